@@ -0,0 +1,75 @@
+#include "complexity.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char *cplx_names[CPLX_COUNT] = {"O(1)", "O(log n)", "O(n)",
+                                      "O(n log n)"};
+
+static double model(cplx_model_t m, double n)
+{
+    switch (m) {
+    case CPLX_LOGN:
+        return log2(n);
+    case CPLX_N:
+        return n;
+    case CPLX_NLOGN:
+        return n * log2(n);
+    default:
+        return 1;
+    }
+}
+
+void cplx_fit(const double *n, const double *t, int count, cplx_fit_t *fit)
+{
+    double mean = 0;
+    for (int i = 0; i < count; i++)
+        mean += t[i];
+    mean = count ? mean / count : 0;
+
+    for (int m = 0; m < CPLX_COUNT; m++) {
+        /* Minimize sum of (t - c * f)^2, which gives c = sum(f t) / sum(f^2) */
+        double ft = 0, ff = 0;
+        for (int i = 0; i < count; i++) {
+            double f = model(m, n[i]);
+            ft += f * t[i];
+            ff += f * f;
+        }
+        double c = ff > 0 ? ft / ff : 0;
+        double err = 0;
+        for (int i = 0; i < count; i++) {
+            double d = t[i] - c * model(m, n[i]);
+            err += d * d;
+        }
+        fit->coef[m] = c;
+        fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+    }
+
+    int best = 0, second = -1;
+    for (int m = 1; m < CPLX_COUNT; m++) {
+        if (fit->error[m] < fit->error[best]) {
+            second = best;
+            best = m;
+        } else if (second < 0 || fit->error[m] < fit->error[second]) {
+            second = m;
+        }
+    }
+    fit->best = best;
+    fit->confidence = fit->error[second] > 0
+                          ? 1 - fit->error[best] / fit->error[second]
+                          : 0;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+double cplx_median(double *v, int count)
+{
+    qsort(v, count, sizeof(double), cmp_double);
+    if (count % 2)
+        return v[count / 2];
+    return (v[count / 2 - 1] + v[count / 2]) / 2;
+}
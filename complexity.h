@@ -0,0 +1,34 @@
+#ifndef LAB0_COMPLEXITY_H
+#define LAB0_COMPLEXITY_H
+
+/*
+ * Classify measured running times by their growth with problem size.
+ * Each model t = c * f(n) is fitted by least squares.  Errors are absolute,
+ * so the largest sizes dominate: small sizes fit in cache and run at a
+ * different cost per element.
+ */
+typedef enum {
+    CPLX_1,
+    CPLX_LOGN,
+    CPLX_N,
+    CPLX_NLOGN,
+    CPLX_COUNT
+} cplx_model_t;
+
+extern const char *cplx_names[CPLX_COUNT];
+
+typedef struct {
+    double coef[CPLX_COUNT];  /* Fitted c of each model */
+    double error[CPLX_COUNT]; /* RMS error of each fit, over mean time */
+    cplx_model_t best;
+    /* 1 - error of best fit / error of runner-up, between 0 and 1 */
+    double confidence;
+} cplx_fit_t;
+
+/* Fit times t measured at sizes n, for count sizes */
+void cplx_fit(const double *n, const double *t, int count, cplx_fit_t *fit);
+
+/* Median of count values.  Reorders v */
+double cplx_median(double *v, int count);
+
+#endif /* LAB0_COMPLEXITY_H */
@@ -0,0 +1,2909 @@
+	.file	"complexity.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "complexity.c"
+	.type	cmp_double, @function
+cmp_double:
+.LVL0:
+.LFB13:
+	.file 1 "complexity.c"
+	.loc 1 64 1 view -0
+	.cfi_startproc
+	.loc 1 65 5 view .LVU1
+# complexity.c:65:     double x = *(const double *) a, y = *(const double *) b;
+	.loc 1 65 12 is_stmt 0 view .LVU2
+	movsd	(%rdi), %xmm0	# MEM[(const double *)a_6(D)], x
+.LVL1:
+# complexity.c:65:     double x = *(const double *) a, y = *(const double *) b;
+	.loc 1 65 37 view .LVU3
+	movsd	(%rsi), %xmm1	# MEM[(const double *)b_8(D)], y
+.LVL2:
+	.loc 1 66 5 is_stmt 1 view .LVU4
+# complexity.c:66:     return (x > y) - (x < y);
+	.loc 1 66 15 is_stmt 0 view .LVU5
+	comisd	%xmm1, %xmm0	# y, x
+	seta	%al	#, tmp92
+	movzbl	%al, %eax	# tmp92, tmp92
+# complexity.c:66:     return (x > y) - (x < y);
+	.loc 1 66 25 view .LVU6
+	comisd	%xmm0, %xmm1	# x, y
+	seta	%dl	#, tmp94
+	movzbl	%dl, %edx	# tmp94, tmp94
+# complexity.c:66:     return (x > y) - (x < y);
+	.loc 1 66 20 view .LVU7
+	subl	%edx, %eax	# tmp94, tmp91
+# complexity.c:67: }
+	.loc 1 67 1 view .LVU8
+	ret	
+	.cfi_endproc
+.LFE13:
+	.size	cmp_double, .-cmp_double
+	.type	model, @function
+model:
+.LVL3:
+.LFB11:
+	.loc 1 10 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 10 1 is_stmt 0 view .LVU10
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%xmm0, %rbx	# tmp88, n
+	.loc 1 11 5 is_stmt 1 view .LVU11
+	cmpl	$2, %edi	#, m
+	je	.L2	#,
+	cmpl	$3, %edi	#, m
+	je	.L4	#,
+	movsd	.LC0(%rip), %xmm0	#, <retval>
+.LVL4:
+	.loc 1 11 5 is_stmt 0 view .LVU12
+	cmpl	$1, %edi	#, m
+	je	.L8	#,
+.LVL5:
+.L2:
+# complexity.c:21: }
+	.loc 1 21 1 view .LVU13
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL6:
+	.loc 1 21 1 view .LVU14
+	ret	
+.LVL7:
+.L8:
+	.cfi_restore_state
+	.loc 1 13 9 is_stmt 1 view .LVU15
+# complexity.c:13:         return log2(n);
+	.loc 1 13 16 is_stmt 0 view .LVU16
+	movq	%rbx, %xmm0	# n,
+	call	log2@PLT	#
+.LVL8:
+	.loc 1 13 16 view .LVU17
+	jmp	.L2	#
+.LVL9:
+.L4:
+	.loc 1 17 9 is_stmt 1 view .LVU18
+# complexity.c:17:         return n * log2(n);
+	.loc 1 17 20 is_stmt 0 view .LVU19
+	call	log2@PLT	#
+.LVL10:
+# complexity.c:17:         return n * log2(n);
+	.loc 1 17 18 view .LVU20
+	movq	%rbx, %xmm1	# n, n
+	mulsd	%xmm1, %xmm0	# n, <retval>
+	jmp	.L2	#
+	.cfi_endproc
+.LFE11:
+	.size	model, .-model
+	.globl	cplx_fit
+	.type	cplx_fit, @function
+cplx_fit:
+.LVL11:
+.LFB12:
+	.loc 1 24 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 24 1 is_stmt 0 view .LVU22
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp	#,
+	.cfi_def_cfa_offset 128
+	movq	%rdi, 40(%rsp)	# tmp175, %sfp
+	movq	%rsi, 48(%rsp)	# t, %sfp
+	movl	%edx, 36(%rsp)	# count, %sfp
+	movq	%rcx, 24(%rsp)	# tmp178, %sfp
+	.loc 1 25 5 is_stmt 1 view .LVU23
+.LVL12:
+	.loc 1 26 5 view .LVU24
+.LBB2:
+	.loc 1 26 10 view .LVU25
+	.loc 1 26 23 view .LVU26
+	testl	%edx, %edx	# count
+	jle	.L10	#,
+	movq	%rsi, %rax	# t, ivtmp.60
+	movslq	%edx, %rdx	# count, count
+.LVL13:
+	.loc 1 26 23 is_stmt 0 view .LVU27
+	leaq	(%rsi,%rdx,8), %rdx	#, _138
+.LBE2:
+# complexity.c:25:     double mean = 0;
+	.loc 1 25 12 view .LVU28
+	pxor	%xmm0, %xmm0	# mean
+.LVL14:
+.L11:
+.LBB3:
+	.loc 1 27 9 is_stmt 1 discriminator 3 view .LVU29
+# complexity.c:27:         mean += t[i];
+	.loc 1 27 14 is_stmt 0 discriminator 3 view .LVU30
+	addsd	(%rax), %xmm0	# MEM[(const double *)_134], mean
+.LVL15:
+	.loc 1 26 33 is_stmt 1 discriminator 3 view .LVU31
+	.loc 1 26 23 discriminator 3 view .LVU32
+	addq	$8, %rax	#, ivtmp.60
+.LVL16:
+	.loc 1 26 23 is_stmt 0 discriminator 3 view .LVU33
+	cmpq	%rdx, %rax	# _138, ivtmp.60
+	jne	.L11	#,
+.LVL17:
+.L12:
+	.loc 1 26 23 discriminator 3 view .LVU34
+.LBE3:
+# complexity.c:28:     mean = count ? mean / count : 0;
+	.loc 1 28 25 discriminator 1 view .LVU35
+	pxor	%xmm1, %xmm1	# tmp145
+	cvtsi2sdl	36(%rsp), %xmm1	# %sfp, tmp145
+# complexity.c:28:     mean = count ? mean / count : 0;
+	.loc 1 28 33 discriminator 1 view .LVU36
+	divsd	%xmm1, %xmm0	# tmp145, mean
+	movsd	%xmm0, 56(%rsp)	# mean, %sfp
+.L13:
+.LVL18:
+	.loc 1 30 5 is_stmt 1 discriminator 4 view .LVU37
+.LBB4:
+	.loc 1 30 10 discriminator 4 view .LVU38
+	.loc 1 30 23 discriminator 4 view .LVU39
+	movslq	36(%rsp), %r12	# %sfp, count
+	salq	$3, %r12	#, _124
+	movq	40(%rsp), %rax	# %sfp, n
+	leaq	(%rax,%r12), %r14	#, _126
+	movq	48(%rsp), %rax	# %sfp, t
+	addq	%rax, %r12	# t, _100
+.LBB5:
+# complexity.c:45:         fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+	.loc 1 45 70 is_stmt 0 discriminator 4 view .LVU40
+	movl	$0, %r15d	#, ivtmp.49
+	jmp	.L14	#
+.LVL19:
+.L10:
+	.loc 1 45 70 discriminator 4 view .LVU41
+.LBE5:
+.LBE4:
+	.loc 1 28 5 is_stmt 1 view .LVU42
+# complexity.c:28:     mean = count ? mean / count : 0;
+	.loc 1 28 33 is_stmt 0 view .LVU43
+	cmpl	$0, 36(%rsp)	#, %sfp
+	jne	.L57	#,
+	movq	$0x000000000, 56(%rsp)	#, %sfp
+	jmp	.L13	#
+.L57:
+# complexity.c:25:     double mean = 0;
+	.loc 1 25 12 view .LVU44
+	pxor	%xmm0, %xmm0	# mean
+	jmp	.L12	#
+.LVL20:
+.L40:
+.LBB16:
+.LBB13:
+# complexity.c:39:         double err = 0;
+	.loc 1 39 16 view .LVU45
+	movq	$0x000000000, (%rsp)	#, %sfp
+	jmp	.L30	#
+.LVL21:
+.L52:
+# complexity.c:45:         fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+	.loc 1 45 45 discriminator 3 view .LVU46
+	call	sqrt@PLT	#
+.LVL22:
+	jmp	.L24	#
+.LVL23:
+.L34:
+	.loc 1 45 45 discriminator 3 view .LVU47
+.LBE13:
+	movl	$1, %eax	#, ivtmp.28
+.LBE16:
+# complexity.c:48:     int best = 0, second = -1;
+	.loc 1 48 19 view .LVU48
+	movl	$-1, %edx	#, second
+# complexity.c:48:     int best = 0, second = -1;
+	.loc 1 48 9 view .LVU49
+	movl	$0, %ecx	#, best
+	jmp	.L25	#
+.LVL24:
+.L36:
+.LBB17:
+	.loc 1 48 9 view .LVU50
+	movl	%ecx, %edx	# best, second
+.LVL25:
+	.loc 1 48 9 view .LVU51
+	movl	%eax, %ecx	# ivtmp.28, best
+.LVL26:
+.L27:
+	.loc 1 49 38 is_stmt 1 discriminator 2 view .LVU52
+	.loc 1 49 23 discriminator 2 view .LVU53
+	addq	$1, %rax	#, ivtmp.28
+.LVL27:
+	.loc 1 49 23 is_stmt 0 discriminator 2 view .LVU54
+	cmpq	$4, %rax	#, ivtmp.28
+	je	.L58	#,
+.LVL28:
+.L25:
+	.loc 1 50 9 is_stmt 1 view .LVU55
+# complexity.c:50:         if (fit->error[m] < fit->error[best]) {
+	.loc 1 50 23 is_stmt 0 view .LVU56
+	movq	24(%rsp), %rbx	# %sfp, fit
+	movsd	32(%rbx,%rax,8), %xmm0	# MEM[(double *)fit_59(D) + 32B + ivtmp.28_55 * 8], _28
+# complexity.c:50:         if (fit->error[m] < fit->error[best]) {
+	.loc 1 50 39 view .LVU57
+	movslq	%ecx, %rsi	# best, best
+# complexity.c:50:         if (fit->error[m] < fit->error[best]) {
+	.loc 1 50 12 view .LVU58
+	movsd	32(%rbx,%rsi,8), %xmm1	# fit_59(D)->error[best_113], fit_59(D)->error[best_113]
+	comisd	%xmm0, %xmm1	# _28, fit_59(D)->error[best_113]
+	ja	.L36	#,
+	.loc 1 53 16 is_stmt 1 view .LVU59
+# complexity.c:53:         } else if (second < 0 || fit->error[m] < fit->error[second]) {
+	.loc 1 53 19 is_stmt 0 view .LVU60
+	testl	%edx, %edx	# second
+	js	.L37	#,
+# complexity.c:53:         } else if (second < 0 || fit->error[m] < fit->error[second]) {
+	.loc 1 53 60 discriminator 1 view .LVU61
+	movslq	%edx, %rsi	# second, second
+# complexity.c:53:         } else if (second < 0 || fit->error[m] < fit->error[second]) {
+	.loc 1 53 31 discriminator 1 view .LVU62
+	movsd	32(%rbx,%rsi,8), %xmm1	# fit_59(D)->error[second_115], fit_59(D)->error[second_115]
+	ucomisd	%xmm0, %xmm1	# _28, fit_59(D)->error[second_115]
+	cmova	%eax, %edx	# second,, m, second
+.LVL29:
+	.loc 1 53 31 discriminator 1 view .LVU63
+	jmp	.L27	#
+.LVL30:
+.L37:
+	.loc 1 53 31 discriminator 1 view .LVU64
+	movl	%eax, %edx	# m, second
+.LVL31:
+	.loc 1 53 31 discriminator 1 view .LVU65
+	jmp	.L27	#
+.LVL32:
+.L58:
+	.loc 1 53 31 discriminator 1 view .LVU66
+.LBE17:
+	.loc 1 57 5 is_stmt 1 view .LVU67
+# complexity.c:57:     fit->best = best;
+	.loc 1 57 15 is_stmt 0 view .LVU68
+	movq	24(%rsp), %rax	# %sfp, fit
+	movl	%ecx, 64(%rax)	# best, fit_59(D)->best
+	.loc 1 58 5 is_stmt 1 view .LVU69
+# complexity.c:58:     fit->confidence = fit->error[second] > 0
+	.loc 1 58 33 is_stmt 0 view .LVU70
+	movslq	%edx, %rdx	# second, second
+	.loc 1 58 33 view .LVU71
+	movsd	32(%rax,%rdx,8), %xmm0	# fit_59(D)->error[second_45], _32
+# complexity.c:60:                           : 0;
+	.loc 1 60 27 view .LVU72
+	pxor	%xmm1, %xmm1	# tmp167
+	comisd	%xmm1, %xmm0	# tmp167, _32
+	jbe	.L54	#,
+# complexity.c:59:                           ? 1 - fit->error[best] / fit->error[second]
+	.loc 1 59 43 discriminator 1 view .LVU73
+	movslq	%ecx, %rcx	# best, best
+.LVL33:
+# complexity.c:59:                           ? 1 - fit->error[best] / fit->error[second]
+	.loc 1 59 50 discriminator 1 view .LVU74
+	movsd	32(%rax,%rcx,8), %xmm1	# fit_59(D)->error[best_43], fit_59(D)->error[best_43]
+	divsd	%xmm0, %xmm1	# _32, tmp170
+# complexity.c:60:                           : 0;
+	.loc 1 60 27 discriminator 1 view .LVU75
+	movsd	.LC0(%rip), %xmm0	#, tmp172
+	subsd	%xmm1, %xmm0	# tmp170, iftmp.6_51
+.L28:
+# complexity.c:58:     fit->confidence = fit->error[second] > 0
+	.loc 1 58 21 view .LVU76
+	movq	24(%rsp), %rax	# %sfp, fit
+.LVL34:
+	.loc 1 58 21 view .LVU77
+	movsd	%xmm0, 72(%rax)	# iftmp.6_51, fit_59(D)->confidence
+.LVL35:
+# complexity.c:61: }
+	.loc 1 61 1 view .LVU78
+	addq	$72, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL36:
+.L54:
+	.cfi_restore_state
+# complexity.c:60:                           : 0;
+	.loc 1 60 27 view .LVU79
+	pxor	%xmm0, %xmm0	# iftmp.6_51
+	jmp	.L28	#
+.LVL37:
+.L59:
+.LBB18:
+.LBB14:
+	.loc 1 39 9 is_stmt 1 view .LVU80
+	.loc 1 40 9 view .LVU81
+.LBB6:
+	.loc 1 40 14 view .LVU82
+	.loc 1 40 27 view .LVU83
+.LBE6:
+	.loc 1 44 9 view .LVU84
+# complexity.c:44:         fit->coef[m] = c;
+	.loc 1 44 22 is_stmt 0 view .LVU85
+	movq	24(%rsp), %rax	# %sfp, fit
+	movq	$0x000000000, (%rax,%r15,8)	#, MEM[(double *)fit_59(D) + ivtmp.49_127 * 8]
+	.loc 1 45 9 is_stmt 1 view .LVU86
+# complexity.c:45:         fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+	.loc 1 45 70 is_stmt 0 view .LVU87
+	cmpl	$0, 36(%rsp)	#, %sfp
+	jne	.L40	#,
+	pxor	%xmm0, %xmm0	# iftmp.4_50
+.LVL38:
+.L20:
+# complexity.c:45:         fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+	.loc 1 45 23 discriminator 6 view .LVU88
+	movq	24(%rsp), %rax	# %sfp, fit
+	movsd	%xmm0, 32(%rax,%r15,8)	# iftmp.4_50, MEM[(double *)fit_59(D) + 32B + ivtmp.49_127 * 8]
+.LBE14:
+	.loc 1 30 38 is_stmt 1 discriminator 6 view .LVU89
+.LVL39:
+	.loc 1 30 23 discriminator 6 view .LVU90
+	addq	$1, %r15	#, ivtmp.49
+.LVL40:
+	.loc 1 30 23 is_stmt 0 discriminator 6 view .LVU91
+	cmpq	$4, %r15	#, ivtmp.49
+	je	.L34	#,
+.LVL41:
+.L14:
+.LBB15:
+.LBB8:
+	.loc 1 33 27 is_stmt 1 view .LVU92
+	cmpl	$0, 36(%rsp)	#, %sfp
+	jle	.L59	#,
+	movq	48(%rsp), %rbp	# %sfp, ivtmp.45
+	movq	40(%rsp), %rbx	# %sfp, ivtmp.44
+.LBE8:
+# complexity.c:32:         double ft = 0, ff = 0;
+	.loc 1 32 24 is_stmt 0 view .LVU93
+	movq	$0x000000000, (%rsp)	#, %sfp
+# complexity.c:32:         double ft = 0, ff = 0;
+	.loc 1 32 16 view .LVU94
+	movq	$0x000000000, 8(%rsp)	#, %sfp
+.LBB10:
+.LBB9:
+# complexity.c:34:             double f = model(m, n[i]);
+	.loc 1 34 24 view .LVU95
+	movl	%r15d, %r13d	# ivtmp.49, ivtmp.49
+.LVL42:
+.L15:
+	.loc 1 34 13 is_stmt 1 discriminator 3 view .LVU96
+# complexity.c:34:             double f = model(m, n[i]);
+	.loc 1 34 24 is_stmt 0 discriminator 3 view .LVU97
+	movsd	(%rbx), %xmm0	# MEM[(const double *)_83], MEM[(const double *)_83]
+	movl	%r13d, %edi	# ivtmp.49,
+	call	model	#
+.LVL43:
+	.loc 1 35 13 is_stmt 1 discriminator 3 view .LVU98
+# complexity.c:35:             ft += f * t[i];
+	.loc 1 35 21 is_stmt 0 discriminator 3 view .LVU99
+	movapd	%xmm0, %xmm1	# f, tmp149
+	mulsd	0(%rbp), %xmm1	# MEM[(const double *)_88], tmp149
+# complexity.c:35:             ft += f * t[i];
+	.loc 1 35 16 discriminator 3 view .LVU100
+	addsd	8(%rsp), %xmm1	# %sfp, tmp149
+	movsd	%xmm1, 8(%rsp)	# tmp149, %sfp
+.LVL44:
+	.loc 1 36 13 is_stmt 1 discriminator 3 view .LVU101
+# complexity.c:36:             ff += f * f;
+	.loc 1 36 21 is_stmt 0 discriminator 3 view .LVU102
+	mulsd	%xmm0, %xmm0	# f, tmp150
+.LVL45:
+# complexity.c:36:             ff += f * f;
+	.loc 1 36 16 discriminator 3 view .LVU103
+	addsd	(%rsp), %xmm0	# %sfp, tmp150
+	movsd	%xmm0, (%rsp)	# tmp150, %sfp
+.LVL46:
+	.loc 1 36 16 discriminator 3 view .LVU104
+.LBE9:
+	.loc 1 33 37 is_stmt 1 discriminator 3 view .LVU105
+	.loc 1 33 27 discriminator 3 view .LVU106
+	addq	$8, %rbx	#, ivtmp.44
+.LVL47:
+	.loc 1 33 27 is_stmt 0 discriminator 3 view .LVU107
+	addq	$8, %rbp	#, ivtmp.45
+	cmpq	%r14, %rbx	# _126, ivtmp.44
+	jne	.L15	#,
+.LBE10:
+	.loc 1 38 9 is_stmt 1 view .LVU108
+# complexity.c:38:         double c = ff > 0 ? ft / ff : 0;
+	.loc 1 38 37 is_stmt 0 view .LVU109
+	pxor	%xmm2, %xmm2	# tmp197
+	comisd	%xmm2, %xmm0	# tmp197, ff
+	jbe	.L49	#,
+# complexity.c:38:         double c = ff > 0 ? ft / ff : 0;
+	.loc 1 38 37 discriminator 1 view .LVU110
+	movapd	%xmm1, %xmm3	# tmp149, ft
+	divsd	%xmm0, %xmm3	# ff, ft
+	movsd	%xmm3, 16(%rsp)	# ft, %sfp
+.L16:
+.LVL48:
+	.loc 1 39 9 is_stmt 1 view .LVU111
+	.loc 1 40 9 view .LVU112
+.LBB11:
+	.loc 1 40 14 view .LVU113
+	.loc 1 40 27 view .LVU114
+	.loc 1 40 27 is_stmt 0 view .LVU115
+.LBE11:
+# complexity.c:32:         double ft = 0, ff = 0;
+	.loc 1 32 16 view .LVU116
+	movq	40(%rsp), %rbp	# %sfp, ivtmp.38
+	movq	48(%rsp), %rbx	# %sfp, ivtmp.37
+.LVL49:
+# complexity.c:39:         double err = 0;
+	.loc 1 39 16 view .LVU117
+	movq	$0x000000000, (%rsp)	#, %sfp
+.LBB12:
+.LBB7:
+# complexity.c:41:             double d = t[i] - c * model(m, n[i]);
+	.loc 1 41 35 view .LVU118
+	movl	%r15d, %r13d	# ivtmp.49, ivtmp.49
+.LVL50:
+.L18:
+	.loc 1 41 13 is_stmt 1 discriminator 3 view .LVU119
+# complexity.c:41:             double d = t[i] - c * model(m, n[i]);
+	.loc 1 41 25 is_stmt 0 discriminator 3 view .LVU120
+	movsd	(%rbx), %xmm2	# MEM[(const double *)_38], _18
+	movsd	%xmm2, 8(%rsp)	# _18, %sfp
+# complexity.c:41:             double d = t[i] - c * model(m, n[i]);
+	.loc 1 41 35 discriminator 3 view .LVU121
+	movsd	0(%rbp), %xmm0	# MEM[(const double *)_91], MEM[(const double *)_91]
+	movl	%r13d, %edi	# ivtmp.49,
+	call	model	#
+.LVL51:
+# complexity.c:41:             double d = t[i] - c * model(m, n[i]);
+	.loc 1 41 33 discriminator 3 view .LVU122
+	mulsd	16(%rsp), %xmm0	# %sfp, tmp154
+# complexity.c:41:             double d = t[i] - c * model(m, n[i]);
+	.loc 1 41 20 discriminator 3 view .LVU123
+	movsd	8(%rsp), %xmm1	# %sfp, _18
+	subsd	%xmm0, %xmm1	# tmp154, _18
+.LVL52:
+	.loc 1 42 13 is_stmt 1 discriminator 3 view .LVU124
+# complexity.c:42:             err += d * d;
+	.loc 1 42 22 is_stmt 0 discriminator 3 view .LVU125
+	mulsd	%xmm1, %xmm1	# d, tmp155
+.LVL53:
+# complexity.c:42:             err += d * d;
+	.loc 1 42 17 discriminator 3 view .LVU126
+	addsd	(%rsp), %xmm1	# %sfp, tmp155
+	movsd	%xmm1, (%rsp)	# tmp155, %sfp
+.LVL54:
+	.loc 1 42 17 discriminator 3 view .LVU127
+.LBE7:
+	.loc 1 40 37 is_stmt 1 discriminator 3 view .LVU128
+	.loc 1 40 27 discriminator 3 view .LVU129
+	addq	$8, %rbx	#, ivtmp.37
+.LVL55:
+	.loc 1 40 27 is_stmt 0 discriminator 3 view .LVU130
+	addq	$8, %rbp	#, ivtmp.38
+	cmpq	%r12, %rbx	# _100, ivtmp.37
+	jne	.L18	#,
+.LBE12:
+	.loc 1 44 9 is_stmt 1 view .LVU131
+# complexity.c:44:         fit->coef[m] = c;
+	.loc 1 44 22 is_stmt 0 view .LVU132
+	movq	24(%rsp), %rax	# %sfp, fit
+	movsd	16(%rsp), %xmm7	# %sfp, iftmp.2_64
+	movsd	%xmm7, (%rax,%r15,8)	# iftmp.2_64, MEM[(double *)fit_59(D) + ivtmp.49_127 * 8]
+	.loc 1 45 9 is_stmt 1 view .LVU133
+.LVL56:
+.L30:
+# complexity.c:45:         fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+	.loc 1 45 31 is_stmt 0 discriminator 1 view .LVU134
+	movsd	56(%rsp), %xmm7	# %sfp, iftmp.0_48
+	pxor	%xmm4, %xmm4	# tmp206
+# complexity.c:45:         fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+	.loc 1 45 70 discriminator 1 view .LVU135
+	pxor	%xmm0, %xmm0	# iftmp.4_50
+# complexity.c:45:         fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+	.loc 1 45 31 discriminator 1 view .LVU136
+	comisd	%xmm4, %xmm7	# tmp206, iftmp.0_48
+	jbe	.L20	#,
+# complexity.c:45:         fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+	.loc 1 45 45 discriminator 3 view .LVU137
+	pxor	%xmm1, %xmm1	# tmp157
+	cvtsi2sdl	36(%rsp), %xmm1	# %sfp, tmp157
+	movsd	(%rsp), %xmm0	# %sfp, err
+	divsd	%xmm1, %xmm0	# tmp157, err
+	pxor	%xmm1, %xmm1	# tmp158
+	ucomisd	%xmm0, %xmm1	# _26, tmp158
+	ja	.L52	#,
+# complexity.c:45:         fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+	.loc 1 45 45 view .LVU138
+	sqrtsd	%xmm0, %xmm0	# _26, _27
+.L24:
+# complexity.c:45:         fit->error[m] = count && mean > 0 ? sqrt(err / count) / mean : 0;
+	.loc 1 45 70 discriminator 3 view .LVU139
+	divsd	56(%rsp), %xmm0	# %sfp, iftmp.4_50
+	jmp	.L20	#
+.LVL57:
+.L49:
+# complexity.c:38:         double c = ff > 0 ? ft / ff : 0;
+	.loc 1 38 37 view .LVU140
+	movq	$0x000000000, 16(%rsp)	#, %sfp
+	jmp	.L16	#
+.LBE15:
+.LBE18:
+	.cfi_endproc
+.LFE12:
+	.size	cplx_fit, .-cplx_fit
+	.globl	cplx_median
+	.type	cplx_median, @function
+cplx_median:
+.LVL58:
+.LFB14:
+	.loc 1 70 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 70 1 is_stmt 0 view .LVU142
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp	# tmp117, v
+	movl	%esi, %ebx	# tmp118, count
+	.loc 1 71 5 is_stmt 1 view .LVU143
+	movslq	%esi, %rsi	# count, count
+.LVL59:
+	.loc 1 71 5 is_stmt 0 view .LVU144
+	leaq	cmp_double(%rip), %rcx	#, tmp101
+	movl	$8, %edx	#,
+	call	qsort@PLT	#
+.LVL60:
+	.loc 1 72 5 is_stmt 1 view .LVU145
+# complexity.c:72:     if (count % 2)
+	.loc 1 72 8 is_stmt 0 view .LVU146
+	testb	$1, %bl	#, count
+	jne	.L64	#,
+	.loc 1 74 5 is_stmt 1 view .LVU147
+# complexity.c:74:     return (v[count / 2 - 1] + v[count / 2]) / 2;
+	.loc 1 74 21 is_stmt 0 view .LVU148
+	movl	%ebx, %eax	# count, tmp109
+	shrl	$31, %eax	#, tmp109
+	addl	%ebx, %eax	# count, tmp110
+	sarl	%eax	# tmp111
+	cltq
+# complexity.c:74:     return (v[count / 2 - 1] + v[count / 2]) / 2;
+	.loc 1 74 30 view .LVU149
+	movsd	-8(%rbp,%rax,8), %xmm0	# *_10, *_10
+	addsd	0(%rbp,%rax,8), %xmm0	# *_12, tmp113
+# complexity.c:74:     return (v[count / 2 - 1] + v[count / 2]) / 2;
+	.loc 1 74 46 view .LVU150
+	mulsd	.LC2(%rip), %xmm0	#, <retval>
+.L60:
+# complexity.c:75: }
+	.loc 1 75 1 view .LVU151
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL61:
+	.loc 1 75 1 view .LVU152
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL62:
+	.loc 1 75 1 view .LVU153
+	ret	
+.LVL63:
+.L64:
+	.cfi_restore_state
+	.loc 1 73 9 is_stmt 1 view .LVU154
+# complexity.c:73:         return v[count / 2];
+	.loc 1 73 24 is_stmt 0 view .LVU155
+	movl	%ebx, %eax	# count, tmp104
+	shrl	$31, %eax	#, tmp104
+	addl	%ebx, %eax	# count, tmp105
+	sarl	%eax	# tmp106
+	cltq
+# complexity.c:73:         return v[count / 2];
+	.loc 1 73 17 view .LVU156
+	movsd	0(%rbp,%rax,8), %xmm0	# *_5, <retval>
+	jmp	.L60	#
+	.cfi_endproc
+.LFE14:
+	.size	cplx_median, .-cplx_median
+	.globl	cplx_names
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"O(1)"
+.LC4:
+	.string	"O(log n)"
+.LC5:
+	.string	"O(n)"
+.LC6:
+	.string	"O(n log n)"
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	cplx_names, @object
+	.size	cplx_names, 32
+cplx_names:
+	.quad	.LC3
+	.quad	.LC4
+	.quad	.LC5
+	.quad	.LC6
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	0
+	.long	1072693248
+	.align 8
+.LC2:
+	.long	0
+	.long	1071644672
+	.text
+.Letext0:
+	.file 2 "complexity.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/stdlib.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x514
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x15
+	.long	.LASF33
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF7
+	.uleb128 0x16
+	.byte	0x7
+	.byte	0x4
+	.long	0x62
+	.byte	0x2
+	.byte	0xa
+	.byte	0xe
+	.long	0x62
+	.uleb128 0x7
+	.long	.LASF2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF4
+	.byte	0x2
+	.uleb128 0x7
+	.long	.LASF5
+	.byte	0x3
+	.uleb128 0x7
+	.long	.LASF6
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0xa
+	.long	.LASF15
+	.byte	0x2
+	.byte	0x10
+	.byte	0x3
+	.long	0x35
+	.uleb128 0xe
+	.long	0x8b
+	.long	0x84
+	.uleb128 0xf
+	.long	0x84
+	.byte	0
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF9
+	.uleb128 0x5
+	.long	0x97
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x10
+	.long	0x90
+	.uleb128 0x17
+	.long	.LASF30
+	.byte	0x2
+	.byte	0x12
+	.byte	0x14
+	.long	0x75
+	.uleb128 0x18
+	.byte	0x50
+	.byte	0x2
+	.byte	0x14
+	.byte	0x9
+	.long	0xe2
+	.uleb128 0x8
+	.long	.LASF11
+	.byte	0x15
+	.byte	0xc
+	.long	0xe2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF12
+	.byte	0x16
+	.byte	0xc
+	.long	0xe2
+	.byte	0x20
+	.uleb128 0x8
+	.long	.LASF13
+	.byte	0x17
+	.byte	0x12
+	.long	0x69
+	.byte	0x40
+	.uleb128 0x8
+	.long	.LASF14
+	.byte	0x19
+	.byte	0xc
+	.long	0x2e
+	.byte	0x48
+	.byte	0
+	.uleb128 0xe
+	.long	0x2e
+	.long	0xf1
+	.uleb128 0xf
+	.long	0x84
+	.byte	0
+	.uleb128 0x10
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x3
+	.long	0xa8
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF17
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF19
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF20
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF21
+	.uleb128 0x1a
+	.byte	0x8
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF22
+	.uleb128 0xa
+	.long	.LASF23
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x84
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF24
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF25
+	.uleb128 0x1b
+	.long	.LASF26
+	.byte	0x4
+	.value	0x33d
+	.byte	0xf
+	.long	0x15c
+	.uleb128 0x5
+	.long	0x161
+	.uleb128 0x1c
+	.long	0x11e
+	.long	0x175
+	.uleb128 0x3
+	.long	0x175
+	.uleb128 0x3
+	.long	0x175
+	.byte	0
+	.uleb128 0x5
+	.long	0x17a
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.long	0x9c
+	.byte	0x1
+	.byte	0x6
+	.byte	0xd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cplx_names
+	.uleb128 0x1f
+	.long	.LASF34
+	.byte	0x4
+	.value	0x353
+	.byte	0xd
+	.long	0x1af
+	.uleb128 0x3
+	.long	0x12c
+	.uleb128 0x3
+	.long	0x135
+	.uleb128 0x3
+	.long	0x135
+	.uleb128 0x3
+	.long	0x14f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF27
+	.byte	0x85
+	.long	0x2e
+	.long	0x1c3
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF28
+	.byte	0x8f
+	.long	0x2e
+	.long	0x1d7
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF35
+	.byte	0x1
+	.byte	0x45
+	.byte	0x8
+	.long	0x2e
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x250
+	.uleb128 0x6
+	.string	"v"
+	.byte	0x45
+	.byte	0x1c
+	.long	0x250
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x12
+	.long	.LASF29
+	.byte	0x45
+	.byte	0x23
+	.long	0x11e
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0xb
+	.quad	.LVL60
+	.long	0x18d
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmp_double
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x21
+	.long	.LASF36
+	.byte	0x1
+	.byte	0x3f
+	.byte	0xc
+	.long	0x11e
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ae
+	.uleb128 0x13
+	.string	"a"
+	.byte	0x23
+	.long	0x175
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x13
+	.string	"b"
+	.byte	0x32
+	.long	0x175
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x41
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x41
+	.byte	0x25
+	.long	0x2e
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x17
+	.byte	0x6
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4a6
+	.uleb128 0x6
+	.string	"n"
+	.byte	0x17
+	.byte	0x1d
+	.long	0x4a6
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x6
+	.string	"t"
+	.byte	0x17
+	.byte	0x2e
+	.long	0x4a6
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x12
+	.long	.LASF29
+	.byte	0x17
+	.byte	0x35
+	.long	0x11e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x6
+	.string	"fit"
+	.byte	0x17
+	.byte	0x48
+	.long	0x4ab
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xc
+	.long	.LASF31
+	.byte	0x19
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xc
+	.long	.LASF13
+	.byte	0x30
+	.byte	0x9
+	.long	0x11e
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xc
+	.long	.LASF32
+	.byte	0x30
+	.byte	0x13
+	.long	0x11e
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x9
+	.long	.LLRL11
+	.long	0x368
+	.uleb128 0x1
+	.string	"i"
+	.byte	0x1a
+	.byte	0xe
+	.long	0x11e
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x9
+	.long	.LLRL13
+	.long	0x482
+	.uleb128 0x1
+	.string	"m"
+	.byte	0x1e
+	.byte	0xe
+	.long	0x11e
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x23
+	.long	.LLRL15
+	.uleb128 0x1
+	.string	"ft"
+	.byte	0x20
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x1
+	.string	"ff"
+	.byte	0x20
+	.byte	0x18
+	.long	0x2e
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1
+	.string	"c"
+	.byte	0x26
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.string	"err"
+	.byte	0x27
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x9
+	.long	.LLRL23
+	.long	0x421
+	.uleb128 0x1
+	.string	"i"
+	.byte	0x21
+	.byte	0x12
+	.long	0x11e
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xd
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x1
+	.string	"f"
+	.byte	0x22
+	.byte	0x14
+	.long	0x2e
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0xb
+	.quad	.LVL43
+	.long	0x4b0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LLRL20
+	.long	0x473
+	.uleb128 0x1
+	.string	"i"
+	.byte	0x28
+	.byte	0x12
+	.long	0x11e
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xd
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x1
+	.string	"d"
+	.byte	0x29
+	.byte	0x14
+	.long	0x2e
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xb
+	.quad	.LVL51
+	.long	0x4b0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL22
+	.long	0x1c3
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.uleb128 0x1
+	.string	"m"
+	.byte	0x31
+	.byte	0xe
+	.long	0x11e
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xf1
+	.uleb128 0x5
+	.long	0xf6
+	.uleb128 0x24
+	.long	.LASF38
+	.byte	0x1
+	.byte	0x9
+	.byte	0xf
+	.long	0x2e
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x6
+	.string	"m"
+	.byte	0x9
+	.byte	0x22
+	.long	0x69
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x6
+	.string	"n"
+	.byte	0x9
+	.byte	0x2c
+	.long	0x2e
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x25
+	.quad	.LVL8
+	.long	0x1af
+	.long	0x509
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL10
+	.long	0x1af
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 63
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE14-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE14-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU3
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE13-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU4
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE13-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU24
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU34
+	.uleb128 .LVU37
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU50
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU78
+	.uleb128 .LVU79
+	.uleb128 .LVU80
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 64
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU50
+	.uleb128 .LVU51
+	.uleb128 .LVU52
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU65
+	.uleb128 .LVU66
+	.uleb128 .LVU80
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU26
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU34
+	.uleb128 .LVU41
+	.uleb128 .LVU45
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU39
+	.uleb128 .LVU41
+	.uleb128 .LVU45
+	.uleb128 .LVU47
+	.uleb128 .LVU80
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU91
+	.uleb128 .LVU92
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+	.uleb128 .LVU80
+	.uleb128 .LVU88
+	.uleb128 .LVU92
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU119
+	.uleb128 .LVU140
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+	.uleb128 .LVU80
+	.uleb128 .LVU88
+	.uleb128 .LVU92
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU119
+	.uleb128 .LVU140
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+	.uleb128 .LVU80
+	.uleb128 .LVU88
+	.uleb128 .LVU111
+	.uleb128 .LVU134
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+	.uleb128 .LVU81
+	.uleb128 .LVU88
+	.uleb128 .LVU112
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU134
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+	.uleb128 .LVU80
+	.uleb128 .LVU88
+	.uleb128 .LVU92
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU117
+	.uleb128 .LVU140
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0xe
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0xe
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU98
+	.uleb128 .LVU103
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+	.uleb128 .LVU83
+	.uleb128 .LVU88
+	.uleb128 .LVU114
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU134
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0xe
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU124
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU134
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0xb
+	.byte	0x91
+	.sleb128 -120
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU50
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU54
+	.uleb128 .LVU55
+	.uleb128 .LVU66
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 .LFE11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE11-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF2:
+	.string	"CPLX_1"
+.LASF3:
+	.string	"CPLX_LOGN"
+.LASF29:
+	.string	"count"
+.LASF5:
+	.string	"CPLX_NLOGN"
+.LASF4:
+	.string	"CPLX_N"
+.LASF22:
+	.string	"float"
+.LASF34:
+	.string	"qsort"
+.LASF17:
+	.string	"unsigned char"
+.LASF9:
+	.string	"long unsigned int"
+.LASF18:
+	.string	"short unsigned int"
+.LASF23:
+	.string	"size_t"
+.LASF14:
+	.string	"confidence"
+.LASF32:
+	.string	"second"
+.LASF7:
+	.string	"double"
+.LASF35:
+	.string	"cplx_median"
+.LASF31:
+	.string	"mean"
+.LASF36:
+	.string	"cmp_double"
+.LASF28:
+	.string	"sqrt"
+.LASF8:
+	.string	"unsigned int"
+.LASF25:
+	.string	"long long unsigned int"
+.LASF11:
+	.string	"coef"
+.LASF15:
+	.string	"cplx_model_t"
+.LASF30:
+	.string	"cplx_names"
+.LASF16:
+	.string	"cplx_fit_t"
+.LASF12:
+	.string	"error"
+.LASF24:
+	.string	"long long int"
+.LASF26:
+	.string	"__compar_fn_t"
+.LASF10:
+	.string	"char"
+.LASF27:
+	.string	"log2"
+.LASF20:
+	.string	"short int"
+.LASF38:
+	.string	"model"
+.LASF13:
+	.string	"best"
+.LASF21:
+	.string	"long int"
+.LASF19:
+	.string	"signed char"
+.LASF33:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF37:
+	.string	"cplx_fit"
+.LASF6:
+	.string	"CPLX_COUNT"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"complexity.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
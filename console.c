@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/select.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -21,8 +22,33 @@ bool simulation = false;
 bool old_measure = false;
 bool write_data;
 int total_measurements = 100000;
+int crop_window = 0;
+int dudect_workers = 1;
+int timing_backend = 0;
+int dudect_pool = 0;
+int dudect_sequential = 0;
 static cmd_ptr cmd_list = NULL;
 static param_ptr param_list = NULL;
+
+/*
+ * Commands and parameters are also indexed by name in open-addressed hash
+ * tables, so that dispatching a line does not scan the lists.
+ * Table sizes are powers of two, kept at most half full.
+ */
+#define TABLE_MIN_SIZE 64
+typedef struct {
+    char *name;
+    void *ele;
+} slot_t;
+
+typedef struct {
+    slot_t *slots;
+    size_t size;
+    size_t cnt;
+} name_table_t;
+
+static name_table_t cmd_table;
+static name_table_t param_table;
 static bool block_flag = false;
 static bool prompt_flag = true;
 
@@ -36,21 +62,33 @@ static double last_time;
 /*
  * Implement buffered I/O using variant of RIO package from CS:APP
  * Must create stack of buffers to handle I/O with nested source commands.
+ * Lines are handed out in place, as views into the buffer.
+ * A line longer than the buffer is split.
+ * Regular files are instead memory-mapped, and lines copied out of the map.
  */
 
-#define RIO_BUFSIZE 8192
+#define RIO_BUFSIZE 65536
 typedef struct RIO_ELE rio_t, *rio_ptr;
 
 struct RIO_ELE {
-    int fd;                /* File descriptor */
-    int cnt;               /* Unread bytes in internal buffer */
-    char *bufptr;          /* Next unread byte in internal buffer */
-    char buf[RIO_BUFSIZE]; /* Internal buffer */
-    rio_ptr prev;          /* Next element in stack */
+    int fd;                    /* File descriptor */
+    int cnt;                   /* Unread bytes in internal buffer */
+    int scan;                  /* Unread bytes known to hold no newline */
+    char *bufptr;              /* Next unread byte in internal buffer */
+    char buf[RIO_BUFSIZE + 1]; /* Internal buffer, plus room for null */
+    char *map;                 /* Mapped file contents, or NULL */
+    char *map_end;             /* End of mapped contents */
+    double start_time;         /* When file was opened */
+    rio_ptr prev;              /* Next element in stack */
 };
 
 static rio_ptr buf_stack;
-static char linebuf[RIO_BUFSIZE];
+
+/*
+ * Holds lines copied out of mapped files, and last line of a file,
+ * since its buffer is gone after EOF
+ */
+static char linebuf[RIO_BUFSIZE + 1];
 
 /* Maximum file descriptor */
 static int fd_max = 0;
@@ -59,6 +97,7 @@ static int fd_max = 0;
 static int err_limit = 5;
 static int err_cnt = 0;
 static bool echo = 0;
+static bool quit_stats = false;
 
 static bool quit_flag = false;
 static char *prompt = "cmd> ";
@@ -70,6 +109,10 @@ static char *prompt = "cmd> ";
 static cmd_function quit_helpers[MAXQUIT];
 static int quit_helper_cnt = 0;
 
+static metrics_function metrics_helper = NULL;
+/* Commands run by other commands, such as repeat, are not recorded */
+static int cmd_depth = 0;
+
 static bool do_quit_cmd(int argc, char *argv[]);
 static bool do_help_cmd(int argc, char *argv[]);
 static bool do_option_cmd(int argc, char *argv[]);
@@ -77,19 +120,91 @@ static bool do_source_cmd(int argc, char *argv[]);
 static bool do_log_cmd(int argc, char *argv[]);
 static bool do_time_cmd(int argc, char *argv[]);
 static bool do_comment_cmd(int argc, char *argv[]);
+static bool do_repeat_cmd(int argc, char *argv[]);
+static bool do_stats_cmd(int argc, char *argv[]);
+static bool do_metrics_cmd(int argc, char *argv[]);
 
 static void init_in();
+static void async_changed(int oldval);
 
 static bool push_file(char *fname);
 static void pop_file();
+static char *readline();
+
+/* Where body lines of repeat blocks come from */
+static char *(*line_source)() = readline;
 
 static bool interpret_cmda(int argc, char *argv[]);
 
+/* FNV-1a hash of name */
+static inline uint32_t hash_name(const char *name)
+{
+    uint32_t h = 2166136261u;
+    while (*name) {
+        h ^= (unsigned char) *name++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* Find slot holding name, or empty slot where it belongs */
+static slot_t *table_slot(slot_t *slots, size_t size, const char *name)
+{
+    size_t i = hash_name(name) & (size - 1);
+    while (slots[i].name && strcmp(slots[i].name, name) != 0)
+        i = (i + 1) & (size - 1);
+    return &slots[i];
+}
+
+/* Look up element by name.  Return NULL if not present */
+static void *table_find(name_table_t *table, const char *name)
+{
+    if (!table->slots)
+        return NULL;
+    return table_slot(table->slots, table->size, name)->ele;
+}
+
+/* Add element to table.  Replaces any element with same name */
+static void table_insert(name_table_t *table, char *name, void *ele)
+{
+    if (2 * (table->cnt + 1) > table->size) {
+        size_t size = table->size ? 2 * table->size : TABLE_MIN_SIZE;
+        slot_t *slots = calloc_or_fail(size, sizeof(slot_t), "table_insert");
+        for (size_t i = 0; i < table->size; i++) {
+            if (table->slots[i].name)
+                *table_slot(slots, size, table->slots[i].name) =
+                    table->slots[i];
+        }
+        if (table->slots)
+            free_array(table->slots, table->size, sizeof(slot_t));
+        table->slots = slots;
+        table->size = size;
+    }
+
+    slot_t *slot = table_slot(table->slots, table->size, name);
+    if (!slot->name)
+        table->cnt++;
+    slot->name = name;
+    slot->ele = ele;
+}
+
+/* Release storage of table */
+static void table_clear(name_table_t *table)
+{
+    if (table->slots)
+        free_array(table->slots, table->size, sizeof(slot_t));
+    table->slots = NULL;
+    table->size = 0;
+    table->cnt = 0;
+}
+
 /* Initialize interpreter */
 void init_cmd()
 {
     cmd_list = NULL;
     param_list = NULL;
+    table_clear(&cmd_table);
+    table_clear(&param_table);
     err_cnt = 0;
     quit_flag = false;
 
@@ -102,16 +217,43 @@ void init_cmd()
     add_cmd("log", do_log_cmd, " file           | Copy output to file");
     add_cmd("time", do_time_cmd, " cmd arg ...    | Time command execution");
     add_cmd("#", do_comment_cmd, " ...            | Display comment");
+    add_cmd("repeat", do_repeat_cmd,
+            " n cmd arg ...  | Run command n times.  'repeat n {' runs "
+            "following lines up to '}' n times");
+    add_cmd("stats", do_stats_cmd,
+            "                | Show timing statistics of each command");
+    add_cmd("metrics", do_metrics_cmd,
+            " [file]         | Write JSON record of each command to file.  "
+            "Stop if no file given");
     add_param("simulation", (int *) &simulation, "Start/Stop simulation mode",
               NULL);
     add_param("verbose", &verblevel, "Verbosity level", NULL);
     add_param("error", &err_limit, "Number of errors until exit", NULL);
     add_param("echo", (int *) &echo, "Do/don't echo commands", NULL);
+    add_param("async", (int *) &async_output,
+              "Do/don't write output from background thread", async_changed);
+    add_param("stats", (int *) &quit_stats,
+              "Do/don't show command timing statistics at exit", NULL);
     add_param("measures", &total_measurements,
               "Number of measurements for simulation", NULL);
+    add_param("cropwindow", &crop_window,
+              "Batches used to set cropping thresholds (0 = first batch only)",
+              NULL);
+    add_param("workers", &dudect_workers,
+              "Number of processes doing simulation measurements", NULL);
+    add_param("timer", &timing_backend,
+              "Simulation timer: 0 rdtsc, 1 lfence+rdtsc, 2 rdtscp, "
+              "3 perf cycles, 4 perf instructions",
+              NULL);
+    add_param("pool", &dudect_pool,
+              "Queues per class reused across simulation samples "
+              "(0 = build per sample)",
+              NULL);
+    add_param("sequential", &dudect_sequential,
+              "Stop simulation once the verdict is settled", NULL);
     add_param("old", (int *) &old_measure, "Use the old measure function",
               NULL);
-    add_param("write", (int *) &write_data, "Write measurements to ./meas.txt",
+    add_param("write", (int *) &write_data, "Write measurements to ./meas.bin",
               NULL);
 
     init_in();
@@ -133,8 +275,13 @@ void add_cmd(char *name, cmd_function operation, char *documentation)
     ele->name = name;
     ele->operation = operation;
     ele->documentation = documentation;
+    ele->calls = 0;
+    ele->total_ns = 0;
+    ele->min_ns = UINT64_MAX;
+    ele->max_ns = 0;
     ele->next = next_cmd;
     *last_loc = ele;
+    table_insert(&cmd_table, name, ele);
 }
 
 /* Add a new parameter */
@@ -157,52 +304,52 @@ void add_param(char *name,
     ele->setter = setter;
     ele->next = next_param;
     *last_loc = ele;
+    table_insert(&param_table, name, ele);
 }
 
-/* Parse a string into a command line */
-static char **parse_args(char *line, int *argcp)
+/* Arguments that fit in stack array of interpret_cmd */
+#define MAXARGS 32
+
+/*
+ * Split command line into arguments in place, by null-terminating each word.
+ * Pointers to the first max_args words are stored in argv.
+ * Return number of words, which may exceed max_args.
+ */
+static int parse_args(char *line, char **argv, int max_args, char **endp)
 {
-    /*
-     * Must first determine how many arguments there are.
-     * Replace all white space with null characters
-     */
-    size_t len = strlen(line);
-    /* First copy into buffer with each substring null-terminated */
-    char *buf = malloc_or_fail(len + 1, "parse_args");
     char *src = line;
-    char *dst = buf;
-    bool skipping = true;
-
-    int c;
     int argc = 0;
-    while ((c = *src++) != '\0') {
-        if (isspace(c)) {
-            if (!skipping) {
-                /* Hit end of word */
-                *dst++ = '\0';
-                skipping = true;
-            }
-        } else {
-            if (skipping) {
-                /* Hit start of new word */
-                argc++;
-                skipping = false;
-            }
-            *dst++ = c;
-        }
+    for (;;) {
+        while (isspace((unsigned char) *src))
+            src++;
+        if (*src == '\0')
+            break;
+        if (argc < max_args)
+            argv[argc] = src;
+        argc++;
+        while (*src != '\0' && !isspace((unsigned char) *src))
+            src++;
+        if (*src == '\0')
+            break;
+        *src++ = '\0';
     }
+    *endp = src;
+    return argc;
+}
 
-    /* Now assemble into array of strings */
-    char **argv = calloc_or_fail(argc, sizeof(char *), "parse_args");
-    src = buf;
-    for (int i = 0; i < argc; i++) {
-        argv[i] = strsave_or_fail(src, "parse_args");
-        src += strlen(argv[i]) + 1;
+/* Collect all words of line already split by parse_args, ending at end */
+static void collect_args(char *line, char *end, char **argv)
+{
+    char *src = line;
+    int argc = 0;
+    while (src < end) {
+        while (src < end && (*src == '\0' || isspace((unsigned char) *src)))
+            src++;
+        if (src == end)
+            break;
+        argv[argc++] = src;
+        src += strlen(src);
     }
-
-    free_block(buf, len + 1);
-    *argcp = argc;
-    return argv;
 }
 
 static void record_error()
@@ -214,19 +361,38 @@ static void record_error()
     }
 }
 
-/* Execute a command that has already been split into arguments */
-static bool interpret_cmda(int argc, char *argv[])
+/* Execute command that has already been looked up.  NULL if unknown */
+static bool run_cmd(cmd_ptr next_cmd, int argc, char *argv[])
 {
-    if (argc == 0)
-        return true;
-
-    /* Try to find matching command */
-    cmd_ptr next_cmd = cmd_list;
     bool ok = true;
-    while (next_cmd && strcmp(argv[0], next_cmd->name) != 0)
-        next_cmd = next_cmd->next;
     if (next_cmd) {
+        bool record = cmd_depth == 0 && metrics_enabled();
+        if (record) {
+            metric_begin(argc, argv);
+            if (metrics_helper)
+                metrics_helper(false);
+        }
+        cmd_depth++;
+        uint64_t start = time_ns();
         ok = next_cmd->operation(argc, argv);
+        uint64_t elapsed = time_ns() - start;
+        cmd_depth--;
+        if (record) {
+            metric_int("ns", elapsed);
+            metric_bool("ok", ok);
+            if (metrics_helper)
+                metrics_helper(true);
+            metric_end();
+        }
+        /* Command may have been quit, releasing next_cmd */
+        if (!quit_flag) {
+            next_cmd->calls++;
+            next_cmd->total_ns += elapsed;
+            if (elapsed < next_cmd->min_ns)
+                next_cmd->min_ns = elapsed;
+            if (elapsed > next_cmd->max_ns)
+                next_cmd->max_ns = elapsed;
+        }
         if (!ok)
             record_error();
     } else {
@@ -238,6 +404,16 @@ static bool interpret_cmda(int argc, char *argv[])
     return ok;
 }
 
+/* Execute a command that has already been split into arguments */
+static bool interpret_cmda(int argc, char *argv[])
+{
+    if (argc == 0)
+        return true;
+
+    /* Try to find matching command */
+    return run_cmd(table_find(&cmd_table, argv[0]), argc, argv);
+}
+
 /* Execute a command from a command line */
 static bool interpret_cmd(char *cmdline)
 {
@@ -247,16 +423,27 @@ static bool interpret_cmd(char *cmdline)
 #if RPT >= 6
     report(6, "Interpreting command '%s'\n", cmdline);
 #endif
-    int argc;
-    char **argv = parse_args(cmdline, &argc);
+    char *stack_argv[MAXARGS];
+    char *end;
+    int argc = parse_args(cmdline, stack_argv, MAXARGS, &end);
+    if (argc <= MAXARGS)
+        return interpret_cmda(argc, stack_argv);
+
+    /* Very long line: need room for every argument */
+    char **argv = calloc_or_fail(argc, sizeof(char *), "interpret_cmd");
+    collect_args(cmdline, end, argv);
     bool ok = interpret_cmda(argc, argv);
-    for (int i = 0; i < argc; i++)
-        free_string(argv[i]);
     free_array(argv, argc, sizeof(char *));
 
     return ok;
 }
 
+/* Output may have been left in buffers by previous mode */
+static void async_changed(int oldval)
+{
+    report_flush();
+}
+
 /* Set function to be executed as part of program exit */
 void add_quit_helper(cmd_function qf)
 {
@@ -266,6 +453,12 @@ void add_quit_helper(cmd_function qf)
         report_event(MSG_FATAL, "Exceeded limit on quit helpers");
 }
 
+/* Set function that adds fields to each metrics record */
+void set_metrics_helper(metrics_function mf)
+{
+    metrics_helper = mf;
+}
+
 /* Turn echoing on/off */
 void set_echo(bool on)
 {
@@ -275,6 +468,9 @@ void set_echo(bool on)
 /* Built-in commands */
 static bool do_quit_cmd(int argc, char *argv[])
 {
+    if (quit_stats)
+        do_stats_cmd(0, NULL);
+
     cmd_ptr c = cmd_list;
     bool ok = true;
     while (c) {
@@ -289,14 +485,19 @@ static bool do_quit_cmd(int argc, char *argv[])
         p = p->next;
         free_block(ele, sizeof(param_ele));
     }
-
-    while (buf_stack)
-        pop_file();
+    cmd_list = NULL;
+    param_list = NULL;
+    table_clear(&cmd_table);
+    table_clear(&param_table);
 
     for (int i = 0; i < quit_helper_cnt; i++) {
         ok = ok && quit_helpers[i](argc, argv);
     }
 
+    /* Arguments may point into input buffers, so release these last */
+    while (buf_stack)
+        pop_file();
+
     quit_flag = true;
     return ok;
 }
@@ -319,6 +520,34 @@ static bool do_help_cmd(int argc, char *argv[])
     return true;
 }
 
+static bool do_stats_cmd(int argc, char *argv[])
+{
+    report(1, "%-10s %10s %12s %12s %12s %12s", "Command", "Calls",
+           "Total (s)", "Min (us)", "Mean (us)", "Max (us)");
+    for (cmd_ptr c = cmd_list; c; c = c->next) {
+        if (!c->calls)
+            continue;
+        report(1, "%-10s %10" PRIu64 " %12.6f %12.3f %12.3f %12.3f", c->name,
+               c->calls, 1e-9 * c->total_ns, 1e-3 * c->min_ns,
+               1e-3 * c->total_ns / c->calls, 1e-3 * c->max_ns);
+    }
+    return true;
+}
+
+static bool do_metrics_cmd(int argc, char *argv[])
+{
+    if (argc < 2) {
+        close_metrics_file();
+        return true;
+    }
+
+    bool result = set_metrics_file(argv[1]);
+    if (!result)
+        report(1, "Couldn't open metrics file '%s'", argv[1]);
+
+    return result;
+}
+
 static bool do_comment_cmd(int argc, char *argv[])
 {
     if (echo)
@@ -370,17 +599,14 @@ static bool do_option_cmd(int argc, char *argv[])
             report(1, "Cannot parse '%s' as integer", argv[i]);
             return false;
         }
-        /* Find parameter in list */
-        param_ptr plist = param_list;
-        while (!found && plist) {
-            if (strcmp(plist->name, name) == 0) {
-                int oldval = *plist->valp;
-                *plist->valp = value;
-                if (plist->setter)
-                    plist->setter(oldval);
-                found = true;
-            } else
-                plist = plist->next;
+        /* Find parameter in table */
+        param_ptr plist = table_find(&param_table, name);
+        if (plist) {
+            int oldval = *plist->valp;
+            *plist->valp = value;
+            if (plist->setter)
+                plist->setter(oldval);
+            found = true;
         }
         /* Didn't find parameter */
         if (!found) {
@@ -427,17 +653,159 @@ static bool do_time_cmd(int argc, char *argv[])
     bool ok = true;
     if (argc <= 1) {
         double elapsed = last_time - first_time;
-        report(1, "Elapsed time = %.3f, Delta time = %.3f", elapsed, delta);
+        report(1, "Elapsed time = %.6f, Delta time = %.6f", elapsed, delta);
     } else {
         ok = interpret_cmda(argc - 1, argv + 1);
         if (block_flag) {
             block_timing = true;
         } else {
             delta = delta_time(&last_time);
-            report(1, "Delta time = %.3f", delta);
+            report(1, "Delta time = %.6f", delta);
+        }
+    }
+
+    return ok;
+}
+
+/*
+ * Body of repeat block.  Each line is split into arguments and its command
+ * looked up once, however many times the block runs.
+ */
+typedef struct STEP step_ele, *step_ptr;
+struct STEP {
+    cmd_ptr cmd;    /* Command to run, if not nested block */
+    int argc;       /* Arguments of command */
+    char **argv;    /* Pointers into line */
+    char *line;     /* Saved copy of line, split into arguments */
+    size_t len;     /* Length of saved line */
+    int reps;       /* Repetitions of nested block */
+    step_ptr body;  /* Nested block, or NULL */
+    step_ptr next;  /* Next step in block */
+};
+
+static void free_steps(step_ptr step)
+{
+    while (step) {
+        step_ptr next = step->next;
+        free_steps(step->body);
+        free_array(step->argv, step->argc, sizeof(char *));
+        free_block(step->line, step->len + 1);
+        free_block(step, sizeof(step_ele));
+        step = next;
+    }
+}
+
+/*
+ * Read lines of repeat block up to matching '}', nested depth levels deep.
+ * Return false if block is not terminated or uses unknown commands.  Lines
+ * up to the matching '}' are read even so, so that none of them run.
+ */
+static bool parse_block(step_ptr *bodyp, int depth)
+{
+    bool ok = true;
+    step_ptr *last_loc = bodyp;
+    *bodyp = NULL;
+
+    for (;;) {
+        char *line = line_source();
+        if (!line) {
+            /* Report once, from the outermost block */
+            if (depth == 0)
+                report(1, "Missing '}' at end of repeat block");
+            return false;
+        }
+
+        size_t len = strlen(line);
+        char *save = strsave_or_fail(line, "parse_block");
+        char *stack_argv[MAXARGS];
+        char *end;
+        int argc = parse_args(save, stack_argv, MAXARGS, &end);
+        if (argc == 0 || strcmp(stack_argv[0], "}") == 0) {
+            free_block(save, len + 1);
+            if (argc == 0)
+                continue;
+            return ok;
+        }
+
+        step_ptr step = malloc_or_fail(sizeof(step_ele), "parse_block");
+        step->line = save;
+        step->len = len;
+        step->argc = argc;
+        step->argv = calloc_or_fail(argc, sizeof(char *), "parse_block");
+        if (argc <= MAXARGS)
+            memcpy(step->argv, stack_argv, argc * sizeof(char *));
+        else
+            collect_args(save, end, step->argv);
+        step->cmd = NULL;
+        step->body = NULL;
+        step->next = NULL;
+        *last_loc = step;
+        last_loc = &step->next;
+
+        char **argv = step->argv;
+        if (argc == 3 && strcmp(argv[0], "repeat") == 0 &&
+            strcmp(argv[2], "{") == 0) {
+            if (!get_int(argv[1], &step->reps) || step->reps < 0) {
+                report(1, "Invalid repeat count '%s'", argv[1]);
+                ok = false;
+            }
+            if (!parse_block(&step->body, depth + 1))
+                ok = false;
+        } else {
+            step->cmd = table_find(&cmd_table, argv[0]);
+            if (!step->cmd) {
+                report(1, "Unknown command '%s'", argv[0]);
+                ok = false;
+            }
+        }
+    }
+}
+
+/* Run block reps times.  Stop early if quitting */
+static bool run_steps(step_ptr body, int reps)
+{
+    bool ok = true;
+    for (int r = 0; r < reps && !quit_flag; r++) {
+        for (step_ptr step = body; step && !quit_flag; step = step->next) {
+            if (step->cmd)
+                ok = run_cmd(step->cmd, step->argc, step->argv) && ok;
+            else
+                ok = run_steps(step->body, step->reps) && ok;
         }
     }
+    return ok;
+}
+
+static bool do_repeat_cmd(int argc, char *argv[])
+{
+    int reps;
+    if (argc < 3) {
+        report(1, "%s needs a count and a command", argv[0]);
+        return false;
+    }
+    if (!get_int(argv[1], &reps) || reps < 0) {
+        report(1, "Invalid repeat count '%s'", argv[1]);
+        return false;
+    }
 
+    if (argc == 3 && strcmp(argv[2], "{") == 0) {
+        step_ptr body;
+        bool ok = parse_block(&body, 0);
+        if (ok)
+            ok = run_steps(body, reps);
+        free_steps(body);
+        return ok;
+    }
+
+    /* Single command.  Arguments stay valid, since no input is read */
+    cmd_ptr cmd = table_find(&cmd_table, argv[2]);
+    if (!cmd) {
+        report(1, "Unknown command '%s'", argv[2]);
+        return false;
+    }
+    bool ok = true;
+    for (int r = 0; r < reps && !quit_flag; r++)
+        ok = run_cmd(cmd, argc - 2, argv + 2) && ok;
     return ok;
 }
 
@@ -457,10 +825,27 @@ static bool push_file(char *fname)
     rio_ptr rnew = malloc_or_fail(sizeof(rio_t), "push_file");
     rnew->fd = fd;
     rnew->cnt = 0;
+    rnew->scan = 0;
     rnew->bufptr = rnew->buf;
+    rnew->map = NULL;
+    rnew->map_end = NULL;
+    init_time(&rnew->start_time);
     rnew->prev = buf_stack;
     buf_stack = rnew;
 
+    /* Map regular files.  Pipes, terminals and empty files use the buffer */
+    struct stat st;
+    if (fname && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+        st.st_size > 0) {
+        char *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            madvise(map, st.st_size, MADV_SEQUENTIAL);
+            rnew->map = map;
+            rnew->map_end = map + st.st_size;
+            rnew->bufptr = map;
+        }
+    }
+
     return true;
 }
 
@@ -470,6 +855,13 @@ static void pop_file()
     if (buf_stack) {
         rio_ptr rsave = buf_stack;
         buf_stack = rsave->prev;
+        if (rsave->map) {
+            size_t size = rsave->map_end - rsave->map;
+            double elapsed = delta_time(&rsave->start_time);
+            report(3, "Read %.1f MB of commands in %.3f s (%.1f MB/s)",
+                   size / 1e6, elapsed, size / 1e6 / elapsed);
+            munmap(rsave->map, size);
+        }
         close(rsave->fd);
         free_block(rsave, sizeof(rio_t));
     }
@@ -481,72 +873,105 @@ static void init_in()
     buf_stack = NULL;
 }
 
+/* Echo line read from input */
+static void echo_line(char *line)
+{
+    if (echo) {
+        report_noreturn(1, prompt);
+        report(1, "%s", line);
+    }
+}
+
+/* Find next newline in unread part of buffer, starting past scanned part */
+static char *find_newline(rio_ptr rio)
+{
+    char *nl = memchr(rio->bufptr + rio->scan, '\n', rio->cnt - rio->scan);
+    rio->scan = nl ? nl - rio->bufptr : rio->cnt;
+    return nl;
+}
+
+/* Copy next line out of mapped file */
+static char *readline_mapped(rio_ptr rio)
+{
+    char *line = rio->bufptr;
+    size_t left = rio->map_end - line;
+    if (left == 0) {
+        /* Encountered EOF */
+        pop_file();
+        return NULL;
+    }
+
+    char *nl = memchr(line, '\n', left);
+    size_t len = nl ? (size_t) (nl - line) : left;
+    if (len > RIO_BUFSIZE) {
+        /* Split line at buffer limit */
+        len = RIO_BUFSIZE;
+        nl = NULL;
+    }
+    memcpy(linebuf, line, len);
+    linebuf[len] = '\0';
+    rio->bufptr = nl ? nl + 1 : line + len;
+    echo_line(linebuf);
+    return linebuf;
+}
+
 /* Read command from input file.
+ * Return line without its newline.  It remains valid until next call.
  * When hit EOF, close that file and return NULL
  */
 static char *readline()
 {
-    int cnt;
-    char c;
-    char *lptr = linebuf;
-
     if (!buf_stack)
         return NULL;
+    if (buf_stack->map)
+        return readline_mapped(buf_stack);
+
+    for (;;) {
+        rio_ptr rio = buf_stack;
+        char *line = rio->bufptr;
+        char *nl = find_newline(rio);
+        if (nl || rio->cnt == RIO_BUFSIZE) {
+            /* Complete line, or one that fills buffer */
+            int len = nl ? nl - line + 1 : rio->cnt;
+            line[nl ? len - 1 : len] = '\0';
+            rio->bufptr += len;
+            rio->cnt -= len;
+            rio->scan = 0;
+            echo_line(line);
+            return line;
+        }
 
-    for (cnt = 0; cnt < RIO_BUFSIZE - 2; cnt++) {
-        if (buf_stack->cnt <= 0) {
-            /* Need to read from input file */
-            buf_stack->cnt = read(buf_stack->fd, buf_stack->buf, RIO_BUFSIZE);
-            buf_stack->bufptr = buf_stack->buf;
-            if (buf_stack->cnt <= 0) {
-                /* Encountered EOF */
-                pop_file();
-                if (cnt > 0) {
-                    /* Last line of file did not terminate with newline. */
-                    /*  Terminate line & return it */
-                    *lptr++ = '\n';
-                    *lptr++ = '\0';
-                    if (echo) {
-                        report_noreturn(1, prompt);
-                        report_noreturn(1, linebuf);
-                    }
-                    return linebuf;
-                }
-                return NULL;
+        /* Move partial line to front and refill behind it */
+        if (line != rio->buf) {
+            memmove(rio->buf, line, rio->cnt);
+            rio->bufptr = rio->buf;
+        }
+        int n = read(rio->fd, rio->buf + rio->cnt, RIO_BUFSIZE - rio->cnt);
+        if (n <= 0) {
+            /* Encountered EOF */
+            int cnt = rio->cnt;
+            if (cnt > 0) {
+                /* Last line of file did not terminate with newline. */
+                memcpy(linebuf, rio->buf, cnt);
+                linebuf[cnt] = '\0';
             }
+            pop_file();
+            if (cnt > 0) {
+                echo_line(linebuf);
+                return linebuf;
+            }
+            return NULL;
         }
-
-        /* Have text in buffer */
-        c = *buf_stack->bufptr++;
-        *lptr++ = c;
-        buf_stack->cnt--;
-        if (c == '\n')
-            break;
-    }
-
-    if (c != '\n') {
-        /* Hit buffer limit.  Artificially terminate line */
-        *lptr++ = '\n';
+        rio->cnt += n;
     }
-    *lptr++ = '\0';
-
-    if (echo) {
-        report_noreturn(1, prompt);
-        report_noreturn(1, linebuf);
-    }
-
-    return linebuf;
 }
 
 /* Determine if there is a complete command line in input buffer */
 static bool read_ready()
 {
-    for (int i = 0; buf_stack && i < buf_stack->cnt; i++) {
-        if (buf_stack->bufptr[i] == '\n')
-            return true;
-    }
-
-    return false;
+    if (buf_stack && buf_stack->map)
+        return buf_stack->bufptr < buf_stack->map_end;
+    return buf_stack && find_newline(buf_stack);
 }
 
 static bool cmd_done()
@@ -591,6 +1016,7 @@ int cmd_select(int nfds,
         infd = buf_stack->fd;
         FD_SET(infd, readfds);
         if (infd == STDIN_FILENO && prompt_flag) {
+            report_flush();
             printf("%s", prompt);
             fflush(stdout);
             prompt_flag = true;
@@ -637,3 +1063,298 @@ bool run_console(char *infile_name)
         cmd_select(0, NULL, NULL, NULL, NULL);
     return err_cnt == 0;
 }
+
+/*
+ * Precompiled command files.
+ * A compiled file holds a header, then one record per command: the argument
+ * count followed by that many string numbers, all as 32-bit words.
+ * Argument strings are interned in a table at the end of the file, each
+ * stored as a 32-bit length and its characters.  Sourced files are inlined.
+ * When replaying, each distinct command name is looked up only once.
+ */
+#define BC_MAGIC "QBC1"
+typedef struct {
+    char magic[4];
+    uint32_t nstrings;
+    uint64_t ncmds;
+    uint64_t strtab_offset;
+} bc_header_t;
+
+/* Return string number of s, adding it to table if new */
+static uint32_t intern(name_table_t *interned,
+                       char ***stringsp,
+                       size_t *capp,
+                       uint32_t *nstringsp,
+                       char *s)
+{
+    uintptr_t id = (uintptr_t) table_find(interned, s);
+    if (id)
+        return id - 1;
+
+    if (*nstringsp == *capp) {
+        size_t cap = *capp ? 2 * *capp : 64;
+        char **strings = calloc_or_fail(cap, sizeof(char *), "intern");
+        if (*stringsp) {
+            memcpy(strings, *stringsp, *capp * sizeof(char *));
+            free_array(*stringsp, *capp, sizeof(char *));
+        }
+        *stringsp = strings;
+        *capp = cap;
+    }
+    char *saved = strsave_or_fail(s, "intern");
+    (*stringsp)[*nstringsp] = saved;
+    id = ++*nstringsp;
+    table_insert(interned, saved, (void *) id);
+    return id - 1;
+}
+
+bool compile_file(char *infile_name, char *outfile_name)
+{
+    FILE *out = fopen(outfile_name, "wb");
+    if (!out) {
+        report(1, "Couldn't open output file '%s'", outfile_name);
+        return false;
+    }
+    if (!push_file(infile_name)) {
+        report(1, "Could not open source file '%s'", infile_name);
+        fclose(out);
+        return false;
+    }
+
+    bc_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BC_MAGIC, sizeof(header.magic));
+    fwrite(&header, sizeof(header), 1, out);
+
+    name_table_t interned = {NULL, 0, 0};
+    char **strings = NULL;
+    size_t cap = 0;
+    bool ok = true;
+    bool save_echo = echo;
+    echo = false;
+
+    while (buf_stack) {
+        char *line = readline();
+        if (!line)
+            continue;
+
+        char *stack_argv[MAXARGS];
+        char **argv = stack_argv;
+        char *end;
+        int argc = parse_args(line, stack_argv, MAXARGS, &end);
+        if (argc > MAXARGS) {
+            argv = calloc_or_fail(argc, sizeof(char *), "compile_file");
+            collect_args(line, end, argv);
+        }
+
+        if (argc == 0) {
+            /* Blank line */
+        } else if (argc >= 2 && strcmp(argv[0], "source") == 0) {
+            if (!push_file(argv[1])) {
+                report(1, "Could not open source file '%s'", argv[1]);
+                ok = false;
+            }
+        } else if (strcmp(argv[0], "}") != 0 &&
+                   !table_find(&cmd_table, argv[0])) {
+            /* Closing brace of repeat block is the only non-command */
+            report(1, "Unknown command '%s'", argv[0]);
+            ok = false;
+        } else {
+            uint32_t word = argc;
+            fwrite(&word, sizeof(word), 1, out);
+            for (int i = 0; i < argc; i++) {
+                word = intern(&interned, &strings, &cap, &header.nstrings,
+                              argv[i]);
+                fwrite(&word, sizeof(word), 1, out);
+            }
+            header.ncmds++;
+        }
+
+        if (argv != stack_argv)
+            free_array(argv, argc, sizeof(char *));
+    }
+
+    header.strtab_offset = ftello(out);
+    for (uint32_t i = 0; i < header.nstrings; i++) {
+        uint32_t len = strlen(strings[i]);
+        fwrite(&len, sizeof(len), 1, out);
+        fwrite(strings[i], 1, len, out);
+        free_string(strings[i]);
+    }
+    if (strings)
+        free_array(strings, cap, sizeof(char *));
+    table_clear(&interned);
+
+    fseeko(out, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, out);
+    if (ferror(out)) {
+        report(1, "Error writing '%s'", outfile_name);
+        ok = false;
+    }
+    fclose(out);
+    echo = save_echo;
+    if (!ok)
+        unlink(outfile_name);
+
+    report(3, "Compiled %" PRIu64 " commands, %u distinct strings",
+           header.ncmds, header.nstrings);
+    return ok;
+}
+
+/* State of compiled file being replayed */
+static uint32_t *bc_code;
+static uint32_t *bc_code_end;
+static uint64_t bc_left;
+static char **bc_strings;
+static uint32_t bc_nstrings;
+
+/*
+ * Decode next compiled command into argument array.
+ * Return argument count, 0 at end, or -1 if file is corrupted.
+ * argv must have room for MAXARGS arguments.  Longer commands get a
+ * heap array, which caller must free.
+ */
+static int next_compiled(char ***argvp)
+{
+    if (bc_left == 0)
+        return 0;
+    bc_left--;
+
+    uint32_t argc = bc_code < bc_code_end ? *bc_code++ : 0;
+    if (argc == 0 || argc > (size_t) (bc_code_end - bc_code))
+        return -1;
+
+    if (argc > MAXARGS)
+        *argvp = calloc_or_fail(argc, sizeof(char *), "next_compiled");
+    for (uint32_t i = 0; i < argc; i++) {
+        if (bc_code[i] >= bc_nstrings) {
+            if (argc > MAXARGS)
+                free_array(*argvp, argc, sizeof(char *));
+            return -1;
+        }
+        (*argvp)[i] = bc_strings[bc_code[i]];
+    }
+    bc_code += argc;
+
+    if (echo) {
+        report_noreturn(1, prompt);
+        for (uint32_t i = 0; i < argc; i++)
+            report_noreturn(1, i ? " %s" : "%s", (*argvp)[i]);
+        report(1, "");
+    }
+    return argc;
+}
+
+/* Supply next compiled command as text, for repeat blocks */
+static char *next_compiled_line()
+{
+    char *stack_argv[MAXARGS];
+    char **argv = stack_argv;
+    int argc = next_compiled(&argv);
+    if (argc <= 0)
+        return NULL;
+
+    size_t pos = 0;
+    linebuf[0] = '\0';
+    for (int i = 0; i < argc && pos < RIO_BUFSIZE; i++)
+        pos += snprintf(linebuf + pos, RIO_BUFSIZE + 1 - pos, i ? " %s" : "%s",
+                        argv[i]);
+    if (argv != stack_argv)
+        free_array(argv, argc, sizeof(char *));
+    return linebuf;
+}
+
+bool run_bytecode(char *file_name)
+{
+    int fd = open(file_name, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        report(1, "ERROR: Could not open compiled file '%s'", file_name);
+        if (fd >= 0)
+            close(fd);
+        return false;
+    }
+
+    size_t size = st.st_size;
+    char *map = size >= sizeof(bc_header_t)
+                    ? mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0)
+                    : MAP_FAILED;
+    close(fd);
+    bc_header_t *header = (bc_header_t *) map;
+    if (map == MAP_FAILED ||
+        memcmp(header->magic, BC_MAGIC, sizeof(header->magic)) != 0 ||
+        header->strtab_offset < sizeof(bc_header_t) ||
+        header->strtab_offset > size) {
+        report(1, "ERROR: '%s' is not a compiled command file", file_name);
+        if (map != MAP_FAILED)
+            munmap(map, size);
+        return false;
+    }
+    madvise(map, size, MADV_SEQUENTIAL);
+
+    /* Unpack string table into null-terminated strings */
+    uint32_t nstrings = header->nstrings;
+    size_t strbytes = size - header->strtab_offset;
+    char **strings =
+        calloc_or_fail(nstrings + 1, sizeof(char *), "run_bytecode");
+    char *chars = malloc_or_fail(strbytes + 1, "run_bytecode");
+    char *src = map + header->strtab_offset;
+    char *dst = chars;
+    bool ok = true;
+    for (uint32_t i = 0; ok && i < nstrings; i++) {
+        uint32_t len;
+        if (src + sizeof(len) > map + size) {
+            ok = false;
+            break;
+        }
+        memcpy(&len, src, sizeof(len));
+        src += sizeof(len);
+        if (len > (size_t) (map + size - src)) {
+            ok = false;
+            break;
+        }
+        memcpy(dst, src, len);
+        strings[i] = dst;
+        dst[len] = '\0';
+        dst += len + 1;
+        src += len;
+    }
+
+    bc_code = (uint32_t *) (map + sizeof(bc_header_t));
+    bc_code_end = (uint32_t *) (map + header->strtab_offset);
+    bc_left = header->ncmds;
+    bc_strings = strings;
+    bc_nstrings = nstrings;
+    line_source = next_compiled_line;
+
+    /* Command looked up by string number of its name */
+    cmd_ptr *cmds =
+        calloc_or_fail(nstrings + 1, sizeof(cmd_ptr), "run_bytecode");
+    while (ok && !quit_flag) {
+        char *stack_argv[MAXARGS];
+        char **argv = stack_argv;
+        uint32_t *rec = bc_code;
+        int argc = next_compiled(&argv);
+        if (argc <= 0) {
+            ok = argc == 0;
+            break;
+        }
+
+        /* First word of record is string number of command name */
+        uint32_t id = rec[1];
+        if (!cmds[id])
+            cmds[id] = table_find(&cmd_table, argv[0]);
+        run_cmd(cmds[id], argc, argv);
+        if (argv != stack_argv)
+            free_array(argv, argc, sizeof(char *));
+    }
+    if (!ok)
+        report(1, "ERROR: Compiled file '%s' is corrupted", file_name);
+
+    line_source = readline;
+    free_array(cmds, nstrings + 1, sizeof(cmd_ptr));
+    free_block(chars, strbytes + 1);
+    free_array(strings, nstrings + 1, sizeof(char *));
+    munmap(map, size);
+    return ok && err_cnt == 0;
+}
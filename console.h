@@ -1,6 +1,7 @@
 #ifndef LAB0_CONSOLE_H
 #define LAB0_CONSOLE_H
 #include <stdbool.h>
+#include <stdint.h>
 #include <sys/select.h>
 
 /* Implementation of simple command-line interface */
@@ -21,6 +22,11 @@ struct CELE {
     char *name;
     cmd_function operation;
     char *documentation;
+    /* Timing statistics, in nanoseconds */
+    uint64_t calls;
+    uint64_t total_ns;
+    uint64_t min_ns;
+    uint64_t max_ns;
     cmd_ptr next;
 };
 
@@ -56,6 +62,13 @@ bool get_int(char *vname, int *loc);
 /* Add function to be executed as part of program exit */
 void add_quit_helper(cmd_function qf);
 
+/*
+ * Function adding fields to the metrics record of each command.
+ * Called with after false before the command runs, and true after.
+ */
+typedef void (*metrics_function)(bool after);
+void set_metrics_helper(metrics_function mf);
+
 /* Turn echoing on/off */
 void set_echo(bool on);
 
@@ -78,4 +91,13 @@ int cmd_select(int nfds,
  */
 bool run_console(char *infile_name);
 
+/*
+ * Compile commands into a file that can be replayed without parsing.
+ * Null infile_name implies read commands from stdin.
+ */
+bool compile_file(char *infile_name, char *outfile_name);
+
+/* Run commands from compiled file */
+bool run_bytecode(char *file_name);
+
 #endif /* LAB0_CONSOLE_H */
@@ -0,0 +1,25224 @@
+	.file	"console.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "console.c"
+	.type	async_changed, @function
+async_changed:
+.LVL0:
+.LFB38:
+	.file 1 "console.c"
+	.loc 1 443 1 view -0
+	.cfi_startproc
+	.loc 1 443 1 is_stmt 0 view .LVU1
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 444 5 is_stmt 1 view .LVU2
+	movl	$0, %eax	#,
+	call	report_flush@PLT	#
+.LVL1:
+# console.c:445: }
+	.loc 1 445 1 is_stmt 0 view .LVU3
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE38:
+	.size	async_changed, .-async_changed
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"Couldn't open metrics file '%s'"
+	.text
+	.type	do_metrics_cmd, @function
+do_metrics_cmd:
+.LVL2:
+.LFB45:
+	.loc 1 538 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 538 1 is_stmt 0 view .LVU5
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 539 5 is_stmt 1 view .LVU6
+# console.c:539:     if (argc < 2) {
+	.loc 1 539 8 is_stmt 0 view .LVU7
+	cmpl	$1, %edi	#, tmp91
+	jle	.L7	#,
+	movq	%rsi, %rbp	# tmp92, argv
+	.loc 1 544 5 is_stmt 1 view .LVU8
+# console.c:544:     bool result = set_metrics_file(argv[1]);
+	.loc 1 544 19 is_stmt 0 view .LVU9
+	movq	8(%rsi), %rdi	# MEM[(char * *)argv_6(D) + 8B], MEM[(char * *)argv_6(D) + 8B]
+.LVL3:
+	.loc 1 544 19 view .LVU10
+	call	set_metrics_file@PLT	#
+.LVL4:
+	.loc 1 544 19 view .LVU11
+	movl	%eax, %ebx	# tmp93, <retval>
+.LVL5:
+	.loc 1 545 5 is_stmt 1 view .LVU12
+# console.c:545:     if (!result)
+	.loc 1 545 8 is_stmt 0 view .LVU13
+	testb	%al, %al	# <retval>
+	je	.L8	#,
+.LVL6:
+.L3:
+# console.c:549: }
+	.loc 1 549 1 view .LVU14
+	movl	%ebx, %eax	# <retval>,
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL7:
+.L7:
+	.cfi_restore_state
+	.loc 1 540 9 is_stmt 1 view .LVU15
+	movl	$0, %eax	#,
+	call	close_metrics_file@PLT	#
+.LVL8:
+	.loc 1 541 9 view .LVU16
+# console.c:541:         return true;
+	.loc 1 541 16 is_stmt 0 view .LVU17
+	movl	$1, %ebx	#, <retval>
+	jmp	.L3	#
+.LVL9:
+.L8:
+	.loc 1 546 9 is_stmt 1 view .LVU18
+	movq	8(%rbp), %rdx	# MEM[(char * *)argv_6(D) + 8B], MEM[(char * *)argv_6(D) + 8B]
+	leaq	.LC0(%rip), %rsi	#, tmp89
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL10:
+	.loc 1 546 9 is_stmt 0 view .LVU19
+	call	report@PLT	#
+.LVL11:
+	jmp	.L3	#
+	.cfi_endproc
+.LFE45:
+	.size	do_metrics_cmd, .-do_metrics_cmd
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"Min (us)"
+.LC2:
+	.string	"Total (s)"
+.LC3:
+	.string	"Calls"
+.LC4:
+	.string	"Command"
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"%-10s %10s %12s %12s %12s %12s"
+	.section	.rodata.str1.1
+.LC6:
+	.string	"Max (us)"
+.LC7:
+	.string	"Mean (us)"
+	.section	.rodata.str1.8
+	.align 8
+.LC10:
+	.string	"%-10s %10lu %12.6f %12.3f %12.3f %12.3f"
+	.text
+	.type	do_stats_cmd, @function
+do_stats_cmd:
+.LVL12:
+.LFB44:
+	.loc 1 524 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 524 1 is_stmt 0 view .LVU21
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 525 5 is_stmt 1 view .LVU22
+	leaq	.LC6(%rip), %rax	#, tmp140
+	pushq	%rax	# tmp140
+	.cfi_def_cfa_offset 40
+	leaq	.LC7(%rip), %rax	#, tmp141
+	pushq	%rax	# tmp141
+	.cfi_def_cfa_offset 48
+	leaq	.LC1(%rip), %r9	#,
+	leaq	.LC2(%rip), %r8	#,
+	leaq	.LC3(%rip), %rcx	#, tmp102
+	leaq	.LC4(%rip), %rdx	#, tmp103
+	leaq	.LC5(%rip), %rsi	#, tmp104
+.LVL13:
+	.loc 1 525 5 is_stmt 0 view .LVU23
+	movl	$1, %edi	#,
+.LVL14:
+	.loc 1 525 5 view .LVU24
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL15:
+	.loc 1 527 5 is_stmt 1 view .LVU25
+.LBB4:
+	.loc 1 527 10 view .LVU26
+# console.c:527:     for (cmd_ptr c = cmd_list; c; c = c->next) {
+	.loc 1 527 18 is_stmt 0 view .LVU27
+	movq	cmd_list(%rip), %rbx	# cmd_list, c
+.LVL16:
+	.loc 1 527 32 is_stmt 1 view .LVU28
+	addq	$16, %rsp	#,
+	.cfi_def_cfa_offset 32
+	testq	%rbx, %rbx	# c
+	je	.L10	#,
+# console.c:530:         report(1, "%-10s %10" PRIu64 " %12.6f %12.3f %12.3f %12.3f", c->name,
+	.loc 1 530 9 is_stmt 0 view .LVU29
+	leaq	.LC10(%rip), %rbp	#, tmp138
+	jmp	.L20	#
+.L12:
+# console.c:532:                1e-3 * c->total_ns / c->calls, 1e-3 * c->max_ns);
+	.loc 1 532 21 view .LVU30
+	movq	%rax, %rdx	# c_25->total_ns, tmp107
+	shrq	%rdx	# tmp107
+	andl	$1, %eax	#, tmp108
+	orq	%rax, %rdx	# tmp108, tmp107
+	pxor	%xmm0, %xmm0	# tmp106
+	cvtsi2sdq	%rdx, %xmm0	# tmp107, tmp106
+	addsd	%xmm0, %xmm0	# tmp106, _6
+	jmp	.L13	#
+.L14:
+# console.c:530:         report(1, "%-10s %10" PRIu64 " %12.6f %12.3f %12.3f %12.3f", c->name,
+	.loc 1 530 9 view .LVU31
+	movq	%rax, %rdx	# c_25->max_ns, tmp112
+	shrq	%rdx	# tmp112
+	andl	$1, %eax	#, tmp113
+	orq	%rax, %rdx	# tmp113, tmp112
+	pxor	%xmm3, %xmm3	# tmp111
+	cvtsi2sdq	%rdx, %xmm3	# tmp112, tmp111
+	addsd	%xmm3, %xmm3	# tmp111, tmp109
+	jmp	.L15	#
+.L16:
+	movq	%rcx, %rax	# _1, tmp120
+	shrq	%rax	# tmp120
+	movq	%rcx, %rdx	# _1, tmp121
+	andl	$1, %edx	#, tmp121
+	orq	%rdx, %rax	# tmp121, tmp120
+	pxor	%xmm1, %xmm1	# tmp119
+	cvtsi2sdq	%rax, %xmm1	# tmp120, tmp119
+	addsd	%xmm1, %xmm1	# tmp119, tmp118
+	jmp	.L17	#
+.L18:
+	.loc 1 530 9 view .LVU32
+	movq	%rax, %rdx	# c_25->min_ns, tmp126
+	shrq	%rdx	# tmp126
+	andl	$1, %eax	#, tmp127
+	orq	%rax, %rdx	# tmp127, tmp126
+	pxor	%xmm1, %xmm1	# tmp125
+	cvtsi2sdq	%rdx, %xmm1	# tmp126, tmp125
+	addsd	%xmm1, %xmm1	# tmp125, tmp123
+.L19:
+	mulsd	.LC9(%rip), %xmm0	#, tmp130
+	movq	(%rbx), %rdx	# c_25->name, c_25->name
+	mulsd	.LC8(%rip), %xmm1	#,
+	movq	%rbp, %rsi	# tmp138,
+	movl	$1, %edi	#,
+	movl	$4, %eax	#,
+	call	report@PLT	#
+.LVL17:
+.L11:
+	.loc 1 527 37 is_stmt 1 discriminator 2 view .LVU33
+	movq	56(%rbx), %rbx	# c_25->next, c
+.LVL18:
+	.loc 1 527 32 discriminator 2 view .LVU34
+	testq	%rbx, %rbx	# c
+	je	.L10	#,
+.L20:
+	.loc 1 528 9 view .LVU35
+# console.c:528:         if (!c->calls)
+	.loc 1 528 15 is_stmt 0 view .LVU36
+	movq	24(%rbx), %rcx	# c_25->calls, _1
+# console.c:528:         if (!c->calls)
+	.loc 1 528 12 view .LVU37
+	testq	%rcx, %rcx	# _1
+	je	.L11	#,
+	.loc 1 530 9 is_stmt 1 view .LVU38
+# console.c:532:                1e-3 * c->total_ns / c->calls, 1e-3 * c->max_ns);
+	.loc 1 532 21 is_stmt 0 view .LVU39
+	movq	32(%rbx), %rax	# c_25->total_ns, c_25->total_ns
+	testq	%rax, %rax	# c_25->total_ns
+	js	.L12	#,
+	pxor	%xmm0, %xmm0	# _6
+	cvtsi2sdq	%rax, %xmm0	# c_25->total_ns, _6
+.L13:
+# console.c:530:         report(1, "%-10s %10" PRIu64 " %12.6f %12.3f %12.3f %12.3f", c->name,
+	.loc 1 530 9 view .LVU40
+	movq	48(%rbx), %rax	# c_25->max_ns, c_25->max_ns
+	testq	%rax, %rax	# c_25->max_ns
+	js	.L14	#,
+	pxor	%xmm3, %xmm3	# tmp109
+	cvtsi2sdq	%rax, %xmm3	# c_25->max_ns, tmp109
+.L15:
+	mulsd	.LC8(%rip), %xmm3	#, tmp114
+# console.c:532:                1e-3 * c->total_ns / c->calls, 1e-3 * c->max_ns);
+	.loc 1 532 21 view .LVU41
+	movapd	%xmm0, %xmm2	# _6, tmp116
+	mulsd	.LC8(%rip), %xmm2	#, tmp116
+# console.c:530:         report(1, "%-10s %10" PRIu64 " %12.6f %12.3f %12.3f %12.3f", c->name,
+	.loc 1 530 9 view .LVU42
+	testq	%rcx, %rcx	# _1
+	js	.L16	#,
+	pxor	%xmm1, %xmm1	# tmp118
+	cvtsi2sdq	%rcx, %xmm1	# _1, tmp118
+.L17:
+	divsd	%xmm1, %xmm2	# tmp118, tmp122
+	movq	40(%rbx), %rax	# c_25->min_ns, c_25->min_ns
+	testq	%rax, %rax	# c_25->min_ns
+	js	.L18	#,
+	pxor	%xmm1, %xmm1	# tmp123
+	cvtsi2sdq	%rax, %xmm1	# c_25->min_ns, tmp123
+	jmp	.L19	#
+.L10:
+	.loc 1 530 9 view .LVU43
+.LBE4:
+	.loc 1 534 5 is_stmt 1 view .LVU44
+# console.c:535: }
+	.loc 1 535 1 is_stmt 0 view .LVU45
+	movl	$1, %eax	#,
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL19:
+	.loc 1 535 1 view .LVU46
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE44:
+	.size	do_stats_cmd, .-do_stats_cmd
+	.section	.rodata.str1.8
+	.align 8
+.LC11:
+	.string	"Error limit exceeded.  Stopping command execution"
+	.text
+	.type	record_error, @function
+record_error:
+.LFB34:
+	.loc 1 356 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 357 5 view .LVU48
+# console.c:357:     err_cnt++;
+	.loc 1 357 12 is_stmt 0 view .LVU49
+	movl	err_cnt(%rip), %eax	# err_cnt, tmp88
+	addl	$1, %eax	#, _2
+	movl	%eax, err_cnt(%rip)	# _2, err_cnt
+	.loc 1 358 5 is_stmt 1 view .LVU50
+# console.c:358:     if (err_cnt >= err_limit) {
+	.loc 1 358 8 is_stmt 0 view .LVU51
+	cmpl	err_limit(%rip), %eax	# err_limit, _2
+	jge	.L29	#,
+	ret	
+.L29:
+# console.c:356: {
+	.loc 1 356 1 view .LVU52
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 359 9 is_stmt 1 view .LVU53
+	leaq	.LC11(%rip), %rsi	#, tmp86
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL20:
+	.loc 1 360 9 view .LVU54
+# console.c:360:         quit_flag = true;
+	.loc 1 360 19 is_stmt 0 view .LVU55
+	movb	$1, quit_flag(%rip)	#, quit_flag
+# console.c:362: }
+	.loc 1 362 1 view .LVU56
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE34:
+	.size	record_error, .-record_error
+	.section	.rodata.str1.1
+.LC12:
+	.string	"Commands:"
+.LC13:
+	.string	"\t%s\t%s"
+.LC14:
+	.string	"Options:"
+.LC15:
+	.string	"\t%s\t%d\t%s"
+	.text
+	.type	do_help_cmd, @function
+do_help_cmd:
+.LVL21:
+.LFB43:
+	.loc 1 506 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 506 1 is_stmt 0 view .LVU58
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 507 5 is_stmt 1 view .LVU59
+# console.c:507:     cmd_ptr clist = cmd_list;
+	.loc 1 507 13 is_stmt 0 view .LVU60
+	movq	cmd_list(%rip), %rbx	# cmd_list, clist
+.LVL22:
+	.loc 1 508 5 is_stmt 1 view .LVU61
+	movq	(%rsi), %rdx	# *argv_14(D), *argv_14(D)
+	leaq	.LC12(%rip), %rsi	#, tmp95
+.LVL23:
+	.loc 1 508 5 is_stmt 0 view .LVU62
+	movl	$1, %edi	#,
+.LVL24:
+	.loc 1 508 5 view .LVU63
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL25:
+	.loc 1 509 5 is_stmt 1 view .LVU64
+	.loc 1 509 12 view .LVU65
+	testq	%rbx, %rbx	# clist
+	je	.L31	#,
+# console.c:510:         report(1, "\t%s\t%s", clist->name, clist->documentation);
+	.loc 1 510 9 is_stmt 0 view .LVU66
+	leaq	.LC13(%rip), %rbp	#, tmp98
+.L32:
+	.loc 1 510 9 is_stmt 1 view .LVU67
+	movq	16(%rbx), %rcx	# clist_26->documentation, clist_26->documentation
+	movq	(%rbx), %rdx	# clist_26->name, clist_26->name
+	movq	%rbp, %rsi	# tmp98,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL26:
+	.loc 1 511 9 view .LVU68
+# console.c:511:         clist = clist->next;
+	.loc 1 511 15 is_stmt 0 view .LVU69
+	movq	56(%rbx), %rbx	# clist_26->next, clist
+.LVL27:
+	.loc 1 509 12 is_stmt 1 view .LVU70
+	testq	%rbx, %rbx	# clist
+	jne	.L32	#,
+.L31:
+	.loc 1 513 5 view .LVU71
+# console.c:513:     param_ptr plist = param_list;
+	.loc 1 513 15 is_stmt 0 view .LVU72
+	movq	param_list(%rip), %rbx	# param_list, plist
+.LVL28:
+	.loc 1 514 5 is_stmt 1 view .LVU73
+	leaq	.LC14(%rip), %rsi	#, tmp99
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL29:
+	.loc 1 515 5 view .LVU74
+	.loc 1 515 12 view .LVU75
+	testq	%rbx, %rbx	# plist
+	je	.L33	#,
+# console.c:516:         report(1, "\t%s\t%d\t%s", plist->name, *plist->valp,
+	.loc 1 516 9 is_stmt 0 view .LVU76
+	leaq	.LC15(%rip), %rbp	#, tmp104
+.L34:
+	.loc 1 516 9 is_stmt 1 view .LVU77
+	movq	8(%rbx), %rax	# plist_27->valp, plist_27->valp
+	movl	(%rax), %ecx	# *_5, *_5
+	movq	(%rbx), %rdx	# plist_27->name, plist_27->name
+	movq	16(%rbx), %r8	# plist_27->documentation,
+	movq	%rbp, %rsi	# tmp104,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL30:
+	.loc 1 518 9 view .LVU78
+# console.c:518:         plist = plist->next;
+	.loc 1 518 15 is_stmt 0 view .LVU79
+	movq	32(%rbx), %rbx	# plist_27->next, plist
+.LVL31:
+	.loc 1 515 12 is_stmt 1 view .LVU80
+	testq	%rbx, %rbx	# plist
+	jne	.L34	#,
+.L33:
+	.loc 1 520 5 view .LVU81
+# console.c:521: }
+	.loc 1 521 1 is_stmt 0 view .LVU82
+	movl	$1, %eax	#,
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL32:
+	.loc 1 521 1 view .LVU83
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE43:
+	.size	do_help_cmd, .-do_help_cmd
+	.type	table_slot, @function
+table_slot:
+.LVL33:
+.LFB25:
+	.loc 1 152 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 152 1 is_stmt 0 view .LVU85
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %r13	# tmp105, slots
+	movq	%rdx, %r12	# tmp107, name
+	.loc 1 153 5 is_stmt 1 view .LVU86
+.LVL34:
+.LBB5:
+.LBI5:
+	.loc 1 140 24 view .LVU87
+.LBB6:
+	.loc 1 142 5 view .LVU88
+	.loc 1 143 5 view .LVU89
+	.loc 1 143 12 view .LVU90
+	movzbl	(%rdx), %eax	# *name_10(D), _17
+	testb	%al, %al	# _17
+	je	.L44	#,
+# console.c:142:     uint32_t h = 2166136261u;
+	.loc 1 142 14 is_stmt 0 view .LVU91
+	movl	$-2128831035, %ebx	#, h
+.LVL35:
+.L40:
+	.loc 1 144 9 is_stmt 1 view .LVU92
+# console.c:144:         h ^= (unsigned char) *name++;
+	.loc 1 144 35 is_stmt 0 view .LVU93
+	addq	$1, %rdx	#, name
+.LVL36:
+# console.c:144:         h ^= (unsigned char) *name++;
+	.loc 1 144 14 view .LVU94
+	movzbl	%al, %eax	# _17, _17
+# console.c:144:         h ^= (unsigned char) *name++;
+	.loc 1 144 11 view .LVU95
+	xorl	%eax, %ebx	# _17, h
+.LVL37:
+	.loc 1 145 9 is_stmt 1 view .LVU96
+# console.c:145:         h *= 16777619u;
+	.loc 1 145 11 is_stmt 0 view .LVU97
+	imull	$16777619, %ebx, %ebx	#, h, h
+.LVL38:
+	.loc 1 143 12 is_stmt 1 view .LVU98
+	movzbl	(%rdx), %eax	# MEM[(const char *)name_16], _17
+	testb	%al, %al	# _17
+	jne	.L40	#,
+.LVL39:
+.L39:
+	.loc 1 147 5 view .LVU99
+	.loc 1 147 5 is_stmt 0 view .LVU100
+.LBE6:
+.LBE5:
+# console.c:153:     size_t i = hash_name(name) & (size - 1);
+	.loc 1 153 40 view .LVU101
+	leaq	-1(%rsi), %r14	#, _2
+# console.c:153:     size_t i = hash_name(name) & (size - 1);
+	.loc 1 153 12 view .LVU102
+	andl	%r14d, %ebx	# _2, i
+.LVL40:
+	.loc 1 154 5 is_stmt 1 view .LVU103
+	.loc 1 154 26 view .LVU104
+# console.c:154:     while (slots[i].name && strcmp(slots[i].name, name) != 0)
+	.loc 1 154 17 is_stmt 0 view .LVU105
+	movq	%rbx, %rbp	# i, tmp102
+	salq	$4, %rbp	#, tmp102
+	addq	%r13, %rbp	# slots, <retval>
+# console.c:154:     while (slots[i].name && strcmp(slots[i].name, name) != 0)
+	.loc 1 154 20 view .LVU106
+	movq	0(%rbp), %rdi	# _25->name, _6
+.LVL41:
+# console.c:154:     while (slots[i].name && strcmp(slots[i].name, name) != 0)
+	.loc 1 154 26 view .LVU107
+	testq	%rdi, %rdi	# _6
+	je	.L38	#,
+.LVL42:
+.L41:
+# console.c:154:     while (slots[i].name && strcmp(slots[i].name, name) != 0)
+	.loc 1 154 29 discriminator 1 view .LVU108
+	movq	%r12, %rsi	# name,
+	call	strcmp@PLT	#
+.LVL43:
+# console.c:154:     while (slots[i].name && strcmp(slots[i].name, name) != 0)
+	.loc 1 154 26 discriminator 1 view .LVU109
+	testl	%eax, %eax	# tmp108
+	je	.L38	#,
+	.loc 1 155 9 is_stmt 1 view .LVU110
+# console.c:155:         i = (i + 1) & (size - 1);
+	.loc 1 155 16 is_stmt 0 view .LVU111
+	addq	$1, %rbx	#, _3
+.LVL44:
+# console.c:155:         i = (i + 1) & (size - 1);
+	.loc 1 155 11 view .LVU112
+	andq	%r14, %rbx	# _2, i
+.LVL45:
+	.loc 1 154 26 is_stmt 1 view .LVU113
+# console.c:154:     while (slots[i].name && strcmp(slots[i].name, name) != 0)
+	.loc 1 154 17 is_stmt 0 view .LVU114
+	movq	%rbx, %rbp	# i, tmp103
+	salq	$4, %rbp	#, tmp103
+	addq	%r13, %rbp	# slots, <retval>
+# console.c:154:     while (slots[i].name && strcmp(slots[i].name, name) != 0)
+	.loc 1 154 20 view .LVU115
+	movq	0(%rbp), %rdi	# _5->name, _6
+# console.c:154:     while (slots[i].name && strcmp(slots[i].name, name) != 0)
+	.loc 1 154 26 view .LVU116
+	testq	%rdi, %rdi	# _6
+	jne	.L41	#,
+.L38:
+# console.c:157: }
+	.loc 1 157 1 view .LVU117
+	movq	%rbp, %rax	# <retval>,
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+.LVL46:
+	.loc 1 157 1 view .LVU118
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+.LVL47:
+	.loc 1 157 1 view .LVU119
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL48:
+	.loc 1 157 1 view .LVU120
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+.LVL49:
+	.loc 1 157 1 view .LVU121
+	ret	
+.LVL50:
+.L44:
+	.cfi_restore_state
+.LBB8:
+.LBB7:
+# console.c:142:     uint32_t h = 2166136261u;
+	.loc 1 142 14 view .LVU122
+	movl	$-2128831035, %ebx	#, h
+	jmp	.L39	#
+.LBE7:
+.LBE8:
+	.cfi_endproc
+.LFE25:
+	.size	table_slot, .-table_slot
+	.type	table_find, @function
+table_find:
+.LVL51:
+.LFB26:
+	.loc 1 161 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 162 5 view .LVU124
+# console.c:162:     if (!table->slots)
+	.loc 1 162 15 is_stmt 0 view .LVU125
+	movq	(%rdi), %rax	# table_6(D)->slots, <retval>
+# console.c:162:     if (!table->slots)
+	.loc 1 162 8 view .LVU126
+	testq	%rax, %rax	# <retval>
+	je	.L51	#,
+# console.c:161: {
+	.loc 1 161 1 view .LVU127
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	movq	%rsi, %rdx	# tmp90, name
+	.loc 1 164 5 is_stmt 1 view .LVU128
+# console.c:164:     return table_slot(table->slots, table->size, name)->ele;
+	.loc 1 164 12 is_stmt 0 view .LVU129
+	movq	8(%rdi), %rsi	# table_6(D)->size, table_6(D)->size
+.LVL52:
+	.loc 1 164 12 view .LVU130
+	movq	%rax, %rdi	# <retval>,
+.LVL53:
+	.loc 1 164 12 view .LVU131
+	call	table_slot	#
+.LVL54:
+# console.c:164:     return table_slot(table->slots, table->size, name)->ele;
+	.loc 1 164 55 view .LVU132
+	movq	8(%rax), %rax	# _3->ele, <retval>
+# console.c:165: }
+	.loc 1 165 1 view .LVU133
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL55:
+.L51:
+	.loc 1 165 1 view .LVU134
+	ret	
+	.cfi_endproc
+.LFE26:
+	.size	table_find, .-table_find
+	.type	find_newline, @function
+find_newline:
+.LVL56:
+.LFB60:
+	.loc 1 887 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 887 1 is_stmt 0 view .LVU136
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx	# tmp99, rio
+	.loc 1 888 5 is_stmt 1 view .LVU137
+# console.c:888:     char *nl = memchr(rio->bufptr + rio->scan, '\n', rio->cnt - rio->scan);
+	.loc 1 888 57 is_stmt 0 view .LVU138
+	movl	4(%rdi), %ebp	# rio_11(D)->cnt, iftmp.17_9
+# console.c:888:     char *nl = memchr(rio->bufptr + rio->scan, '\n', rio->cnt - rio->scan);
+	.loc 1 888 68 view .LVU139
+	movl	8(%rdi), %edi	# rio_11(D)->scan, _2
+.LVL57:
+# console.c:888:     char *nl = memchr(rio->bufptr + rio->scan, '\n', rio->cnt - rio->scan);
+	.loc 1 888 26 view .LVU140
+	movq	16(%rbx), %r12	# rio_11(D)->bufptr, _5
+# console.c:888:     char *nl = memchr(rio->bufptr + rio->scan, '\n', rio->cnt - rio->scan);
+	.loc 1 888 63 view .LVU141
+	movl	%ebp, %edx	# iftmp.17_9, tmp92
+	subl	%edi, %edx	# _2, tmp92
+# console.c:888:     char *nl = memchr(rio->bufptr + rio->scan, '\n', rio->cnt - rio->scan);
+	.loc 1 888 16 view .LVU142
+	movslq	%edx, %rdx	# tmp92, tmp93
+# console.c:888:     char *nl = memchr(rio->bufptr + rio->scan, '\n', rio->cnt - rio->scan);
+	.loc 1 888 40 view .LVU143
+	movslq	%edi, %rdi	# _2, _2
+# console.c:888:     char *nl = memchr(rio->bufptr + rio->scan, '\n', rio->cnt - rio->scan);
+	.loc 1 888 35 view .LVU144
+	addq	%r12, %rdi	# _5, tmp95
+# console.c:888:     char *nl = memchr(rio->bufptr + rio->scan, '\n', rio->cnt - rio->scan);
+	.loc 1 888 16 view .LVU145
+	movl	$10, %esi	#,
+	call	memchr@PLT	#
+.LVL58:
+	.loc 1 889 5 is_stmt 1 view .LVU146
+# console.c:889:     rio->scan = nl ? nl - rio->bufptr : rio->cnt;
+	.loc 1 889 15 is_stmt 0 view .LVU147
+	movq	%rax, %rdx	# <retval>, tmp96
+	subq	%r12, %rdx	# _5, tmp96
+	testq	%rax, %rax	# <retval>
+	cmovne	%edx, %ebp	# tmp96,, iftmp.17_9
+	movl	%ebp, 8(%rbx)	# iftmp.17_9, rio_11(D)->scan
+	.loc 1 890 5 is_stmt 1 view .LVU148
+# console.c:891: }
+	.loc 1 891 1 is_stmt 0 view .LVU149
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LVL59:
+	.loc 1 891 1 view .LVU150
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE60:
+	.size	find_newline, .-find_newline
+	.section	.rodata.str1.8
+	.align 8
+.LC17:
+	.string	"Read %.1f MB of commands in %.3f s (%.1f MB/s)"
+	.text
+	.type	pop_file, @function
+pop_file:
+.LFB57:
+	.loc 1 854 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 855 5 view .LVU152
+# console.c:855:     if (buf_stack) {
+	.loc 1 855 9 is_stmt 0 view .LVU153
+	movq	buf_stack(%rip), %rbx	# buf_stack, buf_stack.18_1
+# console.c:855:     if (buf_stack) {
+	.loc 1 855 8 view .LVU154
+	testq	%rbx, %rbx	# buf_stack.18_1
+	je	.L57	#,
+.LBB9:
+	.loc 1 856 9 is_stmt 1 view .LVU155
+.LVL60:
+	.loc 1 857 9 view .LVU156
+# console.c:857:         buf_stack = rsave->prev;
+	.loc 1 857 19 is_stmt 0 view .LVU157
+	movq	65592(%rbx), %rax	# buf_stack.18_1->prev, buf_stack.18_1->prev
+	movq	%rax, buf_stack(%rip)	# buf_stack.18_1->prev, buf_stack
+	.loc 1 858 9 is_stmt 1 view .LVU158
+# console.c:858:         if (rsave->map) {
+	.loc 1 858 18 is_stmt 0 view .LVU159
+	movq	65568(%rbx), %rax	# buf_stack.18_1->map, _3
+# console.c:858:         if (rsave->map) {
+	.loc 1 858 12 view .LVU160
+	testq	%rax, %rax	# _3
+	je	.L59	#,
+.LBB10:
+	.loc 1 859 13 is_stmt 1 view .LVU161
+# console.c:859:             size_t size = rsave->map_end - rsave->map;
+	.loc 1 859 42 is_stmt 0 view .LVU162
+	movq	65576(%rbx), %rbp	# buf_stack.18_1->map_end, size
+	subq	%rax, %rbp	# _3, size
+.LVL61:
+	.loc 1 860 13 is_stmt 1 view .LVU163
+# console.c:860:             double elapsed = delta_time(&rsave->start_time);
+	.loc 1 860 30 is_stmt 0 view .LVU164
+	leaq	65584(%rbx), %rdi	#, tmp97
+	call	delta_time@PLT	#
+.LVL62:
+	movapd	%xmm0, %xmm1	# tmp107, elapsed
+.LVL63:
+	.loc 1 861 13 is_stmt 1 view .LVU165
+# console.c:862:                    size / 1e6, elapsed, size / 1e6 / elapsed);
+	.loc 1 862 46 is_stmt 0 view .LVU166
+	testq	%rbp, %rbp	# size
+	js	.L60	#,
+	pxor	%xmm0, %xmm0	# tmp98
+.LVL64:
+	.loc 1 862 46 view .LVU167
+	cvtsi2sdq	%rbp, %xmm0	# size, tmp98
+.L61:
+	divsd	.LC16(%rip), %xmm0	#, _8
+# console.c:861:             report(3, "Read %.1f MB of commands in %.3f s (%.1f MB/s)",
+	.loc 1 861 13 view .LVU168
+	movapd	%xmm0, %xmm2	# _8, tmp112
+	divsd	%xmm1, %xmm2	# elapsed, tmp112
+	leaq	.LC17(%rip), %rsi	#, tmp104
+	movl	$3, %edi	#,
+	movl	$3, %eax	#,
+	call	report@PLT	#
+.LVL65:
+	.loc 1 863 13 is_stmt 1 view .LVU169
+	movq	65568(%rbx), %rdi	# buf_stack.18_1->map, buf_stack.18_1->map
+	movq	%rbp, %rsi	# size,
+	call	munmap@PLT	#
+.LVL66:
+.L59:
+	.loc 1 863 13 is_stmt 0 view .LVU170
+.LBE10:
+	.loc 1 865 9 is_stmt 1 view .LVU171
+	movl	(%rbx), %edi	# buf_stack.18_1->fd, buf_stack.18_1->fd
+	call	close@PLT	#
+.LVL67:
+	.loc 1 866 9 view .LVU172
+	movl	$65600, %esi	#,
+	movq	%rbx, %rdi	# buf_stack.18_1,
+	call	free_block@PLT	#
+.LVL68:
+.L57:
+	.loc 1 866 9 is_stmt 0 view .LVU173
+.LBE9:
+# console.c:868: }
+	.loc 1 868 1 view .LVU174
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL69:
+.L60:
+	.cfi_restore_state
+.LBB12:
+.LBB11:
+# console.c:862:                    size / 1e6, elapsed, size / 1e6 / elapsed);
+	.loc 1 862 46 view .LVU175
+	movq	%rbp, %rax	# size, tmp100
+	shrq	%rax	# tmp100
+	movq	%rbp, %rdx	# size, tmp101
+	andl	$1, %edx	#, tmp101
+	orq	%rdx, %rax	# tmp101, tmp100
+	pxor	%xmm0, %xmm0	# tmp99
+.LVL70:
+	.loc 1 862 46 view .LVU176
+	cvtsi2sdq	%rax, %xmm0	# tmp100, tmp99
+	addsd	%xmm0, %xmm0	# tmp99, tmp98
+	jmp	.L61	#
+.LBE11:
+.LBE12:
+	.cfi_endproc
+.LFE57:
+	.size	pop_file, .-pop_file
+	.section	.rodata.str1.1
+.LC18:
+	.string	"cmd> "
+.LC19:
+	.string	"%s"
+	.text
+	.type	echo_line, @function
+echo_line:
+.LVL71:
+.LFB59:
+	.loc 1 878 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 879 5 view .LVU178
+# console.c:879:     if (echo) {
+	.loc 1 879 8 is_stmt 0 view .LVU179
+	cmpb	$0, echo(%rip)	#, echo
+	jne	.L69	#,
+	ret	
+.L69:
+# console.c:878: {
+	.loc 1 878 1 view .LVU180
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp86, line
+	.loc 1 880 9 is_stmt 1 view .LVU181
+	leaq	.LC18(%rip), %rsi	#, tmp84
+	movl	$1, %edi	#,
+.LVL72:
+	.loc 1 880 9 is_stmt 0 view .LVU182
+	movl	$0, %eax	#,
+	call	report_noreturn@PLT	#
+.LVL73:
+	.loc 1 881 9 is_stmt 1 view .LVU183
+	movq	%rbx, %rdx	# line,
+	leaq	.LC19(%rip), %rsi	#, tmp85
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL74:
+# console.c:883: }
+	.loc 1 883 1 is_stmt 0 view .LVU184
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL75:
+	.loc 1 883 1 view .LVU185
+	ret	
+	.cfi_endproc
+.LFE59:
+	.size	echo_line, .-echo_line
+	.type	readline, @function
+readline:
+.LFB62:
+	.loc 1 923 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+	.loc 1 924 5 view .LVU187
+# console.c:924:     if (!buf_stack)
+	.loc 1 924 9 is_stmt 0 view .LVU188
+	movq	buf_stack(%rip), %r15	# buf_stack, <retval>
+# console.c:924:     if (!buf_stack)
+	.loc 1 924 8 view .LVU189
+	testq	%r15, %r15	# <retval>
+	je	.L70	#,
+	.loc 1 926 5 is_stmt 1 view .LVU190
+.LBB18:
+# console.c:949:         int n = read(rio->fd, rio->buf + rio->cnt, RIO_BUFSIZE - rio->cnt);
+	.loc 1 949 64 is_stmt 0 view .LVU191
+	movl	$65536, %r14d	#, tmp163
+.LBE18:
+# console.c:926:     if (buf_stack->map)
+	.loc 1 926 8 view .LVU192
+	cmpq	$0, 65568(%r15)	#, buf_stack.10_1->map
+	je	.L72	#,
+	.loc 1 927 9 is_stmt 1 view .LVU193
+.LVL76:
+.LBB22:
+.LBI22:
+	.loc 1 894 14 view .LVU194
+.LBB23:
+	.loc 1 896 5 view .LVU195
+# console.c:896:     char *line = rio->bufptr;
+	.loc 1 896 11 is_stmt 0 view .LVU196
+	movq	16(%r15), %r12	# buf_stack.10_1->bufptr, line
+.LVL77:
+	.loc 1 897 5 is_stmt 1 view .LVU197
+	.loc 1 898 5 view .LVU198
+# console.c:898:     if (left == 0) {
+	.loc 1 898 8 is_stmt 0 view .LVU199
+	movq	65576(%r15), %rbp	# buf_stack.10_1->map_end, len
+	subq	%r12, %rbp	# line, len
+.LVL78:
+	.loc 1 898 8 view .LVU200
+	je	.L90	#,
+	.loc 1 904 5 is_stmt 1 view .LVU201
+# console.c:904:     char *nl = memchr(line, '\n', left);
+	.loc 1 904 16 is_stmt 0 view .LVU202
+	movq	%rbp, %rdx	# len,
+	movl	$10, %esi	#,
+	movq	%r12, %rdi	# line,
+	call	memchr@PLT	#
+.LVL79:
+	movq	%rax, %rbx	# tmp164, nl
+.LVL80:
+	.loc 1 905 5 is_stmt 1 view .LVU203
+# console.c:905:     size_t len = nl ? (size_t) (nl - line) : left;
+	.loc 1 905 44 is_stmt 0 view .LVU204
+	testq	%rax, %rax	# nl
+	je	.L74	#,
+# console.c:905:     size_t len = nl ? (size_t) (nl - line) : left;
+	.loc 1 905 36 view .LVU205
+	movq	%rax, %rbp	# nl, iftmp.15_64
+.LVL81:
+	.loc 1 905 36 view .LVU206
+	subq	%r12, %rbp	# line, iftmp.15_64
+.LVL82:
+	.loc 1 906 5 is_stmt 1 view .LVU207
+# console.c:906:     if (len > RIO_BUFSIZE) {
+	.loc 1 906 8 is_stmt 0 view .LVU208
+	cmpq	$65536, %rbp	#, iftmp.15_64
+	ja	.L75	#,
+	.loc 1 911 5 is_stmt 1 view .LVU209
+	leaq	linebuf(%rip), %r13	#, tmp121
+	movq	%rbp, %rdx	# iftmp.15_64,
+	movq	%r12, %rsi	# line,
+	movq	%r13, %rdi	# tmp121,
+	call	memcpy@PLT	#
+.LVL83:
+	.loc 1 912 5 view .LVU210
+# console.c:912:     linebuf[len] = '\0';
+	.loc 1 912 18 is_stmt 0 view .LVU211
+	movb	$0, 0(%r13,%rbp)	#, linebuf[iftmp.15_64]
+	.loc 1 913 5 is_stmt 1 view .LVU212
+# console.c:913:     rio->bufptr = nl ? nl + 1 : line + len;
+	.loc 1 913 31 is_stmt 0 view .LVU213
+	addq	$1, %rbx	#, iftmp.16_68
+.LVL84:
+.L76:
+# console.c:913:     rio->bufptr = nl ? nl + 1 : line + len;
+	.loc 1 913 17 view .LVU214
+	movq	%rbx, 16(%r15)	# iftmp.16_68, buf_stack.10_1->bufptr
+	.loc 1 914 5 is_stmt 1 view .LVU215
+	leaq	linebuf(%rip), %r15	#, tmp128
+.LVL85:
+	.loc 1 914 5 is_stmt 0 view .LVU216
+	movq	%r15, %rdi	# tmp128,
+	call	echo_line	#
+.LVL86:
+	.loc 1 915 5 is_stmt 1 view .LVU217
+# console.c:915:     return linebuf;
+	.loc 1 915 12 is_stmt 0 view .LVU218
+	jmp	.L70	#
+.LVL87:
+.L90:
+	.loc 1 900 9 is_stmt 1 view .LVU219
+	movl	$0, %eax	#,
+	call	pop_file	#
+.LVL88:
+	.loc 1 901 9 view .LVU220
+# console.c:901:         return NULL;
+	.loc 1 901 16 is_stmt 0 view .LVU221
+	movl	$0, %r15d	#, <retval>
+.LVL89:
+	.loc 1 901 16 view .LVU222
+	jmp	.L70	#
+.LVL90:
+.L80:
+	.loc 1 901 16 view .LVU223
+.LBE23:
+.LBE22:
+.LBB25:
+	.loc 1 949 9 is_stmt 1 view .LVU224
+# console.c:949:         int n = read(rio->fd, rio->buf + rio->cnt, RIO_BUFSIZE - rio->cnt);
+	.loc 1 949 64 is_stmt 0 view .LVU225
+	movl	%r14d, %edx	# tmp163, tmp132
+	subl	%ebp, %edx	# _3, tmp132
+# console.c:949:         int n = read(rio->fd, rio->buf + rio->cnt, RIO_BUFSIZE - rio->cnt);
+	.loc 1 949 17 view .LVU226
+	movslq	%edx, %rdx	# tmp132, tmp134
+# console.c:949:         int n = read(rio->fd, rio->buf + rio->cnt, RIO_BUFSIZE - rio->cnt);
+	.loc 1 949 45 view .LVU227
+	movslq	%ebp, %rsi	# _3, _3
+# console.c:949:         int n = read(rio->fd, rio->buf + rio->cnt, RIO_BUFSIZE - rio->cnt);
+	.loc 1 949 17 view .LVU228
+	addq	%r13, %rsi	# _14, tmp136
+	movl	(%rbx), %edi	# rio_32->fd, rio_32->fd
+	call	read@PLT	#
+.LVL91:
+	.loc 1 950 9 is_stmt 1 view .LVU229
+# console.c:950:         if (n <= 0) {
+	.loc 1 950 12 is_stmt 0 view .LVU230
+	testl	%eax, %eax	# _21
+	jle	.L91	#,
+	.loc 1 965 9 is_stmt 1 view .LVU231
+# console.c:965:         rio->cnt += n;
+	.loc 1 965 18 is_stmt 0 view .LVU232
+	addl	%eax, 4(%rbx)	# _21, rio_32->cnt
+.LBE25:
+	.loc 1 929 5 is_stmt 1 view .LVU233
+.LVL92:
+.L72:
+	.loc 1 929 5 view .LVU234
+.LBB26:
+	.loc 1 930 9 view .LVU235
+# console.c:930:         rio_ptr rio = buf_stack;
+	.loc 1 930 17 is_stmt 0 view .LVU236
+	movq	buf_stack(%rip), %rbx	# buf_stack, rio
+.LVL93:
+	.loc 1 931 9 is_stmt 1 view .LVU237
+# console.c:931:         char *line = rio->bufptr;
+	.loc 1 931 15 is_stmt 0 view .LVU238
+	movq	16(%rbx), %r15	# rio_32->bufptr, <retval>
+.LVL94:
+	.loc 1 932 9 is_stmt 1 view .LVU239
+# console.c:932:         char *nl = find_newline(rio);
+	.loc 1 932 20 is_stmt 0 view .LVU240
+	movq	%rbx, %rdi	# rio,
+	call	find_newline	#
+.LVL95:
+	movq	%rax, %r12	# tmp165, nl
+.LVL96:
+	.loc 1 933 9 is_stmt 1 view .LVU241
+# console.c:933:         if (nl || rio->cnt == RIO_BUFSIZE) {
+	.loc 1 933 12 is_stmt 0 view .LVU242
+	testq	%rax, %rax	# nl
+	jne	.L77	#,
+# console.c:933:         if (nl || rio->cnt == RIO_BUFSIZE) {
+	.loc 1 933 22 discriminator 1 view .LVU243
+	movl	4(%rbx), %ebp	# rio_32->cnt, _3
+# console.c:933:         if (nl || rio->cnt == RIO_BUFSIZE) {
+	.loc 1 933 16 discriminator 1 view .LVU244
+	cmpl	$65536, %ebp	#, _3
+	je	.L92	#,
+	.loc 1 945 9 is_stmt 1 view .LVU245
+# console.c:945:         if (line != rio->buf) {
+	.loc 1 945 18 is_stmt 0 view .LVU246
+	leaq	24(%rbx), %r13	#, _14
+# console.c:945:         if (line != rio->buf) {
+	.loc 1 945 12 view .LVU247
+	cmpq	%r15, %r13	# <retval>, _14
+	je	.L80	#,
+	.loc 1 946 13 is_stmt 1 view .LVU248
+	movslq	%ebp, %rdx	# _3, _3
+	movq	%r15, %rsi	# <retval>,
+	movq	%r13, %rdi	# _14,
+	call	memmove@PLT	#
+.LVL97:
+	.loc 1 947 13 view .LVU249
+# console.c:947:             rio->bufptr = rio->buf;
+	.loc 1 947 25 is_stmt 0 view .LVU250
+	movq	%r13, 16(%rbx)	# _14, rio_32->bufptr
+	jmp	.L80	#
+.LVL98:
+.L91:
+.LBB19:
+	.loc 1 952 13 is_stmt 1 view .LVU251
+# console.c:952:             int cnt = rio->cnt;
+	.loc 1 952 17 is_stmt 0 view .LVU252
+	movl	4(%rbx), %eax	# rio_32->cnt, cnt
+.LVL99:
+	.loc 1 953 13 is_stmt 1 view .LVU253
+# console.c:953:             if (cnt > 0) {
+	.loc 1 953 16 is_stmt 0 view .LVU254
+	testl	%eax, %eax	# cnt
+	jle	.L93	#,
+	.loc 1 955 17 is_stmt 1 view .LVU255
+	leaq	linebuf(%rip), %r15	#, tmp138
+.LVL100:
+	.loc 1 955 17 is_stmt 0 view .LVU256
+	movslq	%eax, %rbx	# cnt, cnt
+.LVL101:
+	.loc 1 955 17 view .LVU257
+	movq	%rbx, %rdx	# cnt,
+	movq	%r13, %rsi	# _14,
+	movq	%r15, %rdi	# tmp138,
+	call	memcpy@PLT	#
+.LVL102:
+	.loc 1 956 17 is_stmt 1 view .LVU258
+# console.c:956:                 linebuf[cnt] = '\0';
+	.loc 1 956 30 is_stmt 0 view .LVU259
+	movb	$0, (%r15,%rbx)	#, linebuf[cnt_41]
+	.loc 1 958 13 is_stmt 1 view .LVU260
+	movl	$0, %eax	#,
+	call	pop_file	#
+.LVL103:
+	.loc 1 959 13 view .LVU261
+	.loc 1 960 17 view .LVU262
+	movq	%r15, %rdi	# tmp138,
+	call	echo_line	#
+.LVL104:
+	.loc 1 961 17 view .LVU263
+# console.c:961:                 return linebuf;
+	.loc 1 961 24 is_stmt 0 view .LVU264
+	jmp	.L70	#
+.LVL105:
+.L93:
+	.loc 1 958 13 is_stmt 1 view .LVU265
+	movl	$0, %eax	#,
+.LVL106:
+	.loc 1 958 13 is_stmt 0 view .LVU266
+	call	pop_file	#
+.LVL107:
+	.loc 1 959 13 is_stmt 1 view .LVU267
+	.loc 1 963 13 view .LVU268
+# console.c:963:             return NULL;
+	.loc 1 963 20 is_stmt 0 view .LVU269
+	movq	%r12, %r15	# nl, <retval>
+.LVL108:
+	.loc 1 963 20 view .LVU270
+	jmp	.L70	#
+.LVL109:
+.L94:
+	.loc 1 963 20 view .LVU271
+.LBE19:
+.LBE26:
+.LBB27:
+.LBB24:
+	.loc 1 911 5 is_stmt 1 view .LVU272
+	leaq	linebuf(%rip), %rbx	#, tmp156
+	movq	%rbp, %rdx	# len,
+	movq	%r12, %rsi	# line,
+	movq	%rbx, %rdi	# tmp156,
+	call	memcpy@PLT	#
+.LVL110:
+	.loc 1 912 5 view .LVU273
+# console.c:912:     linebuf[len] = '\0';
+	.loc 1 912 18 is_stmt 0 view .LVU274
+	movb	$0, (%rbx,%rbp)	#, linebuf[left_61]
+	.loc 1 913 5 is_stmt 1 view .LVU275
+	jmp	.L83	#
+.LVL111:
+.L74:
+	.loc 1 906 5 view .LVU276
+# console.c:906:     if (len > RIO_BUFSIZE) {
+	.loc 1 906 8 is_stmt 0 view .LVU277
+	cmpq	$65536, %rbp	#, len
+	jbe	.L94	#,
+.LVL112:
+.L75:
+	.loc 1 908 9 is_stmt 1 view .LVU278
+	.loc 1 909 9 view .LVU279
+	.loc 1 911 5 view .LVU280
+	movl	$65536, %edx	#,
+	movq	%r12, %rsi	# line,
+	leaq	linebuf(%rip), %rdi	#, tmp149
+	call	memcpy@PLT	#
+.LVL113:
+	.loc 1 912 5 view .LVU281
+# console.c:912:     linebuf[len] = '\0';
+	.loc 1 912 18 is_stmt 0 view .LVU282
+	movb	$0, 65536+linebuf(%rip)	#, linebuf[65536]
+	.loc 1 913 5 is_stmt 1 view .LVU283
+# console.c:908:         len = RIO_BUFSIZE;
+	.loc 1 908 13 is_stmt 0 view .LVU284
+	movl	$65536, %ebp	#, len
+.LVL114:
+.L83:
+# console.c:913:     rio->bufptr = nl ? nl + 1 : line + len;
+	.loc 1 913 31 view .LVU285
+	leaq	(%r12,%rbp), %rbx	#, iftmp.16_68
+	jmp	.L76	#
+.LVL115:
+.L77:
+	.loc 1 913 31 view .LVU286
+.LBE24:
+.LBE27:
+.LBB28:
+.LBB20:
+	.loc 1 935 13 is_stmt 1 view .LVU287
+# console.c:935:             int len = nl ? nl - line + 1 : rio->cnt;
+	.loc 1 935 31 is_stmt 0 view .LVU288
+	subq	%r15, %r12	# <retval>, _4
+# console.c:935:             int len = nl ? nl - line + 1 : rio->cnt;
+	.loc 1 935 38 view .LVU289
+	leal	1(%r12), %eax	#, iftmp.13_48
+.LVL116:
+	.loc 1 936 13 is_stmt 1 view .LVU290
+# console.c:936:             line[nl ? len - 1 : len] = '\0';
+	.loc 1 936 31 is_stmt 0 view .LVU291
+	movslq	%r12d, %r12	# _4, iftmp.14_27
+.L85:
+# console.c:936:             line[nl ? len - 1 : len] = '\0';
+	.loc 1 936 38 discriminator 4 view .LVU292
+	movb	$0, (%r15,%r12)	#, *_8
+	.loc 1 937 13 is_stmt 1 discriminator 4 view .LVU293
+# console.c:937:             rio->bufptr += len;
+	.loc 1 937 25 is_stmt 0 discriminator 4 view .LVU294
+	movslq	%eax, %rdx	# iftmp.13_48, iftmp.13_48
+	addq	%rdx, 16(%rbx)	# iftmp.13_48, rio_32->bufptr
+	.loc 1 938 13 is_stmt 1 discriminator 4 view .LVU295
+# console.c:938:             rio->cnt -= len;
+	.loc 1 938 22 is_stmt 0 discriminator 4 view .LVU296
+	subl	%eax, 4(%rbx)	# iftmp.13_48, rio_32->cnt
+	.loc 1 939 13 is_stmt 1 discriminator 4 view .LVU297
+# console.c:939:             rio->scan = 0;
+	.loc 1 939 23 is_stmt 0 discriminator 4 view .LVU298
+	movl	$0, 8(%rbx)	#, rio_32->scan
+	.loc 1 940 13 is_stmt 1 discriminator 4 view .LVU299
+	movq	%r15, %rdi	# <retval>,
+	call	echo_line	#
+.LVL117:
+	.loc 1 941 13 discriminator 4 view .LVU300
+.L70:
+	.loc 1 941 13 is_stmt 0 discriminator 4 view .LVU301
+.LBE20:
+.LBE28:
+# console.c:967: }
+	.loc 1 967 1 view .LVU302
+	movq	%r15, %rax	# <retval>,
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL118:
+.L92:
+	.cfi_restore_state
+.LBB29:
+.LBB21:
+	.loc 1 935 13 is_stmt 1 view .LVU303
+# console.c:935:             int len = nl ? nl - line + 1 : rio->cnt;
+	.loc 1 935 17 is_stmt 0 view .LVU304
+	movl	4(%rbx), %eax	# rio_32->cnt, iftmp.13_48
+.LVL119:
+	.loc 1 936 13 is_stmt 1 view .LVU305
+# console.c:936:             line[nl ? len - 1 : len] = '\0';
+	.loc 1 936 31 is_stmt 0 view .LVU306
+	movslq	%eax, %r12	# iftmp.13_48, iftmp.14_27
+.LVL120:
+	.loc 1 936 31 view .LVU307
+	jmp	.L85	#
+.LBE21:
+.LBE29:
+	.cfi_endproc
+.LFE62:
+	.size	readline, .-readline
+	.section	.rodata.str1.1
+.LC20:
+	.string	"%s "
+	.text
+	.type	do_comment_cmd, @function
+do_comment_cmd:
+.LVL121:
+.LFB46:
+	.loc 1 552 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 553 5 view .LVU309
+# console.c:553:     if (echo)
+	.loc 1 553 8 is_stmt 0 view .LVU310
+	cmpb	$0, echo(%rip)	#, echo
+	jne	.L102	#,
+# console.c:552: {
+	.loc 1 552 1 view .LVU311
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movl	%edi, %r13d	# tmp111, argc
+	movq	%rsi, %r14	# tmp112, argv
+.LVL122:
+	.loc 1 557 19 is_stmt 1 view .LVU312
+	cmpl	$1, %edi	#, argc
+	jle	.L99	#,
+	movq	%rsi, %rbx	# argv, ivtmp.203
+	leal	-2(%rdi), %eax	#, tmp102
+	leaq	8(%rsi,%rax,8), %r12	#, _35
+# console.c:558:         report_noreturn(1, "%s ", argv[i]);
+	.loc 1 558 9 is_stmt 0 view .LVU313
+	leaq	.LC20(%rip), %rbp	#, tmp106
+.LVL123:
+.L98:
+	.loc 1 558 9 is_stmt 1 discriminator 3 view .LVU314
+	movq	(%rbx), %rdx	# MEM[(char * *)_28], MEM[(char * *)_28]
+	movq	%rbp, %rsi	# tmp106,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report_noreturn@PLT	#
+.LVL124:
+	.loc 1 557 32 discriminator 3 view .LVU315
+	.loc 1 557 19 discriminator 3 view .LVU316
+	addq	$8, %rbx	#, ivtmp.203
+.LVL125:
+	.loc 1 557 19 is_stmt 0 discriminator 3 view .LVU317
+	cmpq	%r12, %rbx	# _35, ivtmp.203
+	jne	.L98	#,
+# console.c:557:     for (i = 0; i < argc - 1; i++)
+	.loc 1 557 32 view .LVU318
+	leal	-1(%r13), %eax	#, i
+.LVL126:
+.L97:
+	.loc 1 559 5 is_stmt 1 view .LVU319
+# console.c:559:     if (i < argc)
+	.loc 1 559 8 is_stmt 0 view .LVU320
+	cmpl	%eax, %r13d	# i, argc
+	jg	.L105	#,
+.L96:
+# console.c:563: }
+	.loc 1 563 1 view .LVU321
+	movl	$1, %eax	#,
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL127:
+	.loc 1 563 1 view .LVU322
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+.LVL128:
+	.loc 1 563 1 view .LVU323
+	ret	
+.LVL129:
+.L99:
+	.cfi_restore_state
+# console.c:557:     for (i = 0; i < argc - 1; i++)
+	.loc 1 557 12 view .LVU324
+	movl	$0, %eax	#, i
+	jmp	.L97	#
+.LVL130:
+.L105:
+	.loc 1 560 9 is_stmt 1 view .LVU325
+# console.c:560:         report(1, "%s", argv[i]);
+	.loc 1 560 29 is_stmt 0 view .LVU326
+	cltq
+# console.c:560:         report(1, "%s", argv[i]);
+	.loc 1 560 9 view .LVU327
+	movq	(%r14,%rax,8), %rdx	# *_9, *_9
+	leaq	.LC19(%rip), %rsi	#, tmp109
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL131:
+	jmp	.L96	#
+.LVL132:
+.L102:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+# console.c:563: }
+	.loc 1 563 1 view .LVU328
+	movl	$1, %eax	#,
+	ret	
+	.cfi_endproc
+.LFE46:
+	.size	do_comment_cmd, .-do_comment_cmd
+	.type	parse_args, @function
+parse_args:
+.LVL133:
+.LFB32:
+	.loc 1 319 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 319 1 is_stmt 0 view .LVU330
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %r13	# tmp117, line
+	movq	%rsi, %rbp	# tmp118, argv
+	movl	%edx, %ebx	# tmp119, max_args
+	movq	%rcx, %r12	# tmp120, endp
+	.loc 1 320 5 is_stmt 1 view .LVU331
+.LVL134:
+	.loc 1 321 5 view .LVU332
+# console.c:323:         while (isspace((unsigned char) *src))
+	.loc 1 323 16 is_stmt 0 view .LVU333
+	call	__ctype_b_loc@PLT	#
+.LVL135:
+	.loc 1 323 16 view .LVU334
+	movq	%rax, %r8	# tmp121, _1
+# console.c:321:     int argc = 0;
+	.loc 1 321 9 view .LVU335
+	movl	$0, %eax	#, <retval>
+	jmp	.L107	#
+.LVL136:
+.L108:
+	.loc 1 324 13 is_stmt 1 view .LVU336
+# console.c:324:             src++;
+	.loc 1 324 16 is_stmt 0 view .LVU337
+	addq	$1, %r13	#, line
+.LVL137:
+.L107:
+	.loc 1 323 16 is_stmt 1 view .LVU338
+	movzbl	0(%r13), %edx	# *src_22, _3
+	movzbl	%dl, %esi	# _3, _3
+	movq	(%r8), %rcx	# *_1, *_1
+	testb	$32, 1(%rcx,%rsi,2)	#, *_7
+	jne	.L108	#,
+	.loc 1 325 9 view .LVU339
+# console.c:325:         if (*src == '\0')
+	.loc 1 325 12 is_stmt 0 view .LVU340
+	testb	%dl, %dl	# _3
+	je	.L109	#,
+	.loc 1 327 9 is_stmt 1 view .LVU341
+# console.c:327:         if (argc < max_args)
+	.loc 1 327 12 is_stmt 0 view .LVU342
+	cmpl	%ebx, %eax	# max_args, <retval>
+	jge	.L110	#,
+	.loc 1 328 13 is_stmt 1 view .LVU343
+# console.c:328:             argv[argc] = src;
+	.loc 1 328 17 is_stmt 0 view .LVU344
+	movslq	%eax, %rdx	# <retval>, <retval>
+# console.c:328:             argv[argc] = src;
+	.loc 1 328 24 view .LVU345
+	movq	%r13, 0(%rbp,%rdx,8)	# line, *_13
+	.loc 1 329 9 is_stmt 1 view .LVU346
+# console.c:329:         argc++;
+	.loc 1 329 13 is_stmt 0 view .LVU347
+	addl	$1, %eax	#, <retval>
+.LVL138:
+	.loc 1 330 9 is_stmt 1 view .LVU348
+	.loc 1 330 29 view .LVU349
+# console.c:330:         while (*src != '\0' && !isspace((unsigned char) *src))
+	.loc 1 330 16 is_stmt 0 view .LVU350
+	movzbl	0(%r13), %ecx	# *src_22, _14
+# console.c:330:         while (*src != '\0' && !isspace((unsigned char) *src))
+	.loc 1 330 29 view .LVU351
+	testb	%cl, %cl	# _14
+	jne	.L115	#,
+	movq	%r13, %rdx	# line, src
+	jmp	.L111	#
+.LVL139:
+.L120:
+	.loc 1 332 9 is_stmt 1 view .LVU352
+# console.c:332:         if (*src == '\0')
+	.loc 1 332 12 is_stmt 0 view .LVU353
+	testb	%cl, %cl	# _14
+	je	.L117	#,
+	.loc 1 334 9 is_stmt 1 view .LVU354
+# console.c:334:         *src++ = '\0';
+	.loc 1 334 13 is_stmt 0 view .LVU355
+	leaq	1(%rdx), %r13	#, line
+.LVL140:
+# console.c:334:         *src++ = '\0';
+	.loc 1 334 16 view .LVU356
+	movb	$0, (%rdx)	#, *src_48
+	.loc 1 322 5 is_stmt 1 view .LVU357
+# console.c:323:         while (isspace((unsigned char) *src))
+	.loc 1 323 15 is_stmt 0 view .LVU358
+	jmp	.L107	#
+.LVL141:
+.L117:
+	.loc 1 323 15 view .LVU359
+	movq	%rdx, %r13	# src, line
+	jmp	.L109	#
+.LVL142:
+.L110:
+	.loc 1 329 9 is_stmt 1 view .LVU360
+# console.c:329:         argc++;
+	.loc 1 329 13 is_stmt 0 view .LVU361
+	addl	$1, %eax	#, <retval>
+.LVL143:
+	.loc 1 330 9 is_stmt 1 view .LVU362
+	.loc 1 330 29 view .LVU363
+# console.c:330:         while (*src != '\0' && !isspace((unsigned char) *src))
+	.loc 1 330 16 is_stmt 0 view .LVU364
+	movzbl	0(%r13), %ecx	# *src_22, _14
+.L115:
+# console.c:330:         while (*src != '\0' && !isspace((unsigned char) *src))
+	.loc 1 330 33 view .LVU365
+	movq	(%r8), %rdi	# *_1, _15
+	movq	%r13, %rdx	# line, src
+.LVL144:
+.L112:
+# console.c:330:         while (*src != '\0' && !isspace((unsigned char) *src))
+	.loc 1 330 33 discriminator 1 view .LVU366
+	movzbl	%cl, %esi	# _14, _14
+# console.c:330:         while (*src != '\0' && !isspace((unsigned char) *src))
+	.loc 1 330 29 discriminator 1 view .LVU367
+	testb	$32, 1(%rdi,%rsi,2)	#, *_19
+	jne	.L120	#,
+	.loc 1 331 13 is_stmt 1 view .LVU368
+# console.c:331:             src++;
+	.loc 1 331 16 is_stmt 0 view .LVU369
+	addq	$1, %rdx	#, src
+.LVL145:
+	.loc 1 330 29 is_stmt 1 view .LVU370
+# console.c:330:         while (*src != '\0' && !isspace((unsigned char) *src))
+	.loc 1 330 16 is_stmt 0 view .LVU371
+	movzbl	(%rdx), %ecx	# MEM[(char *)src_38], _14
+# console.c:330:         while (*src != '\0' && !isspace((unsigned char) *src))
+	.loc 1 330 29 view .LVU372
+	testb	%cl, %cl	# _14
+	jne	.L112	#,
+.L111:
+	.loc 1 332 9 is_stmt 1 view .LVU373
+	movq	%rdx, %r13	# src, line
+.LVL146:
+.L109:
+	.loc 1 336 5 view .LVU374
+# console.c:336:     *endp = src;
+	.loc 1 336 11 is_stmt 0 view .LVU375
+	movq	%r13, (%r12)	# line, *endp_41(D)
+	.loc 1 337 5 is_stmt 1 view .LVU376
+# console.c:338: }
+	.loc 1 338 1 is_stmt 0 view .LVU377
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL147:
+	.loc 1 338 1 view .LVU378
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+.LVL148:
+	.loc 1 338 1 view .LVU379
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL149:
+	.loc 1 338 1 view .LVU380
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+.LVL150:
+	.loc 1 338 1 view .LVU381
+	ret	
+	.cfi_endproc
+.LFE32:
+	.size	parse_args, .-parse_args
+	.type	collect_args, @function
+collect_args:
+.LVL151:
+.LFB33:
+	.loc 1 342 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 343 5 view .LVU383
+	.loc 1 344 5 view .LVU384
+	.loc 1 345 5 view .LVU385
+	.loc 1 345 16 view .LVU386
+	cmpq	%rsi, %rdi	# end, line
+	jnb	.L129	#,
+# console.c:342: {
+	.loc 1 342 1 is_stmt 0 view .LVU387
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx	# tmp104, line
+	movq	%rsi, %r12	# tmp105, end
+	movq	%rdx, %r13	# argv, ivtmp.223
+	jmp	.L123	#
+.LVL152:
+.L124:
+	.loc 1 347 13 is_stmt 1 view .LVU388
+# console.c:347:             src++;
+	.loc 1 347 16 is_stmt 0 view .LVU389
+	addq	$1, %rbx	#, line
+.LVL153:
+	.loc 1 346 26 is_stmt 1 view .LVU390
+	cmpq	%rbx, %r12	# line, end
+	je	.L121	#,
+.L125:
+# console.c:346:         while (src < end && (*src == '\0' || isspace((unsigned char) *src)))
+	.loc 1 346 30 is_stmt 0 discriminator 1 view .LVU391
+	movzbl	(%rbx), %ebp	# MEM[(char *)src_30], _1
+# console.c:346:         while (src < end && (*src == '\0' || isspace((unsigned char) *src)))
+	.loc 1 346 26 discriminator 1 view .LVU392
+	testb	%bpl, %bpl	# _1
+	je	.L124	#,
+# console.c:346:         while (src < end && (*src == '\0' || isspace((unsigned char) *src)))
+	.loc 1 346 46 discriminator 2 view .LVU393
+	call	__ctype_b_loc@PLT	#
+.LVL154:
+	movzbl	%bpl, %ebp	# _1, _1
+	movq	(%rax), %rax	# *_2, *_2
+# console.c:346:         while (src < end && (*src == '\0' || isspace((unsigned char) *src)))
+	.loc 1 346 43 discriminator 2 view .LVU394
+	testb	$32, 1(%rax,%rbp,2)	#, *_7
+	jne	.L124	#,
+.L126:
+	.loc 1 348 9 is_stmt 1 view .LVU395
+# console.c:348:         if (src == end)
+	.loc 1 348 12 is_stmt 0 view .LVU396
+	cmpq	%rbx, %r12	# line, end
+	je	.L121	#,
+	.loc 1 350 9 is_stmt 1 view .LVU397
+.LVL155:
+# console.c:350:         argv[argc++] = src;
+	.loc 1 350 22 is_stmt 0 view .LVU398
+	movq	%rbx, 0(%r13)	# line, MEM[(char * *)_28]
+	.loc 1 351 9 is_stmt 1 view .LVU399
+# console.c:351:         src += strlen(src);
+	.loc 1 351 16 is_stmt 0 view .LVU400
+	movq	%rbx, %rdi	# line,
+	call	strlen@PLT	#
+.LVL156:
+# console.c:351:         src += strlen(src);
+	.loc 1 351 13 view .LVU401
+	addq	%rax, %rbx	# tmp108, line
+.LVL157:
+	.loc 1 345 16 is_stmt 1 view .LVU402
+	addq	$8, %r13	#, ivtmp.223
+.LVL158:
+	.loc 1 345 16 is_stmt 0 view .LVU403
+	cmpq	%r12, %rbx	# end, line
+	jnb	.L121	#,
+.LVL159:
+.L123:
+	.loc 1 346 26 is_stmt 1 view .LVU404
+	cmpq	%r12, %rbx	# end, line
+	jb	.L125	#,
+	jmp	.L126	#
+.LVL160:
+.L121:
+# console.c:353: }
+	.loc 1 353 1 is_stmt 0 view .LVU405
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL161:
+	.loc 1 353 1 view .LVU406
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL162:
+	.loc 1 353 1 view .LVU407
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL163:
+.L129:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.loc 1 353 1 view .LVU408
+	ret	
+	.cfi_endproc
+.LFE33:
+	.size	collect_args, .-collect_args
+	.type	free_steps, @function
+free_steps:
+.LVL164:
+.LFB52:
+	.loc 1 687 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 687 1 is_stmt 0 view .LVU410
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp	# tmp98, step
+	.loc 1 688 5 is_stmt 1 view .LVU411
+	.loc 1 688 12 view .LVU412
+	testq	%rdi, %rdi	# step
+	je	.L132	#,
+.LVL165:
+.L134:
+.LBB30:
+	.loc 1 689 9 view .LVU413
+	movq	%rbp, %rbx	# step, step
+# console.c:689:         step_ptr next = step->next;
+	.loc 1 689 18 is_stmt 0 view .LVU414
+	movq	56(%rbp), %rbp	# step_19->next, step
+.LVL166:
+	.loc 1 690 9 is_stmt 1 view .LVU415
+	movq	48(%rbx), %rdi	# step_9->body, step_9->body
+	call	free_steps	#
+.LVL167:
+	.loc 1 691 9 view .LVU416
+	movslq	8(%rbx), %rsi	# step_9->argc, step_9->argc
+	movq	16(%rbx), %rdi	# step_9->argv, step_9->argv
+	movl	$8, %edx	#,
+	call	free_array@PLT	#
+.LVL168:
+	.loc 1 692 9 view .LVU417
+	movq	32(%rbx), %rax	# step_9->len, tmp100
+	leaq	1(%rax), %rsi	#, tmp95
+	movq	24(%rbx), %rdi	# step_9->line, step_9->line
+	call	free_block@PLT	#
+.LVL169:
+	.loc 1 693 9 view .LVU418
+	movl	$64, %esi	#,
+	movq	%rbx, %rdi	# step,
+	call	free_block@PLT	#
+.LVL170:
+	.loc 1 694 9 view .LVU419
+	.loc 1 694 9 is_stmt 0 view .LVU420
+.LBE30:
+	.loc 1 688 12 is_stmt 1 view .LVU421
+	testq	%rbp, %rbp	# step
+	jne	.L134	#,
+.LVL171:
+.L132:
+# console.c:696: }
+	.loc 1 696 1 is_stmt 0 view .LVU422
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL172:
+	.loc 1 696 1 view .LVU423
+	ret	
+	.cfi_endproc
+.LFE52:
+	.size	free_steps, .-free_steps
+	.type	table_clear, @function
+table_clear:
+.LVL173:
+.LFB28:
+	.loc 1 193 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 193 1 is_stmt 0 view .LVU425
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp86, table
+	.loc 1 194 5 is_stmt 1 view .LVU426
+# console.c:194:     if (table->slots)
+	.loc 1 194 14 is_stmt 0 view .LVU427
+	movq	(%rdi), %rdi	# table_5(D)->slots, _1
+.LVL174:
+# console.c:194:     if (table->slots)
+	.loc 1 194 8 view .LVU428
+	testq	%rdi, %rdi	# _1
+	je	.L138	#,
+	.loc 1 195 9 is_stmt 1 view .LVU429
+	movq	8(%rbx), %rsi	# table_5(D)->size, table_5(D)->size
+	movl	$16, %edx	#,
+	call	free_array@PLT	#
+.LVL175:
+.L138:
+	.loc 1 196 5 view .LVU430
+# console.c:196:     table->slots = NULL;
+	.loc 1 196 18 is_stmt 0 view .LVU431
+	movq	$0, (%rbx)	#, table_5(D)->slots
+	.loc 1 197 5 is_stmt 1 view .LVU432
+# console.c:197:     table->size = 0;
+	.loc 1 197 17 is_stmt 0 view .LVU433
+	movq	$0, 8(%rbx)	#, table_5(D)->size
+	.loc 1 198 5 is_stmt 1 view .LVU434
+# console.c:198:     table->cnt = 0;
+	.loc 1 198 16 is_stmt 0 view .LVU435
+	movq	$0, 16(%rbx)	#, table_5(D)->cnt
+# console.c:199: }
+	.loc 1 199 1 view .LVU436
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL176:
+	.loc 1 199 1 view .LVU437
+	ret	
+	.cfi_endproc
+.LFE28:
+	.size	table_clear, .-table_clear
+	.type	do_quit_cmd, @function
+do_quit_cmd:
+.LVL177:
+.LFB42:
+	.loc 1 470 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 470 1 is_stmt 0 view .LVU439
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movl	%edi, %ebp	# tmp105, argc
+	movq	%rsi, %r12	# tmp106, argv
+	.loc 1 471 5 is_stmt 1 view .LVU440
+# console.c:471:     if (quit_stats)
+	.loc 1 471 8 is_stmt 0 view .LVU441
+	cmpb	$0, quit_stats(%rip)	#, quit_stats
+	jne	.L158	#,
+.LVL178:
+.L141:
+	.loc 1 474 5 is_stmt 1 view .LVU442
+# console.c:474:     cmd_ptr c = cmd_list;
+	.loc 1 474 13 is_stmt 0 view .LVU443
+	movq	cmd_list(%rip), %rbx	# cmd_list, c
+.LVL179:
+	.loc 1 475 5 is_stmt 1 view .LVU444
+	.loc 1 476 5 view .LVU445
+	.loc 1 476 12 view .LVU446
+	testq	%rbx, %rbx	# c
+	je	.L142	#,
+.L143:
+.LBB31:
+	.loc 1 477 9 view .LVU447
+.LVL180:
+	.loc 1 478 9 view .LVU448
+	movq	%rbx, %rdi	# c, c
+# console.c:478:         c = c->next;
+	.loc 1 478 11 is_stmt 0 view .LVU449
+	movq	56(%rbx), %rbx	# c_47->next, c
+.LVL181:
+	.loc 1 479 9 is_stmt 1 view .LVU450
+	movl	$64, %esi	#,
+	call	free_block@PLT	#
+.LVL182:
+	.loc 1 479 9 is_stmt 0 view .LVU451
+.LBE31:
+	.loc 1 476 12 is_stmt 1 view .LVU452
+	testq	%rbx, %rbx	# c
+	jne	.L143	#,
+.LVL183:
+.L142:
+	.loc 1 482 5 view .LVU453
+# console.c:482:     param_ptr p = param_list;
+	.loc 1 482 15 is_stmt 0 view .LVU454
+	movq	param_list(%rip), %rbx	# param_list, p
+.LVL184:
+	.loc 1 483 5 is_stmt 1 view .LVU455
+	.loc 1 483 12 view .LVU456
+	testq	%rbx, %rbx	# p
+	je	.L144	#,
+.L145:
+.LBB32:
+	.loc 1 484 9 view .LVU457
+.LVL185:
+	.loc 1 485 9 view .LVU458
+	movq	%rbx, %rdi	# p, p
+# console.c:485:         p = p->next;
+	.loc 1 485 11 is_stmt 0 view .LVU459
+	movq	32(%rbx), %rbx	# p_50->next, p
+.LVL186:
+	.loc 1 486 9 is_stmt 1 view .LVU460
+	movl	$40, %esi	#,
+	call	free_block@PLT	#
+.LVL187:
+	.loc 1 486 9 is_stmt 0 view .LVU461
+.LBE32:
+	.loc 1 483 12 is_stmt 1 view .LVU462
+	testq	%rbx, %rbx	# p
+	jne	.L145	#,
+.LVL188:
+.L144:
+	.loc 1 488 5 view .LVU463
+# console.c:488:     cmd_list = NULL;
+	.loc 1 488 14 is_stmt 0 view .LVU464
+	movq	$0, cmd_list(%rip)	#, cmd_list
+	.loc 1 489 5 is_stmt 1 view .LVU465
+# console.c:489:     param_list = NULL;
+	.loc 1 489 16 is_stmt 0 view .LVU466
+	movq	$0, param_list(%rip)	#, param_list
+	.loc 1 490 5 is_stmt 1 view .LVU467
+	leaq	cmd_table(%rip), %rdi	#, tmp99
+	call	table_clear	#
+.LVL189:
+	.loc 1 491 5 view .LVU468
+	leaq	param_table(%rip), %rdi	#, tmp100
+	call	table_clear	#
+.LVL190:
+	.loc 1 493 5 view .LVU469
+.LBB33:
+	.loc 1 493 10 view .LVU470
+	.loc 1 493 23 view .LVU471
+	cmpl	$0, quit_helper_cnt(%rip)	#, quit_helper_cnt
+	jle	.L151	#,
+	movl	$0, %ebx	#, ivtmp.233
+.LVL191:
+	.loc 1 493 23 is_stmt 0 view .LVU472
+.LBE33:
+# console.c:475:     bool ok = true;
+	.loc 1 475 10 view .LVU473
+	movl	$1, %r14d	#, <retval>
+.LBB34:
+# console.c:494:         ok = ok && quit_helpers[i](argc, argv);
+	.loc 1 494 32 view .LVU474
+	leaq	quit_helpers(%rip), %r13	#, tmp104
+	jmp	.L148	#
+.LVL192:
+.L158:
+	.loc 1 494 32 view .LVU475
+.LBE34:
+	.loc 1 472 9 is_stmt 1 view .LVU476
+	movl	$0, %esi	#,
+.LVL193:
+	.loc 1 472 9 is_stmt 0 view .LVU477
+	movl	$0, %edi	#,
+.LVL194:
+	.loc 1 472 9 view .LVU478
+	call	do_stats_cmd	#
+.LVL195:
+	jmp	.L141	#
+.LVL196:
+.L147:
+.LBB35:
+# console.c:494:         ok = ok && quit_helpers[i](argc, argv);
+	.loc 1 494 12 discriminator 6 view .LVU479
+	movl	%eax, %r14d	# iftmp.49_10, <retval>
+	andl	$1, %r14d	#, <retval>
+.LVL197:
+	.loc 1 493 43 is_stmt 1 discriminator 6 view .LVU480
+	.loc 1 493 23 discriminator 6 view .LVU481
+	addq	$1, %rbx	#, ivtmp.233
+.LVL198:
+	.loc 1 493 23 is_stmt 0 discriminator 6 view .LVU482
+	cmpl	%ebx, quit_helper_cnt(%rip)	# ivtmp.233, quit_helper_cnt
+	jle	.L146	#,
+.LVL199:
+.L148:
+	.loc 1 494 9 is_stmt 1 view .LVU483
+# console.c:494:         ok = ok && quit_helpers[i](argc, argv);
+	.loc 1 494 17 is_stmt 0 view .LVU484
+	movl	$0, %eax	#, iftmp.49_10
+	testb	%r14b, %r14b	# <retval>
+	je	.L147	#,
+.LVL200:
+# console.c:494:         ok = ok && quit_helpers[i](argc, argv);
+	.loc 1 494 20 discriminator 1 view .LVU485
+	movq	%r12, %rsi	# argv,
+	movl	%ebp, %edi	# argc,
+	call	*0(%r13,%rbx,8)	# MEM[(_Bool (*<T6c8>) (int, char * *) *)&quit_helpers + ivtmp.233_16 * 8]
+.LVL201:
+# console.c:494:         ok = ok && quit_helpers[i](argc, argv);
+	.loc 1 494 17 discriminator 1 view .LVU486
+	movzbl	%al, %eax	# tmp107, iftmp.49_10
+	jmp	.L147	#
+.LVL202:
+.L151:
+	.loc 1 494 17 discriminator 1 view .LVU487
+.LBE35:
+# console.c:475:     bool ok = true;
+	.loc 1 475 10 view .LVU488
+	movl	$1, %r14d	#, <retval>
+.LVL203:
+.L146:
+	.loc 1 498 12 is_stmt 1 view .LVU489
+	cmpq	$0, buf_stack(%rip)	#, buf_stack
+	je	.L149	#,
+.L150:
+	.loc 1 499 9 view .LVU490
+	movl	$0, %eax	#,
+	call	pop_file	#
+.LVL204:
+	.loc 1 498 12 view .LVU491
+	cmpq	$0, buf_stack(%rip)	#, buf_stack
+	jne	.L150	#,
+.L149:
+	.loc 1 501 5 view .LVU492
+# console.c:501:     quit_flag = true;
+	.loc 1 501 15 is_stmt 0 view .LVU493
+	movb	$1, quit_flag(%rip)	#, quit_flag
+	.loc 1 502 5 is_stmt 1 view .LVU494
+# console.c:503: }
+	.loc 1 503 1 is_stmt 0 view .LVU495
+	movl	%r14d, %eax	# <retval>,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+.LVL205:
+	.loc 1 503 1 view .LVU496
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+.LVL206:
+	.loc 1 503 1 view .LVU497
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE42:
+	.size	do_quit_cmd, .-do_quit_cmd
+	.section	.rodata.str1.1
+.LC21:
+	.string	"table_insert"
+	.text
+	.type	table_insert, @function
+table_insert:
+.LVL207:
+.LFB27:
+	.loc 1 169 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 169 1 is_stmt 0 view .LVU499
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 80
+	movq	%rdi, %rbp	# tmp116, table
+	movq	%rsi, %r13	# tmp117, name
+	movq	%rdx, 8(%rsp)	# tmp118, %sfp
+	.loc 1 170 5 is_stmt 1 view .LVU500
+# console.c:170:     if (2 * (table->cnt + 1) > table->size) {
+	.loc 1 170 37 is_stmt 0 view .LVU501
+	movq	8(%rdi), %rax	# table_25(D)->size, _4
+# console.c:170:     if (2 * (table->cnt + 1) > table->size) {
+	.loc 1 170 25 view .LVU502
+	movq	16(%rdi), %rdx	# table_25(D)->cnt, table_25(D)->cnt
+.LVL208:
+# console.c:170:     if (2 * (table->cnt + 1) > table->size) {
+	.loc 1 170 11 view .LVU503
+	leaq	2(%rdx,%rdx), %rdx	#, tmp107
+# console.c:170:     if (2 * (table->cnt + 1) > table->size) {
+	.loc 1 170 8 view .LVU504
+	cmpq	%rdx, %rax	# tmp107, _4
+	jnb	.L160	#,
+.LBB36:
+	.loc 1 171 9 is_stmt 1 view .LVU505
+# console.c:171:         size_t size = table->size ? 2 * table->size : TABLE_MIN_SIZE;
+	.loc 1 171 53 is_stmt 0 view .LVU506
+	leaq	(%rax,%rax), %r14	#, tmp114
+	testq	%rax, %rax	# _4
+	movl	$64, %eax	#, tmp115
+	cmove	%rax, %r14	# tmp114,, tmp115, iftmp.53_18
+.LVL209:
+	.loc 1 172 9 is_stmt 1 view .LVU507
+# console.c:172:         slot_t *slots = calloc_or_fail(size, sizeof(slot_t), "table_insert");
+	.loc 1 172 25 is_stmt 0 view .LVU508
+	leaq	.LC21(%rip), %rdx	#, tmp108
+	movl	$16, %esi	#,
+.LVL210:
+	.loc 1 172 25 view .LVU509
+	movq	%r14, %rdi	# iftmp.53_18,
+.LVL211:
+	.loc 1 172 25 view .LVU510
+	call	calloc_or_fail@PLT	#
+.LVL212:
+	movq	%rax, %r15	# tmp119, slots
+.LVL213:
+	.loc 1 173 9 is_stmt 1 view .LVU511
+.LBB37:
+	.loc 1 173 14 view .LVU512
+	.loc 1 173 30 view .LVU513
+# console.c:173:         for (size_t i = 0; i < table->size; i++) {
+	.loc 1 173 37 is_stmt 0 view .LVU514
+	movq	8(%rbp), %rsi	# table_25(D)->size, _10
+# console.c:173:         for (size_t i = 0; i < table->size; i++) {
+	.loc 1 173 30 view .LVU515
+	testq	%rsi, %rsi	# _10
+	je	.L162	#,
+# console.c:173:         for (size_t i = 0; i < table->size; i++) {
+	.loc 1 173 21 view .LVU516
+	movl	$0, %r12d	#, i
+	jmp	.L164	#
+.LVL214:
+.L163:
+	.loc 1 173 46 is_stmt 1 discriminator 2 view .LVU517
+	addq	$1, %r12	#, i
+.LVL215:
+	.loc 1 173 30 discriminator 2 view .LVU518
+# console.c:173:         for (size_t i = 0; i < table->size; i++) {
+	.loc 1 173 37 is_stmt 0 discriminator 2 view .LVU519
+	movq	8(%rbp), %rsi	# table_25(D)->size, _10
+# console.c:173:         for (size_t i = 0; i < table->size; i++) {
+	.loc 1 173 30 discriminator 2 view .LVU520
+	cmpq	%rsi, %r12	# _10, i
+	jnb	.L162	#,
+.LVL216:
+.L164:
+	.loc 1 174 13 is_stmt 1 view .LVU521
+# console.c:174:             if (table->slots[i].name)
+	.loc 1 174 29 is_stmt 0 view .LVU522
+	movq	%r12, %rbx	# i, tmp109
+	salq	$4, %rbx	#, tmp109
+	addq	0(%rbp), %rbx	# table_25(D)->slots, _7
+# console.c:174:             if (table->slots[i].name)
+	.loc 1 174 32 view .LVU523
+	movq	(%rbx), %rdx	# _7->name, _8
+# console.c:174:             if (table->slots[i].name)
+	.loc 1 174 16 view .LVU524
+	testq	%rdx, %rdx	# _8
+	je	.L163	#,
+	.loc 1 175 17 is_stmt 1 view .LVU525
+# console.c:175:                 *table_slot(slots, size, table->slots[i].name) =
+	.loc 1 175 18 is_stmt 0 view .LVU526
+	movq	%r14, %rsi	# iftmp.53_18,
+	movq	%r15, %rdi	# slots,
+	call	table_slot	#
+.LVL217:
+# console.c:175:                 *table_slot(slots, size, table->slots[i].name) =
+	.loc 1 175 64 view .LVU527
+	movdqu	(%rbx), %xmm0	# *_7, tmp124
+	movups	%xmm0, (%rax)	# tmp124, *_9
+	jmp	.L163	#
+.LVL218:
+.L162:
+	.loc 1 175 64 view .LVU528
+.LBE37:
+	.loc 1 178 9 is_stmt 1 view .LVU529
+# console.c:178:         if (table->slots)
+	.loc 1 178 18 is_stmt 0 view .LVU530
+	movq	0(%rbp), %rdi	# table_25(D)->slots, _11
+# console.c:178:         if (table->slots)
+	.loc 1 178 12 view .LVU531
+	testq	%rdi, %rdi	# _11
+	je	.L165	#,
+	.loc 1 179 13 is_stmt 1 view .LVU532
+	movl	$16, %edx	#,
+	call	free_array@PLT	#
+.LVL219:
+.L165:
+	.loc 1 180 9 view .LVU533
+# console.c:180:         table->slots = slots;
+	.loc 1 180 22 is_stmt 0 view .LVU534
+	movq	%r15, 0(%rbp)	# slots, table_25(D)->slots
+	.loc 1 181 9 is_stmt 1 view .LVU535
+# console.c:181:         table->size = size;
+	.loc 1 181 21 is_stmt 0 view .LVU536
+	movq	%r14, 8(%rbp)	# iftmp.53_18, table_25(D)->size
+.LVL220:
+.L160:
+	.loc 1 181 21 view .LVU537
+.LBE36:
+	.loc 1 184 5 is_stmt 1 view .LVU538
+# console.c:184:     slot_t *slot = table_slot(table->slots, table->size, name);
+	.loc 1 184 20 is_stmt 0 view .LVU539
+	movq	8(%rbp), %rsi	# table_25(D)->size, table_25(D)->size
+	movq	0(%rbp), %rdi	# table_25(D)->slots, table_25(D)->slots
+	movq	%r13, %rdx	# name,
+	call	table_slot	#
+.LVL221:
+	.loc 1 185 5 is_stmt 1 view .LVU540
+# console.c:185:     if (!slot->name)
+	.loc 1 185 8 is_stmt 0 view .LVU541
+	cmpq	$0, (%rax)	#, slot_35->name
+	je	.L170	#,
+.L166:
+	.loc 1 187 5 is_stmt 1 view .LVU542
+# console.c:187:     slot->name = name;
+	.loc 1 187 16 is_stmt 0 view .LVU543
+	movq	%r13, (%rax)	# name, slot_35->name
+	.loc 1 188 5 is_stmt 1 view .LVU544
+# console.c:188:     slot->ele = ele;
+	.loc 1 188 15 is_stmt 0 view .LVU545
+	movq	8(%rsp), %rcx	# %sfp, ele
+	movq	%rcx, 8(%rax)	# ele, slot_35->ele
+# console.c:189: }
+	.loc 1 189 1 view .LVU546
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL222:
+	.loc 1 189 1 view .LVU547
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL223:
+	.loc 1 189 1 view .LVU548
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL224:
+.L170:
+	.cfi_restore_state
+	.loc 1 186 9 is_stmt 1 view .LVU549
+# console.c:186:         table->cnt++;
+	.loc 1 186 19 is_stmt 0 view .LVU550
+	addq	$1, 16(%rbp)	#, table_25(D)->cnt
+	jmp	.L166	#
+	.cfi_endproc
+.LFE27:
+	.size	table_insert, .-table_insert
+	.section	.rodata.str1.1
+.LC22:
+	.string	" %s"
+.LC23:
+	.string	"next_compiled"
+.LC24:
+	.string	""
+	.text
+	.type	next_compiled, @function
+next_compiled:
+.LVL225:
+.LFB70:
+	.loc 1 1218 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1219 5 view .LVU552
+# console.c:1219:     if (bc_left == 0)
+	.loc 1 1219 17 is_stmt 0 view .LVU553
+	movq	bc_left(%rip), %rax	# bc_left, bc_left.111_1
+# console.c:1220:         return 0;
+	.loc 1 1220 16 view .LVU554
+	movl	$0, %edx	#, <retval>
+# console.c:1219:     if (bc_left == 0)
+	.loc 1 1219 8 view .LVU555
+	testq	%rax, %rax	# bc_left.111_1
+	je	.L188	#,
+# console.c:1218: {
+	.loc 1 1218 1 view .LVU556
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %rbp	# tmp137, argvp
+	.loc 1 1221 5 is_stmt 1 view .LVU557
+# console.c:1221:     bc_left--;
+	.loc 1 1221 12 is_stmt 0 view .LVU558
+	subq	$1, %rax	#, tmp120
+	movq	%rax, bc_left(%rip)	# tmp120, bc_left
+	.loc 1 1223 5 is_stmt 1 view .LVU559
+# console.c:1223:     uint32_t argc = bc_code < bc_code_end ? *bc_code++ : 0;
+	.loc 1 1223 29 is_stmt 0 view .LVU560
+	movq	bc_code(%rip), %rdx	# bc_code, bc_code.114_3
+	movq	bc_code_end(%rip), %rax	# bc_code_end, bc_code_end.115_4
+# console.c:1223:     uint32_t argc = bc_code < bc_code_end ? *bc_code++ : 0;
+	.loc 1 1223 56 view .LVU561
+	cmpq	%rax, %rdx	# bc_code_end.115_4, bc_code.114_3
+	jnb	.L180	#,
+# console.c:1223:     uint32_t argc = bc_code < bc_code_end ? *bc_code++ : 0;
+	.loc 1 1223 53 discriminator 1 view .LVU562
+	leaq	4(%rdx), %rcx	#, _6
+	movq	%rcx, bc_code(%rip)	# _6, bc_code
+# console.c:1223:     uint32_t argc = bc_code < bc_code_end ? *bc_code++ : 0;
+	.loc 1 1223 56 discriminator 1 view .LVU563
+	movl	(%rdx), %r13d	# *bc_code.114_3, iftmp.113_50
+.LVL226:
+	.loc 1 1224 5 is_stmt 1 discriminator 1 view .LVU564
+# console.c:1224:     if (argc == 0 || argc > (size_t) (bc_code_end - bc_code))
+	.loc 1 1224 8 is_stmt 0 discriminator 1 view .LVU565
+	testl	%r13d, %r13d	# iftmp.113_50
+	je	.L181	#,
+# console.c:1224:     if (argc == 0 || argc > (size_t) (bc_code_end - bc_code))
+	.loc 1 1224 27 discriminator 1 view .LVU566
+	movl	%r13d, %r12d	# iftmp.113_50, _7
+# console.c:1224:     if (argc == 0 || argc > (size_t) (bc_code_end - bc_code))
+	.loc 1 1224 51 discriminator 1 view .LVU567
+	subq	%rcx, %rax	# _6, tmp121
+	sarq	$2, %rax	#, tmp123
+# console.c:1224:     if (argc == 0 || argc > (size_t) (bc_code_end - bc_code))
+	.loc 1 1224 19 discriminator 1 view .LVU568
+	cmpq	%r12, %rax	# _7, tmp123
+	jb	.L182	#,
+	.loc 1 1227 5 is_stmt 1 view .LVU569
+# console.c:1227:     if (argc > MAXARGS)
+	.loc 1 1227 8 is_stmt 0 view .LVU570
+	cmpl	$32, %r13d	#, iftmp.113_50
+	ja	.L191	#,
+.LVL227:
+.L173:
+.LBB38:
+	.loc 1 1229 28 is_stmt 1 discriminator 1 view .LVU571
+# console.c:1230:         if (bc_code[i] >= bc_nstrings) {
+	.loc 1 1230 20 is_stmt 0 discriminator 1 view .LVU572
+	movq	bc_code(%rip), %rcx	# bc_code, bc_code.120_12
+# console.c:1230:         if (bc_code[i] >= bc_nstrings) {
+	.loc 1 1230 24 discriminator 1 view .LVU573
+	movl	bc_nstrings(%rip), %esi	# bc_nstrings, bc_nstrings.121_17
+# console.c:1235:         (*argvp)[i] = bc_strings[bc_code[i]];
+	.loc 1 1235 33 discriminator 1 view .LVU574
+	movq	bc_strings(%rip), %rdi	# bc_strings, bc_strings.122_19
+	movl	$0, %ebx	#, ivtmp.251
+	jmp	.L175	#
+.LVL228:
+.L191:
+	.loc 1 1235 33 discriminator 1 view .LVU575
+.LBE38:
+	.loc 1 1228 9 is_stmt 1 view .LVU576
+# console.c:1228:         *argvp = calloc_or_fail(argc, sizeof(char *), "next_compiled");
+	.loc 1 1228 18 is_stmt 0 view .LVU577
+	leaq	.LC23(%rip), %rdx	#, tmp124
+	movl	$8, %esi	#,
+	movq	%r12, %rdi	# _7,
+.LVL229:
+	.loc 1 1228 18 view .LVU578
+	call	calloc_or_fail@PLT	#
+.LVL230:
+# console.c:1228:         *argvp = calloc_or_fail(argc, sizeof(char *), "next_compiled");
+	.loc 1 1228 16 view .LVU579
+	movq	%rax, 0(%rbp)	# tmp138, *argvp_53(D)
+	jmp	.L173	#
+.LVL231:
+.L184:
+.LBB39:
+	.loc 1 1228 16 view .LVU580
+	movq	%rax, %rbx	# ivtmp.251, ivtmp.251
+.LVL232:
+.L175:
+	.loc 1 1230 9 is_stmt 1 view .LVU581
+# console.c:1230:         if (bc_code[i] >= bc_nstrings) {
+	.loc 1 1230 20 is_stmt 0 view .LVU582
+	movl	(%rcx,%rbx,4), %eax	# MEM[(uint32_t *)bc_code.120_12 + ivtmp.251_5 * 4], _16
+# console.c:1230:         if (bc_code[i] >= bc_nstrings) {
+	.loc 1 1230 12 view .LVU583
+	cmpl	%esi, %eax	# bc_nstrings.121_17, _16
+	jnb	.L192	#,
+	.loc 1 1235 9 is_stmt 1 discriminator 2 view .LVU584
+# console.c:1235:         (*argvp)[i] = bc_strings[bc_code[i]];
+	.loc 1 1235 41 is_stmt 0 discriminator 2 view .LVU585
+	movl	%eax, %eax	# _16, _16
+# console.c:1235:         (*argvp)[i] = bc_strings[bc_code[i]];
+	.loc 1 1235 33 discriminator 2 view .LVU586
+	movq	(%rdi,%rax,8), %rdx	# *_22, _26
+# console.c:1235:         (*argvp)[i] = bc_strings[bc_code[i]];
+	.loc 1 1235 21 discriminator 2 view .LVU587
+	movq	0(%rbp), %rax	# *argvp_53(D), *argvp_53(D)
+	movq	%rdx, (%rax,%rbx,8)	# _26, *_25
+	.loc 1 1229 37 is_stmt 1 discriminator 2 view .LVU588
+.LVL233:
+	.loc 1 1229 28 discriminator 2 view .LVU589
+	leaq	1(%rbx), %rax	#, ivtmp.251
+	cmpq	%rax, %r12	# ivtmp.251, _7
+	jne	.L184	#,
+.LBE39:
+	.loc 1 1237 5 view .LVU590
+# console.c:1237:     bc_code += argc;
+	.loc 1 1237 13 is_stmt 0 view .LVU591
+	leaq	(%rcx,%rax,4), %rax	#, tmp129
+	movq	%rax, bc_code(%rip)	# tmp129, bc_code
+	.loc 1 1239 5 is_stmt 1 view .LVU592
+# console.c:1239:     if (echo) {
+	.loc 1 1239 8 is_stmt 0 view .LVU593
+	cmpb	$0, echo(%rip)	#, echo
+	jne	.L193	#,
+.L176:
+	.loc 1 1245 5 is_stmt 1 view .LVU594
+# console.c:1245:     return argc;
+	.loc 1 1245 12 is_stmt 0 view .LVU595
+	movl	%r13d, %edx	# iftmp.113_50, <retval>
+.LVL234:
+.L171:
+# console.c:1246: }
+	.loc 1 1246 1 view .LVU596
+	movl	%edx, %eax	# <retval>,
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL235:
+	.loc 1 1246 1 view .LVU597
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL236:
+.L192:
+	.cfi_restore_state
+.LBB40:
+	.loc 1 1231 13 is_stmt 1 view .LVU598
+# console.c:1233:             return -1;
+	.loc 1 1233 20 is_stmt 0 view .LVU599
+	movl	$-1, %edx	#, <retval>
+# console.c:1231:             if (argc > MAXARGS)
+	.loc 1 1231 16 view .LVU600
+	cmpl	$32, %r13d	#, iftmp.113_50
+	jbe	.L171	#,
+	.loc 1 1232 17 is_stmt 1 view .LVU601
+	movq	0(%rbp), %rdi	# *argvp_53(D), *argvp_53(D)
+	movl	$8, %edx	#,
+	movq	%r12, %rsi	# _7,
+	call	free_array@PLT	#
+.LVL237:
+# console.c:1233:             return -1;
+	.loc 1 1233 20 is_stmt 0 view .LVU602
+	movl	$-1, %edx	#, <retval>
+	jmp	.L171	#
+.LVL238:
+.L193:
+	.loc 1 1233 20 view .LVU603
+.LBE40:
+	.loc 1 1240 9 is_stmt 1 view .LVU604
+	leaq	.LC18(%rip), %rsi	#, tmp130
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report_noreturn@PLT	#
+.LVL239:
+	.loc 1 1241 9 view .LVU605
+.LBB41:
+	.loc 1 1241 14 view .LVU606
+	.loc 1 1241 32 view .LVU607
+.LBE41:
+# console.c:1240:         report_noreturn(1, prompt);
+	.loc 1 1240 9 is_stmt 0 view .LVU608
+	movl	$0, %r12d	#, ivtmp.247
+.LBB42:
+# console.c:1242:             report_noreturn(1, i ? " %s" : "%s", (*argvp)[i]);
+	.loc 1 1242 13 view .LVU609
+	leaq	.LC19(%rip), %r15	#, tmp135
+	leaq	.LC22(%rip), %r14	#, tmp136
+	jmp	.L178	#
+.LVL240:
+.L186:
+	.loc 1 1242 13 view .LVU610
+	movq	%rax, %r12	# ivtmp.247, ivtmp.247
+.LVL241:
+.L178:
+	.loc 1 1242 13 is_stmt 1 view .LVU611
+	movq	0(%rbp), %rax	# *argvp_53(D), *argvp_53(D)
+	movq	(%rax,%r12,8), %rdx	# *_35, _36
+	testl	%r12d, %r12d	# ivtmp.247
+	movq	%r14, %rsi	# tmp136, iftmp.127_40
+	cmove	%r15, %rsi	# tmp135,, iftmp.127_40
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report_noreturn@PLT	#
+.LVL242:
+	.loc 1 1241 41 view .LVU612
+	.loc 1 1241 32 view .LVU613
+	leaq	1(%r12), %rax	#, ivtmp.247
+	cmpq	%r12, %rbx	# ivtmp.247, ivtmp.251
+	jne	.L186	#,
+.LBE42:
+	.loc 1 1243 9 view .LVU614
+	leaq	.LC24(%rip), %rsi	#, tmp133
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL243:
+	jmp	.L176	#
+.LVL244:
+.L180:
+# console.c:1225:         return -1;
+	.loc 1 1225 16 is_stmt 0 view .LVU615
+	movl	$-1, %edx	#, <retval>
+	jmp	.L171	#
+.LVL245:
+.L181:
+	.loc 1 1225 16 view .LVU616
+	movl	$-1, %edx	#, <retval>
+	jmp	.L171	#
+.L182:
+	movl	$-1, %edx	#, <retval>
+	jmp	.L171	#
+.LVL246:
+.L188:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+# console.c:1246: }
+	.loc 1 1246 1 view .LVU617
+	movl	%edx, %eax	# <retval>,
+	ret	
+	.cfi_endproc
+.LFE70:
+	.size	next_compiled, .-next_compiled
+	.section	.rodata.str1.1
+.LC25:
+	.string	"Unknown command '%s'"
+.LC26:
+	.string	"ns"
+.LC27:
+	.string	"ok"
+	.text
+	.type	run_cmd, @function
+run_cmd:
+.LVL247:
+.LFB35:
+	.loc 1 366 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 366 1 is_stmt 0 view .LVU619
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdx, %rbp	# tmp127, argv
+	.loc 1 367 5 is_stmt 1 view .LVU620
+.LVL248:
+	.loc 1 368 5 view .LVU621
+# console.c:368:     if (next_cmd) {
+	.loc 1 368 8 is_stmt 0 view .LVU622
+	testq	%rdi, %rdi	# next_cmd
+	je	.L195	#,
+	movq	%rdi, %rbx	# tmp125, next_cmd
+	movl	%esi, %r12d	# tmp126, argc
+.LBB43:
+	.loc 1 369 9 is_stmt 1 view .LVU623
+# console.c:369:         bool record = cmd_depth == 0 && metrics_enabled();
+	.loc 1 369 38 is_stmt 0 view .LVU624
+	cmpl	$0, cmd_depth(%rip)	#, cmd_depth
+	je	.L205	#,
+.LVL249:
+.L196:
+	.loc 1 375 9 is_stmt 1 view .LVU625
+# console.c:375:         cmd_depth++;
+	.loc 1 375 18 is_stmt 0 view .LVU626
+	addl	$1, cmd_depth(%rip)	#, cmd_depth
+	.loc 1 376 9 is_stmt 1 view .LVU627
+# console.c:376:         uint64_t start = time_ns();
+	.loc 1 376 26 is_stmt 0 view .LVU628
+	movl	$0, %eax	#,
+	call	time_ns@PLT	#
+.LVL250:
+	movq	%rax, %r13	# tmp132, start
+.LVL251:
+	.loc 1 377 9 is_stmt 1 view .LVU629
+# console.c:377:         ok = next_cmd->operation(argc, argv);
+	.loc 1 377 14 is_stmt 0 view .LVU630
+	movq	%rbp, %rsi	# argv,
+	movl	%r12d, %edi	# argc,
+	call	*8(%rbx)	# next_cmd_28(D)->operation
+.LVL252:
+	.loc 1 377 14 view .LVU631
+	movl	%eax, %ebp	# tmp133, <retval>
+.LVL253:
+	.loc 1 378 9 is_stmt 1 view .LVU632
+# console.c:378:         uint64_t elapsed = time_ns() - start;
+	.loc 1 378 28 is_stmt 0 view .LVU633
+	movl	$0, %eax	#,
+.LVL254:
+	.loc 1 378 28 view .LVU634
+	call	time_ns@PLT	#
+.LVL255:
+# console.c:378:         uint64_t elapsed = time_ns() - start;
+	.loc 1 378 18 view .LVU635
+	subq	%r13, %rax	# start, tmp134
+	movq	%rax, %r12	# tmp134, elapsed
+.LVL256:
+	.loc 1 379 9 is_stmt 1 view .LVU636
+# console.c:379:         cmd_depth--;
+	.loc 1 379 18 is_stmt 0 view .LVU637
+	subl	$1, cmd_depth(%rip)	#, cmd_depth
+	.loc 1 380 9 is_stmt 1 view .LVU638
+.LVL257:
+.L203:
+	.loc 1 388 9 view .LVU639
+# console.c:388:         if (!quit_flag) {
+	.loc 1 388 12 is_stmt 0 view .LVU640
+	cmpb	$0, quit_flag(%rip)	#, quit_flag
+	jne	.L198	#,
+	.loc 1 389 13 is_stmt 1 view .LVU641
+# console.c:389:             next_cmd->calls++;
+	.loc 1 389 28 is_stmt 0 view .LVU642
+	addq	$1, 24(%rbx)	#, next_cmd_28(D)->calls
+	.loc 1 390 13 is_stmt 1 view .LVU643
+# console.c:390:             next_cmd->total_ns += elapsed;
+	.loc 1 390 32 is_stmt 0 view .LVU644
+	addq	%r12, 32(%rbx)	# elapsed, next_cmd_28(D)->total_ns
+	.loc 1 391 13 is_stmt 1 view .LVU645
+# console.c:391:             if (elapsed < next_cmd->min_ns)
+	.loc 1 391 16 is_stmt 0 view .LVU646
+	cmpq	40(%rbx), %r12	# next_cmd_28(D)->min_ns, elapsed
+	jnb	.L199	#,
+	.loc 1 392 17 is_stmt 1 view .LVU647
+# console.c:392:                 next_cmd->min_ns = elapsed;
+	.loc 1 392 34 is_stmt 0 view .LVU648
+	movq	%r12, 40(%rbx)	# elapsed, next_cmd_28(D)->min_ns
+.L199:
+	.loc 1 393 13 is_stmt 1 view .LVU649
+# console.c:393:             if (elapsed > next_cmd->max_ns)
+	.loc 1 393 16 is_stmt 0 view .LVU650
+	cmpq	%r12, 48(%rbx)	# elapsed, next_cmd_28(D)->max_ns
+	jnb	.L198	#,
+	.loc 1 394 17 is_stmt 1 view .LVU651
+# console.c:394:                 next_cmd->max_ns = elapsed;
+	.loc 1 394 34 is_stmt 0 view .LVU652
+	movq	%r12, 48(%rbx)	# elapsed, next_cmd_28(D)->max_ns
+.L198:
+	.loc 1 396 9 is_stmt 1 view .LVU653
+# console.c:396:         if (!ok)
+	.loc 1 396 12 is_stmt 0 view .LVU654
+	testb	%bpl, %bpl	# <retval>
+	je	.L206	#,
+.LVL258:
+.L194:
+	.loc 1 396 12 view .LVU655
+.LBE43:
+# console.c:405: }
+	.loc 1 405 1 view .LVU656
+	movl	%ebp, %eax	# <retval>,
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL259:
+.L205:
+	.cfi_restore_state
+.LBB44:
+# console.c:369:         bool record = cmd_depth == 0 && metrics_enabled();
+	.loc 1 369 41 discriminator 1 view .LVU657
+	movl	$0, %eax	#,
+	call	metrics_enabled@PLT	#
+.LVL260:
+# console.c:369:         bool record = cmd_depth == 0 && metrics_enabled();
+	.loc 1 369 38 discriminator 1 view .LVU658
+	testb	%al, %al	# tmp128
+	je	.L196	#,
+.LVL261:
+	.loc 1 370 9 is_stmt 1 view .LVU659
+	.loc 1 371 13 view .LVU660
+	movq	%rbp, %rsi	# argv,
+	movl	%r12d, %edi	# argc,
+	call	metric_begin@PLT	#
+.LVL262:
+	.loc 1 372 13 view .LVU661
+# console.c:372:             if (metrics_helper)
+	.loc 1 372 17 is_stmt 0 view .LVU662
+	movq	metrics_helper(%rip), %rax	# metrics_helper, metrics_helper.30_3
+# console.c:372:             if (metrics_helper)
+	.loc 1 372 16 view .LVU663
+	testq	%rax, %rax	# metrics_helper.30_3
+	je	.L197	#,
+	.loc 1 373 17 is_stmt 1 view .LVU664
+	movl	$0, %edi	#,
+	call	*%rax	# metrics_helper.30_3
+.LVL263:
+.L197:
+	.loc 1 375 9 view .LVU665
+# console.c:375:         cmd_depth++;
+	.loc 1 375 18 is_stmt 0 view .LVU666
+	addl	$1, cmd_depth(%rip)	#, cmd_depth
+	.loc 1 376 9 is_stmt 1 view .LVU667
+# console.c:376:         uint64_t start = time_ns();
+	.loc 1 376 26 is_stmt 0 view .LVU668
+	movl	$0, %eax	#,
+	call	time_ns@PLT	#
+.LVL264:
+	movq	%rax, %r13	# tmp129, start
+.LVL265:
+	.loc 1 377 9 is_stmt 1 view .LVU669
+# console.c:377:         ok = next_cmd->operation(argc, argv);
+	.loc 1 377 14 is_stmt 0 view .LVU670
+	movq	%rbp, %rsi	# argv,
+	movl	%r12d, %edi	# argc,
+	call	*8(%rbx)	# next_cmd_28(D)->operation
+.LVL266:
+	.loc 1 377 14 view .LVU671
+	movl	%eax, %ebp	# tmp130, <retval>
+.LVL267:
+	.loc 1 378 9 is_stmt 1 view .LVU672
+# console.c:378:         uint64_t elapsed = time_ns() - start;
+	.loc 1 378 28 is_stmt 0 view .LVU673
+	movl	$0, %eax	#,
+.LVL268:
+	.loc 1 378 28 view .LVU674
+	call	time_ns@PLT	#
+.LVL269:
+# console.c:378:         uint64_t elapsed = time_ns() - start;
+	.loc 1 378 18 view .LVU675
+	subq	%r13, %rax	# start, tmp131
+	movq	%rax, %r12	# tmp131, elapsed
+.LVL270:
+	.loc 1 379 9 is_stmt 1 view .LVU676
+# console.c:379:         cmd_depth--;
+	.loc 1 379 18 is_stmt 0 view .LVU677
+	subl	$1, cmd_depth(%rip)	#, cmd_depth
+	.loc 1 380 9 is_stmt 1 view .LVU678
+	.loc 1 381 13 view .LVU679
+	movq	%rax, %rsi	# elapsed,
+	leaq	.LC26(%rip), %rdi	#, tmp119
+	call	metric_int@PLT	#
+.LVL271:
+	.loc 1 382 13 view .LVU680
+	movzbl	%bpl, %esi	# <retval>, <retval>
+	leaq	.LC27(%rip), %rdi	#, tmp121
+	call	metric_bool@PLT	#
+.LVL272:
+	.loc 1 383 13 view .LVU681
+# console.c:383:             if (metrics_helper)
+	.loc 1 383 17 is_stmt 0 view .LVU682
+	movq	metrics_helper(%rip), %rax	# metrics_helper, metrics_helper.35_12
+# console.c:383:             if (metrics_helper)
+	.loc 1 383 16 view .LVU683
+	testq	%rax, %rax	# metrics_helper.35_12
+	je	.L202	#,
+	.loc 1 384 17 is_stmt 1 view .LVU684
+	movl	$1, %edi	#,
+	call	*%rax	# metrics_helper.35_12
+.LVL273:
+.L202:
+	.loc 1 385 13 view .LVU685
+	movl	$0, %eax	#,
+	call	metric_end@PLT	#
+.LVL274:
+	jmp	.L203	#
+.LVL275:
+.L206:
+	.loc 1 397 13 view .LVU686
+	movl	$0, %eax	#,
+	call	record_error	#
+.LVL276:
+	jmp	.L194	#
+.LVL277:
+.L195:
+	.loc 1 397 13 is_stmt 0 view .LVU687
+.LBE44:
+	.loc 1 399 9 is_stmt 1 view .LVU688
+	movq	(%rdx), %rdx	# *argv_30(D), *argv_30(D)
+.LVL278:
+	.loc 1 399 9 is_stmt 0 view .LVU689
+	leaq	.LC25(%rip), %rsi	#, tmp116
+.LVL279:
+	.loc 1 399 9 view .LVU690
+	movl	$1, %edi	#,
+.LVL280:
+	.loc 1 399 9 view .LVU691
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL281:
+	.loc 1 400 9 is_stmt 1 view .LVU692
+	movl	$0, %eax	#,
+	call	record_error	#
+.LVL282:
+	.loc 1 401 9 view .LVU693
+# console.c:401:         ok = false;
+	.loc 1 401 12 is_stmt 0 view .LVU694
+	movl	$0, %ebp	#, <retval>
+.LVL283:
+	.loc 1 404 5 is_stmt 1 view .LVU695
+# console.c:404:     return ok;
+	.loc 1 404 12 is_stmt 0 view .LVU696
+	jmp	.L194	#
+	.cfi_endproc
+.LFE35:
+	.size	run_cmd, .-run_cmd
+	.type	run_steps, @function
+run_steps:
+.LVL284:
+.LFB54:
+	.loc 1 766 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 766 1 is_stmt 0 view .LVU698
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %r13	# tmp101, body
+	movl	%esi, %r14d	# tmp102, reps
+	.loc 1 767 5 is_stmt 1 view .LVU699
+.LVL285:
+	.loc 1 768 5 view .LVU700
+.LBB45:
+	.loc 1 768 10 view .LVU701
+	.loc 1 768 30 view .LVU702
+# console.c:768:     for (int r = 0; r < reps && !quit_flag; r++) {
+	.loc 1 768 14 is_stmt 0 view .LVU703
+	movl	$0, %r12d	#, r
+.LBE45:
+# console.c:767:     bool ok = true;
+	.loc 1 767 10 view .LVU704
+	movl	$1, %ebp	#, <retval>
+.LBB48:
+# console.c:768:     for (int r = 0; r < reps && !quit_flag; r++) {
+	.loc 1 768 30 view .LVU705
+	testl	%esi, %esi	# reps
+	jg	.L208	#,
+.LVL286:
+.L207:
+	.loc 1 768 30 view .LVU706
+.LBE48:
+# console.c:777: }
+	.loc 1 777 1 view .LVU707
+	movl	%ebp, %eax	# <retval>,
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL287:
+	.loc 1 777 1 view .LVU708
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+.LVL288:
+	.loc 1 777 1 view .LVU709
+	ret	
+.LVL289:
+.L220:
+	.cfi_restore_state
+.LBB49:
+.LBB46:
+	.loc 1 771 17 is_stmt 1 view .LVU710
+# console.c:771:                 ok = run_cmd(step->cmd, step->argc, step->argv) && ok;
+	.loc 1 771 22 is_stmt 0 view .LVU711
+	movq	16(%rbx), %rdx	# step_42->argv, step_42->argv
+	movl	8(%rbx), %esi	# step_42->argc, step_42->argc
+	call	run_cmd	#
+.LVL290:
+# console.c:771:                 ok = run_cmd(step->cmd, step->argc, step->argv) && ok;
+	.loc 1 771 65 view .LVU712
+	andl	%eax, %ebp	# tmp103, <retval>
+.LVL291:
+.L211:
+	.loc 1 769 61 is_stmt 1 discriminator 2 view .LVU713
+	movq	56(%rbx), %rbx	# step_42->next, step
+.LVL292:
+	.loc 1 769 41 discriminator 2 view .LVU714
+	testq	%rbx, %rbx	# step
+	je	.L212	#,
+.L214:
+# console.c:769:         for (step_ptr step = body; step && !quit_flag; step = step->next) {
+	.loc 1 769 41 is_stmt 0 discriminator 3 view .LVU715
+	cmpb	$0, quit_flag(%rip)	#, quit_flag
+	jne	.L212	#,
+	.loc 1 770 13 is_stmt 1 view .LVU716
+# console.c:770:             if (step->cmd)
+	.loc 1 770 21 is_stmt 0 view .LVU717
+	movq	(%rbx), %rdi	# step_42->cmd, _1
+# console.c:770:             if (step->cmd)
+	.loc 1 770 16 view .LVU718
+	testq	%rdi, %rdi	# _1
+	jne	.L220	#,
+	.loc 1 773 17 is_stmt 1 view .LVU719
+# console.c:773:                 ok = run_steps(step->body, step->reps) && ok;
+	.loc 1 773 22 is_stmt 0 view .LVU720
+	movl	40(%rbx), %esi	# step_42->reps, step_42->reps
+	movq	48(%rbx), %rdi	# step_42->body, step_42->body
+	call	run_steps	#
+.LVL293:
+# console.c:773:                 ok = run_steps(step->body, step->reps) && ok;
+	.loc 1 773 56 view .LVU721
+	andl	%eax, %ebp	# tmp104, <retval>
+.LVL294:
+	.loc 1 773 56 view .LVU722
+	jmp	.L211	#
+.L212:
+	.loc 1 773 56 view .LVU723
+.LBE46:
+	.loc 1 768 46 is_stmt 1 discriminator 2 view .LVU724
+	addl	$1, %r12d	#, r
+.LVL295:
+	.loc 1 768 30 discriminator 2 view .LVU725
+	cmpl	%r12d, %r14d	# r, reps
+	je	.L207	#,
+.LVL296:
+.L208:
+# console.c:768:     for (int r = 0; r < reps && !quit_flag; r++) {
+	.loc 1 768 30 is_stmt 0 discriminator 3 view .LVU726
+	cmpb	$0, quit_flag(%rip)	#, quit_flag
+	jne	.L207	#,
+.LVL297:
+.LBB47:
+	.loc 1 769 41 is_stmt 1 view .LVU727
+# console.c:769:         for (step_ptr step = body; step && !quit_flag; step = step->next) {
+	.loc 1 769 23 is_stmt 0 view .LVU728
+	movq	%r13, %rbx	# body, step
+# console.c:769:         for (step_ptr step = body; step && !quit_flag; step = step->next) {
+	.loc 1 769 41 view .LVU729
+	testq	%r13, %r13	# body
+	jne	.L214	#,
+.LVL298:
+	.loc 1 769 41 view .LVU730
+	jmp	.L212	#
+.LBE47:
+.LBE49:
+	.cfi_endproc
+.LFE54:
+	.size	run_steps, .-run_steps
+	.type	interpret_cmda, @function
+interpret_cmda:
+.LVL299:
+.LFB36:
+	.loc 1 409 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 410 5 view .LVU732
+# console.c:411:         return true;
+	.loc 1 411 16 is_stmt 0 view .LVU733
+	movl	$1, %eax	#, <retval>
+# console.c:410:     if (argc == 0)
+	.loc 1 410 8 view .LVU734
+	testl	%edi, %edi	# argc
+	jne	.L228	#,
+# console.c:415: }
+	.loc 1 415 1 view .LVU735
+	ret	
+.L228:
+# console.c:409: {
+	.loc 1 409 1 view .LVU736
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movl	%edi, %ebx	# tmp90, argc
+	movq	%rsi, %rbp	# tmp91, argv
+	.loc 1 414 5 is_stmt 1 view .LVU737
+# console.c:414:     return run_cmd(table_find(&cmd_table, argv[0]), argc, argv);
+	.loc 1 414 20 is_stmt 0 view .LVU738
+	movq	(%rsi), %rsi	# *argv_7(D), *argv_7(D)
+.LVL300:
+	.loc 1 414 20 view .LVU739
+	leaq	cmd_table(%rip), %rdi	#, tmp88
+.LVL301:
+	.loc 1 414 20 view .LVU740
+	call	table_find	#
+.LVL302:
+	movq	%rax, %rdi	# tmp92, _2
+# console.c:414:     return run_cmd(table_find(&cmd_table, argv[0]), argc, argv);
+	.loc 1 414 12 view .LVU741
+	movq	%rbp, %rdx	# argv,
+	movl	%ebx, %esi	# argc,
+	call	run_cmd	#
+.LVL303:
+# console.c:415: }
+	.loc 1 415 1 view .LVU742
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL304:
+	.loc 1 415 1 view .LVU743
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL305:
+	.loc 1 415 1 view .LVU744
+	ret	
+	.cfi_endproc
+.LFE36:
+	.size	interpret_cmda, .-interpret_cmda
+	.section	.rodata.str1.8
+	.align 8
+.LC28:
+	.string	"Elapsed time = %.6f, Delta time = %.6f"
+	.section	.rodata.str1.1
+.LC29:
+	.string	"Delta time = %.6f"
+	.text
+	.type	do_time_cmd, @function
+do_time_cmd:
+.LVL306:
+.LFB51:
+	.loc 1 651 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 651 1 is_stmt 0 view .LVU746
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movl	%edi, %ebx	# tmp101, argc
+	movq	%rsi, %rbp	# tmp102, argv
+	.loc 1 652 5 is_stmt 1 view .LVU747
+# console.c:652:     double delta = delta_time(&last_time);
+	.loc 1 652 20 is_stmt 0 view .LVU748
+	leaq	last_time(%rip), %rdi	#, tmp92
+.LVL307:
+	.loc 1 652 20 view .LVU749
+	call	delta_time@PLT	#
+.LVL308:
+	.loc 1 653 5 is_stmt 1 view .LVU750
+	.loc 1 654 5 view .LVU751
+# console.c:654:     if (argc <= 1) {
+	.loc 1 654 8 is_stmt 0 view .LVU752
+	cmpl	$1, %ebx	#, argc
+	jle	.L233	#,
+	.loc 1 658 9 is_stmt 1 view .LVU753
+# console.c:658:         ok = interpret_cmda(argc - 1, argv + 1);
+	.loc 1 658 14 is_stmt 0 view .LVU754
+	leaq	8(%rbp), %rsi	#, tmp96
+	leal	-1(%rbx), %edi	#, tmp97
+	call	interpret_cmda	#
+.LVL309:
+	.loc 1 658 14 view .LVU755
+	movl	%eax, %ebx	# tmp104, <retval>
+.LVL310:
+	.loc 1 659 9 is_stmt 1 view .LVU756
+	.loc 1 662 13 view .LVU757
+# console.c:662:             delta = delta_time(&last_time);
+	.loc 1 662 21 is_stmt 0 view .LVU758
+	leaq	last_time(%rip), %rdi	#, tmp98
+	call	delta_time@PLT	#
+.LVL311:
+	.loc 1 663 13 is_stmt 1 view .LVU759
+	leaq	.LC29(%rip), %rsi	#, tmp99
+	movl	$1, %edi	#,
+	movl	$1, %eax	#,
+	call	report@PLT	#
+.LVL312:
+	.loc 1 667 5 view .LVU760
+.L229:
+# console.c:668: }
+	.loc 1 668 1 is_stmt 0 view .LVU761
+	movl	%ebx, %eax	# <retval>,
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL313:
+	.loc 1 668 1 view .LVU762
+	ret	
+.LVL314:
+.L233:
+	.cfi_restore_state
+	.loc 1 668 1 view .LVU763
+	movapd	%xmm0, %xmm1	# tmp103, delta
+.LBB50:
+	.loc 1 655 9 is_stmt 1 view .LVU764
+.LVL315:
+	.loc 1 656 9 view .LVU765
+# console.c:655:         double elapsed = last_time - first_time;
+	.loc 1 655 16 is_stmt 0 view .LVU766
+	movsd	last_time(%rip), %xmm0	# last_time, last_time
+.LVL316:
+	.loc 1 655 16 view .LVU767
+	subsd	first_time(%rip), %xmm0	# first_time, elapsed
+.LVL317:
+# console.c:656:         report(1, "Elapsed time = %.6f, Delta time = %.6f", elapsed, delta);
+	.loc 1 656 9 view .LVU768
+	leaq	.LC28(%rip), %rsi	#, tmp95
+	movl	$1, %edi	#,
+	movl	$2, %eax	#,
+	call	report@PLT	#
+.LVL318:
+	.loc 1 656 9 view .LVU769
+.LBE50:
+# console.c:653:     bool ok = true;
+	.loc 1 653 10 view .LVU770
+	movl	$1, %ebx	#, <retval>
+.LVL319:
+	.loc 1 653 10 view .LVU771
+	jmp	.L229	#
+	.cfi_endproc
+.LFE51:
+	.size	do_time_cmd, .-do_time_cmd
+	.section	.rodata.str1.1
+.LC30:
+	.string	"interpret_cmd"
+	.text
+	.type	interpret_cmd, @function
+interpret_cmd:
+.LVL320:
+.LFB37:
+	.loc 1 419 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 419 1 is_stmt 0 view .LVU773
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$280, %rsp	#,
+	.cfi_def_cfa_offset 320
+	.loc 1 420 5 is_stmt 1 view .LVU774
+# console.c:421:         return false;
+	.loc 1 421 16 is_stmt 0 view .LVU775
+	movl	$0, %ebx	#, <retval>
+# console.c:420:     if (quit_flag)
+	.loc 1 420 8 view .LVU776
+	cmpb	$0, quit_flag(%rip)	#, quit_flag
+	je	.L239	#,
+.LVL321:
+.L234:
+# console.c:439: }
+	.loc 1 439 1 view .LVU777
+	movl	%ebx, %eax	# <retval>,
+	addq	$280, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL322:
+.L239:
+	.cfi_restore_state
+	.loc 1 439 1 view .LVU778
+	movq	%rdi, %rbp	# tmp95, cmdline
+	.loc 1 426 5 is_stmt 1 view .LVU779
+	.loc 1 427 5 view .LVU780
+	.loc 1 428 5 view .LVU781
+# console.c:428:     int argc = parse_args(cmdline, stack_argv, MAXARGS, &end);
+	.loc 1 428 16 is_stmt 0 view .LVU782
+	leaq	8(%rsp), %rcx	#, tmp89
+	leaq	16(%rsp), %rsi	#, tmp90
+	movl	$32, %edx	#,
+	call	parse_args	#
+.LVL323:
+	.loc 1 428 16 view .LVU783
+	movl	%eax, %ebx	# tmp96, argc
+.LVL324:
+	.loc 1 429 5 is_stmt 1 view .LVU784
+# console.c:429:     if (argc <= MAXARGS)
+	.loc 1 429 8 is_stmt 0 view .LVU785
+	cmpl	$32, %eax	#, argc
+	jle	.L240	#,
+	.loc 1 433 5 is_stmt 1 view .LVU786
+# console.c:433:     char **argv = calloc_or_fail(argc, sizeof(char *), "interpret_cmd");
+	.loc 1 433 19 is_stmt 0 view .LVU787
+	movslq	%eax, %r13	# argc, _2
+	leaq	.LC30(%rip), %rdx	#, tmp92
+	movl	$8, %esi	#,
+	movq	%r13, %rdi	# _2,
+	call	calloc_or_fail@PLT	#
+.LVL325:
+	.loc 1 433 19 view .LVU788
+	movq	%rax, %r12	# tmp98, argv
+.LVL326:
+	.loc 1 434 5 is_stmt 1 view .LVU789
+	movq	%rax, %rdx	# argv,
+	movq	8(%rsp), %rsi	# end,
+	movq	%rbp, %rdi	# cmdline,
+	call	collect_args	#
+.LVL327:
+	.loc 1 435 5 view .LVU790
+# console.c:435:     bool ok = interpret_cmda(argc, argv);
+	.loc 1 435 15 is_stmt 0 view .LVU791
+	movq	%r12, %rsi	# argv,
+	movl	%ebx, %edi	# argc,
+	call	interpret_cmda	#
+.LVL328:
+	movl	%eax, %ebx	# tmp99, <retval>
+.LVL329:
+	.loc 1 436 5 is_stmt 1 view .LVU792
+	movl	$8, %edx	#,
+	movq	%r13, %rsi	# _2,
+	movq	%r12, %rdi	# argv,
+	call	free_array@PLT	#
+.LVL330:
+	.loc 1 438 5 view .LVU793
+# console.c:438:     return ok;
+	.loc 1 438 12 is_stmt 0 view .LVU794
+	jmp	.L234	#
+.LVL331:
+.L240:
+	.loc 1 430 9 is_stmt 1 view .LVU795
+# console.c:430:         return interpret_cmda(argc, stack_argv);
+	.loc 1 430 16 is_stmt 0 view .LVU796
+	leaq	16(%rsp), %rsi	#, tmp91
+	movl	%eax, %edi	# argc,
+	call	interpret_cmda	#
+.LVL332:
+	.loc 1 430 16 view .LVU797
+	movl	%eax, %ebx	# tmp97, <retval>
+.LVL333:
+	.loc 1 430 16 view .LVU798
+	jmp	.L234	#
+	.cfi_endproc
+.LFE37:
+	.size	interpret_cmd, .-interpret_cmd
+	.section	.rodata.str1.1
+.LC31:
+	.string	"No log file given"
+.LC32:
+	.string	"Couldn't open log file '%s'"
+	.text
+	.type	do_log_cmd, @function
+do_log_cmd:
+.LVL334:
+.LFB50:
+	.loc 1 637 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 637 1 is_stmt 0 view .LVU800
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 638 5 is_stmt 1 view .LVU801
+# console.c:638:     if (argc < 2) {
+	.loc 1 638 8 is_stmt 0 view .LVU802
+	cmpl	$1, %edi	#, tmp92
+	jle	.L245	#,
+	movq	%rsi, %rbp	# tmp93, argv
+	.loc 1 643 5 is_stmt 1 view .LVU803
+# console.c:643:     bool result = set_logfile(argv[1]);
+	.loc 1 643 19 is_stmt 0 view .LVU804
+	movq	8(%rsi), %rdi	# MEM[(char * *)argv_6(D) + 8B], MEM[(char * *)argv_6(D) + 8B]
+.LVL335:
+	.loc 1 643 19 view .LVU805
+	call	set_logfile@PLT	#
+.LVL336:
+	.loc 1 643 19 view .LVU806
+	movl	%eax, %ebx	# tmp94, <retval>
+.LVL337:
+	.loc 1 644 5 is_stmt 1 view .LVU807
+# console.c:644:     if (!result)
+	.loc 1 644 8 is_stmt 0 view .LVU808
+	testb	%al, %al	# <retval>
+	je	.L246	#,
+.LVL338:
+.L241:
+# console.c:648: }
+	.loc 1 648 1 view .LVU809
+	movl	%ebx, %eax	# <retval>,
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL339:
+.L245:
+	.cfi_restore_state
+	.loc 1 639 9 is_stmt 1 view .LVU810
+	leaq	.LC31(%rip), %rsi	#, tmp87
+.LVL340:
+	.loc 1 639 9 is_stmt 0 view .LVU811
+	movl	$1, %edi	#,
+.LVL341:
+	.loc 1 639 9 view .LVU812
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL342:
+	.loc 1 640 9 is_stmt 1 view .LVU813
+# console.c:640:         return false;
+	.loc 1 640 16 is_stmt 0 view .LVU814
+	movl	$0, %ebx	#, <retval>
+	jmp	.L241	#
+.LVL343:
+.L246:
+	.loc 1 645 9 is_stmt 1 view .LVU815
+	movq	8(%rbp), %rdx	# MEM[(char * *)argv_6(D) + 8B], MEM[(char * *)argv_6(D) + 8B]
+	leaq	.LC32(%rip), %rsi	#, tmp90
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL344:
+	.loc 1 645 9 is_stmt 0 view .LVU816
+	call	report@PLT	#
+.LVL345:
+	jmp	.L241	#
+	.cfi_endproc
+.LFE50:
+	.size	do_log_cmd, .-do_log_cmd
+	.section	.rodata.str1.1
+.LC33:
+	.string	"push_file"
+	.text
+	.type	push_file, @function
+push_file:
+.LVL346:
+.LFB56:
+	.loc 1 817 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 817 1 is_stmt 0 view .LVU818
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$144, %rsp	#,
+	.cfi_def_cfa_offset 176
+	movq	%rdi, %rbp	# tmp116, fname
+	.loc 1 818 5 is_stmt 1 view .LVU819
+# console.c:818:     int fd = fname ? open(fname, O_RDONLY) : STDIN_FILENO;
+	.loc 1 818 44 is_stmt 0 view .LVU820
+	testq	%rdi, %rdi	# fname
+	je	.L251	#,
+# console.c:818:     int fd = fname ? open(fname, O_RDONLY) : STDIN_FILENO;
+	.loc 1 818 22 discriminator 1 view .LVU821
+	movl	$0, %esi	#,
+	movl	$0, %eax	#,
+	call	open@PLT	#
+.LVL347:
+	.loc 1 818 22 discriminator 1 view .LVU822
+	movl	%eax, %r12d	# tmp117, iftmp.45_21
+.LVL348:
+	.loc 1 819 5 is_stmt 1 discriminator 1 view .LVU823
+# console.c:820:         return false;
+	.loc 1 820 16 is_stmt 0 discriminator 1 view .LVU824
+	movl	$0, %eax	#, <retval>
+.LVL349:
+# console.c:819:     if (fd < 0)
+	.loc 1 819 8 discriminator 1 view .LVU825
+	testl	%r12d, %r12d	# iftmp.45_21
+	jns	.L248	#,
+	jmp	.L247	#
+.LVL350:
+.L251:
+# console.c:818:     int fd = fname ? open(fname, O_RDONLY) : STDIN_FILENO;
+	.loc 1 818 44 view .LVU826
+	movl	$0, %r12d	#, iftmp.45_21
+.LVL351:
+.L248:
+	.loc 1 822 5 is_stmt 1 view .LVU827
+# console.c:822:     if (fd > fd_max)
+	.loc 1 822 8 is_stmt 0 view .LVU828
+	cmpl	%r12d, fd_max(%rip)	# iftmp.45_21, fd_max
+	jge	.L250	#,
+	.loc 1 823 9 is_stmt 1 view .LVU829
+# console.c:823:         fd_max = fd;
+	.loc 1 823 16 is_stmt 0 view .LVU830
+	movl	%r12d, fd_max(%rip)	# iftmp.45_21, fd_max
+.L250:
+	.loc 1 825 5 is_stmt 1 view .LVU831
+# console.c:825:     rio_ptr rnew = malloc_or_fail(sizeof(rio_t), "push_file");
+	.loc 1 825 20 is_stmt 0 view .LVU832
+	leaq	.LC33(%rip), %rsi	#, tmp101
+	movl	$65600, %edi	#,
+	call	malloc_or_fail@PLT	#
+.LVL352:
+	movq	%rax, %rbx	# tmp118, rnew
+.LVL353:
+	.loc 1 826 5 is_stmt 1 view .LVU833
+# console.c:826:     rnew->fd = fd;
+	.loc 1 826 14 is_stmt 0 view .LVU834
+	movl	%r12d, (%rax)	# iftmp.45_21, rnew_24->fd
+	.loc 1 827 5 is_stmt 1 view .LVU835
+# console.c:827:     rnew->cnt = 0;
+	.loc 1 827 15 is_stmt 0 view .LVU836
+	movl	$0, 4(%rax)	#, rnew_24->cnt
+	.loc 1 828 5 is_stmt 1 view .LVU837
+# console.c:828:     rnew->scan = 0;
+	.loc 1 828 16 is_stmt 0 view .LVU838
+	movl	$0, 8(%rax)	#, rnew_24->scan
+	.loc 1 829 5 is_stmt 1 view .LVU839
+# console.c:829:     rnew->bufptr = rnew->buf;
+	.loc 1 829 20 is_stmt 0 view .LVU840
+	leaq	24(%rax), %rax	#, tmp102
+.LVL354:
+	.loc 1 829 20 view .LVU841
+	movq	%rax, 16(%rbx)	# tmp102, rnew_24->bufptr
+	.loc 1 830 5 is_stmt 1 view .LVU842
+# console.c:830:     rnew->map = NULL;
+	.loc 1 830 15 is_stmt 0 view .LVU843
+	movq	$0, 65568(%rbx)	#, rnew_24->map
+	.loc 1 831 5 is_stmt 1 view .LVU844
+# console.c:831:     rnew->map_end = NULL;
+	.loc 1 831 19 is_stmt 0 view .LVU845
+	movq	$0, 65576(%rbx)	#, rnew_24->map_end
+	.loc 1 832 5 is_stmt 1 view .LVU846
+	leaq	65584(%rbx), %rdi	#, tmp103
+	call	init_time@PLT	#
+.LVL355:
+	.loc 1 833 5 view .LVU847
+# console.c:833:     rnew->prev = buf_stack;
+	.loc 1 833 16 is_stmt 0 view .LVU848
+	movq	buf_stack(%rip), %rax	# buf_stack, buf_stack
+	movq	%rax, 65592(%rbx)	# buf_stack, rnew_24->prev
+	.loc 1 834 5 is_stmt 1 view .LVU849
+# console.c:834:     buf_stack = rnew;
+	.loc 1 834 15 is_stmt 0 view .LVU850
+	movq	%rbx, buf_stack(%rip)	# rnew, buf_stack
+	.loc 1 837 5 is_stmt 1 view .LVU851
+	.loc 1 838 5 view .LVU852
+# console.c:849:     return true;
+	.loc 1 849 12 is_stmt 0 view .LVU853
+	movl	$1, %eax	#, <retval>
+# console.c:838:     if (fname && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+	.loc 1 838 8 view .LVU854
+	testq	%rbp, %rbp	# fname
+	je	.L247	#,
+# console.c:838:     if (fname && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+	.loc 1 838 18 discriminator 1 view .LVU855
+	movq	%rsp, %rsi	#, tmp105
+	movl	%r12d, %edi	# iftmp.45_21,
+	call	fstat@PLT	#
+.LVL356:
+	movl	%eax, %edx	#, tmp119
+# console.c:849:     return true;
+	.loc 1 849 12 discriminator 1 view .LVU856
+	movl	$1, %eax	#, <retval>
+# console.c:838:     if (fname && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+	.loc 1 838 15 discriminator 1 view .LVU857
+	testl	%edx, %edx	# tmp119
+	jne	.L247	#,
+# console.c:838:     if (fname && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+	.loc 1 838 41 discriminator 2 view .LVU858
+	movl	24(%rsp), %edx	# st.st_mode, tmp106
+	andl	$61440, %edx	#, tmp106
+# console.c:838:     if (fname && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+	.loc 1 838 38 discriminator 2 view .LVU859
+	cmpl	$32768, %edx	#, tmp106
+	je	.L259	#,
+.LVL357:
+.L247:
+# console.c:850: }
+	.loc 1 850 1 view .LVU860
+	addq	$144, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL358:
+.L259:
+	.cfi_restore_state
+# console.c:839:         st.st_size > 0) {
+	.loc 1 839 11 discriminator 3 view .LVU861
+	movq	48(%rsp), %rsi	# st.st_size, _8
+# console.c:838:     if (fname && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+	.loc 1 838 61 discriminator 3 view .LVU862
+	testq	%rsi, %rsi	# _8
+	jle	.L247	#,
+.LBB51:
+	.loc 1 840 9 is_stmt 1 view .LVU863
+# console.c:840:         char *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	.loc 1 840 21 is_stmt 0 view .LVU864
+	movl	$0, %r9d	#,
+	movl	%r12d, %r8d	# iftmp.45_21,
+	movl	$2, %ecx	#,
+	movl	$1, %edx	#,
+	movl	$0, %edi	#,
+	call	mmap@PLT	#
+.LVL359:
+	movq	%rax, %rbp	# tmp120, map
+.LVL360:
+	.loc 1 841 9 is_stmt 1 view .LVU865
+.LBE51:
+# console.c:849:     return true;
+	.loc 1 849 12 is_stmt 0 view .LVU866
+	movl	$1, %eax	#, <retval>
+.LVL361:
+.LBB52:
+# console.c:841:         if (map != MAP_FAILED) {
+	.loc 1 841 12 view .LVU867
+	cmpq	$-1, %rbp	#, map
+	je	.L247	#,
+	.loc 1 842 13 is_stmt 1 view .LVU868
+	movl	$2, %edx	#,
+	movq	48(%rsp), %rsi	# st.st_size,
+	movq	%rbp, %rdi	# map,
+	call	madvise@PLT	#
+.LVL362:
+	.loc 1 843 13 view .LVU869
+# console.c:843:             rnew->map = map;
+	.loc 1 843 23 is_stmt 0 view .LVU870
+	movq	%rbp, 65568(%rbx)	# map, rnew_24->map
+	.loc 1 844 13 is_stmt 1 view .LVU871
+# console.c:844:             rnew->map_end = map + st.st_size;
+	.loc 1 844 33 is_stmt 0 view .LVU872
+	movq	%rbp, %rax	# map, tmp111
+	addq	48(%rsp), %rax	# st.st_size, tmp111
+# console.c:844:             rnew->map_end = map + st.st_size;
+	.loc 1 844 27 view .LVU873
+	movq	%rax, 65576(%rbx)	# tmp111, rnew_24->map_end
+	.loc 1 845 13 is_stmt 1 view .LVU874
+# console.c:845:             rnew->bufptr = map;
+	.loc 1 845 26 is_stmt 0 view .LVU875
+	movq	%rbp, 16(%rbx)	# map, rnew_24->bufptr
+.LBE52:
+# console.c:849:     return true;
+	.loc 1 849 12 view .LVU876
+	movl	$1, %eax	#, <retval>
+	jmp	.L247	#
+	.cfi_endproc
+.LFE56:
+	.size	push_file, .-push_file
+	.section	.rodata.str1.1
+.LC34:
+	.string	"No source file given"
+	.section	.rodata.str1.8
+	.align 8
+.LC35:
+	.string	"Could not open source file '%s'"
+	.text
+	.type	do_source_cmd, @function
+do_source_cmd:
+.LVL363:
+.LFB49:
+	.loc 1 622 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 622 1 is_stmt 0 view .LVU878
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 623 5 is_stmt 1 view .LVU879
+# console.c:623:     if (argc < 2) {
+	.loc 1 623 8 is_stmt 0 view .LVU880
+	cmpl	$1, %edi	#, tmp92
+	jle	.L264	#,
+	movq	%rsi, %rbp	# tmp93, argv
+	.loc 1 628 5 is_stmt 1 view .LVU881
+# console.c:628:     if (!push_file(argv[1])) {
+	.loc 1 628 10 is_stmt 0 view .LVU882
+	movq	8(%rsi), %rdi	# MEM[(char * *)argv_7(D) + 8B], MEM[(char * *)argv_7(D) + 8B]
+.LVL364:
+	.loc 1 628 10 view .LVU883
+	call	push_file	#
+.LVL365:
+	.loc 1 628 10 view .LVU884
+	movl	%eax, %ebx	# tmp94, <retval>
+# console.c:628:     if (!push_file(argv[1])) {
+	.loc 1 628 8 view .LVU885
+	testb	%al, %al	# <retval>
+	je	.L265	#,
+.LVL366:
+.L260:
+# console.c:634: }
+	.loc 1 634 1 view .LVU886
+	movl	%ebx, %eax	# <retval>,
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL367:
+.L264:
+	.cfi_restore_state
+	.loc 1 624 9 is_stmt 1 view .LVU887
+	leaq	.LC34(%rip), %rsi	#, tmp87
+.LVL368:
+	.loc 1 624 9 is_stmt 0 view .LVU888
+	movl	$1, %edi	#,
+.LVL369:
+	.loc 1 624 9 view .LVU889
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL370:
+	.loc 1 625 9 is_stmt 1 view .LVU890
+# console.c:625:         return false;
+	.loc 1 625 16 is_stmt 0 view .LVU891
+	movl	$0, %ebx	#, <retval>
+	jmp	.L260	#
+.LVL371:
+.L265:
+	.loc 1 629 9 is_stmt 1 view .LVU892
+	movq	8(%rbp), %rdx	# MEM[(char * *)argv_7(D) + 8B], MEM[(char * *)argv_7(D) + 8B]
+	leaq	.LC35(%rip), %rsi	#, tmp90
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL372:
+	.loc 1 630 9 view .LVU893
+# console.c:630:         return false;
+	.loc 1 630 16 is_stmt 0 view .LVU894
+	jmp	.L260	#
+	.cfi_endproc
+.LFE49:
+	.size	do_source_cmd, .-do_source_cmd
+	.type	next_compiled_line, @function
+next_compiled_line:
+.LFB71:
+	.loc 1 1250 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$280, %rsp	#,
+	.cfi_def_cfa_offset 336
+	.loc 1 1251 5 view .LVU896
+	.loc 1 1252 5 view .LVU897
+# console.c:1252:     char **argv = stack_argv;
+	.loc 1 1252 12 is_stmt 0 view .LVU898
+	leaq	16(%rsp), %rax	#, tmp103
+	movq	%rax, 8(%rsp)	# tmp103, argv
+	.loc 1 1253 5 is_stmt 1 view .LVU899
+# console.c:1253:     int argc = next_compiled(&argv);
+	.loc 1 1253 16 is_stmt 0 view .LVU900
+	leaq	8(%rsp), %rdi	#, tmp104
+	call	next_compiled	#
+.LVL373:
+	.loc 1 1254 5 is_stmt 1 view .LVU901
+# console.c:1254:     if (argc <= 0)
+	.loc 1 1254 8 is_stmt 0 view .LVU902
+	testl	%eax, %eax	# argc
+	jle	.L270	#,
+	movl	%eax, %r13d	# tmp122, argc
+	.loc 1 1257 5 is_stmt 1 view .LVU903
+.LVL374:
+	.loc 1 1258 5 view .LVU904
+# console.c:1258:     linebuf[0] = '\0';
+	.loc 1 1258 16 is_stmt 0 view .LVU905
+	movb	$0, linebuf(%rip)	#, linebuf[0]
+	.loc 1 1259 5 is_stmt 1 view .LVU906
+.LBB53:
+	.loc 1 1259 10 view .LVU907
+.LVL375:
+	.loc 1 1259 30 view .LVU908
+.LBE53:
+# console.c:1258:     linebuf[0] = '\0';
+	.loc 1 1258 16 is_stmt 0 view .LVU909
+	movl	$0, %ebp	#, ivtmp.271
+# console.c:1257:     size_t pos = 0;
+	.loc 1 1257 12 view .LVU910
+	movl	$0, %ebx	#, pos
+.LBB54:
+# console.c:1260:         pos += snprintf(linebuf + pos, RIO_BUFSIZE + 1 - pos, i ? " %s" : "%s",
+	.loc 1 1260 16 view .LVU911
+	leaq	.LC19(%rip), %r15	#, tmp120
+	leaq	linebuf(%rip), %r14	#, tmp110
+.LVL376:
+.L269:
+	.loc 1 1260 9 is_stmt 1 view .LVU912
+# console.c:1261:                         argv[i]);
+	.loc 1 1261 29 is_stmt 0 view .LVU913
+	movq	8(%rsp), %r12	# argv, argv.107_1
+# console.c:1260:         pos += snprintf(linebuf + pos, RIO_BUFSIZE + 1 - pos, i ? " %s" : "%s",
+	.loc 1 1260 16 view .LVU914
+	movq	(%r12,%rbp,8), %rcx	# *_4, _5
+	testl	%ebp, %ebp	# ivtmp.271
+	leaq	.LC22(%rip), %rdx	#, iftmp.108_17
+	cmove	%r15, %rdx	# tmp120,, iftmp.108_17
+	movl	$65537, %esi	#, tmp107
+	subq	%rbx, %rsi	# pos, tmp107
+	leaq	(%rbx,%r14), %rdi	#, tmp109
+	movl	$0, %eax	#,
+	call	snprintf@PLT	#
+.LVL377:
+	cltq
+# console.c:1260:         pos += snprintf(linebuf + pos, RIO_BUFSIZE + 1 - pos, i ? " %s" : "%s",
+	.loc 1 1260 13 view .LVU915
+	addq	%rax, %rbx	# _27, pos
+.LVL378:
+	.loc 1 1259 53 is_stmt 1 view .LVU916
+	.loc 1 1259 30 view .LVU917
+# console.c:1259:     for (int i = 0; i < argc && pos < RIO_BUFSIZE; i++)
+	.loc 1 1259 23 is_stmt 0 view .LVU918
+	leal	1(%rbp), %eax	#, i
+.LVL379:
+	.loc 1 1259 23 view .LVU919
+	cmpl	%r13d, %eax	# argc, i
+	setl	%dl	#, tmp114
+# console.c:1259:     for (int i = 0; i < argc && pos < RIO_BUFSIZE; i++)
+	.loc 1 1259 37 view .LVU920
+	cmpq	$65535, %rbx	#, pos
+	setbe	%al	#, tmp116
+.LVL380:
+# console.c:1259:     for (int i = 0; i < argc && pos < RIO_BUFSIZE; i++)
+	.loc 1 1259 30 view .LVU921
+	addq	$1, %rbp	#, ivtmp.271
+.LVL381:
+	.loc 1 1259 30 view .LVU922
+	testb	%al, %dl	# tmp116, tmp114
+	jne	.L269	#,
+.LBE54:
+	.loc 1 1262 5 is_stmt 1 view .LVU923
+# console.c:1262:     if (argv != stack_argv)
+	.loc 1 1262 8 is_stmt 0 view .LVU924
+	leaq	16(%rsp), %rdx	#, tmp117
+# console.c:1264:     return linebuf;
+	.loc 1 1264 12 view .LVU925
+	leaq	linebuf(%rip), %rax	#, <retval>
+# console.c:1262:     if (argv != stack_argv)
+	.loc 1 1262 8 view .LVU926
+	cmpq	%rdx, %r12	# tmp117, argv.107_1
+	je	.L266	#,
+	.loc 1 1263 9 is_stmt 1 view .LVU927
+	movslq	%r13d, %rsi	# argc, argc
+	movl	$8, %edx	#,
+	movq	%r12, %rdi	# argv.107_1,
+	call	free_array@PLT	#
+.LVL382:
+# console.c:1264:     return linebuf;
+	.loc 1 1264 12 is_stmt 0 view .LVU928
+	leaq	linebuf(%rip), %rax	#, <retval>
+.LVL383:
+.L266:
+# console.c:1265: }
+	.loc 1 1265 1 view .LVU929
+	addq	$280, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL384:
+.L270:
+	.cfi_restore_state
+# console.c:1255:         return NULL;
+	.loc 1 1255 16 view .LVU930
+	movl	$0, %eax	#, <retval>
+.LVL385:
+	.loc 1 1255 16 view .LVU931
+	jmp	.L266	#
+	.cfi_endproc
+.LFE71:
+	.size	next_compiled_line, .-next_compiled_line
+	.section	.rodata.str1.1
+.LC36:
+	.string	"add_cmd"
+	.text
+	.globl	add_cmd
+	.type	add_cmd, @function
+add_cmd:
+.LVL386:
+.LFB30:
+	.loc 1 266 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 266 1 is_stmt 0 view .LVU933
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %rbp	# tmp95, name
+	movq	%rsi, %r14	# tmp96, operation
+	movq	%rdx, %r13	# tmp97, documentation
+	.loc 1 267 5 is_stmt 1 view .LVU934
+# console.c:267:     cmd_ptr next_cmd = cmd_list;
+	.loc 1 267 13 is_stmt 0 view .LVU935
+	movq	cmd_list(%rip), %rbx	# cmd_list, next_cmd
+.LVL387:
+	.loc 1 268 5 is_stmt 1 view .LVU936
+	.loc 1 269 5 view .LVU937
+	.loc 1 269 21 view .LVU938
+# console.c:268:     cmd_ptr *last_loc = &cmd_list;
+	.loc 1 268 14 is_stmt 0 view .LVU939
+	leaq	cmd_list(%rip), %r12	#, last_loc
+# console.c:269:     while (next_cmd && strcmp(name, next_cmd->name) > 0) {
+	.loc 1 269 21 view .LVU940
+	testq	%rbx, %rbx	# next_cmd
+	je	.L277	#,
+.LVL388:
+.L276:
+# console.c:269:     while (next_cmd && strcmp(name, next_cmd->name) > 0) {
+	.loc 1 269 24 discriminator 1 view .LVU941
+	movq	(%rbx), %rsi	# next_cmd_26->name, next_cmd_26->name
+	movq	%rbp, %rdi	# name,
+	call	strcmp@PLT	#
+.LVL389:
+# console.c:269:     while (next_cmd && strcmp(name, next_cmd->name) > 0) {
+	.loc 1 269 21 discriminator 1 view .LVU942
+	testl	%eax, %eax	# tmp98
+	jle	.L277	#,
+	.loc 1 270 9 is_stmt 1 view .LVU943
+# console.c:270:         last_loc = &next_cmd->next;
+	.loc 1 270 18 is_stmt 0 view .LVU944
+	leaq	56(%rbx), %r12	#, last_loc
+.LVL390:
+	.loc 1 271 9 is_stmt 1 view .LVU945
+# console.c:271:         next_cmd = next_cmd->next;
+	.loc 1 271 18 is_stmt 0 view .LVU946
+	movq	56(%rbx), %rbx	# next_cmd_26->next, next_cmd
+.LVL391:
+	.loc 1 269 21 is_stmt 1 view .LVU947
+	testq	%rbx, %rbx	# next_cmd
+	jne	.L276	#,
+.LVL392:
+.L277:
+	.loc 1 274 5 view .LVU948
+# console.c:274:     cmd_ptr ele = (cmd_ptr) malloc_or_fail(sizeof(cmd_ele), "add_cmd");
+	.loc 1 274 29 is_stmt 0 view .LVU949
+	leaq	.LC36(%rip), %rsi	#, tmp92
+	movl	$64, %edi	#,
+	call	malloc_or_fail@PLT	#
+.LVL393:
+	movq	%rax, %rdx	# tmp99, ele
+.LVL394:
+	.loc 1 275 5 is_stmt 1 view .LVU950
+# console.c:275:     ele->name = name;
+	.loc 1 275 15 is_stmt 0 view .LVU951
+	movq	%rbp, (%rax)	# name, ele_11->name
+	.loc 1 276 5 is_stmt 1 view .LVU952
+# console.c:276:     ele->operation = operation;
+	.loc 1 276 20 is_stmt 0 view .LVU953
+	movq	%r14, 8(%rax)	# operation, ele_11->operation
+	.loc 1 277 5 is_stmt 1 view .LVU954
+# console.c:277:     ele->documentation = documentation;
+	.loc 1 277 24 is_stmt 0 view .LVU955
+	movq	%r13, 16(%rax)	# documentation, ele_11->documentation
+	.loc 1 278 5 is_stmt 1 view .LVU956
+# console.c:278:     ele->calls = 0;
+	.loc 1 278 16 is_stmt 0 view .LVU957
+	movq	$0, 24(%rax)	#, ele_11->calls
+	.loc 1 279 5 is_stmt 1 view .LVU958
+# console.c:279:     ele->total_ns = 0;
+	.loc 1 279 19 is_stmt 0 view .LVU959
+	movq	$0, 32(%rax)	#, ele_11->total_ns
+	.loc 1 280 5 is_stmt 1 view .LVU960
+# console.c:280:     ele->min_ns = UINT64_MAX;
+	.loc 1 280 17 is_stmt 0 view .LVU961
+	movq	$-1, 40(%rax)	#, ele_11->min_ns
+	.loc 1 281 5 is_stmt 1 view .LVU962
+# console.c:281:     ele->max_ns = 0;
+	.loc 1 281 17 is_stmt 0 view .LVU963
+	movq	$0, 48(%rax)	#, ele_11->max_ns
+	.loc 1 282 5 is_stmt 1 view .LVU964
+# console.c:282:     ele->next = next_cmd;
+	.loc 1 282 15 is_stmt 0 view .LVU965
+	movq	%rbx, 56(%rax)	# next_cmd, ele_11->next
+	.loc 1 283 5 is_stmt 1 view .LVU966
+# console.c:283:     *last_loc = ele;
+	.loc 1 283 15 is_stmt 0 view .LVU967
+	movq	%rax, (%r12)	# ele, *last_loc_29
+	.loc 1 284 5 is_stmt 1 view .LVU968
+	movq	%rbp, %rsi	# name,
+	leaq	cmd_table(%rip), %rdi	#, tmp94
+	call	table_insert	#
+.LVL395:
+# console.c:285: }
+	.loc 1 285 1 is_stmt 0 view .LVU969
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+.LVL396:
+	.loc 1 285 1 view .LVU970
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+.LVL397:
+	.loc 1 285 1 view .LVU971
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL398:
+	.loc 1 285 1 view .LVU972
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+.LVL399:
+	.loc 1 285 1 view .LVU973
+	ret	
+	.cfi_endproc
+.LFE30:
+	.size	add_cmd, .-add_cmd
+	.section	.rodata.str1.1
+.LC37:
+	.string	"add_param"
+	.text
+	.globl	add_param
+	.type	add_param, @function
+add_param:
+.LVL400:
+.LFB31:
+	.loc 1 292 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 292 1 is_stmt 0 view .LVU975
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %rbp	# tmp95, name
+	movq	%rsi, %r15	# tmp96, valp
+	movq	%rdx, %r14	# tmp97, documentation
+	movq	%rcx, %r13	# tmp98, setter
+	.loc 1 293 5 is_stmt 1 view .LVU976
+# console.c:293:     param_ptr next_param = param_list;
+	.loc 1 293 15 is_stmt 0 view .LVU977
+	movq	param_list(%rip), %rbx	# param_list, next_param
+.LVL401:
+	.loc 1 294 5 is_stmt 1 view .LVU978
+	.loc 1 295 5 view .LVU979
+	.loc 1 295 23 view .LVU980
+# console.c:294:     param_ptr *last_loc = &param_list;
+	.loc 1 294 16 is_stmt 0 view .LVU981
+	leaq	param_list(%rip), %r12	#, last_loc
+# console.c:295:     while (next_param && strcmp(name, next_param->name) > 0) {
+	.loc 1 295 23 view .LVU982
+	testq	%rbx, %rbx	# next_param
+	je	.L284	#,
+.LVL402:
+.L283:
+# console.c:295:     while (next_param && strcmp(name, next_param->name) > 0) {
+	.loc 1 295 26 discriminator 1 view .LVU983
+	movq	(%rbx), %rsi	# next_param_24->name, next_param_24->name
+	movq	%rbp, %rdi	# name,
+	call	strcmp@PLT	#
+.LVL403:
+# console.c:295:     while (next_param && strcmp(name, next_param->name) > 0) {
+	.loc 1 295 23 discriminator 1 view .LVU984
+	testl	%eax, %eax	# tmp99
+	jle	.L284	#,
+	.loc 1 296 9 is_stmt 1 view .LVU985
+# console.c:296:         last_loc = &next_param->next;
+	.loc 1 296 18 is_stmt 0 view .LVU986
+	leaq	32(%rbx), %r12	#, last_loc
+.LVL404:
+	.loc 1 297 9 is_stmt 1 view .LVU987
+# console.c:297:         next_param = next_param->next;
+	.loc 1 297 20 is_stmt 0 view .LVU988
+	movq	32(%rbx), %rbx	# next_param_24->next, next_param
+.LVL405:
+	.loc 1 295 23 is_stmt 1 view .LVU989
+	testq	%rbx, %rbx	# next_param
+	jne	.L283	#,
+.LVL406:
+.L284:
+	.loc 1 300 5 view .LVU990
+# console.c:300:     param_ptr ele = (param_ptr) malloc_or_fail(sizeof(param_ele), "add_param");
+	.loc 1 300 33 is_stmt 0 view .LVU991
+	leaq	.LC37(%rip), %rsi	#, tmp93
+	movl	$40, %edi	#,
+	call	malloc_or_fail@PLT	#
+.LVL407:
+	movq	%rax, %rdx	# tmp100, ele
+.LVL408:
+	.loc 1 301 5 is_stmt 1 view .LVU992
+# console.c:301:     ele->name = name;
+	.loc 1 301 15 is_stmt 0 view .LVU993
+	movq	%rbp, (%rax)	# name, ele_11->name
+	.loc 1 302 5 is_stmt 1 view .LVU994
+# console.c:302:     ele->valp = valp;
+	.loc 1 302 15 is_stmt 0 view .LVU995
+	movq	%r15, 8(%rax)	# valp, ele_11->valp
+	.loc 1 303 5 is_stmt 1 view .LVU996
+# console.c:303:     ele->documentation = documentation;
+	.loc 1 303 24 is_stmt 0 view .LVU997
+	movq	%r14, 16(%rax)	# documentation, ele_11->documentation
+	.loc 1 304 5 is_stmt 1 view .LVU998
+# console.c:304:     ele->setter = setter;
+	.loc 1 304 17 is_stmt 0 view .LVU999
+	movq	%r13, 24(%rax)	# setter, ele_11->setter
+	.loc 1 305 5 is_stmt 1 view .LVU1000
+# console.c:305:     ele->next = next_param;
+	.loc 1 305 15 is_stmt 0 view .LVU1001
+	movq	%rbx, 32(%rax)	# next_param, ele_11->next
+	.loc 1 306 5 is_stmt 1 view .LVU1002
+# console.c:306:     *last_loc = ele;
+	.loc 1 306 15 is_stmt 0 view .LVU1003
+	movq	%rax, (%r12)	# ele, *last_loc_27
+	.loc 1 307 5 is_stmt 1 view .LVU1004
+	movq	%rbp, %rsi	# name,
+	leaq	param_table(%rip), %rdi	#, tmp94
+	call	table_insert	#
+.LVL409:
+# console.c:308: }
+	.loc 1 308 1 is_stmt 0 view .LVU1005
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+.LVL410:
+	.loc 1 308 1 view .LVU1006
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL411:
+	.loc 1 308 1 view .LVU1007
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL412:
+	.loc 1 308 1 view .LVU1008
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL413:
+	.loc 1 308 1 view .LVU1009
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL414:
+	.loc 1 308 1 view .LVU1010
+	ret	
+	.cfi_endproc
+.LFE31:
+	.size	add_param, .-add_param
+	.section	.rodata.str1.8
+	.align 8
+.LC38:
+	.string	"                | Show documentation"
+	.section	.rodata.str1.1
+.LC39:
+	.string	"help"
+	.section	.rodata.str1.8
+	.align 8
+.LC40:
+	.string	" [name val]     | Display or set options"
+	.section	.rodata.str1.1
+.LC41:
+	.string	"option"
+	.section	.rodata.str1.8
+	.align 8
+.LC42:
+	.string	"                | Exit program"
+	.section	.rodata.str1.1
+.LC43:
+	.string	"quit"
+	.section	.rodata.str1.8
+	.align 8
+.LC44:
+	.string	" file           | Read commands from source file"
+	.section	.rodata.str1.1
+.LC45:
+	.string	"source"
+	.section	.rodata.str1.8
+	.align 8
+.LC46:
+	.string	" file           | Copy output to file"
+	.section	.rodata.str1.1
+.LC47:
+	.string	"log"
+	.section	.rodata.str1.8
+	.align 8
+.LC48:
+	.string	" cmd arg ...    | Time command execution"
+	.section	.rodata.str1.1
+.LC49:
+	.string	"time"
+	.section	.rodata.str1.8
+	.align 8
+.LC50:
+	.string	" ...            | Display comment"
+	.section	.rodata.str1.1
+.LC51:
+	.string	"#"
+	.section	.rodata.str1.8
+	.align 8
+.LC52:
+	.string	" n cmd arg ...  | Run command n times.  'repeat n {' runs following lines up to '}' n times"
+	.section	.rodata.str1.1
+.LC53:
+	.string	"repeat"
+	.section	.rodata.str1.8
+	.align 8
+.LC54:
+	.string	"                | Show timing statistics of each command"
+	.section	.rodata.str1.1
+.LC55:
+	.string	"stats"
+	.section	.rodata.str1.8
+	.align 8
+.LC56:
+	.string	" [file]         | Write JSON record of each command to file.  Stop if no file given"
+	.section	.rodata.str1.1
+.LC57:
+	.string	"metrics"
+.LC58:
+	.string	"Start/Stop simulation mode"
+.LC59:
+	.string	"simulation"
+.LC60:
+	.string	"Verbosity level"
+.LC61:
+	.string	"verbose"
+.LC62:
+	.string	"Number of errors until exit"
+.LC63:
+	.string	"error"
+.LC64:
+	.string	"Do/don't echo commands"
+.LC65:
+	.string	"echo"
+	.section	.rodata.str1.8
+	.align 8
+.LC66:
+	.string	"Do/don't write output from background thread"
+	.section	.rodata.str1.1
+.LC67:
+	.string	"async"
+	.section	.rodata.str1.8
+	.align 8
+.LC68:
+	.string	"Do/don't show command timing statistics at exit"
+	.align 8
+.LC69:
+	.string	"Number of measurements for simulation"
+	.section	.rodata.str1.1
+.LC70:
+	.string	"measures"
+	.section	.rodata.str1.8
+	.align 8
+.LC71:
+	.string	"Batches used to set cropping thresholds (0 = first batch only)"
+	.section	.rodata.str1.1
+.LC72:
+	.string	"cropwindow"
+	.section	.rodata.str1.8
+	.align 8
+.LC73:
+	.string	"Number of processes doing simulation measurements"
+	.section	.rodata.str1.1
+.LC74:
+	.string	"workers"
+	.section	.rodata.str1.8
+	.align 8
+.LC75:
+	.string	"Simulation timer: 0 rdtsc, 1 lfence+rdtsc, 2 rdtscp, 3 perf cycles, 4 perf instructions"
+	.section	.rodata.str1.1
+.LC76:
+	.string	"timer"
+	.section	.rodata.str1.8
+	.align 8
+.LC77:
+	.string	"Queues per class reused across simulation samples (0 = build per sample)"
+	.section	.rodata.str1.1
+.LC78:
+	.string	"pool"
+	.section	.rodata.str1.8
+	.align 8
+.LC79:
+	.string	"Stop simulation once the verdict is settled"
+	.section	.rodata.str1.1
+.LC80:
+	.string	"sequential"
+.LC81:
+	.string	"Use the old measure function"
+.LC82:
+	.string	"old"
+	.section	.rodata.str1.8
+	.align 8
+.LC83:
+	.string	"Write measurements to ./meas.bin"
+	.section	.rodata.str1.1
+.LC84:
+	.string	"write"
+	.text
+	.globl	init_cmd
+	.type	init_cmd, @function
+init_cmd:
+.LFB29:
+	.loc 1 203 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 204 5 view .LVU1012
+# console.c:204:     cmd_list = NULL;
+	.loc 1 204 14 is_stmt 0 view .LVU1013
+	movq	$0, cmd_list(%rip)	#, cmd_list
+	.loc 1 205 5 is_stmt 1 view .LVU1014
+# console.c:205:     param_list = NULL;
+	.loc 1 205 16 is_stmt 0 view .LVU1015
+	movq	$0, param_list(%rip)	#, param_list
+	.loc 1 206 5 is_stmt 1 view .LVU1016
+	leaq	cmd_table(%rip), %rdi	#, tmp83
+	call	table_clear	#
+.LVL415:
+	.loc 1 207 5 view .LVU1017
+	leaq	param_table(%rip), %rdi	#, tmp84
+	call	table_clear	#
+.LVL416:
+	.loc 1 208 5 view .LVU1018
+# console.c:208:     err_cnt = 0;
+	.loc 1 208 13 is_stmt 0 view .LVU1019
+	movl	$0, err_cnt(%rip)	#, err_cnt
+	.loc 1 209 5 is_stmt 1 view .LVU1020
+# console.c:209:     quit_flag = false;
+	.loc 1 209 15 is_stmt 0 view .LVU1021
+	movb	$0, quit_flag(%rip)	#, quit_flag
+	.loc 1 211 5 is_stmt 1 view .LVU1022
+	leaq	.LC38(%rip), %rdx	#, tmp85
+	leaq	do_help_cmd(%rip), %rsi	#, tmp86
+	leaq	.LC39(%rip), %rdi	#, tmp87
+	call	add_cmd	#
+.LVL417:
+	.loc 1 212 5 view .LVU1023
+	leaq	.LC40(%rip), %rdx	#, tmp88
+	leaq	do_option_cmd(%rip), %rsi	#, tmp89
+	leaq	.LC41(%rip), %rdi	#, tmp90
+	call	add_cmd	#
+.LVL418:
+	.loc 1 214 5 view .LVU1024
+	leaq	.LC42(%rip), %rdx	#, tmp91
+	leaq	do_quit_cmd(%rip), %rsi	#, tmp92
+	leaq	.LC43(%rip), %rdi	#, tmp93
+	call	add_cmd	#
+.LVL419:
+	.loc 1 215 5 view .LVU1025
+	leaq	.LC44(%rip), %rdx	#, tmp94
+	leaq	do_source_cmd(%rip), %rsi	#, tmp95
+	leaq	.LC45(%rip), %rdi	#, tmp96
+	call	add_cmd	#
+.LVL420:
+	.loc 1 217 5 view .LVU1026
+	leaq	.LC46(%rip), %rdx	#, tmp97
+	leaq	do_log_cmd(%rip), %rsi	#, tmp98
+	leaq	.LC47(%rip), %rdi	#, tmp99
+	call	add_cmd	#
+.LVL421:
+	.loc 1 218 5 view .LVU1027
+	leaq	.LC48(%rip), %rdx	#, tmp100
+	leaq	do_time_cmd(%rip), %rsi	#, tmp101
+	leaq	.LC49(%rip), %rdi	#, tmp102
+	call	add_cmd	#
+.LVL422:
+	.loc 1 219 5 view .LVU1028
+	leaq	.LC50(%rip), %rdx	#, tmp103
+	leaq	do_comment_cmd(%rip), %rsi	#, tmp104
+	leaq	.LC51(%rip), %rdi	#, tmp105
+	call	add_cmd	#
+.LVL423:
+	.loc 1 220 5 view .LVU1029
+	leaq	.LC52(%rip), %rdx	#, tmp106
+	leaq	do_repeat_cmd(%rip), %rsi	#, tmp107
+	leaq	.LC53(%rip), %rdi	#, tmp108
+	call	add_cmd	#
+.LVL424:
+	.loc 1 223 5 view .LVU1030
+	leaq	.LC54(%rip), %rdx	#, tmp109
+	leaq	do_stats_cmd(%rip), %rsi	#, tmp110
+	leaq	.LC55(%rip), %rbx	#, tmp111
+	movq	%rbx, %rdi	# tmp111,
+	call	add_cmd	#
+.LVL425:
+	.loc 1 225 5 view .LVU1031
+	leaq	.LC56(%rip), %rdx	#, tmp112
+	leaq	do_metrics_cmd(%rip), %rsi	#, tmp113
+	leaq	.LC57(%rip), %rdi	#, tmp114
+	call	add_cmd	#
+.LVL426:
+	.loc 1 228 5 view .LVU1032
+	movl	$0, %ecx	#,
+	leaq	.LC58(%rip), %rdx	#, tmp115
+	leaq	simulation(%rip), %rsi	#, tmp116
+	leaq	.LC59(%rip), %rdi	#, tmp117
+	call	add_param	#
+.LVL427:
+	.loc 1 230 5 view .LVU1033
+	movl	$0, %ecx	#,
+	leaq	.LC60(%rip), %rdx	#, tmp118
+	leaq	verblevel(%rip), %rsi	#, tmp119
+	leaq	.LC61(%rip), %rdi	#, tmp120
+	call	add_param	#
+.LVL428:
+	.loc 1 231 5 view .LVU1034
+	movl	$0, %ecx	#,
+	leaq	.LC62(%rip), %rdx	#, tmp121
+	leaq	err_limit(%rip), %rsi	#, tmp122
+	leaq	.LC63(%rip), %rdi	#, tmp123
+	call	add_param	#
+.LVL429:
+	.loc 1 232 5 view .LVU1035
+	movl	$0, %ecx	#,
+	leaq	.LC64(%rip), %rdx	#, tmp124
+	leaq	echo(%rip), %rsi	#, tmp125
+	leaq	.LC65(%rip), %rdi	#, tmp126
+	call	add_param	#
+.LVL430:
+	.loc 1 233 5 view .LVU1036
+	leaq	async_changed(%rip), %rcx	#, tmp127
+	leaq	.LC66(%rip), %rdx	#, tmp128
+	leaq	async_output(%rip), %rsi	#, tmp129
+	leaq	.LC67(%rip), %rdi	#, tmp130
+	call	add_param	#
+.LVL431:
+	.loc 1 235 5 view .LVU1037
+	movl	$0, %ecx	#,
+	leaq	.LC68(%rip), %rdx	#, tmp131
+	leaq	quit_stats(%rip), %rsi	#, tmp132
+	movq	%rbx, %rdi	# tmp111,
+	call	add_param	#
+.LVL432:
+	.loc 1 237 5 view .LVU1038
+	movl	$0, %ecx	#,
+	leaq	.LC69(%rip), %rdx	#, tmp134
+	leaq	total_measurements(%rip), %rsi	#, tmp135
+	leaq	.LC70(%rip), %rdi	#, tmp136
+	call	add_param	#
+.LVL433:
+	.loc 1 239 5 view .LVU1039
+	movl	$0, %ecx	#,
+	leaq	.LC71(%rip), %rdx	#, tmp137
+	leaq	crop_window(%rip), %rsi	#, tmp138
+	leaq	.LC72(%rip), %rdi	#, tmp139
+	call	add_param	#
+.LVL434:
+	.loc 1 242 5 view .LVU1040
+	movl	$0, %ecx	#,
+	leaq	.LC73(%rip), %rdx	#, tmp140
+	leaq	dudect_workers(%rip), %rsi	#, tmp141
+	leaq	.LC74(%rip), %rdi	#, tmp142
+	call	add_param	#
+.LVL435:
+	.loc 1 244 5 view .LVU1041
+	movl	$0, %ecx	#,
+	leaq	.LC75(%rip), %rdx	#, tmp143
+	leaq	timing_backend(%rip), %rsi	#, tmp144
+	leaq	.LC76(%rip), %rdi	#, tmp145
+	call	add_param	#
+.LVL436:
+	.loc 1 248 5 view .LVU1042
+	movl	$0, %ecx	#,
+	leaq	.LC77(%rip), %rdx	#, tmp146
+	leaq	dudect_pool(%rip), %rsi	#, tmp147
+	leaq	.LC78(%rip), %rdi	#, tmp148
+	call	add_param	#
+.LVL437:
+	.loc 1 252 5 view .LVU1043
+	movl	$0, %ecx	#,
+	leaq	.LC79(%rip), %rdx	#, tmp149
+	leaq	dudect_sequential(%rip), %rsi	#, tmp150
+	leaq	.LC80(%rip), %rdi	#, tmp151
+	call	add_param	#
+.LVL438:
+	.loc 1 254 5 view .LVU1044
+	movl	$0, %ecx	#,
+	leaq	.LC81(%rip), %rdx	#, tmp152
+	leaq	old_measure(%rip), %rsi	#, tmp153
+	leaq	.LC82(%rip), %rdi	#, tmp154
+	call	add_param	#
+.LVL439:
+	.loc 1 256 5 view .LVU1045
+	movl	$0, %ecx	#,
+	leaq	.LC83(%rip), %rdx	#, tmp155
+	leaq	write_data(%rip), %rsi	#, tmp156
+	leaq	.LC84(%rip), %rdi	#, tmp157
+	call	add_param	#
+.LVL440:
+	.loc 1 259 5 view .LVU1046
+.LBB57:
+.LBI57:
+	.loc 1 871 13 view .LVU1047
+.LBB58:
+	.loc 1 873 5 view .LVU1048
+# console.c:873:     buf_stack = NULL;
+	.loc 1 873 15 is_stmt 0 view .LVU1049
+	movq	$0, buf_stack(%rip)	#, buf_stack
+.LBE58:
+.LBE57:
+	.loc 1 260 5 is_stmt 1 view .LVU1050
+	leaq	last_time(%rip), %rdi	#, tmp158
+	call	init_time@PLT	#
+.LVL441:
+	.loc 1 261 5 view .LVU1051
+# console.c:261:     first_time = last_time;
+	.loc 1 261 16 is_stmt 0 view .LVU1052
+	movsd	last_time(%rip), %xmm0	# last_time, last_time
+	movsd	%xmm0, first_time(%rip)	# last_time, first_time
+# console.c:262: }
+	.loc 1 262 1 view .LVU1053
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE29:
+	.size	init_cmd, .-init_cmd
+	.section	.rodata.str1.8
+	.align 8
+.LC85:
+	.string	"Exceeded limit on quit helpers"
+	.text
+	.globl	add_quit_helper
+	.type	add_quit_helper, @function
+add_quit_helper:
+.LVL442:
+.LFB39:
+	.loc 1 449 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 450 5 view .LVU1055
+# console.c:450:     if (quit_helper_cnt < MAXQUIT)
+	.loc 1 450 25 is_stmt 0 view .LVU1056
+	movl	quit_helper_cnt(%rip), %eax	# quit_helper_cnt, quit_helper_cnt.54_1
+# console.c:450:     if (quit_helper_cnt < MAXQUIT)
+	.loc 1 450 8 view .LVU1057
+	cmpl	$9, %eax	#, quit_helper_cnt.54_1
+	jg	.L292	#,
+	.loc 1 451 9 is_stmt 1 view .LVU1058
+# console.c:451:         quit_helpers[quit_helper_cnt++] = qf;
+	.loc 1 451 37 is_stmt 0 view .LVU1059
+	leal	1(%rax), %edx	#, tmp85
+	movl	%edx, quit_helper_cnt(%rip)	# tmp85, quit_helper_cnt
+# console.c:451:         quit_helpers[quit_helper_cnt++] = qf;
+	.loc 1 451 41 view .LVU1060
+	cltq
+	leaq	quit_helpers(%rip), %rdx	#, tmp86
+	movq	%rdi, (%rdx,%rax,8)	# qf, quit_helpers[quit_helper_cnt.54_1]
+	ret	
+.L292:
+# console.c:449: {
+	.loc 1 449 1 view .LVU1061
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 453 9 is_stmt 1 view .LVU1062
+	leaq	.LC85(%rip), %rsi	#, tmp88
+	movl	$2, %edi	#,
+.LVL443:
+	.loc 1 453 9 is_stmt 0 view .LVU1063
+	movl	$0, %eax	#,
+	call	report_event@PLT	#
+.LVL444:
+# console.c:454: }
+	.loc 1 454 1 view .LVU1064
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE39:
+	.size	add_quit_helper, .-add_quit_helper
+	.globl	set_metrics_helper
+	.type	set_metrics_helper, @function
+set_metrics_helper:
+.LVL445:
+.LFB40:
+	.loc 1 458 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 459 5 view .LVU1066
+# console.c:459:     metrics_helper = mf;
+	.loc 1 459 20 is_stmt 0 view .LVU1067
+	movq	%rdi, metrics_helper(%rip)	# tmp83, metrics_helper
+# console.c:460: }
+	.loc 1 460 1 view .LVU1068
+	ret	
+	.cfi_endproc
+.LFE40:
+	.size	set_metrics_helper, .-set_metrics_helper
+	.globl	set_echo
+	.type	set_echo, @function
+set_echo:
+.LVL446:
+.LFB41:
+	.loc 1 464 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 465 5 view .LVU1070
+# console.c:465:     echo = on ? 1 : 0;
+	.loc 1 465 10 is_stmt 0 view .LVU1071
+	movb	%dil, echo(%rip)	# tmp84, echo
+# console.c:466: }
+	.loc 1 466 1 view .LVU1072
+	ret	
+	.cfi_endproc
+.LFE41:
+	.size	set_echo, .-set_echo
+	.globl	get_int
+	.type	get_int, @function
+get_int:
+.LVL447:
+.LFB47:
+	.loc 1 567 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 567 1 is_stmt 0 view .LVU1074
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$16, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rsi, %rbx	# tmp94, loc
+	.loc 1 568 5 is_stmt 1 view .LVU1075
+# console.c:568:     char *end = NULL;
+	.loc 1 568 11 is_stmt 0 view .LVU1076
+	movq	$0, 8(%rsp)	#, end
+	.loc 1 569 5 is_stmt 1 view .LVU1077
+# console.c:569:     long int v = strtol(vname, &end, 0);
+	.loc 1 569 18 is_stmt 0 view .LVU1078
+	leaq	8(%rsp), %rsi	#, tmp89
+.LVL448:
+	.loc 1 569 18 view .LVU1079
+	movl	$0, %edx	#,
+	call	strtol@PLT	#
+.LVL449:
+	.loc 1 570 5 is_stmt 1 view .LVU1080
+# console.c:571:         return false;
+	.loc 1 571 16 is_stmt 0 view .LVU1081
+	movl	$0, %edx	#, <retval>
+# console.c:570:     if (v == LONG_MIN || *end != '\0')
+	.loc 1 570 8 view .LVU1082
+	movabsq	$-9223372036854775808, %rcx	#, tmp90
+	cmpq	%rcx, %rax	# tmp90, v
+	je	.L299	#,
+# console.c:570:     if (v == LONG_MIN || *end != '\0')
+	.loc 1 570 23 discriminator 1 view .LVU1083
+	movq	8(%rsp), %rcx	# end, end
+	cmpb	$0, (%rcx)	#, *end.57_1
+	jne	.L299	#,
+	.loc 1 573 5 is_stmt 1 view .LVU1084
+# console.c:573:     *loc = (int) v;
+	.loc 1 573 12 is_stmt 0 view .LVU1085
+	movl	%eax, (%rbx)	# v, *loc_11(D)
+	.loc 1 574 5 is_stmt 1 view .LVU1086
+# console.c:574:     return true;
+	.loc 1 574 12 is_stmt 0 view .LVU1087
+	movl	$1, %edx	#, <retval>
+.L299:
+# console.c:575: }
+	.loc 1 575 1 view .LVU1088
+	movl	%edx, %eax	# <retval>,
+.LVL450:
+	.loc 1 575 1 view .LVU1089
+	addq	$16, %rsp	#,
+	.cfi_def_cfa_offset 16
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL451:
+	.loc 1 575 1 view .LVU1090
+	ret	
+	.cfi_endproc
+.LFE47:
+	.size	get_int, .-get_int
+	.section	.rodata.str1.8
+	.align 8
+.LC86:
+	.string	"Missing '}' at end of repeat block"
+	.section	.rodata.str1.1
+.LC87:
+	.string	"parse_block"
+.LC88:
+	.string	"}"
+.LC89:
+	.string	"{"
+.LC90:
+	.string	"Invalid repeat count '%s'"
+	.text
+	.type	parse_block, @function
+parse_block:
+.LVL452:
+.LFB53:
+	.loc 1 704 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 704 1 is_stmt 0 view .LVU1092
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$312, %rsp	#,
+	.cfi_def_cfa_offset 368
+	movq	%rdi, 16(%rsp)	# bodyp, %sfp
+	movl	%esi, 28(%rsp)	# tmp163, %sfp
+	.loc 1 705 5 is_stmt 1 view .LVU1093
+.LVL453:
+	.loc 1 706 5 view .LVU1094
+	.loc 1 707 5 view .LVU1095
+# console.c:707:     *bodyp = NULL;
+	.loc 1 707 12 is_stmt 0 view .LVU1096
+	movq	$0, (%rdi)	#, *bodyp_38(D)
+# console.c:705:     bool ok = true;
+	.loc 1 705 10 view .LVU1097
+	movb	$1, 27(%rsp)	#, %sfp
+.LBB59:
+# console.c:719:         char *save = strsave_or_fail(line, "parse_block");
+	.loc 1 719 22 view .LVU1098
+	leaq	.LC87(%rip), %r15	#, tmp158
+# console.c:722:         int argc = parse_args(save, stack_argv, MAXARGS, &end);
+	.loc 1 722 20 view .LVU1099
+	leaq	40(%rsp), %r14	#, tmp159
+	leaq	48(%rsp), %r13	#, tmp160
+.LVL454:
+.L305:
+	.loc 1 722 20 view .LVU1100
+.LBE59:
+	.loc 1 709 5 is_stmt 1 view .LVU1101
+.LBB60:
+	.loc 1 710 9 view .LVU1102
+# console.c:710:         char *line = line_source();
+	.loc 1 710 22 is_stmt 0 view .LVU1103
+	movl	$0, %eax	#,
+	call	*line_source(%rip)	# line_source
+.LVL455:
+	movq	%rax, %rbx	# tmp164, line
+.LVL456:
+	.loc 1 711 9 is_stmt 1 view .LVU1104
+# console.c:711:         if (!line) {
+	.loc 1 711 12 is_stmt 0 view .LVU1105
+	testq	%rax, %rax	# line
+	je	.L320	#,
+	.loc 1 718 9 is_stmt 1 view .LVU1106
+# console.c:718:         size_t len = strlen(line);
+	.loc 1 718 22 is_stmt 0 view .LVU1107
+	movq	%rax, %rdi	# line,
+	call	strlen@PLT	#
+.LVL457:
+	.loc 1 718 22 view .LVU1108
+	movq	%rax, 8(%rsp)	# tmp165, %sfp
+.LVL458:
+	.loc 1 719 9 is_stmt 1 view .LVU1109
+# console.c:719:         char *save = strsave_or_fail(line, "parse_block");
+	.loc 1 719 22 is_stmt 0 view .LVU1110
+	movq	%r15, %rsi	# tmp158,
+	movq	%rbx, %rdi	# line,
+	call	strsave_or_fail@PLT	#
+.LVL459:
+	.loc 1 719 22 view .LVU1111
+	movq	%rax, %rbx	# tmp166, save
+.LVL460:
+	.loc 1 720 9 is_stmt 1 view .LVU1112
+	.loc 1 721 9 view .LVU1113
+	.loc 1 722 9 view .LVU1114
+# console.c:722:         int argc = parse_args(save, stack_argv, MAXARGS, &end);
+	.loc 1 722 20 is_stmt 0 view .LVU1115
+	movq	%r14, %rcx	# tmp159,
+	movl	$32, %edx	#,
+	movq	%r13, %rsi	# tmp160,
+	movq	%rax, %rdi	# save,
+	call	parse_args	#
+.LVL461:
+	.loc 1 722 20 view .LVU1116
+	movl	%eax, %ebp	# tmp167, argc
+.LVL462:
+	.loc 1 723 9 is_stmt 1 view .LVU1117
+# console.c:723:         if (argc == 0 || strcmp(stack_argv[0], "}") == 0) {
+	.loc 1 723 12 is_stmt 0 view .LVU1118
+	testl	%eax, %eax	# argc
+	je	.L308	#,
+# console.c:723:         if (argc == 0 || strcmp(stack_argv[0], "}") == 0) {
+	.loc 1 723 26 discriminator 1 view .LVU1119
+	leaq	.LC88(%rip), %rsi	#,
+	movq	48(%rsp), %rdi	# stack_argv[0],
+	call	strcmp@PLT	#
+.LVL463:
+# console.c:723:         if (argc == 0 || strcmp(stack_argv[0], "}") == 0) {
+	.loc 1 723 23 discriminator 1 view .LVU1120
+	testl	%eax, %eax	# tmp168
+	jne	.L321	#,
+	.loc 1 724 13 is_stmt 1 view .LVU1121
+	movq	8(%rsp), %rsi	# %sfp, tmp118
+	addq	$1, %rsi	#, tmp118
+	movq	%rbx, %rdi	# save,
+	call	free_block@PLT	#
+.LVL464:
+	.loc 1 725 13 view .LVU1122
+.L304:
+	.loc 1 725 13 is_stmt 0 view .LVU1123
+.LBE60:
+# console.c:762: }
+	.loc 1 762 1 view .LVU1124
+	movzbl	27(%rsp), %eax	# %sfp,
+	addq	$312, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL465:
+.L320:
+	.cfi_restore_state
+.LBB61:
+	.loc 1 713 13 is_stmt 1 view .LVU1125
+# console.c:715:             return false;
+	.loc 1 715 20 is_stmt 0 view .LVU1126
+	movb	$0, 27(%rsp)	#, %sfp
+.LVL466:
+# console.c:713:             if (depth == 0)
+	.loc 1 713 16 view .LVU1127
+	cmpl	$0, 28(%rsp)	#, %sfp
+	jne	.L304	#,
+	.loc 1 714 17 is_stmt 1 view .LVU1128
+	leaq	.LC86(%rip), %rsi	#, tmp116
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL467:
+	.loc 1 714 17 is_stmt 0 view .LVU1129
+	call	report@PLT	#
+.LVL468:
+# console.c:715:             return false;
+	.loc 1 715 20 view .LVU1130
+	movb	$0, 27(%rsp)	#, %sfp
+	jmp	.L304	#
+.LVL469:
+.L321:
+	.loc 1 730 9 is_stmt 1 view .LVU1131
+# console.c:730:         step_ptr step = malloc_or_fail(sizeof(step_ele), "parse_block");
+	.loc 1 730 25 is_stmt 0 view .LVU1132
+	leaq	.LC87(%rip), %rsi	#,
+	movl	$64, %edi	#,
+	call	malloc_or_fail@PLT	#
+.LVL470:
+	movq	%rax, %r12	# tmp169, step
+.LVL471:
+	.loc 1 731 9 is_stmt 1 view .LVU1133
+# console.c:731:         step->line = save;
+	.loc 1 731 20 is_stmt 0 view .LVU1134
+	movq	%rbx, 24(%rax)	# save, step_49->line
+	.loc 1 732 9 is_stmt 1 view .LVU1135
+# console.c:732:         step->len = len;
+	.loc 1 732 19 is_stmt 0 view .LVU1136
+	movq	8(%rsp), %rax	# %sfp, tmp118
+.LVL472:
+	.loc 1 732 19 view .LVU1137
+	movq	%rax, 32(%r12)	# tmp118, step_49->len
+	.loc 1 733 9 is_stmt 1 view .LVU1138
+# console.c:733:         step->argc = argc;
+	.loc 1 733 20 is_stmt 0 view .LVU1139
+	movl	%ebp, 8(%r12)	# argc, step_49->argc
+	.loc 1 734 9 is_stmt 1 view .LVU1140
+# console.c:734:         step->argv = calloc_or_fail(argc, sizeof(char *), "parse_block");
+	.loc 1 734 22 is_stmt 0 view .LVU1141
+	movslq	%ebp, %rax	# argc, _5
+	leaq	.LC87(%rip), %rdx	#,
+	movl	$8, %esi	#,
+	movq	%rax, 8(%rsp)	# _5, %sfp
+.LVL473:
+	.loc 1 734 22 view .LVU1142
+	movq	%rax, %rdi	# _5,
+	call	calloc_or_fail@PLT	#
+.LVL474:
+# console.c:734:         step->argv = calloc_or_fail(argc, sizeof(char *), "parse_block");
+	.loc 1 734 20 view .LVU1143
+	movq	%rax, 16(%r12)	# _6, step_49->argv
+	.loc 1 735 9 is_stmt 1 view .LVU1144
+# console.c:735:         if (argc <= MAXARGS)
+	.loc 1 735 12 is_stmt 0 view .LVU1145
+	cmpl	$32, %ebp	#, argc
+	jg	.L310	#,
+	.loc 1 736 13 is_stmt 1 view .LVU1146
+	movq	8(%rsp), %rdx	# %sfp, _5
+	salq	$3, %rdx	#, _5
+	leaq	48(%rsp), %rsi	#, tmp130
+	movq	%rax, %rdi	# _6,
+	call	memcpy@PLT	#
+.LVL475:
+	.loc 1 739 9 view .LVU1147
+# console.c:739:         step->cmd = NULL;
+	.loc 1 739 19 is_stmt 0 view .LVU1148
+	movq	$0, (%r12)	#, step_49->cmd
+	.loc 1 740 9 is_stmt 1 view .LVU1149
+# console.c:740:         step->body = NULL;
+	.loc 1 740 20 is_stmt 0 view .LVU1150
+	movq	$0, 48(%r12)	#, step_49->body
+	.loc 1 741 9 is_stmt 1 view .LVU1151
+# console.c:741:         step->next = NULL;
+	.loc 1 741 20 is_stmt 0 view .LVU1152
+	movq	$0, 56(%r12)	#, step_49->next
+	.loc 1 742 9 is_stmt 1 view .LVU1153
+# console.c:742:         *last_loc = step;
+	.loc 1 742 19 is_stmt 0 view .LVU1154
+	movq	16(%rsp), %rax	# %sfp, bodyp
+	movq	%r12, (%rax)	# step, *last_loc_30
+	.loc 1 743 9 is_stmt 1 view .LVU1155
+# console.c:743:         last_loc = &step->next;
+	.loc 1 743 18 is_stmt 0 view .LVU1156
+	leaq	56(%r12), %rax	#, bodyp
+	movq	%rax, 16(%rsp)	# bodyp, %sfp
+.LVL476:
+	.loc 1 745 9 is_stmt 1 view .LVU1157
+# console.c:745:         char **argv = step->argv;
+	.loc 1 745 16 is_stmt 0 view .LVU1158
+	movq	16(%r12), %rbx	# step_49->argv, argv
+.LVL477:
+	.loc 1 746 9 is_stmt 1 view .LVU1159
+# console.c:746:         if (argc == 3 && strcmp(argv[0], "repeat") == 0 &&
+	.loc 1 746 12 is_stmt 0 view .LVU1160
+	cmpl	$3, %ebp	#, argc
+	jne	.L312	#,
+# console.c:746:         if (argc == 3 && strcmp(argv[0], "repeat") == 0 &&
+	.loc 1 746 26 discriminator 1 view .LVU1161
+	movq	(%rbx), %rdi	# *argv_62, *argv_62
+	leaq	.LC53(%rip), %rsi	#, tmp140
+	call	strcmp@PLT	#
+.LVL478:
+# console.c:746:         if (argc == 3 && strcmp(argv[0], "repeat") == 0 &&
+	.loc 1 746 23 discriminator 1 view .LVU1162
+	testl	%eax, %eax	# tmp171
+	jne	.L312	#,
+# console.c:747:             strcmp(argv[2], "{") == 0) {
+	.loc 1 747 13 discriminator 2 view .LVU1163
+	movq	16(%rbx), %rdi	# MEM[(char * *)argv_62 + 16B], MEM[(char * *)argv_62 + 16B]
+	leaq	.LC89(%rip), %rsi	#, tmp144
+	call	strcmp@PLT	#
+.LVL479:
+# console.c:746:         if (argc == 3 && strcmp(argv[0], "repeat") == 0 &&
+	.loc 1 746 57 discriminator 2 view .LVU1164
+	testl	%eax, %eax	# tmp172
+	jne	.L312	#,
+	.loc 1 748 13 is_stmt 1 view .LVU1165
+# console.c:748:             if (!get_int(argv[1], &step->reps) || step->reps < 0) {
+	.loc 1 748 18 is_stmt 0 view .LVU1166
+	leaq	40(%r12), %rsi	#, tmp145
+	movq	8(%rbx), %rdi	# MEM[(char * *)argv_62 + 8B], MEM[(char * *)argv_62 + 8B]
+	call	get_int	#
+.LVL480:
+# console.c:748:             if (!get_int(argv[1], &step->reps) || step->reps < 0) {
+	.loc 1 748 16 view .LVU1167
+	testb	%al, %al	# tmp173
+	je	.L313	#,
+	movzbl	27(%rsp), %ebp	# %sfp, ok
+.LVL481:
+# console.c:748:             if (!get_int(argv[1], &step->reps) || step->reps < 0) {
+	.loc 1 748 48 discriminator 1 view .LVU1168
+	cmpl	$0, 40(%r12)	#, step_49->reps
+	jns	.L314	#,
+.L313:
+	.loc 1 749 17 is_stmt 1 view .LVU1169
+	movq	8(%rbx), %rdx	# MEM[(char * *)argv_62 + 8B], MEM[(char * *)argv_62 + 8B]
+	leaq	.LC90(%rip), %rsi	#, tmp148
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL482:
+	.loc 1 750 17 view .LVU1170
+# console.c:750:                 ok = false;
+	.loc 1 750 20 is_stmt 0 view .LVU1171
+	movl	$0, %ebp	#, ok
+.LVL483:
+.L314:
+	.loc 1 752 13 is_stmt 1 view .LVU1172
+# console.c:752:             if (!parse_block(&step->body, depth + 1))
+	.loc 1 752 18 is_stmt 0 view .LVU1173
+	movl	28(%rsp), %eax	# %sfp, depth
+	leal	1(%rax), %esi	#, tmp149
+	leaq	48(%r12), %rdi	#, tmp150
+	call	parse_block	#
+.LVL484:
+# console.c:752:             if (!parse_block(&step->body, depth + 1))
+	.loc 1 752 16 view .LVU1174
+	testb	%al, %al	# <retval>
+	cmovne	%ebp, %eax	# <retval>,, ok, <retval>
+	movb	%al, 27(%rsp)	# <retval>, %sfp
+	jmp	.L305	#
+.LVL485:
+.L310:
+	.loc 1 738 13 is_stmt 1 view .LVU1175
+	movq	%rax, %rdx	# _6,
+	movq	40(%rsp), %rsi	# end,
+	movq	%rbx, %rdi	# save,
+	call	collect_args	#
+.LVL486:
+	.loc 1 739 9 view .LVU1176
+# console.c:739:         step->cmd = NULL;
+	.loc 1 739 19 is_stmt 0 view .LVU1177
+	movq	$0, (%r12)	#, step_49->cmd
+	.loc 1 740 9 is_stmt 1 view .LVU1178
+# console.c:740:         step->body = NULL;
+	.loc 1 740 20 is_stmt 0 view .LVU1179
+	movq	$0, 48(%r12)	#, step_49->body
+	.loc 1 741 9 is_stmt 1 view .LVU1180
+# console.c:741:         step->next = NULL;
+	.loc 1 741 20 is_stmt 0 view .LVU1181
+	movq	$0, 56(%r12)	#, step_49->next
+	.loc 1 742 9 is_stmt 1 view .LVU1182
+# console.c:742:         *last_loc = step;
+	.loc 1 742 19 is_stmt 0 view .LVU1183
+	movq	16(%rsp), %rax	# %sfp, bodyp
+	movq	%r12, (%rax)	# step, *last_loc_30
+	.loc 1 743 9 is_stmt 1 view .LVU1184
+# console.c:743:         last_loc = &step->next;
+	.loc 1 743 18 is_stmt 0 view .LVU1185
+	leaq	56(%r12), %rax	#, bodyp
+	movq	%rax, 16(%rsp)	# bodyp, %sfp
+.LVL487:
+	.loc 1 745 9 is_stmt 1 view .LVU1186
+# console.c:745:         char **argv = step->argv;
+	.loc 1 745 16 is_stmt 0 view .LVU1187
+	movq	16(%r12), %rbx	# step_49->argv, argv
+.LVL488:
+	.loc 1 746 9 is_stmt 1 view .LVU1188
+.L312:
+	.loc 1 755 13 view .LVU1189
+# console.c:755:             step->cmd = table_find(&cmd_table, argv[0]);
+	.loc 1 755 25 is_stmt 0 view .LVU1190
+	movq	(%rbx), %rsi	# *argv_90, *argv_90
+	leaq	cmd_table(%rip), %rdi	#, tmp152
+	call	table_find	#
+.LVL489:
+# console.c:755:             step->cmd = table_find(&cmd_table, argv[0]);
+	.loc 1 755 23 view .LVU1191
+	movq	%rax, (%r12)	# _25, step_49->cmd
+	.loc 1 756 13 is_stmt 1 view .LVU1192
+# console.c:756:             if (!step->cmd) {
+	.loc 1 756 16 is_stmt 0 view .LVU1193
+	testq	%rax, %rax	# _25
+	jne	.L305	#,
+	.loc 1 757 17 is_stmt 1 view .LVU1194
+	movq	(%rbx), %rdx	# *argv_90, *argv_90
+	leaq	.LC25(%rip), %rsi	#, tmp154
+	movl	$1, %edi	#,
+	call	report@PLT	#
+.LVL490:
+	.loc 1 758 17 view .LVU1195
+# console.c:758:                 ok = false;
+	.loc 1 758 20 is_stmt 0 view .LVU1196
+	movb	$0, 27(%rsp)	#, %sfp
+	.loc 1 758 20 view .LVU1197
+	jmp	.L305	#
+.LVL491:
+.L308:
+	.loc 1 724 13 is_stmt 1 view .LVU1198
+	movq	8(%rsp), %rsi	# %sfp, tmp118
+	addq	$1, %rsi	#, tmp118
+	movq	%rbx, %rdi	# save,
+	call	free_block@PLT	#
+.LVL492:
+	.loc 1 725 13 view .LVU1199
+	.loc 1 726 17 view .LVU1200
+	jmp	.L305	#
+.LBE61:
+	.cfi_endproc
+.LFE53:
+	.size	parse_block, .-parse_block
+	.section	.rodata.str1.8
+	.align 8
+.LC91:
+	.string	"%s needs a count and a command"
+	.text
+	.type	do_repeat_cmd, @function
+do_repeat_cmd:
+.LVL493:
+.LFB55:
+	.loc 1 780 1 view -0
+	.cfi_startproc
+	.loc 1 780 1 is_stmt 0 view .LVU1202
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 80
+	movq	%rsi, %r12	# tmp120, argv
+	.loc 1 781 5 is_stmt 1 view .LVU1203
+	.loc 1 782 5 view .LVU1204
+# console.c:782:     if (argc < 3) {
+	.loc 1 782 8 is_stmt 0 view .LVU1205
+	cmpl	$2, %edi	#, argc
+	jle	.L335	#,
+	movl	%edi, %r13d	# tmp119, argc
+	.loc 1 786 5 is_stmt 1 view .LVU1206
+# console.c:786:     if (!get_int(argv[1], &reps) || reps < 0) {
+	.loc 1 786 10 is_stmt 0 view .LVU1207
+	leaq	12(%rsp), %rsi	#, tmp102
+.LVL494:
+	.loc 1 786 10 view .LVU1208
+	movq	8(%r12), %rdi	# MEM[(char * *)argv_24(D) + 8B], MEM[(char * *)argv_24(D) + 8B]
+.LVL495:
+	.loc 1 786 10 view .LVU1209
+	call	get_int	#
+.LVL496:
+	movl	%eax, %ebx	# tmp121, <retval>
+# console.c:786:     if (!get_int(argv[1], &reps) || reps < 0) {
+	.loc 1 786 8 view .LVU1210
+	testb	%al, %al	# <retval>
+	je	.L325	#,
+# console.c:786:     if (!get_int(argv[1], &reps) || reps < 0) {
+	.loc 1 786 42 discriminator 1 view .LVU1211
+	movl	12(%rsp), %r15d	# reps, reps.1_4
+# console.c:786:     if (!get_int(argv[1], &reps) || reps < 0) {
+	.loc 1 786 34 discriminator 1 view .LVU1212
+	testl	%r15d, %r15d	# reps.1_4
+	js	.L325	#,
+	.loc 1 791 5 is_stmt 1 view .LVU1213
+# console.c:791:     if (argc == 3 && strcmp(argv[2], "{") == 0) {
+	.loc 1 791 8 is_stmt 0 view .LVU1214
+	cmpl	$3, %r13d	#, argc
+	jne	.L327	#,
+# console.c:791:     if (argc == 3 && strcmp(argv[2], "{") == 0) {
+	.loc 1 791 22 discriminator 1 view .LVU1215
+	movq	16(%r12), %rdi	# MEM[(char * *)argv_24(D) + 16B], MEM[(char * *)argv_24(D) + 16B]
+	leaq	.LC89(%rip), %rsi	#, tmp109
+	call	strcmp@PLT	#
+.LVL497:
+# console.c:791:     if (argc == 3 && strcmp(argv[2], "{") == 0) {
+	.loc 1 791 19 discriminator 1 view .LVU1216
+	testl	%eax, %eax	# tmp122
+	je	.L336	#,
+.L327:
+	.loc 1 801 5 is_stmt 1 view .LVU1217
+# console.c:801:     cmd_ptr cmd = table_find(&cmd_table, argv[2]);
+	.loc 1 801 19 is_stmt 0 view .LVU1218
+	movq	16(%r12), %rbp	# MEM[(char * *)argv_24(D) + 16B], _10
+	movq	%rbp, %rsi	# _10,
+	leaq	cmd_table(%rip), %rdi	#, tmp113
+	call	table_find	#
+.LVL498:
+	movq	%rax, %r14	# tmp125, cmd
+.LVL499:
+	.loc 1 802 5 is_stmt 1 view .LVU1219
+# console.c:802:     if (!cmd) {
+	.loc 1 802 8 is_stmt 0 view .LVU1220
+	testq	%rax, %rax	# cmd
+	je	.L329	#,
+.LVL500:
+.LBB62:
+	.loc 1 807 30 is_stmt 1 view .LVU1221
+# console.c:807:     for (int r = 0; r < reps && !quit_flag; r++)
+	.loc 1 807 14 is_stmt 0 view .LVU1222
+	movl	$0, %ebp	#, r
+# console.c:808:         ok = run_cmd(cmd, argc - 2, argv + 2) && ok;
+	.loc 1 808 14 view .LVU1223
+	addq	$16, %r12	#, tmp118
+.LVL501:
+# console.c:807:     for (int r = 0; r < reps && !quit_flag; r++)
+	.loc 1 807 30 view .LVU1224
+	testl	%r15d, %r15d	# reps.1_4
+	jle	.L322	#,
+.LVL502:
+.L330:
+# console.c:807:     for (int r = 0; r < reps && !quit_flag; r++)
+	.loc 1 807 30 discriminator 3 view .LVU1225
+	cmpb	$0, quit_flag(%rip)	#, quit_flag
+	jne	.L322	#,
+	.loc 1 808 9 is_stmt 1 view .LVU1226
+# console.c:808:         ok = run_cmd(cmd, argc - 2, argv + 2) && ok;
+	.loc 1 808 14 is_stmt 0 view .LVU1227
+	leal	-2(%r13), %esi	#, tmp116
+	movq	%r12, %rdx	# tmp118,
+	movq	%r14, %rdi	# cmd,
+	call	run_cmd	#
+.LVL503:
+# console.c:808:         ok = run_cmd(cmd, argc - 2, argv + 2) && ok;
+	.loc 1 808 47 view .LVU1228
+	andl	%eax, %ebx	# tmp126, <retval>
+.LVL504:
+	.loc 1 807 46 is_stmt 1 view .LVU1229
+	addl	$1, %ebp	#, r
+.LVL505:
+	.loc 1 807 30 view .LVU1230
+	cmpl	%ebp, %r15d	# r, reps.1_4
+	jne	.L330	#,
+	jmp	.L322	#
+.LVL506:
+.L335:
+	.loc 1 807 30 is_stmt 0 view .LVU1231
+.LBE62:
+	.loc 1 783 9 is_stmt 1 view .LVU1232
+	movq	(%rsi), %rdx	# *argv_24(D), *argv_24(D)
+	leaq	.LC91(%rip), %rsi	#, tmp101
+.LVL507:
+	.loc 1 783 9 is_stmt 0 view .LVU1233
+	movl	$1, %edi	#,
+.LVL508:
+	.loc 1 783 9 view .LVU1234
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL509:
+	.loc 1 784 9 is_stmt 1 view .LVU1235
+# console.c:784:         return false;
+	.loc 1 784 16 is_stmt 0 view .LVU1236
+	movl	$0, %ebx	#, <retval>
+.LVL510:
+.L322:
+# console.c:810: }
+	.loc 1 810 1 view .LVU1237
+	movl	%ebx, %eax	# <retval>,
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL511:
+.L325:
+	.cfi_restore_state
+	.loc 1 787 9 is_stmt 1 view .LVU1238
+	movq	8(%r12), %rdx	# MEM[(char * *)argv_24(D) + 8B], MEM[(char * *)argv_24(D) + 8B]
+	leaq	.LC90(%rip), %rsi	#, tmp105
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL512:
+	.loc 1 788 9 view .LVU1239
+# console.c:788:         return false;
+	.loc 1 788 16 is_stmt 0 view .LVU1240
+	movl	$0, %ebx	#, <retval>
+	jmp	.L322	#
+.L336:
+.LBB63:
+	.loc 1 792 9 is_stmt 1 view .LVU1241
+	.loc 1 793 9 view .LVU1242
+# console.c:793:         bool ok = parse_block(&body, 0);
+	.loc 1 793 19 is_stmt 0 view .LVU1243
+	movq	%rsp, %rdi	#, tmp110
+	movl	$0, %esi	#,
+	call	parse_block	#
+.LVL513:
+	movl	%eax, %ebx	# tmp123, <retval>
+.LVL514:
+	.loc 1 794 9 is_stmt 1 view .LVU1244
+# console.c:794:         if (ok)
+	.loc 1 794 12 is_stmt 0 view .LVU1245
+	testb	%al, %al	# <retval>
+	jne	.L337	#,
+.L328:
+	.loc 1 796 9 is_stmt 1 view .LVU1246
+	movq	(%rsp), %rdi	# body,
+	call	free_steps	#
+.LVL515:
+	.loc 1 797 9 view .LVU1247
+	jmp	.L322	#
+.LVL516:
+.L337:
+	.loc 1 795 13 view .LVU1248
+# console.c:795:             ok = run_steps(body, reps);
+	.loc 1 795 18 is_stmt 0 view .LVU1249
+	movl	%r15d, %esi	# reps.1_4,
+	movq	(%rsp), %rdi	# body,
+	call	run_steps	#
+.LVL517:
+	.loc 1 795 18 view .LVU1250
+	movl	%eax, %ebx	# tmp124, <retval>
+.LVL518:
+	.loc 1 795 18 view .LVU1251
+	jmp	.L328	#
+.LVL519:
+.L329:
+	.loc 1 795 18 view .LVU1252
+.LBE63:
+	.loc 1 803 9 is_stmt 1 view .LVU1253
+	movq	%rbp, %rdx	# _10,
+	leaq	.LC25(%rip), %rsi	#, tmp114
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL520:
+	.loc 1 803 9 is_stmt 0 view .LVU1254
+	call	report@PLT	#
+.LVL521:
+	.loc 1 804 9 is_stmt 1 view .LVU1255
+# console.c:804:         return false;
+	.loc 1 804 16 is_stmt 0 view .LVU1256
+	movl	$0, %ebx	#, <retval>
+	jmp	.L322	#
+	.cfi_endproc
+.LFE55:
+	.size	do_repeat_cmd, .-do_repeat_cmd
+	.section	.rodata.str1.8
+	.align 8
+.LC92:
+	.string	"No value given for parameter %s"
+	.section	.rodata.str1.1
+.LC93:
+	.string	"Cannot parse '%s' as integer"
+.LC94:
+	.string	"Unknown parameter '%s'"
+	.text
+	.type	do_option_cmd, @function
+do_option_cmd:
+.LVL522:
+.LFB48:
+	.loc 1 578 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 578 1 is_stmt 0 view .LVU1258
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 80
+	.loc 1 579 5 is_stmt 1 view .LVU1259
+# console.c:579:     if (argc == 1) {
+	.loc 1 579 8 is_stmt 0 view .LVU1260
+	cmpl	$1, %edi	#, argc
+	je	.L356	#,
+.LVL523:
+.LBB64:
+	.loc 1 590 23 is_stmt 1 view .LVU1261
+	jle	.L351	#,
+.LBB65:
+	.loc 1 591 9 view .LVU1262
+# console.c:591:         char *name = argv[i];
+	.loc 1 591 15 is_stmt 0 view .LVU1263
+	movq	8(%rsi), %r13	# MEM[(char * *)argv_28(D) + 8B], name
+.LVL524:
+	.loc 1 592 9 is_stmt 1 view .LVU1264
+# console.c:592:         int value = 0;
+	.loc 1 592 13 is_stmt 0 view .LVU1265
+	movl	$0, 12(%rsp)	#, value
+	.loc 1 593 9 is_stmt 1 view .LVU1266
+.LVL525:
+	.loc 1 595 9 view .LVU1267
+# console.c:595:         if (i + 1 >= argc) {
+	.loc 1 595 12 is_stmt 0 view .LVU1268
+	cmpl	$2, %edi	#, argc
+	jle	.L348	#,
+	leaq	16(%rsi), %rbx	#, ivtmp.299
+	leal	-3(%rdi), %eax	#, tmp122
+	shrl	%eax	# tmp123
+	movl	%eax, %eax	# tmp123, tmp124
+	salq	$4, %rax	#, tmp125
+	leaq	32(%rsi,%rax), %r15	#, _67
+	leal	-2(%rdi), %r12d	#, tmp127
+	shrl	%r12d	# tmp128
+	movl	%r12d, %r12d	# tmp128, tmp129
+	salq	$4, %r12	#, tmp130
+	addq	%rbx, %r12	# ivtmp.299, _75
+	jmp	.L342	#
+.LVL526:
+.L356:
+	.loc 1 595 12 view .LVU1269
+.LBE65:
+.LBE64:
+.LBB71:
+	.loc 1 580 9 is_stmt 1 view .LVU1270
+# console.c:580:         param_ptr plist = param_list;
+	.loc 1 580 19 is_stmt 0 view .LVU1271
+	movq	param_list(%rip), %rbx	# param_list, plist
+.LVL527:
+	.loc 1 581 9 is_stmt 1 view .LVU1272
+	leaq	.LC14(%rip), %rsi	#, tmp115
+.LVL528:
+	.loc 1 581 9 is_stmt 0 view .LVU1273
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL529:
+	.loc 1 582 9 is_stmt 1 view .LVU1274
+	.loc 1 582 16 view .LVU1275
+	testq	%rbx, %rbx	# plist
+	je	.L350	#,
+# console.c:583:             report(1, "\t%s\t%d\t%s", plist->name, *plist->valp,
+	.loc 1 583 13 is_stmt 0 view .LVU1276
+	leaq	.LC15(%rip), %rbp	#, tmp120
+.L341:
+	.loc 1 583 13 is_stmt 1 view .LVU1277
+	movq	8(%rbx), %rax	# plist_57->valp, plist_57->valp
+	movl	(%rax), %ecx	# *_2, *_2
+	movq	(%rbx), %rdx	# plist_57->name, plist_57->name
+	movq	16(%rbx), %r8	# plist_57->documentation,
+	movq	%rbp, %rsi	# tmp120,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL530:
+	.loc 1 585 13 view .LVU1278
+# console.c:585:             plist = plist->next;
+	.loc 1 585 19 is_stmt 0 view .LVU1279
+	movq	32(%rbx), %rbx	# plist_57->next, plist
+.LVL531:
+	.loc 1 582 16 is_stmt 1 view .LVU1280
+	testq	%rbx, %rbx	# plist
+	jne	.L341	#,
+# console.c:587:         return true;
+	.loc 1 587 16 is_stmt 0 view .LVU1281
+	movl	$1, %ebp	#, <retval>
+	jmp	.L338	#
+.LVL532:
+.L348:
+	.loc 1 587 16 view .LVU1282
+.LBE71:
+.LBB72:
+.LBB68:
+	.loc 1 596 13 is_stmt 1 view .LVU1283
+	movq	%r13, %rdx	# name,
+	leaq	.LC92(%rip), %rsi	#, tmp121
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL533:
+	.loc 1 597 13 view .LVU1284
+.L343:
+# console.c:597:             return false;
+	.loc 1 597 20 is_stmt 0 discriminator 1 view .LVU1285
+	movl	$0, %ebp	#, <retval>
+.LVL534:
+.L338:
+	.loc 1 597 20 discriminator 1 view .LVU1286
+.LBE68:
+.LBE72:
+# console.c:619: }
+	.loc 1 619 1 view .LVU1287
+	movl	%ebp, %eax	# <retval>,
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL535:
+.L357:
+	.cfi_restore_state
+.LBB73:
+.LBB69:
+	.loc 1 599 13 is_stmt 1 view .LVU1288
+	movq	(%rbx), %rdx	# *_11, *_11
+	leaq	.LC93(%rip), %rsi	#, tmp135
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL536:
+	.loc 1 600 13 view .LVU1289
+# console.c:600:             return false;
+	.loc 1 600 20 is_stmt 0 view .LVU1290
+	jmp	.L343	#
+.LVL537:
+.L358:
+	.loc 1 612 9 is_stmt 1 view .LVU1291
+	.loc 1 613 13 view .LVU1292
+	movq	%r13, %rdx	# name,
+	leaq	.LC94(%rip), %rsi	#, tmp137
+	movl	$1, %edi	#,
+	call	report@PLT	#
+.LVL538:
+	.loc 1 614 13 view .LVU1293
+# console.c:614:             return false;
+	.loc 1 614 20 is_stmt 0 view .LVU1294
+	jmp	.L343	#
+.LVL539:
+.L359:
+.LBB66:
+	.loc 1 608 17 is_stmt 1 view .LVU1295
+	call	*%rax	# _17
+.LVL540:
+.L346:
+	.loc 1 609 13 view .LVU1296
+	.loc 1 609 13 is_stmt 0 view .LVU1297
+.LBE66:
+	.loc 1 612 9 is_stmt 1 view .LVU1298
+.LBE69:
+	.loc 1 590 32 view .LVU1299
+	.loc 1 590 23 view .LVU1300
+	cmpq	%r12, %rbx	# _75, ivtmp.299
+	je	.L338	#,
+.LBB70:
+	.loc 1 591 9 view .LVU1301
+# console.c:591:         char *name = argv[i];
+	.loc 1 591 15 is_stmt 0 view .LVU1302
+	movq	8(%r14), %r13	# MEM[(char * *)_11 + 8B], name
+.LVL541:
+	.loc 1 592 9 is_stmt 1 view .LVU1303
+# console.c:592:         int value = 0;
+	.loc 1 592 13 is_stmt 0 view .LVU1304
+	movl	$0, 12(%rsp)	#, value
+	.loc 1 593 9 is_stmt 1 view .LVU1305
+.LVL542:
+	.loc 1 595 9 view .LVU1306
+# console.c:595:         if (i + 1 >= argc) {
+	.loc 1 595 12 is_stmt 0 view .LVU1307
+	addq	$16, %rbx	#, ivtmp.299
+.LVL543:
+	.loc 1 595 12 view .LVU1308
+	cmpq	%r15, %rbx	# _67, ivtmp.299
+	je	.L348	#,
+.LVL544:
+.L342:
+	.loc 1 598 16 is_stmt 1 view .LVU1309
+# console.c:598:         } else if (!get_int(argv[++i], &value)) {
+	.loc 1 598 33 is_stmt 0 view .LVU1310
+	movq	%rbx, %r14	# ivtmp.299, _11
+# console.c:598:         } else if (!get_int(argv[++i], &value)) {
+	.loc 1 598 21 view .LVU1311
+	leaq	12(%rsp), %rsi	#, tmp132
+	movq	(%rbx), %rdi	# MEM[(char * *)_11], MEM[(char * *)_11]
+	call	get_int	#
+.LVL545:
+	movl	%eax, %ebp	# tmp143, <retval>
+# console.c:598:         } else if (!get_int(argv[++i], &value)) {
+	.loc 1 598 19 view .LVU1312
+	testb	%al, %al	# <retval>
+	je	.L357	#,
+	.loc 1 603 9 is_stmt 1 view .LVU1313
+# console.c:603:         param_ptr plist = table_find(&param_table, name);
+	.loc 1 603 27 is_stmt 0 view .LVU1314
+	movq	%r13, %rsi	# name,
+	leaq	param_table(%rip), %rdi	#,
+	call	table_find	#
+.LVL546:
+	.loc 1 604 9 is_stmt 1 view .LVU1315
+# console.c:604:         if (plist) {
+	.loc 1 604 12 is_stmt 0 view .LVU1316
+	testq	%rax, %rax	# plist
+	je	.L358	#,
+.LBB67:
+	.loc 1 605 13 is_stmt 1 view .LVU1317
+# console.c:605:             int oldval = *plist->valp;
+	.loc 1 605 32 is_stmt 0 view .LVU1318
+	movq	8(%rax), %rdx	# plist_32->valp, _15
+# console.c:605:             int oldval = *plist->valp;
+	.loc 1 605 17 view .LVU1319
+	movl	(%rdx), %edi	# *_15, oldval
+.LVL547:
+	.loc 1 606 13 is_stmt 1 view .LVU1320
+# console.c:606:             *plist->valp = value;
+	.loc 1 606 26 is_stmt 0 view .LVU1321
+	movl	12(%rsp), %ecx	# value, value
+	movl	%ecx, (%rdx)	# value, *_15
+	.loc 1 607 13 is_stmt 1 view .LVU1322
+# console.c:607:             if (plist->setter)
+	.loc 1 607 22 is_stmt 0 view .LVU1323
+	movq	24(%rax), %rax	# plist_32->setter, _17
+.LVL548:
+# console.c:607:             if (plist->setter)
+	.loc 1 607 16 view .LVU1324
+	testq	%rax, %rax	# _17
+	jne	.L359	#,
+	jmp	.L346	#
+.LVL549:
+.L350:
+	.loc 1 607 16 view .LVU1325
+.LBE67:
+.LBE70:
+.LBE73:
+.LBB74:
+# console.c:587:         return true;
+	.loc 1 587 16 view .LVU1326
+	movl	$1, %ebp	#, <retval>
+	jmp	.L338	#
+.LVL550:
+.L351:
+	.loc 1 587 16 view .LVU1327
+.LBE74:
+# console.c:618:     return true;
+	.loc 1 618 12 view .LVU1328
+	movl	$1, %ebp	#, <retval>
+	jmp	.L338	#
+	.cfi_endproc
+.LFE48:
+	.size	do_option_cmd, .-do_option_cmd
+	.globl	cmd_select
+	.type	cmd_select, @function
+cmd_select:
+.LVL551:
+.LFB65:
+	.loc 1 997 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 997 1 is_stmt 0 view .LVU1330
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$152, %rsp	#,
+	.cfi_def_cfa_offset 208
+	movl	%edi, %r13d	# tmp145, nfds
+	movq	%rsi, %rbp	# tmp146, readfds
+	movq	%rdx, 8(%rsp)	# tmp147, %sfp
+	movq	%rcx, %r14	# tmp148, exceptfds
+	movq	%r8, %r15	# tmp149, timeout
+	.loc 1 998 5 is_stmt 1 view .LVU1331
+	.loc 1 999 5 view .LVU1332
+	.loc 1 1000 5 view .LVU1333
+	.loc 1 1001 5 view .LVU1334
+# console.c:1001:     while (!block_flag && read_ready()) {
+	.loc 1 1001 11 is_stmt 0 view .LVU1335
+	jmp	.L361	#
+.LVL552:
+.L363:
+.LBB79:
+.LBB80:
+	.loc 1 974 5 is_stmt 1 view .LVU1336
+# console.c:974:     return buf_stack && find_newline(buf_stack);
+	.loc 1 974 25 is_stmt 0 view .LVU1337
+	movq	%rbx, %rdi	# buf_stack.65_60,
+	call	find_newline	#
+.LVL553:
+.LBE80:
+.LBE79:
+# console.c:1001:     while (!block_flag && read_ready()) {
+	.loc 1 1001 24 view .LVU1338
+	testq	%rax, %rax	# tmp151
+	je	.L362	#,
+.L364:
+	.loc 1 1002 9 is_stmt 1 view .LVU1339
+# console.c:1002:         cmdline = readline();
+	.loc 1 1002 19 is_stmt 0 view .LVU1340
+	movl	$0, %eax	#,
+	call	readline	#
+.LVL554:
+	movq	%rax, %rdi	# tmp150, cmdline
+.LVL555:
+	.loc 1 1003 9 is_stmt 1 view .LVU1341
+	call	interpret_cmd	#
+.LVL556:
+	.loc 1 1004 9 view .LVU1342
+# console.c:1004:         prompt_flag = true;
+	.loc 1 1004 21 is_stmt 0 view .LVU1343
+	movb	$1, prompt_flag(%rip)	#, prompt_flag
+.LVL557:
+.L361:
+	.loc 1 1001 24 is_stmt 1 view .LVU1344
+.LBB82:
+.LBI79:
+	.loc 1 970 13 view .LVU1345
+.LBB81:
+	.loc 1 972 5 view .LVU1346
+# console.c:972:     if (buf_stack && buf_stack->map)
+	.loc 1 972 9 is_stmt 0 view .LVU1347
+	movq	buf_stack(%rip), %rbx	# buf_stack, buf_stack.65_60
+# console.c:972:     if (buf_stack && buf_stack->map)
+	.loc 1 972 8 view .LVU1348
+	testq	%rbx, %rbx	# buf_stack.65_60
+	je	.L362	#,
+# console.c:972:     if (buf_stack && buf_stack->map)
+	.loc 1 972 19 view .LVU1349
+	cmpq	$0, 65568(%rbx)	#, buf_stack.65_60->map
+	je	.L363	#,
+	.loc 1 973 9 is_stmt 1 view .LVU1350
+.LBE81:
+.LBE82:
+# console.c:1001:     while (!block_flag && read_ready()) {
+	.loc 1 1001 24 is_stmt 0 view .LVU1351
+	movq	65576(%rbx), %rax	# buf_stack.65_60->map_end, tmp155
+	cmpq	%rax, 16(%rbx)	# tmp155, buf_stack.65_60->bufptr
+	jb	.L364	#,
+	jmp	.L365	#
+.L362:
+	.loc 1 1007 5 is_stmt 1 view .LVU1352
+.LBB83:
+.LBI83:
+	.loc 1 977 13 view .LVU1353
+.LBB84:
+	.loc 1 979 5 view .LVU1354
+.LBE84:
+.LBE83:
+# console.c:1008:         return 0;
+	.loc 1 1008 16 is_stmt 0 view .LVU1355
+	movl	$0, %r12d	#, <retval>
+.LBB86:
+.LBB85:
+# console.c:979:     return !buf_stack || quit_flag;
+	.loc 1 979 23 view .LVU1356
+	testq	%rbx, %rbx	# buf_stack.65_60
+	je	.L360	#,
+.L365:
+.LBE85:
+.LBE86:
+# console.c:1007:     if (cmd_done())
+	.loc 1 1007 8 view .LVU1357
+	cmpb	$0, quit_flag(%rip)	#, quit_flag
+	jne	.L371	#,
+	.loc 1 1010 5 is_stmt 1 view .LVU1358
+	.loc 1 1012 9 view .LVU1359
+# console.c:1013:             readfds = &local_readset;
+	.loc 1 1013 21 is_stmt 0 view .LVU1360
+	leaq	16(%rsp), %rax	#, tmp141
+	testq	%rbp, %rbp	# readfds
+	cmove	%rax, %rbp	# tmp141,, readfds
+.LVL558:
+	.loc 1 1016 9 is_stmt 1 view .LVU1361
+# console.c:1016:         infd = buf_stack->fd;
+	.loc 1 1016 14 is_stmt 0 view .LVU1362
+	movl	(%rbx), %ebx	# buf_stack.65_60->fd, infd
+.LVL559:
+	.loc 1 1017 9 is_stmt 1 view .LVU1363
+	leal	63(%rbx), %eax	#, tmp117
+	testl	%ebx, %ebx	# infd
+	cmovns	%ebx, %eax	# tmp117,, infd, infd
+	sarl	$6, %eax	#, tmp118
+	cltq
+	movl	$1, %edx	#, tmp122
+	movl	%ebx, %ecx	# infd, tmp156
+	salq	%cl, %rdx	# tmp156, tmp121
+	orq	%rdx, 0(%rbp,%rax,8)	# tmp121, readfds_24->__fds_bits[_41]
+	.loc 1 1018 9 view .LVU1364
+# console.c:1018:         if (infd == STDIN_FILENO && prompt_flag) {
+	.loc 1 1018 12 is_stmt 0 view .LVU1365
+	testl	%ebx, %ebx	# infd
+	jne	.L368	#,
+# console.c:1018:         if (infd == STDIN_FILENO && prompt_flag) {
+	.loc 1 1018 34 discriminator 1 view .LVU1366
+	cmpb	$0, prompt_flag(%rip)	#, prompt_flag
+	jne	.L375	#,
+.L368:
+	.loc 1 1025 9 is_stmt 1 view .LVU1367
+# console.c:1026:             nfds = infd + 1;
+	.loc 1 1026 18 is_stmt 0 view .LVU1368
+	leal	1(%rbx), %r12d	#, tmp143
+	cmpl	%ebx, %r13d	# infd, nfds
+	cmovg	%r13d, %r12d	# tmp143,, nfds, <retval>
+.LVL560:
+	.loc 1 1028 5 is_stmt 1 view .LVU1369
+# console.c:1028:     if (nfds == 0)
+	.loc 1 1028 8 is_stmt 0 view .LVU1370
+	testl	%r12d, %r12d	# <retval>
+	jne	.L376	#,
+.LVL561:
+.L360:
+# console.c:1045: }
+	.loc 1 1045 1 view .LVU1371
+	movl	%r12d, %eax	# <retval>,
+	addq	$152, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL562:
+	.loc 1 1045 1 view .LVU1372
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL563:
+	.loc 1 1045 1 view .LVU1373
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL564:
+	.loc 1 1045 1 view .LVU1374
+	ret	
+.LVL565:
+.L375:
+	.cfi_restore_state
+	.loc 1 1019 13 is_stmt 1 view .LVU1375
+	movl	$0, %eax	#,
+	call	report_flush@PLT	#
+.LVL566:
+	.loc 1 1020 13 view .LVU1376
+	leaq	.LC18(%rip), %rsi	#, tmp126
+	leaq	.LC19(%rip), %rdi	#, tmp127
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL567:
+	.loc 1 1021 13 view .LVU1377
+	movq	stdout(%rip), %rdi	# stdout,
+	call	fflush@PLT	#
+.LVL568:
+	.loc 1 1022 13 view .LVU1378
+# console.c:1022:             prompt_flag = true;
+	.loc 1 1022 25 is_stmt 0 view .LVU1379
+	movb	$1, prompt_flag(%rip)	#, prompt_flag
+	jmp	.L368	#
+.LVL569:
+.L376:
+	.loc 1 1031 5 is_stmt 1 view .LVU1380
+# console.c:1031:     int result = select(nfds, readfds, writefds, exceptfds, timeout);
+	.loc 1 1031 18 is_stmt 0 view .LVU1381
+	movq	%r15, %r8	# timeout,
+	movq	%r14, %rcx	# exceptfds,
+	movq	8(%rsp), %rdx	# %sfp,
+	movq	%rbp, %rsi	# readfds,
+	movl	%r12d, %edi	# <retval>,
+	call	select@PLT	#
+.LVL570:
+	movl	%eax, %r12d	# tmp152, <retval>
+.LVL571:
+	.loc 1 1032 5 is_stmt 1 view .LVU1382
+# console.c:1032:     if (result <= 0)
+	.loc 1 1032 8 is_stmt 0 view .LVU1383
+	testl	%eax, %eax	# <retval>
+	jle	.L360	#,
+	.loc 1 1035 5 is_stmt 1 view .LVU1384
+# console.c:1035:     infd = buf_stack->fd;
+	.loc 1 1035 10 is_stmt 0 view .LVU1385
+	movq	buf_stack(%rip), %rax	# buf_stack, buf_stack
+.LVL572:
+	.loc 1 1035 10 view .LVU1386
+	movl	(%rax), %ecx	# buf_stack.64_14->fd, infd
+.LVL573:
+	.loc 1 1036 5 is_stmt 1 view .LVU1387
+# console.c:1036:     if (readfds && FD_ISSET(infd, readfds)) {
+	.loc 1 1036 20 is_stmt 0 view .LVU1388
+	leal	63(%rcx), %eax	#, tmp131
+	testl	%ecx, %ecx	# infd
+	cmovns	%ecx, %eax	# tmp131,, infd, infd
+	sarl	$6, %eax	#, tmp132
+	movslq	%eax, %rdx	# tmp132, _15
+	movq	0(%rbp,%rdx,8), %rsi	# readfds_24->__fds_bits[_15], _16
+	movl	$1, %edx	#, tmp135
+	salq	%cl, %rdx	# infd, _19
+# console.c:1036:     if (readfds && FD_ISSET(infd, readfds)) {
+	.loc 1 1036 17 view .LVU1389
+	testq	%rdx, %rsi	# _19, _16
+	je	.L360	#,
+	.loc 1 1038 9 is_stmt 1 view .LVU1390
+	cltq
+	notq	%rdx	# tmp138
+	andq	%rsi, %rdx	# _16, tmp139
+	movq	%rdx, 0(%rbp,%rax,8)	# tmp139, readfds_24->__fds_bits[_15]
+	.loc 1 1039 9 view .LVU1391
+# console.c:1039:         result--;
+	.loc 1 1039 15 is_stmt 0 view .LVU1392
+	subl	$1, %r12d	#, <retval>
+.LVL574:
+	.loc 1 1040 9 is_stmt 1 view .LVU1393
+# console.c:1040:         cmdline = readline();
+	.loc 1 1040 19 is_stmt 0 view .LVU1394
+	movl	$0, %eax	#,
+	call	readline	#
+.LVL575:
+	.loc 1 1041 9 is_stmt 1 view .LVU1395
+# console.c:1041:         if (cmdline)
+	.loc 1 1041 12 is_stmt 0 view .LVU1396
+	testq	%rax, %rax	# cmdline
+	je	.L360	#,
+	.loc 1 1042 13 is_stmt 1 view .LVU1397
+	movq	%rax, %rdi	# cmdline,
+	call	interpret_cmd	#
+.LVL576:
+	.loc 1 1042 13 is_stmt 0 view .LVU1398
+	jmp	.L360	#
+.LVL577:
+.L371:
+# console.c:1008:         return 0;
+	.loc 1 1008 16 view .LVU1399
+	movl	$0, %r12d	#, <retval>
+	jmp	.L360	#
+	.cfi_endproc
+.LFE65:
+	.size	cmd_select, .-cmd_select
+	.globl	finish_cmd
+	.type	finish_cmd, @function
+finish_cmd:
+.LFB66:
+	.loc 1 1048 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1049 5 view .LVU1401
+.LVL578:
+	.loc 1 1050 5 view .LVU1402
+# console.c:1050:     if (!quit_flag)
+	.loc 1 1050 8 is_stmt 0 view .LVU1403
+	cmpb	$0, quit_flag(%rip)	#, quit_flag
+	je	.L386	#,
+.LVL579:
+# console.c:1052:     return ok && err_cnt == 0;
+	.loc 1 1052 15 view .LVU1404
+	cmpl	$0, err_cnt(%rip)	#, err_cnt
+	sete	%al	#, iftmp.79_4
+	movzbl	%al, %eax	# iftmp.79_4, iftmp.79_4
+	andl	$1, %eax	#, iftmp.79_4
+# console.c:1053: }
+	.loc 1 1053 1 view .LVU1405
+	ret	
+.LVL580:
+.L386:
+# console.c:1048: {
+	.loc 1 1048 1 discriminator 1 view .LVU1406
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 1051 9 is_stmt 1 discriminator 1 view .LVU1407
+# console.c:1051:         ok = ok && do_quit_cmd(0, NULL);
+	.loc 1 1051 20 is_stmt 0 discriminator 1 view .LVU1408
+	movl	$0, %esi	#,
+	movl	$0, %edi	#,
+	call	do_quit_cmd	#
+.LVL581:
+	movl	%eax, %edx	#, tmp91
+# console.c:1052:     return ok && err_cnt == 0;
+	.loc 1 1052 15 discriminator 1 view .LVU1409
+	movl	$0, %eax	#, iftmp.79_4
+# console.c:1051:         ok = ok && do_quit_cmd(0, NULL);
+	.loc 1 1051 17 discriminator 1 view .LVU1410
+	testb	%dl, %dl	# tmp91
+	je	.L379	#,
+.LVL582:
+# console.c:1052:     return ok && err_cnt == 0;
+	.loc 1 1052 15 discriminator 1 view .LVU1411
+	cmpl	$0, err_cnt(%rip)	#, err_cnt
+	sete	%al	#, iftmp.79_4
+	movzbl	%al, %eax	# iftmp.79_4, iftmp.79_4
+.L379:
+# console.c:1052:     return ok && err_cnt == 0;
+	.loc 1 1052 15 discriminator 6 view .LVU1412
+	andl	$1, %eax	#, iftmp.79_4
+# console.c:1053: }
+	.loc 1 1053 1 discriminator 6 view .LVU1413
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE66:
+	.size	finish_cmd, .-finish_cmd
+	.section	.rodata.str1.8
+	.align 8
+.LC95:
+	.string	"ERROR: Could not open source file '%s'"
+	.text
+	.globl	run_console
+	.type	run_console, @function
+run_console:
+.LVL583:
+.LFB67:
+	.loc 1 1056 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1056 1 is_stmt 0 view .LVU1415
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp	# tmp90, infile_name
+	.loc 1 1057 5 is_stmt 1 view .LVU1416
+# console.c:1057:     if (!push_file(infile_name)) {
+	.loc 1 1057 10 is_stmt 0 view .LVU1417
+	call	push_file	#
+.LVL584:
+# console.c:1057:     if (!push_file(infile_name)) {
+	.loc 1 1057 8 view .LVU1418
+	testb	%al, %al	# <retval>
+	jne	.L388	#,
+	movl	%eax, %ebx	# tmp91, <retval>
+	.loc 1 1058 9 is_stmt 1 view .LVU1419
+	movq	%rbp, %rdx	# infile_name,
+	leaq	.LC95(%rip), %rsi	#, tmp87
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL585:
+	.loc 1 1059 9 view .LVU1420
+# console.c:1059:         return false;
+	.loc 1 1059 16 is_stmt 0 view .LVU1421
+	jmp	.L387	#
+.L394:
+# console.c:1062:     while (!cmd_done())
+	.loc 1 1062 12 view .LVU1422
+	cmpb	$0, quit_flag(%rip)	#, quit_flag
+	jne	.L390	#,
+	.loc 1 1063 9 is_stmt 1 view .LVU1423
+	movl	$0, %r8d	#,
+	movl	$0, %ecx	#,
+	movl	$0, %edx	#,
+	movl	$0, %esi	#,
+	movl	$0, %edi	#,
+	call	cmd_select	#
+.LVL586:
+.L388:
+	.loc 1 1062 12 view .LVU1424
+.LBB89:
+.LBI89:
+	.loc 1 977 13 view .LVU1425
+.LBB90:
+	.loc 1 979 5 view .LVU1426
+# console.c:979:     return !buf_stack || quit_flag;
+	.loc 1 979 23 is_stmt 0 view .LVU1427
+	cmpq	$0, buf_stack(%rip)	#, buf_stack
+	jne	.L394	#,
+.L390:
+.LBE90:
+.LBE89:
+	.loc 1 1064 5 is_stmt 1 view .LVU1428
+# console.c:1064:     return err_cnt == 0;
+	.loc 1 1064 20 is_stmt 0 view .LVU1429
+	cmpl	$0, err_cnt(%rip)	#, err_cnt
+	sete	%bl	#, <retval>
+.L387:
+# console.c:1065: }
+	.loc 1 1065 1 view .LVU1430
+	movl	%ebx, %eax	# <retval>,
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL587:
+	.loc 1 1065 1 view .LVU1431
+	ret	
+	.cfi_endproc
+.LFE67:
+	.size	run_console, .-run_console
+	.section	.rodata.str1.1
+.LC96:
+	.string	"wb"
+	.section	.rodata.str1.8
+	.align 8
+.LC97:
+	.string	"Couldn't open output file '%s'"
+	.section	.rodata.str1.1
+.LC98:
+	.string	"compile_file"
+.LC99:
+	.string	"intern"
+.LC100:
+	.string	"Error writing '%s'"
+	.section	.rodata.str1.8
+	.align 8
+.LC101:
+	.string	"Compiled %lu commands, %u distinct strings"
+	.text
+	.globl	compile_file
+	.type	compile_file, @function
+compile_file:
+.LVL588:
+.LFB69:
+	.loc 1 1112 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1112 1 is_stmt 0 view .LVU1433
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$392, %rsp	#,
+	.cfi_def_cfa_offset 448
+	movq	%rdi, %rbx	# tmp216, infile_name
+	movq	%rsi, %r13	# tmp217, outfile_name
+	.loc 1 1113 5 is_stmt 1 view .LVU1434
+# console.c:1113:     FILE *out = fopen(outfile_name, "wb");
+	.loc 1 1113 17 is_stmt 0 view .LVU1435
+	leaq	.LC96(%rip), %rsi	#, tmp148
+.LVL589:
+	.loc 1 1113 17 view .LVU1436
+	movq	%r13, %rdi	# outfile_name,
+.LVL590:
+	.loc 1 1113 17 view .LVU1437
+	call	fopen@PLT	#
+.LVL591:
+	.loc 1 1114 5 is_stmt 1 view .LVU1438
+# console.c:1114:     if (!out) {
+	.loc 1 1114 8 is_stmt 0 view .LVU1439
+	testq	%rax, %rax	# out
+	je	.L430	#,
+	movq	%rax, %r15	# tmp218, out
+	.loc 1 1118 5 is_stmt 1 view .LVU1440
+# console.c:1118:     if (!push_file(infile_name)) {
+	.loc 1 1118 10 is_stmt 0 view .LVU1441
+	movq	%rbx, %rdi	# infile_name,
+	call	push_file	#
+.LVL592:
+	.loc 1 1118 10 view .LVU1442
+	movb	%al, 38(%rsp)	# <retval>, %sfp
+# console.c:1118:     if (!push_file(infile_name)) {
+	.loc 1 1118 8 view .LVU1443
+	testb	%al, %al	# <retval>
+	je	.L431	#,
+	.loc 1 1124 5 is_stmt 1 view .LVU1444
+	.loc 1 1125 5 view .LVU1445
+	leaq	352(%rsp), %rdi	#, tmp152
+	pxor	%xmm0, %xmm0	# tmp155
+	movups	%xmm0, 356(%rsp)	# tmp155, MEM <char[1:20]> [(void *)&header + 4B]
+	movl	$0, 372(%rsp)	#, MEM <char[1:20]> [(void *)&header + 4B]
+	.loc 1 1126 5 view .LVU1446
+	movl	$826491473, 352(%rsp)	#, MEM <unsigned char[4]> [(char * {ref-all})&header]
+	.loc 1 1127 5 view .LVU1447
+	movq	%r15, %rcx	# out,
+	movl	$1, %edx	#,
+	movl	$24, %esi	#,
+	call	fwrite@PLT	#
+.LVL593:
+	.loc 1 1129 5 view .LVU1448
+# console.c:1129:     name_table_t interned = {NULL, 0, 0};
+	.loc 1 1129 18 is_stmt 0 view .LVU1449
+	movq	$0, 320(%rsp)	#, interned.slots
+	movq	$0, 328(%rsp)	#, interned.size
+	movq	$0, 336(%rsp)	#, interned.cnt
+	.loc 1 1130 5 is_stmt 1 view .LVU1450
+.LVL594:
+	.loc 1 1131 5 view .LVU1451
+	.loc 1 1132 5 view .LVU1452
+	.loc 1 1133 5 view .LVU1453
+# console.c:1133:     bool save_echo = echo;
+	.loc 1 1133 10 is_stmt 0 view .LVU1454
+	movzbl	echo(%rip), %ebp	# echo, save_echo
+.LVL595:
+	.loc 1 1134 5 is_stmt 1 view .LVU1455
+# console.c:1134:     echo = false;
+	.loc 1 1134 10 is_stmt 0 view .LVU1456
+	movb	$0, echo(%rip)	#, echo
+	.loc 1 1136 5 is_stmt 1 view .LVU1457
+	.loc 1 1136 12 view .LVU1458
+	movq	buf_stack(%rip), %r14	# buf_stack, strings
+	testq	%r14, %r14	# strings
+	je	.L421	#,
+# console.c:1131:     size_t cap = 0;
+	.loc 1 1131 12 is_stmt 0 view .LVU1459
+	movq	$0, 16(%rsp)	#, %sfp
+# console.c:1130:     char **strings = NULL;
+	.loc 1 1130 12 view .LVU1460
+	movl	$0, %r14d	#, strings
+.LBB99:
+# console.c:1158:                    !table_find(&cmd_table, argv[0])) {
+	.loc 1 1158 21 view .LVU1461
+	movb	%bpl, 39(%rsp)	# save_echo, %sfp
+	movq	%r14, 8(%rsp)	# strings, %sfp
+	movq	%r13, 40(%rsp)	# outfile_name, %sfp
+	jmp	.L413	#
+.LVL596:
+.L430:
+	.loc 1 1158 21 view .LVU1462
+.LBE99:
+	.loc 1 1115 9 is_stmt 1 view .LVU1463
+	movq	%r13, %rdx	# outfile_name,
+	leaq	.LC97(%rip), %rsi	#, tmp150
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL597:
+	.loc 1 1115 9 is_stmt 0 view .LVU1464
+	call	report@PLT	#
+.LVL598:
+	.loc 1 1116 9 is_stmt 1 view .LVU1465
+# console.c:1116:         return false;
+	.loc 1 1116 16 is_stmt 0 view .LVU1466
+	movb	$0, 38(%rsp)	#, %sfp
+	jmp	.L395	#
+.LVL599:
+.L431:
+	.loc 1 1119 9 is_stmt 1 view .LVU1467
+	movq	%rbx, %rdx	# infile_name,
+	leaq	.LC35(%rip), %rsi	#, tmp151
+	movl	$1, %edi	#,
+	call	report@PLT	#
+.LVL600:
+	.loc 1 1120 9 view .LVU1468
+	movq	%r15, %rdi	# out,
+	call	fclose@PLT	#
+.LVL601:
+	.loc 1 1121 9 view .LVU1469
+# console.c:1121:         return false;
+	.loc 1 1121 16 is_stmt 0 view .LVU1470
+	jmp	.L395	#
+.LVL602:
+.L435:
+.LBB109:
+	.loc 1 1146 13 is_stmt 1 view .LVU1471
+# console.c:1146:             argv = calloc_or_fail(argc, sizeof(char *), "compile_file");
+	.loc 1 1146 20 is_stmt 0 view .LVU1472
+	movslq	%eax, %rdi	# argc, argc
+	leaq	.LC98(%rip), %rdx	#, tmp160
+	movl	$8, %esi	#,
+	call	calloc_or_fail@PLT	#
+.LVL603:
+	.loc 1 1146 20 view .LVU1473
+	movq	%rax, %r13	# tmp222, argv
+.LVL604:
+	.loc 1 1147 13 is_stmt 1 view .LVU1474
+	movq	%rax, %rdx	# argv,
+	movq	56(%rsp), %rsi	# end,
+	movq	%rbx, %rdi	# line,
+	call	collect_args	#
+.LVL605:
+	.loc 1 1150 9 view .LVU1475
+.L402:
+# console.c:1152:         } else if (argc >= 2 && strcmp(argv[0], "source") == 0) {
+	.loc 1 1152 33 is_stmt 0 discriminator 1 view .LVU1476
+	movq	0(%r13), %rdi	# *argv_178, *argv_178
+	leaq	.LC45(%rip), %rsi	#, tmp165
+	call	strcmp@PLT	#
+.LVL606:
+# console.c:1152:         } else if (argc >= 2 && strcmp(argv[0], "source") == 0) {
+	.loc 1 1152 30 discriminator 1 view .LVU1477
+	testl	%eax, %eax	# tmp223
+	jne	.L403	#,
+	.loc 1 1153 13 is_stmt 1 view .LVU1478
+# console.c:1153:             if (!push_file(argv[1])) {
+	.loc 1 1153 18 is_stmt 0 view .LVU1479
+	movq	8(%r13), %rdi	# MEM[(char * *)argv_178 + 8B], MEM[(char * *)argv_178 + 8B]
+	call	push_file	#
+.LVL607:
+	movl	%eax, %ebx	# tmp224, _8
+.LVL608:
+# console.c:1153:             if (!push_file(argv[1])) {
+	.loc 1 1153 16 view .LVU1480
+	testb	%al, %al	# _8
+	jne	.L404	#,
+	.loc 1 1154 17 is_stmt 1 view .LVU1481
+	movq	8(%r13), %rdx	# MEM[(char * *)argv_178 + 8B], MEM[(char * *)argv_178 + 8B]
+	leaq	.LC35(%rip), %rsi	#, tmp168
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL609:
+	.loc 1 1155 17 view .LVU1482
+# console.c:1155:                 ok = false;
+	.loc 1 1155 20 is_stmt 0 view .LVU1483
+	movb	%bl, 38(%rsp)	# _8, %sfp
+	jmp	.L404	#
+.LVL610:
+.L436:
+# console.c:1142:         char **argv = stack_argv;
+	.loc 1 1142 16 view .LVU1484
+	leaq	64(%rsp), %r13	#, argv
+.LVL611:
+	.loc 1 1142 16 view .LVU1485
+	jmp	.L402	#
+.LVL612:
+.L437:
+	.loc 1 1160 13 is_stmt 1 view .LVU1486
+	movq	%rbx, %rdx	# _10,
+	leaq	.LC25(%rip), %rsi	#, tmp172
+	movl	$1, %edi	#,
+	call	report@PLT	#
+.LVL613:
+	.loc 1 1161 13 view .LVU1487
+# console.c:1161:             ok = false;
+	.loc 1 1161 16 is_stmt 0 view .LVU1488
+	movb	$0, 38(%rsp)	#, %sfp
+	jmp	.L404	#
+.LVL614:
+.L407:
+.LBB100:
+.LBB101:
+.LBB102:
+.LBB103:
+	.loc 1 1094 5 is_stmt 1 view .LVU1489
+# console.c:1094:     if (*nstringsp == *capp) {
+	.loc 1 1094 9 is_stmt 0 view .LVU1490
+	movl	356(%rsp), %eax	# MEM[(uint32_t *)&header + 4B], MEM[(uint32_t *)&header + 4B]
+.LVL615:
+# console.c:1094:     if (*nstringsp == *capp) {
+	.loc 1 1094 8 view .LVU1491
+	cmpq	%r12, %rax	# cap, MEM[(uint32_t *)&header + 4B]
+	je	.L432	#,
+.LVL616:
+.L409:
+	.loc 1 1104 5 is_stmt 1 view .LVU1492
+# console.c:1104:     char *saved = strsave_or_fail(s, "intern");
+	.loc 1 1104 19 is_stmt 0 view .LVU1493
+	leaq	.LC99(%rip), %rsi	#,
+	movq	%rbp, %rdi	# _17,
+	call	strsave_or_fail@PLT	#
+.LVL617:
+	movq	%rax, %rsi	# tmp229, saved
+.LVL618:
+	.loc 1 1105 5 is_stmt 1 view .LVU1494
+# console.c:1105:     (*stringsp)[*nstringsp] = saved;
+	.loc 1 1105 17 is_stmt 0 view .LVU1495
+	movl	356(%rsp), %eax	# MEM[(uint32_t *)&header + 4B], MEM[(uint32_t *)&header + 4B]
+.LVL619:
+# console.c:1105:     (*stringsp)[*nstringsp] = saved;
+	.loc 1 1105 29 view .LVU1496
+	movq	8(%rsp), %rcx	# %sfp, strings
+	movq	%rsi, (%rcx,%rax,8)	# saved, *_144
+	.loc 1 1106 5 is_stmt 1 view .LVU1497
+# console.c:1106:     id = ++*nstringsp;
+	.loc 1 1106 12 is_stmt 0 view .LVU1498
+	movl	356(%rsp), %ebp	# MEM[(uint32_t *)&header + 4B], _127
+.LVL620:
+# console.c:1106:     id = ++*nstringsp;
+	.loc 1 1106 10 view .LVU1499
+	leal	1(%rbp), %edx	#, _146
+# console.c:1106:     id = ++*nstringsp;
+	.loc 1 1106 8 view .LVU1500
+	movl	%edx, 356(%rsp)	# _146, MEM[(uint32_t *)&header + 4B]
+.LVL621:
+	.loc 1 1107 5 is_stmt 1 view .LVU1501
+# console.c:1106:     id = ++*nstringsp;
+	.loc 1 1106 8 is_stmt 0 view .LVU1502
+	movl	%edx, %edx	# _146, id
+.LVL622:
+# console.c:1107:     table_insert(interned, saved, (void *) id);
+	.loc 1 1107 5 view .LVU1503
+	leaq	320(%rsp), %rdi	#, tmp188
+.LVL623:
+	.loc 1 1107 5 view .LVU1504
+	call	table_insert	#
+.LVL624:
+	.loc 1 1108 5 is_stmt 1 view .LVU1505
+.L408:
+	.loc 1 1108 5 is_stmt 0 view .LVU1506
+.LBE103:
+.LBE102:
+# console.c:1166:                 word = intern(&interned, &strings, &cap, &header.nstrings,
+	.loc 1 1166 22 view .LVU1507
+	movl	%ebp, 52(%rsp)	# _127, word
+	.loc 1 1168 17 is_stmt 1 view .LVU1508
+	leaq	52(%rsp), %rdi	#, tmp189
+	movq	%r15, %rcx	# out,
+	movl	$1, %edx	#,
+	movl	$4, %esi	#,
+	call	fwrite@PLT	#
+.LVL625:
+	.loc 1 1165 40 view .LVU1509
+	.loc 1 1165 31 view .LVU1510
+	addq	$8, %rbx	#, ivtmp.319
+.LVL626:
+	.loc 1 1165 31 is_stmt 0 view .LVU1511
+	cmpq	%rbx, %r14	# ivtmp.319, _44
+	je	.L433	#,
+.LVL627:
+.L411:
+	.loc 1 1166 17 is_stmt 1 discriminator 3 view .LVU1512
+# console.c:1166:                 word = intern(&interned, &strings, &cap, &header.nstrings,
+	.loc 1 1166 24 is_stmt 0 discriminator 3 view .LVU1513
+	movq	(%rbx), %rbp	# MEM[(char * *)_46], _17
+.LVL628:
+.LBB106:
+.LBI102:
+	.loc 1 1084 17 is_stmt 1 discriminator 3 view .LVU1514
+.LBB105:
+	.loc 1 1090 5 discriminator 3 view .LVU1515
+# console.c:1090:     uintptr_t id = (uintptr_t) table_find(interned, s);
+	.loc 1 1090 32 is_stmt 0 discriminator 3 view .LVU1516
+	leaq	320(%rsp), %rdi	#, tmp176
+.LVL629:
+	.loc 1 1090 32 discriminator 3 view .LVU1517
+	movq	%rbp, %rsi	# _17,
+	call	table_find	#
+.LVL630:
+	.loc 1 1091 5 is_stmt 1 discriminator 3 view .LVU1518
+# console.c:1091:     if (id)
+	.loc 1 1091 8 is_stmt 0 discriminator 3 view .LVU1519
+	testq	%rax, %rax	# _124
+	je	.L407	#,
+	.loc 1 1092 9 is_stmt 1 view .LVU1520
+# console.c:1092:         return id - 1;
+	.loc 1 1092 19 is_stmt 0 view .LVU1521
+	leal	-1(%rax), %ebp	#, _127
+.LVL631:
+	.loc 1 1092 19 view .LVU1522
+	jmp	.L408	#
+.LVL632:
+.L432:
+.LBB104:
+	.loc 1 1095 9 is_stmt 1 view .LVU1523
+# console.c:1095:         size_t cap = *capp ? 2 * *capp : 64;
+	.loc 1 1095 40 is_stmt 0 view .LVU1524
+	leaq	(%r12,%r12), %r13	#, tmp209
+	testq	%r12, %r12	# cap
+	movl	$64, %eax	#, tmp210
+	cmove	%rax, %r13	# tmp209,, tmp210, iftmp.92_131
+.LVL633:
+	.loc 1 1096 9 is_stmt 1 view .LVU1525
+# console.c:1096:         char **strings = calloc_or_fail(cap, sizeof(char *), "intern");
+	.loc 1 1096 26 is_stmt 0 view .LVU1526
+	leaq	.LC99(%rip), %rdx	#,
+	movl	$8, %esi	#,
+	movq	%r13, %rdi	# iftmp.92_131,
+	call	calloc_or_fail@PLT	#
+.LVL634:
+	movq	%rax, 16(%rsp)	# strings, %sfp
+.LVL635:
+	.loc 1 1097 9 is_stmt 1 view .LVU1527
+# console.c:1097:         if (*stringsp) {
+	.loc 1 1097 12 is_stmt 0 view .LVU1528
+	movq	8(%rsp), %rcx	# %sfp, strings
+	testq	%rcx, %rcx	# strings
+	je	.L424	#,
+	.loc 1 1098 13 is_stmt 1 view .LVU1529
+	leaq	0(,%r12,8), %rdx	#, tmp179
+	movq	%rcx, %rsi	# strings,
+	movq	%rax, %rdi	# strings,
+	call	memcpy@PLT	#
+.LVL636:
+	.loc 1 1099 13 view .LVU1530
+	movl	$8, %edx	#,
+	movq	%r12, %rsi	# cap,
+	movq	8(%rsp), %rdi	# %sfp,
+	call	free_array@PLT	#
+.LVL637:
+# console.c:1102:         *capp = cap;
+	.loc 1 1102 15 is_stmt 0 view .LVU1531
+	movq	%r13, %r12	# iftmp.92_131, cap
+.LVL638:
+# console.c:1101:         *stringsp = strings;
+	.loc 1 1101 19 view .LVU1532
+	movq	16(%rsp), %rax	# %sfp, strings
+	movq	%rax, 8(%rsp)	# strings, %sfp
+.LVL639:
+	.loc 1 1101 19 view .LVU1533
+	jmp	.L409	#
+.LVL640:
+.L424:
+# console.c:1102:         *capp = cap;
+	.loc 1 1102 15 view .LVU1534
+	movq	%r13, %r12	# iftmp.92_131, cap
+.LVL641:
+# console.c:1101:         *stringsp = strings;
+	.loc 1 1101 19 view .LVU1535
+	movq	16(%rsp), %rax	# %sfp, strings
+.LVL642:
+	.loc 1 1101 19 view .LVU1536
+	movq	%rax, 8(%rsp)	# strings, %sfp
+.LVL643:
+	.loc 1 1101 19 view .LVU1537
+	jmp	.L409	#
+.LVL644:
+.L433:
+	.loc 1 1101 19 view .LVU1538
+	movq	24(%rsp), %r13	# %sfp, argv
+	movl	32(%rsp), %ebp	# %sfp, argc
+	movq	%r12, 16(%rsp)	# cap, %sfp
+.LVL645:
+.L406:
+	.loc 1 1101 19 view .LVU1539
+.LBE104:
+.LBE105:
+.LBE106:
+.LBE101:
+	.loc 1 1170 13 is_stmt 1 view .LVU1540
+# console.c:1170:             header.ncmds++;
+	.loc 1 1170 25 is_stmt 0 view .LVU1541
+	addq	$1, 360(%rsp)	#, header.ncmds
+.LVL646:
+.L404:
+	.loc 1 1170 25 view .LVU1542
+.LBE100:
+	.loc 1 1173 9 is_stmt 1 view .LVU1543
+# console.c:1173:         if (argv != stack_argv)
+	.loc 1 1173 12 is_stmt 0 view .LVU1544
+	leaq	64(%rsp), %rax	#, tmp190
+	cmpq	%rax, %r13	# tmp190, argv
+	je	.L400	#,
+	.loc 1 1174 13 is_stmt 1 view .LVU1545
+	movslq	%ebp, %rsi	# argc, argc
+	movl	$8, %edx	#,
+	movq	%r13, %rdi	# argv,
+	call	free_array@PLT	#
+.LVL647:
+.L400:
+	.loc 1 1174 13 is_stmt 0 view .LVU1546
+.LBE109:
+	.loc 1 1136 12 is_stmt 1 view .LVU1547
+	cmpq	$0, buf_stack(%rip)	#, buf_stack
+	je	.L434	#,
+.LVL648:
+.L413:
+.LBB110:
+	.loc 1 1137 9 view .LVU1548
+# console.c:1137:         char *line = readline();
+	.loc 1 1137 22 is_stmt 0 view .LVU1549
+	movl	$0, %eax	#,
+	call	readline	#
+.LVL649:
+	movq	%rax, %rbx	# tmp220, line
+.LVL650:
+	.loc 1 1138 9 is_stmt 1 view .LVU1550
+# console.c:1138:         if (!line)
+	.loc 1 1138 12 is_stmt 0 view .LVU1551
+	testq	%rax, %rax	# line
+	je	.L400	#,
+	.loc 1 1141 9 is_stmt 1 view .LVU1552
+	.loc 1 1142 9 view .LVU1553
+.LVL651:
+	.loc 1 1143 9 view .LVU1554
+	.loc 1 1144 9 view .LVU1555
+# console.c:1144:         int argc = parse_args(line, stack_argv, MAXARGS, &end);
+	.loc 1 1144 20 is_stmt 0 view .LVU1556
+	leaq	56(%rsp), %rcx	#, tmp157
+	leaq	64(%rsp), %rsi	#, tmp158
+.LVL652:
+	.loc 1 1144 20 view .LVU1557
+	movl	$32, %edx	#,
+	movq	%rax, %rdi	# line,
+	call	parse_args	#
+.LVL653:
+	.loc 1 1144 20 view .LVU1558
+	movl	%eax, %ebp	# tmp221, argc
+.LVL654:
+	.loc 1 1145 9 is_stmt 1 view .LVU1559
+# console.c:1145:         if (argc > MAXARGS) {
+	.loc 1 1145 12 is_stmt 0 view .LVU1560
+	cmpl	$32, %eax	#, argc
+	jg	.L435	#,
+	.loc 1 1150 9 is_stmt 1 view .LVU1561
+# console.c:1150:         if (argc == 0) {
+	.loc 1 1150 12 is_stmt 0 view .LVU1562
+	testl	%eax, %eax	# argc
+	je	.L400	#,
+	.loc 1 1152 16 is_stmt 1 view .LVU1563
+# console.c:1152:         } else if (argc >= 2 && strcmp(argv[0], "source") == 0) {
+	.loc 1 1152 19 is_stmt 0 view .LVU1564
+	cmpl	$1, %ebp	#, argc
+	jg	.L436	#,
+# console.c:1142:         char **argv = stack_argv;
+	.loc 1 1142 16 view .LVU1565
+	leaq	64(%rsp), %r13	#, argv
+.LVL655:
+.L403:
+	.loc 1 1157 16 is_stmt 1 view .LVU1566
+# console.c:1157:         } else if (strcmp(argv[0], "}") != 0 &&
+	.loc 1 1157 20 is_stmt 0 view .LVU1567
+	movq	0(%r13), %rbx	# *argv_25, _10
+.LVL656:
+	.loc 1 1157 20 view .LVU1568
+	leaq	.LC88(%rip), %rsi	#,
+	movq	%rbx, %rdi	# _10,
+	call	strcmp@PLT	#
+.LVL657:
+# console.c:1157:         } else if (strcmp(argv[0], "}") != 0 &&
+	.loc 1 1157 19 view .LVU1569
+	testl	%eax, %eax	# tmp225
+	je	.L405	#,
+# console.c:1158:                    !table_find(&cmd_table, argv[0])) {
+	.loc 1 1158 21 discriminator 1 view .LVU1570
+	movq	%rbx, %rsi	# _10,
+	leaq	cmd_table(%rip), %rdi	#,
+	call	table_find	#
+.LVL658:
+# console.c:1157:         } else if (strcmp(argv[0], "}") != 0 &&
+	.loc 1 1157 46 discriminator 1 view .LVU1571
+	testq	%rax, %rax	# tmp226
+	je	.L437	#,
+.L405:
+.LBB108:
+	.loc 1 1163 13 is_stmt 1 view .LVU1572
+# console.c:1163:             uint32_t word = argc;
+	.loc 1 1163 22 is_stmt 0 view .LVU1573
+	movl	%ebp, 52(%rsp)	# argc, word
+	.loc 1 1164 13 is_stmt 1 view .LVU1574
+	leaq	52(%rsp), %rdi	#, tmp173
+	movq	%r15, %rcx	# out,
+	movl	$1, %edx	#,
+	movl	$4, %esi	#,
+	call	fwrite@PLT	#
+.LVL659:
+	.loc 1 1165 13 view .LVU1575
+.LBB107:
+	.loc 1 1165 18 view .LVU1576
+	.loc 1 1165 31 view .LVU1577
+	testl	%ebp, %ebp	# argc
+	jle	.L406	#,
+	movq	%r13, %rbx	# argv, ivtmp.319
+	movslq	%ebp, %rax	# argc, argc
+	leaq	0(%r13,%rax,8), %r14	#, _44
+	movq	%r13, 24(%rsp)	# argv, %sfp
+	movl	%ebp, 32(%rsp)	# argc, %sfp
+	movq	16(%rsp), %r12	# %sfp, cap
+	jmp	.L411	#
+.LVL660:
+.L434:
+	.loc 1 1165 31 is_stmt 0 view .LVU1578
+	movzbl	39(%rsp), %ebp	# %sfp, save_echo
+	movq	8(%rsp), %r14	# %sfp, strings
+	movq	40(%rsp), %r13	# %sfp, outfile_name
+.LVL661:
+.L399:
+	.loc 1 1165 31 view .LVU1579
+.LBE107:
+.LBE108:
+.LBE110:
+	.loc 1 1177 5 is_stmt 1 view .LVU1580
+# console.c:1177:     header.strtab_offset = ftello(out);
+	.loc 1 1177 28 is_stmt 0 view .LVU1581
+	movq	%r15, %rdi	# out,
+	call	ftello@PLT	#
+.LVL662:
+# console.c:1177:     header.strtab_offset = ftello(out);
+	.loc 1 1177 26 view .LVU1582
+	movq	%rax, 368(%rsp)	# tmp230, header.strtab_offset
+	.loc 1 1178 5 is_stmt 1 view .LVU1583
+.LBB111:
+	.loc 1 1178 10 view .LVU1584
+.LVL663:
+	.loc 1 1178 28 view .LVU1585
+	cmpl	$0, 356(%rsp)	#, header.nstrings
+	je	.L414	#,
+# console.c:1178:     for (uint32_t i = 0; i < header.nstrings; i++) {
+	.loc 1 1178 19 is_stmt 0 view .LVU1586
+	movl	$0, %ebx	#, i
+.LBB112:
+# console.c:1180:         fwrite(&len, sizeof(len), 1, out);
+	.loc 1 1180 9 view .LVU1587
+	leaq	64(%rsp), %r12	#, tmp198
+	movb	%bpl, 8(%rsp)	# save_echo, %sfp
+.LVL664:
+.L415:
+	.loc 1 1179 9 is_stmt 1 discriminator 3 view .LVU1588
+# console.c:1179:         uint32_t len = strlen(strings[i]);
+	.loc 1 1179 38 is_stmt 0 discriminator 3 view .LVU1589
+	movl	%ebx, %eax	# i, i
+	leaq	(%r14,%rax,8), %rbp	#, _28
+# console.c:1179:         uint32_t len = strlen(strings[i]);
+	.loc 1 1179 24 discriminator 3 view .LVU1590
+	movq	0(%rbp), %rdi	# *_28, *_28
+	call	strlen@PLT	#
+.LVL665:
+# console.c:1179:         uint32_t len = strlen(strings[i]);
+	.loc 1 1179 18 discriminator 3 view .LVU1591
+	movl	%eax, 64(%rsp)	# tmp231, MEM[(unsigned int *)_175]
+	.loc 1 1180 9 is_stmt 1 discriminator 3 view .LVU1592
+	movq	%r15, %rcx	# out,
+	movl	$1, %edx	#,
+	movl	$4, %esi	#,
+	movq	%r12, %rdi	# tmp198,
+	call	fwrite@PLT	#
+.LVL666:
+	.loc 1 1181 9 discriminator 3 view .LVU1593
+	movl	64(%rsp), %edx	# MEM[(unsigned int *)_175], MEM[(unsigned int *)_175]
+	movq	0(%rbp), %rdi	# *_28, *_28
+	movq	%r15, %rcx	# out,
+	movl	$1, %esi	#,
+	call	fwrite@PLT	#
+.LVL667:
+	.loc 1 1182 9 discriminator 3 view .LVU1594
+	movq	0(%rbp), %rdi	# *_28, *_28
+	call	free_string@PLT	#
+.LVL668:
+.LBE112:
+	.loc 1 1178 48 discriminator 3 view .LVU1595
+	addl	$1, %ebx	#, i
+.LVL669:
+	.loc 1 1178 28 discriminator 3 view .LVU1596
+	cmpl	356(%rsp), %ebx	# header.nstrings, i
+	jb	.L415	#,
+	movzbl	8(%rsp), %ebp	# %sfp, save_echo
+.LVL670:
+.L414:
+	.loc 1 1178 28 is_stmt 0 discriminator 3 view .LVU1597
+.LBE111:
+	.loc 1 1184 5 is_stmt 1 view .LVU1598
+# console.c:1184:     if (strings)
+	.loc 1 1184 8 is_stmt 0 view .LVU1599
+	testq	%r14, %r14	# strings
+	je	.L416	#,
+	.loc 1 1185 9 is_stmt 1 view .LVU1600
+	movl	$8, %edx	#,
+	movq	16(%rsp), %rsi	# %sfp,
+	movq	%r14, %rdi	# strings,
+	call	free_array@PLT	#
+.LVL671:
+.L416:
+	.loc 1 1186 5 view .LVU1601
+	leaq	320(%rsp), %rdi	#, tmp202
+	call	table_clear	#
+.LVL672:
+	.loc 1 1188 5 view .LVU1602
+	movl	$0, %edx	#,
+	movl	$0, %esi	#,
+	movq	%r15, %rdi	# out,
+	call	fseeko@PLT	#
+.LVL673:
+	.loc 1 1189 5 view .LVU1603
+	leaq	352(%rsp), %rdi	#, tmp203
+	movq	%r15, %rcx	# out,
+	movl	$1, %edx	#,
+	movl	$24, %esi	#,
+	call	fwrite@PLT	#
+.LVL674:
+	.loc 1 1190 5 view .LVU1604
+# console.c:1190:     if (ferror(out)) {
+	.loc 1 1190 9 is_stmt 0 view .LVU1605
+	movq	%r15, %rdi	# out,
+	call	ferror@PLT	#
+.LVL675:
+# console.c:1190:     if (ferror(out)) {
+	.loc 1 1190 8 view .LVU1606
+	testl	%eax, %eax	# tmp232
+	jne	.L438	#,
+.LVL676:
+	.loc 1 1194 5 is_stmt 1 view .LVU1607
+	movq	%r15, %rdi	# out,
+	call	fclose@PLT	#
+.LVL677:
+	.loc 1 1195 5 view .LVU1608
+# console.c:1195:     echo = save_echo;
+	.loc 1 1195 10 is_stmt 0 view .LVU1609
+	movb	%bpl, echo(%rip)	# save_echo, echo
+	.loc 1 1196 5 is_stmt 1 view .LVU1610
+# console.c:1196:     if (!ok)
+	.loc 1 1196 8 is_stmt 0 view .LVU1611
+	cmpb	$0, 38(%rsp)	#, %sfp
+	je	.L418	#,
+.LVL678:
+.L419:
+	.loc 1 1199 5 is_stmt 1 view .LVU1612
+	movl	356(%rsp), %ecx	# header.nstrings,
+	movq	360(%rsp), %rdx	# header.ncmds,
+	leaq	.LC101(%rip), %rsi	#, tmp207
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL679:
+	.loc 1 1201 5 view .LVU1613
+.L395:
+# console.c:1202: }
+	.loc 1 1202 1 is_stmt 0 view .LVU1614
+	movzbl	38(%rsp), %eax	# %sfp,
+	addq	$392, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL680:
+.L421:
+	.cfi_restore_state
+# console.c:1131:     size_t cap = 0;
+	.loc 1 1131 12 view .LVU1615
+	movq	$0, 16(%rsp)	#, %sfp
+	jmp	.L399	#
+.LVL681:
+.L438:
+	.loc 1 1191 9 is_stmt 1 view .LVU1616
+	movq	%r13, %rdx	# outfile_name,
+	leaq	.LC100(%rip), %rsi	#, tmp204
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL682:
+	.loc 1 1192 9 view .LVU1617
+	.loc 1 1194 5 view .LVU1618
+	movq	%r15, %rdi	# out,
+	call	fclose@PLT	#
+.LVL683:
+	.loc 1 1195 5 view .LVU1619
+# console.c:1195:     echo = save_echo;
+	.loc 1 1195 10 is_stmt 0 view .LVU1620
+	movb	%bpl, echo(%rip)	# save_echo, echo
+	.loc 1 1196 5 is_stmt 1 view .LVU1621
+.LVL684:
+.L418:
+	.loc 1 1197 9 view .LVU1622
+	movq	%r13, %rdi	# outfile_name,
+	call	unlink@PLT	#
+.LVL685:
+	movb	$0, 38(%rsp)	#, %sfp
+	jmp	.L419	#
+	.cfi_endproc
+.LFE69:
+	.size	compile_file, .-compile_file
+	.section	.rodata.str1.1
+.LC102:
+	.string	"QBC1"
+.LC103:
+	.string	"run_bytecode"
+	.section	.rodata.str1.8
+	.align 8
+.LC104:
+	.string	"ERROR: Compiled file '%s' is corrupted"
+	.align 8
+.LC105:
+	.string	"ERROR: Could not open compiled file '%s'"
+	.align 8
+.LC106:
+	.string	"ERROR: '%s' is not a compiled command file"
+	.text
+	.globl	run_bytecode
+	.type	run_bytecode, @function
+run_bytecode:
+.LVL686:
+.LFB72:
+	.loc 1 1268 1 view -0
+	.cfi_startproc
+	.loc 1 1268 1 is_stmt 0 view .LVU1624
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$504, %rsp	#,
+	.cfi_def_cfa_offset 560
+	movq	%rdi, %r12	# tmp214, file_name
+	.loc 1 1269 5 is_stmt 1 view .LVU1625
+# console.c:1269:     int fd = open(file_name, O_RDONLY);
+	.loc 1 1269 14 is_stmt 0 view .LVU1626
+	movl	$0, %esi	#,
+	movl	$0, %eax	#,
+	call	open@PLT	#
+.LVL687:
+	.loc 1 1270 5 is_stmt 1 view .LVU1627
+	.loc 1 1271 5 view .LVU1628
+# console.c:1271:     if (fd < 0 || fstat(fd, &st) != 0) {
+	.loc 1 1271 8 is_stmt 0 view .LVU1629
+	testl	%eax, %eax	# fd
+	js	.L440	#,
+	movl	%eax, %ebx	# tmp215, fd
+# console.c:1271:     if (fd < 0 || fstat(fd, &st) != 0) {
+	.loc 1 1271 19 discriminator 1 view .LVU1630
+	leaq	352(%rsp), %rsi	#, tmp148
+	movl	%eax, %edi	# fd,
+	call	fstat@PLT	#
+.LVL688:
+# console.c:1271:     if (fd < 0 || fstat(fd, &st) != 0) {
+	.loc 1 1271 16 discriminator 1 view .LVU1631
+	testl	%eax, %eax	# tmp216
+	jne	.L441	#,
+	.loc 1 1278 5 is_stmt 1 view .LVU1632
+# console.c:1278:     size_t size = st.st_size;
+	.loc 1 1278 12 is_stmt 0 view .LVU1633
+	movq	400(%rsp), %r13	# st.st_size, size
+.LVL689:
+	.loc 1 1279 5 is_stmt 1 view .LVU1634
+# console.c:1281:                     : MAP_FAILED;
+	.loc 1 1281 21 is_stmt 0 view .LVU1635
+	cmpq	$23, %r13	#, size
+	ja	.L462	#,
+.LVL690:
+	.loc 1 1282 5 is_stmt 1 view .LVU1636
+	movl	%ebx, %edi	# fd,
+	call	close@PLT	#
+.LVL691:
+	.loc 1 1283 5 view .LVU1637
+	.loc 1 1284 5 view .LVU1638
+.L443:
+	.loc 1 1288 9 view .LVU1639
+	movq	%r12, %rdx	# file_name,
+	leaq	.LC106(%rip), %rsi	#, tmp188
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL692:
+	.loc 1 1289 9 view .LVU1640
+# console.c:1291:         return false;
+	.loc 1 1291 16 is_stmt 0 view .LVU1641
+	movl	$0, %eax	#, <retval>
+	jmp	.L439	#
+.L462:
+# console.c:1280:                     ? mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0)
+	.loc 1 1280 23 view .LVU1642
+	movl	$0, %r9d	#,
+	movl	%ebx, %r8d	# fd,
+	movl	$2, %ecx	#,
+	movl	$1, %edx	#,
+	movq	%r13, %rsi	# size,
+	movl	$0, %edi	#,
+	call	mmap@PLT	#
+.LVL693:
+	movq	%rax, %rbp	# tmp217, iftmp.94_64
+.LVL694:
+	.loc 1 1282 5 is_stmt 1 view .LVU1643
+	movl	%ebx, %edi	# fd,
+	call	close@PLT	#
+.LVL695:
+	.loc 1 1283 5 view .LVU1644
+	.loc 1 1284 5 view .LVU1645
+# console.c:1284:     if (map == MAP_FAILED ||
+	.loc 1 1284 8 is_stmt 0 view .LVU1646
+	cmpq	$-1, %rbp	#, iftmp.94_64
+	je	.L443	#,
+# console.c:1285:         memcmp(header->magic, BC_MAGIC, sizeof(header->magic)) != 0 ||
+	.loc 1 1285 9 discriminator 1 view .LVU1647
+	movl	$4, %edx	#,
+	leaq	.LC102(%rip), %rsi	#, tmp150
+	movq	%rbp, %rdi	# iftmp.94_64,
+	call	memcmp@PLT	#
+.LVL696:
+	movl	%eax, 4(%rsp)	# tmp151, %sfp
+# console.c:1284:     if (map == MAP_FAILED ||
+	.loc 1 1284 27 discriminator 1 view .LVU1648
+	testl	%eax, %eax	# tmp151
+	jne	.L444	#,
+# console.c:1286:         header->strtab_offset < sizeof(bc_header_t) ||
+	.loc 1 1286 15 view .LVU1649
+	movq	16(%rbp), %rax	# MEM[(struct bc_header_t *)iftmp.94_64].strtab_offset, _5
+# console.c:1286:         header->strtab_offset < sizeof(bc_header_t) ||
+	.loc 1 1286 53 view .LVU1650
+	cmpq	%rax, %r13	# _5, size
+	jb	.L444	#,
+	cmpq	$23, %rax	#, _5
+	ja	.L463	#,
+.L444:
+	.loc 1 1288 9 is_stmt 1 view .LVU1651
+	movq	%r12, %rdx	# file_name,
+	leaq	.LC106(%rip), %rsi	#, tmp189
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL697:
+	.loc 1 1289 9 view .LVU1652
+	.loc 1 1290 13 view .LVU1653
+	movq	%r13, %rsi	# size,
+	movq	%rbp, %rdi	# iftmp.94_64,
+	call	munmap@PLT	#
+.LVL698:
+# console.c:1291:         return false;
+	.loc 1 1291 16 is_stmt 0 view .LVU1654
+	movl	$0, %eax	#, <retval>
+	jmp	.L439	#
+.L463:
+	.loc 1 1293 5 is_stmt 1 view .LVU1655
+	movl	$2, %edx	#,
+	movq	%r13, %rsi	# size,
+	movq	%rbp, %rdi	# iftmp.94_64,
+	call	madvise@PLT	#
+.LVL699:
+	.loc 1 1296 5 view .LVU1656
+# console.c:1296:     uint32_t nstrings = header->nstrings;
+	.loc 1 1296 14 is_stmt 0 view .LVU1657
+	movl	4(%rbp), %r15d	# MEM[(struct bc_header_t *)iftmp.94_64].nstrings, nstrings
+.LVL700:
+	.loc 1 1297 5 is_stmt 1 view .LVU1658
+# console.c:1297:     size_t strbytes = size - header->strtab_offset;
+	.loc 1 1297 36 is_stmt 0 view .LVU1659
+	movq	16(%rbp), %r14	# MEM[(struct bc_header_t *)iftmp.94_64].strtab_offset, _6
+.LVL701:
+	.loc 1 1298 5 is_stmt 1 view .LVU1660
+# console.c:1299:         calloc_or_fail(nstrings + 1, sizeof(char *), "run_bytecode");
+	.loc 1 1299 9 is_stmt 0 view .LVU1661
+	leal	1(%r15), %eax	#, _8
+	movq	%rax, 24(%rsp)	# _8, %sfp
+	leaq	.LC103(%rip), %rbx	#, tmp158
+.LVL702:
+	.loc 1 1299 9 view .LVU1662
+	movq	%rbx, %rdx	# tmp158,
+	movl	$8, %esi	#,
+	movq	%rax, %rdi	# _8,
+	call	calloc_or_fail@PLT	#
+.LVL703:
+	movq	%rax, 8(%rsp)	# tmp219, %sfp
+.LVL704:
+	.loc 1 1300 5 is_stmt 1 view .LVU1663
+# console.c:1300:     char *chars = malloc_or_fail(strbytes + 1, "run_bytecode");
+	.loc 1 1300 19 is_stmt 0 view .LVU1664
+	leaq	1(%r13), %rax	#, tmp159
+.LVL705:
+	.loc 1 1300 19 view .LVU1665
+	subq	%r14, %rax	# _6, tmp159
+	movq	%rax, %rdi	# tmp159, _9
+	movq	%rax, 32(%rsp)	# _9, %sfp
+	movq	%rbx, %rsi	# tmp158,
+	call	malloc_or_fail@PLT	#
+.LVL706:
+	movq	%rax, %rsi	# tmp220, chars
+	movq	%rax, 40(%rsp)	# chars, %sfp
+.LVL707:
+	.loc 1 1301 5 is_stmt 1 view .LVU1666
+# console.c:1301:     char *src = map + header->strtab_offset;
+	.loc 1 1301 11 is_stmt 0 view .LVU1667
+	movq	%rbp, %rbx	# iftmp.94_64, src
+	addq	16(%rbp), %rbx	# MEM[(struct bc_header_t *)iftmp.94_64].strtab_offset, src
+.LVL708:
+	.loc 1 1302 5 is_stmt 1 view .LVU1668
+	.loc 1 1303 5 view .LVU1669
+	.loc 1 1304 5 view .LVU1670
+.LBB113:
+	.loc 1 1304 10 view .LVU1671
+	.loc 1 1304 29 view .LVU1672
+	testl	%r15d, %r15d	# nstrings
+	je	.L445	#,
+.LBB114:
+	.loc 1 1305 9 view .LVU1673
+	.loc 1 1306 9 view .LVU1674
+# console.c:1306:         if (src + sizeof(len) > map + size) {
+	.loc 1 1306 17 is_stmt 0 view .LVU1675
+	leaq	4(%rbx), %r14	#, _11
+.LVL709:
+# console.c:1306:         if (src + sizeof(len) > map + size) {
+	.loc 1 1306 37 view .LVU1676
+	leaq	0(%rbp,%r13), %rcx	#, _123
+	movq	%rcx, 16(%rsp)	# _123, %sfp
+# console.c:1306:         if (src + sizeof(len) > map + size) {
+	.loc 1 1306 12 view .LVU1677
+	cmpq	%r14, %rcx	# _11, _123
+	jb	.L446	#,
+	movq	8(%rsp), %rdx	# %sfp, strings
+	leal	-1(%r15), %eax	#, tmp163
+.LVL710:
+	.loc 1 1306 12 view .LVU1678
+	leaq	(%rdx,%rax,8), %rax	#, _144
+	movq	%rax, 48(%rsp)	# _144, %sfp
+	movq	%r13, 56(%rsp)	# size, %sfp
+	movq	%rbp, 64(%rsp)	# iftmp.94_64, %sfp
+	movq	%rdx, %rbp	# ivtmp.327, ivtmp.327
+.LVL711:
+	.loc 1 1306 12 view .LVU1679
+	movq	%r12, 72(%rsp)	# file_name, %sfp
+	movq	%rsi, %r12	# dst, dst
+.LVL712:
+.L447:
+	.loc 1 1310 9 is_stmt 1 view .LVU1680
+	movl	(%rbx), %r13d	# MEM <unsigned int> [(char * {ref-all})src_126], _74
+.LVL713:
+	.loc 1 1311 9 view .LVU1681
+	.loc 1 1312 9 view .LVU1682
+# console.c:1312:         if (len > (size_t) (map + size - src)) {
+	.loc 1 1312 17 is_stmt 0 view .LVU1683
+	movl	%r13d, %ebx	# _74, _13
+# console.c:1312:         if (len > (size_t) (map + size - src)) {
+	.loc 1 1312 40 view .LVU1684
+	movq	16(%rsp), %rax	# %sfp, tmp165
+	subq	%r14, %rax	# _11, tmp165
+# console.c:1312:         if (len > (size_t) (map + size - src)) {
+	.loc 1 1312 12 view .LVU1685
+	cmpq	%rbx, %rax	# _13, tmp165
+	jb	.L448	#,
+	.loc 1 1316 9 is_stmt 1 view .LVU1686
+	movq	%rbx, %rdx	# _13,
+	movq	%r14, %rsi	# _11,
+	movq	%r12, %rdi	# dst,
+	call	memcpy@PLT	#
+.LVL714:
+	.loc 1 1317 9 view .LVU1687
+# console.c:1317:         strings[i] = dst;
+	.loc 1 1317 20 is_stmt 0 view .LVU1688
+	movq	%r12, 0(%rbp)	# dst, MEM[(char * *)_158]
+	.loc 1 1318 9 is_stmt 1 view .LVU1689
+# console.c:1318:         dst[len] = '\0';
+	.loc 1 1318 18 is_stmt 0 view .LVU1690
+	movb	$0, (%r12,%rbx)	#, *_19
+	.loc 1 1319 9 is_stmt 1 view .LVU1691
+# console.c:1319:         dst += len + 1;
+	.loc 1 1319 20 is_stmt 0 view .LVU1692
+	leal	1(%r13), %eax	#, tmp172
+# console.c:1319:         dst += len + 1;
+	.loc 1 1319 13 view .LVU1693
+	addq	%rax, %r12	# tmp172, dst
+.LVL715:
+	.loc 1 1320 9 is_stmt 1 view .LVU1694
+# console.c:1320:         src += len;
+	.loc 1 1320 13 is_stmt 0 view .LVU1695
+	addq	%r14, %rbx	# _11, src
+.LVL716:
+	.loc 1 1320 13 view .LVU1696
+.LBE114:
+	.loc 1 1304 47 is_stmt 1 view .LVU1697
+	.loc 1 1304 29 view .LVU1698
+	movq	48(%rsp), %rax	# %sfp, _144
+	cmpq	%rax, %rbp	# _144, ivtmp.327
+	je	.L464	#,
+.LBB115:
+	.loc 1 1305 9 view .LVU1699
+	.loc 1 1306 9 view .LVU1700
+# console.c:1306:         if (src + sizeof(len) > map + size) {
+	.loc 1 1306 17 is_stmt 0 view .LVU1701
+	leaq	4(%rbx), %r14	#, _11
+# console.c:1306:         if (src + sizeof(len) > map + size) {
+	.loc 1 1306 12 view .LVU1702
+	addq	$8, %rbp	#, ivtmp.327
+.LVL717:
+	.loc 1 1306 12 view .LVU1703
+	cmpq	%r14, 16(%rsp)	# _11, %sfp
+	jnb	.L447	#,
+.LVL718:
+.L448:
+	.loc 1 1306 12 view .LVU1704
+.LBE115:
+.LBE113:
+# console.c:1323:     bc_code = (uint32_t *) (map + sizeof(bc_header_t));
+	.loc 1 1323 33 view .LVU1705
+	movq	56(%rsp), %r13	# %sfp, size
+.LVL719:
+	.loc 1 1323 33 view .LVU1706
+	movq	64(%rsp), %rbp	# %sfp, iftmp.94_64
+	movq	72(%rsp), %r12	# %sfp, file_name
+.LVL720:
+	.loc 1 1323 5 is_stmt 1 view .LVU1707
+# console.c:1323:     bc_code = (uint32_t *) (map + sizeof(bc_header_t));
+	.loc 1 1323 33 is_stmt 0 view .LVU1708
+	leaq	24(%rbp), %rax	#, tmp205
+	movq	%rax, bc_code(%rip)	# tmp205, bc_code
+	.loc 1 1324 5 is_stmt 1 view .LVU1709
+# console.c:1324:     bc_code_end = (uint32_t *) (map + header->strtab_offset);
+	.loc 1 1324 37 is_stmt 0 view .LVU1710
+	movq	%rbp, %rax	# iftmp.94_64, tmp208
+	addq	16(%rbp), %rax	# MEM[(struct bc_header_t *)iftmp.94_64].strtab_offset, tmp208
+# console.c:1324:     bc_code_end = (uint32_t *) (map + header->strtab_offset);
+	.loc 1 1324 17 view .LVU1711
+	movq	%rax, bc_code_end(%rip)	# tmp208, bc_code_end
+	.loc 1 1325 5 is_stmt 1 view .LVU1712
+# console.c:1325:     bc_left = header->ncmds;
+	.loc 1 1325 13 is_stmt 0 view .LVU1713
+	movq	8(%rbp), %rax	# MEM[(struct bc_header_t *)iftmp.94_64].ncmds, MEM[(struct bc_header_t *)iftmp.94_64].ncmds
+	movq	%rax, bc_left(%rip)	# MEM[(struct bc_header_t *)iftmp.94_64].ncmds, bc_left
+	.loc 1 1326 5 is_stmt 1 view .LVU1714
+# console.c:1326:     bc_strings = strings;
+	.loc 1 1326 16 is_stmt 0 view .LVU1715
+	movq	8(%rsp), %rax	# %sfp, strings
+	movq	%rax, bc_strings(%rip)	# strings, bc_strings
+	.loc 1 1327 5 is_stmt 1 view .LVU1716
+# console.c:1327:     bc_nstrings = nstrings;
+	.loc 1 1327 17 is_stmt 0 view .LVU1717
+	movl	%r15d, bc_nstrings(%rip)	# nstrings, bc_nstrings
+	.loc 1 1328 5 is_stmt 1 view .LVU1718
+# console.c:1328:     line_source = next_compiled_line;
+	.loc 1 1328 17 is_stmt 0 view .LVU1719
+	leaq	next_compiled_line(%rip), %rax	#, tmp263
+	movq	%rax, line_source(%rip)	# tmp263, line_source
+	.loc 1 1331 5 is_stmt 1 view .LVU1720
+# console.c:1332:         calloc_or_fail(nstrings + 1, sizeof(cmd_ptr), "run_bytecode");
+	.loc 1 1332 9 is_stmt 0 view .LVU1721
+	leaq	.LC103(%rip), %rdx	#, tmp212
+	movl	$8, %esi	#,
+	movq	24(%rsp), %rdi	# %sfp,
+	call	calloc_or_fail@PLT	#
+.LVL721:
+	movq	%rax, %r14	# tmp225, cmds
+.LVL722:
+	.loc 1 1333 5 is_stmt 1 view .LVU1722
+	.loc 1 1333 15 view .LVU1723
+	jmp	.L452	#
+.LVL723:
+.L464:
+.LBB116:
+	.loc 1 1333 15 is_stmt 0 view .LVU1724
+	movq	56(%rsp), %r13	# %sfp, size
+.LVL724:
+	.loc 1 1333 15 view .LVU1725
+	movq	64(%rsp), %rbp	# %sfp, iftmp.94_64
+.LVL725:
+	.loc 1 1333 15 view .LVU1726
+	movq	72(%rsp), %r12	# %sfp, file_name
+.LVL726:
+.L445:
+	.loc 1 1333 15 view .LVU1727
+.LBE116:
+	.loc 1 1323 5 is_stmt 1 view .LVU1728
+# console.c:1323:     bc_code = (uint32_t *) (map + sizeof(bc_header_t));
+	.loc 1 1323 33 is_stmt 0 view .LVU1729
+	leaq	24(%rbp), %rax	#, tmp197
+	movq	%rax, bc_code(%rip)	# tmp197, bc_code
+	.loc 1 1324 5 is_stmt 1 view .LVU1730
+# console.c:1324:     bc_code_end = (uint32_t *) (map + header->strtab_offset);
+	.loc 1 1324 37 is_stmt 0 view .LVU1731
+	movq	%rbp, %rax	# iftmp.94_64, tmp200
+	addq	16(%rbp), %rax	# MEM[(struct bc_header_t *)iftmp.94_64].strtab_offset, tmp200
+# console.c:1324:     bc_code_end = (uint32_t *) (map + header->strtab_offset);
+	.loc 1 1324 17 view .LVU1732
+	movq	%rax, bc_code_end(%rip)	# tmp200, bc_code_end
+	.loc 1 1325 5 is_stmt 1 view .LVU1733
+# console.c:1325:     bc_left = header->ncmds;
+	.loc 1 1325 13 is_stmt 0 view .LVU1734
+	movq	8(%rbp), %rax	# MEM[(struct bc_header_t *)iftmp.94_64].ncmds, MEM[(struct bc_header_t *)iftmp.94_64].ncmds
+	movq	%rax, bc_left(%rip)	# MEM[(struct bc_header_t *)iftmp.94_64].ncmds, bc_left
+	.loc 1 1326 5 is_stmt 1 view .LVU1735
+# console.c:1326:     bc_strings = strings;
+	.loc 1 1326 16 is_stmt 0 view .LVU1736
+	movq	8(%rsp), %rax	# %sfp, strings
+	movq	%rax, bc_strings(%rip)	# strings, bc_strings
+	.loc 1 1327 5 is_stmt 1 view .LVU1737
+# console.c:1327:     bc_nstrings = nstrings;
+	.loc 1 1327 17 is_stmt 0 view .LVU1738
+	movl	%r15d, bc_nstrings(%rip)	# nstrings, bc_nstrings
+	.loc 1 1328 5 is_stmt 1 view .LVU1739
+# console.c:1328:     line_source = next_compiled_line;
+	.loc 1 1328 17 is_stmt 0 view .LVU1740
+	leaq	next_compiled_line(%rip), %rax	#, tmp260
+	movq	%rax, line_source(%rip)	# tmp260, line_source
+	.loc 1 1331 5 is_stmt 1 view .LVU1741
+# console.c:1332:         calloc_or_fail(nstrings + 1, sizeof(cmd_ptr), "run_bytecode");
+	.loc 1 1332 9 is_stmt 0 view .LVU1742
+	leaq	.LC103(%rip), %rdx	#, tmp204
+	movl	$8, %esi	#,
+	movq	24(%rsp), %rdi	# %sfp,
+	call	calloc_or_fail@PLT	#
+.LVL727:
+	movq	%rax, %r14	# tmp224, cmds
+.LVL728:
+	.loc 1 1333 5 is_stmt 1 view .LVU1743
+	.loc 1 1333 15 view .LVU1744
+.LBB117:
+# console.c:1346:             cmds[id] = table_find(&cmd_table, argv[0]);
+	.loc 1 1346 24 is_stmt 0 view .LVU1745
+	leaq	cmd_table(%rip), %r15	#, tmp213
+.LVL729:
+	.loc 1 1346 24 view .LVU1746
+	movq	%r13, 16(%rsp)	# size, %sfp
+	movq	%r12, 48(%rsp)	# file_name, %sfp
+.LVL730:
+.L459:
+	.loc 1 1346 24 view .LVU1747
+.LBE117:
+# console.c:1333:     while (ok && !quit_flag) {
+	.loc 1 1333 15 discriminator 1 view .LVU1748
+	cmpb	$0, quit_flag(%rip)	#, quit_flag
+	jne	.L465	#,
+.LBB118:
+	.loc 1 1334 9 is_stmt 1 view .LVU1749
+	.loc 1 1335 9 view .LVU1750
+# console.c:1335:         char **argv = stack_argv;
+	.loc 1 1335 16 is_stmt 0 view .LVU1751
+	leaq	96(%rsp), %rax	#, tmp173
+	movq	%rax, 88(%rsp)	# tmp173, argv
+	.loc 1 1336 9 is_stmt 1 view .LVU1752
+# console.c:1336:         uint32_t *rec = bc_code;
+	.loc 1 1336 19 is_stmt 0 view .LVU1753
+	movq	bc_code(%rip), %r12	# bc_code, rec
+.LVL731:
+	.loc 1 1337 9 is_stmt 1 view .LVU1754
+# console.c:1337:         int argc = next_compiled(&argv);
+	.loc 1 1337 20 is_stmt 0 view .LVU1755
+	leaq	88(%rsp), %rdi	#, tmp174
+	call	next_compiled	#
+.LVL732:
+	movl	%eax, %ebx	# tmp221, argc
+.LVL733:
+	.loc 1 1338 9 is_stmt 1 view .LVU1756
+# console.c:1338:         if (argc <= 0) {
+	.loc 1 1338 12 is_stmt 0 view .LVU1757
+	testl	%eax, %eax	# argc
+	jle	.L466	#,
+	.loc 1 1344 9 is_stmt 1 view .LVU1758
+.LVL734:
+	.loc 1 1345 9 view .LVU1759
+# console.c:1345:         if (!cmds[id])
+	.loc 1 1345 18 is_stmt 0 view .LVU1760
+	movl	4(%r12), %eax	# MEM[(uint32_t *)rec_90 + 4B], MEM[(uint32_t *)rec_90 + 4B]
+.LVL735:
+	.loc 1 1345 18 view .LVU1761
+	leaq	(%r14,%rax,8), %r13	#, _28
+# console.c:1345:         if (!cmds[id])
+	.loc 1 1345 12 view .LVU1762
+	cmpq	$0, 0(%r13)	#, *_28
+	je	.L467	#,
+.LVL736:
+.L453:
+	.loc 1 1347 9 is_stmt 1 view .LVU1763
+	movq	88(%rsp), %r12	# argv, argv.101_33
+.LVL737:
+	.loc 1 1347 9 is_stmt 0 view .LVU1764
+	movq	0(%r13), %rdi	# *_28, *_28
+	movq	%r12, %rdx	# argv.101_33,
+	movl	%ebx, %esi	# argc,
+	call	run_cmd	#
+.LVL738:
+	.loc 1 1348 9 is_stmt 1 view .LVU1765
+# console.c:1348:         if (argv != stack_argv)
+	.loc 1 1348 12 is_stmt 0 view .LVU1766
+	leaq	96(%rsp), %rax	#, tmp181
+	cmpq	%rax, %r12	# tmp181, argv.101_33
+	je	.L459	#,
+	.loc 1 1349 13 is_stmt 1 view .LVU1767
+	movslq	%ebx, %rsi	# argc, argc
+	movl	$8, %edx	#,
+	movq	%r12, %rdi	# argv.101_33,
+	call	free_array@PLT	#
+.LVL739:
+.LBE118:
+	.loc 1 1333 15 view .LVU1768
+	jmp	.L459	#
+.LVL740:
+.L466:
+# console.c:1351:     if (!ok)
+	.loc 1 1351 8 is_stmt 0 view .LVU1769
+	movq	16(%rsp), %r13	# %sfp, size
+	movq	48(%rsp), %r12	# %sfp, file_name
+.LVL741:
+.LBB119:
+	.loc 1 1339 13 is_stmt 1 view .LVU1770
+	.loc 1 1340 13 view .LVU1771
+	.loc 1 1340 13 is_stmt 0 view .LVU1772
+.LBE119:
+	.loc 1 1351 5 is_stmt 1 view .LVU1773
+# console.c:1351:     if (!ok)
+	.loc 1 1351 8 is_stmt 0 view .LVU1774
+	je	.L451	#,
+.LVL742:
+.L452:
+	.loc 1 1352 9 is_stmt 1 view .LVU1775
+	movq	%r12, %rdx	# file_name,
+	leaq	.LC104(%rip), %rsi	#, tmp183
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL743:
+	.loc 1 1354 5 view .LVU1776
+# console.c:1354:     line_source = readline;
+	.loc 1 1354 17 is_stmt 0 view .LVU1777
+	leaq	readline(%rip), %rax	#, tmp252
+	movq	%rax, line_source(%rip)	# tmp252, line_source
+	.loc 1 1355 5 is_stmt 1 view .LVU1778
+	movl	$8, %edx	#,
+	movq	24(%rsp), %rbx	# %sfp, _8
+	movq	%rbx, %rsi	# _8,
+	movq	%r14, %rdi	# cmds,
+	call	free_array@PLT	#
+.LVL744:
+	.loc 1 1356 5 view .LVU1779
+	movq	32(%rsp), %rsi	# %sfp,
+	movq	40(%rsp), %rdi	# %sfp,
+	call	free_block@PLT	#
+.LVL745:
+	.loc 1 1357 5 view .LVU1780
+	movl	$8, %edx	#,
+	movq	%rbx, %rsi	# _8,
+	movq	8(%rsp), %rdi	# %sfp,
+	call	free_array@PLT	#
+.LVL746:
+	.loc 1 1358 5 view .LVU1781
+	movq	%r13, %rsi	# size,
+	movq	%rbp, %rdi	# iftmp.94_64,
+	call	munmap@PLT	#
+.LVL747:
+	.loc 1 1359 5 view .LVU1782
+	jmp	.L457	#
+.LVL748:
+.L467:
+.LBB120:
+	.loc 1 1346 13 view .LVU1783
+# console.c:1346:             cmds[id] = table_find(&cmd_table, argv[0]);
+	.loc 1 1346 24 is_stmt 0 view .LVU1784
+	movq	88(%rsp), %rax	# argv, argv
+	movq	(%rax), %rsi	# *argv.100_30, *argv.100_30
+	movq	%r15, %rdi	# tmp213,
+	call	table_find	#
+.LVL749:
+# console.c:1346:             cmds[id] = table_find(&cmd_table, argv[0]);
+	.loc 1 1346 22 view .LVU1785
+	movq	%rax, 0(%r13)	# tmp222, *_28
+	jmp	.L453	#
+.LVL750:
+.L465:
+	.loc 1 1346 22 view .LVU1786
+.LBE120:
+	movq	16(%rsp), %r13	# %sfp, size
+.LVL751:
+.L451:
+	.loc 1 1354 5 is_stmt 1 view .LVU1787
+# console.c:1354:     line_source = readline;
+	.loc 1 1354 17 is_stmt 0 view .LVU1788
+	leaq	readline(%rip), %rax	#, tmp254
+	movq	%rax, line_source(%rip)	# tmp254, line_source
+	.loc 1 1355 5 is_stmt 1 view .LVU1789
+	movl	$8, %edx	#,
+	movq	24(%rsp), %rbx	# %sfp, _8
+	movq	%rbx, %rsi	# _8,
+	movq	%r14, %rdi	# cmds,
+	call	free_array@PLT	#
+.LVL752:
+	.loc 1 1356 5 view .LVU1790
+	movq	32(%rsp), %rsi	# %sfp,
+	movq	40(%rsp), %rdi	# %sfp,
+	call	free_block@PLT	#
+.LVL753:
+	.loc 1 1357 5 view .LVU1791
+	movl	$8, %edx	#,
+	movq	%rbx, %rsi	# _8,
+	movq	8(%rsp), %rdi	# %sfp,
+	call	free_array@PLT	#
+.LVL754:
+	.loc 1 1358 5 view .LVU1792
+	movq	%r13, %rsi	# size,
+	movq	%rbp, %rdi	# iftmp.94_64,
+	call	munmap@PLT	#
+.LVL755:
+	.loc 1 1359 5 view .LVU1793
+# console.c:1359:     return ok && err_cnt == 0;
+	.loc 1 1359 15 is_stmt 0 view .LVU1794
+	cmpl	$0, err_cnt(%rip)	#, err_cnt
+	sete	%al	#, iftmp.105_45
+	movzbl	%al, %eax	# iftmp.105_45, iftmp.105_45
+	movl	%eax, 4(%rsp)	# iftmp.105_45, %sfp
+.LVL756:
+.L457:
+# console.c:1359:     return ok && err_cnt == 0;
+	.loc 1 1359 15 discriminator 6 view .LVU1795
+	movzbl	4(%rsp), %eax	# %sfp, <retval>
+	andl	$1, %eax	#, <retval>
+	jmp	.L439	#
+.LVL757:
+.L440:
+	.loc 1 1272 9 is_stmt 1 view .LVU1796
+	movq	%r12, %rdx	# file_name,
+	leaq	.LC105(%rip), %rsi	#, tmp186
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL758:
+	.loc 1 1272 9 is_stmt 0 view .LVU1797
+	call	report@PLT	#
+.LVL759:
+	.loc 1 1273 9 is_stmt 1 view .LVU1798
+# console.c:1275:         return false;
+	.loc 1 1275 16 is_stmt 0 view .LVU1799
+	movl	$0, %eax	#, <retval>
+.LVL760:
+.L439:
+# console.c:1360: }
+	.loc 1 1360 1 view .LVU1800
+	addq	$504, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL761:
+.L441:
+	.cfi_restore_state
+	.loc 1 1272 9 is_stmt 1 view .LVU1801
+	movq	%r12, %rdx	# file_name,
+	leaq	.LC105(%rip), %rsi	#, tmp187
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL762:
+	.loc 1 1273 9 view .LVU1802
+	.loc 1 1274 13 view .LVU1803
+	movl	%ebx, %edi	# fd,
+	call	close@PLT	#
+.LVL763:
+# console.c:1275:         return false;
+	.loc 1 1275 16 is_stmt 0 view .LVU1804
+	movl	$0, %eax	#, <retval>
+	jmp	.L439	#
+.LVL764:
+.L446:
+	.loc 1 1323 5 is_stmt 1 view .LVU1805
+# console.c:1323:     bc_code = (uint32_t *) (map + sizeof(bc_header_t));
+	.loc 1 1323 33 is_stmt 0 view .LVU1806
+	leaq	24(%rbp), %rax	#, tmp193
+.LVL765:
+	.loc 1 1323 33 view .LVU1807
+	movq	%rax, bc_code(%rip)	# tmp193, bc_code
+	.loc 1 1324 5 is_stmt 1 view .LVU1808
+# console.c:1324:     bc_code_end = (uint32_t *) (map + header->strtab_offset);
+	.loc 1 1324 17 is_stmt 0 view .LVU1809
+	movq	%rbx, bc_code_end(%rip)	# src, bc_code_end
+	.loc 1 1325 5 is_stmt 1 view .LVU1810
+# console.c:1325:     bc_left = header->ncmds;
+	.loc 1 1325 13 is_stmt 0 view .LVU1811
+	movq	8(%rbp), %rax	# MEM[(struct bc_header_t *)iftmp.94_64].ncmds, MEM[(struct bc_header_t *)iftmp.94_64].ncmds
+	movq	%rax, bc_left(%rip)	# MEM[(struct bc_header_t *)iftmp.94_64].ncmds, bc_left
+	.loc 1 1326 5 is_stmt 1 view .LVU1812
+# console.c:1326:     bc_strings = strings;
+	.loc 1 1326 16 is_stmt 0 view .LVU1813
+	movq	8(%rsp), %rax	# %sfp, strings
+	movq	%rax, bc_strings(%rip)	# strings, bc_strings
+	.loc 1 1327 5 is_stmt 1 view .LVU1814
+# console.c:1327:     bc_nstrings = nstrings;
+	.loc 1 1327 17 is_stmt 0 view .LVU1815
+	movl	%r15d, bc_nstrings(%rip)	# nstrings, bc_nstrings
+	.loc 1 1328 5 is_stmt 1 view .LVU1816
+# console.c:1328:     line_source = next_compiled_line;
+	.loc 1 1328 17 is_stmt 0 view .LVU1817
+	leaq	next_compiled_line(%rip), %rax	#, tmp257
+	movq	%rax, line_source(%rip)	# tmp257, line_source
+	.loc 1 1331 5 is_stmt 1 view .LVU1818
+# console.c:1332:         calloc_or_fail(nstrings + 1, sizeof(cmd_ptr), "run_bytecode");
+	.loc 1 1332 9 is_stmt 0 view .LVU1819
+	leaq	.LC103(%rip), %rdx	#, tmp196
+	movl	$8, %esi	#,
+.LVL766:
+	.loc 1 1332 9 view .LVU1820
+	movq	24(%rsp), %rdi	# %sfp,
+	call	calloc_or_fail@PLT	#
+.LVL767:
+	movq	%rax, %r14	# tmp223, cmds
+.LVL768:
+	.loc 1 1333 5 is_stmt 1 view .LVU1821
+	.loc 1 1333 15 view .LVU1822
+	jmp	.L452	#
+	.cfi_endproc
+.LFE72:
+	.size	run_bytecode, .-run_bytecode
+	.local	bc_nstrings
+	.comm	bc_nstrings,4,4
+	.local	bc_strings
+	.comm	bc_strings,8,8
+	.local	bc_left
+	.comm	bc_left,8,8
+	.local	bc_code_end
+	.comm	bc_code_end,8,8
+	.local	bc_code
+	.comm	bc_code,8,8
+	.section	.data.rel.local,"aw"
+	.align 8
+	.type	line_source, @object
+	.size	line_source, 8
+line_source:
+	.quad	readline
+	.local	cmd_depth
+	.comm	cmd_depth,4,4
+	.local	metrics_helper
+	.comm	metrics_helper,8,8
+	.local	quit_helper_cnt
+	.comm	quit_helper_cnt,4,4
+	.local	quit_helpers
+	.comm	quit_helpers,80,32
+	.local	quit_flag
+	.comm	quit_flag,1,1
+	.local	quit_stats
+	.comm	quit_stats,1,1
+	.local	echo
+	.comm	echo,1,1
+	.local	err_cnt
+	.comm	err_cnt,4,4
+	.data
+	.align 4
+	.type	err_limit, @object
+	.size	err_limit, 4
+err_limit:
+	.long	5
+	.local	fd_max
+	.comm	fd_max,4,4
+	.local	linebuf
+	.comm	linebuf,65537,32
+	.local	buf_stack
+	.comm	buf_stack,8,8
+	.local	last_time
+	.comm	last_time,8,8
+	.local	first_time
+	.comm	first_time,8,8
+	.type	prompt_flag, @object
+	.size	prompt_flag, 1
+prompt_flag:
+	.byte	1
+	.local	param_table
+	.comm	param_table,24,16
+	.local	cmd_table
+	.comm	cmd_table,24,16
+	.local	param_list
+	.comm	param_list,8,8
+	.local	cmd_list
+	.comm	cmd_list,8,8
+	.globl	dudect_sequential
+	.bss
+	.align 4
+	.type	dudect_sequential, @object
+	.size	dudect_sequential, 4
+dudect_sequential:
+	.zero	4
+	.globl	dudect_pool
+	.align 4
+	.type	dudect_pool, @object
+	.size	dudect_pool, 4
+dudect_pool:
+	.zero	4
+	.globl	timing_backend
+	.align 4
+	.type	timing_backend, @object
+	.size	timing_backend, 4
+timing_backend:
+	.zero	4
+	.globl	dudect_workers
+	.data
+	.align 4
+	.type	dudect_workers, @object
+	.size	dudect_workers, 4
+dudect_workers:
+	.long	1
+	.globl	crop_window
+	.bss
+	.align 4
+	.type	crop_window, @object
+	.size	crop_window, 4
+crop_window:
+	.zero	4
+	.globl	total_measurements
+	.data
+	.align 4
+	.type	total_measurements, @object
+	.size	total_measurements, 4
+total_measurements:
+	.long	100000
+	.globl	write_data
+	.bss
+	.type	write_data, @object
+	.size	write_data, 1
+write_data:
+	.zero	1
+	.globl	old_measure
+	.type	old_measure, @object
+	.size	old_measure, 1
+old_measure:
+	.zero	1
+	.globl	simulation
+	.type	simulation, @object
+	.size	simulation, 1
+simulation:
+	.zero	1
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC8:
+	.long	-755914244
+	.long	1062232653
+	.align 8
+.LC9:
+	.long	-400107883
+	.long	1041313291
+	.align 8
+.LC16:
+	.long	0
+	.long	1093567616
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "/usr/include/stdint.h"
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 11 "/usr/include/stdio.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.file 14 "console.h"
+	.file 15 "/usr/include/ctype.h"
+	.file 16 "report.h"
+	.file 17 "/usr/include/string.h"
+	.file 18 "/usr/include/unistd.h"
+	.file 19 "/usr/include/stdlib.h"
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 22 "/usr/include/fcntl.h"
+	.file 23 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x4bf9
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x47
+	.long	.LASF336
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF3
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x34
+	.long	0x3c
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	.LASF9
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x48
+	.uleb128 0x9
+	.long	.LASF10
+	.byte	0x2
+	.byte	0x2c
+	.byte	0x19
+	.long	0x83
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x9
+	.long	.LASF12
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x4f
+	.uleb128 0x9
+	.long	.LASF13
+	.byte	0x2
+	.byte	0x91
+	.byte	0x19
+	.long	0x4f
+	.uleb128 0x9
+	.long	.LASF14
+	.byte	0x2
+	.byte	0x92
+	.byte	0x19
+	.long	0x48
+	.uleb128 0x9
+	.long	.LASF15
+	.byte	0x2
+	.byte	0x93
+	.byte	0x19
+	.long	0x48
+	.uleb128 0x9
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x94
+	.byte	0x19
+	.long	0x4f
+	.uleb128 0x9
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x96
+	.byte	0x1a
+	.long	0x48
+	.uleb128 0x9
+	.long	.LASF18
+	.byte	0x2
+	.byte	0x97
+	.byte	0x1b
+	.long	0x4f
+	.uleb128 0x9
+	.long	.LASF19
+	.byte	0x2
+	.byte	0x98
+	.byte	0x19
+	.long	0x83
+	.uleb128 0x9
+	.long	.LASF20
+	.byte	0x2
+	.byte	0x99
+	.byte	0x1b
+	.long	0x83
+	.uleb128 0x9
+	.long	.LASF21
+	.byte	0x2
+	.byte	0xa0
+	.byte	0x1a
+	.long	0x83
+	.uleb128 0x9
+	.long	.LASF22
+	.byte	0x2
+	.byte	0xa2
+	.byte	0x1f
+	.long	0x83
+	.uleb128 0x49
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF23
+	.byte	0x2
+	.byte	0xaf
+	.byte	0x1d
+	.long	0x83
+	.uleb128 0x9
+	.long	.LASF24
+	.byte	0x2
+	.byte	0xb4
+	.byte	0x1c
+	.long	0x83
+	.uleb128 0x9
+	.long	.LASF25
+	.byte	0x2
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x83
+	.uleb128 0x9
+	.long	.LASF26
+	.byte	0x2
+	.byte	0xc5
+	.byte	0x21
+	.long	0x83
+	.uleb128 0xb
+	.long	0x145
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF27
+	.uleb128 0x34
+	.long	0x145
+	.uleb128 0x35
+	.long	0x48
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x1
+	.long	0x1ae
+	.uleb128 0x19
+	.long	.LASF28
+	.value	0x100
+	.uleb128 0x19
+	.long	.LASF29
+	.value	0x200
+	.uleb128 0x19
+	.long	.LASF30
+	.value	0x400
+	.uleb128 0x19
+	.long	.LASF31
+	.value	0x800
+	.uleb128 0x19
+	.long	.LASF32
+	.value	0x1000
+	.uleb128 0x19
+	.long	.LASF33
+	.value	0x2000
+	.uleb128 0x19
+	.long	.LASF34
+	.value	0x4000
+	.uleb128 0x19
+	.long	.LASF35
+	.value	0x8000
+	.uleb128 0x1c
+	.long	.LASF36
+	.byte	0x1
+	.uleb128 0x1c
+	.long	.LASF37
+	.byte	0x2
+	.uleb128 0x1c
+	.long	.LASF38
+	.byte	0x4
+	.uleb128 0x1c
+	.long	.LASF39
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	0x43
+	.uleb128 0xb
+	.long	0x14c
+	.uleb128 0x20
+	.long	0x1b3
+	.uleb128 0x21
+	.long	.LASF42
+	.byte	0x10
+	.byte	0x3
+	.byte	0xb
+	.long	0x1e4
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x3
+	.byte	0x10
+	.byte	0xc
+	.long	0xf6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF41
+	.byte	0x3
+	.byte	0x15
+	.byte	0x15
+	.long	0x134
+	.byte	0x8
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF43
+	.byte	0x90
+	.byte	0x4
+	.byte	0x1a
+	.long	0x2b4
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0x4
+	.byte	0x1f
+	.byte	0xd
+	.long	0x96
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0x4
+	.byte	0x24
+	.byte	0xd
+	.long	0xba
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0x4
+	.byte	0x2c
+	.byte	0xf
+	.long	0xd2
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc6
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xd
+	.long	0xa2
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF49
+	.byte	0x4
+	.byte	0x30
+	.byte	0xd
+	.long	0xae
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF50
+	.byte	0x4
+	.byte	0x32
+	.byte	0x9
+	.long	0x64
+	.byte	0x24
+	.uleb128 0x4
+	.long	.LASF51
+	.byte	0x4
+	.byte	0x34
+	.byte	0xd
+	.long	0x96
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF52
+	.byte	0x4
+	.byte	0x39
+	.byte	0xd
+	.long	0xde
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x11
+	.long	0x110
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF54
+	.byte	0x4
+	.byte	0x3f
+	.byte	0x10
+	.long	0x11c
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF55
+	.byte	0x4
+	.byte	0x4a
+	.byte	0x15
+	.long	0x1bd
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF56
+	.byte	0x4
+	.byte	0x4b
+	.byte	0x15
+	.long	0x1bd
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF57
+	.byte	0x4
+	.byte	0x4c
+	.byte	0x15
+	.long	0x1bd
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0x4
+	.byte	0x59
+	.byte	0x17
+	.long	0x2b4
+	.byte	0x78
+	.byte	0
+	.uleb128 0x1a
+	.long	0x134
+	.long	0x2c4
+	.uleb128 0x1d
+	.long	0x4f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF59
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x13
+	.long	0x77
+	.uleb128 0x9
+	.long	.LASF60
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x9
+	.long	.LASF61
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x9
+	.long	.LASF62
+	.byte	0x7
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x4f
+	.uleb128 0x9
+	.long	.LASF63
+	.byte	0x8
+	.byte	0xd6
+	.byte	0x17
+	.long	0x4f
+	.uleb128 0x1a
+	.long	0x145
+	.long	0x310
+	.uleb128 0x1d
+	.long	0x4f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF64
+	.byte	0xd8
+	.byte	0x9
+	.byte	0x31
+	.long	0x496
+	.uleb128 0x4
+	.long	.LASF65
+	.byte	0x9
+	.byte	0x33
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF66
+	.byte	0x9
+	.byte	0x36
+	.byte	0x9
+	.long	0x140
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF67
+	.byte	0x9
+	.byte	0x37
+	.byte	0x9
+	.long	0x140
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF68
+	.byte	0x9
+	.byte	0x38
+	.byte	0x9
+	.long	0x140
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF69
+	.byte	0x9
+	.byte	0x39
+	.byte	0x9
+	.long	0x140
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF70
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x9
+	.long	0x140
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF71
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x9
+	.long	0x140
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF72
+	.byte	0x9
+	.byte	0x3c
+	.byte	0x9
+	.long	0x140
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF73
+	.byte	0x9
+	.byte	0x3d
+	.byte	0x9
+	.long	0x140
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0x9
+	.byte	0x40
+	.byte	0x9
+	.long	0x140
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF75
+	.byte	0x9
+	.byte	0x41
+	.byte	0x9
+	.long	0x140
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0x9
+	.byte	0x42
+	.byte	0x9
+	.long	0x140
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0x9
+	.byte	0x44
+	.byte	0x16
+	.long	0x4af
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0x9
+	.byte	0x46
+	.byte	0x14
+	.long	0x4b4
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF79
+	.byte	0x9
+	.byte	0x48
+	.byte	0x7
+	.long	0x64
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF80
+	.byte	0x9
+	.byte	0x49
+	.byte	0x7
+	.long	0x64
+	.byte	0x74
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xb
+	.long	0xde
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF82
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x12
+	.long	0x3c
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF83
+	.byte	0x9
+	.byte	0x4e
+	.byte	0xf
+	.long	0x56
+	.byte	0x82
+	.uleb128 0x4
+	.long	.LASF84
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x8
+	.long	0x4b9
+	.byte	0x83
+	.uleb128 0x4
+	.long	.LASF85
+	.byte	0x9
+	.byte	0x51
+	.byte	0xf
+	.long	0x4c9
+	.byte	0x88
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0x9
+	.byte	0x59
+	.byte	0xd
+	.long	0xea
+	.byte	0x90
+	.uleb128 0x4
+	.long	.LASF87
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x17
+	.long	0x4d3
+	.byte	0x98
+	.uleb128 0x4
+	.long	.LASF88
+	.byte	0x9
+	.byte	0x5c
+	.byte	0x19
+	.long	0x4dd
+	.byte	0xa0
+	.uleb128 0x4
+	.long	.LASF89
+	.byte	0x9
+	.byte	0x5d
+	.byte	0x14
+	.long	0x4b4
+	.byte	0xa8
+	.uleb128 0x4
+	.long	.LASF90
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x9
+	.long	0x10e
+	.byte	0xb0
+	.uleb128 0x4
+	.long	.LASF91
+	.byte	0x9
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2f4
+	.byte	0xb8
+	.uleb128 0x4
+	.long	.LASF92
+	.byte	0x9
+	.byte	0x60
+	.byte	0x7
+	.long	0x64
+	.byte	0xc0
+	.uleb128 0x4
+	.long	.LASF93
+	.byte	0x9
+	.byte	0x62
+	.byte	0x8
+	.long	0x4e2
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF94
+	.byte	0xa
+	.byte	0x7
+	.byte	0x19
+	.long	0x310
+	.uleb128 0x4a
+	.long	.LASF337
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x2d
+	.long	.LASF95
+	.uleb128 0xb
+	.long	0x4aa
+	.uleb128 0xb
+	.long	0x310
+	.uleb128 0x1a
+	.long	0x145
+	.long	0x4c9
+	.uleb128 0x1d
+	.long	0x4f
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x4a2
+	.uleb128 0x2d
+	.long	.LASF96
+	.uleb128 0xb
+	.long	0x4ce
+	.uleb128 0x2d
+	.long	.LASF97
+	.uleb128 0xb
+	.long	0x4d8
+	.uleb128 0x1a
+	.long	0x145
+	.long	0x4f2
+	.uleb128 0x1d
+	.long	0x4f
+	.byte	0x13
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF98
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x13
+	.long	0x128
+	.uleb128 0xb
+	.long	0x496
+	.uleb128 0x20
+	.long	0x4fe
+	.uleb128 0x22
+	.long	.LASF106
+	.byte	0xb
+	.byte	0x90
+	.byte	0xe
+	.long	0x4fe
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF99
+	.uleb128 0x21
+	.long	.LASF100
+	.byte	0x10
+	.byte	0xc
+	.byte	0x8
+	.long	0x542
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0xc
+	.byte	0xe
+	.byte	0xc
+	.long	0xf6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF101
+	.byte	0xc
+	.byte	0xf
+	.byte	0x11
+	.long	0x102
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF102
+	.byte	0xd
+	.byte	0x31
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x2e
+	.byte	0x80
+	.byte	0xd
+	.byte	0x3b
+	.long	0x564
+	.uleb128 0x4
+	.long	.LASF103
+	.byte	0xd
+	.byte	0x43
+	.byte	0xf
+	.long	0x564
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x542
+	.long	0x574
+	.uleb128 0x1d
+	.long	0x4f
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF104
+	.byte	0xd
+	.byte	0x46
+	.byte	0x5
+	.long	0x54e
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF105
+	.uleb128 0xb
+	.long	0x591
+	.uleb128 0x20
+	.long	0x587
+	.uleb128 0x4b
+	.uleb128 0xb
+	.long	0x140
+	.uleb128 0x20
+	.long	0x592
+	.uleb128 0x22
+	.long	.LASF107
+	.byte	0xe
+	.byte	0xa
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF108
+	.uleb128 0x22
+	.long	.LASF109
+	.byte	0xe
+	.byte	0xb
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0x22
+	.long	.LASF110
+	.byte	0xe
+	.byte	0xc
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0x9
+	.long	.LASF111
+	.byte	0xe
+	.byte	0xf
+	.byte	0x10
+	.long	0x5d3
+	.uleb128 0xb
+	.long	0x5d8
+	.uleb128 0x4c
+	.long	0x5a8
+	.long	0x5ec
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x592
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF112
+	.byte	0x40
+	.byte	0xe
+	.byte	0x15
+	.long	0x661
+	.uleb128 0x4
+	.long	.LASF113
+	.byte	0xe
+	.byte	0x16
+	.byte	0xb
+	.long	0x140
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF114
+	.byte	0xe
+	.byte	0x17
+	.byte	0x12
+	.long	0x5c7
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF115
+	.byte	0xe
+	.byte	0x18
+	.byte	0xb
+	.long	0x140
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF116
+	.byte	0xe
+	.byte	0x1a
+	.byte	0xe
+	.long	0x2dc
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF117
+	.byte	0xe
+	.byte	0x1b
+	.byte	0xe
+	.long	0x2dc
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF118
+	.byte	0xe
+	.byte	0x1c
+	.byte	0xe
+	.long	0x2dc
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF119
+	.byte	0xe
+	.byte	0x1d
+	.byte	0xe
+	.long	0x2dc
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF120
+	.byte	0xe
+	.byte	0x1e
+	.byte	0xd
+	.long	0x661
+	.byte	0x38
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF121
+	.byte	0xe
+	.byte	0x14
+	.byte	0x1f
+	.long	0x66d
+	.uleb128 0xb
+	.long	0x5ec
+	.uleb128 0x9
+	.long	.LASF122
+	.byte	0xe
+	.byte	0x22
+	.byte	0x10
+	.long	0x67e
+	.uleb128 0xb
+	.long	0x683
+	.uleb128 0x36
+	.long	0x68e
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF123
+	.byte	0x28
+	.byte	0xe
+	.byte	0x26
+	.long	0x6dc
+	.uleb128 0x4
+	.long	.LASF113
+	.byte	0xe
+	.byte	0x27
+	.byte	0xb
+	.long	0x140
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF124
+	.byte	0xe
+	.byte	0x28
+	.byte	0xa
+	.long	0x6ed
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF115
+	.byte	0xe
+	.byte	0x29
+	.byte	0xb
+	.long	0x140
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF125
+	.byte	0xe
+	.byte	0x2b
+	.byte	0x15
+	.long	0x672
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF120
+	.byte	0xe
+	.byte	0x2c
+	.byte	0xf
+	.long	0x6dc
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF126
+	.byte	0xe
+	.byte	0x25
+	.byte	0x21
+	.long	0x6e8
+	.uleb128 0xb
+	.long	0x68e
+	.uleb128 0xb
+	.long	0x64
+	.uleb128 0x9
+	.long	.LASF127
+	.byte	0xe
+	.byte	0x45
+	.byte	0x10
+	.long	0x6fe
+	.uleb128 0xb
+	.long	0x703
+	.uleb128 0x36
+	.long	0x70e
+	.uleb128 0x3
+	.long	0x5a8
+	.byte	0
+	.uleb128 0x35
+	.long	0x48
+	.byte	0x10
+	.byte	0x10
+	.byte	0xe
+	.long	0x72d
+	.uleb128 0x1c
+	.long	.LASF128
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF129
+	.byte	0x1
+	.uleb128 0x1c
+	.long	.LASF130
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF131
+	.byte	0x10
+	.byte	0x10
+	.byte	0x31
+	.long	0x70e
+	.uleb128 0x22
+	.long	.LASF132
+	.byte	0x10
+	.byte	0x17
+	.byte	0xc
+	.long	0x64
+	.uleb128 0x22
+	.long	.LASF133
+	.byte	0x10
+	.byte	0x1e
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0x2f
+	.long	0x59c
+	.byte	0x15
+	.uleb128 0x9
+	.byte	0x3
+	.quad	simulation
+	.uleb128 0x2f
+	.long	0x5af
+	.byte	0x16
+	.uleb128 0x9
+	.byte	0x3
+	.quad	old_measure
+	.uleb128 0x2f
+	.long	0x5bb
+	.byte	0x17
+	.uleb128 0x9
+	.byte	0x3
+	.quad	write_data
+	.uleb128 0x23
+	.long	.LASF134
+	.byte	0x18
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	total_measurements
+	.uleb128 0x23
+	.long	.LASF135
+	.byte	0x19
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crop_window
+	.uleb128 0x23
+	.long	.LASF136
+	.byte	0x1a
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dudect_workers
+	.uleb128 0x23
+	.long	.LASF137
+	.byte	0x1b
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timing_backend
+	.uleb128 0x23
+	.long	.LASF138
+	.byte	0x1c
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dudect_pool
+	.uleb128 0x23
+	.long	.LASF139
+	.byte	0x1d
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dudect_sequential
+	.uleb128 0xd
+	.long	.LASF140
+	.byte	0x1e
+	.byte	0x10
+	.long	0x661
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmd_list
+	.uleb128 0xd
+	.long	.LASF141
+	.byte	0x1f
+	.byte	0x12
+	.long	0x6dc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_list
+	.uleb128 0x2e
+	.byte	0x10
+	.byte	0x1
+	.byte	0x27
+	.long	0x845
+	.uleb128 0x4
+	.long	.LASF113
+	.byte	0x1
+	.byte	0x28
+	.byte	0xb
+	.long	0x140
+	.byte	0
+	.uleb128 0x24
+	.string	"ele"
+	.byte	0x29
+	.byte	0xb
+	.long	0x10e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF142
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x3
+	.long	0x823
+	.uleb128 0x2e
+	.byte	0x18
+	.byte	0x1
+	.byte	0x2c
+	.long	0x880
+	.uleb128 0x4
+	.long	.LASF143
+	.byte	0x1
+	.byte	0x2d
+	.byte	0xd
+	.long	0x880
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF144
+	.byte	0x1
+	.byte	0x2e
+	.byte	0xc
+	.long	0x2f4
+	.byte	0x8
+	.uleb128 0x24
+	.string	"cnt"
+	.byte	0x2f
+	.byte	0xc
+	.long	0x2f4
+	.byte	0x10
+	.byte	0
+	.uleb128 0xb
+	.long	0x845
+	.uleb128 0x9
+	.long	.LASF145
+	.byte	0x1
+	.byte	0x30
+	.byte	0x3
+	.long	0x851
+	.uleb128 0xd
+	.long	.LASF146
+	.byte	0x32
+	.byte	0x15
+	.long	0x885
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmd_table
+	.uleb128 0xd
+	.long	.LASF147
+	.byte	0x33
+	.byte	0x15
+	.long	0x885
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_table
+	.uleb128 0x30
+	.long	.LASF149
+	.byte	0x34
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0xd
+	.long	.LASF148
+	.byte	0x35
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	prompt_flag
+	.uleb128 0x30
+	.long	.LASF150
+	.byte	0x38
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0xd
+	.long	.LASF151
+	.byte	0x3b
+	.byte	0xf
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	first_time
+	.uleb128 0xd
+	.long	.LASF152
+	.byte	0x3c
+	.byte	0xf
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	last_time
+	.uleb128 0x4d
+	.long	.LASF153
+	.long	0x10040
+	.byte	0x1
+	.byte	0x49
+	.byte	0x8
+	.long	0x99b
+	.uleb128 0x24
+	.string	"fd"
+	.byte	0x4a
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x24
+	.string	"cnt"
+	.byte	0x4b
+	.byte	0x9
+	.long	0x64
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF154
+	.byte	0x1
+	.byte	0x4c
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF155
+	.byte	0x1
+	.byte	0x4d
+	.byte	0xb
+	.long	0x140
+	.byte	0x10
+	.uleb128 0x24
+	.string	"buf"
+	.byte	0x4e
+	.byte	0xa
+	.long	0x9ac
+	.byte	0x18
+	.uleb128 0x4e
+	.string	"map"
+	.byte	0x1
+	.byte	0x4f
+	.byte	0xb
+	.long	0x140
+	.long	0x10020
+	.uleb128 0x31
+	.long	.LASF156
+	.byte	0x50
+	.byte	0xb
+	.long	0x140
+	.long	0x10028
+	.uleb128 0x31
+	.long	.LASF157
+	.byte	0x51
+	.byte	0xc
+	.long	0x2e
+	.long	0x10030
+	.uleb128 0x31
+	.long	.LASF158
+	.byte	0x52
+	.byte	0xd
+	.long	0x99b
+	.long	0x10038
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF159
+	.byte	0x1
+	.byte	0x47
+	.byte	0x20
+	.long	0x9a7
+	.uleb128 0xb
+	.long	0x910
+	.uleb128 0x1a
+	.long	0x145
+	.long	0x9bf
+	.uleb128 0x4f
+	.long	0x4f
+	.long	0x10000
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF160
+	.byte	0x55
+	.byte	0x10
+	.long	0x99b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	buf_stack
+	.uleb128 0xd
+	.long	.LASF161
+	.byte	0x5b
+	.byte	0xd
+	.long	0x9ac
+	.uleb128 0x9
+	.byte	0x3
+	.quad	linebuf
+	.uleb128 0xd
+	.long	.LASF162
+	.byte	0x5e
+	.byte	0xc
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fd_max
+	.uleb128 0xd
+	.long	.LASF163
+	.byte	0x61
+	.byte	0xc
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	err_limit
+	.uleb128 0xd
+	.long	.LASF164
+	.byte	0x62
+	.byte	0xc
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	err_cnt
+	.uleb128 0xd
+	.long	.LASF165
+	.byte	0x63
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	echo
+	.uleb128 0xd
+	.long	.LASF166
+	.byte	0x64
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quit_stats
+	.uleb128 0xd
+	.long	.LASF167
+	.byte	0x66
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quit_flag
+	.uleb128 0x30
+	.long	.LASF168
+	.byte	0x67
+	.byte	0xe
+	.long	0x140
+	.uleb128 0x1a
+	.long	0x5c7
+	.long	0xa82
+	.uleb128 0x1d
+	.long	0x4f
+	.byte	0x9
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF169
+	.byte	0x6d
+	.byte	0x15
+	.long	0xa72
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quit_helpers
+	.uleb128 0xd
+	.long	.LASF170
+	.byte	0x6e
+	.byte	0xc
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quit_helper_cnt
+	.uleb128 0xd
+	.long	.LASF171
+	.byte	0x70
+	.byte	0x19
+	.long	0x6f2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	metrics_helper
+	.uleb128 0xd
+	.long	.LASF172
+	.byte	0x72
+	.byte	0xc
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmd_depth
+	.uleb128 0x50
+	.long	0x140
+	.long	0xae1
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF173
+	.byte	0x87
+	.byte	0x10
+	.long	0xaf6
+	.uleb128 0x9
+	.byte	0x3
+	.quad	line_source
+	.uleb128 0xb
+	.long	0xad6
+	.uleb128 0x51
+	.long	.LASF174
+	.byte	0x40
+	.byte	0x1
+	.value	0x2a3
+	.byte	0x8
+	.long	0xb72
+	.uleb128 0x37
+	.string	"cmd"
+	.value	0x2a4
+	.byte	0xd
+	.long	0x661
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF175
+	.value	0x2a5
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x14
+	.long	.LASF176
+	.value	0x2a6
+	.byte	0xc
+	.long	0x592
+	.byte	0x10
+	.uleb128 0x14
+	.long	.LASF177
+	.value	0x2a7
+	.byte	0xb
+	.long	0x140
+	.byte	0x18
+	.uleb128 0x37
+	.string	"len"
+	.value	0x2a8
+	.byte	0xc
+	.long	0x2f4
+	.byte	0x20
+	.uleb128 0x14
+	.long	.LASF178
+	.value	0x2a9
+	.byte	0x9
+	.long	0x64
+	.byte	0x28
+	.uleb128 0x14
+	.long	.LASF179
+	.value	0x2aa
+	.byte	0xe
+	.long	0xb72
+	.byte	0x30
+	.uleb128 0x14
+	.long	.LASF120
+	.value	0x2ab
+	.byte	0xe
+	.long	0xb72
+	.byte	0x38
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF180
+	.value	0x2a2
+	.byte	0x20
+	.long	0xb7e
+	.uleb128 0xb
+	.long	0xafb
+	.uleb128 0x52
+	.byte	0x18
+	.byte	0x1
+	.value	0x434
+	.byte	0x9
+	.long	0xbc2
+	.uleb128 0x14
+	.long	.LASF181
+	.value	0x435
+	.byte	0xa
+	.long	0x300
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF182
+	.value	0x436
+	.byte	0xe
+	.long	0x2d0
+	.byte	0x4
+	.uleb128 0x14
+	.long	.LASF183
+	.value	0x437
+	.byte	0xe
+	.long	0x2dc
+	.byte	0x8
+	.uleb128 0x14
+	.long	.LASF184
+	.value	0x438
+	.byte	0xe
+	.long	0x2dc
+	.byte	0x10
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF185
+	.value	0x439
+	.byte	0x3
+	.long	0xb83
+	.uleb128 0xe
+	.long	.LASF186
+	.value	0x4b5
+	.byte	0x12
+	.long	0xbe4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bc_code
+	.uleb128 0xb
+	.long	0x2d0
+	.uleb128 0xe
+	.long	.LASF187
+	.value	0x4b6
+	.byte	0x12
+	.long	0xbe4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bc_code_end
+	.uleb128 0xe
+	.long	.LASF188
+	.value	0x4b7
+	.byte	0x11
+	.long	0x2dc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bc_left
+	.uleb128 0xe
+	.long	.LASF189
+	.value	0x4b8
+	.byte	0xf
+	.long	0x592
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bc_strings
+	.uleb128 0xe
+	.long	.LASF190
+	.value	0x4b9
+	.byte	0x11
+	.long	0x2d0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bc_nstrings
+	.uleb128 0x13
+	.long	.LASF191
+	.byte	0xb
+	.value	0x17a
+	.byte	0xc
+	.long	0x64
+	.long	0xc63
+	.uleb128 0x3
+	.long	0x140
+	.uleb128 0x3
+	.long	0x2f4
+	.uleb128 0x3
+	.long	0x1b3
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF192
+	.byte	0x11
+	.byte	0x40
+	.byte	0xc
+	.long	0x64
+	.long	0xc83
+	.uleb128 0x3
+	.long	0x587
+	.uleb128 0x3
+	.long	0x587
+	.uleb128 0x3
+	.long	0x2f4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF193
+	.byte	0x12
+	.value	0x35a
+	.byte	0xc
+	.long	0x64
+	.long	0xc9a
+	.uleb128 0x3
+	.long	0x1b3
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF194
+	.byte	0xb
+	.value	0x316
+	.byte	0xc
+	.long	0x64
+	.long	0xcb1
+	.uleb128 0x3
+	.long	0x4fe
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF195
+	.byte	0xb
+	.value	0x2e0
+	.byte	0xc
+	.long	0x64
+	.long	0xcd2
+	.uleb128 0x3
+	.long	0x4fe
+	.uleb128 0x3
+	.long	0xde
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF205
+	.byte	0x44
+	.long	0xce2
+	.uleb128 0x3
+	.long	0x140
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF196
+	.byte	0xb
+	.value	0x2e5
+	.byte	0x10
+	.long	0xde
+	.long	0xcf9
+	.uleb128 0x3
+	.long	0x4fe
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF197
+	.byte	0xb
+	.value	0x2a9
+	.byte	0xf
+	.long	0x2f4
+	.long	0xd1f
+	.uleb128 0x3
+	.long	0x58c
+	.uleb128 0x3
+	.long	0x2f4
+	.uleb128 0x3
+	.long	0x2f4
+	.uleb128 0x3
+	.long	0x503
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF198
+	.byte	0x11
+	.byte	0x3d
+	.byte	0xe
+	.long	0x10e
+	.long	0xd3f
+	.uleb128 0x3
+	.long	0x10e
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x2f4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF199
+	.byte	0xb
+	.byte	0xb2
+	.byte	0xc
+	.long	0x64
+	.long	0xd55
+	.uleb128 0x3
+	.long	0x4fe
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF200
+	.byte	0xb
+	.value	0x102
+	.byte	0xe
+	.long	0x4fe
+	.long	0xd71
+	.uleb128 0x3
+	.long	0x1b8
+	.uleb128 0x3
+	.long	0x1b8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF201
+	.byte	0xd
+	.byte	0x66
+	.byte	0xc
+	.long	0x64
+	.long	0xd9b
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0xda0
+	.uleb128 0x3
+	.long	0xda0
+	.uleb128 0x3
+	.long	0xda0
+	.uleb128 0x3
+	.long	0xdaa
+	.byte	0
+	.uleb128 0xb
+	.long	0x574
+	.uleb128 0x20
+	.long	0xd9b
+	.uleb128 0xb
+	.long	0x51b
+	.uleb128 0x20
+	.long	0xda5
+	.uleb128 0xc
+	.long	.LASF202
+	.byte	0xb
+	.byte	0xe6
+	.byte	0xc
+	.long	0x64
+	.long	0xdc5
+	.uleb128 0x3
+	.long	0x4fe
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF203
+	.byte	0xb
+	.value	0x164
+	.byte	0xc
+	.long	0x64
+	.long	0xddd
+	.uleb128 0x3
+	.long	0x1b3
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF204
+	.byte	0x13
+	.byte	0xb1
+	.byte	0x11
+	.long	0x83
+	.long	0xdfd
+	.uleb128 0x3
+	.long	0x1b8
+	.uleb128 0x3
+	.long	0x597
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF206
+	.byte	0x2c
+	.long	0xe13
+	.uleb128 0x3
+	.long	0x72d
+	.uleb128 0x3
+	.long	0x140
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF207
+	.byte	0x14
+	.byte	0x5e
+	.byte	0xc
+	.long	0x64
+	.long	0xe33
+	.uleb128 0x3
+	.long	0x10e
+	.uleb128 0x3
+	.long	0x2f4
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF208
+	.byte	0x14
+	.byte	0x39
+	.byte	0xe
+	.long	0x10e
+	.long	0xe62
+	.uleb128 0x3
+	.long	0x10e
+	.uleb128 0x3
+	.long	0x2f4
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0xde
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF209
+	.byte	0x15
+	.byte	0xd2
+	.byte	0xc
+	.long	0x64
+	.long	0xe7d
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0xe7d
+	.byte	0
+	.uleb128 0xb
+	.long	0x1e4
+	.uleb128 0xc
+	.long	.LASF210
+	.byte	0x16
+	.byte	0xb5
+	.byte	0xc
+	.long	0x64
+	.long	0xe9e
+	.uleb128 0x3
+	.long	0x1b3
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF211
+	.byte	0x10
+	.byte	0x15
+	.byte	0x6
+	.long	0x5a8
+	.long	0xeb4
+	.uleb128 0x3
+	.long	0x140
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF234
+	.byte	0x66
+	.long	0xec0
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF212
+	.byte	0x63
+	.long	0xed5
+	.uleb128 0x3
+	.long	0x140
+	.uleb128 0x3
+	.long	0x5a8
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF213
+	.byte	0x61
+	.long	0xeea
+	.uleb128 0x3
+	.long	0x140
+	.uleb128 0x3
+	.long	0x2c4
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF214
+	.byte	0x50
+	.byte	0xa
+	.long	0x2dc
+	.long	0xefb
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF215
+	.byte	0x5f
+	.long	0xf10
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x592
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF216
+	.byte	0x5c
+	.byte	0x6
+	.long	0x5a8
+	.long	0xf21
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF217
+	.byte	0x41
+	.long	0xf3b
+	.uleb128 0x3
+	.long	0x10e
+	.uleb128 0x3
+	.long	0x2f4
+	.uleb128 0x3
+	.long	0x2f4
+	.byte	0
+	.uleb128 0x53
+	.long	.LASF338
+	.byte	0xf
+	.byte	0x4f
+	.byte	0x23
+	.long	0xf47
+	.uleb128 0xb
+	.long	0x1ae
+	.uleb128 0x15
+	.long	.LASF218
+	.byte	0x32
+	.long	0xf62
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x140
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF219
+	.byte	0x12
+	.value	0x166
+	.byte	0xc
+	.long	0x64
+	.long	0xf79
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF220
+	.byte	0x14
+	.byte	0x4c
+	.byte	0xc
+	.long	0x64
+	.long	0xf94
+	.uleb128 0x3
+	.long	0x10e
+	.uleb128 0x3
+	.long	0x2f4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF221
+	.byte	0x10
+	.byte	0x4d
+	.byte	0x8
+	.long	0x2e
+	.long	0xfaa
+	.uleb128 0x3
+	.long	0xfaa
+	.byte	0
+	.uleb128 0xb
+	.long	0x2e
+	.uleb128 0xc
+	.long	.LASF222
+	.byte	0x11
+	.byte	0x6b
+	.byte	0xe
+	.long	0x10e
+	.long	0xfcf
+	.uleb128 0x3
+	.long	0x587
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x2f4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF223
+	.byte	0x12
+	.value	0x173
+	.byte	0x10
+	.long	0x4f2
+	.long	0xff0
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x10e
+	.uleb128 0x3
+	.long	0x2f4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF224
+	.byte	0x11
+	.byte	0x2f
+	.byte	0xe
+	.long	0x10e
+	.long	0x1010
+	.uleb128 0x3
+	.long	0x10e
+	.uleb128 0x3
+	.long	0x587
+	.uleb128 0x3
+	.long	0x2f4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF225
+	.byte	0x11
+	.byte	0x2b
+	.byte	0xe
+	.long	0x10e
+	.long	0x1030
+	.uleb128 0x3
+	.long	0x10e
+	.uleb128 0x3
+	.long	0x587
+	.uleb128 0x3
+	.long	0x2f4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF226
+	.byte	0x10
+	.byte	0x38
+	.byte	0x7
+	.long	0x10e
+	.long	0x1050
+	.uleb128 0x3
+	.long	0x2f4
+	.uleb128 0x3
+	.long	0x2f4
+	.uleb128 0x3
+	.long	0x140
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF227
+	.byte	0x10
+	.byte	0x35
+	.byte	0x7
+	.long	0x10e
+	.long	0x106b
+	.uleb128 0x3
+	.long	0x2f4
+	.uleb128 0x3
+	.long	0x140
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF228
+	.byte	0x3e
+	.long	0x1080
+	.uleb128 0x3
+	.long	0x10e
+	.uleb128 0x3
+	.long	0x2f4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF229
+	.byte	0x10
+	.byte	0x3b
+	.byte	0x7
+	.long	0x140
+	.long	0x109b
+	.uleb128 0x3
+	.long	0x140
+	.uleb128 0x3
+	.long	0x140
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF230
+	.byte	0x11
+	.value	0x197
+	.byte	0xf
+	.long	0x2f4
+	.long	0x10b2
+	.uleb128 0x3
+	.long	0x1b3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF231
+	.byte	0x11
+	.byte	0x9c
+	.byte	0xc
+	.long	0x64
+	.long	0x10cd
+	.uleb128 0x3
+	.long	0x1b3
+	.uleb128 0x3
+	.long	0x1b3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF232
+	.byte	0x2f
+	.long	0x10e3
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x140
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF233
+	.byte	0x10
+	.byte	0x5a
+	.byte	0x6
+	.long	0x5a8
+	.long	0x10f9
+	.uleb128 0x3
+	.long	0x140
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF235
+	.byte	0x5b
+	.long	0x1105
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF236
+	.byte	0x21
+	.long	0x1111
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF237
+	.byte	0x49
+	.long	0x1121
+	.uleb128 0x3
+	.long	0xfaa
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF246
+	.value	0x4f3
+	.byte	0x6
+	.long	0x5a8
+	.quad	.LFB72
+	.quad	.LFE72-.LFB72
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x174c
+	.uleb128 0x6
+	.long	.LASF244
+	.value	0x4f3
+	.byte	0x19
+	.long	0x140
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0x8
+	.string	"fd"
+	.value	0x4f5
+	.byte	0x9
+	.long	0x64
+	.long	.LLST205
+	.long	.LVUS205
+	.uleb128 0x1e
+	.string	"st"
+	.value	0x4f6
+	.byte	0x11
+	.long	0x1e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x7
+	.long	.LASF144
+	.value	0x4fe
+	.byte	0xc
+	.long	0x2f4
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0x8
+	.string	"map"
+	.value	0x4ff
+	.byte	0xb
+	.long	0x140
+	.long	.LLST207
+	.long	.LVUS207
+	.uleb128 0x7
+	.long	.LASF238
+	.value	0x503
+	.byte	0x12
+	.long	0x174c
+	.long	.LLST208
+	.long	.LVUS208
+	.uleb128 0x7
+	.long	.LASF182
+	.value	0x510
+	.byte	0xe
+	.long	0x2d0
+	.long	.LLST209
+	.long	.LVUS209
+	.uleb128 0x7
+	.long	.LASF239
+	.value	0x511
+	.byte	0xc
+	.long	0x2f4
+	.long	.LLST210
+	.long	.LVUS210
+	.uleb128 0x7
+	.long	.LASF240
+	.value	0x512
+	.byte	0xc
+	.long	0x592
+	.long	.LLST211
+	.long	.LVUS211
+	.uleb128 0x7
+	.long	.LASF241
+	.value	0x514
+	.byte	0xb
+	.long	0x140
+	.long	.LLST212
+	.long	.LVUS212
+	.uleb128 0x8
+	.string	"src"
+	.value	0x515
+	.byte	0xb
+	.long	0x140
+	.long	.LLST213
+	.long	.LVUS213
+	.uleb128 0x8
+	.string	"dst"
+	.value	0x516
+	.byte	0xb
+	.long	0x140
+	.long	.LLST214
+	.long	.LVUS214
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x517
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST215
+	.long	.LVUS215
+	.uleb128 0x7
+	.long	.LASF242
+	.value	0x533
+	.byte	0xe
+	.long	0x1751
+	.long	.LLST216
+	.long	.LVUS216
+	.uleb128 0x10
+	.long	.LLRL217
+	.long	0x12aa
+	.uleb128 0x8
+	.string	"i"
+	.value	0x518
+	.byte	0x13
+	.long	0x2d0
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x16
+	.long	.LLRL219
+	.uleb128 0x8
+	.string	"len"
+	.value	0x519
+	.byte	0x12
+	.long	0x2d0
+	.long	.LLST220
+	.long	.LVUS220
+	.uleb128 0x5
+	.quad	.LVL714
+	.long	0x4bf1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LLRL221
+	.long	0x1383
+	.uleb128 0xe
+	.long	.LASF243
+	.value	0x536
+	.byte	0xf
+	.long	0x1756
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -464
+	.uleb128 0xe
+	.long	.LASF176
+	.value	0x537
+	.byte	0x10
+	.long	0x592
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -472
+	.uleb128 0x8
+	.string	"rec"
+	.value	0x538
+	.byte	0x13
+	.long	0xbe4
+	.long	.LLST222
+	.long	.LVUS222
+	.uleb128 0x7
+	.long	.LASF175
+	.value	0x539
+	.byte	0xd
+	.long	0x64
+	.long	.LLST223
+	.long	.LVUS223
+	.uleb128 0x8
+	.string	"id"
+	.value	0x540
+	.byte	0x12
+	.long	0x2d0
+	.long	.LLST224
+	.long	.LVUS224
+	.uleb128 0x2
+	.quad	.LVL732
+	.long	0x1868
+	.long	0x1327
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -472
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL738
+	.long	0x3d8d
+	.long	0x1345
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL739
+	.long	0xf21
+	.long	0x136e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL749
+	.long	0x4ab2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL687
+	.long	0xe82
+	.long	0x13a0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL688
+	.long	0xe62
+	.long	0x13bf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL691
+	.long	0xf62
+	.long	0x13d7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL692
+	.long	0x10cd
+	.long	0x1401
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC106
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL693
+	.long	0xe33
+	.long	0x1433
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL695
+	.long	0xf62
+	.long	0x144b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL696
+	.long	0xc63
+	.long	0x1475
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL697
+	.long	0x10cd
+	.long	0x149f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC106
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL698
+	.long	0xf79
+	.long	0x14bd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL699
+	.long	0xe13
+	.long	0x14e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL703
+	.long	0x1030
+	.long	0x1505
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -536
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL706
+	.long	0x1050
+	.long	0x1525
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL721
+	.long	0x1030
+	.long	0x1551
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -536
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC103
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL727
+	.long	0x1030
+	.long	0x157d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -536
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC103
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL743
+	.long	0x10cd
+	.long	0x15a7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC104
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL744
+	.long	0xf21
+	.long	0x15ca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL745
+	.long	0x106b
+	.long	0x15ec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -520
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL746
+	.long	0xf21
+	.long	0x1611
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -552
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL747
+	.long	0xf79
+	.long	0x162f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL752
+	.long	0xf21
+	.long	0x1652
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL753
+	.long	0x106b
+	.long	0x1674
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -520
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL754
+	.long	0xf21
+	.long	0x1699
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -552
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL755
+	.long	0xf79
+	.long	0x16b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL759
+	.long	0x10cd
+	.long	0x16e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC105
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL762
+	.long	0x10cd
+	.long	0x170b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC105
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL763
+	.long	0xf62
+	.long	0x1723
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL767
+	.long	0x1030
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -536
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC103
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0xbc2
+	.uleb128 0xb
+	.long	0x661
+	.uleb128 0x1a
+	.long	0x140
+	.long	0x1766
+	.uleb128 0x1d
+	.long	0x4f
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF270
+	.value	0x4e1
+	.long	0x140
+	.quad	.LFB71
+	.quad	.LFE71-.LFB71
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1868
+	.uleb128 0xe
+	.long	.LASF243
+	.value	0x4e3
+	.byte	0xb
+	.long	0x1756
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0xe
+	.long	.LASF176
+	.value	0x4e4
+	.byte	0xc
+	.long	0x592
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x7
+	.long	.LASF175
+	.value	0x4e5
+	.byte	0x9
+	.long	0x64
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x8
+	.string	"pos"
+	.value	0x4e9
+	.byte	0xc
+	.long	0x2f4
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x10
+	.long	.LLRL119
+	.long	0x1829
+	.uleb128 0x8
+	.string	"i"
+	.value	0x4eb
+	.byte	0xe
+	.long	0x64
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x5
+	.quad	.LVL377
+	.long	0xc41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0xc
+	.long	0x10001
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x17
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x3
+	.quad	.LC22
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL373
+	.long	0x1868
+	.long	0x1842
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL382
+	.long	0xf21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF275
+	.value	0x4c1
+	.byte	0xc
+	.long	0x64
+	.quad	.LFB70
+	.quad	.LFE70-.LFB70
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1999
+	.uleb128 0x6
+	.long	.LASF245
+	.value	0x4c1
+	.byte	0x22
+	.long	0x1999
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x7
+	.long	.LASF175
+	.value	0x4c7
+	.byte	0xe
+	.long	0x2d0
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x10
+	.long	.LLRL77
+	.long	0x18e7
+	.uleb128 0x8
+	.string	"i"
+	.value	0x4cd
+	.byte	0x13
+	.long	0x2d0
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x5
+	.quad	.LVL237
+	.long	0xf21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LLRL79
+	.long	0x192a
+	.uleb128 0x8
+	.string	"i"
+	.value	0x4d9
+	.byte	0x17
+	.long	0x2d0
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x5
+	.quad	.LVL242
+	.long	0xf4c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x10
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL230
+	.long	0x1030
+	.long	0x1954
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL239
+	.long	0xf4c
+	.long	0x1978
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL243
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x592
+	.uleb128 0x25
+	.long	.LASF247
+	.value	0x457
+	.byte	0x6
+	.long	0x5a8
+	.quad	.LFB69
+	.quad	.LFE69-.LFB69
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2111
+	.uleb128 0x6
+	.long	.LASF248
+	.value	0x457
+	.byte	0x19
+	.long	0x140
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x6
+	.long	.LASF249
+	.value	0x457
+	.byte	0x2c
+	.long	0x140
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x8
+	.string	"out"
+	.value	0x459
+	.byte	0xb
+	.long	0x4fe
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0xe
+	.long	.LASF238
+	.value	0x464
+	.byte	0x11
+	.long	0xbc2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0xe
+	.long	.LASF250
+	.value	0x469
+	.byte	0x12
+	.long	0x885
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x7
+	.long	.LASF240
+	.value	0x46a
+	.byte	0xc
+	.long	0x592
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x8
+	.string	"cap"
+	.value	0x46b
+	.byte	0xc
+	.long	0x2f4
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x46c
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x7
+	.long	.LASF251
+	.value	0x46d
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x10
+	.long	.LLRL186
+	.long	0x1e4a
+	.uleb128 0x7
+	.long	.LASF177
+	.value	0x471
+	.byte	0xf
+	.long	0x140
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0xe
+	.long	.LASF243
+	.value	0x475
+	.byte	0xf
+	.long	0x1756
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0x7
+	.long	.LASF176
+	.value	0x476
+	.byte	0x10
+	.long	0x592
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0x1e
+	.string	"end"
+	.value	0x477
+	.byte	0xf
+	.long	0x140
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0x7
+	.long	.LASF175
+	.value	0x478
+	.byte	0xd
+	.long	0x64
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x10
+	.long	.LLRL190
+	.long	0x1cd9
+	.uleb128 0xe
+	.long	.LASF252
+	.value	0x48b
+	.byte	0x16
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -396
+	.uleb128 0x10
+	.long	.LLRL191
+	.long	0x1cb3
+	.uleb128 0x8
+	.string	"i"
+	.value	0x48d
+	.byte	0x16
+	.long	0x64
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0x3b
+	.long	0x2111
+	.quad	.LBI102
+	.byte	.LVU1514
+	.long	.LLRL193
+	.value	0x48e
+	.byte	0x18
+	.long	0x1c8d
+	.uleb128 0x1f
+	.long	0x2151
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x1f
+	.long	0x2145
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0x1f
+	.long	0x2139
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x1f
+	.long	0x212d
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x1f
+	.long	0x2121
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0x16
+	.long	.LLRL193
+	.uleb128 0x18
+	.long	0x215b
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x18
+	.long	0x2166
+	.long	.LLST200
+	.long	.LVUS200
+	.uleb128 0x54
+	.long	0x2172
+	.quad	.LBB104
+	.quad	.LBE104-.LBB104
+	.long	0x1c26
+	.uleb128 0x18
+	.long	0x2173
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x18
+	.long	0x217f
+	.long	.LLST202
+	.long	.LVUS202
+	.uleb128 0x2
+	.quad	.LVL634
+	.long	0x1030
+	.long	0x1bda
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC99
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL636
+	.long	0x4bf1
+	.long	0x1c04
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL637
+	.long	0xf21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL617
+	.long	0x1080
+	.long	0x1c4b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC99
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL624
+	.long	0x497a
+	.long	0x1c70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 1
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL630
+	.long	0x4ab2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL625
+	.long	0xcf9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -396
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL659
+	.long	0xcf9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -396
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL603
+	.long	0x1030
+	.long	0x1d09
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC98
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL605
+	.long	0x3fd4
+	.long	0x1d27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL606
+	.long	0x10b2
+	.long	0x1d46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL607
+	.long	0x2944
+	.uleb128 0x2
+	.quad	.LVL609
+	.long	0x10cd
+	.long	0x1d77
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL613
+	.long	0x10cd
+	.long	0x1da1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL647
+	.long	0xf21
+	.long	0x1dca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL649
+	.long	0x2480
+	.uleb128 0x2
+	.quad	.LVL653
+	.long	0x4077
+	.long	0x1e03
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL657
+	.long	0x10b2
+	.long	0x1e28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL658
+	.long	0x4ab2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmd_table
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.quad	.LBB111
+	.quad	.LBE111-.LBB111
+	.long	0x1ef3
+	.uleb128 0x8
+	.string	"i"
+	.value	0x49a
+	.byte	0x13
+	.long	0x2d0
+	.long	.LLST203
+	.long	.LVUS203
+	.uleb128 0x3c
+	.quad	.LBB112
+	.quad	.LBE112-.LBB112
+	.uleb128 0x1e
+	.string	"len"
+	.value	0x49b
+	.byte	0x12
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0xa
+	.quad	.LVL665
+	.long	0x109b
+	.uleb128 0x2
+	.quad	.LVL666
+	.long	0xcf9
+	.long	0x1ec7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL667
+	.long	0xcf9
+	.long	0x1ee4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL668
+	.long	0xcd2
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL591
+	.long	0xd55
+	.long	0x1f18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC96
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL592
+	.long	0x2944
+	.long	0x1f30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL593
+	.long	0xcf9
+	.long	0x1f59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL598
+	.long	0x10cd
+	.long	0x1f83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC97
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL600
+	.long	0x10cd
+	.long	0x1fad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL601
+	.long	0xd3f
+	.long	0x1fc5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL662
+	.long	0xce2
+	.long	0x1fdd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL671
+	.long	0xf21
+	.long	0x2002
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL672
+	.long	0x4937
+	.long	0x201b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL673
+	.long	0xcb1
+	.long	0x203d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL674
+	.long	0xcf9
+	.long	0x2066
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL675
+	.long	0xc9a
+	.long	0x207e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL677
+	.long	0xd3f
+	.long	0x2096
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL679
+	.long	0x10cd
+	.long	0x20ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC101
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL682
+	.long	0x10cd
+	.long	0x20e4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC100
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL683
+	.long	0xd3f
+	.long	0x20fc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL685
+	.long	0xc83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF272
+	.value	0x43c
+	.byte	0x11
+	.long	0x2d0
+	.long	0x218d
+	.uleb128 0x27
+	.long	.LASF250
+	.value	0x43c
+	.byte	0x26
+	.long	0x218d
+	.uleb128 0x27
+	.long	.LASF253
+	.value	0x43d
+	.byte	0x20
+	.long	0x1999
+	.uleb128 0x27
+	.long	.LASF254
+	.value	0x43e
+	.byte	0x20
+	.long	0x2192
+	.uleb128 0x27
+	.long	.LASF255
+	.value	0x43f
+	.byte	0x22
+	.long	0xbe4
+	.uleb128 0x3e
+	.string	"s"
+	.value	0x440
+	.byte	0x1e
+	.long	0x140
+	.uleb128 0x28
+	.string	"id"
+	.value	0x442
+	.byte	0xf
+	.long	0x2e8
+	.uleb128 0x29
+	.long	.LASF256
+	.value	0x450
+	.byte	0xb
+	.long	0x140
+	.uleb128 0x55
+	.uleb128 0x28
+	.string	"cap"
+	.value	0x447
+	.byte	0x10
+	.long	0x2f4
+	.uleb128 0x29
+	.long	.LASF240
+	.value	0x448
+	.byte	0x10
+	.long	0x592
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x885
+	.uleb128 0xb
+	.long	0x2f4
+	.uleb128 0x25
+	.long	.LASF257
+	.value	0x41f
+	.byte	0x6
+	.long	0x5a8
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2258
+	.uleb128 0x6
+	.long	.LASF248
+	.value	0x41f
+	.byte	0x18
+	.long	0x140
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x3f
+	.long	0x246a
+	.quad	.LBI89
+	.byte	.LVU1425
+	.quad	.LBB89
+	.quad	.LBE89-.LBB89
+	.value	0x426
+	.byte	0xd
+	.uleb128 0x2
+	.quad	.LVL584
+	.long	0x2944
+	.long	0x2206
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL585
+	.long	0x10cd
+	.long	0x2230
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL586
+	.long	0x22a7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.long	.LASF309
+	.byte	0x1
+	.value	0x417
+	.byte	0x6
+	.long	0x5a8
+	.quad	.LFB66
+	.quad	.LFE66-.LFB66
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x22a7
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x419
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x5
+	.quad	.LVL581
+	.long	0x392a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF258
+	.value	0x3e0
+	.byte	0x5
+	.long	0x64
+	.quad	.LFB65
+	.quad	.LFE65-.LFB65
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x246a
+	.uleb128 0x6
+	.long	.LASF259
+	.value	0x3e0
+	.byte	0x14
+	.long	0x64
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x6
+	.long	.LASF260
+	.value	0x3e1
+	.byte	0x18
+	.long	0xd9b
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x6
+	.long	.LASF261
+	.value	0x3e2
+	.byte	0x18
+	.long	0xd9b
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x6
+	.long	.LASF262
+	.value	0x3e3
+	.byte	0x18
+	.long	0xd9b
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x6
+	.long	.LASF263
+	.value	0x3e4
+	.byte	0x20
+	.long	0xda5
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x7
+	.long	.LASF264
+	.value	0x3e6
+	.byte	0xb
+	.long	0x140
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x7
+	.long	.LASF265
+	.value	0x3e7
+	.byte	0x9
+	.long	0x64
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0xe
+	.long	.LASF266
+	.value	0x3e8
+	.byte	0xc
+	.long	0x574
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x7
+	.long	.LASF267
+	.value	0x407
+	.byte	0x9
+	.long	0x64
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x3b
+	.long	0x2475
+	.quad	.LBI79
+	.byte	.LVU1345
+	.long	.LLRL175
+	.value	0x3e9
+	.byte	0x1b
+	.long	0x23a7
+	.uleb128 0x5
+	.quad	.LVL553
+	.long	0x277b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.long	0x246a
+	.quad	.LBI83
+	.byte	.LVU1353
+	.long	.LLRL176
+	.byte	0x1
+	.value	0x3ef
+	.byte	0x9
+	.uleb128 0xa
+	.quad	.LVL554
+	.long	0x2480
+	.uleb128 0xa
+	.quad	.LVL556
+	.long	0x3ba7
+	.uleb128 0xa
+	.quad	.LVL566
+	.long	0x1105
+	.uleb128 0x2
+	.quad	.LVL567
+	.long	0xdc5
+	.long	0x2410
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL568
+	.long	0xdaf
+	.uleb128 0x2
+	.quad	.LVL570
+	.long	0xd71
+	.long	0x244f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -200
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL575
+	.long	0x2480
+	.uleb128 0xa
+	.quad	.LVL576
+	.long	0x3ba7
+	.byte	0
+	.uleb128 0x40
+	.long	.LASF268
+	.value	0x3d1
+	.long	0x5a8
+	.uleb128 0x40
+	.long	.LASF269
+	.value	0x3ca
+	.long	0x5a8
+	.uleb128 0x3a
+	.long	.LASF271
+	.value	0x39a
+	.long	0x140
+	.quad	.LFB62
+	.quad	.LFE62-.LFB62
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x272f
+	.uleb128 0x10
+	.long	.LLRL28
+	.long	0x2618
+	.uleb128 0x8
+	.string	"rio"
+	.value	0x3a2
+	.byte	0x11
+	.long	0x99b
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x7
+	.long	.LASF177
+	.value	0x3a3
+	.byte	0xf
+	.long	0x140
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x8
+	.string	"nl"
+	.value	0x3a4
+	.byte	0xf
+	.long	0x140
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x8
+	.string	"n"
+	.value	0x3b5
+	.byte	0xd
+	.long	0x64
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x10
+	.long	.LLRL34
+	.long	0x2529
+	.uleb128 0x8
+	.string	"len"
+	.value	0x3a7
+	.byte	0x11
+	.long	0x64
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x5
+	.quad	.LVL117
+	.long	0x27d8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.long	0x25a9
+	.uleb128 0x8
+	.string	"cnt"
+	.value	0x3b8
+	.byte	0x11
+	.long	0x64
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x2
+	.quad	.LVL102
+	.long	0x4bf1
+	.long	0x2576
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL103
+	.long	0x285e
+	.uleb128 0x2
+	.quad	.LVL104
+	.long	0x27d8
+	.long	0x259b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL107
+	.long	0x285e
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL91
+	.long	0xfcf
+	.long	0x25d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xb
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xb
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL95
+	.long	0x277b
+	.long	0x25f1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL97
+	.long	0xff0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.long	0x272f
+	.quad	.LBI22
+	.byte	.LVU194
+	.long	.LLRL36
+	.byte	0x1
+	.value	0x39f
+	.byte	0x10
+	.uleb128 0x1f
+	.long	0x273f
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x16
+	.long	.LLRL36
+	.uleb128 0x18
+	.long	0x274b
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x18
+	.long	0x2757
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x18
+	.long	0x2763
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x18
+	.long	0x276e
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x2
+	.quad	.LVL79
+	.long	0xfaf
+	.long	0x2697
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL83
+	.long	0x4bf1
+	.long	0x26bb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL86
+	.long	0x27d8
+	.long	0x26d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL88
+	.long	0x285e
+	.uleb128 0x2
+	.quad	.LVL110
+	.long	0x4bf1
+	.long	0x2704
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL113
+	.long	0x4bf1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	linebuf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF273
+	.value	0x37e
+	.byte	0xe
+	.long	0x140
+	.long	0x277b
+	.uleb128 0x3e
+	.string	"rio"
+	.value	0x37e
+	.byte	0x26
+	.long	0x99b
+	.uleb128 0x29
+	.long	.LASF177
+	.value	0x380
+	.byte	0xb
+	.long	0x140
+	.uleb128 0x29
+	.long	.LASF274
+	.value	0x381
+	.byte	0xc
+	.long	0x2f4
+	.uleb128 0x28
+	.string	"nl"
+	.value	0x388
+	.byte	0xb
+	.long	0x140
+	.uleb128 0x28
+	.string	"len"
+	.value	0x389
+	.byte	0xc
+	.long	0x2f4
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF276
+	.value	0x376
+	.byte	0xe
+	.long	0x140
+	.quad	.LFB60
+	.quad	.LFE60-.LFB60
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x27d8
+	.uleb128 0x2a
+	.string	"rio"
+	.value	0x376
+	.byte	0x23
+	.long	0x99b
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x8
+	.string	"nl"
+	.value	0x378
+	.byte	0xb
+	.long	0x140
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x5
+	.quad	.LVL58
+	.long	0xfaf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF277
+	.value	0x36d
+	.quad	.LFB59
+	.quad	.LFE59-.LFB59
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2854
+	.uleb128 0x6
+	.long	.LASF177
+	.value	0x36d
+	.byte	0x1d
+	.long	0x140
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x2
+	.quad	.LVL73
+	.long	0xf4c
+	.long	0x282d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL74
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.long	.LASF339
+	.byte	0x1
+	.value	0x367
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x41
+	.long	.LASF320
+	.value	0x355
+	.quad	.LFB57
+	.quad	.LFE57-.LFB57
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2944
+	.uleb128 0x16
+	.long	.LLRL22
+	.uleb128 0x7
+	.long	.LASF278
+	.value	0x358
+	.byte	0x11
+	.long	0x99b
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x10
+	.long	.LLRL24
+	.long	0x2918
+	.uleb128 0x7
+	.long	.LASF144
+	.value	0x35b
+	.byte	0x14
+	.long	0x2f4
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x7
+	.long	.LASF279
+	.value	0x35c
+	.byte	0x14
+	.long	0x2e
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x2
+	.quad	.LVL62
+	.long	0xf94
+	.long	0x28df
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 65584
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL65
+	.long	0x10cd
+	.long	0x2903
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL66
+	.long	0xf79
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL67
+	.long	0xf62
+	.uleb128 0x5
+	.quad	.LVL68
+	.long	0x106b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x10040
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF280
+	.value	0x330
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB56
+	.quad	.LFE56-.LFB56
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a8e
+	.uleb128 0x6
+	.long	.LASF281
+	.value	0x330
+	.byte	0x1d
+	.long	0x140
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x8
+	.string	"fd"
+	.value	0x332
+	.byte	0x9
+	.long	0x64
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x7
+	.long	.LASF282
+	.value	0x339
+	.byte	0xd
+	.long	0x99b
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x1e
+	.string	"st"
+	.value	0x345
+	.byte	0x11
+	.long	0x1e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x10
+	.long	.LLRL113
+	.long	0x2a13
+	.uleb128 0x8
+	.string	"map"
+	.value	0x348
+	.byte	0xf
+	.long	0x140
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x2
+	.quad	.LVL359
+	.long	0xe33
+	.long	0x29f9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL362
+	.long	0xe13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL347
+	.long	0xe82
+	.long	0x2a30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL352
+	.long	0x1050
+	.long	0x2a58
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x10040
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL355
+	.long	0x1111
+	.long	0x2a72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 65584
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL356
+	.long	0xe62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF283
+	.value	0x30b
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB55
+	.quad	.LFE55-.LFB55
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2c9b
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x30b
+	.byte	0x1f
+	.long	0x64
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x30b
+	.byte	0x2b
+	.long	0x592
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0xe
+	.long	.LASF178
+	.value	0x30d
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x8
+	.string	"cmd"
+	.value	0x321
+	.byte	0xd
+	.long	0x661
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x326
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x17
+	.quad	.LBB63
+	.quad	.LBE63-.LBB63
+	.long	0x2b87
+	.uleb128 0xe
+	.long	.LASF179
+	.value	0x318
+	.byte	0x12
+	.long	0xb72
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x319
+	.byte	0xe
+	.long	0x5a8
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x2
+	.quad	.LVL513
+	.long	0x2d45
+	.long	0x2b65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL515
+	.long	0x3099
+	.uleb128 0x5
+	.quad	.LVL517
+	.long	0x2c9b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.quad	.LBB62
+	.quad	.LBE62-.LBB62
+	.long	0x2bcf
+	.uleb128 0x8
+	.string	"r"
+	.value	0x327
+	.byte	0xe
+	.long	0x64
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x5
+	.quad	.LVL503
+	.long	0x3d8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 -2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL496
+	.long	0x359a
+	.long	0x2be8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL497
+	.long	0x10b2
+	.long	0x2c07
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC89
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL498
+	.long	0x4ab2
+	.long	0x2c2c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmd_table
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL509
+	.long	0x10cd
+	.long	0x2c50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC91
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL512
+	.long	0x10cd
+	.long	0x2c74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC90
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL521
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF284
+	.value	0x2fd
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB54
+	.quad	.LFE54-.LFB54
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d45
+	.uleb128 0x6
+	.long	.LASF179
+	.value	0x2fd
+	.byte	0x20
+	.long	0xb72
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x6
+	.long	.LASF178
+	.value	0x2fd
+	.byte	0x2a
+	.long	0x64
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x2ff
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x16
+	.long	.LLRL92
+	.uleb128 0x8
+	.string	"r"
+	.value	0x300
+	.byte	0xe
+	.long	0x64
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x16
+	.long	.LLRL94
+	.uleb128 0x7
+	.long	.LASF285
+	.value	0x301
+	.byte	0x17
+	.long	0xb72
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0xa
+	.quad	.LVL290
+	.long	0x3d8d
+	.uleb128 0xa
+	.quad	.LVL293
+	.long	0x2c9b
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF286
+	.value	0x2bf
+	.long	0x5a8
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3094
+	.uleb128 0x6
+	.long	.LASF287
+	.value	0x2bf
+	.byte	0x23
+	.long	0x3094
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x6
+	.long	.LASF288
+	.value	0x2bf
+	.byte	0x2e
+	.long	0x64
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x2c1
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x7
+	.long	.LASF289
+	.value	0x2c2
+	.byte	0xf
+	.long	0x3094
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x16
+	.long	.LLRL142
+	.uleb128 0x7
+	.long	.LASF177
+	.value	0x2c6
+	.byte	0xf
+	.long	0x140
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x8
+	.string	"len"
+	.value	0x2ce
+	.byte	0x10
+	.long	0x2f4
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x7
+	.long	.LASF290
+	.value	0x2cf
+	.byte	0xf
+	.long	0x140
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0xe
+	.long	.LASF243
+	.value	0x2d0
+	.byte	0xf
+	.long	0x1756
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x1e
+	.string	"end"
+	.value	0x2d1
+	.byte	0xf
+	.long	0x140
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x7
+	.long	.LASF175
+	.value	0x2d2
+	.byte	0xd
+	.long	0x64
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x7
+	.long	.LASF285
+	.value	0x2da
+	.byte	0x12
+	.long	0xb72
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x7
+	.long	.LASF176
+	.value	0x2e9
+	.byte	0x10
+	.long	0x592
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x2
+	.quad	.LVL457
+	.long	0x109b
+	.long	0x2e6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL459
+	.long	0x1080
+	.long	0x2e88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL461
+	.long	0x4077
+	.long	0x2eb2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL463
+	.long	0x10b2
+	.long	0x2ed1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL464
+	.long	0x106b
+	.long	0x2ef3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -360
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL468
+	.long	0x10cd
+	.long	0x2f17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC86
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL470
+	.long	0x1050
+	.long	0x2f35
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL474
+	.long	0x1030
+	.long	0x2f5a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -360
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL475
+	.long	0x4bf1
+	.long	0x2f7c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -360
+	.byte	0x6
+	.byte	0x33
+	.byte	0x24
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL478
+	.long	0x10b2
+	.long	0x2f9b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL479
+	.long	0x10b2
+	.long	0x2fba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC89
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL480
+	.long	0x359a
+	.long	0x2fd2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 40
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL482
+	.long	0x10cd
+	.long	0x2ff6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC90
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL484
+	.long	0x2d45
+	.long	0x3019
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -340
+	.byte	0x94
+	.byte	0x4
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL486
+	.long	0x3fd4
+	.long	0x3031
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL489
+	.long	0x4ab2
+	.long	0x3050
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmd_table
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL490
+	.long	0x10cd
+	.long	0x3074
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL492
+	.long	0x106b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -360
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0xb72
+	.uleb128 0x2b
+	.long	.LASF291
+	.value	0x2ae
+	.quad	.LFB52
+	.quad	.LFE52-.LFB52
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x313c
+	.uleb128 0x6
+	.long	.LASF285
+	.value	0x2ae
+	.byte	0x21
+	.long	0xb72
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x3c
+	.quad	.LBB30
+	.quad	.LBE30-.LBB30
+	.uleb128 0x7
+	.long	.LASF120
+	.value	0x2b1
+	.byte	0x12
+	.long	0xb72
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0xa
+	.quad	.LVL167
+	.long	0x3099
+	.uleb128 0x2
+	.quad	.LVL168
+	.long	0xf21
+	.long	0x3113
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL169
+	.long	0x106b
+	.uleb128 0x5
+	.quad	.LVL170
+	.long	0x106b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF292
+	.value	0x28a
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3274
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x28a
+	.byte	0x1d
+	.long	0x64
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x28a
+	.byte	0x29
+	.long	0x592
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x7
+	.long	.LASF293
+	.value	0x28c
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x28d
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x17
+	.quad	.LBB50
+	.quad	.LBE50-.LBB50
+	.long	0x31f7
+	.uleb128 0x7
+	.long	.LASF279
+	.value	0x28f
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x5
+	.quad	.LVL318
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL308
+	.long	0xf94
+	.long	0x3216
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	last_time
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL309
+	.long	0x3d09
+	.long	0x3234
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 8
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL311
+	.long	0xf94
+	.long	0x3253
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	last_time
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL312
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC29
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF294
+	.value	0x27c
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3324
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x27c
+	.byte	0x1c
+	.long	0x64
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x27c
+	.byte	0x28
+	.long	0x592
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x7
+	.long	.LASF267
+	.value	0x283
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0xa
+	.quad	.LVL336
+	.long	0xe9e
+	.uleb128 0x2
+	.quad	.LVL342
+	.long	0x10cd
+	.long	0x3303
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL345
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC32
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF295
+	.value	0x26d
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x33c0
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x26d
+	.byte	0x1f
+	.long	0x64
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x26d
+	.byte	0x2b
+	.long	0x592
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0xa
+	.quad	.LVL365
+	.long	0x2944
+	.uleb128 0x2
+	.quad	.LVL370
+	.long	0x10cd
+	.long	0x339f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC34
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL372
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF296
+	.value	0x241
+	.long	0x5a8
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x359a
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x241
+	.byte	0x1f
+	.long	0x64
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x241
+	.byte	0x2b
+	.long	0x592
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x10
+	.long	.LLRL165
+	.long	0x345f
+	.uleb128 0x7
+	.long	.LASF297
+	.value	0x244
+	.byte	0x13
+	.long	0x6dc
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x2
+	.quad	.LVL529
+	.long	0x10cd
+	.long	0x3445
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL530
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LLRL157
+	.uleb128 0x8
+	.string	"i"
+	.value	0x24e
+	.byte	0xe
+	.long	0x64
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x16
+	.long	.LLRL159
+	.uleb128 0x7
+	.long	.LASF113
+	.value	0x24f
+	.byte	0xf
+	.long	0x140
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0xe
+	.long	.LASF298
+	.value	0x250
+	.byte	0xd
+	.long	0x64
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x7
+	.long	.LASF299
+	.value	0x251
+	.byte	0xe
+	.long	0x5a8
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x7
+	.long	.LASF297
+	.value	0x25b
+	.byte	0x13
+	.long	0x6dc
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x10
+	.long	.LLRL163
+	.long	0x34e5
+	.uleb128 0x7
+	.long	.LASF300
+	.value	0x25d
+	.byte	0x11
+	.long	0x64
+	.long	.LLST164
+	.long	.LVUS164
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL533
+	.long	0x10cd
+	.long	0x350f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC92
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL536
+	.long	0x10cd
+	.long	0x3533
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC93
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL538
+	.long	0x10cd
+	.long	0x355d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC94
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL545
+	.long	0x359a
+	.long	0x3576
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL546
+	.long	0x4ab2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_table
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF301
+	.value	0x236
+	.byte	0x6
+	.long	0x5a8
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3626
+	.uleb128 0x6
+	.long	.LASF302
+	.value	0x236
+	.byte	0x14
+	.long	0x140
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x2a
+	.string	"loc"
+	.value	0x236
+	.byte	0x20
+	.long	0x6ed
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x1e
+	.string	"end"
+	.value	0x238
+	.byte	0xb
+	.long	0x140
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x8
+	.string	"v"
+	.value	0x239
+	.byte	0xe
+	.long	0x83
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x5
+	.quad	.LVL449
+	.long	0xddd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF303
+	.value	0x227
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x36c0
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x227
+	.byte	0x20
+	.long	0x64
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x227
+	.byte	0x2c
+	.long	0x592
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x8
+	.string	"i"
+	.value	0x22c
+	.byte	0x9
+	.long	0x64
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x2
+	.quad	.LVL124
+	.long	0xf4c
+	.long	0x369f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL131
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF304
+	.value	0x219
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3759
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x219
+	.byte	0x20
+	.long	0x64
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x219
+	.byte	0x2c
+	.long	0x592
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x7
+	.long	.LASF267
+	.value	0x220
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xa
+	.quad	.LVL4
+	.long	0x10e3
+	.uleb128 0xa
+	.quad	.LVL8
+	.long	0x10f9
+	.uleb128 0x5
+	.quad	.LVL11
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF305
+	.value	0x20b
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3839
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x20b
+	.byte	0x1e
+	.long	0x64
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x20b
+	.byte	0x2a
+	.long	0x592
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x17
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.long	0x37e4
+	.uleb128 0x8
+	.string	"c"
+	.value	0x20f
+	.byte	0x12
+	.long	0x661
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x5
+	.quad	.LVL17
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL15
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF306
+	.value	0x1f9
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x392a
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x1f9
+	.byte	0x1d
+	.long	0x64
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x1f9
+	.byte	0x29
+	.long	0x592
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x7
+	.long	.LASF307
+	.value	0x1fb
+	.byte	0xd
+	.long	0x661
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x7
+	.long	.LASF297
+	.value	0x201
+	.byte	0xf
+	.long	0x6dc
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2
+	.quad	.LVL25
+	.long	0x10cd
+	.long	0x38cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL26
+	.long	0x10cd
+	.long	0x38ec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL29
+	.long	0x10cd
+	.long	0x3910
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL30
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF308
+	.value	0x1d5
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ac1
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x1d5
+	.byte	0x1d
+	.long	0x64
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x1d5
+	.byte	0x29
+	.long	0x592
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x8
+	.string	"c"
+	.value	0x1da
+	.byte	0xd
+	.long	0x661
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x1db
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x8
+	.string	"p"
+	.value	0x1e2
+	.byte	0xf
+	.long	0x6dc
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x17
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.long	0x39e9
+	.uleb128 0x8
+	.string	"ele"
+	.value	0x1dd
+	.byte	0x11
+	.long	0x661
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x5
+	.quad	.LVL182
+	.long	0x106b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.quad	.LBB32
+	.quad	.LBE32-.LBB32
+	.long	0x3a27
+	.uleb128 0x8
+	.string	"ele"
+	.value	0x1e4
+	.byte	0x13
+	.long	0x6dc
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x5
+	.quad	.LVL187
+	.long	0x106b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LLRL66
+	.long	0x3a59
+	.uleb128 0x8
+	.string	"i"
+	.value	0x1ed
+	.byte	0xe
+	.long	0x64
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x5a
+	.quad	.LVL201
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL189
+	.long	0x4937
+	.long	0x3a78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmd_table
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL190
+	.long	0x4937
+	.long	0x3a97
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_table
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL195
+	.long	0x3759
+	.long	0x3ab3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL204
+	.long	0x285e
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF310
+	.value	0x1cf
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3aec
+	.uleb128 0x43
+	.string	"on"
+	.value	0x1cf
+	.byte	0x14
+	.long	0x5a8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF311
+	.value	0x1c9
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3b17
+	.uleb128 0x43
+	.string	"mf"
+	.value	0x1c9
+	.byte	0x2a
+	.long	0x6f2
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF312
+	.value	0x1c0
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3b68
+	.uleb128 0x2a
+	.string	"qf"
+	.value	0x1c0
+	.byte	0x23
+	.long	0x5c7
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x5
+	.quad	.LVL444
+	.long	0xdfd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC85
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF313
+	.value	0x1ba
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ba7
+	.uleb128 0x6
+	.long	.LASF300
+	.value	0x1ba
+	.byte	0x1f
+	.long	0x64
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xa
+	.quad	.LVL1
+	.long	0x1105
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF314
+	.value	0x1a2
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3d09
+	.uleb128 0x6
+	.long	.LASF264
+	.value	0x1a2
+	.byte	0x21
+	.long	0x140
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0xe
+	.long	.LASF243
+	.value	0x1aa
+	.byte	0xb
+	.long	0x1756
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0x1e
+	.string	"end"
+	.value	0x1ab
+	.byte	0xb
+	.long	0x140
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -312
+	.uleb128 0x7
+	.long	.LASF175
+	.value	0x1ac
+	.byte	0x9
+	.long	0x64
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x7
+	.long	.LASF176
+	.value	0x1b1
+	.byte	0xc
+	.long	0x592
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x1b3
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x2
+	.quad	.LVL323
+	.long	0x4077
+	.long	0x3c64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -312
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL325
+	.long	0x1030
+	.long	0x3c8e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL327
+	.long	0x3fd4
+	.long	0x3cac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL328
+	.long	0x3d09
+	.long	0x3cca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL330
+	.long	0xf21
+	.long	0x3ced
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL332
+	.long	0x3d09
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF315
+	.value	0x198
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3d8d
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x198
+	.byte	0x20
+	.long	0x64
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x198
+	.byte	0x2c
+	.long	0x592
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x2
+	.quad	.LVL302
+	.long	0x4ab2
+	.long	0x3d72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmd_table
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL303
+	.long	0x3d8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF316
+	.value	0x16d
+	.byte	0xd
+	.long	0x5a8
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3f96
+	.uleb128 0x6
+	.long	.LASF317
+	.value	0x16d
+	.byte	0x1d
+	.long	0x661
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x16d
+	.byte	0x2b
+	.long	0x64
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x16d
+	.byte	0x37
+	.long	0x592
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x8
+	.string	"ok"
+	.value	0x16f
+	.byte	0xa
+	.long	0x5a8
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x10
+	.long	.LLRL85
+	.long	0x3f64
+	.uleb128 0x7
+	.long	.LASF318
+	.value	0x171
+	.byte	0xe
+	.long	0x5a8
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x7
+	.long	.LASF319
+	.value	0x178
+	.byte	0x12
+	.long	0x2dc
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x7
+	.long	.LASF279
+	.value	0x17a
+	.byte	0x12
+	.long	0x2dc
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0xa
+	.quad	.LVL250
+	.long	0xeea
+	.uleb128 0x2c
+	.quad	.LVL252
+	.long	0x3e6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL255
+	.long	0xeea
+	.uleb128 0xa
+	.quad	.LVL260
+	.long	0xf10
+	.uleb128 0x2
+	.quad	.LVL262
+	.long	0xefb
+	.long	0x3ea2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2c
+	.quad	.LVL263
+	.long	0x3eb5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL264
+	.long	0xeea
+	.uleb128 0x2c
+	.quad	.LVL266
+	.long	0x3edc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL269
+	.long	0xeea
+	.uleb128 0x2
+	.quad	.LVL271
+	.long	0xed5
+	.long	0x3f0e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL272
+	.long	0xec0
+	.long	0x3f36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x2c
+	.quad	.LVL273
+	.long	0x3f49
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL274
+	.long	0xeb4
+	.uleb128 0xa
+	.quad	.LVL276
+	.long	0x3f96
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL281
+	.long	0x10cd
+	.long	0x3f88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL282
+	.long	0x3f96
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF321
+	.value	0x163
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3fd4
+	.uleb128 0x5
+	.quad	.LVL20
+	.long	0x10cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF322
+	.value	0x155
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4077
+	.uleb128 0x6
+	.long	.LASF177
+	.value	0x155
+	.byte	0x20
+	.long	0x140
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x2a
+	.string	"end"
+	.value	0x155
+	.byte	0x2c
+	.long	0x140
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x155
+	.byte	0x38
+	.long	0x592
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x8
+	.string	"src"
+	.value	0x157
+	.byte	0xb
+	.long	0x140
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x7
+	.long	.LASF175
+	.value	0x158
+	.byte	0x9
+	.long	0x64
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0xa
+	.quad	.LVL154
+	.long	0xf3b
+	.uleb128 0x5
+	.quad	.LVL156
+	.long	0x109b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF323
+	.value	0x13e
+	.byte	0xc
+	.long	0x64
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x411f
+	.uleb128 0x6
+	.long	.LASF177
+	.value	0x13e
+	.byte	0x1d
+	.long	0x140
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x13e
+	.byte	0x2a
+	.long	0x592
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x6
+	.long	.LASF324
+	.value	0x13e
+	.byte	0x34
+	.long	0x64
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x6
+	.long	.LASF325
+	.value	0x13e
+	.byte	0x45
+	.long	0x592
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x8
+	.string	"src"
+	.value	0x140
+	.byte	0xb
+	.long	0x140
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x7
+	.long	.LASF175
+	.value	0x141
+	.byte	0x9
+	.long	0x64
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0xa
+	.quad	.LVL135
+	.long	0xf3b
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF326
+	.value	0x120
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4227
+	.uleb128 0x6
+	.long	.LASF113
+	.value	0x120
+	.byte	0x16
+	.long	0x140
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x6
+	.long	.LASF124
+	.value	0x121
+	.byte	0x15
+	.long	0x6ed
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x6
+	.long	.LASF115
+	.value	0x122
+	.byte	0x16
+	.long	0x140
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x6
+	.long	.LASF125
+	.value	0x123
+	.byte	0x20
+	.long	0x672
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x7
+	.long	.LASF327
+	.value	0x125
+	.byte	0xf
+	.long	0x6dc
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x7
+	.long	.LASF289
+	.value	0x126
+	.byte	0x10
+	.long	0x4227
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x8
+	.string	"ele"
+	.value	0x12c
+	.byte	0xf
+	.long	0x6dc
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x2
+	.quad	.LVL403
+	.long	0x10b2
+	.long	0x41e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL407
+	.long	0x1050
+	.long	0x4205
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL409
+	.long	0x497a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_table
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x6dc
+	.uleb128 0x26
+	.long	.LASF328
+	.value	0x109
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4320
+	.uleb128 0x6
+	.long	.LASF113
+	.value	0x109
+	.byte	0x14
+	.long	0x140
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x6
+	.long	.LASF114
+	.value	0x109
+	.byte	0x27
+	.long	0x5c7
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x6
+	.long	.LASF115
+	.value	0x109
+	.byte	0x38
+	.long	0x140
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x7
+	.long	.LASF317
+	.value	0x10b
+	.byte	0xd
+	.long	0x661
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x7
+	.long	.LASF289
+	.value	0x10c
+	.byte	0xe
+	.long	0x1751
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x8
+	.string	"ele"
+	.value	0x112
+	.byte	0xd
+	.long	0x661
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x2
+	.quad	.LVL389
+	.long	0x10b2
+	.long	0x42d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL393
+	.long	0x1050
+	.long	0x42fe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC36
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL395
+	.long	0x497a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmd_table
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.long	.LASF340
+	.byte	0x1
+	.byte	0xca
+	.byte	0x6
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4937
+	.uleb128 0x3f
+	.long	0x2854
+	.quad	.LBI57
+	.byte	.LVU1047
+	.quad	.LBB57
+	.quad	.LBE57-.LBB57
+	.value	0x103
+	.byte	0x5
+	.uleb128 0x2
+	.quad	.LVL415
+	.long	0x4937
+	.long	0x437e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmd_table
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL416
+	.long	0x4937
+	.long	0x439d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	param_table
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL417
+	.long	0x422c
+	.long	0x43d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_help_cmd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC38
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL418
+	.long	0x422c
+	.long	0x440f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_option_cmd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC40
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL419
+	.long	0x422c
+	.long	0x4448
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_quit_cmd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL420
+	.long	0x422c
+	.long	0x4481
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_source_cmd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL421
+	.long	0x422c
+	.long	0x44ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_log_cmd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL422
+	.long	0x422c
+	.long	0x44f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC49
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_time_cmd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC48
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL423
+	.long	0x422c
+	.long	0x452c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_comment_cmd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL424
+	.long	0x422c
+	.long	0x4565
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_repeat_cmd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC52
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL425
+	.long	0x422c
+	.long	0x4597
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_stats_cmd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL426
+	.long	0x422c
+	.long	0x45d0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC57
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_metrics_cmd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL427
+	.long	0x411f
+	.long	0x460e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	simulation
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC58
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL428
+	.long	0x411f
+	.long	0x463f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL429
+	.long	0x411f
+	.long	0x467d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC63
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	err_limit
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL430
+	.long	0x411f
+	.long	0x46bb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	echo
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL431
+	.long	0x411f
+	.long	0x46f4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC67
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC66
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	async_changed
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL432
+	.long	0x411f
+	.long	0x472b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quit_stats
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL433
+	.long	0x411f
+	.long	0x4769
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	total_measurements
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL434
+	.long	0x411f
+	.long	0x47a7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crop_window
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL435
+	.long	0x411f
+	.long	0x47e5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dudect_workers
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL436
+	.long	0x411f
+	.long	0x4823
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timing_backend
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL437
+	.long	0x411f
+	.long	0x4861
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dudect_pool
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC77
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL438
+	.long	0x411f
+	.long	0x489f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dudect_sequential
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC79
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL439
+	.long	0x411f
+	.long	0x48dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	old_measure
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL440
+	.long	0x411f
+	.long	0x491b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC84
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	write_data
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL441
+	.long	0x1111
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	last_time
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF329
+	.byte	0xc0
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x497a
+	.uleb128 0x1b
+	.long	.LASF330
+	.byte	0xc0
+	.byte	0x27
+	.long	0x218d
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x5
+	.quad	.LVL175
+	.long	0xf21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF331
+	.byte	0xa8
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4ab2
+	.uleb128 0x1b
+	.long	.LASF330
+	.byte	0xa8
+	.byte	0x28
+	.long	0x218d
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x1b
+	.long	.LASF113
+	.byte	0xa8
+	.byte	0x35
+	.long	0x140
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x5c
+	.string	"ele"
+	.byte	0x1
+	.byte	0xa8
+	.byte	0x41
+	.long	0x10e
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x33
+	.long	.LASF332
+	.byte	0xb8
+	.byte	0xd
+	.long	0x880
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x17
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.long	0x4a9d
+	.uleb128 0x33
+	.long	.LASF144
+	.byte	0xab
+	.byte	0x10
+	.long	0x2f4
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x33
+	.long	.LASF143
+	.byte	0xac
+	.byte	0x11
+	.long	0x880
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x17
+	.quad	.LBB37
+	.quad	.LBE37-.LBB37
+	.long	0x4a5f
+	.uleb128 0x45
+	.string	"i"
+	.byte	0xad
+	.byte	0x15
+	.long	0x2f4
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x5
+	.quad	.LVL217
+	.long	0x4b0f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL212
+	.long	0x1030
+	.long	0x4a89
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL219
+	.long	0xf21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL221
+	.long	0x4b0f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF333
+	.byte	0xa0
+	.byte	0xe
+	.long	0x10e
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4b0f
+	.uleb128 0x1b
+	.long	.LASF330
+	.byte	0xa0
+	.byte	0x27
+	.long	0x218d
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1b
+	.long	.LASF113
+	.byte	0xa0
+	.byte	0x3a
+	.long	0x1b3
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x5
+	.quad	.LVL54
+	.long	0x4b0f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF334
+	.byte	0x97
+	.byte	0x10
+	.long	0x880
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4bc9
+	.uleb128 0x1b
+	.long	.LASF143
+	.byte	0x97
+	.byte	0x23
+	.long	0x880
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1b
+	.long	.LASF144
+	.byte	0x97
+	.byte	0x31
+	.long	0x2f4
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1b
+	.long	.LASF113
+	.byte	0x97
+	.byte	0x43
+	.long	0x1b3
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x45
+	.string	"i"
+	.byte	0x99
+	.byte	0xc
+	.long	0x2f4
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x5d
+	.long	0x4bc9
+	.quad	.LBI5
+	.byte	.LVU87
+	.long	.LLRL15
+	.byte	0x1
+	.byte	0x99
+	.byte	0x10
+	.long	0x4bb4
+	.uleb128 0x1f
+	.long	0x4bda
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x16
+	.long	.LLRL15
+	.uleb128 0x18
+	.long	0x4be6
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL43
+	.long	0x10b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF335
+	.byte	0x1
+	.byte	0x8c
+	.byte	0x18
+	.long	0x2d0
+	.byte	0x3
+	.long	0x4bf1
+	.uleb128 0x5f
+	.long	.LASF113
+	.byte	0x1
+	.byte	0x8c
+	.byte	0x2e
+	.long	0x1b3
+	.uleb128 0x60
+	.string	"h"
+	.byte	0x1
+	.byte	0x8e
+	.byte	0xe
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x61
+	.long	.LASF225
+	.long	.LASF341
+	.byte	0x17
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x6
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS204:
+	.uleb128 0
+	.uleb128 .LVU1627
+	.uleb128 .LVU1627
+	.uleb128 .LVU1680
+	.uleb128 .LVU1680
+	.uleb128 .LVU1727
+	.uleb128 .LVU1727
+	.uleb128 .LVU1796
+	.uleb128 .LVU1796
+	.uleb128 .LVU1800
+	.uleb128 .LVU1800
+	.uleb128 .LVU1801
+	.uleb128 .LVU1801
+	.uleb128 0
+.LLST204:
+	.byte	0x4
+	.uleb128 .LVL686-.Ltext0
+	.uleb128 .LVL687-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL687-1-.Ltext0
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -488
+	.byte	0x4
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU1627
+	.uleb128 .LVU1631
+	.uleb128 .LVU1631
+	.uleb128 .LVU1662
+	.uleb128 .LVU1796
+	.uleb128 .LVU1797
+	.uleb128 .LVU1801
+	.uleb128 .LVU1805
+.LLST205:
+	.byte	0x4
+	.uleb128 .LVL687-.Ltext0
+	.uleb128 .LVL688-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL688-1-.Ltext0
+	.uleb128 .LVL702-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU1634
+	.uleb128 .LVU1680
+	.uleb128 .LVU1680
+	.uleb128 .LVU1727
+	.uleb128 .LVU1805
+	.uleb128 0
+.LLST206:
+	.byte	0x4
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -504
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU1636
+	.uleb128 .LVU1639
+	.uleb128 .LVU1643
+	.uleb128 .LVU1644
+	.uleb128 .LVU1644
+	.uleb128 .LVU1679
+	.uleb128 .LVU1679
+	.uleb128 .LVU1727
+	.uleb128 .LVU1805
+	.uleb128 0
+.LLST207:
+	.byte	0x4
+	.uleb128 .LVL690-.Ltext0
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL694-.Ltext0
+	.uleb128 .LVL695-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL695-1-.Ltext0
+	.uleb128 .LVL711-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL711-.Ltext0
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -496
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS208:
+	.uleb128 .LVU1638
+	.uleb128 .LVU1639
+	.uleb128 .LVU1645
+	.uleb128 .LVU1679
+	.uleb128 .LVU1679
+	.uleb128 .LVU1727
+	.uleb128 .LVU1805
+	.uleb128 0
+.LLST208:
+	.byte	0x4
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL695-.Ltext0
+	.uleb128 .LVL711-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL711-.Ltext0
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -496
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS209:
+	.uleb128 .LVU1658
+	.uleb128 .LVU1746
+	.uleb128 .LVU1805
+	.uleb128 0
+.LLST209:
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU1660
+	.uleb128 .LVU1676
+.LLST210:
+	.byte	0x4
+	.uleb128 .LVL701-.Ltext0
+	.uleb128 .LVL709-.Ltext0
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS211:
+	.uleb128 .LVU1663
+	.uleb128 .LVU1665
+	.uleb128 .LVU1665
+	.uleb128 .LVU1796
+	.uleb128 .LVU1805
+	.uleb128 0
+.LLST211:
+	.byte	0x4
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 .LVL705-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL705-.Ltext0
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -552
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -552
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU1666
+	.uleb128 .LVU1678
+	.uleb128 .LVU1678
+	.uleb128 .LVU1680
+	.uleb128 .LVU1680
+	.uleb128 .LVU1796
+	.uleb128 .LVU1805
+	.uleb128 .LVU1807
+	.uleb128 .LVU1807
+	.uleb128 .LVU1820
+	.uleb128 .LVU1820
+	.uleb128 0
+.LLST212:
+	.byte	0x4
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -520
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -520
+	.byte	0
+.LVUS213:
+	.uleb128 .LVU1668
+	.uleb128 .LVU1682
+	.uleb128 .LVU1682
+	.uleb128 .LVU1696
+	.uleb128 .LVU1696
+	.uleb128 .LVU1704
+	.uleb128 .LVU1724
+	.uleb128 .LVU1747
+	.uleb128 .LVU1805
+	.uleb128 0
+.LLST213:
+	.byte	0x4
+	.uleb128 .LVL708-.Ltext0
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS214:
+	.uleb128 .LVU1669
+	.uleb128 .LVU1678
+	.uleb128 .LVU1678
+	.uleb128 .LVU1680
+	.uleb128 .LVU1680
+	.uleb128 .LVU1707
+	.uleb128 .LVU1724
+	.uleb128 .LVU1727
+	.uleb128 .LVU1805
+	.uleb128 .LVU1807
+	.uleb128 .LVU1807
+	.uleb128 .LVU1820
+	.uleb128 .LVU1820
+	.uleb128 0
+.LLST214:
+	.byte	0x4
+	.uleb128 .LVL708-.Ltext0
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -520
+	.byte	0
+.LVUS215:
+	.uleb128 .LVU1670
+	.uleb128 .LVU1707
+	.uleb128 .LVU1707
+	.uleb128 .LVU1724
+	.uleb128 .LVU1724
+	.uleb128 .LVU1771
+	.uleb128 .LVU1775
+	.uleb128 .LVU1783
+	.uleb128 .LVU1783
+	.uleb128 .LVU1787
+	.uleb128 .LVU1805
+	.uleb128 0
+.LLST215:
+	.byte	0x4
+	.uleb128 .LVL708-.Ltext0
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL742-.Ltext0
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU1722
+	.uleb128 .LVU1724
+	.uleb128 .LVU1743
+	.uleb128 .LVU1747
+	.uleb128 .LVU1747
+	.uleb128 .LVU1796
+	.uleb128 .LVU1821
+	.uleb128 0
+.LLST216:
+	.byte	0x4
+	.uleb128 .LVL722-.Ltext0
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL728-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL768-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU1672
+	.uleb128 .LVU1680
+	.uleb128 .LVU1680
+	.uleb128 .LVU1698
+	.uleb128 .LVU1698
+	.uleb128 .LVU1703
+	.uleb128 .LVU1703
+	.uleb128 .LVU1704
+	.uleb128 .LVU1724
+	.uleb128 .LVU1726
+	.uleb128 .LVU1805
+	.uleb128 0
+.LLST218:
+	.byte	0x4
+	.uleb128 .LVL708-.Ltext0
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -552
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 .LVL717-.Ltext0
+	.uleb128 0xc
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -552
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL717-.Ltext0
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -552
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0xc
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -552
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS220:
+	.uleb128 .LVU1681
+	.uleb128 .LVU1706
+	.uleb128 .LVU1724
+	.uleb128 .LVU1725
+.LLST220:
+	.byte	0x4
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 .LVL719-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL724-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS222:
+	.uleb128 .LVU1754
+	.uleb128 .LVU1764
+	.uleb128 .LVU1769
+	.uleb128 .LVU1770
+	.uleb128 .LVU1783
+	.uleb128 .LVU1786
+.LLST222:
+	.byte	0x4
+	.uleb128 .LVL731-.Ltext0
+	.uleb128 .LVL737-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL740-.Ltext0
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 .LVL750-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS223:
+	.uleb128 .LVU1756
+	.uleb128 .LVU1761
+	.uleb128 .LVU1761
+	.uleb128 .LVU1769
+	.uleb128 .LVU1769
+	.uleb128 .LVU1775
+	.uleb128 .LVU1783
+	.uleb128 .LVU1786
+.LLST223:
+	.byte	0x4
+	.uleb128 .LVL733-.Ltext0
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 .LVL740-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL740-.Ltext0
+	.uleb128 .LVL742-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 .LVL750-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU1759
+	.uleb128 .LVU1763
+	.uleb128 .LVU1783
+	.uleb128 .LVU1785
+.LLST224:
+	.byte	0x4
+	.uleb128 .LVL734-.Ltext0
+	.uleb128 .LVL736-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 4
+	.byte	0x4
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 .LVL749-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 4
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU901
+	.uleb128 .LVU912
+	.uleb128 .LVU912
+	.uleb128 .LVU929
+	.uleb128 .LVU930
+	.uleb128 .LVU931
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU904
+	.uleb128 .LVU912
+	.uleb128 .LVU912
+	.uleb128 .LVU929
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU908
+	.uleb128 .LVU912
+	.uleb128 .LVU912
+	.uleb128 .LVU917
+	.uleb128 .LVU917
+	.uleb128 .LVU919
+	.uleb128 .LVU919
+	.uleb128 .LVU921
+	.uleb128 .LVU921
+	.uleb128 .LVU922
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 0
+	.uleb128 .LVU571
+	.uleb128 .LVU571
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU578
+	.uleb128 .LVU578
+	.uleb128 .LVU597
+	.uleb128 .LVU597
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU564
+	.uleb128 .LVU596
+	.uleb128 .LVU598
+	.uleb128 .LVU615
+	.uleb128 .LVU616
+	.uleb128 .LVU617
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU571
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 .LVU581
+	.uleb128 .LVU581
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 .LVU596
+	.uleb128 .LVU598
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU615
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU607
+	.uleb128 .LVU610
+	.uleb128 .LVU610
+	.uleb128 .LVU611
+	.uleb128 .LVU611
+	.uleb128 .LVU613
+	.uleb128 .LVU613
+	.uleb128 .LVU615
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS179:
+	.uleb128 0
+	.uleb128 .LVU1437
+	.uleb128 .LVU1437
+	.uleb128 .LVU1471
+	.uleb128 .LVU1471
+	.uleb128 .LVU1615
+	.uleb128 .LVU1615
+	.uleb128 .LVU1616
+	.uleb128 .LVU1616
+	.uleb128 0
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 .LVL590-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL590-.Ltext0
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LVL681-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL681-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS180:
+	.uleb128 0
+	.uleb128 .LVU1436
+	.uleb128 .LVU1436
+	.uleb128 .LVU1471
+	.uleb128 .LVU1471
+	.uleb128 .LVU1579
+	.uleb128 .LVU1579
+	.uleb128 .LVU1615
+	.uleb128 .LVU1615
+	.uleb128 .LVU1616
+	.uleb128 .LVU1616
+	.uleb128 0
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 .LVL589-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL589-.Ltext0
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -408
+	.byte	0x4
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LVL681-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL681-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU1438
+	.uleb128 .LVU1442
+	.uleb128 .LVU1442
+	.uleb128 .LVU1462
+	.uleb128 .LVU1462
+	.uleb128 .LVU1464
+	.uleb128 .LVU1467
+	.uleb128 .LVU1614
+	.uleb128 .LVU1615
+	.uleb128 0
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL591-.Ltext0
+	.uleb128 .LVL592-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL592-1-.Ltext0
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 .LVL597-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL599-.Ltext0
+	.uleb128 .LVL679-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU1451
+	.uleb128 .LVU1462
+	.uleb128 .LVU1471
+	.uleb128 .LVU1533
+	.uleb128 .LVU1534
+	.uleb128 .LVU1537
+	.uleb128 .LVU1538
+	.uleb128 .LVU1579
+	.uleb128 .LVU1615
+	.uleb128 .LVU1616
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL594-.Ltext0
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL639-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 .LVL643-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LVL681-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU1452
+	.uleb128 .LVU1462
+	.uleb128 .LVU1471
+	.uleb128 .LVU1489
+	.uleb128 .LVU1489
+	.uleb128 .LVU1532
+	.uleb128 .LVU1534
+	.uleb128 .LVU1535
+	.uleb128 .LVU1538
+	.uleb128 .LVU1539
+	.uleb128 .LVU1539
+	.uleb128 .LVU1579
+	.uleb128 .LVU1615
+	.uleb128 .LVU1616
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL594-.Ltext0
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LVL681-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU1453
+	.uleb128 .LVU1462
+	.uleb128 .LVU1471
+	.uleb128 .LVU1483
+	.uleb128 .LVU1483
+	.uleb128 .LVU1484
+	.uleb128 .LVU1484
+	.uleb128 .LVU1488
+	.uleb128 .LVU1488
+	.uleb128 .LVU1489
+	.uleb128 .LVU1489
+	.uleb128 .LVU1579
+	.uleb128 .LVU1607
+	.uleb128 .LVU1612
+	.uleb128 .LVU1615
+	.uleb128 .LVU1616
+	.uleb128 .LVU1618
+	.uleb128 0
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL594-.Ltext0
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL609-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -410
+	.byte	0x4
+	.uleb128 .LVL609-.Ltext0
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL613-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -410
+	.byte	0x4
+	.uleb128 .LVL613-.Ltext0
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -410
+	.byte	0x4
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 .LVL678-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -410
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LVL681-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL682-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU1455
+	.uleb128 .LVU1462
+	.uleb128 .LVU1471
+	.uleb128 .LVU1579
+	.uleb128 .LVU1615
+	.uleb128 .LVU1616
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL595-.Ltext0
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -409
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LVL681-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU1471
+	.uleb128 .LVU1480
+	.uleb128 .LVU1484
+	.uleb128 .LVU1486
+	.uleb128 .LVU1550
+	.uleb128 .LVU1558
+	.uleb128 .LVU1558
+	.uleb128 .LVU1568
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL608-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL650-.Ltext0
+	.uleb128 .LVL653-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL653-1-.Ltext0
+	.uleb128 .LVL656-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU1471
+	.uleb128 .LVU1474
+	.uleb128 .LVU1474
+	.uleb128 .LVU1475
+	.uleb128 .LVU1475
+	.uleb128 .LVU1484
+	.uleb128 .LVU1484
+	.uleb128 .LVU1485
+	.uleb128 .LVU1485
+	.uleb128 .LVU1489
+	.uleb128 .LVU1489
+	.uleb128 .LVU1539
+	.uleb128 .LVU1554
+	.uleb128 .LVU1557
+	.uleb128 .LVU1557
+	.uleb128 .LVU1558
+	.uleb128 .LVU1558
+	.uleb128 .LVU1566
+	.uleb128 .LVU1566
+	.uleb128 .LVU1578
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL604-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -384
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL604-.Ltext0
+	.uleb128 .LVL605-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL605-1-.Ltext0
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -384
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -384
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 .LVL653-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL653-1-.Ltext0
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -384
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 .LVL660-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU1471
+	.uleb128 .LVU1473
+	.uleb128 .LVU1473
+	.uleb128 .LVU1484
+	.uleb128 .LVU1484
+	.uleb128 .LVU1486
+	.uleb128 .LVU1486
+	.uleb128 .LVU1489
+	.uleb128 .LVU1489
+	.uleb128 .LVU1539
+	.uleb128 .LVU1559
+	.uleb128 .LVU1566
+	.uleb128 .LVU1566
+	.uleb128 .LVU1578
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL603-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL603-1-.Ltext0
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x4
+	.uleb128 .LVL654-.Ltext0
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 .LVL660-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU1489
+	.uleb128 .LVU1510
+	.uleb128 .LVU1510
+	.uleb128 .LVU1511
+	.uleb128 .LVU1511
+	.uleb128 .LVU1512
+	.uleb128 .LVU1512
+	.uleb128 .LVU1538
+	.uleb128 .LVU1538
+	.uleb128 .LVU1539
+	.uleb128 .LVU1577
+	.uleb128 .LVU1578
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 .LVL627-.Ltext0
+	.uleb128 0xe
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL627-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 0xe
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL659-.Ltext0
+	.uleb128 .LVL660-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU1489
+	.uleb128 .LVU1499
+	.uleb128 .LVU1514
+	.uleb128 .LVU1522
+	.uleb128 .LVU1523
+	.uleb128 .LVU1538
+.LLST194:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL620-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL631-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU1489
+	.uleb128 .LVU1506
+	.uleb128 .LVU1514
+	.uleb128 .LVU1538
+.LLST195:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL624-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -92
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -92
+	.byte	0x9f
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU1489
+	.uleb128 .LVU1506
+	.uleb128 .LVU1514
+	.uleb128 .LVU1538
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL624-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6704
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6704
+	.sleb128 0
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU1489
+	.uleb128 .LVU1506
+	.uleb128 .LVU1514
+	.uleb128 .LVU1538
+.LLST197:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL624-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6684
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6684
+	.sleb128 0
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU1489
+	.uleb128 .LVU1504
+	.uleb128 .LVU1504
+	.uleb128 .LVU1505
+	.uleb128 .LVU1505
+	.uleb128 .LVU1506
+	.uleb128 .LVU1514
+	.uleb128 .LVU1517
+	.uleb128 .LVU1517
+	.uleb128 .LVU1518
+	.uleb128 .LVU1518
+	.uleb128 .LVU1538
+.LLST198:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 .LVL624-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL624-1-.Ltext0
+	.uleb128 .LVL624-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 .LVL630-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL630-1-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU1489
+	.uleb128 .LVU1491
+	.uleb128 .LVU1501
+	.uleb128 .LVU1503
+	.uleb128 .LVU1503
+	.uleb128 .LVU1505
+	.uleb128 .LVU1505
+	.uleb128 .LVU1506
+	.uleb128 .LVU1518
+	.uleb128 .LVU1523
+.LLST199:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL615-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LVL624-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL624-1-.Ltext0
+	.uleb128 .LVL624-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 1
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS200:
+	.uleb128 .LVU1494
+	.uleb128 .LVU1496
+	.uleb128 .LVU1496
+	.uleb128 .LVU1505
+.LLST200:
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 .LVL624-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU1525
+	.uleb128 .LVU1538
+.LLST201:
+	.byte	0x4
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU1527
+	.uleb128 .LVU1530
+	.uleb128 .LVU1530
+	.uleb128 .LVU1534
+	.uleb128 .LVU1534
+	.uleb128 .LVU1536
+	.uleb128 .LVU1536
+	.uleb128 .LVU1538
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 .LVL636-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL636-1-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0
+.LVUS203:
+	.uleb128 .LVU1585
+	.uleb128 .LVU1588
+	.uleb128 .LVU1588
+	.uleb128 .LVU1597
+.LLST203:
+	.byte	0x4
+	.uleb128 .LVL663-.Ltext0
+	.uleb128 .LVL664-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL664-.Ltext0
+	.uleb128 .LVL670-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS178:
+	.uleb128 0
+	.uleb128 .LVU1418
+	.uleb128 .LVU1418
+	.uleb128 .LVU1431
+	.uleb128 .LVU1431
+	.uleb128 0
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL583-.Ltext0
+	.uleb128 .LVL584-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL584-1-.Ltext0
+	.uleb128 .LVL587-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL587-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU1402
+	.uleb128 .LVU1404
+	.uleb128 .LVU1406
+	.uleb128 .LVU1411
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL578-.Ltext0
+	.uleb128 .LVL579-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL580-.Ltext0
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS167:
+	.uleb128 0
+	.uleb128 .LVU1336
+	.uleb128 .LVU1336
+	.uleb128 .LVU1369
+	.uleb128 .LVU1369
+	.uleb128 .LVU1371
+	.uleb128 .LVU1375
+	.uleb128 .LVU1380
+	.uleb128 .LVU1380
+	.uleb128 .LVU1382
+	.uleb128 .LVU1382
+	.uleb128 .LVU1399
+	.uleb128 .LVU1399
+	.uleb128 0
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 .LVL560-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL560-.Ltext0
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 .LVL571-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL571-.Ltext0
+	.uleb128 .LVL577-.Ltext0
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 1
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL577-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS168:
+	.uleb128 0
+	.uleb128 .LVU1336
+	.uleb128 .LVU1336
+	.uleb128 .LVU1372
+	.uleb128 .LVU1375
+	.uleb128 0
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 .LVL562-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS169:
+	.uleb128 0
+	.uleb128 .LVU1336
+	.uleb128 .LVU1336
+	.uleb128 0
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.byte	0
+.LVUS170:
+	.uleb128 0
+	.uleb128 .LVU1336
+	.uleb128 .LVU1336
+	.uleb128 .LVU1373
+	.uleb128 .LVU1373
+	.uleb128 .LVU1375
+	.uleb128 .LVU1375
+	.uleb128 0
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 .LVL563-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL563-.Ltext0
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS171:
+	.uleb128 0
+	.uleb128 .LVU1336
+	.uleb128 .LVU1336
+	.uleb128 .LVU1374
+	.uleb128 .LVU1374
+	.uleb128 .LVU1375
+	.uleb128 .LVU1375
+	.uleb128 0
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU1341
+	.uleb128 .LVU1342
+	.uleb128 .LVU1395
+	.uleb128 .LVU1398
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 .LVL556-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL575-.Ltext0
+	.uleb128 .LVL576-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU1363
+	.uleb128 .LVU1371
+	.uleb128 .LVU1375
+	.uleb128 .LVU1387
+	.uleb128 .LVU1387
+	.uleb128 .LVU1395
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LVL573-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL573-.Ltext0
+	.uleb128 .LVL575-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU1382
+	.uleb128 .LVU1386
+	.uleb128 .LVU1386
+	.uleb128 .LVU1399
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL571-.Ltext0
+	.uleb128 .LVL572-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL572-.Ltext0
+	.uleb128 .LVL577-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU223
+	.uleb128 .LVU234
+	.uleb128 .LVU237
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU271
+	.uleb128 .LVU286
+	.uleb128 .LVU301
+	.uleb128 .LVU303
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU223
+	.uleb128 .LVU234
+	.uleb128 .LVU239
+	.uleb128 .LVU256
+	.uleb128 .LVU265
+	.uleb128 .LVU270
+	.uleb128 .LVU286
+	.uleb128 .LVU301
+	.uleb128 .LVU303
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU223
+	.uleb128 .LVU234
+	.uleb128 .LVU241
+	.uleb128 .LVU249
+	.uleb128 .LVU249
+	.uleb128 .LVU271
+	.uleb128 .LVU286
+	.uleb128 .LVU290
+	.uleb128 .LVU303
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU307
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU229
+	.uleb128 .LVU234
+	.uleb128 .LVU251
+	.uleb128 .LVU253
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU290
+	.uleb128 .LVU300
+	.uleb128 .LVU305
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU253
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU266
+	.uleb128 .LVU266
+	.uleb128 .LVU267
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL102-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL102-1-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 4
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU194
+	.uleb128 .LVU216
+	.uleb128 .LVU219
+	.uleb128 .LVU222
+	.uleb128 .LVU271
+	.uleb128 .LVU286
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU197
+	.uleb128 .LVU223
+	.uleb128 .LVU271
+	.uleb128 .LVU286
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU198
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU206
+	.uleb128 .LVU219
+	.uleb128 .LVU223
+	.uleb128 .LVU271
+	.uleb128 .LVU278
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x9
+	.byte	0x7f
+	.sleb128 65576
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU203
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU214
+	.uleb128 .LVU271
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 .LVU286
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU207
+	.uleb128 .LVU214
+	.uleb128 .LVU271
+	.uleb128 .LVU278
+	.uleb128 .LVU279
+	.uleb128 .LVU285
+	.uleb128 .LVU285
+	.uleb128 .LVU286
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU146
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LFE59-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU156
+	.uleb128 .LVU173
+	.uleb128 .LVU175
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LFE57-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU163
+	.uleb128 .LVU170
+	.uleb128 .LVU175
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LFE57-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU165
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU169
+	.uleb128 .LVU175
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE57-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS110:
+	.uleb128 0
+	.uleb128 .LVU822
+	.uleb128 .LVU822
+	.uleb128 .LVU826
+	.uleb128 .LVU826
+	.uleb128 .LVU827
+	.uleb128 .LVU827
+	.uleb128 .LVU860
+	.uleb128 .LVU860
+	.uleb128 .LVU861
+	.uleb128 .LVU861
+	.uleb128 .LVU865
+	.uleb128 .LVU865
+	.uleb128 0
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL347-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL347-1-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU823
+	.uleb128 .LVU825
+	.uleb128 .LVU825
+	.uleb128 .LVU826
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU833
+	.uleb128 .LVU841
+	.uleb128 .LVU841
+	.uleb128 .LVU860
+	.uleb128 .LVU861
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU865
+	.uleb128 .LVU867
+	.uleb128 .LVU867
+	.uleb128 0
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS149:
+	.uleb128 0
+	.uleb128 .LVU1209
+	.uleb128 .LVU1209
+	.uleb128 .LVU1231
+	.uleb128 .LVU1231
+	.uleb128 .LVU1234
+	.uleb128 .LVU1234
+	.uleb128 .LVU1238
+	.uleb128 .LVU1238
+	.uleb128 0
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 .LVL495-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL495-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS150:
+	.uleb128 0
+	.uleb128 .LVU1208
+	.uleb128 .LVU1208
+	.uleb128 .LVU1224
+	.uleb128 .LVU1224
+	.uleb128 .LVU1231
+	.uleb128 .LVU1231
+	.uleb128 .LVU1233
+	.uleb128 .LVU1233
+	.uleb128 .LVU1237
+	.uleb128 .LVU1237
+	.uleb128 .LVU1238
+	.uleb128 .LVU1238
+	.uleb128 0
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU1219
+	.uleb128 .LVU1225
+	.uleb128 .LVU1225
+	.uleb128 .LVU1231
+	.uleb128 .LVU1252
+	.uleb128 .LVU1254
+	.uleb128 .LVU1254
+	.uleb128 0
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU1221
+	.uleb128 .LVU1225
+	.uleb128 .LVU1225
+	.uleb128 .LVU1231
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU1244
+	.uleb128 .LVU1247
+	.uleb128 .LVU1247
+	.uleb128 .LVU1248
+	.uleb128 .LVU1248
+	.uleb128 .LVU1250
+	.uleb128 .LVU1250
+	.uleb128 .LVU1251
+	.uleb128 .LVU1251
+	.uleb128 .LVU1252
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 .LVL515-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL515-1-.Ltext0
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 .LVL517-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL517-1-.Ltext0
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU1221
+	.uleb128 .LVU1225
+	.uleb128 .LVU1225
+	.uleb128 .LVU1231
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS89:
+	.uleb128 0
+	.uleb128 .LVU706
+	.uleb128 .LVU706
+	.uleb128 .LVU708
+	.uleb128 .LVU708
+	.uleb128 .LVU710
+	.uleb128 .LVU710
+	.uleb128 .LVU730
+	.uleb128 .LVU730
+	.uleb128 0
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS90:
+	.uleb128 0
+	.uleb128 .LVU706
+	.uleb128 .LVU706
+	.uleb128 .LVU709
+	.uleb128 .LVU709
+	.uleb128 .LVU710
+	.uleb128 .LVU710
+	.uleb128 0
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU700
+	.uleb128 .LVU706
+	.uleb128 .LVU710
+	.uleb128 0
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU702
+	.uleb128 .LVU706
+	.uleb128 .LVU710
+	.uleb128 0
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU710
+	.uleb128 .LVU726
+	.uleb128 .LVU727
+	.uleb128 .LVU730
+	.uleb128 .LVU730
+	.uleb128 0
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS138:
+	.uleb128 0
+	.uleb128 .LVU1100
+	.uleb128 .LVU1100
+	.uleb128 0
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS139:
+	.uleb128 0
+	.uleb128 .LVU1100
+	.uleb128 .LVU1100
+	.uleb128 0
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -340
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU1094
+	.uleb128 .LVU1100
+	.uleb128 .LVU1100
+	.uleb128 .LVU1123
+	.uleb128 .LVU1125
+	.uleb128 .LVU1127
+	.uleb128 .LVU1131
+	.uleb128 .LVU1171
+	.uleb128 .LVU1171
+	.uleb128 .LVU1172
+	.uleb128 .LVU1172
+	.uleb128 .LVU1175
+	.uleb128 .LVU1175
+	.uleb128 .LVU1196
+	.uleb128 .LVU1196
+	.uleb128 .LVU1198
+	.uleb128 .LVU1198
+	.uleb128 0
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -341
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL466-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -341
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -341
+	.byte	0x4
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -341
+	.byte	0x4
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -341
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU1095
+	.uleb128 .LVU1100
+	.uleb128 .LVU1100
+	.uleb128 .LVU1157
+	.uleb128 .LVU1157
+	.uleb128 .LVU1162
+	.uleb128 .LVU1162
+	.uleb128 .LVU1186
+	.uleb128 .LVU1186
+	.uleb128 .LVU1189
+	.uleb128 .LVU1189
+	.uleb128 0
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL478-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL478-1-.Ltext0
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.byte	0x4
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU1104
+	.uleb128 .LVU1108
+	.uleb128 .LVU1108
+	.uleb128 .LVU1112
+	.uleb128 .LVU1125
+	.uleb128 .LVU1129
+	.uleb128 .LVU1129
+	.uleb128 .LVU1131
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 .LVL457-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL457-1-.Ltext0
+	.uleb128 .LVL460-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU1109
+	.uleb128 .LVU1111
+	.uleb128 .LVU1111
+	.uleb128 .LVU1123
+	.uleb128 .LVU1131
+	.uleb128 .LVU1142
+	.uleb128 .LVU1198
+	.uleb128 0
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 .LVL459-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL459-1-.Ltext0
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -360
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -360
+	.byte	0x4
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -360
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU1112
+	.uleb128 .LVU1116
+	.uleb128 .LVU1116
+	.uleb128 .LVU1123
+	.uleb128 .LVU1131
+	.uleb128 .LVU1159
+	.uleb128 .LVU1175
+	.uleb128 .LVU1188
+	.uleb128 .LVU1198
+	.uleb128 0
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL460-.Ltext0
+	.uleb128 .LVL461-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL461-1-.Ltext0
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU1117
+	.uleb128 .LVU1120
+	.uleb128 .LVU1120
+	.uleb128 .LVU1123
+	.uleb128 .LVU1131
+	.uleb128 .LVU1168
+	.uleb128 .LVU1168
+	.uleb128 .LVU1175
+	.uleb128 .LVU1175
+	.uleb128 .LVU1198
+	.uleb128 .LVU1198
+	.uleb128 .LVU1199
+	.uleb128 .LVU1199
+	.uleb128 0
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 .LVL463-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL463-1-.Ltext0
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -360
+	.byte	0x4
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 .LVL492-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL492-1-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU1133
+	.uleb128 .LVU1137
+	.uleb128 .LVU1137
+	.uleb128 .LVU1198
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU1159
+	.uleb128 .LVU1175
+	.uleb128 .LVU1188
+	.uleb128 .LVU1198
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS56:
+	.uleb128 0
+	.uleb128 .LVU413
+	.uleb128 .LVU413
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU420
+	.uleb128 .LVU420
+	.uleb128 .LVU423
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU415
+	.uleb128 .LVU422
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS98:
+	.uleb128 0
+	.uleb128 .LVU749
+	.uleb128 .LVU749
+	.uleb128 .LVU756
+	.uleb128 .LVU756
+	.uleb128 .LVU763
+	.uleb128 .LVU763
+	.uleb128 .LVU771
+	.uleb128 .LVU771
+	.uleb128 0
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 0
+	.uleb128 .LVU750
+	.uleb128 .LVU750
+	.uleb128 .LVU762
+	.uleb128 .LVU762
+	.uleb128 .LVU763
+	.uleb128 .LVU763
+	.uleb128 0
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL308-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL308-1-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU750
+	.uleb128 .LVU755
+	.uleb128 .LVU759
+	.uleb128 .LVU760
+	.uleb128 .LVU763
+	.uleb128 .LVU767
+	.uleb128 .LVU767
+	.uleb128 .LVU769
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL312-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL318-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU751
+	.uleb128 .LVU756
+	.uleb128 .LVU756
+	.uleb128 .LVU759
+	.uleb128 .LVU759
+	.uleb128 .LVU761
+	.uleb128 .LVU763
+	.uleb128 0
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL311-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL311-1-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU765
+	.uleb128 .LVU768
+	.uleb128 .LVU768
+	.uleb128 .LVU769
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1a
+	.byte	0x3
+	.quad	last_time
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0x3
+	.quad	first_time
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL318-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS107:
+	.uleb128 0
+	.uleb128 .LVU805
+	.uleb128 .LVU805
+	.uleb128 .LVU810
+	.uleb128 .LVU810
+	.uleb128 .LVU812
+	.uleb128 .LVU812
+	.uleb128 0
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 0
+	.uleb128 .LVU806
+	.uleb128 .LVU806
+	.uleb128 .LVU809
+	.uleb128 .LVU809
+	.uleb128 .LVU810
+	.uleb128 .LVU810
+	.uleb128 .LVU811
+	.uleb128 .LVU811
+	.uleb128 .LVU815
+	.uleb128 .LVU815
+	.uleb128 0
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL336-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL336-1-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU807
+	.uleb128 .LVU809
+	.uleb128 .LVU815
+	.uleb128 .LVU816
+	.uleb128 .LVU816
+	.uleb128 0
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS115:
+	.uleb128 0
+	.uleb128 .LVU883
+	.uleb128 .LVU883
+	.uleb128 .LVU887
+	.uleb128 .LVU887
+	.uleb128 .LVU889
+	.uleb128 .LVU889
+	.uleb128 0
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 0
+	.uleb128 .LVU884
+	.uleb128 .LVU884
+	.uleb128 .LVU886
+	.uleb128 .LVU886
+	.uleb128 .LVU887
+	.uleb128 .LVU887
+	.uleb128 .LVU888
+	.uleb128 .LVU888
+	.uleb128 .LVU892
+	.uleb128 .LVU892
+	.uleb128 0
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 .LVL365-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL365-1-.Ltext0
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS155:
+	.uleb128 0
+	.uleb128 .LVU1274
+	.uleb128 .LVU1274
+	.uleb128 .LVU1327
+	.uleb128 .LVU1327
+	.uleb128 0
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL529-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL529-1-.Ltext0
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS156:
+	.uleb128 0
+	.uleb128 .LVU1273
+	.uleb128 .LVU1273
+	.uleb128 .LVU1327
+	.uleb128 .LVU1327
+	.uleb128 0
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU1272
+	.uleb128 .LVU1282
+	.uleb128 .LVU1325
+	.uleb128 .LVU1327
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL527-.Ltext0
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU1261
+	.uleb128 .LVU1269
+	.uleb128 .LVU1288
+	.uleb128 .LVU1300
+	.uleb128 .LVU1300
+	.uleb128 .LVU1308
+	.uleb128 .LVU1308
+	.uleb128 .LVU1309
+	.uleb128 .LVU1310
+	.uleb128 .LVU1325
+	.uleb128 .LVU1327
+	.uleb128 0
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 .LVL526-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 .LVL543-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL543-.Ltext0
+	.uleb128 .LVL544-.Ltext0
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL544-.Ltext0
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU1264
+	.uleb128 .LVU1269
+	.uleb128 .LVU1282
+	.uleb128 .LVU1286
+	.uleb128 .LVU1288
+	.uleb128 .LVU1325
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL524-.Ltext0
+	.uleb128 .LVL526-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU1267
+	.uleb128 .LVU1269
+	.uleb128 .LVU1282
+	.uleb128 .LVU1286
+	.uleb128 .LVU1288
+	.uleb128 .LVU1297
+	.uleb128 .LVU1297
+	.uleb128 .LVU1306
+	.uleb128 .LVU1306
+	.uleb128 .LVU1325
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL525-.Ltext0
+	.uleb128 .LVL526-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU1291
+	.uleb128 .LVU1293
+	.uleb128 .LVU1315
+	.uleb128 .LVU1324
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL537-.Ltext0
+	.uleb128 .LVL538-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL546-.Ltext0
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU1295
+	.uleb128 .LVU1296
+	.uleb128 .LVU1320
+	.uleb128 .LVU1325
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL539-.Ltext0
+	.uleb128 .LVL540-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL547-.Ltext0
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS135:
+	.uleb128 0
+	.uleb128 .LVU1080
+	.uleb128 .LVU1080
+	.uleb128 0
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL449-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL449-1-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 0
+	.uleb128 .LVU1079
+	.uleb128 .LVU1079
+	.uleb128 .LVU1090
+	.uleb128 .LVU1090
+	.uleb128 0
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL451-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL451-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU1080
+	.uleb128 .LVU1089
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 .LVU328
+	.uleb128 .LVU328
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 .LVU328
+	.uleb128 .LVU328
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU312
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU316
+	.uleb128 .LVU316
+	.uleb128 .LVU317
+	.uleb128 .LVU317
+	.uleb128 .LVU319
+	.uleb128 .LVU324
+	.uleb128 .LVU325
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+	.uleb128 .LVU18
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU28
+	.uleb128 .LVU46
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU61
+	.uleb128 .LVU73
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU73
+	.uleb128 .LVU83
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU496
+	.uleb128 .LVU496
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU444
+	.uleb128 .LVU455
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU445
+	.uleb128 .LVU475
+	.uleb128 .LVU480
+	.uleb128 .LVU485
+	.uleb128 .LVU485
+	.uleb128 .LVU489
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU455
+	.uleb128 .LVU472
+	.uleb128 .LVU487
+	.uleb128 .LVU489
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU448
+	.uleb128 .LVU450
+	.uleb128 .LVU450
+	.uleb128 .LVU451
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU458
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU461
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU471
+	.uleb128 .LVU475
+	.uleb128 .LVU479
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU482
+	.uleb128 .LVU483
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU489
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS134:
+	.uleb128 0
+	.uleb128 .LVU1063
+	.uleb128 .LVU1063
+	.uleb128 0
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 0
+	.uleb128 .LVU777
+	.uleb128 .LVU777
+	.uleb128 .LVU778
+	.uleb128 .LVU778
+	.uleb128 .LVU783
+	.uleb128 .LVU783
+	.uleb128 0
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL323-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL323-1-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU784
+	.uleb128 .LVU788
+	.uleb128 .LVU788
+	.uleb128 .LVU792
+	.uleb128 .LVU792
+	.uleb128 .LVU795
+	.uleb128 .LVU795
+	.uleb128 .LVU797
+	.uleb128 .LVU797
+	.uleb128 .LVU798
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL325-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL325-1-.Ltext0
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL332-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL332-1-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU789
+	.uleb128 .LVU790
+	.uleb128 .LVU790
+	.uleb128 .LVU795
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL327-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL327-1-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU792
+	.uleb128 .LVU793
+	.uleb128 .LVU793
+	.uleb128 .LVU795
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL330-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL330-1-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS96:
+	.uleb128 0
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 .LVU743
+	.uleb128 .LVU743
+	.uleb128 0
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 0
+	.uleb128 .LVU739
+	.uleb128 .LVU739
+	.uleb128 .LVU744
+	.uleb128 .LVU744
+	.uleb128 0
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 0
+	.uleb128 .LVU625
+	.uleb128 .LVU625
+	.uleb128 .LVU655
+	.uleb128 .LVU655
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 .LVU687
+	.uleb128 .LVU687
+	.uleb128 .LVU691
+	.uleb128 .LVU691
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 0
+	.uleb128 .LVU625
+	.uleb128 .LVU625
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU676
+	.uleb128 .LVU676
+	.uleb128 .LVU687
+	.uleb128 .LVU687
+	.uleb128 .LVU690
+	.uleb128 .LVU690
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL260-1-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 0
+	.uleb128 .LVU625
+	.uleb128 .LVU625
+	.uleb128 .LVU632
+	.uleb128 .LVU632
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 .LVU687
+	.uleb128 .LVU687
+	.uleb128 .LVU689
+	.uleb128 .LVU689
+	.uleb128 .LVU695
+	.uleb128 .LVU695
+	.uleb128 0
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL260-1-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU621
+	.uleb128 .LVU632
+	.uleb128 .LVU632
+	.uleb128 .LVU634
+	.uleb128 .LVU634
+	.uleb128 .LVU655
+	.uleb128 .LVU657
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 .LVU674
+	.uleb128 .LVU674
+	.uleb128 .LVU687
+	.uleb128 .LVU687
+	.uleb128 .LVU694
+	.uleb128 .LVU694
+	.uleb128 0
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU659
+	.uleb128 .LVU665
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU629
+	.uleb128 .LVU631
+	.uleb128 .LVU631
+	.uleb128 .LVU639
+	.uleb128 .LVU669
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU686
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL252-1-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL266-1-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU636
+	.uleb128 .LVU639
+	.uleb128 .LVU639
+	.uleb128 .LVU655
+	.uleb128 .LVU676
+	.uleb128 .LVU680
+	.uleb128 .LVU680
+	.uleb128 .LVU687
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS51:
+	.uleb128 0
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU407
+	.uleb128 .LVU407
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 0
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU384
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU406
+	.uleb128 .LVU408
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU385
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 .LVU403
+	.uleb128 .LVU403
+	.uleb128 .LVU404
+	.uleb128 .LVU404
+	.uleb128 .LVU405
+	.uleb128 .LVU408
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0xb
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0xd
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU332
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU352
+	.uleb128 .LVU352
+	.uleb128 .LVU356
+	.uleb128 .LVU356
+	.uleb128 .LVU359
+	.uleb128 .LVU359
+	.uleb128 .LVU360
+	.uleb128 .LVU360
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU333
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS127:
+	.uleb128 0
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU1007
+	.uleb128 .LVU1007
+	.uleb128 0
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 0
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU1010
+	.uleb128 .LVU1010
+	.uleb128 0
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS129:
+	.uleb128 0
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU1009
+	.uleb128 .LVU1009
+	.uleb128 0
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 0
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU1008
+	.uleb128 .LVU1008
+	.uleb128 0
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU978
+	.uleb128 .LVU1006
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU979
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU990
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	param_list
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU992
+	.uleb128 .LVU1005
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL409-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS121:
+	.uleb128 0
+	.uleb128 .LVU941
+	.uleb128 .LVU941
+	.uleb128 .LVU971
+	.uleb128 .LVU971
+	.uleb128 0
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS122:
+	.uleb128 0
+	.uleb128 .LVU941
+	.uleb128 .LVU941
+	.uleb128 .LVU973
+	.uleb128 .LVU973
+	.uleb128 0
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 0
+	.uleb128 .LVU941
+	.uleb128 .LVU941
+	.uleb128 .LVU972
+	.uleb128 .LVU972
+	.uleb128 0
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU936
+	.uleb128 .LVU970
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU937
+	.uleb128 .LVU941
+	.uleb128 .LVU941
+	.uleb128 .LVU948
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	cmd_list
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU950
+	.uleb128 .LVU969
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL395-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS58:
+	.uleb128 0
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 .LVU547
+	.uleb128 .LVU547
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS70:
+	.uleb128 0
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU540
+	.uleb128 0
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU507
+	.uleb128 .LVU537
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU511
+	.uleb128 .LVU517
+	.uleb128 .LVU517
+	.uleb128 .LVU537
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU513
+	.uleb128 .LVU517
+	.uleb128 .LVU517
+	.uleb128 .LVU528
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU103
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU118
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU87
+	.uleb128 .LVU100
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU89
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU99
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x811c9dc5
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x811c9dc5
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0
+.LLRL24:
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0
+.LLRL66:
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL77:
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0
+.LLRL85:
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0
+.LLRL92:
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0
+.LLRL113:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0
+.LLRL119:
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL142:
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0
+.LLRL157:
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0
+.LLRL159:
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0
+.LLRL163:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0
+.LLRL165:
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0
+.LLRL175:
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0
+.LLRL176:
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0
+.LLRL186:
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0
+.LLRL190:
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0
+.LLRL191:
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0
+.LLRL193:
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0
+.LLRL217:
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB116-.Ltext0
+	.uleb128 .LBE116-.Ltext0
+	.byte	0
+.LLRL219:
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0
+.LLRL221:
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB119-.Ltext0
+	.uleb128 .LBE119-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF169:
+	.string	"quit_helpers"
+.LASF58:
+	.string	"__glibc_reserved"
+.LASF234:
+	.string	"metric_end"
+.LASF57:
+	.string	"st_ctim"
+.LASF63:
+	.string	"size_t"
+.LASF142:
+	.string	"slot_t"
+.LASF319:
+	.string	"start"
+.LASF271:
+	.string	"readline"
+.LASF220:
+	.string	"munmap"
+.LASF35:
+	.string	"_ISgraph"
+.LASF117:
+	.string	"total_ns"
+.LASF53:
+	.string	"st_blksize"
+.LASF148:
+	.string	"prompt_flag"
+.LASF54:
+	.string	"st_blocks"
+.LASF318:
+	.string	"record"
+.LASF25:
+	.string	"__ssize_t"
+.LASF96:
+	.string	"_IO_codecvt"
+.LASF153:
+	.string	"RIO_ELE"
+.LASF76:
+	.string	"_IO_save_end"
+.LASF141:
+	.string	"param_list"
+.LASF15:
+	.string	"__gid_t"
+.LASF138:
+	.string	"dudect_pool"
+.LASF178:
+	.string	"reps"
+.LASF56:
+	.string	"st_mtim"
+.LASF168:
+	.string	"prompt"
+.LASF69:
+	.string	"_IO_write_base"
+.LASF210:
+	.string	"open"
+.LASF299:
+	.string	"found"
+.LASF85:
+	.string	"_lock"
+.LASF123:
+	.string	"PELE"
+.LASF313:
+	.string	"async_changed"
+.LASF109:
+	.string	"old_measure"
+.LASF214:
+	.string	"time_ns"
+.LASF320:
+	.string	"pop_file"
+.LASF43:
+	.string	"stat"
+.LASF74:
+	.string	"_IO_save_base"
+.LASF216:
+	.string	"metrics_enabled"
+.LASF78:
+	.string	"_chain"
+.LASF98:
+	.string	"ssize_t"
+.LASF241:
+	.string	"chars"
+.LASF82:
+	.string	"_cur_column"
+.LASF13:
+	.string	"__dev_t"
+.LASF331:
+	.string	"table_insert"
+.LASF267:
+	.string	"result"
+.LASF275:
+	.string	"next_compiled"
+.LASF310:
+	.string	"set_echo"
+.LASF300:
+	.string	"oldval"
+.LASF124:
+	.string	"valp"
+.LASF308:
+	.string	"do_quit_cmd"
+.LASF122:
+	.string	"setter_function"
+.LASF240:
+	.string	"strings"
+.LASF274:
+	.string	"left"
+.LASF11:
+	.string	"long int"
+.LASF255:
+	.string	"nstringsp"
+.LASF224:
+	.string	"memmove"
+.LASF311:
+	.string	"set_metrics_helper"
+.LASF139:
+	.string	"dudect_sequential"
+.LASF95:
+	.string	"_IO_marker"
+.LASF160:
+	.string	"buf_stack"
+.LASF188:
+	.string	"bc_left"
+.LASF34:
+	.string	"_ISprint"
+.LASF304:
+	.string	"do_metrics_cmd"
+.LASF170:
+	.string	"quit_helper_cnt"
+.LASF201:
+	.string	"select"
+.LASF119:
+	.string	"max_ns"
+.LASF228:
+	.string	"free_block"
+.LASF334:
+	.string	"table_slot"
+.LASF7:
+	.string	"signed char"
+.LASF23:
+	.string	"__blksize_t"
+.LASF322:
+	.string	"collect_args"
+.LASF172:
+	.string	"cmd_depth"
+.LASF64:
+	.string	"_IO_FILE"
+.LASF128:
+	.string	"MSG_WARN"
+.LASF97:
+	.string	"_IO_wide_data"
+.LASF48:
+	.string	"st_uid"
+.LASF279:
+	.string	"elapsed"
+.LASF256:
+	.string	"saved"
+.LASF174:
+	.string	"STEP"
+.LASF285:
+	.string	"step"
+.LASF184:
+	.string	"strtab_offset"
+.LASF103:
+	.string	"__fds_bits"
+.LASF3:
+	.string	"unsigned char"
+.LASF301:
+	.string	"get_int"
+.LASF89:
+	.string	"_freeres_list"
+.LASF51:
+	.string	"st_rdev"
+.LASF196:
+	.string	"ftello"
+.LASF199:
+	.string	"fclose"
+.LASF247:
+	.string	"compile_file"
+.LASF316:
+	.string	"run_cmd"
+.LASF238:
+	.string	"header"
+.LASF26:
+	.string	"__syscall_slong_t"
+.LASF108:
+	.string	"_Bool"
+.LASF330:
+	.string	"table"
+.LASF273:
+	.string	"readline_mapped"
+.LASF298:
+	.string	"value"
+.LASF27:
+	.string	"char"
+.LASF159:
+	.string	"rio_ptr"
+.LASF233:
+	.string	"set_metrics_file"
+.LASF303:
+	.string	"do_comment_cmd"
+.LASF268:
+	.string	"cmd_done"
+.LASF337:
+	.string	"_IO_lock_t"
+.LASF217:
+	.string	"free_array"
+.LASF289:
+	.string	"last_loc"
+.LASF100:
+	.string	"timeval"
+.LASF341:
+	.string	"__builtin_memcpy"
+.LASF17:
+	.string	"__mode_t"
+.LASF213:
+	.string	"metric_int"
+.LASF66:
+	.string	"_IO_read_ptr"
+.LASF315:
+	.string	"interpret_cmda"
+.LASF231:
+	.string	"strcmp"
+.LASF237:
+	.string	"init_time"
+.LASF208:
+	.string	"mmap"
+.LASF212:
+	.string	"metric_bool"
+.LASF277:
+	.string	"echo_line"
+.LASF112:
+	.string	"CELE"
+.LASF127:
+	.string	"metrics_function"
+.LASF77:
+	.string	"_markers"
+.LASF38:
+	.string	"_ISpunct"
+.LASF296:
+	.string	"do_option_cmd"
+.LASF140:
+	.string	"cmd_list"
+.LASF132:
+	.string	"verblevel"
+.LASF302:
+	.string	"vname"
+.LASF254:
+	.string	"capp"
+.LASF102:
+	.string	"__fd_mask"
+.LASF203:
+	.string	"printf"
+.LASF161:
+	.string	"linebuf"
+.LASF280:
+	.string	"push_file"
+.LASF101:
+	.string	"tv_usec"
+.LASF242:
+	.string	"cmds"
+.LASF291:
+	.string	"free_steps"
+.LASF86:
+	.string	"_offset"
+.LASF49:
+	.string	"st_gid"
+.LASF235:
+	.string	"close_metrics_file"
+.LASF133:
+	.string	"async_output"
+.LASF12:
+	.string	"__uint64_t"
+.LASF6:
+	.string	"long unsigned int"
+.LASF211:
+	.string	"set_logfile"
+.LASF340:
+	.string	"init_cmd"
+.LASF80:
+	.string	"_flags2"
+.LASF52:
+	.string	"st_size"
+.LASF68:
+	.string	"_IO_read_base"
+.LASF194:
+	.string	"ferror"
+.LASF177:
+	.string	"line"
+.LASF328:
+	.string	"add_cmd"
+.LASF93:
+	.string	"_unused2"
+.LASF262:
+	.string	"exceptfds"
+.LASF62:
+	.string	"uintptr_t"
+.LASF236:
+	.string	"report_flush"
+.LASF32:
+	.string	"_ISxdigit"
+.LASF175:
+	.string	"argc"
+.LASF81:
+	.string	"_old_offset"
+.LASF205:
+	.string	"free_string"
+.LASF176:
+	.string	"argv"
+.LASF323:
+	.string	"parse_args"
+.LASF209:
+	.string	"fstat"
+.LASF24:
+	.string	"__blkcnt_t"
+.LASF269:
+	.string	"read_ready"
+.LASF180:
+	.string	"step_ptr"
+.LASF309:
+	.string	"finish_cmd"
+.LASF16:
+	.string	"__ino_t"
+.LASF261:
+	.string	"writefds"
+.LASF9:
+	.string	"__uint32_t"
+.LASF99:
+	.string	"long long int"
+.LASF165:
+	.string	"echo"
+.LASF281:
+	.string	"fname"
+.LASF28:
+	.string	"_ISupper"
+.LASF282:
+	.string	"rnew"
+.LASF338:
+	.string	"__ctype_b_loc"
+.LASF2:
+	.string	"double"
+.LASF37:
+	.string	"_IScntrl"
+.LASF295:
+	.string	"do_source_cmd"
+.LASF193:
+	.string	"unlink"
+.LASF259:
+	.string	"nfds"
+.LASF71:
+	.string	"_IO_write_end"
+.LASF150:
+	.string	"block_timing"
+.LASF115:
+	.string	"documentation"
+.LASF288:
+	.string	"depth"
+.LASF162:
+	.string	"fd_max"
+.LASF164:
+	.string	"err_cnt"
+.LASF312:
+	.string	"add_quit_helper"
+.LASF327:
+	.string	"next_param"
+.LASF263:
+	.string	"timeout"
+.LASF156:
+	.string	"map_end"
+.LASF324:
+	.string	"max_args"
+.LASF223:
+	.string	"read"
+.LASF72:
+	.string	"_IO_buf_base"
+.LASF292:
+	.string	"do_time_cmd"
+.LASF5:
+	.string	"unsigned int"
+.LASF246:
+	.string	"run_bytecode"
+.LASF135:
+	.string	"crop_window"
+.LASF218:
+	.string	"report_noreturn"
+.LASF186:
+	.string	"bc_code"
+.LASF314:
+	.string	"interpret_cmd"
+.LASF226:
+	.string	"calloc_or_fail"
+.LASF50:
+	.string	"__pad0"
+.LASF91:
+	.string	"__pad5"
+.LASF325:
+	.string	"endp"
+.LASF22:
+	.string	"__suseconds_t"
+.LASF116:
+	.string	"calls"
+.LASF65:
+	.string	"_flags"
+.LASF317:
+	.string	"next_cmd"
+.LASF92:
+	.string	"_mode"
+.LASF222:
+	.string	"memchr"
+.LASF326:
+	.string	"add_param"
+.LASF270:
+	.string	"next_compiled_line"
+.LASF239:
+	.string	"strbytes"
+.LASF87:
+	.string	"_codecvt"
+.LASF146:
+	.string	"cmd_table"
+.LASF46:
+	.string	"st_nlink"
+.LASF287:
+	.string	"bodyp"
+.LASF260:
+	.string	"readfds"
+.LASF251:
+	.string	"save_echo"
+.LASF264:
+	.string	"cmdline"
+.LASF250:
+	.string	"interned"
+.LASF227:
+	.string	"malloc_or_fail"
+.LASF252:
+	.string	"word"
+.LASF147:
+	.string	"param_table"
+.LASF94:
+	.string	"FILE"
+.LASF45:
+	.string	"st_ino"
+.LASF154:
+	.string	"scan"
+.LASF44:
+	.string	"st_dev"
+.LASF265:
+	.string	"infd"
+.LASF129:
+	.string	"MSG_ERROR"
+.LASF42:
+	.string	"timespec"
+.LASF163:
+	.string	"err_limit"
+.LASF30:
+	.string	"_ISalpha"
+.LASF166:
+	.string	"quit_stats"
+.LASF185:
+	.string	"bc_header_t"
+.LASF134:
+	.string	"total_measurements"
+.LASF305:
+	.string	"do_stats_cmd"
+.LASF335:
+	.string	"hash_name"
+.LASF266:
+	.string	"local_readset"
+.LASF144:
+	.string	"size"
+.LASF121:
+	.string	"cmd_ptr"
+.LASF105:
+	.string	"long long unsigned int"
+.LASF207:
+	.string	"madvise"
+.LASF243:
+	.string	"stack_argv"
+.LASF272:
+	.string	"intern"
+.LASF36:
+	.string	"_ISblank"
+.LASF19:
+	.string	"__off_t"
+.LASF284:
+	.string	"run_steps"
+.LASF39:
+	.string	"_ISalnum"
+.LASF286:
+	.string	"parse_block"
+.LASF293:
+	.string	"delta"
+.LASF90:
+	.string	"_freeres_buf"
+.LASF33:
+	.string	"_ISspace"
+.LASF173:
+	.string	"line_source"
+.LASF329:
+	.string	"table_clear"
+.LASF21:
+	.string	"__time_t"
+.LASF232:
+	.string	"report"
+.LASF198:
+	.string	"memset"
+.LASF221:
+	.string	"delta_time"
+.LASF215:
+	.string	"metric_begin"
+.LASF75:
+	.string	"_IO_backup_base"
+.LASF84:
+	.string	"_shortbuf"
+.LASF206:
+	.string	"report_event"
+.LASF111:
+	.string	"cmd_function"
+.LASF306:
+	.string	"do_help_cmd"
+.LASF297:
+	.string	"plist"
+.LASF20:
+	.string	"__off64_t"
+.LASF179:
+	.string	"body"
+.LASF137:
+	.string	"timing_backend"
+.LASF200:
+	.string	"fopen"
+.LASF192:
+	.string	"memcmp"
+.LASF307:
+	.string	"clist"
+.LASF190:
+	.string	"bc_nstrings"
+.LASF278:
+	.string	"rsave"
+.LASF73:
+	.string	"_IO_buf_end"
+.LASF107:
+	.string	"simulation"
+.LASF113:
+	.string	"name"
+.LASF29:
+	.string	"_ISlower"
+.LASF204:
+	.string	"strtol"
+.LASF244:
+	.string	"file_name"
+.LASF245:
+	.string	"argvp"
+.LASF253:
+	.string	"stringsp"
+.LASF8:
+	.string	"short int"
+.LASF125:
+	.string	"setter"
+.LASF257:
+	.string	"run_console"
+.LASF136:
+	.string	"dudect_workers"
+.LASF61:
+	.string	"uint64_t"
+.LASF171:
+	.string	"metrics_helper"
+.LASF41:
+	.string	"tv_nsec"
+.LASF258:
+	.string	"cmd_select"
+.LASF183:
+	.string	"ncmds"
+.LASF83:
+	.string	"_vtable_offset"
+.LASF187:
+	.string	"bc_code_end"
+.LASF294:
+	.string	"do_log_cmd"
+.LASF167:
+	.string	"quit_flag"
+.LASF145:
+	.string	"name_table_t"
+.LASF191:
+	.string	"snprintf"
+.LASF181:
+	.string	"magic"
+.LASF143:
+	.string	"slots"
+.LASF130:
+	.string	"MSG_FATAL"
+.LASF104:
+	.string	"fd_set"
+.LASF248:
+	.string	"infile_name"
+.LASF155:
+	.string	"bufptr"
+.LASF230:
+	.string	"strlen"
+.LASF10:
+	.string	"__int64_t"
+.LASF225:
+	.string	"memcpy"
+.LASF47:
+	.string	"st_mode"
+.LASF14:
+	.string	"__uid_t"
+.LASF67:
+	.string	"_IO_read_end"
+.LASF118:
+	.string	"min_ns"
+.LASF152:
+	.string	"last_time"
+.LASF60:
+	.string	"uint32_t"
+.LASF283:
+	.string	"do_repeat_cmd"
+.LASF131:
+	.string	"message_t"
+.LASF79:
+	.string	"_fileno"
+.LASF182:
+	.string	"nstrings"
+.LASF88:
+	.string	"_wide_data"
+.LASF31:
+	.string	"_ISdigit"
+.LASF157:
+	.string	"start_time"
+.LASF321:
+	.string	"record_error"
+.LASF4:
+	.string	"short unsigned int"
+.LASF106:
+	.string	"stdout"
+.LASF114:
+	.string	"operation"
+.LASF332:
+	.string	"slot"
+.LASF70:
+	.string	"_IO_write_ptr"
+.LASF290:
+	.string	"save"
+.LASF195:
+	.string	"fseeko"
+.LASF59:
+	.string	"int64_t"
+.LASF126:
+	.string	"param_ptr"
+.LASF276:
+	.string	"find_newline"
+.LASF110:
+	.string	"write_data"
+.LASF336:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF229:
+	.string	"strsave_or_fail"
+.LASF18:
+	.string	"__nlink_t"
+.LASF249:
+	.string	"outfile_name"
+.LASF339:
+	.string	"init_in"
+.LASF189:
+	.string	"bc_strings"
+.LASF120:
+	.string	"next"
+.LASF219:
+	.string	"close"
+.LASF202:
+	.string	"fflush"
+.LASF149:
+	.string	"block_flag"
+.LASF158:
+	.string	"prev"
+.LASF40:
+	.string	"tv_sec"
+.LASF197:
+	.string	"fwrite"
+.LASF333:
+	.string	"table_find"
+.LASF55:
+	.string	"st_atim"
+.LASF151:
+	.string	"first_time"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"console.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -7,9 +7,9 @@
 #include <string.h>
 #include <unistd.h>
 #include "console.h"
-#include "cpucycles.h"
 #include "queue.h"
 #include "random.h"
+#include "timer.h"
 
 #define NR_MEASURE 150
 /* Allow random number range from 0 to 65535 */
@@ -23,12 +23,34 @@ const int drop_size = 20;
 static queue_t *q = NULL;
 static char random_string[NR_MEASURE][8];
 static int random_string_iter = 0;
-enum { test_insert_tail, test_size };
+
+extern int dudect_pool;
+
+/*
+ * Queues of each class kept across samples when dudect_pool > 0.  Each
+ * sample takes the next queue of its class in turn, and undoes the timed
+ * operation afterward, so the pool holds the same lengths throughout.
+ */
+static queue_t **pool[2];
+static size_t pool_size = 0;
+static size_t pool_next[2];
 
 /* Implement the necessary queue interface to simulation */
 void init_dut(void)
 {
     q = NULL;
+    release_dut();
+}
+
+void release_dut(void)
+{
+    for (int c = 0; c < 2; c++) {
+        for (size_t i = 0; i < pool_size; i++)
+            q_free(pool[c][i]);
+        free(pool[c]);
+        pool[c] = NULL;
+    }
+    pool_size = 0;
 }
 
 char *get_random_string(void)
@@ -46,11 +68,10 @@ void prepare_inputs(uint8_t *input_data, uint8_t *classes)
             *(uint16_t *) (input_data + i * chunk_size) = 0x00;
     }
 
-    for (size_t i = 0; i < NR_MEASURE; ++i) {
-        /* Generate random string */
-        randombytes((uint8_t *) random_string[i], 7);
+    /* Generate random strings */
+    randombytes((uint8_t *) random_string, sizeof(random_string));
+    for (size_t i = 0; i < NR_MEASURE; ++i)
         random_string[i][7] = 0;
-    }
 }
 
 void measure_old(int64_t *before_ticks,
@@ -66,9 +87,9 @@ void measure_old(int64_t *before_ticks,
             dut_insert_head(
                 get_random_string(),
                 *(uint16_t *) (input_data + i * chunk_size) > 0 ? 2 : 1);
-            before_ticks[i] = cpucycles();
+            before_ticks[i] = timer_read();
             dut_insert_tail(s, 1);
-            after_ticks[i] = cpucycles();
+            after_ticks[i] = timer_read();
             dut_free();
         }
     } else {
@@ -77,49 +98,170 @@ void measure_old(int64_t *before_ticks,
             dut_insert_head(
                 get_random_string(),
                 *(uint16_t *) (input_data + i * chunk_size) > 0 ? 2 : 1);
-            before_ticks[i] = cpucycles();
+            before_ticks[i] = timer_read();
             dut_size(1);
-            after_ticks[i] = cpucycles();
+            after_ticks[i] = timer_read();
             dut_free();
         }
     }
 }
 
+/*
+ * Operations under test.  Each sample builds a queue for class 0 and one
+ * for class 1, times the operation on the queue of the sample's class,
+ * and tears both down.
+ */
+static char remove_buf[sizeof(random_string[0])];
+
+static queue_t *setup_queue(size_t length)
+{
+    queue_t *q = q_new();
+    for (size_t i = 0; i < length; i++)
+        q_insert_head(q, get_random_string());
+    return q;
+}
+
+static queue_t *call_insert_tail(queue_t *q, char *s)
+{
+    q_insert_tail(q, s);
+    return q;
+}
+
+static queue_t *call_size(queue_t *q, char *s)
+{
+    q_size(q);
+    return q;
+}
+
+static queue_t *call_insert_head(queue_t *q, char *s)
+{
+    q_insert_head(q, s);
+    return q;
+}
+
+static queue_t *call_remove_head(queue_t *q, char *s)
+{
+    q_remove_head(q, remove_buf, sizeof(remove_buf));
+    return q;
+}
+
+static queue_t *call_remove_head_quiet(queue_t *q, char *s)
+{
+    q_remove_head(q, NULL, 0);
+    return q;
+}
+
+static queue_t *call_free(queue_t *q, char *s)
+{
+    q_free(q);
+    return NULL;
+}
+
+static queue_t *call_reverse(queue_t *q, char *s)
+{
+    q_reverse(q);
+    return q;
+}
+
+static void undo_none(queue_t *q) {}
+
+static void undo_insert(queue_t *q)
+{
+    q_remove_head(q, NULL, 0);
+}
+
+static void undo_remove(queue_t *q)
+{
+    q_insert_head(q, get_random_string());
+}
+
+const dut_op_t dut_ops[test_count] = {
+    [test_insert_tail] = {"insert_tail", false, setup_queue, call_insert_tail,
+                          q_free, undo_insert},
+    [test_size] = {"size", false, setup_queue, call_size, q_free, undo_none},
+    [test_insert_head] = {"insert_head", false, setup_queue, call_insert_head,
+                          q_free, undo_insert},
+    [test_remove_head] = {"remove_head", false, setup_queue, call_remove_head,
+                          q_free, undo_remove},
+    [test_remove_head_quiet] = {"remove_head_quiet", false, setup_queue,
+                                call_remove_head_quiet, q_free, undo_remove},
+    /* Linear tests vary the length every sample, so are not pooled */
+    [test_free_queue] = {"free", true, setup_queue, call_free, q_free, NULL},
+    [test_reverse] = {"reverse", true, setup_queue, call_reverse, q_free,
+                      NULL},
+};
+
+/*
+ * Queues for class 0 and 1 have lengths base and 2 * base.  Constant-time
+ * tests use base 2, so that removing an element never empties the queue.
+ */
+#define CONSTANT_BASE 2
+#define LINEAR_MIN_BASE 64
+#define LINEAR_MAX_BASE 128
+
+/*
+ * Next queue from the pool of class c.  Only constant-time tests are
+ * pooled, so class c queues have length (c + 1) * CONSTANT_BASE.
+ */
+static queue_t *pool_take(const dut_op_t *op, int c)
+{
+    if (pool_size != (size_t) dudect_pool) {
+        release_dut();
+        for (int k = 0; k < 2; k++) {
+            pool[k] = calloc(dudect_pool, sizeof(queue_t *));
+            if (!pool[k])
+                exit(111);
+            pool_next[k] = 0;
+        }
+        pool_size = dudect_pool;
+        /* Interleave the classes, so that neither gets the better memory */
+        for (size_t i = 0; i < pool_size; i++)
+            for (int k = 0; k < 2; k++)
+                pool[k][i] = op->setup((k + 1) * CONSTANT_BASE);
+    }
+    queue_t *qi = pool[c][pool_next[c]];
+    pool_next[c] = (pool_next[c] + 1) % pool_size;
+    return qi;
+}
+
 void measure(int64_t *before_ticks,
              int64_t *after_ticks,
+             size_t *lengths,
              uint8_t *input_data,
              uint8_t *classes,
              int mode)
 {
-    assert(mode == test_insert_tail || mode == test_size);
-    if (mode == test_insert_tail) {
-        for (size_t i = 0; i < number_measurements; i++) {
-            char *s = get_random_string();
-            queue_t *q0 = q_new();
-            queue_t *q1 = q_new();
-            queue_t *qi = classes[i] ? q1 : q0;
-            q_insert_head(q0, get_random_string());
-            q_insert_head(q1, get_random_string());
-            q_insert_head(q1, get_random_string());
-            before_ticks[i] = cpucycles();
-            q_insert_tail(qi, s);
-            after_ticks[i] = cpucycles();
-            q_free(q0);
-            q_free(q1);
-        }
-    } else {
-        for (size_t i = 0; i < number_measurements; i++) {
-            queue_t *q0 = q_new();
-            queue_t *q1 = q_new();
-            queue_t *qi = classes[i] ? q1 : q0;
-            q_insert_head(q0, get_random_string());
-            q_insert_head(q1, get_random_string());
-            q_insert_head(q1, get_random_string());
-            before_ticks[i] = cpucycles();
-            q_size(qi);
-            after_ticks[i] = cpucycles();
-            q_free(q0);
-            q_free(q1);
+    assert(mode >= 0 && mode < test_count);
+    const dut_op_t *op = &dut_ops[mode];
+    for (size_t i = 0; i < number_measurements; i++) {
+        size_t base = CONSTANT_BASE;
+        if (op->linear)
+            base = LINEAR_MIN_BASE +
+                   *(uint16_t *) (input_data + i * chunk_size) %
+                       (LINEAR_MAX_BASE - LINEAR_MIN_BASE);
+        char *s = get_random_string();
+        /*
+         * Build queues of both lengths, so that allocation history does not
+         * depend on the class.  The timed queue is built last: the harness
+         * searches live blocks newest first when freeing.
+         */
+        size_t other = classes[i] ? base : 2 * base;
+        lengths[i] = classes[i] ? 2 * base : base;
+        if (dudect_pool > 0 && op->undo) {
+            queue_t *qi = pool_take(op, classes[i]);
+            before_ticks[i] = timer_read();
+            op->call(qi, s);
+            after_ticks[i] = timer_read();
+            op->undo(qi);
+            continue;
         }
+        queue_t *qo = op->setup(other);
+        queue_t *qi = op->setup(lengths[i]);
+        before_ticks[i] = timer_read();
+        qi = op->call(qi, s);
+        after_ticks[i] = timer_read();
+        if (qi)
+            op->teardown(qi);
+        op->teardown(qo);
     }
 }
@@ -1,11 +1,53 @@
 #ifndef DUDECT_CONSTANT_H
 #define DUDECT_CONSTANT_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
+#include "queue.h"
+
+/* Operations that can be tested */
+enum {
+    test_insert_tail,
+    test_size,
+    test_insert_head,
+    test_remove_head,
+    test_remove_head_quiet,
+    test_free_queue,
+    test_reverse,
+    test_count
+};
+
+/* How to test one operation */
+typedef struct {
+    char *name;
+    /* Time should grow linearly with queue length, rather than be constant */
+    bool linear;
+    /* Build queue of given length */
+    queue_t *(*setup)(size_t length);
+    /* Timed operation.  Returns queue still to be torn down, if any */
+    queue_t *(*call)(queue_t *q, char *s);
+    /* Release queue built by setup */
+    void (*teardown)(queue_t *q);
+    /*
+     * Restore the length of a queue after call, so that it can be reused
+     * for later samples.  NULL if the queue must be rebuilt every sample.
+     */
+    void (*undo)(queue_t *q);
+} dut_op_t;
+
+extern const dut_op_t dut_ops[test_count];
 
 void prepare_inputs(uint8_t *input_data, uint8_t *classes);
+
+/*
+ * Time operation mode on a queue of the class of each measurement.
+ * Class 1 queues are twice as long as class 0 queues.  lengths receives
+ * the length of the queue each measurement was taken on.
+ */
 void measure(int64_t *before_ticks,
              int64_t *after_ticks,
+             size_t *lengths,
              uint8_t *input_data,
              uint8_t *classes,
              int mode);
@@ -38,4 +80,7 @@ void measure_old(int64_t *before_ticks,
 #define dut_free() ((void) (q_free(q)))
 
 void init_dut();
+
+/* Release queues kept across samples.  Call once a test is finished */
+void release_dut();
 #endif
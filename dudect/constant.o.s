@@ -0,0 +1,8105 @@
+	.file	"constant.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "dudect/constant.c"
+	.type	undo_none, @function
+undo_none:
+.LVL0:
+.LFB39:
+	.file 1 "dudect/constant.c"
+	.loc 1 166 35 view -0
+	.cfi_startproc
+	.loc 1 166 36 view .LVU1
+	ret	
+	.cfi_endproc
+.LFE39:
+	.size	undo_none, .-undo_none
+	.type	call_free, @function
+call_free:
+.LVL1:
+.LFB37:
+	.loc 1 155 1 view -0
+	.cfi_startproc
+	.loc 1 155 1 is_stmt 0 view .LVU3
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 156 5 is_stmt 1 view .LVU4
+	call	q_free@PLT	#
+.LVL2:
+	.loc 1 157 5 view .LVU5
+# dudect/constant.c:158: }
+	.loc 1 158 1 is_stmt 0 view .LVU6
+	movl	$0, %eax	#,
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE37:
+	.size	call_free, .-call_free
+	.type	call_insert_head, @function
+call_insert_head:
+.LVL3:
+.LFB34:
+	.loc 1 137 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 137 1 is_stmt 0 view .LVU8
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp86, q
+	.loc 1 138 5 is_stmt 1 view .LVU9
+	call	q_insert_head@PLT	#
+.LVL4:
+	.loc 1 139 5 view .LVU10
+# dudect/constant.c:140: }
+	.loc 1 140 1 is_stmt 0 view .LVU11
+	movq	%rbx, %rax	# q,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL5:
+	.loc 1 140 1 view .LVU12
+	ret	
+	.cfi_endproc
+.LFE34:
+	.size	call_insert_head, .-call_insert_head
+	.type	call_insert_tail, @function
+call_insert_tail:
+.LVL6:
+.LFB32:
+	.loc 1 125 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 125 1 is_stmt 0 view .LVU14
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp86, q
+	.loc 1 126 5 is_stmt 1 view .LVU15
+	call	q_insert_tail@PLT	#
+.LVL7:
+	.loc 1 127 5 view .LVU16
+# dudect/constant.c:128: }
+	.loc 1 128 1 is_stmt 0 view .LVU17
+	movq	%rbx, %rax	# q,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL8:
+	.loc 1 128 1 view .LVU18
+	ret	
+	.cfi_endproc
+.LFE32:
+	.size	call_insert_tail, .-call_insert_tail
+	.type	call_size, @function
+call_size:
+.LVL9:
+.LFB33:
+	.loc 1 131 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 131 1 is_stmt 0 view .LVU20
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp86, q
+	.loc 1 132 5 is_stmt 1 view .LVU21
+	call	q_size@PLT	#
+.LVL10:
+	.loc 1 133 5 view .LVU22
+# dudect/constant.c:134: }
+	.loc 1 134 1 is_stmt 0 view .LVU23
+	movq	%rbx, %rax	# q,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL11:
+	.loc 1 134 1 view .LVU24
+	ret	
+	.cfi_endproc
+.LFE33:
+	.size	call_size, .-call_size
+	.type	call_reverse, @function
+call_reverse:
+.LVL12:
+.LFB38:
+	.loc 1 161 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 161 1 is_stmt 0 view .LVU26
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp86, q
+	.loc 1 162 5 is_stmt 1 view .LVU27
+	call	q_reverse@PLT	#
+.LVL13:
+	.loc 1 163 5 view .LVU28
+# dudect/constant.c:164: }
+	.loc 1 164 1 is_stmt 0 view .LVU29
+	movq	%rbx, %rax	# q,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL14:
+	.loc 1 164 1 view .LVU30
+	ret	
+	.cfi_endproc
+.LFE38:
+	.size	call_reverse, .-call_reverse
+	.type	call_remove_head_quiet, @function
+call_remove_head_quiet:
+.LVL15:
+.LFB36:
+	.loc 1 149 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 149 1 is_stmt 0 view .LVU32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp86, q
+	.loc 1 150 5 is_stmt 1 view .LVU33
+	movl	$0, %edx	#,
+	movl	$0, %esi	#,
+.LVL16:
+	.loc 1 150 5 is_stmt 0 view .LVU34
+	call	q_remove_head@PLT	#
+.LVL17:
+	.loc 1 151 5 is_stmt 1 view .LVU35
+# dudect/constant.c:152: }
+	.loc 1 152 1 is_stmt 0 view .LVU36
+	movq	%rbx, %rax	# q,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL18:
+	.loc 1 152 1 view .LVU37
+	ret	
+	.cfi_endproc
+.LFE36:
+	.size	call_remove_head_quiet, .-call_remove_head_quiet
+	.type	call_remove_head, @function
+call_remove_head:
+.LVL19:
+.LFB35:
+	.loc 1 143 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 143 1 is_stmt 0 view .LVU39
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp87, q
+	.loc 1 144 5 is_stmt 1 view .LVU40
+	movl	$8, %edx	#,
+	leaq	remove_buf(%rip), %rsi	#, tmp85
+.LVL20:
+	.loc 1 144 5 is_stmt 0 view .LVU41
+	call	q_remove_head@PLT	#
+.LVL21:
+	.loc 1 145 5 is_stmt 1 view .LVU42
+# dudect/constant.c:146: }
+	.loc 1 146 1 is_stmt 0 view .LVU43
+	movq	%rbx, %rax	# q,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL22:
+	.loc 1 146 1 view .LVU44
+	ret	
+	.cfi_endproc
+.LFE35:
+	.size	call_remove_head, .-call_remove_head
+	.type	undo_insert, @function
+undo_insert:
+.LVL23:
+.LFB40:
+	.loc 1 169 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 169 1 is_stmt 0 view .LVU46
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 170 5 is_stmt 1 view .LVU47
+	movl	$0, %edx	#,
+	movl	$0, %esi	#,
+	call	q_remove_head@PLT	#
+.LVL24:
+# dudect/constant.c:171: }
+	.loc 1 171 1 is_stmt 0 view .LVU48
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE40:
+	.size	undo_insert, .-undo_insert
+	.globl	release_dut
+	.type	release_dut, @function
+release_dut:
+.LFB27:
+	.loc 1 46 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 47 5 view .LVU50
+.LBB8:
+	.loc 1 47 10 view .LVU51
+.LVL25:
+	.loc 1 47 23 view .LVU52
+	leaq	pool(%rip), %rbp	#, ivtmp.72
+	leaq	16(%rbp), %r12	#, _30
+.LVL26:
+.L19:
+.LBB9:
+	.loc 1 48 30 view .LVU53
+# dudect/constant.c:48:         for (size_t i = 0; i < pool_size; i++)
+	.loc 1 48 21 is_stmt 0 view .LVU54
+	movl	$0, %ebx	#, i
+# dudect/constant.c:48:         for (size_t i = 0; i < pool_size; i++)
+	.loc 1 48 30 view .LVU55
+	cmpq	$0, pool_size(%rip)	#, pool_size
+	je	.L22	#,
+.LVL27:
+.L20:
+	.loc 1 49 13 is_stmt 1 discriminator 3 view .LVU56
+	movq	0(%rbp), %rax	# MEM[(struct queue_t * * *)_18], MEM[(struct queue_t * * *)_18]
+	movq	(%rax,%rbx,8), %rdi	# *_3, *_3
+	call	q_free@PLT	#
+.LVL28:
+	.loc 1 48 44 discriminator 3 view .LVU57
+	addq	$1, %rbx	#, i
+.LVL29:
+	.loc 1 48 30 discriminator 3 view .LVU58
+	cmpq	pool_size(%rip), %rbx	# pool_size, i
+	jb	.L20	#,
+.LVL30:
+.L22:
+	.loc 1 48 30 is_stmt 0 discriminator 3 view .LVU59
+.LBE9:
+	.loc 1 50 9 is_stmt 1 discriminator 2 view .LVU60
+	movq	0(%rbp), %rdi	# MEM[(struct queue_t * * *)_19], MEM[(struct queue_t * * *)_19]
+	call	free@PLT	#
+.LVL31:
+	.loc 1 51 9 discriminator 2 view .LVU61
+# dudect/constant.c:51:         pool[c] = NULL;
+	.loc 1 51 17 is_stmt 0 discriminator 2 view .LVU62
+	movq	$0, 0(%rbp)	#, MEM[(struct queue_t * * *)_19]
+	.loc 1 47 29 is_stmt 1 discriminator 2 view .LVU63
+.LVL32:
+	.loc 1 47 23 discriminator 2 view .LVU64
+	addq	$8, %rbp	#, ivtmp.72
+.LVL33:
+	.loc 1 47 23 is_stmt 0 discriminator 2 view .LVU65
+	cmpq	%r12, %rbp	# _30, ivtmp.72
+	jne	.L19	#,
+.LBE8:
+	.loc 1 53 5 is_stmt 1 view .LVU66
+# dudect/constant.c:53:     pool_size = 0;
+	.loc 1 53 15 is_stmt 0 view .LVU67
+	movq	$0, pool_size(%rip)	#, pool_size
+# dudect/constant.c:54: }
+	.loc 1 54 1 view .LVU68
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL34:
+	.loc 1 54 1 view .LVU69
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE27:
+	.size	release_dut, .-release_dut
+	.globl	init_dut
+	.type	init_dut, @function
+init_dut:
+.LFB26:
+	.loc 1 40 1 is_stmt 1 view -0
+	.cfi_startproc
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 41 5 view .LVU71
+# dudect/constant.c:41:     q = NULL;
+	.loc 1 41 7 is_stmt 0 view .LVU72
+	movq	$0, q(%rip)	#, q
+	.loc 1 42 5 is_stmt 1 view .LVU73
+	movl	$0, %eax	#,
+	call	release_dut	#
+.LVL35:
+# dudect/constant.c:43: }
+	.loc 1 43 1 is_stmt 0 view .LVU74
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE26:
+	.size	init_dut, .-init_dut
+	.globl	get_random_string
+	.type	get_random_string, @function
+get_random_string:
+.LFB28:
+	.loc 1 57 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 58 5 view .LVU76
+# dudect/constant.c:58:     random_string_iter = (random_string_iter + 1) % NR_MEASURE;
+	.loc 1 58 46 is_stmt 0 view .LVU77
+	movl	random_string_iter(%rip), %eax	# random_string_iter, tmp101
+	leal	1(%rax), %edx	#, tmp88
+# dudect/constant.c:58:     random_string_iter = (random_string_iter + 1) % NR_MEASURE;
+	.loc 1 58 51 view .LVU78
+	movslq	%edx, %rax	# tmp88, tmp90
+	imulq	$458129845, %rax, %rax	#, tmp90, tmp91
+	sarq	$36, %rax	#, tmp93
+	movl	%edx, %ecx	# tmp88, tmp94
+	sarl	$31, %ecx	#, tmp94
+	subl	%ecx, %eax	# tmp94, _3
+	imull	$150, %eax, %ecx	#, _3, tmp95
+	movl	%edx, %eax	# tmp88, tmp88
+	subl	%ecx, %eax	# tmp95, tmp88
+# dudect/constant.c:58:     random_string_iter = (random_string_iter + 1) % NR_MEASURE;
+	.loc 1 58 24 view .LVU79
+	movl	%eax, random_string_iter(%rip)	# _3, random_string_iter
+	.loc 1 59 5 is_stmt 1 view .LVU80
+# dudect/constant.c:59:     return random_string[random_string_iter];
+	.loc 1 59 12 is_stmt 0 view .LVU81
+	cltq
+	leaq	random_string(%rip), %rdx	#, tmp99
+	leaq	(%rdx,%rax,8), %rax	#, tmp96
+# dudect/constant.c:60: }
+	.loc 1 60 1 view .LVU82
+	ret	
+	.cfi_endproc
+.LFE28:
+	.size	get_random_string, .-get_random_string
+	.type	undo_remove, @function
+undo_remove:
+.LVL36:
+.LFB41:
+	.loc 1 174 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 174 1 is_stmt 0 view .LVU84
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp84, q
+	.loc 1 175 5 is_stmt 1 view .LVU85
+	call	get_random_string	#
+.LVL37:
+	.loc 1 175 5 is_stmt 0 view .LVU86
+	movq	%rax, %rsi	# tmp85, _1
+	movq	%rbx, %rdi	# q,
+	call	q_insert_head@PLT	#
+.LVL38:
+# dudect/constant.c:176: }
+	.loc 1 176 1 view .LVU87
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL39:
+	.loc 1 176 1 view .LVU88
+	ret	
+	.cfi_endproc
+.LFE41:
+	.size	undo_remove, .-undo_remove
+	.type	setup_queue, @function
+setup_queue:
+.LVL40:
+.LFB31:
+	.loc 1 117 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 117 1 is_stmt 0 view .LVU90
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %r12	# tmp87, length
+	.loc 1 118 5 is_stmt 1 view .LVU91
+# dudect/constant.c:118:     queue_t *q = q_new();
+	.loc 1 118 18 is_stmt 0 view .LVU92
+	movl	$0, %eax	#,
+	call	q_new@PLT	#
+.LVL41:
+	.loc 1 118 18 view .LVU93
+	movq	%rax, %rbp	# tmp88, <retval>
+.LVL42:
+	.loc 1 119 5 is_stmt 1 view .LVU94
+.LBB10:
+	.loc 1 119 10 view .LVU95
+	.loc 1 119 26 view .LVU96
+	testq	%r12, %r12	# length
+	je	.L32	#,
+# dudect/constant.c:119:     for (size_t i = 0; i < length; i++)
+	.loc 1 119 17 is_stmt 0 view .LVU97
+	movl	$0, %ebx	#, i
+.LVL43:
+.L34:
+	.loc 1 120 9 is_stmt 1 discriminator 3 view .LVU98
+	call	get_random_string	#
+.LVL44:
+	movq	%rax, %rsi	# tmp89, _1
+	movq	%rbp, %rdi	# <retval>,
+	call	q_insert_head@PLT	#
+.LVL45:
+	.loc 1 119 37 discriminator 3 view .LVU99
+	addq	$1, %rbx	#, i
+.LVL46:
+	.loc 1 119 26 discriminator 3 view .LVU100
+	cmpq	%rbx, %r12	# i, length
+	jne	.L34	#,
+.LVL47:
+.L32:
+	.loc 1 119 26 is_stmt 0 discriminator 3 view .LVU101
+.LBE10:
+# dudect/constant.c:122: }
+	.loc 1 122 1 view .LVU102
+	movq	%rbp, %rax	# <retval>,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL48:
+	.loc 1 122 1 view .LVU103
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL49:
+	.loc 1 122 1 view .LVU104
+	ret	
+	.cfi_endproc
+.LFE31:
+	.size	setup_queue, .-setup_queue
+	.globl	prepare_inputs
+	.type	prepare_inputs, @function
+prepare_inputs:
+.LVL50:
+.LFB29:
+	.loc 1 63 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 63 1 is_stmt 0 view .LVU106
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %r12	# tmp96, input_data
+	movq	%rsi, %rbp	# tmp97, classes
+	.loc 1 64 5 is_stmt 1 view .LVU107
+	movl	$2400, %esi	#,
+.LVL51:
+	.loc 1 64 5 is_stmt 0 view .LVU108
+	call	randombytes@PLT	#
+.LVL52:
+	.loc 1 65 5 is_stmt 1 view .LVU109
+.LBB11:
+	.loc 1 65 10 view .LVU110
+	.loc 1 65 26 view .LVU111
+# dudect/constant.c:65:     for (size_t i = 0; i < number_measurements; i++) {
+	.loc 1 65 17 is_stmt 0 view .LVU112
+	movl	$0, %ebx	#, i
+	jmp	.L39	#
+.LVL53:
+.L38:
+	.loc 1 65 50 is_stmt 1 discriminator 2 view .LVU113
+	addq	$1, %rbx	#, i
+.LVL54:
+	.loc 1 65 26 discriminator 2 view .LVU114
+	cmpq	$150, %rbx	#, i
+	je	.L44	#,
+.LVL55:
+.L39:
+	.loc 1 66 9 view .LVU115
+# dudect/constant.c:66:         classes[i] = randombit();
+	.loc 1 66 22 is_stmt 0 view .LVU116
+	call	randombit@PLT	#
+.LVL56:
+# dudect/constant.c:66:         classes[i] = randombit();
+	.loc 1 66 20 view .LVU117
+	movb	%al, 0(%rbp,%rbx)	# _2, MEM[(uint8_t *)classes_17(D) + i_26 * 1]
+	.loc 1 67 9 is_stmt 1 view .LVU118
+# dudect/constant.c:67:         if (classes[i] == 0 && old_measure)
+	.loc 1 67 12 is_stmt 0 view .LVU119
+	testb	%al, %al	# _2
+	jne	.L38	#,
+# dudect/constant.c:67:         if (classes[i] == 0 && old_measure)
+	.loc 1 67 29 discriminator 1 view .LVU120
+	cmpb	$0, old_measure(%rip)	#, old_measure
+	je	.L38	#,
+	.loc 1 68 13 is_stmt 1 view .LVU121
+# dudect/constant.c:68:             *(uint16_t *) (input_data + i * chunk_size) = 0x00;
+	.loc 1 68 57 is_stmt 0 view .LVU122
+	movq	%rbx, %rax	# i, tmp92
+	salq	$4, %rax	#, tmp92
+	movw	$0, (%r12,%rax)	#, MEM[(uint16_t *)input_data_12(D) + _33 * 1]
+	jmp	.L38	#
+.L44:
+	.loc 1 68 57 view .LVU123
+.LBE11:
+	.loc 1 72 5 is_stmt 1 view .LVU124
+	movl	$1200, %esi	#,
+	leaq	random_string(%rip), %rdi	#, tmp93
+	call	randombytes@PLT	#
+.LVL57:
+	.loc 1 73 5 view .LVU125
+.LBB12:
+	.loc 1 73 10 view .LVU126
+	.loc 1 73 26 view .LVU127
+	leaq	7+random_string(%rip), %rax	#, ivtmp.90
+	leaq	1200(%rax), %rdx	#, _32
+.LVL58:
+.L40:
+	.loc 1 74 9 discriminator 3 view .LVU128
+# dudect/constant.c:74:         random_string[i][7] = 0;
+	.loc 1 74 29 is_stmt 0 discriminator 3 view .LVU129
+	movb	$0, (%rax)	#, MEM[(char *)_24]
+	.loc 1 73 40 is_stmt 1 discriminator 3 view .LVU130
+	.loc 1 73 26 discriminator 3 view .LVU131
+	addq	$8, %rax	#, ivtmp.90
+	cmpq	%rdx, %rax	# _32, ivtmp.90
+	jne	.L40	#,
+.LBE12:
+# dudect/constant.c:75: }
+	.loc 1 75 1 is_stmt 0 view .LVU132
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LVL59:
+	.loc 1 75 1 view .LVU133
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL60:
+	.loc 1 75 1 view .LVU134
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL61:
+	.loc 1 75 1 view .LVU135
+	ret	
+	.cfi_endproc
+.LFE29:
+	.size	prepare_inputs, .-prepare_inputs
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"dudect/constant.c"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"mode == test_insert_tail || mode == test_size"
+	.text
+	.globl	measure_old
+	.type	measure_old, @function
+measure_old:
+.LVL62:
+.LFB30:
+	.loc 1 81 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 81 1 is_stmt 0 view .LVU137
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+	.loc 1 82 5 is_stmt 1 view .LVU138
+	cmpl	$1, %ecx	#, mode
+	ja	.L90	#,
+	movq	%rdi, %r13	# tmp261, before_ticks
+	movq	%rsi, %r14	# tmp262, after_ticks
+	movq	%rdx, %r15	# tmp263, input_data
+	.loc 1 83 5 view .LVU139
+# dudect/constant.c:83:     if (mode == test_insert_tail) {
+	.loc 1 83 8 is_stmt 0 view .LVU140
+	testl	%ecx, %ecx	# mode
+	jne	.L78	#,
+	movl	$160, %ebp	#, ivtmp.129
+	jmp	.L62	#
+.L90:
+	.loc 1 82 5 is_stmt 1 discriminator 1 view .LVU141
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx	#, tmp182
+.LVL63:
+	.loc 1 82 5 is_stmt 0 discriminator 1 view .LVU142
+	movl	$82, %edx	#,
+.LVL64:
+	.loc 1 82 5 discriminator 1 view .LVU143
+	leaq	.LC0(%rip), %rsi	#, tmp183
+.LVL65:
+	.loc 1 82 5 discriminator 1 view .LVU144
+	leaq	.LC1(%rip), %rdi	#, tmp184
+.LVL66:
+	.loc 1 82 5 discriminator 1 view .LVU145
+	call	__assert_fail@PLT	#
+.LVL67:
+.L51:
+.LBB52:
+.LBB53:
+.LBB54:
+.LBB55:
+# dudect/timer.h:35:     switch (timer_active) {
+	.file 2 "dudect/timer.h"
+	.loc 2 35 5 view .LVU146
+	subl	$3, %eax	#, tmp186
+	cmpl	$1, %eax	#, tmp186
+	ja	.L53	#,
+	.loc 2 42 9 is_stmt 1 view .LVU147
+# dudect/timer.h:42:         return perf_read();
+	.loc 2 42 16 is_stmt 0 view .LVU148
+	call	perf_read@PLT	#
+.LVL68:
+	movq	%rax, %rdx	# tmp268, _85
+	jmp	.L55	#
+.L50:
+	.loc 2 39 9 is_stmt 1 view .LVU149
+.LBB56:
+.LBI56:
+	.file 3 "dudect/cpucycles.h"
+	.loc 3 32 23 view .LVU150
+.LBB57:
+	.loc 3 35 5 view .LVU151
+	.loc 3 36 5 view .LVU152
+#APP
+# 36 "dudect/cpucycles.h" 1
+	rdtscp
+	lfence
+	
+# 0 "" 2
+.LVL69:
+	.loc 3 38 5 view .LVU153
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 45 is_stmt 0 view .LVU154
+#NO_APP
+	salq	$32, %rdx	#, tmp195
+.LVL70:
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 13 view .LVU155
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 27 view .LVU156
+	orq	%rax, %rdx	# lo, _85
+.LVL71:
+	.loc 3 38 27 view .LVU157
+.LBE57:
+.LBE56:
+# dudect/timer.h:39:         return cpucycles_rdtscp();
+	.loc 2 39 16 view .LVU158
+	jmp	.L55	#
+.L53:
+	.loc 2 44 9 is_stmt 1 view .LVU159
+.LBB58:
+.LBI58:
+	.loc 3 6 23 view .LVU160
+.LBB59:
+	.loc 3 9 5 view .LVU161
+	.loc 3 10 5 view .LVU162
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL72:
+	.loc 3 11 5 view .LVU163
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 45 is_stmt 0 view .LVU164
+#NO_APP
+	salq	$32, %rdx	#, tmp200
+.LVL73:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 13 view .LVU165
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 27 view .LVU166
+	orq	%rax, %rdx	# lo, _85
+.LVL74:
+	.loc 3 11 27 view .LVU167
+.LBE59:
+.LBE58:
+# dudect/timer.h:44:         return cpucycles();
+	.loc 2 44 16 view .LVU168
+	jmp	.L55	#
+.LVL75:
+.L57:
+	.loc 2 44 16 view .LVU169
+.LBE55:
+.LBE54:
+.LBB63:
+.LBB64:
+# dudect/timer.h:35:     switch (timer_active) {
+	.loc 2 35 5 view .LVU170
+	subl	$3, %eax	#, tmp203
+	cmpl	$1, %eax	#, tmp203
+	ja	.L59	#,
+	.loc 2 42 9 is_stmt 1 view .LVU171
+# dudect/timer.h:42:         return perf_read();
+	.loc 2 42 16 is_stmt 0 view .LVU172
+	call	perf_read@PLT	#
+.LVL76:
+	movq	%rax, %rdx	# tmp269, _106
+	jmp	.L61	#
+.L56:
+	.loc 2 39 9 is_stmt 1 view .LVU173
+.LBB65:
+.LBI65:
+	.loc 3 32 23 view .LVU174
+.LBB66:
+	.loc 3 35 5 view .LVU175
+	.loc 3 36 5 view .LVU176
+#APP
+# 36 "dudect/cpucycles.h" 1
+	rdtscp
+	lfence
+	
+# 0 "" 2
+.LVL77:
+	.loc 3 38 5 view .LVU177
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 45 is_stmt 0 view .LVU178
+#NO_APP
+	salq	$32, %rdx	#, tmp212
+.LVL78:
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 13 view .LVU179
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 27 view .LVU180
+	orq	%rax, %rdx	# lo, _106
+.LVL79:
+.L61:
+	.loc 3 38 27 view .LVU181
+.LBE66:
+.LBE65:
+.LBE64:
+.LBE63:
+# dudect/constant.c:92:             after_ticks[i] = timer_read();
+	.loc 1 92 28 view .LVU182
+	movq	%rdx, (%r14,%rbp)	# _106, MEM[(int64_t *)after_ticks_55(D) + ivtmp.129_183 * 1]
+	.loc 1 93 13 is_stmt 1 view .LVU183
+	movq	q(%rip), %rdi	# q,
+	call	q_free@PLT	#
+.LVL80:
+.LBE53:
+	.loc 1 84 74 view .LVU184
+	.loc 1 84 38 view .LVU185
+	addq	$8, %rbp	#, ivtmp.129
+	cmpq	$1040, %rbp	#, ivtmp.129
+	je	.L45	#,
+.LVL81:
+.L62:
+.LBB76:
+	.loc 1 85 13 view .LVU186
+# dudect/constant.c:85:             char *s = get_random_string();
+	.loc 1 85 23 is_stmt 0 view .LVU187
+	call	get_random_string	#
+.LVL82:
+	movq	%rax, %r12	# tmp265, s
+.LVL83:
+	.loc 1 86 13 is_stmt 1 view .LVU188
+	movl	$0, %eax	#,
+.LVL84:
+	.loc 1 86 13 is_stmt 0 view .LVU189
+	call	q_new@PLT	#
+.LVL85:
+	movq	%rax, q(%rip)	# tmp266, q
+	.loc 1 87 13 is_stmt 1 view .LVU190
+.LBB72:
+	.loc 1 87 13 view .LVU191
+	cmpw	$1, (%r15,%rbp,2)	#, MEM[(uint16_t *)input_data_50(D) + ivtmp.129_183 * 2]
+	sbbl	%ebx, %ebx	# j
+.LVL86:
+	.loc 1 87 13 view .LVU192
+	addl	$1, %ebx	#, j
+.LVL87:
+.L49:
+	.loc 1 87 13 discriminator 7 view .LVU193
+	call	get_random_string	#
+.LVL88:
+	movq	%rax, %rsi	# tmp267, _6
+	movq	q(%rip), %rdi	# q,
+	call	q_insert_head@PLT	#
+.LVL89:
+	.loc 1 87 13 discriminator 7 view .LVU194
+	subl	$1, %ebx	#, j
+.LVL90:
+	.loc 1 87 13 is_stmt 0 discriminator 7 view .LVU195
+	cmpl	$-1, %ebx	#, j
+	jne	.L49	#,
+.LBE72:
+	.loc 1 87 13 is_stmt 1 discriminator 8 view .LVU196
+	.loc 1 90 13 discriminator 8 view .LVU197
+.LBB73:
+.LBI54:
+	.loc 2 33 23 discriminator 8 view .LVU198
+.LBB62:
+	.loc 2 35 5 discriminator 8 view .LVU199
+	movl	timer_active(%rip), %eax	# timer_active, timer_active.16_79
+	cmpl	$2, %eax	#, timer_active.16_79
+	je	.L50	#,
+# dudect/timer.h:35:     switch (timer_active) {
+	.loc 2 35 5 is_stmt 0 view .LVU200
+	jg	.L51	#,
+	cmpl	$1, %eax	#, timer_active.16_79
+	jne	.L53	#,
+	.loc 2 37 9 is_stmt 1 view .LVU201
+.LBB60:
+.LBI60:
+	.loc 3 19 23 view .LVU202
+.LBB61:
+	.loc 3 22 5 view .LVU203
+	.loc 3 23 5 view .LVU204
+#APP
+# 23 "dudect/cpucycles.h" 1
+	lfence
+	rdtsc
+	lfence
+	
+# 0 "" 2
+.LVL91:
+	.loc 3 25 5 view .LVU205
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 45 is_stmt 0 view .LVU206
+#NO_APP
+	salq	$32, %rdx	#, tmp190
+.LVL92:
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 13 view .LVU207
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 27 view .LVU208
+	orq	%rax, %rdx	# lo, _85
+.LVL93:
+.L55:
+	.loc 3 25 27 view .LVU209
+.LBE61:
+.LBE60:
+.LBE62:
+.LBE73:
+# dudect/constant.c:90:             before_ticks[i] = timer_read();
+	.loc 1 90 29 view .LVU210
+	movq	%rdx, 0(%r13,%rbp)	# _85, MEM[(int64_t *)before_ticks_52(D) + ivtmp.129_183 * 1]
+	.loc 1 91 13 is_stmt 1 view .LVU211
+.LBB74:
+	.loc 1 91 13 view .LVU212
+.LVL94:
+	.loc 1 91 13 view .LVU213
+	.loc 1 91 13 view .LVU214
+	.loc 1 91 13 view .LVU215
+	movq	%r12, %rsi	# s,
+	movq	q(%rip), %rdi	# q,
+	call	q_insert_tail@PLT	#
+.LVL95:
+	.loc 1 91 13 view .LVU216
+	.loc 1 91 13 is_stmt 0 view .LVU217
+.LBE74:
+	.loc 1 91 13 is_stmt 1 view .LVU218
+	.loc 1 92 13 view .LVU219
+.LBB75:
+.LBI63:
+	.loc 2 33 23 view .LVU220
+.LBB71:
+	.loc 2 35 5 view .LVU221
+	movl	timer_active(%rip), %eax	# timer_active, timer_active.16_100
+	cmpl	$2, %eax	#, timer_active.16_100
+	je	.L56	#,
+	jg	.L57	#,
+	cmpl	$1, %eax	#, timer_active.16_100
+	jne	.L59	#,
+	.loc 2 37 9 view .LVU222
+.LBB67:
+.LBI67:
+	.loc 3 19 23 view .LVU223
+.LBB68:
+	.loc 3 22 5 view .LVU224
+	.loc 3 23 5 view .LVU225
+#APP
+# 23 "dudect/cpucycles.h" 1
+	lfence
+	rdtsc
+	lfence
+	
+# 0 "" 2
+.LVL96:
+	.loc 3 25 5 view .LVU226
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 45 is_stmt 0 view .LVU227
+#NO_APP
+	salq	$32, %rdx	#, tmp207
+.LVL97:
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 13 view .LVU228
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 27 view .LVU229
+	orq	%rax, %rdx	# lo, _106
+.LVL98:
+	.loc 3 25 27 view .LVU230
+.LBE68:
+.LBE67:
+# dudect/timer.h:37:         return cpucycles_lfence();
+	.loc 2 37 16 view .LVU231
+	jmp	.L61	#
+.L59:
+	.loc 2 44 9 is_stmt 1 view .LVU232
+.LBB69:
+.LBI69:
+	.loc 3 6 23 view .LVU233
+.LBB70:
+	.loc 3 9 5 view .LVU234
+	.loc 3 10 5 view .LVU235
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL99:
+	.loc 3 11 5 view .LVU236
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 45 is_stmt 0 view .LVU237
+#NO_APP
+	salq	$32, %rdx	#, tmp217
+.LVL100:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 13 view .LVU238
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 27 view .LVU239
+	orq	%rax, %rdx	# lo, _106
+.LVL101:
+	.loc 3 11 27 view .LVU240
+.LBE70:
+.LBE69:
+# dudect/timer.h:44:         return cpucycles();
+	.loc 2 44 16 view .LVU241
+	jmp	.L61	#
+.LVL102:
+.L78:
+	.loc 2 44 16 view .LVU242
+.LBE71:
+.LBE75:
+.LBE76:
+.LBE52:
+	movl	$160, %ebp	#, ivtmp.151
+	jmp	.L47	#
+.LVL103:
+.L67:
+.LBB77:
+.LBB78:
+.LBB79:
+# dudect/timer.h:35:     switch (timer_active) {
+	.loc 2 35 5 view .LVU243
+	subl	$3, %eax	#, tmp221
+	cmpl	$1, %eax	#, tmp221
+	ja	.L69	#,
+	.loc 2 42 9 is_stmt 1 view .LVU244
+# dudect/timer.h:42:         return perf_read();
+	.loc 2 42 16 is_stmt 0 view .LVU245
+	call	perf_read@PLT	#
+.LVL104:
+	movq	%rax, %rdx	# tmp272, _127
+	jmp	.L71	#
+.L66:
+	.loc 2 39 9 is_stmt 1 view .LVU246
+.LBB80:
+.LBI80:
+	.loc 3 32 23 view .LVU247
+.LBB81:
+	.loc 3 35 5 view .LVU248
+	.loc 3 36 5 view .LVU249
+#APP
+# 36 "dudect/cpucycles.h" 1
+	rdtscp
+	lfence
+	
+# 0 "" 2
+.LVL105:
+	.loc 3 38 5 view .LVU250
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 45 is_stmt 0 view .LVU251
+#NO_APP
+	salq	$32, %rdx	#, tmp230
+.LVL106:
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 13 view .LVU252
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 27 view .LVU253
+	orq	%rax, %rdx	# lo, _127
+.LVL107:
+	.loc 3 38 27 view .LVU254
+.LBE81:
+.LBE80:
+# dudect/timer.h:39:         return cpucycles_rdtscp();
+	.loc 2 39 16 view .LVU255
+	jmp	.L71	#
+.L69:
+	.loc 2 44 9 is_stmt 1 view .LVU256
+.LBB82:
+.LBI82:
+	.loc 3 6 23 view .LVU257
+.LBB83:
+	.loc 3 9 5 view .LVU258
+	.loc 3 10 5 view .LVU259
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL108:
+	.loc 3 11 5 view .LVU260
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 45 is_stmt 0 view .LVU261
+#NO_APP
+	salq	$32, %rdx	#, tmp235
+.LVL109:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 13 view .LVU262
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 27 view .LVU263
+	orq	%rax, %rdx	# lo, _127
+.LVL110:
+	.loc 3 11 27 view .LVU264
+.LBE83:
+.LBE82:
+# dudect/timer.h:44:         return cpucycles();
+	.loc 2 44 16 view .LVU265
+	jmp	.L71	#
+.LVL111:
+.L73:
+	.loc 2 44 16 view .LVU266
+.LBE79:
+.LBE78:
+.LBB87:
+.LBB88:
+# dudect/timer.h:35:     switch (timer_active) {
+	.loc 2 35 5 view .LVU267
+	subl	$3, %eax	#, tmp238
+	cmpl	$1, %eax	#, tmp238
+	ja	.L75	#,
+	.loc 2 42 9 is_stmt 1 view .LVU268
+# dudect/timer.h:42:         return perf_read();
+	.loc 2 42 16 is_stmt 0 view .LVU269
+	call	perf_read@PLT	#
+.LVL112:
+	movq	%rax, %rdx	# tmp273, _148
+	jmp	.L77	#
+.L72:
+	.loc 2 39 9 is_stmt 1 view .LVU270
+.LBB89:
+.LBI89:
+	.loc 3 32 23 view .LVU271
+.LBB90:
+	.loc 3 35 5 view .LVU272
+	.loc 3 36 5 view .LVU273
+#APP
+# 36 "dudect/cpucycles.h" 1
+	rdtscp
+	lfence
+	
+# 0 "" 2
+.LVL113:
+	.loc 3 38 5 view .LVU274
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 45 is_stmt 0 view .LVU275
+#NO_APP
+	salq	$32, %rdx	#, tmp247
+.LVL114:
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 13 view .LVU276
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 27 view .LVU277
+	orq	%rax, %rdx	# lo, _148
+.LVL115:
+.L77:
+	.loc 3 38 27 view .LVU278
+.LBE90:
+.LBE89:
+.LBE88:
+.LBE87:
+# dudect/constant.c:103:             after_ticks[i] = timer_read();
+	.loc 1 103 28 view .LVU279
+	movq	%rdx, (%r14,%rbp)	# _148, MEM[(int64_t *)after_ticks_55(D) + ivtmp.151_201 * 1]
+	.loc 1 104 13 is_stmt 1 view .LVU280
+	movq	q(%rip), %rdi	# q,
+	call	q_free@PLT	#
+.LVL116:
+	.loc 1 96 74 view .LVU281
+	.loc 1 96 38 view .LVU282
+	addq	$8, %rbp	#, ivtmp.151
+	cmpq	$1040, %rbp	#, ivtmp.151
+	je	.L45	#,
+.LVL117:
+.L47:
+	.loc 1 97 13 view .LVU283
+	movl	$0, %eax	#,
+	call	q_new@PLT	#
+.LVL118:
+	movq	%rax, q(%rip)	# tmp270, q
+	.loc 1 98 13 view .LVU284
+.LBB96:
+	.loc 1 98 13 view .LVU285
+	cmpw	$1, (%r15,%rbp,2)	#, MEM[(uint16_t *)input_data_50(D) + ivtmp.151_201 * 2]
+	sbbl	%ebx, %ebx	# j
+.LVL119:
+	.loc 1 98 13 view .LVU286
+	addl	$1, %ebx	#, j
+.LVL120:
+.L65:
+	.loc 1 98 13 discriminator 7 view .LVU287
+	call	get_random_string	#
+.LVL121:
+	movq	%rax, %rsi	# tmp271, _20
+	movq	q(%rip), %rdi	# q,
+	call	q_insert_head@PLT	#
+.LVL122:
+	.loc 1 98 13 discriminator 7 view .LVU288
+	subl	$1, %ebx	#, j
+.LVL123:
+	.loc 1 98 13 is_stmt 0 discriminator 7 view .LVU289
+	cmpl	$-1, %ebx	#, j
+	jne	.L65	#,
+.LBE96:
+	.loc 1 98 13 is_stmt 1 discriminator 8 view .LVU290
+	.loc 1 101 13 discriminator 8 view .LVU291
+.LBB97:
+.LBI78:
+	.loc 2 33 23 discriminator 8 view .LVU292
+.LBB86:
+	.loc 2 35 5 discriminator 8 view .LVU293
+	movl	timer_active(%rip), %eax	# timer_active, timer_active.16_121
+	cmpl	$2, %eax	#, timer_active.16_121
+	je	.L66	#,
+# dudect/timer.h:35:     switch (timer_active) {
+	.loc 2 35 5 is_stmt 0 view .LVU294
+	jg	.L67	#,
+	cmpl	$1, %eax	#, timer_active.16_121
+	jne	.L69	#,
+	.loc 2 37 9 is_stmt 1 view .LVU295
+.LBB84:
+.LBI84:
+	.loc 3 19 23 view .LVU296
+.LBB85:
+	.loc 3 22 5 view .LVU297
+	.loc 3 23 5 view .LVU298
+#APP
+# 23 "dudect/cpucycles.h" 1
+	lfence
+	rdtsc
+	lfence
+	
+# 0 "" 2
+.LVL124:
+	.loc 3 25 5 view .LVU299
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 45 is_stmt 0 view .LVU300
+#NO_APP
+	salq	$32, %rdx	#, tmp225
+.LVL125:
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 13 view .LVU301
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 27 view .LVU302
+	orq	%rax, %rdx	# lo, _127
+.LVL126:
+.L71:
+	.loc 3 25 27 view .LVU303
+.LBE85:
+.LBE84:
+.LBE86:
+.LBE97:
+# dudect/constant.c:101:             before_ticks[i] = timer_read();
+	.loc 1 101 29 view .LVU304
+	movq	%rdx, 0(%r13,%rbp)	# _127, MEM[(int64_t *)before_ticks_52(D) + ivtmp.151_201 * 1]
+	.loc 1 102 13 is_stmt 1 view .LVU305
+	.loc 1 102 13 view .LVU306
+.LBB98:
+	.loc 1 102 13 view .LVU307
+.LVL127:
+	.loc 1 102 13 view .LVU308
+	.loc 1 102 13 view .LVU309
+	movq	q(%rip), %rdi	# q,
+	call	q_size@PLT	#
+.LVL128:
+	.loc 1 102 13 view .LVU310
+	.loc 1 102 13 view .LVU311
+	.loc 1 102 13 is_stmt 0 view .LVU312
+.LBE98:
+	.loc 1 102 13 is_stmt 1 view .LVU313
+	.loc 1 103 13 view .LVU314
+.LBB99:
+.LBI87:
+	.loc 2 33 23 view .LVU315
+.LBB95:
+	.loc 2 35 5 view .LVU316
+	movl	timer_active(%rip), %eax	# timer_active, timer_active.16_142
+	cmpl	$2, %eax	#, timer_active.16_142
+	je	.L72	#,
+	jg	.L73	#,
+	cmpl	$1, %eax	#, timer_active.16_142
+	jne	.L75	#,
+	.loc 2 37 9 view .LVU317
+.LBB91:
+.LBI91:
+	.loc 3 19 23 view .LVU318
+.LBB92:
+	.loc 3 22 5 view .LVU319
+	.loc 3 23 5 view .LVU320
+#APP
+# 23 "dudect/cpucycles.h" 1
+	lfence
+	rdtsc
+	lfence
+	
+# 0 "" 2
+.LVL129:
+	.loc 3 25 5 view .LVU321
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 45 is_stmt 0 view .LVU322
+#NO_APP
+	salq	$32, %rdx	#, tmp242
+.LVL130:
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 13 view .LVU323
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 27 view .LVU324
+	orq	%rax, %rdx	# lo, _148
+.LVL131:
+	.loc 3 25 27 view .LVU325
+.LBE92:
+.LBE91:
+# dudect/timer.h:37:         return cpucycles_lfence();
+	.loc 2 37 16 view .LVU326
+	jmp	.L77	#
+.L75:
+	.loc 2 44 9 is_stmt 1 view .LVU327
+.LBB93:
+.LBI93:
+	.loc 3 6 23 view .LVU328
+.LBB94:
+	.loc 3 9 5 view .LVU329
+	.loc 3 10 5 view .LVU330
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL132:
+	.loc 3 11 5 view .LVU331
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 45 is_stmt 0 view .LVU332
+#NO_APP
+	salq	$32, %rdx	#, tmp252
+.LVL133:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 13 view .LVU333
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 27 view .LVU334
+	orq	%rax, %rdx	# lo, _148
+.LVL134:
+	.loc 3 11 27 view .LVU335
+.LBE94:
+.LBE93:
+# dudect/timer.h:44:         return cpucycles();
+	.loc 2 44 16 view .LVU336
+	jmp	.L77	#
+.LVL135:
+.L45:
+	.loc 2 44 16 view .LVU337
+.LBE95:
+.LBE99:
+.LBE77:
+# dudect/constant.c:107: }
+	.loc 1 107 1 view .LVU338
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL136:
+	.loc 1 107 1 view .LVU339
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL137:
+	.loc 1 107 1 view .LVU340
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL138:
+	.loc 1 107 1 view .LVU341
+	ret	
+	.cfi_endproc
+.LFE30:
+	.size	measure_old, .-measure_old
+	.section	.rodata.str1.8
+	.align 8
+.LC2:
+	.string	"mode >= 0 && mode < test_count"
+	.text
+	.globl	measure
+	.type	measure, @function
+measure:
+.LVL139:
+.LFB43:
+	.loc 1 233 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 233 1 is_stmt 0 view .LVU343
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp	#,
+	.cfi_def_cfa_offset 128
+	movq	%rdi, 8(%rsp)	# tmp385, %sfp
+	movq	%rsi, 16(%rsp)	# tmp386, %sfp
+	movq	%rcx, 24(%rsp)	# tmp388, %sfp
+	.loc 1 234 5 is_stmt 1 view .LVU344
+	cmpl	$6, %r9d	#, mode
+	ja	.L136	#,
+	movq	%rdx, %r15	# tmp387, lengths
+.LBB140:
+# dudect/constant.c:236:     for (size_t i = 0; i < number_measurements; i++) {
+	.loc 1 236 17 is_stmt 0 view .LVU345
+	movl	$0, %ebx	#, i
+.LBB141:
+# dudect/constant.c:238:         if (op->linear)
+	.loc 1 238 15 view .LVU346
+	movslq	%r9d, %rax	# mode, mode
+	leaq	(%rax,%rax,2), %rax	#, tmp224
+	salq	$4, %rax	#, tmp225
+	leaq	dut_ops(%rip), %rdx	#, tmp220
+.LVL140:
+	.loc 1 238 15 view .LVU347
+	leaq	(%rdx,%rax), %rbp	#, tmp226
+.LBB142:
+.LBB143:
+.LBB144:
+# dudect/constant.c:222:     queue_t *qi = pool[c][pool_next[c]];
+	.loc 1 222 36 view .LVU348
+	movq	%r8, %r12	# classes, classes
+	jmp	.L92	#
+.LVL141:
+.L136:
+	.loc 1 222 36 view .LVU349
+.LBE144:
+.LBE143:
+.LBE142:
+.LBE141:
+.LBE140:
+	.loc 1 234 5 is_stmt 1 discriminator 1 view .LVU350
+	leaq	__PRETTY_FUNCTION__.0(%rip), %rcx	#, tmp217
+.LVL142:
+	.loc 1 234 5 is_stmt 0 discriminator 1 view .LVU351
+	movl	$234, %edx	#,
+.LVL143:
+	.loc 1 234 5 discriminator 1 view .LVU352
+	leaq	.LC0(%rip), %rsi	#, tmp218
+.LVL144:
+	.loc 1 234 5 discriminator 1 view .LVU353
+	leaq	.LC2(%rip), %rdi	#, tmp219
+.LVL145:
+	.loc 1 234 5 discriminator 1 view .LVU354
+	call	__assert_fail@PLT	#
+.LVL146:
+.L139:
+.LBB196:
+.LBB194:
+.LBB173:
+	.loc 1 251 13 is_stmt 1 discriminator 2 view .LVU355
+# dudect/constant.c:251:             queue_t *qi = pool_take(op, classes[i]);
+	.loc 1 251 27 is_stmt 0 discriminator 2 view .LVU356
+	movzbl	(%r12,%rbx), %ecx	# MEM[(uint8_t *)classes_46(D) + i_24 * 1], _15
+	movl	%ecx, 36(%rsp)	# _15, %sfp
+.LVL147:
+.LBB151:
+.LBI143:
+	.loc 1 206 17 is_stmt 1 discriminator 2 view .LVU357
+.LBB149:
+	.loc 1 208 5 discriminator 2 view .LVU358
+# dudect/constant.c:208:     if (pool_size != (size_t) dudect_pool) {
+	.loc 1 208 22 is_stmt 0 discriminator 2 view .LVU359
+	cltq
+# dudect/constant.c:208:     if (pool_size != (size_t) dudect_pool) {
+	.loc 1 208 8 discriminator 2 view .LVU360
+	cmpq	pool_size(%rip), %rax	# pool_size, dudect_pool.20_12
+	jne	.L137	#,
+.LVL148:
+.L96:
+	.loc 1 222 5 is_stmt 1 view .LVU361
+# dudect/constant.c:222:     queue_t *qi = pool[c][pool_next[c]];
+	.loc 1 222 36 is_stmt 0 view .LVU362
+	movslq	36(%rsp), %rcx	# %sfp, _15
+	leaq	pool_next(%rip), %rsi	#, tmp424
+	movq	(%rsi,%rcx,8), %rax	# pool_next[_15], _139
+# dudect/constant.c:222:     queue_t *qi = pool[c][pool_next[c]];
+	.loc 1 222 23 view .LVU363
+	leaq	pool(%rip), %rdx	#, tmp266
+# dudect/constant.c:222:     queue_t *qi = pool[c][pool_next[c]];
+	.loc 1 222 14 view .LVU364
+	movq	(%rdx,%rcx,8), %rdx	# pool[_15], pool[_15]
+	movq	(%rdx,%rax,8), %r13	# *_141, qi
+.LVL149:
+	.loc 1 223 5 is_stmt 1 view .LVU365
+# dudect/constant.c:223:     pool_next[c] = (pool_next[c] + 1) % pool_size;
+	.loc 1 223 34 is_stmt 0 view .LVU366
+	addq	$1, %rax	#, tmp271
+# dudect/constant.c:223:     pool_next[c] = (pool_next[c] + 1) % pool_size;
+	.loc 1 223 39 view .LVU367
+	movl	$0, %edx	#, tmp273
+	divq	pool_size(%rip)	# pool_size
+# dudect/constant.c:223:     pool_next[c] = (pool_next[c] + 1) % pool_size;
+	.loc 1 223 18 view .LVU368
+	movq	%rdx, (%rsi,%rcx,8)	# tmp273, pool_next[_15]
+	.loc 1 224 5 is_stmt 1 view .LVU369
+.LVL150:
+	.loc 1 224 5 is_stmt 0 view .LVU370
+.LBE149:
+.LBE151:
+	.loc 1 252 13 is_stmt 1 view .LVU371
+.LBB152:
+.LBI152:
+	.loc 2 33 23 view .LVU372
+.LBB153:
+	.loc 2 35 5 view .LVU373
+	movl	timer_active(%rip), %eax	# timer_active, timer_active.16_95
+	cmpl	$2, %eax	#, timer_active.16_95
+	je	.L100	#,
+	jg	.L101	#,
+	cmpl	$1, %eax	#, timer_active.16_95
+	jne	.L103	#,
+	.loc 2 37 9 view .LVU374
+.LBB154:
+.LBI154:
+	.loc 3 19 23 view .LVU375
+.LBB155:
+	.loc 3 22 5 view .LVU376
+	.loc 3 23 5 view .LVU377
+#APP
+# 23 "dudect/cpucycles.h" 1
+	lfence
+	rdtsc
+	lfence
+	
+# 0 "" 2
+.LVL151:
+	.loc 3 25 5 view .LVU378
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 45 is_stmt 0 view .LVU379
+#NO_APP
+	salq	$32, %rdx	#, tmp279
+.LVL152:
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 13 view .LVU380
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 27 view .LVU381
+	orq	%rax, %rdx	# lo, _101
+.LVL153:
+.L105:
+	.loc 3 25 27 view .LVU382
+.LBE155:
+.LBE154:
+.LBE153:
+.LBE152:
+# dudect/constant.c:252:             before_ticks[i] = timer_read();
+	.loc 1 252 29 view .LVU383
+	movq	8(%rsp), %rax	# %sfp, before_ticks
+	movq	%rdx, (%rax,%rbx,8)	# _101, MEM[(int64_t *)before_ticks_53(D) + i_24 * 8]
+	.loc 1 253 13 is_stmt 1 view .LVU384
+	movq	(%rsp), %rsi	# %sfp,
+	movq	%r13, %rdi	# qi,
+	call	*24(%rbp)	# MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_37(D)].call
+.LVL154:
+	.loc 1 254 13 view .LVU385
+.LBB161:
+.LBI161:
+	.loc 2 33 23 view .LVU386
+.LBB162:
+	.loc 2 35 5 view .LVU387
+	movl	timer_active(%rip), %eax	# timer_active, timer_active.16_74
+	cmpl	$2, %eax	#, timer_active.16_74
+	je	.L106	#,
+	jg	.L107	#,
+	cmpl	$1, %eax	#, timer_active.16_74
+	jne	.L109	#,
+	.loc 2 37 9 view .LVU388
+.LBB163:
+.LBI163:
+	.loc 3 19 23 view .LVU389
+.LBB164:
+	.loc 3 22 5 view .LVU390
+	.loc 3 23 5 view .LVU391
+#APP
+# 23 "dudect/cpucycles.h" 1
+	lfence
+	rdtsc
+	lfence
+	
+# 0 "" 2
+.LVL155:
+	.loc 3 25 5 view .LVU392
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 45 is_stmt 0 view .LVU393
+#NO_APP
+	salq	$32, %rdx	#, tmp304
+.LVL156:
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 13 view .LVU394
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 27 view .LVU395
+	orq	%rax, %rdx	# lo, _80
+.LVL157:
+.L111:
+	.loc 3 25 27 view .LVU396
+.LBE164:
+.LBE163:
+.LBE162:
+.LBE161:
+# dudect/constant.c:254:             after_ticks[i] = timer_read();
+	.loc 1 254 28 view .LVU397
+	movq	16(%rsp), %rax	# %sfp, after_ticks
+	movq	%rdx, (%rax,%rbx,8)	# _80, MEM[(int64_t *)after_ticks_57(D) + i_24 * 8]
+	.loc 1 255 13 is_stmt 1 view .LVU398
+	movq	%r13, %rdi	# qi,
+	call	*%r14	# _13
+.LVL158:
+	.loc 1 256 13 view .LVU399
+	jmp	.L112	#
+.LVL159:
+.L137:
+.LBB170:
+.LBB150:
+	.loc 1 209 9 view .LVU400
+	call	release_dut	#
+.LVL160:
+	.loc 1 210 9 view .LVU401
+.LBB145:
+	.loc 1 210 14 view .LVU402
+	.loc 1 210 27 view .LVU403
+	.loc 1 211 13 view .LVU404
+# dudect/constant.c:211:             pool[k] = calloc(dudect_pool, sizeof(queue_t *));
+	.loc 1 211 23 is_stmt 0 view .LVU405
+	movslq	dudect_pool(%rip), %rdi	# dudect_pool, dudect_pool
+	movl	$8, %esi	#,
+	call	calloc@PLT	#
+.LVL161:
+# dudect/constant.c:211:             pool[k] = calloc(dudect_pool, sizeof(queue_t *));
+	.loc 1 211 21 view .LVU406
+	movq	%rax, pool(%rip)	# tmp243, pool[0]
+	.loc 1 212 13 is_stmt 1 view .LVU407
+# dudect/constant.c:212:             if (!pool[k])
+	.loc 1 212 16 is_stmt 0 view .LVU408
+	testq	%rax, %rax	# tmp243
+	je	.L97	#,
+	.loc 1 214 13 is_stmt 1 view .LVU409
+# dudect/constant.c:214:             pool_next[k] = 0;
+	.loc 1 214 26 is_stmt 0 view .LVU410
+	leaq	pool_next(%rip), %rax	#, tmp419
+	movq	$0, (%rax)	#, pool_next[0]
+	.loc 1 210 33 is_stmt 1 view .LVU411
+.LVL162:
+	.loc 1 210 27 view .LVU412
+	.loc 1 211 13 view .LVU413
+# dudect/constant.c:211:             pool[k] = calloc(dudect_pool, sizeof(queue_t *));
+	.loc 1 211 23 is_stmt 0 view .LVU414
+	movslq	dudect_pool(%rip), %rdi	# dudect_pool, dudect_pool
+	movl	$8, %esi	#,
+	call	calloc@PLT	#
+.LVL163:
+# dudect/constant.c:211:             pool[k] = calloc(dudect_pool, sizeof(queue_t *));
+	.loc 1 211 21 view .LVU415
+	movq	%rax, 8+pool(%rip)	# tmp248, pool[1]
+	.loc 1 212 13 is_stmt 1 view .LVU416
+# dudect/constant.c:212:             if (!pool[k])
+	.loc 1 212 16 is_stmt 0 view .LVU417
+	testq	%rax, %rax	# tmp248
+	je	.L97	#,
+	.loc 1 214 13 is_stmt 1 view .LVU418
+# dudect/constant.c:214:             pool_next[k] = 0;
+	.loc 1 214 26 is_stmt 0 view .LVU419
+	leaq	pool_next(%rip), %rax	#, tmp420
+	movq	$0, 8(%rax)	#, pool_next[1]
+	.loc 1 210 33 is_stmt 1 view .LVU420
+.LVL164:
+	.loc 1 210 27 view .LVU421
+.LBE145:
+	.loc 1 216 9 view .LVU422
+# dudect/constant.c:216:         pool_size = dudect_pool;
+	.loc 1 216 19 is_stmt 0 view .LVU423
+	movslq	dudect_pool(%rip), %rax	# dudect_pool, _125
+	movq	%rax, pool_size(%rip)	# _125, pool_size
+	.loc 1 218 9 is_stmt 1 view .LVU424
+.LBB146:
+	.loc 1 218 14 view .LVU425
+.LVL165:
+	.loc 1 218 30 view .LVU426
+	testq	%rax, %rax	# _125
+	je	.L96	#,
+# dudect/constant.c:218:         for (size_t i = 0; i < pool_size; i++)
+	.loc 1 218 21 is_stmt 0 view .LVU427
+	movl	$0, %r13d	#, i
+.LBB147:
+# dudect/constant.c:220:                 pool[k][i] = op->setup((k + 1) * CONSTANT_BASE);
+	.loc 1 220 32 view .LVU428
+	movq	16(%rbp), %rax	# MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_37(D)].setup, _192
+	movq	%r14, 40(%rsp)	# _13, %sfp
+	movq	%rbx, 48(%rsp)	# i, %sfp
+	movq	%rax, %r14	# _192, _192
+	movq	%r15, 56(%rsp)	# lengths, %sfp
+.LVL166:
+.L99:
+	.loc 1 219 31 is_stmt 1 view .LVU429
+	leaq	0(,%r13,8), %rbx	#, _54
+	.loc 1 220 17 view .LVU430
+# dudect/constant.c:220:                 pool[k][i] = op->setup((k + 1) * CONSTANT_BASE);
+	.loc 1 220 24 is_stmt 0 view .LVU431
+	movq	%rbx, %r15	# _54, _190
+	addq	pool(%rip), %r15	# pool[0], _190
+# dudect/constant.c:220:                 pool[k][i] = op->setup((k + 1) * CONSTANT_BASE);
+	.loc 1 220 30 view .LVU432
+	movl	$2, %edi	#,
+	call	*%r14	# _192
+.LVL167:
+# dudect/constant.c:220:                 pool[k][i] = op->setup((k + 1) * CONSTANT_BASE);
+	.loc 1 220 28 view .LVU433
+	movq	%rax, (%r15)	# tmp394, *_190
+	.loc 1 219 37 is_stmt 1 view .LVU434
+.LVL168:
+	.loc 1 219 31 view .LVU435
+	.loc 1 220 17 view .LVU436
+# dudect/constant.c:220:                 pool[k][i] = op->setup((k + 1) * CONSTANT_BASE);
+	.loc 1 220 24 is_stmt 0 view .LVU437
+	addq	8+pool(%rip), %rbx	# pool[1], _134
+# dudect/constant.c:220:                 pool[k][i] = op->setup((k + 1) * CONSTANT_BASE);
+	.loc 1 220 30 view .LVU438
+	movl	$4, %edi	#,
+	call	*%r14	# _192
+.LVL169:
+# dudect/constant.c:220:                 pool[k][i] = op->setup((k + 1) * CONSTANT_BASE);
+	.loc 1 220 28 view .LVU439
+	movq	%rax, (%rbx)	# tmp395, *_134
+	.loc 1 219 37 is_stmt 1 view .LVU440
+.LVL170:
+	.loc 1 219 31 view .LVU441
+.LBE147:
+	.loc 1 218 44 view .LVU442
+	addq	$1, %r13	#, i
+.LVL171:
+	.loc 1 218 30 view .LVU443
+	cmpq	pool_size(%rip), %r13	# pool_size, i
+	jb	.L99	#,
+	movq	40(%rsp), %r14	# %sfp, _13
+	movq	48(%rsp), %rbx	# %sfp, i
+	movq	56(%rsp), %r15	# %sfp, lengths
+	jmp	.L96	#
+.LVL172:
+.L97:
+	.loc 1 218 30 is_stmt 0 view .LVU444
+.LBE146:
+.LBB148:
+	.loc 1 213 17 is_stmt 1 view .LVU445
+	movl	$111, %edi	#,
+	call	exit@PLT	#
+.LVL173:
+.L101:
+	.loc 1 213 17 is_stmt 0 view .LVU446
+.LBE148:
+.LBE150:
+.LBE170:
+.LBB171:
+.LBB160:
+# dudect/timer.h:35:     switch (timer_active) {
+	.loc 2 35 5 view .LVU447
+	subl	$3, %eax	#, tmp275
+	cmpl	$1, %eax	#, tmp275
+	ja	.L103	#,
+	.loc 2 42 9 is_stmt 1 view .LVU448
+# dudect/timer.h:42:         return perf_read();
+	.loc 2 42 16 is_stmt 0 view .LVU449
+	call	perf_read@PLT	#
+.LVL174:
+	movq	%rax, %rdx	# tmp396, _101
+	jmp	.L105	#
+.L100:
+	.loc 2 39 9 is_stmt 1 view .LVU450
+.LBB156:
+.LBI156:
+	.loc 3 32 23 view .LVU451
+.LBB157:
+	.loc 3 35 5 view .LVU452
+	.loc 3 36 5 view .LVU453
+#APP
+# 36 "dudect/cpucycles.h" 1
+	rdtscp
+	lfence
+	
+# 0 "" 2
+.LVL175:
+	.loc 3 38 5 view .LVU454
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 45 is_stmt 0 view .LVU455
+#NO_APP
+	salq	$32, %rdx	#, tmp284
+.LVL176:
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 13 view .LVU456
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 27 view .LVU457
+	orq	%rax, %rdx	# lo, _101
+.LVL177:
+	.loc 3 38 27 view .LVU458
+.LBE157:
+.LBE156:
+# dudect/timer.h:39:         return cpucycles_rdtscp();
+	.loc 2 39 16 view .LVU459
+	jmp	.L105	#
+.L103:
+	.loc 2 44 9 is_stmt 1 view .LVU460
+.LBB158:
+.LBI158:
+	.loc 3 6 23 view .LVU461
+.LBB159:
+	.loc 3 9 5 view .LVU462
+	.loc 3 10 5 view .LVU463
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL178:
+	.loc 3 11 5 view .LVU464
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 45 is_stmt 0 view .LVU465
+#NO_APP
+	salq	$32, %rdx	#, tmp289
+.LVL179:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 13 view .LVU466
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 27 view .LVU467
+	orq	%rax, %rdx	# lo, _101
+.LVL180:
+	.loc 3 11 27 view .LVU468
+.LBE159:
+.LBE158:
+# dudect/timer.h:44:         return cpucycles();
+	.loc 2 44 16 view .LVU469
+	jmp	.L105	#
+.L107:
+	.loc 2 44 16 view .LVU470
+.LBE160:
+.LBE171:
+.LBB172:
+.LBB169:
+# dudect/timer.h:35:     switch (timer_active) {
+	.loc 2 35 5 view .LVU471
+	subl	$3, %eax	#, tmp300
+	cmpl	$1, %eax	#, tmp300
+	ja	.L109	#,
+	.loc 2 42 9 is_stmt 1 view .LVU472
+# dudect/timer.h:42:         return perf_read();
+	.loc 2 42 16 is_stmt 0 view .LVU473
+	call	perf_read@PLT	#
+.LVL181:
+	movq	%rax, %rdx	# tmp397, _80
+	jmp	.L111	#
+.L106:
+	.loc 2 39 9 is_stmt 1 view .LVU474
+.LBB165:
+.LBI165:
+	.loc 3 32 23 view .LVU475
+.LBB166:
+	.loc 3 35 5 view .LVU476
+	.loc 3 36 5 view .LVU477
+#APP
+# 36 "dudect/cpucycles.h" 1
+	rdtscp
+	lfence
+	
+# 0 "" 2
+.LVL182:
+	.loc 3 38 5 view .LVU478
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 45 is_stmt 0 view .LVU479
+#NO_APP
+	salq	$32, %rdx	#, tmp309
+.LVL183:
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 13 view .LVU480
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 27 view .LVU481
+	orq	%rax, %rdx	# lo, _80
+.LVL184:
+	.loc 3 38 27 view .LVU482
+.LBE166:
+.LBE165:
+# dudect/timer.h:39:         return cpucycles_rdtscp();
+	.loc 2 39 16 view .LVU483
+	jmp	.L111	#
+.L109:
+	.loc 2 44 9 is_stmt 1 view .LVU484
+.LBB167:
+.LBI167:
+	.loc 3 6 23 view .LVU485
+.LBB168:
+	.loc 3 9 5 view .LVU486
+	.loc 3 10 5 view .LVU487
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL185:
+	.loc 3 11 5 view .LVU488
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 45 is_stmt 0 view .LVU489
+#NO_APP
+	salq	$32, %rdx	#, tmp314
+.LVL186:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 13 view .LVU490
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 27 view .LVU491
+	orq	%rax, %rdx	# lo, _80
+.LVL187:
+	.loc 3 11 27 view .LVU492
+.LBE168:
+.LBE167:
+# dudect/timer.h:44:         return cpucycles();
+	.loc 2 44 16 view .LVU493
+	jmp	.L111	#
+.LVL188:
+.L114:
+	.loc 2 44 16 view .LVU494
+.LBE169:
+.LBE172:
+.LBE173:
+.LBB174:
+.LBB175:
+# dudect/timer.h:35:     switch (timer_active) {
+	.loc 2 35 5 view .LVU495
+	subl	$3, %eax	#, tmp325
+	cmpl	$1, %eax	#, tmp325
+	ja	.L116	#,
+	.loc 2 42 9 is_stmt 1 view .LVU496
+# dudect/timer.h:42:         return perf_read();
+	.loc 2 42 16 is_stmt 0 view .LVU497
+	call	perf_read@PLT	#
+.LVL189:
+	movq	%rax, %rdx	# tmp400, _173
+	jmp	.L118	#
+.L113:
+	.loc 2 39 9 is_stmt 1 view .LVU498
+.LBB176:
+.LBI176:
+	.loc 3 32 23 view .LVU499
+.LBB177:
+	.loc 3 35 5 view .LVU500
+	.loc 3 36 5 view .LVU501
+#APP
+# 36 "dudect/cpucycles.h" 1
+	rdtscp
+	lfence
+	
+# 0 "" 2
+.LVL190:
+	.loc 3 38 5 view .LVU502
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 45 is_stmt 0 view .LVU503
+#NO_APP
+	salq	$32, %rdx	#, tmp334
+.LVL191:
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 13 view .LVU504
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 27 view .LVU505
+	orq	%rax, %rdx	# lo, _173
+.LVL192:
+	.loc 3 38 27 view .LVU506
+.LBE177:
+.LBE176:
+# dudect/timer.h:39:         return cpucycles_rdtscp();
+	.loc 2 39 16 view .LVU507
+	jmp	.L118	#
+.L116:
+	.loc 2 44 9 is_stmt 1 view .LVU508
+.LBB178:
+.LBI178:
+	.loc 3 6 23 view .LVU509
+.LBB179:
+	.loc 3 9 5 view .LVU510
+	.loc 3 10 5 view .LVU511
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL193:
+	.loc 3 11 5 view .LVU512
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 45 is_stmt 0 view .LVU513
+#NO_APP
+	salq	$32, %rdx	#, tmp339
+.LVL194:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 13 view .LVU514
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 27 view .LVU515
+	orq	%rax, %rdx	# lo, _173
+.LVL195:
+	.loc 3 11 27 view .LVU516
+.LBE179:
+.LBE178:
+# dudect/timer.h:44:         return cpucycles();
+	.loc 2 44 16 view .LVU517
+	jmp	.L118	#
+.L120:
+	.loc 2 44 16 view .LVU518
+.LBE175:
+.LBE174:
+.LBB183:
+.LBB184:
+# dudect/timer.h:35:     switch (timer_active) {
+	.loc 2 35 5 view .LVU519
+	subl	$3, %eax	#, tmp350
+	cmpl	$1, %eax	#, tmp350
+	ja	.L122	#,
+	.loc 2 42 9 is_stmt 1 view .LVU520
+# dudect/timer.h:42:         return perf_read();
+	.loc 2 42 16 is_stmt 0 view .LVU521
+	call	perf_read@PLT	#
+.LVL196:
+	movq	%rax, %rdx	# tmp402, _152
+	jmp	.L124	#
+.L119:
+	.loc 2 39 9 is_stmt 1 view .LVU522
+.LBB185:
+.LBI185:
+	.loc 3 32 23 view .LVU523
+.LBB186:
+	.loc 3 35 5 view .LVU524
+	.loc 3 36 5 view .LVU525
+#APP
+# 36 "dudect/cpucycles.h" 1
+	rdtscp
+	lfence
+	
+# 0 "" 2
+.LVL197:
+	.loc 3 38 5 view .LVU526
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 45 is_stmt 0 view .LVU527
+#NO_APP
+	salq	$32, %rdx	#, tmp359
+.LVL198:
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 13 view .LVU528
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:38:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 38 27 view .LVU529
+	orq	%rax, %rdx	# lo, _152
+.LVL199:
+.L124:
+	.loc 3 38 27 view .LVU530
+.LBE186:
+.LBE185:
+.LBE184:
+.LBE183:
+# dudect/constant.c:262:         after_ticks[i] = timer_read();
+	.loc 1 262 24 view .LVU531
+	movq	16(%rsp), %rax	# %sfp, after_ticks
+	movq	%rdx, (%rax,%rbx,8)	# _152, MEM[(int64_t *)after_ticks_57(D) + i_24 * 8]
+	.loc 1 263 9 is_stmt 1 view .LVU532
+# dudect/constant.c:263:         if (qi)
+	.loc 1 263 12 is_stmt 0 view .LVU533
+	testq	%r13, %r13	# qi
+	je	.L125	#,
+	.loc 1 264 13 is_stmt 1 view .LVU534
+	movq	%r13, %rdi	# qi,
+	call	*32(%rbp)	# MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_37(D)].teardown
+.LVL200:
+.L125:
+	.loc 1 265 9 view .LVU535
+	movq	%r14, %rdi	# qo,
+	call	*32(%rbp)	# MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_37(D)].teardown
+.LVL201:
+.L112:
+	.loc 1 265 9 is_stmt 0 view .LVU536
+.LBE194:
+	.loc 1 236 50 is_stmt 1 discriminator 2 view .LVU537
+	addq	$1, %rbx	#, i
+.LVL202:
+	.loc 1 236 26 discriminator 2 view .LVU538
+	cmpq	$150, %rbx	#, i
+	je	.L138	#,
+.LVL203:
+.L92:
+.LBB195:
+	.loc 1 237 9 view .LVU539
+	.loc 1 238 9 view .LVU540
+# dudect/constant.c:237:         size_t base = CONSTANT_BASE;
+	.loc 1 237 16 is_stmt 0 view .LVU541
+	movl	$2, %r13d	#, base
+# dudect/constant.c:238:         if (op->linear)
+	.loc 1 238 12 view .LVU542
+	cmpb	$0, 8(%rbp)	#, MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_37(D)].linear
+	je	.L93	#,
+	.loc 1 239 13 is_stmt 1 view .LVU543
+# dudect/constant.c:240:                    *(uint16_t *) (input_data + i * chunk_size) %
+	.loc 1 240 20 is_stmt 0 view .LVU544
+	movq	%rbx, %rax	# i, tmp228
+	salq	$4, %rax	#, tmp228
+# dudect/constant.c:239:             base = LINEAR_MIN_BASE +
+	.loc 1 239 18 view .LVU545
+	movq	24(%rsp), %rcx	# %sfp, input_data
+	movzwl	(%rcx,%rax), %r13d	# MEM[(uint16_t *)input_data_42(D) + _222 * 1], MEM[(uint16_t *)input_data_42(D) + _222 * 1]
+	andl	$63, %r13d	#, tmp229
+	addl	$64, %r13d	#, tmp231
+	movzwl	%r13w, %r13d	# tmp231, base
+.LVL204:
+.L93:
+	.loc 1 242 9 is_stmt 1 view .LVU546
+# dudect/constant.c:242:         char *s = get_random_string();
+	.loc 1 242 19 is_stmt 0 view .LVU547
+	call	get_random_string	#
+.LVL205:
+	movq	%rax, (%rsp)	# tmp391, %sfp
+.LVL206:
+	.loc 1 248 9 is_stmt 1 view .LVU548
+# dudect/constant.c:249:         lengths[i] = classes[i] ? 2 * base : base;
+	.loc 1 249 44 is_stmt 0 view .LVU549
+	leaq	(%r13,%r13), %rax	#, iftmp.19_33
+.LVL207:
+# dudect/constant.c:248:         size_t other = classes[i] ? base : 2 * base;
+	.loc 1 248 42 view .LVU550
+	cmpb	$0, (%r12,%rbx)	#, MEM[(uint8_t *)classes_46(D) + i_24 * 1]
+	jne	.L126	#,
+.LVL208:
+	.loc 1 249 9 is_stmt 1 discriminator 1 view .LVU551
+# dudect/constant.c:249:         lengths[i] = classes[i] ? 2 * base : base;
+	.loc 1 249 44 is_stmt 0 discriminator 1 view .LVU552
+	movq	%r13, %rax	# base, iftmp.19_33
+# dudect/constant.c:248:         size_t other = classes[i] ? base : 2 * base;
+	.loc 1 248 42 discriminator 1 view .LVU553
+	leaq	(%r13,%r13), %r13	#, base
+.LVL209:
+.L126:
+# dudect/constant.c:249:         lengths[i] = classes[i] ? 2 * base : base;
+	.loc 1 249 20 discriminator 4 view .LVU554
+	movq	%rax, (%r15,%rbx,8)	# iftmp.19_33, MEM[(size_t *)lengths_49(D) + i_24 * 8]
+	.loc 1 250 9 is_stmt 1 discriminator 4 view .LVU555
+# dudect/constant.c:250:         if (dudect_pool > 0 && op->undo) {
+	.loc 1 250 25 is_stmt 0 discriminator 4 view .LVU556
+	movl	dudect_pool(%rip), %eax	# dudect_pool, dudect_pool.20_12
+# dudect/constant.c:250:         if (dudect_pool > 0 && op->undo) {
+	.loc 1 250 12 discriminator 4 view .LVU557
+	testl	%eax, %eax	# dudect_pool.20_12
+	jle	.L95	#,
+# dudect/constant.c:250:         if (dudect_pool > 0 && op->undo) {
+	.loc 1 250 34 discriminator 1 view .LVU558
+	movq	40(%rbp), %r14	# MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_37(D)].undo, _13
+# dudect/constant.c:250:         if (dudect_pool > 0 && op->undo) {
+	.loc 1 250 29 discriminator 1 view .LVU559
+	testq	%r14, %r14	# _13
+	jne	.L139	#,
+.L95:
+	.loc 1 258 9 is_stmt 1 view .LVU560
+# dudect/constant.c:258:         queue_t *qo = op->setup(other);
+	.loc 1 258 25 is_stmt 0 view .LVU561
+	movq	16(%rbp), %rax	# MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_37(D)].setup, _21
+# dudect/constant.c:258:         queue_t *qo = op->setup(other);
+	.loc 1 258 23 view .LVU562
+	movq	%r13, %rdi	# base,
+	movq	%rax, %r13	# _21, _21
+	call	*%rax	# _21
+.LVL210:
+	movq	%rax, %r14	# tmp398, qo
+.LVL211:
+	.loc 1 259 9 is_stmt 1 view .LVU563
+# dudect/constant.c:259:         queue_t *qi = op->setup(lengths[i]);
+	.loc 1 259 23 is_stmt 0 view .LVU564
+	movq	(%r15,%rbx,8), %rdi	# MEM[(size_t *)lengths_49(D) + i_24 * 8], MEM[(size_t *)lengths_49(D) + i_24 * 8]
+	call	*%r13	# _21
+.LVL212:
+	.loc 1 259 23 view .LVU565
+	movq	%rax, %r13	# tmp399, qi
+.LVL213:
+	.loc 1 260 9 is_stmt 1 view .LVU566
+.LBB192:
+.LBI174:
+	.loc 2 33 23 view .LVU567
+.LBB182:
+	.loc 2 35 5 view .LVU568
+	movl	timer_active(%rip), %eax	# timer_active, timer_active.16_167
+.LVL214:
+	.loc 2 35 5 is_stmt 0 view .LVU569
+	cmpl	$2, %eax	#, timer_active.16_167
+	je	.L113	#,
+	jg	.L114	#,
+	cmpl	$1, %eax	#, timer_active.16_167
+	jne	.L116	#,
+	.loc 2 37 9 is_stmt 1 view .LVU570
+.LBB180:
+.LBI180:
+	.loc 3 19 23 view .LVU571
+.LBB181:
+	.loc 3 22 5 view .LVU572
+	.loc 3 23 5 view .LVU573
+#APP
+# 23 "dudect/cpucycles.h" 1
+	lfence
+	rdtsc
+	lfence
+	
+# 0 "" 2
+.LVL215:
+	.loc 3 25 5 view .LVU574
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 45 is_stmt 0 view .LVU575
+#NO_APP
+	salq	$32, %rdx	#, tmp329
+.LVL216:
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 13 view .LVU576
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 27 view .LVU577
+	orq	%rax, %rdx	# lo, _173
+.LVL217:
+.L118:
+	.loc 3 25 27 view .LVU578
+.LBE181:
+.LBE180:
+.LBE182:
+.LBE192:
+# dudect/constant.c:260:         before_ticks[i] = timer_read();
+	.loc 1 260 25 view .LVU579
+	movq	8(%rsp), %rax	# %sfp, before_ticks
+	movq	%rdx, (%rax,%rbx,8)	# _173, MEM[(int64_t *)before_ticks_53(D) + i_24 * 8]
+	.loc 1 261 9 is_stmt 1 view .LVU580
+# dudect/constant.c:261:         qi = op->call(qi, s);
+	.loc 1 261 14 is_stmt 0 view .LVU581
+	movq	(%rsp), %rsi	# %sfp,
+	movq	%r13, %rdi	# qi,
+	call	*24(%rbp)	# MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_37(D)].call
+.LVL218:
+	movq	%rax, %r13	# tmp401, qi
+.LVL219:
+	.loc 1 262 9 is_stmt 1 view .LVU582
+.LBB193:
+.LBI183:
+	.loc 2 33 23 view .LVU583
+.LBB191:
+	.loc 2 35 5 view .LVU584
+	movl	timer_active(%rip), %eax	# timer_active, timer_active.16_146
+.LVL220:
+	.loc 2 35 5 is_stmt 0 view .LVU585
+	cmpl	$2, %eax	#, timer_active.16_146
+	je	.L119	#,
+	jg	.L120	#,
+	cmpl	$1, %eax	#, timer_active.16_146
+	jne	.L122	#,
+	.loc 2 37 9 is_stmt 1 view .LVU586
+.LBB187:
+.LBI187:
+	.loc 3 19 23 view .LVU587
+.LBB188:
+	.loc 3 22 5 view .LVU588
+	.loc 3 23 5 view .LVU589
+#APP
+# 23 "dudect/cpucycles.h" 1
+	lfence
+	rdtsc
+	lfence
+	
+# 0 "" 2
+.LVL221:
+	.loc 3 25 5 view .LVU590
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 45 is_stmt 0 view .LVU591
+#NO_APP
+	salq	$32, %rdx	#, tmp354
+.LVL222:
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 13 view .LVU592
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 25 27 view .LVU593
+	orq	%rax, %rdx	# lo, _152
+.LVL223:
+	.loc 3 25 27 view .LVU594
+.LBE188:
+.LBE187:
+# dudect/timer.h:37:         return cpucycles_lfence();
+	.loc 2 37 16 view .LVU595
+	jmp	.L124	#
+.L122:
+	.loc 2 44 9 is_stmt 1 view .LVU596
+.LBB189:
+.LBI189:
+	.loc 3 6 23 view .LVU597
+.LBB190:
+	.loc 3 9 5 view .LVU598
+	.loc 3 10 5 view .LVU599
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL224:
+	.loc 3 11 5 view .LVU600
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 45 is_stmt 0 view .LVU601
+#NO_APP
+	salq	$32, %rdx	#, tmp364
+.LVL225:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 13 view .LVU602
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 3 11 27 view .LVU603
+	orq	%rax, %rdx	# lo, _152
+.LVL226:
+	.loc 3 11 27 view .LVU604
+.LBE190:
+.LBE189:
+# dudect/timer.h:44:         return cpucycles();
+	.loc 2 44 16 view .LVU605
+	jmp	.L124	#
+.LVL227:
+.L138:
+	.loc 2 44 16 view .LVU606
+.LBE191:
+.LBE193:
+.LBE195:
+.LBE196:
+# dudect/constant.c:267: }
+	.loc 1 267 1 view .LVU607
+	addq	$72, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+.LVL228:
+	.loc 1 267 1 view .LVU608
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL229:
+	.loc 1 267 1 view .LVU609
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE43:
+	.size	measure, .-measure
+	.section	.rodata
+	.align 8
+	.type	__PRETTY_FUNCTION__.0, @object
+	.size	__PRETTY_FUNCTION__.0, 8
+__PRETTY_FUNCTION__.0:
+	.string	"measure"
+	.align 8
+	.type	__PRETTY_FUNCTION__.1, @object
+	.size	__PRETTY_FUNCTION__.1, 12
+__PRETTY_FUNCTION__.1:
+	.string	"measure_old"
+	.globl	dut_ops
+	.section	.rodata.str1.1
+.LC3:
+	.string	"insert_tail"
+.LC4:
+	.string	"size"
+.LC5:
+	.string	"insert_head"
+.LC6:
+	.string	"remove_head"
+.LC7:
+	.string	"remove_head_quiet"
+.LC8:
+	.string	"free"
+.LC9:
+	.string	"reverse"
+	.section	.data.rel.ro,"aw"
+	.align 32
+	.type	dut_ops, @object
+	.size	dut_ops, 336
+dut_ops:
+# name:
+	.quad	.LC3
+# linear:
+	.byte	0
+# setup:
+	.zero	7
+	.quad	setup_queue
+# call:
+	.quad	call_insert_tail
+# teardown:
+	.quad	q_free
+# undo:
+	.quad	undo_insert
+# name:
+	.quad	.LC4
+# linear:
+	.byte	0
+# setup:
+	.zero	7
+	.quad	setup_queue
+# call:
+	.quad	call_size
+# teardown:
+	.quad	q_free
+# undo:
+	.quad	undo_none
+# name:
+	.quad	.LC5
+# linear:
+	.byte	0
+# setup:
+	.zero	7
+	.quad	setup_queue
+# call:
+	.quad	call_insert_head
+# teardown:
+	.quad	q_free
+# undo:
+	.quad	undo_insert
+# name:
+	.quad	.LC6
+# linear:
+	.byte	0
+# setup:
+	.zero	7
+	.quad	setup_queue
+# call:
+	.quad	call_remove_head
+# teardown:
+	.quad	q_free
+# undo:
+	.quad	undo_remove
+# name:
+	.quad	.LC7
+# linear:
+	.byte	0
+# setup:
+	.zero	7
+	.quad	setup_queue
+# call:
+	.quad	call_remove_head_quiet
+# teardown:
+	.quad	q_free
+# undo:
+	.quad	undo_remove
+# name:
+	.quad	.LC8
+# linear:
+	.byte	1
+# setup:
+	.zero	7
+	.quad	setup_queue
+# call:
+	.quad	call_free
+# teardown:
+	.quad	q_free
+# undo:
+	.quad	0
+# name:
+	.quad	.LC9
+# linear:
+	.byte	1
+# setup:
+	.zero	7
+	.quad	setup_queue
+# call:
+	.quad	call_reverse
+# teardown:
+	.quad	q_free
+# undo:
+	.quad	0
+	.local	remove_buf
+	.comm	remove_buf,8,8
+	.local	pool_next
+	.comm	pool_next,16,16
+	.local	pool_size
+	.comm	pool_size,8,8
+	.local	pool
+	.comm	pool,16,16
+	.local	random_string_iter
+	.comm	random_string_iter,4,4
+	.local	random_string
+	.comm	random_string,1200,32
+	.local	q
+	.comm	q,8,8
+	.globl	drop_size
+	.section	.rodata
+	.align 4
+	.type	drop_size, @object
+	.size	drop_size, 4
+drop_size:
+	.long	20
+	.globl	number_measurements
+	.align 8
+	.type	number_measurements, @object
+	.size	number_measurements, 8
+number_measurements:
+	.quad	150
+	.globl	chunk_size
+	.align 8
+	.type	chunk_size, @object
+	.size	chunk_size, 8
+chunk_size:
+	.quad	16
+	.text
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "./queue.h"
+	.file 9 "dudect/constant.h"
+	.file 10 "./console.h"
+	.file 11 "/usr/include/stdlib.h"
+	.file 12 "/usr/include/assert.h"
+	.file 13 "./random.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1857
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2e
+	.long	.LASF106
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0xf
+	.long	.LASF10
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x17
+	.long	0x46
+	.uleb128 0x13
+	.long	0x35
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x13
+	.long	0x4d
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF6
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0xf
+	.long	.LASF11
+	.byte	0x5
+	.byte	0x26
+	.byte	0x17
+	.long	0x67
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF12
+	.uleb128 0xf
+	.long	.LASF13
+	.byte	0x5
+	.byte	0x28
+	.byte	0x1c
+	.long	0x6e
+	.uleb128 0xf
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x2c
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x30
+	.byte	0x8
+	.uleb128 0x9
+	.long	0xb5
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0x13
+	.long	0xb5
+	.uleb128 0xf
+	.long	.LASF16
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x13
+	.long	0xa2
+	.uleb128 0xf
+	.long	.LASF17
+	.byte	0x7
+	.byte	0x18
+	.byte	0x13
+	.long	0x83
+	.uleb128 0xf
+	.long	.LASF18
+	.byte	0x7
+	.byte	0x19
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x31
+	.string	"ELE"
+	.byte	0x10
+	.byte	0x8
+	.byte	0x11
+	.byte	0x10
+	.long	0x10d
+	.uleb128 0xe
+	.long	.LASF19
+	.byte	0x8
+	.byte	0x15
+	.byte	0xb
+	.long	0xb0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF20
+	.byte	0x8
+	.byte	0x16
+	.byte	0x11
+	.long	0x10d
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0xe5
+	.uleb128 0xf
+	.long	.LASF21
+	.byte	0x8
+	.byte	0x17
+	.byte	0x3
+	.long	0xe5
+	.uleb128 0x23
+	.byte	0x18
+	.byte	0x8
+	.byte	0x1a
+	.long	0x14e
+	.uleb128 0xe
+	.long	.LASF22
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x11
+	.long	0x14e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF23
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x11
+	.long	0x14e
+	.byte	0x8
+	.uleb128 0xe
+	.long	.LASF24
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x9
+	.long	0x4d
+	.byte	0x10
+	.byte	0
+	.uleb128 0x9
+	.long	0x112
+	.uleb128 0xf
+	.long	.LASF25
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x3
+	.long	0x11e
+	.uleb128 0x24
+	.long	0x75
+	.byte	0x9
+	.byte	0xa
+	.long	0x19b
+	.uleb128 0x8
+	.long	.LASF26
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF27
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF28
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF29
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF30
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF32
+	.byte	0x6
+	.uleb128 0x8
+	.long	.LASF33
+	.byte	0x7
+	.byte	0
+	.uleb128 0x23
+	.byte	0x30
+	.byte	0x9
+	.byte	0x16
+	.long	0x1f2
+	.uleb128 0xe
+	.long	.LASF34
+	.byte	0x9
+	.byte	0x17
+	.byte	0xb
+	.long	0xb0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF35
+	.byte	0x9
+	.byte	0x19
+	.byte	0xa
+	.long	0x1f2
+	.byte	0x8
+	.uleb128 0xe
+	.long	.LASF36
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x10
+	.long	0x20d
+	.byte	0x10
+	.uleb128 0xe
+	.long	.LASF37
+	.byte	0x9
+	.byte	0x1d
+	.byte	0x10
+	.long	0x226
+	.byte	0x18
+	.uleb128 0xe
+	.long	.LASF38
+	.byte	0x9
+	.byte	0x1f
+	.byte	0xc
+	.long	0x236
+	.byte	0x20
+	.uleb128 0xe
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x24
+	.byte	0xc
+	.long	0x236
+	.byte	0x28
+	.byte	0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF40
+	.uleb128 0x25
+	.long	0x208
+	.long	0x208
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x9
+	.long	0x153
+	.uleb128 0x9
+	.long	0x1f9
+	.uleb128 0x25
+	.long	0x208
+	.long	0x226
+	.uleb128 0x4
+	.long	0x208
+	.uleb128 0x4
+	.long	0xb0
+	.byte	0
+	.uleb128 0x9
+	.long	0x212
+	.uleb128 0x32
+	.long	0x236
+	.uleb128 0x4
+	.long	0x208
+	.byte	0
+	.uleb128 0x9
+	.long	0x22b
+	.uleb128 0xf
+	.long	.LASF41
+	.byte	0x9
+	.byte	0x25
+	.byte	0x3
+	.long	0x19b
+	.uleb128 0x13
+	.long	0x23b
+	.uleb128 0x14
+	.long	0x247
+	.long	0x25c
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x6
+	.byte	0
+	.uleb128 0x13
+	.long	0x24c
+	.uleb128 0x18
+	.long	.LASF43
+	.byte	0x9
+	.byte	0x27
+	.byte	0x17
+	.long	0x25c
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF42
+	.uleb128 0x14
+	.long	0xb5
+	.long	0x284
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	0xbc
+	.uleb128 0x18
+	.long	.LASF44
+	.byte	0xa
+	.byte	0xb
+	.byte	0xd
+	.long	0x1f2
+	.uleb128 0x24
+	.long	0x75
+	.byte	0x2
+	.byte	0x9
+	.long	0x2c5
+	.uleb128 0x8
+	.long	.LASF45
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF47
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF48
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF49
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF50
+	.byte	0x5
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF51
+	.byte	0x2
+	.byte	0x16
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x1b
+	.long	.LASF52
+	.byte	0x10
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x9
+	.byte	0x3
+	.quad	chunk_size
+	.uleb128 0x1b
+	.long	.LASF53
+	.byte	0x12
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x9
+	.byte	0x3
+	.quad	number_measurements
+	.uleb128 0x1b
+	.long	.LASF54
+	.byte	0x13
+	.byte	0xb
+	.long	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	drop_size
+	.uleb128 0x33
+	.string	"q"
+	.byte	0x1
+	.byte	0x17
+	.byte	0x11
+	.long	0x208
+	.uleb128 0x9
+	.byte	0x3
+	.quad	q
+	.uleb128 0x14
+	.long	0xb5
+	.long	0x33a
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x95
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x7
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF55
+	.byte	0x18
+	.byte	0xd
+	.long	0x324
+	.uleb128 0x9
+	.byte	0x3
+	.quad	random_string
+	.uleb128 0x16
+	.long	.LASF56
+	.byte	0x19
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	random_string_iter
+	.uleb128 0x18
+	.long	.LASF57
+	.byte	0x1
+	.byte	0x1b
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x14
+	.long	0x380
+	.long	0x380
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	0x208
+	.uleb128 0x16
+	.long	.LASF58
+	.byte	0x22
+	.byte	0x12
+	.long	0x370
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pool
+	.uleb128 0x16
+	.long	.LASF59
+	.byte	0x23
+	.byte	0xf
+	.long	0x35
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pool_size
+	.uleb128 0x14
+	.long	0x35
+	.long	0x3bf
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x1
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF60
+	.byte	0x24
+	.byte	0xf
+	.long	0x3af
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pool_next
+	.uleb128 0x16
+	.long	.LASF61
+	.byte	0x72
+	.byte	0xd
+	.long	0x274
+	.uleb128 0x9
+	.byte	0x3
+	.quad	remove_buf
+	.uleb128 0x34
+	.long	0x261
+	.byte	0x1
+	.byte	0xb2
+	.byte	0x10
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dut_ops
+	.uleb128 0x35
+	.long	.LASF62
+	.byte	0xb
+	.value	0x27d
+	.byte	0xd
+	.long	0x40e
+	.uleb128 0x4
+	.long	0x4d
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF63
+	.byte	0xb
+	.value	0x22c
+	.byte	0xe
+	.long	0xae
+	.long	0x42a
+	.uleb128 0x4
+	.long	0x35
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF64
+	.byte	0x48
+	.byte	0x6
+	.long	0x1f2
+	.long	0x449
+	.uleb128 0x4
+	.long	0x208
+	.uleb128 0x4
+	.long	0xb0
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF68
+	.byte	0x8
+	.byte	0x57
+	.long	0x45a
+	.uleb128 0x4
+	.long	0x208
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF71
+	.byte	0x2
+	.byte	0x1f
+	.long	0xc1
+	.uleb128 0x19
+	.long	.LASF65
+	.byte	0x4e
+	.byte	0x5
+	.long	0x4d
+	.long	0x47a
+	.uleb128 0x4
+	.long	0x208
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF66
+	.byte	0x3e
+	.byte	0x6
+	.long	0x1f2
+	.long	0x494
+	.uleb128 0x4
+	.long	0x208
+	.uleb128 0x4
+	.long	0xb0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF67
+	.byte	0x35
+	.byte	0x6
+	.long	0x1f2
+	.long	0x4ae
+	.uleb128 0x4
+	.long	0x208
+	.uleb128 0x4
+	.long	0xb0
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF69
+	.byte	0x8
+	.byte	0x26
+	.byte	0xa
+	.long	0x208
+	.long	0x4c0
+	.uleb128 0x38
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF70
+	.byte	0xc
+	.byte	0x45
+	.byte	0xd
+	.long	0x4e1
+	.uleb128 0x4
+	.long	0x284
+	.uleb128 0x4
+	.long	0x284
+	.uleb128 0x4
+	.long	0x75
+	.uleb128 0x4
+	.long	0x284
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF72
+	.byte	0xd
+	.byte	0x7
+	.long	0xcd
+	.uleb128 0x1c
+	.long	.LASF73
+	.byte	0xd
+	.byte	0x6
+	.long	0x502
+	.uleb128 0x4
+	.long	0x502
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x9
+	.long	0xcd
+	.uleb128 0x3a
+	.long	.LASF74
+	.byte	0xb
+	.value	0x238
+	.byte	0xd
+	.long	0x51a
+	.uleb128 0x4
+	.long	0xae
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF75
+	.byte	0x8
+	.byte	0x2c
+	.long	0x52b
+	.uleb128 0x4
+	.long	0x208
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF96
+	.byte	0xe3
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbe3
+	.uleb128 0xa
+	.long	.LASF76
+	.byte	0xe3
+	.byte	0x17
+	.long	0xbe3
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0xa
+	.long	.LASF77
+	.byte	0xe4
+	.byte	0x17
+	.long	0xbe3
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0xa
+	.long	.LASF78
+	.byte	0xe5
+	.byte	0x16
+	.long	0xbe8
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xa
+	.long	.LASF79
+	.byte	0xe6
+	.byte	0x17
+	.long	0x502
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0xa
+	.long	.LASF80
+	.byte	0xe7
+	.byte	0x17
+	.long	0x502
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0xa
+	.long	.LASF81
+	.byte	0xe8
+	.byte	0x12
+	.long	0x4d
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x27
+	.long	.LASF98
+	.long	0xbfd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.uleb128 0xb
+	.string	"op"
+	.byte	0x1
+	.byte	0xeb
+	.byte	0x15
+	.long	0xc02
+	.uleb128 0x28
+	.long	.LLRL69
+	.long	0xba7
+	.uleb128 0xc
+	.string	"i"
+	.byte	0xec
+	.byte	0x11
+	.long	0x35
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x1d
+	.long	.LLRL71
+	.uleb128 0x1e
+	.long	.LASF82
+	.byte	0xed
+	.byte	0x10
+	.long	0x35
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0xc
+	.string	"s"
+	.byte	0xf2
+	.byte	0xf
+	.long	0xb0
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x1e
+	.long	.LASF83
+	.byte	0xf8
+	.byte	0x10
+	.long	0x35
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x29
+	.string	"qo"
+	.value	0x102
+	.long	0x208
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x29
+	.string	"qi"
+	.value	0x103
+	.long	0x208
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x28
+	.long	.LLRL77
+	.long	0x976
+	.uleb128 0xc
+	.string	"qi"
+	.byte	0xfb
+	.byte	0x16
+	.long	0x208
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x15
+	.long	0xc07
+	.quad	.LBI143
+	.value	.LVU357
+	.long	.LLRL79
+	.byte	0xfb
+	.byte	0x1b
+	.long	0x781
+	.uleb128 0x3b
+	.long	0xc22
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x3c
+	.long	0xc18
+	.uleb128 0x1d
+	.long	.LLRL79
+	.uleb128 0x1
+	.long	0xc2b
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x3d
+	.long	0xc36
+	.long	.LLRL82
+	.long	0x706
+	.uleb128 0x1
+	.long	0xc3b
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x1f
+	.quad	.LVL161
+	.long	0x40e
+	.long	0x6da
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL163
+	.long	0x40e
+	.long	0x6f1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL173
+	.long	0x3fb
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x6f
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.long	0xc46
+	.quad	.LBB146
+	.quad	.LBE146-.LBB146
+	.long	0x772
+	.uleb128 0x1
+	.long	0xc47
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x3f
+	.long	0xc51
+	.quad	.LBB147
+	.quad	.LBE147-.LBB147
+	.uleb128 0x1
+	.long	0xc52
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x1a
+	.quad	.LVL167
+	.long	0x761
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL169
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL160
+	.long	0x172e
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x17d9
+	.quad	.LBI152
+	.value	.LVU372
+	.long	.LLRL86
+	.byte	0xfc
+	.byte	0x1f
+	.long	0x865
+	.uleb128 0x5
+	.long	0x180e
+	.quad	.LBI154
+	.value	.LVU375
+	.quad	.LBB154
+	.quad	.LBE154-.LBB154
+	.byte	0x25
+	.long	0x7d9
+	.uleb128 0x1
+	.long	0x181f
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST88
+	.long	.LVUS88
+	.byte	0
+	.uleb128 0x5
+	.long	0x17e6
+	.quad	.LBI156
+	.value	.LVU451
+	.quad	.LBB156
+	.quad	.LBE156-.LBB156
+	.byte	0x27
+	.long	0x818
+	.uleb128 0x1
+	.long	0x17f7
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x1
+	.long	0x1802
+	.long	.LLST90
+	.long	.LVUS90
+	.byte	0
+	.uleb128 0x5
+	.long	0x1836
+	.quad	.LBI158
+	.value	.LVU461
+	.quad	.LBB158
+	.quad	.LBE158-.LBB158
+	.byte	0x2c
+	.long	0x857
+	.uleb128 0x1
+	.long	0x1843
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x1
+	.long	0x184e
+	.long	.LLST92
+	.long	.LVUS92
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL174
+	.long	0x45a
+	.byte	0
+	.uleb128 0x15
+	.long	0x17d9
+	.quad	.LBI161
+	.value	.LVU386
+	.long	.LLRL93
+	.byte	0xfe
+	.byte	0x1e
+	.long	0x949
+	.uleb128 0x5
+	.long	0x180e
+	.quad	.LBI163
+	.value	.LVU389
+	.quad	.LBB163
+	.quad	.LBE163-.LBB163
+	.byte	0x25
+	.long	0x8bd
+	.uleb128 0x1
+	.long	0x181f
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST95
+	.long	.LVUS95
+	.byte	0
+	.uleb128 0x5
+	.long	0x17e6
+	.quad	.LBI165
+	.value	.LVU475
+	.quad	.LBB165
+	.quad	.LBE165-.LBB165
+	.byte	0x27
+	.long	0x8fc
+	.uleb128 0x1
+	.long	0x17f7
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x1
+	.long	0x1802
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.uleb128 0x5
+	.long	0x1836
+	.quad	.LBI167
+	.value	.LVU485
+	.quad	.LBB167
+	.quad	.LBE167-.LBB167
+	.byte	0x2c
+	.long	0x93b
+	.uleb128 0x1
+	.long	0x1843
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x1
+	.long	0x184e
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL181
+	.long	0x45a
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LVL154
+	.long	0x965
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x6
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL158
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	0x17d9
+	.quad	.LBI174
+	.value	.LVU567
+	.long	.LLRL100
+	.value	0x104
+	.byte	0x1b
+	.long	0xa5b
+	.uleb128 0x5
+	.long	0x17e6
+	.quad	.LBI176
+	.value	.LVU499
+	.quad	.LBB176
+	.quad	.LBE176-.LBB176
+	.byte	0x27
+	.long	0x9cf
+	.uleb128 0x1
+	.long	0x17f7
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x1
+	.long	0x1802
+	.long	.LLST102
+	.long	.LVUS102
+	.byte	0
+	.uleb128 0x5
+	.long	0x1836
+	.quad	.LBI178
+	.value	.LVU509
+	.quad	.LBB178
+	.quad	.LBE178-.LBB178
+	.byte	0x2c
+	.long	0xa0e
+	.uleb128 0x1
+	.long	0x1843
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x1
+	.long	0x184e
+	.long	.LLST104
+	.long	.LVUS104
+	.byte	0
+	.uleb128 0x5
+	.long	0x180e
+	.quad	.LBI180
+	.value	.LVU571
+	.quad	.LBB180
+	.quad	.LBE180-.LBB180
+	.byte	0x25
+	.long	0xa4d
+	.uleb128 0x1
+	.long	0x181f
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST106
+	.long	.LVUS106
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL189
+	.long	0x45a
+	.byte	0
+	.uleb128 0x2a
+	.long	0x17d9
+	.quad	.LBI183
+	.value	.LVU583
+	.long	.LLRL107
+	.value	0x106
+	.byte	0x1a
+	.long	0xb40
+	.uleb128 0x5
+	.long	0x17e6
+	.quad	.LBI185
+	.value	.LVU523
+	.quad	.LBB185
+	.quad	.LBE185-.LBB185
+	.byte	0x27
+	.long	0xab4
+	.uleb128 0x1
+	.long	0x17f7
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x1
+	.long	0x1802
+	.long	.LLST109
+	.long	.LVUS109
+	.byte	0
+	.uleb128 0x5
+	.long	0x180e
+	.quad	.LBI187
+	.value	.LVU587
+	.quad	.LBB187
+	.quad	.LBE187-.LBB187
+	.byte	0x25
+	.long	0xaf3
+	.uleb128 0x1
+	.long	0x181f
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST111
+	.long	.LVUS111
+	.byte	0
+	.uleb128 0x5
+	.long	0x1836
+	.quad	.LBI189
+	.value	.LVU597
+	.quad	.LBB189
+	.quad	.LBE189-.LBB189
+	.byte	0x2c
+	.long	0xb32
+	.uleb128 0x1
+	.long	0x1843
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x1
+	.long	0x184e
+	.long	.LLST113
+	.long	.LVUS113
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL196
+	.long	0x45a
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LVL200
+	.long	0xb54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LVL201
+	.long	0xb68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL205
+	.long	0x1710
+	.uleb128 0x2b
+	.quad	.LVL210
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2b
+	.quad	.LVL212
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x20
+	.quad	.LVL218
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL146
+	.long	0x4c0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xea
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xc1
+	.uleb128 0x9
+	.long	0x35
+	.uleb128 0x14
+	.long	0xbc
+	.long	0xbfd
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x7
+	.byte	0
+	.uleb128 0x13
+	.long	0xbed
+	.uleb128 0x9
+	.long	0x247
+	.uleb128 0x21
+	.long	.LASF103
+	.byte	0x1
+	.byte	0xce
+	.byte	0x11
+	.long	0x208
+	.byte	0x1
+	.long	0xc5f
+	.uleb128 0x2c
+	.string	"op"
+	.byte	0xce
+	.byte	0x2b
+	.long	0xc02
+	.uleb128 0x2c
+	.string	"c"
+	.byte	0xce
+	.byte	0x33
+	.long	0x4d
+	.uleb128 0xb
+	.string	"qi"
+	.byte	0x1
+	.byte	0xde
+	.byte	0xe
+	.long	0x208
+	.uleb128 0x40
+	.long	0xc46
+	.uleb128 0xb
+	.string	"k"
+	.byte	0x1
+	.byte	0xd2
+	.byte	0x12
+	.long	0x4d
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x1
+	.byte	0xda
+	.byte	0x15
+	.long	0x35
+	.uleb128 0x2d
+	.uleb128 0xb
+	.string	"k"
+	.byte	0x1
+	.byte	0xdb
+	.byte	0x16
+	.long	0x4d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF84
+	.byte	0xad
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcae
+	.uleb128 0x6
+	.string	"q"
+	.byte	0xad
+	.byte	0x22
+	.long	0x208
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x3
+	.quad	.LVL37
+	.long	0x1710
+	.uleb128 0x7
+	.quad	.LVL38
+	.long	0x494
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF85
+	.byte	0xa8
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcfb
+	.uleb128 0x6
+	.string	"q"
+	.byte	0xa8
+	.byte	0x22
+	.long	0x208
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x7
+	.quad	.LVL24
+	.long	0x42a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF86
+	.byte	0xa6
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd24
+	.uleb128 0x41
+	.string	"q"
+	.byte	0x1
+	.byte	0xa6
+	.byte	0x20
+	.long	0x208
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF87
+	.byte	0xa0
+	.long	0x208
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd7b
+	.uleb128 0x6
+	.string	"q"
+	.byte	0xa0
+	.byte	0x27
+	.long	0x208
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x6
+	.string	"s"
+	.byte	0xa0
+	.byte	0x30
+	.long	0xb0
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x7
+	.quad	.LVL13
+	.long	0x449
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF88
+	.byte	0x9a
+	.long	0x208
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdd3
+	.uleb128 0x6
+	.string	"q"
+	.byte	0x9a
+	.byte	0x24
+	.long	0x208
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x6
+	.string	"s"
+	.byte	0x9a
+	.byte	0x2d
+	.long	0xb0
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x7
+	.quad	.LVL2
+	.long	0x51a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF89
+	.byte	0x94
+	.long	0x208
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe34
+	.uleb128 0x6
+	.string	"q"
+	.byte	0x94
+	.byte	0x31
+	.long	0x208
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x6
+	.string	"s"
+	.byte	0x94
+	.byte	0x3a
+	.long	0xb0
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x7
+	.quad	.LVL17
+	.long	0x42a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF90
+	.byte	0x8e
+	.long	0x208
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe9d
+	.uleb128 0x6
+	.string	"q"
+	.byte	0x8e
+	.byte	0x2b
+	.long	0x208
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x6
+	.string	"s"
+	.byte	0x8e
+	.byte	0x34
+	.long	0xb0
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x7
+	.quad	.LVL21
+	.long	0x42a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	remove_buf
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF91
+	.byte	0x88
+	.long	0x208
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xefb
+	.uleb128 0x6
+	.string	"q"
+	.byte	0x88
+	.byte	0x2b
+	.long	0x208
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x6
+	.string	"s"
+	.byte	0x88
+	.byte	0x34
+	.long	0xb0
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x7
+	.quad	.LVL4
+	.long	0x494
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF92
+	.byte	0x82
+	.long	0x208
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf52
+	.uleb128 0x6
+	.string	"q"
+	.byte	0x82
+	.byte	0x24
+	.long	0x208
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x6
+	.string	"s"
+	.byte	0x82
+	.byte	0x2d
+	.long	0xb0
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x7
+	.quad	.LVL10
+	.long	0x465
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF93
+	.byte	0x7c
+	.long	0x208
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfb0
+	.uleb128 0x6
+	.string	"q"
+	.byte	0x7c
+	.byte	0x2b
+	.long	0x208
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x6
+	.string	"s"
+	.byte	0x7c
+	.byte	0x34
+	.long	0xb0
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x7
+	.quad	.LVL7
+	.long	0x47a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF94
+	.byte	0x74
+	.long	0x208
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x104a
+	.uleb128 0xa
+	.long	.LASF95
+	.byte	0x74
+	.byte	0x24
+	.long	0x35
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xc
+	.string	"q"
+	.byte	0x76
+	.byte	0xe
+	.long	0x208
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x10
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.long	0x103c
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x77
+	.byte	0x11
+	.long	0x35
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x3
+	.quad	.LVL44
+	.long	0x1710
+	.uleb128 0x7
+	.quad	.LVL45
+	.long	0x494
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL41
+	.long	0x4ae
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF97
+	.byte	0x4d
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x161c
+	.uleb128 0xa
+	.long	.LASF76
+	.byte	0x4d
+	.byte	0x1b
+	.long	0xbe3
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0xa
+	.long	.LASF77
+	.byte	0x4e
+	.byte	0x1b
+	.long	0xbe3
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0xa
+	.long	.LASF79
+	.byte	0x4f
+	.byte	0x1b
+	.long	0x502
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xa
+	.long	.LASF81
+	.byte	0x50
+	.byte	0x16
+	.long	0x4d
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x27
+	.long	.LASF98
+	.long	0x162c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.uleb128 0x10
+	.quad	.LBB52
+	.quad	.LBE52-.LBB52
+	.long	0x1367
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x1
+	.byte	0x54
+	.byte	0x15
+	.long	0x35
+	.uleb128 0x1d
+	.long	.LLRL29
+	.uleb128 0xc
+	.string	"s"
+	.byte	0x55
+	.byte	0x13
+	.long	0xb0
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x10
+	.quad	.LBB72
+	.quad	.LBE72-.LBB72
+	.long	0x113b
+	.uleb128 0xc
+	.string	"j"
+	.byte	0x57
+	.byte	0xd
+	.long	0x4d
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x3
+	.quad	.LVL88
+	.long	0x1710
+	.uleb128 0x3
+	.quad	.LVL89
+	.long	0x494
+	.byte	0
+	.uleb128 0x10
+	.quad	.LBB74
+	.quad	.LBE74-.LBB74
+	.long	0x1176
+	.uleb128 0xc
+	.string	"j"
+	.byte	0x5b
+	.byte	0xd
+	.long	0x4d
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x7
+	.quad	.LVL95
+	.long	0x47a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x17d9
+	.quad	.LBI54
+	.value	.LVU198
+	.long	.LLRL31
+	.byte	0x5a
+	.byte	0x1f
+	.long	0x125a
+	.uleb128 0x5
+	.long	0x17e6
+	.quad	.LBI56
+	.value	.LVU150
+	.quad	.LBB56
+	.quad	.LBE56-.LBB56
+	.byte	0x27
+	.long	0x11ce
+	.uleb128 0x1
+	.long	0x17f7
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1
+	.long	0x1802
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x5
+	.long	0x1836
+	.quad	.LBI58
+	.value	.LVU160
+	.quad	.LBB58
+	.quad	.LBE58-.LBB58
+	.byte	0x2c
+	.long	0x120d
+	.uleb128 0x1
+	.long	0x1843
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1
+	.long	0x184e
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0x5
+	.long	0x180e
+	.quad	.LBI60
+	.value	.LVU202
+	.quad	.LBB60
+	.quad	.LBE60-.LBB60
+	.byte	0x25
+	.long	0x124c
+	.uleb128 0x1
+	.long	0x181f
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST37
+	.long	.LVUS37
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL68
+	.long	0x45a
+	.byte	0
+	.uleb128 0x15
+	.long	0x17d9
+	.quad	.LBI63
+	.value	.LVU220
+	.long	.LLRL38
+	.byte	0x5c
+	.byte	0x1e
+	.long	0x133e
+	.uleb128 0x5
+	.long	0x17e6
+	.quad	.LBI65
+	.value	.LVU174
+	.quad	.LBB65
+	.quad	.LBE65-.LBB65
+	.byte	0x27
+	.long	0x12b2
+	.uleb128 0x1
+	.long	0x17f7
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	0x1802
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.uleb128 0x5
+	.long	0x180e
+	.quad	.LBI67
+	.value	.LVU223
+	.quad	.LBB67
+	.quad	.LBE67-.LBB67
+	.byte	0x25
+	.long	0x12f1
+	.uleb128 0x1
+	.long	0x181f
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0x5
+	.long	0x1836
+	.quad	.LBI69
+	.value	.LVU233
+	.quad	.LBB69
+	.quad	.LBE69-.LBB69
+	.byte	0x2c
+	.long	0x1330
+	.uleb128 0x1
+	.long	0x1843
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x1
+	.long	0x184e
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL76
+	.long	0x45a
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL80
+	.long	0x51a
+	.uleb128 0x3
+	.quad	.LVL82
+	.long	0x1710
+	.uleb128 0x3
+	.quad	.LVL85
+	.long	0x4ae
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LBB77
+	.quad	.LBE77-.LBB77
+	.long	0x15e0
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x1
+	.byte	0x60
+	.byte	0x15
+	.long	0x35
+	.uleb128 0x10
+	.quad	.LBB96
+	.quad	.LBE96-.LBB96
+	.long	0x13c7
+	.uleb128 0xc
+	.string	"j"
+	.byte	0x62
+	.byte	0xd
+	.long	0x4d
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x3
+	.quad	.LVL121
+	.long	0x1710
+	.uleb128 0x3
+	.quad	.LVL122
+	.long	0x494
+	.byte	0
+	.uleb128 0x10
+	.quad	.LBB98
+	.quad	.LBE98-.LBB98
+	.long	0x13fd
+	.uleb128 0x1e
+	.long	.LASF99
+	.byte	0x66
+	.byte	0xd
+	.long	0x4d
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x3
+	.quad	.LVL128
+	.long	0x465
+	.byte	0
+	.uleb128 0x15
+	.long	0x17d9
+	.quad	.LBI78
+	.value	.LVU292
+	.long	.LLRL47
+	.byte	0x65
+	.byte	0x1f
+	.long	0x14e1
+	.uleb128 0x5
+	.long	0x17e6
+	.quad	.LBI80
+	.value	.LVU247
+	.quad	.LBB80
+	.quad	.LBE80-.LBB80
+	.byte	0x27
+	.long	0x1455
+	.uleb128 0x1
+	.long	0x17f7
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1
+	.long	0x1802
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.uleb128 0x5
+	.long	0x1836
+	.quad	.LBI82
+	.value	.LVU257
+	.quad	.LBB82
+	.quad	.LBE82-.LBB82
+	.byte	0x2c
+	.long	0x1494
+	.uleb128 0x1
+	.long	0x1843
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x1
+	.long	0x184e
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0x5
+	.long	0x180e
+	.quad	.LBI84
+	.value	.LVU296
+	.quad	.LBB84
+	.quad	.LBE84-.LBB84
+	.byte	0x25
+	.long	0x14d3
+	.uleb128 0x1
+	.long	0x181f
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL104
+	.long	0x45a
+	.byte	0
+	.uleb128 0x15
+	.long	0x17d9
+	.quad	.LBI87
+	.value	.LVU315
+	.long	.LLRL54
+	.byte	0x67
+	.byte	0x1e
+	.long	0x15c5
+	.uleb128 0x5
+	.long	0x17e6
+	.quad	.LBI89
+	.value	.LVU271
+	.quad	.LBB89
+	.quad	.LBE89-.LBB89
+	.byte	0x27
+	.long	0x1539
+	.uleb128 0x1
+	.long	0x17f7
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x1
+	.long	0x1802
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.uleb128 0x5
+	.long	0x180e
+	.quad	.LBI91
+	.value	.LVU318
+	.quad	.LBB91
+	.quad	.LBE91-.LBB91
+	.byte	0x25
+	.long	0x1578
+	.uleb128 0x1
+	.long	0x181f
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST58
+	.long	.LVUS58
+	.byte	0
+	.uleb128 0x5
+	.long	0x1836
+	.quad	.LBI93
+	.value	.LVU328
+	.quad	.LBB93
+	.quad	.LBE93-.LBB93
+	.byte	0x2c
+	.long	0x15b7
+	.uleb128 0x1
+	.long	0x1843
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x1
+	.long	0x184e
+	.long	.LLST60
+	.long	.LVUS60
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL112
+	.long	0x45a
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL116
+	.long	0x51a
+	.uleb128 0x3
+	.quad	.LVL118
+	.long	0x4ae
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL67
+	.long	0x4c0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x52
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0xbc
+	.long	0x162c
+	.uleb128 0x11
+	.long	0x46
+	.byte	0xb
+	.byte	0
+	.uleb128 0x13
+	.long	0x161c
+	.uleb128 0x17
+	.long	.LASF100
+	.byte	0x3e
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1710
+	.uleb128 0xa
+	.long	.LASF79
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x502
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xa
+	.long	.LASF80
+	.byte	0x3e
+	.byte	0x33
+	.long	0x502
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x10
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.long	0x16a7
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x41
+	.byte	0x11
+	.long	0x35
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x3
+	.quad	.LVL56
+	.long	0x4e1
+	.byte	0
+	.uleb128 0x10
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.long	0x16ce
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x49
+	.byte	0x11
+	.long	0x35
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL52
+	.long	0x4ec
+	.long	0x16ed
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x960
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL57
+	.long	0x4ec
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	random_string
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4b0
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF107
+	.byte	0x1
+	.byte	0x38
+	.byte	0x7
+	.long	0xb0
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x17
+	.long	.LASF101
+	.byte	0x2d
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17af
+	.uleb128 0x43
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0xc
+	.string	"c"
+	.byte	0x2f
+	.byte	0xe
+	.long	0x4d
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x10
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.long	0x17a0
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x30
+	.byte	0x15
+	.long	0x35
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x3
+	.quad	.LVL28
+	.long	0x51a
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL31
+	.long	0x507
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF102
+	.byte	0x27
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17d9
+	.uleb128 0x3
+	.quad	.LVL35
+	.long	0x172e
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF108
+	.byte	0x2
+	.byte	0x21
+	.byte	0x17
+	.long	0xc1
+	.byte	0x3
+	.uleb128 0x21
+	.long	.LASF104
+	.byte	0x3
+	.byte	0x20
+	.byte	0x17
+	.long	0xc1
+	.byte	0x3
+	.long	0x180e
+	.uleb128 0xb
+	.string	"hi"
+	.byte	0x3
+	.byte	0x23
+	.byte	0x12
+	.long	0x75
+	.uleb128 0xb
+	.string	"lo"
+	.byte	0x3
+	.byte	0x23
+	.byte	0x16
+	.long	0x75
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF105
+	.byte	0x3
+	.byte	0x13
+	.byte	0x17
+	.long	0xc1
+	.byte	0x3
+	.long	0x1836
+	.uleb128 0xb
+	.string	"hi"
+	.byte	0x3
+	.byte	0x16
+	.byte	0x12
+	.long	0x75
+	.uleb128 0xb
+	.string	"lo"
+	.byte	0x3
+	.byte	0x16
+	.byte	0x16
+	.long	0x75
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF109
+	.byte	0x3
+	.byte	0x6
+	.byte	0x17
+	.long	0xc1
+	.byte	0x3
+	.uleb128 0xb
+	.string	"hi"
+	.byte	0x3
+	.byte	0x9
+	.byte	0x12
+	.long	0x75
+	.uleb128 0xb
+	.string	"lo"
+	.byte	0x3
+	.byte	0x9
+	.byte	0x16
+	.long	0x75
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS63:
+	.uleb128 0
+	.uleb128 .LVU354
+	.uleb128 .LVU354
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS64:
+	.uleb128 0
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 0
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+.LVUS65:
+	.uleb128 0
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU352
+	.uleb128 .LVU352
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 0
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU355
+	.uleb128 .LVU355
+	.uleb128 .LVU355
+	.uleb128 .LVU355
+	.uleb128 .LVU609
+	.uleb128 .LVU609
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU355
+	.uleb128 .LVU355
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU355
+	.uleb128 .LVU361
+	.uleb128 .LVU400
+	.uleb128 .LVU429
+	.uleb128 .LVU429
+	.uleb128 .LVU444
+	.uleb128 .LVU444
+	.uleb128 .LVU446
+	.uleb128 .LVU494
+	.uleb128 .LVU536
+	.uleb128 .LVU538
+	.uleb128 .LVU608
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU540
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 .LVU554
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU355
+	.uleb128 .LVU539
+	.uleb128 .LVU548
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 0
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU551
+	.uleb128 .LVU554
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU494
+	.uleb128 .LVU536
+	.uleb128 .LVU563
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU606
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL212-1-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU494
+	.uleb128 .LVU536
+	.uleb128 .LVU566
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU582
+	.uleb128 .LVU582
+	.uleb128 .LVU585
+	.uleb128 .LVU585
+	.uleb128 .LVU606
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU370
+	.uleb128 .LVU400
+	.uleb128 .LVU446
+	.uleb128 .LVU494
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU357
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU370
+	.uleb128 .LVU400
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 .LVU446
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU365
+	.uleb128 .LVU370
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU403
+	.uleb128 .LVU412
+	.uleb128 .LVU412
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU444
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU426
+	.uleb128 .LVU429
+	.uleb128 .LVU429
+	.uleb128 .LVU444
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU429
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 .LVU441
+	.uleb128 .LVU441
+	.uleb128 .LVU444
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU378
+	.uleb128 .LVU380
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU378
+	.uleb128 .LVU382
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU454
+	.uleb128 .LVU456
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU454
+	.uleb128 .LVU458
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU464
+	.uleb128 .LVU466
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU464
+	.uleb128 .LVU468
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU392
+	.uleb128 .LVU394
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU392
+	.uleb128 .LVU396
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU478
+	.uleb128 .LVU480
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU478
+	.uleb128 .LVU482
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU488
+	.uleb128 .LVU490
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU488
+	.uleb128 .LVU492
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU502
+	.uleb128 .LVU504
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU502
+	.uleb128 .LVU506
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU512
+	.uleb128 .LVU514
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU512
+	.uleb128 .LVU516
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU574
+	.uleb128 .LVU576
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU574
+	.uleb128 .LVU578
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU526
+	.uleb128 .LVU528
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU526
+	.uleb128 .LVU530
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU590
+	.uleb128 .LVU592
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU590
+	.uleb128 .LVU594
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU600
+	.uleb128 .LVU602
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU600
+	.uleb128 .LVU604
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU94
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU96
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU101
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU340
+	.uleb128 .LVU340
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU146
+	.uleb128 .LVU186
+	.uleb128 .LVU188
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU242
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU146
+	.uleb128 .LVU186
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU242
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU169
+	.uleb128 .LVU186
+	.uleb128 .LVU213
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU242
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU153
+	.uleb128 .LVU155
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU153
+	.uleb128 .LVU157
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU163
+	.uleb128 .LVU167
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU205
+	.uleb128 .LVU207
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU205
+	.uleb128 .LVU209
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU177
+	.uleb128 .LVU179
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU177
+	.uleb128 .LVU181
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU226
+	.uleb128 .LVU228
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU226
+	.uleb128 .LVU230
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU236
+	.uleb128 .LVU238
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU236
+	.uleb128 .LVU240
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU243
+	.uleb128 .LVU283
+	.uleb128 .LVU286
+	.uleb128 .LVU287
+	.uleb128 .LVU287
+	.uleb128 .LVU337
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU266
+	.uleb128 .LVU283
+	.uleb128 .LVU308
+	.uleb128 .LVU311
+	.uleb128 .LVU311
+	.uleb128 .LVU337
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU250
+	.uleb128 .LVU252
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU250
+	.uleb128 .LVU254
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU260
+	.uleb128 .LVU262
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU260
+	.uleb128 .LVU264
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU299
+	.uleb128 .LVU301
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU299
+	.uleb128 .LVU303
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU274
+	.uleb128 .LVU276
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU274
+	.uleb128 .LVU278
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU321
+	.uleb128 .LVU323
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU321
+	.uleb128 .LVU325
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU331
+	.uleb128 .LVU333
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU331
+	.uleb128 .LVU335
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL52-1-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU111
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU133
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU127
+	.uleb128 .LVU128
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU52
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU69
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0xf
+	.byte	0x76
+	.sleb128 0
+	.byte	0x3
+	.quad	pool
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x11
+	.byte	0x76
+	.sleb128 0
+	.byte	0x3
+	.quad	pool
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x11
+	.byte	0x76
+	.sleb128 0
+	.byte	0x3
+	.quad	pool+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU53
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU59
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL47:
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0
+.LLRL69:
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB196-.Ltext0
+	.uleb128 .LBE196-.Ltext0
+	.byte	0
+.LLRL71:
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB194-.Ltext0
+	.uleb128 .LBE194-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB195-.Ltext0
+	.uleb128 .LBE195-.Ltext0
+	.byte	0
+.LLRL77:
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB173-.Ltext0
+	.uleb128 .LBE173-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0
+.LLRL82:
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0
+.LLRL86:
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0
+.LLRL93:
+	.byte	0x4
+	.uleb128 .LBB161-.Ltext0
+	.uleb128 .LBE161-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0
+.LLRL100:
+	.byte	0x4
+	.uleb128 .LBB174-.Ltext0
+	.uleb128 .LBE174-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB192-.Ltext0
+	.uleb128 .LBE192-.Ltext0
+	.byte	0
+.LLRL107:
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB193-.Ltext0
+	.uleb128 .LBE193-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF35:
+	.string	"linear"
+.LASF66:
+	.string	"q_insert_tail"
+.LASF12:
+	.string	"short int"
+.LASF10:
+	.string	"size_t"
+.LASF51:
+	.string	"timer_active"
+.LASF73:
+	.string	"randombytes"
+.LASF26:
+	.string	"test_insert_tail"
+.LASF76:
+	.string	"before_ticks"
+.LASF106:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF98:
+	.string	"__PRETTY_FUNCTION__"
+.LASF95:
+	.string	"length"
+.LASF86:
+	.string	"undo_none"
+.LASF4:
+	.string	"long long int"
+.LASF41:
+	.string	"dut_op_t"
+.LASF85:
+	.string	"undo_insert"
+.LASF13:
+	.string	"__uint16_t"
+.LASF81:
+	.string	"mode"
+.LASF16:
+	.string	"int64_t"
+.LASF19:
+	.string	"value"
+.LASF22:
+	.string	"head"
+.LASF17:
+	.string	"uint8_t"
+.LASF84:
+	.string	"undo_remove"
+.LASF57:
+	.string	"dudect_pool"
+.LASF32:
+	.string	"test_reverse"
+.LASF74:
+	.string	"free"
+.LASF54:
+	.string	"drop_size"
+.LASF88:
+	.string	"call_free"
+.LASF101:
+	.string	"release_dut"
+.LASF92:
+	.string	"call_size"
+.LASF36:
+	.string	"setup"
+.LASF97:
+	.string	"measure_old"
+.LASF87:
+	.string	"call_reverse"
+.LASF42:
+	.string	"long long unsigned int"
+.LASF67:
+	.string	"q_insert_head"
+.LASF37:
+	.string	"call"
+.LASF2:
+	.string	"long int"
+.LASF75:
+	.string	"q_free"
+.LASF79:
+	.string	"input_data"
+.LASF60:
+	.string	"pool_next"
+.LASF11:
+	.string	"__uint8_t"
+.LASF90:
+	.string	"call_remove_head"
+.LASF38:
+	.string	"teardown"
+.LASF34:
+	.string	"name"
+.LASF68:
+	.string	"q_reverse"
+.LASF49:
+	.string	"TIMER_PERF_INSTRUCTIONS"
+.LASF71:
+	.string	"perf_read"
+.LASF23:
+	.string	"tail"
+.LASF109:
+	.string	"cpucycles"
+.LASF78:
+	.string	"lengths"
+.LASF96:
+	.string	"measure"
+.LASF6:
+	.string	"unsigned char"
+.LASF94:
+	.string	"setup_queue"
+.LASF104:
+	.string	"cpucycles_rdtscp"
+.LASF52:
+	.string	"chunk_size"
+.LASF9:
+	.string	"signed char"
+.LASF27:
+	.string	"test_size"
+.LASF33:
+	.string	"test_count"
+.LASF8:
+	.string	"unsigned int"
+.LASF18:
+	.string	"uint16_t"
+.LASF28:
+	.string	"test_insert_head"
+.LASF56:
+	.string	"random_string_iter"
+.LASF44:
+	.string	"old_measure"
+.LASF7:
+	.string	"short unsigned int"
+.LASF30:
+	.string	"test_remove_head_quiet"
+.LASF89:
+	.string	"call_remove_head_quiet"
+.LASF93:
+	.string	"call_insert_tail"
+.LASF15:
+	.string	"char"
+.LASF102:
+	.string	"init_dut"
+.LASF62:
+	.string	"exit"
+.LASF63:
+	.string	"calloc"
+.LASF40:
+	.string	"_Bool"
+.LASF64:
+	.string	"q_remove_head"
+.LASF59:
+	.string	"pool_size"
+.LASF24:
+	.string	"size"
+.LASF48:
+	.string	"TIMER_PERF_CYCLES"
+.LASF39:
+	.string	"undo"
+.LASF21:
+	.string	"list_ele_t"
+.LASF53:
+	.string	"number_measurements"
+.LASF105:
+	.string	"cpucycles_lfence"
+.LASF3:
+	.string	"long unsigned int"
+.LASF45:
+	.string	"TIMER_RDTSC"
+.LASF108:
+	.string	"timer_read"
+.LASF77:
+	.string	"after_ticks"
+.LASF47:
+	.string	"TIMER_RDTSCP"
+.LASF46:
+	.string	"TIMER_LFENCE"
+.LASF107:
+	.string	"get_random_string"
+.LASF83:
+	.string	"other"
+.LASF29:
+	.string	"test_remove_head"
+.LASF5:
+	.string	"long double"
+.LASF61:
+	.string	"remove_buf"
+.LASF72:
+	.string	"randombit"
+.LASF103:
+	.string	"pool_take"
+.LASF25:
+	.string	"queue_t"
+.LASF91:
+	.string	"call_insert_head"
+.LASF43:
+	.string	"dut_ops"
+.LASF100:
+	.string	"prepare_inputs"
+.LASF58:
+	.string	"pool"
+.LASF80:
+	.string	"classes"
+.LASF14:
+	.string	"__int64_t"
+.LASF31:
+	.string	"test_free_queue"
+.LASF70:
+	.string	"__assert_fail"
+.LASF82:
+	.string	"base"
+.LASF55:
+	.string	"random_string"
+.LASF50:
+	.string	"TIMER_COUNT"
+.LASF99:
+	.string	"__iter"
+.LASF65:
+	.string	"q_size"
+.LASF20:
+	.string	"next"
+.LASF69:
+	.string	"q_new"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"dudect/constant.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
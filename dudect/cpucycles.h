@@ -1,3 +1,6 @@
+#ifndef DUDECT_CPUCYCLES_H
+#define DUDECT_CPUCYCLES_H
+
 #include <stdint.h>
 // http://www.intel.com/content/www/us/en/embedded/training/ia-32-ia-64-benchmark-code-execution-paper.html
 static inline int64_t cpucycles(void)
@@ -10,3 +13,32 @@ static inline int64_t cpucycles(void)
 #error Unsupported Architecture
 #endif
 }
+
+// rdtsc fenced on both sides, so that the measured code can neither start
+// before nor finish after the counter is read.
+static inline int64_t cpucycles_lfence(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    unsigned int hi, lo;
+    __asm__ volatile("lfence\n\trdtsc\n\tlfence\n\t"
+                     : "=a"(lo), "=d"(hi)::"memory");
+    return ((int64_t) lo) | (((int64_t) hi) << 32);
+#else
+#error Unsupported Architecture
+#endif
+}
+
+// rdtscp waits for earlier instructions; the lfence holds back later ones.
+static inline int64_t cpucycles_rdtscp(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    unsigned int hi, lo;
+    __asm__ volatile("rdtscp\n\tlfence\n\t"
+                     : "=a"(lo), "=d"(hi)::"ecx", "memory");
+    return ((int64_t) lo) | (((int64_t) hi) << 32);
+#else
+#error Unsupported Architecture
+#endif
+}
+
+#endif
@@ -27,19 +27,30 @@
  *
  */
 
+#define _GNU_SOURCE
 #include "fixture.h"
 #include <math.h>
+#include <sched.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
 #include "../console.h"
 #include "cpucycles.h"
+#include "measfile.h"
 #include "percentile.h"
 #include "random.h"
+#include "timer.h"
 #include "ttest.h"
 
 extern int total_measurements;
+extern int crop_window;
+extern int dudect_workers;
+extern int dudect_sequential;
+extern void report_flush();
 #define enough_measurements 10000
 #define number_tests                                                    \
     (1 /* first order uncropped */ + number_percentiles /* cropped */ + \
@@ -48,6 +59,14 @@ extern int total_measurements;
 
 static t_ctx *t[number_tests];
 static int64_t percentiles[number_percentiles] = {0};
+static double crop_fractions[number_percentiles];
+static pwindow_t crop_samples;
+/*
+ * Running means the second-order test is centered on.  Kept apart from
+ * t[0] because worker processes start t[0] empty, but should center on
+ * every sample taken so far.
+ */
+static t_ctx center;
 extern const int drop_size;
 extern const size_t chunk_size;
 extern const size_t number_measurements;
@@ -57,20 +76,42 @@ extern const size_t number_measurements;
 #define t_threshold_moderate \
     10  // test failed. Pankaj likes 4.5 but let's be more lenient
 
+/*
+ * Sequential testing stops once max t exceeds t_threshold_moderate by
+ * t_margin, or once max t plus t_margin, projected to all batches, stays
+ * below t_threshold_moderate.  A t statistic grows with the square root of
+ * the number of measurements, and has standard deviation 1.
+ */
+#define t_margin 3
+#define sequential_min_n 1000
+
 static void __attribute__((noreturn)) die(void)
 {
     exit(111);
 }
 
-// fill percentiles.
 // the exponential tendency is mean to approximately match
 // the measurements distribution.
-static void prepare_percentiles(int64_t *ticks)
+static void init_crop_fractions(void)
 {
     for (size_t i = 0; i < number_percentiles; i++) {
-        percentiles[i] = percentile(
-            ticks, 1 - (pow(0.5, 10 * (double) (i + 1) / number_percentiles)),
-            number_measurements);
+        crop_fractions[i] =
+            1 - (pow(0.5, 10 * (double) (i + 1) / number_percentiles));
+    }
+}
+
+// fill percentiles, from the first batch or from the last crop_window
+// batches.
+static void prepare_percentiles(int64_t *ticks)
+{
+    if (crop_samples.capacity) {
+        pwindow_push(&crop_samples, ticks + drop_size,
+                     number_measurements - 2 * drop_size);
+        pwindow_percentiles(&crop_samples, crop_fractions, number_percentiles,
+                            percentiles);
+    } else if (percentiles[number_percentiles - 1] == 0) {
+        compute_percentiles(ticks, number_measurements, crop_fractions,
+                            number_percentiles, percentiles);
     }
 }
 
@@ -83,6 +124,39 @@ static void differentiate(int64_t *exec_times,
     }
 }
 
+/*
+ * Cropped tests for one batch.  A measurement below percentiles[k] but not
+ * below percentiles[k - 1] belongs to the cropped tests k .. and up, so it
+ * is pushed to bucket k only.  fold_crop_buckets then adds buckets 0 .. k
+ * to cropped test k.
+ */
+static t_ctx crop_bucket[number_percentiles];
+
+/* Index of first percentile above x, number_percentiles if none */
+static size_t crop_index(int64_t x)
+{
+    size_t lo = 0, hi = number_percentiles;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (percentiles[mid] > x)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+static void fold_crop_buckets(void)
+{
+    t_ctx below;
+    t_init(&below);
+    for (size_t i = 0; i < number_percentiles; i++) {
+        t_merge(&below, &crop_bucket[i]);
+        t_merge(t[i + 1], &below);
+        t_init(&crop_bucket[i]);
+    }
+}
+
 static void update_statistics(int64_t *exec_times, uint8_t *classes)
 {
     for (size_t i = drop_size; i < number_measurements - drop_size; i++) {
@@ -97,30 +171,29 @@ static void update_statistics(int64_t *exec_times, uint8_t *classes)
 
         // do a t-test on cropped execution times, for several cropping
         // thresholds.
-        for (size_t crop_index = 0; crop_index < number_percentiles;
-             crop_index++) {
-            if (difference < percentiles[crop_index]) {
-                t_push(t[crop_index + 1], difference, classes[i]);
-            }
-        }
+        size_t k = crop_index(difference);
+        if (k < number_percentiles)
+            t_push(&crop_bucket[k], difference, classes[i]);
 
         // do a second-order test (only if we have more than 10000
         // measurements). Centered product pre-processing.
-        if (t[0]->n[0] > 10000) {
-            double centered = (double) difference - t[0]->mean[classes[i]];
+        t_push(&center, difference, classes[i]);
+        if (center.n[0] > 10000) {
+            double centered = (double) difference - center.mean[classes[i]];
             t_push(t[1 + number_percentiles], centered * centered, classes[i]);
         }
     }
+    fold_crop_buckets();
 }
 
 // which t-test yields max t value?
-static int max_test(void)
+static int max_test(t_ctx **tests, double min_n)
 {
     int ret = 0;
     double max = 0;
     for (size_t i = 0; i < number_tests; i++) {
-        if (t[i]->n[0] > enough_measurements) {
-            double x = fabs(t_compute(t[i]));
+        if (tests[i]->n[0] > min_n) {
+            double x = fabs(t_compute(tests[i]));
             if (max < x) {
                 max = x;
                 ret = i;
@@ -130,14 +203,20 @@ static int max_test(void)
     return ret;
 }
 
+static const_result_t last_result;
+
 static bool report(void)
 {
-    int mt = max_test();
+    int mt = max_test(t, enough_measurements);
     t_ctx *tt = t[mt];
     double max_t = fabs(t_compute(t[mt]));
     double number_traces_max_t = t[mt]->n[0] + t[mt]->n[1];
     double max_tau = max_t / sqrt(number_traces_max_t);
 
+    last_result.test = mt;
+    last_result.max_t = max_t;
+    last_result.measurements = number_traces_max_t;
+
     printf("\033[A\033[2K\033[A\033[2K");
     printf("meas: %7.2lf M, ", (number_traces_max_t / 1e6));
     if (number_traces_max_t < enough_measurements) {
@@ -165,7 +244,7 @@ static bool report(void)
         "s0: %.2e, s1: %.2e, m20: %.2e, m21: %.2e.\n",
         mt, max_t, max_tau, (double) (5 * 5) / (double) (max_tau * max_tau),
         tt->mean[0], tt->mean[1], tt->mean[1] - tt->mean[0],
-        sqrt(tt->m2[0] / (tt->n[0] - 1)), sqrt(tt->m2[0] / (tt->n[0] - 1)),
+        sqrt(tt->m2[0] / (tt->n[0] - 1)), sqrt(tt->m2[1] / (tt->n[1] - 1)),
         tt->m2[0], tt->m2[1]);
 
     if (max_t > t_threshold_bananas) {
@@ -177,54 +256,95 @@ static bool report(void)
     }
 }
 
-void write_times(int64_t *exec_times, uint8_t *classes)
+/* Can sequential testing stop after done of batches batches? */
+static bool settled(int done, int batches)
+{
+    if (last_result.measurements < enough_measurements)
+        return false;
+    if (last_result.max_t > t_threshold_moderate + t_margin)
+        return true;
+    /*
+     * Tests cropped at low percentiles do not count towards max t yet, but
+     * may by the last batch.  Bound them all.
+     */
+    double max_t = fabs(t_compute(t[max_test(t, sequential_min_n)]));
+    double bound = (max_t + t_margin) * sqrt((double) batches / done);
+    return bound < t_threshold_moderate;
+}
+
+/*
+ * Linear operations are checked by comparing the time per element on
+ * queues of length n (class 0) and 2n (class 1).  Times are scaled by
+ * element_scale to keep precision.
+ */
+#define linear_measurements 3000
+#define linear_threshold 1.5
+#define linear_min_ratio 0.7
+#define element_scale 256
+
+static int64_t *element_ticks[2];
+static size_t element_cnt[2];
+
+static void record_elements(int64_t *exec_times,
+                            uint8_t *classes,
+                            size_t *lengths)
 {
-    static FILE *f = NULL;
-    if (!f)
-        f = fopen("./meas.txt", "w");
-    for (int i = drop_size; i < number_measurements - drop_size; ++i) {
-        fprintf(f, "%d %ld\n", classes[i], exec_times[i]);
+    for (size_t i = drop_size; i < number_measurements - drop_size; i++) {
+        if (exec_times[i] < 0 || lengths[i] == 0)
+            continue;
+        int c = classes[i];
+        element_ticks[c][element_cnt[c]++] =
+            exec_times[i] * element_scale / (int64_t) lengths[i];
     }
 }
 
-static bool doit(int mode)
+/* Measure one batch and add it to the statistics in t */
+static void measure_batch(int mode)
 {
     int64_t *before_ticks = calloc(number_measurements + 1, sizeof(int64_t));
     int64_t *after_ticks = calloc(number_measurements + 1, sizeof(int64_t));
     int64_t *exec_times = calloc(number_measurements, sizeof(int64_t));
+    size_t *lengths = calloc(number_measurements, sizeof(size_t));
     uint8_t *classes = calloc(number_measurements, sizeof(uint8_t));
     uint8_t *input_data =
         calloc(number_measurements * chunk_size, sizeof(uint8_t));
 
-    if (!before_ticks || !after_ticks || !exec_times || !classes ||
-        !input_data) {
+    if (!before_ticks || !after_ticks || !exec_times || !lengths ||
+        !classes || !input_data) {
         die();
     }
 
     prepare_inputs(input_data, classes);
 
-    if (old_measure) {
+    int timer = timer_active;
+    if (old_measure && (mode == test_insert_tail || mode == test_size)) {
         measure_old(before_ticks, after_ticks, input_data, mode);
     } else {
-        measure(before_ticks, after_ticks, input_data, classes, mode);
+        measure(before_ticks, after_ticks, lengths, input_data, classes,
+                mode);
     }
     differentiate(exec_times, before_ticks, after_ticks);
-    if (write_data) {
-        write_times(exec_times, classes);
-    }
-    // we compute the percentiles only if they are not filled yet
-    if (percentiles[number_percentiles - 1] == 0) {
-        prepare_percentiles(exec_times);
+    /* Timer fell back partway through: samples mix two backends */
+    if (timer_active != timer) {
+        printf("Dropping batch measured with two timers\n");
+    } else {
+        if (write_data)
+            meas_write(exec_times, classes, lengths, drop_size,
+                       number_measurements - drop_size);
+        if (dut_ops[mode].linear) {
+            record_elements(exec_times, classes, lengths);
+        } else {
+            prepare_percentiles(exec_times);
+            update_statistics(exec_times, classes);
+        }
     }
-    update_statistics(exec_times, classes);
-    bool ret = report();
 
     free(before_ticks);
     free(after_ticks);
     free(exec_times);
+    free(lengths);
     free(classes);
     free(input_data);
-    return ret;
 }
 
 static void init_once(void)
@@ -233,44 +353,225 @@ static void init_once(void)
     for (int i = 0; i < number_tests; ++i) {
         t_init(t[i]);
     }
+    t_init(&center);
+    init_crop_fractions();
+    memset(percentiles, 0, sizeof(percentiles));
+    pwindow_free(&crop_samples);
+    if (crop_window > 0)
+        pwindow_init(&crop_samples, (size_t) crop_window *
+                                        (number_measurements - 2 * drop_size));
 }
 
+static const_result_t worker_result[MAX_WORKERS];
+static int worker_cnt = 0;
 
-bool is_insert_tail_const(void)
+static bool read_all(int fd, void *buf, size_t len)
 {
-    bool result = false;
-    for (int i = 0; i < number_tests; ++i) {
-        t[i] = malloc(sizeof(t_ctx));
+    char *p = buf;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n <= 0)
+            return false;
+        p += n;
+        len -= n;
     }
+    return true;
+}
 
+/*
+ * Measure batches in forked worker processes, each pinned to its own CPU.
+ * The queue under test and the allocation harness are process-global, so
+ * workers are processes rather than threads.  Each worker starts from empty
+ * statistics, and the parent merges them into t.
+ */
+static bool run_workers(int mode, int batches)
+{
+    int nworkers = dudect_workers < MAX_WORKERS ? dudect_workers : MAX_WORKERS;
+    if (nworkers > batches)
+        nworkers = batches;
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpu < 1)
+        ncpu = 1;
+    pid_t pids[MAX_WORKERS];
+    int fds[MAX_WORKERS];
 
-    printf("Testing insert_tail...\n\n\n");
-    init_once();
-    for (int i = 0;
-         i < total_measurements / (number_measurements - drop_size * 2) + 1;
-         ++i)
-        result = doit(0);
-    for (int i = 0; i < number_tests; ++i) {
-        free(t[i]);
+    /* Children must not write out output the parent still holds */
+    report_flush();
+    fflush(stdout);
+    for (int w = 0; w < nworkers; w++) {
+        int pfd[2];
+        if (pipe(pfd) < 0)
+            die();
+        pids[w] = fork();
+        if (pids[w] < 0)
+            die();
+        if (pids[w] == 0) {
+            close(pfd[0]);
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(w % ncpu, &set);
+            sched_setaffinity(0, sizeof(set), &set);
+            timer_setup();
+            /* Keep cropping at the parent's thresholds, as every worker does */
+            pwindow_free(&crop_samples);
+            for (int i = 0; i < number_tests; i++)
+                t_init(t[i]);
+            for (int b = w; b < batches; b += nworkers)
+                measure_batch(mode);
+            bool ok = true;
+            for (int i = 0; i < number_tests && ok; i++)
+                ok = write(pfd[1], t[i], sizeof(t_ctx)) == sizeof(t_ctx);
+            _exit(ok ? 0 : 1);
+        }
+        close(pfd[1]);
+        fds[w] = pfd[0];
     }
-    return result;
+
+    bool ok = true;
+    t_ctx *wt[number_tests];
+    t_ctx wctx[number_tests];
+    for (int i = 0; i < number_tests; i++)
+        wt[i] = &wctx[i];
+    for (int w = 0; w < nworkers; w++) {
+        int status;
+        bool got = read_all(fds[w], wctx, sizeof(wctx));
+        close(fds[w]);
+        waitpid(pids[w], &status, 0);
+        if (!got || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            printf("Worker %d failed\n", w);
+            ok = false;
+            continue;
+        }
+        int mt = max_test(wt, enough_measurements / nworkers);
+        worker_result[w].test = mt;
+        worker_result[w].max_t = fabs(t_compute(wt[mt]));
+        worker_result[w].measurements = wt[mt]->n[0] + wt[mt]->n[1];
+        for (int i = 0; i < number_tests; i++)
+            t_merge(t[i], wt[i]);
+    }
+    worker_cnt = ok ? nworkers : 0;
+    return ok;
 }
 
-bool is_size_const(void)
+static bool test_linear(char *name, int mode)
+{
+    printf("Testing %s...\n", name);
+    if (write_data)
+        meas_open(mode);
+    for (int c = 0; c < 2; c++) {
+        element_ticks[c] =
+            calloc(linear_measurements + number_measurements, sizeof(int64_t));
+        if (!element_ticks[c])
+            die();
+        element_cnt[c] = 0;
+    }
+    while (element_cnt[0] + element_cnt[1] < linear_measurements)
+        measure_batch(mode);
+
+    double median[2] = {0, 0};
+    double half = 0.5;
+    for (int c = 0; c < 2; c++) {
+        int64_t m = 0;
+        if (element_cnt[c])
+            compute_percentiles(element_ticks[c], element_cnt[c], &half, 1,
+                                &m);
+        median[c] = (double) m / element_scale;
+        free(element_ticks[c]);
+    }
+    meas_close();
+
+    /*
+     * Linear time gives a ratio near 1, quadratic time near 2, and constant
+     * time near 0.5
+     */
+    double ratio = median[0] > 0 ? median[1] / median[0] : INFINITY;
+    printf("per element: %.2f at n, %.2f at 2n, ratio %.2f\n", median[0],
+           median[1], ratio);
+    last_result.test = -1;
+    last_result.max_t = ratio;
+    last_result.measurements = element_cnt[0] + element_cnt[1];
+    last_result.rate = 0;
+    return ratio > linear_min_ratio && ratio < linear_threshold;
+}
+
+static bool test_const(char *name, int mode)
 {
     bool result = false;
     for (int i = 0; i < number_tests; ++i) {
         t[i] = malloc(sizeof(t_ctx));
     }
 
-    printf("Testing size...\n\n\n");
+    timer_setup();
+    printf("Testing %s...\n\n\n", name);
     init_once();
-    for (int i = 0;
-         i < total_measurements / (number_measurements - drop_size * 2) + 1;
-         ++i)
-        result = doit(1);
+    if (write_data)
+        meas_open(mode);
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    worker_cnt = 0;
+    int batches =
+        total_measurements / (number_measurements - drop_size * 2) + 1;
+    if (dudect_workers > 1 && batches > 1 && !write_data) {
+        /* First batch here, so that all workers crop at the same points */
+        measure_batch(mode);
+        result = run_workers(mode, batches - 1) && report();
+        for (int w = 0; w < worker_cnt; w++)
+            printf("worker %d: max t [%d]: %+7.2f, meas: %7.2lf M\n", w,
+                   worker_result[w].test, worker_result[w].max_t,
+                   worker_result[w].measurements / 1e6);
+    } else {
+        for (int i = 0; i < batches; ++i) {
+            measure_batch(mode);
+            result = report();
+            if (dudect_sequential && i + 1 < batches &&
+                settled(i + 1, batches)) {
+                printf("settled after %d of %d batches\n", i + 1, batches);
+                break;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds =
+        (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    last_result.rate = (t[0]->n[0] + t[0]->n[1]) / seconds;
+    meas_close();
+    printf("%.0f samples/s\n", last_result.rate);
     for (int i = 0; i < number_tests; ++i) {
         free(t[i]);
     }
     return result;
 }
+
+bool check_op(int mode)
+{
+    const dut_op_t *op = &dut_ops[mode];
+    if (op->linear) {
+        timer_setup();
+        init_dut();
+        return test_linear(op->name, mode);
+    }
+    bool result = test_const(op->name, mode);
+    release_dut();
+    return result;
+}
+
+bool is_insert_tail_const(void)
+{
+    return check_op(test_insert_tail);
+}
+
+bool is_size_const(void)
+{
+    return check_op(test_size);
+}
+
+const_result_t last_const_result(void)
+{
+    return last_result;
+}
+
+int worker_results(const const_result_t **results)
+{
+    *results = worker_result;
+    return worker_cnt;
+}
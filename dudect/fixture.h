@@ -8,4 +8,31 @@
 bool is_insert_tail_const(void);
 bool is_size_const(void);
 
+/*
+ * Check operation mode, one of the test_ constants, against its expected
+ * complexity: constant time, or linear in the length of the queue.
+ */
+bool check_op(int mode);
+
+/*
+ * Statistics behind the most recent verdict.
+ * For a linear check, test is -1 and max_t is the growth ratio of the
+ * time per element when the queue length doubles.
+ */
+typedef struct {
+    int test;            /* Which t-test gave the largest t */
+    double max_t;        /* Absolute value of that t statistic */
+    double measurements; /* Number of measurements in that test */
+    double rate;         /* Samples per second, 0 for a linear check */
+} const_result_t;
+
+const_result_t last_const_result(void);
+
+/*
+ * Statistics of each worker process in the most recent test, so that noisy
+ * CPUs can be spotted.  Returns the number of workers, 0 for a serial run.
+ */
+#define MAX_WORKERS 64
+int worker_results(const const_result_t **results);
+
 #endif
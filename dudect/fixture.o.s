@@ -0,0 +1,13004 @@
+	.file	"fixture.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "dudect/fixture.c"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"Dropping batch measured with two timers"
+	.text
+	.type	measure_batch, @function
+measure_batch:
+.LVL0:
+.LFB38:
+	.file 1 "dudect/fixture.c"
+	.loc 1 303 1 view -0
+	.cfi_startproc
+	.loc 1 303 1 is_stmt 0 view .LVU1
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp	#,
+	.cfi_def_cfa_offset 160
+	movl	%edi, %r12d	# tmp264, mode
+	.loc 1 304 5 is_stmt 1 view .LVU2
+# dudect/fixture.c:304:     int64_t *before_ticks = calloc(number_measurements + 1, sizeof(int64_t));
+	.loc 1 304 29 is_stmt 0 view .LVU3
+	movq	number_measurements(%rip), %rbx	# number_measurements, number_measurements.5_1
+	leaq	1(%rbx), %rbp	#, _2
+	movl	$8, %esi	#,
+	movq	%rbp, %rdi	# _2,
+.LVL1:
+	.loc 1 304 29 view .LVU4
+	call	calloc@PLT	#
+.LVL2:
+	movq	%rax, %r13	# tmp265, before_ticks
+	movq	%rax, 16(%rsp)	# before_ticks, %sfp
+.LVL3:
+	.loc 1 305 5 is_stmt 1 view .LVU5
+# dudect/fixture.c:305:     int64_t *after_ticks = calloc(number_measurements + 1, sizeof(int64_t));
+	.loc 1 305 28 is_stmt 0 view .LVU6
+	movl	$8, %esi	#,
+	movq	%rbp, %rdi	# _2,
+	call	calloc@PLT	#
+.LVL4:
+	.loc 1 305 28 view .LVU7
+	movq	%rax, %r15	# tmp266, after_ticks
+.LVL5:
+	.loc 1 306 5 is_stmt 1 view .LVU8
+# dudect/fixture.c:306:     int64_t *exec_times = calloc(number_measurements, sizeof(int64_t));
+	.loc 1 306 27 is_stmt 0 view .LVU9
+	movl	$8, %esi	#,
+	movq	%rbx, %rdi	# number_measurements.5_1,
+	call	calloc@PLT	#
+.LVL6:
+	.loc 1 306 27 view .LVU10
+	movq	%rax, %r14	# tmp267, exec_times
+.LVL7:
+	.loc 1 307 5 is_stmt 1 view .LVU11
+# dudect/fixture.c:307:     size_t *lengths = calloc(number_measurements, sizeof(size_t));
+	.loc 1 307 23 is_stmt 0 view .LVU12
+	movl	$8, %esi	#,
+	movq	%rbx, %rdi	# number_measurements.5_1,
+	call	calloc@PLT	#
+.LVL8:
+	.loc 1 307 23 view .LVU13
+	movq	%rax, %rbp	# tmp268, lengths
+	movq	%rax, 24(%rsp)	# lengths, %sfp
+.LVL9:
+	.loc 1 308 5 is_stmt 1 view .LVU14
+# dudect/fixture.c:308:     uint8_t *classes = calloc(number_measurements, sizeof(uint8_t));
+	.loc 1 308 24 is_stmt 0 view .LVU15
+	movl	$1, %esi	#,
+	movq	%rbx, %rdi	# number_measurements.5_1,
+	call	calloc@PLT	#
+.LVL10:
+	.loc 1 308 24 view .LVU16
+	movq	%rax, (%rsp)	# tmp269, %sfp
+.LVL11:
+	.loc 1 309 5 is_stmt 1 view .LVU17
+# dudect/fixture.c:310:         calloc(number_measurements * chunk_size, sizeof(uint8_t));
+	.loc 1 310 9 is_stmt 0 view .LVU18
+	movq	%rbx, %rdi	# number_measurements.5_1, tmp176
+	imulq	chunk_size(%rip), %rdi	# chunk_size, tmp176
+	movl	$1, %esi	#,
+	call	calloc@PLT	#
+.LVL12:
+	.loc 1 310 9 view .LVU19
+	movq	%rax, 8(%rsp)	# input_data, %sfp
+.LVL13:
+	.loc 1 312 5 is_stmt 1 view .LVU20
+# dudect/fixture.c:312:     if (!before_ticks || !after_ticks || !exec_times || !lengths ||
+	.loc 1 312 8 is_stmt 0 view .LVU21
+	testq	%r13, %r13	# before_ticks
+	je	.L2	#,
+	testq	%r15, %r15	# after_ticks
+	je	.L2	#,
+# dudect/fixture.c:312:     if (!before_ticks || !after_ticks || !exec_times || !lengths ||
+	.loc 1 312 54 discriminator 1 view .LVU22
+	testq	%r14, %r14	# exec_times
+	je	.L2	#,
+	testq	%rbp, %rbp	# lengths
+	je	.L2	#,
+# dudect/fixture.c:313:         !classes || !input_data) {
+	.loc 1 313 18 view .LVU23
+	cmpq	$0, (%rsp)	#, %sfp
+	je	.L2	#,
+	testq	%rax, %rax	# input_data
+	je	.L2	#,
+	.loc 1 317 5 is_stmt 1 view .LVU24
+	movq	(%rsp), %rsi	# %sfp,
+	movq	8(%rsp), %rdi	# %sfp,
+	call	prepare_inputs@PLT	#
+.LVL14:
+	.loc 1 319 5 view .LVU25
+# dudect/fixture.c:319:     int timer = timer_active;
+	.loc 1 319 9 is_stmt 0 view .LVU26
+	movl	timer_active(%rip), %ebp	# timer_active, timer
+.LVL15:
+	.loc 1 320 5 is_stmt 1 view .LVU27
+# dudect/fixture.c:320:     if (old_measure && (mode == test_insert_tail || mode == test_size)) {
+	.loc 1 320 8 is_stmt 0 view .LVU28
+	cmpb	$0, old_measure(%rip)	#, old_measure
+	je	.L5	#,
+# dudect/fixture.c:320:     if (old_measure && (mode == test_insert_tail || mode == test_size)) {
+	.loc 1 320 21 discriminator 1 view .LVU29
+	cmpl	$1, %r12d	#, mode
+	jbe	.L33	#,
+.L5:
+	.loc 1 323 9 is_stmt 1 view .LVU30
+	movl	%r12d, %r9d	# mode,
+	movq	(%rsp), %r8	# %sfp,
+	movq	8(%rsp), %rcx	# %sfp,
+	movq	24(%rsp), %rdx	# %sfp,
+	movq	%r15, %rsi	# after_ticks,
+	movq	16(%rsp), %rdi	# %sfp,
+	call	measure@PLT	#
+.LVL16:
+.L6:
+.LBB24:
+.LBB25:
+	.loc 1 122 26 view .LVU31
+	testq	%rbx, %rbx	# number_measurements.5_1
+	je	.L7	#,
+	movl	$0, %eax	#, i
+	movq	16(%rsp), %rcx	# %sfp, before_ticks
+.LVL17:
+.L8:
+	.loc 1 123 9 view .LVU32
+# dudect/fixture.c:123:         exec_times[i] = after_ticks[i] - before_ticks[i];
+	.loc 1 123 40 is_stmt 0 view .LVU33
+	movq	(%r15,%rax,8), %rdx	# MEM[(int64_t *)after_ticks_29 + i_43 * 8], MEM[(int64_t *)after_ticks_29 + i_43 * 8]
+	subq	(%rcx,%rax,8), %rdx	# MEM[(int64_t *)before_ticks_27 + i_43 * 8], tmp192
+# dudect/fixture.c:123:         exec_times[i] = after_ticks[i] - before_ticks[i];
+	.loc 1 123 23 view .LVU34
+	movq	%rdx, (%r14,%rax,8)	# tmp192, MEM[(int64_t *)exec_times_31 + i_43 * 8]
+	.loc 1 122 50 is_stmt 1 view .LVU35
+	addq	$1, %rax	#, i
+.LVL18:
+	.loc 1 122 26 view .LVU36
+	cmpq	%rax, %rbx	# i, number_measurements.5_1
+	jne	.L8	#,
+.LVL19:
+.L7:
+	.loc 1 122 26 is_stmt 0 view .LVU37
+.LBE25:
+.LBE24:
+	.loc 1 328 5 is_stmt 1 view .LVU38
+# dudect/fixture.c:328:     if (timer_active != timer) {
+	.loc 1 328 8 is_stmt 0 view .LVU39
+	cmpl	%ebp, timer_active(%rip)	# timer, timer_active
+	jne	.L34	#,
+	.loc 1 331 9 is_stmt 1 view .LVU40
+# dudect/fixture.c:331:         if (write_data)
+	.loc 1 331 12 is_stmt 0 view .LVU41
+	cmpb	$0, write_data(%rip)	#, write_data
+	jne	.L35	#,
+.L11:
+	.loc 1 334 9 is_stmt 1 view .LVU42
+# dudect/fixture.c:334:         if (dut_ops[mode].linear) {
+	.loc 1 334 26 is_stmt 0 view .LVU43
+	movslq	%r12d, %r12	# mode, mode
+	.loc 1 334 26 view .LVU44
+	leaq	(%r12,%r12,2), %rax	#, tmp201
+	salq	$4, %rax	#, tmp202
+# dudect/fixture.c:334:         if (dut_ops[mode].linear) {
+	.loc 1 334 12 view .LVU45
+	leaq	dut_ops(%rip), %rdx	#, tmp197
+	cmpb	$0, 8(%rdx,%rax)	#, dut_ops[mode_40(D)].linear
+	je	.L12	#,
+	.loc 1 335 13 is_stmt 1 view .LVU46
+.LVL20:
+.LBB26:
+.LBI26:
+	.loc 1 288 13 view .LVU47
+	.loc 1 292 5 view .LVU48
+.LBB27:
+	.loc 1 292 10 view .LVU49
+# dudect/fixture.c:292:     for (size_t i = drop_size; i < number_measurements - drop_size; i++) {
+	.loc 1 292 17 is_stmt 0 view .LVU50
+	movslq	drop_size(%rip), %rcx	# drop_size, i
+.LVL21:
+	.loc 1 292 34 is_stmt 1 view .LVU51
+# dudect/fixture.c:292:     for (size_t i = drop_size; i < number_measurements - drop_size; i++) {
+	.loc 1 292 56 is_stmt 0 view .LVU52
+	subq	%rcx, %rbx	# i, _112
+# dudect/fixture.c:292:     for (size_t i = drop_size; i < number_measurements - drop_size; i++) {
+	.loc 1 292 34 view .LVU53
+	cmpq	%rbx, %rcx	# _112, i
+	jnb	.L10	#,
+.LBB28:
+# dudect/fixture.c:296:         element_ticks[c][element_cnt[c]++] =
+	.loc 1 296 22 view .LVU54
+	leaq	element_ticks(%rip), %r11	#, tmp256
+# dudect/fixture.c:296:         element_ticks[c][element_cnt[c]++] =
+	.loc 1 296 37 view .LVU55
+	leaq	element_cnt(%rip), %r8	#, tmp257
+	movq	24(%rsp), %r9	# %sfp, lengths
+	movq	(%rsp), %r10	# %sfp, classes
+	jmp	.L14	#
+.LVL22:
+.L2:
+	.loc 1 296 37 view .LVU56
+.LBE28:
+.LBE27:
+.LBE26:
+	.loc 1 314 9 is_stmt 1 view .LVU57
+.LBB31:
+.LBI31:
+	.loc 1 88 39 view .LVU58
+.LBB32:
+	.loc 1 90 5 view .LVU59
+	movl	$111, %edi	#,
+	call	exit@PLT	#
+.LVL23:
+.L33:
+	.loc 1 90 5 is_stmt 0 view .LVU60
+.LBE32:
+.LBE31:
+	.loc 1 321 9 is_stmt 1 view .LVU61
+	movl	%r12d, %ecx	# mode,
+	movq	8(%rsp), %rdx	# %sfp,
+	movq	%r15, %rsi	# after_ticks,
+	movq	16(%rsp), %rdi	# %sfp,
+	call	measure_old@PLT	#
+.LVL24:
+	jmp	.L6	#
+.L34:
+	.loc 1 329 9 view .LVU62
+	leaq	.LC0(%rip), %rdi	#, tmp194
+	call	puts@PLT	#
+.LVL25:
+.L10:
+	.loc 1 342 5 view .LVU63
+	movq	16(%rsp), %rdi	# %sfp,
+	call	free@PLT	#
+.LVL26:
+	.loc 1 343 5 view .LVU64
+	movq	%r15, %rdi	# after_ticks,
+	call	free@PLT	#
+.LVL27:
+	.loc 1 344 5 view .LVU65
+	movq	%r14, %rdi	# exec_times,
+	call	free@PLT	#
+.LVL28:
+	.loc 1 345 5 view .LVU66
+	movq	24(%rsp), %rdi	# %sfp,
+	call	free@PLT	#
+.LVL29:
+	.loc 1 346 5 view .LVU67
+	movq	(%rsp), %rdi	# %sfp,
+	call	free@PLT	#
+.LVL30:
+	.loc 1 347 5 view .LVU68
+	movq	8(%rsp), %rdi	# %sfp,
+	call	free@PLT	#
+.LVL31:
+# dudect/fixture.c:348: }
+	.loc 1 348 1 is_stmt 0 view .LVU69
+	addq	$104, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL32:
+	.loc 1 348 1 view .LVU70
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL33:
+.L35:
+	.cfi_restore_state
+	.loc 1 332 13 is_stmt 1 view .LVU71
+	movslq	drop_size(%rip), %rcx	# drop_size, _19
+	movq	%rbx, %r8	# number_measurements.5_1, tmp299
+	subq	%rcx, %r8	# _19, tmp299
+	movq	24(%rsp), %rdx	# %sfp,
+	movq	(%rsp), %rsi	# %sfp,
+	movq	%r14, %rdi	# exec_times,
+	call	meas_write@PLT	#
+.LVL34:
+	jmp	.L11	#
+.LVL35:
+.L13:
+.LBB33:
+.LBB30:
+	.loc 1 292 70 view .LVU72
+	addq	$1, %rcx	#, i
+.LVL36:
+	.loc 1 292 34 view .LVU73
+	cmpq	%rbx, %rcx	# _112, i
+	je	.L10	#,
+.L14:
+.LBB29:
+	.loc 1 293 9 view .LVU74
+# dudect/fixture.c:293:         if (exec_times[i] < 0 || lengths[i] == 0)
+	.loc 1 293 23 is_stmt 0 view .LVU75
+	movq	(%r14,%rcx,8), %rax	# MEM[(int64_t *)exec_times_31 + i_162 * 8], _70
+# dudect/fixture.c:293:         if (exec_times[i] < 0 || lengths[i] == 0)
+	.loc 1 293 12 view .LVU76
+	testq	%rax, %rax	# _70
+	js	.L13	#,
+# dudect/fixture.c:293:         if (exec_times[i] < 0 || lengths[i] == 0)
+	.loc 1 293 41 view .LVU77
+	movq	(%r9,%rcx,8), %rbp	# MEM[(size_t *)lengths_33 + i_162 * 8], _72
+# dudect/fixture.c:293:         if (exec_times[i] < 0 || lengths[i] == 0)
+	.loc 1 293 31 view .LVU78
+	testq	%rbp, %rbp	# _72
+	je	.L13	#,
+	.loc 1 295 9 is_stmt 1 view .LVU79
+.LVL37:
+	.loc 1 296 9 view .LVU80
+# dudect/fixture.c:296:         element_ticks[c][element_cnt[c]++] =
+	.loc 1 296 22 is_stmt 0 view .LVU81
+	movzbl	(%r10,%rcx), %edx	# MEM[(uint8_t *)classes_35 + i_162 * 1], c
+	movq	(%r11,%rdx,8), %rdi	# element_ticks[c_75], _78
+# dudect/fixture.c:296:         element_ticks[c][element_cnt[c]++] =
+	.loc 1 296 37 view .LVU82
+	movq	(%r8,%rdx,8), %rsi	# element_cnt[c_75], _79
+# dudect/fixture.c:296:         element_ticks[c][element_cnt[c]++] =
+	.loc 1 296 40 view .LVU83
+	leaq	1(%rsi), %r12	#, tmp212
+	movq	%r12, (%r8,%rdx,8)	# tmp212, element_cnt[c_75]
+# dudect/fixture.c:297:             exec_times[i] * element_scale / (int64_t) lengths[i];
+	.loc 1 297 27 view .LVU84
+	salq	$8, %rax	#, tmp213
+# dudect/fixture.c:297:             exec_times[i] * element_scale / (int64_t) lengths[i];
+	.loc 1 297 43 view .LVU85
+	cqto
+	idivq	%rbp	# _72
+# dudect/fixture.c:296:         element_ticks[c][element_cnt[c]++] =
+	.loc 1 296 44 view .LVU86
+	movq	%rax, (%rdi,%rsi,8)	# tmp214, *_82
+.LVL38:
+	.loc 1 296 44 view .LVU87
+	jmp	.L13	#
+.LVL39:
+.L12:
+	.loc 1 296 44 view .LVU88
+.LBE29:
+.LBE30:
+.LBE33:
+	.loc 1 337 13 is_stmt 1 view .LVU89
+.LBB34:
+.LBI34:
+	.loc 1 105 13 view .LVU90
+.LBB35:
+	.loc 1 107 5 view .LVU91
+# dudect/fixture.c:107:     if (crop_samples.capacity) {
+	.loc 1 107 8 is_stmt 0 view .LVU92
+	cmpq	$0, 8+crop_samples(%rip)	#, crop_samples.capacity
+	jne	.L36	#,
+	.loc 1 112 12 is_stmt 1 view .LVU93
+# dudect/fixture.c:112:     } else if (percentiles[number_percentiles - 1] == 0) {
+	.loc 1 112 15 is_stmt 0 view .LVU94
+	cmpq	$0, 792+percentiles(%rip)	#, percentiles[99]
+	je	.L37	#,
+.LVL40:
+.L16:
+	.loc 1 112 15 view .LVU95
+.LBE35:
+.LBE34:
+	.loc 1 338 13 is_stmt 1 view .LVU96
+.LBB37:
+.LBI37:
+	.loc 1 160 13 view .LVU97
+	.loc 1 162 5 view .LVU98
+.LBB38:
+	.loc 1 162 10 view .LVU99
+# dudect/fixture.c:162:     for (size_t i = drop_size; i < number_measurements - drop_size; i++) {
+	.loc 1 162 17 is_stmt 0 view .LVU100
+	movslq	drop_size(%rip), %r12	# drop_size, i
+.LVL41:
+	.loc 1 162 34 is_stmt 1 view .LVU101
+# dudect/fixture.c:162:     for (size_t i = drop_size; i < number_measurements - drop_size; i++) {
+	.loc 1 162 56 is_stmt 0 view .LVU102
+	subq	%r12, %rbx	# i, number_measurements.5_1
+	movq	%rbx, %r13	# number_measurements.5_1, _45
+.LVL42:
+# dudect/fixture.c:162:     for (size_t i = drop_size; i < number_measurements - drop_size; i++) {
+	.loc 1 162 34 view .LVU103
+	cmpq	%rbx, %r12	# _45, i
+	jnb	.L17	#,
+.LBB39:
+.LBB40:
+.LBB41:
+.LBB42:
+# dudect/fixture.c:141:         if (percentiles[mid] > x)
+	.loc 1 141 24 view .LVU104
+	leaq	percentiles(%rip), %rbp	#, tmp260
+.LBE42:
+.LBE41:
+.LBE40:
+# dudect/fixture.c:181:         if (center.n[0] > 10000) {
+	.loc 1 181 12 view .LVU105
+	movq	%r15, 40(%rsp)	# after_ticks, %sfp
+	movq	(%rsp), %r15	# %sfp, classes
+.LVL43:
+	.loc 1 181 12 view .LVU106
+	jmp	.L24	#
+.LVL44:
+.L36:
+	.loc 1 181 12 view .LVU107
+.LBE39:
+.LBE38:
+.LBE37:
+.LBB56:
+.LBB36:
+	.loc 1 108 9 is_stmt 1 view .LVU108
+# dudect/fixture.c:109:                      number_measurements - 2 * drop_size);
+	.loc 1 109 46 is_stmt 0 view .LVU109
+	movl	drop_size(%rip), %eax	# drop_size, drop_size.24_116
+	leal	(%rax,%rax), %edx	#, tmp217
+	movslq	%edx, %rdx	# tmp217, tmp218
+# dudect/fixture.c:108:         pwindow_push(&crop_samples, ticks + drop_size,
+	.loc 1 108 9 view .LVU110
+	movq	%rbx, %rcx	# number_measurements.5_1, tmp219
+	subq	%rdx, %rcx	# tmp218, tmp219
+# dudect/fixture.c:108:         pwindow_push(&crop_samples, ticks + drop_size,
+	.loc 1 108 43 view .LVU111
+	cltq
+	leaq	(%r14,%rax,8), %rsi	#, tmp222
+# dudect/fixture.c:108:         pwindow_push(&crop_samples, ticks + drop_size,
+	.loc 1 108 9 view .LVU112
+	movq	%rcx, %rdx	# tmp219,
+	leaq	crop_samples(%rip), %rbp	#, tmp223
+.LVL45:
+	.loc 1 108 9 view .LVU113
+	movq	%rbp, %rdi	# tmp223,
+	call	pwindow_push@PLT	#
+.LVL46:
+	.loc 1 110 9 is_stmt 1 view .LVU114
+	leaq	percentiles(%rip), %rcx	#, tmp224
+	movl	$100, %edx	#,
+	leaq	crop_fractions(%rip), %rsi	#, tmp225
+	movq	%rbp, %rdi	# tmp223,
+	call	pwindow_percentiles@PLT	#
+.LVL47:
+	jmp	.L16	#
+.LVL48:
+.L37:
+	.loc 1 113 9 view .LVU115
+	leaq	percentiles(%rip), %r8	#,
+	movl	$100, %ecx	#,
+	leaq	crop_fractions(%rip), %rdx	#, tmp228
+	movq	%rbx, %rsi	# number_measurements.5_1,
+	movq	%r14, %rdi	# exec_times,
+	call	compute_percentiles@PLT	#
+.LVL49:
+	jmp	.L16	#
+.LVL50:
+.L42:
+	.loc 1 113 9 is_stmt 0 view .LVU116
+.LBE36:
+.LBE56:
+.LBB57:
+.LBB52:
+.LBB50:
+.LBB47:
+.LBB45:
+.LBB43:
+	.loc 1 144 13 is_stmt 1 view .LVU117
+# dudect/fixture.c:144:             lo = mid + 1;
+	.loc 1 144 16 is_stmt 0 view .LVU118
+	leaq	1(%rax), %rcx	#, lo
+.LVL51:
+	.loc 1 144 16 view .LVU119
+	jmp	.L20	#
+.LVL52:
+.L41:
+	.loc 1 144 16 view .LVU120
+.LBE43:
+	.loc 1 146 5 is_stmt 1 view .LVU121
+	.loc 1 146 5 is_stmt 0 view .LVU122
+.LBE45:
+.LBE47:
+	.loc 1 175 9 is_stmt 1 view .LVU123
+# dudect/fixture.c:175:         if (k < number_percentiles)
+	.loc 1 175 12 is_stmt 0 view .LVU124
+	cmpq	$99, %rcx	#, lo
+	jbe	.L38	#,
+.LVL53:
+.L22:
+	.loc 1 180 9 is_stmt 1 view .LVU125
+	movzbl	(%r15,%r12), %esi	# MEM[(uint8_t *)classes_35 + i_163 * 1], MEM[(uint8_t *)classes_35 + i_163 * 1]
+	movsd	32(%rsp), %xmm0	# %sfp,
+	leaq	center(%rip), %rdi	#, tmp243
+	call	t_push@PLT	#
+.LVL54:
+	.loc 1 181 9 view .LVU126
+# dudect/fixture.c:181:         if (center.n[0] > 10000) {
+	.loc 1 181 12 is_stmt 0 view .LVU127
+	movsd	32+center(%rip), %xmm0	# center.n[0], center.n[0]
+	comisd	.LC1(%rip), %xmm0	#, center.n[0]
+	ja	.L39	#,
+.LVL55:
+.L18:
+	.loc 1 181 12 view .LVU128
+.LBE50:
+	.loc 1 162 70 is_stmt 1 view .LVU129
+	addq	$1, %r12	#, i
+.LVL56:
+	.loc 1 162 34 view .LVU130
+	cmpq	%r13, %r12	# _45, i
+	jnb	.L40	#,
+.LVL57:
+.L24:
+.LBB51:
+	.loc 1 163 9 view .LVU131
+# dudect/fixture.c:163:         int64_t difference = exec_times[i];
+	.loc 1 163 17 is_stmt 0 view .LVU132
+	movq	(%r14,%r12,8), %rbx	# MEM[(int64_t *)exec_times_31 + i_163 * 8], difference
+.LVL58:
+	.loc 1 165 9 is_stmt 1 view .LVU133
+# dudect/fixture.c:165:         if (difference < 0) {
+	.loc 1 165 12 is_stmt 0 view .LVU134
+	testq	%rbx, %rbx	# difference
+	js	.L18	#,
+	.loc 1 170 9 is_stmt 1 view .LVU135
+	pxor	%xmm1, %xmm1	# _96
+	cvtsi2sdq	%rbx, %xmm1	# difference, _96
+	movsd	%xmm1, 32(%rsp)	# _96, %sfp
+	movzbl	(%r15,%r12), %esi	# MEM[(uint8_t *)classes_35 + i_163 * 1], MEM[(uint8_t *)classes_35 + i_163 * 1]
+	movapd	%xmm1, %xmm0	# _96,
+	movq	t(%rip), %rdi	# t[0],
+	call	t_push@PLT	#
+.LVL59:
+	.loc 1 174 9 view .LVU136
+.LBB48:
+.LBI40:
+	.loc 1 136 15 view .LVU137
+.LBB46:
+	.loc 1 138 5 view .LVU138
+	.loc 1 139 5 view .LVU139
+# dudect/fixture.c:138:     size_t lo = 0, hi = number_percentiles;
+	.loc 1 138 20 is_stmt 0 view .LVU140
+	movl	$100, %edx	#, hi
+# dudect/fixture.c:138:     size_t lo = 0, hi = number_percentiles;
+	.loc 1 138 12 view .LVU141
+	movl	$0, %ecx	#, lo
+.LVL60:
+.L20:
+	.loc 1 139 15 is_stmt 1 view .LVU142
+	cmpq	%rdx, %rcx	# hi, lo
+	jnb	.L41	#,
+.LBB44:
+	.loc 1 140 9 view .LVU143
+# dudect/fixture.c:140:         size_t mid = (lo + hi) / 2;
+	.loc 1 140 26 is_stmt 0 view .LVU144
+	leaq	(%rdx,%rcx), %rax	#, tmp233
+# dudect/fixture.c:140:         size_t mid = (lo + hi) / 2;
+	.loc 1 140 16 view .LVU145
+	shrq	%rax	# mid
+.LVL61:
+	.loc 1 141 9 is_stmt 1 view .LVU146
+# dudect/fixture.c:141:         if (percentiles[mid] > x)
+	.loc 1 141 12 is_stmt 0 view .LVU147
+	cmpq	0(%rbp,%rax,8), %rbx	# percentiles[mid_128], difference
+	jge	.L42	#,
+# dudect/fixture.c:140:         size_t mid = (lo + hi) / 2;
+	.loc 1 140 16 view .LVU148
+	movq	%rax, %rdx	# mid, hi
+.LVL62:
+	.loc 1 140 16 view .LVU149
+	jmp	.L20	#
+.LVL63:
+.L38:
+	.loc 1 140 16 view .LVU150
+.LBE44:
+.LBE46:
+.LBE48:
+	.loc 1 176 13 is_stmt 1 view .LVU151
+	movzbl	(%r15,%r12), %esi	# MEM[(uint8_t *)classes_35 + i_163 * 1], MEM[(uint8_t *)classes_35 + i_163 * 1]
+	leaq	(%rcx,%rcx,2), %rdi	#, tmp238
+	salq	$4, %rdi	#, tmp239
+	leaq	crop_bucket(%rip), %rax	#, tmp241
+	addq	%rax, %rdi	# tmp241, tmp240
+	movsd	32(%rsp), %xmm0	# %sfp,
+	call	t_push@PLT	#
+.LVL64:
+	.loc 1 176 13 is_stmt 0 view .LVU152
+	jmp	.L22	#
+.L39:
+.LBB49:
+	.loc 1 182 13 is_stmt 1 view .LVU153
+# dudect/fixture.c:182:             double centered = (double) difference - center.mean[classes[i]];
+	.loc 1 182 72 is_stmt 0 view .LVU154
+	movzbl	(%r15,%r12), %esi	# MEM[(uint8_t *)classes_35 + i_163 * 1], _106
+# dudect/fixture.c:182:             double centered = (double) difference - center.mean[classes[i]];
+	.loc 1 182 64 view .LVU155
+	movslq	%esi, %rdx	# _106, _106
+# dudect/fixture.c:182:             double centered = (double) difference - center.mean[classes[i]];
+	.loc 1 182 20 view .LVU156
+	leaq	center(%rip), %rax	#, tmp247
+	movsd	32(%rsp), %xmm0	# %sfp, _96
+	subsd	(%rax,%rdx,8), %xmm0	# center.mean[_106], _96
+.LVL65:
+	.loc 1 183 13 is_stmt 1 view .LVU157
+	mulsd	%xmm0, %xmm0	# centered, tmp249
+.LVL66:
+	.loc 1 183 13 is_stmt 0 view .LVU158
+	movq	808+t(%rip), %rdi	# t[101],
+	call	t_push@PLT	#
+.LVL67:
+	.loc 1 183 13 view .LVU159
+	jmp	.L18	#
+.LVL68:
+.L40:
+	.loc 1 183 13 view .LVU160
+	movq	40(%rsp), %r15	# %sfp, after_ticks
+.LVL69:
+.L17:
+	.loc 1 183 13 view .LVU161
+.LBE49:
+.LBE51:
+.LBE52:
+	.loc 1 186 5 is_stmt 1 view .LVU162
+.LBB53:
+.LBI53:
+	.loc 1 149 13 view .LVU163
+.LBB54:
+	.loc 1 151 5 view .LVU164
+	.loc 1 152 5 view .LVU165
+	leaq	48(%rsp), %rdi	#, tmp252
+	call	t_init@PLT	#
+.LVL70:
+	.loc 1 153 5 view .LVU166
+.LBB55:
+	.loc 1 153 10 view .LVU167
+	.loc 1 153 26 view .LVU168
+	leaq	crop_bucket(%rip), %rbx	#, ivtmp.94
+	leaq	8+t(%rip), %rbp	#, ivtmp.95
+	leaq	4800(%rbx), %r13	#, _46
+# dudect/fixture.c:154:         t_merge(&below, &crop_bucket[i]);
+	.loc 1 154 9 is_stmt 0 view .LVU169
+	leaq	48(%rsp), %r12	#, tmp253
+.LVL71:
+.L25:
+	.loc 1 154 9 is_stmt 1 view .LVU170
+	movq	%rbx, %rsi	# ivtmp.94,
+	movq	%r12, %rdi	# tmp253,
+	call	t_merge@PLT	#
+.LVL72:
+	.loc 1 155 9 view .LVU171
+	movq	0(%rbp), %rdi	# MEM[(struct t_ctx * *)_124], MEM[(struct t_ctx * *)_124]
+	movq	%r12, %rsi	# tmp253,
+	call	t_merge@PLT	#
+.LVL73:
+	.loc 1 156 9 view .LVU172
+	movq	%rbx, %rdi	# ivtmp.94,
+	call	t_init@PLT	#
+.LVL74:
+	.loc 1 153 49 view .LVU173
+	.loc 1 153 26 view .LVU174
+	addq	$48, %rbx	#, ivtmp.94
+	addq	$8, %rbp	#, ivtmp.95
+	cmpq	%rbx, %r13	# ivtmp.94, _46
+	jne	.L25	#,
+	jmp	.L10	#
+.LBE55:
+.LBE54:
+.LBE53:
+.LBE57:
+	.cfi_endproc
+.LFE38:
+	.size	measure_batch, .-measure_batch
+	.type	max_test, @function
+max_test:
+.LVL75:
+.LFB34:
+	.loc 1 191 1 view -0
+	.cfi_startproc
+	.loc 1 191 1 is_stmt 0 view .LVU176
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$16, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbp	# tmp96, tests
+	movsd	%xmm0, (%rsp)	# tmp97, %sfp
+	.loc 1 192 5 is_stmt 1 view .LVU177
+.LVL76:
+	.loc 1 193 5 view .LVU178
+	.loc 1 194 5 view .LVU179
+.LBB58:
+	.loc 1 194 10 view .LVU180
+	.loc 1 194 26 view .LVU181
+# dudect/fixture.c:194:     for (size_t i = 0; i < number_tests; i++) {
+	.loc 1 194 17 is_stmt 0 view .LVU182
+	movl	$0, %ebx	#, i
+.LBE58:
+# dudect/fixture.c:193:     double max = 0;
+	.loc 1 193 12 view .LVU183
+	movq	$0x000000000, 8(%rsp)	#, %sfp
+# dudect/fixture.c:192:     int ret = 0;
+	.loc 1 192 9 view .LVU184
+	movl	$0, %r12d	#, <retval>
+	jmp	.L47	#
+.LVL77:
+.L44:
+.LBB60:
+	.loc 1 194 43 is_stmt 1 discriminator 2 view .LVU185
+	addq	$1, %rbx	#, i
+.LVL78:
+	.loc 1 194 26 discriminator 2 view .LVU186
+	cmpq	$102, %rbx	#, i
+	je	.L52	#,
+.LVL79:
+.L47:
+	.loc 1 195 9 view .LVU187
+# dudect/fixture.c:195:         if (tests[i]->n[0] > min_n) {
+	.loc 1 195 18 is_stmt 0 view .LVU188
+	movq	0(%rbp,%rbx,8), %rdi	# MEM[(struct t_ctx * *)tests_14(D) + i_27 * 8], _3
+# dudect/fixture.c:195:         if (tests[i]->n[0] > min_n) {
+	.loc 1 195 12 view .LVU189
+	movsd	32(%rdi), %xmm0	# _3->n[0], _3->n[0]
+	comisd	(%rsp), %xmm0	# %sfp, _3->n[0]
+	jbe	.L44	#,
+.LBB59:
+	.loc 1 196 13 is_stmt 1 view .LVU190
+# dudect/fixture.c:196:             double x = fabs(t_compute(tests[i]));
+	.loc 1 196 29 is_stmt 0 view .LVU191
+	call	t_compute@PLT	#
+.LVL80:
+# dudect/fixture.c:196:             double x = fabs(t_compute(tests[i]));
+	.loc 1 196 20 view .LVU192
+	andpd	.LC3(%rip), %xmm0	#, x
+.LVL81:
+	.loc 1 197 13 is_stmt 1 view .LVU193
+# dudect/fixture.c:197:             if (max < x) {
+	.loc 1 197 16 is_stmt 0 view .LVU194
+	movsd	8(%rsp), %xmm2	# %sfp, max
+	comisd	%xmm2, %xmm0	# max, x
+# dudect/fixture.c:198:                 max = x;
+	.loc 1 198 21 view .LVU195
+	cmova	%ebx, %r12d	# i,, <retval>
+.LVL82:
+	.loc 1 198 21 view .LVU196
+	maxsd	%xmm2, %xmm0	# max, x
+.LVL83:
+	.loc 1 198 21 view .LVU197
+	movsd	%xmm0, 8(%rsp)	# x, %sfp
+.LVL84:
+	.loc 1 198 21 view .LVU198
+	jmp	.L44	#
+.LVL85:
+.L52:
+	.loc 1 198 21 view .LVU199
+.LBE59:
+.LBE60:
+	.loc 1 203 5 is_stmt 1 view .LVU200
+# dudect/fixture.c:204: }
+	.loc 1 204 1 is_stmt 0 view .LVU201
+	movl	%r12d, %eax	# <retval>,
+	addq	$16, %rsp	#,
+	.cfi_def_cfa_offset 32
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LVL86:
+	.loc 1 204 1 view .LVU202
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL87:
+	.loc 1 204 1 view .LVU203
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL88:
+	.loc 1 204 1 view .LVU204
+	ret	
+	.cfi_endproc
+.LFE34:
+	.size	max_test, .-max_test
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC4:
+	.string	"\033[A\033[2K\033[A\033[2K"
+.LC6:
+	.string	"meas: %7.2lf M, "
+	.section	.rodata.str1.8
+	.align 8
+.LC7:
+	.string	"not enough measurements (%.0f still to go).\n"
+	.align 8
+.LC10:
+	.string	"max t [%d]: %+7.2f, max tau: %.2e, (5/tau)^2: %.2e, mu0: %.2e, mu1: %.2e, dmu: %-.2e, s0: %.2e, s1: %.2e, m20: %.2e, m21: %.2e.\n"
+	.text
+	.type	report, @function
+report:
+.LFB35:
+	.loc 1 209 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 80
+	.loc 1 210 5 view .LVU206
+# dudect/fixture.c:210:     int mt = max_test(t, enough_measurements);
+	.loc 1 210 14 is_stmt 0 view .LVU207
+	movsd	.LC1(%rip), %xmm0	#,
+	leaq	t(%rip), %rbx	#, tmp112
+	movq	%rbx, %rdi	# tmp112,
+	call	max_test	#
+.LVL89:
+	movl	%eax, %r13d	# tmp148, mt
+.LVL90:
+	.loc 1 211 5 is_stmt 1 view .LVU208
+# dudect/fixture.c:211:     t_ctx *tt = t[mt];
+	.loc 1 211 12 is_stmt 0 view .LVU209
+	movslq	%eax, %r14	# mt, mt
+	movq	(%rbx,%r14,8), %rbp	# t[mt_27], tt
+.LVL91:
+	.loc 1 212 5 is_stmt 1 view .LVU210
+# dudect/fixture.c:212:     double max_t = fabs(t_compute(t[mt]));
+	.loc 1 212 25 is_stmt 0 view .LVU211
+	movq	%rbp, %rdi	# tt,
+	call	t_compute@PLT	#
+.LVL92:
+# dudect/fixture.c:212:     double max_t = fabs(t_compute(t[mt]));
+	.loc 1 212 12 view .LVU212
+	andpd	.LC3(%rip), %xmm0	#, tmp149
+	movq	%xmm0, %r12	# tmp149, max_t
+.LVL93:
+	.loc 1 213 5 is_stmt 1 view .LVU213
+# dudect/fixture.c:213:     double number_traces_max_t = t[mt]->n[0] + t[mt]->n[1];
+	.loc 1 213 35 is_stmt 0 view .LVU214
+	movq	(%rbx,%r14,8), %rax	# t[mt_27], _2
+# dudect/fixture.c:213:     double number_traces_max_t = t[mt]->n[0] + t[mt]->n[1];
+	.loc 1 213 12 view .LVU215
+	movsd	32(%rax), %xmm0	# _2->n[0], _2->n[0]
+.LVL94:
+	.loc 1 213 12 view .LVU216
+	addsd	40(%rax), %xmm0	# _2->n[1], _2->n[0]
+	movq	%xmm0, %rbx	# _2->n[0], number_traces_max_t
+.LVL95:
+	.loc 1 214 5 is_stmt 1 view .LVU217
+	pxor	%xmm0, %xmm0	# tmp119
+	movq	%rbx, %xmm7	# number_traces_max_t, number_traces_max_t
+	ucomisd	%xmm7, %xmm0	# number_traces_max_t, tmp119
+	ja	.L72	#,
+# dudect/fixture.c:214:     double max_tau = max_t / sqrt(number_traces_max_t);
+	.loc 1 214 30 is_stmt 0 view .LVU218
+	movq	%rbx, %xmm0	# number_traces_max_t, _5
+	sqrtsd	%xmm0, %xmm0	# _5, _5
+.L56:
+# dudect/fixture.c:214:     double max_tau = max_t / sqrt(number_traces_max_t);
+	.loc 1 214 12 view .LVU219
+	movq	%r12, %xmm5	# max_t, max_tau
+	divsd	%xmm0, %xmm5	# _5, max_tau
+	movsd	%xmm5, 8(%rsp)	# max_tau, %sfp
+.LVL96:
+	.loc 1 216 5 is_stmt 1 view .LVU220
+# dudect/fixture.c:216:     last_result.test = mt;
+	.loc 1 216 22 is_stmt 0 view .LVU221
+	movl	%r13d, last_result(%rip)	# mt, last_result.test
+	.loc 1 217 5 is_stmt 1 view .LVU222
+# dudect/fixture.c:217:     last_result.max_t = max_t;
+	.loc 1 217 23 is_stmt 0 view .LVU223
+	movq	%r12, 8+last_result(%rip)	# max_t, last_result.max_t
+	.loc 1 218 5 is_stmt 1 view .LVU224
+# dudect/fixture.c:218:     last_result.measurements = number_traces_max_t;
+	.loc 1 218 30 is_stmt 0 view .LVU225
+	movq	%rbx, 16+last_result(%rip)	# number_traces_max_t, last_result.measurements
+	.loc 1 220 5 is_stmt 1 view .LVU226
+	leaq	.LC4(%rip), %rdi	#, tmp123
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL97:
+	.loc 1 221 5 view .LVU227
+	movq	%rbx, %xmm0	# number_traces_max_t, tmp124
+	divsd	.LC5(%rip), %xmm0	#, tmp124
+	leaq	.LC6(%rip), %rdi	#, tmp126
+	movl	$1, %eax	#,
+	call	printf@PLT	#
+.LVL98:
+	.loc 1 222 5 view .LVU228
+# dudect/fixture.c:222:     if (number_traces_max_t < enough_measurements) {
+	.loc 1 222 8 is_stmt 0 view .LVU229
+	movsd	.LC1(%rip), %xmm0	#, tmp127
+	movq	%rbx, %xmm2	# number_traces_max_t, number_traces_max_t
+	comisd	%xmm2, %xmm0	# number_traces_max_t, tmp127
+	jbe	.L73	#,
+	.loc 1 223 9 is_stmt 1 view .LVU230
+	subsd	%xmm2, %xmm0	# number_traces_max_t, tmp128
+	leaq	.LC7(%rip), %rdi	#, tmp130
+	movl	$1, %eax	#,
+	call	printf@PLT	#
+.LVL99:
+.L59:
+	.loc 1 240 5 view .LVU231
+	movq	24(%rbp), %r15	# tt_28->m2[1], _8
+	movq	16(%rbp), %r14	# tt_28->m2[0], _9
+# dudect/fixture.c:247:         sqrt(tt->m2[0] / (tt->n[0] - 1)), sqrt(tt->m2[1] / (tt->n[1] - 1)),
+	.loc 1 247 70 is_stmt 0 view .LVU232
+	movsd	40(%rbp), %xmm0	# tt_28->n[1], tt_28->n[1]
+	subsd	.LC8(%rip), %xmm0	#, tmp131
+# dudect/fixture.c:240:     printf(
+	.loc 1 240 5 view .LVU233
+	movq	%r15, %xmm1	# _8, _12
+	divsd	%xmm0, %xmm1	# tmp131, _12
+	pxor	%xmm0, %xmm0	# tmp134
+	ucomisd	%xmm1, %xmm0	# _12, tmp134
+	ja	.L74	#,
+	sqrtsd	%xmm1, %xmm1	# _12, _12
+	movq	%xmm1, %rbx	# _12, _13
+.LVL100:
+.L62:
+# dudect/fixture.c:247:         sqrt(tt->m2[0] / (tt->n[0] - 1)), sqrt(tt->m2[1] / (tt->n[1] - 1)),
+	.loc 1 247 36 view .LVU234
+	movsd	32(%rbp), %xmm0	# tt_28->n[0], tt_28->n[0]
+	subsd	.LC8(%rip), %xmm0	#, tmp135
+# dudect/fixture.c:240:     printf(
+	.loc 1 240 5 view .LVU235
+	movq	%r14, %xmm6	# _9, _16
+	divsd	%xmm0, %xmm6	# tmp135, _16
+	pxor	%xmm0, %xmm0	# tmp138
+	ucomisd	%xmm6, %xmm0	# _16, tmp138
+	ja	.L75	#,
+	sqrtsd	%xmm6, %xmm6	# _16, _17
+.L65:
+# dudect/fixture.c:246:         tt->mean[0], tt->mean[1], tt->mean[1] - tt->mean[0],
+	.loc 1 246 43 view .LVU236
+	movsd	8(%rbp), %xmm4	# tt_28->mean[1], _18
+# dudect/fixture.c:246:         tt->mean[0], tt->mean[1], tt->mean[1] - tt->mean[0],
+	.loc 1 246 57 view .LVU237
+	movsd	0(%rbp), %xmm3	# tt_28->mean[0], _19
+# dudect/fixture.c:245:         mt, max_t, max_tau, (double) (5 * 5) / (double) (max_tau * max_tau),
+	.loc 1 245 48 view .LVU238
+	movsd	8(%rsp), %xmm1	# %sfp, max_tau
+	movapd	%xmm1, %xmm0	# max_tau, tmp140
+	mulsd	%xmm1, %xmm0	# max_tau, tmp140
+# dudect/fixture.c:240:     printf(
+	.loc 1 240 5 view .LVU239
+	pushq	%r15	# _8
+	.cfi_def_cfa_offset 88
+	pushq	%r14	# _9
+	.cfi_def_cfa_offset 96
+	movq	%rbx, %xmm7	# _13,
+	movapd	%xmm4, %xmm5	# _18, tmp167
+	subsd	%xmm3, %xmm5	# _19, tmp167
+	movsd	.LC9(%rip), %xmm2	#, tmp142
+	divsd	%xmm0, %xmm2	# tmp140,
+	movq	%r12, %xmm0	# max_t,
+	movl	%r13d, %esi	# mt,
+	leaq	.LC10(%rip), %rdi	#, tmp143
+	movl	$8, %eax	#,
+	call	printf@PLT	#
+.LVL101:
+	.loc 1 250 5 is_stmt 1 view .LVU240
+# dudect/fixture.c:250:     if (max_t > t_threshold_bananas) {
+	.loc 1 250 8 is_stmt 0 view .LVU241
+	addq	$16, %rsp	#,
+	.cfi_def_cfa_offset 80
+# dudect/fixture.c:251:         return false;
+	.loc 1 251 16 view .LVU242
+	movl	$0, %eax	#, <retval>
+# dudect/fixture.c:250:     if (max_t > t_threshold_bananas) {
+	.loc 1 250 8 view .LVU243
+	movq	%r12, %xmm7	# max_t, max_t
+	comisd	.LC11(%rip), %xmm7	#, max_t
+	ja	.L53	#,
+.LVL102:
+	.loc 1 252 12 is_stmt 1 view .LVU244
+# dudect/fixture.c:252:     } else if (max_t > t_threshold_moderate) {
+	.loc 1 252 15 is_stmt 0 view .LVU245
+	comisd	.LC12(%rip), %xmm7	#, max_t
+	setbe	%al	#, <retval>
+.L53:
+# dudect/fixture.c:257: }
+	.loc 1 257 1 view .LVU246
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL103:
+	.loc 1 257 1 view .LVU247
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL104:
+	.loc 1 257 1 view .LVU248
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL105:
+.L72:
+	.cfi_restore_state
+# dudect/fixture.c:214:     double max_tau = max_t / sqrt(number_traces_max_t);
+	.loc 1 214 30 view .LVU249
+	movq	%rbx, %xmm0	# number_traces_max_t,
+	call	sqrt@PLT	#
+.LVL106:
+	jmp	.L56	#
+.LVL107:
+.L73:
+	.loc 1 226 9 is_stmt 1 view .LVU250
+	movl	$10, %edi	#,
+	call	putchar@PLT	#
+.LVL108:
+	jmp	.L59	#
+.L74:
+# dudect/fixture.c:240:     printf(
+	.loc 1 240 5 is_stmt 0 view .LVU251
+	movapd	%xmm1, %xmm0	# _12,
+	call	sqrt@PLT	#
+.LVL109:
+	movq	%xmm0, %rbx	# tmp151, _13
+.LVL110:
+	.loc 1 240 5 view .LVU252
+	jmp	.L62	#
+.L75:
+	.loc 1 240 5 view .LVU253
+	movapd	%xmm6, %xmm0	# _16,
+	call	sqrt@PLT	#
+.LVL111:
+	movapd	%xmm0, %xmm6	# tmp152, _17
+	jmp	.L65	#
+	.cfi_endproc
+.LFE35:
+	.size	report, .-report
+	.section	.rodata.str1.1
+.LC13:
+	.string	"Worker %d failed\n"
+	.text
+	.type	run_workers, @function
+run_workers:
+.LVL112:
+.LFB41:
+	.loc 1 388 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 388 1 is_stmt 0 view .LVU255
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$6408, %rsp	#,
+	.cfi_def_cfa_offset 6464
+	movl	%edi, %r15d	# tmp227, mode
+	movl	%esi, %r13d	# tmp228, batches
+	.loc 1 389 5 is_stmt 1 view .LVU256
+.LVL113:
+	.loc 1 390 5 view .LVU257
+# dudect/fixture.c:389:     int nworkers = dudect_workers < MAX_WORKERS ? dudect_workers : MAX_WORKERS;
+	.loc 1 389 9 is_stmt 0 view .LVU258
+	movl	dudect_workers(%rip), %eax	# dudect_workers, dudect_workers
+	movl	$64, %edx	#, tmp237
+	cmpl	%edx, %eax	# tmp237, dudect_workers
+	cmovg	%edx, %eax	# dudect_workers,, tmp237, nworkers
+	cmpl	%esi, %eax	# batches, nworkers
+	cmovg	%esi, %eax	# nworkers,, batches, nworkers
+	movl	%eax, %ebx	# nworkers, _53
+	movl	%eax, 28(%rsp)	# _53, %sfp
+.LVL114:
+	.loc 1 392 5 is_stmt 1 view .LVU259
+# dudect/fixture.c:392:     long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+	.loc 1 392 17 is_stmt 0 view .LVU260
+	movl	$84, %edi	#,
+.LVL115:
+	.loc 1 392 17 view .LVU261
+	call	sysconf@PLT	#
+.LVL116:
+	.loc 1 392 17 view .LVU262
+	movq	%rax, %r14	# tmp229, ncpu
+.LVL117:
+	.loc 1 393 5 is_stmt 1 view .LVU263
+	.loc 1 395 5 view .LVU264
+	.loc 1 396 5 view .LVU265
+	.loc 1 399 5 view .LVU266
+	movl	$0, %eax	#,
+.LVL118:
+	.loc 1 399 5 is_stmt 0 view .LVU267
+	call	report_flush@PLT	#
+.LVL119:
+	.loc 1 400 5 is_stmt 1 view .LVU268
+	movq	stdout(%rip), %rdi	# stdout,
+	call	fflush@PLT	#
+.LVL120:
+	.loc 1 401 5 view .LVU269
+.LBB79:
+	.loc 1 401 10 view .LVU270
+	.loc 1 401 23 view .LVU271
+	testl	%ebx, %ebx	# _53
+	jle	.L78	#,
+	movslq	%ebx, %r12	# _53, _77
+	movl	$0, %ebx	#, ivtmp.179
+.LVL121:
+.LBB80:
+# dudect/fixture.c:403:         if (pipe(pfd) < 0)
+	.loc 1 403 13 is_stmt 0 view .LVU272
+	leaq	40(%rsp), %rbp	#, tmp160
+.LVL122:
+.L87:
+	.loc 1 402 9 is_stmt 1 view .LVU273
+	.loc 1 403 9 view .LVU274
+# dudect/fixture.c:403:         if (pipe(pfd) < 0)
+	.loc 1 403 13 is_stmt 0 view .LVU275
+	movq	%rbp, %rdi	# tmp160,
+	call	pipe@PLT	#
+.LVL123:
+# dudect/fixture.c:403:         if (pipe(pfd) < 0)
+	.loc 1 403 12 view .LVU276
+	testl	%eax, %eax	# tmp230
+	js	.L112	#,
+	.loc 1 405 9 is_stmt 1 view .LVU277
+# dudect/fixture.c:405:         pids[w] = fork();
+	.loc 1 405 19 is_stmt 0 view .LVU278
+	call	fork@PLT	#
+.LVL124:
+# dudect/fixture.c:405:         pids[w] = fork();
+	.loc 1 405 17 view .LVU279
+	movl	%eax, 6144(%rsp,%rbx,4)	# tmp161, MEM[(int *)&pids + ivtmp.179_135 * 4]
+	.loc 1 406 9 is_stmt 1 view .LVU280
+# dudect/fixture.c:406:         if (pids[w] < 0)
+	.loc 1 406 12 is_stmt 0 view .LVU281
+	testl	%eax, %eax	# tmp161
+	js	.L113	#,
+	.loc 1 408 9 is_stmt 1 view .LVU282
+# dudect/fixture.c:408:         if (pids[w] == 0) {
+	.loc 1 408 12 is_stmt 0 view .LVU283
+	je	.L114	#,
+	.loc 1 426 9 is_stmt 1 discriminator 2 view .LVU284
+	movl	44(%rsp), %edi	# pfd[1],
+	call	close@PLT	#
+.LVL125:
+	.loc 1 427 9 discriminator 2 view .LVU285
+# dudect/fixture.c:427:         fds[w] = pfd[0];
+	.loc 1 427 16 is_stmt 0 discriminator 2 view .LVU286
+	movl	40(%rsp), %eax	# pfd[0], pfd[0]
+	movl	%eax, 5888(%rsp,%rbx,4)	# pfd[0], MEM[(int *)&fds + ivtmp.179_135 * 4]
+.LBE80:
+	.loc 1 401 36 is_stmt 1 discriminator 2 view .LVU287
+.LVL126:
+	.loc 1 401 23 discriminator 2 view .LVU288
+	addq	$1, %rbx	#, ivtmp.179
+.LVL127:
+	.loc 1 401 23 is_stmt 0 discriminator 2 view .LVU289
+	cmpq	%rbx, %r12	# ivtmp.179, _77
+	jne	.L87	#,
+.LVL128:
+.L78:
+	.loc 1 401 23 discriminator 2 view .LVU290
+.LBE79:
+.LBB97:
+	.loc 1 433 23 is_stmt 1 view .LVU291
+	leaq	176(%rsp), %rax	#, ivtmp.176
+	leaq	5072(%rsp), %rdx	#, ivtmp.177
+	movq	%rdx, %rcx	# ivtmp.177, _138
+.LVL129:
+.L88:
+	.loc 1 434 9 discriminator 3 view .LVU292
+# dudect/fixture.c:434:         wt[i] = &wctx[i];
+	.loc 1 434 15 is_stmt 0 discriminator 3 view .LVU293
+	movq	%rax, (%rdx)	# ivtmp.176, MEM[(struct t_ctx * *)_140]
+	.loc 1 433 40 is_stmt 1 discriminator 3 view .LVU294
+.LVL130:
+	.loc 1 433 23 discriminator 3 view .LVU295
+	addq	$48, %rax	#, ivtmp.176
+.LVL131:
+	.loc 1 433 23 is_stmt 0 discriminator 3 view .LVU296
+	addq	$8, %rdx	#, ivtmp.177
+.LVL132:
+	.loc 1 433 23 discriminator 3 view .LVU297
+	cmpq	%rax, %rcx	# ivtmp.176, _138
+	jne	.L88	#,
+.LVL133:
+	.loc 1 433 23 discriminator 3 view .LVU298
+.LBE97:
+.LBB98:
+	.loc 1 435 23 is_stmt 1 view .LVU299
+	movl	28(%rsp), %eax	# %sfp, _53
+	testl	%eax, %eax	# _53
+	jle	.L98	#,
+	leaq	worker_result(%rip), %r15	#, ivtmp.168
+.LVL134:
+	.loc 1 435 23 is_stmt 0 view .LVU300
+	cltq
+	movq	%rax, 8(%rsp)	# _46, %sfp
+	movl	$0, %r14d	#, ivtmp.163
+.LVL135:
+	.loc 1 435 23 view .LVU301
+.LBE98:
+# dudect/fixture.c:430:     bool ok = true;
+	.loc 1 430 10 view .LVU302
+	movb	$1, 27(%rsp)	#, %sfp
+.LBB110:
+.LBB99:
+# dudect/fixture.c:439:         waitpid(pids[w], &status, 0);
+	.loc 1 439 9 view .LVU303
+	leaq	48(%rsp), %rax	#, tmp223
+	movq	%rax, 16(%rsp)	# tmp223, %sfp
+.LBB100:
+# dudect/fixture.c:450:             t_merge(t[i], wt[i]);
+	.loc 1 450 13 view .LVU304
+	leaq	t(%rip), %r12	#, tmp226
+	jmp	.L95	#
+.LVL136:
+.L112:
+	.loc 1 450 13 view .LVU305
+.LBE100:
+.LBE99:
+.LBE110:
+.LBB111:
+.LBB94:
+	.loc 1 404 13 is_stmt 1 view .LVU306
+.LBB81:
+.LBI81:
+	.loc 1 88 39 view .LVU307
+.LBB82:
+	.loc 1 90 5 view .LVU308
+	movl	$111, %edi	#,
+	call	exit@PLT	#
+.LVL137:
+.L113:
+.LBE82:
+.LBE81:
+	.loc 1 407 13 view .LVU309
+.LBB83:
+.LBI83:
+	.loc 1 88 39 view .LVU310
+.LBB84:
+	.loc 1 90 5 view .LVU311
+	movl	$111, %edi	#,
+	call	exit@PLT	#
+.LVL138:
+.L114:
+	movl	%ebx, %ebp	# ivtmp.179, w
+.LBE84:
+.LBE83:
+.LBB85:
+	.loc 1 409 13 view .LVU312
+	movl	40(%rsp), %edi	# pfd[0],
+	call	close@PLT	#
+.LVL139:
+	.loc 1 410 13 view .LVU313
+	.loc 1 411 13 view .LVU314
+	.loc 1 411 13 view .LVU315
+	leaq	48(%rsp), %rdx	#, tmp165
+	movl	$16, %ecx	#, tmp168
+	movl	$0, %eax	#, tmp167
+	movq	%rdx, %rdi	# tmp165, tmp165
+	rep stosq
+	.loc 1 411 13 view .LVU316
+	.loc 1 412 13 view .LVU317
+.LBB86:
+	.loc 1 412 13 view .LVU318
+	movslq	%ebx, %rax	# ivtmp.179, w
+.LBE86:
+.LBE85:
+.LBE94:
+.LBE111:
+# dudect/fixture.c:393:     if (ncpu < 1)
+	.loc 1 393 8 is_stmt 0 view .LVU319
+	testq	%r14, %r14	# ncpu
+	movl	$1, %edx	#, tmp236
+	cmovle	%rdx, %r14	# ncpu,, tmp236, tmp170
+.LVL140:
+.LBB112:
+.LBB95:
+.LBB92:
+.LBB87:
+# dudect/fixture.c:412:             CPU_SET(w % ncpu, &set);
+	.loc 1 412 13 view .LVU320
+	cqto
+	idivq	%r14	# tmp170
+.LVL141:
+	.loc 1 412 13 is_stmt 1 view .LVU321
+	cmpq	$1023, %rdx	#, tmp171
+	ja	.L82	#,
+# dudect/fixture.c:412:             CPU_SET(w % ncpu, &set);
+	.loc 1 412 13 is_stmt 0 discriminator 1 view .LVU322
+	movq	%rdx, %rsi	# tmp171, tmp174
+	shrq	$6, %rsi	#, tmp174
+	movl	$1, %eax	#, tmp178
+	movl	%edx, %ecx	# tmp171, tmp245
+	salq	%cl, %rax	# tmp245, tmp177
+	orq	%rax, 48(%rsp,%rsi,8)	# tmp177, *_9
+.L82:
+.LBE87:
+	.loc 1 413 13 is_stmt 1 discriminator 4 view .LVU323
+	leaq	48(%rsp), %rdx	#, tmp179
+.LVL142:
+	.loc 1 413 13 is_stmt 0 discriminator 4 view .LVU324
+	movl	$128, %esi	#,
+	movl	$0, %edi	#,
+	call	sched_setaffinity@PLT	#
+.LVL143:
+	.loc 1 414 13 is_stmt 1 discriminator 4 view .LVU325
+	call	timer_setup@PLT	#
+.LVL144:
+	.loc 1 416 13 discriminator 4 view .LVU326
+	leaq	crop_samples(%rip), %rdi	#, tmp180
+	call	pwindow_free@PLT	#
+.LVL145:
+	.loc 1 417 13 discriminator 4 view .LVU327
+.LBB88:
+	.loc 1 417 18 discriminator 4 view .LVU328
+	.loc 1 417 31 discriminator 4 view .LVU329
+	leaq	t(%rip), %rbx	#, ivtmp.152
+.LVL146:
+	.loc 1 417 31 is_stmt 0 discriminator 4 view .LVU330
+	leaq	816(%rbx), %r12	#, _119
+.LVL147:
+.L83:
+	.loc 1 418 17 is_stmt 1 discriminator 3 view .LVU331
+	movq	(%rbx), %rdi	# MEM[(struct t_ctx * *)_125], MEM[(struct t_ctx * *)_125]
+	call	t_init@PLT	#
+.LVL148:
+	.loc 1 417 48 discriminator 3 view .LVU332
+	.loc 1 417 31 discriminator 3 view .LVU333
+	addq	$8, %rbx	#, ivtmp.152
+.LVL149:
+	.loc 1 417 31 is_stmt 0 discriminator 3 view .LVU334
+	cmpq	%r12, %rbx	# _119, ivtmp.152
+	jne	.L83	#,
+.LVL150:
+	.loc 1 417 31 discriminator 3 view .LVU335
+.LBE88:
+.LBB89:
+	.loc 1 419 31 is_stmt 1 view .LVU336
+	cmpl	%ebp, %r13d	# w, batches
+	jle	.L84	#,
+.LVL151:
+.L85:
+	.loc 1 420 17 discriminator 3 view .LVU337
+	movl	%r15d, %edi	# mode,
+	call	measure_batch	#
+.LVL152:
+	.loc 1 419 44 discriminator 3 view .LVU338
+	movl	28(%rsp), %eax	# %sfp, _53
+	addl	%eax, %ebp	# _53, w
+.LVL153:
+	.loc 1 419 31 discriminator 3 view .LVU339
+	cmpl	%ebp, %r13d	# w, batches
+	jg	.L85	#,
+.LVL154:
+.L84:
+	.loc 1 419 31 is_stmt 0 discriminator 3 view .LVU340
+.LBE89:
+.LBB90:
+	.loc 1 422 46 is_stmt 1 view .LVU341
+.LBE90:
+.LBE92:
+.LBE95:
+# dudect/fixture.c:401:     for (int w = 0; w < nworkers; w++) {
+	.loc 1 401 23 is_stmt 0 view .LVU342
+	movl	$1, %ebx	#, ivtmp.138
+.LVL155:
+.LBB96:
+.LBB93:
+.LBB91:
+# dudect/fixture.c:423:                 ok = write(pfd[1], t[i], sizeof(t_ctx)) == sizeof(t_ctx);
+	.loc 1 423 37 view .LVU343
+	leaq	-8+t(%rip), %rbp	#, tmp182
+.LVL156:
+.L86:
+	.loc 1 423 17 is_stmt 1 discriminator 3 view .LVU344
+# dudect/fixture.c:423:                 ok = write(pfd[1], t[i], sizeof(t_ctx)) == sizeof(t_ctx);
+	.loc 1 423 22 is_stmt 0 discriminator 3 view .LVU345
+	movq	0(%rbp,%rbx,8), %rsi	# MEM[(struct t_ctx * *)&t + -8B + ivtmp.138_170 * 8], MEM[(struct t_ctx * *)&t + -8B + ivtmp.138_170 * 8]
+	movl	$48, %edx	#,
+	movl	44(%rsp), %edi	# pfd[1],
+	call	write@PLT	#
+.LVL157:
+	.loc 1 422 54 is_stmt 1 discriminator 3 view .LVU346
+	.loc 1 422 46 discriminator 3 view .LVU347
+# dudect/fixture.c:422:             for (int i = 0; i < number_tests && ok; i++)
+	.loc 1 422 31 is_stmt 0 discriminator 3 view .LVU348
+	cmpl	$101, %ebx	#, ivtmp.138
+	setle	%cl	#, tmp186
+# dudect/fixture.c:423:                 ok = write(pfd[1], t[i], sizeof(t_ctx)) == sizeof(t_ctx);
+	.loc 1 423 20 discriminator 3 view .LVU349
+	cmpq	$48, %rax	#, _18
+	sete	%dl	#, ok
+# dudect/fixture.c:422:             for (int i = 0; i < number_tests && ok; i++)
+	.loc 1 422 46 discriminator 3 view .LVU350
+	addq	$1, %rbx	#, ivtmp.138
+.LVL158:
+	.loc 1 422 46 discriminator 3 view .LVU351
+	testb	%dl, %cl	# ok, tmp186
+	jne	.L86	#,
+.LBE91:
+	.loc 1 424 13 is_stmt 1 view .LVU352
+	cmpq	$48, %rax	#, _18
+	setne	%dil	#, tmp189
+	movzbl	%dil, %edi	# tmp189, tmp189
+	call	_exit@PLT	#
+.LVL159:
+.L115:
+	.loc 1 424 13 is_stmt 0 view .LVU353
+.LBE93:
+.LBE96:
+.LBE112:
+.LBB113:
+.LBB107:
+	.loc 1 445 9 is_stmt 1 view .LVU354
+# dudect/fixture.c:445:         int mt = max_test(wt, enough_measurements / nworkers);
+	.loc 1 445 51 is_stmt 0 view .LVU355
+	movl	$10000, %eax	#, tmp197
+	movl	$0, %edx	#, tmp198
+	idivl	28(%rsp)	# %sfp
+# dudect/fixture.c:445:         int mt = max_test(wt, enough_measurements / nworkers);
+	.loc 1 445 18 view .LVU356
+	pxor	%xmm0, %xmm0	# tmp200
+	cvtsi2sdl	%eax, %xmm0	# tmp197, tmp200
+	leaq	5072(%rsp), %rdi	#, tmp201
+	call	max_test	#
+.LVL160:
+	.loc 1 446 9 is_stmt 1 view .LVU357
+# dudect/fixture.c:446:         worker_result[w].test = mt;
+	.loc 1 446 31 is_stmt 0 view .LVU358
+	movl	%eax, (%r15)	# mt, MEM[(int *)_45]
+	.loc 1 447 9 is_stmt 1 view .LVU359
+# dudect/fixture.c:447:         worker_result[w].max_t = fabs(t_compute(wt[mt]));
+	.loc 1 447 39 is_stmt 0 view .LVU360
+	cltq
+.LVL161:
+	.loc 1 447 39 view .LVU361
+	movq	5072(%rsp,%rax,8), %rbp	# wt[mt_81], _35
+	movq	%rbp, %rdi	# _35,
+	call	t_compute@PLT	#
+.LVL162:
+# dudect/fixture.c:447:         worker_result[w].max_t = fabs(t_compute(wt[mt]));
+	.loc 1 447 34 view .LVU362
+	andpd	.LC3(%rip), %xmm0	#, tmp203
+# dudect/fixture.c:447:         worker_result[w].max_t = fabs(t_compute(wt[mt]));
+	.loc 1 447 32 view .LVU363
+	movsd	%xmm0, 8(%r15)	# tmp203, MEM[(double *)_45 + 8B]
+	.loc 1 448 9 is_stmt 1 view .LVU364
+# dudect/fixture.c:448:         worker_result[w].measurements = wt[mt]->n[0] + wt[mt]->n[1];
+	.loc 1 448 54 is_stmt 0 view .LVU365
+	movsd	32(%rbp), %xmm0	# _35->n[0], _35->n[0]
+	addsd	40(%rbp), %xmm0	# _35->n[1], tmp205
+# dudect/fixture.c:448:         worker_result[w].measurements = wt[mt]->n[0] + wt[mt]->n[1];
+	.loc 1 448 39 view .LVU366
+	movsd	%xmm0, 16(%r15)	# tmp205, MEM[(double *)_45 + 16B]
+	.loc 1 449 9 is_stmt 1 view .LVU367
+.LBB101:
+	.loc 1 449 14 view .LVU368
+.LVL163:
+	.loc 1 449 27 view .LVU369
+.L94:
+	.loc 1 450 13 discriminator 3 view .LVU370
+	movq	5072(%rsp,%rbx), %rsi	# MEM[(struct t_ctx * *)&wt + ivtmp.161_144 * 1], MEM[(struct t_ctx * *)&wt + ivtmp.161_144 * 1]
+	movq	(%r12,%rbx), %rdi	# MEM[(struct t_ctx * *)&t + ivtmp.161_144 * 1], MEM[(struct t_ctx * *)&t + ivtmp.161_144 * 1]
+	call	t_merge@PLT	#
+.LVL164:
+	.loc 1 449 44 discriminator 3 view .LVU371
+	.loc 1 449 27 discriminator 3 view .LVU372
+	addq	$8, %rbx	#, ivtmp.161
+.LVL165:
+	.loc 1 449 27 is_stmt 0 discriminator 3 view .LVU373
+	cmpq	$816, %rbx	#, ivtmp.161
+	jne	.L94	#,
+	jmp	.L93	#
+.LVL166:
+.L116:
+	.loc 1 449 27 discriminator 3 view .LVU374
+.LBE101:
+.LBE107:
+.LBE113:
+	.loc 1 452 5 is_stmt 1 view .LVU375
+# dudect/fixture.c:452:     worker_cnt = ok ? nworkers : 0;
+	.loc 1 452 32 is_stmt 0 view .LVU376
+	cmpb	$0, 27(%rsp)	#, %sfp
+	movl	$0, %eax	#, tmp222
+	cmovne	28(%rsp), %eax	# %sfp,, tmp222
+	movl	%eax, 28(%rsp)	# tmp222, %sfp
+.LVL167:
+.L89:
+# dudect/fixture.c:452:     worker_cnt = ok ? nworkers : 0;
+	.loc 1 452 16 discriminator 4 view .LVU377
+	movl	28(%rsp), %eax	# %sfp, _53
+	movl	%eax, worker_cnt(%rip)	# _53, worker_cnt
+	.loc 1 453 5 is_stmt 1 discriminator 4 view .LVU378
+# dudect/fixture.c:454: }
+	.loc 1 454 1 is_stmt 0 discriminator 4 view .LVU379
+	movzbl	27(%rsp), %eax	# %sfp,
+	addq	$6408, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL168:
+.L98:
+	.cfi_restore_state
+# dudect/fixture.c:430:     bool ok = true;
+	.loc 1 430 10 view .LVU380
+	movb	$1, 27(%rsp)	#, %sfp
+	jmp	.L89	#
+.LVL169:
+.L90:
+.LBB114:
+.LBB108:
+	.loc 1 438 9 is_stmt 1 view .LVU381
+	movl	%r13d, %edi	# _26,
+	call	close@PLT	#
+.LVL170:
+	.loc 1 439 9 view .LVU382
+	movl	6144(%rsp,%r14,4), %edi	# MEM[(int *)&pids + ivtmp.163_50 * 4], MEM[(int *)&pids + ivtmp.163_50 * 4]
+	movl	$0, %edx	#,
+	movq	16(%rsp), %rsi	# %sfp,
+	call	waitpid@PLT	#
+.LVL171:
+	.loc 1 440 9 view .LVU383
+	jmp	.L96	#
+.LVL172:
+.L117:
+	.loc 1 438 9 view .LVU384
+	movl	%r13d, %edi	# _26,
+	call	close@PLT	#
+.LVL173:
+	.loc 1 439 9 view .LVU385
+	movl	6144(%rsp,%r14,4), %edi	# MEM[(int *)&pids + ivtmp.163_50 * 4], MEM[(int *)&pids + ivtmp.163_50 * 4]
+	movl	$0, %edx	#,
+	movq	16(%rsp), %rsi	# %sfp,
+	call	waitpid@PLT	#
+.LVL174:
+	.loc 1 440 9 view .LVU386
+# dudect/fixture.c:440:         if (!got || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+	.loc 1 440 22 is_stmt 0 view .LVU387
+	movl	48(%rsp), %eax	# MEM[(int *)_57], status.46_29
+# dudect/fixture.c:440:         if (!got || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+	.loc 1 440 43 view .LVU388
+	movzbl	%ah, %edx	# status.46_29, tmp219
+# dudect/fixture.c:440:         if (!got || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+	.loc 1 440 22 view .LVU389
+	andl	$127, %eax	#, tmp220
+# dudect/fixture.c:440:         if (!got || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+	.loc 1 440 40 view .LVU390
+	orl	%eax, %edx	# tmp220, tmp238
+	je	.L115	#,
+.LVL175:
+.L96:
+	.loc 1 441 13 is_stmt 1 discriminator 5 view .LVU391
+	movl	4(%rsp), %esi	# %sfp,
+	leaq	.LC13(%rip), %rdi	#,
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL176:
+	.loc 1 442 13 discriminator 5 view .LVU392
+	.loc 1 443 13 discriminator 5 view .LVU393
+# dudect/fixture.c:442:             ok = false;
+	.loc 1 442 16 is_stmt 0 discriminator 5 view .LVU394
+	movb	$0, 27(%rsp)	#, %sfp
+.LVL177:
+.L93:
+	.loc 1 442 16 discriminator 5 view .LVU395
+.LBE108:
+	.loc 1 435 36 is_stmt 1 discriminator 2 view .LVU396
+	.loc 1 435 23 discriminator 2 view .LVU397
+	addq	$1, %r14	#, ivtmp.163
+.LVL178:
+	.loc 1 435 23 is_stmt 0 discriminator 2 view .LVU398
+	addq	$32, %r15	#, ivtmp.168
+	cmpq	%r14, 8(%rsp)	# ivtmp.163, %sfp
+	je	.L116	#,
+.LVL179:
+.L95:
+	.loc 1 435 23 discriminator 2 view .LVU399
+	movl	%r14d, 4(%rsp)	# ivtmp.163, %sfp
+.LVL180:
+.LBB109:
+	.loc 1 436 9 is_stmt 1 view .LVU400
+	.loc 1 437 9 view .LVU401
+# dudect/fixture.c:437:         bool got = read_all(fds[w], wctx, sizeof(wctx));
+	.loc 1 437 20 is_stmt 0 view .LVU402
+	movl	5888(%rsp,%r14,4), %r13d	# MEM[(int *)&fds + ivtmp.163_50 * 4], _26
+.LVL181:
+.LBB102:
+.LBI102:
+	.loc 1 368 13 is_stmt 1 view .LVU403
+.LBB103:
+	.loc 1 370 5 view .LVU404
+	.loc 1 371 5 view .LVU405
+	.loc 1 371 16 view .LVU406
+.LBE103:
+.LBE102:
+# dudect/fixture.c:437:         bool got = read_all(fds[w], wctx, sizeof(wctx));
+	.loc 1 437 20 is_stmt 0 view .LVU407
+	movl	$4896, %ebx	#, ivtmp.161
+.LBB106:
+.LBB105:
+# dudect/fixture.c:370:     char *p = buf;
+	.loc 1 370 11 view .LVU408
+	leaq	176(%rsp), %rbp	#, p
+.LVL182:
+.L91:
+.LBB104:
+	.loc 1 372 9 is_stmt 1 view .LVU409
+# dudect/fixture.c:372:         ssize_t n = read(fd, p, len);
+	.loc 1 372 21 is_stmt 0 view .LVU410
+	movq	%rbx, %rdx	# ivtmp.161,
+	movq	%rbp, %rsi	# p,
+	movl	%r13d, %edi	# _26,
+	call	read@PLT	#
+.LVL183:
+	.loc 1 373 9 is_stmt 1 view .LVU411
+# dudect/fixture.c:373:         if (n <= 0)
+	.loc 1 373 12 is_stmt 0 view .LVU412
+	testq	%rax, %rax	# n
+	jle	.L90	#,
+	.loc 1 375 9 is_stmt 1 view .LVU413
+# dudect/fixture.c:375:         p += n;
+	.loc 1 375 11 is_stmt 0 view .LVU414
+	addq	%rax, %rbp	# n, p
+.LVL184:
+	.loc 1 376 9 is_stmt 1 view .LVU415
+	.loc 1 376 9 is_stmt 0 view .LVU416
+.LBE104:
+	.loc 1 371 16 is_stmt 1 view .LVU417
+	subq	%rax, %rbx	# n, ivtmp.161
+.LVL185:
+	.loc 1 371 16 is_stmt 0 view .LVU418
+	jne	.L91	#,
+	jmp	.L117	#
+.LBE105:
+.LBE106:
+.LBE109:
+.LBE114:
+	.cfi_endproc
+.LFE41:
+	.size	run_workers, .-run_workers
+	.section	.rodata.str1.1
+.LC15:
+	.string	"Testing %s...\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC18:
+	.string	"per element: %.2f at n, %.2f at 2n, ratio %.2f\n"
+	.section	.rodata.str1.1
+.LC21:
+	.string	"Testing %s...\n\n\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC23:
+	.string	"worker %d: max t [%d]: %+7.2f, meas: %7.2lf M\n"
+	.align 8
+.LC27:
+	.string	"settled after %d of %d batches\n"
+	.section	.rodata.str1.1
+.LC29:
+	.string	"%.0f samples/s\n"
+	.text
+	.globl	check_op
+	.type	check_op, @function
+check_op:
+.LVL186:
+.LFB44:
+	.loc 1 546 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 546 1 is_stmt 0 view .LVU420
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp	#,
+	.cfi_def_cfa_offset 128
+	movl	%edi, %r13d	# tmp385, mode
+	.loc 1 547 5 is_stmt 1 view .LVU421
+.LVL187:
+	.loc 1 548 5 view .LVU422
+# dudect/fixture.c:548:     if (op->linear) {
+	.loc 1 548 11 is_stmt 0 view .LVU423
+	movslq	%edi, %rax	# mode, mode
+	leaq	(%rax,%rax,2), %rax	#, tmp205
+	salq	$4, %rax	#, tmp206
+# dudect/fixture.c:548:     if (op->linear) {
+	.loc 1 548 8 view .LVU424
+	leaq	dut_ops(%rip), %rdx	#, tmp201
+	cmpb	$0, 8(%rdx,%rax)	#, MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_6(D)].linear
+	jne	.L173	#,
+	.loc 1 553 5 is_stmt 1 view .LVU425
+# dudect/fixture.c:553:     bool result = test_const(op->name, mode);
+	.loc 1 553 32 is_stmt 0 view .LVU426
+	movslq	%edi, %rax	# mode, mode
+	leaq	(%rax,%rax,2), %rax	#, tmp271
+	salq	$4, %rax	#, tmp272
+	leaq	dut_ops(%rip), %rdx	#, tmp266
+	movq	(%rdx,%rax), %r14	# MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_6(D)].name, _3
+.LVL188:
+.LBB136:
+.LBI136:
+	.loc 1 497 13 is_stmt 1 view .LVU427
+.LBB137:
+	.loc 1 499 5 view .LVU428
+	.loc 1 500 5 view .LVU429
+.LBB138:
+	.loc 1 500 10 view .LVU430
+	.loc 1 500 23 view .LVU431
+	leaq	t(%rip), %rbx	#, ivtmp.213
+	leaq	816(%rbx), %rbp	#, _277
+.LBE138:
+.LBE137:
+.LBE136:
+# dudect/fixture.c:553:     bool result = test_const(op->name, mode);
+	.loc 1 553 32 is_stmt 0 view .LVU432
+	movq	%rbx, %r12	# ivtmp.213, ivtmp.242
+.LVL189:
+.L133:
+.LBB167:
+.LBB164:
+.LBB139:
+	.loc 1 501 9 is_stmt 1 view .LVU433
+# dudect/fixture.c:501:         t[i] = malloc(sizeof(t_ctx));
+	.loc 1 501 16 is_stmt 0 view .LVU434
+	movl	$48, %edi	#,
+	call	malloc@PLT	#
+.LVL190:
+# dudect/fixture.c:501:         t[i] = malloc(sizeof(t_ctx));
+	.loc 1 501 14 view .LVU435
+	movq	%rax, (%r12)	# tmp388, MEM[(struct t_ctx * *)_275]
+	.loc 1 500 39 is_stmt 1 view .LVU436
+.LVL191:
+	.loc 1 500 23 view .LVU437
+	addq	$8, %r12	#, ivtmp.242
+.LVL192:
+	.loc 1 500 23 is_stmt 0 view .LVU438
+	cmpq	%rbp, %r12	# _277, ivtmp.242
+	jne	.L133	#,
+.LBE139:
+	.loc 1 504 5 is_stmt 1 view .LVU439
+	call	timer_setup@PLT	#
+.LVL193:
+	.loc 1 505 5 view .LVU440
+	movq	%r14, %rsi	# _3,
+	leaq	.LC21(%rip), %rdi	#, tmp275
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL194:
+	.loc 1 506 5 view .LVU441
+.LBB140:
+.LBI140:
+	.loc 1 350 13 view .LVU442
+.LBB141:
+	.loc 1 352 5 view .LVU443
+	movl	$0, %eax	#,
+	call	init_dut@PLT	#
+.LVL195:
+	.loc 1 353 5 view .LVU444
+.LBB142:
+	.loc 1 353 10 view .LVU445
+	.loc 1 353 23 view .LVU446
+.LBE142:
+# dudect/fixture.c:352:     init_dut();
+	.loc 1 352 5 is_stmt 0 view .LVU447
+	movq	%rbx, %r12	# ivtmp.213, ivtmp.235
+.LVL196:
+.L134:
+.LBB143:
+	.loc 1 354 9 is_stmt 1 view .LVU448
+	movq	(%r12), %rdi	# MEM[(struct t_ctx * *)_269], MEM[(struct t_ctx * *)_269]
+	call	t_init@PLT	#
+.LVL197:
+	.loc 1 353 39 view .LVU449
+	.loc 1 353 23 view .LVU450
+	addq	$8, %r12	#, ivtmp.235
+.LVL198:
+	.loc 1 353 23 is_stmt 0 view .LVU451
+	cmpq	%rbp, %r12	# _277, ivtmp.235
+	jne	.L134	#,
+.LBE143:
+	.loc 1 356 5 is_stmt 1 view .LVU452
+	leaq	center(%rip), %rdi	#, tmp277
+	call	t_init@PLT	#
+.LVL199:
+	.loc 1 357 5 view .LVU453
+.LBB144:
+.LBI144:
+	.loc 1 95 13 view .LVU454
+	.loc 1 97 5 view .LVU455
+.LBB145:
+	.loc 1 97 10 view .LVU456
+	.loc 1 97 26 view .LVU457
+# dudect/fixture.c:97:     for (size_t i = 0; i < number_percentiles; i++) {
+	.loc 1 97 17 is_stmt 0 view .LVU458
+	movl	$0, %r12d	#, i
+.LVL200:
+	.loc 1 97 17 view .LVU459
+	jmp	.L137	#
+.LVL201:
+.L173:
+	.loc 1 97 17 view .LVU460
+.LBE145:
+.LBE144:
+.LBE141:
+.LBE140:
+.LBE164:
+.LBE167:
+	.loc 1 549 9 is_stmt 1 view .LVU461
+	call	timer_setup@PLT	#
+.LVL202:
+	.loc 1 550 9 view .LVU462
+	movl	$0, %eax	#,
+	call	init_dut@PLT	#
+.LVL203:
+	.loc 1 551 9 view .LVU463
+.LBB168:
+.LBI168:
+	.loc 1 456 13 view .LVU464
+.LBB169:
+	.loc 1 458 5 view .LVU465
+.LBE169:
+.LBE168:
+# dudect/fixture.c:551:         return test_linear(op->name, mode);
+	.loc 1 551 30 is_stmt 0 view .LVU466
+	movslq	%r13d, %rax	# mode, mode
+	leaq	(%rax,%rax,2), %rax	#, tmp214
+	salq	$4, %rax	#, tmp215
+.LBB182:
+.LBB179:
+# dudect/fixture.c:458:     printf("Testing %s...\n", name);
+	.loc 1 458 5 view .LVU467
+	leaq	dut_ops(%rip), %rdx	#, tmp209
+	movq	(%rdx,%rax), %rsi	# MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_6(D)].name, MEM <const struct dut_op_t[7]> [(const struct dut_op_t *)&dut_ops][mode_6(D)].name
+	leaq	.LC15(%rip), %rdi	#, tmp218
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL204:
+	.loc 1 459 5 is_stmt 1 view .LVU468
+# dudect/fixture.c:459:     if (write_data)
+	.loc 1 459 8 is_stmt 0 view .LVU469
+	cmpb	$0, write_data(%rip)	#, write_data
+	jne	.L174	#,
+.L120:
+.LVL205:
+.LBB170:
+	.loc 1 461 23 is_stmt 1 view .LVU470
+	.loc 1 462 9 view .LVU471
+# dudect/fixture.c:463:             calloc(linear_measurements + number_measurements, sizeof(int64_t));
+	.loc 1 463 13 is_stmt 0 view .LVU472
+	movq	number_measurements(%rip), %rax	# number_measurements, tmp398
+	leaq	3000(%rax), %rbx	#, _24
+	movl	$8, %esi	#,
+	movq	%rbx, %rdi	# _24,
+	call	calloc@PLT	#
+.LVL206:
+# dudect/fixture.c:462:         element_ticks[c] =
+	.loc 1 462 26 view .LVU473
+	movq	%rax, element_ticks(%rip)	# tmp221, element_ticks[0]
+	.loc 1 464 9 is_stmt 1 view .LVU474
+# dudect/fixture.c:464:         if (!element_ticks[c])
+	.loc 1 464 12 is_stmt 0 view .LVU475
+	testq	%rax, %rax	# tmp221
+	je	.L122	#,
+	.loc 1 466 9 is_stmt 1 view .LVU476
+# dudect/fixture.c:466:         element_cnt[c] = 0;
+	.loc 1 466 24 is_stmt 0 view .LVU477
+	movq	$0, element_cnt(%rip)	#, element_cnt[0]
+	.loc 1 461 29 is_stmt 1 view .LVU478
+.LVL207:
+	.loc 1 461 23 view .LVU479
+	.loc 1 462 9 view .LVU480
+# dudect/fixture.c:463:             calloc(linear_measurements + number_measurements, sizeof(int64_t));
+	.loc 1 463 13 is_stmt 0 view .LVU481
+	movl	$8, %esi	#,
+	movq	%rbx, %rdi	# _24,
+	call	calloc@PLT	#
+.LVL208:
+# dudect/fixture.c:462:         element_ticks[c] =
+	.loc 1 462 26 view .LVU482
+	movq	%rax, 8+element_ticks(%rip)	# tmp224, element_ticks[1]
+	.loc 1 464 9 is_stmt 1 view .LVU483
+# dudect/fixture.c:464:         if (!element_ticks[c])
+	.loc 1 464 12 is_stmt 0 view .LVU484
+	testq	%rax, %rax	# tmp224
+	je	.L122	#,
+	.loc 1 466 9 is_stmt 1 view .LVU485
+# dudect/fixture.c:466:         element_cnt[c] = 0;
+	.loc 1 466 24 is_stmt 0 view .LVU486
+	movq	$0, 8+element_cnt(%rip)	#, element_cnt[1]
+	.loc 1 461 29 is_stmt 1 view .LVU487
+.LVL209:
+	.loc 1 461 23 view .LVU488
+.LBE170:
+	.loc 1 468 44 view .LVU489
+.L121:
+	.loc 1 469 9 view .LVU490
+	movl	%r13d, %edi	# mode,
+	call	measure_batch	#
+.LVL210:
+	.loc 1 468 44 view .LVU491
+# dudect/fixture.c:468:     while (element_cnt[0] + element_cnt[1] < linear_measurements)
+	.loc 1 468 27 is_stmt 0 view .LVU492
+	movq	8+element_cnt(%rip), %rax	# element_cnt[1], element_cnt[1]
+	addq	element_cnt(%rip), %rax	# element_cnt[0], tmp228
+# dudect/fixture.c:468:     while (element_cnt[0] + element_cnt[1] < linear_measurements)
+	.loc 1 468 44 view .LVU493
+	cmpq	$2999, %rax	#, tmp228
+	jbe	.L121	#,
+	.loc 1 471 5 is_stmt 1 view .LVU494
+# dudect/fixture.c:471:     double median[2] = {0, 0};
+	.loc 1 471 12 is_stmt 0 view .LVU495
+	movq	$0x000000000, 48(%rsp)	#, MEM[(double[2] *)_270][0]
+	movq	$0x000000000, 56(%rsp)	#, MEM[(double[2] *)_270][1]
+	.loc 1 472 5 is_stmt 1 view .LVU496
+# dudect/fixture.c:472:     double half = 0.5;
+	.loc 1 472 12 is_stmt 0 view .LVU497
+	movq	.LC16(%rip), %rax	#, tmp399
+	movq	%rax, 24(%rsp)	# tmp399, half
+	.loc 1 473 5 is_stmt 1 view .LVU498
+.LBB173:
+	.loc 1 473 10 view .LVU499
+.LVL211:
+	.loc 1 473 23 view .LVU500
+.LBE173:
+# dudect/fixture.c:472:     double half = 0.5;
+	.loc 1 472 12 is_stmt 0 view .LVU501
+	movl	$0, %ebx	#, ivtmp.206
+.LBB176:
+.LBB174:
+# dudect/fixture.c:475:         if (element_cnt[c])
+	.loc 1 475 24 view .LVU502
+	leaq	element_cnt(%rip), %r12	#, tmp234
+# dudect/fixture.c:479:         free(element_ticks[c]);
+	.loc 1 479 27 view .LVU503
+	leaq	element_ticks(%rip), %rbp	#, tmp243
+.LVL212:
+.L125:
+	.loc 1 474 9 is_stmt 1 view .LVU504
+# dudect/fixture.c:474:         int64_t m = 0;
+	.loc 1 474 17 is_stmt 0 view .LVU505
+	movq	$0, 32(%rsp)	#, MEM[(long int *)_268]
+	.loc 1 475 9 is_stmt 1 view .LVU506
+# dudect/fixture.c:475:         if (element_cnt[c])
+	.loc 1 475 24 is_stmt 0 view .LVU507
+	movq	(%r12,%rbx), %rsi	# MEM[(long unsigned int *)&element_cnt + ivtmp.206_8 * 1], _25
+# dudect/fixture.c:475:         if (element_cnt[c])
+	.loc 1 475 12 view .LVU508
+	testq	%rsi, %rsi	# _25
+	jne	.L175	#,
+.L124:
+	.loc 1 478 9 is_stmt 1 view .LVU509
+# dudect/fixture.c:478:         median[c] = (double) m / element_scale;
+	.loc 1 478 21 is_stmt 0 view .LVU510
+	pxor	%xmm0, %xmm0	# tmp240
+	cvtsi2sdq	32(%rsp), %xmm0	# MEM[(long int *)_268], tmp240
+# dudect/fixture.c:478:         median[c] = (double) m / element_scale;
+	.loc 1 478 32 view .LVU511
+	mulsd	.LC17(%rip), %xmm0	#, tmp241
+# dudect/fixture.c:478:         median[c] = (double) m / element_scale;
+	.loc 1 478 19 view .LVU512
+	movsd	%xmm0, 48(%rsp,%rbx)	# tmp241, MEM[(double *)_270]
+	.loc 1 479 9 is_stmt 1 view .LVU513
+	movq	0(%rbp,%rbx), %rdi	# MEM[(int64_t * *)&element_ticks + ivtmp.206_8 * 1], MEM[(int64_t * *)&element_ticks + ivtmp.206_8 * 1]
+	call	free@PLT	#
+.LVL213:
+.LBE174:
+	.loc 1 473 29 view .LVU514
+	.loc 1 473 23 view .LVU515
+	addq	$8, %rbx	#, ivtmp.206
+.LVL214:
+	.loc 1 473 23 is_stmt 0 view .LVU516
+	cmpq	$16, %rbx	#, ivtmp.206
+	jne	.L125	#,
+.LBE176:
+	.loc 1 481 5 is_stmt 1 view .LVU517
+	call	meas_close@PLT	#
+.LVL215:
+	.loc 1 487 5 view .LVU518
+# dudect/fixture.c:487:     double ratio = median[0] > 0 ? median[1] / median[0] : INFINITY;
+	.loc 1 487 26 is_stmt 0 view .LVU519
+	movsd	48(%rsp), %xmm0	# MEM[(double[2] *)_270][0], _32
+# dudect/fixture.c:487:     double ratio = median[0] > 0 ? median[1] / median[0] : INFINITY;
+	.loc 1 487 58 view .LVU520
+	pxor	%xmm1, %xmm1	# tmp245
+	comisd	%xmm1, %xmm0	# tmp245, _32
+	jbe	.L169	#,
+# dudect/fixture.c:487:     double ratio = median[0] > 0 ? median[1] / median[0] : INFINITY;
+	.loc 1 487 42 view .LVU521
+	movsd	56(%rsp), %xmm1	# MEM[(double[2] *)_270][1], _33
+# dudect/fixture.c:487:     double ratio = median[0] > 0 ? median[1] / median[0] : INFINITY;
+	.loc 1 487 58 view .LVU522
+	movapd	%xmm1, %xmm5	# _33, iftmp.3_34
+	divsd	%xmm0, %xmm5	# _32, iftmp.3_34
+	movq	%xmm5, %rbx	# iftmp.3_34, iftmp.3_34
+.LVL216:
+	.loc 1 488 5 is_stmt 1 view .LVU523
+	movapd	%xmm5, %xmm2	# iftmp.3_34,
+	leaq	.LC18(%rip), %rdi	#, tmp246
+	movl	$3, %eax	#,
+	call	printf@PLT	#
+.LVL217:
+	.loc 1 490 5 view .LVU524
+# dudect/fixture.c:490:     last_result.test = -1;
+	.loc 1 490 22 is_stmt 0 view .LVU525
+	movl	$-1, last_result(%rip)	#, last_result.test
+	.loc 1 491 5 is_stmt 1 view .LVU526
+# dudect/fixture.c:491:     last_result.max_t = ratio;
+	.loc 1 491 23 is_stmt 0 view .LVU527
+	movq	%rbx, 8+last_result(%rip)	# iftmp.3_34, last_result.max_t
+	.loc 1 492 5 is_stmt 1 view .LVU528
+# dudect/fixture.c:492:     last_result.measurements = element_cnt[0] + element_cnt[1];
+	.loc 1 492 47 is_stmt 0 view .LVU529
+	movq	8+element_cnt(%rip), %rax	# element_cnt[1], element_cnt[1]
+# dudect/fixture.c:492:     last_result.measurements = element_cnt[0] + element_cnt[1];
+	.loc 1 492 30 view .LVU530
+	addq	element_cnt(%rip), %rax	# element_cnt[0], tmp252
+	js	.L128	#,
+	pxor	%xmm0, %xmm0	# tmp255
+	cvtsi2sdq	%rax, %xmm0	# tmp252, tmp255
+.L129:
+	movsd	%xmm0, 16+last_result(%rip)	# tmp255, last_result.measurements
+	.loc 1 493 5 is_stmt 1 view .LVU531
+# dudect/fixture.c:493:     last_result.rate = 0;
+	.loc 1 493 22 is_stmt 0 view .LVU532
+	movq	$0x000000000, 24+last_result(%rip)	#, last_result.rate
+	.loc 1 494 5 is_stmt 1 view .LVU533
+# dudect/fixture.c:494:     return ratio > linear_min_ratio && ratio < linear_threshold;
+	.loc 1 494 37 is_stmt 0 view .LVU534
+	movq	%rbx, %xmm6	# iftmp.3_34, iftmp.3_34
+	movl	$0, %eax	#, iftmp.4_41
+	comisd	.LC19(%rip), %xmm6	#, iftmp.3_34
+	ja	.L155	#,
+.L130:
+	.loc 1 494 37 view .LVU535
+	andl	$1, %eax	#, <retval>
+	movb	%al, 3(%rsp)	# <retval>, %sfp
+.LVL218:
+	.loc 1 494 37 view .LVU536
+.LBE179:
+.LBE182:
+# dudect/fixture.c:551:         return test_linear(op->name, mode);
+	.loc 1 551 16 view .LVU537
+	jmp	.L118	#
+.LVL219:
+.L174:
+.LBB183:
+.LBB180:
+	.loc 1 460 9 is_stmt 1 view .LVU538
+	movl	%r13d, %edi	# mode,
+	call	meas_open@PLT	#
+.LVL220:
+	jmp	.L120	#
+.L122:
+.LBB177:
+	.loc 1 465 13 view .LVU539
+.LBB171:
+.LBI171:
+	.loc 1 88 39 view .LVU540
+.LBB172:
+	.loc 1 90 5 view .LVU541
+	movl	$111, %edi	#,
+	call	exit@PLT	#
+.LVL221:
+.L175:
+	.loc 1 90 5 is_stmt 0 view .LVU542
+.LBE172:
+.LBE171:
+.LBE177:
+.LBB178:
+.LBB175:
+	.loc 1 476 13 is_stmt 1 view .LVU543
+	leaq	24(%rsp), %rdx	#, tmp236
+# dudect/fixture.c:476:             compute_percentiles(element_ticks[c], element_cnt[c], &half, 1,
+	.loc 1 476 46 is_stmt 0 view .LVU544
+	leaq	element_ticks(%rip), %rax	#, tmp237
+# dudect/fixture.c:476:             compute_percentiles(element_ticks[c], element_cnt[c], &half, 1,
+	.loc 1 476 13 view .LVU545
+	movq	(%rax,%rbx), %rdi	# MEM[(int64_t * *)&element_ticks + ivtmp.206_8 * 1], MEM[(int64_t * *)&element_ticks + ivtmp.206_8 * 1]
+	leaq	32(%rsp), %r8	#,
+	movl	$1, %ecx	#,
+	call	compute_percentiles@PLT	#
+.LVL222:
+	jmp	.L124	#
+.LVL223:
+.L128:
+	.loc 1 476 13 view .LVU546
+.LBE175:
+.LBE178:
+# dudect/fixture.c:492:     last_result.measurements = element_cnt[0] + element_cnt[1];
+	.loc 1 492 30 view .LVU547
+	movq	%rax, %rdx	# tmp252, tmp257
+	shrq	%rdx	# tmp257
+	andl	$1, %eax	#, tmp258
+	orq	%rax, %rdx	# tmp258, tmp257
+	pxor	%xmm0, %xmm0	# tmp256
+	cvtsi2sdq	%rdx, %xmm0	# tmp257, tmp256
+	addsd	%xmm0, %xmm0	# tmp256, tmp255
+	jmp	.L129	#
+.LVL224:
+.L135:
+	.loc 1 492 30 view .LVU548
+.LBE180:
+.LBE183:
+.LBB184:
+.LBB165:
+.LBB150:
+.LBB148:
+.LBB147:
+.LBB146:
+# dudect/fixture.c:99:             1 - (pow(0.5, 10 * (double) (i + 1) / number_percentiles));
+	.loc 1 99 32 view .LVU549
+	movq	%r12, %rax	# i, tmp280
+	shrq	%rax	# tmp280
+	movq	%r12, %rdx	# i, tmp281
+	andl	$1, %edx	#, tmp281
+	orq	%rdx, %rax	# tmp281, tmp280
+	pxor	%xmm1, %xmm1	# tmp279
+	cvtsi2sdq	%rax, %xmm1	# tmp280, tmp279
+	addsd	%xmm1, %xmm1	# tmp279, tmp278
+.L136:
+# dudect/fixture.c:99:             1 - (pow(0.5, 10 * (double) (i + 1) / number_percentiles));
+	.loc 1 99 30 view .LVU550
+	mulsd	.LC12(%rip), %xmm1	#, tmp282
+# dudect/fixture.c:99:             1 - (pow(0.5, 10 * (double) (i + 1) / number_percentiles));
+	.loc 1 99 18 view .LVU551
+	divsd	.LC22(%rip), %xmm1	#,
+	movq	.LC16(%rip), %rax	#, tmp407
+	movq	%rax, %xmm0	# tmp407,
+	call	pow@PLT	#
+.LVL225:
+	movapd	%xmm0, %xmm1	#, tmp389
+# dudect/fixture.c:99:             1 - (pow(0.5, 10 * (double) (i + 1) / number_percentiles));
+	.loc 1 99 15 view .LVU552
+	movsd	.LC8(%rip), %xmm0	#, tmp288
+	subsd	%xmm1, %xmm0	# tmp389, tmp288
+# dudect/fixture.c:98:         crop_fractions[i] =
+	.loc 1 98 27 view .LVU553
+	leaq	-8+crop_fractions(%rip), %rax	#, tmp287
+	movsd	%xmm0, (%rax,%r12,8)	# tmp288, MEM[(double *)&crop_fractions + -8B + _114 * 8]
+	.loc 1 97 49 is_stmt 1 view .LVU554
+.LVL226:
+	.loc 1 97 26 view .LVU555
+	cmpq	$100, %r12	#, i
+	je	.L176	#,
+.LVL227:
+.L137:
+	.loc 1 98 9 view .LVU556
+# dudect/fixture.c:99:             1 - (pow(0.5, 10 * (double) (i + 1) / number_percentiles));
+	.loc 1 99 32 is_stmt 0 view .LVU557
+	addq	$1, %r12	#, i
+.LVL228:
+	.loc 1 99 32 view .LVU558
+	js	.L135	#,
+	pxor	%xmm1, %xmm1	# tmp278
+	cvtsi2sdq	%r12, %xmm1	# i, tmp278
+	jmp	.L136	#
+.LVL229:
+.L176:
+	.loc 1 99 32 view .LVU559
+.LBE146:
+.LBE147:
+	.loc 1 358 5 is_stmt 1 view .LVU560
+	leaq	percentiles(%rip), %rdx	#, tmp290
+	movl	$100, %ecx	#, tmp293
+	movl	$0, %eax	#, tmp292
+	movq	%rdx, %rdi	# tmp290, tmp290
+	rep stosq
+	.loc 1 359 5 view .LVU561
+	leaq	crop_samples(%rip), %rdi	#, tmp294
+	call	pwindow_free@PLT	#
+.LVL230:
+	.loc 1 360 5 view .LVU562
+# dudect/fixture.c:360:     if (crop_window > 0)
+	.loc 1 360 21 is_stmt 0 view .LVU563
+	movl	crop_window(%rip), %eax	# crop_window, crop_window.39_105
+# dudect/fixture.c:360:     if (crop_window > 0)
+	.loc 1 360 8 view .LVU564
+	testl	%eax, %eax	# crop_window.39_105
+	jg	.L177	#,
+.L138:
+.LVL231:
+	.loc 1 360 8 view .LVU565
+.LBE148:
+.LBE150:
+	.loc 1 507 5 is_stmt 1 view .LVU566
+# dudect/fixture.c:507:     if (write_data)
+	.loc 1 507 8 is_stmt 0 view .LVU567
+	cmpb	$0, write_data(%rip)	#, write_data
+	jne	.L178	#,
+.L139:
+	.loc 1 509 5 is_stmt 1 view .LVU568
+	.loc 1 510 5 view .LVU569
+	leaq	32(%rsp), %rsi	#, tmp303
+	movl	$1, %edi	#,
+	call	clock_gettime@PLT	#
+.LVL232:
+	.loc 1 511 5 view .LVU570
+# dudect/fixture.c:511:     worker_cnt = 0;
+	.loc 1 511 16 is_stmt 0 view .LVU571
+	movl	$0, worker_cnt(%rip)	#, worker_cnt
+	.loc 1 512 5 is_stmt 1 view .LVU572
+# dudect/fixture.c:513:         total_measurements / (number_measurements - drop_size * 2) + 1;
+	.loc 1 513 28 is_stmt 0 view .LVU573
+	movslq	total_measurements(%rip), %r14	# total_measurements, total_measurements
+.LVL233:
+# dudect/fixture.c:513:         total_measurements / (number_measurements - drop_size * 2) + 1;
+	.loc 1 513 63 view .LVU574
+	movl	drop_size(%rip), %eax	# drop_size, tmp412
+	leal	(%rax,%rax), %edx	#, tmp306
+	movslq	%edx, %rdx	# tmp306, tmp308
+# dudect/fixture.c:513:         total_measurements / (number_measurements - drop_size * 2) + 1;
+	.loc 1 513 51 view .LVU575
+	movq	number_measurements(%rip), %rcx	# number_measurements, tmp309
+	subq	%rdx, %rcx	# tmp308, tmp309
+# dudect/fixture.c:513:         total_measurements / (number_measurements - drop_size * 2) + 1;
+	.loc 1 513 28 view .LVU576
+	movq	%r14, %rax	# total_measurements, total_measurements
+	movl	$0, %edx	#, tmp312
+	divq	%rcx	# tmp309
+	movq	%rax, %r14	# total_measurements, tmp311
+# dudect/fixture.c:513:         total_measurements / (number_measurements - drop_size * 2) + 1;
+	.loc 1 513 68 view .LVU577
+	leal	1(%rax), %r15d	#, batches
+.LVL234:
+	.loc 1 514 5 is_stmt 1 view .LVU578
+# dudect/fixture.c:514:     if (dudect_workers > 1 && batches > 1 && !write_data) {
+	.loc 1 514 8 is_stmt 0 view .LVU579
+	cmpl	$1, dudect_workers(%rip)	#, dudect_workers
+	setg	%dl	#, tmp314
+# dudect/fixture.c:514:     if (dudect_workers > 1 && batches > 1 && !write_data) {
+	.loc 1 514 28 view .LVU580
+	cmpl	$1, %r15d	#, batches
+	setg	%al	#, tmp316
+	andb	%al, %dl	# tmp316, tmp314
+	movb	%dl, 3(%rsp)	# tmp314, %sfp
+	jne	.L179	#,
+.LVL235:
+.LBB151:
+	.loc 1 523 27 is_stmt 1 view .LVU581
+	testl	%r15d, %r15d	# batches
+	jle	.L143	#,
+.LVL236:
+.L141:
+	.loc 1 523 27 is_stmt 0 view .LVU582
+	addl	$2, %r14d	#, _264
+.LBE151:
+.LBB158:
+# dudect/fixture.c:518:         for (int w = 0; w < worker_cnt; w++)
+	.loc 1 518 18 view .LVU583
+	movl	$1, %r12d	#, ivtmp.221
+	jmp	.L151	#
+.LVL237:
+.L177:
+	.loc 1 518 18 view .LVU584
+.LBE158:
+.LBB159:
+.LBB149:
+	.loc 1 361 9 is_stmt 1 view .LVU585
+# dudect/fixture.c:362:                                         (number_measurements - 2 * drop_size));
+	.loc 1 362 66 is_stmt 0 view .LVU586
+	movl	drop_size(%rip), %ecx	# drop_size, tmp410
+	leal	(%rcx,%rcx), %edx	#, tmp295
+	movslq	%edx, %rdx	# tmp295, tmp297
+# dudect/fixture.c:362:                                         (number_measurements - 2 * drop_size));
+	.loc 1 362 62 view .LVU587
+	movq	number_measurements(%rip), %rsi	# number_measurements, tmp298
+	subq	%rdx, %rsi	# tmp297, tmp298
+# dudect/fixture.c:361:         pwindow_init(&crop_samples, (size_t) crop_window *
+	.loc 1 361 37 view .LVU588
+	cltq
+# dudect/fixture.c:361:         pwindow_init(&crop_samples, (size_t) crop_window *
+	.loc 1 361 9 view .LVU589
+	imulq	%rax, %rsi	# crop_window.39_105, tmp301
+	leaq	crop_samples(%rip), %rdi	#, tmp302
+	call	pwindow_init@PLT	#
+.LVL238:
+	jmp	.L138	#
+.LVL239:
+.L178:
+	.loc 1 361 9 view .LVU590
+.LBE149:
+.LBE159:
+	.loc 1 508 9 is_stmt 1 view .LVU591
+	movl	%r13d, %edi	# mode,
+	call	meas_open@PLT	#
+.LVL240:
+	jmp	.L139	#
+.LVL241:
+.L179:
+# dudect/fixture.c:514:     if (dudect_workers > 1 && batches > 1 && !write_data) {
+	.loc 1 514 43 is_stmt 0 view .LVU592
+	cmpb	$0, write_data(%rip)	#, write_data
+	jne	.L141	#,
+	.loc 1 516 9 is_stmt 1 view .LVU593
+	movl	%r13d, %edi	# mode,
+	call	measure_batch	#
+.LVL242:
+	.loc 1 517 9 view .LVU594
+# dudect/fixture.c:517:         result = run_workers(mode, batches - 1) && report();
+	.loc 1 517 18 is_stmt 0 view .LVU595
+	movl	%r14d, %esi	# tmp311, _55
+	movl	%r13d, %edi	# mode,
+	call	run_workers	#
+.LVL243:
+	movl	%eax, %edx	#, tmp390
+# dudect/fixture.c:517:         result = run_workers(mode, batches - 1) && report();
+	.loc 1 517 49 view .LVU596
+	movl	$0, %eax	#, _9
+	testb	%dl, %dl	# tmp390
+	jne	.L180	#,
+.L142:
+# dudect/fixture.c:517:         result = run_workers(mode, batches - 1) && report();
+	.loc 1 517 16 view .LVU597
+	andl	$1, %eax	#, <retval>
+	movb	%al, 3(%rsp)	# <retval>, %sfp
+.LVL244:
+	.loc 1 518 9 is_stmt 1 view .LVU598
+.LBB160:
+	.loc 1 518 14 view .LVU599
+	.loc 1 518 27 view .LVU600
+	cmpl	$0, worker_cnt(%rip)	#, worker_cnt
+	jle	.L143	#,
+	leaq	worker_result(%rip), %r12	#, ivtmp.217
+# dudect/fixture.c:518:         for (int w = 0; w < worker_cnt; w++)
+	.loc 1 518 18 is_stmt 0 view .LVU601
+	movl	$0, %r13d	#, w
+.LVL245:
+# dudect/fixture.c:519:             printf("worker %d: max t [%d]: %+7.2f, meas: %7.2lf M\n", w,
+	.loc 1 519 13 view .LVU602
+	leaq	.LC23(%rip), %r14	#, tmp323
+.LVL246:
+.L144:
+	.loc 1 519 13 is_stmt 1 view .LVU603
+	movsd	16(%r12), %xmm1	# MEM[(double *)_260 + 16B], MEM[(double *)_260 + 16B]
+	movsd	8(%r12), %xmm0	# MEM[(double *)_260 + 8B], MEM[(double *)_260 + 8B]
+	movl	(%r12), %edx	# MEM[(int *)_260], MEM[(int *)_260]
+	divsd	.LC5(%rip), %xmm1	#,
+	movl	%r13d, %esi	# w,
+	movq	%r14, %rdi	# tmp323,
+	movl	$2, %eax	#,
+	call	printf@PLT	#
+.LVL247:
+	.loc 1 518 42 view .LVU604
+	addl	$1, %r13d	#, w
+.LVL248:
+	.loc 1 518 27 view .LVU605
+	addq	$32, %r12	#, ivtmp.217
+	cmpl	worker_cnt(%rip), %r13d	# worker_cnt, w
+	jl	.L144	#,
+	jmp	.L143	#
+.LVL249:
+.L180:
+	.loc 1 518 27 is_stmt 0 view .LVU606
+.LBE160:
+# dudect/fixture.c:517:         result = run_workers(mode, batches - 1) && report();
+	.loc 1 517 52 view .LVU607
+	call	report	#
+.LVL250:
+# dudect/fixture.c:517:         result = run_workers(mode, batches - 1) && report();
+	.loc 1 517 49 view .LVU608
+	movzbl	%al, %eax	# tmp391, _9
+	jmp	.L142	#
+.LVL251:
+.L182:
+.LBB161:
+.LBB152:
+.LBI152:
+	.loc 1 260 13 is_stmt 1 view .LVU609
+.LBB153:
+	.loc 1 262 5 view .LVU610
+# dudect/fixture.c:262:     if (last_result.measurements < enough_measurements)
+	.loc 1 262 8 is_stmt 0 view .LVU611
+	movsd	.LC1(%rip), %xmm3	#, tmp417
+	comisd	16+last_result(%rip), %xmm3	# last_result.measurements, tmp417
+	ja	.L145	#,
+	.loc 1 264 5 is_stmt 1 view .LVU612
+# dudect/fixture.c:264:     if (last_result.max_t > t_threshold_moderate + t_margin)
+	.loc 1 264 8 is_stmt 0 view .LVU613
+	movsd	8+last_result(%rip), %xmm0	# last_result.max_t, last_result.max_t
+	comisd	.LC24(%rip), %xmm0	#, last_result.max_t
+	jbe	.L181	#,
+.LVL252:
+.L146:
+	.loc 1 264 8 view .LVU614
+.LBE153:
+.LBE152:
+	.loc 1 528 17 is_stmt 1 view .LVU615
+	movl	%r15d, %edx	# batches,
+	movl	4(%rsp), %esi	# %sfp,
+	leaq	.LC27(%rip), %rdi	#, tmp342
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL253:
+	.loc 1 529 17 view .LVU616
+	jmp	.L143	#
+.LVL254:
+.L181:
+.LBB156:
+.LBB154:
+	.loc 1 270 5 view .LVU617
+# dudect/fixture.c:270:     double max_t = fabs(t_compute(t[max_test(t, sequential_min_n)]));
+	.loc 1 270 37 is_stmt 0 view .LVU618
+	movsd	.LC25(%rip), %xmm0	#,
+	leaq	t(%rip), %rdi	#,
+	call	max_test	#
+.LVL255:
+# dudect/fixture.c:270:     double max_t = fabs(t_compute(t[max_test(t, sequential_min_n)]));
+	.loc 1 270 25 view .LVU619
+	cltq
+	leaq	t(%rip), %rcx	#, tmp418
+	movq	(%rcx,%rax,8), %rdi	# t[_122], t[_122]
+	call	t_compute@PLT	#
+.LVL256:
+	.loc 1 271 5 is_stmt 1 view .LVU620
+# dudect/fixture.c:270:     double max_t = fabs(t_compute(t[max_test(t, sequential_min_n)]));
+	.loc 1 270 12 is_stmt 0 view .LVU621
+	andpd	.LC3(%rip), %xmm0	#, max_t
+.LVL257:
+# dudect/fixture.c:271:     double bound = (max_t + t_margin) * sqrt((double) batches / done);
+	.loc 1 271 27 view .LVU622
+	addsd	.LC26(%rip), %xmm0	#, max_t
+	movsd	%xmm0, 8(%rsp)	# max_t, %sfp
+# dudect/fixture.c:271:     double bound = (max_t + t_margin) * sqrt((double) batches / done);
+	.loc 1 271 46 view .LVU623
+	pxor	%xmm0, %xmm0	# tmp337
+	cvtsi2sdl	%r15d, %xmm0	# batches, tmp337
+# dudect/fixture.c:271:     double bound = (max_t + t_margin) * sqrt((double) batches / done);
+	.loc 1 271 41 view .LVU624
+	pxor	%xmm1, %xmm1	# tmp338
+	cvtsi2sdl	4(%rsp), %xmm1	# %sfp, tmp338
+	divsd	%xmm1, %xmm0	# tmp338, _129
+	pxor	%xmm1, %xmm1	# tmp339
+	ucomisd	%xmm0, %xmm1	# _129, tmp339
+	ja	.L171	#,
+	sqrtsd	%xmm0, %xmm0	# _129, _130
+.L149:
+.LVL258:
+	.loc 1 272 5 is_stmt 1 view .LVU625
+# dudect/fixture.c:271:     double bound = (max_t + t_margin) * sqrt((double) batches / done);
+	.loc 1 271 12 is_stmt 0 view .LVU626
+	mulsd	8(%rsp), %xmm0	# %sfp, bound
+.LBE154:
+.LBE156:
+# dudect/fixture.c:526:             if (dudect_sequential && i + 1 < batches &&
+	.loc 1 526 54 view .LVU627
+	movsd	.LC12(%rip), %xmm1	#, tmp341
+	comisd	%xmm0, %xmm1	# bound, tmp341
+	ja	.L146	#,
+.L145:
+	.loc 1 523 38 is_stmt 1 view .LVU628
+.LVL259:
+	.loc 1 523 27 view .LVU629
+	addl	$1, %r12d	#, ivtmp.221
+.LVL260:
+	.loc 1 523 27 is_stmt 0 view .LVU630
+	cmpl	%r14d, %r12d	# _264, ivtmp.221
+	je	.L143	#,
+.LVL261:
+.L151:
+	.loc 1 524 13 is_stmt 1 view .LVU631
+	movl	%r13d, %edi	# mode,
+	call	measure_batch	#
+.LVL262:
+	.loc 1 525 13 view .LVU632
+# dudect/fixture.c:525:             result = report();
+	.loc 1 525 22 is_stmt 0 view .LVU633
+	call	report	#
+.LVL263:
+	movb	%al, 3(%rsp)	# tmp392, %sfp
+.LVL264:
+	.loc 1 526 13 is_stmt 1 view .LVU634
+# dudect/fixture.c:526:             if (dudect_sequential && i + 1 < batches &&
+	.loc 1 526 16 is_stmt 0 view .LVU635
+	cmpl	$0, dudect_sequential(%rip)	#, dudect_sequential
+	je	.L145	#,
+# dudect/fixture.c:526:             if (dudect_sequential && i + 1 < batches &&
+	.loc 1 526 40 view .LVU636
+	movl	%r12d, 4(%rsp)	# ivtmp.221, %sfp
+# dudect/fixture.c:526:             if (dudect_sequential && i + 1 < batches &&
+	.loc 1 526 35 view .LVU637
+	cmpl	%r12d, %r15d	# ivtmp.221, batches
+	jg	.L182	#,
+.LVL265:
+.L143:
+	.loc 1 526 35 view .LVU638
+.LBE161:
+	.loc 1 533 5 is_stmt 1 view .LVU639
+	leaq	48(%rsp), %rsi	#, tmp343
+	movl	$1, %edi	#,
+	call	clock_gettime@PLT	#
+.LVL266:
+	.loc 1 534 5 view .LVU640
+	.loc 1 536 5 view .LVU641
+# dudect/fixture.c:536:     last_result.rate = (t[0]->n[0] + t[0]->n[1]) / seconds;
+	.loc 1 536 26 is_stmt 0 view .LVU642
+	movq	t(%rip), %rax	# t[0], _89
+# dudect/fixture.c:536:     last_result.rate = (t[0]->n[0] + t[0]->n[1]) / seconds;
+	.loc 1 536 36 view .LVU643
+	movsd	32(%rax), %xmm0	# _89->n[0], _89->n[0]
+	addsd	40(%rax), %xmm0	# _89->n[1], tmp346
+# dudect/fixture.c:535:         (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	.loc 1 535 52 view .LVU644
+	movq	56(%rsp), %rax	# MEM[(struct timespec *)_270].tv_nsec, MEM[(struct timespec *)_270].tv_nsec
+	subq	40(%rsp), %rax	# MEM[(struct timespec *)_268].tv_nsec, tmp348
+# dudect/fixture.c:535:         (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	.loc 1 535 69 view .LVU645
+	pxor	%xmm1, %xmm1	# tmp350
+	cvtsi2sdq	%rax, %xmm1	# tmp348, tmp350
+	divsd	.LC28(%rip), %xmm1	#, tmp351
+# dudect/fixture.c:535:         (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	.loc 1 535 21 view .LVU646
+	movq	48(%rsp), %rax	# MEM[(struct timespec *)_270].tv_sec, MEM[(struct timespec *)_270].tv_sec
+	subq	32(%rsp), %rax	# MEM[(struct timespec *)_268].tv_sec, tmp353
+# dudect/fixture.c:535:         (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	.loc 1 535 37 view .LVU647
+	pxor	%xmm2, %xmm2	# tmp355
+	cvtsi2sdq	%rax, %xmm2	# tmp353, tmp355
+# dudect/fixture.c:534:     double seconds =
+	.loc 1 534 12 view .LVU648
+	addsd	%xmm2, %xmm1	# tmp355, seconds
+# dudect/fixture.c:536:     last_result.rate = (t[0]->n[0] + t[0]->n[1]) / seconds;
+	.loc 1 536 50 view .LVU649
+	divsd	%xmm1, %xmm0	# seconds, tmp357
+# dudect/fixture.c:536:     last_result.rate = (t[0]->n[0] + t[0]->n[1]) / seconds;
+	.loc 1 536 22 view .LVU650
+	movsd	%xmm0, 24+last_result(%rip)	# tmp357, last_result.rate
+	.loc 1 537 5 is_stmt 1 view .LVU651
+	call	meas_close@PLT	#
+.LVL267:
+	.loc 1 538 5 view .LVU652
+	movsd	24+last_result(%rip), %xmm0	# last_result.rate,
+	leaq	.LC29(%rip), %rdi	#, tmp360
+	movl	$1, %eax	#,
+	call	printf@PLT	#
+.LVL268:
+	.loc 1 539 5 view .LVU653
+.LBB162:
+	.loc 1 539 10 view .LVU654
+	.loc 1 539 23 view .LVU655
+.L152:
+	.loc 1 540 9 view .LVU656
+	movq	(%rbx), %rdi	# MEM[(struct t_ctx * *)_211], MEM[(struct t_ctx * *)_211]
+	call	free@PLT	#
+.LVL269:
+	.loc 1 539 39 view .LVU657
+	.loc 1 539 23 view .LVU658
+	addq	$8, %rbx	#, ivtmp.213
+.LVL270:
+	.loc 1 539 23 is_stmt 0 view .LVU659
+	cmpq	%rbp, %rbx	# _277, ivtmp.213
+	jne	.L152	#,
+.LBE162:
+	.loc 1 542 5 is_stmt 1 view .LVU660
+.LVL271:
+	.loc 1 542 5 is_stmt 0 view .LVU661
+.LBE165:
+.LBE184:
+	.loc 1 554 5 is_stmt 1 view .LVU662
+	movl	$0, %eax	#,
+	call	release_dut@PLT	#
+.LVL272:
+	.loc 1 555 5 view .LVU663
+.L118:
+# dudect/fixture.c:556: }
+	.loc 1 556 1 is_stmt 0 view .LVU664
+	movzbl	3(%rsp), %eax	# %sfp,
+	addq	$72, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL273:
+.L171:
+	.cfi_restore_state
+.LBB185:
+.LBB166:
+.LBB163:
+.LBB157:
+.LBB155:
+# dudect/fixture.c:271:     double bound = (max_t + t_margin) * sqrt((double) batches / done);
+	.loc 1 271 41 view .LVU665
+	call	sqrt@PLT	#
+.LVL274:
+	jmp	.L149	#
+.LVL275:
+.L169:
+	.loc 1 271 41 view .LVU666
+.LBE155:
+.LBE157:
+.LBE163:
+.LBE166:
+.LBE185:
+.LBB186:
+.LBB181:
+	.loc 1 488 5 is_stmt 1 view .LVU667
+	movq	.LC14(%rip), %rax	#, tmp421
+	movq	%rax, %xmm2	# tmp421,
+	movsd	56(%rsp), %xmm1	# MEM[(double[2] *)_270][1],
+	leaq	.LC18(%rip), %rdi	#, tmp365
+	movl	$3, %eax	#,
+	call	printf@PLT	#
+.LVL276:
+	.loc 1 490 5 view .LVU668
+# dudect/fixture.c:490:     last_result.test = -1;
+	.loc 1 490 22 is_stmt 0 view .LVU669
+	movl	$-1, last_result(%rip)	#, last_result.test
+	.loc 1 491 5 is_stmt 1 view .LVU670
+# dudect/fixture.c:491:     last_result.max_t = ratio;
+	.loc 1 491 23 is_stmt 0 view .LVU671
+	movq	.LC14(%rip), %rax	#, tmp422
+	movq	%rax, 8+last_result(%rip)	# tmp422, last_result.max_t
+	.loc 1 492 5 is_stmt 1 view .LVU672
+# dudect/fixture.c:492:     last_result.measurements = element_cnt[0] + element_cnt[1];
+	.loc 1 492 47 is_stmt 0 view .LVU673
+	movq	element_cnt(%rip), %rax	# element_cnt[0], element_cnt[0]
+# dudect/fixture.c:492:     last_result.measurements = element_cnt[0] + element_cnt[1];
+	.loc 1 492 30 view .LVU674
+	addq	8+element_cnt(%rip), %rax	# element_cnt[1], tmp372
+	js	.L153	#,
+	pxor	%xmm0, %xmm0	# tmp375
+	cvtsi2sdq	%rax, %xmm0	# tmp372, tmp375
+.L154:
+	movsd	%xmm0, 16+last_result(%rip)	# tmp375, last_result.measurements
+	.loc 1 493 5 is_stmt 1 view .LVU675
+# dudect/fixture.c:493:     last_result.rate = 0;
+	.loc 1 493 22 is_stmt 0 view .LVU676
+	movq	$0x000000000, 24+last_result(%rip)	#, last_result.rate
+	.loc 1 494 5 is_stmt 1 view .LVU677
+# dudect/fixture.c:487:     double ratio = median[0] > 0 ? median[1] / median[0] : INFINITY;
+	.loc 1 487 58 is_stmt 0 view .LVU678
+	movq	.LC14(%rip), %rbx	#, iftmp.3_34
+.LVL277:
+.L155:
+# dudect/fixture.c:494:     return ratio > linear_min_ratio && ratio < linear_threshold;
+	.loc 1 494 37 view .LVU679
+	movsd	.LC20(%rip), %xmm0	#, tmp265
+	movq	%rbx, %xmm7	# iftmp.3_34, iftmp.3_34
+	comisd	%xmm7, %xmm0	# iftmp.3_34, tmp265
+	seta	%al	#, iftmp.4_41
+	movzbl	%al, %eax	# iftmp.4_41, iftmp.4_41
+	jmp	.L130	#
+.LVL278:
+.L153:
+# dudect/fixture.c:492:     last_result.measurements = element_cnt[0] + element_cnt[1];
+	.loc 1 492 30 view .LVU680
+	movq	%rax, %rdx	# tmp372, tmp377
+	shrq	%rdx	# tmp377
+	andl	$1, %eax	#, tmp378
+	orq	%rax, %rdx	# tmp378, tmp377
+	pxor	%xmm0, %xmm0	# tmp376
+	cvtsi2sdq	%rdx, %xmm0	# tmp377, tmp376
+	addsd	%xmm0, %xmm0	# tmp376, tmp375
+	jmp	.L154	#
+.LBE181:
+.LBE186:
+	.cfi_endproc
+.LFE44:
+	.size	check_op, .-check_op
+	.globl	is_insert_tail_const
+	.type	is_insert_tail_const, @function
+is_insert_tail_const:
+.LFB45:
+	.loc 1 559 1 is_stmt 1 view -0
+	.cfi_startproc
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 560 5 view .LVU682
+# dudect/fixture.c:560:     return check_op(test_insert_tail);
+	.loc 1 560 12 is_stmt 0 view .LVU683
+	movl	$0, %edi	#,
+	call	check_op	#
+.LVL279:
+# dudect/fixture.c:561: }
+	.loc 1 561 1 view .LVU684
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE45:
+	.size	is_insert_tail_const, .-is_insert_tail_const
+	.globl	is_size_const
+	.type	is_size_const, @function
+is_size_const:
+.LFB46:
+	.loc 1 564 1 is_stmt 1 view -0
+	.cfi_startproc
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 565 5 view .LVU686
+# dudect/fixture.c:565:     return check_op(test_size);
+	.loc 1 565 12 is_stmt 0 view .LVU687
+	movl	$1, %edi	#,
+	call	check_op	#
+.LVL280:
+# dudect/fixture.c:566: }
+	.loc 1 566 1 view .LVU688
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE46:
+	.size	is_size_const, .-is_size_const
+	.globl	last_const_result
+	.type	last_const_result, @function
+last_const_result:
+.LVL281:
+.LFB47:
+	.loc 1 569 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 569 1 is_stmt 0 view .LVU690
+	movq	%rdi, %rax	# tmp87, .result_ptr
+	.loc 1 570 5 is_stmt 1 view .LVU691
+# dudect/fixture.c:570:     return last_result;
+	.loc 1 570 12 is_stmt 0 view .LVU692
+	movdqa	last_result(%rip), %xmm0	# last_result, tmp89
+	movups	%xmm0, (%rdi)	# tmp89, <retval>
+	movdqa	16+last_result(%rip), %xmm1	# last_result, tmp90
+	movups	%xmm1, 16(%rdi)	# tmp90, <retval>
+# dudect/fixture.c:571: }
+	.loc 1 571 1 view .LVU693
+	ret	
+	.cfi_endproc
+.LFE47:
+	.size	last_const_result, .-last_const_result
+	.globl	worker_results
+	.type	worker_results, @function
+worker_results:
+.LVL282:
+.LFB48:
+	.loc 1 574 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 575 5 view .LVU695
+# dudect/fixture.c:575:     *results = worker_result;
+	.loc 1 575 14 is_stmt 0 view .LVU696
+	leaq	worker_result(%rip), %rax	#, tmp89
+	movq	%rax, (%rdi)	# tmp89, *results_2(D)
+	.loc 1 576 5 is_stmt 1 view .LVU697
+# dudect/fixture.c:577: }
+	.loc 1 577 1 is_stmt 0 view .LVU698
+	movl	worker_cnt(%rip), %eax	# worker_cnt,
+	ret	
+	.cfi_endproc
+.LFE48:
+	.size	worker_results, .-worker_results
+	.local	worker_cnt
+	.comm	worker_cnt,4,4
+	.local	worker_result
+	.comm	worker_result,2048,32
+	.local	element_cnt
+	.comm	element_cnt,16,16
+	.local	element_ticks
+	.comm	element_ticks,16,16
+	.local	last_result
+	.comm	last_result,32,32
+	.local	crop_bucket
+	.comm	crop_bucket,4800,32
+	.local	center
+	.comm	center,48,32
+	.local	crop_samples
+	.comm	crop_samples,32,32
+	.local	crop_fractions
+	.comm	crop_fractions,800,32
+	.local	percentiles
+	.comm	percentiles,800,32
+	.local	t
+	.comm	t,816,32
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC1:
+	.long	0
+	.long	1086556160
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC3:
+	.long	-1
+	.long	2147483647
+	.long	0
+	.long	0
+	.section	.rodata.cst8
+	.align 8
+.LC5:
+	.long	0
+	.long	1093567616
+	.align 8
+.LC8:
+	.long	0
+	.long	1072693248
+	.align 8
+.LC9:
+	.long	0
+	.long	1077477376
+	.align 8
+.LC11:
+	.long	0
+	.long	1082081280
+	.align 8
+.LC12:
+	.long	0
+	.long	1076101120
+	.align 8
+.LC14:
+	.long	0
+	.long	2146435072
+	.align 8
+.LC16:
+	.long	0
+	.long	1071644672
+	.align 8
+.LC17:
+	.long	0
+	.long	1064304640
+	.align 8
+.LC19:
+	.long	1717986918
+	.long	1072064102
+	.align 8
+.LC20:
+	.long	0
+	.long	1073217536
+	.align 8
+.LC22:
+	.long	0
+	.long	1079574528
+	.align 8
+.LC24:
+	.long	0
+	.long	1076494336
+	.align 8
+.LC25:
+	.long	0
+	.long	1083129856
+	.align 8
+.LC26:
+	.long	0
+	.long	1074266112
+	.align 8
+.LC28:
+	.long	0
+	.long	1104006501
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "./queue.h"
+	.file 7 "dudect/constant.h"
+	.file 8 "dudect/fixture.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 10 "/usr/include/sched.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 14 "/usr/include/stdio.h"
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.file 17 "dudect/../console.h"
+	.file 18 "dudect/percentile.h"
+	.file 19 "dudect/timer.h"
+	.file 20 "dudect/ttest.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 22 "/usr/include/unistd.h"
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/wait.h"
+	.file 24 "/usr/include/string.h"
+	.file 25 "/usr/include/time.h"
+	.file 26 "/usr/include/stdlib.h"
+	.file 27 "dudect/measfile.h"
+	.file 28 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x29fd
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x41
+	.long	.LASF433
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x9
+	.long	.LASF11
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x35
+	.uleb128 0x13
+	.long	0x43
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x13
+	.long	0x54
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF5
+	.uleb128 0xe
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF6
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF7
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF9
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x9
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x6e
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF13
+	.uleb128 0x9
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x3c
+	.uleb128 0x9
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x98
+	.byte	0x19
+	.long	0x3c
+	.uleb128 0x9
+	.long	.LASF16
+	.byte	0x3
+	.byte	0x99
+	.byte	0x1b
+	.long	0x3c
+	.uleb128 0x9
+	.long	.LASF17
+	.byte	0x3
+	.byte	0x9a
+	.byte	0x19
+	.long	0x54
+	.uleb128 0xb
+	.long	0x54
+	.long	0xdd
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF18
+	.byte	0x3
+	.byte	0xa0
+	.byte	0x1a
+	.long	0x3c
+	.uleb128 0x9
+	.long	.LASF19
+	.byte	0x3
+	.byte	0xa9
+	.byte	0x1d
+	.long	0x54
+	.uleb128 0x43
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF20
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x3c
+	.uleb128 0x9
+	.long	.LASF21
+	.byte	0x3
+	.byte	0xc5
+	.byte	0x21
+	.long	0x3c
+	.uleb128 0x6
+	.long	0x114
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF22
+	.uleb128 0x13
+	.long	0x114
+	.uleb128 0x9
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x13
+	.long	0x9d
+	.uleb128 0x13
+	.long	0x120
+	.uleb128 0x9
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x8a
+	.uleb128 0x13
+	.long	0x131
+	.uleb128 0x44
+	.string	"ELE"
+	.byte	0x10
+	.byte	0x6
+	.byte	0x11
+	.byte	0x10
+	.long	0x16a
+	.uleb128 0x5
+	.long	.LASF25
+	.byte	0x6
+	.byte	0x15
+	.byte	0xb
+	.long	0x10f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x16
+	.byte	0x11
+	.long	0x16a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0x142
+	.uleb128 0x9
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x17
+	.byte	0x3
+	.long	0x142
+	.uleb128 0x1e
+	.byte	0x18
+	.byte	0x6
+	.byte	0x1a
+	.long	0x1ab
+	.uleb128 0x5
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x11
+	.long	0x1ab
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x11
+	.long	0x1ab
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF30
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x9
+	.long	0x54
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	0x16f
+	.uleb128 0x9
+	.long	.LASF31
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x3
+	.long	0x17b
+	.uleb128 0x36
+	.long	0x7c
+	.byte	0x7
+	.byte	0xa
+	.byte	0x6
+	.long	0x1f9
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x7
+	.byte	0
+	.uleb128 0x1e
+	.byte	0x30
+	.byte	0x7
+	.byte	0x16
+	.long	0x250
+	.uleb128 0x5
+	.long	.LASF40
+	.byte	0x7
+	.byte	0x17
+	.byte	0xb
+	.long	0x10f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF41
+	.byte	0x7
+	.byte	0x19
+	.byte	0xa
+	.long	0x250
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF42
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x10
+	.long	0x26b
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF43
+	.byte	0x7
+	.byte	0x1d
+	.byte	0x10
+	.long	0x284
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF44
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xc
+	.long	0x294
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF45
+	.byte	0x7
+	.byte	0x24
+	.byte	0xc
+	.long	0x294
+	.byte	0x28
+	.byte	0
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF46
+	.uleb128 0x37
+	.long	0x266
+	.long	0x266
+	.uleb128 0x3
+	.long	0x43
+	.byte	0
+	.uleb128 0x6
+	.long	0x1b0
+	.uleb128 0x6
+	.long	0x257
+	.uleb128 0x37
+	.long	0x266
+	.long	0x284
+	.uleb128 0x3
+	.long	0x266
+	.uleb128 0x3
+	.long	0x10f
+	.byte	0
+	.uleb128 0x6
+	.long	0x270
+	.uleb128 0x45
+	.long	0x294
+	.uleb128 0x3
+	.long	0x266
+	.byte	0
+	.uleb128 0x6
+	.long	0x289
+	.uleb128 0x9
+	.long	.LASF47
+	.byte	0x7
+	.byte	0x25
+	.byte	0x3
+	.long	0x1f9
+	.uleb128 0x13
+	.long	0x299
+	.uleb128 0xb
+	.long	0x2a5
+	.long	0x2ba
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x6
+	.byte	0
+	.uleb128 0x13
+	.long	0x2aa
+	.uleb128 0x12
+	.long	.LASF96
+	.byte	0x7
+	.byte	0x27
+	.byte	0x17
+	.long	0x2ba
+	.uleb128 0x1e
+	.byte	0x20
+	.byte	0x8
+	.byte	0x16
+	.long	0x308
+	.uleb128 0x5
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x17
+	.byte	0x9
+	.long	0x54
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF49
+	.byte	0x8
+	.byte	0x18
+	.byte	0xc
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF50
+	.byte	0x8
+	.byte	0x19
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF51
+	.byte	0x8
+	.byte	0x1a
+	.byte	0xc
+	.long	0x2e
+	.byte	0x18
+	.byte	0
+	.uleb128 0x13
+	.long	0x2e
+	.uleb128 0x9
+	.long	.LASF52
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x3
+	.long	0x2cb
+	.uleb128 0x13
+	.long	0x30d
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF53
+	.uleb128 0x38
+	.long	.LASF54
+	.byte	0x10
+	.byte	0x9
+	.byte	0xb
+	.long	0x34c
+	.uleb128 0x5
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x10
+	.byte	0xc
+	.long	0xdd
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF56
+	.byte	0x9
+	.byte	0x15
+	.byte	0x15
+	.long	0x103
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF57
+	.byte	0xa
+	.byte	0x26
+	.byte	0x11
+	.long	0xc1
+	.uleb128 0x9
+	.long	.LASF58
+	.byte	0xb
+	.byte	0x20
+	.byte	0x19
+	.long	0x35
+	.uleb128 0x1e
+	.byte	0x80
+	.byte	0xb
+	.byte	0x27
+	.long	0x37a
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0xb
+	.byte	0x29
+	.byte	0xe
+	.long	0x37a
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x358
+	.long	0x38a
+	.uleb128 0xc
+	.long	0x35
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF60
+	.byte	0xb
+	.byte	0x2a
+	.byte	0x3
+	.long	0x364
+	.uleb128 0x13
+	.long	0x38a
+	.uleb128 0x38
+	.long	.LASF61
+	.byte	0xd8
+	.byte	0xc
+	.byte	0x31
+	.long	0x521
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0xc
+	.byte	0x33
+	.byte	0x7
+	.long	0x54
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0xc
+	.byte	0x36
+	.byte	0x9
+	.long	0x10f
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF64
+	.byte	0xc
+	.byte	0x37
+	.byte	0x9
+	.long	0x10f
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0xc
+	.byte	0x38
+	.byte	0x9
+	.long	0x10f
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF66
+	.byte	0xc
+	.byte	0x39
+	.byte	0x9
+	.long	0x10f
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF67
+	.byte	0xc
+	.byte	0x3a
+	.byte	0x9
+	.long	0x10f
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF68
+	.byte	0xc
+	.byte	0x3b
+	.byte	0x9
+	.long	0x10f
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF69
+	.byte	0xc
+	.byte	0x3c
+	.byte	0x9
+	.long	0x10f
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0xc
+	.byte	0x3d
+	.byte	0x9
+	.long	0x10f
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF71
+	.byte	0xc
+	.byte	0x40
+	.byte	0x9
+	.long	0x10f
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF72
+	.byte	0xc
+	.byte	0x41
+	.byte	0x9
+	.long	0x10f
+	.byte	0x50
+	.uleb128 0x5
+	.long	.LASF73
+	.byte	0xc
+	.byte	0x42
+	.byte	0x9
+	.long	0x10f
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF74
+	.byte	0xc
+	.byte	0x44
+	.byte	0x16
+	.long	0x53a
+	.byte	0x60
+	.uleb128 0x5
+	.long	.LASF75
+	.byte	0xc
+	.byte	0x46
+	.byte	0x14
+	.long	0x53f
+	.byte	0x68
+	.uleb128 0x5
+	.long	.LASF76
+	.byte	0xc
+	.byte	0x48
+	.byte	0x7
+	.long	0x54
+	.byte	0x70
+	.uleb128 0x5
+	.long	.LASF77
+	.byte	0xc
+	.byte	0x49
+	.byte	0x7
+	.long	0x54
+	.byte	0x74
+	.uleb128 0x5
+	.long	.LASF78
+	.byte	0xc
+	.byte	0x4a
+	.byte	0xb
+	.long	0xa9
+	.byte	0x78
+	.uleb128 0x5
+	.long	.LASF79
+	.byte	0xc
+	.byte	0x4d
+	.byte	0x12
+	.long	0x75
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF80
+	.byte	0xc
+	.byte	0x4e
+	.byte	0xf
+	.long	0x83
+	.byte	0x82
+	.uleb128 0x5
+	.long	.LASF81
+	.byte	0xc
+	.byte	0x4f
+	.byte	0x8
+	.long	0x544
+	.byte	0x83
+	.uleb128 0x5
+	.long	.LASF82
+	.byte	0xc
+	.byte	0x51
+	.byte	0xf
+	.long	0x554
+	.byte	0x88
+	.uleb128 0x5
+	.long	.LASF83
+	.byte	0xc
+	.byte	0x59
+	.byte	0xd
+	.long	0xb5
+	.byte	0x90
+	.uleb128 0x5
+	.long	.LASF84
+	.byte	0xc
+	.byte	0x5b
+	.byte	0x17
+	.long	0x55e
+	.byte	0x98
+	.uleb128 0x5
+	.long	.LASF85
+	.byte	0xc
+	.byte	0x5c
+	.byte	0x19
+	.long	0x568
+	.byte	0xa0
+	.uleb128 0x5
+	.long	.LASF86
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x14
+	.long	0x53f
+	.byte	0xa8
+	.uleb128 0x5
+	.long	.LASF87
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x9
+	.long	0xf5
+	.byte	0xb0
+	.uleb128 0x5
+	.long	.LASF88
+	.byte	0xc
+	.byte	0x5f
+	.byte	0xa
+	.long	0x43
+	.byte	0xb8
+	.uleb128 0x5
+	.long	.LASF89
+	.byte	0xc
+	.byte	0x60
+	.byte	0x7
+	.long	0x54
+	.byte	0xc0
+	.uleb128 0x5
+	.long	.LASF90
+	.byte	0xc
+	.byte	0x62
+	.byte	0x8
+	.long	0x56d
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF91
+	.byte	0xd
+	.byte	0x7
+	.byte	0x19
+	.long	0x39b
+	.uleb128 0x46
+	.long	.LASF434
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x2f
+	.long	.LASF92
+	.uleb128 0x6
+	.long	0x535
+	.uleb128 0x6
+	.long	0x39b
+	.uleb128 0xb
+	.long	0x114
+	.long	0x554
+	.uleb128 0xc
+	.long	0x35
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x52d
+	.uleb128 0x2f
+	.long	.LASF93
+	.uleb128 0x6
+	.long	0x559
+	.uleb128 0x2f
+	.long	.LASF94
+	.uleb128 0x6
+	.long	0x563
+	.uleb128 0xb
+	.long	0x114
+	.long	0x57d
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x13
+	.byte	0
+	.uleb128 0x6
+	.long	0x11b
+	.uleb128 0x9
+	.long	.LASF95
+	.byte	0xe
+	.byte	0x4d
+	.byte	0x13
+	.long	0xf7
+	.uleb128 0x6
+	.long	0x521
+	.uleb128 0x12
+	.long	.LASF97
+	.byte	0xe
+	.byte	0x90
+	.byte	0xe
+	.long	0x58e
+	.uleb128 0x9
+	.long	.LASF98
+	.byte	0xf
+	.byte	0x7
+	.byte	0x15
+	.long	0xe9
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF99
+	.uleb128 0x6
+	.long	0x5b7
+	.uleb128 0x47
+	.uleb128 0x36
+	.long	0x7c
+	.byte	0x10
+	.byte	0x48
+	.byte	0x3
+	.long	0xadb
+	.uleb128 0x1
+	.long	.LASF100
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF101
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF102
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF103
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF104
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF111
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF112
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF121
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF122
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF123
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF124
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF125
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF126
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF127
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF128
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF131
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF155
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF157
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF167
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF168
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF169
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF170
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF171
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF172
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF173
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF174
+	.byte	0x49
+	.uleb128 0x1
+	.long	.LASF175
+	.byte	0x4a
+	.uleb128 0x1
+	.long	.LASF176
+	.byte	0x4b
+	.uleb128 0x1
+	.long	.LASF177
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x4d
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0x59
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0x5b
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0x5d
+	.uleb128 0x1
+	.long	.LASF195
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF196
+	.byte	0x5f
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF198
+	.byte	0x61
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF200
+	.byte	0x63
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF202
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF206
+	.byte	0x69
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0x6a
+	.uleb128 0x1
+	.long	.LASF208
+	.byte	0x6b
+	.uleb128 0x1
+	.long	.LASF209
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0x6d
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0x6e
+	.uleb128 0x1
+	.long	.LASF212
+	.byte	0x6f
+	.uleb128 0x1
+	.long	.LASF213
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0x71
+	.uleb128 0x1
+	.long	.LASF215
+	.byte	0x72
+	.uleb128 0x1
+	.long	.LASF216
+	.byte	0x73
+	.uleb128 0x1
+	.long	.LASF217
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF218
+	.byte	0x75
+	.uleb128 0x1
+	.long	.LASF219
+	.byte	0x76
+	.uleb128 0x1
+	.long	.LASF220
+	.byte	0x77
+	.uleb128 0x1
+	.long	.LASF221
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF222
+	.byte	0x79
+	.uleb128 0x1
+	.long	.LASF223
+	.byte	0x7a
+	.uleb128 0x1
+	.long	.LASF224
+	.byte	0x7b
+	.uleb128 0x1
+	.long	.LASF225
+	.byte	0x7c
+	.uleb128 0x1
+	.long	.LASF226
+	.byte	0x7d
+	.uleb128 0x1
+	.long	.LASF227
+	.byte	0x7e
+	.uleb128 0x1
+	.long	.LASF228
+	.byte	0x7f
+	.uleb128 0x1
+	.long	.LASF229
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF230
+	.byte	0x81
+	.uleb128 0x1
+	.long	.LASF231
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF232
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF233
+	.byte	0x84
+	.uleb128 0x1
+	.long	.LASF234
+	.byte	0x85
+	.uleb128 0x1
+	.long	.LASF235
+	.byte	0x86
+	.uleb128 0x1
+	.long	.LASF236
+	.byte	0x87
+	.uleb128 0x1
+	.long	.LASF237
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF238
+	.byte	0x89
+	.uleb128 0x1
+	.long	.LASF239
+	.byte	0x8a
+	.uleb128 0x1
+	.long	.LASF240
+	.byte	0x8b
+	.uleb128 0x1
+	.long	.LASF241
+	.byte	0x8c
+	.uleb128 0x1
+	.long	.LASF242
+	.byte	0x8d
+	.uleb128 0x1
+	.long	.LASF243
+	.byte	0x8e
+	.uleb128 0x1
+	.long	.LASF244
+	.byte	0x8f
+	.uleb128 0x1
+	.long	.LASF245
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF246
+	.byte	0x91
+	.uleb128 0x1
+	.long	.LASF247
+	.byte	0x92
+	.uleb128 0x1
+	.long	.LASF248
+	.byte	0x93
+	.uleb128 0x1
+	.long	.LASF249
+	.byte	0x94
+	.uleb128 0x1
+	.long	.LASF250
+	.byte	0x95
+	.uleb128 0x1
+	.long	.LASF251
+	.byte	0x96
+	.uleb128 0x1
+	.long	.LASF252
+	.byte	0x97
+	.uleb128 0x1
+	.long	.LASF253
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF254
+	.byte	0x99
+	.uleb128 0x1
+	.long	.LASF255
+	.byte	0x9a
+	.uleb128 0x1
+	.long	.LASF256
+	.byte	0x9b
+	.uleb128 0x1
+	.long	.LASF257
+	.byte	0x9c
+	.uleb128 0x1
+	.long	.LASF258
+	.byte	0x9d
+	.uleb128 0x1
+	.long	.LASF259
+	.byte	0x9e
+	.uleb128 0x1
+	.long	.LASF260
+	.byte	0x9f
+	.uleb128 0x1
+	.long	.LASF261
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF262
+	.byte	0xa1
+	.uleb128 0x1
+	.long	.LASF263
+	.byte	0xa2
+	.uleb128 0x1
+	.long	.LASF264
+	.byte	0xa3
+	.uleb128 0x1
+	.long	.LASF265
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF266
+	.byte	0xa5
+	.uleb128 0x1
+	.long	.LASF267
+	.byte	0xa6
+	.uleb128 0x1
+	.long	.LASF268
+	.byte	0xa7
+	.uleb128 0x1
+	.long	.LASF269
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF270
+	.byte	0xa9
+	.uleb128 0x1
+	.long	.LASF271
+	.byte	0xaa
+	.uleb128 0x1
+	.long	.LASF272
+	.byte	0xab
+	.uleb128 0x1
+	.long	.LASF273
+	.byte	0xac
+	.uleb128 0x1
+	.long	.LASF274
+	.byte	0xad
+	.uleb128 0x1
+	.long	.LASF275
+	.byte	0xae
+	.uleb128 0x1
+	.long	.LASF276
+	.byte	0xaf
+	.uleb128 0x1
+	.long	.LASF277
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF278
+	.byte	0xb1
+	.uleb128 0x1
+	.long	.LASF279
+	.byte	0xb2
+	.uleb128 0x1
+	.long	.LASF280
+	.byte	0xb3
+	.uleb128 0x1
+	.long	.LASF281
+	.byte	0xb4
+	.uleb128 0x1
+	.long	.LASF282
+	.byte	0xb5
+	.uleb128 0x1
+	.long	.LASF283
+	.byte	0xb6
+	.uleb128 0x1
+	.long	.LASF284
+	.byte	0xb7
+	.uleb128 0x1
+	.long	.LASF285
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF286
+	.byte	0xb9
+	.uleb128 0x1
+	.long	.LASF287
+	.byte	0xba
+	.uleb128 0x1
+	.long	.LASF288
+	.byte	0xbb
+	.uleb128 0x1
+	.long	.LASF289
+	.byte	0xbc
+	.uleb128 0x1
+	.long	.LASF290
+	.byte	0xbd
+	.uleb128 0x1
+	.long	.LASF291
+	.byte	0xbe
+	.uleb128 0x1
+	.long	.LASF292
+	.byte	0xbf
+	.uleb128 0x1
+	.long	.LASF293
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF294
+	.byte	0xc1
+	.uleb128 0x1
+	.long	.LASF295
+	.byte	0xc2
+	.uleb128 0x1
+	.long	.LASF296
+	.byte	0xc3
+	.uleb128 0x1
+	.long	.LASF297
+	.byte	0xc4
+	.uleb128 0x1
+	.long	.LASF298
+	.byte	0xc5
+	.uleb128 0x1
+	.long	.LASF299
+	.byte	0xc6
+	.uleb128 0x1
+	.long	.LASF300
+	.byte	0xc7
+	.uleb128 0x1
+	.long	.LASF301
+	.byte	0xeb
+	.uleb128 0x1
+	.long	.LASF302
+	.byte	0xec
+	.uleb128 0x1
+	.long	.LASF303
+	.byte	0xed
+	.uleb128 0x1
+	.long	.LASF304
+	.byte	0xee
+	.uleb128 0x1
+	.long	.LASF305
+	.byte	0xef
+	.uleb128 0x1
+	.long	.LASF306
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF307
+	.byte	0xf1
+	.uleb128 0x1
+	.long	.LASF308
+	.byte	0xf2
+	.uleb128 0x1
+	.long	.LASF309
+	.byte	0xf3
+	.uleb128 0x1
+	.long	.LASF310
+	.byte	0xf4
+	.uleb128 0x1
+	.long	.LASF311
+	.byte	0xf5
+	.uleb128 0x1
+	.long	.LASF312
+	.byte	0xf6
+	.uleb128 0x1
+	.long	.LASF313
+	.byte	0xf7
+	.uleb128 0x1
+	.long	.LASF314
+	.byte	0xf8
+	.uleb128 0x1
+	.long	.LASF315
+	.byte	0xf9
+	.uleb128 0x1
+	.long	.LASF316
+	.byte	0xfa
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF317
+	.byte	0x11
+	.byte	0xb
+	.byte	0xd
+	.long	0x250
+	.uleb128 0x12
+	.long	.LASF318
+	.byte	0x11
+	.byte	0xc
+	.byte	0xd
+	.long	0x250
+	.uleb128 0x6
+	.long	0x54
+	.uleb128 0x1e
+	.byte	0x20
+	.byte	0x12
+	.byte	0xf
+	.long	0xb35
+	.uleb128 0x5
+	.long	.LASF319
+	.byte	0x12
+	.byte	0x10
+	.byte	0xe
+	.long	0xb35
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF320
+	.byte	0x12
+	.byte	0x11
+	.byte	0xc
+	.long	0x43
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF321
+	.byte	0x12
+	.byte	0x12
+	.byte	0xc
+	.long	0x43
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF26
+	.byte	0x12
+	.byte	0x13
+	.byte	0xc
+	.long	0x43
+	.byte	0x18
+	.byte	0
+	.uleb128 0x6
+	.long	0x120
+	.uleb128 0x9
+	.long	.LASF322
+	.byte	0x12
+	.byte	0x14
+	.byte	0x3
+	.long	0xaf8
+	.uleb128 0x12
+	.long	.LASF323
+	.byte	0x13
+	.byte	0x16
+	.byte	0xc
+	.long	0x54
+	.uleb128 0x1e
+	.byte	0x30
+	.byte	0x14
+	.byte	0x5
+	.long	0xb7b
+	.uleb128 0x5
+	.long	.LASF324
+	.byte	0x14
+	.byte	0x6
+	.byte	0xc
+	.long	0xb7b
+	.byte	0
+	.uleb128 0x39
+	.string	"m2"
+	.byte	0x7
+	.long	0xb7b
+	.byte	0x10
+	.uleb128 0x39
+	.string	"n"
+	.byte	0x8
+	.long	0xb7b
+	.byte	0x20
+	.byte	0
+	.uleb128 0xb
+	.long	0x2e
+	.long	0xb8b
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF325
+	.byte	0x14
+	.byte	0x9
+	.byte	0x3
+	.long	0xb52
+	.uleb128 0x13
+	.long	0xb8b
+	.uleb128 0x12
+	.long	.LASF326
+	.byte	0x1
+	.byte	0x31
+	.byte	0xc
+	.long	0x54
+	.uleb128 0x12
+	.long	.LASF327
+	.byte	0x1
+	.byte	0x32
+	.byte	0xc
+	.long	0x54
+	.uleb128 0x12
+	.long	.LASF328
+	.byte	0x1
+	.byte	0x33
+	.byte	0xc
+	.long	0x54
+	.uleb128 0x12
+	.long	.LASF329
+	.byte	0x1
+	.byte	0x34
+	.byte	0xc
+	.long	0x54
+	.uleb128 0xb
+	.long	0xbdc
+	.long	0xbdc
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x65
+	.byte	0
+	.uleb128 0x6
+	.long	0xb8b
+	.uleb128 0x48
+	.string	"t"
+	.byte	0x1
+	.byte	0x3c
+	.byte	0xf
+	.long	0xbcc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	t
+	.uleb128 0xb
+	.long	0x120
+	.long	0xc05
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x63
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF330
+	.byte	0x3d
+	.byte	0x10
+	.long	0xbf5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	percentiles
+	.uleb128 0xb
+	.long	0x2e
+	.long	0xc2a
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x63
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF331
+	.byte	0x3e
+	.byte	0xf
+	.long	0xc1a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crop_fractions
+	.uleb128 0x1f
+	.long	.LASF332
+	.byte	0x3f
+	.byte	0x12
+	.long	0xb3a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crop_samples
+	.uleb128 0x1f
+	.long	.LASF333
+	.byte	0x45
+	.byte	0xe
+	.long	0xb8b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	center
+	.uleb128 0x12
+	.long	.LASF334
+	.byte	0x1
+	.byte	0x46
+	.byte	0x12
+	.long	0x5b
+	.uleb128 0x12
+	.long	.LASF335
+	.byte	0x1
+	.byte	0x47
+	.byte	0x15
+	.long	0x4f
+	.uleb128 0x12
+	.long	.LASF336
+	.byte	0x1
+	.byte	0x48
+	.byte	0x15
+	.long	0x4f
+	.uleb128 0xb
+	.long	0xb8b
+	.long	0xc9d
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x63
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF337
+	.byte	0x85
+	.byte	0xe
+	.long	0xc8d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crop_bucket
+	.uleb128 0x1f
+	.long	.LASF338
+	.byte	0xce
+	.byte	0x17
+	.long	0x30d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	last_result
+	.uleb128 0xb
+	.long	0xb35
+	.long	0xcd7
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF339
+	.value	0x11d
+	.byte	0x11
+	.long	0xcc7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	element_ticks
+	.uleb128 0xb
+	.long	0x43
+	.long	0xcfd
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF340
+	.value	0x11e
+	.byte	0xf
+	.long	0xced
+	.uleb128 0x9
+	.byte	0x3
+	.quad	element_cnt
+	.uleb128 0xb
+	.long	0x30d
+	.long	0xd23
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF341
+	.value	0x16d
+	.byte	0x17
+	.long	0xd13
+	.uleb128 0x9
+	.byte	0x3
+	.quad	worker_result
+	.uleb128 0x1c
+	.long	.LASF342
+	.value	0x16e
+	.byte	0xc
+	.long	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	worker_cnt
+	.uleb128 0x20
+	.long	.LASF343
+	.byte	0x15
+	.byte	0x8f
+	.byte	0x1
+	.long	0x2e
+	.long	0xd65
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF344
+	.byte	0x16
+	.value	0x173
+	.byte	0x10
+	.long	0x582
+	.long	0xd86
+	.uleb128 0x3
+	.long	0x54
+	.uleb128 0x3
+	.long	0xf5
+	.uleb128 0x3
+	.long	0x43
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF345
+	.byte	0x14
+	.byte	0xc
+	.byte	0x8
+	.long	0x2e
+	.long	0xd9c
+	.uleb128 0x3
+	.long	0xbdc
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF346
+	.byte	0x17
+	.byte	0x6a
+	.byte	0x10
+	.long	0xc1
+	.long	0xdbc
+	.uleb128 0x3
+	.long	0xc1
+	.uleb128 0x3
+	.long	0xaf3
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF347
+	.byte	0x16
+	.value	0x270
+	.long	0xdce
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF348
+	.byte	0x16
+	.value	0x17a
+	.byte	0x10
+	.long	0x582
+	.long	0xdef
+	.uleb128 0x3
+	.long	0x54
+	.uleb128 0x3
+	.long	0x5b2
+	.uleb128 0x3
+	.long	0x43
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF349
+	.byte	0xa
+	.byte	0x82
+	.byte	0xc
+	.long	0x54
+	.long	0xe0f
+	.uleb128 0x3
+	.long	0xc1
+	.uleb128 0x3
+	.long	0x43
+	.uleb128 0x3
+	.long	0xe0f
+	.byte	0
+	.uleb128 0x6
+	.long	0x396
+	.uleb128 0x16
+	.long	.LASF350
+	.byte	0x16
+	.value	0x166
+	.byte	0xc
+	.long	0x54
+	.long	0xe2b
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF435
+	.byte	0x16
+	.value	0x30a
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x16
+	.long	.LASF351
+	.byte	0x16
+	.value	0x1b5
+	.byte	0xc
+	.long	0x54
+	.long	0xe4f
+	.uleb128 0x3
+	.long	0xaf3
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF352
+	.byte	0xe
+	.byte	0xe6
+	.byte	0xc
+	.long	0x54
+	.long	0xe65
+	.uleb128 0x3
+	.long	0x58e
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF374
+	.byte	0x1
+	.byte	0x35
+	.byte	0xd
+	.long	0xe73
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF353
+	.byte	0x16
+	.value	0x280
+	.byte	0x11
+	.long	0x3c
+	.long	0xe8a
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x4a
+	.string	"pow"
+	.byte	0x15
+	.byte	0x8c
+	.byte	0x1
+	.long	0x2e
+	.long	0xea5
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF354
+	.byte	0x12
+	.byte	0x16
+	.long	0xebb
+	.uleb128 0x3
+	.long	0xebb
+	.uleb128 0x3
+	.long	0x43
+	.byte	0
+	.uleb128 0x6
+	.long	0xb3a
+	.uleb128 0x11
+	.long	.LASF355
+	.byte	0x12
+	.byte	0x17
+	.long	0xed1
+	.uleb128 0x3
+	.long	0xebb
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF356
+	.byte	0x18
+	.byte	0x3d
+	.byte	0xe
+	.long	0xf5
+	.long	0xef1
+	.uleb128 0x3
+	.long	0xf5
+	.uleb128 0x3
+	.long	0x54
+	.uleb128 0x3
+	.long	0x43
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF357
+	.byte	0x19
+	.value	0x120
+	.byte	0xc
+	.long	0x54
+	.long	0xf0d
+	.uleb128 0x3
+	.long	0x59f
+	.uleb128 0x3
+	.long	0xf0d
+	.byte	0
+	.uleb128 0x6
+	.long	0x325
+	.uleb128 0x16
+	.long	.LASF358
+	.byte	0x1a
+	.value	0x229
+	.byte	0xe
+	.long	0xf5
+	.long	0xf29
+	.uleb128 0x3
+	.long	0x43
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF359
+	.byte	0x14
+	.byte	0xe
+	.long	0xf3f
+	.uleb128 0x3
+	.long	0xbdc
+	.uleb128 0x3
+	.long	0xf3f
+	.byte	0
+	.uleb128 0x6
+	.long	0xb97
+	.uleb128 0x11
+	.long	.LASF360
+	.byte	0x14
+	.byte	0xd
+	.long	0xf55
+	.uleb128 0x3
+	.long	0xbdc
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF361
+	.byte	0x14
+	.byte	0xb
+	.long	0xf70
+	.uleb128 0x3
+	.long	0xbdc
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x131
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF362
+	.byte	0x12
+	.byte	0x1b
+	.long	0xf90
+	.uleb128 0x3
+	.long	0xebb
+	.uleb128 0x3
+	.long	0xf90
+	.uleb128 0x3
+	.long	0x43
+	.uleb128 0x3
+	.long	0xb35
+	.byte	0
+	.uleb128 0x6
+	.long	0x308
+	.uleb128 0x11
+	.long	.LASF363
+	.byte	0x12
+	.byte	0x18
+	.long	0xfb0
+	.uleb128 0x3
+	.long	0xebb
+	.uleb128 0x3
+	.long	0xfb0
+	.uleb128 0x3
+	.long	0x43
+	.byte	0
+	.uleb128 0x6
+	.long	0x12c
+	.uleb128 0x11
+	.long	.LASF364
+	.byte	0x1b
+	.byte	0x2e
+	.long	0xfda
+	.uleb128 0x3
+	.long	0xfb0
+	.uleb128 0x3
+	.long	0xfda
+	.uleb128 0x3
+	.long	0xfdf
+	.uleb128 0x3
+	.long	0x43
+	.uleb128 0x3
+	.long	0x43
+	.byte	0
+	.uleb128 0x6
+	.long	0x13d
+	.uleb128 0x6
+	.long	0x4f
+	.uleb128 0x11
+	.long	.LASF365
+	.byte	0x7
+	.byte	0x30
+	.long	0x100e
+	.uleb128 0x3
+	.long	0xb35
+	.uleb128 0x3
+	.long	0xb35
+	.uleb128 0x3
+	.long	0x100e
+	.uleb128 0x3
+	.long	0x1013
+	.uleb128 0x3
+	.long	0x1013
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x6
+	.long	0x43
+	.uleb128 0x6
+	.long	0x131
+	.uleb128 0x11
+	.long	.LASF366
+	.byte	0x7
+	.byte	0x36
+	.long	0x1038
+	.uleb128 0x3
+	.long	0xb35
+	.uleb128 0x3
+	.long	0xb35
+	.uleb128 0x3
+	.long	0x1013
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF367
+	.byte	0x7
+	.byte	0x29
+	.long	0x104e
+	.uleb128 0x3
+	.long	0x1013
+	.uleb128 0x3
+	.long	0x1013
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF368
+	.byte	0x1a
+	.value	0x27d
+	.long	0x1060
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF377
+	.byte	0x1b
+	.byte	0x35
+	.uleb128 0x4b
+	.long	.LASF369
+	.byte	0x1a
+	.value	0x238
+	.byte	0xd
+	.long	0x107a
+	.uleb128 0x3
+	.long	0xf5
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF370
+	.byte	0x12
+	.byte	0x8
+	.long	0x109f
+	.uleb128 0x3
+	.long	0xfb0
+	.uleb128 0x3
+	.long	0x43
+	.uleb128 0x3
+	.long	0xf90
+	.uleb128 0x3
+	.long	0x43
+	.uleb128 0x3
+	.long	0xb35
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF371
+	.byte	0x1a
+	.value	0x22c
+	.byte	0xe
+	.long	0xf5
+	.long	0x10bb
+	.uleb128 0x3
+	.long	0x43
+	.uleb128 0x3
+	.long	0x43
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF372
+	.byte	0x1b
+	.byte	0x2b
+	.long	0x10cc
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF373
+	.byte	0xe
+	.value	0x164
+	.byte	0xc
+	.long	0x54
+	.long	0x10e4
+	.uleb128 0x3
+	.long	0x57d
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF375
+	.byte	0x7
+	.byte	0x55
+	.byte	0x6
+	.long	0x10f2
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF376
+	.byte	0x7
+	.byte	0x52
+	.byte	0x6
+	.long	0x1100
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF378
+	.byte	0x13
+	.byte	0x1c
+	.uleb128 0x28
+	.long	.LASF379
+	.value	0x23d
+	.byte	0x5
+	.long	0x54
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1139
+	.uleb128 0x4c
+	.long	.LASF436
+	.byte	0x1
+	.value	0x23d
+	.byte	0x2b
+	.long	0x1139
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x6
+	.long	0x113e
+	.uleb128 0x6
+	.long	0x319
+	.uleb128 0x4d
+	.long	.LASF437
+	.byte	0x1
+	.value	0x238
+	.byte	0x10
+	.long	0x30d
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x28
+	.long	.LASF380
+	.value	0x233
+	.byte	0x6
+	.long	0x250
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1198
+	.uleb128 0xa
+	.quad	.LVL280
+	.long	0x11ce
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF381
+	.value	0x22e
+	.byte	0x6
+	.long	0x250
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11ce
+	.uleb128 0xa
+	.quad	.LVL279
+	.long	0x11ce
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF382
+	.value	0x221
+	.byte	0x6
+	.long	0x250
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x182a
+	.uleb128 0x29
+	.long	.LASF384
+	.value	0x221
+	.byte	0x13
+	.long	0x54
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0xf
+	.string	"op"
+	.value	0x223
+	.byte	0x15
+	.long	0x182a
+	.uleb128 0x14
+	.long	.LASF383
+	.value	0x229
+	.byte	0xa
+	.long	0x250
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x17
+	.long	0x182f
+	.quad	.LBI136
+	.value	.LVU427
+	.long	.LLRL78
+	.value	0x229
+	.byte	0x13
+	.long	0x161c
+	.uleb128 0xd
+	.long	0x184a
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0xd
+	.long	0x183e
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x1a
+	.long	.LLRL78
+	.uleb128 0x7
+	.long	0x1856
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x21
+	.long	0x1862
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x21
+	.long	0x186e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x7
+	.long	0x187a
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x7
+	.long	0x1886
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x1d
+	.long	0x1892
+	.long	.LLRL84
+	.long	0x12c4
+	.uleb128 0x7
+	.long	0x1897
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0xa
+	.quad	.LVL190
+	.long	0xf12
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x1f05
+	.quad	.LBI140
+	.value	.LVU442
+	.long	.LLRL86
+	.value	0x1fa
+	.byte	0x5
+	.long	0x13bc
+	.uleb128 0x1d
+	.long	0x1f10
+	.long	.LLRL87
+	.long	0x1306
+	.uleb128 0x7
+	.long	0x1f11
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x8
+	.quad	.LVL197
+	.long	0xf44
+	.byte	0
+	.uleb128 0x17
+	.long	0x29cf
+	.quad	.LBI144
+	.value	.LVU454
+	.long	.LLRL89
+	.value	0x165
+	.byte	0x5
+	.long	0x1355
+	.uleb128 0x22
+	.long	0x29d9
+	.long	.LLRL89
+	.uleb128 0x7
+	.long	0x29da
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0xa
+	.quad	.LVL225
+	.long	0xe8a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3fe00000
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL195
+	.long	0x10f2
+	.uleb128 0x4
+	.quad	.LVL199
+	.long	0xf44
+	.long	0x1381
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	center
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL230
+	.long	0xec0
+	.long	0x13a0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crop_samples
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL238
+	.long	0xea5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crop_samples
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x18b2
+	.long	.LLRL91
+	.long	0x14c0
+	.uleb128 0x7
+	.long	0x18b7
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x17
+	.long	0x25f9
+	.quad	.LBI152
+	.value	.LVU609
+	.long	.LLRL93
+	.value	0x20f
+	.byte	0x11
+	.long	0x146c
+	.uleb128 0xd
+	.long	0x2614
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0xd
+	.long	0x2608
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x1a
+	.long	.LLRL93
+	.uleb128 0x7
+	.long	0x2620
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x7
+	.long	0x262c
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x4
+	.quad	.LVL255
+	.long	0x281b
+	.long	0x1450
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x408f4000
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL256
+	.long	0xd86
+	.uleb128 0x8
+	.quad	.LVL274
+	.long	0xd4f
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL253
+	.long	0x10cc
+	.long	0x149a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -124
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL262
+	.long	0x1f1d
+	.long	0x14b2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL263
+	.long	0x2639
+	.byte	0
+	.uleb128 0x1d
+	.long	0x18a2
+	.long	.LLRL98
+	.long	0x14f5
+	.uleb128 0x7
+	.long	0x18a7
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0xa
+	.quad	.LVL247
+	.long	0x10cc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.long	0x18c2
+	.quad	.LBB162
+	.quad	.LBE162-.LBB162
+	.long	0x1529
+	.uleb128 0x7
+	.long	0x18c3
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x8
+	.quad	.LVL269
+	.long	0x1067
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL193
+	.long	0x1100
+	.uleb128 0x4
+	.quad	.LVL194
+	.long	0x10cc
+	.long	0x155b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL232
+	.long	0xef1
+	.long	0x1579
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL240
+	.long	0x10bb
+	.long	0x1591
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL242
+	.long	0x1f1d
+	.long	0x15a9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL243
+	.long	0x1943
+	.long	0x15c7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL250
+	.long	0x2639
+	.uleb128 0x4
+	.quad	.LVL266
+	.long	0xef1
+	.long	0x15f2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL267
+	.long	0x1060
+	.uleb128 0xa
+	.quad	.LVL268
+	.long	0x10cc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC29
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x18cf
+	.quad	.LBI168
+	.value	.LVU464
+	.long	.LLRL101
+	.value	0x227
+	.byte	0x10
+	.long	0x1802
+	.uleb128 0xd
+	.long	0x18ea
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x2a
+	.long	0x18de
+	.uleb128 0x1a
+	.long	.LLRL101
+	.uleb128 0x21
+	.long	0x18f6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x21
+	.long	0x1902
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x7
+	.long	0x190e
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x1d
+	.long	0x191a
+	.long	.LLRL104
+	.long	0x16f8
+	.uleb128 0x7
+	.long	0x191f
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x2b
+	.long	0x29e5
+	.quad	.LBI171
+	.value	.LVU540
+	.quad	.LBB171
+	.quad	.LBE171-.LBB171
+	.value	0x1d1
+	.byte	0xd
+	.long	0x16c1
+	.uleb128 0xa
+	.quad	.LVL221
+	.long	0x104e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x6f
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL206
+	.long	0x109f
+	.long	0x16de
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL208
+	.long	0x109f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x192a
+	.long	.LLRL106
+	.long	0x1754
+	.uleb128 0x7
+	.long	0x192b
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x22
+	.long	0x1935
+	.long	.LLRL108
+	.uleb128 0x21
+	.long	0x1936
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x8
+	.quad	.LVL213
+	.long	0x1067
+	.uleb128 0xa
+	.quad	.LVL222
+	.long	0x107a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL204
+	.long	0x10cc
+	.long	0x1773
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL210
+	.long	0x1f1d
+	.long	0x178b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL215
+	.long	0x1060
+	.uleb128 0x4
+	.quad	.LVL217
+	.long	0x10cc
+	.long	0x17be
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x63
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL220
+	.long	0x10bb
+	.long	0x17d6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL276
+	.long	0x10cc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x63
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x7ff00000
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL202
+	.long	0x1100
+	.uleb128 0x8
+	.quad	.LVL203
+	.long	0x10f2
+	.uleb128 0x8
+	.quad	.LVL272
+	.long	0x10e4
+	.byte	0
+	.uleb128 0x6
+	.long	0x2a5
+	.uleb128 0x2c
+	.long	.LASF388
+	.value	0x1f1
+	.long	0x250
+	.long	0x18cf
+	.uleb128 0x18
+	.long	.LASF40
+	.value	0x1f1
+	.byte	0x1e
+	.long	0x10f
+	.uleb128 0x18
+	.long	.LASF384
+	.value	0x1f1
+	.byte	0x28
+	.long	0x54
+	.uleb128 0x19
+	.long	.LASF383
+	.value	0x1f3
+	.byte	0xa
+	.long	0x250
+	.uleb128 0x19
+	.long	.LASF385
+	.value	0x1fd
+	.byte	0x15
+	.long	0x325
+	.uleb128 0xf
+	.string	"end"
+	.value	0x1fd
+	.byte	0x1c
+	.long	0x325
+	.uleb128 0x19
+	.long	.LASF386
+	.value	0x200
+	.byte	0x9
+	.long	0x54
+	.uleb128 0x19
+	.long	.LASF387
+	.value	0x216
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2d
+	.long	0x18a2
+	.uleb128 0xf
+	.string	"i"
+	.value	0x1f4
+	.byte	0xe
+	.long	0x54
+	.byte	0
+	.uleb128 0x2d
+	.long	0x18b2
+	.uleb128 0xf
+	.string	"w"
+	.value	0x206
+	.byte	0x12
+	.long	0x54
+	.byte	0
+	.uleb128 0x2d
+	.long	0x18c2
+	.uleb128 0xf
+	.string	"i"
+	.value	0x20b
+	.byte	0x12
+	.long	0x54
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.string	"i"
+	.value	0x21b
+	.byte	0xe
+	.long	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF389
+	.value	0x1c8
+	.long	0x250
+	.long	0x1943
+	.uleb128 0x18
+	.long	.LASF40
+	.value	0x1c8
+	.byte	0x1f
+	.long	0x10f
+	.uleb128 0x18
+	.long	.LASF384
+	.value	0x1c8
+	.byte	0x29
+	.long	0x54
+	.uleb128 0x19
+	.long	.LASF390
+	.value	0x1d7
+	.byte	0xc
+	.long	0xb7b
+	.uleb128 0x19
+	.long	.LASF391
+	.value	0x1d8
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x19
+	.long	.LASF392
+	.value	0x1e7
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2d
+	.long	0x192a
+	.uleb128 0xf
+	.string	"c"
+	.value	0x1cd
+	.byte	0xe
+	.long	0x54
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.string	"c"
+	.value	0x1d9
+	.byte	0xe
+	.long	0x54
+	.uleb128 0x10
+	.uleb128 0xf
+	.string	"m"
+	.value	0x1da
+	.byte	0x11
+	.long	0x120
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF412
+	.byte	0x1
+	.value	0x183
+	.byte	0xd
+	.long	0x250
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e92
+	.uleb128 0x29
+	.long	.LASF384
+	.value	0x183
+	.byte	0x1d
+	.long	0x54
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x29
+	.long	.LASF386
+	.value	0x183
+	.byte	0x27
+	.long	0x54
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x14
+	.long	.LASF393
+	.value	0x185
+	.byte	0x9
+	.long	0x54
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x14
+	.long	.LASF394
+	.value	0x188
+	.byte	0xa
+	.long	0x3c
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x1c
+	.long	.LASF395
+	.value	0x18b
+	.byte	0xb
+	.long	0x1e92
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x2e
+	.string	"fds"
+	.value	0x18c
+	.byte	0x9
+	.long	0x1ea2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -576
+	.uleb128 0x15
+	.string	"ok"
+	.value	0x1ae
+	.byte	0xa
+	.long	0x250
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x2e
+	.string	"wt"
+	.value	0x1af
+	.byte	0xc
+	.long	0xbcc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1392
+	.uleb128 0x1c
+	.long	.LASF396
+	.value	0x1b0
+	.byte	0xb
+	.long	0x1eb2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6288
+	.uleb128 0x23
+	.long	.LLRL51
+	.long	0x1c38
+	.uleb128 0x15
+	.string	"w"
+	.value	0x191
+	.byte	0xe
+	.long	0x54
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x1a
+	.long	.LLRL53
+	.uleb128 0x2e
+	.string	"pfd"
+	.value	0x192
+	.byte	0xd
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6424
+	.uleb128 0x23
+	.long	.LLRL54
+	.long	0x1b8e
+	.uleb128 0x2e
+	.string	"set"
+	.value	0x19a
+	.byte	0x17
+	.long	0x38a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6416
+	.uleb128 0x15
+	.string	"ok"
+	.value	0x1a5
+	.byte	0x12
+	.long	0x250
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x23
+	.long	.LLRL56
+	.long	0x1a82
+	.uleb128 0x14
+	.long	.LASF397
+	.value	0x19c
+	.byte	0xd
+	.long	0x43
+	.long	.LLST57
+	.long	.LVUS57
+	.byte	0
+	.uleb128 0x32
+	.quad	.LBB88
+	.quad	.LBE88-.LBB88
+	.long	0x1ab7
+	.uleb128 0x15
+	.string	"i"
+	.value	0x1a1
+	.byte	0x16
+	.long	0x54
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x8
+	.quad	.LVL148
+	.long	0xf44
+	.byte	0
+	.uleb128 0x32
+	.quad	.LBB89
+	.quad	.LBE89-.LBB89
+	.long	0x1af3
+	.uleb128 0x15
+	.string	"b"
+	.value	0x1a3
+	.byte	0x16
+	.long	0x54
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0xa
+	.quad	.LVL152
+	.long	0x1f1d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LLRL60
+	.long	0x1b23
+	.uleb128 0x15
+	.string	"i"
+	.value	0x1a6
+	.byte	0x16
+	.long	0x54
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0xa
+	.quad	.LVL157
+	.long	0xdce
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL139
+	.long	0xe14
+	.uleb128 0x4
+	.quad	.LVL143
+	.long	0xdef
+	.long	0x1b54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6416
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL144
+	.long	0x1100
+	.uleb128 0x4
+	.quad	.LVL145
+	.long	0xec0
+	.long	0x1b80
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crop_samples
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL159
+	.long	0xdbc
+	.byte	0
+	.uleb128 0x2b
+	.long	0x29e5
+	.quad	.LBI81
+	.value	.LVU307
+	.quad	.LBB81
+	.quad	.LBE81-.LBB81
+	.value	0x194
+	.byte	0xd
+	.long	0x1bc9
+	.uleb128 0xa
+	.quad	.LVL137
+	.long	0x104e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x6f
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x29e5
+	.quad	.LBI83
+	.value	.LVU310
+	.quad	.LBB83
+	.quad	.LBE83-.LBB83
+	.value	0x197
+	.byte	0xd
+	.long	0x1c04
+	.uleb128 0xa
+	.quad	.LVL138
+	.long	0x104e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x6f
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL123
+	.long	0xe38
+	.long	0x1c1c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL124
+	.long	0xe2b
+	.uleb128 0x8
+	.quad	.LVL125
+	.long	0xe14
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.quad	.LBB97
+	.quad	.LBE97-.LBB97
+	.long	0x1c60
+	.uleb128 0x15
+	.string	"i"
+	.value	0x1b1
+	.byte	0xe
+	.long	0x54
+	.long	.LLST62
+	.long	.LVUS62
+	.byte	0
+	.uleb128 0x23
+	.long	.LLRL63
+	.long	0x1e5f
+	.uleb128 0x15
+	.string	"w"
+	.value	0x1b3
+	.byte	0xe
+	.long	0x54
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x1a
+	.long	.LLRL65
+	.uleb128 0x1c
+	.long	.LASF398
+	.value	0x1b4
+	.byte	0xd
+	.long	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6416
+	.uleb128 0x15
+	.string	"got"
+	.value	0x1b5
+	.byte	0xe
+	.long	0x250
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x15
+	.string	"mt"
+	.value	0x1bd
+	.byte	0xd
+	.long	0x54
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x23
+	.long	.LLRL68
+	.long	0x1ce0
+	.uleb128 0x15
+	.string	"i"
+	.value	0x1c1
+	.byte	0x12
+	.long	0x54
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x8
+	.quad	.LVL164
+	.long	0xf29
+	.byte	0
+	.uleb128 0x17
+	.long	0x1ec2
+	.quad	.LBI102
+	.value	.LVU403
+	.long	.LLRL70
+	.value	0x1b5
+	.byte	0x14
+	.long	0x1d78
+	.uleb128 0xd
+	.long	0x1ee4
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0xd
+	.long	0x1eda
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0xd
+	.long	0x1ed1
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x1a
+	.long	.LLRL70
+	.uleb128 0x7
+	.long	0x1eee
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x3c
+	.long	0x1ef8
+	.quad	.LBB104
+	.quad	.LBE104-.LBB104
+	.uleb128 0x7
+	.long	0x1ef9
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0xa
+	.quad	.LVL183
+	.long	0xd65
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL160
+	.long	0x281b
+	.long	0x1d91
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1392
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL162
+	.long	0xd86
+	.long	0x1da9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL170
+	.long	0xe14
+	.long	0x1dc1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL171
+	.long	0xd9c
+	.long	0x1df1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -6448
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL173
+	.long	0xe14
+	.long	0x1e09
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL174
+	.long	0xd9c
+	.long	0x1e39
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -6448
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL176
+	.long	0x10cc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -6460
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL116
+	.long	0xe73
+	.long	0x1e77
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x54
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL119
+	.long	0xe65
+	.uleb128 0x8
+	.quad	.LVL120
+	.long	0xe4f
+	.byte	0
+	.uleb128 0xb
+	.long	0x34c
+	.long	0x1ea2
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xb
+	.long	0x54
+	.long	0x1eb2
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xb
+	.long	0xb8b
+	.long	0x1ec2
+	.uleb128 0xc
+	.long	0x35
+	.byte	0x65
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF399
+	.value	0x170
+	.long	0x250
+	.long	0x1f05
+	.uleb128 0x33
+	.string	"fd"
+	.byte	0x1a
+	.long	0x54
+	.uleb128 0x33
+	.string	"buf"
+	.byte	0x24
+	.long	0xf5
+	.uleb128 0x33
+	.string	"len"
+	.byte	0x30
+	.long	0x43
+	.uleb128 0xf
+	.string	"p"
+	.value	0x172
+	.byte	0xb
+	.long	0x10f
+	.uleb128 0x10
+	.uleb128 0xf
+	.string	"n"
+	.value	0x174
+	.byte	0x11
+	.long	0x582
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF407
+	.value	0x15e
+	.long	0x1f1d
+	.uleb128 0x10
+	.uleb128 0xf
+	.string	"i"
+	.value	0x161
+	.byte	0xe
+	.long	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.long	.LASF438
+	.byte	0x1
+	.value	0x12e
+	.byte	0xd
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x25b1
+	.uleb128 0x29
+	.long	.LASF384
+	.value	0x12e
+	.byte	0x1f
+	.long	0x54
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x14
+	.long	.LASF400
+	.value	0x130
+	.byte	0xe
+	.long	0xb35
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x14
+	.long	.LASF401
+	.value	0x131
+	.byte	0xe
+	.long	0xb35
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x14
+	.long	.LASF402
+	.value	0x132
+	.byte	0xe
+	.long	0xb35
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x14
+	.long	.LASF403
+	.value	0x133
+	.byte	0xd
+	.long	0x100e
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x14
+	.long	.LASF404
+	.value	0x134
+	.byte	0xe
+	.long	0x1013
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x14
+	.long	.LASF405
+	.value	0x135
+	.byte	0xe
+	.long	0x1013
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x14
+	.long	.LASF406
+	.value	0x13f
+	.byte	0x9
+	.long	0x54
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x50
+	.long	0x2982
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.byte	0x1
+	.value	0x146
+	.byte	0x5
+	.long	0x202c
+	.uleb128 0x2a
+	.long	0x29a2
+	.uleb128 0x2a
+	.long	0x2997
+	.uleb128 0x2a
+	.long	0x298c
+	.uleb128 0x3c
+	.long	0x29ad
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.uleb128 0x7
+	.long	0x29ae
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x25b1
+	.quad	.LBI26
+	.value	.LVU47
+	.long	.LLRL9
+	.value	0x14f
+	.byte	0xd
+	.long	0x209c
+	.uleb128 0xd
+	.long	0x25d4
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xd
+	.long	0x25c8
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xd
+	.long	0x25bc
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x22
+	.long	0x25e0
+	.long	.LLRL9
+	.uleb128 0x7
+	.long	0x25e1
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x22
+	.long	0x25eb
+	.long	.LLRL14
+	.uleb128 0x7
+	.long	0x25ec
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x29e5
+	.quad	.LBI31
+	.value	.LVU58
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.value	0x13a
+	.byte	0x9
+	.long	0x20d7
+	.uleb128 0xa
+	.quad	.LVL23
+	.long	0x104e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x6f
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x29b9
+	.quad	.LBI34
+	.value	.LVU90
+	.long	.LLRL16
+	.value	0x151
+	.byte	0xd
+	.long	0x2189
+	.uleb128 0xd
+	.long	0x29c3
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x4
+	.quad	.LVL46
+	.long	0xf95
+	.long	0x2116
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL47
+	.long	0xf70
+	.long	0x214e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crop_fractions
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	percentiles
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL49
+	.long	0x107a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crop_fractions
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	percentiles
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x28d5
+	.quad	.LBI37
+	.value	.LVU97
+	.long	.LLRL18
+	.value	0x152
+	.byte	0xd
+	.long	0x239f
+	.uleb128 0xd
+	.long	0x28ea
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xd
+	.long	0x28df
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1d
+	.long	0x28f5
+	.long	.LLRL21
+	.long	0x22ec
+	.uleb128 0x7
+	.long	0x28f6
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x22
+	.long	0x28ff
+	.long	.LLRL23
+	.uleb128 0x7
+	.long	0x2900
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x7
+	.long	0x290b
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x51
+	.long	0x2945
+	.quad	.LBI40
+	.value	.LVU137
+	.long	.LLRL26
+	.byte	0x1
+	.byte	0xae
+	.byte	0x14
+	.long	0x2259
+	.uleb128 0xd
+	.long	0x2956
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1a
+	.long	.LLRL26
+	.uleb128 0x7
+	.long	0x2960
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x7
+	.long	0x296a
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x22
+	.long	0x2974
+	.long	.LLRL30
+	.uleb128 0x7
+	.long	0x2975
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.long	0x2914
+	.quad	.LBB49
+	.quad	.LBE49-.LBB49
+	.long	0x228d
+	.uleb128 0x7
+	.long	0x2915
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x8
+	.quad	.LVL67
+	.long	0xf55
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL54
+	.long	0xf55
+	.long	0x22b6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	center
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -128
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL59
+	.long	0xf55
+	.long	0x22d2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -128
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL64
+	.long	0xf55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -128
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.long	0x2924
+	.quad	.LBI53
+	.value	.LVU163
+	.quad	.LBB53
+	.quad	.LBE53-.LBB53
+	.byte	0x1
+	.byte	0xba
+	.byte	0x5
+	.uleb128 0x21
+	.long	0x292e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x31
+	.long	0x2939
+	.quad	.LBB55
+	.quad	.LBE55-.LBB55
+	.long	0x2388
+	.uleb128 0x7
+	.long	0x293a
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x4
+	.quad	.LVL72
+	.long	0xf29
+	.long	0x235b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL73
+	.long	0xf29
+	.long	0x2373
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL74
+	.long	0xf44
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL70
+	.long	0xf44
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL2
+	.long	0x109f
+	.long	0x23bc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL4
+	.long	0x109f
+	.long	0x23d9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL6
+	.long	0x109f
+	.long	0x23f6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL8
+	.long	0x109f
+	.long	0x2413
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL10
+	.long	0x109f
+	.long	0x2430
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL12
+	.long	0x109f
+	.long	0x2447
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL14
+	.long	0x1038
+	.long	0x2469
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -152
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL16
+	.long	0xfe4
+	.long	0x24a7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -136
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -152
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL24
+	.long	0x1018
+	.long	0x24d5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -152
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL25
+	.long	0x29ee
+	.long	0x24f4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL26
+	.long	0x1067
+	.long	0x250e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL27
+	.long	0x1067
+	.long	0x2526
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL28
+	.long	0x1067
+	.long	0x253e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL29
+	.long	0x1067
+	.long	0x2558
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -136
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL30
+	.long	0x1067
+	.long	0x2572
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL31
+	.long	0x1067
+	.long	0x258c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -152
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL34
+	.long	0xfb5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -136
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF408
+	.value	0x120
+	.long	0x25f9
+	.uleb128 0x18
+	.long	.LASF402
+	.value	0x120
+	.byte	0x26
+	.long	0xb35
+	.uleb128 0x18
+	.long	.LASF404
+	.value	0x121
+	.byte	0x26
+	.long	0x1013
+	.uleb128 0x18
+	.long	.LASF403
+	.value	0x122
+	.byte	0x25
+	.long	0x100e
+	.uleb128 0x10
+	.uleb128 0xf
+	.string	"i"
+	.value	0x124
+	.byte	0x11
+	.long	0x43
+	.uleb128 0x10
+	.uleb128 0xf
+	.string	"c"
+	.value	0x127
+	.byte	0xd
+	.long	0x54
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF409
+	.value	0x104
+	.long	0x250
+	.long	0x2639
+	.uleb128 0x18
+	.long	.LASF410
+	.value	0x104
+	.byte	0x19
+	.long	0x54
+	.uleb128 0x18
+	.long	.LASF386
+	.value	0x104
+	.byte	0x23
+	.long	0x54
+	.uleb128 0x19
+	.long	.LASF49
+	.value	0x10e
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x19
+	.long	.LASF411
+	.value	0x10f
+	.byte	0xc
+	.long	0x2e
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF413
+	.byte	0xd0
+	.byte	0xd
+	.long	0x250
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x281b
+	.uleb128 0x24
+	.string	"mt"
+	.byte	0xd2
+	.byte	0x9
+	.long	0x54
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x24
+	.string	"tt"
+	.byte	0xd3
+	.byte	0xc
+	.long	0xbdc
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x34
+	.long	.LASF49
+	.byte	0xd4
+	.long	0x2e
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x34
+	.long	.LASF414
+	.byte	0xd5
+	.long	0x2e
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x34
+	.long	.LASF415
+	.byte	0xd6
+	.long	0x2e
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x4
+	.quad	.LVL89
+	.long	0x281b
+	.long	0x26db
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x40c38800
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL92
+	.long	0xd86
+	.long	0x26f3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL97
+	.long	0x10cc
+	.long	0x2712
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL98
+	.long	0x10cc
+	.long	0x2744
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xf
+	.byte	0xa5
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x412e8480
+	.byte	0x1b
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL99
+	.long	0x10cc
+	.long	0x2776
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xf
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x40c38800
+	.byte	0xa5
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL101
+	.long	0x10cc
+	.long	0x27d0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0xc
+	.uleb128 0x2e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -72
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x63
+	.uleb128 0x19
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x40390000
+	.byte	0x91
+	.sleb128 -72
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -72
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x68
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL106
+	.long	0xd4f
+	.long	0x27e9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL108
+	.long	0x29f7
+	.long	0x2800
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL109
+	.long	0xd4f
+	.uleb128 0x8
+	.quad	.LVL111
+	.long	0xd4f
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF416
+	.byte	0xbe
+	.byte	0xc
+	.long	0x54
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x28d0
+	.uleb128 0x3f
+	.long	.LASF417
+	.byte	0xbe
+	.byte	0x1d
+	.long	0x28d0
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x3f
+	.long	.LASF418
+	.byte	0xbe
+	.byte	0x2b
+	.long	0x2e
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x24
+	.string	"ret"
+	.byte	0xc0
+	.byte	0x9
+	.long	0x54
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x24
+	.string	"max"
+	.byte	0xc1
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1a
+	.long	.LLRL38
+	.uleb128 0x24
+	.string	"i"
+	.byte	0xc2
+	.byte	0x11
+	.long	0x43
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x53
+	.quad	.LBB59
+	.quad	.LBE59-.LBB59
+	.uleb128 0x24
+	.string	"x"
+	.byte	0xc4
+	.byte	0x14
+	.long	0x2e
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x8
+	.quad	.LVL80
+	.long	0xd86
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xbdc
+	.uleb128 0x26
+	.long	.LASF419
+	.byte	0xa0
+	.long	0x2924
+	.uleb128 0x25
+	.long	.LASF402
+	.byte	0xa0
+	.byte	0x28
+	.long	0xb35
+	.uleb128 0x25
+	.long	.LASF404
+	.byte	0xa0
+	.byte	0x3d
+	.long	0x1013
+	.uleb128 0x10
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0xa2
+	.byte	0x11
+	.long	0x43
+	.uleb128 0x10
+	.uleb128 0x35
+	.long	.LASF420
+	.byte	0xa3
+	.byte	0x11
+	.long	0x120
+	.uleb128 0x1b
+	.string	"k"
+	.byte	0xae
+	.byte	0x10
+	.long	0x43
+	.uleb128 0x10
+	.uleb128 0x35
+	.long	.LASF421
+	.byte	0xb6
+	.byte	0x14
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF422
+	.byte	0x95
+	.long	0x2945
+	.uleb128 0x35
+	.long	.LASF423
+	.byte	0x97
+	.byte	0xb
+	.long	0xb8b
+	.uleb128 0x10
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0x99
+	.byte	0x11
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.long	.LASF424
+	.byte	0x1
+	.byte	0x88
+	.byte	0xf
+	.long	0x43
+	.byte	0x1
+	.long	0x2982
+	.uleb128 0x55
+	.string	"x"
+	.byte	0x1
+	.byte	0x88
+	.byte	0x22
+	.long	0x120
+	.uleb128 0x1b
+	.string	"lo"
+	.byte	0x8a
+	.byte	0xc
+	.long	0x43
+	.uleb128 0x1b
+	.string	"hi"
+	.byte	0x8a
+	.byte	0x14
+	.long	0x43
+	.uleb128 0x10
+	.uleb128 0x1b
+	.string	"mid"
+	.byte	0x8c
+	.byte	0x10
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF425
+	.byte	0x76
+	.long	0x29b9
+	.uleb128 0x25
+	.long	.LASF402
+	.byte	0x76
+	.byte	0x24
+	.long	0xb35
+	.uleb128 0x25
+	.long	.LASF400
+	.byte	0x77
+	.byte	0x24
+	.long	0xb35
+	.uleb128 0x25
+	.long	.LASF401
+	.byte	0x78
+	.byte	0x24
+	.long	0xb35
+	.uleb128 0x10
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0x7a
+	.byte	0x11
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF426
+	.byte	0x69
+	.long	0x29cf
+	.uleb128 0x25
+	.long	.LASF427
+	.byte	0x69
+	.byte	0x2a
+	.long	0xb35
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF428
+	.byte	0x5f
+	.long	0x29e5
+	.uleb128 0x10
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0x61
+	.byte	0x11
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.string	"die"
+	.byte	0x1
+	.byte	0x58
+	.byte	0x27
+	.byte	0x1
+	.uleb128 0x40
+	.long	.LASF429
+	.long	.LASF431
+	.uleb128 0x40
+	.long	.LASF430
+	.long	.LASF432
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 368
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS76:
+	.uleb128 0
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 .LVU665
+	.uleb128 .LVU665
+	.uleb128 0
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL202-1-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU661
+	.uleb128 .LVU664
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -125
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU427
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 .LVU460
+	.uleb128 .LVU548
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 .LVU661
+	.uleb128 .LVU665
+	.uleb128 .LVU666
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU427
+	.uleb128 .LVU460
+	.uleb128 .LVU548
+	.uleb128 .LVU574
+	.uleb128 .LVU584
+	.uleb128 .LVU592
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU429
+	.uleb128 .LVU460
+	.uleb128 .LVU548
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 .LVU609
+	.uleb128 .LVU609
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU617
+	.uleb128 .LVU617
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 .LVU631
+	.uleb128 .LVU631
+	.uleb128 .LVU634
+	.uleb128 .LVU634
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 .LVU661
+	.uleb128 .LVU665
+	.uleb128 .LVU666
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -125
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -125
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL255-1-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -125
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -125
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -125
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU578
+	.uleb128 .LVU584
+	.uleb128 .LVU592
+	.uleb128 .LVU661
+	.uleb128 .LVU665
+	.uleb128 .LVU666
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU641
+	.uleb128 .LVU652
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-1-.Ltext0
+	.uleb128 0x28
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x41cdcd65
+	.byte	0x1b
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x6
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU431
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU448
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0xf
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3
+	.quad	t
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x11
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3
+	.quad	t
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x11
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3
+	.quad	t+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU446
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 .LVU450
+	.uleb128 .LVU450
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU459
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0xf
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3
+	.quad	t
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x11
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3
+	.quad	t
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x11
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3
+	.quad	t+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU457
+	.uleb128 .LVU460
+	.uleb128 .LVU548
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU558
+	.uleb128 .LVU558
+	.uleb128 .LVU559
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU581
+	.uleb128 .LVU584
+	.uleb128 .LVU609
+	.uleb128 .LVU629
+	.uleb128 .LVU629
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 .LVU638
+	.uleb128 .LVU665
+	.uleb128 .LVU666
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU609
+	.uleb128 .LVU614
+	.uleb128 .LVU617
+	.uleb128 .LVU626
+	.uleb128 .LVU665
+	.uleb128 .LVU666
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU609
+	.uleb128 .LVU614
+	.uleb128 .LVU617
+	.uleb128 .LVU626
+	.uleb128 .LVU665
+	.uleb128 .LVU666
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU620
+	.uleb128 .LVU622
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x5
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x19
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU625
+	.uleb128 .LVU626
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0xb
+	.byte	0x91
+	.sleb128 -120
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU600
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU606
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU655
+	.uleb128 .LVU656
+	.uleb128 .LVU656
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU659
+	.uleb128 .LVU659
+	.uleb128 .LVU661
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	t
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x11
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	t
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x11
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	t+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU464
+	.uleb128 .LVU536
+	.uleb128 .LVU538
+	.uleb128 .LVU548
+	.uleb128 .LVU666
+	.uleb128 0
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU523
+	.uleb128 .LVU538
+	.uleb128 .LVU546
+	.uleb128 .LVU548
+	.uleb128 .LVU666
+	.uleb128 .LVU679
+	.uleb128 .LVU679
+	.uleb128 .LVU680
+	.uleb128 .LVU680
+	.uleb128 0
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0x7ff00000
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0x7ff00000
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU470
+	.uleb128 .LVU479
+	.uleb128 .LVU479
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU536
+	.uleb128 .LVU542
+	.uleb128 .LVU548
+	.uleb128 .LVU666
+	.uleb128 0
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU500
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 .LVU516
+	.uleb128 .LVU516
+	.uleb128 .LVU523
+	.uleb128 .LVU542
+	.uleb128 .LVU546
+	.uleb128 .LVU666
+	.uleb128 .LVU679
+	.uleb128 .LVU680
+	.uleb128 0
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU259
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU377
+	.uleb128 .LVU380
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6436
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6436
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU263
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU301
+	.uleb128 .LVU305
+	.uleb128 .LVU320
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0x12
+	.byte	0x31
+	.byte	0x16
+	.byte	0x14
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x12
+	.byte	0x31
+	.byte	0x16
+	.byte	0x14
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x12
+	.byte	0x31
+	.byte	0x16
+	.byte	0x14
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x12
+	.byte	0x31
+	.byte	0x16
+	.byte	0x14
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU298
+	.uleb128 .LVU305
+	.uleb128 .LVU353
+	.uleb128 .LVU377
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU395
+	.uleb128 .LVU395
+	.uleb128 .LVU399
+	.uleb128 .LVU400
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6437
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6437
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6437
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6437
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU271
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 .LVU288
+	.uleb128 .LVU288
+	.uleb128 .LVU289
+	.uleb128 .LVU305
+	.uleb128 .LVU330
+	.uleb128 .LVU330
+	.uleb128 .LVU337
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU340
+	.uleb128 .LVU346
+	.uleb128 .LVU346
+	.uleb128 .LVU353
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x29
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU321
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU330
+	.uleb128 .LVU330
+	.uleb128 .LVU337
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x10
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x14
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x10
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x14
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU329
+	.uleb128 .LVU331
+	.uleb128 .LVU331
+	.uleb128 .LVU333
+	.uleb128 .LVU333
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU343
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	t
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x11
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	t
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x11
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	t+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU335
+	.uleb128 .LVU340
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU340
+	.uleb128 .LVU344
+	.uleb128 .LVU344
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU351
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU290
+	.uleb128 .LVU292
+	.uleb128 .LVU292
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU305
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x12
+	.byte	0x70
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1890
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x8
+	.byte	0x30
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x14
+	.byte	0x70
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1890
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x8
+	.byte	0x30
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x15
+	.byte	0x71
+	.sleb128 0
+	.byte	0x6
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1890
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x8
+	.byte	0x30
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x15
+	.byte	0x71
+	.sleb128 -8
+	.byte	0x6
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1890
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x8
+	.byte	0x30
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x15
+	.byte	0x71
+	.sleb128 -8
+	.byte	0x6
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1890
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x8
+	.byte	0x30
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU298
+	.uleb128 .LVU305
+	.uleb128 .LVU353
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU377
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU397
+	.uleb128 .LVU397
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 .LVU399
+	.uleb128 .LVU400
+	.uleb128 0
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -6460
+	.byte	0x94
+	.byte	0x4
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -6460
+	.byte	0x94
+	.byte	0x4
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU353
+	.uleb128 .LVU374
+	.uleb128 .LVU381
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 .LVU391
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU357
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU362
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU369
+	.uleb128 .LVU370
+	.uleb128 .LVU370
+	.uleb128 .LVU372
+	.uleb128 .LVU372
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 .LVU374
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU403
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU416
+	.uleb128 .LVU416
+	.uleb128 .LVU418
+	.uleb128 .LVU418
+	.uleb128 0
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x1320
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU403
+	.uleb128 0
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -6288
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU403
+	.uleb128 0
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU405
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 0
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -6288
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU411
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU5
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU8
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU63
+	.uleb128 .LVU71
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU161
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU11
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU70
+	.uleb128 .LVU71
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU14
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU17
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU20
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL23-1-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU27
+	.uleb128 .LVU56
+	.uleb128 .LVU60
+	.uleb128 .LVU63
+	.uleb128 .LVU71
+	.uleb128 .LVU72
+	.uleb128 .LVU88
+	.uleb128 .LVU95
+	.uleb128 .LVU107
+	.uleb128 .LVU113
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU31
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU37
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU47
+	.uleb128 .LVU56
+	.uleb128 .LVU72
+	.uleb128 .LVU88
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU47
+	.uleb128 .LVU56
+	.uleb128 .LVU72
+	.uleb128 .LVU88
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU47
+	.uleb128 .LVU56
+	.uleb128 .LVU72
+	.uleb128 .LVU88
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU51
+	.uleb128 .LVU56
+	.uleb128 .LVU72
+	.uleb128 .LVU88
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU80
+	.uleb128 .LVU87
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0xb
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU90
+	.uleb128 .LVU95
+	.uleb128 .LVU107
+	.uleb128 .LVU116
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU97
+	.uleb128 .LVU107
+	.uleb128 .LVU116
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU97
+	.uleb128 .LVU107
+	.uleb128 .LVU116
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU101
+	.uleb128 .LVU107
+	.uleb128 .LVU116
+	.uleb128 .LVU170
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU116
+	.uleb128 .LVU131
+	.uleb128 .LVU133
+	.uleb128 .LVU161
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU122
+	.uleb128 .LVU125
+	.uleb128 .LVU150
+	.uleb128 .LVU152
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU116
+	.uleb128 .LVU122
+	.uleb128 .LVU137
+	.uleb128 .LVU150
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU116
+	.uleb128 .LVU122
+	.uleb128 .LVU139
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU150
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU116
+	.uleb128 .LVU122
+	.uleb128 .LVU139
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU149
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU116
+	.uleb128 .LVU120
+	.uleb128 .LVU146
+	.uleb128 .LVU150
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU157
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU159
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-1-.Ltext0
+	.uleb128 0x12
+	.byte	0x91
+	.sleb128 -128
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0x71
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU168
+	.uleb128 .LVU170
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU208
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU248
+	.uleb128 .LVU249
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU210
+	.uleb128 .LVU247
+	.uleb128 .LVU249
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU213
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 .LVU249
+	.uleb128 .LVU249
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU217
+	.uleb128 .LVU234
+	.uleb128 .LVU249
+	.uleb128 .LVU252
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU220
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 .LVU249
+	.uleb128 .LVU250
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU178
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU196
+	.uleb128 .LVU199
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU179
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU198
+	.uleb128 .LVU199
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU181
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU202
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU193
+	.uleb128 .LVU197
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.LLRL51:
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0
+.LLRL53:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB93-.Ltext0
+	.uleb128 .LBE93-.Ltext0
+	.byte	0
+.LLRL56:
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0
+.LLRL60:
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0
+.LLRL63:
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0
+.LLRL65:
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0
+.LLRL68:
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0
+.LLRL78:
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB185-.Ltext0
+	.uleb128 .LBE185-.Ltext0
+	.byte	0
+.LLRL84:
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB139-.Ltext0
+	.uleb128 .LBE139-.Ltext0
+	.byte	0
+.LLRL86:
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0
+.LLRL89:
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB147-.Ltext0
+	.uleb128 .LBE147-.Ltext0
+	.byte	0
+.LLRL91:
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB161-.Ltext0
+	.uleb128 .LBE161-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB163-.Ltext0
+	.uleb128 .LBE163-.Ltext0
+	.byte	0
+.LLRL93:
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB157-.Ltext0
+	.uleb128 .LBE157-.Ltext0
+	.byte	0
+.LLRL98:
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0
+.LLRL101:
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB186-.Ltext0
+	.uleb128 .LBE186-.Ltext0
+	.byte	0
+.LLRL104:
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB177-.Ltext0
+	.uleb128 .LBE177-.Ltext0
+	.byte	0
+.LLRL106:
+	.byte	0x4
+	.uleb128 .LBB173-.Ltext0
+	.uleb128 .LBE173-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB176-.Ltext0
+	.uleb128 .LBE176-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB178-.Ltext0
+	.uleb128 .LBE178-.Ltext0
+	.byte	0
+.LLRL108:
+	.byte	0x4
+	.uleb128 .LBB174-.Ltext0
+	.uleb128 .LBE174-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB175-.Ltext0
+	.uleb128 .LBE175-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF345:
+	.string	"t_compute"
+.LASF295:
+	.string	"_SC_LEVEL3_CACHE_SIZE"
+.LASF360:
+	.string	"t_init"
+.LASF205:
+	.string	"_SC_INT_MAX"
+.LASF11:
+	.string	"size_t"
+.LASF116:
+	.string	"_SC_MAPPED_FILES"
+.LASF101:
+	.string	"_SC_CHILD_MAX"
+.LASF385:
+	.string	"start"
+.LASF102:
+	.string	"_SC_CLK_TCK"
+.LASF134:
+	.string	"_SC_SIGQUEUE_MAX"
+.LASF29:
+	.string	"tail"
+.LASF20:
+	.string	"__ssize_t"
+.LASF93:
+	.string	"_IO_codecvt"
+.LASF313:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF241:
+	.string	"_SC_DEVICE_IO"
+.LASF422:
+	.string	"fold_crop_buckets"
+.LASF49:
+	.string	"max_t"
+.LASF337:
+	.string	"crop_bucket"
+.LASF319:
+	.string	"values"
+.LASF73:
+	.string	"_IO_save_end"
+.LASF299:
+	.string	"_SC_LEVEL4_CACHE_ASSOC"
+.LASF107:
+	.string	"_SC_JOB_CONTROL"
+.LASF203:
+	.string	"_SC_CHAR_MAX"
+.LASF41:
+	.string	"linear"
+.LASF19:
+	.string	"__clockid_t"
+.LASF390:
+	.string	"median"
+.LASF284:
+	.string	"_SC_TRACE_INHERIT"
+.LASF409:
+	.string	"settled"
+.LASF418:
+	.string	"min_n"
+.LASF190:
+	.string	"_SC_XOPEN_VERSION"
+.LASF66:
+	.string	"_IO_write_base"
+.LASF34:
+	.string	"test_insert_head"
+.LASF170:
+	.string	"_SC_GETGR_R_SIZE_MAX"
+.LASF39:
+	.string	"test_count"
+.LASF204:
+	.string	"_SC_CHAR_MIN"
+.LASF82:
+	.string	"_lock"
+.LASF108:
+	.string	"_SC_SAVED_IDS"
+.LASF429:
+	.string	"puts"
+.LASF414:
+	.string	"number_traces_max_t"
+.LASF340:
+	.string	"element_cnt"
+.LASF212:
+	.string	"_SC_SCHAR_MAX"
+.LASF317:
+	.string	"old_measure"
+.LASF60:
+	.string	"cpu_set_t"
+.LASF100:
+	.string	"_SC_ARG_MAX"
+.LASF265:
+	.string	"_SC_TIMEOUTS"
+.LASF71:
+	.string	"_IO_save_base"
+.LASF202:
+	.string	"_SC_CHAR_BIT"
+.LASF123:
+	.string	"_SC_AIO_LISTIO_MAX"
+.LASF209:
+	.string	"_SC_MB_LEN_MAX"
+.LASF182:
+	.string	"_SC_THREAD_PRIO_PROTECT"
+.LASF156:
+	.string	"_SC_PII_INTERNET"
+.LASF392:
+	.string	"ratio"
+.LASF183:
+	.string	"_SC_THREAD_PROCESS_SHARED"
+.LASF375:
+	.string	"release_dut"
+.LASF75:
+	.string	"_chain"
+.LASF95:
+	.string	"ssize_t"
+.LASF309:
+	.string	"_SC_TRACE_NAME_MAX"
+.LASF346:
+	.string	"waitpid"
+.LASF79:
+	.string	"_cur_column"
+.LASF365:
+	.string	"measure"
+.LASF153:
+	.string	"_SC_PII"
+.LASF125:
+	.string	"_SC_AIO_PRIO_DELTA_MAX"
+.LASF12:
+	.string	"__uint8_t"
+.LASF33:
+	.string	"test_size"
+.LASF119:
+	.string	"_SC_MEMORY_PROTECTION"
+.LASF395:
+	.string	"pids"
+.LASF381:
+	.string	"is_insert_tail_const"
+.LASF104:
+	.string	"_SC_OPEN_MAX"
+.LASF177:
+	.string	"_SC_THREAD_THREADS_MAX"
+.LASF254:
+	.string	"_SC_READER_WRITER_LOCKS"
+.LASF275:
+	.string	"_SC_STREAMS"
+.LASF4:
+	.string	"long int"
+.LASF127:
+	.string	"_SC_MQ_OPEN_MAX"
+.LASF368:
+	.string	"exit"
+.LASF245:
+	.string	"_SC_FIFO"
+.LASF242:
+	.string	"_SC_DEVICE_SPECIFIC"
+.LASF329:
+	.string	"dudect_sequential"
+.LASF197:
+	.string	"_SC_2_C_VERSION"
+.LASF48:
+	.string	"test"
+.LASF314:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF92:
+	.string	"_IO_marker"
+.LASF137:
+	.string	"_SC_BC_DIM_MAX"
+.LASF436:
+	.string	"results"
+.LASF330:
+	.string	"percentiles"
+.LASF27:
+	.string	"list_ele_t"
+.LASF28:
+	.string	"head"
+.LASF178:
+	.string	"_SC_THREAD_ATTR_STACKADDR"
+.LASF303:
+	.string	"_SC_V7_ILP32_OFF32"
+.LASF217:
+	.string	"_SC_UINT_MAX"
+.LASF271:
+	.string	"_SC_2_PBS_LOCATE"
+.LASF334:
+	.string	"drop_size"
+.LASF10:
+	.string	"signed char"
+.LASF24:
+	.string	"uint8_t"
+.LASF291:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE"
+.LASF61:
+	.string	"_IO_FILE"
+.LASF94:
+	.string	"_IO_wide_data"
+.LASF43:
+	.string	"call"
+.LASF283:
+	.string	"_SC_TRACE_EVENT_FILTER"
+.LASF221:
+	.string	"_SC_NL_LANGMAX"
+.LASF279:
+	.string	"_SC_V6_LP64_OFF64"
+.LASF222:
+	.string	"_SC_NL_MSGMAX"
+.LASF7:
+	.string	"unsigned char"
+.LASF86:
+	.string	"_freeres_list"
+.LASF165:
+	.string	"_SC_PII_OSI_CLTS"
+.LASF287:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC"
+.LASF383:
+	.string	"result"
+.LASF243:
+	.string	"_SC_DEVICE_SPECIFIC_R"
+.LASF338:
+	.string	"last_result"
+.LASF210:
+	.string	"_SC_NZERO"
+.LASF199:
+	.string	"_SC_XOPEN_XPG2"
+.LASF200:
+	.string	"_SC_XOPEN_XPG3"
+.LASF201:
+	.string	"_SC_XOPEN_XPG4"
+.LASF218:
+	.string	"_SC_ULONG_MAX"
+.LASF21:
+	.string	"__syscall_slong_t"
+.LASF46:
+	.string	"_Bool"
+.LASF194:
+	.string	"_SC_XOPEN_ENH_I18N"
+.LASF419:
+	.string	"update_statistics"
+.LASF25:
+	.string	"value"
+.LASF393:
+	.string	"nworkers"
+.LASF206:
+	.string	"_SC_INT_MIN"
+.LASF22:
+	.string	"char"
+.LASF198:
+	.string	"_SC_2_UPE"
+.LASF356:
+	.string	"memset"
+.LASF130:
+	.string	"_SC_PAGESIZE"
+.LASF249:
+	.string	"_SC_FILE_SYSTEM"
+.LASF320:
+	.string	"capacity"
+.LASF332:
+	.string	"crop_samples"
+.LASF355:
+	.string	"pwindow_free"
+.LASF434:
+	.string	"_IO_lock_t"
+.LASF146:
+	.string	"_SC_2_VERSION"
+.LASF428:
+	.string	"init_crop_fractions"
+.LASF406:
+	.string	"timer"
+.LASF144:
+	.string	"_SC_RE_DUP_MAX"
+.LASF296:
+	.string	"_SC_LEVEL3_CACHE_ASSOC"
+.LASF149:
+	.string	"_SC_2_FORT_DEV"
+.LASF63:
+	.string	"_IO_read_ptr"
+.LASF394:
+	.string	"ncpu"
+.LASF396:
+	.string	"wctx"
+.LASF161:
+	.string	"_SC_IOV_MAX"
+.LASF333:
+	.string	"center"
+.LASF240:
+	.string	"_SC_THREAD_CPUTIME"
+.LASF402:
+	.string	"exec_times"
+.LASF263:
+	.string	"_SC_SYSTEM_DATABASE"
+.LASF163:
+	.string	"_SC_PII_INTERNET_DGRAM"
+.LASF248:
+	.string	"_SC_FILE_LOCKING"
+.LASF74:
+	.string	"_markers"
+.LASF155:
+	.string	"_SC_PII_SOCKET"
+.LASF213:
+	.string	"_SC_SCHAR_MIN"
+.LASF363:
+	.string	"pwindow_push"
+.LASF160:
+	.string	"_SC_UIO_MAXIOV"
+.LASF373:
+	.string	"printf"
+.LASF42:
+	.string	"setup"
+.LASF129:
+	.string	"_SC_VERSION"
+.LASF364:
+	.string	"meas_write"
+.LASF51:
+	.string	"rate"
+.LASF58:
+	.string	"__cpu_mask"
+.LASF343:
+	.string	"sqrt"
+.LASF255:
+	.string	"_SC_SPIN_LOCKS"
+.LASF83:
+	.string	"_offset"
+.LASF289:
+	.string	"_SC_LEVEL1_DCACHE_SIZE"
+.LASF273:
+	.string	"_SC_2_PBS_TRACK"
+.LASF335:
+	.string	"chunk_size"
+.LASF408:
+	.string	"record_elements"
+.LASF302:
+	.string	"_SC_RAW_SOCKETS"
+.LASF168:
+	.string	"_SC_THREADS"
+.LASF169:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS"
+.LASF208:
+	.string	"_SC_WORD_BIT"
+.LASF256:
+	.string	"_SC_REGEXP"
+.LASF112:
+	.string	"_SC_ASYNCHRONOUS_IO"
+.LASF145:
+	.string	"_SC_CHARCLASS_NAME_MAX"
+.LASF290:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC"
+.LASF297:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE"
+.LASF176:
+	.string	"_SC_THREAD_STACK_MIN"
+.LASF3:
+	.string	"long unsigned int"
+.LASF192:
+	.string	"_SC_XOPEN_UNIX"
+.LASF398:
+	.string	"status"
+.LASF225:
+	.string	"_SC_NL_TEXTMAX"
+.LASF77:
+	.string	"_flags2"
+.LASF162:
+	.string	"_SC_PII_INTERNET_STREAM"
+.LASF316:
+	.string	"_SC_SIGSTKSZ"
+.LASF278:
+	.string	"_SC_V6_ILP32_OFFBIG"
+.LASF65:
+	.string	"_IO_read_base"
+.LASF304:
+	.string	"_SC_V7_ILP32_OFFBIG"
+.LASF424:
+	.string	"crop_index"
+.LASF121:
+	.string	"_SC_SEMAPHORES"
+.LASF298:
+	.string	"_SC_LEVEL4_CACHE_SIZE"
+.LASF47:
+	.string	"dut_op_t"
+.LASF315:
+	.string	"_SC_MINSIGSTKSZ"
+.LASF90:
+	.string	"_unused2"
+.LASF372:
+	.string	"meas_open"
+.LASF251:
+	.string	"_SC_MULTI_PROCESS"
+.LASF185:
+	.string	"_SC_NPROCESSORS_ONLN"
+.LASF349:
+	.string	"sched_setaffinity"
+.LASF348:
+	.string	"write"
+.LASF267:
+	.string	"_SC_USER_GROUPS"
+.LASF124:
+	.string	"_SC_AIO_MAX"
+.LASF152:
+	.string	"_SC_2_LOCALEDEF"
+.LASF143:
+	.string	"_SC_LINE_MAX"
+.LASF78:
+	.string	"_old_offset"
+.LASF186:
+	.string	"_SC_PHYS_PAGES"
+.LASF231:
+	.string	"_SC_XOPEN_REALTIME"
+.LASF403:
+	.string	"lengths"
+.LASF259:
+	.string	"_SC_SIGNALS"
+.LASF250:
+	.string	"_SC_MONOTONIC_CLOCK"
+.LASF131:
+	.string	"_SC_RTSIG_MAX"
+.LASF407:
+	.string	"init_once"
+.LASF247:
+	.string	"_SC_FILE_ATTRIBUTES"
+.LASF50:
+	.string	"measurements"
+.LASF268:
+	.string	"_SC_USER_GROUPS_R"
+.LASF191:
+	.string	"_SC_XOPEN_XCU_VERSION"
+.LASF154:
+	.string	"_SC_PII_XTI"
+.LASF232:
+	.string	"_SC_XOPEN_REALTIME_THREADS"
+.LASF376:
+	.string	"init_dut"
+.LASF5:
+	.string	"long long int"
+.LASF207:
+	.string	"_SC_LONG_BIT"
+.LASF37:
+	.string	"test_free_queue"
+.LASF35:
+	.string	"test_remove_head"
+.LASF2:
+	.string	"double"
+.LASF68:
+	.string	"_IO_write_end"
+.LASF351:
+	.string	"pipe"
+.LASF397:
+	.string	"__cpu"
+.LASF216:
+	.string	"_SC_UCHAR_MAX"
+.LASF246:
+	.string	"_SC_PIPE"
+.LASF266:
+	.string	"_SC_TYPED_MEMORY_OBJECTS"
+.LASF431:
+	.string	"__builtin_puts"
+.LASF172:
+	.string	"_SC_LOGIN_NAME_MAX"
+.LASF230:
+	.string	"_SC_XOPEN_LEGACY"
+.LASF175:
+	.string	"_SC_THREAD_KEYS_MAX"
+.LASF233:
+	.string	"_SC_ADVISORY_INFO"
+.LASF53:
+	.string	"float"
+.LASF387:
+	.string	"seconds"
+.LASF321:
+	.string	"count"
+.LASF359:
+	.string	"t_merge"
+.LASF344:
+	.string	"read"
+.LASF69:
+	.string	"_IO_buf_base"
+.LASF347:
+	.string	"_exit"
+.LASF9:
+	.string	"unsigned int"
+.LASF339:
+	.string	"element_ticks"
+.LASF341:
+	.string	"worker_result"
+.LASF327:
+	.string	"crop_window"
+.LASF380:
+	.string	"is_size_const"
+.LASF140:
+	.string	"_SC_COLL_WEIGHTS_MAX"
+.LASF166:
+	.string	"_SC_PII_OSI_M"
+.LASF148:
+	.string	"_SC_2_C_DEV"
+.LASF361:
+	.string	"t_push"
+.LASF88:
+	.string	"__pad5"
+.LASF264:
+	.string	"_SC_SYSTEM_DATABASE_R"
+.LASF57:
+	.string	"pid_t"
+.LASF308:
+	.string	"_SC_TRACE_EVENT_NAME_MAX"
+.LASF32:
+	.string	"test_insert_tail"
+.LASF219:
+	.string	"_SC_USHRT_MAX"
+.LASF423:
+	.string	"below"
+.LASF301:
+	.string	"_SC_IPV6"
+.LASF281:
+	.string	"_SC_HOST_NAME_MAX"
+.LASF139:
+	.string	"_SC_BC_STRING_MAX"
+.LASF180:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING"
+.LASF62:
+	.string	"_flags"
+.LASF405:
+	.string	"input_data"
+.LASF410:
+	.string	"done"
+.LASF52:
+	.string	"const_result_t"
+.LASF382:
+	.string	"check_op"
+.LASF432:
+	.string	"__builtin_putchar"
+.LASF89:
+	.string	"_mode"
+.LASF377:
+	.string	"meas_close"
+.LASF84:
+	.string	"_codecvt"
+.LASF151:
+	.string	"_SC_2_SW_DEV"
+.LASF370:
+	.string	"compute_percentiles"
+.LASF109:
+	.string	"_SC_REALTIME_SIGNALS"
+.LASF421:
+	.string	"centered"
+.LASF425:
+	.string	"differentiate"
+.LASF371:
+	.string	"calloc"
+.LASF229:
+	.string	"_SC_XBS5_LPBIG_OFFBIG"
+.LASF270:
+	.string	"_SC_2_PBS_ACCOUNTING"
+.LASF342:
+	.string	"worker_cnt"
+.LASF174:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF285:
+	.string	"_SC_TRACE_LOG"
+.LASF6:
+	.string	"long double"
+.LASF117:
+	.string	"_SC_MEMLOCK"
+.LASF157:
+	.string	"_SC_PII_OSI"
+.LASF126:
+	.string	"_SC_DELAYTIMER_MAX"
+.LASF150:
+	.string	"_SC_2_FORT_RUN"
+.LASF322:
+	.string	"pwindow_t"
+.LASF305:
+	.string	"_SC_V7_LP64_OFF64"
+.LASF184:
+	.string	"_SC_NPROCESSORS_CONF"
+.LASF214:
+	.string	"_SC_SHRT_MAX"
+.LASF91:
+	.string	"FILE"
+.LASF17:
+	.string	"__pid_t"
+.LASF31:
+	.string	"queue_t"
+.LASF234:
+	.string	"_SC_BARRIERS"
+.LASF257:
+	.string	"_SC_REGEX_VERSION"
+.LASF294:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE"
+.LASF54:
+	.string	"timespec"
+.LASF412:
+	.string	"run_workers"
+.LASF122:
+	.string	"_SC_SHARED_MEMORY_OBJECTS"
+.LASF59:
+	.string	"__bits"
+.LASF326:
+	.string	"total_measurements"
+.LASF417:
+	.string	"tests"
+.LASF378:
+	.string	"timer_setup"
+.LASF30:
+	.string	"size"
+.LASF228:
+	.string	"_SC_XBS5_LP64_OFF64"
+.LASF99:
+	.string	"long long unsigned int"
+.LASF306:
+	.string	"_SC_V7_LPBIG_OFFBIG"
+.LASF411:
+	.string	"bound"
+.LASF220:
+	.string	"_SC_NL_ARGMAX"
+.LASF15:
+	.string	"__off_t"
+.LASF336:
+	.string	"number_measurements"
+.LASF252:
+	.string	"_SC_SINGLE_PROCESS"
+.LASF187:
+	.string	"_SC_AVPHYS_PAGES"
+.LASF195:
+	.string	"_SC_XOPEN_SHM"
+.LASF386:
+	.string	"batches"
+.LASF262:
+	.string	"_SC_THREAD_SPORADIC_SERVER"
+.LASF87:
+	.string	"_freeres_buf"
+.LASF36:
+	.string	"test_remove_head_quiet"
+.LASF325:
+	.string	"t_ctx"
+.LASF307:
+	.string	"_SC_SS_REPL_MAX"
+.LASF323:
+	.string	"timer_active"
+.LASF420:
+	.string	"difference"
+.LASF223:
+	.string	"_SC_NL_NMAX"
+.LASF354:
+	.string	"pwindow_init"
+.LASF18:
+	.string	"__time_t"
+.LASF391:
+	.string	"half"
+.LASF413:
+	.string	"report"
+.LASF98:
+	.string	"clockid_t"
+.LASF44:
+	.string	"teardown"
+.LASF435:
+	.string	"fork"
+.LASF72:
+	.string	"_IO_backup_base"
+.LASF81:
+	.string	"_shortbuf"
+.LASF404:
+	.string	"classes"
+.LASF272:
+	.string	"_SC_2_PBS_MESSAGE"
+.LASF132:
+	.string	"_SC_SEM_NSEMS_MAX"
+.LASF167:
+	.string	"_SC_T_IOV_MAX"
+.LASF113:
+	.string	"_SC_PRIORITIZED_IO"
+.LASF358:
+	.string	"malloc"
+.LASF16:
+	.string	"__off64_t"
+.LASF277:
+	.string	"_SC_V6_ILP32_OFF32"
+.LASF438:
+	.string	"measure_batch"
+.LASF105:
+	.string	"_SC_STREAM_MAX"
+.LASF399:
+	.string	"read_all"
+.LASF106:
+	.string	"_SC_TZNAME_MAX"
+.LASF276:
+	.string	"_SC_2_PBS_CHECKPOINT"
+.LASF260:
+	.string	"_SC_SPAWN"
+.LASF118:
+	.string	"_SC_MEMLOCK_RANGE"
+.LASF138:
+	.string	"_SC_BC_SCALE_MAX"
+.LASF353:
+	.string	"sysconf"
+.LASF310:
+	.string	"_SC_TRACE_SYS_MAX"
+.LASF274:
+	.string	"_SC_SYMLOOP_MAX"
+.LASF70:
+	.string	"_IO_buf_end"
+.LASF196:
+	.string	"_SC_2_CHAR_TERM"
+.LASF400:
+	.string	"before_ticks"
+.LASF258:
+	.string	"_SC_SHELL"
+.LASF244:
+	.string	"_SC_FD_MGMT"
+.LASF193:
+	.string	"_SC_XOPEN_CRYPT"
+.LASF288:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE"
+.LASF237:
+	.string	"_SC_C_LANG_SUPPORT_R"
+.LASF40:
+	.string	"name"
+.LASF311:
+	.string	"_SC_TRACE_USER_EVENT_MAX"
+.LASF135:
+	.string	"_SC_TIMER_MAX"
+.LASF269:
+	.string	"_SC_2_PBS"
+.LASF239:
+	.string	"_SC_CPUTIME"
+.LASF261:
+	.string	"_SC_SPORADIC_SERVER"
+.LASF331:
+	.string	"crop_fractions"
+.LASF13:
+	.string	"short int"
+.LASF238:
+	.string	"_SC_CLOCK_SELECTION"
+.LASF328:
+	.string	"dudect_workers"
+.LASF226:
+	.string	"_SC_XBS5_ILP32_OFF32"
+.LASF384:
+	.string	"mode"
+.LASF96:
+	.string	"dut_ops"
+.LASF388:
+	.string	"test_const"
+.LASF253:
+	.string	"_SC_NETWORKING"
+.LASF300:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE"
+.LASF56:
+	.string	"tv_nsec"
+.LASF188:
+	.string	"_SC_ATEXIT_MAX"
+.LASF379:
+	.string	"worker_results"
+.LASF164:
+	.string	"_SC_PII_OSI_COTS"
+.LASF128:
+	.string	"_SC_MQ_PRIO_MAX"
+.LASF80:
+	.string	"_vtable_offset"
+.LASF133:
+	.string	"_SC_SEM_VALUE_MAX"
+.LASF236:
+	.string	"_SC_C_LANG_SUPPORT"
+.LASF111:
+	.string	"_SC_TIMERS"
+.LASF189:
+	.string	"_SC_PASS_MAX"
+.LASF115:
+	.string	"_SC_FSYNC"
+.LASF159:
+	.string	"_SC_SELECT"
+.LASF173:
+	.string	"_SC_TTY_NAME_MAX"
+.LASF367:
+	.string	"prepare_inputs"
+.LASF430:
+	.string	"putchar"
+.LASF14:
+	.string	"__int64_t"
+.LASF427:
+	.string	"ticks"
+.LASF158:
+	.string	"_SC_POLL"
+.LASF120:
+	.string	"_SC_MESSAGE_PASSING"
+.LASF437:
+	.string	"last_const_result"
+.LASF64:
+	.string	"_IO_read_end"
+.LASF293:
+	.string	"_SC_LEVEL2_CACHE_ASSOC"
+.LASF136:
+	.string	"_SC_BC_BASE_MAX"
+.LASF292:
+	.string	"_SC_LEVEL2_CACHE_SIZE"
+.LASF142:
+	.string	"_SC_EXPR_NEST_MAX"
+.LASF401:
+	.string	"after_ticks"
+.LASF114:
+	.string	"_SC_SYNCHRONIZED_IO"
+.LASF76:
+	.string	"_fileno"
+.LASF312:
+	.string	"_SC_XOPEN_STREAMS"
+.LASF415:
+	.string	"max_tau"
+.LASF215:
+	.string	"_SC_SHRT_MIN"
+.LASF85:
+	.string	"_wide_data"
+.LASF38:
+	.string	"test_reverse"
+.LASF103:
+	.string	"_SC_NGROUPS_MAX"
+.LASF416:
+	.string	"max_test"
+.LASF280:
+	.string	"_SC_V6_LPBIG_OFFBIG"
+.LASF369:
+	.string	"free"
+.LASF374:
+	.string	"report_flush"
+.LASF8:
+	.string	"short unsigned int"
+.LASF97:
+	.string	"stdout"
+.LASF286:
+	.string	"_SC_LEVEL1_ICACHE_SIZE"
+.LASF227:
+	.string	"_SC_XBS5_ILP32_OFFBIG"
+.LASF389:
+	.string	"test_linear"
+.LASF141:
+	.string	"_SC_EQUIV_CLASS_MAX"
+.LASF67:
+	.string	"_IO_write_ptr"
+.LASF235:
+	.string	"_SC_BASE"
+.LASF110:
+	.string	"_SC_PRIORITY_SCHEDULING"
+.LASF357:
+	.string	"clock_gettime"
+.LASF23:
+	.string	"int64_t"
+.LASF211:
+	.string	"_SC_SSIZE_MAX"
+.LASF318:
+	.string	"write_data"
+.LASF171:
+	.string	"_SC_GETPW_R_SIZE_MAX"
+.LASF433:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF181:
+	.string	"_SC_THREAD_PRIO_INHERIT"
+.LASF324:
+	.string	"mean"
+.LASF282:
+	.string	"_SC_TRACE"
+.LASF426:
+	.string	"prepare_percentiles"
+.LASF26:
+	.string	"next"
+.LASF350:
+	.string	"close"
+.LASF352:
+	.string	"fflush"
+.LASF224:
+	.string	"_SC_NL_SETMAX"
+.LASF55:
+	.string	"tv_sec"
+.LASF362:
+	.string	"pwindow_percentiles"
+.LASF45:
+	.string	"undo"
+.LASF366:
+	.string	"measure_old"
+.LASF147:
+	.string	"_SC_2_C_BIND"
+.LASF179:
+	.string	"_SC_THREAD_ATTR_STACKSIZE"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"dudect/fixture.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
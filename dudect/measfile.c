@@ -0,0 +1,140 @@
+#define _GNU_SOURCE
+#include "measfile.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "constant.h"
+#include "timer.h"
+
+extern int total_measurements;
+extern const int drop_size;
+extern const size_t number_measurements;
+
+/* Records are written out when the buffer fills, not per measurement */
+#define MEAS_BUFFER_RECORDS 65536
+
+static meas_record_t buffer[MEAS_BUFFER_RECORDS];
+static size_t buffer_cnt = 0;
+static int meas_fd = -1;
+static off_t header_offset = 0;
+static meas_header_t header;
+/* File is emptied by the first test of each run, and appended to after */
+static bool started = false;
+
+static void cpu_model(char *buf, size_t len)
+{
+    char line[256];
+    FILE *f = fopen("/proc/cpuinfo", "r");
+    buf[0] = '\0';
+    if (!f)
+        return;
+    while (fgets(line, sizeof(line), f)) {
+        char *colon = strchr(line, ':');
+        if (strncmp(line, "model name", 10) || !colon)
+            continue;
+        colon += strspn(colon + 1, " \t") + 1;
+        colon[strcspn(colon, "\n")] = '\0';
+        strncpy(buf, colon, len - 1);
+        buf[len - 1] = '\0';
+        break;
+    }
+    fclose(f);
+}
+
+static bool write_all(const void *buf, size_t len)
+{
+    const char *p = buf;
+    while (len > 0) {
+        ssize_t n = write(meas_fd, p, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static void flush_buffer(void)
+{
+    if (meas_fd >= 0 && buffer_cnt > 0 &&
+        !write_all(buffer, buffer_cnt * sizeof(meas_record_t))) {
+        printf("Cannot write %s: %s\n", MEAS_FILE, strerror(errno));
+        close(meas_fd);
+        meas_fd = -1;
+    }
+    buffer_cnt = 0;
+}
+
+void meas_open(int mode)
+{
+    meas_close();
+    meas_fd = open(MEAS_FILE, O_WRONLY | O_CREAT | (started ? 0 : O_TRUNC),
+                   0644);
+    if (meas_fd < 0) {
+        printf("Cannot open %s: %s\n", MEAS_FILE, strerror(errno));
+        return;
+    }
+    started = true;
+    header_offset = lseek(meas_fd, 0, SEEK_END);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MEAS_MAGIC, sizeof(header.magic));
+    header.version = MEAS_VERSION;
+    header.header_size = sizeof(meas_header_t);
+    header.record_size = sizeof(meas_record_t);
+    header.op = mode;
+    header.timer = timer_active;
+    header.cpu = sched_getcpu();
+    header.batch_size = number_measurements;
+    header.drop_size = drop_size;
+    header.total_measurements = total_measurements;
+    strncpy(header.op_name, dut_ops[mode].name, sizeof(header.op_name) - 1);
+    cpu_model(header.cpu_model, sizeof(header.cpu_model));
+    if (!write_all(&header, sizeof(header))) {
+        printf("Cannot write %s: %s\n", MEAS_FILE, strerror(errno));
+        close(meas_fd);
+        meas_fd = -1;
+    }
+}
+
+void meas_write(const int64_t *exec_times,
+                const uint8_t *classes,
+                const size_t *lengths,
+                size_t from,
+                size_t to)
+{
+    if (meas_fd < 0)
+        return;
+    for (size_t i = from; i < to; i++) {
+        if (buffer_cnt == MEAS_BUFFER_RECORDS)
+            flush_buffer();
+        meas_record_t *r = &buffer[buffer_cnt++];
+        r->ticks = exec_times[i];
+        r->length = lengths ? lengths[i] : 0;
+        r->class = classes[i];
+        memset(r->pad, 0, sizeof(r->pad));
+        header.records++;
+    }
+}
+
+void meas_close(void)
+{
+    if (meas_fd < 0)
+        return;
+    flush_buffer();
+    /* Header was written before the record count was known */
+    if (meas_fd >= 0 &&
+        pwrite(meas_fd, &header.records, sizeof(header.records),
+               header_offset + offsetof(meas_header_t, records)) !=
+            sizeof(header.records))
+        printf("Cannot write %s: %s\n", MEAS_FILE, strerror(errno));
+    if (meas_fd >= 0)
+        close(meas_fd);
+    meas_fd = -1;
+}
@@ -0,0 +1,55 @@
+#ifndef DUDECT_MEASFILE_H
+#define DUDECT_MEASFILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Binary measurement file, written when option write is set.  The first
+ * test of a run empties it, and every test appends a segment: one header,
+ * then one fixed-size record per measurement.  Only the last segment can
+ * be from an interrupted test.  Fields are in native byte order.
+ * scripts/meas2txt.py converts the file to text.
+ */
+#define MEAS_FILE "./meas.bin"
+#define MEAS_MAGIC "DUDECTMF"
+#define MEAS_VERSION 1
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t record_size;
+    uint32_t op;                 /* One of the test_ constants */
+    uint32_t timer;              /* Timer backend in use */
+    int32_t cpu;                 /* CPU the test started on, -1 if unknown */
+    uint32_t batch_size;         /* Measurements per batch */
+    uint32_t drop_size;          /* Measurements dropped at each batch end */
+    uint32_t total_measurements; /* Measurements asked for */
+    uint32_t reserved;
+    uint64_t records; /* Set when the test finishes, 0 if interrupted */
+    char op_name[32];
+    char cpu_model[64];
+} meas_header_t;
+
+typedef struct {
+    int64_t ticks;   /* Execution time */
+    uint32_t length; /* Queue length, 0 if not recorded */
+    uint8_t class;
+    uint8_t pad[3];
+} meas_record_t;
+
+/* Start a segment for operation mode.  Warns and returns if cannot open */
+void meas_open(int mode);
+
+/* Buffer records for measurements from .. to - 1 */
+void meas_write(const int64_t *exec_times,
+                const uint8_t *classes,
+                const size_t *lengths,
+                size_t from,
+                size_t to);
+
+/* Write out buffered records and finish the segment */
+void meas_close(void);
+
+#endif
@@ -0,0 +1,4066 @@
+	.file	"measfile.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "dudect/measfile.c"
+	.type	write_all, @function
+write_all:
+.LVL0:
+.LFB17:
+	.file 1 "dudect/measfile.c"
+	.loc 1 49 1 view -0
+	.cfi_startproc
+	.loc 1 49 1 is_stmt 0 view .LVU1
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp	# tmp92, buf
+	movq	%rsi, %rbx	# tmp93, len
+	.loc 1 50 5 is_stmt 1 view .LVU2
+.LVL1:
+	.loc 1 51 5 view .LVU3
+	.loc 1 51 16 view .LVU4
+	testq	%rsi, %rsi	# len
+	jne	.L5	#,
+# dudect/measfile.c:60:     return true;
+	.loc 1 60 12 is_stmt 0 view .LVU5
+	movl	$1, %eax	#, <retval>
+	jmp	.L1	#
+.LVL2:
+.L3:
+.LBB2:
+	.loc 1 55 9 is_stmt 1 view .LVU6
+# dudect/measfile.c:55:         if (n <= 0)
+	.loc 1 55 12 is_stmt 0 view .LVU7
+	je	.L7	#,
+	.loc 1 57 9 is_stmt 1 view .LVU8
+# dudect/measfile.c:57:         p += n;
+	.loc 1 57 11 is_stmt 0 view .LVU9
+	addq	%rax, %rbp	# n, buf
+.LVL3:
+	.loc 1 58 9 is_stmt 1 view .LVU10
+# dudect/measfile.c:58:         len -= n;
+	.loc 1 58 13 is_stmt 0 view .LVU11
+	subq	%rax, %rbx	# n, len
+.LVL4:
+.L4:
+	.loc 1 58 13 view .LVU12
+.LBE2:
+	.loc 1 51 16 is_stmt 1 view .LVU13
+	testq	%rbx, %rbx	# len
+	je	.L10	#,
+.LVL5:
+.L5:
+.LBB3:
+	.loc 1 52 9 view .LVU14
+# dudect/measfile.c:52:         ssize_t n = write(meas_fd, p, len);
+	.loc 1 52 21 is_stmt 0 view .LVU15
+	movq	%rbx, %rdx	# len,
+	movq	%rbp, %rsi	# buf,
+	movl	meas_fd(%rip), %edi	# meas_fd,
+	call	write@PLT	#
+.LVL6:
+	.loc 1 53 9 is_stmt 1 view .LVU16
+# dudect/measfile.c:53:         if (n < 0 && errno == EINTR)
+	.loc 1 53 12 is_stmt 0 view .LVU17
+	testq	%rax, %rax	# n
+	jns	.L3	#,
+# dudect/measfile.c:53:         if (n < 0 && errno == EINTR)
+	.loc 1 53 22 discriminator 1 view .LVU18
+	call	__errno_location@PLT	#
+.LVL7:
+# dudect/measfile.c:53:         if (n < 0 && errno == EINTR)
+	.loc 1 53 19 discriminator 1 view .LVU19
+	cmpl	$4, (%rax)	#, *_2
+	je	.L4	#,
+# dudect/measfile.c:56:             return false;
+	.loc 1 56 20 view .LVU20
+	movl	$0, %eax	#, <retval>
+.LVL8:
+.L1:
+	.loc 1 56 20 view .LVU21
+.LBE3:
+# dudect/measfile.c:61: }
+	.loc 1 61 1 view .LVU22
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL9:
+	.loc 1 61 1 view .LVU23
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL10:
+	.loc 1 61 1 view .LVU24
+	ret	
+.LVL11:
+.L10:
+	.cfi_restore_state
+# dudect/measfile.c:60:     return true;
+	.loc 1 60 12 view .LVU25
+	movl	$1, %eax	#, <retval>
+	jmp	.L1	#
+.LVL12:
+.L7:
+.LBB4:
+# dudect/measfile.c:56:             return false;
+	.loc 1 56 20 view .LVU26
+	movl	$0, %eax	#, <retval>
+.LVL13:
+	.loc 1 56 20 view .LVU27
+	jmp	.L1	#
+.LBE4:
+	.cfi_endproc
+.LFE17:
+	.size	write_all, .-write_all
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"./meas.bin"
+.LC1:
+	.string	"Cannot write %s: %s\n"
+	.text
+	.type	flush_buffer, @function
+flush_buffer:
+.LFB18:
+	.loc 1 64 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 65 5 view .LVU29
+# dudect/measfile.c:65:     if (meas_fd >= 0 && buffer_cnt > 0 &&
+	.loc 1 65 8 is_stmt 0 view .LVU30
+	cmpl	$0, meas_fd(%rip)	#, meas_fd
+	js	.L14	#,
+# dudect/measfile.c:65:     if (meas_fd >= 0 && buffer_cnt > 0 &&
+	.loc 1 65 36 discriminator 1 view .LVU31
+	movq	buffer_cnt(%rip), %rsi	# buffer_cnt, buffer_cnt.22_2
+# dudect/measfile.c:65:     if (meas_fd >= 0 && buffer_cnt > 0 &&
+	.loc 1 65 22 discriminator 1 view .LVU32
+	testq	%rsi, %rsi	# buffer_cnt.22_2
+	jne	.L17	#,
+.L14:
+	.loc 1 71 5 is_stmt 1 view .LVU33
+# dudect/measfile.c:71:     buffer_cnt = 0;
+	.loc 1 71 16 is_stmt 0 view .LVU34
+	movq	$0, buffer_cnt(%rip)	#, buffer_cnt
+	ret	
+.L17:
+# dudect/measfile.c:64: {
+	.loc 1 64 1 discriminator 2 view .LVU35
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+# dudect/measfile.c:66:         !write_all(buffer, buffer_cnt * sizeof(meas_record_t))) {
+	.loc 1 66 10 discriminator 2 view .LVU36
+	salq	$4, %rsi	#, tmp90
+	leaq	buffer(%rip), %rdi	#, tmp91
+	call	write_all	#
+.LVL14:
+# dudect/measfile.c:65:     if (meas_fd >= 0 && buffer_cnt > 0 &&
+	.loc 1 65 40 discriminator 2 view .LVU37
+	testb	%al, %al	# tmp96
+	je	.L18	#,
+.L12:
+	.loc 1 71 5 is_stmt 1 view .LVU38
+# dudect/measfile.c:71:     buffer_cnt = 0;
+	.loc 1 71 16 is_stmt 0 view .LVU39
+	movq	$0, buffer_cnt(%rip)	#, buffer_cnt
+# dudect/measfile.c:72: }
+	.loc 1 72 1 view .LVU40
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.L18:
+	.cfi_restore_state
+	.loc 1 67 9 is_stmt 1 view .LVU41
+# dudect/measfile.c:67:         printf("Cannot write %s: %s\n", MEAS_FILE, strerror(errno));
+	.loc 1 67 61 is_stmt 0 view .LVU42
+	call	__errno_location@PLT	#
+.LVL15:
+# dudect/measfile.c:67:         printf("Cannot write %s: %s\n", MEAS_FILE, strerror(errno));
+	.loc 1 67 9 view .LVU43
+	movl	(%rax), %edi	# *_5, *_5
+	call	strerror@PLT	#
+.LVL16:
+	movq	%rax, %rdx	# tmp98, _7
+	leaq	.LC0(%rip), %rsi	#, tmp93
+	leaq	.LC1(%rip), %rdi	#, tmp94
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL17:
+	.loc 1 68 9 is_stmt 1 view .LVU44
+	movl	meas_fd(%rip), %edi	# meas_fd,
+	call	close@PLT	#
+.LVL18:
+	.loc 1 69 9 view .LVU45
+# dudect/measfile.c:69:         meas_fd = -1;
+	.loc 1 69 17 is_stmt 0 view .LVU46
+	movl	$-1, meas_fd(%rip)	#, meas_fd
+	jmp	.L12	#
+	.cfi_endproc
+.LFE18:
+	.size	flush_buffer, .-flush_buffer
+	.globl	meas_write
+	.type	meas_write, @function
+meas_write:
+.LVL19:
+.LFB20:
+	.loc 1 111 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 112 5 view .LVU48
+# dudect/measfile.c:112:     if (meas_fd < 0)
+	.loc 1 112 8 is_stmt 0 view .LVU49
+	cmpl	$0, meas_fd(%rip)	#, meas_fd
+	js	.L27	#,
+# dudect/measfile.c:111: {
+	.loc 1 111 1 view .LVU50
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %r14	# tmp123, exec_times
+	movq	%rsi, %r15	# tmp124, classes
+	movq	%rdx, %r12	# tmp125, lengths
+	movq	%rcx, %rbx	# tmp126, from
+	movq	%r8, %r13	# tmp127, to
+.LVL20:
+.LBB5:
+	.loc 1 114 29 is_stmt 1 view .LVU51
+	cmpq	%r8, %rcx	# to, from
+	jnb	.L19	#,
+.LBB6:
+# dudect/measfile.c:118:         r->ticks = exec_times[i];
+	.loc 1 118 18 is_stmt 0 view .LVU52
+	leaq	buffer(%rip), %rbp	#, tmp101
+	jmp	.L23	#
+.LVL21:
+.L30:
+	.loc 1 116 13 is_stmt 1 view .LVU53
+	call	flush_buffer	#
+.LVL22:
+	jmp	.L21	#
+.LVL23:
+.L31:
+# dudect/measfile.c:119:         r->length = lengths ? lengths[i] : 0;
+	.loc 1 119 19 is_stmt 0 discriminator 1 view .LVU54
+	movl	(%r12,%rbx,8), %ecx	# MEM[(const size_t *)lengths_27(D) + i_37 * 8], iftmp.20_16
+.L22:
+# dudect/measfile.c:119:         r->length = lengths ? lengths[i] : 0;
+	.loc 1 119 19 discriminator 4 view .LVU55
+	salq	$4, %rax	#, tmp106
+.LVL24:
+	.loc 1 119 19 discriminator 4 view .LVU56
+	leaq	0(%rbp,%rax), %rdx	#, tmp107
+	movl	%ecx, 8(%rdx)	# iftmp.20_16, MEM <struct meas_record_t[65536]> [(struct meas_record_t *)&buffer][buffer_cnt.18_3].length
+	.loc 1 120 9 is_stmt 1 discriminator 4 view .LVU57
+# dudect/measfile.c:120:         r->class = classes[i];
+	.loc 1 120 27 is_stmt 0 discriminator 4 view .LVU58
+	movzbl	(%r15,%rbx), %ecx	# MEM[(const uint8_t *)classes_30(D) + i_37 * 1], _11
+# dudect/measfile.c:120:         r->class = classes[i];
+	.loc 1 120 18 discriminator 4 view .LVU59
+	movb	%cl, 12(%rdx)	# _11, MEM <struct meas_record_t[65536]> [(struct meas_record_t *)&buffer][buffer_cnt.18_3].class
+	.loc 1 121 9 is_stmt 1 discriminator 4 view .LVU60
+# dudect/measfile.c:121:         memset(r->pad, 0, sizeof(r->pad));
+	.loc 1 121 17 is_stmt 0 discriminator 4 view .LVU61
+	leaq	13(%rbp,%rax), %rax	#, tmp115
+# dudect/measfile.c:121:         memset(r->pad, 0, sizeof(r->pad));
+	.loc 1 121 9 discriminator 4 view .LVU62
+	movw	$0, (%rax)	#, MEM <char[1:3]> [(void *)_12]
+	movb	$0, 2(%rax)	#, MEM <char[1:3]> [(void *)_12]
+	.loc 1 122 9 is_stmt 1 discriminator 4 view .LVU63
+# dudect/measfile.c:122:         header.records++;
+	.loc 1 122 23 is_stmt 0 discriminator 4 view .LVU64
+	addq	$1, 48+header(%rip)	#, header.records
+.LBE6:
+	.loc 1 114 36 is_stmt 1 discriminator 4 view .LVU65
+	addq	$1, %rbx	#, from
+.LVL25:
+	.loc 1 114 29 discriminator 4 view .LVU66
+	cmpq	%rbx, %r13	# from, to
+	je	.L19	#,
+.LVL26:
+.L23:
+.LBB7:
+	.loc 1 115 9 view .LVU67
+# dudect/measfile.c:115:         if (buffer_cnt == MEAS_BUFFER_RECORDS)
+	.loc 1 115 12 is_stmt 0 view .LVU68
+	cmpq	$65536, buffer_cnt(%rip)	#, buffer_cnt
+	je	.L30	#,
+.L21:
+	.loc 1 117 9 is_stmt 1 view .LVU69
+# dudect/measfile.c:117:         meas_record_t *r = &buffer[buffer_cnt++];
+	.loc 1 117 46 is_stmt 0 view .LVU70
+	movq	buffer_cnt(%rip), %rax	# buffer_cnt, buffer_cnt.18_3
+	leaq	1(%rax), %rdx	#, tmp100
+	movq	%rdx, buffer_cnt(%rip)	# tmp100, buffer_cnt
+.LVL27:
+	.loc 1 118 9 is_stmt 1 view .LVU71
+# dudect/measfile.c:118:         r->ticks = exec_times[i];
+	.loc 1 118 30 is_stmt 0 view .LVU72
+	movq	(%r14,%rbx,8), %rcx	# MEM[(const int64_t *)exec_times_25(D) + i_37 * 8], _7
+# dudect/measfile.c:118:         r->ticks = exec_times[i];
+	.loc 1 118 18 view .LVU73
+	movq	%rax, %rdx	# buffer_cnt.18_3, tmp102
+	salq	$4, %rdx	#, tmp102
+	movq	%rcx, 0(%rbp,%rdx)	# _7, MEM <struct meas_record_t[65536]> [(struct meas_record_t *)&buffer][buffer_cnt.18_3].ticks
+	.loc 1 119 9 is_stmt 1 view .LVU74
+# dudect/measfile.c:119:         r->length = lengths ? lengths[i] : 0;
+	.loc 1 119 19 is_stmt 0 view .LVU75
+	movl	$0, %ecx	#, iftmp.20_16
+	testq	%r12, %r12	# lengths
+	jne	.L31	#,
+	jmp	.L22	#
+.LVL28:
+.L19:
+	.loc 1 119 19 view .LVU76
+.LBE7:
+.LBE5:
+# dudect/measfile.c:124: }
+	.loc 1 124 1 view .LVU77
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+.LVL29:
+	.loc 1 124 1 view .LVU78
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL30:
+	.loc 1 124 1 view .LVU79
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL31:
+	.loc 1 124 1 view .LVU80
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL32:
+	.loc 1 124 1 view .LVU81
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL33:
+	.loc 1 124 1 view .LVU82
+	ret	
+.LVL34:
+.L27:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	.loc 1 124 1 view .LVU83
+	ret	
+	.cfi_endproc
+.LFE20:
+	.size	meas_write, .-meas_write
+	.globl	meas_close
+	.type	meas_close, @function
+meas_close:
+.LFB21:
+	.loc 1 127 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 128 5 view .LVU85
+# dudect/measfile.c:128:     if (meas_fd < 0)
+	.loc 1 128 8 is_stmt 0 view .LVU86
+	cmpl	$0, meas_fd(%rip)	#, meas_fd
+	js	.L37	#,
+# dudect/measfile.c:127: {
+	.loc 1 127 1 view .LVU87
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 130 5 is_stmt 1 view .LVU88
+	call	flush_buffer	#
+.LVL35:
+	.loc 1 132 5 view .LVU89
+# dudect/measfile.c:132:     if (meas_fd >= 0 &&
+	.loc 1 132 17 is_stmt 0 view .LVU90
+	movl	meas_fd(%rip), %edi	# meas_fd, meas_fd.26_2
+# dudect/measfile.c:132:     if (meas_fd >= 0 &&
+	.loc 1 132 8 view .LVU91
+	testl	%edi, %edi	# meas_fd.26_2
+	jns	.L40	#,
+.L34:
+	.loc 1 139 5 is_stmt 1 view .LVU92
+# dudect/measfile.c:139:     meas_fd = -1;
+	.loc 1 139 13 is_stmt 0 view .LVU93
+	movl	$-1, meas_fd(%rip)	#, meas_fd
+# dudect/measfile.c:140: }
+	.loc 1 140 1 view .LVU94
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.L40:
+	.cfi_restore_state
+# dudect/measfile.c:134:                header_offset + offsetof(meas_header_t, records)) !=
+	.loc 1 134 30 discriminator 1 view .LVU95
+	movq	header_offset(%rip), %rax	# header_offset, tmp103
+	leaq	48(%rax), %rcx	#, tmp93
+# dudect/measfile.c:133:         pwrite(meas_fd, &header.records, sizeof(header.records),
+	.loc 1 133 9 discriminator 1 view .LVU96
+	movl	$8, %edx	#,
+	leaq	48+header(%rip), %rsi	#, tmp95
+	call	pwrite@PLT	#
+.LVL36:
+# dudect/measfile.c:132:     if (meas_fd >= 0 &&
+	.loc 1 132 22 discriminator 1 view .LVU97
+	cmpq	$8, %rax	#, tmp99
+	jne	.L41	#,
+.L35:
+	.loc 1 137 5 is_stmt 1 view .LVU98
+# dudect/measfile.c:137:     if (meas_fd >= 0)
+	.loc 1 137 17 is_stmt 0 view .LVU99
+	movl	meas_fd(%rip), %edi	# meas_fd, meas_fd.30_11
+# dudect/measfile.c:137:     if (meas_fd >= 0)
+	.loc 1 137 8 view .LVU100
+	testl	%edi, %edi	# meas_fd.30_11
+	js	.L34	#,
+	.loc 1 138 9 is_stmt 1 view .LVU101
+	call	close@PLT	#
+.LVL37:
+	jmp	.L34	#
+.L41:
+	.loc 1 136 9 view .LVU102
+# dudect/measfile.c:136:         printf("Cannot write %s: %s\n", MEAS_FILE, strerror(errno));
+	.loc 1 136 61 is_stmt 0 view .LVU103
+	call	__errno_location@PLT	#
+.LVL38:
+# dudect/measfile.c:136:         printf("Cannot write %s: %s\n", MEAS_FILE, strerror(errno));
+	.loc 1 136 9 view .LVU104
+	movl	(%rax), %edi	# *_8, *_8
+	call	strerror@PLT	#
+.LVL39:
+	movq	%rax, %rdx	# tmp101, _10
+	leaq	.LC0(%rip), %rsi	#, tmp97
+	leaq	.LC1(%rip), %rdi	#, tmp98
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL40:
+	jmp	.L35	#
+.L37:
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE21:
+	.size	meas_close, .-meas_close
+	.section	.rodata.str1.1
+.LC2:
+	.string	"Cannot open %s: %s\n"
+.LC3:
+	.string	"r"
+.LC4:
+	.string	"/proc/cpuinfo"
+.LC5:
+	.string	"model name"
+.LC6:
+	.string	" \t"
+.LC7:
+	.string	"\n"
+	.text
+	.globl	meas_open
+	.type	meas_open, @function
+meas_open:
+.LVL41:
+.LFB19:
+	.loc 1 75 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 75 1 is_stmt 0 view .LVU106
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$264, %rsp	#,
+	.cfi_def_cfa_offset 304
+	movl	%edi, %ebx	# tmp186, mode
+	.loc 1 76 5 is_stmt 1 view .LVU107
+	call	meas_close	#
+.LVL42:
+	.loc 1 77 5 view .LVU108
+# dudect/measfile.c:77:     meas_fd = open(MEAS_FILE, O_WRONLY | O_CREAT | (started ? 0 : O_TRUNC),
+	.loc 1 77 15 is_stmt 0 view .LVU109
+	cmpb	$1, started(%rip)	#, started
+	sbbl	%esi, %esi	# iftmp.0_23
+	andl	$512, %esi	#, iftmp.0_23
+	addl	$65, %esi	#, iftmp.0_23
+	movl	$420, %edx	#,
+	leaq	.LC0(%rip), %rdi	#, tmp119
+	movl	$0, %eax	#,
+	call	open@PLT	#
+.LVL43:
+# dudect/measfile.c:77:     meas_fd = open(MEAS_FILE, O_WRONLY | O_CREAT | (started ? 0 : O_TRUNC),
+	.loc 1 77 13 view .LVU110
+	movl	%eax, meas_fd(%rip)	# _2, meas_fd
+	.loc 1 79 5 is_stmt 1 view .LVU111
+# dudect/measfile.c:79:     if (meas_fd < 0) {
+	.loc 1 79 8 is_stmt 0 view .LVU112
+	testl	%eax, %eax	# _2
+	js	.L53	#,
+	movl	%eax, %edi	# tmp187, _2
+	.loc 1 83 5 is_stmt 1 view .LVU113
+# dudect/measfile.c:83:     started = true;
+	.loc 1 83 13 is_stmt 0 view .LVU114
+	movb	$1, started(%rip)	#, started
+	.loc 1 84 5 is_stmt 1 view .LVU115
+# dudect/measfile.c:84:     header_offset = lseek(meas_fd, 0, SEEK_END);
+	.loc 1 84 21 is_stmt 0 view .LVU116
+	movl	$2, %edx	#,
+	movl	$0, %esi	#,
+	call	lseek@PLT	#
+.LVL44:
+# dudect/measfile.c:84:     header_offset = lseek(meas_fd, 0, SEEK_END);
+	.loc 1 84 19 view .LVU117
+	movq	%rax, header_offset(%rip)	# tmp190, header_offset
+	.loc 1 86 5 is_stmt 1 view .LVU118
+	movq	$0, 28+header(%rip)	#,
+	movq	$0, 144+header(%rip)	#,
+	leaq	36+header(%rip), %rdi	#, tmp130
+	andq	$-8, %rdi	#, tmp130
+	leaq	28+header(%rip), %rcx	#, tmp123
+	subq	%rdi, %rcx	# tmp130, tmp124
+	addl	$124, %ecx	#, tmp125
+	shrl	$3, %ecx	#, tmp131
+	movl	%ecx, %ecx	# tmp131, tmp132
+	movl	$0, %eax	#, tmp126
+	rep stosq
+	.loc 1 87 5 view .LVU119
+	movabsq	$5065797803763324228, %rax	#, tmp202
+	movq	%rax, header(%rip)	# tmp202, MEM <unsigned char[8]> [(char * {ref-all})&header]
+	.loc 1 88 5 view .LVU120
+# dudect/measfile.c:88:     header.version = MEAS_VERSION;
+	.loc 1 88 20 is_stmt 0 view .LVU121
+	movl	$1, 8+header(%rip)	#, header.version
+	.loc 1 89 5 is_stmt 1 view .LVU122
+# dudect/measfile.c:89:     header.header_size = sizeof(meas_header_t);
+	.loc 1 89 24 is_stmt 0 view .LVU123
+	movl	$152, 12+header(%rip)	#, header.header_size
+	.loc 1 90 5 is_stmt 1 view .LVU124
+# dudect/measfile.c:90:     header.record_size = sizeof(meas_record_t);
+	.loc 1 90 24 is_stmt 0 view .LVU125
+	movl	$16, 16+header(%rip)	#, header.record_size
+	.loc 1 91 5 is_stmt 1 view .LVU126
+# dudect/measfile.c:91:     header.op = mode;
+	.loc 1 91 15 is_stmt 0 view .LVU127
+	movl	%ebx, 20+header(%rip)	# mode, header.op
+	.loc 1 92 5 is_stmt 1 view .LVU128
+# dudect/measfile.c:92:     header.timer = timer_active;
+	.loc 1 92 18 is_stmt 0 view .LVU129
+	movl	timer_active(%rip), %eax	# timer_active, timer_active
+	movl	%eax, 24+header(%rip)	# timer_active, header.timer
+	.loc 1 93 5 is_stmt 1 view .LVU130
+# dudect/measfile.c:93:     header.cpu = sched_getcpu();
+	.loc 1 93 18 is_stmt 0 view .LVU131
+	call	sched_getcpu@PLT	#
+.LVL45:
+# dudect/measfile.c:93:     header.cpu = sched_getcpu();
+	.loc 1 93 16 view .LVU132
+	movl	%eax, 28+header(%rip)	# tmp191, header.cpu
+	.loc 1 94 5 is_stmt 1 view .LVU133
+# dudect/measfile.c:94:     header.batch_size = number_measurements;
+	.loc 1 94 23 is_stmt 0 view .LVU134
+	movq	number_measurements(%rip), %rax	# number_measurements, number_measurements
+	movl	%eax, 32+header(%rip)	# number_measurements, header.batch_size
+	.loc 1 95 5 is_stmt 1 view .LVU135
+# dudect/measfile.c:95:     header.drop_size = drop_size;
+	.loc 1 95 22 is_stmt 0 view .LVU136
+	movl	drop_size(%rip), %eax	# drop_size, drop_size
+	movl	%eax, 36+header(%rip)	# drop_size, header.drop_size
+	.loc 1 96 5 is_stmt 1 view .LVU137
+# dudect/measfile.c:96:     header.total_measurements = total_measurements;
+	.loc 1 96 31 is_stmt 0 view .LVU138
+	movl	total_measurements(%rip), %eax	# total_measurements, total_measurements
+	movl	%eax, 40+header(%rip)	# total_measurements, header.total_measurements
+	.loc 1 97 5 is_stmt 1 view .LVU139
+# dudect/measfile.c:97:     strncpy(header.op_name, dut_ops[mode].name, sizeof(header.op_name) - 1);
+	.loc 1 97 42 is_stmt 0 view .LVU140
+	movslq	%ebx, %rbx	# mode, mode
+	.loc 1 97 42 view .LVU141
+	leaq	(%rbx,%rbx,2), %rax	#, tmp153
+	salq	$4, %rax	#, tmp154
+# dudect/measfile.c:97:     strncpy(header.op_name, dut_ops[mode].name, sizeof(header.op_name) - 1);
+	.loc 1 97 5 view .LVU142
+	leaq	dut_ops(%rip), %rdx	#, tmp148
+	movq	(%rdx,%rax), %rsi	# dut_ops[mode_37(D)].name, dut_ops[mode_37(D)].name
+	movl	$31, %edx	#,
+	leaq	56+header(%rip), %rdi	#, tmp157
+	call	strncpy@PLT	#
+.LVL46:
+	.loc 1 98 5 is_stmt 1 view .LVU143
+.LBB11:
+.LBI11:
+	.loc 1 28 13 view .LVU144
+.LBB12:
+	.loc 1 30 5 view .LVU145
+	.loc 1 31 5 view .LVU146
+# dudect/measfile.c:31:     FILE *f = fopen("/proc/cpuinfo", "r");
+	.loc 1 31 15 is_stmt 0 view .LVU147
+	leaq	.LC3(%rip), %rsi	#, tmp158
+	leaq	.LC4(%rip), %rdi	#, tmp159
+	call	fopen@PLT	#
+.LVL47:
+	movq	%rax, %rbp	# tmp192, f
+.LVL48:
+	.loc 1 32 5 is_stmt 1 view .LVU148
+# dudect/measfile.c:32:     buf[0] = '\0';
+	.loc 1 32 12 is_stmt 0 view .LVU149
+	movb	$0, 88+header(%rip)	#, MEM[(char *)&header + 88B]
+	.loc 1 33 5 is_stmt 1 view .LVU150
+# dudect/measfile.c:33:     if (!f)
+	.loc 1 33 8 is_stmt 0 view .LVU151
+	testq	%rax, %rax	# f
+	je	.L46	#,
+.LBB13:
+# dudect/measfile.c:37:         if (strncmp(line, "model name", 10) || !colon)
+	.loc 1 37 13 view .LVU152
+	leaq	.LC5(%rip), %r13	#, tmp185
+.LVL49:
+.L51:
+	.loc 1 37 13 view .LVU153
+.LBE13:
+	.loc 1 35 12 is_stmt 1 view .LVU154
+	movq	%rsp, %rdi	#, tmp177
+	movq	%rbp, %rdx	# f,
+	movl	$256, %esi	#,
+	call	fgets@PLT	#
+.LVL50:
+	testq	%rax, %rax	# tmp197
+	je	.L48	#,
+.LBB14:
+	.loc 1 36 9 view .LVU155
+# dudect/measfile.c:36:         char *colon = strchr(line, ':');
+	.loc 1 36 23 is_stmt 0 view .LVU156
+	movq	%rsp, %r12	#, tmp162
+	movl	$58, %esi	#,
+	movq	%r12, %rdi	# tmp162,
+	call	strchr@PLT	#
+.LVL51:
+	movq	%rax, %rbx	# tmp193, colon
+.LVL52:
+	.loc 1 37 9 is_stmt 1 view .LVU157
+# dudect/measfile.c:37:         if (strncmp(line, "model name", 10) || !colon)
+	.loc 1 37 13 is_stmt 0 view .LVU158
+	movl	$10, %edx	#,
+	movq	%r13, %rsi	# tmp185,
+	movq	%r12, %rdi	# tmp162,
+	call	strncmp@PLT	#
+.LVL53:
+# dudect/measfile.c:37:         if (strncmp(line, "model name", 10) || !colon)
+	.loc 1 37 45 view .LVU159
+	testl	%eax, %eax	# tmp194
+	jne	.L51	#,
+	testq	%rbx, %rbx	# colon
+	je	.L51	#,
+	.loc 1 39 9 is_stmt 1 view .LVU160
+# dudect/measfile.c:39:         colon += strspn(colon + 1, " \t") + 1;
+	.loc 1 39 31 is_stmt 0 view .LVU161
+	leaq	1(%rbx), %rdi	#, tmp171
+# dudect/measfile.c:39:         colon += strspn(colon + 1, " \t") + 1;
+	.loc 1 39 18 view .LVU162
+	leaq	.LC6(%rip), %rsi	#, tmp172
+	call	strspn@PLT	#
+.LVL54:
+# dudect/measfile.c:39:         colon += strspn(colon + 1, " \t") + 1;
+	.loc 1 39 15 view .LVU163
+	leaq	1(%rbx,%rax), %rbx	#, colon
+.LVL55:
+	.loc 1 40 9 is_stmt 1 view .LVU164
+# dudect/measfile.c:40:         colon[strcspn(colon, "\n")] = '\0';
+	.loc 1 40 15 is_stmt 0 view .LVU165
+	leaq	.LC7(%rip), %rsi	#, tmp174
+	movq	%rbx, %rdi	# colon,
+	call	strcspn@PLT	#
+.LVL56:
+# dudect/measfile.c:40:         colon[strcspn(colon, "\n")] = '\0';
+	.loc 1 40 37 view .LVU166
+	movb	$0, (%rbx,%rax)	#, *_62
+	.loc 1 41 9 is_stmt 1 view .LVU167
+	movl	$63, %edx	#,
+	movq	%rbx, %rsi	# colon,
+	leaq	88+header(%rip), %rdi	#, tmp175
+.LVL57:
+	.loc 1 41 9 is_stmt 0 view .LVU168
+	call	strncpy@PLT	#
+.LVL58:
+	.loc 1 42 9 is_stmt 1 view .LVU169
+# dudect/measfile.c:42:         buf[len - 1] = '\0';
+	.loc 1 42 22 is_stmt 0 view .LVU170
+	movb	$0, 151+header(%rip)	#, MEM[(char *)&header + 151B]
+	.loc 1 43 9 is_stmt 1 view .LVU171
+.LVL59:
+.L48:
+	.loc 1 43 9 is_stmt 0 view .LVU172
+.LBE14:
+	.loc 1 45 5 is_stmt 1 view .LVU173
+	movq	%rbp, %rdi	# f,
+	call	fclose@PLT	#
+.LVL60:
+.L46:
+	.loc 1 45 5 is_stmt 0 view .LVU174
+.LBE12:
+.LBE11:
+	.loc 1 99 5 is_stmt 1 view .LVU175
+# dudect/measfile.c:99:     if (!write_all(&header, sizeof(header))) {
+	.loc 1 99 10 is_stmt 0 view .LVU176
+	movl	$152, %esi	#,
+	leaq	header(%rip), %rdi	#, tmp178
+	call	write_all	#
+.LVL61:
+# dudect/measfile.c:99:     if (!write_all(&header, sizeof(header))) {
+	.loc 1 99 8 view .LVU177
+	testb	%al, %al	# tmp198
+	je	.L54	#,
+.L42:
+# dudect/measfile.c:104: }
+	.loc 1 104 1 view .LVU178
+	addq	$264, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL62:
+.L53:
+	.cfi_restore_state
+	.loc 1 80 9 is_stmt 1 view .LVU179
+# dudect/measfile.c:80:         printf("Cannot open %s: %s\n", MEAS_FILE, strerror(errno));
+	.loc 1 80 60 is_stmt 0 view .LVU180
+	call	__errno_location@PLT	#
+.LVL63:
+# dudect/measfile.c:80:         printf("Cannot open %s: %s\n", MEAS_FILE, strerror(errno));
+	.loc 1 80 9 view .LVU181
+	movl	(%rax), %edi	# *_3, *_3
+	call	strerror@PLT	#
+.LVL64:
+	movq	%rax, %rdx	# tmp189, _5
+	leaq	.LC0(%rip), %rsi	#, tmp121
+	leaq	.LC2(%rip), %rdi	#, tmp122
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL65:
+	.loc 1 81 9 is_stmt 1 view .LVU182
+	jmp	.L42	#
+.LVL66:
+.L54:
+	.loc 1 100 9 view .LVU183
+# dudect/measfile.c:100:         printf("Cannot write %s: %s\n", MEAS_FILE, strerror(errno));
+	.loc 1 100 61 is_stmt 0 view .LVU184
+	call	__errno_location@PLT	#
+.LVL67:
+# dudect/measfile.c:100:         printf("Cannot write %s: %s\n", MEAS_FILE, strerror(errno));
+	.loc 1 100 9 view .LVU185
+	movl	(%rax), %edi	# *_19, *_19
+	call	strerror@PLT	#
+.LVL68:
+	movq	%rax, %rdx	# tmp200, _21
+	leaq	.LC0(%rip), %rsi	#, tmp180
+	leaq	.LC1(%rip), %rdi	#, tmp181
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL69:
+	.loc 1 101 9 is_stmt 1 view .LVU186
+	movl	meas_fd(%rip), %edi	# meas_fd,
+	call	close@PLT	#
+.LVL70:
+	.loc 1 102 9 view .LVU187
+# dudect/measfile.c:102:         meas_fd = -1;
+	.loc 1 102 17 is_stmt 0 view .LVU188
+	movl	$-1, meas_fd(%rip)	#, meas_fd
+	jmp	.L42	#
+	.cfi_endproc
+.LFE19:
+	.size	meas_open, .-meas_open
+	.local	started
+	.comm	started,1,1
+	.local	header
+	.comm	header,152,32
+	.local	header_offset
+	.comm	header_offset,8,8
+	.data
+	.align 4
+	.type	meas_fd, @object
+	.size	meas_fd, 4
+meas_fd:
+	.long	-1
+	.local	buffer_cnt
+	.comm	buffer_cnt,8,8
+	.local	buffer
+	.comm	buffer,1048576,32
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "dudect/measfile.h"
+	.file 7 "/usr/include/fcntl.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 10 "/usr/include/stdio.h"
+	.file 11 "./queue.h"
+	.file 12 "dudect/constant.h"
+	.file 13 "dudect/timer.h"
+	.file 14 "/usr/include/unistd.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.file 17 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xec8
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF139
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x4
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x46
+	.uleb128 0xd
+	.long	0x35
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xd
+	.long	0x4d
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF6
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0x4
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x67
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF12
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x29
+	.byte	0x14
+	.long	0x4d
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x75
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x4
+	.long	.LASF17
+	.byte	0x3
+	.byte	0x98
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x3
+	.byte	0x99
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x24
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x5
+	.long	0xf6
+	.uleb128 0x14
+	.long	0xec
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF20
+	.uleb128 0xd
+	.long	0xf6
+	.uleb128 0x4
+	.long	.LASF21
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x13
+	.long	0x96
+	.uleb128 0x4
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x13
+	.long	0xae
+	.uleb128 0xd
+	.long	0x10e
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x83
+	.uleb128 0xd
+	.long	0x11f
+	.uleb128 0x4
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x4
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0xba
+	.uleb128 0x12
+	.byte	0x98
+	.byte	0x6
+	.byte	0x12
+	.long	0x204
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x13
+	.byte	0xa
+	.long	0x204
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x14
+	.byte	0xe
+	.long	0x130
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x15
+	.byte	0xe
+	.long	0x130
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x16
+	.byte	0xe
+	.long	0x130
+	.byte	0x10
+	.uleb128 0x15
+	.string	"op"
+	.byte	0x17
+	.byte	0xe
+	.long	0x130
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x6
+	.byte	0x18
+	.byte	0xe
+	.long	0x130
+	.byte	0x18
+	.uleb128 0x15
+	.string	"cpu"
+	.byte	0x19
+	.byte	0xd
+	.long	0x102
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x6
+	.byte	0x1a
+	.byte	0xe
+	.long	0x130
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x6
+	.byte	0x1b
+	.byte	0xe
+	.long	0x130
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x6
+	.byte	0x1c
+	.byte	0xe
+	.long	0x130
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x6
+	.byte	0x1d
+	.byte	0xe
+	.long	0x130
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x6
+	.byte	0x1e
+	.byte	0xe
+	.long	0x13c
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x6
+	.byte	0x1f
+	.byte	0xa
+	.long	0x214
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x6
+	.byte	0x20
+	.byte	0xa
+	.long	0x224
+	.byte	0x58
+	.byte	0
+	.uleb128 0xa
+	.long	0xf6
+	.long	0x214
+	.uleb128 0xb
+	.long	0x46
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	0xf6
+	.long	0x224
+	.uleb128 0xb
+	.long	0x46
+	.byte	0x1f
+	.byte	0
+	.uleb128 0xa
+	.long	0xf6
+	.long	0x234
+	.uleb128 0xb
+	.long	0x46
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0x6
+	.byte	0x21
+	.byte	0x3
+	.long	0x148
+	.uleb128 0x12
+	.byte	0x10
+	.byte	0x6
+	.byte	0x23
+	.long	0x27c
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x6
+	.byte	0x24
+	.byte	0xd
+	.long	0x10e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x25
+	.byte	0xe
+	.long	0x130
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x26
+	.byte	0xd
+	.long	0x11f
+	.byte	0xc
+	.uleb128 0x15
+	.string	"pad"
+	.byte	0x27
+	.byte	0xd
+	.long	0x27c
+	.byte	0xd
+	.byte	0
+	.uleb128 0xa
+	.long	0x11f
+	.long	0x28c
+	.uleb128 0xb
+	.long	0x46
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x28
+	.byte	0x3
+	.long	0x240
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0x7
+	.byte	0x38
+	.byte	0x11
+	.long	0xc6
+	.uleb128 0x25
+	.long	.LASF78
+	.byte	0xd8
+	.byte	0x8
+	.byte	0x31
+	.byte	0x8
+	.long	0x42b
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x8
+	.byte	0x33
+	.byte	0x7
+	.long	0x4d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x36
+	.byte	0x9
+	.long	0xec
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x37
+	.byte	0x9
+	.long	0xec
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x38
+	.byte	0x9
+	.long	0xec
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9
+	.long	0xec
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x9
+	.long	0xec
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x9
+	.long	0xec
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x9
+	.long	0xec
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x8
+	.byte	0x3d
+	.byte	0x9
+	.long	0xec
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9
+	.long	0xec
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0x8
+	.byte	0x41
+	.byte	0x9
+	.long	0xec
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x8
+	.byte	0x42
+	.byte	0x9
+	.long	0xec
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x8
+	.byte	0x44
+	.byte	0x16
+	.long	0x444
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0x8
+	.byte	0x46
+	.byte	0x14
+	.long	0x449
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0x8
+	.byte	0x48
+	.byte	0x7
+	.long	0x4d
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0x8
+	.byte	0x49
+	.byte	0x7
+	.long	0x4d
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0x8
+	.byte	0x4a
+	.byte	0xb
+	.long	0xc6
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x12
+	.long	0x6e
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0x8
+	.byte	0x4e
+	.byte	0xf
+	.long	0x7c
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0x8
+	.byte	0x4f
+	.byte	0x8
+	.long	0x44e
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0x8
+	.byte	0x51
+	.byte	0xf
+	.long	0x45e
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0x8
+	.byte	0x59
+	.byte	0xd
+	.long	0xd2
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0x8
+	.byte	0x5b
+	.byte	0x17
+	.long	0x468
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0x8
+	.byte	0x5c
+	.byte	0x19
+	.long	0x472
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0x8
+	.byte	0x5d
+	.byte	0x14
+	.long	0x449
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x8
+	.byte	0x5e
+	.byte	0x9
+	.long	0xde
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x8
+	.byte	0x5f
+	.byte	0xa
+	.long	0x35
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x8
+	.byte	0x60
+	.byte	0x7
+	.long	0x4d
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0x8
+	.byte	0x62
+	.byte	0x8
+	.long	0x477
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF73
+	.byte	0x9
+	.byte	0x7
+	.byte	0x19
+	.long	0x2a4
+	.uleb128 0x26
+	.long	.LASF140
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x16
+	.long	.LASF74
+	.uleb128 0x5
+	.long	0x43f
+	.uleb128 0x5
+	.long	0x2a4
+	.uleb128 0xa
+	.long	0xf6
+	.long	0x45e
+	.uleb128 0xb
+	.long	0x46
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x437
+	.uleb128 0x16
+	.long	.LASF75
+	.uleb128 0x5
+	.long	0x463
+	.uleb128 0x16
+	.long	.LASF76
+	.uleb128 0x5
+	.long	0x46d
+	.uleb128 0xa
+	.long	0xf6
+	.long	0x487
+	.uleb128 0xb
+	.long	0x46
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0xfd
+	.uleb128 0x14
+	.long	0x487
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0xa
+	.byte	0x4d
+	.byte	0x13
+	.long	0xe0
+	.uleb128 0x5
+	.long	0x42b
+	.uleb128 0x14
+	.long	0x49d
+	.uleb128 0x27
+	.string	"ELE"
+	.byte	0x10
+	.byte	0xb
+	.byte	0x11
+	.byte	0x10
+	.long	0x4cf
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0xb
+	.byte	0x15
+	.byte	0xb
+	.long	0xec
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xb
+	.byte	0x16
+	.byte	0x11
+	.long	0x4cf
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x4a7
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0xb
+	.byte	0x17
+	.byte	0x3
+	.long	0x4a7
+	.uleb128 0x12
+	.byte	0x18
+	.byte	0xb
+	.byte	0x1a
+	.long	0x510
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0xb
+	.byte	0x1b
+	.byte	0x11
+	.long	0x510
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xb
+	.byte	0x1c
+	.byte	0x11
+	.long	0x510
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0xb
+	.byte	0x1d
+	.byte	0x9
+	.long	0x4d
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	0x4d4
+	.uleb128 0x4
+	.long	.LASF85
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x3
+	.long	0x4e0
+	.uleb128 0x28
+	.byte	0x7
+	.byte	0x4
+	.long	0x75
+	.byte	0xc
+	.byte	0xa
+	.byte	0x6
+	.long	0x560
+	.uleb128 0xc
+	.long	.LASF86
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF87
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF88
+	.byte	0x2
+	.uleb128 0xc
+	.long	.LASF89
+	.byte	0x3
+	.uleb128 0xc
+	.long	.LASF90
+	.byte	0x4
+	.uleb128 0xc
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF92
+	.byte	0x6
+	.uleb128 0xc
+	.long	.LASF93
+	.byte	0x7
+	.byte	0
+	.uleb128 0x12
+	.byte	0x30
+	.byte	0xc
+	.byte	0x16
+	.long	0x5b7
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xc
+	.byte	0x17
+	.byte	0xb
+	.long	0xec
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0xc
+	.byte	0x19
+	.byte	0xa
+	.long	0x5b7
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x10
+	.long	0x5d2
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0xc
+	.byte	0x1d
+	.byte	0x10
+	.long	0x5eb
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF98
+	.byte	0xc
+	.byte	0x1f
+	.byte	0xc
+	.long	0x5fb
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0xc
+	.byte	0x24
+	.byte	0xc
+	.long	0x5fb
+	.byte	0x28
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF100
+	.uleb128 0x1a
+	.long	0x5cd
+	.long	0x5cd
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x5
+	.long	0x515
+	.uleb128 0x5
+	.long	0x5be
+	.uleb128 0x1a
+	.long	0x5cd
+	.long	0x5eb
+	.uleb128 0x2
+	.long	0x5cd
+	.uleb128 0x2
+	.long	0xec
+	.byte	0
+	.uleb128 0x5
+	.long	0x5d7
+	.uleb128 0x29
+	.long	0x5fb
+	.uleb128 0x2
+	.long	0x5cd
+	.byte	0
+	.uleb128 0x5
+	.long	0x5f0
+	.uleb128 0x4
+	.long	.LASF101
+	.byte	0xc
+	.byte	0x25
+	.byte	0x3
+	.long	0x560
+	.uleb128 0xd
+	.long	0x600
+	.uleb128 0xa
+	.long	0x60c
+	.long	0x621
+	.uleb128 0xb
+	.long	0x46
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.long	0x611
+	.uleb128 0x10
+	.long	.LASF102
+	.byte	0xc
+	.byte	0x27
+	.byte	0x17
+	.long	0x621
+	.uleb128 0x10
+	.long	.LASF103
+	.byte	0xd
+	.byte	0x16
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x10
+	.long	.LASF33
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x10
+	.long	.LASF32
+	.byte	0x1
+	.byte	0xe
+	.byte	0x12
+	.long	0x54
+	.uleb128 0x10
+	.long	.LASF104
+	.byte	0x1
+	.byte	0xf
+	.byte	0x15
+	.long	0x41
+	.uleb128 0xa
+	.long	0x28c
+	.long	0x673
+	.uleb128 0x2a
+	.long	0x46
+	.value	0xffff
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF105
+	.byte	0x14
+	.byte	0x16
+	.long	0x662
+	.uleb128 0x9
+	.byte	0x3
+	.quad	buffer
+	.uleb128 0xe
+	.long	.LASF106
+	.byte	0x15
+	.byte	0xf
+	.long	0x35
+	.uleb128 0x9
+	.byte	0x3
+	.quad	buffer_cnt
+	.uleb128 0xe
+	.long	.LASF107
+	.byte	0x16
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	meas_fd
+	.uleb128 0xe
+	.long	.LASF108
+	.byte	0x17
+	.byte	0xe
+	.long	0x298
+	.uleb128 0x9
+	.byte	0x3
+	.quad	header_offset
+	.uleb128 0xe
+	.long	.LASF109
+	.byte	0x18
+	.byte	0x16
+	.long	0x234
+	.uleb128 0x9
+	.byte	0x3
+	.quad	header
+	.uleb128 0xe
+	.long	.LASF110
+	.byte	0x1a
+	.byte	0xd
+	.long	0x5b7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	started
+	.uleb128 0x9
+	.long	.LASF111
+	.byte	0xe
+	.value	0x18e
+	.byte	0x10
+	.long	0x491
+	.long	0x717
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x717
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0xc6
+	.byte	0
+	.uleb128 0x5
+	.long	0x71c
+	.uleb128 0x2b
+	.uleb128 0x9
+	.long	.LASF112
+	.byte	0xe
+	.value	0x17a
+	.byte	0x10
+	.long	0x491
+	.long	0x73e
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x717
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF113
+	.byte	0xa
+	.byte	0xb2
+	.byte	0xc
+	.long	0x4d
+	.long	0x754
+	.uleb128 0x2
+	.long	0x49d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF114
+	.byte	0xa
+	.value	0x250
+	.byte	0xe
+	.long	0xec
+	.long	0x775
+	.uleb128 0x2
+	.long	0xf1
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x4a2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF115
+	.byte	0xf
+	.value	0x125
+	.byte	0xf
+	.long	0x35
+	.long	0x791
+	.uleb128 0x2
+	.long	0x487
+	.uleb128 0x2
+	.long	0x487
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF116
+	.byte	0xf
+	.value	0x129
+	.byte	0xf
+	.long	0x35
+	.long	0x7ad
+	.uleb128 0x2
+	.long	0x487
+	.uleb128 0x2
+	.long	0x487
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF117
+	.byte	0xf
+	.byte	0x9f
+	.byte	0xc
+	.long	0x4d
+	.long	0x7cd
+	.uleb128 0x2
+	.long	0x487
+	.uleb128 0x2
+	.long	0x487
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF118
+	.byte	0xf
+	.byte	0xf6
+	.byte	0xe
+	.long	0xec
+	.long	0x7e8
+	.uleb128 0x2
+	.long	0x487
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF119
+	.byte	0xa
+	.value	0x102
+	.byte	0xe
+	.long	0x49d
+	.long	0x804
+	.uleb128 0x2
+	.long	0x48c
+	.uleb128 0x2
+	.long	0x48c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF120
+	.byte	0xe
+	.value	0x166
+	.byte	0xc
+	.long	0x4d
+	.long	0x81b
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF121
+	.byte	0xf
+	.byte	0x90
+	.byte	0xe
+	.long	0xec
+	.long	0x83b
+	.uleb128 0x2
+	.long	0xec
+	.uleb128 0x2
+	.long	0x487
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF126
+	.byte	0x10
+	.byte	0x5d
+	.byte	0xc
+	.long	0x4d
+	.uleb128 0xf
+	.long	.LASF122
+	.byte	0xf
+	.byte	0x3d
+	.byte	0xe
+	.long	0xde
+	.long	0x867
+	.uleb128 0x2
+	.long	0xde
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF123
+	.byte	0xe
+	.value	0x153
+	.byte	0x10
+	.long	0xc6
+	.long	0x888
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0xc6
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF124
+	.byte	0xa
+	.value	0x164
+	.byte	0xc
+	.long	0x4d
+	.long	0x8a0
+	.uleb128 0x2
+	.long	0x487
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF125
+	.byte	0xf
+	.value	0x1a3
+	.byte	0xe
+	.long	0xec
+	.long	0x8b7
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF127
+	.byte	0x11
+	.byte	0x25
+	.byte	0xd
+	.long	0x8c3
+	.uleb128 0x5
+	.long	0x4d
+	.uleb128 0xf
+	.long	.LASF128
+	.byte	0x7
+	.byte	0xb5
+	.byte	0xc
+	.long	0x4d
+	.long	0x8e4
+	.uleb128 0x2
+	.long	0x487
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF129
+	.byte	0x7e
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x981
+	.uleb128 0x6
+	.quad	.LVL35
+	.long	0xd4e
+	.uleb128 0x7
+	.quad	.LVL36
+	.long	0x6f1
+	.long	0x931
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	header+48
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL37
+	.long	0x804
+	.uleb128 0x6
+	.quad	.LVL38
+	.long	0x8b7
+	.uleb128 0x6
+	.quad	.LVL39
+	.long	0x8a0
+	.uleb128 0x18
+	.quad	.LVL40
+	.long	0x888
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF130
+	.byte	0x6a
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa43
+	.uleb128 0x11
+	.long	.LASF131
+	.byte	0x6a
+	.byte	0x20
+	.long	0xa43
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x11
+	.long	.LASF132
+	.byte	0x6b
+	.byte	0x20
+	.long	0xa48
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x11
+	.long	.LASF133
+	.byte	0x6c
+	.byte	0x1f
+	.long	0xa4d
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x11
+	.long	.LASF134
+	.byte	0x6d
+	.byte	0x18
+	.long	0x35
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x19
+	.string	"to"
+	.byte	0x6e
+	.byte	0x18
+	.long	0x35
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2c
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x13
+	.string	"i"
+	.byte	0x72
+	.byte	0x11
+	.long	0x35
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1d
+	.long	.LLRL11
+	.uleb128 0x13
+	.string	"r"
+	.byte	0x75
+	.byte	0x18
+	.long	0xa52
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x6
+	.quad	.LVL22
+	.long	0xd4e
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x11a
+	.uleb128 0x5
+	.long	0x12b
+	.uleb128 0x5
+	.long	0x41
+	.uleb128 0x5
+	.long	0x28c
+	.uleb128 0x17
+	.long	.LASF135
+	.byte	0x4a
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd4e
+	.uleb128 0x11
+	.long	.LASF136
+	.byte	0x4a
+	.byte	0x14
+	.long	0x4d
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x2d
+	.long	0xe7b
+	.quad	.LBI11
+	.byte	.LVU144
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.byte	0x1
+	.byte	0x62
+	.byte	0x5
+	.long	0xc0f
+	.uleb128 0x1e
+	.long	0xe92
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1e
+	.long	0xe88
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2e
+	.long	0xe9c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0x1f
+	.long	0xea7
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2f
+	.long	0xeb1
+	.long	.LLRL17
+	.long	0xba8
+	.uleb128 0x1f
+	.long	0xeb2
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x7
+	.quad	.LVL51
+	.long	0x7cd
+	.long	0xb13
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL53
+	.long	0x7ad
+	.long	0xb36
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL54
+	.long	0x791
+	.long	0xb5b
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL56
+	.long	0x775
+	.long	0xb80
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL58
+	.long	0x81b
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	header+88
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3f
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL47
+	.long	0x7e8
+	.long	0xbd4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL50
+	.long	0x754
+	.long	0xbfa
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL60
+	.long	0x73e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL42
+	.long	0x8e4
+	.uleb128 0x7
+	.quad	.LVL43
+	.long	0x8c8
+	.long	0xc42
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1a4
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL44
+	.long	0x867
+	.long	0xc5e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL45
+	.long	0x83b
+	.uleb128 0x7
+	.quad	.LVL46
+	.long	0x81b
+	.long	0xc8f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	header+56
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x4f
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL61
+	.long	0xddf
+	.long	0xcb4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	header
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x98
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL63
+	.long	0x8b7
+	.uleb128 0x6
+	.quad	.LVL64
+	.long	0x8a0
+	.uleb128 0x7
+	.quad	.LVL65
+	.long	0x888
+	.long	0xcfa
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL67
+	.long	0x8b7
+	.uleb128 0x6
+	.quad	.LVL68
+	.long	0x8a0
+	.uleb128 0x7
+	.quad	.LVL69
+	.long	0x888
+	.long	0xd40
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL70
+	.long	0x804
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF141
+	.byte	0x1
+	.byte	0x3f
+	.byte	0xd
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xddf
+	.uleb128 0x7
+	.quad	.LVL14
+	.long	0xddf
+	.long	0xd8b
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	buffer
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL15
+	.long	0x8b7
+	.uleb128 0x6
+	.quad	.LVL16
+	.long	0x8a0
+	.uleb128 0x7
+	.quad	.LVL17
+	.long	0x888
+	.long	0xdd1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL18
+	.long	0x804
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF142
+	.byte	0x1
+	.byte	0x30
+	.byte	0xd
+	.long	0x5b7
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe7b
+	.uleb128 0x19
+	.string	"buf"
+	.byte	0x30
+	.byte	0x23
+	.long	0x717
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x19
+	.string	"len"
+	.byte	0x30
+	.byte	0x2f
+	.long	0x35
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x13
+	.string	"p"
+	.byte	0x32
+	.byte	0x11
+	.long	0x487
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1d
+	.long	.LLRL3
+	.uleb128 0x13
+	.string	"n"
+	.byte	0x34
+	.byte	0x11
+	.long	0x491
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x7
+	.quad	.LVL6
+	.long	0x71d
+	.long	0xe6c
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL7
+	.long	0x8b7
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x1c
+	.byte	0xd
+	.byte	0x1
+	.long	0xebf
+	.uleb128 0x20
+	.string	"buf"
+	.byte	0x1d
+	.long	0xec
+	.uleb128 0x20
+	.string	"len"
+	.byte	0x29
+	.long	0x35
+	.uleb128 0x21
+	.long	.LASF137
+	.byte	0x1e
+	.byte	0xa
+	.long	0xebf
+	.uleb128 0x33
+	.string	"f"
+	.byte	0x1
+	.byte	0x1f
+	.byte	0xb
+	.long	0x49d
+	.uleb128 0x34
+	.uleb128 0x21
+	.long	.LASF138
+	.byte	0x24
+	.byte	0xf
+	.long	0xec
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	0xf6
+	.uleb128 0xb
+	.long	0x46
+	.byte	0xff
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU78
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU54
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU67
+	.uleb128 .LVU71
+	.uleb128 .LVU76
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	buffer
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x19
+	.byte	0x3
+	.quad	buffer_cnt
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	buffer
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	buffer
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU144
+	.uleb128 .LVU174
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU144
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU174
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	header+88
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	header+88
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU148
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU174
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU157
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 .LVU172
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU23
+	.uleb128 .LVU25
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU3
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU24
+	.uleb128 .LVU25
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU6
+	.uleb128 .LVU12
+	.uleb128 .LVU16
+	.uleb128 .LVU19
+	.uleb128 .LVU26
+	.uleb128 .LVU27
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF85:
+	.string	"queue_t"
+.LASF63:
+	.string	"_shortbuf"
+.LASF134:
+	.string	"from"
+.LASF129:
+	.string	"meas_close"
+.LASF140:
+	.string	"_IO_lock_t"
+.LASF117:
+	.string	"strncmp"
+.LASF52:
+	.string	"_IO_buf_end"
+.LASF105:
+	.string	"buffer"
+.LASF50:
+	.string	"_IO_write_end"
+.LASF8:
+	.string	"unsigned int"
+.LASF80:
+	.string	"next"
+.LASF27:
+	.string	"version"
+.LASF68:
+	.string	"_freeres_list"
+.LASF126:
+	.string	"sched_getcpu"
+.LASF88:
+	.string	"test_insert_head"
+.LASF44:
+	.string	"_flags"
+.LASF82:
+	.string	"head"
+.LASF13:
+	.string	"__int32_t"
+.LASF59:
+	.string	"_flags2"
+.LASF38:
+	.string	"meas_header_t"
+.LASF125:
+	.string	"strerror"
+.LASF56:
+	.string	"_markers"
+.LASF42:
+	.string	"meas_record_t"
+.LASF136:
+	.string	"mode"
+.LASF92:
+	.string	"test_reverse"
+.LASF127:
+	.string	"__errno_location"
+.LASF24:
+	.string	"uint32_t"
+.LASF28:
+	.string	"header_size"
+.LASF55:
+	.string	"_IO_save_end"
+.LASF75:
+	.string	"_IO_codecvt"
+.LASF115:
+	.string	"strcspn"
+.LASF121:
+	.string	"strncpy"
+.LASF99:
+	.string	"undo"
+.LASF36:
+	.string	"op_name"
+.LASF95:
+	.string	"linear"
+.LASF54:
+	.string	"_IO_backup_base"
+.LASF65:
+	.string	"_offset"
+.LASF79:
+	.string	"value"
+.LASF37:
+	.string	"cpu_model"
+.LASF141:
+	.string	"flush_buffer"
+.LASF10:
+	.string	"size_t"
+.LASF108:
+	.string	"header_offset"
+.LASF22:
+	.string	"int64_t"
+.LASF47:
+	.string	"_IO_read_base"
+.LASF100:
+	.string	"_Bool"
+.LASF87:
+	.string	"test_size"
+.LASF97:
+	.string	"call"
+.LASF16:
+	.string	"__uint64_t"
+.LASF90:
+	.string	"test_remove_head_quiet"
+.LASF39:
+	.string	"ticks"
+.LASF81:
+	.string	"list_ele_t"
+.LASF20:
+	.string	"char"
+.LASF71:
+	.string	"_mode"
+.LASF74:
+	.string	"_IO_marker"
+.LASF120:
+	.string	"close"
+.LASF45:
+	.string	"_IO_read_ptr"
+.LASF77:
+	.string	"ssize_t"
+.LASF123:
+	.string	"lseek"
+.LASF23:
+	.string	"uint8_t"
+.LASF107:
+	.string	"meas_fd"
+.LASF103:
+	.string	"timer_active"
+.LASF89:
+	.string	"test_remove_head"
+.LASF48:
+	.string	"_IO_write_base"
+.LASF4:
+	.string	"long long int"
+.LASF112:
+	.string	"write"
+.LASF124:
+	.string	"printf"
+.LASF53:
+	.string	"_IO_save_base"
+.LASF109:
+	.string	"header"
+.LASF98:
+	.string	"teardown"
+.LASF116:
+	.string	"strspn"
+.LASF122:
+	.string	"memset"
+.LASF131:
+	.string	"exec_times"
+.LASF33:
+	.string	"total_measurements"
+.LASF84:
+	.string	"size"
+.LASF69:
+	.string	"_freeres_buf"
+.LASF104:
+	.string	"number_measurements"
+.LASF70:
+	.string	"__pad5"
+.LASF110:
+	.string	"started"
+.LASF35:
+	.string	"records"
+.LASF119:
+	.string	"fopen"
+.LASF62:
+	.string	"_vtable_offset"
+.LASF114:
+	.string	"fgets"
+.LASF15:
+	.string	"__int64_t"
+.LASF142:
+	.string	"write_all"
+.LASF130:
+	.string	"meas_write"
+.LASF5:
+	.string	"long double"
+.LASF31:
+	.string	"batch_size"
+.LASF46:
+	.string	"_IO_read_end"
+.LASF118:
+	.string	"strchr"
+.LASF12:
+	.string	"short int"
+.LASF2:
+	.string	"long int"
+.LASF40:
+	.string	"length"
+.LASF76:
+	.string	"_IO_wide_data"
+.LASF138:
+	.string	"colon"
+.LASF25:
+	.string	"uint64_t"
+.LASF139:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF113:
+	.string	"fclose"
+.LASF128:
+	.string	"open"
+.LASF19:
+	.string	"__ssize_t"
+.LASF11:
+	.string	"__uint8_t"
+.LASF135:
+	.string	"meas_open"
+.LASF94:
+	.string	"name"
+.LASF26:
+	.string	"magic"
+.LASF91:
+	.string	"test_free_queue"
+.LASF67:
+	.string	"_wide_data"
+.LASF64:
+	.string	"_lock"
+.LASF3:
+	.string	"long unsigned int"
+.LASF60:
+	.string	"_old_offset"
+.LASF106:
+	.string	"buffer_cnt"
+.LASF78:
+	.string	"_IO_FILE"
+.LASF21:
+	.string	"int32_t"
+.LASF32:
+	.string	"drop_size"
+.LASF6:
+	.string	"unsigned char"
+.LASF96:
+	.string	"setup"
+.LASF14:
+	.string	"__uint32_t"
+.LASF137:
+	.string	"line"
+.LASF49:
+	.string	"_IO_write_ptr"
+.LASF83:
+	.string	"tail"
+.LASF66:
+	.string	"_codecvt"
+.LASF29:
+	.string	"record_size"
+.LASF41:
+	.string	"class"
+.LASF58:
+	.string	"_fileno"
+.LASF17:
+	.string	"__off_t"
+.LASF9:
+	.string	"signed char"
+.LASF43:
+	.string	"off_t"
+.LASF7:
+	.string	"short unsigned int"
+.LASF133:
+	.string	"lengths"
+.LASF34:
+	.string	"reserved"
+.LASF102:
+	.string	"dut_ops"
+.LASF93:
+	.string	"test_count"
+.LASF101:
+	.string	"dut_op_t"
+.LASF57:
+	.string	"_chain"
+.LASF86:
+	.string	"test_insert_tail"
+.LASF73:
+	.string	"FILE"
+.LASF111:
+	.string	"pwrite"
+.LASF30:
+	.string	"timer"
+.LASF132:
+	.string	"classes"
+.LASF61:
+	.string	"_cur_column"
+.LASF18:
+	.string	"__off64_t"
+.LASF72:
+	.string	"_unused2"
+.LASF51:
+	.string	"_IO_buf_base"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"dudect/measfile.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -2,48 +2,87 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <strings.h>
+#include <string.h>
 
-static int cmp(const int64_t *a, const int64_t *b)
+/* Difference of two 64-bit values need not fit in an int */
+static int cmp(const void *a, const void *b)
 {
-    return (int) (*a - *b);
+    int64_t x = *(const int64_t *) a, y = *(const int64_t *) b;
+    return (x > y) - (x < y);
 }
 
-int64_t percentile(int64_t *a, double which, size_t size)
+void compute_percentiles(const int64_t *a,
+                         size_t size,
+                         const double *which,
+                         size_t count,
+                         int64_t *out)
 {
-    qsort(a, size, sizeof(int64_t), (int (*)(const void *, const void *)) cmp);
-    size_t array_position = (size_t)((double) size * (double) which);
-    assert(array_position < size);
-    // printf("percentile %f is %lld\n", which, a[array_position]);
-    return a[array_position];
+    int64_t *sorted = malloc(size * sizeof(int64_t));
+    if (!sorted) {
+        fprintf(stderr, "percentiles: out of memory\n");
+        exit(111);
+    }
+    memcpy(sorted, a, size * sizeof(int64_t));
+    qsort(sorted, size, sizeof(int64_t), cmp);
+    for (size_t i = 0; i < count; i++) {
+        size_t array_position = (size_t)((double) size * which[i]);
+        assert(array_position < size);
+        out[i] = sorted[array_position];
+    }
+    free(sorted);
+}
+
+void pwindow_init(pwindow_t *w, size_t capacity)
+{
+    w->values = capacity ? calloc(capacity, sizeof(int64_t)) : NULL;
+    w->capacity = w->values ? capacity : 0;
+    w->count = 0;
+    w->next = 0;
+}
+
+void pwindow_free(pwindow_t *w)
+{
+    free(w->values);
+    pwindow_init(w, 0);
+}
+
+void pwindow_push(pwindow_t *w, const int64_t *a, size_t size)
+{
+    if (!w->capacity)
+        return;
+    /* Only the newest values matter when a exceeds the window */
+    if (size > w->capacity) {
+        a += size - w->capacity;
+        size = w->capacity;
+    }
+    size_t first = w->capacity - w->next;
+    if (first > size)
+        first = size;
+    memcpy(w->values + w->next, a, first * sizeof(int64_t));
+    memcpy(w->values, a + first, (size - first) * sizeof(int64_t));
+    w->next = (w->next + size) % w->capacity;
+    w->count = w->count + size < w->capacity ? w->count + size : w->capacity;
+}
+
+void pwindow_percentiles(pwindow_t *w,
+                         const double *which,
+                         size_t count,
+                         int64_t *out)
+{
+    /* Order of values within the window does not matter */
+    compute_percentiles(w->values, w->count, which, count, out);
 }
 
 #if 0
 int main(int argc, char **argv)
 {
   int64_t a[1000];
-  int64_t b[1000];
+  double which[] = {0.1, 0.9, 0.25, 0.75, 0.99, 0.999};
+  int64_t out[6];
   for (int i = 0; i< 1000; i++) {
     a[i] = i;
-    b[i] = i;
   }
 
-  memcpy(b,a,1000*sizeof(a[0]));
-  percentile(b, 0.1, 1000);
-
-  memcpy(b,a,1000*sizeof(a[0]));
-  percentile(b, 0.9, 1000);
-
-  memcpy(b,a,1000*sizeof(a[0]));
-  percentile(b, 0.25, 1000);
-
-  memcpy(b,a,1000*sizeof(a[0]));
-  percentile(b, 0.75, 1000);
-
-  memcpy(b,a,1000*sizeof(a[0]));
-  percentile(b, 0.99, 1000);
-
-  memcpy(b,a,1000*sizeof(a[0]));
-  percentile(b, 0.999, 1000);
+  compute_percentiles(a, 1000, which, 6, out);
 }
 #endif
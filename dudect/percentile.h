@@ -1,4 +1,30 @@
 #include <stddef.h>
 #include <stdint.h>
 
-int64_t percentile(int64_t *a, double which, size_t length);
+/*
+ * Compute values at fractions which[0..count-1] of a, sorting a copy of a
+ * only once.  a is left unchanged.
+ */
+void compute_percentiles(const int64_t *a,
+                         size_t size,
+                         const double *which,
+                         size_t count,
+                         int64_t *out);
+
+/* Sliding window holding the most recent capacity values */
+typedef struct {
+    int64_t *values;
+    size_t capacity;
+    size_t count; /* Number of valid values */
+    size_t next;  /* Where next value goes */
+} pwindow_t;
+
+void pwindow_init(pwindow_t *w, size_t capacity);
+void pwindow_free(pwindow_t *w);
+void pwindow_push(pwindow_t *w, const int64_t *a, size_t size);
+
+/* Like percentiles, over the values currently in the window */
+void pwindow_percentiles(pwindow_t *w,
+                         const double *which,
+                         size_t count,
+                         int64_t *out);
@@ -0,0 +1,2888 @@
+	.file	"percentile.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "dudect/percentile.c"
+	.type	cmp, @function
+cmp:
+.LVL0:
+.LFB22:
+	.file 1 "dudect/percentile.c"
+	.loc 1 9 1 view -0
+	.cfi_startproc
+	.loc 1 10 5 view .LVU1
+	.loc 1 11 5 view .LVU2
+# dudect/percentile.c:11:     return (x > y) - (x < y);
+	.loc 1 11 15 is_stmt 0 view .LVU3
+	movq	(%rsi), %rax	# MEM[(const int64_t *)b_8(D)], tmp99
+	cmpq	%rax, (%rdi)	# tmp99, MEM[(const int64_t *)a_6(D)]
+	setg	%al	#, tmp92
+	movzbl	%al, %eax	# tmp92, tmp92
+# dudect/percentile.c:11:     return (x > y) - (x < y);
+	.loc 1 11 25 view .LVU4
+	setl	%dl	#, tmp94
+	movzbl	%dl, %edx	# tmp94, tmp94
+# dudect/percentile.c:11:     return (x > y) - (x < y);
+	.loc 1 11 20 view .LVU5
+	subl	%edx, %eax	# tmp94, tmp91
+# dudect/percentile.c:12: }
+	.loc 1 12 1 view .LVU6
+	ret	
+	.cfi_endproc
+.LFE22:
+	.size	cmp, .-cmp
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"percentiles: out of memory\n"
+.LC2:
+	.string	"dudect/percentile.c"
+.LC3:
+	.string	"array_position < size"
+	.text
+	.globl	compute_percentiles
+	.type	compute_percentiles, @function
+compute_percentiles:
+.LVL1:
+.LFB23:
+	.loc 1 19 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 19 1 is_stmt 0 view .LVU8
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 80
+	movq	%rdi, 8(%rsp)	# tmp123, %sfp
+	movq	%rsi, %rbx	# tmp124, size
+	movq	%rdx, %r13	# tmp125, which
+	movq	%rcx, %r12	# tmp126, count
+	movq	%r8, %r14	# tmp127, out
+	.loc 1 20 5 is_stmt 1 view .LVU9
+# dudect/percentile.c:20:     int64_t *sorted = malloc(size * sizeof(int64_t));
+	.loc 1 20 23 is_stmt 0 view .LVU10
+	leaq	0(,%rsi,8), %r15	#, _1
+	movq	%r15, %rdi	# _1,
+.LVL2:
+	.loc 1 20 23 view .LVU11
+	call	malloc@PLT	#
+.LVL3:
+	.loc 1 21 5 is_stmt 1 view .LVU12
+# dudect/percentile.c:21:     if (!sorted) {
+	.loc 1 21 8 is_stmt 0 view .LVU13
+	testq	%rax, %rax	# sorted
+	je	.L13	#,
+	movq	%rax, %rbp	# tmp128, sorted
+	.loc 1 25 5 is_stmt 1 view .LVU14
+	movq	%r15, %rdx	# _1,
+	movq	8(%rsp), %rsi	# %sfp,
+	movq	%rax, %rdi	# sorted,
+	call	memcpy@PLT	#
+.LVL4:
+	.loc 1 26 5 view .LVU15
+	leaq	cmp(%rip), %rcx	#, tmp106
+	movl	$8, %edx	#,
+	movq	%rbx, %rsi	# size,
+	movq	%rbp, %rdi	# sorted,
+	call	qsort@PLT	#
+.LVL5:
+	.loc 1 27 5 view .LVU16
+.LBB2:
+	.loc 1 27 10 view .LVU17
+	.loc 1 27 26 view .LVU18
+	testq	%r12, %r12	# count
+	je	.L4	#,
+# dudect/percentile.c:27:     for (size_t i = 0; i < count; i++) {
+	.loc 1 27 17 is_stmt 0 view .LVU19
+	movl	$0, %eax	#, i
+.LBB3:
+# dudect/percentile.c:28:         size_t array_position = (size_t)((double) size * which[i]);
+	.loc 1 28 42 view .LVU20
+	movq	%rbx, %rsi	# size, tmp120
+	andl	$1, %esi	#, tmp120
+# dudect/percentile.c:28:         size_t array_position = (size_t)((double) size * which[i]);
+	.loc 1 28 16 view .LVU21
+	movsd	.LC1(%rip), %xmm1	#, tmp112
+	movapd	%xmm1, %xmm2	# tmp112, tmp121
+	movabsq	$-9223372036854775808, %rcx	#, tmp122
+	jmp	.L10	#
+.LVL6:
+.L13:
+	.loc 1 28 16 view .LVU22
+.LBE3:
+.LBE2:
+	.loc 1 22 9 is_stmt 1 view .LVU23
+	movq	stderr(%rip), %rcx	# stderr,
+	movl	$27, %edx	#,
+	movl	$1, %esi	#,
+	leaq	.LC0(%rip), %rdi	#, tmp100
+	call	fwrite@PLT	#
+.LVL7:
+	.loc 1 23 9 view .LVU24
+	movl	$111, %edi	#,
+	call	exit@PLT	#
+.LVL8:
+.L5:
+.LBB6:
+.LBB4:
+# dudect/percentile.c:28:         size_t array_position = (size_t)((double) size * which[i]);
+	.loc 1 28 42 is_stmt 0 view .LVU25
+	movq	%rbx, %rdx	# size, tmp109
+	shrq	%rdx	# tmp109
+	orq	%rsi, %rdx	# tmp120, tmp109
+	pxor	%xmm0, %xmm0	# tmp108
+	cvtsi2sdq	%rdx, %xmm0	# tmp109, tmp108
+	addsd	%xmm0, %xmm0	# tmp108, tmp107
+	jmp	.L6	#
+.L7:
+# dudect/percentile.c:28:         size_t array_position = (size_t)((double) size * which[i]);
+	.loc 1 28 16 view .LVU26
+	subsd	%xmm2, %xmm0	# tmp121, tmp113
+	cvttsd2siq	%xmm0, %rdx	# tmp113, array_position
+	xorq	%rcx, %rdx	# tmp122, array_position
+.L8:
+.LVL9:
+	.loc 1 29 9 is_stmt 1 view .LVU27
+	cmpq	%rbx, %rdx	# size, array_position
+	jnb	.L14	#,
+	.loc 1 30 9 discriminator 2 view .LVU28
+# dudect/percentile.c:30:         out[i] = sorted[array_position];
+	.loc 1 30 16 is_stmt 0 discriminator 2 view .LVU29
+	movq	0(%rbp,%rdx,8), %rdx	# *_9, *_9
+.LVL10:
+	.loc 1 30 16 discriminator 2 view .LVU30
+	movq	%rdx, (%r14,%rax,8)	# *_9, MEM[(int64_t *)out_26(D) + i_33 * 8]
+.LBE4:
+	.loc 1 27 36 is_stmt 1 discriminator 2 view .LVU31
+	addq	$1, %rax	#, i
+.LVL11:
+	.loc 1 27 26 discriminator 2 view .LVU32
+	cmpq	%rax, %r12	# i, count
+	je	.L4	#,
+.LVL12:
+.L10:
+.LBB5:
+	.loc 1 28 9 view .LVU33
+# dudect/percentile.c:28:         size_t array_position = (size_t)((double) size * which[i]);
+	.loc 1 28 42 is_stmt 0 view .LVU34
+	testq	%rbx, %rbx	# size
+	js	.L5	#,
+	pxor	%xmm0, %xmm0	# tmp107
+	cvtsi2sdq	%rbx, %xmm0	# size, tmp107
+.L6:
+# dudect/percentile.c:28:         size_t array_position = (size_t)((double) size * which[i]);
+	.loc 1 28 56 view .LVU35
+	mulsd	0(%r13,%rax,8), %xmm0	# MEM[(const double *)which_23(D) + i_33 * 8], tmp111
+# dudect/percentile.c:28:         size_t array_position = (size_t)((double) size * which[i]);
+	.loc 1 28 16 view .LVU36
+	comisd	%xmm1, %xmm0	# tmp112, tmp111
+	jnb	.L7	#,
+	cvttsd2siq	%xmm0, %rdx	# tmp111, array_position
+	jmp	.L8	#
+.LVL13:
+.L14:
+	.loc 1 29 9 is_stmt 1 discriminator 1 view .LVU37
+	leaq	__PRETTY_FUNCTION__.0(%rip), %rcx	#, tmp116
+	movl	$29, %edx	#,
+.LVL14:
+	.loc 1 29 9 is_stmt 0 discriminator 1 view .LVU38
+	leaq	.LC2(%rip), %rsi	#, tmp117
+	leaq	.LC3(%rip), %rdi	#, tmp118
+	call	__assert_fail@PLT	#
+.LVL15:
+.L4:
+	.loc 1 29 9 discriminator 1 view .LVU39
+.LBE5:
+.LBE6:
+	.loc 1 32 5 is_stmt 1 view .LVU40
+	movq	%rbp, %rdi	# sorted,
+	call	free@PLT	#
+.LVL16:
+# dudect/percentile.c:33: }
+	.loc 1 33 1 is_stmt 0 view .LVU41
+	addq	$24, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+.LVL17:
+	.loc 1 33 1 view .LVU42
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL18:
+	.loc 1 33 1 view .LVU43
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL19:
+	.loc 1 33 1 view .LVU44
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL20:
+	.loc 1 33 1 view .LVU45
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL21:
+	.loc 1 33 1 view .LVU46
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE23:
+	.size	compute_percentiles, .-compute_percentiles
+	.globl	pwindow_init
+	.type	pwindow_init, @function
+pwindow_init:
+.LVL22:
+.LFB24:
+	.loc 1 36 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 36 1 is_stmt 0 view .LVU48
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp	# tmp93, w
+	movq	%rsi, %rbx	# tmp94, capacity
+	.loc 1 37 5 is_stmt 1 view .LVU49
+	movl	$0, %eax	#, iftmp.1_7
+# dudect/percentile.c:37:     w->values = capacity ? calloc(capacity, sizeof(int64_t)) : NULL;
+	.loc 1 37 62 is_stmt 0 view .LVU50
+	testq	%rsi, %rsi	# capacity
+	je	.L16	#,
+# dudect/percentile.c:37:     w->values = capacity ? calloc(capacity, sizeof(int64_t)) : NULL;
+	.loc 1 37 28 discriminator 1 view .LVU51
+	movl	$8, %esi	#,
+.LVL23:
+	.loc 1 37 28 discriminator 1 view .LVU52
+	movq	%rbx, %rdi	# capacity,
+.LVL24:
+	.loc 1 37 28 discriminator 1 view .LVU53
+	call	calloc@PLT	#
+.LVL25:
+	.loc 1 38 5 is_stmt 1 discriminator 1 view .LVU54
+# dudect/percentile.c:38:     w->capacity = w->values ? capacity : 0;
+	.loc 1 38 40 is_stmt 0 discriminator 1 view .LVU55
+	testq	%rax, %rax	# iftmp.1_7
+	movl	$0, %edx	#, tmp92
+	cmove	%rdx, %rbx	# capacity,, tmp92, capacity
+.LVL26:
+.L16:
+# dudect/percentile.c:37:     w->values = capacity ? calloc(capacity, sizeof(int64_t)) : NULL;
+	.loc 1 37 15 discriminator 4 view .LVU56
+	movq	%rax, 0(%rbp)	# iftmp.1_7, w_8(D)->values
+# dudect/percentile.c:38:     w->capacity = w->values ? capacity : 0;
+	.loc 1 38 17 discriminator 4 view .LVU57
+	movq	%rbx, 8(%rbp)	# capacity, w_8(D)->capacity
+	.loc 1 39 5 is_stmt 1 discriminator 4 view .LVU58
+# dudect/percentile.c:39:     w->count = 0;
+	.loc 1 39 14 is_stmt 0 discriminator 4 view .LVU59
+	movq	$0, 16(%rbp)	#, w_8(D)->count
+	.loc 1 40 5 is_stmt 1 discriminator 4 view .LVU60
+# dudect/percentile.c:40:     w->next = 0;
+	.loc 1 40 13 is_stmt 0 discriminator 4 view .LVU61
+	movq	$0, 24(%rbp)	#, w_8(D)->next
+# dudect/percentile.c:41: }
+	.loc 1 41 1 discriminator 4 view .LVU62
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL27:
+	.loc 1 41 1 discriminator 4 view .LVU63
+	ret	
+	.cfi_endproc
+.LFE24:
+	.size	pwindow_init, .-pwindow_init
+	.globl	pwindow_free
+	.type	pwindow_free, @function
+pwindow_free:
+.LVL28:
+.LFB25:
+	.loc 1 44 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 44 1 is_stmt 0 view .LVU65
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp85, w
+	.loc 1 45 5 is_stmt 1 view .LVU66
+	movq	(%rdi), %rdi	# w_3(D)->values, w_3(D)->values
+.LVL29:
+	.loc 1 45 5 is_stmt 0 view .LVU67
+	call	free@PLT	#
+.LVL30:
+	.loc 1 46 5 is_stmt 1 view .LVU68
+	movl	$0, %esi	#,
+	movq	%rbx, %rdi	# w,
+	call	pwindow_init	#
+.LVL31:
+# dudect/percentile.c:47: }
+	.loc 1 47 1 is_stmt 0 view .LVU69
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL32:
+	.loc 1 47 1 view .LVU70
+	ret	
+	.cfi_endproc
+.LFE25:
+	.size	pwindow_free, .-pwindow_free
+	.globl	pwindow_push
+	.type	pwindow_push, @function
+pwindow_push:
+.LVL33:
+.LFB26:
+	.loc 1 50 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 51 5 view .LVU72
+# dudect/percentile.c:51:     if (!w->capacity)
+	.loc 1 51 11 is_stmt 0 view .LVU73
+	movq	8(%rdi), %rax	# w_25(D)->capacity, _1
+# dudect/percentile.c:51:     if (!w->capacity)
+	.loc 1 51 8 view .LVU74
+	testq	%rax, %rax	# _1
+	je	.L26	#,
+# dudect/percentile.c:50: {
+	.loc 1 50 1 view .LVU75
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %rbp	# tmp133, w
+	movq	%rsi, %r13	# tmp134, a
+	movq	%rdx, %rbx	# tmp135, size
+	.loc 1 54 5 is_stmt 1 view .LVU76
+# dudect/percentile.c:54:     if (size > w->capacity) {
+	.loc 1 54 8 is_stmt 0 view .LVU77
+	cmpq	%rdx, %rax	# size, _1
+	jnb	.L24	#,
+	.loc 1 55 9 is_stmt 1 view .LVU78
+# dudect/percentile.c:55:         a += size - w->capacity;
+	.loc 1 55 19 is_stmt 0 view .LVU79
+	subq	%rax, %rbx	# _1, tmp106
+# dudect/percentile.c:55:         a += size - w->capacity;
+	.loc 1 55 11 view .LVU80
+	leaq	(%rsi,%rbx,8), %r13	#, a
+.LVL34:
+	.loc 1 56 9 is_stmt 1 view .LVU81
+# dudect/percentile.c:56:         size = w->capacity;
+	.loc 1 56 14 is_stmt 0 view .LVU82
+	movq	%rax, %rbx	# _1, size
+.LVL35:
+.L24:
+	.loc 1 58 5 is_stmt 1 view .LVU83
+# dudect/percentile.c:58:     size_t first = w->capacity - w->next;
+	.loc 1 58 35 is_stmt 0 view .LVU84
+	movq	24(%rbp), %rdx	# w_25(D)->next, _5
+.LVL36:
+	.loc 1 59 5 is_stmt 1 view .LVU85
+# dudect/percentile.c:58:     size_t first = w->capacity - w->next;
+	.loc 1 58 12 is_stmt 0 view .LVU86
+	subq	%rdx, %rax	# _5, first
+.LVL37:
+	.loc 1 58 12 view .LVU87
+	cmpq	%rbx, %rax	# size, first
+	cmova	%rbx, %rax	# first,, size, first
+.LVL38:
+	.loc 1 58 12 view .LVU88
+	movq	%rax, %r12	# first, _2
+.LVL39:
+	.loc 1 61 5 is_stmt 1 view .LVU89
+	leaq	0(,%rax,8), %r14	#, _6
+# dudect/percentile.c:61:     memcpy(w->values + w->next, a, first * sizeof(int64_t));
+	.loc 1 61 22 is_stmt 0 view .LVU90
+	movq	0(%rbp), %rax	# w_25(D)->values, w_25(D)->values
+.LVL40:
+	.loc 1 61 22 view .LVU91
+	leaq	(%rax,%rdx,8), %rdi	#, tmp110
+.LVL41:
+# dudect/percentile.c:61:     memcpy(w->values + w->next, a, first * sizeof(int64_t));
+	.loc 1 61 5 view .LVU92
+	movq	%r14, %rdx	# _6,
+	movq	%r13, %rsi	# a,
+	call	memcpy@PLT	#
+.LVL42:
+	.loc 1 62 5 is_stmt 1 view .LVU93
+	movq	0(%rbp), %rdi	# w_25(D)->values, w_25(D)->values
+# dudect/percentile.c:62:     memcpy(w->values, a + first, (size - first) * sizeof(int64_t));
+	.loc 1 62 40 is_stmt 0 view .LVU94
+	movq	%rbx, %rdx	# size, tmp118
+	subq	%r12, %rdx	# _2, tmp118
+# dudect/percentile.c:62:     memcpy(w->values, a + first, (size - first) * sizeof(int64_t));
+	.loc 1 62 5 view .LVU95
+	salq	$3, %rdx	#, tmp119
+# dudect/percentile.c:62:     memcpy(w->values, a + first, (size - first) * sizeof(int64_t));
+	.loc 1 62 25 view .LVU96
+	leaq	0(%r13,%r14), %rsi	#, tmp120
+# dudect/percentile.c:62:     memcpy(w->values, a + first, (size - first) * sizeof(int64_t));
+	.loc 1 62 5 view .LVU97
+	call	memcpy@PLT	#
+.LVL43:
+	.loc 1 63 5 is_stmt 1 view .LVU98
+# dudect/percentile.c:63:     w->next = (w->next + size) % w->capacity;
+	.loc 1 63 35 is_stmt 0 view .LVU99
+	movq	8(%rbp), %rcx	# w_25(D)->capacity, _16
+# dudect/percentile.c:63:     w->next = (w->next + size) % w->capacity;
+	.loc 1 63 24 view .LVU100
+	movq	%rbx, %rax	# size, tmp126
+	addq	24(%rbp), %rax	# w_25(D)->next, tmp126
+# dudect/percentile.c:63:     w->next = (w->next + size) % w->capacity;
+	.loc 1 63 32 view .LVU101
+	movl	$0, %edx	#, tmp128
+	divq	%rcx	# _16
+# dudect/percentile.c:63:     w->next = (w->next + size) % w->capacity;
+	.loc 1 63 13 view .LVU102
+	movq	%rdx, 24(%rbp)	# tmp128, w_25(D)->next
+	.loc 1 64 5 is_stmt 1 view .LVU103
+# dudect/percentile.c:64:     w->count = w->count + size < w->capacity ? w->count + size : w->capacity;
+	.loc 1 64 25 is_stmt 0 view .LVU104
+	addq	16(%rbp), %rbx	# w_25(D)->count, tmp130
+.LVL44:
+# dudect/percentile.c:64:     w->count = w->count + size < w->capacity ? w->count + size : w->capacity;
+	.loc 1 64 64 view .LVU105
+	cmpq	%rcx, %rbx	# _16, tmp130
+	cmova	%rcx, %rbx	# tmp130,, _16, tmp132
+# dudect/percentile.c:64:     w->count = w->count + size < w->capacity ? w->count + size : w->capacity;
+	.loc 1 64 14 view .LVU106
+	movq	%rbx, 16(%rbp)	# tmp132, w_25(D)->count
+# dudect/percentile.c:65: }
+	.loc 1 65 1 view .LVU107
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+.LVL45:
+	.loc 1 65 1 view .LVU108
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+.LVL46:
+	.loc 1 65 1 view .LVU109
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL47:
+	.loc 1 65 1 view .LVU110
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL48:
+.L26:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.loc 1 65 1 view .LVU111
+	ret	
+	.cfi_endproc
+.LFE26:
+	.size	pwindow_push, .-pwindow_push
+	.globl	pwindow_percentiles
+	.type	pwindow_percentiles, @function
+pwindow_percentiles:
+.LVL49:
+.LFB27:
+	.loc 1 71 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 71 1 is_stmt 0 view .LVU113
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	movq	%rcx, %r8	# out, tmp93
+	.loc 1 73 5 is_stmt 1 view .LVU114
+	movq	16(%rdi), %rax	# w_4(D)->count, w_4(D)->count
+	movq	(%rdi), %rdi	# w_4(D)->values, w_4(D)->values
+.LVL50:
+	.loc 1 73 5 is_stmt 0 view .LVU115
+	movq	%rdx, %rcx	# count,
+.LVL51:
+	.loc 1 73 5 view .LVU116
+	movq	%rsi, %rdx	# which,
+.LVL52:
+	.loc 1 73 5 view .LVU117
+	movq	%rax, %rsi	# w_4(D)->count,
+.LVL53:
+	.loc 1 73 5 view .LVU118
+	call	compute_percentiles	#
+.LVL54:
+# dudect/percentile.c:74: }
+	.loc 1 74 1 view .LVU119
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE27:
+	.size	pwindow_percentiles, .-pwindow_percentiles
+	.section	.rodata
+	.align 16
+	.type	__PRETTY_FUNCTION__.0, @object
+	.size	__PRETTY_FUNCTION__.0, 20
+__PRETTY_FUNCTION__.0:
+	.string	"compute_percentiles"
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC1:
+	.long	0
+	.long	1138753536
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "dudect/percentile.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 8 "/usr/include/stdlib.h"
+	.file 9 "/usr/include/assert.h"
+	.file 10 "/usr/include/string.h"
+	.file 11 "/usr/include/stdio.h"
+	.file 12 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x83d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF79
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x7
+	.long	.LASF11
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x41
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x5
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF6
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x7
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x7
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x98
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x7
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x99
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x18
+	.byte	0x8
+	.uleb128 0x4
+	.long	0xab
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0xc
+	.long	0xab
+	.uleb128 0x7
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x13
+	.long	0x80
+	.uleb128 0xc
+	.long	0xb7
+	.uleb128 0x19
+	.byte	0x20
+	.byte	0x5
+	.byte	0xf
+	.byte	0x9
+	.long	0x106
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x10
+	.byte	0xe
+	.long	0x106
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x11
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x12
+	.byte	0xc
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x13
+	.byte	0xc
+	.long	0x35
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x7
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x14
+	.byte	0x3
+	.long	0xc8
+	.uleb128 0x1a
+	.long	.LASF80
+	.byte	0xd8
+	.byte	0x6
+	.byte	0x31
+	.byte	0x8
+	.long	0x29e
+	.uleb128 0x1
+	.long	.LASF22
+	.byte	0x6
+	.byte	0x33
+	.byte	0x7
+	.long	0x48
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x6
+	.byte	0x36
+	.byte	0x9
+	.long	0xa6
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x6
+	.byte	0x37
+	.byte	0x9
+	.long	0xa6
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x6
+	.byte	0x38
+	.byte	0x9
+	.long	0xa6
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x39
+	.byte	0x9
+	.long	0xa6
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x9
+	.long	0xa6
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x9
+	.long	0xa6
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x9
+	.long	0xa6
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x9
+	.long	0xa6
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x6
+	.byte	0x40
+	.byte	0x9
+	.long	0xa6
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x6
+	.byte	0x41
+	.byte	0x9
+	.long	0xa6
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x6
+	.byte	0x42
+	.byte	0x9
+	.long	0xa6
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x6
+	.byte	0x44
+	.byte	0x16
+	.long	0x2b7
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x6
+	.byte	0x46
+	.byte	0x14
+	.long	0x2bc
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x6
+	.byte	0x48
+	.byte	0x7
+	.long	0x48
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x6
+	.byte	0x49
+	.byte	0x7
+	.long	0x48
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xb
+	.long	0x8c
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x12
+	.long	0x64
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xf
+	.long	0x72
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x8
+	.long	0x2c1
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x51
+	.byte	0xf
+	.long	0x2d1
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x59
+	.byte	0xd
+	.long	0x98
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2db
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x6
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2e5
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x6
+	.byte	0x5d
+	.byte	0x14
+	.long	0x2bc
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x9
+	.long	0xa4
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xa
+	.long	0x35
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x6
+	.byte	0x60
+	.byte	0x7
+	.long	0x48
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0x6
+	.byte	0x62
+	.byte	0x8
+	.long	0x2ea
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF51
+	.byte	0x7
+	.byte	0x7
+	.byte	0x19
+	.long	0x117
+	.uleb128 0x1b
+	.long	.LASF81
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0xd
+	.long	.LASF52
+	.uleb128 0x4
+	.long	0x2b2
+	.uleb128 0x4
+	.long	0x117
+	.uleb128 0xe
+	.long	0xab
+	.long	0x2d1
+	.uleb128 0xf
+	.long	0x41
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x2aa
+	.uleb128 0xd
+	.long	.LASF53
+	.uleb128 0x4
+	.long	0x2d6
+	.uleb128 0xd
+	.long	.LASF54
+	.uleb128 0x4
+	.long	0x2e0
+	.uleb128 0xe
+	.long	0xab
+	.long	0x2fa
+	.uleb128 0xf
+	.long	0x41
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	0x29e
+	.uleb128 0x1c
+	.long	.LASF69
+	.byte	0xb
+	.byte	0x91
+	.byte	0xe
+	.long	0x2fa
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF55
+	.uleb128 0x1d
+	.long	.LASF56
+	.byte	0x8
+	.value	0x33d
+	.byte	0xf
+	.long	0x31f
+	.uleb128 0x4
+	.long	0x324
+	.uleb128 0x1e
+	.long	0x48
+	.long	0x338
+	.uleb128 0x3
+	.long	0x338
+	.uleb128 0x3
+	.long	0x338
+	.byte	0
+	.uleb128 0x4
+	.long	0x33d
+	.uleb128 0x1f
+	.uleb128 0x4
+	.long	0xb2
+	.uleb128 0x12
+	.long	.LASF57
+	.value	0x22c
+	.long	0xa4
+	.long	0x35d
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF59
+	.value	0x238
+	.long	0x36e
+	.uleb128 0x3
+	.long	0xa4
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF58
+	.byte	0x9
+	.byte	0x45
+	.byte	0xd
+	.long	0x38f
+	.uleb128 0x3
+	.long	0x33e
+	.uleb128 0x3
+	.long	0x33e
+	.uleb128 0x3
+	.long	0x6b
+	.uleb128 0x3
+	.long	0x33e
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF60
+	.value	0x353
+	.long	0x3af
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x312
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF61
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xe
+	.long	0xa4
+	.long	0x3cf
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0x338
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF62
+	.byte	0x8
+	.value	0x27d
+	.byte	0xd
+	.long	0x3e2
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF63
+	.value	0x229
+	.long	0xa4
+	.long	0x3f7
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF66
+	.byte	0x43
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x481
+	.uleb128 0x6
+	.string	"w"
+	.byte	0x43
+	.byte	0x25
+	.long	0x481
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x8
+	.long	.LASF64
+	.byte	0x44
+	.byte	0x28
+	.long	0x486
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x8
+	.long	.LASF19
+	.byte	0x45
+	.byte	0x21
+	.long	0x35
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x6
+	.string	"out"
+	.byte	0x46
+	.byte	0x23
+	.long	0x106
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x9
+	.quad	.LVL54
+	.long	0x5ef
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x10b
+	.uleb128 0x4
+	.long	0x492
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF65
+	.uleb128 0xc
+	.long	0x48b
+	.uleb128 0xb
+	.long	.LASF67
+	.byte	0x31
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x53c
+	.uleb128 0x6
+	.string	"w"
+	.byte	0x31
+	.byte	0x1e
+	.long	0x481
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x6
+	.string	"a"
+	.byte	0x31
+	.byte	0x30
+	.long	0x53c
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x8
+	.long	.LASF68
+	.byte	0x31
+	.byte	0x3a
+	.long	0x35
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x10
+	.long	.LASF70
+	.byte	0x3a
+	.byte	0xc
+	.long	0x35
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xa
+	.quad	.LVL42
+	.long	0x82e
+	.long	0x519
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL43
+	.long	0x82e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xc3
+	.uleb128 0xb
+	.long	.LASF71
+	.byte	0x2b
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x595
+	.uleb128 0x6
+	.string	"w"
+	.byte	0x2b
+	.byte	0x1e
+	.long	0x481
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x23
+	.quad	.LVL30
+	.long	0x35d
+	.uleb128 0x9
+	.quad	.LVL31
+	.long	0x595
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF72
+	.byte	0x23
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5ef
+	.uleb128 0x6
+	.string	"w"
+	.byte	0x23
+	.byte	0x1e
+	.long	0x481
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x8
+	.long	.LASF18
+	.byte	0x23
+	.byte	0x28
+	.long	0x35
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x9
+	.quad	.LVL25
+	.long	0x343
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF73
+	.byte	0xe
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7c0
+	.uleb128 0x6
+	.string	"a"
+	.byte	0xe
+	.byte	0x29
+	.long	0x53c
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x8
+	.long	.LASF68
+	.byte	0xf
+	.byte	0x21
+	.long	0x35
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x8
+	.long	.LASF64
+	.byte	0x10
+	.byte	0x28
+	.long	0x486
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x8
+	.long	.LASF19
+	.byte	0x11
+	.byte	0x21
+	.long	0x35
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x6
+	.string	"out"
+	.byte	0x12
+	.byte	0x23
+	.long	0x106
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x10
+	.long	.LASF74
+	.byte	0x14
+	.byte	0xe
+	.long	0x106
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x24
+	.long	.LASF82
+	.long	0x7d0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.uleb128 0x25
+	.long	.LLRL8
+	.long	0x6fc
+	.uleb128 0x11
+	.string	"i"
+	.byte	0x1b
+	.byte	0x11
+	.long	0x35
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x26
+	.long	.LLRL10
+	.uleb128 0x10
+	.long	.LASF75
+	.byte	0x1c
+	.byte	0x10
+	.long	0x35
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x9
+	.quad	.LVL15
+	.long	0x36e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x4d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL3
+	.long	0x3e2
+	.long	0x714
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL4
+	.long	0x82e
+	.long	0x73a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL5
+	.long	0x38f
+	.long	0x76a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmp
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL7
+	.long	0x837
+	.long	0x793
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x4b
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL8
+	.long	0x3cf
+	.long	0x7ab
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x6f
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL16
+	.long	0x35d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xb2
+	.long	0x7d0
+	.uleb128 0xf
+	.long	0x41
+	.byte	0x13
+	.byte	0
+	.uleb128 0xc
+	.long	0x7c0
+	.uleb128 0x27
+	.string	"cmp"
+	.byte	0x1
+	.byte	0x8
+	.byte	0xc
+	.long	0x48
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x82e
+	.uleb128 0x14
+	.string	"a"
+	.byte	0x1c
+	.long	0x338
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x14
+	.string	"b"
+	.byte	0x2b
+	.long	0x338
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x11
+	.string	"x"
+	.byte	0xa
+	.byte	0xd
+	.long	0xb7
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x11
+	.string	"y"
+	.byte	0xa
+	.byte	0x27
+	.long	0xb7
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF61
+	.long	.LASF77
+	.uleb128 0x15
+	.long	.LASF76
+	.long	.LASF78
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU105
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU85
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU88
+	.uleb128 .LVU89
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU109
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU12
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU24
+	.uleb128 .LVU25
+	.uleb128 .LVU43
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU18
+	.uleb128 .LVU22
+	.uleb128 .LVU25
+	.uleb128 .LVU39
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU27
+	.uleb128 .LVU30
+	.uleb128 .LVU37
+	.uleb128 .LVU38
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU2
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU2
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF13:
+	.string	"__off_t"
+.LASF19:
+	.string	"count"
+.LASF18:
+	.string	"capacity"
+.LASF23:
+	.string	"_IO_read_ptr"
+.LASF63:
+	.string	"malloc"
+.LASF35:
+	.string	"_chain"
+.LASF11:
+	.string	"size_t"
+.LASF41:
+	.string	"_shortbuf"
+.LASF29:
+	.string	"_IO_buf_base"
+.LASF55:
+	.string	"long long unsigned int"
+.LASF12:
+	.string	"__int64_t"
+.LASF20:
+	.string	"next"
+.LASF44:
+	.string	"_codecvt"
+.LASF72:
+	.string	"pwindow_init"
+.LASF4:
+	.string	"long long int"
+.LASF9:
+	.string	"signed char"
+.LASF78:
+	.string	"__builtin_fwrite"
+.LASF82:
+	.string	"__PRETTY_FUNCTION__"
+.LASF36:
+	.string	"_fileno"
+.LASF24:
+	.string	"_IO_read_end"
+.LASF71:
+	.string	"pwindow_free"
+.LASF2:
+	.string	"long int"
+.LASF22:
+	.string	"_flags"
+.LASF30:
+	.string	"_IO_buf_end"
+.LASF39:
+	.string	"_cur_column"
+.LASF53:
+	.string	"_IO_codecvt"
+.LASF65:
+	.string	"double"
+.LASF38:
+	.string	"_old_offset"
+.LASF43:
+	.string	"_offset"
+.LASF60:
+	.string	"qsort"
+.LASF48:
+	.string	"__pad5"
+.LASF52:
+	.string	"_IO_marker"
+.LASF8:
+	.string	"unsigned int"
+.LASF47:
+	.string	"_freeres_buf"
+.LASF64:
+	.string	"which"
+.LASF3:
+	.string	"long unsigned int"
+.LASF27:
+	.string	"_IO_write_ptr"
+.LASF68:
+	.string	"size"
+.LASF7:
+	.string	"short unsigned int"
+.LASF17:
+	.string	"values"
+.LASF67:
+	.string	"pwindow_push"
+.LASF31:
+	.string	"_IO_save_base"
+.LASF77:
+	.string	"__builtin_memcpy"
+.LASF42:
+	.string	"_lock"
+.LASF37:
+	.string	"_flags2"
+.LASF49:
+	.string	"_mode"
+.LASF5:
+	.string	"long double"
+.LASF28:
+	.string	"_IO_write_end"
+.LASF79:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF81:
+	.string	"_IO_lock_t"
+.LASF80:
+	.string	"_IO_FILE"
+.LASF34:
+	.string	"_markers"
+.LASF58:
+	.string	"__assert_fail"
+.LASF73:
+	.string	"compute_percentiles"
+.LASF66:
+	.string	"pwindow_percentiles"
+.LASF6:
+	.string	"unsigned char"
+.LASF10:
+	.string	"short int"
+.LASF54:
+	.string	"_IO_wide_data"
+.LASF40:
+	.string	"_vtable_offset"
+.LASF51:
+	.string	"FILE"
+.LASF62:
+	.string	"exit"
+.LASF74:
+	.string	"sorted"
+.LASF70:
+	.string	"first"
+.LASF15:
+	.string	"char"
+.LASF14:
+	.string	"__off64_t"
+.LASF25:
+	.string	"_IO_read_base"
+.LASF61:
+	.string	"memcpy"
+.LASF33:
+	.string	"_IO_save_end"
+.LASF59:
+	.string	"free"
+.LASF21:
+	.string	"pwindow_t"
+.LASF50:
+	.string	"_unused2"
+.LASF69:
+	.string	"stderr"
+.LASF57:
+	.string	"calloc"
+.LASF32:
+	.string	"_IO_backup_base"
+.LASF76:
+	.string	"fwrite"
+.LASF56:
+	.string	"__compar_fn_t"
+.LASF46:
+	.string	"_freeres_list"
+.LASF45:
+	.string	"_wide_data"
+.LASF16:
+	.string	"int64_t"
+.LASF75:
+	.string	"array_position"
+.LASF26:
+	.string	"_IO_write_base"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"dudect/percentile.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
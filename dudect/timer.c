@@ -0,0 +1,77 @@
+#include "timer.h"
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+int timer_active = TIMER_RDTSC;
+
+/* Counter is per process: a forked worker must open its own */
+static int perf_fd = -1;
+static pid_t perf_pid = 0;
+static int perf_config = -1;
+
+static bool perf_open(int backend)
+{
+    int config = backend == TIMER_PERF_CYCLES ? PERF_COUNT_HW_CPU_CYCLES
+                                              : PERF_COUNT_HW_INSTRUCTIONS;
+    if (perf_fd >= 0 && perf_pid == getpid() && perf_config == config)
+        return true;
+    if (perf_fd >= 0)
+        close(perf_fd);
+
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    /* Calling thread only, on any CPU */
+    perf_fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (perf_fd < 0)
+        return false;
+    perf_pid = getpid();
+    perf_config = config;
+    ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    return true;
+}
+
+void timer_setup(void)
+{
+    int backend = timing_backend;
+    if (backend < 0 || backend >= TIMER_COUNT) {
+        printf("Unknown timer %d, using %d\n", backend, TIMER_LFENCE);
+        backend = TIMER_LFENCE;
+    }
+    if ((backend == TIMER_PERF_CYCLES ||
+         backend == TIMER_PERF_INSTRUCTIONS) &&
+        !perf_open(backend)) {
+        printf("Hardware counters unavailable (%s), using timer %d\n",
+               strerror(errno), TIMER_LFENCE);
+        backend = TIMER_LFENCE;
+    }
+    timer_active = backend;
+}
+
+int64_t perf_read(void)
+{
+    uint64_t count = 0;
+    ssize_t n;
+    do
+        n = read(perf_fd, &count, sizeof(count));
+    while (n < 0 && errno == EINTR);
+    if (n != sizeof(count)) {
+        /* Fall back as timer_setup does.  The next test tries again */
+        printf("Cannot read hardware counter (%s), using timer %d\n",
+               n < 0 ? strerror(errno) : "short read", TIMER_LFENCE);
+        close(perf_fd);
+        perf_fd = -1;
+        timer_active = TIMER_LFENCE;
+        return cpucycles_lfence();
+    }
+    return (int64_t) count;
+}
@@ -0,0 +1,51 @@
+#ifndef DUDECT_TIMER_H
+#define DUDECT_TIMER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cpucycles.h"
+
+/* Ways of timing a measurement, selected with option timer */
+enum {
+    TIMER_RDTSC,             /* Bare rdtsc, may be reordered */
+    TIMER_LFENCE,            /* lfence; rdtsc; lfence */
+    TIMER_RDTSCP,            /* rdtscp; lfence */
+    TIMER_PERF_CYCLES,       /* perf_event_open, cycles of this thread */
+    TIMER_PERF_INSTRUCTIONS, /* perf_event_open, instructions retired */
+    TIMER_COUNT
+};
+
+/* Requested backend.  Set by console option */
+extern int timing_backend;
+
+/* Backend actually in use, after timer_setup */
+extern int timer_active;
+
+/*
+ * Prepare the requested backend for the calling process.  Falls back to
+ * TIMER_LFENCE, with a warning, if it cannot be used.
+ */
+void timer_setup(void);
+
+/*
+ * Read the hardware counter opened by timer_setup.  If the read fails,
+ * warns and switches timer_active to TIMER_LFENCE.
+ */
+int64_t perf_read(void);
+
+static inline int64_t timer_read(void)
+{
+    switch (timer_active) {
+    case TIMER_LFENCE:
+        return cpucycles_lfence();
+    case TIMER_RDTSCP:
+        return cpucycles_rdtscp();
+    case TIMER_PERF_CYCLES:
+    case TIMER_PERF_INSTRUCTIONS:
+        return perf_read();
+    default:
+        return cpucycles();
+    }
+}
+
+#endif
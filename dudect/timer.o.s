@@ -0,0 +1,2751 @@
+	.file	"timer.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "dudect/timer.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Unknown timer %d, using %d\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"Hardware counters unavailable (%s), using timer %d\n"
+	.text
+	.globl	timer_setup
+	.type	timer_setup, @function
+timer_setup:
+.LFB46:
+	.file 1 "dudect/timer.c"
+	.loc 1 44 1 view -0
+	.cfi_startproc
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$136, %rsp	#,
+	.cfi_def_cfa_offset 176
+	.loc 1 45 5 view .LVU1
+# dudect/timer.c:45:     int backend = timing_backend;
+	.loc 1 45 9 is_stmt 0 view .LVU2
+	movl	timing_backend(%rip), %ebx	# timing_backend, backend
+.LVL0:
+	.loc 1 46 5 is_stmt 1 view .LVU3
+# dudect/timer.c:46:     if (backend < 0 || backend >= TIMER_COUNT) {
+	.loc 1 46 8 is_stmt 0 view .LVU4
+	cmpl	$4, %ebx	#, backend
+	ja	.L10	#,
+	.loc 1 50 5 is_stmt 1 view .LVU5
+# dudect/timer.c:50:     if ((backend == TIMER_PERF_CYCLES ||
+	.loc 1 50 39 is_stmt 0 view .LVU6
+	leal	-3(%rbx), %eax	#, tmp99
+# dudect/timer.c:50:     if ((backend == TIMER_PERF_CYCLES ||
+	.loc 1 50 8 view .LVU7
+	cmpl	$1, %eax	#, tmp99
+	jbe	.L11	#,
+.LVL1:
+.L3:
+	.loc 1 57 5 is_stmt 1 view .LVU8
+# dudect/timer.c:57:     timer_active = backend;
+	.loc 1 57 18 is_stmt 0 view .LVU9
+	movl	%ebx, timer_active(%rip)	# backend, timer_active
+# dudect/timer.c:58: }
+	.loc 1 58 1 view .LVU10
+	addq	$136, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL2:
+	.loc 1 58 1 view .LVU11
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL3:
+.L10:
+	.cfi_restore_state
+	.loc 1 47 9 is_stmt 1 view .LVU12
+	movl	$1, %edx	#,
+	movl	%ebx, %esi	# backend,
+	leaq	.LC0(%rip), %rdi	#, tmp98
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL4:
+	.loc 1 48 9 view .LVU13
+	.loc 1 50 5 view .LVU14
+# dudect/timer.c:48:         backend = TIMER_LFENCE;
+	.loc 1 48 17 is_stmt 0 view .LVU15
+	movl	$1, %ebx	#, backend
+	jmp	.L3	#
+.LVL5:
+.L11:
+.LBB6:
+.LBI6:
+	.loc 1 17 13 is_stmt 1 view .LVU16
+.LBB7:
+	.loc 1 19 5 view .LVU17
+# dudect/timer.c:20:                                               : PERF_COUNT_HW_INSTRUCTIONS;
+	.loc 1 20 47 is_stmt 0 view .LVU18
+	cmpl	$3, %ebx	#, backend
+	setne	%bpl	#, _19
+# dudect/timer.c:19:     int config = backend == TIMER_PERF_CYCLES ? PERF_COUNT_HW_CPU_CYCLES
+	.loc 1 19 9 view .LVU19
+	setne	%r12b	#, config
+	movzbl	%r12b, %r12d	# config, config
+.LVL6:
+	.loc 1 21 5 is_stmt 1 view .LVU20
+# dudect/timer.c:21:     if (perf_fd >= 0 && perf_pid == getpid() && perf_config == config)
+	.loc 1 21 17 is_stmt 0 view .LVU21
+	movl	perf_fd(%rip), %r13d	# perf_fd, perf_fd.2_21
+# dudect/timer.c:21:     if (perf_fd >= 0 && perf_pid == getpid() && perf_config == config)
+	.loc 1 21 8 view .LVU22
+	testl	%r13d, %r13d	# perf_fd.2_21
+	jns	.L12	#,
+.L4:
+	.loc 1 26 5 is_stmt 1 view .LVU23
+	.loc 1 27 5 view .LVU24
+	movq	%rsp, %rsi	#, tmp101
+	movl	$16, %ecx	#, tmp104
+	movl	$0, %eax	#, tmp103
+	movq	%rsi, %rdi	# tmp101, tmp102
+	rep stosq
+	.loc 1 28 5 view .LVU25
+	.loc 1 29 5 view .LVU26
+# dudect/timer.c:29:     attr.size = sizeof(attr);
+	.loc 1 29 15 is_stmt 0 view .LVU27
+	movl	$128, 4(%rsp)	#, attr.size
+	.loc 1 30 5 is_stmt 1 view .LVU28
+# dudect/timer.c:30:     attr.config = config;
+	.loc 1 30 17 is_stmt 0 view .LVU29
+	movzbl	%bpl, %ebp	# _19, _19
+	movq	%rbp, 8(%rsp)	# _19, attr.config
+	.loc 1 31 5 is_stmt 1 view .LVU30
+	.loc 1 32 5 view .LVU31
+# dudect/timer.c:32:     attr.exclude_hv = 1;
+	.loc 1 32 21 is_stmt 0 view .LVU32
+	movb	$96, 40(%rsp)	#, attr.exclude_hv
+	.loc 1 34 5 is_stmt 1 view .LVU33
+# dudect/timer.c:34:     perf_fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	.loc 1 34 15 is_stmt 0 view .LVU34
+	movl	$0, %r9d	#,
+	movl	$-1, %r8d	#,
+	movl	$-1, %ecx	#,
+	movl	$0, %edx	#,
+	movl	$298, %edi	#,
+	call	syscall@PLT	#
+.LVL7:
+# dudect/timer.c:34:     perf_fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	.loc 1 34 13 view .LVU35
+	movl	%eax, %ebp	# _27, _28
+	movl	%eax, perf_fd(%rip)	# _27, perf_fd
+	.loc 1 35 5 is_stmt 1 view .LVU36
+# dudect/timer.c:35:     if (perf_fd < 0)
+	.loc 1 35 8 is_stmt 0 view .LVU37
+	testl	%eax, %eax	# _27
+	js	.L7	#,
+	.loc 1 37 5 is_stmt 1 view .LVU38
+# dudect/timer.c:37:     perf_pid = getpid();
+	.loc 1 37 16 is_stmt 0 view .LVU39
+	call	getpid@PLT	#
+.LVL8:
+# dudect/timer.c:37:     perf_pid = getpid();
+	.loc 1 37 14 view .LVU40
+	movl	%eax, perf_pid(%rip)	# tmp120, perf_pid
+	.loc 1 38 5 is_stmt 1 view .LVU41
+# dudect/timer.c:38:     perf_config = config;
+	.loc 1 38 17 is_stmt 0 view .LVU42
+	movl	%r12d, perf_config(%rip)	# config, perf_config
+	.loc 1 39 5 is_stmt 1 view .LVU43
+	movl	$0, %edx	#,
+	movl	$9216, %esi	#,
+	movl	%ebp, %edi	# _28,
+	movl	$0, %eax	#,
+	call	ioctl@PLT	#
+.LVL9:
+	.loc 1 40 5 view .LVU44
+# dudect/timer.c:40:     return true;
+	.loc 1 40 12 is_stmt 0 view .LVU45
+	jmp	.L3	#
+.L12:
+# dudect/timer.c:21:     if (perf_fd >= 0 && perf_pid == getpid() && perf_config == config)
+	.loc 1 21 37 view .LVU46
+	call	getpid@PLT	#
+.LVL10:
+# dudect/timer.c:21:     if (perf_fd >= 0 && perf_pid == getpid() && perf_config == config)
+	.loc 1 21 22 view .LVU47
+	cmpl	perf_pid(%rip), %eax	# perf_pid, tmp118
+	je	.L13	#,
+.L5:
+	.loc 1 23 5 is_stmt 1 view .LVU48
+	.loc 1 24 9 view .LVU49
+	movl	%r13d, %edi	# perf_fd.2_21,
+	call	close@PLT	#
+.LVL11:
+	jmp	.L4	#
+.L13:
+# dudect/timer.c:21:     if (perf_fd >= 0 && perf_pid == getpid() && perf_config == config)
+	.loc 1 21 46 is_stmt 0 view .LVU50
+	cmpl	perf_config(%rip), %r12d	# perf_config, config
+	jne	.L5	#,
+	jmp	.L3	#
+.L7:
+.LVL12:
+	.loc 1 21 46 view .LVU51
+.LBE7:
+.LBE6:
+	.loc 1 53 9 is_stmt 1 view .LVU52
+# dudect/timer.c:54:                strerror(errno), TIMER_LFENCE);
+	.loc 1 54 25 is_stmt 0 view .LVU53
+	call	__errno_location@PLT	#
+.LVL13:
+# dudect/timer.c:53:         printf("Hardware counters unavailable (%s), using timer %d\n",
+	.loc 1 53 9 view .LVU54
+	movl	(%rax), %edi	# *_5, *_5
+	call	strerror@PLT	#
+.LVL14:
+	movq	%rax, %rsi	# tmp122, _7
+	movl	$1, %edx	#,
+	leaq	.LC1(%rip), %rdi	#, tmp116
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL15:
+	.loc 1 55 9 is_stmt 1 view .LVU55
+# dudect/timer.c:55:         backend = TIMER_LFENCE;
+	.loc 1 55 17 is_stmt 0 view .LVU56
+	movl	$1, %ebx	#, backend
+	jmp	.L3	#
+	.cfi_endproc
+.LFE46:
+	.size	timer_setup, .-timer_setup
+	.section	.rodata.str1.1
+.LC2:
+	.string	"short read"
+	.section	.rodata.str1.8
+	.align 8
+.LC3:
+	.string	"Cannot read hardware counter (%s), using timer %d\n"
+	.text
+	.globl	perf_read
+	.type	perf_read, @function
+perf_read:
+.LFB47:
+	.loc 1 61 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$16, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 62 5 view .LVU58
+# dudect/timer.c:62:     uint64_t count = 0;
+	.loc 1 62 14 is_stmt 0 view .LVU59
+	movq	$0, 8(%rsp)	#, count
+# dudect/timer.c:65:         n = read(perf_fd, &count, sizeof(count));
+	.loc 1 65 13 view .LVU60
+	leaq	8(%rsp), %rbx	#, tmp97
+.L16:
+	.loc 1 63 5 is_stmt 1 discriminator 2 view .LVU61
+	.loc 1 64 5 discriminator 2 view .LVU62
+	.loc 1 65 9 discriminator 2 view .LVU63
+# dudect/timer.c:65:         n = read(perf_fd, &count, sizeof(count));
+	.loc 1 65 13 is_stmt 0 discriminator 2 view .LVU64
+	movl	$8, %edx	#,
+	movq	%rbx, %rsi	# tmp97,
+	movl	perf_fd(%rip), %edi	# perf_fd,
+	call	read@PLT	#
+.LVL16:
+	.loc 1 66 18 is_stmt 1 discriminator 2 view .LVU65
+	testq	%rax, %rax	# n
+	jns	.L15	#,
+# dudect/timer.c:66:     while (n < 0 && errno == EINTR);
+	.loc 1 66 21 is_stmt 0 discriminator 1 view .LVU66
+	call	__errno_location@PLT	#
+.LVL17:
+# dudect/timer.c:66:     while (n < 0 && errno == EINTR);
+	.loc 1 66 18 discriminator 1 view .LVU67
+	cmpl	$4, (%rax)	#, *_2
+	je	.L16	#,
+	.loc 1 67 5 is_stmt 1 view .LVU68
+# dudect/timer.c:70:                n < 0 ? strerror(errno) : "short read", TIMER_LFENCE);
+	.loc 1 70 33 is_stmt 0 view .LVU69
+	call	__errno_location@PLT	#
+.LVL18:
+# dudect/timer.c:70:                n < 0 ? strerror(errno) : "short read", TIMER_LFENCE);
+	.loc 1 70 24 view .LVU70
+	movl	(%rax), %edi	# *_4, *_4
+	call	strerror@PLT	#
+.LVL19:
+	movq	%rax, %rsi	# tmp111, iftmp.10_8
+	jmp	.L19	#
+.LVL20:
+.L26:
+# dudect/timer.c:69:         printf("Cannot read hardware counter (%s), using timer %d\n",
+	.loc 1 69 9 view .LVU71
+	leaq	.LC2(%rip), %rsi	#, iftmp.10_8
+.LVL21:
+.L19:
+# dudect/timer.c:69:         printf("Cannot read hardware counter (%s), using timer %d\n",
+	.loc 1 69 9 discriminator 2 view .LVU72
+	movl	$1, %edx	#,
+	leaq	.LC3(%rip), %rdi	#, tmp99
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL22:
+	.loc 1 71 9 is_stmt 1 discriminator 2 view .LVU73
+	movl	perf_fd(%rip), %edi	# perf_fd,
+	call	close@PLT	#
+.LVL23:
+	.loc 1 72 9 discriminator 2 view .LVU74
+# dudect/timer.c:72:         perf_fd = -1;
+	.loc 1 72 17 is_stmt 0 discriminator 2 view .LVU75
+	movl	$-1, perf_fd(%rip)	#, perf_fd
+	.loc 1 73 9 is_stmt 1 discriminator 2 view .LVU76
+# dudect/timer.c:73:         timer_active = TIMER_LFENCE;
+	.loc 1 73 22 is_stmt 0 discriminator 2 view .LVU77
+	movl	$1, timer_active(%rip)	#, timer_active
+	.loc 1 74 9 is_stmt 1 discriminator 2 view .LVU78
+.LBB8:
+.LBI8:
+	.file 2 "dudect/cpucycles.h"
+	.loc 2 19 23 discriminator 2 view .LVU79
+.LBB9:
+	.loc 2 22 5 discriminator 2 view .LVU80
+	.loc 2 23 5 discriminator 2 view .LVU81
+#APP
+# 23 "dudect/cpucycles.h" 1
+	lfence
+	rdtsc
+	lfence
+	
+# 0 "" 2
+.LVL24:
+	.loc 2 25 5 discriminator 2 view .LVU82
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 25 45 is_stmt 0 discriminator 2 view .LVU83
+#NO_APP
+	salq	$32, %rdx	#, tmp104
+.LVL25:
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 25 13 discriminator 2 view .LVU84
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:25:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 25 27 discriminator 2 view .LVU85
+	orq	%rdx, %rax	# tmp104, <retval>
+.LVL26:
+.L14:
+	.loc 2 25 27 discriminator 2 view .LVU86
+.LBE9:
+.LBE8:
+# dudect/timer.c:77: }
+	.loc 1 77 1 view .LVU87
+	addq	$16, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL27:
+.L15:
+	.cfi_restore_state
+	.loc 1 67 5 is_stmt 1 view .LVU88
+# dudect/timer.c:67:     if (n != sizeof(count)) {
+	.loc 1 67 8 is_stmt 0 view .LVU89
+	cmpq	$8, %rax	#, n
+	jne	.L26	#,
+	.loc 1 76 5 is_stmt 1 view .LVU90
+# dudect/timer.c:76:     return (int64_t) count;
+	.loc 1 76 12 is_stmt 0 view .LVU91
+	movq	8(%rsp), %rax	# count, <retval>
+.LVL28:
+	.loc 1 76 12 view .LVU92
+	jmp	.L14	#
+	.cfi_endproc
+.LFE47:
+	.size	perf_read, .-perf_read
+	.data
+	.align 4
+	.type	perf_config, @object
+	.size	perf_config, 4
+perf_config:
+	.long	-1
+	.local	perf_pid
+	.comm	perf_pid,4,4
+	.align 4
+	.type	perf_fd, @object
+	.size	perf_fd, 4
+perf_fd:
+	.long	-1
+	.globl	timer_active
+	.bss
+	.align 4
+	.type	timer_active, @object
+	.size	timer_active, 4
+timer_active:
+	.zero	4
+	.text
+.Letext0:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "dudect/timer.h"
+	.file 7 "/usr/include/asm-generic/int-ll64.h"
+	.file 8 "/usr/include/linux/perf_event.h"
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 10 "/usr/include/stdio.h"
+	.file 11 "/usr/include/unistd.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/sys/ioctl.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xa47
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF157
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x6b
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x5
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x5
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x9a
+	.byte	0x19
+	.long	0x58
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x6b
+	.uleb128 0xf
+	.long	0x9d
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x1c
+	.long	0x9d
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0x5
+	.long	.LASF15
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x1d
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0x6
+	.byte	0x9
+	.byte	0x6
+	.long	0xf4
+	.uleb128 0x1
+	.long	.LASF16
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF19
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF21
+	.byte	0x5
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF22
+	.byte	0x13
+	.long	0x58
+	.uleb128 0x13
+	.long	.LASF23
+	.byte	0x16
+	.long	0x58
+	.uleb128 0x5
+	.long	.LASF24
+	.byte	0x7
+	.byte	0x18
+	.byte	0x18
+	.long	0x35
+	.uleb128 0x5
+	.long	.LASF25
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x18
+	.long	0x58
+	.uleb128 0x5
+	.long	.LASF26
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF27
+	.uleb128 0x5
+	.long	.LASF28
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x2a
+	.long	0x13f
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF29
+	.uleb128 0x10
+	.long	.LASF37
+	.long	0x3c
+	.byte	0x1d
+	.long	0x17f
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x6
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF38
+	.long	0x3c
+	.byte	0x3c
+	.long	0x1d0
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF50
+	.long	0x3c
+	.byte	0xb4
+	.long	0x257
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x13
+	.byte	0
+	.uleb128 0xc
+	.byte	0x8
+	.value	0x191
+	.long	0x276
+	.uleb128 0x6
+	.long	.LASF71
+	.value	0x192
+	.long	0x133
+	.uleb128 0x6
+	.long	.LASF72
+	.value	0x193
+	.long	0x133
+	.byte	0
+	.uleb128 0xc
+	.byte	0x4
+	.value	0x1cc
+	.long	0x295
+	.uleb128 0x6
+	.long	.LASF73
+	.value	0x1cd
+	.long	0x120
+	.uleb128 0x6
+	.long	.LASF74
+	.value	0x1ce
+	.long	0x120
+	.byte	0
+	.uleb128 0xc
+	.byte	0x8
+	.value	0x1d2
+	.long	0x2ca
+	.uleb128 0x6
+	.long	.LASF75
+	.value	0x1d3
+	.long	0x133
+	.uleb128 0x6
+	.long	.LASF76
+	.value	0x1d4
+	.long	0x133
+	.uleb128 0x6
+	.long	.LASF77
+	.value	0x1d5
+	.long	0x133
+	.uleb128 0x6
+	.long	.LASF78
+	.value	0x1d6
+	.long	0x133
+	.byte	0
+	.uleb128 0xc
+	.byte	0x8
+	.value	0x1d8
+	.long	0x2ff
+	.uleb128 0x6
+	.long	.LASF79
+	.value	0x1d9
+	.long	0x133
+	.uleb128 0x6
+	.long	.LASF80
+	.value	0x1da
+	.long	0x133
+	.uleb128 0x6
+	.long	.LASF81
+	.value	0x1db
+	.long	0x133
+	.uleb128 0x6
+	.long	.LASF82
+	.value	0x1dc
+	.long	0x133
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF158
+	.byte	0x80
+	.byte	0x8
+	.value	0x180
+	.byte	0x8
+	.long	0x63d
+	.uleb128 0x4
+	.long	.LASF83
+	.value	0x185
+	.byte	0xa
+	.long	0x120
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF84
+	.value	0x18a
+	.byte	0xa
+	.long	0x120
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF85
+	.value	0x18f
+	.byte	0xa
+	.long	0x133
+	.byte	0x8
+	.uleb128 0xd
+	.long	0x257
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF86
+	.value	0x196
+	.byte	0xa
+	.long	0x133
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF87
+	.value	0x197
+	.byte	0xa
+	.long	0x133
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF88
+	.value	0x199
+	.byte	0xa
+	.long	0x133
+	.byte	0x1
+	.value	0x140
+	.uleb128 0x2
+	.long	.LASF89
+	.value	0x19a
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x141
+	.uleb128 0x2
+	.long	.LASF90
+	.value	0x19b
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x142
+	.uleb128 0x2
+	.long	.LASF91
+	.value	0x19c
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x143
+	.uleb128 0x2
+	.long	.LASF92
+	.value	0x19d
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x144
+	.uleb128 0x2
+	.long	.LASF93
+	.value	0x19e
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x145
+	.uleb128 0x2
+	.long	.LASF94
+	.value	0x19f
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x146
+	.uleb128 0x2
+	.long	.LASF95
+	.value	0x1a0
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x147
+	.uleb128 0x2
+	.long	.LASF96
+	.value	0x1a1
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x148
+	.uleb128 0x2
+	.long	.LASF97
+	.value	0x1a2
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x149
+	.uleb128 0x2
+	.long	.LASF98
+	.value	0x1a3
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x14a
+	.uleb128 0x2
+	.long	.LASF99
+	.value	0x1a4
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x14b
+	.uleb128 0x2
+	.long	.LASF100
+	.value	0x1a5
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x14c
+	.uleb128 0x2
+	.long	.LASF101
+	.value	0x1a6
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x14d
+	.uleb128 0x2
+	.long	.LASF102
+	.value	0x1a7
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x14e
+	.uleb128 0x2
+	.long	.LASF103
+	.value	0x1b2
+	.byte	0x5
+	.long	0x133
+	.byte	0x2
+	.value	0x14f
+	.uleb128 0x2
+	.long	.LASF104
+	.value	0x1b3
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x151
+	.uleb128 0x2
+	.long	.LASF105
+	.value	0x1b4
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x152
+	.uleb128 0x2
+	.long	.LASF106
+	.value	0x1b6
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x153
+	.uleb128 0x2
+	.long	.LASF107
+	.value	0x1b7
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x154
+	.uleb128 0x2
+	.long	.LASF108
+	.value	0x1b9
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x155
+	.uleb128 0x2
+	.long	.LASF109
+	.value	0x1ba
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x156
+	.uleb128 0x2
+	.long	.LASF110
+	.value	0x1bb
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x157
+	.uleb128 0x2
+	.long	.LASF111
+	.value	0x1bc
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x158
+	.uleb128 0x2
+	.long	.LASF112
+	.value	0x1bd
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x159
+	.uleb128 0x2
+	.long	.LASF113
+	.value	0x1be
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x15a
+	.uleb128 0x2
+	.long	.LASF114
+	.value	0x1bf
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x15b
+	.uleb128 0x2
+	.long	.LASF115
+	.value	0x1c0
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x15c
+	.uleb128 0x2
+	.long	.LASF116
+	.value	0x1c1
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x15d
+	.uleb128 0x2
+	.long	.LASF117
+	.value	0x1c2
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x15e
+	.uleb128 0x2
+	.long	.LASF118
+	.value	0x1c3
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x15f
+	.uleb128 0x2
+	.long	.LASF119
+	.value	0x1c4
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x160
+	.uleb128 0x2
+	.long	.LASF120
+	.value	0x1c5
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x161
+	.uleb128 0x2
+	.long	.LASF121
+	.value	0x1c6
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x162
+	.uleb128 0x2
+	.long	.LASF122
+	.value	0x1c7
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x163
+	.uleb128 0x2
+	.long	.LASF123
+	.value	0x1c8
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x164
+	.uleb128 0x2
+	.long	.LASF124
+	.value	0x1c9
+	.byte	0x5
+	.long	0x133
+	.byte	0x1
+	.value	0x165
+	.uleb128 0x2
+	.long	.LASF125
+	.value	0x1ca
+	.byte	0x5
+	.long	0x133
+	.byte	0x1a
+	.value	0x166
+	.uleb128 0xd
+	.long	0x276
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF126
+	.value	0x1d1
+	.byte	0xa
+	.long	0x120
+	.byte	0x34
+	.uleb128 0xd
+	.long	0x295
+	.byte	0x38
+	.uleb128 0xd
+	.long	0x2ca
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF127
+	.value	0x1de
+	.byte	0x8
+	.long	0x133
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF128
+	.value	0x1e4
+	.byte	0x8
+	.long	0x133
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF129
+	.value	0x1e9
+	.byte	0x8
+	.long	0x120
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF130
+	.value	0x1eb
+	.byte	0x8
+	.long	0x114
+	.byte	0x5c
+	.uleb128 0x4
+	.long	.LASF131
+	.value	0x1f4
+	.byte	0x8
+	.long	0x133
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF132
+	.value	0x1f9
+	.byte	0x8
+	.long	0x120
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF133
+	.value	0x1fa
+	.byte	0x8
+	.long	0x108
+	.byte	0x6c
+	.uleb128 0x4
+	.long	.LASF134
+	.value	0x1fb
+	.byte	0x8
+	.long	0x108
+	.byte	0x6e
+	.uleb128 0x4
+	.long	.LASF135
+	.value	0x1fc
+	.byte	0x8
+	.long	0x120
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF136
+	.value	0x1fd
+	.byte	0x8
+	.long	0x120
+	.byte	0x74
+	.uleb128 0x4
+	.long	.LASF137
+	.value	0x205
+	.byte	0x8
+	.long	0x133
+	.byte	0x78
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF138
+	.byte	0x9
+	.byte	0xd6
+	.byte	0x17
+	.long	0x43
+	.uleb128 0x5
+	.long	.LASF139
+	.byte	0xa
+	.byte	0x4d
+	.byte	0x13
+	.long	0x8c
+	.uleb128 0xf
+	.long	0xa4
+	.uleb128 0x1f
+	.long	.LASF140
+	.byte	0xb
+	.value	0x104
+	.byte	0x11
+	.long	0x7e
+	.uleb128 0x20
+	.long	0xfe
+	.byte	0x1
+	.byte	0xa
+	.byte	0x5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timer_active
+	.uleb128 0xe
+	.long	.LASF141
+	.byte	0xd
+	.byte	0xc
+	.long	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	perf_fd
+	.uleb128 0xe
+	.long	.LASF142
+	.byte	0xe
+	.byte	0xe
+	.long	0x65a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	perf_pid
+	.uleb128 0xe
+	.long	.LASF143
+	.byte	0xf
+	.byte	0xc
+	.long	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	perf_config
+	.uleb128 0xa
+	.long	.LASF144
+	.byte	0xb
+	.value	0x173
+	.byte	0x10
+	.long	0x649
+	.long	0x6d9
+	.uleb128 0x7
+	.long	0x58
+	.uleb128 0x7
+	.long	0x8a
+	.uleb128 0x7
+	.long	0x63d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF145
+	.byte	0xc
+	.byte	0x2a
+	.byte	0xc
+	.long	0x58
+	.long	0x6f5
+	.uleb128 0x7
+	.long	0x58
+	.uleb128 0x7
+	.long	0x43
+	.uleb128 0x11
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF146
+	.byte	0xb
+	.value	0x443
+	.byte	0x11
+	.long	0x6b
+	.long	0x70d
+	.uleb128 0x7
+	.long	0x6b
+	.uleb128 0x11
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF147
+	.byte	0xd
+	.byte	0x3d
+	.byte	0xe
+	.long	0x8a
+	.long	0x72d
+	.uleb128 0x7
+	.long	0x8a
+	.uleb128 0x7
+	.long	0x58
+	.uleb128 0x7
+	.long	0x63d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF148
+	.byte	0xb
+	.value	0x166
+	.byte	0xc
+	.long	0x58
+	.long	0x744
+	.uleb128 0x7
+	.long	0x58
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF150
+	.byte	0xb
+	.value	0x28a
+	.byte	0x10
+	.long	0x7e
+	.uleb128 0xa
+	.long	.LASF149
+	.byte	0xd
+	.value	0x1a3
+	.byte	0xe
+	.long	0x98
+	.long	0x768
+	.uleb128 0x7
+	.long	0x58
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF151
+	.byte	0xe
+	.byte	0x25
+	.byte	0xd
+	.long	0x774
+	.uleb128 0xf
+	.long	0x58
+	.uleb128 0xa
+	.long	.LASF152
+	.byte	0xa
+	.value	0x164
+	.byte	0xc
+	.long	0x58
+	.long	0x791
+	.uleb128 0x7
+	.long	0x655
+	.uleb128 0x11
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF159
+	.byte	0x1
+	.byte	0x3c
+	.byte	0x9
+	.long	0xa9
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x888
+	.uleb128 0xe
+	.long	.LASF153
+	.byte	0x3e
+	.byte	0xe
+	.long	0xb5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x24
+	.string	"n"
+	.byte	0x1
+	.byte	0x3f
+	.byte	0xd
+	.long	0x649
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x15
+	.long	0xa2a
+	.quad	.LBI8
+	.byte	.LVU79
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.byte	0x4a
+	.byte	0x10
+	.long	0x812
+	.uleb128 0x12
+	.long	0xa37
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x12
+	.long	0xa40
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL16
+	.long	0x6b8
+	.long	0x82f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL17
+	.long	0x768
+	.uleb128 0x9
+	.quad	.LVL18
+	.long	0x768
+	.uleb128 0x9
+	.quad	.LVL19
+	.long	0x751
+	.uleb128 0xb
+	.quad	.LVL22
+	.long	0x779
+	.long	0x87a
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL23
+	.long	0x72d
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF160
+	.byte	0x1
+	.byte	0x2b
+	.byte	0x6
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9ef
+	.uleb128 0x26
+	.long	.LASF154
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x9
+	.long	0x58
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x15
+	.long	0x9ef
+	.quad	.LBI6
+	.byte	.LVU16
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.byte	0x34
+	.byte	0xa
+	.long	0x98a
+	.uleb128 0x27
+	.long	0xa00
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x12
+	.long	0xa0c
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x28
+	.long	0xa17
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0xb
+	.quad	.LVL7
+	.long	0x6f5
+	.long	0x937
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12a
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL8
+	.long	0x744
+	.uleb128 0xb
+	.quad	.LVL9
+	.long	0x6d9
+	.long	0x968
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x2400
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL10
+	.long	0x744
+	.uleb128 0x16
+	.quad	.LVL11
+	.long	0x72d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL4
+	.long	0x779
+	.long	0x9b4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL13
+	.long	0x768
+	.uleb128 0x9
+	.quad	.LVL14
+	.long	0x751
+	.uleb128 0x16
+	.quad	.LVL15
+	.long	0x779
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF161
+	.byte	0x1
+	.byte	0x11
+	.byte	0xd
+	.long	0xa23
+	.byte	0x1
+	.long	0xa23
+	.uleb128 0x2a
+	.long	.LASF154
+	.byte	0x1
+	.byte	0x11
+	.byte	0x1b
+	.long	0x58
+	.uleb128 0x17
+	.long	.LASF85
+	.byte	0x13
+	.byte	0x9
+	.long	0x58
+	.uleb128 0x17
+	.long	.LASF155
+	.byte	0x1a
+	.byte	0x1c
+	.long	0x2ff
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF156
+	.uleb128 0x2b
+	.long	.LASF162
+	.byte	0x2
+	.byte	0x13
+	.byte	0x17
+	.long	0xa9
+	.byte	0x3
+	.uleb128 0x18
+	.string	"hi"
+	.byte	0x12
+	.long	0x3c
+	.uleb128 0x18
+	.string	"lo"
+	.byte	0x16
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0xd
+	.uleb128 0xb
+	.uleb128 0x6b
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS3:
+	.uleb128 .LVU65
+	.uleb128 .LVU67
+	.uleb128 .LVU71
+	.uleb128 .LVU72
+	.uleb128 .LVU88
+	.uleb128 .LVU92
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU82
+	.uleb128 .LVU86
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU3
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	timer_active
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU16
+	.uleb128 .LVU51
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU20
+	.uleb128 .LVU51
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF152:
+	.string	"printf"
+.LASF153:
+	.string	"count"
+.LASF104:
+	.string	"mmap_data"
+.LASF49:
+	.string	"PERF_COUNT_HW_MAX"
+.LASF138:
+	.string	"size_t"
+.LASF74:
+	.string	"wakeup_watermark"
+.LASF131:
+	.string	"sample_regs_intr"
+.LASF15:
+	.string	"uint64_t"
+.LASF91:
+	.string	"exclusive"
+.LASF148:
+	.string	"close"
+.LASF139:
+	.string	"ssize_t"
+.LASF116:
+	.string	"ksymbol"
+.LASF97:
+	.string	"comm"
+.LASF83:
+	.string	"type"
+.LASF53:
+	.string	"PERF_SAMPLE_BRANCH_HV_SHIFT"
+.LASF56:
+	.string	"PERF_SAMPLE_BRANCH_ANY_RETURN_SHIFT"
+.LASF47:
+	.string	"PERF_COUNT_HW_STALLED_CYCLES_BACKEND"
+.LASF87:
+	.string	"read_format"
+.LASF102:
+	.string	"watermark"
+.LASF120:
+	.string	"text_poke"
+.LASF42:
+	.string	"PERF_COUNT_HW_CACHE_MISSES"
+.LASF29:
+	.string	"long long unsigned int"
+.LASF24:
+	.string	"__u16"
+.LASF9:
+	.string	"__int64_t"
+.LASF65:
+	.string	"PERF_SAMPLE_BRANCH_NO_FLAGS_SHIFT"
+.LASF21:
+	.string	"TIMER_COUNT"
+.LASF142:
+	.string	"perf_pid"
+.LASF95:
+	.string	"exclude_idle"
+.LASF69:
+	.string	"PERF_SAMPLE_BRANCH_PRIV_SAVE_SHIFT"
+.LASF27:
+	.string	"long long int"
+.LASF6:
+	.string	"signed char"
+.LASF98:
+	.string	"freq"
+.LASF62:
+	.string	"PERF_SAMPLE_BRANCH_CALL_STACK_SHIFT"
+.LASF22:
+	.string	"timing_backend"
+.LASF73:
+	.string	"wakeup_events"
+.LASF92:
+	.string	"exclude_user"
+.LASF8:
+	.string	"long int"
+.LASF124:
+	.string	"sigtrap"
+.LASF43:
+	.string	"PERF_COUNT_HW_BRANCH_INSTRUCTIONS"
+.LASF33:
+	.string	"PERF_TYPE_HW_CACHE"
+.LASF12:
+	.string	"__ssize_t"
+.LASF137:
+	.string	"sig_data"
+.LASF96:
+	.string	"mmap"
+.LASF109:
+	.string	"exclude_callchain_user"
+.LASF37:
+	.string	"perf_type_id"
+.LASF32:
+	.string	"PERF_TYPE_TRACEPOINT"
+.LASF50:
+	.string	"perf_branch_sample_type_shift"
+.LASF110:
+	.string	"mmap2"
+.LASF119:
+	.string	"cgroup"
+.LASF78:
+	.string	"config1"
+.LASF82:
+	.string	"config2"
+.LASF40:
+	.string	"PERF_COUNT_HW_INSTRUCTIONS"
+.LASF108:
+	.string	"exclude_callchain_kernel"
+.LASF127:
+	.string	"branch_sample_type"
+.LASF36:
+	.string	"PERF_TYPE_MAX"
+.LASF155:
+	.string	"attr"
+.LASF20:
+	.string	"TIMER_PERF_INSTRUCTIONS"
+.LASF125:
+	.string	"__reserved_1"
+.LASF134:
+	.string	"__reserved_2"
+.LASF4:
+	.string	"unsigned int"
+.LASF79:
+	.string	"bp_len"
+.LASF88:
+	.string	"disabled"
+.LASF89:
+	.string	"inherit"
+.LASF86:
+	.string	"sample_type"
+.LASF5:
+	.string	"long unsigned int"
+.LASF26:
+	.string	"__u32"
+.LASF66:
+	.string	"PERF_SAMPLE_BRANCH_NO_CYCLES_SHIFT"
+.LASF30:
+	.string	"PERF_TYPE_HARDWARE"
+.LASF94:
+	.string	"exclude_hv"
+.LASF67:
+	.string	"PERF_SAMPLE_BRANCH_TYPE_SAVE_SHIFT"
+.LASF18:
+	.string	"TIMER_RDTSCP"
+.LASF84:
+	.string	"size"
+.LASF3:
+	.string	"short unsigned int"
+.LASF34:
+	.string	"PERF_TYPE_RAW"
+.LASF60:
+	.string	"PERF_SAMPLE_BRANCH_NO_TX_SHIFT"
+.LASF81:
+	.string	"probe_offset"
+.LASF160:
+	.string	"timer_setup"
+.LASF23:
+	.string	"timer_active"
+.LASF113:
+	.string	"context_switch"
+.LASF141:
+	.string	"perf_fd"
+.LASF19:
+	.string	"TIMER_PERF_CYCLES"
+.LASF126:
+	.string	"bp_type"
+.LASF39:
+	.string	"PERF_COUNT_HW_CPU_CYCLES"
+.LASF133:
+	.string	"sample_max_stack"
+.LASF154:
+	.string	"backend"
+.LASF64:
+	.string	"PERF_SAMPLE_BRANCH_CALL_SHIFT"
+.LASF122:
+	.string	"inherit_thread"
+.LASF129:
+	.string	"sample_stack_user"
+.LASF111:
+	.string	"comm_exec"
+.LASF123:
+	.string	"remove_on_exec"
+.LASF76:
+	.string	"kprobe_func"
+.LASF93:
+	.string	"exclude_kernel"
+.LASF52:
+	.string	"PERF_SAMPLE_BRANCH_KERNEL_SHIFT"
+.LASF157:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF31:
+	.string	"PERF_TYPE_SOFTWARE"
+.LASF71:
+	.string	"sample_period"
+.LASF59:
+	.string	"PERF_SAMPLE_BRANCH_IN_TX_SHIFT"
+.LASF16:
+	.string	"TIMER_RDTSC"
+.LASF63:
+	.string	"PERF_SAMPLE_BRANCH_IND_JUMP_SHIFT"
+.LASF130:
+	.string	"clockid"
+.LASF121:
+	.string	"build_id"
+.LASF10:
+	.string	"__uint64_t"
+.LASF48:
+	.string	"PERF_COUNT_HW_REF_CPU_CYCLES"
+.LASF44:
+	.string	"PERF_COUNT_HW_BRANCH_MISSES"
+.LASF105:
+	.string	"sample_id_all"
+.LASF146:
+	.string	"syscall"
+.LASF75:
+	.string	"bp_addr"
+.LASF156:
+	.string	"_Bool"
+.LASF161:
+	.string	"perf_open"
+.LASF2:
+	.string	"unsigned char"
+.LASF41:
+	.string	"PERF_COUNT_HW_CACHE_REFERENCES"
+.LASF77:
+	.string	"uprobe_path"
+.LASF158:
+	.string	"perf_event_attr"
+.LASF115:
+	.string	"namespaces"
+.LASF11:
+	.string	"__pid_t"
+.LASF114:
+	.string	"write_backward"
+.LASF7:
+	.string	"short int"
+.LASF17:
+	.string	"TIMER_LFENCE"
+.LASF51:
+	.string	"PERF_SAMPLE_BRANCH_USER_SHIFT"
+.LASF25:
+	.string	"__s32"
+.LASF112:
+	.string	"use_clockid"
+.LASF107:
+	.string	"exclude_guest"
+.LASF72:
+	.string	"sample_freq"
+.LASF132:
+	.string	"aux_watermark"
+.LASF28:
+	.string	"__u64"
+.LASF159:
+	.string	"perf_read"
+.LASF13:
+	.string	"char"
+.LASF85:
+	.string	"config"
+.LASF46:
+	.string	"PERF_COUNT_HW_STALLED_CYCLES_FRONTEND"
+.LASF117:
+	.string	"bpf_event"
+.LASF55:
+	.string	"PERF_SAMPLE_BRANCH_ANY_CALL_SHIFT"
+.LASF38:
+	.string	"perf_hw_id"
+.LASF57:
+	.string	"PERF_SAMPLE_BRANCH_IND_CALL_SHIFT"
+.LASF151:
+	.string	"__errno_location"
+.LASF150:
+	.string	"getpid"
+.LASF145:
+	.string	"ioctl"
+.LASF90:
+	.string	"pinned"
+.LASF101:
+	.string	"task"
+.LASF58:
+	.string	"PERF_SAMPLE_BRANCH_ABORT_TX_SHIFT"
+.LASF128:
+	.string	"sample_regs_user"
+.LASF80:
+	.string	"kprobe_addr"
+.LASF61:
+	.string	"PERF_SAMPLE_BRANCH_COND_SHIFT"
+.LASF103:
+	.string	"precise_ip"
+.LASF147:
+	.string	"memset"
+.LASF35:
+	.string	"PERF_TYPE_BREAKPOINT"
+.LASF143:
+	.string	"perf_config"
+.LASF70:
+	.string	"PERF_SAMPLE_BRANCH_MAX_SHIFT"
+.LASF118:
+	.string	"aux_output"
+.LASF162:
+	.string	"cpucycles_lfence"
+.LASF45:
+	.string	"PERF_COUNT_HW_BUS_CYCLES"
+.LASF144:
+	.string	"read"
+.LASF140:
+	.string	"pid_t"
+.LASF68:
+	.string	"PERF_SAMPLE_BRANCH_HW_INDEX_SHIFT"
+.LASF14:
+	.string	"int64_t"
+.LASF135:
+	.string	"aux_sample_size"
+.LASF149:
+	.string	"strerror"
+.LASF136:
+	.string	"__reserved_3"
+.LASF99:
+	.string	"inherit_stat"
+.LASF54:
+	.string	"PERF_SAMPLE_BRANCH_ANY_SHIFT"
+.LASF106:
+	.string	"exclude_host"
+.LASF100:
+	.string	"enable_on_exec"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"dudect/timer.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1954 @@
+	.file	"ttest.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "dudect/ttest.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"dudect/ttest.c"
+.LC1:
+	.string	"class == 0 || class == 1"
+	.text
+	.globl	t_push
+	.type	t_push, @function
+t_push:
+.LVL0:
+.LFB22:
+	.file 1 "dudect/ttest.c"
+	.loc 1 20 1 view -0
+	.cfi_startproc
+	.loc 1 21 5 view .LVU1
+	cmpb	$1, %sil	#, class
+	ja	.L6	#,
+	.loc 1 22 5 view .LVU2
+	movzbl	%sil, %esi	# class, class
+	.loc 1 22 5 is_stmt 0 view .LVU3
+	leaq	(%rdi,%rsi,8), %rax	#, _22
+# dudect/ttest.c:22:     ctx->n[class]++;
+	.loc 1 22 18 view .LVU4
+	movsd	.LC2(%rip), %xmm2	#, tmp105
+	addsd	32(%rax), %xmm2	# MEM <double> [(struct t_ctx *)_22 + 32B], _3
+	movsd	%xmm2, 32(%rax)	# _3, MEM <double> [(struct t_ctx *)_22 + 32B]
+	.loc 1 26 5 is_stmt 1 view .LVU5
+# dudect/ttest.c:26:     double delta = x - ctx->mean[class];
+	.loc 1 26 33 is_stmt 0 view .LVU6
+	movsd	(%rax), %xmm4	# MEM <double> [(struct t_ctx *)_22], _4
+# dudect/ttest.c:26:     double delta = x - ctx->mean[class];
+	.loc 1 26 12 view .LVU7
+	movapd	%xmm0, %xmm3	# x, delta
+	subsd	%xmm4, %xmm3	# _4, delta
+.LVL1:
+	.loc 1 27 5 is_stmt 1 view .LVU8
+# dudect/ttest.c:27:     ctx->mean[class] = ctx->mean[class] + delta / ctx->n[class];
+	.loc 1 27 49 is_stmt 0 view .LVU9
+	movapd	%xmm3, %xmm1	# delta, tmp106
+	divsd	%xmm2, %xmm1	# _3, tmp106
+# dudect/ttest.c:27:     ctx->mean[class] = ctx->mean[class] + delta / ctx->n[class];
+	.loc 1 27 41 view .LVU10
+	addsd	%xmm4, %xmm1	# _4, _6
+# dudect/ttest.c:27:     ctx->mean[class] = ctx->mean[class] + delta / ctx->n[class];
+	.loc 1 27 22 view .LVU11
+	movsd	%xmm1, (%rax)	# _6, MEM <double> [(struct t_ctx *)_22]
+	.loc 1 28 5 is_stmt 1 view .LVU12
+# dudect/ttest.c:28:     ctx->m2[class] = ctx->m2[class] + delta * (x - ctx->mean[class]);
+	.loc 1 28 50 is_stmt 0 view .LVU13
+	subsd	%xmm1, %xmm0	# _6, tmp107
+.LVL2:
+# dudect/ttest.c:28:     ctx->m2[class] = ctx->m2[class] + delta * (x - ctx->mean[class]);
+	.loc 1 28 45 view .LVU14
+	mulsd	%xmm3, %xmm0	# delta, tmp108
+# dudect/ttest.c:28:     ctx->m2[class] = ctx->m2[class] + delta * (x - ctx->mean[class]);
+	.loc 1 28 37 view .LVU15
+	addsd	16(%rax), %xmm0	# MEM <double> [(struct t_ctx *)_22 + 16B], tmp109
+# dudect/ttest.c:28:     ctx->m2[class] = ctx->m2[class] + delta * (x - ctx->mean[class]);
+	.loc 1 28 20 view .LVU16
+	movsd	%xmm0, 16(%rax)	# tmp109, MEM <double> [(struct t_ctx *)_22 + 16B]
+	ret	
+.LVL3:
+.L6:
+# dudect/ttest.c:20: {
+	.loc 1 20 1 discriminator 1 view .LVU17
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 21 5 is_stmt 1 discriminator 1 view .LVU18
+	leaq	__PRETTY_FUNCTION__.0(%rip), %rcx	#, tmp99
+	movl	$21, %edx	#,
+	leaq	.LC0(%rip), %rsi	#, tmp100
+.LVL4:
+	.loc 1 21 5 is_stmt 0 discriminator 1 view .LVU19
+	leaq	.LC1(%rip), %rdi	#, tmp101
+.LVL5:
+	.loc 1 21 5 discriminator 1 view .LVU20
+	call	__assert_fail@PLT	#
+.LVL6:
+	.loc 1 21 5 discriminator 1 view .LVU21
+	.cfi_endproc
+.LFE22:
+	.size	t_push, .-t_push
+	.globl	t_compute
+	.type	t_compute, @function
+t_compute:
+.LVL7:
+.LFB23:
+	.loc 1 32 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 32 1 is_stmt 0 view .LVU23
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 33 5 is_stmt 1 view .LVU24
+.LVL8:
+	.loc 1 34 5 view .LVU25
+# dudect/ttest.c:34:     var[0] = ctx->m2[0] / (ctx->n[0] - 1);
+	.loc 1 34 34 is_stmt 0 view .LVU26
+	movsd	32(%rdi), %xmm3	# ctx_15(D)->n[0], _2
+.LVL9:
+	.loc 1 35 5 is_stmt 1 view .LVU27
+# dudect/ttest.c:35:     var[1] = ctx->m2[1] / (ctx->n[1] - 1);
+	.loc 1 35 34 is_stmt 0 view .LVU28
+	movsd	40(%rdi), %xmm2	# ctx_15(D)->n[1], _6
+.LVL10:
+	.loc 1 36 5 is_stmt 1 view .LVU29
+# dudect/ttest.c:36:     double num = (ctx->mean[0] - ctx->mean[1]);
+	.loc 1 36 12 is_stmt 0 view .LVU30
+	movsd	(%rdi), %xmm0	# ctx_15(D)->mean[0], ctx_15(D)->mean[0]
+	subsd	8(%rdi), %xmm0	# ctx_15(D)->mean[1], ctx_15(D)->mean[0]
+	movq	%xmm0, %rbx	# ctx_15(D)->mean[0], num
+.LVL11:
+	.loc 1 37 5 is_stmt 1 view .LVU31
+# dudect/ttest.c:34:     var[0] = ctx->m2[0] / (ctx->n[0] - 1);
+	.loc 1 34 38 is_stmt 0 view .LVU32
+	movsd	.LC2(%rip), %xmm1	#, tmp101
+	movapd	%xmm3, %xmm4	# _2, tmp100
+	subsd	%xmm1, %xmm4	# tmp101, tmp100
+# dudect/ttest.c:34:     var[0] = ctx->m2[0] / (ctx->n[0] - 1);
+	.loc 1 34 25 view .LVU33
+	movsd	16(%rdi), %xmm0	# ctx_15(D)->m2[0], ctx_15(D)->m2[0]
+	divsd	%xmm4, %xmm0	# tmp100, tmp102
+.LVL12:
+# dudect/ttest.c:37:     double den = sqrt(var[0] / ctx->n[0] + var[1] / ctx->n[1]);
+	.loc 1 37 30 view .LVU34
+	divsd	%xmm3, %xmm0	# _2, tmp104
+.LVL13:
+# dudect/ttest.c:35:     var[1] = ctx->m2[1] / (ctx->n[1] - 1);
+	.loc 1 35 38 view .LVU35
+	movapd	%xmm2, %xmm3	# _6, tmp105
+.LVL14:
+	.loc 1 35 38 view .LVU36
+	subsd	%xmm1, %xmm3	# tmp101, tmp105
+# dudect/ttest.c:35:     var[1] = ctx->m2[1] / (ctx->n[1] - 1);
+	.loc 1 35 25 view .LVU37
+	movsd	24(%rdi), %xmm1	# ctx_15(D)->m2[1], ctx_15(D)->m2[1]
+	divsd	%xmm3, %xmm1	# tmp105, tmp107
+.LVL15:
+# dudect/ttest.c:37:     double den = sqrt(var[0] / ctx->n[0] + var[1] / ctx->n[1]);
+	.loc 1 37 51 view .LVU38
+	divsd	%xmm2, %xmm1	# _6, tmp109
+.LVL16:
+# dudect/ttest.c:37:     double den = sqrt(var[0] / ctx->n[0] + var[1] / ctx->n[1]);
+	.loc 1 37 18 view .LVU39
+	addsd	%xmm1, %xmm0	# tmp109, _13
+	pxor	%xmm1, %xmm1	# tmp110
+	ucomisd	%xmm0, %xmm1	# _13, tmp110
+	ja	.L12	#,
+	sqrtsd	%xmm0, %xmm0	# _13, den
+.LVL17:
+.L10:
+	.loc 1 38 5 is_stmt 1 view .LVU40
+	.loc 1 39 5 view .LVU41
+# dudect/ttest.c:38:     double t_value = num / den;
+	.loc 1 38 12 is_stmt 0 view .LVU42
+	movq	%rbx, %xmm1	# num, num
+	divsd	%xmm0, %xmm1	# den, num
+.LVL18:
+# dudect/ttest.c:40: }
+	.loc 1 40 1 view .LVU43
+	movapd	%xmm1, %xmm0	# t_value,
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL19:
+	.loc 1 40 1 view .LVU44
+	ret	
+.LVL20:
+.L12:
+	.cfi_restore_state
+# dudect/ttest.c:37:     double den = sqrt(var[0] / ctx->n[0] + var[1] / ctx->n[1]);
+	.loc 1 37 18 view .LVU45
+	call	sqrt@PLT	#
+.LVL21:
+	.loc 1 37 18 view .LVU46
+	jmp	.L10	#
+	.cfi_endproc
+.LFE23:
+	.size	t_compute, .-t_compute
+	.globl	t_merge
+	.type	t_merge, @function
+t_merge:
+.LVL22:
+.LFB24:
+	.loc 1 47 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 48 5 view .LVU48
+.LBB2:
+	.loc 1 48 10 view .LVU49
+	.loc 1 48 31 view .LVU50
+	movq	%rdi, %rdx	# dst, ivtmp.18
+	movq	%rsi, %rax	# tmp121, ivtmp.19
+	addq	$16, %rdi	#, _48
+.LVL23:
+.LBB3:
+# dudect/ttest.c:50:         if (n == 0)
+	.loc 1 50 12 is_stmt 0 view .LVU51
+	pxor	%xmm5, %xmm5	# tmp107
+	jmp	.L17	#
+.LVL24:
+.L18:
+	.loc 1 52 9 is_stmt 1 view .LVU52
+# dudect/ttest.c:52:         double delta = src->mean[class] - dst->mean[class];
+	.loc 1 52 52 is_stmt 0 view .LVU53
+	movsd	(%rcx), %xmm6	# MEM[(double *)_41], _4
+# dudect/ttest.c:52:         double delta = src->mean[class] - dst->mean[class];
+	.loc 1 52 16 view .LVU54
+	movsd	(%rsi), %xmm1	# MEM[(double *)_45], MEM[(double *)_45]
+	subsd	%xmm6, %xmm1	# _4, MEM[(double *)_45]
+	movapd	%xmm1, %xmm0	# MEM[(double *)_45], delta
+.LVL25:
+	.loc 1 53 9 is_stmt 1 view .LVU55
+# dudect/ttest.c:53:         dst->mean[class] += delta * src->n[class] / n;
+	.loc 1 53 35 is_stmt 0 view .LVU56
+	mulsd	%xmm1, %xmm2	# delta, tmp110
+# dudect/ttest.c:53:         dst->mean[class] += delta * src->n[class] / n;
+	.loc 1 53 51 view .LVU57
+	divsd	%xmm3, %xmm2	# n, tmp111
+# dudect/ttest.c:53:         dst->mean[class] += delta * src->n[class] / n;
+	.loc 1 53 26 view .LVU58
+	addsd	%xmm6, %xmm2	# _4, tmp112
+	movsd	%xmm2, (%rcx)	# tmp112, MEM[(double *)_41]
+	.loc 1 54 9 is_stmt 1 view .LVU59
+# dudect/ttest.c:55:                           delta * delta * dst->n[class] * src->n[class] / n;
+	.loc 1 55 33 is_stmt 0 view .LVU60
+	mulsd	%xmm1, %xmm0	# delta, tmp113
+.LVL26:
+# dudect/ttest.c:55:                           delta * delta * dst->n[class] * src->n[class] / n;
+	.loc 1 55 41 view .LVU61
+	mulsd	%xmm4, %xmm0	# _1, tmp114
+# dudect/ttest.c:55:                           delta * delta * dst->n[class] * src->n[class] / n;
+	.loc 1 55 57 view .LVU62
+	mulsd	32(%rsi), %xmm0	# MEM[(double *)_45 + 32B], tmp115
+# dudect/ttest.c:55:                           delta * delta * dst->n[class] * src->n[class] / n;
+	.loc 1 55 73 view .LVU63
+	divsd	%xmm3, %xmm0	# n, tmp116
+# dudect/ttest.c:54:         dst->m2[class] += src->m2[class] +
+	.loc 1 54 42 view .LVU64
+	addsd	16(%rsi), %xmm0	# MEM[(double *)_45 + 16B], tmp117
+# dudect/ttest.c:54:         dst->m2[class] += src->m2[class] +
+	.loc 1 54 24 view .LVU65
+	addsd	16(%rcx), %xmm0	# MEM[(double *)_41 + 16B], tmp118
+	movsd	%xmm0, 16(%rcx)	# tmp118, MEM[(double *)_41 + 16B]
+	.loc 1 56 9 is_stmt 1 view .LVU66
+# dudect/ttest.c:56:         dst->n[class] = n;
+	.loc 1 56 23 is_stmt 0 view .LVU67
+	movsd	%xmm3, 32(%rcx)	# n, MEM[(double *)_41 + 32B]
+.LVL27:
+.L15:
+	.loc 1 56 23 view .LVU68
+.LBE3:
+	.loc 1 48 42 is_stmt 1 discriminator 2 view .LVU69
+	.loc 1 48 31 discriminator 2 view .LVU70
+	addq	$8, %rdx	#, ivtmp.18
+.LVL28:
+	.loc 1 48 31 is_stmt 0 discriminator 2 view .LVU71
+	addq	$8, %rax	#, ivtmp.19
+	cmpq	%rdi, %rdx	# _48, ivtmp.18
+	je	.L20	#,
+.LVL29:
+.L17:
+.LBB4:
+	.loc 1 49 9 is_stmt 1 view .LVU72
+	movq	%rdx, %rcx	# ivtmp.18, _41
+# dudect/ttest.c:49:         double n = dst->n[class] + src->n[class];
+	.loc 1 49 26 is_stmt 0 view .LVU73
+	movsd	32(%rdx), %xmm4	# MEM[(double *)_41 + 32B], _1
+	movq	%rax, %rsi	# ivtmp.19, _45
+# dudect/ttest.c:49:         double n = dst->n[class] + src->n[class];
+	.loc 1 49 42 view .LVU74
+	movsd	32(%rax), %xmm2	# MEM[(double *)_45 + 32B], _2
+# dudect/ttest.c:49:         double n = dst->n[class] + src->n[class];
+	.loc 1 49 16 view .LVU75
+	movapd	%xmm4, %xmm3	# _1, n
+	addsd	%xmm2, %xmm3	# _2, n
+.LVL30:
+	.loc 1 50 9 is_stmt 1 view .LVU76
+# dudect/ttest.c:50:         if (n == 0)
+	.loc 1 50 12 is_stmt 0 view .LVU77
+	ucomisd	%xmm5, %xmm3	# tmp107, n
+	jp	.L18	#,
+	jne	.L18	#,
+	jmp	.L15	#
+.LVL31:
+.L20:
+	.loc 1 50 12 view .LVU78
+.LBE4:
+.LBE2:
+# dudect/ttest.c:58: }
+	.loc 1 58 1 view .LVU79
+	ret	
+	.cfi_endproc
+.LFE24:
+	.size	t_merge, .-t_merge
+	.globl	t_init
+	.type	t_init, @function
+t_init:
+.LVL32:
+.LFB25:
+	.loc 1 61 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 62 5 view .LVU81
+.LBB5:
+	.loc 1 62 10 view .LVU82
+	.loc 1 62 31 view .LVU83
+	.loc 1 63 9 view .LVU84
+# dudect/ttest.c:63:         ctx->mean[class] = 0.0;
+	.loc 1 63 26 is_stmt 0 view .LVU85
+	movq	$0x000000000, (%rdi)	#, ctx_4(D)->mean[0]
+	.loc 1 64 9 is_stmt 1 view .LVU86
+# dudect/ttest.c:64:         ctx->m2[class] = 0.0;
+	.loc 1 64 24 is_stmt 0 view .LVU87
+	movq	$0x000000000, 16(%rdi)	#, ctx_4(D)->m2[0]
+	.loc 1 65 9 is_stmt 1 view .LVU88
+# dudect/ttest.c:65:         ctx->n[class] = 0.0;
+	.loc 1 65 23 is_stmt 0 view .LVU89
+	movq	$0x000000000, 32(%rdi)	#, ctx_4(D)->n[0]
+	.loc 1 62 42 is_stmt 1 view .LVU90
+.LVL33:
+	.loc 1 62 31 view .LVU91
+	.loc 1 63 9 view .LVU92
+# dudect/ttest.c:63:         ctx->mean[class] = 0.0;
+	.loc 1 63 26 is_stmt 0 view .LVU93
+	movq	$0x000000000, 8(%rdi)	#, MEM <double> [(struct t_ctx *)ctx_4(D) + 8B]
+	.loc 1 64 9 is_stmt 1 view .LVU94
+# dudect/ttest.c:64:         ctx->m2[class] = 0.0;
+	.loc 1 64 24 is_stmt 0 view .LVU95
+	movq	$0x000000000, 24(%rdi)	#, MEM <double> [(struct t_ctx *)ctx_4(D) + 24B]
+	.loc 1 65 9 is_stmt 1 view .LVU96
+# dudect/ttest.c:65:         ctx->n[class] = 0.0;
+	.loc 1 65 23 is_stmt 0 view .LVU97
+	movq	$0x000000000, 40(%rdi)	#, MEM <double> [(struct t_ctx *)ctx_4(D) + 40B]
+	.loc 1 62 42 is_stmt 1 view .LVU98
+.LVL34:
+	.loc 1 62 31 view .LVU99
+.LBE5:
+	.loc 1 67 5 view .LVU100
+# dudect/ttest.c:68: }
+	.loc 1 68 1 is_stmt 0 view .LVU101
+	ret	
+	.cfi_endproc
+.LFE25:
+	.size	t_init, .-t_init
+	.section	.rodata
+	.type	__PRETTY_FUNCTION__.0, @object
+	.size	__PRETTY_FUNCTION__.0, 7
+__PRETTY_FUNCTION__.0:
+	.string	"t_push"
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC2:
+	.long	0
+	.long	1072693248
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "dudect/ttest.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 6 "/usr/include/assert.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x36a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xf
+	.long	.LASF26
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF3
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x6
+	.long	.LASF11
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x35
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x7
+	.long	0x79
+	.uleb128 0x6
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x58
+	.uleb128 0x11
+	.byte	0x30
+	.byte	0x4
+	.byte	0x5
+	.byte	0x9
+	.long	0xbb
+	.uleb128 0x12
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x6
+	.byte	0xc
+	.long	0xbb
+	.byte	0
+	.uleb128 0xb
+	.string	"m2"
+	.byte	0x7
+	.long	0xbb
+	.byte	0x10
+	.uleb128 0xb
+	.string	"n"
+	.byte	0x8
+	.long	0xbb
+	.byte	0x20
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e
+	.long	0xcb
+	.uleb128 0xd
+	.long	0x4a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x9
+	.byte	0x3
+	.long	0x91
+	.uleb128 0x7
+	.long	0xcb
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF15
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF16
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF17
+	.uleb128 0x13
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x8f
+	.byte	0x1
+	.long	0x2e
+	.long	0x107
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x45
+	.byte	0xd
+	.long	0x128
+	.uleb128 0x2
+	.long	0x128
+	.uleb128 0x2
+	.long	0x128
+	.uleb128 0x2
+	.long	0x43
+	.uleb128 0x2
+	.long	0x128
+	.byte	0
+	.uleb128 0x8
+	.long	0x80
+	.uleb128 0x9
+	.long	.LASF20
+	.byte	0x3c
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17d
+	.uleb128 0x15
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x3c
+	.byte	0x14
+	.long	0x17d
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xe
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x3e
+	.byte	0xe
+	.long	0x6b
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xcb
+	.uleb128 0x9
+	.long	.LASF21
+	.byte	0x2e
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x214
+	.uleb128 0x4
+	.string	"dst"
+	.byte	0x2e
+	.byte	0x15
+	.long	0x17d
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x4
+	.string	"src"
+	.byte	0x2e
+	.byte	0x27
+	.long	0x214
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xe
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x30
+	.byte	0xe
+	.long	0x6b
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x16
+	.long	.LLRL11
+	.uleb128 0xa
+	.string	"n"
+	.byte	0x31
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x34
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xd7
+	.uleb128 0x17
+	.long	.LASF27
+	.byte	0x1
+	.byte	0x1f
+	.byte	0x8
+	.long	0x2e
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a3
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x1f
+	.byte	0x19
+	.long	0x17d
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xa
+	.string	"var"
+	.byte	0x21
+	.byte	0xc
+	.long	0xbb
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xa
+	.string	"num"
+	.byte	0x24
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x18
+	.string	"den"
+	.byte	0x1
+	.byte	0x25
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.long	.LASF24
+	.byte	0x26
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x19
+	.quad	.LVL21
+	.long	0xf1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF25
+	.byte	0x13
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x358
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x13
+	.byte	0x14
+	.long	0x17d
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x13
+	.byte	0x20
+	.long	0x2e
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1a
+	.long	.LASF22
+	.byte	0x1
+	.byte	0x13
+	.byte	0x2b
+	.long	0x85
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1b
+	.long	.LASF28
+	.long	0x368
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x1a
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1c
+	.quad	.LVL6
+	.long	0x107
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x45
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x80
+	.long	0x368
+	.uleb128 0xd
+	.long	0x4a
+	.byte	0x6
+	.byte	0
+	.uleb128 0x7
+	.long	0x358
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS14:
+	.uleb128 .LVU83
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU50
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0xa
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0xc
+	.byte	0x72
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0xa
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0xc
+	.byte	0x72
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU52
+	.uleb128 .LVU72
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU55
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU68
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU25
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU40
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x18
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x24
+	.byte	0x75
+	.sleb128 16
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x9e
+	.uleb128 0x8
+	.long	0
+	.long	0
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x30
+	.byte	0x75
+	.sleb128 16
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 24
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1b
+	.byte	0x61
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 24
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x30
+	.byte	0x75
+	.sleb128 16
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 24
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x32
+	.byte	0x75
+	.sleb128 16
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0x75
+	.sleb128 32
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 24
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1d
+	.byte	0x75
+	.sleb128 16
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0x75
+	.sleb128 32
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x62
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x32
+	.byte	0x75
+	.sleb128 16
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0x75
+	.sleb128 32
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 24
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x32
+	.byte	0x75
+	.sleb128 16
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0x75
+	.sleb128 32
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 24
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3ff00000
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU31
+	.uleb128 .LVU44
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU41
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU45
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x8
+	.byte	0xa5
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU8
+	.uleb128 .LVU17
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF11:
+	.string	"__uint8_t"
+.LASF19:
+	.string	"__assert_fail"
+.LASF15:
+	.string	"float"
+.LASF23:
+	.string	"delta"
+.LASF21:
+	.string	"t_merge"
+.LASF22:
+	.string	"class"
+.LASF28:
+	.string	"__PRETTY_FUNCTION__"
+.LASF3:
+	.string	"unsigned char"
+.LASF6:
+	.string	"long unsigned int"
+.LASF4:
+	.string	"short unsigned int"
+.LASF27:
+	.string	"t_compute"
+.LASF2:
+	.string	"double"
+.LASF5:
+	.string	"unsigned int"
+.LASF17:
+	.string	"long long unsigned int"
+.LASF12:
+	.string	"uint8_t"
+.LASF13:
+	.string	"mean"
+.LASF14:
+	.string	"t_ctx"
+.LASF16:
+	.string	"long long int"
+.LASF20:
+	.string	"t_init"
+.LASF10:
+	.string	"char"
+.LASF24:
+	.string	"t_value"
+.LASF8:
+	.string	"short int"
+.LASF25:
+	.string	"t_push"
+.LASF9:
+	.string	"long int"
+.LASF7:
+	.string	"signed char"
+.LASF26:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF18:
+	.string	"sqrt"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"dudect/ttest.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
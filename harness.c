@@ -1,7 +1,11 @@
 /* Test support code */
 
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <dlfcn.h>
 #include <setjmp.h>
 #include <signal.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -13,6 +17,24 @@
 #define INTERNAL 1
 #include "harness.h"
 
+/*
+ * Name allocation site as object+offset, such as qtest+0x2f1c, which stays
+ * the same from run to run of a PIE binary and can be passed to
+ * addr2line -e qtest.  Falls back to the raw address.
+ */
+static void format_site(char *buf, size_t buf_size, void *site)
+{
+    Dl_info info;
+    if (site && dladdr(site, &info) && info.dli_fname) {
+        const char *name = strrchr(info.dli_fname, '/');
+        name = name ? name + 1 : info.dli_fname;
+        snprintf(buf, buf_size, "%s+%#lx", name,
+                 (unsigned long) ((char *) site - (char *) info.dli_fbase));
+    } else {
+        snprintf(buf, buf_size, "%p", site);
+    }
+}
+
 /** Special values **/
 
 /* Value at start of every allocated block */
@@ -27,6 +49,9 @@
 /* Byte to fill newly malloced space with */
 #define FILLCHAR 0x55
 
+/* Byte to poison quarantined space with */
+#define FREECHAR (MAGICFREE & 0xff)
+
 /* Data structures used by our code */
 
 /*
@@ -36,6 +61,7 @@
 typedef struct BELE {
     struct BELE *next, *prev;
     size_t payload_size;
+    void *site;          /* Return address of allocating call */
     size_t magic_header; /* Marker to see if block seems legitimate */
     unsigned char payload[0];
     /* Also place magic number at tail of every block */
@@ -43,10 +69,42 @@ typedef struct BELE {
 
 static block_ele_t *allocated = NULL;
 static size_t allocated_count = 0;
+static size_t allocated_bytes = 0;
+
+/*
+ * Freed blocks are held in a FIFO quarantine before returning them to libc,
+ * so that writes through dangling pointers can be detected.
+ * Linked through next field, oldest block first.
+ */
+static block_ele_t *quarantine_head = NULL;
+static block_ele_t *quarantine_tail = NULL;
+static size_t quarantine_count = 0;
+static size_t quarantine_bytes = 0;
+
+/* Capacity of quarantine, as number of blocks and as kilobytes */
+int quarantine_max_blocks = 1024;
+int quarantine_max_kb = 1024;
 
 /* Percent probability of malloc failure */
 int fail_probability = 0;
 
+/* Make every nth allocation fail (0 = never) */
+int fail_every = 0;
+
+/* Sorted list of allocation numbers that should fail */
+#define FAIL_LIST_MAX 256
+static size_t fail_list[FAIL_LIST_MAX];
+static int fail_list_cnt = 0;
+static int fail_list_pos = 0;
+
+/* Number of calls to test_malloc so far, numbered from 1 */
+static size_t alloc_seq = 0;
+
+/* State of xorshift64* generator deciding random failures */
+static uint64_t fail_state = 88172645463325252ULL;
+/* Last seed given to set_fail_seed, shown with injected failures */
+static unsigned int fail_seed = 0;
+
 static bool cautious_mode = true;
 static bool noallocate_mode = false;
 static bool error_occurred = false;
@@ -65,11 +123,40 @@ static bool time_limited = false;
  * Internal functions
  */
 
+/* Next value from xorshift64* generator */
+static inline uint64_t fail_random()
+{
+    uint64_t x = fail_state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    fail_state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
 /* Should this allocation fail? */
 static bool fail_allocation()
 {
-    double weight = (double) random() / RAND_MAX;
-    return (weight < 0.01 * fail_probability);
+    alloc_seq++;
+
+    if (fail_list_pos < fail_list_cnt &&
+        fail_list[fail_list_pos] <= alloc_seq) {
+        while (fail_list_pos < fail_list_cnt &&
+               fail_list[fail_list_pos] <= alloc_seq)
+            fail_list_pos++;
+        if (fail_list[fail_list_pos - 1] == alloc_seq)
+            return true;
+    }
+
+    if (fail_every > 0 && alloc_seq % fail_every == 0)
+        return true;
+
+    if (fail_probability <= 0)
+        return false;
+
+    /* Map upper 32 bits onto [0, 100) without a division */
+    uint64_t weight = ((fail_random() >> 32) * 100) >> 32;
+    return weight < (uint64_t) fail_probability;
 }
 
 /*
@@ -119,10 +206,48 @@ static size_t *find_footer(block_ele_t *b)
     return p;
 }
 
+/* Check that a quarantined block is still poisoned, then release it */
+static void release_block(block_ele_t *b)
+{
+    unsigned char *p = b->payload;
+    size_t n = b->payload_size;
+    bool intact = b->magic_header == MAGICFREE && *find_footer(b) == MAGICFREE;
+    if (intact && n > 0)
+        intact = p[0] == FREECHAR && !memcmp(p, p + 1, n - 1);
+    if (!intact) {
+        char site[128];
+        format_site(site, sizeof(site), b->site);
+        report_event(MSG_ERROR,
+                     "Write to freed block with address %p (%lu bytes, "
+                     "allocated from %s)",
+                     (void *) p, n, site);
+        error_occurred = true;
+    }
+    free(b);
+}
+
+/* Release oldest quarantined blocks until within limits */
+static void trim_quarantine(int max_blocks, int max_kb)
+{
+    size_t max_bytes = max_kb > 0 ? (size_t) max_kb << 10 : 0;
+    if (max_blocks < 0)
+        max_blocks = 0;
+    while (quarantine_head &&
+           (quarantine_count > (size_t) max_blocks || quarantine_bytes > max_bytes)) {
+        block_ele_t *b = quarantine_head;
+        quarantine_head = b->next;
+        if (!quarantine_head)
+            quarantine_tail = NULL;
+        quarantine_count--;
+        quarantine_bytes -= b->payload_size;
+        release_block(b);
+    }
+}
+
 /*
  * Implementation of application functions
  */
-void *test_malloc(size_t size)
+static void *alloc_block(size_t size, void *site)
 {
     if (noallocate_mode) {
         report_event(MSG_FATAL, "Calls to malloc disallowed");
@@ -130,7 +255,9 @@ void *test_malloc(size_t size)
     }
 
     if (fail_allocation()) {
-        report_event(MSG_WARN, "Malloc returning NULL");
+        report_event(MSG_WARN,
+                     "Malloc returning NULL (allocation #%lu, seed %u)",
+                     alloc_seq, fail_seed);
         return NULL;
     }
 
@@ -145,6 +272,8 @@ void *test_malloc(size_t size)
     new_block->magic_header = MAGICHEADER;
     // cppcheck-suppress nullPointerRedundantCheck
     new_block->payload_size = size;
+    // cppcheck-suppress nullPointerRedundantCheck
+    new_block->site = site;
     *find_footer(new_block) = MAGICFOOTER;
     void *p = (void *) &new_block->payload;
     memset(p, FILLCHAR, size);
@@ -157,10 +286,16 @@ void *test_malloc(size_t size)
         allocated->prev = new_block;
     allocated = new_block;
     allocated_count++;
+    allocated_bytes += size;
 
     return p;
 }
 
+void *test_malloc(size_t size)
+{
+    return alloc_block(size, __builtin_return_address(0));
+}
+
 // cppcheck-suppress unusedFunction
 void *test_calloc(size_t nelem, size_t elsize)
 {
@@ -168,7 +303,7 @@ void *test_calloc(size_t nelem, size_t elsize)
      * https://danluu.com/malloc-tutorial/
      */
     size_t size = nelem * elsize;  // TODO: check for overflow
-    void *ptr = test_malloc(size);
+    void *ptr = alloc_block(size, __builtin_return_address(0));
     memset(ptr, 0, size);
     return ptr;
 }
@@ -184,6 +319,10 @@ void test_free(void *p)
         return;
 
     block_ele_t *b = find_header(p);
+    if (b->magic_header != MAGICHEADER) {
+        /* Already reported.  Block may be sitting in quarantine */
+        return;
+    }
     size_t footer = *find_footer(b);
     if (footer != MAGICFOOTER) {
         report_event(MSG_ERROR,
@@ -194,7 +333,7 @@ void test_free(void *p)
     }
     b->magic_header = MAGICFREE;
     *find_footer(b) = MAGICFREE;
-    memset(p, FILLCHAR, b->payload_size);
+    memset(p, FREECHAR, b->payload_size);
 
     /* Unlink from list */
     block_ele_t *bn = b->next;
@@ -206,15 +345,26 @@ void test_free(void *p)
     if (bn)
         bn->prev = bp;
 
-    free(b);
     allocated_count--;
+    allocated_bytes -= b->payload_size;
+
+    /* Hold on to block for a while to catch use after free */
+    b->next = NULL;
+    if (quarantine_tail)
+        quarantine_tail->next = b;
+    else
+        quarantine_head = b;
+    quarantine_tail = b;
+    quarantine_count++;
+    quarantine_bytes += b->payload_size;
+    trim_quarantine(quarantine_max_blocks, quarantine_max_kb);
 }
 
 // cppcheck-suppress unusedFunction
 char *test_strdup(const char *s)
 {
     size_t len = strlen(s) + 1;
-    void *new = test_malloc(len);
+    void *new = alloc_block(len, __builtin_return_address(0));
     if (!new)
         return NULL;
 
@@ -226,6 +376,221 @@ size_t allocation_check()
     return allocated_count;
 }
 
+size_t allocation_bytes()
+{
+    return allocated_bytes;
+}
+
+/*
+ * Implementation of failure schedules
+ */
+
+/*
+ * Seed the generator deciding random failures.
+ * Also restarts allocation numbering, so that a run can be replayed.
+ */
+void set_fail_seed(unsigned int seed)
+{
+    fail_seed = seed;
+    /* xorshift must not start from zero */
+    fail_state = ((uint64_t) seed << 32 | seed) ^ 0x9E3779B97F4A7C15ULL;
+    alloc_seq = 0;
+    fail_list_pos = 0;
+}
+
+static int cmp_size(const void *a, const void *b)
+{
+    size_t x = *(const size_t *) a, y = *(const size_t *) b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Make the listed calls to malloc fail.
+ * Allocations are numbered from 1.  Return false if list is too long.
+ */
+bool set_fail_list(size_t *list, int cnt)
+{
+    if (cnt < 0 || cnt > FAIL_LIST_MAX)
+        return false;
+    memcpy(fail_list, list, cnt * sizeof(size_t));
+    qsort(fail_list, cnt, sizeof(size_t), cmp_size);
+    fail_list_cnt = cnt;
+    /* Skip entries that are already in the past */
+    fail_list_pos = 0;
+    while (fail_list_pos < fail_list_cnt &&
+           fail_list[fail_list_pos] <= alloc_seq)
+        fail_list_pos++;
+    return true;
+}
+
+size_t allocation_number()
+{
+    return alloc_seq;
+}
+
+/*
+ * Leak reporting.
+ * Live blocks are grouped by payload size and allocation site with an
+ * open-addressed hash table, so a report takes time linear in the number
+ * of blocks.
+ */
+
+#define LEAK_TOP 10
+#define LEAK_SAMPLES 3
+#define LEAK_SAMPLE_LEN 40
+
+typedef struct {
+    size_t payload_size;
+    void *site;
+    size_t count;
+    block_ele_t *samples[LEAK_SAMPLES];
+} leak_group_t;
+
+static inline size_t leak_hash(size_t size, void *site)
+{
+    uint64_t h = (uint64_t) size * 0x9E3779B97F4A7C15ULL ^ (uintptr_t) site;
+    h ^= h >> 29;
+    return (size_t) (h * 0xBF58476D1CE4E5B9ULL >> 32);
+}
+
+/* Find slot of group with given key, or empty slot where it belongs */
+static leak_group_t *leak_slot(leak_group_t *table,
+                               size_t mask,
+                               size_t size,
+                               void *site)
+{
+    size_t i = leak_hash(size, site) & mask;
+    while (table[i].count &&
+           (table[i].payload_size != size || table[i].site != site))
+        i = (i + 1) & mask;
+    return &table[i];
+}
+
+/* Print payload as string if it looks like one, otherwise as hex bytes */
+static void format_sample(char *buf, size_t buf_size, block_ele_t *b)
+{
+    unsigned char *p = b->payload;
+    size_t n = b->payload_size;
+    size_t len = 0;
+    while (len < n && p[len] && isprint(p[len]))
+        len++;
+
+    if (len < n && !p[len]) {
+        snprintf(buf, buf_size, "\"%.*s\"%s",
+                 (int) (len < LEAK_SAMPLE_LEN ? len : LEAK_SAMPLE_LEN), p,
+                 len > LEAK_SAMPLE_LEN ? "..." : "");
+        return;
+    }
+
+    size_t pos = 0;
+    for (size_t i = 0; i < n && i < 16 && pos + 4 < buf_size; i++)
+        pos += snprintf(buf + pos, buf_size - pos, i ? " %.2x" : "%.2x", p[i]);
+    if (n > 16 && pos + 4 < buf_size)
+        snprintf(buf + pos, buf_size - pos, " ...");
+    if (!n)
+        snprintf(buf, buf_size, "(empty)");
+}
+
+/*
+ * Summarize blocks that are still allocated.
+ * Groups with most blocks are printed at given verbosity level.
+ * Every block is listed in file if non-NULL.
+ */
+void report_leaks(int vlevel, FILE *file)
+{
+    char sample[LEAK_SAMPLE_LEN + 64];
+    char site[128];
+    size_t nslots = 64;
+    while (nslots < 2 * allocated_count && nslots < ((size_t) 1 << 20))
+        nslots <<= 1;
+
+    size_t ngroups = 0, nbytes = 0;
+    leak_group_t *table = calloc(nslots, sizeof(leak_group_t));
+    if (!table) {
+        report_event(MSG_WARN, "Couldn't allocate table for leak report");
+        return;
+    }
+
+    for (block_ele_t *b = allocated; b; b = b->next) {
+        nbytes += b->payload_size;
+        if (file) {
+            format_sample(sample, sizeof(sample), b);
+            format_site(site, sizeof(site), b->site);
+            fprintf(file, "%p\t%lu\t%s\t%s\n", (void *) b->payload,
+                    b->payload_size, site, sample);
+        }
+
+        leak_group_t *g =
+            leak_slot(table, nslots - 1, b->payload_size, b->site);
+        if (!g->count) {
+            if (2 * (ngroups + 1) > nslots) {
+                /* Grow table, rehashing existing groups */
+                leak_group_t *bigger =
+                    calloc(2 * nslots, sizeof(leak_group_t));
+                if (!bigger)
+                    break;
+                for (size_t i = 0; i < nslots; i++) {
+                    if (table[i].count)
+                        *leak_slot(bigger, 2 * nslots - 1,
+                                   table[i].payload_size,
+                                   table[i].site) = table[i];
+                }
+                free(table);
+                table = bigger;
+                nslots *= 2;
+                g = leak_slot(table, nslots - 1, b->payload_size, b->site);
+            }
+            g->payload_size = b->payload_size;
+            g->site = b->site;
+            ngroups++;
+        }
+        if (g->count < LEAK_SAMPLES)
+            g->samples[g->count] = b;
+        g->count++;
+    }
+
+    /* Select largest groups, keeping them ordered by count */
+    leak_group_t *top[LEAK_TOP];
+    size_t ntop = 0;
+    for (size_t i = 0; i < nslots; i++) {
+        leak_group_t *g = &table[i];
+        if (!g->count || (ntop == LEAK_TOP && g->count <= top[ntop - 1]->count))
+            continue;
+        size_t j = ntop < LEAK_TOP ? ntop++ : LEAK_TOP - 1;
+        while (j > 0 && top[j - 1]->count < g->count) {
+            top[j] = top[j - 1];
+            j--;
+        }
+        top[j] = g;
+    }
+
+    report(vlevel, "%lu blocks (%lu bytes) still allocated, in %lu groups:",
+           allocated_count, nbytes, ngroups);
+    for (size_t i = 0; i < ntop; i++) {
+        leak_group_t *g = top[i];
+        format_site(site, sizeof(site), g->site);
+        report(vlevel, "  %lu blocks of %lu bytes allocated from %s", g->count,
+               g->payload_size, site);
+        for (size_t j = 0; j < g->count && j < LEAK_SAMPLES; j++) {
+            format_sample(sample, sizeof(sample), g->samples[j]);
+            report(vlevel, "    %p: %s", (void *) g->samples[j]->payload,
+                   sample);
+        }
+    }
+    if (ngroups > ntop)
+        report(vlevel, "  ... %lu more groups", ngroups - ntop);
+
+    free(table);
+}
+
+/*
+ * Check and release all quarantined blocks.
+ */
+void quarantine_flush()
+{
+    trim_quarantine(0, 0);
+}
+
 /*
  * Implementation of functions for testing
  */
@@ -265,7 +630,8 @@ bool error_check()
 bool exception_setup(bool limit_time)
 {
     if (sigsetjmp(env, 1)) {
-        /* Got here from longjmp */
+        /* Got here from longjmp, possibly out of a signal handler */
+        report_signal_leave();
         jmp_ready = false;
         if (time_limited) {
             alarm(0);
@@ -4,6 +4,7 @@
 #include <setjmp.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdio.h>
 
 /*
  * This test harness enables us to do stringent testing of code.
@@ -22,9 +23,47 @@ char *test_strdup(const char *s);
 /* Report number of allocated blocks */
 size_t allocation_check();
 
+/* Report total payload bytes of allocated blocks */
+size_t allocation_bytes();
+
+/*
+ * Summarize allocated blocks, grouped by size and allocation site.
+ * Largest groups are shown at verbosity level vlevel.
+ * If file is non-NULL, every block is listed in it.
+ */
+void report_leaks(int vlevel, FILE *file);
+
 /* Probability of malloc failing, expressed as percent */
 extern int fail_probability;
 
+/* Make every nth call to malloc fail (0 = never) */
+extern int fail_every;
+
+/*
+ * Seed the generator used to decide random malloc failures.
+ * Also restarts allocation numbering, so a failing run can be replayed.
+ */
+void set_fail_seed(unsigned int seed);
+
+/*
+ * Make the listed calls to malloc fail.  Allocations are numbered from 1.
+ * Return false if the list is too long.
+ */
+bool set_fail_list(size_t *list, int cnt);
+
+/* Report number of calls to malloc made so far */
+size_t allocation_number();
+
+/*
+ * Capacity of the quarantine holding freed blocks, in blocks and kilobytes.
+ * Writes to a quarantined block are reported when it leaves the quarantine.
+ */
+extern int quarantine_max_blocks;
+extern int quarantine_max_kb;
+
+/* Check and release all quarantined blocks */
+void quarantine_flush();
+
 /*
  * Set/unset cautious mode.
  * In this mode, makes extra sure any block to be freed is currently allocated.
@@ -0,0 +1,10541 @@
+	.file	"harness.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "harness.c"
+	.type	cmp_size, @function
+cmp_size:
+.LVL0:
+.LFB40:
+	.file 1 "harness.c"
+	.loc 1 402 1 view -0
+	.cfi_startproc
+	.loc 1 403 5 view .LVU1
+# harness.c:403:     size_t x = *(const size_t *) a, y = *(const size_t *) b;
+	.loc 1 403 12 is_stmt 0 view .LVU2
+	movq	(%rdi), %rcx	# MEM[(const size_t *)a_6(D)], x
+.LVL1:
+# harness.c:403:     size_t x = *(const size_t *) a, y = *(const size_t *) b;
+	.loc 1 403 37 view .LVU3
+	movq	(%rsi), %rdx	# MEM[(const size_t *)b_8(D)], y
+.LVL2:
+	.loc 1 404 5 is_stmt 1 view .LVU4
+# harness.c:404:     return (x > y) - (x < y);
+	.loc 1 404 15 is_stmt 0 view .LVU5
+	cmpq	%rcx, %rdx	# x, y
+	setb	%al	#, tmp92
+	movzbl	%al, %eax	# tmp92, tmp92
+# harness.c:404:     return (x > y) - (x < y);
+	.loc 1 404 25 view .LVU6
+	cmpq	%rdx, %rcx	# y, x
+# harness.c:404:     return (x > y) - (x < y);
+	.loc 1 404 20 view .LVU7
+	sbbl	$0, %eax	# tmp91
+# harness.c:405: }
+	.loc 1 405 1 view .LVU8
+	ret	
+	.cfi_endproc
+.LFE40:
+	.size	cmp_size, .-cmp_size
+	.type	leak_slot, @function
+leak_slot:
+.LVL3:
+.LFB44:
+	.loc 1 461 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 461 1 is_stmt 0 view .LVU10
+	movq	%rdx, %r8	# tmp119, size
+	.loc 1 462 5 is_stmt 1 view .LVU11
+.LVL4:
+.LBB4:
+.LBI4:
+	.loc 1 449 22 view .LVU12
+.LBB5:
+	.loc 1 451 5 view .LVU13
+# harness.c:451:     uint64_t h = (uint64_t) size * 0x9E3779B97F4A7C15ULL ^ (uintptr_t) site;
+	.loc 1 451 34 is_stmt 0 view .LVU14
+	movabsq	$-7046029254386353131, %rdx	#, tmp103
+.LVL5:
+	.loc 1 451 34 view .LVU15
+	imulq	%r8, %rdx	# size, tmp102
+# harness.c:451:     uint64_t h = (uint64_t) size * 0x9E3779B97F4A7C15ULL ^ (uintptr_t) site;
+	.loc 1 451 14 view .LVU16
+	xorq	%rcx, %rdx	# site, h
+.LVL6:
+	.loc 1 452 5 is_stmt 1 view .LVU17
+# harness.c:452:     h ^= h >> 29;
+	.loc 1 452 12 is_stmt 0 view .LVU18
+	movq	%rdx, %rax	# h, _18
+	shrq	$29, %rax	#, _18
+.LVL7:
+	.loc 1 453 5 is_stmt 1 view .LVU19
+# harness.c:452:     h ^= h >> 29;
+	.loc 1 452 7 is_stmt 0 view .LVU20
+	xorq	%rax, %rdx	# _18, h
+# harness.c:453:     return (size_t) (h * 0xBF58476D1CE4E5B9ULL >> 32);
+	.loc 1 453 24 view .LVU21
+	movabsq	$-4658895280553007687, %rax	#, tmp106
+	imulq	%rax, %rdx	# tmp106, tmp105
+# harness.c:453:     return (size_t) (h * 0xBF58476D1CE4E5B9ULL >> 32);
+	.loc 1 453 12 view .LVU22
+	shrq	$32, %rdx	#, tmp107
+.LBE5:
+.LBE4:
+# harness.c:462:     size_t i = leak_hash(size, site) & mask;
+	.loc 1 462 12 view .LVU23
+	andq	%rsi, %rdx	# mask, i
+.LVL8:
+	.loc 1 463 5 is_stmt 1 view .LVU24
+	.loc 1 463 27 view .LVU25
+# harness.c:463:     while (table[i].count &&
+	.loc 1 463 17 is_stmt 0 view .LVU26
+	leaq	(%rdx,%rdx,2), %rax	#, tmp110
+	salq	$4, %rax	#, tmp111
+	addq	%rdi, %rax	# table, <retval>
+# harness.c:463:     while (table[i].count &&
+	.loc 1 463 27 view .LVU27
+	cmpq	$0, 16(%rax)	#, _24->count
+	jne	.L3	#,
+	ret	
+.L5:
+	.loc 1 465 9 is_stmt 1 view .LVU28
+# harness.c:465:         i = (i + 1) & mask;
+	.loc 1 465 16 is_stmt 0 view .LVU29
+	addq	$1, %rdx	#, _1
+.LVL9:
+# harness.c:465:         i = (i + 1) & mask;
+	.loc 1 465 11 view .LVU30
+	andq	%rsi, %rdx	# mask, i
+.LVL10:
+	.loc 1 463 27 is_stmt 1 view .LVU31
+# harness.c:463:     while (table[i].count &&
+	.loc 1 463 17 is_stmt 0 view .LVU32
+	leaq	(%rdx,%rdx,2), %rax	#, tmp114
+	salq	$4, %rax	#, tmp115
+	addq	%rdi, %rax	# table, <retval>
+# harness.c:463:     while (table[i].count &&
+	.loc 1 463 27 view .LVU33
+	cmpq	$0, 16(%rax)	#, _3->count
+	je	.L2	#,
+.L3:
+# harness.c:463:     while (table[i].count &&
+	.loc 1 463 27 discriminator 1 view .LVU34
+	cmpq	%r8, (%rax)	# size, _26->payload_size
+	jne	.L5	#,
+# harness.c:464:            (table[i].payload_size != size || table[i].site != site))
+	.loc 1 464 43 view .LVU35
+	cmpq	%rcx, 8(%rax)	# site, _26->site
+	jne	.L5	#,
+.L2:
+# harness.c:467: }
+	.loc 1 467 1 view .LVU36
+	ret	
+	.cfi_endproc
+.LFE44:
+	.size	leak_slot, .-leak_slot
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Calls to malloc disallowed"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"Malloc returning NULL (allocation #%lu, seed %u)"
+	.align 8
+.LC2:
+	.string	"Couldn't allocate any more memory"
+	.text
+	.type	alloc_block, @function
+alloc_block:
+.LVL11:
+.LFB32:
+	.loc 1 251 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 251 1 is_stmt 0 view .LVU38
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 252 5 is_stmt 1 view .LVU39
+# harness.c:252:     if (noallocate_mode) {
+	.loc 1 252 9 is_stmt 0 view .LVU40
+	movzbl	noallocate_mode(%rip), %ecx	# noallocate_mode, fail_list_pos_lsm_flag.103
+# harness.c:252:     if (noallocate_mode) {
+	.loc 1 252 8 view .LVU41
+	testb	%cl, %cl	# fail_list_pos_lsm_flag.103
+	jne	.L23	#,
+	movq	%rdi, %rbp	# tmp162, size
+	movq	%rsi, %r12	# tmp163, site
+	.loc 1 257 5 is_stmt 1 view .LVU42
+.LBB12:
+.LBI12:
+	.loc 1 138 13 view .LVU43
+.LBB13:
+	.loc 1 140 5 view .LVU44
+# harness.c:140:     alloc_seq++;
+	.loc 1 140 14 is_stmt 0 view .LVU45
+	movq	alloc_seq(%rip), %rax	# alloc_seq, tmp170
+	leaq	1(%rax), %rsi	#, _39
+.LVL12:
+	.loc 1 140 14 view .LVU46
+	movq	%rsi, alloc_seq(%rip)	# _39, alloc_seq
+	.loc 1 142 5 is_stmt 1 view .LVU47
+# harness.c:142:     if (fail_list_pos < fail_list_cnt &&
+	.loc 1 142 23 is_stmt 0 view .LVU48
+	movl	fail_list_pos(%rip), %eax	# fail_list_pos, fail_list_pos.14_4
+	movl	fail_list_cnt(%rip), %edi	# fail_list_cnt, fail_list_cnt.10_41
+.LVL13:
+# harness.c:142:     if (fail_list_pos < fail_list_cnt &&
+	.loc 1 142 8 view .LVU49
+	cmpl	%edi, %eax	# fail_list_cnt.10_41, fail_list_pos.14_4
+	jge	.L10	#,
+# harness.c:143:         fail_list[fail_list_pos] <= alloc_seq) {
+	.loc 1 143 18 view .LVU50
+	movslq	%eax, %rdx	# fail_list_pos.14_4, fail_list_pos.14_4
+# harness.c:142:     if (fail_list_pos < fail_list_cnt &&
+	.loc 1 142 39 view .LVU51
+	leaq	fail_list(%rip), %r8	#, tmp130
+	cmpq	(%r8,%rdx,8), %rsi	# fail_list[fail_list_pos.9_40], _39
+	jb	.L10	#,
+	leaq	(%r8,%rdx,8), %rdx	#, ivtmp.110
+	movl	$1, %r8d	#, fail_list_pos_lsm_flag.103
+.L11:
+# harness.c:144:         while (fail_list_pos < fail_list_cnt &&
+	.loc 1 144 46 view .LVU52
+	cmpq	(%rdx), %rsi	# MEM[(long unsigned int *)_75], _39
+	jb	.L24	#,
+	.loc 1 146 13 is_stmt 1 view .LVU53
+# harness.c:146:             fail_list_pos++;
+	.loc 1 146 26 is_stmt 0 view .LVU54
+	addl	$1, %eax	#, fail_list_pos.14_4
+	.loc 1 144 46 is_stmt 1 view .LVU55
+	addq	$8, %rdx	#, ivtmp.110
+	movl	%r8d, %ecx	# fail_list_pos_lsm_flag.103, fail_list_pos_lsm_flag.103
+	cmpl	%eax, %edi	# fail_list_pos.14_4, fail_list_cnt.10_41
+	je	.L25	#,
+# harness.c:146:             fail_list_pos++;
+	.loc 1 146 26 is_stmt 0 view .LVU56
+	movl	%eax, %r9d	# fail_list_pos.14_4, D.5401
+	jmp	.L11	#
+.LVL14:
+.L23:
+	.loc 1 146 26 view .LVU57
+.LBE13:
+.LBE12:
+	.loc 1 253 9 is_stmt 1 view .LVU58
+	leaq	.LC0(%rip), %rsi	#, tmp128
+.LVL15:
+	.loc 1 253 9 is_stmt 0 view .LVU59
+	movl	$2, %edi	#,
+.LVL16:
+	.loc 1 253 9 view .LVU60
+	movl	$0, %eax	#,
+	call	report_event@PLT	#
+.LVL17:
+	.loc 1 254 9 is_stmt 1 view .LVU61
+# harness.c:254:         return NULL;
+	.loc 1 254 16 is_stmt 0 view .LVU62
+	movl	$0, %r12d	#, <retval>
+	jmp	.L7	#
+.LVL18:
+.L25:
+	.loc 1 254 16 view .LVU63
+	movl	%eax, fail_list_pos(%rip)	# fail_list_pos.14_4, fail_list_pos
+.L12:
+.LBB19:
+.LBB18:
+	.loc 1 147 9 is_stmt 1 view .LVU64
+# harness.c:147:         if (fail_list[fail_list_pos - 1] == alloc_seq)
+	.loc 1 147 37 is_stmt 0 view .LVU65
+	subl	$1, %eax	#, tmp136
+# harness.c:147:         if (fail_list[fail_list_pos - 1] == alloc_seq)
+	.loc 1 147 22 view .LVU66
+	cltq
+# harness.c:147:         if (fail_list[fail_list_pos - 1] == alloc_seq)
+	.loc 1 147 12 view .LVU67
+	leaq	fail_list(%rip), %rdx	#, tmp135
+	cmpq	(%rdx,%rax,8), %rsi	# fail_list[_46], _39
+	je	.L20	#,
+.L10:
+	.loc 1 151 5 is_stmt 1 view .LVU68
+# harness.c:151:     if (fail_every > 0 && alloc_seq % fail_every == 0)
+	.loc 1 151 20 is_stmt 0 view .LVU69
+	movl	fail_every(%rip), %eax	# fail_every, fail_every.20_48
+# harness.c:151:     if (fail_every > 0 && alloc_seq % fail_every == 0)
+	.loc 1 151 8 view .LVU70
+	testl	%eax, %eax	# fail_every.20_48
+	jle	.L16	#,
+# harness.c:151:     if (fail_every > 0 && alloc_seq % fail_every == 0)
+	.loc 1 151 37 view .LVU71
+	movslq	%eax, %rcx	# fail_every.20_48, fail_every.20_48
+	movq	%rsi, %rax	# _39, tmp141
+	movl	$0, %edx	#, tmp140
+	divq	%rcx	# fail_every.20_48
+# harness.c:151:     if (fail_every > 0 && alloc_seq % fail_every == 0)
+	.loc 1 151 24 view .LVU72
+	testq	%rdx, %rdx	# tmp140
+	je	.L20	#,
+.L16:
+	.loc 1 154 5 is_stmt 1 view .LVU73
+# harness.c:154:     if (fail_probability <= 0)
+	.loc 1 154 26 is_stmt 0 view .LVU74
+	movl	fail_probability(%rip), %edx	# fail_probability, fail_probability.23_51
+# harness.c:154:     if (fail_probability <= 0)
+	.loc 1 154 8 view .LVU75
+	testl	%edx, %edx	# fail_probability.23_51
+	jle	.L17	#,
+	.loc 1 158 5 is_stmt 1 view .LVU76
+.LBB14:
+.LBI14:
+	.loc 1 127 24 view .LVU77
+.LBB15:
+	.loc 1 129 5 view .LVU78
+# harness.c:129:     uint64_t x = fail_state;
+	.loc 1 129 14 is_stmt 0 view .LVU79
+	movq	fail_state(%rip), %rax	# fail_state, x
+.LVL19:
+	.loc 1 130 5 is_stmt 1 view .LVU80
+# harness.c:130:     x ^= x >> 12;
+	.loc 1 130 12 is_stmt 0 view .LVU81
+	movq	%rax, %rcx	# x, _61
+	shrq	$12, %rcx	#, _61
+# harness.c:130:     x ^= x >> 12;
+	.loc 1 130 7 view .LVU82
+	xorq	%rcx, %rax	# _61, x
+.LVL20:
+	.loc 1 131 5 is_stmt 1 view .LVU83
+# harness.c:131:     x ^= x << 25;
+	.loc 1 131 12 is_stmt 0 view .LVU84
+	movq	%rax, %rcx	# x, _63
+	salq	$25, %rcx	#, _63
+# harness.c:131:     x ^= x << 25;
+	.loc 1 131 7 view .LVU85
+	xorq	%rcx, %rax	# _63, x
+.LVL21:
+	.loc 1 132 5 is_stmt 1 view .LVU86
+# harness.c:132:     x ^= x >> 27;
+	.loc 1 132 12 is_stmt 0 view .LVU87
+	movq	%rax, %rcx	# x, _65
+	shrq	$27, %rcx	#, _65
+# harness.c:132:     x ^= x >> 27;
+	.loc 1 132 7 view .LVU88
+	xorq	%rcx, %rax	# _65, x
+.LVL22:
+	.loc 1 133 5 is_stmt 1 view .LVU89
+# harness.c:133:     fail_state = x;
+	.loc 1 133 16 is_stmt 0 view .LVU90
+	movq	%rax, fail_state(%rip)	# x, fail_state
+	.loc 1 134 5 is_stmt 1 view .LVU91
+.LVL23:
+	.loc 1 134 5 is_stmt 0 view .LVU92
+.LBE15:
+.LBE14:
+	.loc 1 159 5 is_stmt 1 view .LVU93
+.LBB17:
+.LBB16:
+# harness.c:134:     return x * 0x2545F4914F6CDD1DULL;
+	.loc 1 134 14 is_stmt 0 view .LVU94
+	movabsq	$2685821657736338717, %rcx	#, tmp143
+	imulq	%rcx, %rax	# tmp143, tmp142
+.LBE16:
+.LBE17:
+# harness.c:158:     uint64_t weight = ((fail_random() >> 32) * 100) >> 32;
+	.loc 1 158 39 view .LVU95
+	shrq	$32, %rax	#, tmp144
+# harness.c:158:     uint64_t weight = ((fail_random() >> 32) * 100) >> 32;
+	.loc 1 158 46 view .LVU96
+	leaq	(%rax,%rax,4), %rax	#, tmp147
+	leaq	(%rax,%rax,4), %rax	#, tmp149
+# harness.c:158:     uint64_t weight = ((fail_random() >> 32) * 100) >> 32;
+	.loc 1 158 14 view .LVU97
+	shrq	$30, %rax	#, weight
+# harness.c:159:     return weight < (uint64_t) fail_probability;
+	.loc 1 159 21 view .LVU98
+	movslq	%edx, %rdx	# fail_probability.23_51, fail_probability.23_51
+.LBE18:
+.LBE19:
+# harness.c:257:     if (fail_allocation()) {
+	.loc 1 257 8 view .LVU99
+	cmpq	%rdx, %rax	# fail_probability.23_51, weight
+	jb	.L20	#,
+.L17:
+	.loc 1 264 5 is_stmt 1 view .LVU100
+# harness.c:265:         malloc(size + sizeof(block_ele_t) + sizeof(size_t));
+	.loc 1 265 9 is_stmt 0 view .LVU101
+	leaq	48(%rbp), %rdi	#, tmp155
+	call	malloc@PLT	#
+.LVL24:
+	movq	%rax, %rbx	# tmp164, new_block
+.LVL25:
+	.loc 1 266 5 is_stmt 1 view .LVU102
+# harness.c:266:     if (!new_block) {
+	.loc 1 266 8 is_stmt 0 view .LVU103
+	testq	%rax, %rax	# new_block
+	je	.L26	#,
+.LVL26:
+.L18:
+	.loc 1 272 5 is_stmt 1 view .LVU104
+# harness.c:272:     new_block->magic_header = MAGICHEADER;
+	.loc 1 272 29 is_stmt 0 view .LVU105
+	movl	$3735928559, %eax	#, tmp175
+	movq	%rax, 32(%rbx)	# tmp175, new_block_20->magic_header
+	.loc 1 274 5 is_stmt 1 view .LVU106
+# harness.c:274:     new_block->payload_size = size;
+	.loc 1 274 29 is_stmt 0 view .LVU107
+	movq	%rbp, 16(%rbx)	# size, new_block_20->payload_size
+	.loc 1 276 5 is_stmt 1 view .LVU108
+# harness.c:276:     new_block->site = site;
+	.loc 1 276 21 is_stmt 0 view .LVU109
+	movq	%r12, 24(%rbx)	# site, new_block_20->site
+	.loc 1 277 5 is_stmt 1 view .LVU110
+.LVL27:
+.LBB20:
+.LBI20:
+	.loc 1 202 16 view .LVU111
+.LBB21:
+	.loc 1 205 5 view .LVU112
+	.loc 1 206 5 view .LVU113
+	.loc 1 206 5 is_stmt 0 view .LVU114
+.LBE21:
+.LBE20:
+# harness.c:277:     *find_footer(new_block) = MAGICFOOTER;
+	.loc 1 277 29 view .LVU115
+	leaq	-532537410(%rax), %rax	#, tmp176
+	movq	%rax, 40(%rbx,%rbp)	# tmp176, *p_72
+	.loc 1 278 5 is_stmt 1 view .LVU116
+# harness.c:278:     void *p = (void *) &new_block->payload;
+	.loc 1 278 11 is_stmt 0 view .LVU117
+	leaq	40(%rbx), %r12	#, <retval>
+.LVL28:
+	.loc 1 279 5 is_stmt 1 view .LVU118
+	movq	%rbp, %rdx	# size,
+	movl	$85, %esi	#,
+	movq	%r12, %rdi	# <retval>,
+	call	memset@PLT	#
+.LVL29:
+	.loc 1 281 5 view .LVU119
+# harness.c:281:     new_block->next = allocated;
+	.loc 1 281 21 is_stmt 0 view .LVU120
+	movq	allocated(%rip), %rax	# allocated, allocated.3_7
+	movq	%rax, (%rbx)	# allocated.3_7, new_block_20->next
+	.loc 1 283 5 is_stmt 1 view .LVU121
+# harness.c:283:     new_block->prev = NULL;
+	.loc 1 283 21 is_stmt 0 view .LVU122
+	movq	$0, 8(%rbx)	#, new_block_20->prev
+	.loc 1 285 5 is_stmt 1 view .LVU123
+# harness.c:285:     if (allocated)
+	.loc 1 285 8 is_stmt 0 view .LVU124
+	testq	%rax, %rax	# allocated.3_7
+	je	.L19	#,
+	.loc 1 286 9 is_stmt 1 view .LVU125
+# harness.c:286:         allocated->prev = new_block;
+	.loc 1 286 25 is_stmt 0 view .LVU126
+	movq	%rbx, 8(%rax)	# new_block, allocated.3_7->prev
+.L19:
+	.loc 1 287 5 is_stmt 1 view .LVU127
+# harness.c:287:     allocated = new_block;
+	.loc 1 287 15 is_stmt 0 view .LVU128
+	movq	%rbx, allocated(%rip)	# new_block, allocated
+	.loc 1 288 5 is_stmt 1 view .LVU129
+# harness.c:288:     allocated_count++;
+	.loc 1 288 20 is_stmt 0 view .LVU130
+	addq	$1, allocated_count(%rip)	#, allocated_count
+	.loc 1 289 5 is_stmt 1 view .LVU131
+# harness.c:289:     allocated_bytes += size;
+	.loc 1 289 21 is_stmt 0 view .LVU132
+	addq	%rbp, allocated_bytes(%rip)	# size, allocated_bytes
+	.loc 1 291 5 is_stmt 1 view .LVU133
+.LVL30:
+.L7:
+# harness.c:292: }
+	.loc 1 292 1 is_stmt 0 view .LVU134
+	movq	%r12, %rax	# <retval>,
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL31:
+.L24:
+	.cfi_restore_state
+	.loc 1 292 1 view .LVU135
+	testb	%cl, %cl	# fail_list_pos_lsm_flag.103
+	je	.L12	#,
+	movl	%r9d, fail_list_pos(%rip)	# D.5401, fail_list_pos
+	jmp	.L12	#
+.L20:
+	.loc 1 258 9 is_stmt 1 view .LVU136
+	movl	fail_seed(%rip), %ecx	# fail_seed,
+	movq	%rsi, %rdx	# _39,
+	leaq	.LC1(%rip), %rsi	#, tmp154
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+	call	report_event@PLT	#
+.LVL32:
+	.loc 1 261 9 view .LVU137
+# harness.c:261:         return NULL;
+	.loc 1 261 16 is_stmt 0 view .LVU138
+	movl	$0, %r12d	#, <retval>
+.LVL33:
+	.loc 1 261 16 view .LVU139
+	jmp	.L7	#
+.LVL34:
+.L26:
+	.loc 1 267 9 is_stmt 1 view .LVU140
+	leaq	.LC2(%rip), %rsi	#, tmp157
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+.LVL35:
+	.loc 1 267 9 is_stmt 0 view .LVU141
+	call	report_event@PLT	#
+.LVL36:
+	.loc 1 268 9 is_stmt 1 view .LVU142
+# harness.c:268:         error_occurred = true;
+	.loc 1 268 24 is_stmt 0 view .LVU143
+	movb	$1, error_occurred(%rip)	#, error_occurred
+	jmp	.L18	#
+	.cfi_endproc
+.LFE32:
+	.size	alloc_block, .-alloc_block
+	.section	.rodata.str1.1
+.LC3:
+	.string	"%s+%#lx"
+.LC4:
+	.string	"%p"
+	.text
+	.type	format_site, @function
+format_site:
+.LVL37:
+.LFB25:
+	.loc 1 26 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 26 1 is_stmt 0 view .LVU145
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$40, %rsp	#,
+	.cfi_def_cfa_offset 80
+	movq	%rdi, %rbp	# tmp97, buf
+	movq	%rsi, %r12	# tmp98, buf_size
+	movq	%rdx, %rbx	# tmp99, site
+	.loc 1 27 5 is_stmt 1 view .LVU146
+	.loc 1 28 5 view .LVU147
+# harness.c:28:     if (site && dladdr(site, &info) && info.dli_fname) {
+	.loc 1 28 8 is_stmt 0 view .LVU148
+	testq	%rdx, %rdx	# site
+	je	.L28	#,
+# harness.c:28:     if (site && dladdr(site, &info) && info.dli_fname) {
+	.loc 1 28 17 discriminator 1 view .LVU149
+	movq	%rsp, %rsi	#, tmp91
+.LVL38:
+	.loc 1 28 17 discriminator 1 view .LVU150
+	movq	%rdx, %rdi	# site,
+.LVL39:
+	.loc 1 28 17 discriminator 1 view .LVU151
+	call	dladdr@PLT	#
+.LVL40:
+# harness.c:28:     if (site && dladdr(site, &info) && info.dli_fname) {
+	.loc 1 28 14 discriminator 1 view .LVU152
+	testl	%eax, %eax	# tmp100
+	je	.L28	#,
+# harness.c:28:     if (site && dladdr(site, &info) && info.dli_fname) {
+	.loc 1 28 44 discriminator 2 view .LVU153
+	movq	(%rsp), %r13	# info.dli_fname, iftmp.46_6
+# harness.c:28:     if (site && dladdr(site, &info) && info.dli_fname) {
+	.loc 1 28 37 discriminator 2 view .LVU154
+	testq	%r13, %r13	# iftmp.46_6
+	je	.L28	#,
+.LBB22:
+	.loc 1 29 9 is_stmt 1 view .LVU155
+# harness.c:29:         const char *name = strrchr(info.dli_fname, '/');
+	.loc 1 29 28 is_stmt 0 view .LVU156
+	movl	$47, %esi	#,
+	movq	%r13, %rdi	# iftmp.46_6,
+	call	strrchr@PLT	#
+.LVL41:
+	.loc 1 30 9 is_stmt 1 view .LVU157
+# harness.c:30:         name = name ? name + 1 : info.dli_fname;
+	.loc 1 30 32 is_stmt 0 view .LVU158
+	leaq	1(%rax), %rdx	#, tmp95
+	testq	%rax, %rax	# name
+	cmovne	%rdx, %r13	# tmp95,, iftmp.46_6
+.LVL42:
+	.loc 1 31 9 is_stmt 1 view .LVU159
+	subq	8(%rsp), %rbx	# info.dli_fbase, site
+.LVL43:
+	.loc 1 31 9 is_stmt 0 view .LVU160
+	movq	%rbx, %r8	# site,
+	movq	%r13, %rcx	# iftmp.46_6,
+	leaq	.LC3(%rip), %rdx	#, tmp93
+	movq	%r12, %rsi	# buf_size,
+	movq	%rbp, %rdi	# buf,
+	movl	$0, %eax	#,
+	call	snprintf@PLT	#
+.LVL44:
+.LBE22:
+# harness.c:28:     if (site && dladdr(site, &info) && info.dli_fname) {
+	.loc 1 28 56 view .LVU161
+	jmp	.L27	#
+.LVL45:
+.L28:
+	.loc 1 34 9 is_stmt 1 view .LVU162
+	movq	%rbx, %rcx	# site,
+	leaq	.LC4(%rip), %rdx	#, tmp94
+	movq	%r12, %rsi	# buf_size,
+	movq	%rbp, %rdi	# buf,
+	movl	$0, %eax	#,
+	call	snprintf@PLT	#
+.LVL46:
+.L27:
+# harness.c:36: }
+	.loc 1 36 1 is_stmt 0 view .LVU163
+	addq	$40, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+.LVL47:
+	.loc 1 36 1 view .LVU164
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL48:
+	.loc 1 36 1 view .LVU165
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE25:
+	.size	format_site, .-format_site
+	.section	.rodata.str1.1
+.LC5:
+	.string	""
+.LC6:
+	.string	"..."
+.LC7:
+	.string	" %.2x"
+.LC8:
+	.string	"%.2x"
+.LC9:
+	.string	"\"%.*s\"%s"
+.LC10:
+	.string	" ..."
+.LC11:
+	.string	"(empty)"
+	.text
+	.type	format_sample, @function
+format_sample:
+.LVL49:
+.LFB45:
+	.loc 1 471 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 471 1 is_stmt 0 view .LVU167
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %r15	# tmp137, buf
+	movq	%rsi, %r14	# tmp138, buf_size
+	movq	%rdx, %r12	# tmp139, b
+	.loc 1 472 5 is_stmt 1 view .LVU168
+.LVL50:
+	.loc 1 473 5 view .LVU169
+# harness.c:473:     size_t n = b->payload_size;
+	.loc 1 473 12 is_stmt 0 view .LVU170
+	movq	16(%rdx), %r13	# b_34(D)->payload_size, n
+.LVL51:
+	.loc 1 474 5 is_stmt 1 view .LVU171
+	.loc 1 475 5 view .LVU172
+	.loc 1 475 30 view .LVU173
+# harness.c:474:     size_t len = 0;
+	.loc 1 474 12 is_stmt 0 view .LVU174
+	movl	$0, %ebp	#, len
+# harness.c:475:     while (len < n && p[len] && isprint(p[len]))
+	.loc 1 475 30 view .LVU175
+	testq	%r13, %r13	# n
+	je	.L57	#,
+.LVL52:
+.L33:
+# harness.c:475:     while (len < n && p[len] && isprint(p[len]))
+	.loc 1 475 24 discriminator 1 view .LVU176
+	movzbl	40(%r12,%rbp), %ebx	# MEM[(unsigned char *)b_34(D) + 40B + len_60 * 1], _2
+# harness.c:475:     while (len < n && p[len] && isprint(p[len]))
+	.loc 1 475 20 discriminator 1 view .LVU177
+	testb	%bl, %bl	# _2
+	je	.L36	#,
+# harness.c:475:     while (len < n && p[len] && isprint(p[len]))
+	.loc 1 475 33 discriminator 2 view .LVU178
+	call	__ctype_b_loc@PLT	#
+.LVL53:
+	movzbl	%bl, %ebx	# _2, _2
+	movq	(%rax), %rax	# *_3, *_3
+# harness.c:475:     while (len < n && p[len] && isprint(p[len]))
+	.loc 1 475 30 discriminator 2 view .LVU179
+	testb	$64, 1(%rax,%rbx,2)	#, *_7
+	je	.L36	#,
+	.loc 1 476 9 is_stmt 1 view .LVU180
+# harness.c:476:         len++;
+	.loc 1 476 12 is_stmt 0 view .LVU181
+	addq	$1, %rbp	#, len
+.LVL54:
+	.loc 1 475 30 is_stmt 1 view .LVU182
+	cmpq	%rbp, %r13	# len, n
+	jne	.L33	#,
+	jmp	.L35	#
+.L36:
+	.loc 1 478 5 view .LVU183
+# harness.c:478:     if (len < n && !p[len]) {
+	.loc 1 478 8 is_stmt 0 view .LVU184
+	cmpq	%r13, %rbp	# n, len
+	jnb	.L35	#,
+# harness.c:472:     unsigned char *p = b->payload;
+	.loc 1 472 20 discriminator 1 view .LVU185
+	leaq	40(%r12), %r8	#, p
+# harness.c:478:     if (len < n && !p[len]) {
+	.loc 1 478 17 discriminator 1 view .LVU186
+	cmpb	$0, 40(%r12,%rbp)	#, *_11
+	je	.L58	#,
+.L35:
+.LVL55:
+.LBB23:
+# harness.c:486:     for (size_t i = 0; i < n && i < 16 && pos + 4 < buf_size; i++)
+	.loc 1 486 40 view .LVU187
+	movl	$0, %ebx	#, i
+	movl	$0, %ebp	#, pos
+.LVL56:
+	.loc 1 486 40 view .LVU188
+	cmpq	$4, %r14	#, buf_size
+	jbe	.L32	#,
+.LVL57:
+.L39:
+	.loc 1 487 9 is_stmt 1 view .LVU189
+# harness.c:487:         pos += snprintf(buf + pos, buf_size - pos, i ? " %.2x" : "%.2x", p[i]);
+	.loc 1 487 16 is_stmt 0 view .LVU190
+	movzbl	40(%r12,%rbx), %ecx	# MEM[(unsigned char *)b_34(D) + 40B + i_64 * 1], _15
+	testq	%rbx, %rbx	# i
+	leaq	.LC7(%rip), %rdx	#, iftmp.60_30
+	leaq	.LC8(%rip), %rax	#, tmp144
+	cmove	%rax, %rdx	# tmp144,, iftmp.60_30
+	movq	%r14, %rsi	# buf_size, tmp121
+	subq	%rbp, %rsi	# pos, tmp121
+	leaq	(%r15,%rbp), %rdi	#, tmp122
+	movl	$0, %eax	#,
+	call	snprintf@PLT	#
+.LVL58:
+	cltq
+# harness.c:487:         pos += snprintf(buf + pos, buf_size - pos, i ? " %.2x" : "%.2x", p[i]);
+	.loc 1 487 13 view .LVU191
+	addq	%rax, %rbp	# _47, pos
+.LVL59:
+	.loc 1 486 64 is_stmt 1 view .LVU192
+	addq	$1, %rbx	#, i
+.LVL60:
+	.loc 1 486 40 view .LVU193
+	cmpq	%r13, %rbx	# n, i
+	jnb	.L44	#,
+# harness.c:486:     for (size_t i = 0; i < n && i < 16 && pos + 4 < buf_size; i++)
+	.loc 1 486 40 is_stmt 0 discriminator 4 view .LVU194
+	cmpq	$15, %rbx	#, i
+	ja	.L44	#,
+# harness.c:486:     for (size_t i = 0; i < n && i < 16 && pos + 4 < buf_size; i++)
+	.loc 1 486 47 discriminator 3 view .LVU195
+	leaq	4(%rbp), %rax	#, tmp128
+# harness.c:486:     for (size_t i = 0; i < n && i < 16 && pos + 4 < buf_size; i++)
+	.loc 1 486 40 discriminator 3 view .LVU196
+	cmpq	%r14, %rax	# buf_size, tmp128
+	jb	.L39	#,
+.LVL61:
+.L32:
+	.loc 1 486 40 discriminator 3 view .LVU197
+.LBE23:
+# harness.c:492: }
+	.loc 1 492 1 view .LVU198
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL62:
+	.loc 1 492 1 view .LVU199
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL63:
+	.loc 1 492 1 view .LVU200
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL64:
+	.loc 1 492 1 view .LVU201
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL65:
+	.loc 1 492 1 view .LVU202
+	ret	
+.LVL66:
+.L58:
+	.cfi_restore_state
+	.loc 1 479 9 is_stmt 1 view .LVU203
+	leaq	.LC6(%rip), %r9	#, iftmp.58_45
+	movl	$40, %ecx	#, iftmp.59_29
+	cmpq	$40, %rbp	#, len
+	ja	.L41	#,
+# harness.c:479:         snprintf(buf, buf_size, "\"%.*s\"%s",
+	.loc 1 479 9 is_stmt 0 discriminator 4 view .LVU204
+	cmpq	$39, %rbp	#, len
+	cmovbe	%ebp, %ecx	# len,, iftmp.59_29
+	leaq	.LC5(%rip), %r9	#, iftmp.58_45
+.L41:
+# harness.c:479:         snprintf(buf, buf_size, "\"%.*s\"%s",
+	.loc 1 479 9 discriminator 8 view .LVU205
+	leaq	.LC9(%rip), %rdx	#, tmp120
+	movq	%r14, %rsi	# buf_size,
+	movq	%r15, %rdi	# buf,
+	movl	$0, %eax	#,
+	call	snprintf@PLT	#
+.LVL67:
+	.loc 1 482 9 is_stmt 1 discriminator 8 view .LVU206
+	jmp	.L32	#
+.LVL68:
+.L44:
+	.loc 1 488 5 view .LVU207
+# harness.c:488:     if (n > 16 && pos + 4 < buf_size)
+	.loc 1 488 8 is_stmt 0 view .LVU208
+	cmpq	$16, %r13	#, n
+	jbe	.L32	#,
+# harness.c:488:     if (n > 16 && pos + 4 < buf_size)
+	.loc 1 488 23 discriminator 1 view .LVU209
+	leaq	4(%rbp), %rax	#, tmp129
+# harness.c:488:     if (n > 16 && pos + 4 < buf_size)
+	.loc 1 488 16 discriminator 1 view .LVU210
+	cmpq	%r14, %rax	# buf_size, tmp129
+	jnb	.L32	#,
+	.loc 1 489 9 is_stmt 1 view .LVU211
+	movq	%r14, %rsi	# buf_size, buf_size
+	subq	%rbp, %rsi	# pos, buf_size
+	leaq	(%r15,%rbp), %rdi	#, tmp131
+	leaq	.LC10(%rip), %rdx	#, tmp132
+	movl	$0, %eax	#,
+	call	snprintf@PLT	#
+.LVL69:
+	jmp	.L32	#
+.LVL70:
+.L57:
+.LBB24:
+	.loc 1 486 40 view .LVU212
+.LBE24:
+	.loc 1 490 5 view .LVU213
+	.loc 1 491 9 view .LVU214
+	leaq	.LC11(%rip), %rdx	#, tmp133
+.LVL71:
+	.loc 1 491 9 is_stmt 0 view .LVU215
+	movl	$0, %eax	#,
+	call	snprintf@PLT	#
+.LVL72:
+	.loc 1 491 9 view .LVU216
+	jmp	.L32	#
+	.cfi_endproc
+.LFE45:
+	.size	format_sample, .-format_sample
+	.section	.rodata.str1.8
+	.align 8
+.LC12:
+	.string	"Write to freed block with address %p (%lu bytes, allocated from %s)"
+	.text
+	.type	trim_quarantine, @function
+trim_quarantine:
+.LVL73:
+.LFB31:
+	.loc 1 231 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 231 1 is_stmt 0 view .LVU218
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$152, %rsp	#,
+	.cfi_def_cfa_offset 208
+	.loc 1 232 5 is_stmt 1 view .LVU219
+# harness.c:232:     size_t max_bytes = max_kb > 0 ? (size_t) max_kb << 10 : 0;
+	.loc 1 232 59 is_stmt 0 view .LVU220
+	movslq	%esi, %rax	# max_kb, max_kb
+	salq	$10, %rax	#, tmp132
+	testl	%esi, %esi	# max_kb
+	movl	$0, %edx	#, tmp131
+	cmovg	%rax, %rdx	# tmp132,, tmp131
+	movq	%rdx, 8(%rsp)	# tmp131, %sfp
+.LVL74:
+	.loc 1 233 5 is_stmt 1 view .LVU221
+# harness.c:233:     if (max_blocks < 0)
+	.loc 1 233 8 is_stmt 0 view .LVU222
+	testl	%edi, %edi	# tmp138
+	movl	$0, %eax	#, tmp143
+	cmovs	%eax, %edi	# tmp138,, tmp143, _23
+.LVL75:
+	.loc 1 235 28 is_stmt 1 view .LVU223
+# harness.c:235:     while (quarantine_head &&
+	.loc 1 235 12 is_stmt 0 view .LVU224
+	movq	quarantine_head(%rip), %rbx	# quarantine_head, quarantine_head.41_7
+# harness.c:236:            (quarantine_count > (size_t) max_blocks || quarantine_bytes > max_bytes)) {
+	.loc 1 236 32 view .LVU225
+	movslq	%edi, %r14	# _23, _23
+.LBB31:
+.LBB32:
+.LBB33:
+# harness.c:214:     bool intact = b->magic_header == MAGICFREE && *find_footer(b) == MAGICFREE;
+	.loc 1 214 48 view .LVU226
+	movl	$4294967295, %r12d	#, tmp135
+.LBB34:
+# harness.c:219:         format_site(site, sizeof(site), b->site);
+	.loc 1 219 9 view .LVU227
+	leaq	16(%rsp), %r15	#, tmp136
+.LBE34:
+.LBE33:
+.LBE32:
+.LBE31:
+# harness.c:235:     while (quarantine_head &&
+	.loc 1 235 28 view .LVU228
+	testq	%rbx, %rbx	# quarantine_head.41_7
+	jne	.L61	#,
+	jmp	.L59	#
+.LVL76:
+.L67:
+.LBB42:
+	.loc 1 237 9 is_stmt 1 view .LVU229
+	.loc 1 238 9 view .LVU230
+# harness.c:238:         quarantine_head = b->next;
+	.loc 1 238 28 is_stmt 0 view .LVU231
+	movq	(%rbx), %rdx	# quarantine_head.41_22->next, _2
+# harness.c:238:         quarantine_head = b->next;
+	.loc 1 238 25 view .LVU232
+	movq	%rdx, quarantine_head(%rip)	# _2, quarantine_head
+	.loc 1 239 9 is_stmt 1 view .LVU233
+# harness.c:239:         if (!quarantine_head)
+	.loc 1 239 12 is_stmt 0 view .LVU234
+	testq	%rdx, %rdx	# _2
+	je	.L71	#,
+.L63:
+	.loc 1 241 9 is_stmt 1 view .LVU235
+# harness.c:241:         quarantine_count--;
+	.loc 1 241 25 is_stmt 0 view .LVU236
+	subq	$1, %rax	#, tmp112
+	movq	%rax, quarantine_count(%rip)	# tmp112, quarantine_count
+	.loc 1 242 9 is_stmt 1 view .LVU237
+# harness.c:242:         quarantine_bytes -= b->payload_size;
+	.loc 1 242 30 is_stmt 0 view .LVU238
+	movq	16(%rbx), %rbp	# quarantine_head.41_22->payload_size, _5
+# harness.c:242:         quarantine_bytes -= b->payload_size;
+	.loc 1 242 26 view .LVU239
+	subq	%rbp, quarantine_bytes(%rip)	# _5, quarantine_bytes
+	.loc 1 243 9 is_stmt 1 view .LVU240
+.LVL77:
+.LBB40:
+.LBI32:
+	.loc 1 210 13 view .LVU241
+.LBB38:
+	.loc 1 212 5 view .LVU242
+# harness.c:212:     unsigned char *p = b->payload;
+	.loc 1 212 20 is_stmt 0 view .LVU243
+	leaq	40(%rbx), %r13	#, p
+.LVL78:
+	.loc 1 213 5 is_stmt 1 view .LVU244
+	.loc 1 214 5 view .LVU245
+# harness.c:214:     bool intact = b->magic_header == MAGICFREE && *find_footer(b) == MAGICFREE;
+	.loc 1 214 48 is_stmt 0 view .LVU246
+	cmpq	%r12, 32(%rbx)	# tmp135, quarantine_head.41_22->magic_header
+	je	.L72	#,
+.L64:
+.LBB35:
+	.loc 1 218 9 is_stmt 1 view .LVU247
+	.loc 1 219 9 view .LVU248
+	movq	24(%rbx), %rdx	# quarantine_head.41_22->site, quarantine_head.41_22->site
+	movl	$128, %esi	#,
+	movq	%r15, %rdi	# tmp136,
+	call	format_site	#
+.LVL79:
+	.loc 1 220 9 view .LVU249
+	movq	%r15, %r8	# tmp136,
+	movq	%rbp, %rcx	# _5,
+	movq	%r13, %rdx	# p,
+	leaq	.LC12(%rip), %rsi	#,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report_event@PLT	#
+.LVL80:
+	.loc 1 224 9 view .LVU250
+# harness.c:224:         error_occurred = true;
+	.loc 1 224 24 is_stmt 0 view .LVU251
+	movb	$1, error_occurred(%rip)	#, error_occurred
+.L66:
+	.loc 1 224 24 view .LVU252
+.LBE35:
+	.loc 1 226 5 is_stmt 1 view .LVU253
+	movq	%rbx, %rdi	# quarantine_head.41_7,
+	call	free@PLT	#
+.LVL81:
+	.loc 1 226 5 is_stmt 0 view .LVU254
+.LBE38:
+.LBE40:
+.LBE42:
+	.loc 1 235 28 is_stmt 1 view .LVU255
+# harness.c:235:     while (quarantine_head &&
+	.loc 1 235 12 is_stmt 0 view .LVU256
+	movq	quarantine_head(%rip), %rbx	# quarantine_head, quarantine_head.41_7
+.LVL82:
+# harness.c:235:     while (quarantine_head &&
+	.loc 1 235 28 view .LVU257
+	testq	%rbx, %rbx	# quarantine_head.41_7
+	je	.L59	#,
+.LVL83:
+.L61:
+# harness.c:236:            (quarantine_count > (size_t) max_blocks || quarantine_bytes > max_bytes)) {
+	.loc 1 236 30 discriminator 1 view .LVU258
+	movq	quarantine_count(%rip), %rax	# quarantine_count, quarantine_count.42_9
+# harness.c:235:     while (quarantine_head &&
+	.loc 1 235 28 discriminator 1 view .LVU259
+	cmpq	%rax, %r14	# quarantine_count.42_9, _23
+	jb	.L67	#,
+# harness.c:236:            (quarantine_count > (size_t) max_blocks || quarantine_bytes > max_bytes)) {
+	.loc 1 236 52 view .LVU260
+	movq	8(%rsp), %rcx	# %sfp, iftmp.37_11
+	cmpq	quarantine_bytes(%rip), %rcx	# quarantine_bytes, iftmp.37_11
+	jb	.L67	#,
+.L59:
+# harness.c:245: }
+	.loc 1 245 1 view .LVU261
+	addq	$152, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL84:
+.L71:
+	.cfi_restore_state
+.LBB43:
+	.loc 1 240 13 is_stmt 1 view .LVU262
+# harness.c:240:             quarantine_tail = NULL;
+	.loc 1 240 29 is_stmt 0 view .LVU263
+	movq	$0, quarantine_tail(%rip)	#, quarantine_tail
+	jmp	.L63	#
+.LVL85:
+.L72:
+.LBB41:
+.LBB39:
+.LBB36:
+.LBI36:
+	.loc 1 202 16 is_stmt 1 view .LVU264
+.LBB37:
+	.loc 1 205 5 view .LVU265
+	.loc 1 206 5 view .LVU266
+	.loc 1 206 5 is_stmt 0 view .LVU267
+.LBE37:
+.LBE36:
+# harness.c:214:     bool intact = b->magic_header == MAGICFREE && *find_footer(b) == MAGICFREE;
+	.loc 1 214 51 view .LVU268
+	movq	40(%rbx,%rbp), %rax	# *p_42, _28
+.LVL86:
+	.loc 1 215 5 is_stmt 1 view .LVU269
+# harness.c:215:     if (intact && n > 0)
+	.loc 1 215 8 is_stmt 0 view .LVU270
+	cmpq	%r12, %rax	# tmp135, _28
+	jne	.L65	#,
+	testq	%rbp, %rbp	# _5
+	je	.L65	#,
+	.loc 1 216 9 is_stmt 1 view .LVU271
+# harness.c:216:         intact = p[0] == FREECHAR && !memcmp(p, p + 1, n - 1);
+	.loc 1 216 35 is_stmt 0 view .LVU272
+	cmpb	$-1, 40(%rbx)	#, MEM[(unsigned char *)quarantine_head.41_22 + 40B]
+	jne	.L64	#,
+# harness.c:216:         intact = p[0] == FREECHAR && !memcmp(p, p + 1, n - 1);
+	.loc 1 216 39 view .LVU273
+	leaq	-1(%rbp), %rdx	#, tmp121
+# harness.c:216:         intact = p[0] == FREECHAR && !memcmp(p, p + 1, n - 1);
+	.loc 1 216 51 view .LVU274
+	leaq	41(%rbx), %rsi	#, tmp122
+# harness.c:216:         intact = p[0] == FREECHAR && !memcmp(p, p + 1, n - 1);
+	.loc 1 216 39 view .LVU275
+	movq	%r13, %rdi	# p,
+	call	memcmp@PLT	#
+.LVL87:
+# harness.c:216:         intact = p[0] == FREECHAR && !memcmp(p, p + 1, n - 1);
+	.loc 1 216 35 view .LVU276
+	testl	%eax, %eax	# tmp140
+	je	.L66	#,
+	jmp	.L64	#
+.LVL88:
+.L65:
+	.loc 1 217 5 is_stmt 1 view .LVU277
+# harness.c:217:     if (!intact) {
+	.loc 1 217 8 is_stmt 0 view .LVU278
+	cmpq	%r12, %rax	# tmp135, _28
+	je	.L66	#,
+	jmp	.L64	#
+.LBE39:
+.LBE41:
+.LBE43:
+	.cfi_endproc
+.LFE31:
+	.size	trim_quarantine, .-trim_quarantine
+	.globl	test_malloc
+	.type	test_malloc, @function
+test_malloc:
+.LVL89:
+.LFB33:
+	.loc 1 295 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 295 1 is_stmt 0 view .LVU280
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 296 5 is_stmt 1 view .LVU281
+# harness.c:296:     return alloc_block(size, __builtin_return_address(0));
+	.loc 1 296 12 is_stmt 0 view .LVU282
+	movq	8(%rsp), %rsi	#,
+	call	alloc_block	#
+.LVL90:
+# harness.c:297: }
+	.loc 1 297 1 view .LVU283
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE33:
+	.size	test_malloc, .-test_malloc
+	.globl	test_calloc
+	.type	test_calloc, @function
+test_calloc:
+.LVL91:
+.LFB34:
+	.loc 1 301 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 301 1 is_stmt 0 view .LVU285
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 305 5 is_stmt 1 view .LVU286
+# harness.c:305:     size_t size = nelem * elsize;  // TODO: check for overflow
+	.loc 1 305 12 is_stmt 0 view .LVU287
+	imulq	%rsi, %rdi	# tmp94, tmp93
+.LVL92:
+	.loc 1 305 12 view .LVU288
+	movq	%rdi, %rbp	# tmp93, size
+.LVL93:
+	.loc 1 306 5 is_stmt 1 view .LVU289
+# harness.c:306:     void *ptr = alloc_block(size, __builtin_return_address(0));
+	.loc 1 306 17 is_stmt 0 view .LVU290
+	movq	24(%rsp), %rsi	#,
+.LVL94:
+	.loc 1 306 17 view .LVU291
+	call	alloc_block	#
+.LVL95:
+	.loc 1 307 5 is_stmt 1 view .LVU292
+	movq	%rbp, %rdx	# size,
+	movl	$0, %esi	#,
+	movq	%rax, %rdi	# <retval>,
+	call	memset@PLT	#
+.LVL96:
+	.loc 1 308 5 view .LVU293
+# harness.c:309: }
+	.loc 1 309 1 is_stmt 0 view .LVU294
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL97:
+	.loc 1 309 1 view .LVU295
+	ret	
+	.cfi_endproc
+.LFE34:
+	.size	test_calloc, .-test_calloc
+	.section	.rodata.str1.1
+.LC13:
+	.string	"Calls to free disallowed"
+	.section	.rodata.str1.8
+	.align 8
+.LC14:
+	.string	"Attempted to free unallocated block.  Address = %p"
+	.align 8
+.LC15:
+	.string	"Attempted to free unallocated or corrupted block.  Address = %p"
+	.align 8
+.LC16:
+	.string	"Corruption detected in block with address %p when attempting to free it"
+	.text
+	.globl	test_free
+	.type	test_free, @function
+test_free:
+.LVL98:
+.LFB35:
+	.loc 1 312 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 312 1 is_stmt 0 view .LVU297
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 313 5 is_stmt 1 view .LVU298
+# harness.c:313:     if (noallocate_mode) {
+	.loc 1 313 8 is_stmt 0 view .LVU299
+	cmpb	$0, noallocate_mode(%rip)	#, noallocate_mode
+	jne	.L94	#,
+	movq	%rdi, %rbx	# tmp138, p
+	.loc 1 318 5 is_stmt 1 view .LVU300
+# harness.c:318:     if (!p)
+	.loc 1 318 8 is_stmt 0 view .LVU301
+	testq	%rdi, %rdi	# p
+	je	.L77	#,
+	.loc 1 321 5 is_stmt 1 view .LVU302
+.LVL99:
+.LBB51:
+.LBI51:
+	.loc 1 166 21 view .LVU303
+.LBB52:
+	.loc 1 168 5 view .LVU304
+	.loc 1 173 5 view .LVU305
+# harness.c:173:     block_ele_t *b = (block_ele_t *) ((size_t) p - sizeof(block_ele_t));
+	.loc 1 173 50 is_stmt 0 view .LVU306
+	leaq	-40(%rdi), %rbp	#, b
+.LVL100:
+	.loc 1 174 5 is_stmt 1 view .LVU307
+# harness.c:174:     if (cautious_mode) {
+	.loc 1 174 8 is_stmt 0 view .LVU308
+	cmpb	$0, cautious_mode(%rip)	#, cautious_mode
+	je	.L80	#,
+.LBB53:
+	.loc 1 176 9 is_stmt 1 view .LVU309
+# harness.c:176:         block_ele_t *ab = allocated;
+	.loc 1 176 22 is_stmt 0 view .LVU310
+	movq	allocated(%rip), %rax	# allocated, ab
+.LVL101:
+	.loc 1 177 9 is_stmt 1 view .LVU311
+	.loc 1 178 9 view .LVU312
+	.loc 1 178 19 view .LVU313
+	testq	%rax, %rax	# ab
+	je	.L81	#,
+.LVL102:
+.L82:
+	.loc 1 179 13 view .LVU314
+	.loc 1 180 13 view .LVU315
+	movq	%rax, %rdx	# ab, ab
+# harness.c:180:             ab = ab->next;
+	.loc 1 180 16 is_stmt 0 view .LVU316
+	movq	(%rax), %rax	# ab_63->next, ab
+.LVL103:
+	.loc 1 178 19 is_stmt 1 view .LVU317
+	testq	%rax, %rax	# ab
+	je	.L91	#,
+	cmpq	%rdx, %rbp	# ab, b
+	jne	.L82	#,
+.L91:
+	.loc 1 182 9 view .LVU318
+# harness.c:182:         if (!found) {
+	.loc 1 182 12 is_stmt 0 view .LVU319
+	cmpq	%rdx, %rbp	# ab, b
+	jne	.L81	#,
+.LVL104:
+.L80:
+	.loc 1 182 12 view .LVU320
+.LBE53:
+	.loc 1 190 5 is_stmt 1 view .LVU321
+# harness.c:190:     if (b->magic_header != MAGICHEADER) {
+	.loc 1 190 8 is_stmt 0 view .LVU322
+	movl	$3735928559, %eax	#, tmp124
+	cmpq	%rax, 32(%rbp)	# tmp124, b_51->magic_header
+	jne	.L95	#,
+.LVL105:
+.L84:
+	.loc 1 190 8 view .LVU323
+.LBE52:
+.LBE51:
+	.loc 1 326 5 is_stmt 1 view .LVU324
+.LBB56:
+.LBI56:
+	.loc 1 202 16 view .LVU325
+.LBB57:
+	.loc 1 205 5 view .LVU326
+	.loc 1 206 5 view .LVU327
+	.loc 1 206 5 is_stmt 0 view .LVU328
+.LBE57:
+.LBE56:
+	.loc 1 327 5 is_stmt 1 view .LVU329
+# harness.c:326:     size_t footer = *find_footer(b);
+	.loc 1 326 12 is_stmt 0 view .LVU330
+	movq	16(%rbp), %rdx	# b_51->payload_size, b_51->payload_size
+# harness.c:327:     if (footer != MAGICFOOTER) {
+	.loc 1 327 8 view .LVU331
+	movl	$3203391149, %eax	#, tmp128
+	cmpq	%rax, (%rbx,%rdx)	# tmp128, *p_66
+	jne	.L96	#,
+.LVL106:
+.L85:
+	.loc 1 334 5 is_stmt 1 view .LVU332
+# harness.c:334:     b->magic_header = MAGICFREE;
+	.loc 1 334 21 is_stmt 0 view .LVU333
+	movl	$4294967295, %ecx	#, tmp141
+	movq	%rcx, 32(%rbp)	# tmp141, b_51->magic_header
+	.loc 1 335 5 is_stmt 1 view .LVU334
+.LVL107:
+.LBB58:
+.LBI58:
+	.loc 1 202 16 view .LVU335
+.LBB59:
+	.loc 1 205 5 view .LVU336
+	.loc 1 206 5 view .LVU337
+	.loc 1 206 5 is_stmt 0 view .LVU338
+.LBE59:
+.LBE58:
+# harness.c:335:     *find_footer(b) = MAGICFREE;
+	.loc 1 335 21 view .LVU339
+	movq	16(%rbp), %rax	# b_51->payload_size, b_51->payload_size
+	movq	%rcx, (%rbx,%rax)	# tmp142, *p_71
+	.loc 1 336 5 is_stmt 1 view .LVU340
+	movq	16(%rbp), %rdx	# b_51->payload_size, b_51->payload_size
+	movl	$255, %esi	#,
+	movq	%rbx, %rdi	# p,
+	call	memset@PLT	#
+.LVL108:
+	.loc 1 339 5 view .LVU341
+# harness.c:339:     block_ele_t *bn = b->next;
+	.loc 1 339 18 is_stmt 0 view .LVU342
+	movq	-40(%rbx), %rax	# b_51->next, bn
+.LVL109:
+	.loc 1 340 5 is_stmt 1 view .LVU343
+# harness.c:340:     block_ele_t *bp = b->prev;
+	.loc 1 340 18 is_stmt 0 view .LVU344
+	movq	8(%rbp), %rdx	# b_51->prev, bp
+.LVL110:
+	.loc 1 341 5 is_stmt 1 view .LVU345
+# harness.c:341:     if (bp)
+	.loc 1 341 8 is_stmt 0 view .LVU346
+	testq	%rdx, %rdx	# bp
+	je	.L86	#,
+	.loc 1 342 9 is_stmt 1 view .LVU347
+# harness.c:342:         bp->next = bn;
+	.loc 1 342 18 is_stmt 0 view .LVU348
+	movq	%rax, (%rdx)	# bn, bp_35->next
+.L87:
+	.loc 1 345 5 is_stmt 1 view .LVU349
+# harness.c:345:     if (bn)
+	.loc 1 345 8 is_stmt 0 view .LVU350
+	testq	%rax, %rax	# bn
+	je	.L88	#,
+	.loc 1 346 9 is_stmt 1 view .LVU351
+# harness.c:346:         bn->prev = bp;
+	.loc 1 346 18 is_stmt 0 view .LVU352
+	movq	%rdx, 8(%rax)	# bp, bn_34->prev
+.L88:
+	.loc 1 348 5 is_stmt 1 view .LVU353
+# harness.c:348:     allocated_count--;
+	.loc 1 348 20 is_stmt 0 view .LVU354
+	subq	$1, allocated_count(%rip)	#, allocated_count
+	.loc 1 349 5 is_stmt 1 view .LVU355
+# harness.c:349:     allocated_bytes -= b->payload_size;
+	.loc 1 349 21 is_stmt 0 view .LVU356
+	movq	16(%rbp), %rax	# b_51->payload_size, b_51->payload_size
+.LVL111:
+	.loc 1 349 21 view .LVU357
+	subq	%rax, allocated_bytes(%rip)	# b_51->payload_size, allocated_bytes
+	.loc 1 352 5 is_stmt 1 view .LVU358
+# harness.c:352:     b->next = NULL;
+	.loc 1 352 13 is_stmt 0 view .LVU359
+	movq	$0, -40(%rbx)	#, b_51->next
+	.loc 1 353 5 is_stmt 1 view .LVU360
+# harness.c:353:     if (quarantine_tail)
+	.loc 1 353 9 is_stmt 0 view .LVU361
+	movq	quarantine_tail(%rip), %rax	# quarantine_tail, quarantine_tail.29_11
+# harness.c:353:     if (quarantine_tail)
+	.loc 1 353 8 view .LVU362
+	testq	%rax, %rax	# quarantine_tail.29_11
+	je	.L89	#,
+	.loc 1 354 9 is_stmt 1 view .LVU363
+# harness.c:354:         quarantine_tail->next = b;
+	.loc 1 354 31 is_stmt 0 view .LVU364
+	movq	%rbp, (%rax)	# b, quarantine_tail.29_11->next
+.L90:
+	.loc 1 357 5 is_stmt 1 view .LVU365
+# harness.c:357:     quarantine_tail = b;
+	.loc 1 357 21 is_stmt 0 view .LVU366
+	movq	%rbp, quarantine_tail(%rip)	# b, quarantine_tail
+	.loc 1 358 5 is_stmt 1 view .LVU367
+# harness.c:358:     quarantine_count++;
+	.loc 1 358 21 is_stmt 0 view .LVU368
+	addq	$1, quarantine_count(%rip)	#, quarantine_count
+	.loc 1 359 5 is_stmt 1 view .LVU369
+# harness.c:359:     quarantine_bytes += b->payload_size;
+	.loc 1 359 22 is_stmt 0 view .LVU370
+	movq	16(%rbp), %rax	# b_51->payload_size, b_51->payload_size
+	addq	%rax, quarantine_bytes(%rip)	# b_51->payload_size, quarantine_bytes
+	.loc 1 360 5 is_stmt 1 view .LVU371
+	movl	quarantine_max_kb(%rip), %esi	# quarantine_max_kb,
+	movl	quarantine_max_blocks(%rip), %edi	# quarantine_max_blocks,
+	call	trim_quarantine	#
+.LVL112:
+	.loc 1 360 5 is_stmt 0 view .LVU372
+	jmp	.L77	#
+.LVL113:
+.L94:
+	.loc 1 314 9 is_stmt 1 view .LVU373
+	leaq	.LC13(%rip), %rsi	#, tmp118
+	movl	$2, %edi	#,
+.LVL114:
+	.loc 1 314 9 is_stmt 0 view .LVU374
+	movl	$0, %eax	#,
+	call	report_event@PLT	#
+.LVL115:
+	.loc 1 315 9 is_stmt 1 view .LVU375
+	jmp	.L77	#
+.LVL116:
+.L81:
+.LBB60:
+.LBB55:
+.LBB54:
+	.loc 1 183 13 view .LVU376
+	movq	%rbx, %rdx	# p,
+	leaq	.LC14(%rip), %rsi	#, tmp123
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL117:
+	.loc 1 183 13 is_stmt 0 view .LVU377
+	call	report_event@PLT	#
+.LVL118:
+	.loc 1 186 13 is_stmt 1 view .LVU378
+# harness.c:186:             error_occurred = true;
+	.loc 1 186 28 is_stmt 0 view .LVU379
+	movb	$1, error_occurred(%rip)	#, error_occurred
+	jmp	.L80	#
+.LVL119:
+.L95:
+	.loc 1 186 28 view .LVU380
+.LBE54:
+	.loc 1 191 9 is_stmt 1 view .LVU381
+	movq	%rbx, %rdx	# p,
+	leaq	.LC15(%rip), %rsi	#, tmp125
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report_event@PLT	#
+.LVL120:
+	.loc 1 195 9 view .LVU382
+# harness.c:195:         error_occurred = true;
+	.loc 1 195 24 is_stmt 0 view .LVU383
+	movb	$1, error_occurred(%rip)	#, error_occurred
+	.loc 1 198 5 is_stmt 1 view .LVU384
+.LVL121:
+	.loc 1 198 5 is_stmt 0 view .LVU385
+.LBE55:
+.LBE60:
+	.loc 1 322 5 is_stmt 1 view .LVU386
+# harness.c:322:     if (b->magic_header != MAGICHEADER) {
+	.loc 1 322 8 is_stmt 0 view .LVU387
+	movl	$3735928559, %eax	#, tmp126
+	cmpq	%rax, 32(%rbp)	# tmp126, b_51->magic_header
+	je	.L84	#,
+.LVL122:
+.L77:
+# harness.c:361: }
+	.loc 1 361 1 view .LVU388
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL123:
+.L96:
+	.cfi_restore_state
+	.loc 1 328 9 is_stmt 1 view .LVU389
+	movq	%rbx, %rdx	# p,
+.LVL124:
+	.loc 1 328 9 is_stmt 0 view .LVU390
+	leaq	.LC16(%rip), %rsi	#, tmp129
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report_event@PLT	#
+.LVL125:
+	.loc 1 332 9 is_stmt 1 view .LVU391
+# harness.c:332:         error_occurred = true;
+	.loc 1 332 24 is_stmt 0 view .LVU392
+	movb	$1, error_occurred(%rip)	#, error_occurred
+	jmp	.L85	#
+.LVL126:
+.L86:
+	.loc 1 344 9 is_stmt 1 view .LVU393
+# harness.c:344:         allocated = bn;
+	.loc 1 344 19 is_stmt 0 view .LVU394
+	movq	%rax, allocated(%rip)	# bn, allocated
+	jmp	.L87	#
+.LVL127:
+.L89:
+	.loc 1 356 9 is_stmt 1 view .LVU395
+# harness.c:356:         quarantine_head = b;
+	.loc 1 356 25 is_stmt 0 view .LVU396
+	movq	%rbp, quarantine_head(%rip)	# b, quarantine_head
+	jmp	.L90	#
+	.cfi_endproc
+.LFE35:
+	.size	test_free, .-test_free
+	.globl	test_strdup
+	.type	test_strdup, @function
+test_strdup:
+.LVL128:
+.LFB36:
+	.loc 1 365 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 365 1 is_stmt 0 view .LVU398
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbx	# tmp97, s
+	.loc 1 366 5 is_stmt 1 view .LVU399
+# harness.c:366:     size_t len = strlen(s) + 1;
+	.loc 1 366 18 is_stmt 0 view .LVU400
+	call	strlen@PLT	#
+.LVL129:
+# harness.c:366:     size_t len = strlen(s) + 1;
+	.loc 1 366 12 view .LVU401
+	leaq	1(%rax), %rbp	#, len
+.LVL130:
+	.loc 1 367 5 is_stmt 1 view .LVU402
+# harness.c:367:     void *new = alloc_block(len, __builtin_return_address(0));
+	.loc 1 367 17 is_stmt 0 view .LVU403
+	movq	24(%rsp), %rsi	#,
+	movq	%rbp, %rdi	# len,
+	call	alloc_block	#
+.LVL131:
+	.loc 1 368 5 is_stmt 1 view .LVU404
+# harness.c:368:     if (!new)
+	.loc 1 368 8 is_stmt 0 view .LVU405
+	testq	%rax, %rax	# <retval>
+	je	.L97	#,
+	.loc 1 371 5 is_stmt 1 view .LVU406
+# harness.c:371:     return (char *) memcpy(new, s, len);
+	.loc 1 371 21 is_stmt 0 view .LVU407
+	movq	%rbp, %rdx	# len,
+	movq	%rbx, %rsi	# s,
+	movq	%rax, %rdi	# <retval>,
+	call	memcpy@PLT	#
+.LVL132:
+.L97:
+# harness.c:372: }
+	.loc 1 372 1 view .LVU408
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL133:
+	.loc 1 372 1 view .LVU409
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL134:
+	.loc 1 372 1 view .LVU410
+	ret	
+	.cfi_endproc
+.LFE36:
+	.size	test_strdup, .-test_strdup
+	.globl	allocation_check
+	.type	allocation_check, @function
+allocation_check:
+.LFB37:
+	.loc 1 375 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 376 5 view .LVU412
+# harness.c:377: }
+	.loc 1 377 1 is_stmt 0 view .LVU413
+	movq	allocated_count(%rip), %rax	# allocated_count,
+	ret	
+	.cfi_endproc
+.LFE37:
+	.size	allocation_check, .-allocation_check
+	.globl	allocation_bytes
+	.type	allocation_bytes, @function
+allocation_bytes:
+.LFB38:
+	.loc 1 380 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 381 5 view .LVU415
+# harness.c:382: }
+	.loc 1 382 1 is_stmt 0 view .LVU416
+	movq	allocated_bytes(%rip), %rax	# allocated_bytes,
+	ret	
+	.cfi_endproc
+.LFE38:
+	.size	allocation_bytes, .-allocation_bytes
+	.globl	set_fail_seed
+	.type	set_fail_seed, @function
+set_fail_seed:
+.LVL135:
+.LFB39:
+	.loc 1 393 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 394 5 view .LVU418
+# harness.c:394:     fail_seed = seed;
+	.loc 1 394 15 is_stmt 0 view .LVU419
+	movl	%edi, fail_seed(%rip)	# seed, fail_seed
+	.loc 1 396 5 is_stmt 1 view .LVU420
+# harness.c:396:     fail_state = ((uint64_t) seed << 32 | seed) ^ 0x9E3779B97F4A7C15ULL;
+	.loc 1 396 19 is_stmt 0 view .LVU421
+	movl	%edi, %eax	# seed, seed
+# harness.c:396:     fail_state = ((uint64_t) seed << 32 | seed) ^ 0x9E3779B97F4A7C15ULL;
+	.loc 1 396 41 view .LVU422
+	salq	$32, %rdi	#, tmp88
+.LVL136:
+	.loc 1 396 41 view .LVU423
+	addq	%rax, %rdi	# seed, tmp89
+# harness.c:396:     fail_state = ((uint64_t) seed << 32 | seed) ^ 0x9E3779B97F4A7C15ULL;
+	.loc 1 396 49 view .LVU424
+	movabsq	$-7046029254386353131, %rax	#, tmp90
+	xorq	%rax, %rdi	# tmp90, tmp91
+	movq	%rdi, fail_state(%rip)	# tmp91, fail_state
+	.loc 1 397 5 is_stmt 1 view .LVU425
+# harness.c:397:     alloc_seq = 0;
+	.loc 1 397 15 is_stmt 0 view .LVU426
+	movq	$0, alloc_seq(%rip)	#, alloc_seq
+	.loc 1 398 5 is_stmt 1 view .LVU427
+# harness.c:398:     fail_list_pos = 0;
+	.loc 1 398 19 is_stmt 0 view .LVU428
+	movl	$0, fail_list_pos(%rip)	#, fail_list_pos
+# harness.c:399: }
+	.loc 1 399 1 view .LVU429
+	ret	
+	.cfi_endproc
+.LFE39:
+	.size	set_fail_seed, .-set_fail_seed
+	.globl	set_fail_list
+	.type	set_fail_list, @function
+set_fail_list:
+.LVL137:
+.LFB41:
+	.loc 1 412 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 413 5 view .LVU431
+# harness.c:414:         return false;
+	.loc 1 414 16 is_stmt 0 view .LVU432
+	movl	$0, %eax	#, <retval>
+# harness.c:413:     if (cnt < 0 || cnt > FAIL_LIST_MAX)
+	.loc 1 413 8 view .LVU433
+	cmpl	$256, %esi	#, cnt
+	jbe	.L119	#,
+# harness.c:424: }
+	.loc 1 424 1 view .LVU434
+	ret	
+.L119:
+# harness.c:412: {
+	.loc 1 412 1 view .LVU435
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	%esi, %ebp	# tmp118, cnt
+	.loc 1 415 5 is_stmt 1 view .LVU436
+	movslq	%esi, %rbx	# cnt, _2
+	leaq	0(,%rbx,8), %rcx	#, tmp95
+	leaq	fail_list(%rip), %rax	#, tmp97
+	movq	%rdi, %rsi	# list, list
+.LVL138:
+	.loc 1 415 5 is_stmt 0 view .LVU437
+	cmpl	$8, %ecx	#, tmp95
+	jnb	.L120	#,
+.LVL139:
+.L108:
+	.loc 1 416 5 is_stmt 1 view .LVU438
+	leaq	cmp_size(%rip), %rcx	#, tmp110
+	movl	$8, %edx	#,
+	movq	%rbx, %rsi	# _2,
+	leaq	fail_list(%rip), %rdi	#, tmp111
+	call	qsort@PLT	#
+.LVL140:
+	.loc 1 417 5 view .LVU439
+# harness.c:417:     fail_list_cnt = cnt;
+	.loc 1 417 19 is_stmt 0 view .LVU440
+	movl	%ebp, fail_list_cnt(%rip)	# cnt, fail_list_cnt
+	.loc 1 419 5 is_stmt 1 view .LVU441
+# harness.c:419:     fail_list_pos = 0;
+	.loc 1 419 19 is_stmt 0 view .LVU442
+	movl	$0, fail_list_pos(%rip)	#, fail_list_pos
+	.loc 1 420 5 is_stmt 1 view .LVU443
+	.loc 1 420 42 view .LVU444
+	testl	%ebp, %ebp	# cnt
+	jle	.L113	#,
+# harness.c:421:            fail_list[fail_list_pos] <= alloc_seq)
+	.loc 1 421 37 is_stmt 0 view .LVU445
+	movq	alloc_seq(%rip), %rdi	# alloc_seq, alloc_seq.52_7
+	movl	$1, %eax	#, ivtmp.142
+	movl	$0, %ecx	#, fail_list_pos_lsm_flag.139
+# harness.c:421:            fail_list[fail_list_pos] <= alloc_seq)
+	.loc 1 421 21 view .LVU446
+	leaq	-8+fail_list(%rip), %rsi	#, tmp112
+	movl	$1, %r8d	#, fail_list_pos_lsm_flag.139
+.L109:
+# harness.c:420:     while (fail_list_pos < fail_list_cnt &&
+	.loc 1 420 42 discriminator 1 view .LVU447
+	cmpq	(%rsi,%rax,8), %rdi	# MEM[(long unsigned int *)&fail_list + -8B + ivtmp.142_5 * 8], alloc_seq.52_7
+	jb	.L121	#,
+	.loc 1 422 9 is_stmt 1 view .LVU448
+# harness.c:422:         fail_list_pos++;
+	.loc 1 422 22 is_stmt 0 view .LVU449
+	movl	%eax, %r12d	# ivtmp.142, D.5481
+	.loc 1 420 42 is_stmt 1 view .LVU450
+	leaq	1(%rax), %rdx	#, ivtmp.142
+	movl	%r8d, %ecx	# fail_list_pos_lsm_flag.139, fail_list_pos_lsm_flag.139
+	cmpq	%rax, %rbx	# ivtmp.142, _2
+	je	.L122	#,
+	movq	%rdx, %rax	# ivtmp.142, ivtmp.142
+	jmp	.L109	#
+.LVL141:
+.L120:
+# harness.c:415:     memcpy(fail_list, list, cnt * sizeof(size_t));
+	.loc 1 415 5 is_stmt 0 view .LVU451
+	shrl	$3, %ecx	#, tmp99
+	movl	%ecx, %ecx	# tmp99, tmp100
+	movq	%rax, %rdi	# tmp97, tmp97
+	rep movsq
+.LVL142:
+	.loc 1 415 5 view .LVU452
+	jmp	.L108	#
+.L122:
+	.loc 1 415 5 view .LVU453
+	movl	%eax, fail_list_pos(%rip)	# ivtmp.142, fail_list_pos
+# harness.c:423:     return true;
+	.loc 1 423 12 view .LVU454
+	movl	$1, %eax	#, <retval>
+	jmp	.L103	#
+.L121:
+	testb	%cl, %cl	# fail_list_pos_lsm_flag.139
+	je	.L111	#,
+	movl	%r12d, fail_list_pos(%rip)	# D.5481, fail_list_pos
+.L111:
+	movl	$1, %eax	#, <retval>
+.L103:
+# harness.c:424: }
+	.loc 1 424 1 view .LVU455
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL143:
+	.loc 1 424 1 view .LVU456
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL144:
+.L113:
+	.cfi_restore_state
+# harness.c:423:     return true;
+	.loc 1 423 12 view .LVU457
+	movl	$1, %eax	#, <retval>
+	jmp	.L103	#
+	.cfi_endproc
+.LFE41:
+	.size	set_fail_list, .-set_fail_list
+	.globl	allocation_number
+	.type	allocation_number, @function
+allocation_number:
+.LFB42:
+	.loc 1 427 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 428 5 view .LVU459
+# harness.c:429: }
+	.loc 1 429 1 is_stmt 0 view .LVU460
+	movq	alloc_seq(%rip), %rax	# alloc_seq,
+	ret	
+	.cfi_endproc
+.LFE42:
+	.size	allocation_number, .-allocation_number
+	.section	.rodata.str1.8
+	.align 8
+.LC17:
+	.string	"Couldn't allocate table for leak report"
+	.section	.rodata.str1.1
+.LC18:
+	.string	"%p\t%lu\t%s\t%s\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC19:
+	.string	"%lu blocks (%lu bytes) still allocated, in %lu groups:"
+	.align 8
+.LC20:
+	.string	"  %lu blocks of %lu bytes allocated from %s"
+	.section	.rodata.str1.1
+.LC21:
+	.string	"    %p: %s"
+.LC22:
+	.string	"  ... %lu more groups"
+	.text
+	.globl	report_leaks
+	.type	report_leaks, @function
+report_leaks:
+.LVL145:
+.LFB46:
+	.loc 1 500 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 500 1 is_stmt 0 view .LVU462
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$376, %rsp	#,
+	.cfi_def_cfa_offset 432
+	movl	%edi, 44(%rsp)	# tmp213, %sfp
+	movq	%rsi, (%rsp)	# tmp214, %sfp
+	.loc 1 501 5 is_stmt 1 view .LVU463
+	.loc 1 502 5 view .LVU464
+	.loc 1 503 5 view .LVU465
+.LVL146:
+	.loc 1 504 5 view .LVU466
+	.loc 1 504 41 view .LVU467
+# harness.c:504:     while (nslots < 2 * allocated_count && nslots < ((size_t) 1 << 20))
+	.loc 1 504 23 is_stmt 0 view .LVU468
+	movq	allocated_count(%rip), %rax	# allocated_count, tmp247
+	addq	%rax, %rax	# _154
+# harness.c:504:     while (nslots < 2 * allocated_count && nslots < ((size_t) 1 << 20))
+	.loc 1 504 41 view .LVU469
+	cmpq	$64, %rax	#, _154
+	jbe	.L154	#,
+# harness.c:503:     size_t nslots = 64;
+	.loc 1 503 12 view .LVU470
+	movl	$64, %r15d	#, i
+.LVL147:
+.L126:
+	.loc 1 505 9 is_stmt 1 view .LVU471
+# harness.c:505:         nslots <<= 1;
+	.loc 1 505 16 is_stmt 0 view .LVU472
+	addq	%r15, %r15	# i
+.LVL148:
+	.loc 1 504 41 is_stmt 1 view .LVU473
+	cmpq	$1048575, %r15	#, i
+	ja	.L125	#,
+	cmpq	%rax, %r15	# _154, i
+	jb	.L126	#,
+.LVL149:
+.L125:
+	.loc 1 507 5 view .LVU474
+	.loc 1 508 5 view .LVU475
+# harness.c:508:     leak_group_t *table = calloc(nslots, sizeof(leak_group_t));
+	.loc 1 508 27 is_stmt 0 view .LVU476
+	movl	$48, %esi	#,
+.LVL150:
+	.loc 1 508 27 view .LVU477
+	movq	%r15, %rdi	# i,
+.LVL151:
+	.loc 1 508 27 view .LVU478
+	call	calloc@PLT	#
+.LVL152:
+	movq	%rax, 8(%rsp)	# table, %sfp
+.LVL153:
+	.loc 1 509 5 is_stmt 1 view .LVU479
+# harness.c:509:     if (!table) {
+	.loc 1 509 8 is_stmt 0 view .LVU480
+	testq	%rax, %rax	# table
+	je	.L169	#,
+	.loc 1 514 5 is_stmt 1 view .LVU481
+.LBB61:
+	.loc 1 514 10 view .LVU482
+# harness.c:514:     for (block_ele_t *b = allocated; b; b = b->next) {
+	.loc 1 514 23 is_stmt 0 view .LVU483
+	movq	allocated(%rip), %rbx	# allocated, b
+.LVL154:
+	.loc 1 514 38 is_stmt 1 view .LVU484
+	testq	%rbx, %rbx	# b
+	je	.L155	#,
+.LBE61:
+# harness.c:507:     size_t ngroups = 0, nbytes = 0;
+	.loc 1 507 25 is_stmt 0 view .LVU485
+	movl	$0, %r13d	#, nbytes
+# harness.c:507:     size_t ngroups = 0, nbytes = 0;
+	.loc 1 507 12 view .LVU486
+	movl	$0, %r12d	#, ngroups
+	jmp	.L138	#
+.LVL155:
+.L154:
+# harness.c:503:     size_t nslots = 64;
+	.loc 1 503 12 view .LVU487
+	movl	$64, %r15d	#, i
+	jmp	.L125	#
+.LVL156:
+.L169:
+	.loc 1 510 9 is_stmt 1 view .LVU488
+	leaq	.LC17(%rip), %rsi	#, tmp153
+	movl	$0, %edi	#,
+	call	report_event@PLT	#
+.LVL157:
+	.loc 1 511 9 view .LVU489
+	jmp	.L124	#
+.LVL158:
+.L135:
+.LBB68:
+.LBB62:
+.LBB63:
+.LBB64:
+	.loc 1 532 49 discriminator 2 view .LVU490
+	addq	$1, %rbp	#, i
+.LVL159:
+	.loc 1 532 38 discriminator 2 view .LVU491
+	addq	$48, %r12	#, ivtmp.182
+	cmpq	%r15, %rbp	# i, i
+	je	.L134	#,
+.LVL160:
+.L136:
+	.loc 1 533 21 view .LVU492
+# harness.c:533:                     if (table[i].count)
+	.loc 1 533 24 is_stmt 0 view .LVU493
+	cmpq	$0, 16(%r12)	#, MEM[(long unsigned int *)_76 + 16B]
+	je	.L135	#,
+	.loc 1 534 25 is_stmt 1 view .LVU494
+# harness.c:534:                         *leak_slot(bigger, 2 * nslots - 1,
+	.loc 1 534 26 is_stmt 0 view .LVU495
+	movq	8(%r12), %rcx	# MEM[(void * *)_76 + 8B], MEM[(void * *)_76 + 8B]
+	movq	(%r12), %rdx	# MEM[(long unsigned int *)_76], MEM[(long unsigned int *)_76]
+	movq	24(%rsp), %rsi	# %sfp,
+	movq	16(%rsp), %rdi	# %sfp,
+	call	leak_slot	#
+.LVL161:
+# harness.c:536:                                    table[i].site) = table[i];
+	.loc 1 536 51 view .LVU496
+	movdqu	(%r12), %xmm0	# MEM[(struct leak_group_t *)_76], tmp254
+	movups	%xmm0, (%rax)	# tmp254, *_20
+	movdqu	16(%r12), %xmm1	# MEM[(struct leak_group_t *)_76], tmp255
+	movups	%xmm1, 16(%rax)	# tmp255, *_20
+	movdqu	32(%r12), %xmm2	# MEM[(struct leak_group_t *)_76], tmp256
+	movups	%xmm2, 32(%rax)	# tmp256, *_20
+	jmp	.L135	#
+.LVL162:
+.L134:
+	.loc 1 536 51 view .LVU497
+.LBE64:
+	.loc 1 538 17 is_stmt 1 view .LVU498
+	movq	8(%rsp), %rdi	# %sfp,
+	call	free@PLT	#
+.LVL163:
+	.loc 1 539 17 view .LVU499
+	.loc 1 540 17 view .LVU500
+	.loc 1 541 17 view .LVU501
+# harness.c:541:                 g = leak_slot(table, nslots - 1, b->payload_size, b->site);
+	.loc 1 541 21 is_stmt 0 view .LVU502
+	movq	24(%rbx), %rcx	# b_167->site, b_167->site
+	movq	16(%rbx), %rdx	# b_167->payload_size, b_167->payload_size
+	movq	32(%rsp), %r15	# %sfp, _13
+	leaq	-1(%r15), %rsi	#, tmp178
+	movq	16(%rsp), %rbp	# %sfp, bigger
+	movq	%rbp, %rdi	# bigger,
+	call	leak_slot	#
+.LVL164:
+# harness.c:539:                 table = bigger;
+	.loc 1 539 23 view .LVU503
+	movq	%rbp, 8(%rsp)	# bigger, %sfp
+.LVL165:
+.L133:
+	.loc 1 539 23 view .LVU504
+.LBE63:
+	.loc 1 543 13 is_stmt 1 view .LVU505
+# harness.c:543:             g->payload_size = b->payload_size;
+	.loc 1 543 32 is_stmt 0 view .LVU506
+	movq	16(%rbx), %rdx	# b_167->payload_size, _24
+# harness.c:543:             g->payload_size = b->payload_size;
+	.loc 1 543 29 view .LVU507
+	movq	%rdx, (%rax)	# _24, g_55->payload_size
+	.loc 1 544 13 is_stmt 1 view .LVU508
+# harness.c:544:             g->site = b->site;
+	.loc 1 544 24 is_stmt 0 view .LVU509
+	movq	24(%rbx), %rdx	# b_167->site, _25
+# harness.c:544:             g->site = b->site;
+	.loc 1 544 21 view .LVU510
+	movq	%rdx, 8(%rax)	# _25, g_55->site
+	.loc 1 545 13 is_stmt 1 view .LVU511
+.LVL166:
+# harness.c:545:             ngroups++;
+	.loc 1 545 20 is_stmt 0 view .LVU512
+	movq	%r14, %r12	# _11, ngroups
+.LVL167:
+.L132:
+	.loc 1 547 9 is_stmt 1 view .LVU513
+# harness.c:547:         if (g->count < LEAK_SAMPLES)
+	.loc 1 547 14 is_stmt 0 view .LVU514
+	movq	16(%rax), %rdx	# g_56->count, _26
+# harness.c:547:         if (g->count < LEAK_SAMPLES)
+	.loc 1 547 12 view .LVU515
+	cmpq	$2, %rdx	#, _26
+	ja	.L137	#,
+	.loc 1 548 13 is_stmt 1 view .LVU516
+# harness.c:548:             g->samples[g->count] = b;
+	.loc 1 548 34 is_stmt 0 view .LVU517
+	movq	%rbx, 24(%rax,%rdx,8)	# b, g_56->samples[_26]
+.L137:
+	.loc 1 549 9 is_stmt 1 discriminator 2 view .LVU518
+# harness.c:549:         g->count++;
+	.loc 1 549 17 is_stmt 0 discriminator 2 view .LVU519
+	addq	$1, %rdx	#, tmp180
+	movq	%rdx, 16(%rax)	# tmp180, g_56->count
+.LBE62:
+	.loc 1 514 43 is_stmt 1 discriminator 2 view .LVU520
+	movq	(%rbx), %rbx	# b_167->next, b
+.LVL168:
+	.loc 1 514 38 discriminator 2 view .LVU521
+	testq	%rbx, %rbx	# b
+	je	.L170	#,
+.LVL169:
+.L138:
+.LBB67:
+	.loc 1 515 9 view .LVU522
+# harness.c:515:         nbytes += b->payload_size;
+	.loc 1 515 16 is_stmt 0 view .LVU523
+	addq	16(%rbx), %r13	# b_167->payload_size, nbytes
+.LVL170:
+	.loc 1 516 9 is_stmt 1 view .LVU524
+# harness.c:516:         if (file) {
+	.loc 1 516 12 is_stmt 0 view .LVU525
+	cmpq	$0, (%rsp)	#, %sfp
+	je	.L131	#,
+	.loc 1 517 13 is_stmt 1 view .LVU526
+	leaq	256(%rsp), %r14	#, tmp157
+	movq	%rbx, %rdx	# b,
+	movl	$104, %esi	#,
+	movq	%r14, %rdi	# tmp157,
+	call	format_sample	#
+.LVL171:
+	.loc 1 518 13 view .LVU527
+	movq	24(%rbx), %rdx	# b_167->site, b_167->site
+	leaq	128(%rsp), %rbp	#, tmp159
+	movl	$128, %esi	#,
+	movq	%rbp, %rdi	# tmp159,
+	call	format_site	#
+.LVL172:
+	.loc 1 519 13 view .LVU528
+	movq	16(%rbx), %rcx	# b_167->payload_size, b_167->payload_size
+	leaq	40(%rbx), %rdx	#, tmp163
+	movq	%r14, %r9	# tmp157,
+	movq	%rbp, %r8	# tmp159,
+	leaq	.LC18(%rip), %rsi	#,
+	movq	(%rsp), %rdi	# %sfp,
+	movl	$0, %eax	#,
+	call	fprintf@PLT	#
+.LVL173:
+.L131:
+	.loc 1 523 9 view .LVU529
+# harness.c:524:             leak_slot(table, nslots - 1, b->payload_size, b->site);
+	.loc 1 524 13 is_stmt 0 view .LVU530
+	movq	24(%rbx), %rcx	# b_167->site, b_167->site
+	movq	16(%rbx), %rdx	# b_167->payload_size, b_167->payload_size
+	leaq	-1(%r15), %rsi	#, tmp167
+	movq	8(%rsp), %rdi	# %sfp,
+	call	leak_slot	#
+.LVL174:
+	.loc 1 525 9 is_stmt 1 view .LVU531
+# harness.c:525:         if (!g->count) {
+	.loc 1 525 15 is_stmt 0 view .LVU532
+	movq	16(%rax), %rbp	# g_91->count, i
+# harness.c:525:         if (!g->count) {
+	.loc 1 525 12 view .LVU533
+	testq	%rbp, %rbp	# i
+	jne	.L132	#,
+	.loc 1 526 13 is_stmt 1 view .LVU534
+# harness.c:526:             if (2 * (ngroups + 1) > nslots) {
+	.loc 1 526 30 is_stmt 0 view .LVU535
+	leaq	1(%r12), %r14	#, _11
+# harness.c:526:             if (2 * (ngroups + 1) > nslots) {
+	.loc 1 526 19 view .LVU536
+	leaq	(%r14,%r14), %rdx	#, tmp168
+# harness.c:526:             if (2 * (ngroups + 1) > nslots) {
+	.loc 1 526 16 view .LVU537
+	cmpq	%rdx, %r15	# tmp168, i
+	jnb	.L133	#,
+.LBB66:
+	.loc 1 528 17 is_stmt 1 view .LVU538
+# harness.c:529:                     calloc(2 * nslots, sizeof(leak_group_t));
+	.loc 1 529 21 is_stmt 0 view .LVU539
+	leaq	(%r15,%r15), %rax	#, _13
+.LVL175:
+	.loc 1 529 21 view .LVU540
+	movl	$48, %esi	#,
+	movq	%rax, 32(%rsp)	# _13, %sfp
+	movq	%rax, %rdi	# _13,
+	call	calloc@PLT	#
+.LVL176:
+	movq	%rax, 16(%rsp)	# bigger, %sfp
+.LVL177:
+	.loc 1 530 17 is_stmt 1 view .LVU541
+# harness.c:530:                 if (!bigger)
+	.loc 1 530 20 is_stmt 0 view .LVU542
+	testq	%rax, %rax	# bigger
+	je	.L166	#,
+.LVL178:
+.LBB65:
+	.loc 1 532 38 is_stmt 1 view .LVU543
+	testq	%r15, %r15	# i
+	je	.L134	#,
+	movq	8(%rsp), %r12	# %sfp, ivtmp.182
+.LVL179:
+# harness.c:534:                         *leak_slot(bigger, 2 * nslots - 1,
+	.loc 1 534 26 is_stmt 0 view .LVU544
+	movq	32(%rsp), %rax	# %sfp, _13
+.LVL180:
+	.loc 1 534 26 view .LVU545
+	subq	$1, %rax	#, tmp211
+	movq	%rax, 24(%rsp)	# tmp211, %sfp
+	jmp	.L136	#
+.LVL181:
+.L170:
+	.loc 1 534 26 view .LVU546
+	movq	%r12, 32(%rsp)	# ngroups, %sfp
+.LVL182:
+.L130:
+	.loc 1 534 26 view .LVU547
+.LBE65:
+.LBE66:
+.LBE67:
+.LBE68:
+	.loc 1 553 5 is_stmt 1 view .LVU548
+	.loc 1 554 5 view .LVU549
+	.loc 1 555 5 view .LVU550
+.LBB69:
+	.loc 1 555 10 view .LVU551
+	.loc 1 555 26 view .LVU552
+	testq	%r15, %r15	# i
+	je	.L139	#,
+	.loc 1 555 26 is_stmt 0 view .LVU553
+	movq	8(%rsp), %rax	# %sfp, table
+	movq	%rax, %rsi	# table, ivtmp.177
+	leaq	(%r15,%r15,2), %r8	#, tmp183
+	salq	$4, %r8	#, tmp184
+	addq	%rax, %r8	# table, _1
+.LBE69:
+# harness.c:554:     size_t ntop = 0;
+	.loc 1 554 12 view .LVU554
+	movl	$0, %ebp	#, ntop
+	jmp	.L147	#
+.LVL183:
+.L155:
+# harness.c:507:     size_t ngroups = 0, nbytes = 0;
+	.loc 1 507 12 view .LVU555
+	movq	$0, 32(%rsp)	#, %sfp
+# harness.c:507:     size_t ngroups = 0, nbytes = 0;
+	.loc 1 507 25 view .LVU556
+	movl	$0, %r13d	#, nbytes
+	jmp	.L130	#
+.LVL184:
+.L166:
+	.loc 1 507 25 view .LVU557
+	movq	%r12, 32(%rsp)	# ngroups, %sfp
+	jmp	.L130	#
+.LVL185:
+.L141:
+.LBB74:
+.LBB70:
+	.loc 1 559 9 is_stmt 1 view .LVU558
+# harness.c:559:         size_t j = ntop < LEAK_TOP ? ntop++ : LEAK_TOP - 1;
+	.loc 1 559 45 is_stmt 0 view .LVU559
+	cmpq	$9, %rbp	#, ntop
+	ja	.L142	#,
+# harness.c:559:         size_t j = ntop < LEAK_TOP ? ntop++ : LEAK_TOP - 1;
+	.loc 1 559 42 discriminator 1 view .LVU560
+	leaq	1(%rbp), %rdx	#, ntop
+.LVL186:
+	.loc 1 560 9 is_stmt 1 discriminator 1 view .LVU561
+	.loc 1 560 22 discriminator 1 view .LVU562
+	testq	%rbp, %rbp	# ntop
+	je	.L171	#,
+# harness.c:560:         while (j > 0 && top[j - 1]->count < g->count) {
+	.loc 1 560 22 is_stmt 0 view .LVU563
+	movq	%rbp, %rax	# ntop, _33
+# harness.c:559:         size_t j = ntop < LEAK_TOP ? ntop++ : LEAK_TOP - 1;
+	.loc 1 559 42 view .LVU564
+	movq	%rdx, %rbp	# ntop, ntop
+.LVL187:
+	.loc 1 559 42 view .LVU565
+	jmp	.L145	#
+.LVL188:
+.L171:
+# harness.c:559:         size_t j = ntop < LEAK_TOP ? ntop++ : LEAK_TOP - 1;
+	.loc 1 559 16 view .LVU566
+	movq	%rbp, %rdi	# ntop, j
+# harness.c:559:         size_t j = ntop < LEAK_TOP ? ntop++ : LEAK_TOP - 1;
+	.loc 1 559 42 view .LVU567
+	movq	%rdx, %rbp	# ntop, ntop
+.LVL189:
+	.loc 1 559 42 view .LVU568
+	jmp	.L144	#
+.LVL190:
+.L174:
+	.loc 1 559 42 view .LVU569
+.LBE70:
+.LBE74:
+	.loc 1 567 5 is_stmt 1 view .LVU570
+	movq	32(%rsp), %r8	# %sfp,
+	movq	%r13, %rcx	# nbytes,
+	movq	allocated_count(%rip), %rdx	# allocated_count,
+	leaq	.LC19(%rip), %rsi	#, tmp189
+	movl	44(%rsp), %ebx	# %sfp, vlevel
+.LVL191:
+	.loc 1 567 5 is_stmt 0 view .LVU571
+	movl	%ebx, %edi	# vlevel,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL192:
+	.loc 1 569 5 is_stmt 1 view .LVU572
+.LBB75:
+	.loc 1 569 10 view .LVU573
+	.loc 1 569 26 view .LVU574
+	testq	%rbp, %rbp	# ntop
+	je	.L157	#,
+# harness.c:569:     for (size_t i = 0; i < ntop; i++) {
+	.loc 1 569 17 is_stmt 0 view .LVU575
+	movl	$0, %r15d	#, i
+.LVL193:
+.LBB76:
+# harness.c:571:         format_site(site, sizeof(site), g->site);
+	.loc 1 571 9 view .LVU576
+	leaq	128(%rsp), %rax	#, tmp192
+	movq	%rax, 16(%rsp)	# tmp192, %sfp
+.LBB77:
+# harness.c:575:             format_sample(sample, sizeof(sample), g->samples[j]);
+	.loc 1 575 13 view .LVU577
+	leaq	256(%rsp), %r14	#, tmp210
+	movq	%r15, (%rsp)	# i, %sfp
+.LVL194:
+	.loc 1 575 13 view .LVU578
+	movq	%rbp, 24(%rsp)	# ntop, %sfp
+	movl	%ebx, %ebp	# vlevel, vlevel
+.LVL195:
+	.loc 1 575 13 view .LVU579
+	jmp	.L152	#
+.LVL196:
+.L149:
+	.loc 1 575 13 view .LVU580
+.LBE77:
+.LBE76:
+	.loc 1 569 35 is_stmt 1 discriminator 2 view .LVU581
+	addq	$1, (%rsp)	#, %sfp
+.LVL197:
+	.loc 1 569 35 is_stmt 0 discriminator 2 view .LVU582
+	movq	(%rsp), %rax	# %sfp, i
+.LVL198:
+	.loc 1 569 26 is_stmt 1 discriminator 2 view .LVU583
+	cmpq	%rax, 24(%rsp)	# i, %sfp
+	je	.L172	#,
+.LVL199:
+.L152:
+.LBB79:
+	.loc 1 570 9 view .LVU584
+# harness.c:570:         leak_group_t *g = top[i];
+	.loc 1 570 23 is_stmt 0 view .LVU585
+	movq	(%rsp), %rax	# %sfp, i
+	movq	48(%rsp,%rax,8), %r12	# MEM[(struct leak_group_t * *)&top + i_174 * 8], g
+.LVL200:
+	.loc 1 571 9 is_stmt 1 view .LVU586
+	movq	8(%r12), %rdx	# g_110->site, g_110->site
+	movl	$128, %esi	#,
+	movq	16(%rsp), %rbx	# %sfp, tmp192
+	movq	%rbx, %rdi	# tmp192,
+	call	format_site	#
+.LVL201:
+	.loc 1 572 9 view .LVU587
+	movq	16(%r12), %r13	# g_110->count, _39
+	movq	(%r12), %rcx	# g_110->payload_size, g_110->payload_size
+	movq	%rbx, %r8	# tmp192,
+	movq	%r13, %rdx	# _39,
+	leaq	.LC20(%rip), %rsi	#,
+	movl	%ebp, %edi	# vlevel,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL202:
+	.loc 1 574 9 view .LVU588
+.LBB78:
+	.loc 1 574 14 view .LVU589
+	.loc 1 574 41 view .LVU590
+	testq	%r13, %r13	# _39
+	je	.L149	#,
+# harness.c:574:         for (size_t j = 0; j < g->count && j < LEAK_SAMPLES; j++) {
+	.loc 1 574 21 is_stmt 0 view .LVU591
+	movl	$0, %ebx	#, j
+.LVL203:
+.L150:
+	.loc 1 575 13 is_stmt 1 discriminator 4 view .LVU592
+	movq	24(%r12,%rbx,8), %r15	# MEM[(struct block_ele_t * *)g_110 + 24B + j_175 * 8], _40
+	movq	%r15, %rdx	# _40,
+	movl	$104, %esi	#,
+	movq	%r14, %rdi	# tmp210,
+	call	format_sample	#
+.LVL204:
+	.loc 1 576 13 discriminator 4 view .LVU593
+# harness.c:576:             report(vlevel, "    %p: %s", (void *) g->samples[j]->payload,
+	.loc 1 576 51 is_stmt 0 discriminator 4 view .LVU594
+	leaq	40(%r15), %rdx	#, tmp198
+# harness.c:576:             report(vlevel, "    %p: %s", (void *) g->samples[j]->payload,
+	.loc 1 576 13 discriminator 4 view .LVU595
+	movq	%r14, %rcx	# tmp210,
+	leaq	.LC21(%rip), %rsi	#,
+	movl	%ebp, %edi	# vlevel,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL205:
+	.loc 1 574 63 is_stmt 1 discriminator 4 view .LVU596
+	addq	$1, %rbx	#, j
+.LVL206:
+	.loc 1 574 41 discriminator 4 view .LVU597
+	cmpq	$2, %rbx	#, j
+	ja	.L149	#,
+	cmpq	%r13, %rbx	# _39, j
+	jb	.L150	#,
+	jmp	.L149	#
+.LVL207:
+.L172:
+	.loc 1 574 41 is_stmt 0 discriminator 4 view .LVU598
+	movq	%rax, %r15	# i, i
+.LVL208:
+.L148:
+	.loc 1 574 41 discriminator 4 view .LVU599
+.LBE78:
+.LBE79:
+.LBE75:
+	.loc 1 580 5 is_stmt 1 view .LVU600
+# harness.c:580:     if (ngroups > ntop)
+	.loc 1 580 8 is_stmt 0 view .LVU601
+	movq	32(%rsp), %rax	# %sfp, ngroups
+	cmpq	%rax, %r15	# ngroups, i
+	jb	.L173	#,
+.L153:
+	.loc 1 583 5 is_stmt 1 view .LVU602
+	movq	8(%rsp), %rdi	# %sfp,
+	call	free@PLT	#
+.LVL209:
+.L124:
+# harness.c:584: }
+	.loc 1 584 1 is_stmt 0 view .LVU603
+	addq	$376, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL210:
+.L157:
+	.cfi_restore_state
+.LBB80:
+# harness.c:569:     for (size_t i = 0; i < ntop; i++) {
+	.loc 1 569 26 view .LVU604
+	movq	%rbp, %r15	# ntop, i
+.LVL211:
+	.loc 1 569 26 view .LVU605
+	jmp	.L148	#
+.LVL212:
+.L173:
+	.loc 1 569 26 view .LVU606
+.LBE80:
+	.loc 1 581 9 is_stmt 1 view .LVU607
+	movq	%rax, %rdx	# ngroups, ngroups
+	subq	%r15, %rdx	# i, ngroups
+	leaq	.LC22(%rip), %rsi	#, tmp205
+	movl	44(%rsp), %edi	# %sfp,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL213:
+	jmp	.L153	#
+.LVL214:
+.L139:
+	.loc 1 567 5 view .LVU608
+	movq	32(%rsp), %r8	# %sfp,
+	movq	%r13, %rcx	# nbytes,
+	movq	allocated_count(%rip), %rdx	# allocated_count,
+	leaq	.LC19(%rip), %rsi	#, tmp207
+	movl	44(%rsp), %edi	# %sfp,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL215:
+	.loc 1 569 5 view .LVU609
+.LBB81:
+	.loc 1 569 10 view .LVU610
+	.loc 1 569 26 view .LVU611
+	jmp	.L148	#
+.LVL216:
+.L142:
+	.loc 1 569 26 is_stmt 0 view .LVU612
+.LBE81:
+.LBB82:
+.LBB71:
+	.loc 1 560 9 is_stmt 1 view .LVU613
+	.loc 1 560 22 view .LVU614
+.LBE71:
+.LBE82:
+# harness.c:554:     size_t ntop = 0;
+	.loc 1 554 12 is_stmt 0 view .LVU615
+	movl	$9, %eax	#, _33
+.LVL217:
+.L145:
+	.loc 1 554 12 view .LVU616
+	movq	%rax, %rdi	# _33, j
+.LBB83:
+.LBB72:
+# harness.c:560:         while (j > 0 && top[j - 1]->count < g->count) {
+	.loc 1 560 31 discriminator 1 view .LVU617
+	subq	$1, %rax	#, _33
+.LVL218:
+# harness.c:560:         while (j > 0 && top[j - 1]->count < g->count) {
+	.loc 1 560 28 discriminator 1 view .LVU618
+	movq	48(%rsp,%rax,8), %rdx	# MEM[(struct leak_group_t * *)&top + _33 * 8], _34
+# harness.c:560:         while (j > 0 && top[j - 1]->count < g->count) {
+	.loc 1 560 22 discriminator 1 view .LVU619
+	cmpq	%rcx, 16(%rdx)	# _29, _34->count
+	jnb	.L144	#,
+	.loc 1 561 13 is_stmt 1 view .LVU620
+# harness.c:561:             top[j] = top[j - 1];
+	.loc 1 561 20 is_stmt 0 view .LVU621
+	movq	%rdx, 56(%rsp,%rax,8)	# _34, MEM[(struct leak_group_t * *)&top + 8B + _33 * 8]
+	.loc 1 562 13 is_stmt 1 view .LVU622
+.LVL219:
+	.loc 1 560 22 view .LVU623
+	testq	%rax, %rax	# _33
+	jne	.L145	#,
+# harness.c:562:             j--;
+	.loc 1 562 14 is_stmt 0 view .LVU624
+	movq	%rax, %rdi	# _33, j
+.LVL220:
+.L144:
+	.loc 1 564 9 is_stmt 1 view .LVU625
+# harness.c:564:         top[j] = g;
+	.loc 1 564 16 is_stmt 0 view .LVU626
+	movq	%r9, 48(%rsp,%rdi,8)	# g, top[j_173]
+.LVL221:
+.L140:
+	.loc 1 564 16 view .LVU627
+.LBE72:
+	.loc 1 555 37 is_stmt 1 discriminator 2 view .LVU628
+	.loc 1 555 26 discriminator 2 view .LVU629
+	addq	$48, %rsi	#, ivtmp.177
+.LVL222:
+	.loc 1 555 26 is_stmt 0 discriminator 2 view .LVU630
+	cmpq	%rsi, %r8	# ivtmp.177, _1
+	je	.L174	#,
+.LVL223:
+.L147:
+.LBB73:
+	.loc 1 556 9 is_stmt 1 view .LVU631
+# harness.c:556:         leak_group_t *g = &table[i];
+	.loc 1 556 23 is_stmt 0 view .LVU632
+	movq	%rsi, %r9	# ivtmp.177, g
+.LVL224:
+	.loc 1 557 9 is_stmt 1 view .LVU633
+# harness.c:557:         if (!g->count || (ntop == LEAK_TOP && g->count <= top[ntop - 1]->count))
+	.loc 1 557 15 is_stmt 0 view .LVU634
+	movq	16(%rsi), %rcx	# MEM[(long unsigned int *)g_117 + 16B], _29
+# harness.c:557:         if (!g->count || (ntop == LEAK_TOP && g->count <= top[ntop - 1]->count))
+	.loc 1 557 12 view .LVU635
+	testq	%rcx, %rcx	# _29
+	je	.L140	#,
+# harness.c:557:         if (!g->count || (ntop == LEAK_TOP && g->count <= top[ntop - 1]->count))
+	.loc 1 557 23 discriminator 2 view .LVU636
+	cmpq	$10, %rbp	#, ntop
+	jne	.L141	#,
+# harness.c:557:         if (!g->count || (ntop == LEAK_TOP && g->count <= top[ntop - 1]->count))
+	.loc 1 557 72 discriminator 3 view .LVU637
+	movq	120(%rsp), %rax	# top[9], top[9]
+# harness.c:557:         if (!g->count || (ntop == LEAK_TOP && g->count <= top[ntop - 1]->count))
+	.loc 1 557 44 discriminator 3 view .LVU638
+	cmpq	%rcx, 16(%rax)	# _29, _31->count
+	jnb	.L140	#,
+	jmp	.L142	#
+.LBE73:
+.LBE83:
+	.cfi_endproc
+.LFE46:
+	.size	report_leaks, .-report_leaks
+	.globl	quarantine_flush
+	.type	quarantine_flush, @function
+quarantine_flush:
+.LFB47:
+	.loc 1 590 1 is_stmt 1 view -0
+	.cfi_startproc
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 591 5 view .LVU640
+	movl	$0, %esi	#,
+	movl	$0, %edi	#,
+	call	trim_quarantine	#
+.LVL225:
+# harness.c:592: }
+	.loc 1 592 1 is_stmt 0 view .LVU641
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE47:
+	.size	quarantine_flush, .-quarantine_flush
+	.globl	set_cautious_mode
+	.type	set_cautious_mode, @function
+set_cautious_mode:
+.LVL226:
+.LFB48:
+	.loc 1 603 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 604 5 view .LVU643
+# harness.c:604:     cautious_mode = cautious;
+	.loc 1 604 19 is_stmt 0 view .LVU644
+	movb	%dil, cautious_mode(%rip)	# tmp84, cautious_mode
+# harness.c:605: }
+	.loc 1 605 1 view .LVU645
+	ret	
+	.cfi_endproc
+.LFE48:
+	.size	set_cautious_mode, .-set_cautious_mode
+	.globl	set_noallocate_mode
+	.type	set_noallocate_mode, @function
+set_noallocate_mode:
+.LVL227:
+.LFB49:
+	.loc 1 612 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 613 5 view .LVU647
+# harness.c:613:     noallocate_mode = noallocate;
+	.loc 1 613 21 is_stmt 0 view .LVU648
+	movb	%dil, noallocate_mode(%rip)	# tmp84, noallocate_mode
+# harness.c:614: }
+	.loc 1 614 1 view .LVU649
+	ret	
+	.cfi_endproc
+.LFE49:
+	.size	set_noallocate_mode, .-set_noallocate_mode
+	.globl	error_check
+	.type	error_check, @function
+error_check:
+.LFB50:
+	.loc 1 620 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 621 5 view .LVU651
+# harness.c:621:     bool e = error_occurred;
+	.loc 1 621 10 is_stmt 0 view .LVU652
+	movzbl	error_occurred(%rip), %eax	# error_occurred, <retval>
+.LVL228:
+	.loc 1 622 5 is_stmt 1 view .LVU653
+# harness.c:622:     error_occurred = false;
+	.loc 1 622 20 is_stmt 0 view .LVU654
+	movb	$0, error_occurred(%rip)	#, error_occurred
+	.loc 1 623 5 is_stmt 1 view .LVU655
+# harness.c:624: }
+	.loc 1 624 1 is_stmt 0 view .LVU656
+	ret	
+	.cfi_endproc
+.LFE50:
+	.size	error_check, .-error_check
+	.globl	exception_setup
+	.type	exception_setup, @function
+exception_setup:
+.LVL229:
+.LFB51:
+	.loc 1 631 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 631 1 is_stmt 0 view .LVU658
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movl	%edi, 12(%rsp)	# tmp91, %sfp
+	.loc 1 632 5 is_stmt 1 view .LVU659
+# harness.c:632:     if (sigsetjmp(env, 1)) {
+	.loc 1 632 9 is_stmt 0 view .LVU660
+	movl	$1, %esi	#,
+	leaq	env(%rip), %rdi	#, tmp88
+.LVL230:
+	.loc 1 632 9 view .LVU661
+	call	__sigsetjmp@PLT	#
+.LVL231:
+# harness.c:632:     if (sigsetjmp(env, 1)) {
+	.loc 1 632 8 view .LVU662
+	testl	%eax, %eax	# tmp92
+	jne	.L188	#,
+	.loc 1 648 5 is_stmt 1 view .LVU663
+# harness.c:648:     jmp_ready = true;
+	.loc 1 648 15 is_stmt 0 view .LVU664
+	movl	$1, jmp_ready(%rip)	#, jmp_ready
+	.loc 1 649 5 is_stmt 1 view .LVU665
+# harness.c:653:     return true;
+	.loc 1 653 12 is_stmt 0 view .LVU666
+	movl	$1, %eax	#, <retval>
+# harness.c:649:     if (limit_time) {
+	.loc 1 649 8 view .LVU667
+	cmpb	$0, 12(%rsp)	#, %sfp
+	jne	.L189	#,
+.L180:
+# harness.c:654: }
+	.loc 1 654 1 view .LVU668
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.L188:
+	.cfi_restore_state
+	.loc 1 634 9 is_stmt 1 view .LVU669
+	movl	$0, %eax	#,
+	call	report_signal_leave@PLT	#
+.LVL232:
+	.loc 1 635 9 view .LVU670
+# harness.c:635:         jmp_ready = false;
+	.loc 1 635 19 is_stmt 0 view .LVU671
+	movl	$0, jmp_ready(%rip)	#, jmp_ready
+	.loc 1 636 9 is_stmt 1 view .LVU672
+# harness.c:636:         if (time_limited) {
+	.loc 1 636 12 is_stmt 0 view .LVU673
+	cmpb	$0, time_limited(%rip)	#, time_limited
+	jne	.L190	#,
+.L183:
+	.loc 1 641 9 is_stmt 1 view .LVU674
+# harness.c:641:         if (error_message)
+	.loc 1 641 13 is_stmt 0 view .LVU675
+	movq	error_message(%rip), %rsi	# error_message, error_message.62_2
+# harness.c:641:         if (error_message)
+	.loc 1 641 12 view .LVU676
+	testq	%rsi, %rsi	# error_message.62_2
+	je	.L184	#,
+	.loc 1 642 13 is_stmt 1 view .LVU677
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report_event@PLT	#
+.LVL233:
+.L184:
+	.loc 1 643 9 view .LVU678
+# harness.c:643:         error_message = "";
+	.loc 1 643 23 is_stmt 0 view .LVU679
+	leaq	.LC5(%rip), %rax	#, tmp94
+	movq	%rax, error_message(%rip)	# tmp94, error_message
+	.loc 1 644 9 is_stmt 1 view .LVU680
+# harness.c:644:         return false;
+	.loc 1 644 16 is_stmt 0 view .LVU681
+	movl	$0, %eax	#, <retval>
+	jmp	.L180	#
+.L190:
+	.loc 1 637 13 is_stmt 1 view .LVU682
+	movl	$0, %edi	#,
+	call	alarm@PLT	#
+.LVL234:
+	.loc 1 638 13 view .LVU683
+# harness.c:638:             time_limited = false;
+	.loc 1 638 26 is_stmt 0 view .LVU684
+	movb	$0, time_limited(%rip)	#, time_limited
+	jmp	.L183	#
+.L189:
+	.loc 1 650 9 is_stmt 1 view .LVU685
+	movl	$1, %edi	#,
+	call	alarm@PLT	#
+.LVL235:
+	.loc 1 651 9 view .LVU686
+# harness.c:651:         time_limited = true;
+	.loc 1 651 22 is_stmt 0 view .LVU687
+	movb	$1, time_limited(%rip)	#, time_limited
+# harness.c:653:     return true;
+	.loc 1 653 12 view .LVU688
+	movzbl	12(%rsp), %eax	# %sfp, <retval>
+	jmp	.L180	#
+	.cfi_endproc
+.LFE51:
+	.size	exception_setup, .-exception_setup
+	.globl	exception_cancel
+	.type	exception_cancel, @function
+exception_cancel:
+.LFB52:
+	.loc 1 660 1 is_stmt 1 view -0
+	.cfi_startproc
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 661 5 view .LVU690
+# harness.c:661:     if (time_limited) {
+	.loc 1 661 8 is_stmt 0 view .LVU691
+	cmpb	$0, time_limited(%rip)	#, time_limited
+	jne	.L194	#,
+.L192:
+	.loc 1 666 5 is_stmt 1 view .LVU692
+# harness.c:666:     jmp_ready = false;
+	.loc 1 666 15 is_stmt 0 view .LVU693
+	movl	$0, jmp_ready(%rip)	#, jmp_ready
+	.loc 1 667 5 is_stmt 1 view .LVU694
+# harness.c:667:     error_message = "";
+	.loc 1 667 19 is_stmt 0 view .LVU695
+	leaq	.LC5(%rip), %rax	#, tmp85
+	movq	%rax, error_message(%rip)	# tmp85, error_message
+# harness.c:668: }
+	.loc 1 668 1 view .LVU696
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.L194:
+	.cfi_restore_state
+	.loc 1 662 9 is_stmt 1 view .LVU697
+	movl	$0, %edi	#,
+	call	alarm@PLT	#
+.LVL236:
+	.loc 1 663 9 view .LVU698
+# harness.c:663:         time_limited = false;
+	.loc 1 663 22 is_stmt 0 view .LVU699
+	movb	$0, time_limited(%rip)	#, time_limited
+	jmp	.L192	#
+	.cfi_endproc
+.LFE52:
+	.size	exception_cancel, .-exception_cancel
+	.globl	trigger_exception
+	.type	trigger_exception, @function
+trigger_exception:
+.LVL237:
+.LFB53:
+	.loc 1 674 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 674 1 is_stmt 0 view .LVU701
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 675 5 is_stmt 1 view .LVU702
+# harness.c:675:     error_occurred = true;
+	.loc 1 675 20 is_stmt 0 view .LVU703
+	movb	$1, error_occurred(%rip)	#, error_occurred
+	.loc 1 676 5 is_stmt 1 view .LVU704
+# harness.c:676:     error_message = msg;
+	.loc 1 676 19 is_stmt 0 view .LVU705
+	movq	%rdi, error_message(%rip)	# tmp85, error_message
+	.loc 1 677 5 is_stmt 1 view .LVU706
+# harness.c:677:     if (jmp_ready)
+	.loc 1 677 9 is_stmt 0 view .LVU707
+	movl	jmp_ready(%rip), %eax	# jmp_ready, jmp_ready.67_1
+# harness.c:677:     if (jmp_ready)
+	.loc 1 677 8 view .LVU708
+	testl	%eax, %eax	# jmp_ready.67_1
+	je	.L196	#,
+	.loc 1 678 9 is_stmt 1 view .LVU709
+	movl	$1, %esi	#,
+	leaq	env(%rip), %rdi	#, tmp84
+.LVL238:
+	.loc 1 678 9 is_stmt 0 view .LVU710
+	call	siglongjmp@PLT	#
+.LVL239:
+.L196:
+	.loc 1 680 9 is_stmt 1 view .LVU711
+	movl	$1, %edi	#,
+.LVL240:
+	.loc 1 680 9 is_stmt 0 view .LVU712
+	call	exit@PLT	#
+.LVL241:
+	.loc 1 680 9 view .LVU713
+	.cfi_endproc
+.LFE53:
+	.size	trigger_exception, .-trigger_exception
+	.local	time_limited
+	.comm	time_limited,1,1
+	.local	jmp_ready
+	.comm	jmp_ready,4,4
+	.local	env
+	.comm	env,200,32
+	.section	.data.rel.local,"aw"
+	.align 8
+	.type	error_message, @object
+	.size	error_message, 8
+error_message:
+	.quad	.LC5
+	.local	error_occurred
+	.comm	error_occurred,1,1
+	.local	noallocate_mode
+	.comm	noallocate_mode,1,1
+	.data
+	.type	cautious_mode, @object
+	.size	cautious_mode, 1
+cautious_mode:
+	.byte	1
+	.local	fail_seed
+	.comm	fail_seed,4,4
+	.align 8
+	.type	fail_state, @object
+	.size	fail_state, 8
+fail_state:
+	.quad	88172645463325252
+	.local	alloc_seq
+	.comm	alloc_seq,8,8
+	.local	fail_list_pos
+	.comm	fail_list_pos,4,4
+	.local	fail_list_cnt
+	.comm	fail_list_cnt,4,4
+	.local	fail_list
+	.comm	fail_list,2048,32
+	.globl	fail_every
+	.bss
+	.align 4
+	.type	fail_every, @object
+	.size	fail_every, 4
+fail_every:
+	.zero	4
+	.globl	fail_probability
+	.align 4
+	.type	fail_probability, @object
+	.size	fail_probability, 4
+fail_probability:
+	.zero	4
+	.globl	quarantine_max_kb
+	.data
+	.align 4
+	.type	quarantine_max_kb, @object
+	.size	quarantine_max_kb, 4
+quarantine_max_kb:
+	.long	1024
+	.globl	quarantine_max_blocks
+	.align 4
+	.type	quarantine_max_blocks, @object
+	.size	quarantine_max_blocks, 4
+quarantine_max_blocks:
+	.long	1024
+	.local	quarantine_bytes
+	.comm	quarantine_bytes,8,8
+	.local	quarantine_count
+	.comm	quarantine_count,8,8
+	.local	quarantine_tail
+	.comm	quarantine_tail,8,8
+	.local	quarantine_head
+	.comm	quarantine_head,8,8
+	.local	allocated_bytes
+	.comm	allocated_bytes,8,8
+	.local	allocated_count
+	.comm	allocated_count,8,8
+	.local	allocated
+	.comm	allocated,8,8
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/dlfcn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.file 8 "/usr/include/setjmp.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 11 "/usr/include/stdint.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 14 "/usr/include/stdlib.h"
+	.file 15 "/usr/include/ctype.h"
+	.file 16 "report.h"
+	.file 17 "harness.h"
+	.file 18 "/usr/include/unistd.h"
+	.file 19 "/usr/include/stdio.h"
+	.file 20 "/usr/include/string.h"
+	.file 21 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1d2e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3e
+	.long	.LASF198
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x28
+	.long	0x35
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x9
+	.long	.LASF9
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x9
+	.long	.LASF10
+	.byte	0x2
+	.byte	0x98
+	.byte	0x19
+	.long	0x64
+	.uleb128 0x9
+	.long	.LASF11
+	.byte	0x2
+	.byte	0x99
+	.byte	0x1b
+	.long	0x64
+	.uleb128 0x40
+	.byte	0x8
+	.uleb128 0x8
+	.long	0x96
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0x28
+	.long	0x96
+	.uleb128 0x9
+	.long	.LASF13
+	.byte	0x2
+	.byte	0xd7
+	.byte	0xd
+	.long	0x5d
+	.uleb128 0x29
+	.long	0x41
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x1
+	.long	0x10b
+	.uleb128 0x10
+	.long	.LASF14
+	.value	0x100
+	.uleb128 0x10
+	.long	.LASF15
+	.value	0x200
+	.uleb128 0x10
+	.long	.LASF16
+	.value	0x400
+	.uleb128 0x10
+	.long	.LASF17
+	.value	0x800
+	.uleb128 0x10
+	.long	.LASF18
+	.value	0x1000
+	.uleb128 0x10
+	.long	.LASF19
+	.value	0x2000
+	.uleb128 0x10
+	.long	.LASF20
+	.value	0x4000
+	.uleb128 0x10
+	.long	.LASF21
+	.value	0x8000
+	.uleb128 0x13
+	.long	.LASF22
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF23
+	.byte	0x2
+	.uleb128 0x13
+	.long	.LASF24
+	.byte	0x4
+	.uleb128 0x13
+	.long	.LASF25
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	0x3c
+	.uleb128 0x8
+	.long	0x9d
+	.uleb128 0x2a
+	.long	0x110
+	.uleb128 0x9
+	.long	.LASF26
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x48
+	.uleb128 0x2b
+	.byte	0x20
+	.byte	0x4
+	.byte	0x58
+	.long	0x163
+	.uleb128 0x2
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x5a
+	.byte	0xf
+	.long	0x110
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF28
+	.byte	0x4
+	.byte	0x5b
+	.byte	0x9
+	.long	0x8f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x5c
+	.byte	0xf
+	.long	0x110
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x5d
+	.byte	0x9
+	.long	0x8f
+	.byte	0x18
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF31
+	.byte	0x4
+	.byte	0x5e
+	.byte	0x3
+	.long	0x126
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF32
+	.uleb128 0x9
+	.long	.LASF33
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x12
+	.long	0x182
+	.uleb128 0xc
+	.long	0x64
+	.long	0x192
+	.uleb128 0xd
+	.long	0x48
+	.byte	0x7
+	.byte	0
+	.uleb128 0x2b
+	.byte	0x80
+	.byte	0x6
+	.byte	0x5
+	.long	0x1a8
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0x6
+	.byte	0x7
+	.byte	0x15
+	.long	0x1a8
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x48
+	.long	0x1b8
+	.uleb128 0xd
+	.long	0x48
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF35
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.long	0x192
+	.uleb128 0x22
+	.long	.LASF44
+	.byte	0xc8
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x8
+	.long	0x1f9
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0x7
+	.byte	0x20
+	.byte	0xf
+	.long	0x176
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF37
+	.byte	0x7
+	.byte	0x21
+	.byte	0x9
+	.long	0x5d
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF38
+	.byte	0x7
+	.byte	0x22
+	.byte	0x10
+	.long	0x1b8
+	.byte	0x48
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF39
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1e
+	.long	0x205
+	.uleb128 0xc
+	.long	0x1c4
+	.long	0x215
+	.uleb128 0xd
+	.long	0x48
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF40
+	.byte	0x9
+	.byte	0x8
+	.byte	0x18
+	.long	0xa2
+	.uleb128 0x41
+	.long	0x215
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF41
+	.uleb128 0x9
+	.long	.LASF42
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x9
+	.long	.LASF43
+	.byte	0xb
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x22
+	.long	.LASF45
+	.byte	0xd8
+	.byte	0xc
+	.byte	0x31
+	.byte	0x8
+	.long	0x3cc
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0xc
+	.byte	0x33
+	.byte	0x7
+	.long	0x5d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF47
+	.byte	0xc
+	.byte	0x36
+	.byte	0x9
+	.long	0x91
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF48
+	.byte	0xc
+	.byte	0x37
+	.byte	0x9
+	.long	0x91
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF49
+	.byte	0xc
+	.byte	0x38
+	.byte	0x9
+	.long	0x91
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF50
+	.byte	0xc
+	.byte	0x39
+	.byte	0x9
+	.long	0x91
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF51
+	.byte	0xc
+	.byte	0x3a
+	.byte	0x9
+	.long	0x91
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF52
+	.byte	0xc
+	.byte	0x3b
+	.byte	0x9
+	.long	0x91
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF53
+	.byte	0xc
+	.byte	0x3c
+	.byte	0x9
+	.long	0x91
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF54
+	.byte	0xc
+	.byte	0x3d
+	.byte	0x9
+	.long	0x91
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF55
+	.byte	0xc
+	.byte	0x40
+	.byte	0x9
+	.long	0x91
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF56
+	.byte	0xc
+	.byte	0x41
+	.byte	0x9
+	.long	0x91
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF57
+	.byte	0xc
+	.byte	0x42
+	.byte	0x9
+	.long	0x91
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF58
+	.byte	0xc
+	.byte	0x44
+	.byte	0x16
+	.long	0x3e5
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF59
+	.byte	0xc
+	.byte	0x46
+	.byte	0x14
+	.long	0x3ea
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF60
+	.byte	0xc
+	.byte	0x48
+	.byte	0x7
+	.long	0x5d
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF61
+	.byte	0xc
+	.byte	0x49
+	.byte	0x7
+	.long	0x5d
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF62
+	.byte	0xc
+	.byte	0x4a
+	.byte	0xb
+	.long	0x77
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF63
+	.byte	0xc
+	.byte	0x4d
+	.byte	0x12
+	.long	0x35
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF64
+	.byte	0xc
+	.byte	0x4e
+	.byte	0xf
+	.long	0x4f
+	.byte	0x82
+	.uleb128 0x2
+	.long	.LASF65
+	.byte	0xc
+	.byte	0x4f
+	.byte	0x8
+	.long	0x3ef
+	.byte	0x83
+	.uleb128 0x2
+	.long	.LASF66
+	.byte	0xc
+	.byte	0x51
+	.byte	0xf
+	.long	0x3ff
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF67
+	.byte	0xc
+	.byte	0x59
+	.byte	0xd
+	.long	0x83
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF68
+	.byte	0xc
+	.byte	0x5b
+	.byte	0x17
+	.long	0x409
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF69
+	.byte	0xc
+	.byte	0x5c
+	.byte	0x19
+	.long	0x413
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF70
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x14
+	.long	0x3ea
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF71
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x9
+	.long	0x8f
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF72
+	.byte	0xc
+	.byte	0x5f
+	.byte	0xa
+	.long	0x11a
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF73
+	.byte	0xc
+	.byte	0x60
+	.byte	0x7
+	.long	0x5d
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF74
+	.byte	0xc
+	.byte	0x62
+	.byte	0x8
+	.long	0x418
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF75
+	.byte	0xd
+	.byte	0x7
+	.byte	0x19
+	.long	0x245
+	.uleb128 0x42
+	.long	.LASF199
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x23
+	.long	.LASF76
+	.uleb128 0x8
+	.long	0x3e0
+	.uleb128 0x8
+	.long	0x245
+	.uleb128 0xc
+	.long	0x96
+	.long	0x3ff
+	.uleb128 0xd
+	.long	0x48
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x3d8
+	.uleb128 0x23
+	.long	.LASF77
+	.uleb128 0x8
+	.long	0x404
+	.uleb128 0x23
+	.long	.LASF78
+	.uleb128 0x8
+	.long	0x40e
+	.uleb128 0xc
+	.long	0x96
+	.long	0x428
+	.uleb128 0xd
+	.long	0x48
+	.byte	0x13
+	.byte	0
+	.uleb128 0x8
+	.long	0x3cc
+	.uleb128 0x2a
+	.long	0x428
+	.uleb128 0x2c
+	.long	.LASF79
+	.byte	0xe
+	.value	0x33d
+	.byte	0xf
+	.long	0x43f
+	.uleb128 0x8
+	.long	0x444
+	.uleb128 0x43
+	.long	0x5d
+	.long	0x458
+	.uleb128 0x3
+	.long	0x458
+	.uleb128 0x3
+	.long	0x458
+	.byte	0
+	.uleb128 0x8
+	.long	0x45d
+	.uleb128 0x44
+	.uleb128 0x29
+	.long	0x41
+	.byte	0x10
+	.byte	0x10
+	.byte	0xe
+	.long	0x47d
+	.uleb128 0x13
+	.long	.LASF80
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF81
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF82
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF83
+	.byte	0x10
+	.byte	0x10
+	.byte	0x31
+	.long	0x45e
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF84
+	.uleb128 0x1f
+	.long	.LASF85
+	.byte	0x25
+	.long	0x5d
+	.uleb128 0x1f
+	.long	.LASF86
+	.byte	0x28
+	.long	0x5d
+	.uleb128 0x1f
+	.long	.LASF87
+	.byte	0x3d
+	.long	0x5d
+	.uleb128 0x1f
+	.long	.LASF88
+	.byte	0x3e
+	.long	0x5d
+	.uleb128 0x22
+	.long	.LASF89
+	.byte	0x28
+	.byte	0x1
+	.byte	0x3d
+	.byte	0x10
+	.long	0x514
+	.uleb128 0x2
+	.long	.LASF90
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x12
+	.long	0x514
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF91
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x19
+	.long	0x514
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF92
+	.byte	0x1
+	.byte	0x3f
+	.byte	0xc
+	.long	0x11a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF93
+	.byte	0x1
+	.byte	0x40
+	.byte	0xb
+	.long	0x8f
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF94
+	.byte	0x1
+	.byte	0x41
+	.byte	0xc
+	.long	0x11a
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF95
+	.byte	0x1
+	.byte	0x42
+	.byte	0x13
+	.long	0x519
+	.byte	0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x4b8
+	.uleb128 0xc
+	.long	0x2e
+	.long	0x529
+	.uleb128 0x45
+	.long	0x48
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF96
+	.byte	0x1
+	.byte	0x44
+	.byte	0x3
+	.long	0x4b8
+	.uleb128 0x7
+	.long	.LASF97
+	.byte	0x46
+	.byte	0x15
+	.long	0x54a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocated
+	.uleb128 0x8
+	.long	0x529
+	.uleb128 0x7
+	.long	.LASF98
+	.byte	0x47
+	.byte	0xf
+	.long	0x11a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocated_count
+	.uleb128 0x7
+	.long	.LASF99
+	.byte	0x48
+	.byte	0xf
+	.long	0x11a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocated_bytes
+	.uleb128 0x7
+	.long	.LASF100
+	.byte	0x4f
+	.byte	0x15
+	.long	0x54a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quarantine_head
+	.uleb128 0x7
+	.long	.LASF101
+	.byte	0x50
+	.byte	0x15
+	.long	0x54a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quarantine_tail
+	.uleb128 0x7
+	.long	.LASF102
+	.byte	0x51
+	.byte	0xf
+	.long	0x11a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quarantine_count
+	.uleb128 0x7
+	.long	.LASF103
+	.byte	0x52
+	.byte	0xf
+	.long	0x11a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quarantine_bytes
+	.uleb128 0x20
+	.long	0x4a4
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quarantine_max_blocks
+	.uleb128 0x20
+	.long	0x4ae
+	.byte	0x56
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quarantine_max_kb
+	.uleb128 0x20
+	.long	0x490
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_probability
+	.uleb128 0x20
+	.long	0x49a
+	.byte	0x5c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_every
+	.uleb128 0xc
+	.long	0x11a
+	.long	0x61d
+	.uleb128 0xd
+	.long	0x48
+	.byte	0xff
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF104
+	.byte	0x60
+	.byte	0xf
+	.long	0x60d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_list
+	.uleb128 0x7
+	.long	.LASF105
+	.byte	0x61
+	.byte	0xc
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_list_cnt
+	.uleb128 0x7
+	.long	.LASF106
+	.byte	0x62
+	.byte	0xc
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_list_pos
+	.uleb128 0x7
+	.long	.LASF107
+	.byte	0x65
+	.byte	0xf
+	.long	0x11a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	alloc_seq
+	.uleb128 0x7
+	.long	.LASF108
+	.byte	0x68
+	.byte	0x11
+	.long	0x22d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_state
+	.uleb128 0x7
+	.long	.LASF109
+	.byte	0x6a
+	.byte	0x15
+	.long	0x41
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_seed
+	.uleb128 0x7
+	.long	.LASF110
+	.byte	0x6c
+	.byte	0xd
+	.long	0x489
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cautious_mode
+	.uleb128 0x7
+	.long	.LASF111
+	.byte	0x6d
+	.byte	0xd
+	.long	0x489
+	.uleb128 0x9
+	.byte	0x3
+	.quad	noallocate_mode
+	.uleb128 0x7
+	.long	.LASF112
+	.byte	0x6e
+	.byte	0xd
+	.long	0x489
+	.uleb128 0x9
+	.byte	0x3
+	.quad	error_occurred
+	.uleb128 0x7
+	.long	.LASF113
+	.byte	0x6f
+	.byte	0xe
+	.long	0x91
+	.uleb128 0x9
+	.byte	0x3
+	.quad	error_message
+	.uleb128 0x1a
+	.long	.LASF157
+	.byte	0x71
+	.byte	0xc
+	.long	0x5d
+	.uleb128 0x46
+	.string	"env"
+	.byte	0x1
+	.byte	0x76
+	.byte	0x10
+	.long	0x1f9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	env
+	.uleb128 0x7
+	.long	.LASF114
+	.byte	0x77
+	.byte	0x1e
+	.long	0x221
+	.uleb128 0x9
+	.byte	0x3
+	.quad	jmp_ready
+	.uleb128 0x7
+	.long	.LASF115
+	.byte	0x78
+	.byte	0xd
+	.long	0x489
+	.uleb128 0x9
+	.byte	0x3
+	.quad	time_limited
+	.uleb128 0x47
+	.byte	0x30
+	.byte	0x1
+	.value	0x1ba
+	.byte	0x9
+	.long	0x779
+	.uleb128 0x21
+	.long	.LASF92
+	.value	0x1bb
+	.byte	0xc
+	.long	0x11a
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF93
+	.value	0x1bc
+	.byte	0xb
+	.long	0x8f
+	.byte	0x8
+	.uleb128 0x21
+	.long	.LASF116
+	.value	0x1bd
+	.byte	0xc
+	.long	0x11a
+	.byte	0x10
+	.uleb128 0x21
+	.long	.LASF117
+	.value	0x1be
+	.byte	0x12
+	.long	0x779
+	.byte	0x18
+	.byte	0
+	.uleb128 0xc
+	.long	0x54a
+	.long	0x789
+	.uleb128 0xd
+	.long	0x48
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF118
+	.byte	0x1
+	.value	0x1bf
+	.byte	0x3
+	.long	0x73a
+	.uleb128 0x48
+	.long	.LASF119
+	.byte	0xe
+	.value	0x27d
+	.byte	0xd
+	.long	0x7a9
+	.uleb128 0x3
+	.long	0x5d
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF120
+	.byte	0x8
+	.byte	0x50
+	.byte	0xd
+	.long	0x7c0
+	.uleb128 0x3
+	.long	0x7c0
+	.uleb128 0x3
+	.long	0x5d
+	.byte	0
+	.uleb128 0x8
+	.long	0x1c4
+	.uleb128 0x14
+	.long	.LASF121
+	.byte	0x12
+	.value	0x1c4
+	.byte	0x15
+	.long	0x41
+	.long	0x7dc
+	.uleb128 0x3
+	.long	0x41
+	.byte	0
+	.uleb128 0x4a
+	.long	.LASF200
+	.byte	0x10
+	.byte	0x29
+	.byte	0x6
+	.long	0x7ea
+	.uleb128 0x1b
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF122
+	.byte	0x8
+	.byte	0x29
+	.byte	0xc
+	.long	0x5d
+	.long	0x805
+	.uleb128 0x3
+	.long	0x7c0
+	.uleb128 0x3
+	.long	0x5d
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF201
+	.byte	0xf
+	.byte	0x4f
+	.byte	0x23
+	.long	0x811
+	.uleb128 0x8
+	.long	0x10b
+	.uleb128 0x2d
+	.long	.LASF125
+	.byte	0x2f
+	.long	0x82c
+	.uleb128 0x3
+	.long	0x5d
+	.uleb128 0x3
+	.long	0x91
+	.uleb128 0x1b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF123
+	.byte	0x13
+	.value	0x15e
+	.byte	0xc
+	.long	0x5d
+	.long	0x849
+	.uleb128 0x3
+	.long	0x42d
+	.uleb128 0x3
+	.long	0x115
+	.uleb128 0x1b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF124
+	.byte	0xe
+	.value	0x22c
+	.byte	0xe
+	.long	0x8f
+	.long	0x865
+	.uleb128 0x3
+	.long	0x11a
+	.uleb128 0x3
+	.long	0x11a
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF126
+	.value	0x353
+	.long	0x885
+	.uleb128 0x3
+	.long	0x8f
+	.uleb128 0x3
+	.long	0x11a
+	.uleb128 0x3
+	.long	0x11a
+	.uleb128 0x3
+	.long	0x432
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF127
+	.byte	0x14
+	.byte	0x2b
+	.byte	0xe
+	.long	0x8f
+	.long	0x8a5
+	.uleb128 0x3
+	.long	0x8f
+	.uleb128 0x3
+	.long	0x458
+	.uleb128 0x3
+	.long	0x11a
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF128
+	.byte	0x14
+	.value	0x197
+	.byte	0xf
+	.long	0x11a
+	.long	0x8bc
+	.uleb128 0x3
+	.long	0x110
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF129
+	.byte	0x13
+	.value	0x17a
+	.byte	0xc
+	.long	0x5d
+	.long	0x8de
+	.uleb128 0x3
+	.long	0x91
+	.uleb128 0x3
+	.long	0x11a
+	.uleb128 0x3
+	.long	0x110
+	.uleb128 0x1b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF130
+	.byte	0x14
+	.value	0x111
+	.byte	0xe
+	.long	0x91
+	.long	0x8fa
+	.uleb128 0x3
+	.long	0x110
+	.uleb128 0x3
+	.long	0x5d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF131
+	.byte	0x4
+	.byte	0x62
+	.byte	0xc
+	.long	0x5d
+	.long	0x915
+	.uleb128 0x3
+	.long	0x458
+	.uleb128 0x3
+	.long	0x915
+	.byte	0
+	.uleb128 0x8
+	.long	0x163
+	.uleb128 0x2e
+	.long	.LASF132
+	.value	0x238
+	.long	0x92b
+	.uleb128 0x3
+	.long	0x8f
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF133
+	.byte	0x14
+	.byte	0x40
+	.byte	0xc
+	.long	0x5d
+	.long	0x94b
+	.uleb128 0x3
+	.long	0x458
+	.uleb128 0x3
+	.long	0x458
+	.uleb128 0x3
+	.long	0x11a
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF134
+	.byte	0x14
+	.byte	0x3d
+	.byte	0xe
+	.long	0x8f
+	.long	0x96b
+	.uleb128 0x3
+	.long	0x8f
+	.uleb128 0x3
+	.long	0x5d
+	.uleb128 0x3
+	.long	0x11a
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF135
+	.byte	0xe
+	.value	0x229
+	.byte	0xe
+	.long	0x8f
+	.long	0x982
+	.uleb128 0x3
+	.long	0x11a
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF136
+	.byte	0x2c
+	.long	0x998
+	.uleb128 0x3
+	.long	0x47d
+	.uleb128 0x3
+	.long	0x91
+	.uleb128 0x1b
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF138
+	.value	0x2a1
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa01
+	.uleb128 0x17
+	.string	"msg"
+	.value	0x2a1
+	.byte	0x1e
+	.long	0x91
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x4
+	.quad	.LVL239
+	.long	0x7a9
+	.long	0x9ed
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	env
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL241
+	.long	0x796
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF144
+	.value	0x293
+	.quad	.LFB52
+	.quad	.LFE52-.LFB52
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa32
+	.uleb128 0x5
+	.quad	.LVL236
+	.long	0x7c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF160
+	.value	0x276
+	.byte	0x6
+	.long	0x489
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xadb
+	.uleb128 0xe
+	.long	.LASF137
+	.value	0x276
+	.byte	0x1b
+	.long	0x489
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x4
+	.quad	.LVL231
+	.long	0x7ea
+	.long	0xa8c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	env
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x24
+	.quad	.LVL232
+	.long	0x7dc
+	.uleb128 0x4
+	.quad	.LVL233
+	.long	0x982
+	.long	0xab0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL234
+	.long	0x7c5
+	.long	0xac7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL235
+	.long	0x7c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.long	.LASF139
+	.byte	0x1
+	.value	0x26b
+	.byte	0x6
+	.long	0x489
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb11
+	.uleb128 0x6
+	.string	"e"
+	.value	0x26d
+	.byte	0xa
+	.long	0x489
+	.long	.LLST94
+	.long	.LVUS94
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF140
+	.value	0x263
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb3d
+	.uleb128 0x1e
+	.long	.LASF142
+	.value	0x263
+	.byte	0x1f
+	.long	0x489
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF141
+	.value	0x25a
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb69
+	.uleb128 0x1e
+	.long	.LASF143
+	.value	0x25a
+	.byte	0x1d
+	.long	0x489
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF145
+	.value	0x24d
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb9f
+	.uleb128 0x5
+	.quad	.LVL225
+	.long	0x1985
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF146
+	.value	0x1f3
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x101b
+	.uleb128 0xe
+	.long	.LASF147
+	.value	0x1f3
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0xe
+	.long	.LASF148
+	.value	0x1f3
+	.byte	0x25
+	.long	0x428
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x30
+	.long	.LASF149
+	.value	0x1f5
+	.long	0x101b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x30
+	.long	.LASF93
+	.value	0x1f6
+	.long	0x102b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0xf
+	.long	.LASF150
+	.value	0x1f7
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0xf
+	.long	.LASF151
+	.value	0x1fb
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0xf
+	.long	.LASF152
+	.value	0x1fb
+	.byte	0x19
+	.long	0x11a
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0xf
+	.long	.LASF153
+	.value	0x1fc
+	.byte	0x13
+	.long	0x103b
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x4d
+	.string	"top"
+	.byte	0x1
+	.value	0x229
+	.byte	0x13
+	.long	0x1040
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0xf
+	.long	.LASF154
+	.value	0x22a
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x15
+	.long	.LLRL75
+	.long	0xdf4
+	.uleb128 0x6
+	.string	"b"
+	.value	0x202
+	.byte	0x17
+	.long	0x54a
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x11
+	.long	.LLRL77
+	.uleb128 0x6
+	.string	"g"
+	.value	0x20b
+	.byte	0x17
+	.long	0x103b
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x15
+	.long	.LLRL79
+	.long	0xd5b
+	.uleb128 0xf
+	.long	.LASF155
+	.value	0x210
+	.byte	0x1f
+	.long	0x103b
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x15
+	.long	.LLRL81
+	.long	0xd00
+	.uleb128 0x6
+	.string	"i"
+	.value	0x214
+	.byte	0x1d
+	.long	0x11a
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x5
+	.quad	.LVL161
+	.long	0x11d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -408
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL163
+	.long	0x91a
+	.long	0xd1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL164
+	.long	0x11d2
+	.long	0xd3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -400
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL176
+	.long	0x849
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -400
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL171
+	.long	0x1050
+	.long	0xd7f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL172
+	.long	0x1bf3
+	.long	0xd9d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL173
+	.long	0x82c
+	.long	0xdd6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL174
+	.long	0x11d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LLRL83
+	.long	0xe3a
+	.uleb128 0x6
+	.string	"i"
+	.value	0x22b
+	.byte	0x11
+	.long	0x11a
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x11
+	.long	.LLRL85
+	.uleb128 0x6
+	.string	"g"
+	.value	0x22c
+	.byte	0x17
+	.long	0x103b
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x6
+	.string	"j"
+	.value	0x22f
+	.byte	0x10
+	.long	0x11a
+	.long	.LLST87
+	.long	.LVUS87
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LLRL88
+	.long	0xf26
+	.uleb128 0x6
+	.string	"i"
+	.value	0x239
+	.byte	0x11
+	.long	0x11a
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x11
+	.long	.LLRL90
+	.uleb128 0x6
+	.string	"g"
+	.value	0x23a
+	.byte	0x17
+	.long	0x103b
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x15
+	.long	.LLRL92
+	.long	0xed9
+	.uleb128 0x6
+	.string	"j"
+	.value	0x23e
+	.byte	0x15
+	.long	0x11a
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x4
+	.quad	.LVL204
+	.long	0x1050
+	.long	0xeab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL205
+	.long	0x816
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL201
+	.long	0x1bf3
+	.long	0xef7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL202
+	.long	0x816
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL152
+	.long	0x849
+	.long	0xf44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL157
+	.long	0x982
+	.long	0xf68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL192
+	.long	0x816
+	.long	0xf9b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -400
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL209
+	.long	0x91a
+	.long	0xfb5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL213
+	.long	0x816
+	.long	0xfe8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -388
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -400
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL215
+	.long	0x816
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -388
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -400
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x96
+	.long	0x102b
+	.uleb128 0xd
+	.long	0x48
+	.byte	0x67
+	.byte	0
+	.uleb128 0xc
+	.long	0x96
+	.long	0x103b
+	.uleb128 0xd
+	.long	0x48
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x8
+	.long	0x789
+	.uleb128 0xc
+	.long	0x103b
+	.long	0x1050
+	.uleb128 0xd
+	.long	0x48
+	.byte	0x9
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF179
+	.byte	0x1
+	.value	0x1d6
+	.byte	0xd
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11cd
+	.uleb128 0x17
+	.string	"buf"
+	.value	0x1d6
+	.byte	0x21
+	.long	0x91
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xe
+	.long	.LASF156
+	.value	0x1d6
+	.byte	0x2d
+	.long	0x11a
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x17
+	.string	"b"
+	.value	0x1d6
+	.byte	0x44
+	.long	0x54a
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x31
+	.string	"p"
+	.value	0x1d8
+	.byte	0x14
+	.long	0x11cd
+	.uleb128 0x6
+	.string	"n"
+	.value	0x1d9
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x6
+	.string	"len"
+	.value	0x1da
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x6
+	.string	"pos"
+	.value	0x1e5
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x15
+	.long	.LLRL27
+	.long	0x1148
+	.uleb128 0x6
+	.string	"i"
+	.value	0x1e6
+	.byte	0x11
+	.long	0x11a
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x5
+	.quad	.LVL58
+	.long	0x8bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1b
+	.byte	0x3
+	.quad	.LC8
+	.byte	0x3
+	.quad	.LC7
+	.byte	0x73
+	.sleb128 0
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.quad	.LVL53
+	.long	0x805
+	.uleb128 0x4
+	.quad	.LVL67
+	.long	0x8bc
+	.long	0x1180
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL69
+	.long	0x8bc
+	.long	0x11b1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL72
+	.long	0x8bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x2e
+	.uleb128 0x32
+	.long	.LASF163
+	.value	0x1c9
+	.byte	0x16
+	.long	0x103b
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x128f
+	.uleb128 0x1e
+	.long	.LASF153
+	.value	0x1c9
+	.byte	0x2e
+	.long	0x103b
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1e
+	.long	.LASF158
+	.value	0x1ca
+	.byte	0x27
+	.long	0x11a
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xe
+	.long	.LASF159
+	.value	0x1cb
+	.byte	0x27
+	.long	0x11a
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1e
+	.long	.LASF93
+	.value	0x1cc
+	.byte	0x26
+	.long	0x8f
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x6
+	.string	"i"
+	.value	0x1ce
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x4f
+	.long	0x128f
+	.quad	.LBI4
+	.byte	.LVU12
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.byte	0x1
+	.value	0x1ce
+	.byte	0x10
+	.uleb128 0x12
+	.long	0x12ab
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x12
+	.long	0x12a1
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xa
+	.long	0x12b5
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF185
+	.byte	0x1
+	.value	0x1c1
+	.byte	0x16
+	.long	0x11a
+	.byte	0x3
+	.long	0x12c0
+	.uleb128 0x33
+	.long	.LASF159
+	.byte	0x27
+	.long	0x11a
+	.uleb128 0x33
+	.long	.LASF93
+	.byte	0x33
+	.long	0x8f
+	.uleb128 0x31
+	.string	"h"
+	.value	0x1c3
+	.byte	0xe
+	.long	0x22d
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF167
+	.value	0x1aa
+	.long	0x11a
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1d
+	.long	.LASF161
+	.value	0x19b
+	.byte	0x6
+	.long	0x489
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x135b
+	.uleb128 0xe
+	.long	.LASF162
+	.value	0x19b
+	.byte	0x1c
+	.long	0x135b
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x17
+	.string	"cnt"
+	.value	0x19b
+	.byte	0x26
+	.long	0x5d
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x5
+	.quad	.LVL140
+	.long	0x865
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_list
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmp_size
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x11a
+	.uleb128 0x32
+	.long	.LASF164
+	.value	0x191
+	.byte	0xc
+	.long	0x5d
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13bb
+	.uleb128 0x34
+	.string	"a"
+	.byte	0x21
+	.long	0x458
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x34
+	.string	"b"
+	.byte	0x30
+	.long	0x458
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.string	"x"
+	.value	0x193
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x6
+	.string	"y"
+	.value	0x193
+	.byte	0x25
+	.long	0x11a
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF165
+	.value	0x188
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13ed
+	.uleb128 0xe
+	.long	.LASF166
+	.value	0x188
+	.byte	0x21
+	.long	0x41
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF168
+	.value	0x17b
+	.long	0x11a
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x25
+	.long	.LASF169
+	.value	0x176
+	.long	0x11a
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1d
+	.long	.LASF170
+	.value	0x16c
+	.byte	0x7
+	.long	0x91
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14ce
+	.uleb128 0x17
+	.string	"s"
+	.value	0x16c
+	.byte	0x1f
+	.long	0x110
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x6
+	.string	"len"
+	.value	0x16e
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x6
+	.string	"new"
+	.value	0x16f
+	.byte	0xb
+	.long	0x8f
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x4
+	.quad	.LVL129
+	.long	0x8a5
+	.long	0x149b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL131
+	.long	0x17dd
+	.long	0x14b3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL132
+	.long	0x1d1f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF171
+	.value	0x137
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16ed
+	.uleb128 0x17
+	.string	"p"
+	.value	0x137
+	.byte	0x16
+	.long	0x8f
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x6
+	.string	"b"
+	.value	0x141
+	.byte	0x12
+	.long	0x54a
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0xf
+	.long	.LASF172
+	.value	0x146
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x6
+	.string	"bn"
+	.value	0x153
+	.byte	0x12
+	.long	0x54a
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x6
+	.string	"bp"
+	.value	0x154
+	.byte	0x12
+	.long	0x54a
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x35
+	.long	0x1b84
+	.quad	.LBI51
+	.byte	.LVU303
+	.long	.LLRL52
+	.value	0x141
+	.byte	0x16
+	.long	0x15f7
+	.uleb128 0x12
+	.long	0x1b93
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x11
+	.long	.LLRL52
+	.uleb128 0xa
+	.long	0x1b9c
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x36
+	.long	0x1ba5
+	.long	.LLRL55
+	.long	0x15cf
+	.uleb128 0xa
+	.long	0x1ba6
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0xa
+	.long	0x1bb0
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x5
+	.quad	.LVL118
+	.long	0x982
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL120
+	.long	0x982
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	0x1b62
+	.quad	.LBI56
+	.byte	.LVU325
+	.quad	.LBB56
+	.quad	.LBE56-.LBB56
+	.value	0x146
+	.byte	0x16
+	.long	0x1637
+	.uleb128 0x12
+	.long	0x1b71
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0xa
+	.long	0x1b7a
+	.long	.LLST59
+	.long	.LVUS59
+	.byte	0
+	.uleb128 0x26
+	.long	0x1b62
+	.quad	.LBI58
+	.byte	.LVU335
+	.quad	.LBB58
+	.quad	.LBE58-.LBB58
+	.value	0x14f
+	.byte	0x6
+	.long	0x1677
+	.uleb128 0x12
+	.long	0x1b71
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0xa
+	.long	0x1b7a
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL108
+	.long	0x94b
+	.long	0x1695
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.uleb128 0x24
+	.quad	.LVL112
+	.long	0x1985
+	.uleb128 0x4
+	.quad	.LVL115
+	.long	0x982
+	.long	0x16c6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL125
+	.long	0x982
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF173
+	.value	0x12c
+	.byte	0x7
+	.long	0x8f
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1791
+	.uleb128 0xe
+	.long	.LASF174
+	.value	0x12c
+	.byte	0x1a
+	.long	0x11a
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0xe
+	.long	.LASF175
+	.value	0x12c
+	.byte	0x28
+	.long	0x11a
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0xf
+	.long	.LASF159
+	.value	0x131
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x132
+	.byte	0xb
+	.long	0x8f
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x4
+	.quad	.LVL95
+	.long	0x17dd
+	.long	0x1777
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL96
+	.long	0x1d28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF176
+	.value	0x126
+	.byte	0x7
+	.long	0x8f
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17dd
+	.uleb128 0xe
+	.long	.LASF159
+	.value	0x126
+	.byte	0x1a
+	.long	0x11a
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x5
+	.quad	.LVL90
+	.long	0x17dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF177
+	.byte	0x1
+	.byte	0xfa
+	.byte	0xe
+	.long	0x8f
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1985
+	.uleb128 0x18
+	.long	.LASF159
+	.byte	0xfa
+	.byte	0x21
+	.long	0x11a
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x18
+	.long	.LASF93
+	.byte	0xfa
+	.byte	0x2d
+	.long	0x8f
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xf
+	.long	.LASF178
+	.value	0x108
+	.byte	0x12
+	.long	0x54a
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x6
+	.string	"p"
+	.value	0x116
+	.byte	0xb
+	.long	0x8f
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x35
+	.long	0x1bbd
+	.quad	.LBI12
+	.byte	.LVU43
+	.long	.LLRL11
+	.value	0x101
+	.byte	0x9
+	.long	0x18a0
+	.uleb128 0x11
+	.long	.LLRL11
+	.uleb128 0xa
+	.long	0x1bcd
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x37
+	.long	0x1bd9
+	.quad	.LBI14
+	.byte	.LVU77
+	.long	.LLRL13
+	.byte	0x9e
+	.byte	0x19
+	.uleb128 0x11
+	.long	.LLRL13
+	.uleb128 0xa
+	.long	0x1be9
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	0x1b62
+	.quad	.LBI20
+	.byte	.LVU111
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.value	0x115
+	.byte	0x6
+	.long	0x18e0
+	.uleb128 0x12
+	.long	0x1b71
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xa
+	.long	0x1b7a
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL17
+	.long	0x982
+	.long	0x1904
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL24
+	.long	0x96b
+	.long	0x191c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 48
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL29
+	.long	0x94b
+	.long	0x1940
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL32
+	.long	0x982
+	.long	0x1964
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL36
+	.long	0x982
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF180
+	.byte	0xe6
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b21
+	.uleb128 0x18
+	.long	.LASF181
+	.byte	0xe6
+	.byte	0x21
+	.long	0x5d
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x18
+	.long	.LASF182
+	.byte	0xe6
+	.byte	0x31
+	.long	0x5d
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x39
+	.long	.LASF183
+	.byte	0xe8
+	.byte	0xc
+	.long	0x11a
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x11
+	.long	.LLRL32
+	.uleb128 0x52
+	.string	"b"
+	.byte	0x1
+	.byte	0xed
+	.byte	0x16
+	.long	0x54a
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x37
+	.long	0x1b21
+	.quad	.LBI32
+	.byte	.LVU241
+	.long	.LLRL34
+	.byte	0xf3
+	.byte	0x9
+	.uleb128 0x12
+	.long	0x1b2e
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x11
+	.long	.LLRL34
+	.uleb128 0xa
+	.long	0x1b37
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0xa
+	.long	0x1b40
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xa
+	.long	0x1b49
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x36
+	.long	0x1b54
+	.long	.LLRL39
+	.long	0x1aa5
+	.uleb128 0x53
+	.long	0x1b55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x4
+	.quad	.LVL79
+	.long	0x1bf3
+	.long	0x1a72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL80
+	.long	0x982
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.long	0x1b62
+	.quad	.LBI36
+	.byte	.LVU264
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x34
+	.long	0x1ae5
+	.uleb128 0x12
+	.long	0x1b71
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0xa
+	.long	0x1b7a
+	.long	.LLST41
+	.long	.LVUS41
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL81
+	.long	0x91a
+	.long	0x1afd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL87
+	.long	0x92b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF189
+	.byte	0x1
+	.byte	0xd2
+	.byte	0xd
+	.byte	0x1
+	.long	0x1b62
+	.uleb128 0x27
+	.string	"b"
+	.byte	0xd2
+	.byte	0x28
+	.long	0x54a
+	.uleb128 0x19
+	.string	"p"
+	.byte	0xd4
+	.byte	0x14
+	.long	0x11cd
+	.uleb128 0x19
+	.string	"n"
+	.byte	0xd5
+	.byte	0xc
+	.long	0x11a
+	.uleb128 0x1a
+	.long	.LASF184
+	.byte	0xd6
+	.byte	0xa
+	.long	0x489
+	.uleb128 0x3a
+	.uleb128 0x1a
+	.long	.LASF93
+	.byte	0xda
+	.byte	0xe
+	.long	0x102b
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF186
+	.byte	0xca
+	.byte	0x10
+	.long	0x135b
+	.long	0x1b84
+	.uleb128 0x27
+	.string	"b"
+	.byte	0xca
+	.byte	0x29
+	.long	0x54a
+	.uleb128 0x19
+	.string	"p"
+	.byte	0xcd
+	.byte	0xd
+	.long	0x135b
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF187
+	.byte	0xa6
+	.byte	0x15
+	.long	0x54a
+	.long	0x1bbd
+	.uleb128 0x27
+	.string	"p"
+	.byte	0xa6
+	.byte	0x27
+	.long	0x8f
+	.uleb128 0x19
+	.string	"b"
+	.byte	0xad
+	.byte	0x12
+	.long	0x54a
+	.uleb128 0x3a
+	.uleb128 0x19
+	.string	"ab"
+	.byte	0xb0
+	.byte	0x16
+	.long	0x54a
+	.uleb128 0x1a
+	.long	.LASF188
+	.byte	0xb1
+	.byte	0xe
+	.long	0x489
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF190
+	.byte	0x8a
+	.byte	0xd
+	.long	0x489
+	.byte	0x1
+	.long	0x1bd9
+	.uleb128 0x1a
+	.long	.LASF191
+	.byte	0x9e
+	.byte	0xe
+	.long	0x22d
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF192
+	.byte	0x7f
+	.byte	0x18
+	.long	0x22d
+	.byte	0x3
+	.long	0x1bf3
+	.uleb128 0x19
+	.string	"x"
+	.byte	0x81
+	.byte	0xe
+	.long	0x22d
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF193
+	.byte	0x19
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d1f
+	.uleb128 0x56
+	.string	"buf"
+	.byte	0x1
+	.byte	0x19
+	.byte	0x1f
+	.long	0x91
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x18
+	.long	.LASF156
+	.byte	0x19
+	.byte	0x2b
+	.long	0x11a
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x18
+	.long	.LASF93
+	.byte	0x19
+	.byte	0x3b
+	.long	0x8f
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x7
+	.long	.LASF194
+	.byte	0x1b
+	.byte	0xd
+	.long	0x163
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x57
+	.quad	.LBB22
+	.quad	.LBE22-.LBB22
+	.long	0x1cd2
+	.uleb128 0x39
+	.long	.LASF195
+	.byte	0x1d
+	.byte	0x15
+	.long	0x110
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x4
+	.quad	.LVL41
+	.long	0x8de
+	.long	0x1c9e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL44
+	.long	0x8bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL40
+	.long	0x8fa
+	.long	0x1cf1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL46
+	.long	0x8bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF127
+	.long	.LASF196
+	.uleb128 0x3d
+	.long	.LASF134
+	.long	.LASF197
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 449
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 401
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS96:
+	.uleb128 0
+	.uleb128 .LVU710
+	.uleb128 .LVU710
+	.uleb128 .LVU711
+	.uleb128 .LVU711
+	.uleb128 .LVU711
+	.uleb128 .LVU711
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 0
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-1-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	error_message
+	.byte	0x4
+	.uleb128 .LVL239-1-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	error_message
+	.byte	0x4
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 0
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 0
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -388
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -388
+	.byte	0
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU578
+	.uleb128 .LVU578
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 .LVU608
+	.uleb128 .LVU608
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU466
+	.uleb128 .LVU471
+	.uleb128 .LVU471
+	.uleb128 .LVU474
+	.uleb128 .LVU484
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU488
+	.uleb128 .LVU490
+	.uleb128 .LVU501
+	.uleb128 .LVU501
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU576
+	.uleb128 .LVU604
+	.uleb128 .LVU605
+	.uleb128 .LVU608
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU475
+	.uleb128 .LVU487
+	.uleb128 .LVU488
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU512
+	.uleb128 .LVU512
+	.uleb128 .LVU513
+	.uleb128 .LVU513
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 .LVU547
+	.uleb128 .LVU555
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU558
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU475
+	.uleb128 .LVU487
+	.uleb128 .LVU488
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU580
+	.uleb128 .LVU604
+	.uleb128 .LVU606
+	.uleb128 .LVU608
+	.uleb128 0
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU479
+	.uleb128 .LVU487
+	.uleb128 .LVU488
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 0
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL157-1-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU550
+	.uleb128 .LVU555
+	.uleb128 .LVU558
+	.uleb128 .LVU561
+	.uleb128 .LVU561
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU579
+	.uleb128 .LVU579
+	.uleb128 .LVU599
+	.uleb128 .LVU604
+	.uleb128 .LVU606
+	.uleb128 .LVU608
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 0
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -408
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU484
+	.uleb128 .LVU487
+	.uleb128 .LVU490
+	.uleb128 .LVU571
+	.uleb128 .LVU608
+	.uleb128 0
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU503
+	.uleb128 .LVU522
+	.uleb128 .LVU531
+	.uleb128 .LVU540
+	.uleb128 .LVU546
+	.uleb128 .LVU547
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU490
+	.uleb128 .LVU504
+	.uleb128 .LVU541
+	.uleb128 .LVU545
+	.uleb128 .LVU545
+	.uleb128 .LVU546
+	.uleb128 .LVU557
+	.uleb128 .LVU558
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU490
+	.uleb128 .LVU497
+	.uleb128 .LVU543
+	.uleb128 .LVU546
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU552
+	.uleb128 .LVU555
+	.uleb128 .LVU608
+	.uleb128 .LVU612
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU558
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU572
+	.uleb128 .LVU612
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 .LVU631
+	.uleb128 .LVU633
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL192-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU561
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU569
+	.uleb128 .LVU612
+	.uleb128 .LVU616
+	.uleb128 .LVU616
+	.uleb128 .LVU618
+	.uleb128 .LVU618
+	.uleb128 .LVU623
+	.uleb128 .LVU623
+	.uleb128 .LVU625
+	.uleb128 .LVU625
+	.uleb128 .LVU627
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x2
+	.byte	0x39
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU574
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU582
+	.uleb128 .LVU583
+	.uleb128 .LVU584
+	.uleb128 .LVU584
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU599
+	.uleb128 .LVU604
+	.uleb128 .LVU606
+	.uleb128 .LVU611
+	.uleb128 .LVU612
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU580
+	.uleb128 .LVU584
+	.uleb128 .LVU586
+	.uleb128 .LVU599
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU590
+	.uleb128 .LVU592
+	.uleb128 .LVU592
+	.uleb128 .LVU598
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU171
+	.uleb128 .LVU200
+	.uleb128 .LVU203
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU172
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU188
+	.uleb128 .LVU203
+	.uleb128 .LVU207
+	.uleb128 .LVU212
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU187
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU197
+	.uleb128 .LVU207
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU187
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU197
+	.uleb128 .LVU207
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU24
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU12
+	.uleb128 .LVU20
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU12
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU20
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU17
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU20
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 0
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 .LVU456
+	.uleb128 .LVU456
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_list_cnt
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU3
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU4
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS65:
+	.uleb128 0
+	.uleb128 .LVU423
+	.uleb128 .LVU423
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_seed
+	.byte	0
+.LVUS62:
+	.uleb128 0
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL129-1-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU402
+	.uleb128 .LVU410
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU404
+	.uleb128 .LVU408
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU376
+	.uleb128 .LVU376
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU323
+	.uleb128 .LVU373
+	.uleb128 .LVU385
+	.uleb128 .LVU388
+	.uleb128 .LVU389
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU328
+	.uleb128 .LVU332
+	.uleb128 .LVU389
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 .LVU391
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU343
+	.uleb128 .LVU357
+	.uleb128 .LVU393
+	.uleb128 .LVU395
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU345
+	.uleb128 .LVU372
+	.uleb128 .LVU393
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU303
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 .LVU323
+	.uleb128 .LVU376
+	.uleb128 .LVU385
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU307
+	.uleb128 .LVU323
+	.uleb128 .LVU376
+	.uleb128 .LVU385
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU311
+	.uleb128 .LVU320
+	.uleb128 .LVU376
+	.uleb128 .LVU377
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU312
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU317
+	.uleb128 .LVU317
+	.uleb128 .LVU320
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x29
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x29
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU325
+	.uleb128 .LVU328
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU327
+	.uleb128 .LVU328
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 0
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU335
+	.uleb128 .LVU338
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU337
+	.uleb128 .LVU338
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 0
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU288
+	.uleb128 .LVU288
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU291
+	.uleb128 .LVU291
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU289
+	.uleb128 .LVU292
+	.uleb128 .LVU292
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU292
+	.uleb128 .LVU293
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU102
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU134
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU118
+	.uleb128 .LVU134
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU92
+	.uleb128 .LVU94
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x17
+	.byte	0x70
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0x2545f4914f6cdd1d
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x20
+	.byte	0x25
+	.byte	0x8
+	.byte	0x64
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x20
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU80
+	.uleb128 .LVU92
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU113
+	.uleb128 .LVU114
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 0
+	.byte	0x73
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x28
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU229
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU221
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU230
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU258
+	.uleb128 .LVU262
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU241
+	.uleb128 .LVU254
+	.uleb128 .LVU264
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU244
+	.uleb128 .LVU254
+	.uleb128 .LVU264
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU245
+	.uleb128 .LVU254
+	.uleb128 .LVU264
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU269
+	.uleb128 .LVU276
+	.uleb128 .LVU277
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-1-.Ltext0
+	.uleb128 0x9
+	.byte	0x70
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x29
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x9
+	.byte	0x70
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x29
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU264
+	.uleb128 .LVU267
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU266
+	.uleb128 .LVU267
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x28
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL40-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL40-1-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU157
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0
+.LLRL32:
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.LLRL55:
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0
+.LLRL77:
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0
+.LLRL81:
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0
+.LLRL85:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0
+.LLRL88:
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0
+.LLRL90:
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0
+.LLRL92:
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF10:
+	.string	"__off_t"
+.LASF7:
+	.string	"short int"
+.LASF21:
+	.string	"_ISgraph"
+.LASF135:
+	.string	"malloc"
+.LASF65:
+	.string	"_shortbuf"
+.LASF151:
+	.string	"ngroups"
+.LASF192:
+	.string	"fail_random"
+.LASF26:
+	.string	"size_t"
+.LASF90:
+	.string	"next"
+.LASF43:
+	.string	"uintptr_t"
+.LASF186:
+	.string	"find_footer"
+.LASF100:
+	.string	"quarantine_head"
+.LASF19:
+	.string	"_ISspace"
+.LASF120:
+	.string	"siglongjmp"
+.LASF87:
+	.string	"quarantine_max_blocks"
+.LASF107:
+	.string	"alloc_seq"
+.LASF144:
+	.string	"exception_cancel"
+.LASF29:
+	.string	"dli_sname"
+.LASF81:
+	.string	"MSG_ERROR"
+.LASF53:
+	.string	"_IO_buf_base"
+.LASF197:
+	.string	"__builtin_memset"
+.LASF32:
+	.string	"long long unsigned int"
+.LASF96:
+	.string	"block_ele_t"
+.LASF161:
+	.string	"set_fail_list"
+.LASF16:
+	.string	"_ISalpha"
+.LASF149:
+	.string	"sample"
+.LASF68:
+	.string	"_codecvt"
+.LASF17:
+	.string	"_ISdigit"
+.LASF88:
+	.string	"quarantine_max_kb"
+.LASF41:
+	.string	"long long int"
+.LASF6:
+	.string	"signed char"
+.LASF44:
+	.string	"__jmp_buf_tag"
+.LASF102:
+	.string	"quarantine_count"
+.LASF131:
+	.string	"dladdr"
+.LASF118:
+	.string	"leak_group_t"
+.LASF113:
+	.string	"error_message"
+.LASF60:
+	.string	"_fileno"
+.LASF48:
+	.string	"_IO_read_end"
+.LASF139:
+	.string	"error_check"
+.LASF165:
+	.string	"set_fail_seed"
+.LASF200:
+	.string	"report_signal_leave"
+.LASF8:
+	.string	"long int"
+.LASF156:
+	.string	"buf_size"
+.LASF121:
+	.string	"alarm"
+.LASF46:
+	.string	"_flags"
+.LASF69:
+	.string	"_wide_data"
+.LASF185:
+	.string	"leak_hash"
+.LASF63:
+	.string	"_cur_column"
+.LASF154:
+	.string	"ntop"
+.LASF83:
+	.string	"message_t"
+.LASF77:
+	.string	"_IO_codecvt"
+.LASF167:
+	.string	"allocation_number"
+.LASF62:
+	.string	"_old_offset"
+.LASF67:
+	.string	"_offset"
+.LASF3:
+	.string	"short unsigned int"
+.LASF150:
+	.string	"nslots"
+.LASF116:
+	.string	"count"
+.LASF177:
+	.string	"alloc_block"
+.LASF28:
+	.string	"dli_fbase"
+.LASF94:
+	.string	"magic_header"
+.LASF126:
+	.string	"qsort"
+.LASF92:
+	.string	"payload_size"
+.LASF160:
+	.string	"exception_setup"
+.LASF86:
+	.string	"fail_every"
+.LASF172:
+	.string	"footer"
+.LASF169:
+	.string	"allocation_check"
+.LASF24:
+	.string	"_ISpunct"
+.LASF76:
+	.string	"_IO_marker"
+.LASF36:
+	.string	"__jmpbuf"
+.LASF4:
+	.string	"unsigned int"
+.LASF179:
+	.string	"format_sample"
+.LASF71:
+	.string	"_freeres_buf"
+.LASF123:
+	.string	"fprintf"
+.LASF34:
+	.string	"__val"
+.LASF166:
+	.string	"seed"
+.LASF5:
+	.string	"long unsigned int"
+.LASF80:
+	.string	"MSG_WARN"
+.LASF106:
+	.string	"fail_list_pos"
+.LASF82:
+	.string	"MSG_FATAL"
+.LASF51:
+	.string	"_IO_write_ptr"
+.LASF35:
+	.string	"__sigset_t"
+.LASF195:
+	.string	"name"
+.LASF133:
+	.string	"memcmp"
+.LASF159:
+	.string	"size"
+.LASF170:
+	.string	"test_strdup"
+.LASF33:
+	.string	"__jmp_buf"
+.LASF136:
+	.string	"report_event"
+.LASF178:
+	.string	"new_block"
+.LASF115:
+	.string	"time_limited"
+.LASF164:
+	.string	"cmp_size"
+.LASF45:
+	.string	"_IO_FILE"
+.LASF55:
+	.string	"_IO_save_base"
+.LASF180:
+	.string	"trim_quarantine"
+.LASF174:
+	.string	"nelem"
+.LASF103:
+	.string	"quarantine_bytes"
+.LASF187:
+	.string	"find_header"
+.LASF196:
+	.string	"__builtin_memcpy"
+.LASF66:
+	.string	"_lock"
+.LASF171:
+	.string	"test_free"
+.LASF61:
+	.string	"_flags2"
+.LASF73:
+	.string	"_mode"
+.LASF111:
+	.string	"noallocate_mode"
+.LASF158:
+	.string	"mask"
+.LASF173:
+	.string	"test_calloc"
+.LASF128:
+	.string	"strlen"
+.LASF114:
+	.string	"jmp_ready"
+.LASF117:
+	.string	"samples"
+.LASF137:
+	.string	"limit_time"
+.LASF37:
+	.string	"__mask_was_saved"
+.LASF182:
+	.string	"max_kb"
+.LASF101:
+	.string	"quarantine_tail"
+.LASF95:
+	.string	"payload"
+.LASF47:
+	.string	"_IO_read_ptr"
+.LASF42:
+	.string	"uint64_t"
+.LASF85:
+	.string	"fail_probability"
+.LASF198:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF199:
+	.string	"_IO_lock_t"
+.LASF130:
+	.string	"strrchr"
+.LASF98:
+	.string	"allocated_count"
+.LASF175:
+	.string	"elsize"
+.LASF105:
+	.string	"fail_list_cnt"
+.LASF93:
+	.string	"site"
+.LASF40:
+	.string	"sig_atomic_t"
+.LASF138:
+	.string	"trigger_exception"
+.LASF9:
+	.string	"__uint64_t"
+.LASF38:
+	.string	"__saved_mask"
+.LASF147:
+	.string	"vlevel"
+.LASF108:
+	.string	"fail_state"
+.LASF152:
+	.string	"nbytes"
+.LASF140:
+	.string	"set_noallocate_mode"
+.LASF58:
+	.string	"_markers"
+.LASF148:
+	.string	"file"
+.LASF193:
+	.string	"format_site"
+.LASF189:
+	.string	"release_block"
+.LASF84:
+	.string	"_Bool"
+.LASF2:
+	.string	"unsigned char"
+.LASF157:
+	.string	"time_limit"
+.LASF110:
+	.string	"cautious_mode"
+.LASF54:
+	.string	"_IO_buf_end"
+.LASF163:
+	.string	"leak_slot"
+.LASF194:
+	.string	"info"
+.LASF59:
+	.string	"_chain"
+.LASF153:
+	.string	"table"
+.LASF142:
+	.string	"noallocate"
+.LASF181:
+	.string	"max_blocks"
+.LASF22:
+	.string	"_ISblank"
+.LASF75:
+	.string	"FILE"
+.LASF119:
+	.string	"exit"
+.LASF122:
+	.string	"__sigsetjmp"
+.LASF176:
+	.string	"test_malloc"
+.LASF12:
+	.string	"char"
+.LASF201:
+	.string	"__ctype_b_loc"
+.LASF168:
+	.string	"allocation_bytes"
+.LASF23:
+	.string	"_IScntrl"
+.LASF18:
+	.string	"_ISxdigit"
+.LASF15:
+	.string	"_ISlower"
+.LASF30:
+	.string	"dli_saddr"
+.LASF183:
+	.string	"max_bytes"
+.LASF11:
+	.string	"__off64_t"
+.LASF145:
+	.string	"quarantine_flush"
+.LASF49:
+	.string	"_IO_read_base"
+.LASF127:
+	.string	"memcpy"
+.LASF57:
+	.string	"_IO_save_end"
+.LASF97:
+	.string	"allocated"
+.LASF132:
+	.string	"free"
+.LASF99:
+	.string	"allocated_bytes"
+.LASF31:
+	.string	"Dl_info"
+.LASF91:
+	.string	"prev"
+.LASF72:
+	.string	"__pad5"
+.LASF129:
+	.string	"snprintf"
+.LASF52:
+	.string	"_IO_write_end"
+.LASF188:
+	.string	"found"
+.LASF74:
+	.string	"_unused2"
+.LASF89:
+	.string	"BELE"
+.LASF134:
+	.string	"memset"
+.LASF39:
+	.string	"jmp_buf"
+.LASF143:
+	.string	"cautious"
+.LASF25:
+	.string	"_ISalnum"
+.LASF141:
+	.string	"set_cautious_mode"
+.LASF124:
+	.string	"calloc"
+.LASF14:
+	.string	"_ISupper"
+.LASF27:
+	.string	"dli_fname"
+.LASF56:
+	.string	"_IO_backup_base"
+.LASF104:
+	.string	"fail_list"
+.LASF64:
+	.string	"_vtable_offset"
+.LASF79:
+	.string	"__compar_fn_t"
+.LASF190:
+	.string	"fail_allocation"
+.LASF70:
+	.string	"_freeres_list"
+.LASF125:
+	.string	"report"
+.LASF78:
+	.string	"_IO_wide_data"
+.LASF184:
+	.string	"intact"
+.LASF155:
+	.string	"bigger"
+.LASF162:
+	.string	"list"
+.LASF50:
+	.string	"_IO_write_base"
+.LASF112:
+	.string	"error_occurred"
+.LASF13:
+	.string	"__sig_atomic_t"
+.LASF20:
+	.string	"_ISprint"
+.LASF109:
+	.string	"fail_seed"
+.LASF146:
+	.string	"report_leaks"
+.LASF191:
+	.string	"weight"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"harness.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,58 @@
+#include "histogram.h"
+
+#include <string.h>
+
+#define SUB_COUNT (1 << HIST_SUB_BITS)
+
+void hist_init(histogram_t *h)
+{
+    memset(h, 0, sizeof(histogram_t));
+}
+
+static inline int bucket_index(uint64_t value)
+{
+    if (value < SUB_COUNT)
+        return (int) value;
+    int e = 63 - __builtin_clzll(value);
+    int shift = e - HIST_SUB_BITS;
+    return ((shift + 1) << HIST_SUB_BITS) |
+           (int) ((value >> shift) & (SUB_COUNT - 1));
+}
+
+/* Highest value falling in bucket */
+static uint64_t bucket_top(int index)
+{
+    if (index < SUB_COUNT)
+        return index;
+    int shift = (index >> HIST_SUB_BITS) - 1;
+    uint64_t low = (uint64_t) (SUB_COUNT + (index & (SUB_COUNT - 1))) << shift;
+    return low + ((uint64_t) 1 << shift) - 1;
+}
+
+void hist_record(histogram_t *h, uint64_t value)
+{
+    h->buckets[bucket_index(value)]++;
+    h->count++;
+    if (value > h->max)
+        h->max = value;
+}
+
+uint64_t hist_percentile(histogram_t *h, double p)
+{
+    if (h->count == 0)
+        return 0;
+
+    /* Rank of wanted value, counting from 1 */
+    uint64_t rank = (uint64_t) (p * h->count + 0.5);
+    if (rank < 1)
+        rank = 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen >= rank) {
+            uint64_t top = bucket_top(i);
+            return top < h->max ? top : h->max;
+        }
+    }
+    return h->max;
+}
@@ -0,0 +1,33 @@
+#ifndef LAB0_HISTOGRAM_H
+#define LAB0_HISTOGRAM_H
+
+#include <stdint.h>
+
+/*
+ * Log-linear histogram, in the style of HdrHistogram.
+ * Values below 2^HIST_SUB_BITS get a bucket each.  Above that, every power
+ * of two is split into 2^HIST_SUB_BITS equal buckets, so that a recorded
+ * value is known to within about 3%.
+ */
+#define HIST_SUB_BITS 5
+#define HIST_BUCKETS ((64 - HIST_SUB_BITS + 1) << HIST_SUB_BITS)
+
+typedef struct {
+    uint64_t count;
+    uint64_t max;
+    uint64_t buckets[HIST_BUCKETS];
+} histogram_t;
+
+/* Clear all recorded values */
+void hist_init(histogram_t *h);
+
+/* Record one value */
+void hist_record(histogram_t *h, uint64_t value);
+
+/*
+ * Return value below which fraction p of recorded values lie.
+ * Reported as highest value of its bucket, but never above maximum.
+ */
+uint64_t hist_percentile(histogram_t *h, double p);
+
+#endif /* LAB0_HISTOGRAM_H */
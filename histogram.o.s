@@ -0,0 +1,1801 @@
+	.file	"histogram.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "histogram.c"
+	.globl	hist_init
+	.type	hist_init, @function
+hist_init:
+.LVL0:
+.LFB0:
+	.file 1 "histogram.c"
+	.loc 1 8 1 view -0
+	.cfi_startproc
+	.loc 1 8 1 is_stmt 0 view .LVU1
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 9 5 is_stmt 1 view .LVU2
+	movl	$15376, %edx	#,
+	movl	$0, %esi	#,
+	call	memset@PLT	#
+.LVL1:
+# histogram.c:10: }
+	.loc 1 10 1 is_stmt 0 view .LVU3
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE0:
+	.size	hist_init, .-hist_init
+	.globl	hist_record
+	.type	hist_record, @function
+hist_record:
+.LVL2:
+.LFB3:
+	.loc 1 33 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 33 1 is_stmt 0 view .LVU5
+	movq	%rdi, %rax	# tmp117, h
+	.loc 1 34 5 is_stmt 1 view .LVU6
+.LVL3:
+.LBB4:
+.LBI4:
+	.loc 1 12 19 view .LVU7
+.LBB5:
+	.loc 1 14 5 view .LVU8
+# histogram.c:15:         return (int) value;
+	.loc 1 15 16 is_stmt 0 view .LVU9
+	movl	%esi, %edx	# value, _21
+# histogram.c:14:     if (value < SUB_COUNT)
+	.loc 1 14 8 view .LVU10
+	cmpq	$31, %rsi	#, value
+	jbe	.L5	#,
+	.loc 1 16 5 is_stmt 1 view .LVU11
+# histogram.c:16:     int e = 63 - __builtin_clzll(value);
+	.loc 1 16 18 is_stmt 0 view .LVU12
+	bsrq	%rsi, %rdi	# value, tmp98
+.LVL4:
+	.loc 1 16 18 view .LVU13
+	xorq	$63, %rdi	#, tmp97
+.LVL5:
+	.loc 1 17 5 is_stmt 1 view .LVU14
+	.loc 1 18 5 view .LVU15
+# histogram.c:17:     int shift = e - HIST_SUB_BITS;
+	.loc 1 17 9 is_stmt 0 view .LVU16
+	movl	$58, %ecx	#, tmp100
+	subl	%edi, %ecx	# tmp97, shift
+.LVL6:
+# histogram.c:19:            (int) ((value >> shift) & (SUB_COUNT - 1));
+	.loc 1 19 26 view .LVU17
+	movq	%rsi, %rdx	# value, tmp101
+	shrq	%cl, %rdx	# shift, tmp101
+# histogram.c:19:            (int) ((value >> shift) & (SUB_COUNT - 1));
+	.loc 1 19 12 view .LVU18
+	andl	$31, %edx	#, tmp102
+# histogram.c:18:     return ((shift + 1) << HIST_SUB_BITS) |
+	.loc 1 18 20 view .LVU19
+	movl	$59, %ecx	#, tmp104
+.LVL7:
+	.loc 1 18 20 view .LVU20
+	subl	%edi, %ecx	# tmp97, tmp103
+# histogram.c:18:     return ((shift + 1) << HIST_SUB_BITS) |
+	.loc 1 18 25 view .LVU21
+	sall	$5, %ecx	#, tmp105
+# histogram.c:18:     return ((shift + 1) << HIST_SUB_BITS) |
+	.loc 1 18 43 view .LVU22
+	orl	%ecx, %edx	# tmp105, _21
+.LVL8:
+.L5:
+	.loc 1 18 43 view .LVU23
+.LBE5:
+.LBE4:
+# histogram.c:34:     h->buckets[bucket_index(value)]++;
+	.loc 1 34 36 view .LVU24
+	movslq	%edx, %rdx	# _21, _21
+	addq	$1, 16(%rax,%rdx,8)	#, h_10(D)->buckets[_22]
+	.loc 1 35 5 is_stmt 1 view .LVU25
+# histogram.c:35:     h->count++;
+	.loc 1 35 13 is_stmt 0 view .LVU26
+	addq	$1, (%rax)	#, h_10(D)->count
+	.loc 1 36 5 is_stmt 1 view .LVU27
+# histogram.c:36:     if (value > h->max)
+	.loc 1 36 8 is_stmt 0 view .LVU28
+	cmpq	%rsi, 8(%rax)	# value, h_10(D)->max
+	jnb	.L3	#,
+	.loc 1 37 9 is_stmt 1 view .LVU29
+# histogram.c:37:         h->max = value;
+	.loc 1 37 16 is_stmt 0 view .LVU30
+	movq	%rsi, 8(%rax)	# value, h_10(D)->max
+.L3:
+# histogram.c:38: }
+	.loc 1 38 1 view .LVU31
+	ret	
+	.cfi_endproc
+.LFE3:
+	.size	hist_record, .-hist_record
+	.globl	hist_percentile
+	.type	hist_percentile, @function
+hist_percentile:
+.LVL9:
+.LFB4:
+	.loc 1 41 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 42 5 view .LVU33
+# histogram.c:42:     if (h->count == 0)
+	.loc 1 42 10 is_stmt 0 view .LVU34
+	movq	(%rdi), %rax	# h_12(D)->count, <retval>
+# histogram.c:42:     if (h->count == 0)
+	.loc 1 42 8 view .LVU35
+	testq	%rax, %rax	# <retval>
+	je	.L7	#,
+	.loc 1 46 5 is_stmt 1 view .LVU36
+.LVL10:
+	.loc 1 47 5 view .LVU37
+# histogram.c:46:     uint64_t rank = (uint64_t) (p * h->count + 0.5);
+	.loc 1 46 35 is_stmt 0 view .LVU38
+	js	.L9	#,
+	pxor	%xmm1, %xmm1	# tmp105
+	cvtsi2sdq	%rax, %xmm1	# <retval>, tmp105
+.LVL11:
+.L10:
+	.loc 1 46 35 view .LVU39
+	mulsd	%xmm1, %xmm0	# tmp105, tmp109
+.LVL12:
+# histogram.c:46:     uint64_t rank = (uint64_t) (p * h->count + 0.5);
+	.loc 1 46 46 view .LVU40
+	addsd	.LC0(%rip), %xmm0	#, tmp110
+# histogram.c:46:     uint64_t rank = (uint64_t) (p * h->count + 0.5);
+	.loc 1 46 14 view .LVU41
+	comisd	.LC1(%rip), %xmm0	#, tmp110
+	jnb	.L11	#,
+	cvttsd2siq	%xmm0, %r8	# tmp110, _10
+.L12:
+	testq	%r8, %r8	# _10
+	movl	$1, %eax	#, tmp131
+	cmove	%rax, %r8	# _10,, tmp131, _10
+.LVL13:
+	.loc 1 49 5 is_stmt 1 view .LVU42
+	.loc 1 50 5 view .LVU43
+.LBB10:
+	.loc 1 50 10 view .LVU44
+	.loc 1 50 23 view .LVU45
+	.loc 1 51 9 view .LVU46
+# histogram.c:51:         seen += h->buckets[i];
+	.loc 1 51 27 is_stmt 0 view .LVU47
+	movq	16(%rdi), %rcx	# h_12(D)->buckets[0], seen
+.LVL14:
+	.loc 1 52 9 is_stmt 1 view .LVU48
+# histogram.c:52:         if (seen >= rank) {
+	.loc 1 52 12 is_stmt 0 view .LVU49
+	cmpq	%r8, %rcx	# _10, seen
+	jnb	.L18	#,
+.LVL15:
+.L14:
+	.loc 1 50 40 is_stmt 1 discriminator 2 view .LVU50
+	.loc 1 50 23 discriminator 2 view .LVU51
+	cmpq	$1920, %rax	#, ivtmp.13
+	je	.L20	#,
+	.loc 1 51 9 view .LVU52
+# histogram.c:51:         seen += h->buckets[i];
+	.loc 1 51 14 is_stmt 0 view .LVU53
+	addq	16(%rdi,%rax,8), %rcx	# MEM[(long unsigned int *)h_12(D) + 16B + ivtmp.13_18 * 8], seen
+.LVL16:
+	.loc 1 52 9 is_stmt 1 view .LVU54
+# histogram.c:52:         if (seen >= rank) {
+	.loc 1 52 12 is_stmt 0 view .LVU55
+	leaq	1(%rax), %rsi	#, ivtmp.13
+	cmpq	%r8, %rcx	# _10, tmp117
+	jnb	.L21	#,
+	movq	%rsi, %rax	# ivtmp.13, ivtmp.13
+.LVL17:
+	.loc 1 52 12 view .LVU56
+	jmp	.L14	#
+.LVL18:
+.L9:
+	.loc 1 52 12 view .LVU57
+.LBE10:
+# histogram.c:46:     uint64_t rank = (uint64_t) (p * h->count + 0.5);
+	.loc 1 46 35 view .LVU58
+	movq	%rax, %rdx	# <retval>, tmp107
+	shrq	%rdx	# tmp107
+	andl	$1, %eax	#, tmp108
+.LVL19:
+	.loc 1 46 35 view .LVU59
+	orq	%rax, %rdx	# tmp108, tmp107
+	pxor	%xmm1, %xmm1	# tmp106
+	cvtsi2sdq	%rdx, %xmm1	# tmp107, tmp106
+	addsd	%xmm1, %xmm1	# tmp106, tmp105
+	jmp	.L10	#
+.LVL20:
+.L11:
+# histogram.c:46:     uint64_t rank = (uint64_t) (p * h->count + 0.5);
+	.loc 1 46 14 view .LVU60
+	subsd	.LC1(%rip), %xmm0	#, tmp113
+	cvttsd2siq	%xmm0, %r8	# tmp113, _10
+	btcq	$63, %r8	#, _10
+	jmp	.L12	#
+.LVL21:
+.L21:
+.LBB17:
+# histogram.c:50:     for (int i = 0; i < HIST_BUCKETS; i++) {
+	.loc 1 50 40 view .LVU61
+	movl	%eax, %edx	# ivtmp.13, i
+.LBB11:
+	.loc 1 53 13 is_stmt 1 view .LVU62
+.LVL22:
+.LBB12:
+.LBI12:
+	.loc 1 23 17 view .LVU63
+.LBB13:
+	.loc 1 25 5 view .LVU64
+# histogram.c:25:     if (index < SUB_COUNT)
+	.loc 1 25 8 is_stmt 0 view .LVU65
+	cmpl	$31, %eax	#, ivtmp.13
+	jle	.L13	#,
+	.loc 1 27 5 is_stmt 1 view .LVU66
+# histogram.c:27:     int shift = (index >> HIST_SUB_BITS) - 1;
+	.loc 1 27 24 is_stmt 0 view .LVU67
+	movl	%eax, %ecx	# ivtmp.13, tmp119
+.LVL23:
+	.loc 1 27 24 view .LVU68
+	sarl	$5, %ecx	#, tmp119
+# histogram.c:27:     int shift = (index >> HIST_SUB_BITS) - 1;
+	.loc 1 27 9 view .LVU69
+	subl	$1, %ecx	#, shift
+.LVL24:
+	.loc 1 28 5 is_stmt 1 view .LVU70
+	.loc 1 29 5 view .LVU71
+# histogram.c:28:     uint64_t low = (uint64_t) (SUB_COUNT + (index & (SUB_COUNT - 1))) << shift;
+	.loc 1 28 42 is_stmt 0 view .LVU72
+	andl	$31, %eax	#, tmp121
+.LVL25:
+# histogram.c:28:     uint64_t low = (uint64_t) (SUB_COUNT + (index & (SUB_COUNT - 1))) << shift;
+	.loc 1 28 20 view .LVU73
+	leaq	32(%rax), %rdx	#, tmp122
+.LVL26:
+# histogram.c:28:     uint64_t low = (uint64_t) (SUB_COUNT + (index & (SUB_COUNT - 1))) << shift;
+	.loc 1 28 14 view .LVU74
+	salq	%cl, %rdx	# shift, low
+# histogram.c:29:     return low + ((uint64_t) 1 << shift) - 1;
+	.loc 1 29 32 view .LVU75
+	movl	$1, %eax	#, tmp125
+	salq	%cl, %rax	# shift, tmp124
+# histogram.c:29:     return low + ((uint64_t) 1 << shift) - 1;
+	.loc 1 29 42 view .LVU76
+	leaq	-1(%rdx,%rax), %rax	#, _29
+.LVL27:
+.L16:
+	.loc 1 29 42 view .LVU77
+.LBE13:
+.LBE12:
+	.loc 1 54 13 is_stmt 1 view .LVU78
+# histogram.c:54:             return top < h->max ? top : h->max;
+	.loc 1 54 39 is_stmt 0 view .LVU79
+	movq	8(%rdi), %rdx	# h_12(D)->max, tmp130
+	cmpq	%rdx, %rax	# tmp130, _29
+	cmova	%rdx, %rax	# _29,, tmp130, <retval>
+.LVL28:
+	.loc 1 54 39 view .LVU80
+	ret	
+.LVL29:
+.L18:
+	.loc 1 54 39 view .LVU81
+.LBE11:
+# histogram.c:50:     for (int i = 0; i < HIST_BUCKETS; i++) {
+	.loc 1 50 14 view .LVU82
+	movl	$0, %edx	#, i
+.LVL30:
+.L13:
+.LBB16:
+.LBB15:
+.LBB14:
+	.loc 1 26 9 is_stmt 1 view .LVU83
+# histogram.c:26:         return index;
+	.loc 1 26 16 is_stmt 0 view .LVU84
+	movslq	%edx, %rax	# i, _29
+	jmp	.L16	#
+.LVL31:
+.L20:
+	.loc 1 26 16 view .LVU85
+.LBE14:
+.LBE15:
+.LBE16:
+.LBE17:
+	.loc 1 57 5 is_stmt 1 view .LVU86
+# histogram.c:57:     return h->max;
+	.loc 1 57 13 is_stmt 0 view .LVU87
+	movq	8(%rdi), %rax	# h_12(D)->max, <retval>
+.LVL32:
+.L7:
+# histogram.c:58: }
+	.loc 1 58 1 view .LVU88
+	ret	
+	.cfi_endproc
+.LFE4:
+	.size	hist_percentile, .-hist_percentile
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	0
+	.long	1071644672
+	.align 8
+.LC1:
+	.long	0
+	.long	1138753536
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "histogram.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/string.h"
+	.file 7 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x31e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x11
+	.long	.LASF26
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x2
+	.long	.LASF11
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x13
+	.byte	0x8
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x2
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x6d
+	.uleb128 0x14
+	.value	0x3c10
+	.byte	0x4
+	.byte	0xf
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x8
+	.long	.LASF13
+	.byte	0x10
+	.long	0x82
+	.byte	0
+	.uleb128 0x15
+	.string	"max"
+	.byte	0x4
+	.byte	0x11
+	.byte	0xe
+	.long	0x82
+	.byte	0x8
+	.uleb128 0x8
+	.long	.LASF14
+	.byte	0x12
+	.long	0xbc
+	.byte	0x10
+	.byte	0
+	.uleb128 0x16
+	.long	0x82
+	.long	0xcd
+	.uleb128 0x17
+	.long	0x35
+	.value	0x77f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x13
+	.byte	0x3
+	.long	0x8e
+	.uleb128 0x2
+	.long	.LASF16
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x17
+	.long	0x35
+	.uleb128 0x18
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xe
+	.long	0x79
+	.long	0x105
+	.uleb128 0x4
+	.long	0x79
+	.uleb128 0x4
+	.long	0x5f
+	.uleb128 0x4
+	.long	0xd9
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x28
+	.byte	0xa
+	.long	0x82
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1dc
+	.uleb128 0x1a
+	.string	"h"
+	.byte	0x1
+	.byte	0x28
+	.byte	0x27
+	.long	0x1dc
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.string	"p"
+	.byte	0x28
+	.byte	0x31
+	.long	0x2e
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x9
+	.long	.LASF17
+	.byte	0x2e
+	.long	0x82
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x9
+	.long	.LASF18
+	.byte	0x31
+	.long	0x82
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x6
+	.long	.LLRL8
+	.uleb128 0xa
+	.string	"i"
+	.byte	0x32
+	.byte	0xe
+	.long	0x5f
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x6
+	.long	.LLRL10
+	.uleb128 0xa
+	.string	"top"
+	.byte	0x35
+	.byte	0x16
+	.long	0x82
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1b
+	.long	0x267
+	.quad	.LBI12
+	.byte	.LVU63
+	.long	.LLRL12
+	.byte	0x1
+	.byte	0x35
+	.byte	0x1c
+	.uleb128 0xb
+	.long	0x277
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x6
+	.long	.LLRL12
+	.uleb128 0x3
+	.long	0x282
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x3
+	.long	0x28c
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x8
+	.long	0xcd
+	.uleb128 0xc
+	.long	.LASF24
+	.byte	0x20
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x267
+	.uleb128 0x5
+	.string	"h"
+	.byte	0x20
+	.byte	0x1f
+	.long	0x1dc
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1d
+	.long	.LASF19
+	.byte	0x1
+	.byte	0x20
+	.byte	0x2b
+	.long	0x82
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1e
+	.long	0x298
+	.quad	.LBI4
+	.byte	.LVU7
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.byte	0x1
+	.byte	0x22
+	.byte	0x10
+	.uleb128 0xb
+	.long	0x2a8
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x3
+	.long	0x2b3
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x3
+	.long	0x2bc
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF21
+	.byte	0x17
+	.byte	0x11
+	.long	0x82
+	.byte	0x1
+	.long	0x298
+	.uleb128 0xe
+	.long	.LASF23
+	.byte	0x17
+	.byte	0x20
+	.long	0x5f
+	.uleb128 0xf
+	.long	.LASF20
+	.byte	0x1b
+	.long	0x5f
+	.uleb128 0x10
+	.string	"low"
+	.byte	0x1c
+	.byte	0xe
+	.long	0x82
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF22
+	.byte	0xc
+	.byte	0x13
+	.long	0x5f
+	.byte	0x3
+	.long	0x2c7
+	.uleb128 0xe
+	.long	.LASF19
+	.byte	0xc
+	.byte	0x29
+	.long	0x82
+	.uleb128 0x10
+	.string	"e"
+	.byte	0x10
+	.byte	0x9
+	.long	0x5f
+	.uleb128 0xf
+	.long	.LASF20
+	.byte	0x11
+	.long	0x5f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF25
+	.byte	0x7
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x316
+	.uleb128 0x5
+	.string	"h"
+	.byte	0x7
+	.byte	0x1d
+	.long	0x1dc
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1f
+	.quad	.LVL1
+	.long	0x316
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3c10
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF27
+	.long	.LASF29
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU37
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU88
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x19
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3fe00000
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1a
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3fe00000
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3fe00000
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x19
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3fe00000
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1a
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3fe00000
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0
+	.long	0x3fe00000
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU43
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU57
+	.uleb128 .LVU61
+	.uleb128 .LVU68
+	.uleb128 .LVU81
+	.uleb128 .LVU88
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU45
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU56
+	.uleb128 .LVU61
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU74
+	.uleb128 .LVU81
+	.uleb128 .LVU83
+	.uleb128 .LVU85
+	.uleb128 .LVU88
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU77
+	.uleb128 .LVU80
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU63
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU74
+	.uleb128 .LVU83
+	.uleb128 .LVU85
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU70
+	.uleb128 .LVU77
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU71
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU74
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x16
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4f
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x72
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x16
+	.byte	0x71
+	.sleb128 0
+	.byte	0x4f
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x72
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU7
+	.uleb128 .LVU23
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU14
+	.uleb128 .LVU23
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU15
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU23
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 .LFE0-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF12:
+	.string	"uint64_t"
+.LASF8:
+	.string	"short int"
+.LASF16:
+	.string	"size_t"
+.LASF21:
+	.string	"bucket_top"
+.LASF19:
+	.string	"value"
+.LASF29:
+	.string	"__builtin_memset"
+.LASF23:
+	.string	"index"
+.LASF17:
+	.string	"rank"
+.LASF25:
+	.string	"hist_init"
+.LASF27:
+	.string	"memset"
+.LASF9:
+	.string	"long int"
+.LASF20:
+	.string	"shift"
+.LASF15:
+	.string	"histogram_t"
+.LASF4:
+	.string	"unsigned char"
+.LASF28:
+	.string	"hist_percentile"
+.LASF7:
+	.string	"signed char"
+.LASF6:
+	.string	"unsigned int"
+.LASF14:
+	.string	"buckets"
+.LASF24:
+	.string	"hist_record"
+.LASF5:
+	.string	"short unsigned int"
+.LASF22:
+	.string	"bucket_index"
+.LASF10:
+	.string	"char"
+.LASF18:
+	.string	"seen"
+.LASF11:
+	.string	"__uint64_t"
+.LASF3:
+	.string	"long unsigned int"
+.LASF2:
+	.string	"double"
+.LASF26:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF13:
+	.string	"count"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"histogram.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -11,7 +11,10 @@
 #include <sys/wait.h>
 #include <time.h>
 #include <unistd.h>
+#include "dudect/cpucycles.h"
 #include "dudect/fixture.h"
+#include "complexity.h"
+#include "histogram.h"
 
 /* Our program needs to use regular malloc/free */
 #define INTERNAL 1
@@ -52,12 +55,51 @@ static queue_t *q = NULL;
 /* Number of elements in queue */
 static size_t qcnt = 0;
 
+/*
+ * Queues that can be selected by name.  q and qcnt hold the current queue,
+ * and are only copied back to its slot when another queue is selected.
+ * Slot 0 is the queue used when no name is given.
+ */
+#define MAX_QUEUES 64
+#define QUEUE_NAME_LEN 16
+typedef struct {
+    char name[QUEUE_NAME_LEN];
+    queue_t *q;
+    size_t cnt;
+} queue_slot_t;
+
+static queue_slot_t queues[MAX_QUEUES];
+static int queue_slots = 1;
+static int current = 0;
+
 /* How many times can queue operations fail */
 static int fail_limit = BIG_QUEUE;
 static int fail_count = 0;
 
 static int string_length = MAXSTRING;
 
+/* Seed for random strings and malloc failures */
+static int seed = 0;
+
+/* Where to list leaked blocks, if anywhere */
+static char *leakfile_name = NULL;
+
+/* Allocation number at start of command, for metrics */
+static size_t metrics_alloc_start = 0;
+
+/* Cycles taken by each call in repeated operations */
+enum { lat_insert_head, lat_insert_tail, lat_size, lat_count };
+static const char *lat_names[lat_count] = {"insert_head", "insert_tail",
+                                           "size"};
+static histogram_t latency[lat_count];
+
+/* Negative cycle counts, as when the TSC differs between CPUs, are dropped */
+static inline void record_latency(int op, int64_t cycles)
+{
+    if (cycles >= 0)
+        hist_record(&latency[op], cycles);
+}
+
 #define MIN_RANDSTR_LEN 5
 #define MAX_RANDSTR_LEN 10
 static const char charset[] = "abcdefghijklmnopqrstuvwxyz";
@@ -66,6 +108,11 @@ static const char charset[] = "abcdefghijklmnopqrstuvwxyz";
 static bool show_queue(int vlevel);
 static bool do_new(int argc, char *argv[]);
 static bool do_free(int argc, char *argv[]);
+static bool do_use(int argc, char *argv[]);
+static bool do_queues(int argc, char *argv[]);
+static bool do_splice(int argc, char *argv[]);
+static bool do_merge(int argc, char *argv[]);
+static bool do_mergebench(int argc, char *argv[]);
 static bool do_insert_head(int argc, char *argv[]);
 static bool do_insert_tail(int argc, char *argv[]);
 static bool do_remove_head(int argc, char *argv[]);
@@ -74,13 +121,36 @@ static bool do_reverse(int argc, char *argv[]);
 static bool do_size(int argc, char *argv[]);
 static bool do_sort(int argc, char *argv[]);
 static bool do_show(int argc, char *argv[]);
+static bool do_failat(int argc, char *argv[]);
+static bool do_leaks(int argc, char *argv[]);
+static bool do_latency(int argc, char *argv[]);
+static bool do_complexity(int argc, char *argv[]);
+static void set_seed(int oldval);
+static void queue_metrics(bool after);
+static bool simulate(int argc, char *argv[], int mode);
 
 static void queue_init();
 
 static void console_init()
 {
-    add_cmd("new", do_new, "                | Create new queue");
-    add_cmd("free", do_free, "                | Delete queue");
+    add_cmd("new", do_new,
+            " [name]         | Create new queue, and make it the current one");
+    add_cmd("free", do_free,
+            " [name]         | Delete queue, and make it the current one");
+    add_cmd("use", do_use,
+            " name           | Make queue name the current one.  Other "
+            "commands operate on the current queue");
+    add_cmd("queues", do_queues, "                | List named queues");
+    add_cmd("splice", do_splice,
+            " name           | Move all elements of queue name to the tail of "
+            "the current queue");
+    add_cmd("merge", do_merge,
+            " name ...       | Merge the listed sorted queues into the current "
+            "queue, leaving them empty");
+    add_cmd("mergebench", do_mergebench,
+            " [n [t]]        | Time merging n elements split over 2 .. 256 "
+            "sorted queues, at once and pairwise, using the median of t trials "
+            "(default: n == 65536, t == 5)");
     add_cmd("ih", do_insert_head,
             " str [n]        | Insert string str at head of queue n times. "
             "Generate random string(s) if str equals RAND. (default: n == 1)");
@@ -98,20 +168,110 @@ static void console_init()
     add_cmd("size", do_size,
             " [n]            | Compute queue size n times (default: n == 1)");
     add_cmd("show", do_show, "                | Show queue contents");
+    add_cmd("failat", do_failat,
+            " [n ...]        | Make the listed calls to malloc fail "
+            "(no arguments clears the list)");
+    add_cmd("latency", do_latency,
+            " [reset]        | Show cycles per call of ih, it and size as "
+            "percentiles, or clear them");
+    add_cmd("complexity", do_complexity,
+            " op [max [n]]   | Fit running time of op (size, ih, it, rh, "
+            "splice, transfer, reverse or sort) on queues of 2^10 .. 2^max "
+            "elements, using the median of n trials (default: max == 22, "
+            "n == 5)");
+    add_cmd("leaks", do_leaks,
+            " [file]         | Summarize allocated blocks.  Optionally list "
+            "all of them in file");
     add_param("length", &string_length, "Maximum length of displayed string",
               NULL);
     add_param("malloc", &fail_probability, "Malloc failure probability percent",
               NULL);
+    add_param("mallocevery", &fail_every,
+              "Make every nth call to malloc fail (0 = never)", NULL);
+    add_param("seed", &seed,
+              "Seed for random strings and malloc failures (restarts "
+              "allocation numbering)",
+              set_seed);
     add_param("fail", &fail_limit,
               "Number of times allow queue operations to return false", NULL);
+    add_param("quarantine", &quarantine_max_blocks,
+              "Maximum number of freed blocks held to detect use after free",
+              NULL);
+    add_param("quarantinekb", &quarantine_max_kb,
+              "Maximum kilobytes of freed blocks held to detect use after free",
+              NULL);
+}
+
+/* Copy current queue back to its slot */
+static void save_queue()
+{
+    queues[current].q = q;
+    queues[current].cnt = qcnt;
+}
+
+static void select_queue(int i)
+{
+    save_queue();
+    current = i;
+    q = queues[i].q;
+    qcnt = queues[i].cnt;
+}
+
+/* Slot of queue name, or -1 */
+static int find_queue(char *name)
+{
+    for (int i = 0; i < queue_slots; i++) {
+        if (!strcmp(queues[i].name, name))
+            return i;
+    }
+    return -1;
+}
+
+/* Select queue name, adding it if create is set.  Reports failure */
+static bool use_queue(char *name, bool create)
+{
+    int i = find_queue(name);
+    if (i < 0 && !create) {
+        report(1, "No queue named '%s'", name);
+        return false;
+    }
+    if (i < 0) {
+        if (strlen(name) >= QUEUE_NAME_LEN) {
+            report(1, "Queue name '%s' is longer than %d characters", name,
+                   QUEUE_NAME_LEN - 1);
+            return false;
+        }
+        if (queue_slots == MAX_QUEUES) {
+            report(1, "Cannot have more than %d queues", MAX_QUEUES);
+            return false;
+        }
+        i = queue_slots++;
+        strcpy(queues[i].name, name);
+        queues[i].q = NULL;
+        queues[i].cnt = 0;
+    }
+    select_queue(i);
+    return true;
+}
+
+/* Does any queue other than the current one exist? */
+static bool other_queues()
+{
+    for (int i = 0; i < queue_slots; i++) {
+        if (i != current && queues[i].q)
+            return true;
+    }
+    return false;
 }
 
 static bool do_new(int argc, char *argv[])
 {
-    if (argc != 1) {
-        report(1, "%s takes no arguments", argv[0]);
+    if (argc != 1 && argc != 2) {
+        report(1, "%s needs 0-1 arguments", argv[0]);
         return false;
     }
+    if (argc == 2 && !use_queue(argv[1], true))
+        return false;
 
     bool ok = true;
     if (q) {
@@ -129,12 +289,32 @@ static bool do_new(int argc, char *argv[])
     return ok && !error_check();
 }
 
+/* Summarize leaked blocks, listing all of them in named file */
+static void show_leaks(char *file_name)
+{
+    FILE *file = NULL;
+    if (file_name) {
+        file = fopen(file_name, "w");
+        if (!file)
+            report(1, "Couldn't open leak file '%s'", file_name);
+    }
+
+    report_leaks(1, file);
+    if (file)
+        fclose(file);
+}
+
 static bool do_free(int argc, char *argv[])
 {
-    if (argc != 1) {
-        report(1, "%s takes no arguments", argv[0]);
+    if (simulation)
+        return simulate(argc, argv, test_free_queue);
+
+    if (argc != 1 && argc != 2) {
+        report(1, "%s needs 0-1 arguments", argv[0]);
         return false;
     }
+    if (argc == 2 && !use_queue(argv[1], false))
+        return false;
 
     bool ok = true;
     if (!q)
@@ -152,15 +332,91 @@ static bool do_free(int argc, char *argv[])
     qcnt = 0;
     show_queue(3);
 
-    size_t bcnt = allocation_check();
+    /* Blocks of other queues are still allocated */
+    size_t bcnt = other_queues() ? 0 : allocation_check();
     if (bcnt > 0) {
         report(1, "ERROR: Freed queue, but %lu blocks are still allocated",
                bcnt);
+        show_leaks(leakfile_name);
         ok = false;
     }
 
     return ok && !error_check();
 }
+
+static bool do_use(int argc, char *argv[])
+{
+    if (argc != 2) {
+        report(1, "%s needs 1 argument", argv[0]);
+        return false;
+    }
+    if (!use_queue(argv[1], false))
+        return false;
+    show_queue(3);
+    return true;
+}
+
+static bool do_queues(int argc, char *argv[])
+{
+    if (argc != 1) {
+        report(1, "%s takes no arguments", argv[0]);
+        return false;
+    }
+    save_queue();
+    for (int i = 0; i < queue_slots; i++) {
+        if (queues[i].q)
+            report(1, "%c %-15s %lu elements", i == current ? '*' : ' ',
+                   queues[i].name, queues[i].cnt);
+        else
+            report(1, "%c %-15s NULL", i == current ? '*' : ' ',
+                   queues[i].name);
+    }
+    return true;
+}
+
+static bool do_splice(int argc, char *argv[])
+{
+    if (argc != 2) {
+        report(1, "%s needs 1 argument", argv[0]);
+        return false;
+    }
+    int i = find_queue(argv[1]);
+    if (i < 0) {
+        report(1, "No queue named '%s'", argv[1]);
+        return false;
+    }
+    if (i == current) {
+        report(1, "Cannot splice queue '%s' onto itself", argv[1]);
+        return false;
+    }
+
+    queue_slot_t *src = &queues[i];
+    if (!q)
+        report(3, "Warning: Calling splice on null queue");
+    if (!src->q)
+        report(3, "Warning: Splicing null queue");
+    error_check();
+
+    set_noallocate_mode(true);
+    if (exception_setup(true))
+        q_splice(q, src->q);
+    exception_cancel();
+    set_noallocate_mode(false);
+
+    bool ok = true;
+    if (q && src->q) {
+        if (src->q->head || src->q->tail) {
+            report(1, "ERROR: Queue '%s' not empty after splice", src->name);
+            ok = false;
+        }
+        qcnt += src->cnt;
+        src->cnt = 0;
+    }
+
+    show_queue(3);
+    return ok && !error_check();
+}
+
 /*
  * TODO: Add a buf_size check of if the buf_size may be less
  * than MIN_RANDSTR_LEN.
@@ -177,8 +433,225 @@ static void fill_rand_string(char *buf, size_t buf_size)
     buf[len] = '\0';
 }
 
+/* Check that queue q holds cnt elements in ascending order */
+static bool check_sorted(queue_t *q, size_t cnt)
+{
+    bool ok = true;
+    if (!q)
+        return true;
+    if (exception_setup(true)) {
+        for (list_ele_t *e = q->head; e && --cnt; e = e->next) {
+            /* Ensure each element in ascending order */
+            if (strcasecmp(e->value, e->next->value) > 0) {
+                report(1, "ERROR: Not sorted in ascending order");
+                ok = false;
+                break;
+            }
+        }
+    }
+    exception_cancel();
+    return ok;
+}
+
+static bool do_merge(int argc, char *argv[])
+{
+    if (argc < 2) {
+        report(1, "%s needs at least 1 argument", argv[0]);
+        return false;
+    }
+    int slots[MAX_QUEUES];
+    queue_t *qs[MAX_QUEUES + 1];
+    for (int i = 1; i < argc; i++) {
+        int j = find_queue(argv[i]);
+        if (j < 0) {
+            report(1, "No queue named '%s'", argv[i]);
+            return false;
+        }
+        if (j == current) {
+            report(1, "Cannot merge queue '%s' into itself", argv[i]);
+            return false;
+        }
+        for (int k = 1; k < i; k++) {
+            if (slots[k - 1] == j) {
+                report(1, "Queue '%s' listed twice", argv[i]);
+                return false;
+            }
+        }
+        slots[i - 1] = j;
+        qs[i] = queues[j].q;
+    }
+    qs[0] = q;
+
+    if (!q)
+        report(3, "Warning: Calling merge on null queue");
+    error_check();
+
+    set_noallocate_mode(true);
+    if (exception_setup(true))
+        q_merge_k(qs, argc);
+    exception_cancel();
+    set_noallocate_mode(false);
+
+    bool ok = true;
+    if (q) {
+        for (int i = 1; i < argc; i++) {
+            queue_slot_t *src = &queues[slots[i - 1]];
+            if (!src->q)
+                continue;
+            if (src->q->head || src->q->tail) {
+                report(1, "ERROR: Queue '%s' not empty after merge",
+                       src->name);
+                ok = false;
+            }
+            qcnt += src->cnt;
+            src->cnt = 0;
+        }
+        ok = ok && check_sorted(q, qcnt);
+    }
+
+    show_queue(3);
+    return ok && !error_check();
+}
+
+#define MERGE_MAX_K 256
+#define MERGE_MAX_TRIALS 101
+
+/* Deal the elements of sorted queue q out to k queues, keeping each sorted */
+static bool merge_deal(queue_t *q, queue_t **qs, int k)
+{
+    char buf[MAX_RANDSTR_LEN];
+    for (int i = 0; q_remove_head(q, buf, sizeof(buf)); i = (i + 1) % k) {
+        if (!q_insert_tail(qs[i], buf))
+            return false;
+    }
+    return true;
+}
+
+static bool do_mergebench(int argc, char *argv[])
+{
+    int n = 65536, trials = 5;
+    if (argc > 3) {
+        report(1, "%s needs 0-2 arguments", argv[0]);
+        return false;
+    }
+    if (argc > 1 && (!get_int(argv[1], &n) || n < MERGE_MAX_K)) {
+        report(1, "Invalid number of elements '%s', must be at least %d",
+               argv[1], MERGE_MAX_K);
+        return false;
+    }
+    if (argc > 2 && (!get_int(argv[2], &trials) || trials < 1 ||
+                     trials > MERGE_MAX_TRIALS)) {
+        report(1, "Invalid number of trials '%s', must be 1 .. %d", argv[2],
+               MERGE_MAX_TRIALS);
+        return false;
+    }
+    error_check();
+
+    queue_t *qs[MERGE_MAX_K] = {NULL};
+    queue_t *all = NULL;
+    double heap_ns[MERGE_MAX_TRIALS], pair_ns[MERGE_MAX_TRIALS];
+    char randstr_buf[MAX_RANDSTR_LEN];
+    bool ok = true;
+
+    /* Checking every free against all live blocks would dominate */
+    set_cautious_mode(false);
+    if (exception_setup(false)) {
+        all = q_new();
+        for (int i = 0; all && i < n; i++) {
+            fill_rand_string(randstr_buf, sizeof(randstr_buf));
+            if (!q_insert_head(all, randstr_buf)) {
+                report(1, "ERROR: Could not build queue of %d elements", n);
+                ok = false;
+                break;
+            }
+        }
+        q_sort(all);
+        for (int i = 0; all && ok && i < MERGE_MAX_K; i++)
+            ok = (qs[i] = q_new()) != NULL;
+        if (!all || !ok) {
+            report(1, "ERROR: Could not allocate queues");
+            ok = false;
+        }
+
+        report(1, "%6s %18s %18s", "Queues", "Heap (ns/elem)",
+               "Pairwise (ns/elem)");
+        for (int k = 2; ok && k <= MERGE_MAX_K; k *= 2) {
+            for (int t = 0; ok && t < trials; t++) {
+                ok = merge_deal(all, qs, k);
+                uint64_t start = time_ns();
+                q_merge_k(qs, k);
+                heap_ns[t] = (double) (time_ns() - start) / n;
+
+                q_splice(all, qs[0]);
+                ok = ok && check_sorted(all, n) && merge_deal(all, qs, k);
+                start = time_ns();
+                for (int i = 1; i < k; i++) {
+                    queue_t *pair[2] = {qs[0], qs[i]};
+                    q_merge_k(pair, 2);
+                }
+                pair_ns[t] = (double) (time_ns() - start) / n;
+                q_splice(all, qs[0]);
+                if (ok && !check_sorted(all, n))
+                    ok = false;
+            }
+            if (ok)
+                report(1, "%6d %18.1f %18.1f", k,
+                       cplx_median(heap_ns, trials),
+                       cplx_median(pair_ns, trials));
+        }
+    } else {
+        ok = false;
+    }
+    exception_cancel();
+    if (exception_setup(false)) {
+        q_free(all);
+        for (int i = 0; i < MERGE_MAX_K; i++)
+            q_free(qs[i]);
+    }
+    exception_cancel();
+    set_cautious_mode(true);
+    if (!ok)
+        report(1, "ERROR: Could not complete merge benchmark");
+    return ok && !error_check();
+}
+
+/* Add verdict of constant-time test to metrics record */
+static void record_const(bool ok)
+{
+    const_result_t r = last_const_result();
+    metric_bool("constant", ok);
+    metric_double("t", r.max_t);
+    metric_int("t_test", r.test);
+    metric_double("measurements", r.measurements);
+    if (r.rate > 0)
+        metric_double("samples_per_sec", r.rate);
+}
+
+/* Check complexity of operation, instead of running it */
+static bool simulate(int argc, char *argv[], int mode)
+{
+    if (argc != 1) {
+        report(1, "%s does not need arguments in simulation mode", argv[0]);
+        return false;
+    }
+    char *complexity = dut_ops[mode].linear ? "linear" : "constant";
+    report_flush();
+    bool ok = check_op(mode);
+    fflush(stdout);
+    record_const(ok);
+    if (!ok) {
+        report(1, "ERROR: Probably not %s time", complexity);
+        return false;
+    }
+    report(1, "Probably %s time", complexity);
+    return ok;
+}
+
 static bool do_insert_head(int argc, char *argv[])
 {
+    if (simulation)
+        return simulate(argc, argv, test_insert_head);
+
     char *lasts = NULL;
     char randstr_buf[MAX_RANDSTR_LEN];
     int reps = 1;
@@ -209,7 +682,9 @@ static bool do_insert_head(int argc, char *argv[])
         for (int r = 0; ok && r < reps; r++) {
             if (need_rand)
                 fill_rand_string(randstr_buf, sizeof(randstr_buf));
+            int64_t before = cpucycles();
             bool rval = q_insert_head(q, inserts);
+            record_latency(lat_insert_head, cpucycles() - before);
             if (rval) {
                 qcnt++;
                 if (!q->head->value) {
@@ -251,19 +726,8 @@ static bool do_insert_head(int argc, char *argv[])
 
 static bool do_insert_tail(int argc, char *argv[])
 {
-    if (simulation) {
-        if (argc != 1) {
-            report(1, "%s does not need arguments in simulation mode", argv[0]);
-            return false;
-        }
-        bool ok = is_insert_tail_const();
-        if (!ok) {
-            report(1, "ERROR: Probably not constant time");
-            return false;
-        }
-        report(1, "Probably constant time");
-        return ok;
-    }
+    if (simulation)
+        return simulate(argc, argv, test_insert_tail);
 
     char randstr_buf[MAX_RANDSTR_LEN];
     int reps = 1;
@@ -294,7 +758,9 @@ static bool do_insert_tail(int argc, char *argv[])
         for (int r = 0; ok && r < reps; r++) {
             if (need_rand)
                 fill_rand_string(randstr_buf, sizeof(randstr_buf));
+            int64_t before = cpucycles();
             bool rval = q_insert_tail(q, inserts);
+            record_latency(lat_insert_tail, cpucycles() - before);
             if (rval) {
                 qcnt++;
                 if (!q->head->value) {
@@ -322,6 +788,9 @@ static bool do_insert_tail(int argc, char *argv[])
 
 static bool do_remove_head(int argc, char *argv[])
 {
+    if (simulation)
+        return simulate(argc, argv, test_remove_head);
+
     if (argc != 1 && argc != 2) {
         report(1, "%s needs 0-1 arguments", argv[0]);
         return false;
@@ -413,6 +882,9 @@ static bool do_remove_head(int argc, char *argv[])
 
 static bool do_remove_head_quiet(int argc, char *argv[])
 {
+    if (simulation)
+        return simulate(argc, argv, test_remove_head_quiet);
+
     if (argc != 1) {
         report(1, "%s takes no arguments", argv[0]);
         return false;
@@ -449,6 +921,9 @@ static bool do_remove_head_quiet(int argc, char *argv[])
 
 static bool do_reverse(int argc, char *argv[])
 {
+    if (simulation)
+        return simulate(argc, argv, test_reverse);
+
     if (argc != 1) {
         report(1, "%s takes no arguments", argv[0]);
         return false;
@@ -470,19 +945,8 @@ static bool do_reverse(int argc, char *argv[])
 
 static bool do_size(int argc, char *argv[])
 {
-    if (simulation) {
-        if (argc != 1) {
-            report(1, "%s does not need arguments in simulation mode", argv[0]);
-            return false;
-        }
-        bool ok = is_size_const();
-        if (!ok) {
-            report(1, "ERROR: Probably not constant time");
-            return false;
-        }
-        report(1, "Probably constant time");
-        return ok;
-    }
+    if (simulation)
+        return simulate(argc, argv, test_size);
 
     if (argc != 1 && argc != 2) {
         report(1, "%s takes 0-1 arguments", argv[0]);
@@ -509,7 +973,9 @@ static bool do_size(int argc, char *argv[])
 
     if (exception_setup(true)) {
         for (int r = 0; ok && r < reps; r++) {
+            int64_t before = cpucycles();
             cnt = q_size(q);
+            record_latency(lat_size, cpucycles() - before);
             ok = ok && !error_check();
         }
     }
@@ -577,12 +1043,13 @@ static bool show_queue(int vlevel)
         return true;
 
     int cnt = 0;
+    char *name = queues[current].name;
     if (!q) {
-        report(vlevel, "q = NULL");
+        report(vlevel, "%s = NULL", name);
         return true;
     }
 
-    report_noreturn(vlevel, "q = [");
+    report_noreturn(vlevel, "%s = [", name);
     list_ele_t *e = q->head;
     if (exception_setup(true)) {
         while (ok && e && cnt < qcnt) {
@@ -626,27 +1093,308 @@ static bool do_show(int argc, char *argv[])
     return show_queue(0);
 }
 
+static bool do_failat(int argc, char *argv[])
+{
+    size_t list[argc];
+    for (int i = 1; i < argc; i++) {
+        int n;
+        if (!get_int(argv[i], &n) || n <= 0) {
+            report(1, "Invalid allocation number '%s'", argv[i]);
+            return false;
+        }
+        list[i - 1] = n;
+    }
+
+    if (!set_fail_list(list, argc - 1)) {
+        report(1, "Too many allocation numbers given");
+        return false;
+    }
+    return true;
+}
+
+static bool do_leaks(int argc, char *argv[])
+{
+    if (argc != 1 && argc != 2) {
+        report(1, "%s needs 0-1 arguments", argv[0]);
+        return false;
+    }
+
+    show_leaks(argc == 2 ? argv[1] : NULL);
+    return true;
+}
+
+static bool do_latency(int argc, char *argv[])
+{
+    if (argc == 2 && !strcmp(argv[1], "reset")) {
+        for (int i = 0; i < lat_count; i++)
+            hist_init(&latency[i]);
+        return true;
+    }
+    if (argc != 1) {
+        report(1, "%s takes no arguments, or 'reset'", argv[0]);
+        return false;
+    }
+
+    report(1, "%-12s %10s %8s %8s %8s %8s %10s", "Cycles", "Calls", "p50",
+           "p90", "p99", "p99.9", "max");
+    for (int i = 0; i < lat_count; i++) {
+        histogram_t *h = &latency[i];
+        if (!h->count)
+            continue;
+        report(1, "%-12s %10lu %8lu %8lu %8lu %8lu %10lu", lat_names[i],
+               h->count, hist_percentile(h, 0.5), hist_percentile(h, 0.9),
+               hist_percentile(h, 0.99), hist_percentile(h, 0.999), h->max);
+    }
+    return true;
+}
+
+/*
+ * Operations whose growth can be measured by complexity.
+ * Cheap operations are timed over several calls.  undo restores the queue
+ * to its size, or for sort to random order, without being timed.
+ */
+typedef struct {
+    char *name;
+    int reps;
+    void (*run)(queue_t *q, int reps);
+    void (*undo)(queue_t *q, int reps);
+} cplx_op_t;
+
+static char cplx_buf[MAX_RANDSTR_LEN];
+
+/* Second, empty queue, for operations that move elements */
+static queue_t *cplx_side = NULL;
+
+static void cplx_size(queue_t *q, int reps)
+{
+    for (int i = 0; i < reps; i++)
+        q_size(q);
+}
+
+static void cplx_insert_head(queue_t *q, int reps)
+{
+    for (int i = 0; i < reps; i++)
+        q_insert_head(q, cplx_buf);
+}
+
+static void cplx_insert_tail(queue_t *q, int reps)
+{
+    for (int i = 0; i < reps; i++)
+        q_insert_tail(q, cplx_buf);
+}
+
+static void cplx_remove_head(queue_t *q, int reps)
+{
+    for (int i = 0; i < reps; i++)
+        q_remove_head(q, cplx_buf, sizeof(cplx_buf));
+}
+
+/* Splice to the side queue and back */
+static void cplx_splice(queue_t *q, int reps)
+{
+    for (int i = 0; i < reps; i++) {
+        q_splice(cplx_side, q);
+        q_splice(q, cplx_side);
+    }
+}
+
+/* Move every element to the side queue, one at a time */
+static void cplx_transfer(queue_t *q, int reps)
+{
+    while (q_remove_head(q, cplx_buf, sizeof(cplx_buf)))
+        q_insert_tail(cplx_side, cplx_buf);
+}
+
+static void cplx_transfer_back(queue_t *q, int reps)
+{
+    q_splice(q, cplx_side);
+}
+
+static void cplx_reverse(queue_t *q, int reps)
+{
+    q_reverse(q);
+}
+
+static void cplx_sort(queue_t *q, int reps)
+{
+    q_sort(q);
+}
+
+/*
+ * Give every element new random contents of the same length.  Moving
+ * strings between elements instead would scatter them in memory, making
+ * each comparison a cache miss.
+ */
+static void cplx_randomize(queue_t *q, int reps)
+{
+    for (list_ele_t *e = q->head; e; e = e->next) {
+        for (char *c = e->value; *c; c++)
+            *c = charset[rand() % (sizeof charset - 1)];
+    }
+}
+
+static const cplx_op_t cplx_ops[] = {
+    {"size", 256, cplx_size, NULL},
+    {"ih", 256, cplx_insert_head, cplx_remove_head},
+    {"it", 256, cplx_insert_tail, cplx_remove_head},
+    {"rh", 256, cplx_remove_head, cplx_insert_head},
+    {"splice", 256, cplx_splice, NULL},
+    {"transfer", 1, cplx_transfer, cplx_transfer_back},
+    {"reverse", 1, cplx_reverse, NULL},
+    {"sort", 1, cplx_sort, cplx_randomize},
+};
+
+#define CPLX_MIN_LOG 10
+#define CPLX_MAX_LOG 24
+#define CPLX_MAX_TRIALS 101
+
+static bool do_complexity(int argc, char *argv[])
+{
+    int max_log = 22, trials = 5;
+    if (argc < 2 || argc > 4) {
+        report(1, "%s needs 1-3 arguments", argv[0]);
+        return false;
+    }
+    const cplx_op_t *op = NULL;
+    for (size_t i = 0; i < sizeof(cplx_ops) / sizeof(cplx_ops[0]); i++) {
+        if (!strcmp(argv[1], cplx_ops[i].name))
+            op = &cplx_ops[i];
+    }
+    if (!op) {
+        report(1, "Unknown operation '%s'", argv[1]);
+        return false;
+    }
+    if (argc > 2 && (!get_int(argv[2], &max_log) || max_log < CPLX_MIN_LOG ||
+                     max_log > CPLX_MAX_LOG)) {
+        report(1, "Invalid maximum '%s', must be %d .. %d", argv[2],
+               CPLX_MIN_LOG, CPLX_MAX_LOG);
+        return false;
+    }
+    if (argc > 3 && (!get_int(argv[3], &trials) || trials < 1 ||
+                     trials > CPLX_MAX_TRIALS)) {
+        report(1, "Invalid number of trials '%s', must be 1 .. %d", argv[3],
+               CPLX_MAX_TRIALS);
+        return false;
+    }
+    error_check();
+
+    double sizes[CPLX_MAX_LOG - CPLX_MIN_LOG + 1];
+    double times[CPLX_MAX_LOG - CPLX_MIN_LOG + 1];
+    double samples[CPLX_MAX_TRIALS];
+    int count = 0;
+    bool ok = true;
+    fill_rand_string(cplx_buf, sizeof(cplx_buf));
+
+    /* Checking every free against all live blocks would dominate */
+    set_cautious_mode(false);
+    report(1, "%10s %14s", "Elements", "Time (ns)");
+    for (int k = CPLX_MIN_LOG; ok && k <= max_log; k++) {
+        size_t n = (size_t) 1 << k;
+        char randstr_buf[MAX_RANDSTR_LEN];
+        queue_t *cq = NULL;
+        if (exception_setup(false)) {
+            cplx_side = q_new();
+            cq = q_new();
+            for (size_t i = 0; cq && i < n; i++) {
+                fill_rand_string(randstr_buf, sizeof(randstr_buf));
+                if (!q_insert_head(cq, randstr_buf)) {
+                    report(1, "ERROR: Could not build queue of %lu elements",
+                           n);
+                    ok = false;
+                    break;
+                }
+            }
+            for (int i = 0; ok && i < trials; i++) {
+                uint64_t start = time_ns();
+                op->run(cq, op->reps);
+                samples[i] = (double) (time_ns() - start) / op->reps;
+                if (op->undo)
+                    op->undo(cq, op->reps);
+            }
+        } else {
+            ok = false;
+        }
+        exception_cancel();
+        if (exception_setup(false)) {
+            q_free(cq);
+            q_free(cplx_side);
+        }
+        exception_cancel();
+        cplx_side = NULL;
+        if (!cq) {
+            report(1, "ERROR: Could not allocate queue");
+            ok = false;
+        }
+        if (!ok)
+            break;
+
+        sizes[count] = n;
+        times[count] = cplx_median(samples, trials);
+        report(1, "%10lu %14.1f", n, times[count]);
+        count++;
+    }
+    set_cautious_mode(true);
+    if (!ok)
+        return false;
+
+    cplx_fit_t fit;
+    cplx_fit(sizes, times, count, &fit);
+    for (int m = 0; m < CPLX_COUNT; m++)
+        report(2, "%-10s c = %-12.4g relative error %.3f", cplx_names[m],
+               fit.coef[m], fit.error[m]);
+    report(1, "%s is %s (confidence %.0f%%)", op->name, cplx_names[fit.best],
+           100 * fit.confidence);
+    return !error_check();
+}
+
+static void set_seed(int oldval)
+{
+    srand((unsigned int) seed);
+    set_fail_seed((unsigned int) seed);
+}
+
 /* Signal handlers */
 static void sigsegvhandler(int sig)
 {
+    report_signal_enter();
     report(1,
            "Segmentation fault occurred.  You dereferenced a NULL or invalid "
            "pointer");
+    report_flush();
     /* Raising a SIGABRT signal to produce a core dump for debugging. */
     abort();
 }
 
 static void sigalrmhandler(int sig)
 {
+    report_signal_enter();
     trigger_exception(
         "Time limit exceeded.  Either you are in an infinite loop, or your "
         "code is too inefficient");
 }
 
+/* Queue size and allocations, as seen by the harness */
+static void queue_metrics(bool after)
+{
+    if (q)
+        metric_int(after ? "size_after" : "size_before", qcnt);
+    if (!after) {
+        metrics_alloc_start = allocation_number();
+        return;
+    }
+    metric_int("blocks", allocation_check());
+    metric_int("bytes", allocation_bytes());
+    metric_int("mallocs", allocation_number() - metrics_alloc_start);
+}
+
 static void queue_init()
 {
     fail_count = 0;
     q = NULL;
+    qcnt = 0;
+    strcpy(queues[0].name, "q");
+    queue_slots = 1;
+    current = 0;
     signal(SIGSEGV, sigsegvhandler);
     signal(SIGALRM, sigalrmhandler);
 }
@@ -654,31 +1402,41 @@ static void queue_init()
 static bool queue_quit(int argc, char *argv[])
 {
     report(3, "Freeing queue");
-    if (qcnt > big_queue_size)
-        set_cautious_mode(false);
-
-    if (exception_setup(true))
-        q_free(q);
-    exception_cancel();
-    set_cautious_mode(true);
+    save_queue();
+    for (int i = 0; i < queue_slots; i++) {
+        if (queues[i].cnt > big_queue_size)
+            set_cautious_mode(false);
+        if (exception_setup(true))
+            q_free(queues[i].q);
+        exception_cancel();
+        set_cautious_mode(true);
+    }
+    quarantine_flush();
 
     size_t bcnt = allocation_check();
     if (bcnt > 0) {
         report(1, "ERROR: Freed queue, but %lu blocks are still allocated",
                bcnt);
+        show_leaks(leakfile_name);
         return false;
     }
 
-    return true;
+    return !error_check();
 }
 
 static void usage(char *cmd)
 {
-    printf("Usage: %s [-h] [-f IFILE][-v VLEVEL][-l LFILE]\n", cmd);
+    printf("Usage: %s [-h] [-f IFILE][-v VLEVEL][-l LFILE][-k KFILE]\n"
+           "\t[-s SEED][-o OFILE][-b BFILE][-j JFILE]\n", cmd);
     printf("\t-h         Print this information\n");
     printf("\t-f IFILE   Read commands from IFILE\n");
+    printf("\t-o OFILE   Compile commands into OFILE instead of running them\n");
+    printf("\t-b BFILE   Run commands compiled into BFILE\n");
+    printf("\t-s SEED    Seed random strings and malloc failures\n");
     printf("\t-v VLEVEL  Set verbosity level\n");
     printf("\t-l LFILE   Echo results to LFILE\n");
+    printf("\t-k KFILE   List leaked blocks in KFILE\n");
+    printf("\t-j JFILE   Write JSON record of each command to JFILE\n");
     exit(0);
 }
 
@@ -726,10 +1484,18 @@ int main(int argc, char *argv[])
     char *infile_name = NULL;
     char lbuf[BUFSIZE];
     char *logfile_name = NULL;
+    char kbuf[BUFSIZE];
+    char obuf[BUFSIZE];
+    char *compile_name = NULL;
+    char bbuf[BUFSIZE];
+    char *bytecode_name = NULL;
+    char jbuf[BUFSIZE];
+    char *metrics_name = NULL;
     int level = 4;
     int c;
 
-    while ((c = getopt(argc, argv, "hv:f:l:")) != -1) {
+    seed = (int) time(NULL);
+    while ((c = getopt(argc, argv, "hv:f:l:k:s:o:b:j:")) != -1) {
         switch (c) {
         case 'h':
             usage(argv[0]);
@@ -742,6 +1508,29 @@ int main(int argc, char *argv[])
         case 'v':
             level = atoi(optarg);
             break;
+        case 'k':
+            strncpy(kbuf, optarg, BUFSIZE);
+            kbuf[BUFSIZE - 1] = '\0';
+            leakfile_name = kbuf;
+            break;
+        case 's':
+            seed = atoi(optarg);
+            break;
+        case 'o':
+            strncpy(obuf, optarg, BUFSIZE);
+            obuf[BUFSIZE - 1] = '\0';
+            compile_name = obuf;
+            break;
+        case 'b':
+            strncpy(bbuf, optarg, BUFSIZE);
+            bbuf[BUFSIZE - 1] = '\0';
+            bytecode_name = bbuf;
+            break;
+        case 'j':
+            strncpy(jbuf, optarg, BUFSIZE);
+            jbuf[BUFSIZE - 1] = '\0';
+            metrics_name = jbuf;
+            break;
         case 'l':
             strncpy(lbuf, optarg, BUFSIZE);
             buf[BUFSIZE - 1] = '\0';
@@ -754,7 +1543,7 @@ int main(int argc, char *argv[])
         }
     }
 
-    srand((unsigned int) (time(NULL)));
+    set_seed(0);
     queue_init();
     init_cmd();
     console_init();
@@ -763,13 +1552,25 @@ int main(int argc, char *argv[])
     if (level > 1) {
         set_echo(true);
     }
+    /* Seed may come from the clock, so show it for replaying with -s */
+    report(1, "seed = %d", seed);
     if (logfile_name)
         set_logfile(logfile_name);
+    if (metrics_name && !set_metrics_file(metrics_name)) {
+        printf("Couldn't open metrics file '%s'\n", metrics_name);
+        return 1;
+    }
+    set_metrics_helper(queue_metrics);
 
     add_quit_helper(queue_quit);
 
     bool ok = true;
-    ok = ok && run_console(infile_name);
+    if (compile_name)
+        ok = ok && compile_file(infile_name, compile_name);
+    else if (bytecode_name)
+        ok = ok && run_bytecode(bytecode_name);
+    else
+        ok = ok && run_console(infile_name);
     ok = ok && finish_cmd();
 
     return ok ? 0 : 1;
@@ -0,0 +1,31462 @@
+	.file	"qtest.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "qtest.c"
+	.type	save_queue, @function
+save_queue:
+.LFB27:
+	.file 1 "qtest.c"
+	.loc 1 207 1 view -0
+	.cfi_startproc
+	.loc 1 208 5 view .LVU1
+# qtest.c:208:     queues[current].q = q;
+	.loc 1 208 23 is_stmt 0 view .LVU2
+	movslq	current(%rip), %rdx	# current, current.16_1
+	salq	$5, %rdx	#, tmp87
+	leaq	queues(%rip), %rax	#, tmp85
+	addq	%rdx, %rax	# tmp87, tmp88
+	movq	q(%rip), %rdx	# q, q
+	movq	%rdx, 16(%rax)	# q, queues[current.16_1].q
+	.loc 1 209 5 is_stmt 1 view .LVU3
+# qtest.c:209:     queues[current].cnt = qcnt;
+	.loc 1 209 25 is_stmt 0 view .LVU4
+	movq	qcnt(%rip), %rdx	# qcnt, qcnt
+	movq	%rdx, 24(%rax)	# qcnt, queues[current.16_1].cnt
+# qtest.c:210: }
+	.loc 1 210 1 view .LVU5
+	ret	
+	.cfi_endproc
+.LFE27:
+	.size	save_queue, .-save_queue
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"%s takes no arguments"
+.LC1:
+	.string	"%c %-15s %lu elements"
+.LC2:
+	.string	"%c %-15s NULL"
+	.text
+	.type	do_queues, @function
+do_queues:
+.LVL0:
+.LFB36:
+	.loc 1 360 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 360 1 is_stmt 0 view .LVU7
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+	.loc 1 361 5 is_stmt 1 view .LVU8
+# qtest.c:361:     if (argc != 1) {
+	.loc 1 361 8 is_stmt 0 view .LVU9
+	cmpl	$1, %edi	#, tmp118
+	je	.L3	#,
+	.loc 1 362 9 is_stmt 1 view .LVU10
+	movq	(%rsi), %rdx	# *argv_22(D), *argv_22(D)
+	leaq	.LC0(%rip), %rsi	#, tmp98
+.LVL1:
+	.loc 1 362 9 is_stmt 0 view .LVU11
+	movl	$1, %edi	#,
+.LVL2:
+	.loc 1 362 9 view .LVU12
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL3:
+	.loc 1 363 9 is_stmt 1 view .LVU13
+# qtest.c:363:         return false;
+	.loc 1 363 16 is_stmt 0 view .LVU14
+	movl	$0, %eax	#, <retval>
+.L2:
+# qtest.c:375: }
+	.loc 1 375 1 view .LVU15
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL4:
+.L3:
+	.cfi_restore_state
+	.loc 1 365 5 is_stmt 1 view .LVU16
+	movl	$0, %eax	#,
+	call	save_queue	#
+.LVL5:
+	.loc 1 366 5 view .LVU17
+.LBB30:
+	.loc 1 366 10 view .LVU18
+	.loc 1 366 23 view .LVU19
+	cmpl	$0, queue_slots(%rip)	#, queue_slots
+	jle	.L10	#,
+	leaq	queues(%rip), %rbx	#, ivtmp.260
+# qtest.c:366:     for (int i = 0; i < queue_slots; i++) {
+	.loc 1 366 14 is_stmt 0 view .LVU20
+	movl	$0, %ebp	#, i
+# qtest.c:371:             report(1, "%c %-15s NULL", i == current ? '*' : ' ',
+	.loc 1 371 13 view .LVU21
+	movl	$32, %r13d	#, tmp114
+	movl	$42, %r12d	#, tmp115
+	leaq	.LC2(%rip), %r15	#, tmp116
+# qtest.c:368:             report(1, "%c %-15s %lu elements", i == current ? '*' : ' ',
+	.loc 1 368 13 view .LVU22
+	leaq	.LC1(%rip), %r14	#, tmp117
+	jmp	.L9	#
+.LVL6:
+.L16:
+	.loc 1 368 13 is_stmt 1 view .LVU23
+	cmpl	%ebp, current(%rip)	# i, current
+	movl	%r12d, %edx	# tmp115, iftmp.176_11
+	cmovne	%r13d, %edx	# tmp114,, iftmp.176_11
+	movq	24(%rbx), %r8	# MEM[(long unsigned int *)_32 + 24B],
+	movq	%r14, %rsi	# tmp117,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL7:
+.L7:
+	.loc 1 366 39 discriminator 2 view .LVU24
+	addl	$1, %ebp	#, i
+.LVL8:
+	.loc 1 366 23 discriminator 2 view .LVU25
+	addq	$32, %rbx	#, ivtmp.260
+	cmpl	%ebp, queue_slots(%rip)	# i, queue_slots
+	jle	.L15	#,
+.LVL9:
+.L9:
+	.loc 1 367 9 view .LVU26
+	movq	%rbx, %rcx	# ivtmp.260, _32
+# qtest.c:367:         if (queues[i].q)
+	.loc 1 367 12 is_stmt 0 view .LVU27
+	cmpq	$0, 16(%rbx)	#, MEM[(struct queue_t * *)_32 + 16B]
+	jne	.L16	#,
+	.loc 1 371 13 is_stmt 1 view .LVU28
+	cmpl	%ebp, current(%rip)	# i, current
+	movl	%r12d, %edx	# tmp115, iftmp.178_12
+	cmovne	%r13d, %edx	# tmp114,, iftmp.178_12
+	movq	%r15, %rsi	# tmp116,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL10:
+	jmp	.L7	#
+.L15:
+	.loc 1 371 13 is_stmt 0 view .LVU29
+.LBE30:
+# qtest.c:374:     return true;
+	.loc 1 374 12 view .LVU30
+	movl	$1, %eax	#, <retval>
+.LBB31:
+	jmp	.L2	#
+.LVL11:
+.L10:
+	.loc 1 374 12 view .LVU31
+.LBE31:
+	movl	$1, %eax	#, <retval>
+	jmp	.L2	#
+	.cfi_endproc
+.LFE36:
+	.size	do_queues, .-do_queues
+	.section	.rodata.str1.1
+.LC3:
+	.string	"w"
+.LC4:
+	.string	"Couldn't open leak file '%s'"
+	.text
+	.type	show_leaks, @function
+show_leaks:
+.LVL12:
+.LFB33:
+	.loc 1 294 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 294 1 is_stmt 0 view .LVU33
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 295 5 is_stmt 1 view .LVU34
+.LVL13:
+	.loc 1 296 5 view .LVU35
+# qtest.c:296:     if (file_name) {
+	.loc 1 296 8 is_stmt 0 view .LVU36
+	testq	%rdi, %rdi	# file_name
+	je	.L18	#,
+	movq	%rdi, %rbx	# tmp87, file_name
+	.loc 1 297 9 is_stmt 1 view .LVU37
+# qtest.c:297:         file = fopen(file_name, "w");
+	.loc 1 297 16 is_stmt 0 view .LVU38
+	leaq	.LC3(%rip), %rsi	#, tmp84
+	call	fopen@PLT	#
+.LVL14:
+	.loc 1 297 16 view .LVU39
+	movq	%rax, %rbp	# tmp88, file
+.LVL15:
+	.loc 1 298 9 is_stmt 1 view .LVU40
+# qtest.c:298:         if (!file)
+	.loc 1 298 12 is_stmt 0 view .LVU41
+	testq	%rax, %rax	# file
+	je	.L22	#,
+	.loc 1 302 5 is_stmt 1 view .LVU42
+	movq	%rax, %rsi	# file,
+	movl	$1, %edi	#,
+	call	report_leaks@PLT	#
+.LVL16:
+	.loc 1 303 5 view .LVU43
+	.loc 1 304 9 view .LVU44
+	movq	%rbp, %rdi	# file,
+	call	fclose@PLT	#
+.LVL17:
+.L17:
+# qtest.c:305: }
+	.loc 1 305 1 is_stmt 0 view .LVU45
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL18:
+.L22:
+	.cfi_restore_state
+	.loc 1 299 13 is_stmt 1 view .LVU46
+	movq	%rbx, %rdx	# file_name,
+	leaq	.LC4(%rip), %rsi	#, tmp86
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL19:
+	.loc 1 299 13 is_stmt 0 view .LVU47
+	call	report@PLT	#
+.LVL20:
+.L18:
+	.loc 1 302 5 is_stmt 1 view .LVU48
+	movl	$0, %esi	#,
+	movl	$1, %edi	#,
+	call	report_leaks@PLT	#
+.LVL21:
+	.loc 1 303 5 view .LVU49
+	jmp	.L17	#
+	.cfi_endproc
+.LFE33:
+	.size	show_leaks, .-show_leaks
+	.section	.rodata.str1.1
+.LC5:
+	.string	"Freeing queue"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC6:
+	.string	"ERROR: Freed queue, but %lu blocks are still allocated"
+	.text
+	.type	queue_quit, @function
+queue_quit:
+.LVL22:
+.LFB73:
+	.loc 1 1403 1 view -0
+	.cfi_startproc
+	.loc 1 1403 1 is_stmt 0 view .LVU51
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 1404 5 is_stmt 1 view .LVU52
+	leaq	.LC5(%rip), %rsi	#, tmp96
+.LVL23:
+	.loc 1 1404 5 is_stmt 0 view .LVU53
+	movl	$3, %edi	#,
+.LVL24:
+	.loc 1 1404 5 view .LVU54
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL25:
+	.loc 1 1405 5 is_stmt 1 view .LVU55
+	movl	$0, %eax	#,
+	call	save_queue	#
+.LVL26:
+	.loc 1 1406 5 view .LVU56
+.LBB32:
+	.loc 1 1406 10 view .LVU57
+	.loc 1 1406 23 view .LVU58
+	cmpl	$0, queue_slots(%rip)	#, queue_slots
+	jle	.L24	#,
+	leaq	16+queues(%rip), %rbx	#, ivtmp.271
+# qtest.c:1406:     for (int i = 0; i < queue_slots; i++) {
+	.loc 1 1406 14 is_stmt 0 view .LVU59
+	movl	$0, %ebp	#, i
+	jmp	.L27	#
+.LVL27:
+.L32:
+	.loc 1 1408 13 is_stmt 1 view .LVU60
+	movl	$0, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL28:
+	jmp	.L25	#
+.L26:
+	.loc 1 1411 9 discriminator 2 view .LVU61
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL29:
+	.loc 1 1412 9 discriminator 2 view .LVU62
+	movl	$1, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL30:
+	.loc 1 1406 39 discriminator 2 view .LVU63
+	addl	$1, %ebp	#, i
+.LVL31:
+	.loc 1 1406 23 discriminator 2 view .LVU64
+	addq	$32, %rbx	#, ivtmp.271
+	cmpl	%ebp, queue_slots(%rip)	# i, queue_slots
+	jle	.L24	#,
+.LVL32:
+.L27:
+	.loc 1 1407 9 view .LVU65
+	movq	%rbx, %r12	# ivtmp.271, _36
+# qtest.c:1407:         if (queues[i].cnt > big_queue_size)
+	.loc 1 1407 12 is_stmt 0 view .LVU66
+	cmpq	$30, 8(%rbx)	#, MEM[(long unsigned int *)_36 + 8B]
+	ja	.L32	#,
+.L25:
+	.loc 1 1409 9 is_stmt 1 view .LVU67
+# qtest.c:1409:         if (exception_setup(true))
+	.loc 1 1409 13 is_stmt 0 view .LVU68
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL33:
+# qtest.c:1409:         if (exception_setup(true))
+	.loc 1 1409 12 view .LVU69
+	testb	%al, %al	# tmp101
+	je	.L26	#,
+	.loc 1 1410 13 is_stmt 1 view .LVU70
+	movq	(%r12), %rdi	# MEM[(struct queue_t * *)_36], MEM[(struct queue_t * *)_36]
+	call	q_free@PLT	#
+.LVL34:
+	jmp	.L26	#
+.LVL35:
+.L24:
+	.loc 1 1410 13 is_stmt 0 view .LVU71
+.LBE32:
+	.loc 1 1414 5 is_stmt 1 view .LVU72
+	movl	$0, %eax	#,
+	call	quarantine_flush@PLT	#
+.LVL36:
+	.loc 1 1416 5 view .LVU73
+# qtest.c:1416:     size_t bcnt = allocation_check();
+	.loc 1 1416 19 is_stmt 0 view .LVU74
+	movl	$0, %eax	#,
+	call	allocation_check@PLT	#
+.LVL37:
+	.loc 1 1417 5 is_stmt 1 view .LVU75
+# qtest.c:1417:     if (bcnt > 0) {
+	.loc 1 1417 8 is_stmt 0 view .LVU76
+	testq	%rax, %rax	# bcnt
+	jne	.L33	#,
+	.loc 1 1424 5 is_stmt 1 view .LVU77
+# qtest.c:1424:     return !error_check();
+	.loc 1 1424 13 is_stmt 0 view .LVU78
+	movl	$0, %eax	#,
+.LVL38:
+	.loc 1 1424 13 view .LVU79
+	call	error_check@PLT	#
+.LVL39:
+# qtest.c:1424:     return !error_check();
+	.loc 1 1424 5 view .LVU80
+	xorl	$1, %eax	#, <retval>
+.L23:
+# qtest.c:1425: }
+	.loc 1 1425 1 view .LVU81
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL40:
+.L33:
+	.cfi_restore_state
+	.loc 1 1418 9 is_stmt 1 view .LVU82
+	movq	%rax, %rdx	# bcnt,
+	leaq	.LC6(%rip), %rsi	#, tmp98
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL41:
+	.loc 1 1418 9 is_stmt 0 view .LVU83
+	call	report@PLT	#
+.LVL42:
+	.loc 1 1420 9 is_stmt 1 view .LVU84
+	movq	leakfile_name(%rip), %rdi	# leakfile_name,
+	call	show_leaks	#
+.LVL43:
+	.loc 1 1421 9 view .LVU85
+# qtest.c:1421:         return false;
+	.loc 1 1421 16 is_stmt 0 view .LVU86
+	movl	$0, %eax	#, <retval>
+	jmp	.L23	#
+	.cfi_endproc
+.LFE73:
+	.size	queue_quit, .-queue_quit
+	.section	.rodata.str1.1
+.LC7:
+	.string	"%s needs 0-1 arguments"
+	.text
+	.type	do_leaks, @function
+do_leaks:
+.LVL44:
+.LFB55:
+	.loc 1 1116 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1116 1 is_stmt 0 view .LVU88
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 1117 5 is_stmt 1 view .LVU89
+# qtest.c:1117:     if (argc != 1 && argc != 2) {
+	.loc 1 1117 19 is_stmt 0 view .LVU90
+	leal	-1(%rdi), %eax	#, tmp89
+# qtest.c:1117:     if (argc != 1 && argc != 2) {
+	.loc 1 1117 8 view .LVU91
+	cmpl	$1, %eax	#, tmp89
+	ja	.L40	#,
+	.loc 1 1122 5 is_stmt 1 view .LVU92
+	movl	$0, %eax	#, iftmp.36_5
+	cmpl	$2, %edi	#, argc
+	je	.L41	#,
+.L37:
+# qtest.c:1122:     show_leaks(argc == 2 ? argv[1] : NULL);
+	.loc 1 1122 5 is_stmt 0 discriminator 4 view .LVU93
+	movq	%rax, %rdi	# iftmp.36_5,
+.LVL45:
+	.loc 1 1122 5 discriminator 4 view .LVU94
+	call	show_leaks	#
+.LVL46:
+	.loc 1 1123 5 is_stmt 1 discriminator 4 view .LVU95
+# qtest.c:1123:     return true;
+	.loc 1 1123 12 is_stmt 0 discriminator 4 view .LVU96
+	movl	$1, %eax	#, <retval>
+.L34:
+# qtest.c:1124: }
+	.loc 1 1124 1 view .LVU97
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL47:
+.L40:
+	.cfi_restore_state
+	.loc 1 1118 9 is_stmt 1 view .LVU98
+	movq	(%rsi), %rdx	# *argv_9(D), *argv_9(D)
+	leaq	.LC7(%rip), %rsi	#, tmp91
+.LVL48:
+	.loc 1 1118 9 is_stmt 0 view .LVU99
+	movl	$1, %edi	#,
+.LVL49:
+	.loc 1 1118 9 view .LVU100
+	movl	$0, %eax	#,
+.LVL50:
+	.loc 1 1118 9 view .LVU101
+	call	report@PLT	#
+.LVL51:
+	.loc 1 1119 9 is_stmt 1 view .LVU102
+# qtest.c:1119:         return false;
+	.loc 1 1119 16 is_stmt 0 view .LVU103
+	movl	$0, %eax	#, <retval>
+	jmp	.L34	#
+.LVL52:
+.L41:
+# qtest.c:1122:     show_leaks(argc == 2 ? argv[1] : NULL);
+	.loc 1 1122 5 discriminator 1 view .LVU104
+	movq	8(%rsi), %rax	# MEM[(char * *)argv_9(D) + 8B], iftmp.36_5
+	jmp	.L37	#
+	.cfi_endproc
+.LFE55:
+	.size	do_leaks, .-do_leaks
+	.section	.rodata.str1.1
+.LC8:
+	.string	"size_after"
+.LC9:
+	.string	"size_before"
+.LC10:
+	.string	"blocks"
+.LC11:
+	.string	"bytes"
+.LC12:
+	.string	"mallocs"
+	.text
+	.type	queue_metrics, @function
+queue_metrics:
+.LVL53:
+.LFB71:
+	.loc 1 1378 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1378 1 is_stmt 0 view .LVU106
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	%edi, %ebx	# tmp103, after
+	.loc 1 1379 5 is_stmt 1 view .LVU107
+# qtest.c:1379:     if (q)
+	.loc 1 1379 8 is_stmt 0 view .LVU108
+	cmpq	$0, q(%rip)	#, q
+	je	.L43	#,
+	.loc 1 1380 9 is_stmt 1 view .LVU109
+	testb	%dil, %dil	# after
+	leaq	.LC9(%rip), %rdi	#, tmp101
+.LVL54:
+	.loc 1 1380 9 is_stmt 0 view .LVU110
+	leaq	.LC8(%rip), %rax	#, tmp102
+	cmovne	%rax, %rdi	# tmp101,, tmp102, iftmp.23_13
+	movq	qcnt(%rip), %rsi	# qcnt,
+	call	metric_int@PLT	#
+.LVL55:
+.L43:
+	.loc 1 1381 5 is_stmt 1 view .LVU111
+# qtest.c:1381:     if (!after) {
+	.loc 1 1381 8 is_stmt 0 view .LVU112
+	testb	%bl, %bl	# after
+	je	.L49	#,
+	.loc 1 1385 5 is_stmt 1 view .LVU113
+# qtest.c:1385:     metric_int("blocks", allocation_check());
+	.loc 1 1385 26 is_stmt 0 view .LVU114
+	movl	$0, %eax	#,
+	call	allocation_check@PLT	#
+.LVL56:
+	movq	%rax, %rsi	# tmp105, _5
+# qtest.c:1385:     metric_int("blocks", allocation_check());
+	.loc 1 1385 5 view .LVU115
+	leaq	.LC10(%rip), %rdi	#, tmp97
+	call	metric_int@PLT	#
+.LVL57:
+	.loc 1 1386 5 is_stmt 1 view .LVU116
+# qtest.c:1386:     metric_int("bytes", allocation_bytes());
+	.loc 1 1386 25 is_stmt 0 view .LVU117
+	movl	$0, %eax	#,
+	call	allocation_bytes@PLT	#
+.LVL58:
+	movq	%rax, %rsi	# tmp106, _7
+# qtest.c:1386:     metric_int("bytes", allocation_bytes());
+	.loc 1 1386 5 view .LVU118
+	leaq	.LC11(%rip), %rdi	#, tmp98
+	call	metric_int@PLT	#
+.LVL59:
+	.loc 1 1387 5 is_stmt 1 view .LVU119
+# qtest.c:1387:     metric_int("mallocs", allocation_number() - metrics_alloc_start);
+	.loc 1 1387 27 is_stmt 0 view .LVU120
+	movl	$0, %eax	#,
+	call	allocation_number@PLT	#
+.LVL60:
+# qtest.c:1387:     metric_int("mallocs", allocation_number() - metrics_alloc_start);
+	.loc 1 1387 47 view .LVU121
+	subq	metrics_alloc_start(%rip), %rax	# metrics_alloc_start, tmp107
+	movq	%rax, %rsi	# tmp107, tmp99
+# qtest.c:1387:     metric_int("mallocs", allocation_number() - metrics_alloc_start);
+	.loc 1 1387 5 view .LVU122
+	leaq	.LC12(%rip), %rdi	#, tmp100
+	call	metric_int@PLT	#
+.LVL61:
+.L42:
+# qtest.c:1388: }
+	.loc 1 1388 1 view .LVU123
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.L49:
+	.cfi_restore_state
+	.loc 1 1382 9 is_stmt 1 view .LVU124
+# qtest.c:1382:         metrics_alloc_start = allocation_number();
+	.loc 1 1382 31 is_stmt 0 view .LVU125
+	movl	$0, %eax	#,
+	call	allocation_number@PLT	#
+.LVL62:
+# qtest.c:1382:         metrics_alloc_start = allocation_number();
+	.loc 1 1382 29 view .LVU126
+	movq	%rax, metrics_alloc_start(%rip)	# tmp104, metrics_alloc_start
+	.loc 1 1383 9 is_stmt 1 view .LVU127
+	jmp	.L42	#
+	.cfi_endproc
+.LFE71:
+	.size	queue_metrics, .-queue_metrics
+	.section	.rodata.str1.8
+	.align 8
+.LC13:
+	.string	"Usage: %s [-h] [-f IFILE][-v VLEVEL][-l LFILE][-k KFILE]\n\t[-s SEED][-o OFILE][-b BFILE][-j JFILE]\n"
+	.align 8
+.LC14:
+	.string	"\t-h         Print this information"
+	.align 8
+.LC15:
+	.string	"\t-f IFILE   Read commands from IFILE"
+	.align 8
+.LC16:
+	.string	"\t-o OFILE   Compile commands into OFILE instead of running them"
+	.align 8
+.LC17:
+	.string	"\t-b BFILE   Run commands compiled into BFILE"
+	.align 8
+.LC18:
+	.string	"\t-s SEED    Seed random strings and malloc failures"
+	.align 8
+.LC19:
+	.string	"\t-v VLEVEL  Set verbosity level"
+	.align 8
+.LC20:
+	.string	"\t-l LFILE   Echo results to LFILE"
+	.align 8
+.LC21:
+	.string	"\t-k KFILE   List leaked blocks in KFILE"
+	.align 8
+.LC22:
+	.string	"\t-j JFILE   Write JSON record of each command to JFILE"
+	.text
+	.type	usage, @function
+usage:
+.LVL63:
+.LFB74:
+	.loc 1 1428 1 view -0
+	.cfi_startproc
+	.loc 1 1428 1 is_stmt 0 view .LVU129
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	movq	%rdi, %rsi	# tmp93, cmd
+	.loc 1 1429 5 is_stmt 1 view .LVU130
+	leaq	.LC13(%rip), %rdi	#, tmp83
+.LVL64:
+	.loc 1 1429 5 is_stmt 0 view .LVU131
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL65:
+	.loc 1 1431 5 is_stmt 1 view .LVU132
+	leaq	.LC14(%rip), %rdi	#, tmp84
+	call	puts@PLT	#
+.LVL66:
+	.loc 1 1432 5 view .LVU133
+	leaq	.LC15(%rip), %rdi	#, tmp85
+	call	puts@PLT	#
+.LVL67:
+	.loc 1 1433 5 view .LVU134
+	leaq	.LC16(%rip), %rdi	#, tmp86
+	call	puts@PLT	#
+.LVL68:
+	.loc 1 1434 5 view .LVU135
+	leaq	.LC17(%rip), %rdi	#, tmp87
+	call	puts@PLT	#
+.LVL69:
+	.loc 1 1435 5 view .LVU136
+	leaq	.LC18(%rip), %rdi	#, tmp88
+	call	puts@PLT	#
+.LVL70:
+	.loc 1 1436 5 view .LVU137
+	leaq	.LC19(%rip), %rdi	#, tmp89
+	call	puts@PLT	#
+.LVL71:
+	.loc 1 1437 5 view .LVU138
+	leaq	.LC20(%rip), %rdi	#, tmp90
+	call	puts@PLT	#
+.LVL72:
+	.loc 1 1438 5 view .LVU139
+	leaq	.LC21(%rip), %rdi	#, tmp91
+	call	puts@PLT	#
+.LVL73:
+	.loc 1 1439 5 view .LVU140
+	leaq	.LC22(%rip), %rdi	#, tmp92
+	call	puts@PLT	#
+.LVL74:
+	.loc 1 1440 5 view .LVU141
+	movl	$0, %edi	#,
+	call	exit@PLT	#
+.LVL75:
+	.cfi_endproc
+.LFE74:
+	.size	usage, .-usage
+	.type	set_seed, @function
+set_seed:
+.LVL76:
+.LFB68:
+	.loc 1 1351 1 view -0
+	.cfi_startproc
+	.loc 1 1351 1 is_stmt 0 view .LVU143
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 1352 5 is_stmt 1 view .LVU144
+	movl	seed(%rip), %edi	# seed,
+.LVL77:
+	.loc 1 1352 5 is_stmt 0 view .LVU145
+	call	srand@PLT	#
+.LVL78:
+	.loc 1 1353 5 is_stmt 1 view .LVU146
+	movl	seed(%rip), %edi	# seed,
+	call	set_fail_seed@PLT	#
+.LVL79:
+# qtest.c:1354: }
+	.loc 1 1354 1 is_stmt 0 view .LVU147
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE68:
+	.size	set_seed, .-set_seed
+	.section	.rodata.str1.8
+	.align 8
+.LC23:
+	.string	"Time limit exceeded.  Either you are in an infinite loop, or your code is too inefficient"
+	.text
+	.type	sigalrmhandler, @function
+sigalrmhandler:
+.LVL80:
+.LFB70:
+	.loc 1 1369 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1369 1 is_stmt 0 view .LVU149
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 1370 5 is_stmt 1 view .LVU150
+	movl	$0, %eax	#,
+	call	report_signal_enter@PLT	#
+.LVL81:
+	.loc 1 1371 5 view .LVU151
+	leaq	.LC23(%rip), %rdi	#, tmp83
+	call	trigger_exception@PLT	#
+.LVL82:
+# qtest.c:1374: }
+	.loc 1 1374 1 is_stmt 0 view .LVU152
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE70:
+	.size	sigalrmhandler, .-sigalrmhandler
+	.section	.rodata.str1.8
+	.align 8
+.LC24:
+	.string	"Segmentation fault occurred.  You dereferenced a NULL or invalid pointer"
+	.text
+	.type	sigsegvhandler, @function
+sigsegvhandler:
+.LVL83:
+.LFB69:
+	.loc 1 1358 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1358 1 is_stmt 0 view .LVU154
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 1359 5 is_stmt 1 view .LVU155
+	movl	$0, %eax	#,
+	call	report_signal_enter@PLT	#
+.LVL84:
+	.loc 1 1360 5 view .LVU156
+	leaq	.LC24(%rip), %rsi	#, tmp83
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL85:
+	.loc 1 1363 5 view .LVU157
+	movl	$0, %eax	#,
+	call	report_flush@PLT	#
+.LVL86:
+	.loc 1 1365 5 view .LVU158
+	call	abort@PLT	#
+.LVL87:
+	.cfi_endproc
+.LFE69:
+	.size	sigsegvhandler, .-sigsegvhandler
+	.type	find_queue, @function
+find_queue:
+.LVL88:
+.LFB29:
+	.loc 1 222 1 view -0
+	.cfi_startproc
+	.loc 1 222 1 is_stmt 0 view .LVU160
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	.loc 1 223 5 is_stmt 1 view .LVU161
+.LBB33:
+	.loc 1 223 10 view .LVU162
+.LVL89:
+	.loc 1 223 23 view .LVU163
+	movl	queue_slots(%rip), %r13d	# queue_slots, queue_slots.169_10
+	testl	%r13d, %r13d	# queue_slots.169_10
+	jle	.L61	#,
+	movq	%rdi, %r12	# tmp89, name
+	leaq	queues(%rip), %rbp	#, ivtmp.287
+# qtest.c:223:     for (int i = 0; i < queue_slots; i++) {
+	.loc 1 223 14 is_stmt 0 view .LVU164
+	movl	$0, %ebx	#, <retval>
+.LVL90:
+.L60:
+	.loc 1 224 9 is_stmt 1 view .LVU165
+# qtest.c:224:         if (!strcmp(queues[i].name, name))
+	.loc 1 224 14 is_stmt 0 view .LVU166
+	movq	%r12, %rsi	# name,
+	movq	%rbp, %rdi	# ivtmp.287,
+	call	strcmp@PLT	#
+.LVL91:
+# qtest.c:224:         if (!strcmp(queues[i].name, name))
+	.loc 1 224 12 view .LVU167
+	testl	%eax, %eax	# tmp90
+	je	.L58	#,
+	.loc 1 223 39 is_stmt 1 discriminator 2 view .LVU168
+	addl	$1, %ebx	#, <retval>
+.LVL92:
+	.loc 1 223 23 discriminator 2 view .LVU169
+	addq	$32, %rbp	#, ivtmp.287
+	cmpl	%r13d, %ebx	# queue_slots.169_10, <retval>
+	jne	.L60	#,
+.LBE33:
+# qtest.c:227:     return -1;
+	.loc 1 227 12 is_stmt 0 view .LVU170
+	movl	$-1, %ebx	#, <retval>
+.LVL93:
+.L58:
+# qtest.c:228: }
+	.loc 1 228 1 view .LVU171
+	movl	%ebx, %eax	# <retval>,
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL94:
+.L61:
+	.cfi_restore_state
+# qtest.c:227:     return -1;
+	.loc 1 227 12 view .LVU172
+	movl	$-1, %ebx	#, <retval>
+	jmp	.L58	#
+	.cfi_endproc
+.LFE29:
+	.size	find_queue, .-find_queue
+	.type	cplx_insert_head, @function
+cplx_insert_head:
+.LVL95:
+.LFB58:
+	.loc 1 1175 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1176 5 view .LVU174
+.LBB34:
+	.loc 1 1176 10 view .LVU175
+	.loc 1 1176 23 view .LVU176
+	testl	%esi, %esi	# reps
+	jle	.L69	#,
+.LBE34:
+# qtest.c:1175: {
+	.loc 1 1175 1 is_stmt 0 view .LVU177
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %r12	# tmp86, q
+	movl	%esi, %ebp	# tmp87, reps
+.LBB35:
+# qtest.c:1176:     for (int i = 0; i < reps; i++)
+	.loc 1 1176 14 view .LVU178
+	movl	$0, %ebx	#, i
+# qtest.c:1177:         q_insert_head(q, cplx_buf);
+	.loc 1 1177 9 view .LVU179
+	leaq	cplx_buf(%rip), %r13	#, tmp85
+.LVL96:
+.L66:
+	.loc 1 1177 9 is_stmt 1 discriminator 3 view .LVU180
+	movq	%r13, %rsi	# tmp85,
+	movq	%r12, %rdi	# q,
+	call	q_insert_head@PLT	#
+.LVL97:
+	.loc 1 1176 32 discriminator 3 view .LVU181
+	addl	$1, %ebx	#, i
+.LVL98:
+	.loc 1 1176 23 discriminator 3 view .LVU182
+	cmpl	%ebx, %ebp	# i, reps
+	jne	.L66	#,
+.LBE35:
+# qtest.c:1178: }
+	.loc 1 1178 1 is_stmt 0 view .LVU183
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL99:
+	.loc 1 1178 1 view .LVU184
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+.LVL100:
+	.loc 1 1178 1 view .LVU185
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL101:
+	.loc 1 1178 1 view .LVU186
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL102:
+.L69:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.loc 1 1178 1 view .LVU187
+	ret	
+	.cfi_endproc
+.LFE58:
+	.size	cplx_insert_head, .-cplx_insert_head
+	.type	cplx_randomize, @function
+cplx_randomize:
+.LVL103:
+.LFB66:
+	.loc 1 1229 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1229 1 is_stmt 0 view .LVU189
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	.loc 1 1230 5 is_stmt 1 view .LVU190
+.LBB36:
+	.loc 1 1230 10 view .LVU191
+# qtest.c:1230:     for (list_ele_t *e = q->head; e; e = e->next) {
+	.loc 1 1230 22 is_stmt 0 view .LVU192
+	movq	(%rdi), %r13	# q_11(D)->head, e
+.LVL104:
+	.loc 1 1230 35 is_stmt 1 view .LVU193
+	testq	%r13, %r13	# e
+	je	.L72	#,
+.LBB37:
+# qtest.c:1232:             *c = charset[rand() % (sizeof charset - 1)];
+	.loc 1 1232 25 is_stmt 0 view .LVU194
+	leaq	charset(%rip), %r12	#, tmp105
+# qtest.c:1232:             *c = charset[rand() % (sizeof charset - 1)];
+	.loc 1 1232 33 view .LVU195
+	movabsq	$5675921253449092805, %rbp	#, tmp106
+.LVL105:
+.L76:
+	.loc 1 1232 33 view .LVU196
+.LBE37:
+	.loc 1 1231 9 is_stmt 1 view .LVU197
+.LBB38:
+	.loc 1 1231 14 view .LVU198
+# qtest.c:1231:         for (char *c = e->value; *c; c++)
+	.loc 1 1231 20 is_stmt 0 view .LVU199
+	movq	0(%r13), %rbx	# e_23->value, c
+.LVL106:
+	.loc 1 1231 34 is_stmt 1 view .LVU200
+	cmpb	$0, (%rbx)	#, *c_13
+	je	.L74	#,
+.L75:
+	.loc 1 1232 13 discriminator 3 view .LVU201
+# qtest.c:1232:             *c = charset[rand() % (sizeof charset - 1)];
+	.loc 1 1232 26 is_stmt 0 discriminator 3 view .LVU202
+	call	rand@PLT	#
+.LVL107:
+	movslq	%eax, %rcx	# tmp108, _1
+# qtest.c:1232:             *c = charset[rand() % (sizeof charset - 1)];
+	.loc 1 1232 33 discriminator 3 view .LVU203
+	movq	%rcx, %rax	# _1, tmp109
+	mulq	%rbp	# tmp106
+	shrq	$3, %rdx	#, tmp94
+	leaq	(%rdx,%rdx,2), %rax	#, tmp99
+	leaq	(%rdx,%rax,4), %rax	#, tmp101
+	addq	%rax, %rax	# tmp102
+	subq	%rax, %rcx	# tmp102, tmp103
+# qtest.c:1232:             *c = charset[rand() % (sizeof charset - 1)];
+	.loc 1 1232 16 discriminator 3 view .LVU204
+	movzbl	(%r12,%rcx), %eax	# charset[_3], charset[_3]
+	movb	%al, (%rbx)	# charset[_3], MEM[(char *)c_24]
+	.loc 1 1231 39 is_stmt 1 discriminator 3 view .LVU205
+	addq	$1, %rbx	#, c
+.LVL108:
+	.loc 1 1231 34 discriminator 3 view .LVU206
+	cmpb	$0, (%rbx)	#, MEM[(char *)c_17]
+	jne	.L75	#,
+.L74:
+	.loc 1 1231 34 is_stmt 0 discriminator 3 view .LVU207
+.LBE38:
+	.loc 1 1230 40 is_stmt 1 discriminator 2 view .LVU208
+	movq	8(%r13), %r13	# e_23->next, e
+.LVL109:
+	.loc 1 1230 35 discriminator 2 view .LVU209
+	testq	%r13, %r13	# e
+	jne	.L76	#,
+.LVL110:
+.L72:
+	.loc 1 1230 35 is_stmt 0 discriminator 2 view .LVU210
+.LBE36:
+# qtest.c:1234: }
+	.loc 1 1234 1 view .LVU211
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+.LVL111:
+	.loc 1 1234 1 view .LVU212
+	ret	
+	.cfi_endproc
+.LFE66:
+	.size	cplx_randomize, .-cplx_randomize
+	.type	fill_rand_string, @function
+fill_rand_string:
+.LVL112:
+.LFB38:
+	.loc 1 425 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 425 1 is_stmt 0 view .LVU214
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %r12	# tmp109, buf
+	movq	%rsi, %rbx	# tmp110, buf_size
+	.loc 1 426 5 is_stmt 1 view .LVU215
+.LVL113:
+	.loc 1 427 5 view .LVU216
+	.loc 1 427 16 view .LVU217
+.L81:
+	.loc 1 428 9 view .LVU218
+# qtest.c:428:         len = rand() % buf_size;
+	.loc 1 428 15 is_stmt 0 view .LVU219
+	call	rand@PLT	#
+.LVL114:
+	cltq
+# qtest.c:428:         len = rand() % buf_size;
+	.loc 1 428 13 view .LVU220
+	movl	$0, %edx	#, tmp94
+	divq	%rbx	# buf_size
+	movq	%rdx, %rbp	# tmp94, tmp94
+.LVL115:
+	.loc 1 427 16 is_stmt 1 view .LVU221
+	cmpq	$4, %rdx	#, tmp94
+	jbe	.L81	#,
+.LBB39:
+# qtest.c:430:     for (size_t n = 0; n < len; n++) {
+	.loc 1 430 17 is_stmt 0 view .LVU222
+	movl	$0, %ebx	#, n
+.LVL116:
+# qtest.c:431:         buf[n] = charset[rand() % (sizeof charset - 1)];
+	.loc 1 431 25 view .LVU223
+	leaq	charset(%rip), %r14	#, tmp96
+# qtest.c:431:         buf[n] = charset[rand() % (sizeof charset - 1)];
+	.loc 1 431 33 view .LVU224
+	movabsq	$5675921253449092805, %r13	#, tmp100
+.LVL117:
+.L82:
+	.loc 1 431 9 is_stmt 1 discriminator 3 view .LVU225
+# qtest.c:431:         buf[n] = charset[rand() % (sizeof charset - 1)];
+	.loc 1 431 26 is_stmt 0 discriminator 3 view .LVU226
+	call	rand@PLT	#
+.LVL118:
+	movslq	%eax, %rcx	# tmp112, _3
+# qtest.c:431:         buf[n] = charset[rand() % (sizeof charset - 1)];
+	.loc 1 431 33 discriminator 3 view .LVU227
+	movq	%rcx, %rax	# _3, tmp113
+	mulq	%r13	# tmp100
+	shrq	$3, %rdx	#, tmp98
+	leaq	(%rdx,%rdx,2), %rax	#, tmp103
+	leaq	(%rdx,%rax,4), %rax	#, tmp105
+	addq	%rax, %rax	# tmp106
+	subq	%rax, %rcx	# tmp106, tmp107
+# qtest.c:431:         buf[n] = charset[rand() % (sizeof charset - 1)];
+	.loc 1 431 16 discriminator 3 view .LVU228
+	movzbl	(%r14,%rcx), %eax	# charset[_5], charset[_5]
+	movb	%al, (%r12,%rbx)	# charset[_5], MEM[(char *)buf_14(D) + n_27 * 1]
+	.loc 1 430 34 is_stmt 1 discriminator 3 view .LVU229
+	addq	$1, %rbx	#, n
+.LVL119:
+	.loc 1 430 26 discriminator 3 view .LVU230
+	cmpq	%rbp, %rbx	# tmp94, n
+	jb	.L82	#,
+.LBE39:
+	.loc 1 433 5 view .LVU231
+# qtest.c:433:     buf[len] = '\0';
+	.loc 1 433 14 is_stmt 0 view .LVU232
+	movb	$0, (%r12,%rbp)	#, *_8
+# qtest.c:434: }
+	.loc 1 434 1 view .LVU233
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+.LVL120:
+	.loc 1 434 1 view .LVU234
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+.LVL121:
+	.loc 1 434 1 view .LVU235
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+.LVL122:
+	.loc 1 434 1 view .LVU236
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE38:
+	.size	fill_rand_string, .-fill_rand_string
+	.section	.rodata.str1.1
+.LC25:
+	.string	"%s needs 1-3 arguments"
+.LC26:
+	.string	"Unknown operation '%s'"
+	.section	.rodata.str1.8
+	.align 8
+.LC27:
+	.string	"Invalid maximum '%s', must be %d .. %d"
+	.align 8
+.LC28:
+	.string	"Invalid number of trials '%s', must be 1 .. %d"
+	.section	.rodata.str1.1
+.LC29:
+	.string	"Time (ns)"
+.LC30:
+	.string	"Elements"
+.LC31:
+	.string	"%10s %14s"
+	.section	.rodata.str1.8
+	.align 8
+.LC32:
+	.string	"ERROR: Could not build queue of %lu elements"
+	.align 8
+.LC33:
+	.string	"ERROR: Could not allocate queue"
+	.section	.rodata.str1.1
+.LC34:
+	.string	"%10lu %14.1f"
+	.section	.rodata.str1.8
+	.align 8
+.LC35:
+	.string	"%-10s c = %-12.4g relative error %.3f"
+	.section	.rodata.str1.1
+.LC37:
+	.string	"%s is %s (confidence %.0f%%)"
+	.text
+	.type	do_complexity, @function
+do_complexity:
+.LVL123:
+.LFB67:
+	.loc 1 1252 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1252 1 is_stmt 0 view .LVU238
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1192, %rsp	#,
+	.cfi_def_cfa_offset 1248
+	movq	%rsi, %r15	# tmp221, argv
+	.loc 1 1253 5 is_stmt 1 view .LVU239
+# qtest.c:1253:     int max_log = 22, trials = 5;
+	.loc 1 1253 9 is_stmt 0 view .LVU240
+	movl	$22, 1180(%rsp)	#, max_log
+# qtest.c:1253:     int max_log = 22, trials = 5;
+	.loc 1 1253 23 view .LVU241
+	movl	$5, 1176(%rsp)	#, trials
+	.loc 1 1254 5 is_stmt 1 view .LVU242
+# qtest.c:1254:     if (argc < 2 || argc > 4) {
+	.loc 1 1254 18 is_stmt 0 view .LVU243
+	leal	-2(%rdi), %eax	#, tmp152
+# qtest.c:1254:     if (argc < 2 || argc > 4) {
+	.loc 1 1254 8 view .LVU244
+	cmpl	$2, %eax	#, tmp152
+	ja	.L125	#,
+	movl	%edi, %r14d	# tmp220, argc
+.LBB40:
+# qtest.c:1260:         if (!strcmp(argv[1], cplx_ops[i].name))
+	.loc 1 1260 14 view .LVU245
+	movq	8(%rsi), %r12	# MEM[(char * *)argv_79(D) + 8B], _5
+	leaq	cplx_ops(%rip), %rbp	#, ivtmp.352
+	leaq	256(%rbp), %r13	#, _176
+.LBE40:
+# qtest.c:1258:     const cplx_op_t *op = NULL;
+	.loc 1 1258 22 view .LVU246
+	movl	$0, %ebx	#, op
+.LVL124:
+.L90:
+.LBB41:
+	.loc 1 1260 9 is_stmt 1 view .LVU247
+# qtest.c:1260:         if (!strcmp(argv[1], cplx_ops[i].name))
+	.loc 1 1260 14 is_stmt 0 view .LVU248
+	movq	0(%rbp), %rsi	# MEM[(char * *)_174], MEM[(char * *)_174]
+	movq	%r12, %rdi	# _5,
+	call	strcmp@PLT	#
+.LVL125:
+# qtest.c:1261:             op = &cplx_ops[i];
+	.loc 1 1261 16 view .LVU249
+	testl	%eax, %eax	# tmp222
+	cmove	%rbp, %rbx	# op,, ivtmp.352, op
+.LVL126:
+	.loc 1 1259 69 is_stmt 1 view .LVU250
+	.loc 1 1259 26 view .LVU251
+	addq	$32, %rbp	#, ivtmp.352
+	cmpq	%r13, %rbp	# _176, ivtmp.352
+	jne	.L90	#,
+.LBE41:
+	.loc 1 1263 5 view .LVU252
+# qtest.c:1263:     if (!op) {
+	.loc 1 1263 8 is_stmt 0 view .LVU253
+	testq	%rbx, %rbx	# op
+	je	.L126	#,
+	.loc 1 1267 5 is_stmt 1 view .LVU254
+# qtest.c:1267:     if (argc > 2 && (!get_int(argv[2], &max_log) || max_log < CPLX_MIN_LOG ||
+	.loc 1 1267 8 is_stmt 0 view .LVU255
+	cmpl	$2, %r14d	#, argc
+	jle	.L92	#,
+# qtest.c:1267:     if (argc > 2 && (!get_int(argv[2], &max_log) || max_log < CPLX_MIN_LOG ||
+	.loc 1 1267 23 discriminator 1 view .LVU256
+	leaq	1180(%rsp), %rsi	#, tmp158
+	movq	16(%r15), %rdi	# MEM[(char * *)argv_79(D) + 16B], MEM[(char * *)argv_79(D) + 16B]
+	call	get_int@PLT	#
+.LVL127:
+# qtest.c:1267:     if (argc > 2 && (!get_int(argv[2], &max_log) || max_log < CPLX_MIN_LOG ||
+	.loc 1 1267 18 discriminator 1 view .LVU257
+	testb	%al, %al	# tmp223
+	je	.L93	#,
+# qtest.c:1267:     if (argc > 2 && (!get_int(argv[2], &max_log) || max_log < CPLX_MIN_LOG ||
+	.loc 1 1267 76 discriminator 2 view .LVU258
+	movl	1180(%rsp), %eax	# max_log, tmp237
+	subl	$10, %eax	#, tmp160
+	cmpl	$14, %eax	#, tmp160
+	jbe	.L94	#,
+.L93:
+	.loc 1 1269 9 is_stmt 1 view .LVU259
+	movq	16(%r15), %rdx	# MEM[(char * *)argv_79(D) + 16B], MEM[(char * *)argv_79(D) + 16B]
+	movl	$24, %r8d	#,
+	movl	$10, %ecx	#,
+	leaq	.LC27(%rip), %rsi	#, tmp163
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL128:
+	.loc 1 1271 9 view .LVU260
+# qtest.c:1271:         return false;
+	.loc 1 1271 16 is_stmt 0 view .LVU261
+	movl	$0, %eax	#, <retval>
+.LVL129:
+.L86:
+# qtest.c:1348: }
+	.loc 1 1348 1 view .LVU262
+	addq	$1192, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL130:
+.L125:
+	.cfi_restore_state
+	.loc 1 1255 9 is_stmt 1 view .LVU263
+	movq	(%rsi), %rdx	# *argv_79(D), *argv_79(D)
+	leaq	.LC25(%rip), %rsi	#, tmp154
+.LVL131:
+	.loc 1 1255 9 is_stmt 0 view .LVU264
+	movl	$1, %edi	#,
+.LVL132:
+	.loc 1 1255 9 view .LVU265
+	movl	$0, %eax	#,
+.LVL133:
+	.loc 1 1255 9 view .LVU266
+	call	report@PLT	#
+.LVL134:
+	.loc 1 1256 9 is_stmt 1 view .LVU267
+# qtest.c:1256:         return false;
+	.loc 1 1256 16 is_stmt 0 view .LVU268
+	movl	$0, %eax	#, <retval>
+	jmp	.L86	#
+.LVL135:
+.L126:
+	.loc 1 1264 9 is_stmt 1 view .LVU269
+	movq	%r12, %rdx	# _5,
+	leaq	.LC26(%rip), %rsi	#, tmp157
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL136:
+	.loc 1 1265 9 view .LVU270
+# qtest.c:1265:         return false;
+	.loc 1 1265 16 is_stmt 0 view .LVU271
+	movl	$0, %eax	#, <retval>
+	jmp	.L86	#
+.L94:
+	.loc 1 1273 5 is_stmt 1 view .LVU272
+# qtest.c:1273:     if (argc > 3 && (!get_int(argv[3], &trials) || trials < 1 ||
+	.loc 1 1273 8 is_stmt 0 view .LVU273
+	cmpl	$3, %r14d	#, argc
+	jg	.L127	#,
+.L92:
+	.loc 1 1279 5 is_stmt 1 view .LVU274
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL137:
+	.loc 1 1281 5 view .LVU275
+	.loc 1 1282 5 view .LVU276
+	.loc 1 1283 5 view .LVU277
+	.loc 1 1284 5 view .LVU278
+	.loc 1 1285 5 view .LVU279
+	.loc 1 1286 5 view .LVU280
+	movl	$10, %esi	#,
+	leaq	cplx_buf(%rip), %rdi	#, tmp170
+	call	fill_rand_string	#
+.LVL138:
+	.loc 1 1289 5 view .LVU281
+	movl	$0, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL139:
+	.loc 1 1290 5 view .LVU282
+	leaq	.LC29(%rip), %rcx	#, tmp171
+	leaq	.LC30(%rip), %rdx	#, tmp172
+	leaq	.LC31(%rip), %rsi	#, tmp173
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL140:
+	.loc 1 1291 5 view .LVU283
+.LBB42:
+	.loc 1 1291 10 view .LVU284
+	.loc 1 1291 35 view .LVU285
+.LBE42:
+# qtest.c:1290:     report(1, "%10s %14s", "Elements", "Time (ns)");
+	.loc 1 1290 5 is_stmt 0 view .LVU286
+	movl	$0, %r14d	#, ivtmp.333
+.LVL141:
+	.loc 1 1290 5 view .LVU287
+	jmp	.L96	#
+.LVL142:
+.L127:
+# qtest.c:1273:     if (argc > 3 && (!get_int(argv[3], &trials) || trials < 1 ||
+	.loc 1 1273 23 discriminator 1 view .LVU288
+	leaq	1176(%rsp), %rsi	#, tmp164
+	movq	24(%r15), %rdi	# MEM[(char * *)argv_79(D) + 24B], MEM[(char * *)argv_79(D) + 24B]
+	call	get_int@PLT	#
+.LVL143:
+# qtest.c:1273:     if (argc > 3 && (!get_int(argv[3], &trials) || trials < 1 ||
+	.loc 1 1273 18 discriminator 1 view .LVU289
+	testb	%al, %al	# tmp224
+	je	.L95	#,
+# qtest.c:1273:     if (argc > 3 && (!get_int(argv[3], &trials) || trials < 1 ||
+	.loc 1 1273 63 discriminator 2 view .LVU290
+	movl	1176(%rsp), %eax	# trials, tmp238
+	subl	$1, %eax	#, tmp166
+	cmpl	$100, %eax	#, tmp166
+	jbe	.L92	#,
+.L95:
+	.loc 1 1275 9 is_stmt 1 view .LVU291
+	movq	24(%r15), %rdx	# MEM[(char * *)argv_79(D) + 24B], MEM[(char * *)argv_79(D) + 24B]
+	movl	$101, %ecx	#,
+	leaq	.LC28(%rip), %rsi	#, tmp169
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL144:
+	.loc 1 1277 9 view .LVU292
+# qtest.c:1277:         return false;
+	.loc 1 1277 16 is_stmt 0 view .LVU293
+	movl	$0, %eax	#, <retval>
+	jmp	.L86	#
+.LVL145:
+.L130:
+.LBB55:
+.LBB43:
+.LBB44:
+	.loc 1 1301 21 is_stmt 1 view .LVU294
+	movq	%r13, %rdx	# n,
+	leaq	.LC32(%rip), %rsi	#,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL146:
+	.loc 1 1303 21 view .LVU295
+	.loc 1 1304 21 view .LVU296
+	.loc 1 1304 21 is_stmt 0 view .LVU297
+.LBE44:
+	.loc 1 1307 13 is_stmt 1 view .LVU298
+.LBB45:
+	.loc 1 1307 18 view .LVU299
+	.loc 1 1307 32 view .LVU300
+	.loc 1 1307 32 is_stmt 0 view .LVU301
+.LBE45:
+	.loc 1 1317 9 is_stmt 1 view .LVU302
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL147:
+	.loc 1 1318 9 view .LVU303
+# qtest.c:1318:         if (exception_setup(false)) {
+	.loc 1 1318 13 is_stmt 0 view .LVU304
+	movl	$0, %edi	#,
+	call	exception_setup@PLT	#
+.LVL148:
+# qtest.c:1318:         if (exception_setup(false)) {
+	.loc 1 1318 12 view .LVU305
+	testb	%al, %al	# tmp229
+	je	.L128	#,
+.LVL149:
+.L100:
+	.loc 1 1319 13 is_stmt 1 view .LVU306
+	movq	%rbp, %rdi	# cq,
+	call	q_free@PLT	#
+.LVL150:
+	.loc 1 1320 13 view .LVU307
+	movq	cplx_side(%rip), %rdi	# cplx_side,
+	call	q_free@PLT	#
+.LVL151:
+.L108:
+	.loc 1 1322 9 view .LVU308
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL152:
+	.loc 1 1323 9 view .LVU309
+# qtest.c:1323:         cplx_side = NULL;
+	.loc 1 1323 19 is_stmt 0 view .LVU310
+	movq	$0, cplx_side(%rip)	#, cplx_side
+	.loc 1 1324 9 is_stmt 1 view .LVU311
+# qtest.c:1324:         if (!cq) {
+	.loc 1 1324 12 is_stmt 0 view .LVU312
+	testq	%rbp, %rbp	# cq
+	je	.L115	#,
+.LVL153:
+	.loc 1 1328 9 is_stmt 1 view .LVU313
+# qtest.c:1328:         if (!ok)
+	.loc 1 1328 12 is_stmt 0 view .LVU314
+	testb	%r12b, %r12b	# ok
+	je	.L110	#,
+	.loc 1 1331 9 is_stmt 1 view .LVU315
+# qtest.c:1331:         sizes[count] = n;
+	.loc 1 1331 22 is_stmt 0 view .LVU316
+	leaq	1056(%rsp), %rax	#, tmp190
+	testq	%r13, %r13	# n
+	js	.L111	#,
+	.loc 1 1331 22 view .LVU317
+	pxor	%xmm0, %xmm0	# tmp191
+	cvtsi2sdq	%r13, %xmm0	# n, tmp191
+.L112:
+	.loc 1 1331 22 view .LVU318
+	movsd	%xmm0, (%rax,%r14,8)	# tmp191, MEM[(double *)&sizes + ivtmp.333_73 * 8]
+	.loc 1 1332 9 is_stmt 1 view .LVU319
+# qtest.c:1332:         times[count] = cplx_median(samples, trials);
+	.loc 1 1332 24 is_stmt 0 view .LVU320
+	leaq	112(%rsp), %rdi	#, tmp196
+	movl	1176(%rsp), %esi	# trials,
+	call	cplx_median@PLT	#
+.LVL154:
+# qtest.c:1332:         times[count] = cplx_median(samples, trials);
+	.loc 1 1332 22 view .LVU321
+	movsd	%xmm0, 928(%rsp,%r14,8)	# _38, MEM[(double *)&times + ivtmp.333_73 * 8]
+	.loc 1 1333 9 is_stmt 1 view .LVU322
+	movq	%r13, %rdx	# n,
+	leaq	.LC34(%rip), %rsi	#,
+	movl	$1, %edi	#,
+	movl	$1, %eax	#,
+	call	report@PLT	#
+.LVL155:
+	.loc 1 1334 9 view .LVU323
+	.loc 1 1334 9 is_stmt 0 view .LVU324
+.LBE43:
+	.loc 1 1291 53 is_stmt 1 view .LVU325
+	.loc 1 1291 35 view .LVU326
+	addq	$1, %r14	#, ivtmp.333
+.LVL156:
+.L96:
+	.loc 1 1291 35 is_stmt 0 view .LVU327
+	leal	10(%r14), %ecx	#, k
+.LVL157:
+# qtest.c:1291:     for (int k = CPLX_MIN_LOG; ok && k <= max_log; k++) {
+	.loc 1 1291 35 discriminator 3 view .LVU328
+	cmpl	%ecx, 1180(%rsp)	# k, max_log
+	jl	.L129	#,
+.LBB52:
+	.loc 1 1292 9 is_stmt 1 view .LVU329
+# qtest.c:1292:         size_t n = (size_t) 1 << k;
+	.loc 1 1292 16 is_stmt 0 view .LVU330
+	movl	$1, %r13d	#, n
+	salq	%cl, %r13	# k, n
+.LVL158:
+	.loc 1 1293 9 is_stmt 1 view .LVU331
+	.loc 1 1294 9 view .LVU332
+	.loc 1 1295 9 view .LVU333
+# qtest.c:1295:         if (exception_setup(false)) {
+	.loc 1 1295 13 is_stmt 0 view .LVU334
+	movl	$0, %edi	#,
+	call	exception_setup@PLT	#
+.LVL159:
+	.loc 1 1295 13 view .LVU335
+	movb	%al, 15(%rsp)	# _18, %sfp
+# qtest.c:1295:         if (exception_setup(false)) {
+	.loc 1 1295 12 view .LVU336
+	testb	%al, %al	# _18
+	je	.L97	#,
+	.loc 1 1296 13 is_stmt 1 view .LVU337
+# qtest.c:1296:             cplx_side = q_new();
+	.loc 1 1296 25 is_stmt 0 view .LVU338
+	movl	$0, %eax	#,
+	call	q_new@PLT	#
+.LVL160:
+# qtest.c:1296:             cplx_side = q_new();
+	.loc 1 1296 23 view .LVU339
+	movq	%rax, cplx_side(%rip)	# tmp226, cplx_side
+	.loc 1 1297 13 is_stmt 1 view .LVU340
+# qtest.c:1297:             cq = q_new();
+	.loc 1 1297 18 is_stmt 0 view .LVU341
+	movl	$0, %eax	#,
+	call	q_new@PLT	#
+.LVL161:
+	movq	%rax, %rbp	# tmp227, cq
+.LVL162:
+	.loc 1 1298 13 is_stmt 1 view .LVU342
+.LBB48:
+	.loc 1 1298 18 view .LVU343
+	.loc 1 1298 35 view .LVU344
+	testq	%rax, %rax	# cq
+	je	.L98	#,
+# qtest.c:1298:             for (size_t i = 0; cq && i < n; i++) {
+	.loc 1 1298 25 is_stmt 0 view .LVU345
+	movl	$0, %r15d	#, i
+# qtest.c:1299:                 fill_rand_string(randstr_buf, sizeof(randstr_buf));
+	.loc 1 1299 17 view .LVU346
+	leaq	22(%rsp), %rax	#, tmp175
+.LVL163:
+	.loc 1 1299 17 view .LVU347
+	movq	%rax, (%rsp)	# tmp175, %sfp
+.LVL164:
+.L102:
+	.loc 1 1299 17 is_stmt 1 view .LVU348
+	movl	$10, %esi	#,
+	movq	(%rsp), %r12	# %sfp, tmp175
+	movq	%r12, %rdi	# tmp175,
+	call	fill_rand_string	#
+.LVL165:
+	.loc 1 1300 17 view .LVU349
+# qtest.c:1300:                 if (!q_insert_head(cq, randstr_buf)) {
+	.loc 1 1300 22 is_stmt 0 view .LVU350
+	movq	%r12, %rsi	# tmp175,
+	movq	%rbp, %rdi	# cq,
+	call	q_insert_head@PLT	#
+.LVL166:
+	movl	%eax, %r12d	# tmp228, ok
+# qtest.c:1300:                 if (!q_insert_head(cq, randstr_buf)) {
+	.loc 1 1300 20 view .LVU351
+	testb	%al, %al	# ok
+	je	.L130	#,
+	.loc 1 1298 46 is_stmt 1 discriminator 2 view .LVU352
+	addq	$1, %r15	#, i
+.LVL167:
+	.loc 1 1298 35 discriminator 2 view .LVU353
+	cmpq	%r15, %r13	# i, n
+	jne	.L102	#,
+.LVL168:
+.L98:
+	.loc 1 1298 35 is_stmt 0 discriminator 2 view .LVU354
+.LBE48:
+	.loc 1 1307 13 is_stmt 1 view .LVU355
+.LBB49:
+	.loc 1 1307 18 view .LVU356
+	.loc 1 1307 32 view .LVU357
+.LBE49:
+.LBB50:
+# qtest.c:1298:             for (size_t i = 0; cq && i < n; i++) {
+	.loc 1 1298 25 is_stmt 0 view .LVU358
+	movl	$0, %r15d	#, ivtmp.324
+	jmp	.L103	#
+.LVL169:
+.L104:
+	.loc 1 1298 25 view .LVU359
+.LBE50:
+.LBB51:
+.LBB46:
+# qtest.c:1310:                 samples[i] = (double) (time_ns() - start) / op->reps;
+	.loc 1 1310 30 view .LVU360
+	movq	%rax, %rcx	# tmp181, tmp184
+	shrq	%rcx	# tmp184
+	andl	$1, %eax	#, tmp185
+	orq	%rax, %rcx	# tmp185, tmp184
+	pxor	%xmm0, %xmm0	# tmp183
+	cvtsi2sdq	%rcx, %xmm0	# tmp184, tmp183
+	addsd	%xmm0, %xmm0	# tmp183, tmp182
+.L105:
+# qtest.c:1310:                 samples[i] = (double) (time_ns() - start) / op->reps;
+	.loc 1 1310 59 view .LVU361
+	pxor	%xmm1, %xmm1	# tmp186
+	cvtsi2sdl	%esi, %xmm1	# _29, tmp186
+	divsd	%xmm1, %xmm0	# tmp186, tmp187
+# qtest.c:1310:                 samples[i] = (double) (time_ns() - start) / op->reps;
+	.loc 1 1310 28 view .LVU362
+	movsd	%xmm0, (%rdx,%r15,8)	# tmp187, MEM[(double *)&samples + ivtmp.324_7 * 8]
+	.loc 1 1311 17 is_stmt 1 view .LVU363
+# qtest.c:1311:                 if (op->undo)
+	.loc 1 1311 23 is_stmt 0 view .LVU364
+	movq	24(%rbx), %rax	# op_50->undo, _32
+# qtest.c:1311:                 if (op->undo)
+	.loc 1 1311 20 view .LVU365
+	testq	%rax, %rax	# _32
+	je	.L106	#,
+	.loc 1 1312 21 is_stmt 1 view .LVU366
+	movq	%rbp, %rdi	# cq,
+	call	*%rax	# _32
+.LVL170:
+.L106:
+	.loc 1 1312 21 is_stmt 0 view .LVU367
+.LBE46:
+	.loc 1 1307 48 is_stmt 1 discriminator 2 view .LVU368
+	.loc 1 1307 32 discriminator 2 view .LVU369
+	.loc 1 1307 32 is_stmt 0 discriminator 2 view .LVU370
+	addq	$1, %r15	#, ivtmp.324
+.LVL171:
+.L103:
+# qtest.c:1307:             for (int i = 0; ok && i < trials; i++) {
+	.loc 1 1307 32 discriminator 3 view .LVU371
+	cmpl	%r15d, 1176(%rsp)	# ivtmp.324, trials
+	jle	.L131	#,
+.LBB47:
+	.loc 1 1308 17 is_stmt 1 view .LVU372
+# qtest.c:1308:                 uint64_t start = time_ns();
+	.loc 1 1308 34 is_stmt 0 view .LVU373
+	movl	$0, %eax	#,
+	call	time_ns@PLT	#
+.LVL172:
+	movq	%rax, %r12	# tmp230, start
+.LVL173:
+	.loc 1 1309 17 is_stmt 1 view .LVU374
+	movl	8(%rbx), %esi	# op_50->reps, op_50->reps
+	movq	%rbp, %rdi	# cq,
+	call	*16(%rbx)	# op_50->run
+.LVL174:
+	.loc 1 1310 17 view .LVU375
+# qtest.c:1310:                 samples[i] = (double) (time_ns() - start) / op->reps;
+	.loc 1 1310 40 is_stmt 0 view .LVU376
+	movl	$0, %eax	#,
+	call	time_ns@PLT	#
+.LVL175:
+# qtest.c:1310:                 samples[i] = (double) (time_ns() - start) / op->reps;
+	.loc 1 1310 63 view .LVU377
+	movl	8(%rbx), %esi	# op_50->reps, _29
+# qtest.c:1310:                 samples[i] = (double) (time_ns() - start) / op->reps;
+	.loc 1 1310 28 view .LVU378
+	leaq	112(%rsp), %rdx	#, tmp180
+# qtest.c:1310:                 samples[i] = (double) (time_ns() - start) / op->reps;
+	.loc 1 1310 30 view .LVU379
+	subq	%r12, %rax	# start, tmp181
+	js	.L104	#,
+	pxor	%xmm0, %xmm0	# tmp182
+	cvtsi2sdq	%rax, %xmm0	# tmp181, tmp182
+	jmp	.L105	#
+.LVL176:
+.L131:
+	.loc 1 1310 30 view .LVU380
+.LBE47:
+.LBE51:
+	.loc 1 1317 9 is_stmt 1 view .LVU381
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL177:
+	.loc 1 1318 9 view .LVU382
+# qtest.c:1318:         if (exception_setup(false)) {
+	.loc 1 1318 13 is_stmt 0 view .LVU383
+	movl	$0, %edi	#,
+	call	exception_setup@PLT	#
+.LVL178:
+	movl	%eax, %r12d	# tmp232, ok
+# qtest.c:1318:         if (exception_setup(false)) {
+	.loc 1 1318 12 view .LVU384
+	testb	%al, %al	# ok
+	jne	.L100	#,
+	movzbl	15(%rsp), %r12d	# %sfp, ok
+	jmp	.L108	#
+.LVL179:
+.L111:
+# qtest.c:1331:         sizes[count] = n;
+	.loc 1 1331 22 view .LVU385
+	movq	%r13, %rdx	# n, tmp193
+	shrq	%rdx	# tmp193
+	movq	%r13, %rcx	# n, tmp194
+	andl	$1, %ecx	#, tmp194
+	orq	%rcx, %rdx	# tmp194, tmp193
+	pxor	%xmm0, %xmm0	# tmp192
+	cvtsi2sdq	%rdx, %xmm0	# tmp193, tmp192
+	addsd	%xmm0, %xmm0	# tmp192, tmp191
+	jmp	.L112	#
+.LVL180:
+.L129:
+	.loc 1 1331 22 view .LVU386
+.LBE52:
+.LBE55:
+	.loc 1 1336 5 is_stmt 1 view .LVU387
+	movl	$1, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL181:
+	.loc 1 1337 5 view .LVU388
+	.loc 1 1340 5 view .LVU389
+	.loc 1 1341 5 view .LVU390
+	leaq	32(%rsp), %rbp	#, tmp199
+	leaq	928(%rsp), %rsi	#, tmp200
+	leaq	1056(%rsp), %rdi	#, tmp201
+	movq	%rbp, %rcx	# tmp199,
+	movl	%r14d, %edx	# ivtmp.333, ivtmp.333
+	call	cplx_fit@PLT	#
+.LVL182:
+	.loc 1 1342 5 view .LVU391
+.LBB56:
+	.loc 1 1342 10 view .LVU392
+	.loc 1 1342 23 view .LVU393
+	leaq	cplx_names(%rip), %r12	#, ivtmp.320
+	leaq	64(%rsp), %r14	#, _59
+.LVL183:
+# qtest.c:1343:         report(2, "%-10s c = %-12.4g relative error %.3f", cplx_names[m],
+	.loc 1 1343 9 is_stmt 0 view .LVU394
+	leaq	.LC35(%rip), %r13	#, tmp206
+.LVL184:
+.L114:
+	.loc 1 1343 9 is_stmt 1 discriminator 3 view .LVU395
+	movsd	0(%rbp), %xmm0	# MEM[(double *)_13], MEM[(double *)_13]
+	movq	(%r12), %rdx	# MEM[(const char * *)_23], MEM[(const char * *)_23]
+	movsd	32(%rbp), %xmm1	# MEM[(double *)_13 + 32B],
+	movq	%r13, %rsi	# tmp206,
+	movl	$2, %edi	#,
+	movl	$2, %eax	#,
+	call	report@PLT	#
+.LVL185:
+	.loc 1 1342 38 discriminator 3 view .LVU396
+	.loc 1 1342 23 discriminator 3 view .LVU397
+	addq	$8, %rbp	#, ivtmp.319
+.LVL186:
+	.loc 1 1342 23 is_stmt 0 discriminator 3 view .LVU398
+	addq	$8, %r12	#, ivtmp.320
+	cmpq	%r14, %rbp	# _59, ivtmp.319
+	jne	.L114	#,
+.LBE56:
+	.loc 1 1345 5 is_stmt 1 view .LVU399
+	movsd	.LC36(%rip), %xmm0	#, tmp209
+	mulsd	104(%rsp), %xmm0	# fit.confidence, tmp207
+	movl	96(%rsp), %edx	# fit.best, fit.best
+	leaq	cplx_names(%rip), %rax	#, tmp210
+	movq	(%rax,%rdx,8), %rcx	# cplx_names[_45], cplx_names[_45]
+	movq	(%rbx), %rdx	# op_50->name, op_50->name
+	leaq	.LC37(%rip), %rsi	#, tmp214
+	movl	$1, %edi	#,
+	movl	$1, %eax	#,
+	call	report@PLT	#
+.LVL187:
+	.loc 1 1347 5 view .LVU400
+# qtest.c:1347:     return !error_check();
+	.loc 1 1347 13 is_stmt 0 view .LVU401
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL188:
+# qtest.c:1347:     return !error_check();
+	.loc 1 1347 5 view .LVU402
+	xorl	$1, %eax	#, <retval>
+# qtest.c:1347:     return !error_check();
+	.loc 1 1347 12 view .LVU403
+	jmp	.L86	#
+.LVL189:
+.L132:
+.LBB57:
+.LBB53:
+	.loc 1 1322 9 is_stmt 1 view .LVU404
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL190:
+	.loc 1 1323 9 view .LVU405
+# qtest.c:1323:         cplx_side = NULL;
+	.loc 1 1323 19 is_stmt 0 view .LVU406
+	movq	$0, cplx_side(%rip)	#, cplx_side
+	.loc 1 1324 9 is_stmt 1 view .LVU407
+.LVL191:
+.L115:
+	.loc 1 1325 13 view .LVU408
+	leaq	.LC33(%rip), %rsi	#, tmp189
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL192:
+	.loc 1 1326 13 view .LVU409
+	.loc 1 1328 9 view .LVU410
+.L110:
+	.loc 1 1328 9 is_stmt 0 view .LVU411
+.LBE53:
+.LBE57:
+	.loc 1 1336 5 is_stmt 1 view .LVU412
+	movl	$1, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL193:
+	.loc 1 1337 5 view .LVU413
+# qtest.c:1338:         return false;
+	.loc 1 1338 16 is_stmt 0 view .LVU414
+	movl	$0, %eax	#, <retval>
+	jmp	.L86	#
+.LVL194:
+.L97:
+.LBB58:
+.LBB54:
+	.loc 1 1317 9 is_stmt 1 view .LVU415
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL195:
+	.loc 1 1318 9 view .LVU416
+# qtest.c:1318:         if (exception_setup(false)) {
+	.loc 1 1318 13 is_stmt 0 view .LVU417
+	movl	$0, %edi	#,
+	call	exception_setup@PLT	#
+.LVL196:
+# qtest.c:1318:         if (exception_setup(false)) {
+	.loc 1 1318 12 view .LVU418
+	testb	%al, %al	# tmp235
+	je	.L132	#,
+# qtest.c:1315:             ok = false;
+	.loc 1 1315 16 view .LVU419
+	movzbl	15(%rsp), %r12d	# %sfp, ok
+# qtest.c:1294:         queue_t *cq = NULL;
+	.loc 1 1294 18 view .LVU420
+	movl	$0, %ebp	#, cq
+	jmp	.L100	#
+.LVL197:
+.L128:
+	.loc 1 1322 9 is_stmt 1 view .LVU421
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL198:
+	.loc 1 1323 9 view .LVU422
+# qtest.c:1323:         cplx_side = NULL;
+	.loc 1 1323 19 is_stmt 0 view .LVU423
+	movq	$0, cplx_side(%rip)	#, cplx_side
+	.loc 1 1324 9 is_stmt 1 view .LVU424
+	jmp	.L110	#
+.LBE54:
+.LBE58:
+	.cfi_endproc
+.LFE67:
+	.size	do_complexity, .-do_complexity
+	.type	cplx_sort, @function
+cplx_sort:
+.LVL199:
+.LFB65:
+	.loc 1 1219 1 view -0
+	.cfi_startproc
+	.loc 1 1219 1 is_stmt 0 view .LVU426
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 1220 5 is_stmt 1 view .LVU427
+	call	q_sort@PLT	#
+.LVL200:
+# qtest.c:1221: }
+	.loc 1 1221 1 is_stmt 0 view .LVU428
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE65:
+	.size	cplx_sort, .-cplx_sort
+	.type	cplx_reverse, @function
+cplx_reverse:
+.LVL201:
+.LFB64:
+	.loc 1 1214 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1214 1 is_stmt 0 view .LVU430
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 1215 5 is_stmt 1 view .LVU431
+	call	q_reverse@PLT	#
+.LVL202:
+# qtest.c:1216: }
+	.loc 1 1216 1 is_stmt 0 view .LVU432
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE64:
+	.size	cplx_reverse, .-cplx_reverse
+	.type	cplx_transfer_back, @function
+cplx_transfer_back:
+.LVL203:
+.LFB63:
+	.loc 1 1209 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1209 1 is_stmt 0 view .LVU434
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 1210 5 is_stmt 1 view .LVU435
+	movq	cplx_side(%rip), %rsi	# cplx_side,
+.LVL204:
+	.loc 1 1210 5 is_stmt 0 view .LVU436
+	call	q_splice@PLT	#
+.LVL205:
+# qtest.c:1211: }
+	.loc 1 1211 1 view .LVU437
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE63:
+	.size	cplx_transfer_back, .-cplx_transfer_back
+	.type	cplx_splice, @function
+cplx_splice:
+.LVL206:
+.LFB61:
+	.loc 1 1194 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1195 5 view .LVU439
+.LBB59:
+	.loc 1 1195 10 view .LVU440
+	.loc 1 1195 23 view .LVU441
+	testl	%esi, %esi	# reps
+	jle	.L144	#,
+.LBE59:
+# qtest.c:1194: {
+	.loc 1 1194 1 is_stmt 0 view .LVU442
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbp	# tmp89, q
+	movl	%esi, %r12d	# tmp90, reps
+.LBB60:
+# qtest.c:1195:     for (int i = 0; i < reps; i++) {
+	.loc 1 1195 14 view .LVU443
+	movl	$0, %ebx	#, i
+.LVL207:
+.L141:
+	.loc 1 1196 9 is_stmt 1 discriminator 3 view .LVU444
+	movq	%rbp, %rsi	# q,
+	movq	cplx_side(%rip), %rdi	# cplx_side,
+	call	q_splice@PLT	#
+.LVL208:
+	.loc 1 1197 9 discriminator 3 view .LVU445
+	movq	cplx_side(%rip), %rsi	# cplx_side,
+	movq	%rbp, %rdi	# q,
+	call	q_splice@PLT	#
+.LVL209:
+	.loc 1 1195 32 discriminator 3 view .LVU446
+	addl	$1, %ebx	#, i
+.LVL210:
+	.loc 1 1195 23 discriminator 3 view .LVU447
+	cmpl	%ebx, %r12d	# i, reps
+	jne	.L141	#,
+.LBE60:
+# qtest.c:1199: }
+	.loc 1 1199 1 is_stmt 0 view .LVU448
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LVL211:
+	.loc 1 1199 1 view .LVU449
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL212:
+	.loc 1 1199 1 view .LVU450
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL213:
+	.loc 1 1199 1 view .LVU451
+	ret	
+.LVL214:
+.L144:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.loc 1 1199 1 view .LVU452
+	ret	
+	.cfi_endproc
+.LFE61:
+	.size	cplx_splice, .-cplx_splice
+	.type	cplx_insert_tail, @function
+cplx_insert_tail:
+.LVL215:
+.LFB59:
+	.loc 1 1181 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1182 5 view .LVU454
+.LBB61:
+	.loc 1 1182 10 view .LVU455
+	.loc 1 1182 23 view .LVU456
+	testl	%esi, %esi	# reps
+	jle	.L152	#,
+.LBE61:
+# qtest.c:1181: {
+	.loc 1 1181 1 is_stmt 0 view .LVU457
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %r12	# tmp86, q
+	movl	%esi, %ebp	# tmp87, reps
+.LBB62:
+# qtest.c:1182:     for (int i = 0; i < reps; i++)
+	.loc 1 1182 14 view .LVU458
+	movl	$0, %ebx	#, i
+# qtest.c:1183:         q_insert_tail(q, cplx_buf);
+	.loc 1 1183 9 view .LVU459
+	leaq	cplx_buf(%rip), %r13	#, tmp85
+.LVL216:
+.L149:
+	.loc 1 1183 9 is_stmt 1 discriminator 3 view .LVU460
+	movq	%r13, %rsi	# tmp85,
+	movq	%r12, %rdi	# q,
+	call	q_insert_tail@PLT	#
+.LVL217:
+	.loc 1 1182 32 discriminator 3 view .LVU461
+	addl	$1, %ebx	#, i
+.LVL218:
+	.loc 1 1182 23 discriminator 3 view .LVU462
+	cmpl	%ebx, %ebp	# i, reps
+	jne	.L149	#,
+.LBE62:
+# qtest.c:1184: }
+	.loc 1 1184 1 is_stmt 0 view .LVU463
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL219:
+	.loc 1 1184 1 view .LVU464
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+.LVL220:
+	.loc 1 1184 1 view .LVU465
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL221:
+	.loc 1 1184 1 view .LVU466
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL222:
+.L152:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.loc 1 1184 1 view .LVU467
+	ret	
+	.cfi_endproc
+.LFE59:
+	.size	cplx_insert_tail, .-cplx_insert_tail
+	.type	cplx_transfer, @function
+cplx_transfer:
+.LVL223:
+.LFB62:
+	.loc 1 1203 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1203 1 is_stmt 0 view .LVU469
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp	# tmp89, q
+	.loc 1 1204 5 is_stmt 1 view .LVU470
+# qtest.c:1204:     while (q_remove_head(q, cplx_buf, sizeof(cplx_buf)))
+	.loc 1 1204 12 is_stmt 0 view .LVU471
+	leaq	cplx_buf(%rip), %rbx	#, tmp88
+# qtest.c:1204:     while (q_remove_head(q, cplx_buf, sizeof(cplx_buf)))
+	.loc 1 1204 11 view .LVU472
+	jmp	.L156	#
+.LVL224:
+.L157:
+	.loc 1 1205 9 is_stmt 1 view .LVU473
+	movq	%rbx, %rsi	# tmp88,
+	movq	cplx_side(%rip), %rdi	# cplx_side,
+	call	q_insert_tail@PLT	#
+.LVL225:
+.L156:
+	.loc 1 1204 12 view .LVU474
+	movl	$10, %edx	#,
+	movq	%rbx, %rsi	# tmp88,
+	movq	%rbp, %rdi	# q,
+	call	q_remove_head@PLT	#
+.LVL226:
+	testb	%al, %al	# tmp90
+	jne	.L157	#,
+# qtest.c:1206: }
+	.loc 1 1206 1 is_stmt 0 view .LVU475
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL227:
+	.loc 1 1206 1 view .LVU476
+	ret	
+	.cfi_endproc
+.LFE62:
+	.size	cplx_transfer, .-cplx_transfer
+	.type	cplx_remove_head, @function
+cplx_remove_head:
+.LVL228:
+.LFB60:
+	.loc 1 1187 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1188 5 view .LVU478
+.LBB63:
+	.loc 1 1188 10 view .LVU479
+	.loc 1 1188 23 view .LVU480
+	testl	%esi, %esi	# reps
+	jle	.L164	#,
+.LBE63:
+# qtest.c:1187: {
+	.loc 1 1187 1 is_stmt 0 view .LVU481
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %r12	# tmp86, q
+	movl	%esi, %ebp	# tmp87, reps
+.LBB64:
+# qtest.c:1188:     for (int i = 0; i < reps; i++)
+	.loc 1 1188 14 view .LVU482
+	movl	$0, %ebx	#, i
+# qtest.c:1189:         q_remove_head(q, cplx_buf, sizeof(cplx_buf));
+	.loc 1 1189 9 view .LVU483
+	leaq	cplx_buf(%rip), %r13	#, tmp85
+.LVL229:
+.L161:
+	.loc 1 1189 9 is_stmt 1 discriminator 3 view .LVU484
+	movl	$10, %edx	#,
+	movq	%r13, %rsi	# tmp85,
+	movq	%r12, %rdi	# q,
+	call	q_remove_head@PLT	#
+.LVL230:
+	.loc 1 1188 32 discriminator 3 view .LVU485
+	addl	$1, %ebx	#, i
+.LVL231:
+	.loc 1 1188 23 discriminator 3 view .LVU486
+	cmpl	%ebx, %ebp	# i, reps
+	jne	.L161	#,
+.LBE64:
+# qtest.c:1190: }
+	.loc 1 1190 1 is_stmt 0 view .LVU487
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL232:
+	.loc 1 1190 1 view .LVU488
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+.LVL233:
+	.loc 1 1190 1 view .LVU489
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL234:
+	.loc 1 1190 1 view .LVU490
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL235:
+.L164:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.loc 1 1190 1 view .LVU491
+	ret	
+	.cfi_endproc
+.LFE60:
+	.size	cplx_remove_head, .-cplx_remove_head
+	.type	merge_deal, @function
+merge_deal:
+.LVL236:
+.LFB41:
+	.loc 1 521 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 521 1 is_stmt 0 view .LVU493
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$16, %rsp	#,
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %r13	# tmp100, q
+	movq	%rsi, %r14	# tmp101, qs
+	movl	%edx, %ebp	# tmp102, k
+	.loc 1 522 5 is_stmt 1 view .LVU494
+	.loc 1 523 5 view .LVU495
+.LBB65:
+	.loc 1 523 10 view .LVU496
+.LVL237:
+# qtest.c:523:     for (int i = 0; q_remove_head(q, buf, sizeof(buf)); i = (i + 1) % k) {
+	.loc 1 523 14 is_stmt 0 view .LVU497
+	movl	$0, %ebx	#, i
+# qtest.c:523:     for (int i = 0; q_remove_head(q, buf, sizeof(buf)); i = (i + 1) % k) {
+	.loc 1 523 21 view .LVU498
+	leaq	6(%rsp), %r12	#, tmp98
+# qtest.c:523:     for (int i = 0; q_remove_head(q, buf, sizeof(buf)); i = (i + 1) % k) {
+	.loc 1 523 5 view .LVU499
+	jmp	.L168	#
+.LVL238:
+.L173:
+	.loc 1 523 59 is_stmt 1 discriminator 2 view .LVU500
+# qtest.c:523:     for (int i = 0; q_remove_head(q, buf, sizeof(buf)); i = (i + 1) % k) {
+	.loc 1 523 64 is_stmt 0 discriminator 2 view .LVU501
+	leal	1(%rbx), %eax	#, _6
+# qtest.c:523:     for (int i = 0; q_remove_head(q, buf, sizeof(buf)); i = (i + 1) % k) {
+	.loc 1 523 59 discriminator 2 view .LVU502
+	cltd
+	idivl	%ebp	# k
+	movl	%edx, %ebx	# i, i
+.LVL239:
+.L168:
+	.loc 1 523 21 is_stmt 1 discriminator 1 view .LVU503
+	movl	$10, %edx	#,
+	movq	%r12, %rsi	# tmp98,
+	movq	%r13, %rdi	# q,
+	call	q_remove_head@PLT	#
+.LVL240:
+	testb	%al, %al	# tmp104
+	je	.L172	#,
+	.loc 1 524 9 view .LVU504
+# qtest.c:524:         if (!q_insert_tail(qs[i], buf))
+	.loc 1 524 30 is_stmt 0 view .LVU505
+	movslq	%ebx, %rax	# i, i
+# qtest.c:524:         if (!q_insert_tail(qs[i], buf))
+	.loc 1 524 14 view .LVU506
+	movq	(%r14,%rax,8), %rdi	# *_3, *_3
+	movq	%r12, %rsi	# tmp98,
+	call	q_insert_tail@PLT	#
+.LVL241:
+# qtest.c:524:         if (!q_insert_tail(qs[i], buf))
+	.loc 1 524 12 view .LVU507
+	testb	%al, %al	# <retval>
+	jne	.L173	#,
+	jmp	.L167	#
+.L172:
+	.loc 1 524 12 view .LVU508
+.LBE65:
+# qtest.c:527:     return true;
+	.loc 1 527 12 view .LVU509
+	movl	$1, %eax	#, <retval>
+.L167:
+# qtest.c:528: }
+	.loc 1 528 1 view .LVU510
+	addq	$16, %rsp	#,
+	.cfi_def_cfa_offset 48
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+.LVL242:
+	.loc 1 528 1 view .LVU511
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+.LVL243:
+	.loc 1 528 1 view .LVU512
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL244:
+	.loc 1 528 1 view .LVU513
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+.LVL245:
+	.loc 1 528 1 view .LVU514
+	ret	
+	.cfi_endproc
+.LFE41:
+	.size	merge_deal, .-merge_deal
+	.type	cplx_size, @function
+cplx_size:
+.LVL246:
+.LFB57:
+	.loc 1 1169 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1170 5 view .LVU516
+.LBB66:
+	.loc 1 1170 10 view .LVU517
+	.loc 1 1170 23 view .LVU518
+	testl	%esi, %esi	# reps
+	jle	.L179	#,
+.LBE66:
+# qtest.c:1169: {
+	.loc 1 1169 1 is_stmt 0 view .LVU519
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %r12	# tmp85, q
+	movl	%esi, %ebp	# tmp86, reps
+.LBB67:
+# qtest.c:1170:     for (int i = 0; i < reps; i++)
+	.loc 1 1170 14 view .LVU520
+	movl	$0, %ebx	#, i
+.LVL247:
+.L176:
+	.loc 1 1171 9 is_stmt 1 discriminator 3 view .LVU521
+	movq	%r12, %rdi	# q,
+	call	q_size@PLT	#
+.LVL248:
+	.loc 1 1170 32 discriminator 3 view .LVU522
+	addl	$1, %ebx	#, i
+.LVL249:
+	.loc 1 1170 23 discriminator 3 view .LVU523
+	cmpl	%ebx, %ebp	# i, reps
+	jne	.L176	#,
+.LBE67:
+# qtest.c:1172: }
+	.loc 1 1172 1 is_stmt 0 view .LVU524
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LVL250:
+	.loc 1 1172 1 view .LVU525
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL251:
+	.loc 1 1172 1 view .LVU526
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL252:
+	.loc 1 1172 1 view .LVU527
+	ret	
+.LVL253:
+.L179:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.loc 1 1172 1 view .LVU528
+	ret	
+	.cfi_endproc
+.LFE57:
+	.size	cplx_size, .-cplx_size
+	.section	.rodata.str1.1
+.LC38:
+	.string	"reset"
+	.section	.rodata.str1.8
+	.align 8
+.LC39:
+	.string	"%s takes no arguments, or 'reset'"
+	.section	.rodata.str1.1
+.LC40:
+	.string	"p90"
+.LC41:
+	.string	"p50"
+.LC42:
+	.string	"Calls"
+.LC43:
+	.string	"Cycles"
+	.section	.rodata.str1.8
+	.align 8
+.LC44:
+	.string	"%-12s %10s %8s %8s %8s %8s %10s"
+	.section	.rodata.str1.1
+.LC45:
+	.string	"max"
+.LC46:
+	.string	"p99.9"
+.LC47:
+	.string	"p99"
+	.section	.rodata.str1.8
+	.align 8
+.LC52:
+	.string	"%-12s %10lu %8lu %8lu %8lu %8lu %10lu"
+	.text
+	.type	do_latency, @function
+do_latency:
+.LVL254:
+.LFB56:
+	.loc 1 1127 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1127 1 is_stmt 0 view .LVU530
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 80
+	movq	%rsi, %rbx	# tmp129, argv
+	.loc 1 1128 5 is_stmt 1 view .LVU531
+# qtest.c:1128:     if (argc == 2 && !strcmp(argv[1], "reset")) {
+	.loc 1 1128 8 is_stmt 0 view .LVU532
+	cmpl	$2, %edi	#, argc
+	je	.L191	#,
+	.loc 1 1133 5 is_stmt 1 view .LVU533
+# qtest.c:1133:     if (argc != 1) {
+	.loc 1 1133 8 is_stmt 0 view .LVU534
+	cmpl	$1, %edi	#, argc
+	jne	.L184	#,
+	.loc 1 1138 5 is_stmt 1 view .LVU535
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 88
+	leaq	.LC45(%rip), %rax	#, tmp136
+	pushq	%rax	# tmp136
+	.cfi_def_cfa_offset 96
+	leaq	.LC46(%rip), %rax	#, tmp137
+	pushq	%rax	# tmp137
+	.cfi_def_cfa_offset 104
+	leaq	.LC47(%rip), %rax	#, tmp138
+	pushq	%rax	# tmp138
+	.cfi_def_cfa_offset 112
+	leaq	.LC40(%rip), %r9	#,
+	leaq	.LC41(%rip), %r8	#,
+	leaq	.LC42(%rip), %rcx	#, tmp113
+	leaq	.LC43(%rip), %rdx	#, tmp114
+	leaq	.LC44(%rip), %rsi	#, tmp115
+.LVL255:
+	.loc 1 1138 5 is_stmt 0 view .LVU536
+	movl	$1, %edi	#,
+.LVL256:
+	.loc 1 1138 5 view .LVU537
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL257:
+	.loc 1 1140 5 is_stmt 1 view .LVU538
+.LBB68:
+	.loc 1 1140 10 view .LVU539
+	.loc 1 1140 23 view .LVU540
+	leaq	latency(%rip), %rbx	#, ivtmp.388
+.LVL258:
+	.loc 1 1140 23 is_stmt 0 view .LVU541
+	leaq	lat_names(%rip), %rbp	#, ivtmp.389
+	leaq	46128(%rbx), %r14	#, _63
+	addq	$32, %rsp	#,
+	.cfi_def_cfa_offset 80
+	jmp	.L188	#
+.LVL259:
+.L191:
+	.loc 1 1140 23 view .LVU542
+.LBE68:
+# qtest.c:1128:     if (argc == 2 && !strcmp(argv[1], "reset")) {
+	.loc 1 1128 23 discriminator 1 view .LVU543
+	movq	8(%rsi), %rdi	# MEM[(char * *)argv_21(D) + 8B], MEM[(char * *)argv_21(D) + 8B]
+.LVL260:
+	.loc 1 1128 23 discriminator 1 view .LVU544
+	leaq	.LC38(%rip), %rsi	#, tmp104
+	call	strcmp@PLT	#
+.LVL261:
+# qtest.c:1128:     if (argc == 2 && !strcmp(argv[1], "reset")) {
+	.loc 1 1128 19 discriminator 1 view .LVU545
+	testl	%eax, %eax	# tmp130
+	je	.L192	#,
+.L184:
+	.loc 1 1134 9 is_stmt 1 view .LVU546
+	movq	(%rbx), %rdx	# *argv_21(D), *argv_21(D)
+	leaq	.LC39(%rip), %rsi	#, tmp109
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL262:
+	.loc 1 1135 9 view .LVU547
+# qtest.c:1135:         return false;
+	.loc 1 1135 16 is_stmt 0 view .LVU548
+	movl	$0, %eax	#, <retval>
+.LVL263:
+.L182:
+# qtest.c:1149: }
+	.loc 1 1149 1 view .LVU549
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL264:
+.L192:
+	.cfi_restore_state
+.LBB70:
+	.loc 1 1130 13 is_stmt 1 view .LVU550
+	leaq	latency(%rip), %rdi	#, tmp105
+	call	hist_init@PLT	#
+.LVL265:
+	.loc 1 1129 41 view .LVU551
+	.loc 1 1129 27 view .LVU552
+	.loc 1 1130 13 view .LVU553
+	leaq	15376+latency(%rip), %rdi	#, tmp106
+	call	hist_init@PLT	#
+.LVL266:
+	.loc 1 1129 41 view .LVU554
+	.loc 1 1129 27 view .LVU555
+	.loc 1 1130 13 view .LVU556
+	leaq	30752+latency(%rip), %rdi	#, tmp107
+	call	hist_init@PLT	#
+.LVL267:
+	.loc 1 1129 41 view .LVU557
+	.loc 1 1129 27 view .LVU558
+.LBE70:
+# qtest.c:1131:         return true;
+	.loc 1 1131 16 is_stmt 0 view .LVU559
+	movl	$1, %eax	#, <retval>
+.LBB71:
+	jmp	.L182	#
+.LVL268:
+.L187:
+	.loc 1 1131 16 view .LVU560
+.LBE71:
+.LBB72:
+	.loc 1 1140 37 is_stmt 1 discriminator 2 view .LVU561
+	.loc 1 1140 23 discriminator 2 view .LVU562
+	addq	$15376, %rbx	#, ivtmp.388
+.LVL269:
+	.loc 1 1140 23 is_stmt 0 discriminator 2 view .LVU563
+	addq	$8, %rbp	#, ivtmp.389
+	cmpq	%r14, %rbx	# _63, ivtmp.388
+	je	.L193	#,
+.LVL270:
+.L188:
+.LBB69:
+	.loc 1 1141 9 is_stmt 1 view .LVU564
+	.loc 1 1142 9 view .LVU565
+# qtest.c:1142:         if (!h->count)
+	.loc 1 1142 12 is_stmt 0 view .LVU566
+	cmpq	$0, (%rbx)	#, MEM <uint64_t> [(struct histogram_t *)_60]
+	je	.L187	#,
+	.loc 1 1144 9 is_stmt 1 view .LVU567
+	movq	8(%rbx), %r15	# MEM <uint64_t> [(struct histogram_t *)_60 + 8B], _6
+	movsd	.LC48(%rip), %xmm0	#,
+	movq	%rbx, %rdi	# ivtmp.388,
+	call	hist_percentile@PLT	#
+.LVL271:
+	movq	%rax, %r13	# tmp131, _7
+	movsd	.LC49(%rip), %xmm0	#,
+	movq	%rbx, %rdi	# ivtmp.388,
+	call	hist_percentile@PLT	#
+.LVL272:
+	movq	%rax, %r12	# tmp132, _8
+	movsd	.LC50(%rip), %xmm0	#,
+	movq	%rbx, %rdi	# ivtmp.388,
+	call	hist_percentile@PLT	#
+.LVL273:
+	movq	%rax, 8(%rsp)	# tmp133, %sfp
+	movsd	.LC51(%rip), %xmm0	#,
+	movq	%rbx, %rdi	# ivtmp.388,
+	call	hist_percentile@PLT	#
+.LVL274:
+	movq	%rax, %r8	#, tmp134
+	movq	(%rbx), %rcx	# MEM <uint64_t> [(struct histogram_t *)_60], MEM <uint64_t> [(struct histogram_t *)_60]
+	movq	0(%rbp), %rdx	# MEM[(const char * *)_64], MEM[(const char * *)_64]
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 88
+	pushq	%r15	# _6
+	.cfi_def_cfa_offset 96
+	pushq	%r13	# _7
+	.cfi_def_cfa_offset 104
+	pushq	%r12	# _8
+	.cfi_def_cfa_offset 112
+	movq	40(%rsp), %r9	# %sfp,
+	leaq	.LC52(%rip), %rsi	#, tmp122
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL275:
+	addq	$32, %rsp	#,
+	.cfi_def_cfa_offset 80
+	jmp	.L187	#
+.LVL276:
+.L193:
+	.loc 1 1144 9 is_stmt 0 view .LVU568
+.LBE69:
+.LBE72:
+# qtest.c:1148:     return true;
+	.loc 1 1148 12 view .LVU569
+	movl	$1, %eax	#, <retval>
+	jmp	.L182	#
+	.cfi_endproc
+.LFE56:
+	.size	do_latency, .-do_latency
+	.section	.rodata.str1.8
+	.align 8
+.LC53:
+	.string	"Invalid allocation number '%s'"
+	.align 8
+.LC54:
+	.string	"Too many allocation numbers given"
+	.text
+	.type	do_failat, @function
+do_failat:
+.LVL277:
+.LFB54:
+	.loc 1 1097 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1097 1 is_stmt 0 view .LVU571
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$40, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movl	%edi, %r15d	# tmp132, argc
+	.loc 1 1098 5 is_stmt 1 view .LVU572
+.LVL278:
+# qtest.c:1098:     size_t list[argc];
+	.loc 1 1098 12 is_stmt 0 view .LVU573
+	movslq	%edi, %rax	# argc, argc
+.LVL279:
+	.loc 1 1098 12 view .LVU574
+	leaq	15(,%rax,8), %rax	#, tmp109
+.LVL280:
+	.loc 1 1098 12 view .LVU575
+	andq	$-16, %rax	#, tmp113
+	subq	%rax, %rsp	# tmp113,
+	movq	%rsp, %r12	#, tmp117
+	movq	%r12, -80(%rbp)	# tmp117, %sfp
+.LVL281:
+	.loc 1 1099 5 is_stmt 1 view .LVU576
+.LBB73:
+	.loc 1 1099 10 view .LVU577
+	.loc 1 1099 23 view .LVU578
+	cmpl	$1, %edi	#, argc
+	jle	.L195	#,
+	leaq	8(%rsi), %rbx	#, ivtmp.398
+	leal	-2(%rdi), %eax	#, tmp119
+	leaq	16(%rsi,%rax,8), %r14	#, _53
+.LBB74:
+# qtest.c:1101:         if (!get_int(argv[i], &n) || n <= 0) {
+	.loc 1 1101 14 is_stmt 0 view .LVU579
+	leaq	-52(%rbp), %r13	#, tmp122
+.LVL282:
+.L199:
+	.loc 1 1100 9 is_stmt 1 view .LVU580
+	.loc 1 1101 9 view .LVU581
+# qtest.c:1101:         if (!get_int(argv[i], &n) || n <= 0) {
+	.loc 1 1101 26 is_stmt 0 view .LVU582
+	movq	%rbx, -72(%rbp)	# ivtmp.398, %sfp
+# qtest.c:1101:         if (!get_int(argv[i], &n) || n <= 0) {
+	.loc 1 1101 14 view .LVU583
+	movq	(%rbx), %rdi	# MEM[(char * *)_5], MEM[(char * *)_5]
+	movq	%r13, %rsi	# tmp122,
+	call	get_int@PLT	#
+.LVL283:
+# qtest.c:1101:         if (!get_int(argv[i], &n) || n <= 0) {
+	.loc 1 1101 12 view .LVU584
+	testb	%al, %al	# tmp134
+	je	.L196	#,
+# qtest.c:1101:         if (!get_int(argv[i], &n) || n <= 0) {
+	.loc 1 1101 40 discriminator 1 view .LVU585
+	movl	-52(%rbp), %eax	# n, n.52_8
+# qtest.c:1101:         if (!get_int(argv[i], &n) || n <= 0) {
+	.loc 1 1101 35 discriminator 1 view .LVU586
+	testl	%eax, %eax	# n.52_8
+	jle	.L196	#,
+	.loc 1 1105 9 is_stmt 1 view .LVU587
+# qtest.c:1105:         list[i - 1] = n;
+	.loc 1 1105 21 is_stmt 0 view .LVU588
+	cltq
+	movq	%rax, (%r12)	# n.52_8, MEM[(long unsigned int *)_46]
+.LBE74:
+	.loc 1 1099 32 is_stmt 1 view .LVU589
+.LVL284:
+	.loc 1 1099 23 view .LVU590
+	addq	$8, %rbx	#, ivtmp.398
+.LVL285:
+	.loc 1 1099 23 is_stmt 0 view .LVU591
+	addq	$8, %r12	#, ivtmp.400
+	cmpq	%r14, %rbx	# _53, ivtmp.398
+	jne	.L199	#,
+.LVL286:
+.L195:
+	.loc 1 1099 23 view .LVU592
+.LBE73:
+	.loc 1 1108 5 is_stmt 1 view .LVU593
+# qtest.c:1108:     if (!set_fail_list(list, argc - 1)) {
+	.loc 1 1108 10 is_stmt 0 view .LVU594
+	leal	-1(%r15), %esi	#, tmp127
+	movq	-80(%rbp), %rdi	# %sfp,
+	call	set_fail_list@PLT	#
+.LVL287:
+	movl	%eax, %ebx	# tmp135, <retval>
+# qtest.c:1108:     if (!set_fail_list(list, argc - 1)) {
+	.loc 1 1108 8 view .LVU595
+	testb	%al, %al	# <retval>
+	jne	.L194	#,
+	.loc 1 1109 9 is_stmt 1 view .LVU596
+	leaq	.LC54(%rip), %rsi	#, tmp128
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL288:
+	.loc 1 1110 9 view .LVU597
+# qtest.c:1110:         return false;
+	.loc 1 1110 16 is_stmt 0 view .LVU598
+	jmp	.L194	#
+.LVL289:
+.L196:
+.LBB76:
+.LBB75:
+	.loc 1 1102 13 is_stmt 1 view .LVU599
+	movq	-72(%rbp), %rax	# %sfp, _5
+	movq	(%rax), %rdx	# *_5, *_5
+	leaq	.LC53(%rip), %rsi	#, tmp125
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL290:
+	.loc 1 1103 13 view .LVU600
+# qtest.c:1103:             return false;
+	.loc 1 1103 20 is_stmt 0 view .LVU601
+	movl	$0, %ebx	#, <retval>
+.LVL291:
+.L194:
+	.loc 1 1103 20 view .LVU602
+.LBE75:
+.LBE76:
+# qtest.c:1113: }
+	.loc 1 1113 1 view .LVU603
+	movl	%ebx, %eax	# <retval>,
+	leaq	-40(%rbp), %rsp	#,
+.LVL292:
+	.loc 1 1113 1 view .LVU604
+	popq	%rbx	#
+	popq	%r12	#
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+.LVL293:
+	.loc 1 1113 1 view .LVU605
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+.LVL294:
+	.loc 1 1113 1 view .LVU606
+	ret	
+	.cfi_endproc
+.LFE54:
+	.size	do_failat, .-do_failat
+	.section	.rodata.str1.1
+.LC55:
+	.string	"%s"
+.LC56:
+	.string	" %s"
+.LC57:
+	.string	"%s = NULL"
+.LC58:
+	.string	"%s = ["
+.LC59:
+	.string	" ... ]"
+.LC60:
+	.string	"]"
+	.section	.rodata.str1.8
+	.align 8
+.LC61:
+	.string	"ERROR:  Either list has cycle, or queue has more than %d elements"
+	.text
+	.type	show_queue, @function
+show_queue:
+.LVL295:
+.LFB52:
+	.loc 1 1040 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1040 1 is_stmt 0 view .LVU608
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 80
+	.loc 1 1041 5 is_stmt 1 view .LVU609
+.LVL296:
+	.loc 1 1042 5 view .LVU610
+# qtest.c:1043:         return true;
+	.loc 1 1043 16 is_stmt 0 view .LVU611
+	movl	$1, %ebp	#, <retval>
+# qtest.c:1042:     if (verblevel < vlevel)
+	.loc 1 1042 8 view .LVU612
+	cmpl	%edi, verblevel(%rip)	# vlevel, verblevel
+	jl	.L202	#,
+	movl	%edi, %r13d	# tmp125, vlevel
+	.loc 1 1045 5 is_stmt 1 view .LVU613
+.LVL297:
+	.loc 1 1046 5 view .LVU614
+# qtest.c:1046:     char *name = queues[current].name;
+	.loc 1 1046 11 is_stmt 0 view .LVU615
+	movslq	current(%rip), %rdx	# current, current
+	salq	$5, %rdx	#, tmp107
+	leaq	queues(%rip), %rax	#, tmp108
+	addq	%rax, %rdx	# tmp108, name
+.LVL298:
+	.loc 1 1047 5 is_stmt 1 view .LVU616
+# qtest.c:1047:     if (!q) {
+	.loc 1 1047 8 is_stmt 0 view .LVU617
+	cmpq	$0, q(%rip)	#, q
+	je	.L225	#,
+	.loc 1 1052 5 is_stmt 1 view .LVU618
+	leaq	.LC58(%rip), %rsi	#, tmp110
+	movl	$0, %eax	#,
+	call	report_noreturn@PLT	#
+.LVL299:
+	.loc 1 1053 5 view .LVU619
+# qtest.c:1053:     list_ele_t *e = q->head;
+	.loc 1 1053 17 is_stmt 0 view .LVU620
+	movq	q(%rip), %rax	# q, q
+	movq	(%rax), %r12	# q.58_4->head, e
+.LVL300:
+	.loc 1 1054 5 is_stmt 1 view .LVU621
+# qtest.c:1054:     if (exception_setup(true)) {
+	.loc 1 1054 9 is_stmt 0 view .LVU622
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL301:
+	movb	%al, 15(%rsp)	# _5, %sfp
+# qtest.c:1054:     if (exception_setup(true)) {
+	.loc 1 1054 8 view .LVU623
+	testb	%al, %al	# _5
+	je	.L205	#,
+	.loc 1 1055 24 is_stmt 1 view .LVU624
+	movl	$0, %ebx	#, ivtmp.407
+# qtest.c:1057:                 report_noreturn(vlevel, cnt == 0 ? "%s" : " %s", e->value);
+	.loc 1 1057 17 is_stmt 0 view .LVU625
+	leaq	.LC56(%rip), %r15	#, tmp123
+	leaq	.LC55(%rip), %r14	#, tmp124
+# qtest.c:1055:         while (ok && e && cnt < qcnt) {
+	.loc 1 1055 24 view .LVU626
+	testq	%r12, %r12	# e
+	jne	.L206	#,
+.LVL302:
+	.loc 1 1063 5 is_stmt 1 view .LVU627
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL303:
+	.loc 1 1065 5 view .LVU628
+	.loc 1 1070 5 view .LVU629
+	.loc 1 1071 9 view .LVU630
+.L216:
+	.loc 1 1072 13 view .LVU631
+	leaq	.LC60(%rip), %rsi	#, tmp115
+	movl	%r13d, %edi	# vlevel,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL304:
+	movl	$1, %ebp	#, <retval>
+	jmp	.L202	#
+.LVL305:
+.L225:
+	.loc 1 1048 9 view .LVU632
+	leaq	.LC57(%rip), %rsi	#, tmp109
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL306:
+	.loc 1 1049 9 view .LVU633
+# qtest.c:1049:         return true;
+	.loc 1 1049 16 is_stmt 0 view .LVU634
+	jmp	.L202	#
+.LVL307:
+.L208:
+	.loc 1 1058 13 is_stmt 1 view .LVU635
+# qtest.c:1058:             e = e->next;
+	.loc 1 1058 15 is_stmt 0 view .LVU636
+	movq	8(%r12), %r12	# e_55->next, e
+.LVL308:
+	.loc 1 1059 13 is_stmt 1 view .LVU637
+	.loc 1 1060 13 view .LVU638
+# qtest.c:1060:             ok = ok && !error_check();
+	.loc 1 1060 25 is_stmt 0 view .LVU639
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL309:
+# qtest.c:1060:             ok = ok && !error_check();
+	.loc 1 1060 21 view .LVU640
+	xorl	$1, %eax	#, tmp127
+	movl	%eax, %ebp	# tmp127, <retval>
+.LVL310:
+	.loc 1 1055 24 is_stmt 1 view .LVU641
+	addq	$1, %rbx	#, ivtmp.407
+	testq	%r12, %r12	# e
+	je	.L210	#,
+	testb	%al, %al	# <retval>
+	je	.L210	#,
+.LVL311:
+.L206:
+	.loc 1 1055 24 is_stmt 0 view .LVU642
+	movl	%ebx, 8(%rsp)	# ivtmp.407, %sfp
+.LVL312:
+# qtest.c:1055:         while (ok && e && cnt < qcnt) {
+	.loc 1 1055 24 discriminator 1 view .LVU643
+	cmpq	qcnt(%rip), %rbx	# qcnt, ivtmp.407
+	jnb	.L226	#,
+	.loc 1 1056 13 is_stmt 1 view .LVU644
+# qtest.c:1056:             if (cnt < big_queue_size)
+	.loc 1 1056 16 is_stmt 0 view .LVU645
+	cmpl	$29, %ebx	#, ivtmp.407
+	jg	.L208	#,
+	.loc 1 1057 17 is_stmt 1 view .LVU646
+	movq	(%r12), %rdx	# e_55->value, _7
+	testl	%ebx, %ebx	# ivtmp.407
+	movq	%r14, %rsi	# tmp124, iftmp.60_22
+	cmovne	%r15, %rsi	# tmp123,, iftmp.60_22
+	movl	%r13d, %edi	# vlevel,
+	movl	$0, %eax	#,
+	call	report_noreturn@PLT	#
+.LVL313:
+	jmp	.L208	#
+.LVL314:
+.L210:
+	.loc 1 1063 5 view .LVU647
+	movl	$0, %eax	#,
+.LVL315:
+	.loc 1 1063 5 is_stmt 0 view .LVU648
+	call	exception_cancel@PLT	#
+.LVL316:
+	.loc 1 1065 5 is_stmt 1 view .LVU649
+# qtest.c:1065:     if (!ok) {
+	.loc 1 1065 8 is_stmt 0 view .LVU650
+	testb	%bpl, %bpl	# <retval>
+	jne	.L213	#,
+	.loc 1 1066 9 is_stmt 1 view .LVU651
+	leaq	.LC59(%rip), %rsi	#, tmp114
+	movl	%r13d, %edi	# vlevel,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL317:
+	.loc 1 1067 9 view .LVU652
+# qtest.c:1067:         return false;
+	.loc 1 1067 16 is_stmt 0 view .LVU653
+	jmp	.L202	#
+.L213:
+# qtest.c:1059:             cnt++;
+	.loc 1 1059 16 view .LVU654
+	movl	8(%rsp), %ebx	# %sfp, _64
+	addl	$1, %ebx	#, _64
+	jmp	.L217	#
+.LVL318:
+.L205:
+	.loc 1 1063 5 is_stmt 1 view .LVU655
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL319:
+	.loc 1 1065 5 view .LVU656
+	.loc 1 1070 5 view .LVU657
+# qtest.c:1070:     if (!e) {
+	.loc 1 1070 8 is_stmt 0 view .LVU658
+	testq	%r12, %r12	# e
+	je	.L216	#,
+.LVL320:
+.L214:
+	.loc 1 1076 9 is_stmt 1 view .LVU659
+	leaq	.LC59(%rip), %rsi	#, tmp117
+	movl	%r13d, %edi	# vlevel,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL321:
+	.loc 1 1077 9 view .LVU660
+	movq	qcnt(%rip), %rdx	# qcnt,
+	leaq	.LC61(%rip), %rsi	#, tmp119
+	movl	%r13d, %edi	# vlevel,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL322:
+	.loc 1 1081 9 view .LVU661
+# qtest.c:1081:         ok = false;
+	.loc 1 1081 12 is_stmt 0 view .LVU662
+	movl	$0, %ebp	#, <retval>
+.LVL323:
+.L202:
+# qtest.c:1085: }
+	.loc 1 1085 1 view .LVU663
+	movl	%ebp, %eax	# <retval>,
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL324:
+.L226:
+	.cfi_restore_state
+	.loc 1 1063 5 is_stmt 1 view .LVU664
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL325:
+	.loc 1 1065 5 view .LVU665
+.L217:
+	.loc 1 1070 5 view .LVU666
+# qtest.c:1070:     if (!e) {
+	.loc 1 1070 8 is_stmt 0 view .LVU667
+	testq	%r12, %r12	# e
+	jne	.L214	#,
+	.loc 1 1071 9 is_stmt 1 view .LVU668
+# qtest.c:1071:         if (cnt <= big_queue_size)
+	.loc 1 1071 12 is_stmt 0 view .LVU669
+	cmpl	$30, %ebx	#, cnt
+	jle	.L216	#,
+	.loc 1 1074 13 is_stmt 1 view .LVU670
+	leaq	.LC59(%rip), %rsi	#, tmp116
+	movl	%r13d, %edi	# vlevel,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL326:
+	movzbl	15(%rsp), %ebp	# %sfp, <retval>
+	jmp	.L202	#
+	.cfi_endproc
+.LFE52:
+	.size	show_queue, .-show_queue
+	.type	do_show, @function
+do_show:
+.LVL327:
+.LFB53:
+	.loc 1 1088 1 view -0
+	.cfi_startproc
+	.loc 1 1088 1 is_stmt 0 view .LVU672
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 1089 5 is_stmt 1 view .LVU673
+# qtest.c:1089:     if (argc != 1) {
+	.loc 1 1089 8 is_stmt 0 view .LVU674
+	cmpl	$1, %edi	#, tmp89
+	je	.L228	#,
+	.loc 1 1090 9 is_stmt 1 view .LVU675
+	movq	(%rsi), %rdx	# *argv_8(D), *argv_8(D)
+	leaq	.LC0(%rip), %rsi	#, tmp87
+.LVL328:
+	.loc 1 1090 9 is_stmt 0 view .LVU676
+	movl	$1, %edi	#,
+.LVL329:
+	.loc 1 1090 9 view .LVU677
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL330:
+	.loc 1 1091 9 is_stmt 1 view .LVU678
+# qtest.c:1091:         return false;
+	.loc 1 1091 16 is_stmt 0 view .LVU679
+	movl	$0, %eax	#, <retval>
+.L227:
+# qtest.c:1094: }
+	.loc 1 1094 1 view .LVU680
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL331:
+.L228:
+	.cfi_restore_state
+	.loc 1 1093 5 is_stmt 1 view .LVU681
+# qtest.c:1093:     return show_queue(0);
+	.loc 1 1093 12 is_stmt 0 view .LVU682
+	movl	$0, %edi	#,
+.LVL332:
+	.loc 1 1093 12 view .LVU683
+	call	show_queue	#
+.LVL333:
+	.loc 1 1093 12 view .LVU684
+	jmp	.L227	#
+	.cfi_endproc
+.LFE53:
+	.size	do_show, .-do_show
+	.section	.rodata.str1.1
+.LC62:
+	.string	"linear"
+.LC63:
+	.string	"constant"
+	.section	.rodata.str1.8
+	.align 8
+.LC64:
+	.string	"%s does not need arguments in simulation mode"
+	.section	.rodata.str1.1
+.LC65:
+	.string	"t"
+.LC66:
+	.string	"t_test"
+.LC67:
+	.string	"measurements"
+.LC69:
+	.string	"samples_per_sec"
+.LC70:
+	.string	"ERROR: Probably not %s time"
+.LC71:
+	.string	"Probably %s time"
+	.text
+	.type	simulate, @function
+simulate:
+.LVL334:
+.LFB44:
+	.loc 1 632 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 632 1 is_stmt 0 view .LVU686
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$32, %rsp	#,
+	.cfi_def_cfa_offset 64
+	.loc 1 633 5 is_stmt 1 view .LVU687
+# qtest.c:633:     if (argc != 1) {
+	.loc 1 633 8 is_stmt 0 view .LVU688
+	cmpl	$1, %edi	#, tmp128
+	jne	.L241	#,
+	movl	%edx, %ebx	# tmp130, mode
+	.loc 1 637 5 is_stmt 1 view .LVU689
+# qtest.c:637:     char *complexity = dut_ops[mode].linear ? "linear" : "constant";
+	.loc 1 637 37 is_stmt 0 view .LVU690
+	movslq	%edx, %rax	# mode, mode
+	leaq	(%rax,%rax,2), %rax	#, tmp102
+	salq	$4, %rax	#, tmp103
+# qtest.c:637:     char *complexity = dut_ops[mode].linear ? "linear" : "constant";
+	.loc 1 637 56 view .LVU691
+	leaq	dut_ops(%rip), %rdx	#, tmp98
+.LVL335:
+	.loc 1 637 56 view .LVU692
+	cmpb	$0, 8(%rdx,%rax)	#, dut_ops[mode_10(D)].linear
+	leaq	.LC63(%rip), %rbp	#, tmp126
+	leaq	.LC62(%rip), %rax	#, tmp127
+	cmovne	%rax, %rbp	# tmp126,, tmp127, iftmp.75_6
+.LVL336:
+	.loc 1 638 5 is_stmt 1 view .LVU693
+	movl	$0, %eax	#,
+	call	report_flush@PLT	#
+.LVL337:
+	.loc 1 639 5 view .LVU694
+# qtest.c:639:     bool ok = check_op(mode);
+	.loc 1 639 15 is_stmt 0 view .LVU695
+	movl	%ebx, %edi	# mode,
+	call	check_op@PLT	#
+.LVL338:
+	movl	%eax, %ebx	# tmp131, <retval>
+.LVL339:
+	.loc 1 640 5 is_stmt 1 view .LVU696
+	movq	stdout(%rip), %rdi	# stdout,
+	call	fflush@PLT	#
+.LVL340:
+	.loc 1 641 5 view .LVU697
+.LBB79:
+.LBI79:
+	.loc 1 619 13 view .LVU698
+.LBB80:
+	.loc 1 621 5 view .LVU699
+# qtest.c:621:     const_result_t r = last_const_result();
+	.loc 1 621 24 is_stmt 0 view .LVU700
+	movq	%rsp, %rdi	#, tmp107
+	call	last_const_result@PLT	#
+.LVL341:
+	movq	24(%rsp), %r12	# r.rate, r$rate
+.LVL342:
+	.loc 1 622 5 is_stmt 1 view .LVU701
+.LBE80:
+.LBE79:
+# qtest.c:641:     record_const(ok);
+	.loc 1 641 5 is_stmt 0 view .LVU702
+	movzbl	%bl, %esi	# <retval>, <retval>
+.LBB83:
+.LBB81:
+# qtest.c:622:     metric_bool("constant", ok);
+	.loc 1 622 5 view .LVU703
+	leaq	.LC63(%rip), %rdi	#, tmp109
+	call	metric_bool@PLT	#
+.LVL343:
+	.loc 1 623 5 is_stmt 1 view .LVU704
+	movsd	8(%rsp), %xmm0	# r.max_t,
+	leaq	.LC65(%rip), %rdi	#, tmp111
+	call	metric_double@PLT	#
+.LVL344:
+	.loc 1 624 5 view .LVU705
+	movslq	(%rsp), %rsi	# r.test, r.test
+	leaq	.LC66(%rip), %rdi	#, tmp114
+	call	metric_int@PLT	#
+.LVL345:
+	.loc 1 625 5 view .LVU706
+	movsd	16(%rsp), %xmm0	# r.measurements,
+	leaq	.LC67(%rip), %rdi	#, tmp116
+	call	metric_double@PLT	#
+.LVL346:
+	.loc 1 626 5 view .LVU707
+# qtest.c:626:     if (r.rate > 0)
+	.loc 1 626 8 is_stmt 0 view .LVU708
+	pxor	%xmm0, %xmm0	# tmp117
+	movq	%r12, %xmm1	# r$rate, r$rate
+	comisd	%xmm0, %xmm1	# tmp117, r$rate
+	ja	.L242	#,
+.L235:
+.LVL347:
+	.loc 1 626 8 view .LVU709
+.LBE81:
+.LBE83:
+	.loc 1 642 5 is_stmt 1 view .LVU710
+# qtest.c:642:     if (!ok) {
+	.loc 1 642 8 is_stmt 0 view .LVU711
+	testb	%bl, %bl	# <retval>
+	je	.L243	#,
+	.loc 1 646 5 is_stmt 1 view .LVU712
+	movq	%rbp, %rdx	# iftmp.75_6,
+	leaq	.LC71(%rip), %rsi	#, tmp120
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL348:
+	.loc 1 647 5 view .LVU713
+.L231:
+# qtest.c:648: }
+	.loc 1 648 1 is_stmt 0 view .LVU714
+	movl	%ebx, %eax	# <retval>,
+	addq	$32, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL349:
+.L241:
+	.cfi_restore_state
+	.loc 1 634 9 is_stmt 1 view .LVU715
+	movq	(%rsi), %rdx	# *argv_18(D), *argv_18(D)
+.LVL350:
+	.loc 1 634 9 is_stmt 0 view .LVU716
+	leaq	.LC64(%rip), %rsi	#, tmp97
+.LVL351:
+	.loc 1 634 9 view .LVU717
+	movl	$1, %edi	#,
+.LVL352:
+	.loc 1 634 9 view .LVU718
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL353:
+	.loc 1 635 9 is_stmt 1 view .LVU719
+# qtest.c:635:         return false;
+	.loc 1 635 16 is_stmt 0 view .LVU720
+	movl	$0, %ebx	#, <retval>
+	jmp	.L231	#
+.LVL354:
+.L242:
+.LBB84:
+.LBB82:
+	.loc 1 627 9 is_stmt 1 view .LVU721
+	movq	%r12, %xmm0	# r$rate,
+	leaq	.LC69(%rip), %rdi	#, tmp118
+	call	metric_double@PLT	#
+.LVL355:
+	.loc 1 627 9 is_stmt 0 view .LVU722
+	jmp	.L235	#
+.LVL356:
+.L243:
+	.loc 1 627 9 view .LVU723
+.LBE82:
+.LBE84:
+	.loc 1 643 9 is_stmt 1 view .LVU724
+	movq	%rbp, %rdx	# iftmp.75_6,
+	leaq	.LC70(%rip), %rsi	#, tmp119
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL357:
+	.loc 1 644 9 view .LVU725
+# qtest.c:644:         return false;
+	.loc 1 644 16 is_stmt 0 view .LVU726
+	jmp	.L231	#
+	.cfi_endproc
+.LFE44:
+	.size	simulate, .-simulate
+	.section	.rodata.str1.8
+	.align 8
+.LC72:
+	.string	"Warning: Calling remove head on null queue"
+	.align 8
+.LC73:
+	.string	"Warning: Calling remove head on empty queue"
+	.section	.rodata.str1.1
+.LC74:
+	.string	"Removed element from queue"
+.LC75:
+	.string	"Removal failed"
+	.section	.rodata.str1.8
+	.align 8
+.LC76:
+	.string	"ERROR: Removal failed (%d failures total)"
+	.text
+	.type	do_remove_head_quiet, @function
+do_remove_head_quiet:
+.LVL358:
+.LFB48:
+	.loc 1 884 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 884 1 is_stmt 0 view .LVU728
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 885 5 is_stmt 1 view .LVU729
+# qtest.c:885:     if (simulation)
+	.loc 1 885 9 is_stmt 0 view .LVU730
+	movzbl	simulation(%rip), %ebx	# simulation, <retval>
+# qtest.c:885:     if (simulation)
+	.loc 1 885 8 view .LVU731
+	testb	%bl, %bl	# <retval>
+	jne	.L256	#,
+	.loc 1 888 5 is_stmt 1 view .LVU732
+# qtest.c:888:     if (argc != 1) {
+	.loc 1 888 8 is_stmt 0 view .LVU733
+	cmpl	$1, %edi	#, argc
+	jne	.L257	#,
+	.loc 1 893 5 is_stmt 1 view .LVU734
+.LVL359:
+	.loc 1 894 5 view .LVU735
+# qtest.c:894:     if (!q)
+	.loc 1 894 9 is_stmt 0 view .LVU736
+	movq	q(%rip), %rax	# q, q.88_3
+# qtest.c:894:     if (!q)
+	.loc 1 894 8 view .LVU737
+	testq	%rax, %rax	# q.88_3
+	je	.L258	#,
+	.loc 1 896 10 is_stmt 1 view .LVU738
+# qtest.c:896:     else if (!q->head)
+	.loc 1 896 13 is_stmt 0 view .LVU739
+	cmpq	$0, (%rax)	#, q.88_3->head
+	je	.L259	#,
+.LVL360:
+.L249:
+	.loc 1 898 5 is_stmt 1 view .LVU740
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL361:
+	.loc 1 900 5 view .LVU741
+	.loc 1 901 5 view .LVU742
+# qtest.c:901:     if (exception_setup(true))
+	.loc 1 901 9 is_stmt 0 view .LVU743
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL362:
+# qtest.c:901:     if (exception_setup(true))
+	.loc 1 901 8 view .LVU744
+	testb	%al, %al	# tmp113
+	jne	.L250	#,
+	.loc 1 903 5 is_stmt 1 view .LVU745
+	call	exception_cancel@PLT	#
+.LVL363:
+	.loc 1 905 5 view .LVU746
+.L251:
+	.loc 1 909 9 view .LVU747
+# qtest.c:909:         fail_count++;
+	.loc 1 909 19 is_stmt 0 view .LVU748
+	movl	fail_count(%rip), %eax	# fail_count, tmp117
+	leal	1(%rax), %edx	#, _10
+	movl	%edx, fail_count(%rip)	# _10, fail_count
+	.loc 1 910 9 is_stmt 1 view .LVU749
+# qtest.c:910:         if (fail_count < fail_limit)
+	.loc 1 910 12 is_stmt 0 view .LVU750
+	cmpl	fail_limit(%rip), %edx	# fail_limit, _10
+	jge	.L253	#,
+	.loc 1 911 13 is_stmt 1 view .LVU751
+	leaq	.LC75(%rip), %rsi	#, tmp106
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL364:
+.L252:
+	.loc 1 918 5 view .LVU752
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL365:
+	.loc 1 919 5 view .LVU753
+# qtest.c:919:     return ok && !error_check();
+	.loc 1 919 19 is_stmt 0 view .LVU754
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL366:
+# qtest.c:919:     return ok && !error_check();
+	.loc 1 919 15 view .LVU755
+	xorl	$1, %eax	#, tmp115
+	movzbl	%al, %ebx	# tmp109, iftmp.96_15
+	jmp	.L254	#
+.LVL367:
+.L256:
+	.loc 1 886 9 is_stmt 1 view .LVU756
+# qtest.c:886:         return simulate(argc, argv, test_remove_head_quiet);
+	.loc 1 886 16 is_stmt 0 view .LVU757
+	movl	$4, %edx	#,
+	call	simulate	#
+.LVL368:
+	.loc 1 886 16 view .LVU758
+	movl	%eax, %ebx	# tmp112, <retval>
+	jmp	.L244	#
+.LVL369:
+.L257:
+	.loc 1 889 9 is_stmt 1 view .LVU759
+	movq	(%rsi), %rdx	# *argv_39(D), *argv_39(D)
+	leaq	.LC0(%rip), %rsi	#, tmp100
+.LVL370:
+	.loc 1 889 9 is_stmt 0 view .LVU760
+	movl	$1, %edi	#,
+.LVL371:
+	.loc 1 889 9 view .LVU761
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL372:
+	.loc 1 890 9 is_stmt 1 view .LVU762
+# qtest.c:890:         return false;
+	.loc 1 890 16 is_stmt 0 view .LVU763
+	jmp	.L244	#
+.LVL373:
+.L258:
+	.loc 1 895 9 is_stmt 1 view .LVU764
+	leaq	.LC72(%rip), %rsi	#, tmp101
+.LVL374:
+	.loc 1 895 9 is_stmt 0 view .LVU765
+	movl	$3, %edi	#,
+.LVL375:
+	.loc 1 895 9 view .LVU766
+	call	report@PLT	#
+.LVL376:
+	jmp	.L249	#
+.LVL377:
+.L259:
+	.loc 1 897 9 is_stmt 1 view .LVU767
+	leaq	.LC73(%rip), %rsi	#, tmp102
+.LVL378:
+	.loc 1 897 9 is_stmt 0 view .LVU768
+	movl	$3, %edi	#,
+.LVL379:
+	.loc 1 897 9 view .LVU769
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL380:
+	jmp	.L249	#
+.LVL381:
+.L250:
+	.loc 1 902 9 is_stmt 1 view .LVU770
+# qtest.c:902:         rval = q_remove_head(q, NULL, 0);
+	.loc 1 902 16 is_stmt 0 view .LVU771
+	movl	$0, %edx	#,
+	movl	$0, %esi	#,
+	movq	q(%rip), %rdi	# q,
+	call	q_remove_head@PLT	#
+.LVL382:
+	movl	%eax, %ebx	# tmp114, rval
+.LVL383:
+	.loc 1 903 5 is_stmt 1 view .LVU772
+	movl	$0, %eax	#,
+.LVL384:
+	.loc 1 903 5 is_stmt 0 view .LVU773
+	call	exception_cancel@PLT	#
+.LVL385:
+	.loc 1 905 5 is_stmt 1 view .LVU774
+# qtest.c:905:     if (rval) {
+	.loc 1 905 8 is_stmt 0 view .LVU775
+	testb	%bl, %bl	# rval
+	je	.L251	#,
+	.loc 1 906 9 is_stmt 1 view .LVU776
+	leaq	.LC74(%rip), %rsi	#, tmp104
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL386:
+	.loc 1 907 9 view .LVU777
+# qtest.c:907:         qcnt--;
+	.loc 1 907 13 is_stmt 0 view .LVU778
+	subq	$1, qcnt(%rip)	#, qcnt
+	jmp	.L252	#
+.LVL387:
+.L253:
+	.loc 1 913 13 is_stmt 1 view .LVU779
+	leaq	.LC76(%rip), %rsi	#, tmp107
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL388:
+	.loc 1 914 13 view .LVU780
+	.loc 1 918 5 view .LVU781
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL389:
+	.loc 1 919 5 view .LVU782
+# qtest.c:919:     return ok && !error_check();
+	.loc 1 919 15 is_stmt 0 view .LVU783
+	movl	$0, %ebx	#, iftmp.96_15
+.LVL390:
+.L254:
+# qtest.c:919:     return ok && !error_check();
+	.loc 1 919 15 discriminator 6 view .LVU784
+	andl	$1, %ebx	#, <retval>
+.L244:
+# qtest.c:920: }
+	.loc 1 920 1 view .LVU785
+	movl	%ebx, %eax	# <retval>,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE48:
+	.size	do_remove_head_quiet, .-do_remove_head_quiet
+	.section	.rodata.str1.1
+.LC77:
+	.string	"%s takes 0-1 arguments"
+	.section	.rodata.str1.8
+	.align 8
+.LC78:
+	.string	"Invalid number of calls to size '%s'"
+	.align 8
+.LC79:
+	.string	"Warning: Calling size on null queue"
+	.section	.rodata.str1.1
+.LC80:
+	.string	"Queue size = %d"
+	.section	.rodata.str1.8
+	.align 8
+.LC81:
+	.string	"ERROR: Computed queue size as %d, but correct value is %d"
+	.text
+	.type	do_size, @function
+do_size:
+.LVL391:
+.LFB50:
+	.loc 1 947 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 947 1 is_stmt 0 view .LVU787
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 64
+	movq	%rsi, %rbp	# tmp147, argv
+	.loc 1 948 5 is_stmt 1 view .LVU788
+# qtest.c:948:     if (simulation)
+	.loc 1 948 9 is_stmt 0 view .LVU789
+	movzbl	simulation(%rip), %ebx	# simulation, <retval>
+# qtest.c:948:     if (simulation)
+	.loc 1 948 8 view .LVU790
+	testb	%bl, %bl	# <retval>
+	jne	.L280	#,
+	.loc 1 951 5 is_stmt 1 view .LVU791
+# qtest.c:951:     if (argc != 1 && argc != 2) {
+	.loc 1 951 19 is_stmt 0 view .LVU792
+	leal	-1(%rdi), %eax	#, tmp118
+# qtest.c:951:     if (argc != 1 && argc != 2) {
+	.loc 1 951 8 view .LVU793
+	cmpl	$1, %eax	#, tmp118
+	ja	.L281	#,
+	.loc 1 956 5 is_stmt 1 view .LVU794
+# qtest.c:956:     int reps = 1;
+	.loc 1 956 9 is_stmt 0 view .LVU795
+	movl	$1, 12(%rsp)	#, reps
+	.loc 1 957 5 is_stmt 1 view .LVU796
+.LVL392:
+	.loc 1 958 5 view .LVU797
+	.loc 1 963 5 view .LVU798
+# qtest.c:963:     if (argc == 2) {
+	.loc 1 963 8 is_stmt 0 view .LVU799
+	cmpl	$2, %edi	#, argc
+	je	.L282	#,
+.LVL393:
+.L264:
+	.loc 1 969 5 is_stmt 1 view .LVU800
+	.loc 1 970 5 view .LVU801
+# qtest.c:970:     if (!q)
+	.loc 1 970 8 is_stmt 0 view .LVU802
+	cmpq	$0, q(%rip)	#, q
+	je	.L283	#,
+.L265:
+	.loc 1 972 5 is_stmt 1 view .LVU803
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL394:
+	.loc 1 974 5 view .LVU804
+# qtest.c:974:     if (exception_setup(true)) {
+	.loc 1 974 9 is_stmt 0 view .LVU805
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL395:
+# qtest.c:974:     if (exception_setup(true)) {
+	.loc 1 974 8 view .LVU806
+	testb	%al, %al	# tmp150
+	jne	.L276	#,
+	.loc 1 982 5 is_stmt 1 view .LVU807
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL396:
+	.loc 1 984 5 view .LVU808
+# qtest.c:969:     int cnt = 0;
+	.loc 1 969 9 is_stmt 0 view .LVU809
+	movl	$0, %ebp	#, cnt
+.LVL397:
+.L275:
+	.loc 1 985 9 is_stmt 1 view .LVU810
+# qtest.c:985:         if (qcnt == cnt) {
+	.loc 1 985 18 is_stmt 0 view .LVU811
+	movq	qcnt(%rip), %rcx	# qcnt, qcnt.72_15
+	movslq	%ebp, %rax	# cnt, cnt
+# qtest.c:985:         if (qcnt == cnt) {
+	.loc 1 985 12 view .LVU812
+	cmpq	%rcx, %rax	# qcnt.72_15, cnt
+	je	.L284	#,
+	.loc 1 988 13 is_stmt 1 view .LVU813
+	movl	%ebp, %edx	# cnt,
+	leaq	.LC81(%rip), %rsi	#, tmp143
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL398:
+	.loc 1 991 13 view .LVU814
+.L274:
+	.loc 1 995 5 view .LVU815
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL399:
+	.loc 1 997 5 view .LVU816
+# qtest.c:997:     return ok && !error_check();
+	.loc 1 997 15 is_stmt 0 view .LVU817
+	movl	$0, %ebx	#, iftmp.74_26
+.LVL400:
+.L273:
+# qtest.c:997:     return ok && !error_check();
+	.loc 1 997 15 discriminator 6 view .LVU818
+	andl	$1, %ebx	#, <retval>
+.LVL401:
+.L260:
+# qtest.c:998: }
+	.loc 1 998 1 view .LVU819
+	movl	%ebx, %eax	# <retval>,
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL402:
+.L280:
+	.cfi_restore_state
+	.loc 1 949 9 is_stmt 1 view .LVU820
+# qtest.c:949:         return simulate(argc, argv, test_size);
+	.loc 1 949 16 is_stmt 0 view .LVU821
+	movl	$1, %edx	#,
+	call	simulate	#
+.LVL403:
+	.loc 1 949 16 view .LVU822
+	movl	%eax, %ebx	# tmp148, <retval>
+	jmp	.L260	#
+.LVL404:
+.L281:
+	.loc 1 952 9 is_stmt 1 view .LVU823
+	movq	(%rsi), %rdx	# *argv_37(D), *argv_37(D)
+	leaq	.LC77(%rip), %rsi	#, tmp120
+.LVL405:
+	.loc 1 952 9 is_stmt 0 view .LVU824
+	movl	$1, %edi	#,
+.LVL406:
+	.loc 1 952 9 view .LVU825
+	movl	$0, %eax	#,
+.LVL407:
+	.loc 1 952 9 view .LVU826
+	call	report@PLT	#
+.LVL408:
+	.loc 1 953 9 is_stmt 1 view .LVU827
+# qtest.c:953:         return false;
+	.loc 1 953 16 is_stmt 0 view .LVU828
+	jmp	.L260	#
+.LVL409:
+.L282:
+	.loc 1 964 9 is_stmt 1 view .LVU829
+# qtest.c:964:         if (!get_int(argv[1], &reps)) {
+	.loc 1 964 14 is_stmt 0 view .LVU830
+	leaq	12(%rsp), %rsi	#, tmp121
+.LVL410:
+	.loc 1 964 14 view .LVU831
+	movq	8(%rbp), %rdi	# MEM[(char * *)argv_37(D) + 8B], MEM[(char * *)argv_37(D) + 8B]
+.LVL411:
+	.loc 1 964 14 view .LVU832
+	call	get_int@PLT	#
+.LVL412:
+# qtest.c:964:         if (!get_int(argv[1], &reps)) {
+	.loc 1 964 12 view .LVU833
+	testb	%al, %al	# tmp149
+	jne	.L264	#,
+	.loc 1 965 13 is_stmt 1 view .LVU834
+	movq	16(%rbp), %rdx	# MEM[(char * *)argv_37(D) + 16B], MEM[(char * *)argv_37(D) + 16B]
+	leaq	.LC78(%rip), %rsi	#, tmp124
+	movl	$1, %edi	#,
+	call	report@PLT	#
+.LVL413:
+	jmp	.L264	#
+.LVL414:
+.L283:
+	.loc 1 971 9 view .LVU835
+	leaq	.LC79(%rip), %rsi	#, tmp125
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL415:
+	jmp	.L265	#
+.LVL416:
+.L287:
+.LBB85:
+.LBB86:
+.LBB87:
+.LBB88:
+	.loc 1 100 9 view .LVU836
+	movq	%r13, %rdi	# tmp145,
+	call	hist_record@PLT	#
+.LVL417:
+.L268:
+	.loc 1 100 9 is_stmt 0 view .LVU837
+.LBE88:
+.LBE87:
+	.loc 1 979 13 is_stmt 1 view .LVU838
+# qtest.c:979:             ok = ok && !error_check();
+	.loc 1 979 25 is_stmt 0 view .LVU839
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL418:
+	.loc 1 979 25 view .LVU840
+.LBE86:
+	.loc 1 975 42 is_stmt 1 view .LVU841
+	addl	$1, %r12d	#, r
+.LVL419:
+	.loc 1 975 28 view .LVU842
+	testb	%al, %al	# tmp152
+	jne	.L285	#,
+.LVL420:
+.L266:
+# qtest.c:975:         for (int r = 0; ok && r < reps; r++) {
+	.loc 1 975 28 is_stmt 0 discriminator 3 view .LVU843
+	cmpl	%r12d, 12(%rsp)	# r, reps
+	jle	.L286	#,
+.LBB97:
+	.loc 1 976 13 is_stmt 1 view .LVU844
+.LBB91:
+.LBI91:
+	.file 2 "dudect/cpucycles.h"
+	.loc 2 6 23 view .LVU845
+.LBB92:
+	.loc 2 9 5 view .LVU846
+	.loc 2 10 5 view .LVU847
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL421:
+	.loc 2 11 5 view .LVU848
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 45 is_stmt 0 view .LVU849
+#NO_APP
+	salq	$32, %rdx	#, tmp129
+.LVL422:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 13 view .LVU850
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 27 view .LVU851
+	movq	%rdx, %rbx	# tmp129, tmp129
+	orq	%rax, %rbx	# lo, tmp129
+.LVL423:
+	.loc 2 11 27 view .LVU852
+.LBE92:
+.LBE91:
+	.loc 1 977 13 is_stmt 1 view .LVU853
+# qtest.c:977:             cnt = q_size(q);
+	.loc 1 977 19 is_stmt 0 view .LVU854
+	movq	q(%rip), %rdi	# q,
+	call	q_size@PLT	#
+.LVL424:
+	.loc 1 977 19 view .LVU855
+	movl	%eax, %ebp	# tmp151, cnt
+	.loc 1 978 13 is_stmt 1 view .LVU856
+.LBB93:
+.LBI93:
+	.loc 2 6 23 view .LVU857
+.LBB94:
+	.loc 2 9 5 view .LVU858
+	.loc 2 10 5 view .LVU859
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL425:
+	.loc 2 11 5 view .LVU860
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 45 is_stmt 0 view .LVU861
+#NO_APP
+	movq	%rdx, %rsi	# hi, tmp135
+	salq	$32, %rsi	#, tmp135
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 13 view .LVU862
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 27 view .LVU863
+	orq	%rax, %rsi	# lo, tmp137
+.LVL426:
+	.loc 2 11 27 view .LVU864
+.LBE94:
+.LBE93:
+.LBB95:
+.LBI87:
+	.loc 1 97 20 is_stmt 1 view .LVU865
+.LBB89:
+	.loc 1 99 5 view .LVU866
+# qtest.c:99:     if (cycles >= 0)
+	.loc 1 99 8 is_stmt 0 view .LVU867
+	subq	%rbx, %rsi	# _70, _11
+.LVL427:
+	.loc 1 99 8 view .LVU868
+	js	.L268	#,
+	jmp	.L287	#
+.LVL428:
+.L276:
+	.loc 1 99 8 view .LVU869
+.LBE89:
+.LBE95:
+.LBE97:
+# qtest.c:975:         for (int r = 0; ok && r < reps; r++) {
+	.loc 1 975 18 view .LVU870
+	movl	$0, %r12d	#, r
+.LBE85:
+# qtest.c:969:     int cnt = 0;
+	.loc 1 969 9 view .LVU871
+	movl	$0, %ebp	#, cnt
+.LVL429:
+.LBB99:
+.LBB98:
+.LBB96:
+.LBB90:
+# qtest.c:100:         hist_record(&latency[op], cycles);
+	.loc 1 100 9 view .LVU872
+	leaq	30752+latency(%rip), %r13	#, tmp145
+	jmp	.L266	#
+.LVL430:
+.L284:
+	.loc 1 100 9 view .LVU873
+.LBE90:
+.LBE96:
+.LBE98:
+.LBE99:
+	.loc 1 986 13 is_stmt 1 view .LVU874
+	movl	%ebp, %edx	# cnt,
+	leaq	.LC80(%rip), %rsi	#, tmp140
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL431:
+	.loc 1 995 5 view .LVU875
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL432:
+	.loc 1 997 5 view .LVU876
+# qtest.c:997:     return ok && !error_check();
+	.loc 1 997 19 is_stmt 0 view .LVU877
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL433:
+# qtest.c:997:     return ok && !error_check();
+	.loc 1 997 15 view .LVU878
+	xorl	$1, %eax	#, tmp153
+	movzbl	%al, %ebx	# tmp141, iftmp.74_26
+	jmp	.L273	#
+.LVL434:
+.L285:
+	.loc 1 982 5 is_stmt 1 view .LVU879
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL435:
+	.loc 1 984 5 view .LVU880
+	jmp	.L274	#
+.LVL436:
+.L286:
+	.loc 1 982 5 view .LVU881
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL437:
+	.loc 1 984 5 view .LVU882
+	jmp	.L275	#
+	.cfi_endproc
+.LFE50:
+	.size	do_size, .-do_size
+	.section	.rodata.str1.1
+.LC82:
+	.string	"%s needs 1-2 arguments"
+	.section	.rodata.str1.8
+	.align 8
+.LC83:
+	.string	"Invalid number of insertions '%s'"
+	.section	.rodata.str1.1
+.LC84:
+	.string	"RAND"
+	.section	.rodata.str1.8
+	.align 8
+.LC85:
+	.string	"Warning: Calling insert tail on null queue"
+	.align 8
+.LC86:
+	.string	"ERROR: Failed to save copy of string in list"
+	.section	.rodata.str1.1
+.LC87:
+	.string	"Insertion of %s failed"
+	.section	.rodata.str1.8
+	.align 8
+.LC88:
+	.string	"ERROR: Insertion of %s failed (%d failures total)"
+	.text
+	.type	do_insert_tail, @function
+do_insert_tail:
+.LVL438:
+.LFB46:
+	.loc 1 728 1 view -0
+	.cfi_startproc
+	.loc 1 728 1 is_stmt 0 view .LVU884
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp	#,
+	.cfi_def_cfa_offset 96
+	movq	%rsi, %rbx	# tmp157, argv
+	.loc 1 729 5 is_stmt 1 view .LVU885
+# qtest.c:729:     if (simulation)
+	.loc 1 729 9 is_stmt 0 view .LVU886
+	movzbl	simulation(%rip), %r15d	# simulation, simulation.119_1
+# qtest.c:729:     if (simulation)
+	.loc 1 729 8 view .LVU887
+	testb	%r15b, %r15b	# simulation.119_1
+	jne	.L308	#,
+	.loc 1 732 5 is_stmt 1 view .LVU888
+	.loc 1 733 5 view .LVU889
+# qtest.c:733:     int reps = 1;
+	.loc 1 733 9 is_stmt 0 view .LVU890
+	movl	$1, 16(%rsp)	#, reps
+	.loc 1 734 5 is_stmt 1 view .LVU891
+.LVL439:
+	.loc 1 735 5 view .LVU892
+# qtest.c:735:     if (argc != 2 && argc != 3) {
+	.loc 1 735 19 is_stmt 0 view .LVU893
+	leal	-2(%rdi), %eax	#, tmp122
+# qtest.c:735:     if (argc != 2 && argc != 3) {
+	.loc 1 735 8 view .LVU894
+	cmpl	$1, %eax	#, tmp122
+	ja	.L309	#,
+	.loc 1 740 5 is_stmt 1 view .LVU895
+# qtest.c:740:     char *inserts = argv[1];
+	.loc 1 740 11 is_stmt 0 view .LVU896
+	movq	8(%rsi), %r13	# MEM[(char * *)argv_41(D) + 8B], inserts
+.LVL440:
+	.loc 1 741 5 is_stmt 1 view .LVU897
+# qtest.c:741:     if (argc == 3) {
+	.loc 1 741 8 is_stmt 0 view .LVU898
+	cmpl	$3, %edi	#, argc
+	je	.L310	#,
+.LVL441:
+.L292:
+	.loc 1 748 5 is_stmt 1 view .LVU899
+# qtest.c:748:     if (!strcmp(inserts, "RAND")) {
+	.loc 1 748 10 is_stmt 0 view .LVU900
+	leaq	.LC84(%rip), %rsi	#, tmp130
+	movq	%r13, %rdi	# inserts,
+	call	strcmp@PLT	#
+.LVL442:
+# qtest.c:734:     bool ok = true, need_rand = false;
+	.loc 1 734 21 view .LVU901
+	movl	%r15d, %r14d	# simulation.119_1, need_rand
+# qtest.c:748:     if (!strcmp(inserts, "RAND")) {
+	.loc 1 748 8 view .LVU902
+	testl	%eax, %eax	# tmp160
+	jne	.L293	#,
+# qtest.c:750:         inserts = randstr_buf;
+	.loc 1 750 17 view .LVU903
+	leaq	22(%rsp), %r13	#, inserts
+.LVL443:
+# qtest.c:749:         need_rand = true;
+	.loc 1 749 19 view .LVU904
+	movl	$1, %r14d	#, need_rand
+.L293:
+.LVL444:
+	.loc 1 753 5 is_stmt 1 view .LVU905
+# qtest.c:753:     if (!q)
+	.loc 1 753 8 is_stmt 0 view .LVU906
+	cmpq	$0, q(%rip)	#, q
+	je	.L311	#,
+.L294:
+	.loc 1 755 5 is_stmt 1 view .LVU907
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL445:
+	.loc 1 757 5 view .LVU908
+# qtest.c:757:     if (exception_setup(true)) {
+	.loc 1 757 9 is_stmt 0 view .LVU909
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL446:
+	movb	%al, 7(%rsp)	# <retval>, %sfp
+# qtest.c:757:     if (exception_setup(true)) {
+	.loc 1 757 8 view .LVU910
+	testb	%al, %al	# <retval>
+	jne	.L305	#,
+# qtest.c:734:     bool ok = true, need_rand = false;
+	.loc 1 734 10 view .LVU911
+	movb	$1, 7(%rsp)	#, %sfp
+.LVL447:
+.L296:
+	.loc 1 784 5 is_stmt 1 view .LVU912
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL448:
+	.loc 1 785 5 view .LVU913
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL449:
+	.loc 1 786 5 view .LVU914
+.L288:
+# qtest.c:787: }
+	.loc 1 787 1 is_stmt 0 view .LVU915
+	movzbl	7(%rsp), %eax	# %sfp,
+	addq	$40, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL450:
+.L308:
+	.cfi_restore_state
+	.loc 1 730 9 is_stmt 1 view .LVU916
+# qtest.c:730:         return simulate(argc, argv, test_insert_tail);
+	.loc 1 730 16 is_stmt 0 view .LVU917
+	movl	$0, %edx	#,
+	call	simulate	#
+.LVL451:
+	.loc 1 730 16 view .LVU918
+	movb	%al, 7(%rsp)	# tmp158, %sfp
+	jmp	.L288	#
+.LVL452:
+.L309:
+	.loc 1 736 9 is_stmt 1 view .LVU919
+	movq	(%rsi), %rdx	# *argv_41(D), *argv_41(D)
+	leaq	.LC82(%rip), %rsi	#, tmp124
+	movl	$1, %edi	#,
+.LVL453:
+	.loc 1 736 9 is_stmt 0 view .LVU920
+	movl	$0, %eax	#,
+.LVL454:
+	.loc 1 736 9 view .LVU921
+	call	report@PLT	#
+.LVL455:
+	.loc 1 737 9 is_stmt 1 view .LVU922
+# qtest.c:737:         return false;
+	.loc 1 737 16 is_stmt 0 view .LVU923
+	movb	%r15b, 7(%rsp)	# simulation.119_1, %sfp
+	jmp	.L288	#
+.LVL456:
+.L310:
+	.loc 1 742 9 is_stmt 1 view .LVU924
+# qtest.c:742:         if (!get_int(argv[2], &reps)) {
+	.loc 1 742 14 is_stmt 0 view .LVU925
+	leaq	16(%rsp), %rsi	#, tmp125
+	movq	16(%rbx), %rdi	# MEM[(char * *)argv_41(D) + 16B], MEM[(char * *)argv_41(D) + 16B]
+.LVL457:
+	.loc 1 742 14 view .LVU926
+	call	get_int@PLT	#
+.LVL458:
+	.loc 1 742 14 view .LVU927
+	movb	%al, 7(%rsp)	# <retval>, %sfp
+# qtest.c:742:         if (!get_int(argv[2], &reps)) {
+	.loc 1 742 12 view .LVU928
+	testb	%al, %al	# <retval>
+	jne	.L292	#,
+	.loc 1 743 13 is_stmt 1 view .LVU929
+	movq	16(%rbx), %rdx	# MEM[(char * *)argv_41(D) + 16B], MEM[(char * *)argv_41(D) + 16B]
+	leaq	.LC83(%rip), %rsi	#, tmp128
+	movl	$1, %edi	#,
+	call	report@PLT	#
+.LVL459:
+	.loc 1 744 13 view .LVU930
+# qtest.c:744:             return false;
+	.loc 1 744 20 is_stmt 0 view .LVU931
+	jmp	.L288	#
+.LVL460:
+.L311:
+	.loc 1 754 9 is_stmt 1 view .LVU932
+	leaq	.LC85(%rip), %rsi	#, tmp131
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL461:
+	jmp	.L294	#
+.LVL462:
+.L313:
+.LBB100:
+.LBB101:
+	.loc 1 760 17 view .LVU933
+	movl	$10, %esi	#,
+	movq	8(%rsp), %rdi	# %sfp,
+	call	fill_rand_string	#
+.LVL463:
+	jmp	.L297	#
+.LVL464:
+.L314:
+.LBB102:
+.LBB103:
+	.loc 1 100 9 view .LVU934
+	leaq	15376+latency(%rip), %rdi	#,
+	call	hist_record@PLT	#
+.LVL465:
+	.loc 1 100 9 is_stmt 0 view .LVU935
+	jmp	.L298	#
+.LVL466:
+.L299:
+	.loc 1 100 9 view .LVU936
+.LBE103:
+.LBE102:
+	.loc 1 771 17 is_stmt 1 view .LVU937
+# qtest.c:771:                 fail_count++;
+	.loc 1 771 27 is_stmt 0 view .LVU938
+	movl	fail_count(%rip), %eax	# fail_count, tmp169
+	leal	1(%rax), %ecx	#, _19
+	movl	%ecx, fail_count(%rip)	# _19, fail_count
+	.loc 1 772 17 is_stmt 1 view .LVU939
+# qtest.c:772:                 if (fail_count < fail_limit)
+	.loc 1 772 20 is_stmt 0 view .LVU940
+	cmpl	fail_limit(%rip), %ecx	# fail_limit, _19
+	jge	.L302	#,
+	.loc 1 773 21 is_stmt 1 view .LVU941
+	movq	%r13, %rdx	# inserts,
+	leaq	.LC87(%rip), %rsi	#,
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL467:
+.L300:
+	.loc 1 781 13 view .LVU942
+# qtest.c:781:             ok = ok && !error_check();
+	.loc 1 781 25 is_stmt 0 view .LVU943
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL468:
+	.loc 1 781 25 view .LVU944
+.LBE101:
+	.loc 1 758 42 is_stmt 1 view .LVU945
+	.loc 1 758 42 is_stmt 0 view .LVU946
+	addl	$1, %r12d	#, r
+.LVL469:
+	.loc 1 758 28 is_stmt 1 view .LVU947
+	testb	%al, %al	# tmp163
+	jne	.L312	#,
+.LVL470:
+.L295:
+# qtest.c:758:         for (int r = 0; ok && r < reps; r++) {
+	.loc 1 758 28 is_stmt 0 discriminator 3 view .LVU948
+	cmpl	%r12d, 16(%rsp)	# r, reps
+	jle	.L296	#,
+.LBB110:
+	.loc 1 759 13 is_stmt 1 view .LVU949
+# qtest.c:759:             if (need_rand)
+	.loc 1 759 16 is_stmt 0 view .LVU950
+	testb	%r14b, %r14b	# need_rand
+	jne	.L313	#,
+.L297:
+	.loc 1 761 13 is_stmt 1 view .LVU951
+.LBB105:
+.LBI105:
+	.loc 2 6 23 view .LVU952
+.LBB106:
+	.loc 2 9 5 view .LVU953
+	.loc 2 10 5 view .LVU954
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL471:
+	.loc 2 11 5 view .LVU955
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 45 is_stmt 0 view .LVU956
+#NO_APP
+	salq	$32, %rdx	#, tmp136
+.LVL472:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 13 view .LVU957
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 27 view .LVU958
+	movq	%rdx, %rbx	# tmp136, tmp136
+	orq	%rax, %rbx	# lo, tmp136
+.LVL473:
+	.loc 2 11 27 view .LVU959
+.LBE106:
+.LBE105:
+	.loc 1 762 13 is_stmt 1 view .LVU960
+# qtest.c:762:             bool rval = q_insert_tail(q, inserts);
+	.loc 1 762 25 is_stmt 0 view .LVU961
+	movq	%r13, %rsi	# inserts,
+	movq	q(%rip), %rdi	# q,
+	call	q_insert_tail@PLT	#
+.LVL474:
+	movl	%eax, %ebp	# tmp162, rval
+.LVL475:
+	.loc 1 763 13 is_stmt 1 view .LVU962
+.LBB107:
+.LBI107:
+	.loc 2 6 23 view .LVU963
+.LBB108:
+	.loc 2 9 5 view .LVU964
+	.loc 2 10 5 view .LVU965
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL476:
+	.loc 2 11 5 view .LVU966
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 45 is_stmt 0 view .LVU967
+#NO_APP
+	movq	%rdx, %rsi	# hi, tmp142
+	salq	$32, %rsi	#, tmp142
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 13 view .LVU968
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 27 view .LVU969
+	orq	%rax, %rsi	# lo, tmp144
+.LVL477:
+	.loc 2 11 27 view .LVU970
+.LBE108:
+.LBE107:
+.LBB109:
+.LBI102:
+	.loc 1 97 20 is_stmt 1 view .LVU971
+.LBB104:
+	.loc 1 99 5 view .LVU972
+# qtest.c:99:     if (cycles >= 0)
+	.loc 1 99 8 is_stmt 0 view .LVU973
+	subq	%rbx, %rsi	# _78, _12
+.LVL478:
+	.loc 1 99 8 view .LVU974
+	jns	.L314	#,
+.LVL479:
+.L298:
+	.loc 1 99 8 view .LVU975
+.LBE104:
+.LBE109:
+	.loc 1 764 13 is_stmt 1 view .LVU976
+# qtest.c:764:             if (rval) {
+	.loc 1 764 16 is_stmt 0 view .LVU977
+	testb	%bpl, %bpl	# rval
+	je	.L299	#,
+	.loc 1 765 17 is_stmt 1 view .LVU978
+# qtest.c:765:                 qcnt++;
+	.loc 1 765 21 is_stmt 0 view .LVU979
+	addq	$1, qcnt(%rip)	#, qcnt
+	.loc 1 766 17 is_stmt 1 view .LVU980
+# qtest.c:766:                 if (!q->head->value) {
+	.loc 1 766 23 is_stmt 0 view .LVU981
+	movq	q(%rip), %rax	# q, q
+# qtest.c:766:                 if (!q->head->value) {
+	.loc 1 766 29 view .LVU982
+	movq	(%rax), %rax	# q.124_15->head, q.124_15->head
+# qtest.c:766:                 if (!q->head->value) {
+	.loc 1 766 20 view .LVU983
+	cmpq	$0, (%rax)	#, _16->value
+	jne	.L300	#,
+	.loc 1 767 21 is_stmt 1 view .LVU984
+	leaq	.LC86(%rip), %rsi	#, tmp148
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL480:
+	.loc 1 768 21 view .LVU985
+	.loc 1 781 13 view .LVU986
+	jmp	.L301	#
+.LVL481:
+.L302:
+	.loc 1 775 21 view .LVU987
+	movq	%r13, %rdx	# inserts,
+	leaq	.LC88(%rip), %rsi	#, tmp151
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL482:
+	.loc 1 778 21 view .LVU988
+	.loc 1 781 13 view .LVU989
+.L301:
+	.loc 1 781 13 is_stmt 0 view .LVU990
+.LBE110:
+	.loc 1 758 42 is_stmt 1 view .LVU991
+	.loc 1 758 28 view .LVU992
+.LBB111:
+# qtest.c:781:             ok = ok && !error_check();
+	.loc 1 781 16 is_stmt 0 view .LVU993
+	movb	%r15b, 7(%rsp)	# simulation.119_1, %sfp
+	jmp	.L296	#
+.LVL483:
+.L305:
+	.loc 1 781 16 view .LVU994
+.LBE111:
+# qtest.c:758:         for (int r = 0; ok && r < reps; r++) {
+	.loc 1 758 18 view .LVU995
+	movl	$0, %r12d	#, r
+.LBB112:
+# qtest.c:760:                 fill_rand_string(randstr_buf, sizeof(randstr_buf));
+	.loc 1 760 17 view .LVU996
+	leaq	22(%rsp), %rax	#, tmp153
+	movq	%rax, 8(%rsp)	# tmp153, %sfp
+	jmp	.L295	#
+.LVL484:
+.L312:
+# qtest.c:781:             ok = ok && !error_check();
+	.loc 1 781 16 view .LVU997
+	movb	%r15b, 7(%rsp)	# simulation.119_1, %sfp
+	jmp	.L296	#
+.LBE112:
+.LBE100:
+	.cfi_endproc
+.LFE46:
+	.size	do_insert_tail, .-do_insert_tail
+	.section	.rodata.str1.8
+	.align 8
+.LC89:
+	.string	"Warning: Calling insert head on null queue"
+	.align 8
+.LC90:
+	.string	"ERROR: Need to allocate and copy string for new list element"
+	.align 8
+.LC91:
+	.string	"ERROR: Need to allocate separate string for each list element"
+	.text
+	.type	do_insert_head, @function
+do_insert_head:
+.LVL485:
+.LFB45:
+	.loc 1 651 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 651 1 is_stmt 0 view .LVU999
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp	#,
+	.cfi_def_cfa_offset 96
+	movq	%rsi, %rbx	# tmp179, argv
+	.loc 1 652 5 is_stmt 1 view .LVU1000
+# qtest.c:652:     if (simulation)
+	.loc 1 652 9 is_stmt 0 view .LVU1001
+	movzbl	simulation(%rip), %eax	# simulation, simulation.131_1
+	movb	%al, 7(%rsp)	# simulation.131_1, %sfp
+# qtest.c:652:     if (simulation)
+	.loc 1 652 8 view .LVU1002
+	testb	%al, %al	# simulation.131_1
+	jne	.L338	#,
+	.loc 1 655 5 is_stmt 1 view .LVU1003
+.LVL486:
+	.loc 1 656 5 view .LVU1004
+	.loc 1 657 5 view .LVU1005
+# qtest.c:657:     int reps = 1;
+	.loc 1 657 9 is_stmt 0 view .LVU1006
+	movl	$1, 16(%rsp)	#, reps
+	.loc 1 658 5 is_stmt 1 view .LVU1007
+.LVL487:
+	.loc 1 659 5 view .LVU1008
+# qtest.c:659:     if (argc != 2 && argc != 3) {
+	.loc 1 659 19 is_stmt 0 view .LVU1009
+	leal	-2(%rdi), %eax	#, tmp131
+# qtest.c:659:     if (argc != 2 && argc != 3) {
+	.loc 1 659 8 view .LVU1010
+	cmpl	$1, %eax	#, tmp131
+	ja	.L339	#,
+	.loc 1 664 5 is_stmt 1 view .LVU1011
+# qtest.c:664:     char *inserts = argv[1];
+	.loc 1 664 11 is_stmt 0 view .LVU1012
+	movq	8(%rsi), %r13	# MEM[(char * *)argv_49(D) + 8B], inserts
+.LVL488:
+	.loc 1 665 5 is_stmt 1 view .LVU1013
+# qtest.c:665:     if (argc == 3) {
+	.loc 1 665 8 is_stmt 0 view .LVU1014
+	cmpl	$3, %edi	#, argc
+	je	.L340	#,
+.LVL489:
+.L319:
+	.loc 1 672 5 is_stmt 1 view .LVU1015
+# qtest.c:672:     if (!strcmp(inserts, "RAND")) {
+	.loc 1 672 10 is_stmt 0 view .LVU1016
+	leaq	.LC84(%rip), %rsi	#, tmp139
+	movq	%r13, %rdi	# inserts,
+	call	strcmp@PLT	#
+.LVL490:
+# qtest.c:672:     if (!strcmp(inserts, "RAND")) {
+	.loc 1 672 8 view .LVU1017
+	testl	%eax, %eax	# tmp182
+	je	.L334	#,
+# qtest.c:658:     bool ok = true, need_rand = false;
+	.loc 1 658 21 view .LVU1018
+	movzbl	7(%rsp), %r14d	# %sfp, need_rand
+.LVL491:
+.L320:
+	.loc 1 677 5 is_stmt 1 view .LVU1019
+# qtest.c:677:     if (!q)
+	.loc 1 677 8 is_stmt 0 view .LVU1020
+	cmpq	$0, q(%rip)	#, q
+	je	.L341	#,
+.L321:
+	.loc 1 679 5 is_stmt 1 view .LVU1021
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL492:
+	.loc 1 681 5 view .LVU1022
+# qtest.c:681:     if (exception_setup(true)) {
+	.loc 1 681 9 is_stmt 0 view .LVU1023
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL493:
+	movb	%al, 6(%rsp)	# <retval>, %sfp
+# qtest.c:681:     if (exception_setup(true)) {
+	.loc 1 681 8 view .LVU1024
+	testb	%al, %al	# <retval>
+	jne	.L335	#,
+# qtest.c:658:     bool ok = true, need_rand = false;
+	.loc 1 658 10 view .LVU1025
+	movb	$1, 6(%rsp)	#, %sfp
+.LVL494:
+.L323:
+	.loc 1 721 5 is_stmt 1 view .LVU1026
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL495:
+	.loc 1 723 5 view .LVU1027
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL496:
+	.loc 1 724 5 view .LVU1028
+.L315:
+# qtest.c:725: }
+	.loc 1 725 1 is_stmt 0 view .LVU1029
+	movzbl	6(%rsp), %eax	# %sfp,
+	addq	$40, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL497:
+.L338:
+	.cfi_restore_state
+	.loc 1 653 9 is_stmt 1 view .LVU1030
+# qtest.c:653:         return simulate(argc, argv, test_insert_head);
+	.loc 1 653 16 is_stmt 0 view .LVU1031
+	movl	$2, %edx	#,
+	call	simulate	#
+.LVL498:
+	.loc 1 653 16 view .LVU1032
+	movb	%al, 6(%rsp)	# tmp180, %sfp
+	jmp	.L315	#
+.LVL499:
+.L339:
+	.loc 1 660 9 is_stmt 1 view .LVU1033
+	movq	(%rsi), %rdx	# *argv_49(D), *argv_49(D)
+	leaq	.LC82(%rip), %rsi	#, tmp133
+	movl	$1, %edi	#,
+.LVL500:
+	.loc 1 660 9 is_stmt 0 view .LVU1034
+	movl	$0, %eax	#,
+.LVL501:
+	.loc 1 660 9 view .LVU1035
+	call	report@PLT	#
+.LVL502:
+	.loc 1 661 9 is_stmt 1 view .LVU1036
+# qtest.c:661:         return false;
+	.loc 1 661 16 is_stmt 0 view .LVU1037
+	movzbl	7(%rsp), %eax	# %sfp, simulation.131_1
+	movb	%al, 6(%rsp)	# simulation.131_1, %sfp
+	jmp	.L315	#
+.LVL503:
+.L340:
+	.loc 1 666 9 is_stmt 1 view .LVU1038
+# qtest.c:666:         if (!get_int(argv[2], &reps)) {
+	.loc 1 666 14 is_stmt 0 view .LVU1039
+	leaq	16(%rsp), %rsi	#, tmp134
+	movq	16(%rbx), %rdi	# MEM[(char * *)argv_49(D) + 16B], MEM[(char * *)argv_49(D) + 16B]
+.LVL504:
+	.loc 1 666 14 view .LVU1040
+	call	get_int@PLT	#
+.LVL505:
+	.loc 1 666 14 view .LVU1041
+	movb	%al, 6(%rsp)	# <retval>, %sfp
+# qtest.c:666:         if (!get_int(argv[2], &reps)) {
+	.loc 1 666 12 view .LVU1042
+	testb	%al, %al	# <retval>
+	jne	.L319	#,
+	.loc 1 667 13 is_stmt 1 view .LVU1043
+	movq	16(%rbx), %rdx	# MEM[(char * *)argv_49(D) + 16B], MEM[(char * *)argv_49(D) + 16B]
+	leaq	.LC83(%rip), %rsi	#, tmp137
+	movl	$1, %edi	#,
+	call	report@PLT	#
+.LVL506:
+	.loc 1 668 13 view .LVU1044
+# qtest.c:668:             return false;
+	.loc 1 668 20 is_stmt 0 view .LVU1045
+	jmp	.L315	#
+.L334:
+# qtest.c:674:         inserts = randstr_buf;
+	.loc 1 674 17 view .LVU1046
+	leaq	22(%rsp), %r13	#, inserts
+.LVL507:
+# qtest.c:673:         need_rand = true;
+	.loc 1 673 19 view .LVU1047
+	movl	$1, %r14d	#, need_rand
+	jmp	.L320	#
+.LVL508:
+.L341:
+	.loc 1 678 9 is_stmt 1 view .LVU1048
+	leaq	.LC89(%rip), %rsi	#, tmp140
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL509:
+	jmp	.L321	#
+.LVL510:
+.L343:
+.LBB113:
+.LBB114:
+	.loc 1 684 17 view .LVU1049
+	movl	$10, %esi	#,
+	movq	8(%rsp), %rdi	# %sfp,
+	call	fill_rand_string	#
+.LVL511:
+	jmp	.L324	#
+.LVL512:
+.L344:
+.LBB115:
+.LBB116:
+	.loc 1 100 9 view .LVU1050
+	leaq	latency(%rip), %rdi	#,
+	call	hist_record@PLT	#
+.LVL513:
+	.loc 1 100 9 is_stmt 0 view .LVU1051
+	jmp	.L325	#
+.LVL514:
+.L345:
+	.loc 1 100 9 view .LVU1052
+.LBE116:
+.LBE115:
+	.loc 1 691 21 is_stmt 1 view .LVU1053
+	leaq	.LC86(%rip), %rsi	#,
+	movl	$1, %edi	#,
+	call	report@PLT	#
+.LVL515:
+	.loc 1 692 21 view .LVU1054
+# qtest.c:692:                     ok = false;
+	.loc 1 692 24 is_stmt 0 view .LVU1055
+	movzbl	7(%rsp), %ebp	# %sfp, rval
+.LVL516:
+	.loc 1 692 24 view .LVU1056
+	jmp	.L328	#
+.LVL517:
+.L346:
+	.loc 1 694 21 is_stmt 1 view .LVU1057
+	leaq	.LC90(%rip), %rsi	#, tmp162
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL518:
+	.loc 1 697 21 view .LVU1058
+	.loc 1 698 21 view .LVU1059
+# qtest.c:697:                     ok = false;
+	.loc 1 697 24 is_stmt 0 view .LVU1060
+	movzbl	7(%rsp), %eax	# %sfp, simulation.131_1
+	movb	%al, 6(%rsp)	# simulation.131_1, %sfp
+# qtest.c:698:                     break;
+	.loc 1 698 21 view .LVU1061
+	jmp	.L323	#
+.LVL519:
+.L347:
+	.loc 1 700 21 is_stmt 1 view .LVU1062
+	leaq	.LC91(%rip), %rsi	#, tmp167
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL520:
+	.loc 1 703 21 view .LVU1063
+	.loc 1 704 21 view .LVU1064
+# qtest.c:703:                     ok = false;
+	.loc 1 703 24 is_stmt 0 view .LVU1065
+	movb	%bl, 6(%rsp)	# _94, %sfp
+# qtest.c:704:                     break;
+	.loc 1 704 21 view .LVU1066
+	jmp	.L323	#
+.LVL521:
+.L326:
+	.loc 1 708 17 is_stmt 1 view .LVU1067
+# qtest.c:708:                 fail_count++;
+	.loc 1 708 27 is_stmt 0 view .LVU1068
+	movl	fail_count(%rip), %eax	# fail_count, tmp196
+	leal	1(%rax), %ecx	#, _21
+	movl	%ecx, fail_count(%rip)	# _21, fail_count
+	.loc 1 709 17 is_stmt 1 view .LVU1069
+# qtest.c:709:                 if (fail_count < fail_limit)
+	.loc 1 709 20 is_stmt 0 view .LVU1070
+	cmpl	fail_limit(%rip), %ecx	# fail_limit, _21
+	jge	.L332	#,
+	.loc 1 710 21 is_stmt 1 view .LVU1071
+	movq	%r13, %rdx	# inserts,
+	leaq	.LC87(%rip), %rsi	#,
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL522:
+	.loc 1 718 13 view .LVU1072
+.L330:
+# qtest.c:718:             ok = ok && !error_check();
+	.loc 1 718 25 is_stmt 0 discriminator 1 view .LVU1073
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL523:
+	.loc 1 718 25 discriminator 1 view .LVU1074
+.LBE114:
+	.loc 1 682 42 is_stmt 1 discriminator 1 view .LVU1075
+	.loc 1 682 42 is_stmt 0 discriminator 1 view .LVU1076
+	addl	$1, %r12d	#, r
+.LVL524:
+	.loc 1 682 28 is_stmt 1 discriminator 1 view .LVU1077
+	testb	%al, %al	# tmp185
+	jne	.L342	#,
+.LVL525:
+.L322:
+# qtest.c:682:         for (int r = 0; ok && r < reps; r++) {
+	.loc 1 682 28 is_stmt 0 discriminator 3 view .LVU1078
+	cmpl	%r12d, 16(%rsp)	# r, reps
+	jle	.L323	#,
+.LBB123:
+	.loc 1 683 13 is_stmt 1 view .LVU1079
+# qtest.c:683:             if (need_rand)
+	.loc 1 683 16 is_stmt 0 view .LVU1080
+	testb	%r14b, %r14b	# need_rand
+	jne	.L343	#,
+.L324:
+	.loc 1 685 13 is_stmt 1 view .LVU1081
+.LBB118:
+.LBI118:
+	.loc 2 6 23 view .LVU1082
+.LBB119:
+	.loc 2 9 5 view .LVU1083
+	.loc 2 10 5 view .LVU1084
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL526:
+	.loc 2 11 5 view .LVU1085
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 45 is_stmt 0 view .LVU1086
+#NO_APP
+	salq	$32, %rdx	#, tmp145
+.LVL527:
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 13 view .LVU1087
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 27 view .LVU1088
+	movq	%rdx, %rbx	# tmp145, tmp145
+	orq	%rax, %rbx	# lo, tmp145
+.LVL528:
+	.loc 2 11 27 view .LVU1089
+.LBE119:
+.LBE118:
+	.loc 1 686 13 is_stmt 1 view .LVU1090
+# qtest.c:686:             bool rval = q_insert_head(q, inserts);
+	.loc 1 686 25 is_stmt 0 view .LVU1091
+	movq	%r13, %rsi	# inserts,
+	movq	q(%rip), %rdi	# q,
+	call	q_insert_head@PLT	#
+.LVL529:
+	movl	%eax, %ebp	# tmp184, rval
+.LVL530:
+	.loc 1 687 13 is_stmt 1 view .LVU1092
+.LBB120:
+.LBI120:
+	.loc 2 6 23 view .LVU1093
+.LBB121:
+	.loc 2 9 5 view .LVU1094
+	.loc 2 10 5 view .LVU1095
+#APP
+# 10 "dudect/cpucycles.h" 1
+	rdtsc
+		
+# 0 "" 2
+.LVL531:
+	.loc 2 11 5 view .LVU1096
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 45 is_stmt 0 view .LVU1097
+#NO_APP
+	movq	%rdx, %rsi	# hi, tmp151
+	salq	$32, %rsi	#, tmp151
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 13 view .LVU1098
+	movl	%eax, %eax	# lo, lo
+# dudect/cpucycles.h:11:     return ((int64_t) lo) | (((int64_t) hi) << 32);
+	.loc 2 11 27 view .LVU1099
+	orq	%rax, %rsi	# lo, tmp153
+.LVL532:
+	.loc 2 11 27 view .LVU1100
+.LBE121:
+.LBE120:
+.LBB122:
+.LBI115:
+	.loc 1 97 20 is_stmt 1 view .LVU1101
+.LBB117:
+	.loc 1 99 5 view .LVU1102
+# qtest.c:99:     if (cycles >= 0)
+	.loc 1 99 8 is_stmt 0 view .LVU1103
+	subq	%rbx, %rsi	# _89, _12
+.LVL533:
+	.loc 1 99 8 view .LVU1104
+	jns	.L344	#,
+.LVL534:
+.L325:
+	.loc 1 99 8 view .LVU1105
+.LBE117:
+.LBE122:
+	.loc 1 688 13 is_stmt 1 view .LVU1106
+# qtest.c:688:             if (rval) {
+	.loc 1 688 16 is_stmt 0 view .LVU1107
+	testb	%bpl, %bpl	# rval
+	je	.L326	#,
+	.loc 1 689 17 is_stmt 1 view .LVU1108
+# qtest.c:689:                 qcnt++;
+	.loc 1 689 21 is_stmt 0 view .LVU1109
+	addq	$1, qcnt(%rip)	#, qcnt
+	.loc 1 690 17 is_stmt 1 view .LVU1110
+# qtest.c:690:                 if (!q->head->value) {
+	.loc 1 690 23 is_stmt 0 view .LVU1111
+	movq	q(%rip), %rax	# q, q
+# qtest.c:690:                 if (!q->head->value) {
+	.loc 1 690 29 view .LVU1112
+	movq	(%rax), %rax	# q.136_15->head, q.136_15->head
+	movq	(%rax), %rax	# _16->value, _17
+# qtest.c:690:                 if (!q->head->value) {
+	.loc 1 690 20 view .LVU1113
+	testq	%rax, %rax	# _17
+	je	.L345	#,
+	.loc 1 693 24 is_stmt 1 discriminator 1 view .LVU1114
+# qtest.c:693:                 } else if (r == 0 && inserts == q->head->value) {
+	.loc 1 693 35 is_stmt 0 discriminator 1 view .LVU1115
+	cmpq	%r13, %rax	# inserts, _17
+	sete	%cl	#, tmp159
+# qtest.c:693:                 } else if (r == 0 && inserts == q->head->value) {
+	.loc 1 693 27 discriminator 1 view .LVU1116
+	testl	%r12d, %r12d	# r
+	sete	%dl	#, tmp161
+# qtest.c:693:                 } else if (r == 0 && inserts == q->head->value) {
+	.loc 1 693 35 discriminator 1 view .LVU1117
+	andb	%dl, %cl	# tmp161, tmp159
+	movl	%ecx, %ebx	# tmp159, _94
+.LVL535:
+	.loc 1 693 35 discriminator 1 view .LVU1118
+	jne	.L346	#,
+	.loc 1 699 24 is_stmt 1 discriminator 1 view .LVU1119
+# qtest.c:699:                 } else if (r == 1 && lasts == q->head->value) {
+	.loc 1 699 35 is_stmt 0 discriminator 1 view .LVU1120
+	cmpq	%r15, %rax	# lasts, _17
+	jne	.L328	#,
+	cmpl	$1, %r12d	#, r
+	je	.L347	#,
+.LVL536:
+.L328:
+	.loc 1 706 17 is_stmt 1 view .LVU1121
+# qtest.c:706:                 lasts = q->head->value;
+	.loc 1 706 26 is_stmt 0 view .LVU1122
+	movq	q(%rip), %rax	# q, q
+# qtest.c:706:                 lasts = q->head->value;
+	.loc 1 706 23 view .LVU1123
+	movq	(%rax), %rax	# q.139_18->head, q.139_18->head
+.LVL537:
+	.loc 1 706 23 view .LVU1124
+	movq	(%rax), %r15	# _19->value, lasts
+	.loc 1 718 13 is_stmt 1 view .LVU1125
+# qtest.c:718:             ok = ok && !error_check();
+	.loc 1 718 21 is_stmt 0 view .LVU1126
+	testb	%bpl, %bpl	# rval
+	jne	.L330	#,
+.LVL538:
+.L331:
+	.loc 1 718 21 view .LVU1127
+.LBE123:
+	.loc 1 682 42 is_stmt 1 view .LVU1128
+	.loc 1 682 28 view .LVU1129
+.LBB124:
+# qtest.c:718:             ok = ok && !error_check();
+	.loc 1 718 16 is_stmt 0 view .LVU1130
+	movzbl	7(%rsp), %eax	# %sfp, simulation.131_1
+	movb	%al, 6(%rsp)	# simulation.131_1, %sfp
+	jmp	.L323	#
+.LVL539:
+.L332:
+	.loc 1 712 21 is_stmt 1 view .LVU1131
+	movq	%r13, %rdx	# inserts,
+	leaq	.LC88(%rip), %rsi	#, tmp172
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL540:
+	.loc 1 715 21 view .LVU1132
+	.loc 1 718 13 view .LVU1133
+	jmp	.L331	#
+.LVL541:
+.L335:
+	.loc 1 718 13 is_stmt 0 view .LVU1134
+.LBE124:
+# qtest.c:682:         for (int r = 0; ok && r < reps; r++) {
+	.loc 1 682 18 view .LVU1135
+	movl	$0, %r12d	#, r
+.LBE113:
+# qtest.c:655:     char *lasts = NULL;
+	.loc 1 655 11 view .LVU1136
+	movl	$0, %r15d	#, lasts
+.LBB126:
+.LBB125:
+# qtest.c:684:                 fill_rand_string(randstr_buf, sizeof(randstr_buf));
+	.loc 1 684 17 view .LVU1137
+	leaq	22(%rsp), %rax	#, tmp174
+	movq	%rax, 8(%rsp)	# tmp174, %sfp
+	jmp	.L322	#
+.LVL542:
+.L342:
+# qtest.c:718:             ok = ok && !error_check();
+	.loc 1 718 16 view .LVU1138
+	movzbl	7(%rsp), %eax	# %sfp, simulation.131_1
+.LVL543:
+	.loc 1 718 16 view .LVU1139
+	movb	%al, 6(%rsp)	# simulation.131_1, %sfp
+	jmp	.L323	#
+.LBE125:
+.LBE126:
+	.cfi_endproc
+.LFE45:
+	.size	do_insert_head, .-do_insert_head
+	.section	.rodata.str1.8
+	.align 8
+.LC92:
+	.string	"Warning: Calling reverse on null queue"
+	.text
+	.type	do_reverse, @function
+do_reverse:
+.LVL544:
+.LFB49:
+	.loc 1 923 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 923 1 is_stmt 0 view .LVU1141
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 924 5 is_stmt 1 view .LVU1142
+# qtest.c:924:     if (simulation)
+	.loc 1 924 9 is_stmt 0 view .LVU1143
+	movzbl	simulation(%rip), %ebx	# simulation, <retval>
+# qtest.c:924:     if (simulation)
+	.loc 1 924 8 view .LVU1144
+	testb	%bl, %bl	# <retval>
+	jne	.L355	#,
+	.loc 1 927 5 is_stmt 1 view .LVU1145
+# qtest.c:927:     if (argc != 1) {
+	.loc 1 927 8 is_stmt 0 view .LVU1146
+	cmpl	$1, %edi	#, argc
+	jne	.L356	#,
+	.loc 1 932 5 is_stmt 1 view .LVU1147
+# qtest.c:932:     if (!q)
+	.loc 1 932 8 is_stmt 0 view .LVU1148
+	cmpq	$0, q(%rip)	#, q
+	je	.L357	#,
+.LVL545:
+.L352:
+	.loc 1 934 5 is_stmt 1 view .LVU1149
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL546:
+	.loc 1 936 5 view .LVU1150
+	movl	$1, %edi	#,
+	call	set_noallocate_mode@PLT	#
+.LVL547:
+	.loc 1 937 5 view .LVU1151
+# qtest.c:937:     if (exception_setup(true))
+	.loc 1 937 9 is_stmt 0 view .LVU1152
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL548:
+# qtest.c:937:     if (exception_setup(true))
+	.loc 1 937 8 view .LVU1153
+	testb	%al, %al	# tmp98
+	jne	.L358	#,
+.L353:
+	.loc 1 939 5 is_stmt 1 view .LVU1154
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL549:
+	.loc 1 941 5 view .LVU1155
+	movl	$0, %edi	#,
+	call	set_noallocate_mode@PLT	#
+.LVL550:
+	.loc 1 942 5 view .LVU1156
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL551:
+	.loc 1 943 5 view .LVU1157
+# qtest.c:943:     return !error_check();
+	.loc 1 943 13 is_stmt 0 view .LVU1158
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL552:
+# qtest.c:943:     return !error_check();
+	.loc 1 943 5 view .LVU1159
+	xorl	$1, %eax	#, tmp99
+	movl	%eax, %ebx	# tmp99, <retval>
+.L348:
+# qtest.c:944: }
+	.loc 1 944 1 view .LVU1160
+	movl	%ebx, %eax	# <retval>,
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL553:
+.L355:
+	.cfi_restore_state
+	.loc 1 925 9 is_stmt 1 view .LVU1161
+# qtest.c:925:         return simulate(argc, argv, test_reverse);
+	.loc 1 925 16 is_stmt 0 view .LVU1162
+	movl	$6, %edx	#,
+	call	simulate	#
+.LVL554:
+	.loc 1 925 16 view .LVU1163
+	movl	%eax, %ebx	# tmp97, <retval>
+	jmp	.L348	#
+.LVL555:
+.L356:
+	.loc 1 928 9 is_stmt 1 view .LVU1164
+	movq	(%rsi), %rdx	# *argv_23(D), *argv_23(D)
+	leaq	.LC0(%rip), %rsi	#, tmp91
+.LVL556:
+	.loc 1 928 9 is_stmt 0 view .LVU1165
+	movl	$1, %edi	#,
+.LVL557:
+	.loc 1 928 9 view .LVU1166
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL558:
+	.loc 1 929 9 is_stmt 1 view .LVU1167
+# qtest.c:929:         return false;
+	.loc 1 929 16 is_stmt 0 view .LVU1168
+	jmp	.L348	#
+.LVL559:
+.L357:
+	.loc 1 933 9 is_stmt 1 view .LVU1169
+	leaq	.LC92(%rip), %rsi	#, tmp92
+.LVL560:
+	.loc 1 933 9 is_stmt 0 view .LVU1170
+	movl	$3, %edi	#,
+.LVL561:
+	.loc 1 933 9 view .LVU1171
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL562:
+	jmp	.L352	#
+.L358:
+	.loc 1 938 9 is_stmt 1 view .LVU1172
+	movq	q(%rip), %rdi	# q,
+	call	q_reverse@PLT	#
+.LVL563:
+	jmp	.L353	#
+	.cfi_endproc
+.LFE49:
+	.size	do_reverse, .-do_reverse
+	.section	.rodata.str1.1
+.LC93:
+	.string	"%s needs 1 argument"
+.LC94:
+	.string	"No queue named '%s'"
+	.section	.rodata.str1.8
+	.align 8
+.LC95:
+	.string	"Cannot splice queue '%s' onto itself"
+	.align 8
+.LC96:
+	.string	"Warning: Calling splice on null queue"
+	.section	.rodata.str1.1
+.LC97:
+	.string	"Warning: Splicing null queue"
+	.section	.rodata.str1.8
+	.align 8
+.LC98:
+	.string	"ERROR: Queue '%s' not empty after splice"
+	.text
+	.type	do_splice, @function
+do_splice:
+.LVL564:
+.LFB37:
+	.loc 1 378 1 view -0
+	.cfi_startproc
+	.loc 1 378 1 is_stmt 0 view .LVU1174
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 379 5 is_stmt 1 view .LVU1175
+# qtest.c:379:     if (argc != 2) {
+	.loc 1 379 8 is_stmt 0 view .LVU1176
+	cmpl	$2, %edi	#, tmp162
+	jne	.L373	#,
+	.loc 1 383 5 is_stmt 1 view .LVU1177
+# qtest.c:383:     int i = find_queue(argv[1]);
+	.loc 1 383 13 is_stmt 0 view .LVU1178
+	movq	8(%rsi), %rbp	# MEM[(char * *)argv_30(D) + 8B], _2
+	movq	%rbp, %rdi	# _2,
+.LVL565:
+	.loc 1 383 13 view .LVU1179
+	call	find_queue	#
+.LVL566:
+	.loc 1 383 13 view .LVU1180
+	movl	%eax, %ebx	# tmp164, i
+.LVL567:
+	.loc 1 384 5 is_stmt 1 view .LVU1181
+# qtest.c:384:     if (i < 0) {
+	.loc 1 384 8 is_stmt 0 view .LVU1182
+	testl	%eax, %eax	# i
+	js	.L374	#,
+	.loc 1 388 5 is_stmt 1 view .LVU1183
+# qtest.c:388:     if (i == current) {
+	.loc 1 388 8 is_stmt 0 view .LVU1184
+	cmpl	%eax, current(%rip)	# i, current
+	je	.L375	#,
+	.loc 1 393 5 is_stmt 1 view .LVU1185
+.LVL568:
+	.loc 1 394 5 view .LVU1186
+# qtest.c:394:     if (!q)
+	.loc 1 394 8 is_stmt 0 view .LVU1187
+	cmpq	$0, q(%rip)	#, q
+	je	.L376	#,
+.LVL569:
+.L364:
+	.loc 1 396 5 is_stmt 1 view .LVU1188
+# qtest.c:396:     if (!src->q)
+	.loc 1 396 13 is_stmt 0 view .LVU1189
+	movslq	%ebx, %rax	# i, i
+	salq	$5, %rax	#, tmp117
+# qtest.c:396:     if (!src->q)
+	.loc 1 396 8 view .LVU1190
+	leaq	queues(%rip), %rdx	#, tmp115
+	cmpq	$0, 16(%rdx,%rax)	#, MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].q
+	je	.L377	#,
+.L365:
+	.loc 1 398 5 is_stmt 1 view .LVU1191
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL570:
+	.loc 1 400 5 view .LVU1192
+	movl	$1, %edi	#,
+	call	set_noallocate_mode@PLT	#
+.LVL571:
+	.loc 1 401 5 view .LVU1193
+# qtest.c:401:     if (exception_setup(true))
+	.loc 1 401 9 is_stmt 0 view .LVU1194
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL572:
+# qtest.c:401:     if (exception_setup(true))
+	.loc 1 401 8 view .LVU1195
+	testb	%al, %al	# tmp165
+	jne	.L378	#,
+.L366:
+	.loc 1 403 5 is_stmt 1 view .LVU1196
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL573:
+	.loc 1 404 5 view .LVU1197
+	movl	$0, %edi	#,
+	call	set_noallocate_mode@PLT	#
+.LVL574:
+	.loc 1 406 5 view .LVU1198
+	.loc 1 407 5 view .LVU1199
+# qtest.c:407:     if (q && src->q) {
+	.loc 1 407 8 is_stmt 0 view .LVU1200
+	cmpq	$0, q(%rip)	#, q
+	je	.L367	#,
+# qtest.c:407:     if (q && src->q) {
+	.loc 1 407 17 discriminator 1 view .LVU1201
+	movslq	%ebx, %rax	# i, i
+	salq	$5, %rax	#, tmp130
+	leaq	queues(%rip), %rdx	#, tmp128
+	movq	16(%rdx,%rax), %rax	# MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].q, _10
+# qtest.c:407:     if (q && src->q) {
+	.loc 1 407 11 discriminator 1 view .LVU1202
+	testq	%rax, %rax	# _10
+	je	.L367	#,
+	.loc 1 408 9 is_stmt 1 view .LVU1203
+# qtest.c:408:         if (src->q->head || src->q->tail) {
+	.loc 1 408 12 is_stmt 0 view .LVU1204
+	cmpq	$0, (%rax)	#, _10->head
+	je	.L379	#,
+.L368:
+	.loc 1 409 13 is_stmt 1 view .LVU1205
+# qtest.c:409:             report(1, "ERROR: Queue '%s' not empty after splice", src->name);
+	.loc 1 409 70 is_stmt 0 view .LVU1206
+	movslq	%ebx, %rbx	# i, i
+	.loc 1 409 70 view .LVU1207
+	salq	$5, %rbx	#, tmp134
+.LVL575:
+	.loc 1 409 70 view .LVU1208
+	leaq	queues(%rip), %rax	#, tmp136
+	addq	%rax, %rbx	# tmp136, tmp135
+# qtest.c:409:             report(1, "ERROR: Queue '%s' not empty after splice", src->name);
+	.loc 1 409 13 view .LVU1209
+	movq	%rbx, %rdx	# tmp135,
+	leaq	.LC98(%rip), %rsi	#, tmp137
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL576:
+	.loc 1 410 13 is_stmt 1 view .LVU1210
+	.loc 1 412 9 view .LVU1211
+# qtest.c:412:         qcnt += src->cnt;
+	.loc 1 412 14 is_stmt 0 view .LVU1212
+	movq	24(%rbx), %rax	# MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].cnt, MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].cnt
+	addq	%rax, qcnt(%rip)	# MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].cnt, qcnt
+	.loc 1 413 9 is_stmt 1 view .LVU1213
+# qtest.c:413:         src->cnt = 0;
+	.loc 1 413 18 is_stmt 0 view .LVU1214
+	movq	$0, 24(%rbx)	#, MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].cnt
+	.loc 1 416 5 is_stmt 1 view .LVU1215
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL577:
+	.loc 1 417 5 view .LVU1216
+# qtest.c:417:     return ok && !error_check();
+	.loc 1 417 15 is_stmt 0 view .LVU1217
+	movl	$0, %eax	#, iftmp.175_21
+.LVL578:
+.L370:
+# qtest.c:417:     return ok && !error_check();
+	.loc 1 417 15 discriminator 6 view .LVU1218
+	andl	$1, %eax	#, <retval>
+.LVL579:
+.L359:
+# qtest.c:418: }
+	.loc 1 418 1 view .LVU1219
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL580:
+.L373:
+	.cfi_restore_state
+	.loc 1 380 9 is_stmt 1 view .LVU1220
+	movq	(%rsi), %rdx	# *argv_30(D), *argv_30(D)
+	leaq	.LC93(%rip), %rsi	#, tmp111
+.LVL581:
+	.loc 1 380 9 is_stmt 0 view .LVU1221
+	movl	$1, %edi	#,
+.LVL582:
+	.loc 1 380 9 view .LVU1222
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL583:
+	.loc 1 381 9 is_stmt 1 view .LVU1223
+# qtest.c:381:         return false;
+	.loc 1 381 16 is_stmt 0 view .LVU1224
+	movl	$0, %eax	#, <retval>
+	jmp	.L359	#
+.LVL584:
+.L374:
+	.loc 1 385 9 is_stmt 1 view .LVU1225
+	movq	%rbp, %rdx	# _2,
+	leaq	.LC94(%rip), %rsi	#, tmp112
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL585:
+	.loc 1 385 9 is_stmt 0 view .LVU1226
+	call	report@PLT	#
+.LVL586:
+	.loc 1 386 9 is_stmt 1 view .LVU1227
+# qtest.c:386:         return false;
+	.loc 1 386 16 is_stmt 0 view .LVU1228
+	movl	$0, %eax	#, <retval>
+	jmp	.L359	#
+.LVL587:
+.L375:
+	.loc 1 389 9 is_stmt 1 view .LVU1229
+	movq	%rbp, %rdx	# _2,
+	leaq	.LC95(%rip), %rsi	#, tmp113
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL588:
+	.loc 1 389 9 is_stmt 0 view .LVU1230
+	call	report@PLT	#
+.LVL589:
+	.loc 1 390 9 is_stmt 1 view .LVU1231
+# qtest.c:390:         return false;
+	.loc 1 390 16 is_stmt 0 view .LVU1232
+	movl	$0, %eax	#, <retval>
+	jmp	.L359	#
+.LVL590:
+.L376:
+	.loc 1 395 9 is_stmt 1 view .LVU1233
+	leaq	.LC96(%rip), %rsi	#, tmp114
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+.LVL591:
+	.loc 1 395 9 is_stmt 0 view .LVU1234
+	call	report@PLT	#
+.LVL592:
+	jmp	.L364	#
+.L377:
+	.loc 1 397 9 is_stmt 1 view .LVU1235
+	leaq	.LC97(%rip), %rsi	#, tmp120
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL593:
+	jmp	.L365	#
+.L378:
+	.loc 1 402 9 view .LVU1236
+	movslq	%ebx, %rax	# i, i
+	salq	$5, %rax	#, tmp123
+	leaq	queues(%rip), %rdx	#, tmp121
+	movq	16(%rdx,%rax), %rsi	# MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].q, MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].q
+	movq	q(%rip), %rdi	# q,
+	call	q_splice@PLT	#
+.LVL594:
+	jmp	.L366	#
+.LVL595:
+.L379:
+# qtest.c:408:         if (src->q->head || src->q->tail) {
+	.loc 1 408 26 is_stmt 0 discriminator 1 view .LVU1237
+	cmpq	$0, 8(%rax)	#, _10->tail
+	jne	.L368	#,
+	.loc 1 412 9 is_stmt 1 view .LVU1238
+# qtest.c:412:         qcnt += src->cnt;
+	.loc 1 412 20 is_stmt 0 view .LVU1239
+	movslq	%ebx, %rax	# i, i
+	salq	$5, %rax	#, tmp153
+	leaq	queues(%rip), %rdx	#, tmp151
+	addq	%rdx, %rax	# tmp151, tmp154
+# qtest.c:412:         qcnt += src->cnt;
+	.loc 1 412 14 view .LVU1240
+	movq	24(%rax), %rdx	# MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].cnt, MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].cnt
+	addq	%rdx, qcnt(%rip)	# MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].cnt, qcnt
+	.loc 1 413 9 is_stmt 1 view .LVU1241
+# qtest.c:413:         src->cnt = 0;
+	.loc 1 413 18 is_stmt 0 view .LVU1242
+	movq	$0, 24(%rax)	#, MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][i_32].cnt
+	.loc 1 416 5 is_stmt 1 view .LVU1243
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL596:
+	.loc 1 417 5 view .LVU1244
+	jmp	.L371	#
+.L367:
+	.loc 1 416 5 view .LVU1245
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL597:
+	.loc 1 417 5 view .LVU1246
+.L371:
+# qtest.c:417:     return ok && !error_check();
+	.loc 1 417 19 is_stmt 0 discriminator 1 view .LVU1247
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL598:
+# qtest.c:417:     return ok && !error_check();
+	.loc 1 417 15 discriminator 1 view .LVU1248
+	xorl	$1, %eax	#, tmp149
+	movzbl	%al, %eax	# tmp149, iftmp.175_21
+	jmp	.L370	#
+	.cfi_endproc
+.LFE37:
+	.size	do_splice, .-do_splice
+	.section	.rodata.str1.8
+	.align 8
+.LC99:
+	.string	"Warning: Calling sort on null queue"
+	.align 8
+.LC100:
+	.string	"Warning: Calling sort on single node"
+	.align 8
+.LC101:
+	.string	"ERROR: Not sorted in ascending order"
+	.text
+	.type	do_sort, @function
+do_sort:
+.LVL599:
+.LFB51:
+	.loc 1 1001 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1001 1 is_stmt 0 view .LVU1250
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 1002 5 is_stmt 1 view .LVU1251
+# qtest.c:1002:     if (argc != 1) {
+	.loc 1 1002 8 is_stmt 0 view .LVU1252
+	cmpl	$1, %edi	#, tmp111
+	jne	.L394	#,
+	.loc 1 1007 5 is_stmt 1 view .LVU1253
+# qtest.c:1007:     if (!q)
+	.loc 1 1007 8 is_stmt 0 view .LVU1254
+	cmpq	$0, q(%rip)	#, q
+	je	.L395	#,
+.LVL600:
+.L383:
+	.loc 1 1009 5 is_stmt 1 view .LVU1255
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL601:
+	.loc 1 1011 5 view .LVU1256
+# qtest.c:1011:     int cnt = q_size(q);
+	.loc 1 1011 15 is_stmt 0 view .LVU1257
+	movq	q(%rip), %rdi	# q,
+	call	q_size@PLT	#
+.LVL602:
+	movl	%eax, %ebx	# tmp113, cnt
+.LVL603:
+	.loc 1 1012 5 is_stmt 1 view .LVU1258
+# qtest.c:1012:     if (cnt < 2)
+	.loc 1 1012 8 is_stmt 0 view .LVU1259
+	cmpl	$1, %eax	#, cnt
+	jle	.L396	#,
+.LVL604:
+.L384:
+	.loc 1 1014 5 is_stmt 1 view .LVU1260
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL605:
+	.loc 1 1016 5 view .LVU1261
+	movl	$1, %edi	#,
+	call	set_noallocate_mode@PLT	#
+.LVL606:
+	.loc 1 1017 5 view .LVU1262
+# qtest.c:1017:     if (exception_setup(true))
+	.loc 1 1017 9 is_stmt 0 view .LVU1263
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL607:
+# qtest.c:1017:     if (exception_setup(true))
+	.loc 1 1017 8 view .LVU1264
+	testb	%al, %al	# tmp114
+	jne	.L397	#,
+.L385:
+	.loc 1 1019 5 is_stmt 1 view .LVU1265
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL608:
+	.loc 1 1020 5 view .LVU1266
+	movl	$0, %edi	#,
+	call	set_noallocate_mode@PLT	#
+.LVL609:
+	.loc 1 1022 5 view .LVU1267
+	.loc 1 1023 5 view .LVU1268
+# qtest.c:1023:     if (q) {
+	.loc 1 1023 9 is_stmt 0 view .LVU1269
+	movq	q(%rip), %rax	# q, q.81_6
+# qtest.c:1023:     if (q) {
+	.loc 1 1023 8 view .LVU1270
+	testq	%rax, %rax	# q.81_6
+	je	.L386	#,
+	.loc 1 1024 9 is_stmt 1 view .LVU1271
+.LBB127:
+	.loc 1 1024 14 view .LVU1272
+# qtest.c:1024:         for (list_ele_t *e = q->head; e && --cnt; e = e->next) {
+	.loc 1 1024 26 is_stmt 0 view .LVU1273
+	movq	(%rax), %rax	# q.81_6->head, e
+.LVL610:
+.L387:
+	.loc 1 1024 41 is_stmt 1 discriminator 1 view .LVU1274
+	testq	%rax, %rax	# e
+	je	.L389	#,
+.LVL611:
+# qtest.c:1024:         for (list_ele_t *e = q->head; e && --cnt; e = e->next) {
+	.loc 1 1024 41 is_stmt 0 discriminator 3 view .LVU1275
+	subl	$1, %ebx	#, cnt
+.LVL612:
+	.loc 1 1024 41 discriminator 3 view .LVU1276
+	je	.L389	#,
+	.loc 1 1027 13 is_stmt 1 view .LVU1277
+# qtest.c:1027:             if (strcasecmp(e->value, e->next->value) > 0) {
+	.loc 1 1027 39 is_stmt 0 view .LVU1278
+	movq	8(%rax), %rbp	# e_14->next, _7
+# qtest.c:1027:             if (strcasecmp(e->value, e->next->value) > 0) {
+	.loc 1 1027 17 view .LVU1279
+	movq	0(%rbp), %rsi	# _7->value, _7->value
+	movq	(%rax), %rdi	# e_14->value, e_14->value
+	call	strcasecmp@PLT	#
+.LVL613:
+# qtest.c:1027:             if (strcasecmp(e->value, e->next->value) > 0) {
+	.loc 1 1027 16 view .LVU1280
+	testl	%eax, %eax	# tmp115
+	jg	.L398	#,
+# qtest.c:1024:         for (list_ele_t *e = q->head; e && --cnt; e = e->next) {
+	.loc 1 1024 53 view .LVU1281
+	movq	%rbp, %rax	# _7, e
+	jmp	.L387	#
+.LVL614:
+.L394:
+	.loc 1 1024 53 view .LVU1282
+.LBE127:
+	.loc 1 1003 9 is_stmt 1 view .LVU1283
+	movq	(%rsi), %rdx	# *argv_42(D), *argv_42(D)
+	leaq	.LC0(%rip), %rsi	#, tmp101
+.LVL615:
+	.loc 1 1003 9 is_stmt 0 view .LVU1284
+	movl	$1, %edi	#,
+.LVL616:
+	.loc 1 1003 9 view .LVU1285
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL617:
+	.loc 1 1004 9 is_stmt 1 view .LVU1286
+# qtest.c:1004:         return false;
+	.loc 1 1004 16 is_stmt 0 view .LVU1287
+	movl	$0, %eax	#, <retval>
+	jmp	.L380	#
+.LVL618:
+.L395:
+	.loc 1 1008 9 is_stmt 1 view .LVU1288
+	leaq	.LC99(%rip), %rsi	#, tmp102
+.LVL619:
+	.loc 1 1008 9 is_stmt 0 view .LVU1289
+	movl	$3, %edi	#,
+.LVL620:
+	.loc 1 1008 9 view .LVU1290
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL621:
+	jmp	.L383	#
+.LVL622:
+.L396:
+	.loc 1 1013 9 is_stmt 1 view .LVU1291
+	leaq	.LC100(%rip), %rsi	#, tmp104
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+.LVL623:
+	.loc 1 1013 9 is_stmt 0 view .LVU1292
+	call	report@PLT	#
+.LVL624:
+	jmp	.L384	#
+.L397:
+	.loc 1 1018 9 is_stmt 1 view .LVU1293
+	movq	q(%rip), %rdi	# q,
+	call	q_sort@PLT	#
+.LVL625:
+	jmp	.L385	#
+.LVL626:
+.L398:
+.LBB128:
+	.loc 1 1028 17 view .LVU1294
+	leaq	.LC101(%rip), %rsi	#, tmp108
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL627:
+	.loc 1 1029 17 view .LVU1295
+	.loc 1 1030 17 view .LVU1296
+	.loc 1 1030 17 is_stmt 0 view .LVU1297
+.LBE128:
+	.loc 1 1035 5 is_stmt 1 view .LVU1298
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL628:
+	.loc 1 1036 5 view .LVU1299
+# qtest.c:1036:     return ok && !error_check();
+	.loc 1 1036 15 is_stmt 0 view .LVU1300
+	movl	$0, %eax	#, iftmp.83_16
+	jmp	.L388	#
+.LVL629:
+.L389:
+	.loc 1 1035 5 is_stmt 1 view .LVU1301
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL630:
+	.loc 1 1036 5 view .LVU1302
+.L391:
+# qtest.c:1036:     return ok && !error_check();
+	.loc 1 1036 19 is_stmt 0 discriminator 1 view .LVU1303
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL631:
+# qtest.c:1036:     return ok && !error_check();
+	.loc 1 1036 15 discriminator 1 view .LVU1304
+	xorl	$1, %eax	#, tmp109
+	movzbl	%al, %eax	# tmp109, iftmp.83_16
+.LVL632:
+.L388:
+# qtest.c:1036:     return ok && !error_check();
+	.loc 1 1036 15 discriminator 6 view .LVU1305
+	andl	$1, %eax	#, <retval>
+.LVL633:
+.L380:
+# qtest.c:1037: }
+	.loc 1 1037 1 view .LVU1306
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL634:
+.L386:
+	.cfi_restore_state
+	.loc 1 1035 5 is_stmt 1 view .LVU1307
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL635:
+	.loc 1 1036 5 view .LVU1308
+	jmp	.L391	#
+	.cfi_endproc
+.LFE51:
+	.size	do_sort, .-do_sort
+	.type	check_sorted, @function
+check_sorted:
+.LVL636:
+.LFB39:
+	.loc 1 438 1 view -0
+	.cfi_startproc
+	.loc 1 438 1 is_stmt 0 view .LVU1310
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 439 5 is_stmt 1 view .LVU1311
+.LVL637:
+	.loc 1 440 5 view .LVU1312
+# qtest.c:441:         return true;
+	.loc 1 441 16 is_stmt 0 view .LVU1313
+	movl	$1, %r12d	#, <retval>
+# qtest.c:440:     if (!q)
+	.loc 1 440 8 view .LVU1314
+	testq	%rdi, %rdi	# q
+	je	.L399	#,
+	movq	%rdi, %rbp	# tmp94, q
+	movq	%rsi, %rbx	# tmp95, cnt
+	.loc 1 442 5 is_stmt 1 view .LVU1315
+# qtest.c:442:     if (exception_setup(true)) {
+	.loc 1 442 9 is_stmt 0 view .LVU1316
+	movl	$1, %edi	#,
+.LVL638:
+	.loc 1 442 9 view .LVU1317
+	call	exception_setup@PLT	#
+.LVL639:
+	.loc 1 442 9 view .LVU1318
+	movl	%eax, %r12d	# tmp96, <retval>
+# qtest.c:442:     if (exception_setup(true)) {
+	.loc 1 442 8 view .LVU1319
+	testb	%al, %al	# <retval>
+	je	.L405	#,
+	.loc 1 443 9 is_stmt 1 view .LVU1320
+.LBB129:
+	.loc 1 443 14 view .LVU1321
+# qtest.c:443:         for (list_ele_t *e = q->head; e && --cnt; e = e->next) {
+	.loc 1 443 26 is_stmt 0 view .LVU1322
+	movq	0(%rbp), %rax	# q_12(D)->head, e
+.LVL640:
+.L402:
+	.loc 1 443 41 is_stmt 1 discriminator 1 view .LVU1323
+	testq	%rax, %rax	# e
+	je	.L401	#,
+.LVL641:
+# qtest.c:443:         for (list_ele_t *e = q->head; e && --cnt; e = e->next) {
+	.loc 1 443 41 is_stmt 0 discriminator 3 view .LVU1324
+	subq	$1, %rbx	#, cnt
+.LVL642:
+	.loc 1 443 41 discriminator 3 view .LVU1325
+	je	.L401	#,
+	.loc 1 445 13 is_stmt 1 view .LVU1326
+# qtest.c:445:             if (strcasecmp(e->value, e->next->value) > 0) {
+	.loc 1 445 39 is_stmt 0 view .LVU1327
+	movq	8(%rax), %rbp	# e_8->next, _2
+# qtest.c:445:             if (strcasecmp(e->value, e->next->value) > 0) {
+	.loc 1 445 17 view .LVU1328
+	movq	0(%rbp), %rsi	# _2->value, _2->value
+	movq	(%rax), %rdi	# e_8->value, e_8->value
+	call	strcasecmp@PLT	#
+.LVL643:
+# qtest.c:445:             if (strcasecmp(e->value, e->next->value) > 0) {
+	.loc 1 445 16 view .LVU1329
+	testl	%eax, %eax	# tmp97
+	jg	.L408	#,
+# qtest.c:443:         for (list_ele_t *e = q->head; e && --cnt; e = e->next) {
+	.loc 1 443 53 view .LVU1330
+	movq	%rbp, %rax	# _2, e
+	jmp	.L402	#
+.L408:
+	.loc 1 446 17 is_stmt 1 view .LVU1331
+	leaq	.LC101(%rip), %rsi	#, tmp92
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL644:
+	.loc 1 447 17 view .LVU1332
+	.loc 1 448 17 view .LVU1333
+# qtest.c:447:                 ok = false;
+	.loc 1 447 20 is_stmt 0 view .LVU1334
+	movl	$0, %r12d	#, <retval>
+# qtest.c:448:                 break;
+	.loc 1 448 17 view .LVU1335
+	jmp	.L401	#
+.LVL645:
+.L405:
+	.loc 1 448 17 view .LVU1336
+.LBE129:
+# qtest.c:439:     bool ok = true;
+	.loc 1 439 10 view .LVU1337
+	movl	$1, %r12d	#, <retval>
+.LVL646:
+.L401:
+	.loc 1 452 5 is_stmt 1 view .LVU1338
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL647:
+	.loc 1 453 5 view .LVU1339
+.L399:
+# qtest.c:454: }
+	.loc 1 454 1 is_stmt 0 view .LVU1340
+	movl	%r12d, %eax	# <retval>,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE39:
+	.size	check_sorted, .-check_sorted
+	.section	.rodata.str1.8
+	.align 8
+.LC102:
+	.string	"INTERNAL ERROR.  Could not allocate space for removed strings"
+	.align 8
+.LC103:
+	.string	"ERROR: Failed to store removed value"
+	.align 8
+.LC104:
+	.string	"ERROR: copying of string in remove_head overflowed destination buffer."
+	.section	.rodata.str1.1
+.LC105:
+	.string	"Removed %s from queue"
+.LC106:
+	.string	"Removal from queue failed"
+	.section	.rodata.str1.8
+	.align 8
+.LC107:
+	.string	"ERROR: Removal from queue failed (%d failures total)"
+	.align 8
+.LC108:
+	.string	"ERROR: Removed value %s != expected value %s"
+	.text
+	.type	do_remove_head, @function
+do_remove_head:
+.LVL648:
+.LFB47:
+	.loc 1 790 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 790 1 is_stmt 0 view .LVU1342
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 80
+	movl	%edi, %ebx	# tmp179, argc
+	movq	%rsi, 8(%rsp)	# tmp180, %sfp
+	.loc 1 791 5 is_stmt 1 view .LVU1343
+# qtest.c:791:     if (simulation)
+	.loc 1 791 9 is_stmt 0 view .LVU1344
+	movzbl	simulation(%rip), %r12d	# simulation, <retval>
+# qtest.c:791:     if (simulation)
+	.loc 1 791 8 view .LVU1345
+	testb	%r12b, %r12b	# <retval>
+	jne	.L435	#,
+	.loc 1 794 5 is_stmt 1 view .LVU1346
+# qtest.c:794:     if (argc != 1 && argc != 2) {
+	.loc 1 794 19 is_stmt 0 view .LVU1347
+	leal	-1(%rdi), %eax	#, tmp139
+# qtest.c:794:     if (argc != 1 && argc != 2) {
+	.loc 1 794 8 view .LVU1348
+	cmpl	$1, %eax	#, tmp139
+	ja	.L436	#,
+	.loc 1 799 5 is_stmt 1 view .LVU1349
+# qtest.c:799:     char *removes = malloc(string_length + STRINGPAD + 1);
+	.loc 1 799 54 is_stmt 0 view .LVU1350
+	movl	string_length(%rip), %r13d	# string_length, string_length.99_5
+	leal	1025(%r13), %edi	#, tmp142
+.LVL649:
+# qtest.c:799:     char *removes = malloc(string_length + STRINGPAD + 1);
+	.loc 1 799 21 view .LVU1351
+	movslq	%edi, %rdi	# tmp142, tmp143
+	call	malloc@PLT	#
+.LVL650:
+	.loc 1 799 21 view .LVU1352
+	movq	%rax, %rbp	# tmp182, removes
+.LVL651:
+	.loc 1 800 5 is_stmt 1 view .LVU1353
+# qtest.c:800:     if (!removes) {
+	.loc 1 800 8 is_stmt 0 view .LVU1354
+	testq	%rax, %rax	# removes
+	je	.L437	#,
+	.loc 1 806 5 is_stmt 1 view .LVU1355
+# qtest.c:806:     char *checks = malloc(string_length + 1);
+	.loc 1 806 41 is_stmt 0 view .LVU1356
+	leal	1(%r13), %r15d	#, tmp146
+# qtest.c:806:     char *checks = malloc(string_length + 1);
+	.loc 1 806 20 view .LVU1357
+	movslq	%r15d, %r15	# tmp146, _9
+	movq	%r15, %rdi	# _9,
+	call	malloc@PLT	#
+.LVL652:
+	.loc 1 806 20 view .LVU1358
+	movq	%rax, %r14	# tmp183, checks
+.LVL653:
+	.loc 1 807 5 is_stmt 1 view .LVU1359
+# qtest.c:807:     if (!checks) {
+	.loc 1 807 8 is_stmt 0 view .LVU1360
+	testq	%rax, %rax	# checks
+	je	.L438	#,
+	.loc 1 814 5 is_stmt 1 view .LVU1361
+.LVL654:
+	.loc 1 815 5 view .LVU1362
+	.loc 1 816 5 view .LVU1363
+# qtest.c:816:     if (check) {
+	.loc 1 816 8 is_stmt 0 view .LVU1364
+	cmpl	$1, %ebx	#, argc
+	jg	.L439	#,
+.LVL655:
+.L415:
+	.loc 1 821 5 is_stmt 1 view .LVU1365
+# qtest.c:821:     removes[0] = '\0';
+	.loc 1 821 16 is_stmt 0 view .LVU1366
+	movb	$0, 0(%rbp)	#, *removes_63
+	.loc 1 822 5 is_stmt 1 view .LVU1367
+# qtest.c:822:     memset(removes + 1, 'X', string_length + STRINGPAD - 1);
+	.loc 1 822 56 is_stmt 0 view .LVU1368
+	leal	1023(%r13), %edx	#, tmp154
+# qtest.c:822:     memset(removes + 1, 'X', string_length + STRINGPAD - 1);
+	.loc 1 822 5 view .LVU1369
+	movslq	%edx, %rdx	# tmp154, tmp155
+# qtest.c:822:     memset(removes + 1, 'X', string_length + STRINGPAD - 1);
+	.loc 1 822 20 view .LVU1370
+	leaq	1(%rbp), %rdi	#, tmp156
+# qtest.c:822:     memset(removes + 1, 'X', string_length + STRINGPAD - 1);
+	.loc 1 822 5 view .LVU1371
+	movl	$88, %esi	#,
+	call	memset@PLT	#
+.LVL656:
+	.loc 1 823 5 is_stmt 1 view .LVU1372
+# qtest.c:823:     removes[string_length + STRINGPAD] = '\0';
+	.loc 1 823 12 is_stmt 0 view .LVU1373
+	movslq	%r13d, %r13	# string_length.99_5, string_length.99_5
+# qtest.c:823:     removes[string_length + STRINGPAD] = '\0';
+	.loc 1 823 40 view .LVU1374
+	movb	$0, 1024(%rbp,%r13)	#, *_18
+	.loc 1 825 5 is_stmt 1 view .LVU1375
+# qtest.c:825:     if (!q)
+	.loc 1 825 9 is_stmt 0 view .LVU1376
+	movq	q(%rip), %rax	# q, q.105_19
+# qtest.c:825:     if (!q)
+	.loc 1 825 8 view .LVU1377
+	testq	%rax, %rax	# q.105_19
+	je	.L440	#,
+	.loc 1 827 10 is_stmt 1 view .LVU1378
+# qtest.c:827:     else if (!q->head)
+	.loc 1 827 13 is_stmt 0 view .LVU1379
+	cmpq	$0, (%rax)	#, q.105_19->head
+	je	.L441	#,
+.L417:
+	.loc 1 829 5 is_stmt 1 view .LVU1380
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL657:
+	.loc 1 831 5 view .LVU1381
+	.loc 1 832 5 view .LVU1382
+# qtest.c:832:     if (exception_setup(true))
+	.loc 1 832 9 is_stmt 0 view .LVU1383
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL658:
+# qtest.c:832:     if (exception_setup(true))
+	.loc 1 832 8 view .LVU1384
+	testb	%al, %al	# tmp184
+	jne	.L418	#,
+	.loc 1 834 5 is_stmt 1 view .LVU1385
+	call	exception_cancel@PLT	#
+.LVL659:
+	.loc 1 836 5 view .LVU1386
+.L419:
+	.loc 1 860 9 view .LVU1387
+# qtest.c:860:         fail_count++;
+	.loc 1 860 19 is_stmt 0 view .LVU1388
+	movl	fail_count(%rip), %eax	# fail_count, tmp192
+	leal	1(%rax), %edx	#, _40
+	movl	%edx, fail_count(%rip)	# _40, fail_count
+	.loc 1 861 9 is_stmt 1 view .LVU1389
+# qtest.c:861:         if (!check && fail_count < fail_limit) {
+	.loc 1 861 12 is_stmt 0 view .LVU1390
+	cmpl	$1, %ebx	#, argc
+	jg	.L428	#,
+# qtest.c:861:         if (!check && fail_count < fail_limit) {
+	.loc 1 861 20 discriminator 1 view .LVU1391
+	cmpl	fail_limit(%rip), %edx	# fail_limit, _40
+	jl	.L442	#,
+.L428:
+	.loc 1 864 13 is_stmt 1 view .LVU1392
+	leaq	.LC107(%rip), %rsi	#, tmp175
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL660:
+	.loc 1 866 13 view .LVU1393
+	.loc 1 870 5 view .LVU1394
+	.loc 1 876 5 view .LVU1395
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL661:
+	.loc 1 878 5 view .LVU1396
+	movq	%rbp, %rdi	# removes,
+	call	free@PLT	#
+.LVL662:
+	.loc 1 879 5 view .LVU1397
+	movq	%r14, %rdi	# checks,
+	call	free@PLT	#
+.LVL663:
+	.loc 1 880 5 view .LVU1398
+# qtest.c:880:     return ok && !error_check();
+	.loc 1 880 15 is_stmt 0 view .LVU1399
+	movl	$0, %eax	#, iftmp.118_51
+.LVL664:
+.L430:
+# qtest.c:880:     return ok && !error_check();
+	.loc 1 880 15 discriminator 6 view .LVU1400
+	movl	%eax, %r12d	# iftmp.118_51, <retval>
+	andl	$1, %r12d	#, <retval>
+.LVL665:
+.L409:
+# qtest.c:881: }
+	.loc 1 881 1 view .LVU1401
+	movl	%r12d, %eax	# <retval>,
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+.LVL666:
+	.loc 1 881 1 view .LVU1402
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL667:
+.L435:
+	.cfi_restore_state
+	.loc 1 792 9 is_stmt 1 view .LVU1403
+# qtest.c:792:         return simulate(argc, argv, test_remove_head);
+	.loc 1 792 16 is_stmt 0 view .LVU1404
+	movl	$3, %edx	#,
+	call	simulate	#
+.LVL668:
+	.loc 1 792 16 view .LVU1405
+	movl	%eax, %r12d	# tmp181, <retval>
+	jmp	.L409	#
+.LVL669:
+.L436:
+	.loc 1 795 9 is_stmt 1 view .LVU1406
+	movq	8(%rsp), %rax	# %sfp, argv
+	movq	(%rax), %rdx	# *argv_68(D), *argv_68(D)
+	leaq	.LC7(%rip), %rsi	#, tmp141
+.LVL670:
+	.loc 1 795 9 is_stmt 0 view .LVU1407
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL671:
+	.loc 1 796 9 is_stmt 1 view .LVU1408
+# qtest.c:796:         return false;
+	.loc 1 796 16 is_stmt 0 view .LVU1409
+	jmp	.L409	#
+.LVL672:
+.L437:
+	.loc 1 801 9 is_stmt 1 view .LVU1410
+	leaq	.LC102(%rip), %rsi	#, tmp145
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL673:
+	.loc 1 801 9 is_stmt 0 view .LVU1411
+	call	report@PLT	#
+.LVL674:
+	.loc 1 803 9 is_stmt 1 view .LVU1412
+# qtest.c:803:         return false;
+	.loc 1 803 16 is_stmt 0 view .LVU1413
+	jmp	.L409	#
+.LVL675:
+.L438:
+	.loc 1 808 9 is_stmt 1 view .LVU1414
+	leaq	.LC102(%rip), %rsi	#, tmp148
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL676:
+	.loc 1 808 9 is_stmt 0 view .LVU1415
+	call	report@PLT	#
+.LVL677:
+	.loc 1 810 9 is_stmt 1 view .LVU1416
+	movq	%rbp, %rdi	# removes,
+	call	free@PLT	#
+.LVL678:
+	.loc 1 811 9 view .LVU1417
+# qtest.c:811:         return false;
+	.loc 1 811 16 is_stmt 0 view .LVU1418
+	jmp	.L409	#
+.LVL679:
+.L439:
+	.loc 1 817 9 is_stmt 1 view .LVU1419
+	movq	8(%rsp), %rax	# %sfp, argv
+.LVL680:
+	.loc 1 817 9 is_stmt 0 view .LVU1420
+	movq	8(%rax), %rsi	# MEM[(char * *)argv_68(D) + 8B], MEM[(char * *)argv_68(D) + 8B]
+	movq	%r15, %rdx	# _9,
+	movq	%r14, %rdi	# checks,
+	call	strncpy@PLT	#
+.LVL681:
+	.loc 1 818 9 is_stmt 1 view .LVU1421
+# qtest.c:818:         checks[string_length] = '\0';
+	.loc 1 818 15 is_stmt 0 view .LVU1422
+	movslq	%r13d, %rax	# string_length.99_5, string_length.99_5
+# qtest.c:818:         checks[string_length] = '\0';
+	.loc 1 818 31 view .LVU1423
+	movb	$0, (%r14,%rax)	#, *_12
+	jmp	.L415	#
+.L440:
+	.loc 1 826 9 is_stmt 1 view .LVU1424
+	leaq	.LC72(%rip), %rsi	#, tmp158
+	movl	$3, %edi	#,
+	call	report@PLT	#
+.LVL682:
+	jmp	.L417	#
+.L441:
+	.loc 1 828 9 view .LVU1425
+	leaq	.LC73(%rip), %rsi	#, tmp159
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL683:
+	jmp	.L417	#
+.LVL684:
+.L418:
+	.loc 1 833 9 view .LVU1426
+# qtest.c:833:         rval = q_remove_head(q, removes, string_length + 1);
+	.loc 1 833 56 is_stmt 0 view .LVU1427
+	movl	string_length(%rip), %eax	# string_length, tmp191
+	leal	1(%rax), %edx	#, tmp160
+# qtest.c:833:         rval = q_remove_head(q, removes, string_length + 1);
+	.loc 1 833 16 view .LVU1428
+	movslq	%edx, %rdx	# tmp160, tmp162
+	movq	%rbp, %rsi	# removes,
+	movq	q(%rip), %rdi	# q,
+	call	q_remove_head@PLT	#
+.LVL685:
+	movl	%eax, %r13d	# tmp185, rval
+.LVL686:
+	.loc 1 834 5 is_stmt 1 view .LVU1429
+	movl	$0, %eax	#,
+.LVL687:
+	.loc 1 834 5 is_stmt 0 view .LVU1430
+	call	exception_cancel@PLT	#
+.LVL688:
+	.loc 1 836 5 is_stmt 1 view .LVU1431
+# qtest.c:836:     if (rval) {
+	.loc 1 836 8 is_stmt 0 view .LVU1432
+	testb	%r13b, %r13b	# rval
+	je	.L419	#,
+.LBB130:
+	.loc 1 837 9 is_stmt 1 view .LVU1433
+# qtest.c:837:         removes[string_length + STRINGPAD] = '\0';
+	.loc 1 837 16 is_stmt 0 view .LVU1434
+	movslq	string_length(%rip), %rax	# string_length, string_length
+# qtest.c:837:         removes[string_length + STRINGPAD] = '\0';
+	.loc 1 837 44 view .LVU1435
+	movb	$0, 1024(%rbp,%rax)	#, *_29
+	.loc 1 838 9 is_stmt 1 view .LVU1436
+# qtest.c:838:         if (removes[0] == '\0') {
+	.loc 1 838 12 is_stmt 0 view .LVU1437
+	cmpb	$0, 0(%rbp)	#, *removes_63
+	je	.L443	#,
+.LVL689:
+.L420:
+	.loc 1 847 9 is_stmt 1 view .LVU1438
+# qtest.c:847:         int i = string_length + 1;
+	.loc 1 847 31 is_stmt 0 view .LVU1439
+	movl	string_length(%rip), %esi	# string_length, string_length.110_31
+# qtest.c:847:         int i = string_length + 1;
+	.loc 1 847 13 view .LVU1440
+	leal	1(%rsi), %edx	#, i
+.LVL690:
+	.loc 1 848 9 is_stmt 1 view .LVU1441
+	.loc 1 848 48 view .LVU1442
+# qtest.c:848:         while ((i < string_length + STRINGPAD) && (removes[i] == 'X'))
+	.loc 1 848 19 is_stmt 0 view .LVU1443
+	leal	1023(%rsi), %ecx	#, _107
+	movslq	%edx, %rax	# i, i
+	addq	%rbp, %rax	# removes, ivtmp.450
+.L421:
+# qtest.c:848:         while ((i < string_length + STRINGPAD) && (removes[i] == 'X'))
+	.loc 1 848 48 discriminator 1 view .LVU1444
+	cmpb	$88, (%rax)	#, MEM[(char *)_113]
+	jne	.L422	#,
+	.loc 1 849 13 is_stmt 1 view .LVU1445
+# qtest.c:849:             i++;
+	.loc 1 849 14 is_stmt 0 view .LVU1446
+	addl	$1, %edx	#, i
+.LVL691:
+	.loc 1 848 48 is_stmt 1 view .LVU1447
+	addq	$1, %rax	#, ivtmp.450
+	cmpl	%ecx, %edx	# _107, i
+	jle	.L421	#,
+.L422:
+	.loc 1 850 9 view .LVU1448
+# qtest.c:850:         if (i != string_length + STRINGPAD) {
+	.loc 1 850 32 is_stmt 0 view .LVU1449
+	addl	$1024, %esi	#, tmp168
+# qtest.c:850:         if (i != string_length + STRINGPAD) {
+	.loc 1 850 12 view .LVU1450
+	cmpl	%edx, %esi	# i, tmp168
+	je	.L424	#,
+	.loc 1 851 13 is_stmt 1 view .LVU1451
+	leaq	.LC104(%rip), %rsi	#, tmp169
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL692:
+	.loc 1 854 13 view .LVU1452
+	.loc 1 858 9 view .LVU1453
+# qtest.c:858:         qcnt--;
+	.loc 1 858 13 is_stmt 0 view .LVU1454
+	subq	$1, qcnt(%rip)	#, qcnt
+	.loc 1 858 13 view .LVU1455
+.LBE130:
+	.loc 1 870 5 is_stmt 1 view .LVU1456
+.LVL693:
+.L425:
+	.loc 1 876 5 view .LVU1457
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL694:
+	.loc 1 878 5 view .LVU1458
+	movq	%rbp, %rdi	# removes,
+	call	free@PLT	#
+.LVL695:
+	.loc 1 879 5 view .LVU1459
+	movq	%r14, %rdi	# checks,
+	call	free@PLT	#
+.LVL696:
+	.loc 1 880 5 view .LVU1460
+# qtest.c:880:     return ok && !error_check();
+	.loc 1 880 15 is_stmt 0 view .LVU1461
+	movl	$0, %eax	#, iftmp.118_51
+	testb	%r12b, %r12b	# <retval>
+	je	.L430	#,
+	jmp	.L429	#
+.LVL697:
+.L443:
+.LBB131:
+	.loc 1 839 13 is_stmt 1 view .LVU1462
+	leaq	.LC103(%rip), %rsi	#, tmp166
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL698:
+	.loc 1 840 13 view .LVU1463
+# qtest.c:840:             ok = false;
+	.loc 1 840 16 is_stmt 0 view .LVU1464
+	movl	%r12d, %r13d	# <retval>, rval
+.LVL699:
+	.loc 1 840 16 view .LVU1465
+	jmp	.L420	#
+.LVL700:
+.L424:
+	.loc 1 856 13 is_stmt 1 view .LVU1466
+	movq	%rbp, %rdx	# removes,
+.LVL701:
+	.loc 1 856 13 is_stmt 0 view .LVU1467
+	leaq	.LC105(%rip), %rsi	#, tmp170
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL702:
+	.loc 1 858 9 is_stmt 1 view .LVU1468
+# qtest.c:858:         qcnt--;
+	.loc 1 858 13 is_stmt 0 view .LVU1469
+	subq	$1, qcnt(%rip)	#, qcnt
+	.loc 1 858 13 view .LVU1470
+.LBE131:
+	.loc 1 870 5 is_stmt 1 view .LVU1471
+# qtest.c:870:     if (ok && check && strcmp(removes, checks)) {
+	.loc 1 870 8 is_stmt 0 view .LVU1472
+	cmpl	$1, %ebx	#, argc
+	jle	.L433	#,
+	testb	%r13b, %r13b	# rval
+	je	.L433	#,
+# qtest.c:870:     if (ok && check && strcmp(removes, checks)) {
+	.loc 1 870 24 discriminator 1 view .LVU1473
+	movq	%r14, %rsi	# checks,
+	movq	%rbp, %rdi	# removes,
+	call	strcmp@PLT	#
+.LVL703:
+# qtest.c:870:     if (ok && check && strcmp(removes, checks)) {
+	.loc 1 870 21 discriminator 1 view .LVU1474
+	testl	%eax, %eax	# tmp186
+	jne	.L444	#,
+.LVL704:
+	.loc 1 876 5 is_stmt 1 view .LVU1475
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL705:
+	.loc 1 878 5 view .LVU1476
+	movq	%rbp, %rdi	# removes,
+	call	free@PLT	#
+.LVL706:
+	.loc 1 879 5 view .LVU1477
+	movq	%r14, %rdi	# checks,
+	call	free@PLT	#
+.LVL707:
+	.loc 1 880 5 view .LVU1478
+.L429:
+# qtest.c:880:     return ok && !error_check();
+	.loc 1 880 19 is_stmt 0 discriminator 1 view .LVU1479
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL708:
+# qtest.c:880:     return ok && !error_check();
+	.loc 1 880 15 discriminator 1 view .LVU1480
+	xorl	$1, %eax	#, tmp177
+	movzbl	%al, %eax	# tmp177, iftmp.118_51
+	jmp	.L430	#
+.LVL709:
+.L433:
+	.loc 1 880 15 discriminator 1 view .LVU1481
+	movl	%r13d, %r12d	# rval, <retval>
+	jmp	.L425	#
+.LVL710:
+.L442:
+	.loc 1 862 13 is_stmt 1 view .LVU1482
+	leaq	.LC106(%rip), %rsi	#, tmp174
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL711:
+	.loc 1 870 5 view .LVU1483
+	.loc 1 876 5 view .LVU1484
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL712:
+	.loc 1 878 5 view .LVU1485
+	movq	%rbp, %rdi	# removes,
+	call	free@PLT	#
+.LVL713:
+	.loc 1 879 5 view .LVU1486
+	movq	%r14, %rdi	# checks,
+	call	free@PLT	#
+.LVL714:
+	.loc 1 880 5 view .LVU1487
+	jmp	.L429	#
+.LVL715:
+.L444:
+	.loc 1 871 9 view .LVU1488
+	movq	%r14, %rcx	# checks,
+	movq	%rbp, %rdx	# removes,
+	leaq	.LC108(%rip), %rsi	#, tmp176
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL716:
+	.loc 1 873 9 view .LVU1489
+	.loc 1 876 5 view .LVU1490
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL717:
+	.loc 1 878 5 view .LVU1491
+	movq	%rbp, %rdi	# removes,
+	call	free@PLT	#
+.LVL718:
+	.loc 1 879 5 view .LVU1492
+	movq	%r14, %rdi	# checks,
+	call	free@PLT	#
+.LVL719:
+	.loc 1 880 5 view .LVU1493
+# qtest.c:880:     return ok && !error_check();
+	.loc 1 880 15 is_stmt 0 view .LVU1494
+	movl	$0, %eax	#, iftmp.118_51
+	jmp	.L430	#
+	.cfi_endproc
+.LFE47:
+	.size	do_remove_head, .-do_remove_head
+	.section	.rodata.str1.1
+.LC109:
+	.string	"%s needs 0-2 arguments"
+	.section	.rodata.str1.8
+	.align 8
+.LC110:
+	.string	"Invalid number of elements '%s', must be at least %d"
+	.align 8
+.LC111:
+	.string	"ERROR: Could not build queue of %d elements"
+	.align 8
+.LC112:
+	.string	"ERROR: Could not allocate queues"
+	.section	.rodata.str1.1
+.LC113:
+	.string	"Pairwise (ns/elem)"
+.LC114:
+	.string	"Heap (ns/elem)"
+.LC115:
+	.string	"Queues"
+.LC116:
+	.string	"%6s %18s %18s"
+	.section	.rodata.str1.8
+	.align 8
+.LC117:
+	.string	"ERROR: Could not complete merge benchmark"
+	.section	.rodata.str1.1
+.LC118:
+	.string	"%6d %18.1f %18.1f"
+	.text
+	.type	do_mergebench, @function
+do_mergebench:
+.LVL720:
+.LFB42:
+	.loc 1 531 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 531 1 is_stmt 0 view .LVU1496
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$3768, %rsp	#,
+	.cfi_def_cfa_offset 3824
+	movq	%rsi, %rbp	# tmp244, argv
+	.loc 1 532 5 is_stmt 1 view .LVU1497
+# qtest.c:532:     int n = 65536, trials = 5;
+	.loc 1 532 9 is_stmt 0 view .LVU1498
+	movl	$65536, 3756(%rsp)	#, n
+# qtest.c:532:     int n = 65536, trials = 5;
+	.loc 1 532 20 view .LVU1499
+	movl	$5, 3752(%rsp)	#, trials
+	.loc 1 533 5 is_stmt 1 view .LVU1500
+# qtest.c:533:     if (argc > 3) {
+	.loc 1 533 8 is_stmt 0 view .LVU1501
+	cmpl	$3, %edi	#, argc
+	jg	.L497	#,
+	movl	%edi, %ebx	# tmp243, argc
+	.loc 1 537 5 is_stmt 1 view .LVU1502
+# qtest.c:537:     if (argc > 1 && (!get_int(argv[1], &n) || n < MERGE_MAX_K)) {
+	.loc 1 537 8 is_stmt 0 view .LVU1503
+	cmpl	$1, %edi	#, argc
+	jle	.L448	#,
+# qtest.c:537:     if (argc > 1 && (!get_int(argv[1], &n) || n < MERGE_MAX_K)) {
+	.loc 1 537 23 discriminator 1 view .LVU1504
+	leaq	3756(%rsp), %rsi	#, tmp165
+.LVL721:
+	.loc 1 537 23 discriminator 1 view .LVU1505
+	movq	8(%rbp), %rdi	# MEM[(char * *)argv_90(D) + 8B], MEM[(char * *)argv_90(D) + 8B]
+.LVL722:
+	.loc 1 537 23 discriminator 1 view .LVU1506
+	call	get_int@PLT	#
+.LVL723:
+# qtest.c:537:     if (argc > 1 && (!get_int(argv[1], &n) || n < MERGE_MAX_K)) {
+	.loc 1 537 18 discriminator 1 view .LVU1507
+	testb	%al, %al	# tmp245
+	je	.L449	#,
+# qtest.c:537:     if (argc > 1 && (!get_int(argv[1], &n) || n < MERGE_MAX_K)) {
+	.loc 1 537 44 discriminator 2 view .LVU1508
+	cmpl	$255, 3756(%rsp)	#, n
+	jle	.L449	#,
+	.loc 1 542 5 is_stmt 1 view .LVU1509
+# qtest.c:542:     if (argc > 2 && (!get_int(argv[2], &trials) || trials < 1 ||
+	.loc 1 542 8 is_stmt 0 view .LVU1510
+	cmpl	$3, %ebx	#, argc
+	je	.L498	#,
+.L448:
+	.loc 1 548 5 is_stmt 1 view .LVU1511
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL724:
+	.loc 1 550 5 view .LVU1512
+# qtest.c:550:     queue_t *qs[MERGE_MAX_K] = {NULL};
+	.loc 1 550 14 is_stmt 0 view .LVU1513
+	leaq	1696(%rsp), %rdi	#, tmp175
+	movl	$256, %ecx	#, tmp177
+	movl	$0, %eax	#, tmp176
+	rep stosq
+	.loc 1 551 5 is_stmt 1 view .LVU1514
+.LVL725:
+	.loc 1 552 5 view .LVU1515
+	.loc 1 553 5 view .LVU1516
+	.loc 1 554 5 view .LVU1517
+	.loc 1 557 5 view .LVU1518
+	movl	$0, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL726:
+	.loc 1 558 5 view .LVU1519
+# qtest.c:558:     if (exception_setup(false)) {
+	.loc 1 558 9 is_stmt 0 view .LVU1520
+	movl	$0, %edi	#,
+	call	exception_setup@PLT	#
+.LVL727:
+	movl	%eax, %ebx	# tmp247, _11
+.LVL728:
+# qtest.c:551:     queue_t *all = NULL;
+	.loc 1 551 14 view .LVU1521
+	movl	$0, %r13d	#, all
+# qtest.c:558:     if (exception_setup(false)) {
+	.loc 1 558 8 view .LVU1522
+	testb	%al, %al	# _11
+	jne	.L499	#,
+.LVL729:
+.L452:
+	.loc 1 605 5 is_stmt 1 view .LVU1523
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL730:
+	.loc 1 606 5 view .LVU1524
+# qtest.c:606:     if (exception_setup(false)) {
+	.loc 1 606 9 is_stmt 0 view .LVU1525
+	movl	$0, %edi	#,
+	call	exception_setup@PLT	#
+.LVL731:
+# qtest.c:606:     if (exception_setup(false)) {
+	.loc 1 606 8 view .LVU1526
+	testb	%al, %al	# tmp260
+	jne	.L500	#,
+	.loc 1 611 5 is_stmt 1 view .LVU1527
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL732:
+	.loc 1 612 5 view .LVU1528
+	movl	$1, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL733:
+	.loc 1 613 5 view .LVU1529
+.L472:
+	.loc 1 614 9 view .LVU1530
+	leaq	.LC117(%rip), %rsi	#, tmp232
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL734:
+	.loc 1 615 5 view .LVU1531
+# qtest.c:615:     return ok && !error_check();
+	.loc 1 615 15 is_stmt 0 view .LVU1532
+	movl	$0, %eax	#, iftmp.159_69
+	jmp	.L473	#
+.LVL735:
+.L497:
+	.loc 1 534 9 is_stmt 1 view .LVU1533
+	movq	(%rsi), %rdx	# *argv_90(D), *argv_90(D)
+	leaq	.LC109(%rip), %rsi	#, tmp164
+.LVL736:
+	.loc 1 534 9 is_stmt 0 view .LVU1534
+	movl	$1, %edi	#,
+.LVL737:
+	.loc 1 534 9 view .LVU1535
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL738:
+	.loc 1 535 9 is_stmt 1 view .LVU1536
+# qtest.c:535:         return false;
+	.loc 1 535 16 is_stmt 0 view .LVU1537
+	movl	$0, %eax	#, <retval>
+	jmp	.L445	#
+.LVL739:
+.L449:
+	.loc 1 538 9 is_stmt 1 view .LVU1538
+	movq	8(%rbp), %rdx	# MEM[(char * *)argv_90(D) + 8B], MEM[(char * *)argv_90(D) + 8B]
+	movl	$256, %ecx	#,
+	leaq	.LC110(%rip), %rsi	#, tmp168
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL740:
+	.loc 1 540 9 view .LVU1539
+# qtest.c:540:         return false;
+	.loc 1 540 16 is_stmt 0 view .LVU1540
+	movl	$0, %eax	#, <retval>
+	jmp	.L445	#
+.L498:
+# qtest.c:542:     if (argc > 2 && (!get_int(argv[2], &trials) || trials < 1 ||
+	.loc 1 542 23 discriminator 1 view .LVU1541
+	leaq	3752(%rsp), %rsi	#, tmp169
+	movq	16(%rbp), %rdi	# MEM[(char * *)argv_90(D) + 16B], MEM[(char * *)argv_90(D) + 16B]
+	call	get_int@PLT	#
+.LVL741:
+# qtest.c:542:     if (argc > 2 && (!get_int(argv[2], &trials) || trials < 1 ||
+	.loc 1 542 18 discriminator 1 view .LVU1542
+	testb	%al, %al	# tmp246
+	je	.L451	#,
+# qtest.c:542:     if (argc > 2 && (!get_int(argv[2], &trials) || trials < 1 ||
+	.loc 1 542 63 discriminator 2 view .LVU1543
+	movl	3752(%rsp), %eax	# trials, tmp266
+	subl	$1, %eax	#, tmp171
+	cmpl	$100, %eax	#, tmp171
+	jbe	.L448	#,
+.L451:
+	.loc 1 544 9 is_stmt 1 view .LVU1544
+	movq	16(%rbp), %rdx	# MEM[(char * *)argv_90(D) + 16B], MEM[(char * *)argv_90(D) + 16B]
+	movl	$101, %ecx	#,
+	leaq	.LC28(%rip), %rsi	#, tmp174
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL742:
+	.loc 1 546 9 view .LVU1545
+# qtest.c:546:         return false;
+	.loc 1 546 16 is_stmt 0 view .LVU1546
+	movl	$0, %eax	#, <retval>
+	jmp	.L445	#
+.LVL743:
+.L499:
+	.loc 1 559 9 is_stmt 1 view .LVU1547
+# qtest.c:559:         all = q_new();
+	.loc 1 559 15 is_stmt 0 view .LVU1548
+	movl	$0, %eax	#,
+	call	q_new@PLT	#
+.LVL744:
+	movq	%rax, %r13	# tmp248, all
+.LVL745:
+	.loc 1 560 9 is_stmt 1 view .LVU1549
+.LBB132:
+	.loc 1 560 14 view .LVU1550
+	.loc 1 560 29 view .LVU1551
+# qtest.c:560:         for (int i = 0; all && i < n; i++) {
+	.loc 1 560 18 is_stmt 0 view .LVU1552
+	movl	$0, %ebp	#, i
+.LVL746:
+# qtest.c:561:             fill_rand_string(randstr_buf, sizeof(randstr_buf));
+	.loc 1 561 13 view .LVU1553
+	leaq	54(%rsp), %r12	#, tmp242
+# qtest.c:560:         for (int i = 0; all && i < n; i++) {
+	.loc 1 560 29 view .LVU1554
+	testq	%rax, %rax	# all
+	je	.L454	#,
+.LVL747:
+.L453:
+# qtest.c:560:         for (int i = 0; all && i < n; i++) {
+	.loc 1 560 29 discriminator 3 view .LVU1555
+	cmpl	%ebp, 3756(%rsp)	# i, n
+	jle	.L501	#,
+	.loc 1 561 13 is_stmt 1 view .LVU1556
+	movl	$10, %esi	#,
+	movq	%r12, %rdi	# tmp242,
+	call	fill_rand_string	#
+.LVL748:
+	.loc 1 562 13 view .LVU1557
+# qtest.c:562:             if (!q_insert_head(all, randstr_buf)) {
+	.loc 1 562 18 is_stmt 0 view .LVU1558
+	movq	%r12, %rsi	# tmp242,
+	movq	%r13, %rdi	# all,
+	call	q_insert_head@PLT	#
+.LVL749:
+	movl	%eax, %ebx	# tmp249, _11
+# qtest.c:562:             if (!q_insert_head(all, randstr_buf)) {
+	.loc 1 562 16 view .LVU1559
+	testb	%al, %al	# _11
+	je	.L502	#,
+	.loc 1 560 40 is_stmt 1 discriminator 2 view .LVU1560
+	addl	$1, %ebp	#, i
+.LVL750:
+	.loc 1 560 29 discriminator 2 view .LVU1561
+	jmp	.L453	#
+.L502:
+	.loc 1 563 17 view .LVU1562
+	movl	3756(%rsp), %edx	# n,
+	leaq	.LC111(%rip), %rsi	#, tmp181
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL751:
+	.loc 1 564 17 view .LVU1563
+	.loc 1 565 17 view .LVU1564
+.L454:
+	.loc 1 565 17 is_stmt 0 view .LVU1565
+.LBE132:
+	.loc 1 568 9 is_stmt 1 view .LVU1566
+	movq	%r13, %rdi	# all,
+	call	q_sort@PLT	#
+.LVL752:
+	.loc 1 569 9 view .LVU1567
+.LBB133:
+	.loc 1 569 14 view .LVU1568
+	.loc 1 569 35 view .LVU1569
+	jmp	.L477	#
+.LVL753:
+.L501:
+	.loc 1 569 35 is_stmt 0 view .LVU1570
+.LBE133:
+	.loc 1 568 9 is_stmt 1 view .LVU1571
+	movq	%r13, %rdi	# all,
+	call	q_sort@PLT	#
+.LVL754:
+	.loc 1 569 9 view .LVU1572
+.LBB134:
+	.loc 1 569 14 view .LVU1573
+	.loc 1 569 35 view .LVU1574
+.LBE134:
+# qtest.c:568:         q_sort(all);
+	.loc 1 568 9 is_stmt 0 view .LVU1575
+	movl	$1, %ebp	#, ivtmp.487
+.LVL755:
+.L457:
+.LBB135:
+	.loc 1 570 13 is_stmt 1 discriminator 4 view .LVU1576
+# qtest.c:570:             ok = (qs[i] = q_new()) != NULL;
+	.loc 1 570 27 is_stmt 0 discriminator 4 view .LVU1577
+	movl	$0, %eax	#,
+	call	q_new@PLT	#
+.LVL756:
+# qtest.c:570:             ok = (qs[i] = q_new()) != NULL;
+	.loc 1 570 25 discriminator 4 view .LVU1578
+	movq	%rax, 1688(%rsp,%rbp,8)	# _14, MEM[(struct queue_t * *)&qs + -8B + ivtmp.487_79 * 8]
+# qtest.c:570:             ok = (qs[i] = q_new()) != NULL;
+	.loc 1 570 16 discriminator 4 view .LVU1579
+	testq	%rax, %rax	# _14
+	setne	%bl	#, _11
+.LVL757:
+	.loc 1 569 56 is_stmt 1 discriminator 4 view .LVU1580
+	.loc 1 569 35 discriminator 4 view .LVU1581
+	cmpl	$255, %ebp	#, ivtmp.487
+	setle	%al	#, tmp185
+	addq	$1, %rbp	#, ivtmp.487
+.LVL758:
+	.loc 1 569 35 is_stmt 0 discriminator 4 view .LVU1582
+	testb	%bl, %al	# _11, tmp185
+	jne	.L457	#,
+.LVL759:
+.L477:
+	.loc 1 569 35 discriminator 4 view .LVU1583
+.LBE135:
+	.loc 1 571 9 is_stmt 1 view .LVU1584
+# qtest.c:571:         if (!all || !ok) {
+	.loc 1 571 13 is_stmt 0 view .LVU1585
+	testq	%r13, %r13	# all
+	sete	%al	#, tmp187
+# qtest.c:571:         if (!all || !ok) {
+	.loc 1 571 21 view .LVU1586
+	xorl	$1, %ebx	#, tmp188
+.LVL760:
+# qtest.c:571:         if (!all || !ok) {
+	.loc 1 571 12 view .LVU1587
+	orb	%bl, %al	# tmp188, tmp187
+	movb	%al, 31(%rsp)	# tmp187, %sfp
+	jne	.L503	#,
+.LVL761:
+	.loc 1 576 9 is_stmt 1 view .LVU1588
+	leaq	.LC113(%rip), %r8	#,
+	leaq	.LC114(%rip), %rcx	#, tmp193
+	leaq	.LC115(%rip), %rdx	#, tmp194
+	leaq	.LC116(%rip), %rsi	#, tmp195
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL762:
+	.loc 1 578 9 view .LVU1589
+.LBB136:
+	.loc 1 578 14 view .LVU1590
+	.loc 1 578 28 view .LVU1591
+# qtest.c:578:         for (int k = 2; ok && k <= MERGE_MAX_K; k *= 2) {
+	.loc 1 578 18 is_stmt 0 view .LVU1592
+	movl	$2, %r15d	#, k
+	leaq	1712(%rsp), %rax	#, tmp229
+	movq	%rax, 16(%rsp)	# tmp229, %sfp
+.LBB137:
+.LBB138:
+# qtest.c:580:                 ok = merge_deal(all, qs, k);
+	.loc 1 580 22 view .LVU1593
+	leaq	1696(%rsp), %rax	#, tmp239
+	movq	%rax, (%rsp)	# tmp239, %sfp
+	jmp	.L459	#
+.LVL763:
+.L503:
+	.loc 1 580 22 view .LVU1594
+.LBE138:
+.LBE137:
+.LBE136:
+	.loc 1 572 13 is_stmt 1 view .LVU1595
+	leaq	.LC112(%rip), %rsi	#, tmp189
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL764:
+	.loc 1 573 13 view .LVU1596
+	.loc 1 576 9 view .LVU1597
+	leaq	.LC113(%rip), %r8	#,
+	leaq	.LC114(%rip), %rcx	#, tmp190
+	leaq	.LC115(%rip), %rdx	#, tmp191
+	leaq	.LC116(%rip), %rsi	#, tmp192
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL765:
+	.loc 1 578 9 view .LVU1598
+.LBB146:
+	.loc 1 578 14 view .LVU1599
+	.loc 1 578 28 view .LVU1600
+	jmp	.L452	#
+.LVL766:
+.L460:
+.LBB144:
+.LBB141:
+# qtest.c:583:                 heap_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 583 30 is_stmt 0 view .LVU1601
+	movq	%rax, %rcx	# tmp199, tmp202
+	shrq	%rcx	# tmp202
+	andl	$1, %eax	#, tmp203
+	orq	%rax, %rcx	# tmp203, tmp202
+	pxor	%xmm0, %xmm0	# tmp201
+	cvtsi2sdq	%rcx, %xmm0	# tmp202, tmp201
+	addsd	%xmm0, %xmm0	# tmp201, tmp200
+	jmp	.L461	#
+.L505:
+# qtest.c:586:                 ok = ok && check_sorted(all, n) && merge_deal(all, qs, k);
+	.loc 1 586 28 discriminator 1 view .LVU1602
+	movslq	3756(%rsp), %rsi	# n, n
+	movq	%r13, %rdi	# all,
+	call	check_sorted	#
+.LVL767:
+	movl	%eax, %edx	#, tmp254
+# qtest.c:586:                 ok = ok && check_sorted(all, n) && merge_deal(all, qs, k);
+	.loc 1 586 49 discriminator 1 view .LVU1603
+	movl	$0, %eax	#, iftmp.152_68
+# qtest.c:586:                 ok = ok && check_sorted(all, n) && merge_deal(all, qs, k);
+	.loc 1 586 25 discriminator 1 view .LVU1604
+	testb	%dl, %dl	# tmp254
+	je	.L462	#,
+# qtest.c:586:                 ok = ok && check_sorted(all, n) && merge_deal(all, qs, k);
+	.loc 1 586 52 discriminator 3 view .LVU1605
+	movl	%r15d, %edx	# k,
+	movq	(%rsp), %rsi	# %sfp,
+	movq	%r13, %rdi	# all,
+	call	merge_deal	#
+.LVL768:
+# qtest.c:586:                 ok = ok && check_sorted(all, n) && merge_deal(all, qs, k);
+	.loc 1 586 49 discriminator 3 view .LVU1606
+	movzbl	%al, %eax	# tmp255, iftmp.152_68
+	jmp	.L462	#
+.LVL769:
+.L465:
+# qtest.c:592:                 pair_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 592 30 view .LVU1607
+	movq	%rax, %rcx	# tmp215, tmp218
+	shrq	%rcx	# tmp218
+	andl	$1, %eax	#, tmp219
+	orq	%rax, %rcx	# tmp219, tmp218
+	pxor	%xmm0, %xmm0	# tmp217
+	cvtsi2sdq	%rcx, %xmm0	# tmp218, tmp217
+	addsd	%xmm0, %xmm0	# tmp217, tmp216
+	jmp	.L466	#
+.L506:
+# qtest.c:594:                 if (ok && !check_sorted(all, n))
+	.loc 1 594 28 discriminator 1 view .LVU1608
+	movslq	3756(%rsp), %rsi	# n, n
+	movq	%r13, %rdi	# all,
+	call	check_sorted	#
+.LVL770:
+# qtest.c:594:                 if (ok && !check_sorted(all, n))
+	.loc 1 594 24 discriminator 1 view .LVU1609
+	addq	$1, %r14	#, ivtmp.475
+.LVL771:
+	.loc 1 594 24 discriminator 1 view .LVU1610
+	testb	%al, %al	# tmp258
+	je	.L467	#,
+.LVL772:
+.L470:
+	.loc 1 594 24 discriminator 1 view .LVU1611
+.LBE141:
+# qtest.c:579:             for (int t = 0; ok && t < trials; t++) {
+	.loc 1 579 32 discriminator 3 view .LVU1612
+	cmpl	%r14d, 3752(%rsp)	# ivtmp.475, trials
+	jle	.L504	#,
+.LBB142:
+	.loc 1 580 17 is_stmt 1 view .LVU1613
+# qtest.c:580:                 ok = merge_deal(all, qs, k);
+	.loc 1 580 22 is_stmt 0 view .LVU1614
+	movl	%r15d, %edx	# k,
+	movq	(%rsp), %rsi	# %sfp,
+	movq	%r13, %rdi	# all,
+	call	merge_deal	#
+.LVL773:
+	movl	%eax, %ebp	# tmp251, ok
+.LVL774:
+	.loc 1 581 17 is_stmt 1 view .LVU1615
+# qtest.c:581:                 uint64_t start = time_ns();
+	.loc 1 581 34 is_stmt 0 view .LVU1616
+	movl	$0, %eax	#,
+.LVL775:
+	.loc 1 581 34 view .LVU1617
+	call	time_ns@PLT	#
+.LVL776:
+	movq	%rax, %rbx	# tmp252, start
+.LVL777:
+	.loc 1 582 17 is_stmt 1 view .LVU1618
+	movl	%r15d, %esi	# k,
+	movq	(%rsp), %rdi	# %sfp,
+	call	q_merge_k@PLT	#
+.LVL778:
+	.loc 1 583 17 view .LVU1619
+# qtest.c:583:                 heap_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 583 40 is_stmt 0 view .LVU1620
+	movl	$0, %eax	#,
+	call	time_ns@PLT	#
+.LVL779:
+# qtest.c:583:                 heap_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 583 28 view .LVU1621
+	leaq	880(%rsp), %rdx	#, tmp198
+# qtest.c:583:                 heap_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 583 30 view .LVU1622
+	subq	%rbx, %rax	# start, tmp199
+	js	.L460	#,
+	.loc 1 583 30 view .LVU1623
+	pxor	%xmm0, %xmm0	# tmp200
+	cvtsi2sdq	%rax, %xmm0	# tmp199, tmp200
+.L461:
+# qtest.c:583:                 heap_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 583 59 view .LVU1624
+	pxor	%xmm1, %xmm1	# tmp204
+	cvtsi2sdl	3756(%rsp), %xmm1	# n, tmp204
+	divsd	%xmm1, %xmm0	# tmp204, tmp205
+# qtest.c:583:                 heap_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 583 28 view .LVU1625
+	movsd	%xmm0, (%rdx,%r14,8)	# tmp205, MEM[(double *)&heap_ns + ivtmp.475_53 * 8]
+	.loc 1 585 17 is_stmt 1 view .LVU1626
+	movq	1696(%rsp), %rsi	# qs[0],
+	movq	%r13, %rdi	# all,
+	call	q_splice@PLT	#
+.LVL780:
+	.loc 1 586 17 view .LVU1627
+# qtest.c:586:                 ok = ok && check_sorted(all, n) && merge_deal(all, qs, k);
+	.loc 1 586 49 is_stmt 0 view .LVU1628
+	movl	$0, %eax	#, iftmp.152_68
+	testb	%bpl, %bpl	# ok
+	jne	.L505	#,
+.L462:
+# qtest.c:586:                 ok = ok && check_sorted(all, n) && merge_deal(all, qs, k);
+	.loc 1 586 20 discriminator 8 view .LVU1629
+	andl	$1, %eax	#, ok
+	movb	%al, 30(%rsp)	# ok, %sfp
+.LVL781:
+	.loc 1 587 17 is_stmt 1 discriminator 8 view .LVU1630
+# qtest.c:587:                 start = time_ns();
+	.loc 1 587 25 is_stmt 0 discriminator 8 view .LVU1631
+	movl	$0, %eax	#,
+.LVL782:
+	.loc 1 587 25 discriminator 8 view .LVU1632
+	call	time_ns@PLT	#
+.LVL783:
+	movq	%rax, 8(%rsp)	# tmp256, %sfp
+.LVL784:
+	.loc 1 588 17 is_stmt 1 discriminator 8 view .LVU1633
+.LBB139:
+	.loc 1 588 22 discriminator 8 view .LVU1634
+	.loc 1 588 35 discriminator 8 view .LVU1635
+	cmpl	$1, %r15d	#, k
+	jle	.L463	#,
+	leaq	1704(%rsp), %rbx	#, ivtmp.469
+.LBB140:
+# qtest.c:590:                     q_merge_k(pair, 2);
+	.loc 1 590 21 is_stmt 0 view .LVU1636
+	leaq	32(%rsp), %rbp	#, tmp213
+.LVL785:
+.L464:
+	.loc 1 589 21 is_stmt 1 discriminator 3 view .LVU1637
+# qtest.c:589:                     queue_t *pair[2] = {qs[0], qs[i]};
+	.loc 1 589 30 is_stmt 0 discriminator 3 view .LVU1638
+	movq	1696(%rsp), %rax	# qs[0], qs[0]
+	movq	%rax, 32(%rsp)	# qs[0], pair[0]
+	movq	(%rbx), %rax	# MEM[(struct queue_t * *)_15], MEM[(struct queue_t * *)_15]
+	movq	%rax, 40(%rsp)	# MEM[(struct queue_t * *)_15], pair[1]
+	.loc 1 590 21 is_stmt 1 discriminator 3 view .LVU1639
+	movl	$2, %esi	#,
+	movq	%rbp, %rdi	# tmp213,
+	call	q_merge_k@PLT	#
+.LVL786:
+.LBE140:
+	.loc 1 588 41 discriminator 3 view .LVU1640
+	.loc 1 588 35 discriminator 3 view .LVU1641
+	addq	$8, %rbx	#, ivtmp.469
+.LVL787:
+	.loc 1 588 35 is_stmt 0 discriminator 3 view .LVU1642
+	cmpq	%r12, %rbx	# _168, ivtmp.469
+	jne	.L464	#,
+.LVL788:
+.L463:
+	.loc 1 588 35 discriminator 3 view .LVU1643
+.LBE139:
+	.loc 1 592 17 is_stmt 1 view .LVU1644
+# qtest.c:592:                 pair_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 592 40 is_stmt 0 view .LVU1645
+	movl	$0, %eax	#,
+	call	time_ns@PLT	#
+.LVL789:
+# qtest.c:592:                 pair_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 592 28 view .LVU1646
+	leaq	64(%rsp), %rdx	#, tmp214
+# qtest.c:592:                 pair_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 592 30 view .LVU1647
+	movq	8(%rsp), %rcx	# %sfp, start
+	subq	%rcx, %rax	# start, tmp215
+	js	.L465	#,
+	pxor	%xmm0, %xmm0	# tmp216
+	cvtsi2sdq	%rax, %xmm0	# tmp215, tmp216
+.L466:
+# qtest.c:592:                 pair_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 592 59 view .LVU1648
+	pxor	%xmm1, %xmm1	# tmp220
+	cvtsi2sdl	3756(%rsp), %xmm1	# n, tmp220
+	divsd	%xmm1, %xmm0	# tmp220, tmp221
+# qtest.c:592:                 pair_ns[t] = (double) (time_ns() - start) / n;
+	.loc 1 592 28 view .LVU1649
+	movsd	%xmm0, (%rdx,%r14,8)	# tmp221, MEM[(double *)&pair_ns + ivtmp.475_53 * 8]
+	.loc 1 593 17 is_stmt 1 view .LVU1650
+	movq	1696(%rsp), %rsi	# qs[0],
+	movq	%r13, %rdi	# all,
+	call	q_splice@PLT	#
+.LVL790:
+	.loc 1 594 17 view .LVU1651
+# qtest.c:594:                 if (ok && !check_sorted(all, n))
+	.loc 1 594 20 is_stmt 0 view .LVU1652
+	cmpb	$0, 30(%rsp)	#, %sfp
+	jne	.L506	#,
+.LVL791:
+.L467:
+	.loc 1 594 20 view .LVU1653
+.LBE142:
+	.loc 1 579 48 is_stmt 1 view .LVU1654
+	.loc 1 579 32 view .LVU1655
+.LBE144:
+	.loc 1 597 13 view .LVU1656
+	.loc 1 597 13 is_stmt 0 view .LVU1657
+.LBE146:
+	.loc 1 605 5 is_stmt 1 view .LVU1658
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL792:
+	.loc 1 606 5 view .LVU1659
+# qtest.c:606:     if (exception_setup(false)) {
+	.loc 1 606 9 is_stmt 0 view .LVU1660
+	movl	$0, %edi	#,
+	call	exception_setup@PLT	#
+.LVL793:
+# qtest.c:606:     if (exception_setup(false)) {
+	.loc 1 606 8 view .LVU1661
+	testb	%al, %al	# tmp261
+	je	.L507	#,
+.LVL794:
+.L474:
+	.loc 1 607 9 is_stmt 1 view .LVU1662
+	movq	%r13, %rdi	# all,
+	call	q_free@PLT	#
+.LVL795:
+	.loc 1 608 9 view .LVU1663
+.LBB147:
+	.loc 1 608 14 view .LVU1664
+	.loc 1 608 27 view .LVU1665
+	leaq	1696(%rsp), %rbx	#, ivtmp.464
+	leaq	3744(%rsp), %rbp	#, _62
+.LVL796:
+.L471:
+	.loc 1 609 13 discriminator 3 view .LVU1666
+	movq	(%rbx), %rdi	# MEM[(struct queue_t * *)_76], MEM[(struct queue_t * *)_76]
+	call	q_free@PLT	#
+.LVL797:
+	.loc 1 608 43 discriminator 3 view .LVU1667
+	.loc 1 608 27 discriminator 3 view .LVU1668
+	addq	$8, %rbx	#, ivtmp.464
+.LVL798:
+	.loc 1 608 27 is_stmt 0 discriminator 3 view .LVU1669
+	cmpq	%rbx, %rbp	# ivtmp.464, _62
+	jne	.L471	#,
+.LBE147:
+	.loc 1 611 5 is_stmt 1 view .LVU1670
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL799:
+	.loc 1 612 5 view .LVU1671
+	movl	$1, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL800:
+	.loc 1 613 5 view .LVU1672
+# qtest.c:613:     if (!ok)
+	.loc 1 613 8 is_stmt 0 view .LVU1673
+	cmpb	$0, 31(%rsp)	#, %sfp
+	je	.L472	#,
+.LVL801:
+.L478:
+	.loc 1 615 5 is_stmt 1 view .LVU1674
+# qtest.c:615:     return ok && !error_check();
+	.loc 1 615 19 is_stmt 0 view .LVU1675
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL802:
+# qtest.c:615:     return ok && !error_check();
+	.loc 1 615 15 view .LVU1676
+	xorl	$1, %eax	#, tmp231
+	movzbl	%al, %eax	# tmp231, iftmp.159_69
+.L473:
+# qtest.c:615:     return ok && !error_check();
+	.loc 1 615 15 discriminator 6 view .LVU1677
+	andl	$1, %eax	#, <retval>
+.LVL803:
+.L445:
+# qtest.c:616: }
+	.loc 1 616 1 view .LVU1678
+	addq	$3768, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL804:
+.L500:
+	.cfi_restore_state
+# qtest.c:606:     if (exception_setup(false)) {
+	.loc 1 606 8 view .LVU1679
+	movb	$0, 31(%rsp)	#, %sfp
+	jmp	.L474	#
+.LVL805:
+.L508:
+	.loc 1 605 5 is_stmt 1 view .LVU1680
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL806:
+	.loc 1 606 5 view .LVU1681
+# qtest.c:606:     if (exception_setup(false)) {
+	.loc 1 606 9 is_stmt 0 view .LVU1682
+	movl	$0, %edi	#,
+	call	exception_setup@PLT	#
+.LVL807:
+	movb	%al, 31(%rsp)	# _19, %sfp
+# qtest.c:606:     if (exception_setup(false)) {
+	.loc 1 606 8 view .LVU1683
+	testb	%al, %al	# _19
+	jne	.L474	#,
+	.loc 1 611 5 is_stmt 1 view .LVU1684
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL808:
+	.loc 1 612 5 view .LVU1685
+	movl	$1, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL809:
+	.loc 1 613 5 view .LVU1686
+	jmp	.L478	#
+.LVL810:
+.L507:
+	.loc 1 611 5 view .LVU1687
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL811:
+	.loc 1 612 5 view .LVU1688
+	movl	$1, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL812:
+	.loc 1 613 5 view .LVU1689
+	jmp	.L472	#
+.LVL813:
+.L504:
+.LBB148:
+	.loc 1 597 13 view .LVU1690
+	.loc 1 598 17 view .LVU1691
+	leaq	64(%rsp), %rdi	#, tmp235
+	movl	3752(%rsp), %esi	# trials,
+	call	cplx_median@PLT	#
+.LVL814:
+	movq	%xmm0, %rbx	# tmp263, _45
+	leaq	880(%rsp), %rdi	#, tmp237
+	movl	3752(%rsp), %esi	# trials,
+	call	cplx_median@PLT	#
+.LVL815:
+	movq	%rbx, %xmm1	# _45,
+	movl	%r15d, %edx	# k,
+	leaq	.LC118(%rip), %rsi	#,
+	movl	$1, %edi	#,
+	movl	$2, %eax	#,
+	call	report@PLT	#
+.LVL816:
+	.loc 1 578 51 view .LVU1692
+	addl	%r15d, %r15d	# k
+.LVL817:
+	.loc 1 578 28 view .LVU1693
+	cmpl	$256, %r15d	#, k
+	jg	.L508	#,
+.LVL818:
+.L459:
+.LBB145:
+	.loc 1 579 32 view .LVU1694
+	leal	-2(%r15), %eax	#, tmp225
+	movl	%eax, %eax	# tmp225, tmp226
+	movq	16(%rsp), %rdx	# %sfp, tmp229
+	leaq	(%rdx,%rax,8), %r12	#, _168
+.LBB143:
+# qtest.c:586:                 ok = ok && check_sorted(all, n) && merge_deal(all, qs, k);
+	.loc 1 586 49 is_stmt 0 view .LVU1695
+	movl	$0, %r14d	#, ivtmp.475
+	jmp	.L470	#
+.LBE143:
+.LBE145:
+.LBE148:
+	.cfi_endproc
+.LFE42:
+	.size	do_mergebench, .-do_mergebench
+	.section	.rodata.str1.1
+.LC119:
+	.string	"%s needs at least 1 argument"
+	.section	.rodata.str1.8
+	.align 8
+.LC120:
+	.string	"Cannot merge queue '%s' into itself"
+	.section	.rodata.str1.1
+.LC121:
+	.string	"Queue '%s' listed twice"
+	.section	.rodata.str1.8
+	.align 8
+.LC122:
+	.string	"Warning: Calling merge on null queue"
+	.align 8
+.LC123:
+	.string	"ERROR: Queue '%s' not empty after merge"
+	.text
+	.type	do_merge, @function
+do_merge:
+.LVL819:
+.LFB40:
+	.loc 1 457 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 457 1 is_stmt 0 view .LVU1697
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$808, %rsp	#,
+	.cfi_def_cfa_offset 864
+	movl	%edi, 12(%rsp)	# argc, %sfp
+	movq	%rsi, %rbp	# tmp181, argv
+	.loc 1 458 5 is_stmt 1 view .LVU1698
+.LBB149:
+.LBB150:
+# qtest.c:470:         if (j == current) {
+	.loc 1 470 15 is_stmt 0 view .LVU1699
+	movl	current(%rip), %r13d	# current, current.160_6
+	movl	%edi, %r15d	# argc, _114
+	movl	$1, %ebx	#, ivtmp.515
+	leaq	548(%rsp), %r14	#, tmp179
+.LBE150:
+.LBE149:
+# qtest.c:458:     if (argc < 2) {
+	.loc 1 458 8 view .LVU1700
+	cmpl	$1, %edi	#, argc
+	jle	.L535	#,
+.LVL820:
+.L518:
+.LBB155:
+.LBB153:
+	.loc 1 465 9 is_stmt 1 view .LVU1701
+# qtest.c:465:         int j = find_queue(argv[i]);
+	.loc 1 465 17 is_stmt 0 view .LVU1702
+	movq	0(%rbp,%rbx,8), %r12	# MEM[(char * *)argv_66(D) + ivtmp.515_109 * 8], _5
+	movq	%r12, %rdi	# _5,
+	call	find_queue	#
+.LVL821:
+	.loc 1 466 9 is_stmt 1 view .LVU1703
+# qtest.c:466:         if (j < 0) {
+	.loc 1 466 12 is_stmt 0 view .LVU1704
+	testl	%eax, %eax	# j
+	js	.L536	#,
+	.loc 1 470 9 is_stmt 1 view .LVU1705
+# qtest.c:470:         if (j == current) {
+	.loc 1 470 12 is_stmt 0 view .LVU1706
+	cmpl	%eax, %r13d	# j, current.160_6
+	je	.L513	#,
+.LVL822:
+.LBB151:
+	.loc 1 474 27 is_stmt 1 view .LVU1707
+	cmpl	$1, %ebx	#, ivtmp.515
+	jle	.L515	#,
+	leaq	544(%rsp), %rdx	#, ivtmp.510
+	leal	-2(%rbx), %ecx	#, tmp135
+	leaq	(%r14,%rcx,4), %rcx	#, _108
+.LVL823:
+.L517:
+	.loc 1 475 13 view .LVU1708
+# qtest.c:475:             if (slots[k - 1] == j) {
+	.loc 1 475 16 is_stmt 0 view .LVU1709
+	cmpl	%eax, (%rdx)	# j, MEM[(int *)_101]
+	je	.L537	#,
+	.loc 1 474 33 is_stmt 1 discriminator 2 view .LVU1710
+.LVL824:
+	.loc 1 474 27 discriminator 2 view .LVU1711
+	addq	$4, %rdx	#, ivtmp.510
+.LVL825:
+	.loc 1 474 27 is_stmt 0 discriminator 2 view .LVU1712
+	cmpq	%rcx, %rdx	# _108, ivtmp.510
+	jne	.L517	#,
+.LVL826:
+.L515:
+	.loc 1 474 27 discriminator 2 view .LVU1713
+.LBE151:
+	.loc 1 480 9 is_stmt 1 discriminator 2 view .LVU1714
+# qtest.c:480:         slots[i - 1] = j;
+	.loc 1 480 22 is_stmt 0 discriminator 2 view .LVU1715
+	movl	%eax, 540(%rsp,%rbx,4)	# j, MEM[(int *)&slots + -4B + ivtmp.515_109 * 4]
+	.loc 1 481 9 is_stmt 1 discriminator 2 view .LVU1716
+# qtest.c:481:         qs[i] = queues[j].q;
+	.loc 1 481 26 is_stmt 0 discriminator 2 view .LVU1717
+	cltq
+.LVL827:
+	.loc 1 481 26 discriminator 2 view .LVU1718
+	salq	$5, %rax	#, tmp143
+# qtest.c:481:         qs[i] = queues[j].q;
+	.loc 1 481 15 discriminator 2 view .LVU1719
+	leaq	queues(%rip), %rdx	#, tmp141
+	movq	16(%rdx,%rax), %rax	# queues[j_67].q, queues[j_67].q
+	movq	%rax, 16(%rsp,%rbx,8)	# queues[j_67].q, MEM[(struct queue_t * *)&qs + ivtmp.515_109 * 8]
+.LBE153:
+	.loc 1 464 32 is_stmt 1 discriminator 2 view .LVU1720
+.LVL828:
+	.loc 1 464 23 discriminator 2 view .LVU1721
+	addq	$1, %rbx	#, ivtmp.515
+.LVL829:
+	.loc 1 464 23 is_stmt 0 discriminator 2 view .LVU1722
+	cmpq	%r15, %rbx	# _114, ivtmp.515
+	jne	.L518	#,
+	.loc 1 464 23 discriminator 2 view .LVU1723
+.LBE155:
+	.loc 1 483 5 is_stmt 1 view .LVU1724
+# qtest.c:483:     qs[0] = q;
+	.loc 1 483 11 is_stmt 0 view .LVU1725
+	movq	q(%rip), %rax	# q, q.161_11
+	movq	%rax, 16(%rsp)	# q.161_11, qs[0]
+	.loc 1 485 5 is_stmt 1 view .LVU1726
+# qtest.c:485:     if (!q)
+	.loc 1 485 8 is_stmt 0 view .LVU1727
+	testq	%rax, %rax	# q.161_11
+	je	.L538	#,
+.LVL830:
+.L519:
+	.loc 1 487 5 is_stmt 1 view .LVU1728
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL831:
+	.loc 1 489 5 view .LVU1729
+	movl	$1, %edi	#,
+	call	set_noallocate_mode@PLT	#
+.LVL832:
+	.loc 1 490 5 view .LVU1730
+# qtest.c:490:     if (exception_setup(true))
+	.loc 1 490 9 is_stmt 0 view .LVU1731
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL833:
+# qtest.c:490:     if (exception_setup(true))
+	.loc 1 490 8 view .LVU1732
+	testb	%al, %al	# tmp183
+	jne	.L539	#,
+.L520:
+	.loc 1 492 5 is_stmt 1 view .LVU1733
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL834:
+	.loc 1 493 5 view .LVU1734
+	movl	$0, %edi	#,
+	call	set_noallocate_mode@PLT	#
+.LVL835:
+	.loc 1 495 5 view .LVU1735
+	.loc 1 496 5 view .LVU1736
+# qtest.c:496:     if (q) {
+	.loc 1 496 8 is_stmt 0 view .LVU1737
+	cmpq	$0, q(%rip)	#, q
+	je	.L521	#,
+	leaq	544(%rsp), %rbp	#, ivtmp.504
+.LVL836:
+	.loc 1 496 8 view .LVU1738
+	movl	12(%rsp), %eax	# %sfp, argc
+	leal	-2(%rax), %eax	#, tmp150
+	leaq	548(%rsp,%rax,4), %r13	#, _97
+# qtest.c:495:     bool ok = true;
+	.loc 1 495 10 view .LVU1739
+	movl	$1, %ecx	#, ok
+.LBB156:
+.LBB157:
+# qtest.c:499:             if (!src->q)
+	.loc 1 499 21 view .LVU1740
+	leaq	queues(%rip), %r12	#, tmp153
+# qtest.c:502:                 report(1, "ERROR: Queue '%s' not empty after merge",
+	.loc 1 502 17 view .LVU1741
+	leaq	.LC123(%rip), %r14	#, tmp178
+	jmp	.L525	#
+.LVL837:
+.L535:
+	.loc 1 502 17 view .LVU1742
+.LBE157:
+.LBE156:
+	.loc 1 459 9 is_stmt 1 view .LVU1743
+	movq	(%rsi), %rdx	# *argv_66(D), *argv_66(D)
+	leaq	.LC119(%rip), %rsi	#, tmp131
+.LVL838:
+	.loc 1 459 9 is_stmt 0 view .LVU1744
+	movl	$1, %edi	#,
+.LVL839:
+	.loc 1 459 9 view .LVU1745
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL840:
+	.loc 1 460 9 is_stmt 1 view .LVU1746
+# qtest.c:460:         return false;
+	.loc 1 460 16 is_stmt 0 view .LVU1747
+	movl	$0, %eax	#, <retval>
+	jmp	.L509	#
+.LVL841:
+.L536:
+.LBB160:
+.LBB154:
+	.loc 1 467 13 is_stmt 1 view .LVU1748
+	movq	%r12, %rdx	# _5,
+	leaq	.LC94(%rip), %rsi	#, tmp132
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL842:
+	.loc 1 467 13 is_stmt 0 view .LVU1749
+	call	report@PLT	#
+.LVL843:
+	.loc 1 468 13 is_stmt 1 view .LVU1750
+# qtest.c:468:             return false;
+	.loc 1 468 20 is_stmt 0 view .LVU1751
+	movl	$0, %eax	#, <retval>
+	jmp	.L509	#
+.LVL844:
+.L513:
+	.loc 1 471 13 is_stmt 1 view .LVU1752
+	movq	%r12, %rdx	# _5,
+	leaq	.LC120(%rip), %rsi	#, tmp133
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL845:
+	.loc 1 471 13 is_stmt 0 view .LVU1753
+	call	report@PLT	#
+.LVL846:
+	.loc 1 472 13 is_stmt 1 view .LVU1754
+# qtest.c:472:             return false;
+	.loc 1 472 20 is_stmt 0 view .LVU1755
+	movl	$0, %eax	#, <retval>
+	jmp	.L509	#
+.LVL847:
+.L537:
+.LBB152:
+	.loc 1 476 17 is_stmt 1 view .LVU1756
+	movq	%r12, %rdx	# _5,
+.LVL848:
+	.loc 1 476 17 is_stmt 0 view .LVU1757
+	leaq	.LC121(%rip), %rsi	#, tmp138
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL849:
+	.loc 1 476 17 view .LVU1758
+	call	report@PLT	#
+.LVL850:
+	.loc 1 477 17 is_stmt 1 view .LVU1759
+# qtest.c:477:                 return false;
+	.loc 1 477 24 is_stmt 0 view .LVU1760
+	movl	$0, %eax	#, <retval>
+.LVL851:
+.L509:
+	.loc 1 477 24 view .LVU1761
+.LBE152:
+.LBE154:
+.LBE160:
+# qtest.c:514: }
+	.loc 1 514 1 view .LVU1762
+	addq	$808, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL852:
+.L538:
+	.cfi_restore_state
+	.loc 1 486 9 is_stmt 1 view .LVU1763
+	leaq	.LC122(%rip), %rsi	#, tmp147
+	movl	$3, %edi	#,
+	call	report@PLT	#
+.LVL853:
+	.loc 1 486 9 is_stmt 0 view .LVU1764
+	jmp	.L519	#
+.L539:
+	.loc 1 491 9 is_stmt 1 view .LVU1765
+	leaq	16(%rsp), %rdi	#, tmp148
+	movl	12(%rsp), %esi	# %sfp,
+	call	q_merge_k@PLT	#
+.LVL854:
+	jmp	.L520	#
+.LVL855:
+.L523:
+.LBB161:
+.LBB158:
+	.loc 1 502 17 view .LVU1766
+# qtest.c:503:                        src->name);
+	.loc 1 503 27 is_stmt 0 view .LVU1767
+	movslq	%ebx, %rdx	# _15, _15
+	salq	$5, %rdx	#, tmp159
+	addq	%r12, %rdx	# tmp153, tmp160
+# qtest.c:502:                 report(1, "ERROR: Queue '%s' not empty after merge",
+	.loc 1 502 17 view .LVU1768
+	movq	%r14, %rsi	# tmp178,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL856:
+	.loc 1 504 17 is_stmt 1 view .LVU1769
+# qtest.c:504:                 ok = false;
+	.loc 1 504 20 is_stmt 0 view .LVU1770
+	movl	$0, %ecx	#, ok
+.LVL857:
+.L524:
+	.loc 1 506 13 is_stmt 1 view .LVU1771
+# qtest.c:506:             qcnt += src->cnt;
+	.loc 1 506 24 is_stmt 0 view .LVU1772
+	movslq	%ebx, %rbx	# _15, _15
+	.loc 1 506 24 view .LVU1773
+	salq	$5, %rbx	#, tmp165
+.LVL858:
+	.loc 1 506 24 view .LVU1774
+	leaq	(%r12,%rbx), %rax	#, tmp166
+# qtest.c:506:             qcnt += src->cnt;
+	.loc 1 506 18 view .LVU1775
+	movq	24(%rax), %rdx	# MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][_15].cnt, MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][_15].cnt
+	addq	%rdx, qcnt(%rip)	# MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][_15].cnt, qcnt
+	.loc 1 507 13 is_stmt 1 view .LVU1776
+# qtest.c:507:             src->cnt = 0;
+	.loc 1 507 22 is_stmt 0 view .LVU1777
+	movq	$0, 24(%rax)	#, MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][_15].cnt
+.L522:
+	.loc 1 507 22 view .LVU1778
+.LBE158:
+	.loc 1 497 36 is_stmt 1 discriminator 2 view .LVU1779
+.LVL859:
+	.loc 1 497 27 discriminator 2 view .LVU1780
+	addq	$4, %rbp	#, ivtmp.504
+.LVL860:
+	.loc 1 497 27 is_stmt 0 discriminator 2 view .LVU1781
+	cmpq	%r13, %rbp	# _97, ivtmp.504
+	je	.L540	#,
+.LVL861:
+.L525:
+.LBB159:
+	.loc 1 498 13 is_stmt 1 view .LVU1782
+# qtest.c:498:             queue_slot_t *src = &queues[slots[i - 1]];
+	.loc 1 498 46 is_stmt 0 view .LVU1783
+	movl	0(%rbp), %ebx	# MEM[(int *)_27], _15
+.LVL862:
+	.loc 1 499 13 is_stmt 1 view .LVU1784
+# qtest.c:499:             if (!src->q)
+	.loc 1 499 21 is_stmt 0 view .LVU1785
+	movslq	%ebx, %rax	# _15, _15
+	salq	$5, %rax	#, tmp155
+	movq	16(%r12,%rax), %rax	# MEM <struct queue_slot_t[64]> [(struct queue_slot_t *)&queues][_15].q, _16
+# qtest.c:499:             if (!src->q)
+	.loc 1 499 16 view .LVU1786
+	testq	%rax, %rax	# _16
+	je	.L522	#,
+	.loc 1 501 13 is_stmt 1 view .LVU1787
+# qtest.c:501:             if (src->q->head || src->q->tail) {
+	.loc 1 501 16 is_stmt 0 view .LVU1788
+	cmpq	$0, (%rax)	#, _16->head
+	jne	.L523	#,
+# qtest.c:501:             if (src->q->head || src->q->tail) {
+	.loc 1 501 30 discriminator 1 view .LVU1789
+	cmpq	$0, 8(%rax)	#, _16->tail
+	jne	.L523	#,
+	jmp	.L524	#
+.LVL863:
+.L540:
+	.loc 1 501 30 discriminator 1 view .LVU1790
+.LBE159:
+.LBE161:
+	.loc 1 509 9 is_stmt 1 view .LVU1791
+# qtest.c:509:         ok = ok && check_sorted(q, qcnt);
+	.loc 1 509 17 is_stmt 0 view .LVU1792
+	testb	%cl, %cl	# ok
+	jne	.L541	#,
+.LVL864:
+	.loc 1 512 5 is_stmt 1 view .LVU1793
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL865:
+	.loc 1 513 5 view .LVU1794
+# qtest.c:513:     return ok && !error_check();
+	.loc 1 513 15 is_stmt 0 view .LVU1795
+	movl	$0, %eax	#, iftmp.168_36
+.LVL866:
+.L527:
+# qtest.c:513:     return ok && !error_check();
+	.loc 1 513 15 discriminator 6 view .LVU1796
+	andl	$1, %eax	#, <retval>
+	jmp	.L509	#
+.LVL867:
+.L541:
+# qtest.c:509:         ok = ok && check_sorted(q, qcnt);
+	.loc 1 509 20 discriminator 1 view .LVU1797
+	movq	qcnt(%rip), %rsi	# qcnt,
+	movq	q(%rip), %rdi	# q,
+	call	check_sorted	#
+.LVL868:
+	.loc 1 509 20 discriminator 1 view .LVU1798
+	movl	%eax, %ebx	# tmp184, _25
+.LVL869:
+	.loc 1 512 5 is_stmt 1 discriminator 1 view .LVU1799
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL870:
+	.loc 1 513 5 discriminator 1 view .LVU1800
+# qtest.c:513:     return ok && !error_check();
+	.loc 1 513 15 is_stmt 0 discriminator 1 view .LVU1801
+	movl	$0, %eax	#, iftmp.168_36
+	testb	%bl, %bl	# _25
+	je	.L527	#,
+	jmp	.L528	#
+.LVL871:
+.L521:
+	.loc 1 512 5 is_stmt 1 view .LVU1802
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL872:
+	.loc 1 513 5 view .LVU1803
+.L528:
+# qtest.c:513:     return ok && !error_check();
+	.loc 1 513 19 is_stmt 0 discriminator 1 view .LVU1804
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL873:
+# qtest.c:513:     return ok && !error_check();
+	.loc 1 513 15 discriminator 1 view .LVU1805
+	xorl	$1, %eax	#, tmp176
+	movzbl	%al, %eax	# tmp176, iftmp.168_36
+	jmp	.L527	#
+	.cfi_endproc
+.LFE40:
+	.size	do_merge, .-do_merge
+	.section	.rodata.str1.8
+	.align 8
+.LC124:
+	.string	"Queue name '%s' is longer than %d characters"
+	.align 8
+.LC125:
+	.string	"Cannot have more than %d queues"
+	.text
+	.type	use_queue, @function
+use_queue:
+.LVL874:
+.LFB30:
+	.loc 1 232 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 232 1 is_stmt 0 view .LVU1807
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %r12	# tmp133, name
+	movl	%esi, %ebp	# tmp134, create
+	.loc 1 233 5 is_stmt 1 view .LVU1808
+# qtest.c:233:     int i = find_queue(name);
+	.loc 1 233 13 is_stmt 0 view .LVU1809
+	call	find_queue	#
+.LVL875:
+	.loc 1 233 13 view .LVU1810
+	movl	%eax, %ebx	# tmp135, i
+.LVL876:
+	.loc 1 234 5 is_stmt 1 view .LVU1811
+# qtest.c:234:     if (i < 0 && !create) {
+	.loc 1 234 11 is_stmt 0 view .LVU1812
+	shrl	$31, %eax	#, tmp97
+.LVL877:
+# qtest.c:234:     if (i < 0 && !create) {
+	.loc 1 234 18 view .LVU1813
+	movl	%ebp, %esi	# create, tmp98
+	xorl	$1, %esi	#, tmp98
+# qtest.c:234:     if (i < 0 && !create) {
+	.loc 1 234 8 view .LVU1814
+	andb	%al, %sil	# tmp97, tmp98
+	jne	.L549	#,
+	movl	%esi, %ebp	# tmp98, <retval>
+	.loc 1 238 5 is_stmt 1 view .LVU1815
+# qtest.c:238:     if (i < 0) {
+	.loc 1 238 8 is_stmt 0 view .LVU1816
+	testl	%ebx, %ebx	# i
+	jns	.L545	#,
+	.loc 1 239 9 is_stmt 1 view .LVU1817
+# qtest.c:239:         if (strlen(name) >= QUEUE_NAME_LEN) {
+	.loc 1 239 13 is_stmt 0 view .LVU1818
+	movq	%r12, %rdi	# name,
+	call	strlen@PLT	#
+.LVL878:
+# qtest.c:239:         if (strlen(name) >= QUEUE_NAME_LEN) {
+	.loc 1 239 12 view .LVU1819
+	cmpq	$15, %rax	#, tmp136
+	ja	.L550	#,
+	.loc 1 244 9 is_stmt 1 view .LVU1820
+# qtest.c:244:         if (queue_slots == MAX_QUEUES) {
+	.loc 1 244 25 is_stmt 0 view .LVU1821
+	movl	queue_slots(%rip), %ebx	# queue_slots, i
+.LVL879:
+# qtest.c:244:         if (queue_slots == MAX_QUEUES) {
+	.loc 1 244 12 view .LVU1822
+	cmpl	$64, %ebx	#, i
+	je	.L551	#,
+	.loc 1 248 9 is_stmt 1 view .LVU1823
+# qtest.c:248:         i = queue_slots++;
+	.loc 1 248 24 is_stmt 0 view .LVU1824
+	leal	1(%rbx), %eax	#, tmp105
+	movl	%eax, queue_slots(%rip)	# tmp105, queue_slots
+.LVL880:
+	.loc 1 249 9 is_stmt 1 view .LVU1825
+# qtest.c:249:         strcpy(queues[i].name, name);
+	.loc 1 249 25 is_stmt 0 view .LVU1826
+	movslq	%ebx, %rbp	# i, i
+	salq	$5, %rbp	#, tmp107
+	leaq	queues(%rip), %rax	#, tmp109
+	addq	%rax, %rbp	# tmp109, tmp108
+# qtest.c:249:         strcpy(queues[i].name, name);
+	.loc 1 249 9 view .LVU1827
+	movq	%r12, %rsi	# name,
+	movq	%rbp, %rdi	# tmp108,
+	call	strcpy@PLT	#
+.LVL881:
+	.loc 1 250 9 is_stmt 1 view .LVU1828
+# qtest.c:250:         queues[i].q = NULL;
+	.loc 1 250 21 is_stmt 0 view .LVU1829
+	movq	$0, 16(%rbp)	#, queues[queue_slots.181_5].q
+	.loc 1 251 9 is_stmt 1 view .LVU1830
+# qtest.c:251:         queues[i].cnt = 0;
+	.loc 1 251 23 is_stmt 0 view .LVU1831
+	movq	$0, 24(%rbp)	#, queues[queue_slots.181_5].cnt
+.L545:
+	.loc 1 253 5 is_stmt 1 view .LVU1832
+.LVL882:
+.LBB164:
+.LBI164:
+	.loc 1 212 13 view .LVU1833
+.LBB165:
+	.loc 1 214 5 view .LVU1834
+	movl	$0, %eax	#,
+	call	save_queue	#
+.LVL883:
+	.loc 1 215 5 view .LVU1835
+# qtest.c:215:     current = i;
+	.loc 1 215 13 is_stmt 0 view .LVU1836
+	movl	%ebx, current(%rip)	# i, current
+	.loc 1 216 5 is_stmt 1 view .LVU1837
+# qtest.c:216:     q = queues[i].q;
+	.loc 1 216 18 is_stmt 0 view .LVU1838
+	movslq	%ebx, %rbx	# i, i
+.LVL884:
+	.loc 1 216 18 view .LVU1839
+	salq	$5, %rbx	#, tmp122
+	leaq	queues(%rip), %rax	#, tmp120
+	addq	%rbx, %rax	# tmp122, tmp123
+# qtest.c:216:     q = queues[i].q;
+	.loc 1 216 7 view .LVU1840
+	movq	16(%rax), %rdx	# queues[i_8].q, queues[i_8].q
+	movq	%rdx, q(%rip)	# queues[i_8].q, q
+	.loc 1 217 5 is_stmt 1 view .LVU1841
+# qtest.c:217:     qcnt = queues[i].cnt;
+	.loc 1 217 10 is_stmt 0 view .LVU1842
+	movq	24(%rax), %rax	# queues[i_8].cnt, queues[i_8].cnt
+	movq	%rax, qcnt(%rip)	# queues[i_8].cnt, qcnt
+.LBE165:
+.LBE164:
+# qtest.c:254:     return true;
+	.loc 1 254 12 view .LVU1843
+	movl	$1, %ebp	#, <retval>
+.LVL885:
+.L542:
+# qtest.c:255: }
+	.loc 1 255 1 view .LVU1844
+	movl	%ebp, %eax	# <retval>,
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL886:
+	.loc 1 255 1 view .LVU1845
+	ret	
+.LVL887:
+.L549:
+	.cfi_restore_state
+	.loc 1 235 9 is_stmt 1 view .LVU1846
+	movq	%r12, %rdx	# name,
+	leaq	.LC94(%rip), %rsi	#, tmp99
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL888:
+	.loc 1 236 9 view .LVU1847
+# qtest.c:236:         return false;
+	.loc 1 236 16 is_stmt 0 view .LVU1848
+	movl	$0, %ebp	#, <retval>
+	jmp	.L542	#
+.L550:
+	.loc 1 240 13 is_stmt 1 view .LVU1849
+	movl	$15, %ecx	#,
+	movq	%r12, %rdx	# name,
+	leaq	.LC124(%rip), %rsi	#, tmp103
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL889:
+	.loc 1 242 13 view .LVU1850
+# qtest.c:242:             return false;
+	.loc 1 242 20 is_stmt 0 view .LVU1851
+	jmp	.L542	#
+.LVL890:
+.L551:
+	.loc 1 245 13 is_stmt 1 view .LVU1852
+	movl	$64, %edx	#,
+	leaq	.LC125(%rip), %rsi	#, tmp104
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL891:
+	.loc 1 246 13 view .LVU1853
+# qtest.c:246:             return false;
+	.loc 1 246 20 is_stmt 0 view .LVU1854
+	jmp	.L542	#
+	.cfi_endproc
+.LFE30:
+	.size	use_queue, .-use_queue
+	.type	do_use, @function
+do_use:
+.LVL892:
+.LFB35:
+	.loc 1 348 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 348 1 is_stmt 0 view .LVU1856
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 349 5 is_stmt 1 view .LVU1857
+# qtest.c:349:     if (argc != 2) {
+	.loc 1 349 8 is_stmt 0 view .LVU1858
+	cmpl	$2, %edi	#, tmp91
+	je	.L553	#,
+	.loc 1 350 9 is_stmt 1 view .LVU1859
+	movq	(%rsi), %rdx	# *argv_7(D), *argv_7(D)
+	leaq	.LC93(%rip), %rsi	#, tmp88
+.LVL893:
+	.loc 1 350 9 is_stmt 0 view .LVU1860
+	movl	$1, %edi	#,
+.LVL894:
+	.loc 1 350 9 view .LVU1861
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL895:
+	.loc 1 351 9 is_stmt 1 view .LVU1862
+# qtest.c:351:         return false;
+	.loc 1 351 16 is_stmt 0 view .LVU1863
+	movl	$0, %ebx	#, <retval>
+.L552:
+# qtest.c:357: }
+	.loc 1 357 1 view .LVU1864
+	movl	%ebx, %eax	# <retval>,
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL896:
+.L553:
+	.cfi_restore_state
+	.loc 1 353 5 is_stmt 1 view .LVU1865
+# qtest.c:353:     if (!use_queue(argv[1], false))
+	.loc 1 353 10 is_stmt 0 view .LVU1866
+	movq	8(%rsi), %rdi	# MEM[(char * *)argv_7(D) + 8B], MEM[(char * *)argv_7(D) + 8B]
+.LVL897:
+	.loc 1 353 10 view .LVU1867
+	movl	$0, %esi	#,
+.LVL898:
+	.loc 1 353 10 view .LVU1868
+	call	use_queue	#
+.LVL899:
+	movl	%eax, %ebx	# tmp93, <retval>
+# qtest.c:353:     if (!use_queue(argv[1], false))
+	.loc 1 353 8 view .LVU1869
+	testb	%al, %al	# <retval>
+	je	.L552	#,
+	.loc 1 355 5 is_stmt 1 view .LVU1870
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL900:
+	.loc 1 356 5 view .LVU1871
+# qtest.c:356:     return true;
+	.loc 1 356 12 is_stmt 0 view .LVU1872
+	jmp	.L552	#
+	.cfi_endproc
+.LFE35:
+	.size	do_use, .-do_use
+	.section	.rodata.str1.8
+	.align 8
+.LC126:
+	.string	"Warning: Calling free on null queue"
+	.text
+	.type	do_free, @function
+do_free:
+.LVL901:
+.LFB34:
+	.loc 1 308 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 308 1 is_stmt 0 view .LVU1874
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 309 5 is_stmt 1 view .LVU1875
+# qtest.c:309:     if (simulation)
+	.loc 1 309 9 is_stmt 0 view .LVU1876
+	movzbl	simulation(%rip), %ebx	# simulation, <retval>
+# qtest.c:309:     if (simulation)
+	.loc 1 309 8 view .LVU1877
+	testb	%bl, %bl	# <retval>
+	jne	.L571	#,
+	.loc 1 312 5 is_stmt 1 view .LVU1878
+# qtest.c:312:     if (argc != 1 && argc != 2) {
+	.loc 1 312 19 is_stmt 0 view .LVU1879
+	leal	-1(%rdi), %eax	#, tmp104
+# qtest.c:312:     if (argc != 1 && argc != 2) {
+	.loc 1 312 8 view .LVU1880
+	cmpl	$1, %eax	#, tmp104
+	ja	.L572	#,
+	.loc 1 316 5 is_stmt 1 view .LVU1881
+# qtest.c:316:     if (argc == 2 && !use_queue(argv[1], false))
+	.loc 1 316 8 is_stmt 0 view .LVU1882
+	cmpl	$2, %edi	#, argc
+	je	.L573	#,
+.LVL902:
+.L560:
+	.loc 1 319 5 is_stmt 1 view .LVU1883
+	.loc 1 320 5 view .LVU1884
+# qtest.c:320:     if (!q)
+	.loc 1 320 8 is_stmt 0 view .LVU1885
+	cmpq	$0, q(%rip)	#, q
+	je	.L574	#,
+.L561:
+	.loc 1 322 5 is_stmt 1 view .LVU1886
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL903:
+	.loc 1 324 5 view .LVU1887
+# qtest.c:324:     if (qcnt > big_queue_size)
+	.loc 1 324 8 is_stmt 0 view .LVU1888
+	cmpq	$30, qcnt(%rip)	#, qcnt
+	ja	.L575	#,
+.L562:
+	.loc 1 326 5 is_stmt 1 view .LVU1889
+# qtest.c:326:     if (exception_setup(true))
+	.loc 1 326 9 is_stmt 0 view .LVU1890
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL904:
+# qtest.c:326:     if (exception_setup(true))
+	.loc 1 326 8 view .LVU1891
+	testb	%al, %al	# tmp118
+	jne	.L576	#,
+.L563:
+	.loc 1 328 5 is_stmt 1 view .LVU1892
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL905:
+	.loc 1 329 5 view .LVU1893
+	movl	$1, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL906:
+	.loc 1 331 5 view .LVU1894
+# qtest.c:331:     q = NULL;
+	.loc 1 331 7 is_stmt 0 view .LVU1895
+	movq	$0, q(%rip)	#, q
+	.loc 1 332 5 is_stmt 1 view .LVU1896
+# qtest.c:332:     qcnt = 0;
+	.loc 1 332 10 is_stmt 0 view .LVU1897
+	movq	$0, qcnt(%rip)	#, qcnt
+	.loc 1 333 5 is_stmt 1 view .LVU1898
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL907:
+	.loc 1 336 5 view .LVU1899
+.LBB169:
+.LBI169:
+	.loc 1 258 13 view .LVU1900
+	.loc 1 260 5 view .LVU1901
+.LBB170:
+	.loc 1 260 10 view .LVU1902
+	.loc 1 260 23 view .LVU1903
+	movl	queue_slots(%rip), %ecx	# queue_slots, queue_slots.194_13
+	testl	%ecx, %ecx	# queue_slots.194_13
+	jle	.L564	#,
+# qtest.c:261:         if (i != current && queues[i].q)
+	.loc 1 261 15 is_stmt 0 view .LVU1904
+	movl	current(%rip), %esi	# current, current.193_48
+	leaq	16+queues(%rip), %rdx	#, ivtmp.534
+# qtest.c:260:     for (int i = 0; i < queue_slots; i++) {
+	.loc 1 260 14 view .LVU1905
+	movl	$0, %eax	#, i
+	jmp	.L567	#
+.LVL908:
+.L571:
+	.loc 1 260 14 view .LVU1906
+.LBE170:
+.LBE169:
+	.loc 1 310 9 is_stmt 1 view .LVU1907
+# qtest.c:310:         return simulate(argc, argv, test_free_queue);
+	.loc 1 310 16 is_stmt 0 view .LVU1908
+	movl	$5, %edx	#,
+	call	simulate	#
+.LVL909:
+	.loc 1 310 16 view .LVU1909
+	movl	%eax, %ebx	# tmp116, <retval>
+	jmp	.L556	#
+.LVL910:
+.L572:
+	.loc 1 313 9 is_stmt 1 view .LVU1910
+	movq	(%rsi), %rdx	# *argv_26(D), *argv_26(D)
+	leaq	.LC7(%rip), %rsi	#, tmp106
+.LVL911:
+	.loc 1 313 9 is_stmt 0 view .LVU1911
+	movl	$1, %edi	#,
+.LVL912:
+	.loc 1 313 9 view .LVU1912
+	movl	$0, %eax	#,
+.LVL913:
+	.loc 1 313 9 view .LVU1913
+	call	report@PLT	#
+.LVL914:
+	.loc 1 314 9 is_stmt 1 view .LVU1914
+# qtest.c:314:         return false;
+	.loc 1 314 16 is_stmt 0 view .LVU1915
+	jmp	.L556	#
+.LVL915:
+.L573:
+# qtest.c:316:     if (argc == 2 && !use_queue(argv[1], false))
+	.loc 1 316 23 discriminator 1 view .LVU1916
+	movq	8(%rsi), %rdi	# MEM[(char * *)argv_26(D) + 8B], MEM[(char * *)argv_26(D) + 8B]
+.LVL916:
+	.loc 1 316 23 discriminator 1 view .LVU1917
+	movl	$0, %esi	#,
+.LVL917:
+	.loc 1 316 23 discriminator 1 view .LVU1918
+	call	use_queue	#
+.LVL918:
+	.loc 1 316 23 discriminator 1 view .LVU1919
+	movl	%eax, %ebx	# tmp117, <retval>
+# qtest.c:316:     if (argc == 2 && !use_queue(argv[1], false))
+	.loc 1 316 19 discriminator 1 view .LVU1920
+	testb	%al, %al	# <retval>
+	jne	.L560	#,
+	jmp	.L556	#
+.LVL919:
+.L574:
+	.loc 1 321 9 is_stmt 1 view .LVU1921
+	leaq	.LC126(%rip), %rsi	#, tmp108
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL920:
+	jmp	.L561	#
+.L575:
+	.loc 1 325 9 view .LVU1922
+	movl	$0, %edi	#,
+	call	set_cautious_mode@PLT	#
+.LVL921:
+	jmp	.L562	#
+.L576:
+	.loc 1 327 9 view .LVU1923
+	movq	q(%rip), %rdi	# q,
+	call	q_free@PLT	#
+.LVL922:
+	jmp	.L563	#
+.LVL923:
+.L565:
+.LBB172:
+.LBB171:
+	.loc 1 260 39 view .LVU1924
+	addl	$1, %eax	#, i
+.LVL924:
+	.loc 1 260 23 view .LVU1925
+	addq	$32, %rdx	#, ivtmp.534
+	cmpl	%eax, %ecx	# i, queue_slots.194_13
+	je	.L564	#,
+.LVL925:
+.L567:
+	.loc 1 261 9 view .LVU1926
+# qtest.c:261:         if (i != current && queues[i].q)
+	.loc 1 261 12 is_stmt 0 view .LVU1927
+	cmpl	%eax, %esi	# i, current.193_48
+	je	.L565	#,
+# qtest.c:261:         if (i != current && queues[i].q)
+	.loc 1 261 26 view .LVU1928
+	cmpq	$0, (%rdx)	#, MEM[(struct queue_t * *)_57]
+	je	.L565	#,
+.LVL926:
+.L566:
+	.loc 1 261 26 view .LVU1929
+.LBE171:
+.LBE172:
+# qtest.c:344:     return ok && !error_check();
+	.loc 1 344 19 discriminator 1 view .LVU1930
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL927:
+# qtest.c:344:     return ok && !error_check();
+	.loc 1 344 15 discriminator 1 view .LVU1931
+	xorl	$1, %eax	#, tmp120
+	movzbl	%al, %ebx	# tmp112, _9
+.L568:
+# qtest.c:344:     return ok && !error_check();
+	.loc 1 344 15 discriminator 6 view .LVU1932
+	andl	$1, %ebx	#, <retval>
+.L556:
+# qtest.c:345: }
+	.loc 1 345 1 view .LVU1933
+	movl	%ebx, %eax	# <retval>,
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL928:
+.L564:
+	.cfi_restore_state
+# qtest.c:336:     size_t bcnt = other_queues() ? 0 : allocation_check();
+	.loc 1 336 40 discriminator 1 view .LVU1934
+	movl	$0, %eax	#,
+	call	allocation_check@PLT	#
+.LVL929:
+	.loc 1 337 5 is_stmt 1 discriminator 1 view .LVU1935
+# qtest.c:337:     if (bcnt > 0) {
+	.loc 1 337 8 is_stmt 0 discriminator 1 view .LVU1936
+	testq	%rax, %rax	# iftmp.190_39
+	je	.L566	#,
+	.loc 1 338 9 is_stmt 1 view .LVU1937
+	movq	%rax, %rdx	# iftmp.190_39,
+	leaq	.LC6(%rip), %rsi	#, tmp110
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL930:
+	.loc 1 338 9 is_stmt 0 view .LVU1938
+	call	report@PLT	#
+.LVL931:
+	.loc 1 340 9 is_stmt 1 view .LVU1939
+	movq	leakfile_name(%rip), %rdi	# leakfile_name,
+	call	show_leaks	#
+.LVL932:
+	.loc 1 341 9 view .LVU1940
+	.loc 1 344 5 view .LVU1941
+# qtest.c:344:     return ok && !error_check();
+	.loc 1 344 15 is_stmt 0 view .LVU1942
+	movl	$0, %ebx	#, _9
+	jmp	.L568	#
+	.cfi_endproc
+.LFE34:
+	.size	do_free, .-do_free
+	.section	.rodata.str1.1
+.LC127:
+	.string	"Freeing old queue"
+	.text
+	.type	do_new, @function
+do_new:
+.LVL933:
+.LFB32:
+	.loc 1 268 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 268 1 is_stmt 0 view .LVU1944
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rsi, %rbp	# tmp104, argv
+	.loc 1 269 5 is_stmt 1 view .LVU1945
+# qtest.c:269:     if (argc != 1 && argc != 2) {
+	.loc 1 269 19 is_stmt 0 view .LVU1946
+	leal	-1(%rdi), %eax	#, tmp96
+# qtest.c:269:     if (argc != 1 && argc != 2) {
+	.loc 1 269 8 view .LVU1947
+	cmpl	$1, %eax	#, tmp96
+	ja	.L590	#,
+	movl	%edi, %ebx	# tmp103, argc
+	.loc 1 273 5 is_stmt 1 view .LVU1948
+# qtest.c:273:     if (argc == 2 && !use_queue(argv[1], true))
+	.loc 1 273 8 is_stmt 0 view .LVU1949
+	cmpl	$2, %edi	#, argc
+	je	.L591	#,
+.LVL934:
+.L580:
+	.loc 1 276 5 is_stmt 1 view .LVU1950
+	.loc 1 277 5 view .LVU1951
+# qtest.c:277:     if (q) {
+	.loc 1 277 8 is_stmt 0 view .LVU1952
+	cmpq	$0, q(%rip)	#, q
+	je	.L581	#,
+	.loc 1 278 9 is_stmt 1 view .LVU1953
+	leaq	.LC127(%rip), %rsi	#, tmp100
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL935:
+	.loc 1 279 9 view .LVU1954
+# qtest.c:279:         ok = do_free(argc, argv);
+	.loc 1 279 14 is_stmt 0 view .LVU1955
+	movq	%rbp, %rsi	# argv,
+	movl	%ebx, %edi	# argc,
+	call	do_free	#
+.LVL936:
+	movl	%eax, %ebx	# tmp106, ok
+.LVL937:
+	.loc 1 281 5 is_stmt 1 view .LVU1956
+	movl	$0, %eax	#,
+.LVL938:
+	.loc 1 281 5 is_stmt 0 view .LVU1957
+	call	error_check@PLT	#
+.LVL939:
+	.loc 1 283 5 is_stmt 1 view .LVU1958
+# qtest.c:283:     if (exception_setup(true))
+	.loc 1 283 9 is_stmt 0 view .LVU1959
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL940:
+# qtest.c:283:     if (exception_setup(true))
+	.loc 1 283 8 view .LVU1960
+	testb	%al, %al	# tmp107
+	jne	.L585	#,
+.LVL941:
+.L582:
+	.loc 1 285 5 is_stmt 1 view .LVU1961
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL942:
+	.loc 1 286 5 view .LVU1962
+# qtest.c:286:     qcnt = 0;
+	.loc 1 286 10 is_stmt 0 view .LVU1963
+	movq	$0, qcnt(%rip)	#, qcnt
+	.loc 1 287 5 is_stmt 1 view .LVU1964
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL943:
+	.loc 1 289 5 view .LVU1965
+# qtest.c:289:     return ok && !error_check();
+	.loc 1 289 15 is_stmt 0 view .LVU1966
+	movl	$0, %eax	#, iftmp.197_12
+	testb	%bl, %bl	# ok
+	jne	.L584	#,
+.L583:
+# qtest.c:289:     return ok && !error_check();
+	.loc 1 289 15 discriminator 6 view .LVU1967
+	andl	$1, %eax	#, <retval>
+.L577:
+# qtest.c:290: }
+	.loc 1 290 1 view .LVU1968
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL944:
+	.loc 1 290 1 view .LVU1969
+	ret	
+.LVL945:
+.L590:
+	.cfi_restore_state
+	.loc 1 270 9 is_stmt 1 view .LVU1970
+	movq	(%rsi), %rdx	# *argv_20(D), *argv_20(D)
+	leaq	.LC7(%rip), %rsi	#, tmp98
+.LVL946:
+	.loc 1 270 9 is_stmt 0 view .LVU1971
+	movl	$1, %edi	#,
+.LVL947:
+	.loc 1 270 9 view .LVU1972
+	movl	$0, %eax	#,
+.LVL948:
+	.loc 1 270 9 view .LVU1973
+	call	report@PLT	#
+.LVL949:
+	.loc 1 271 9 is_stmt 1 view .LVU1974
+# qtest.c:271:         return false;
+	.loc 1 271 16 is_stmt 0 view .LVU1975
+	movl	$0, %eax	#, <retval>
+	jmp	.L577	#
+.LVL950:
+.L591:
+# qtest.c:273:     if (argc == 2 && !use_queue(argv[1], true))
+	.loc 1 273 23 discriminator 1 view .LVU1976
+	movq	8(%rsi), %rdi	# MEM[(char * *)argv_20(D) + 8B], MEM[(char * *)argv_20(D) + 8B]
+	movl	$1, %esi	#,
+.LVL951:
+	.loc 1 273 23 discriminator 1 view .LVU1977
+	call	use_queue	#
+.LVL952:
+# qtest.c:273:     if (argc == 2 && !use_queue(argv[1], true))
+	.loc 1 273 19 discriminator 1 view .LVU1978
+	testb	%al, %al	# <retval>
+	jne	.L580	#,
+	jmp	.L577	#
+.LVL953:
+.L585:
+	.loc 1 284 9 is_stmt 1 view .LVU1979
+# qtest.c:284:         q = q_new();
+	.loc 1 284 13 is_stmt 0 view .LVU1980
+	movl	$0, %eax	#,
+	call	q_new@PLT	#
+.LVL954:
+# qtest.c:284:         q = q_new();
+	.loc 1 284 11 view .LVU1981
+	movq	%rax, q(%rip)	# tmp108, q
+	jmp	.L582	#
+.LVL955:
+.L581:
+	.loc 1 281 5 is_stmt 1 view .LVU1982
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL956:
+	.loc 1 283 5 view .LVU1983
+# qtest.c:283:     if (exception_setup(true))
+	.loc 1 283 9 is_stmt 0 view .LVU1984
+	movl	$1, %edi	#,
+	call	exception_setup@PLT	#
+.LVL957:
+	movl	%eax, %ebx	# tmp110, ok
+.LVL958:
+# qtest.c:283:     if (exception_setup(true))
+	.loc 1 283 8 view .LVU1985
+	testb	%al, %al	# ok
+	jne	.L585	#,
+	.loc 1 285 5 is_stmt 1 view .LVU1986
+	movl	$0, %eax	#,
+	call	exception_cancel@PLT	#
+.LVL959:
+	.loc 1 286 5 view .LVU1987
+# qtest.c:286:     qcnt = 0;
+	.loc 1 286 10 is_stmt 0 view .LVU1988
+	movq	$0, qcnt(%rip)	#, qcnt
+	.loc 1 287 5 is_stmt 1 view .LVU1989
+	movl	$3, %edi	#,
+	call	show_queue	#
+.LVL960:
+	.loc 1 289 5 view .LVU1990
+.L584:
+# qtest.c:289:     return ok && !error_check();
+	.loc 1 289 19 is_stmt 0 discriminator 1 view .LVU1991
+	movl	$0, %eax	#,
+	call	error_check@PLT	#
+.LVL961:
+# qtest.c:289:     return ok && !error_check();
+	.loc 1 289 15 discriminator 1 view .LVU1992
+	xorl	$1, %eax	#, tmp101
+	movzbl	%al, %eax	# tmp101, iftmp.197_12
+	jmp	.L583	#
+	.cfi_endproc
+.LFE32:
+	.size	do_new, .-do_new
+	.section	.rodata.str1.1
+.LC128:
+	.string	".git"
+	.section	.rodata.str1.8
+	.align 8
+.LC129:
+	.string	"FATAL: You should run qtest in the directory containing valid git workspace.\n"
+	.section	.rodata.str1.1
+.LC130:
+	.string	".git/hooks/commit-msg"
+.LC131:
+	.string	".git/hooks/pre-commit"
+.LC132:
+	.string	".git/hooks/pre-push"
+	.section	.rodata.str1.8
+	.align 8
+.LC133:
+	.string	"FATAL: Git hooks are not properly installed.\n"
+	.section	.rodata.str1.1
+.LC134:
+	.string	"sh"
+.LC135:
+	.string	"-c"
+.LC136:
+	.string	"scripts/install-git-hooks"
+.LC137:
+	.string	"/bin/sh"
+.LC138:
+	.string	"waitpid"
+.LC139:
+	.string	"Unknown option '%c'\n"
+.LC140:
+	.string	"hv:f:l:k:s:o:b:j:"
+	.section	.rodata.str1.8
+	.align 8
+.LC141:
+	.string	" [name]         | Create new queue, and make it the current one"
+	.section	.rodata.str1.1
+.LC142:
+	.string	"new"
+	.section	.rodata.str1.8
+	.align 8
+.LC143:
+	.string	" [name]         | Delete queue, and make it the current one"
+	.section	.rodata.str1.1
+.LC144:
+	.string	"free"
+	.section	.rodata.str1.8
+	.align 8
+.LC145:
+	.string	" name           | Make queue name the current one.  Other commands operate on the current queue"
+	.section	.rodata.str1.1
+.LC146:
+	.string	"use"
+	.section	.rodata.str1.8
+	.align 8
+.LC147:
+	.string	"                | List named queues"
+	.section	.rodata.str1.1
+.LC148:
+	.string	"queues"
+	.section	.rodata.str1.8
+	.align 8
+.LC149:
+	.string	" name           | Move all elements of queue name to the tail of the current queue"
+	.section	.rodata.str1.1
+.LC150:
+	.string	"splice"
+	.section	.rodata.str1.8
+	.align 8
+.LC151:
+	.string	" name ...       | Merge the listed sorted queues into the current queue, leaving them empty"
+	.section	.rodata.str1.1
+.LC152:
+	.string	"merge"
+	.section	.rodata.str1.8
+	.align 8
+.LC153:
+	.string	" [n [t]]        | Time merging n elements split over 2 .. 256 sorted queues, at once and pairwise, using the median of t trials (default: n == 65536, t == 5)"
+	.section	.rodata.str1.1
+.LC154:
+	.string	"mergebench"
+	.section	.rodata.str1.8
+	.align 8
+.LC155:
+	.string	" str [n]        | Insert string str at head of queue n times. Generate random string(s) if str equals RAND. (default: n == 1)"
+	.section	.rodata.str1.1
+.LC156:
+	.string	"ih"
+	.section	.rodata.str1.8
+	.align 8
+.LC157:
+	.string	" str [n]        | Insert string str at tail of queue n times. Generate random string(s) if str equals RAND. (default: n == 1)"
+	.section	.rodata.str1.1
+.LC158:
+	.string	"it"
+	.section	.rodata.str1.8
+	.align 8
+.LC159:
+	.string	" [str]          | Remove from head of queue.  Optionally compare to expected value str"
+	.section	.rodata.str1.1
+.LC160:
+	.string	"rh"
+	.section	.rodata.str1.8
+	.align 8
+.LC161:
+	.string	"                | Remove from head of queue without reporting value."
+	.section	.rodata.str1.1
+.LC162:
+	.string	"rhq"
+	.section	.rodata.str1.8
+	.align 8
+.LC163:
+	.string	"                | Reverse queue"
+	.section	.rodata.str1.1
+.LC164:
+	.string	"reverse"
+	.section	.rodata.str1.8
+	.align 8
+.LC165:
+	.string	"                | Sort queue in ascending order"
+	.section	.rodata.str1.1
+.LC166:
+	.string	"sort"
+	.section	.rodata.str1.8
+	.align 8
+.LC167:
+	.string	" [n]            | Compute queue size n times (default: n == 1)"
+	.section	.rodata.str1.1
+.LC168:
+	.string	"size"
+	.section	.rodata.str1.8
+	.align 8
+.LC169:
+	.string	"                | Show queue contents"
+	.section	.rodata.str1.1
+.LC170:
+	.string	"show"
+	.section	.rodata.str1.8
+	.align 8
+.LC171:
+	.string	" [n ...]        | Make the listed calls to malloc fail (no arguments clears the list)"
+	.section	.rodata.str1.1
+.LC172:
+	.string	"failat"
+	.section	.rodata.str1.8
+	.align 8
+.LC173:
+	.string	" [reset]        | Show cycles per call of ih, it and size as percentiles, or clear them"
+	.section	.rodata.str1.1
+.LC174:
+	.string	"latency"
+	.section	.rodata.str1.8
+	.align 8
+.LC175:
+	.string	" op [max [n]]   | Fit running time of op (size, ih, it, rh, splice, transfer, reverse or sort) on queues of 2^10 .. 2^max elements, using the median of n trials (default: max == 22, n == 5)"
+	.section	.rodata.str1.1
+.LC176:
+	.string	"complexity"
+	.section	.rodata.str1.8
+	.align 8
+.LC177:
+	.string	" [file]         | Summarize allocated blocks.  Optionally list all of them in file"
+	.section	.rodata.str1.1
+.LC178:
+	.string	"leaks"
+	.section	.rodata.str1.8
+	.align 8
+.LC179:
+	.string	"Maximum length of displayed string"
+	.section	.rodata.str1.1
+.LC180:
+	.string	"length"
+	.section	.rodata.str1.8
+	.align 8
+.LC181:
+	.string	"Malloc failure probability percent"
+	.section	.rodata.str1.1
+.LC182:
+	.string	"malloc"
+	.section	.rodata.str1.8
+	.align 8
+.LC183:
+	.string	"Make every nth call to malloc fail (0 = never)"
+	.section	.rodata.str1.1
+.LC184:
+	.string	"mallocevery"
+	.section	.rodata.str1.8
+	.align 8
+.LC185:
+	.string	"Seed for random strings and malloc failures (restarts allocation numbering)"
+	.section	.rodata.str1.1
+.LC186:
+	.string	"seed"
+	.section	.rodata.str1.8
+	.align 8
+.LC187:
+	.string	"Number of times allow queue operations to return false"
+	.section	.rodata.str1.1
+.LC188:
+	.string	"fail"
+	.section	.rodata.str1.8
+	.align 8
+.LC189:
+	.string	"Maximum number of freed blocks held to detect use after free"
+	.section	.rodata.str1.1
+.LC190:
+	.string	"quarantine"
+	.section	.rodata.str1.8
+	.align 8
+.LC191:
+	.string	"Maximum kilobytes of freed blocks held to detect use after free"
+	.section	.rodata.str1.1
+.LC192:
+	.string	"quarantinekb"
+.LC193:
+	.string	"seed = %d"
+	.section	.rodata.str1.8
+	.align 8
+.LC194:
+	.string	"Couldn't open metrics file '%s'\n"
+	.text
+	.globl	main
+	.type	main, @function
+main:
+.LVL962:
+.LFB76:
+	.loc 1 1477 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1477 1 is_stmt 0 view .LVU1994
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1800, %rsp	#,
+	.cfi_def_cfa_offset 1856
+	movl	%edi, %r12d	# tmp265, argc
+	movq	%rsi, %rbp	# tmp266, argv
+	.loc 1 1479 5 is_stmt 1 view .LVU1995
+.LBB184:
+.LBI184:
+	.loc 1 1444 13 view .LVU1996
+.LBB185:
+	.loc 1 1446 5 view .LVU1997
+	.loc 1 1448 5 view .LVU1998
+# qtest.c:1448:     if (stat(".git", &buf)) {
+	.loc 1 1448 9 is_stmt 0 view .LVU1999
+	leaq	112(%rsp), %rsi	#, tmp126
+.LVL963:
+	.loc 1 1448 9 view .LVU2000
+	leaq	.LC128(%rip), %rdi	#, tmp127
+.LVL964:
+	.loc 1 1448 9 view .LVU2001
+	call	stat@PLT	#
+.LVL965:
+# qtest.c:1448:     if (stat(".git", &buf)) {
+	.loc 1 1448 8 view .LVU2002
+	testl	%eax, %eax	# iftmp.12_30
+	jne	.L622	#,
+	movl	%eax, %r14d	# tmp267, iftmp.12_30
+	.loc 1 1455 5 is_stmt 1 view .LVU2003
+# qtest.c:1455:     if (stat(GIT_HOOK "commit-msg", &buf) ||
+	.loc 1 1455 9 is_stmt 0 view .LVU2004
+	leaq	112(%rsp), %rsi	#, tmp130
+	leaq	.LC130(%rip), %rdi	#, tmp131
+	call	stat@PLT	#
+.LVL966:
+# qtest.c:1455:     if (stat(GIT_HOOK "commit-msg", &buf) ||
+	.loc 1 1455 8 view .LVU2005
+	testl	%eax, %eax	# tmp268
+	jne	.L595	#,
+# qtest.c:1456:         stat(GIT_HOOK "pre-commit", &buf) || stat(GIT_HOOK "pre-push", &buf)) {
+	.loc 1 1456 9 view .LVU2006
+	leaq	112(%rsp), %rsi	#, tmp132
+	leaq	.LC131(%rip), %rdi	#, tmp133
+	call	stat@PLT	#
+.LVL967:
+# qtest.c:1455:     if (stat(GIT_HOOK "commit-msg", &buf) ||
+	.loc 1 1455 43 view .LVU2007
+	testl	%eax, %eax	# tmp269
+	je	.L623	#,
+.L595:
+.LBB186:
+	.loc 1 1457 9 is_stmt 1 view .LVU2008
+	movq	stderr(%rip), %rcx	# stderr,
+	movl	$45, %edx	#,
+	movl	$1, %esi	#,
+	leaq	.LC133(%rip), %rdi	#, tmp137
+	call	fwrite@PLT	#
+.LVL968:
+	.loc 1 1460 9 view .LVU2009
+# qtest.c:1460:         char *argv[] = {"sh", "-c", "scripts/install-git-hooks", NULL};
+	.loc 1 1460 15 is_stmt 0 view .LVU2010
+	leaq	.LC134(%rip), %rax	#, tmp288
+	movq	%rax, 80(%rsp)	# tmp288, argv[0]
+	leaq	.LC135(%rip), %rax	#, tmp289
+	movq	%rax, 88(%rsp)	# tmp289, argv[1]
+	leaq	.LC136(%rip), %rax	#, tmp290
+	movq	%rax, 96(%rsp)	# tmp290, argv[2]
+	movq	$0, 104(%rsp)	#, argv[3]
+	.loc 1 1461 9 is_stmt 1 view .LVU2011
+	.loc 1 1462 9 view .LVU2012
+	.loc 1 1463 9 view .LVU2013
+# qtest.c:1463:         int status = posix_spawn(&pid, "/bin/sh", NULL, NULL, argv, environ);
+	.loc 1 1463 22 is_stmt 0 view .LVU2014
+	leaq	72(%rsp), %rdi	#, tmp143
+	movq	environ(%rip), %r9	# environ,
+	leaq	80(%rsp), %r8	#,
+	movl	$0, %ecx	#,
+	movl	$0, %edx	#,
+	leaq	.LC137(%rip), %rsi	#, tmp144
+	call	posix_spawn@PLT	#
+.LVL969:
+# qtest.c:1463:         int status = posix_spawn(&pid, "/bin/sh", NULL, NULL, argv, environ);
+	.loc 1 1463 13 view .LVU2015
+	movl	%eax, 76(%rsp)	# _105, status
+	.loc 1 1464 9 is_stmt 1 view .LVU2016
+# qtest.c:1464:         if (status == 0) {
+	.loc 1 1464 12 is_stmt 0 view .LVU2017
+	testl	%eax, %eax	# _105
+	je	.L624	#,
+.L597:
+.LBE186:
+.LBE185:
+.LBE184:
+# qtest.c:1480:         return -1;
+	.loc 1 1480 16 view .LVU2018
+	movl	$-1, %eax	#, <retval>
+	jmp	.L592	#
+.L622:
+.LBB191:
+.LBB188:
+	.loc 1 1449 9 is_stmt 1 view .LVU2019
+	movq	stderr(%rip), %rcx	# stderr,
+	movl	$77, %edx	#,
+	movl	$1, %esi	#,
+	leaq	.LC129(%rip), %rdi	#, tmp129
+	call	fwrite@PLT	#
+.LVL970:
+	.loc 1 1452 9 view .LVU2020
+.LBE188:
+.LBE191:
+# qtest.c:1480:         return -1;
+	.loc 1 1480 16 is_stmt 0 view .LVU2021
+	movl	$-1, %eax	#, <retval>
+	jmp	.L592	#
+.L623:
+.LBB192:
+.LBB189:
+# qtest.c:1456:         stat(GIT_HOOK "pre-commit", &buf) || stat(GIT_HOOK "pre-push", &buf)) {
+	.loc 1 1456 46 view .LVU2022
+	leaq	112(%rsp), %rsi	#, tmp134
+	leaq	.LC132(%rip), %rdi	#, tmp135
+	call	stat@PLT	#
+.LVL971:
+# qtest.c:1456:         stat(GIT_HOOK "pre-commit", &buf) || stat(GIT_HOOK "pre-push", &buf)) {
+	.loc 1 1456 43 view .LVU2023
+	testl	%eax, %eax	# tmp270
+	jne	.L595	#,
+.L596:
+.LBE189:
+.LBE192:
+	.loc 1 1483 5 is_stmt 1 view .LVU2024
+	.loc 1 1484 5 view .LVU2025
+.LVL972:
+	.loc 1 1485 5 view .LVU2026
+	.loc 1 1486 5 view .LVU2027
+	.loc 1 1487 5 view .LVU2028
+	.loc 1 1488 5 view .LVU2029
+	.loc 1 1489 5 view .LVU2030
+	.loc 1 1490 5 view .LVU2031
+	.loc 1 1491 5 view .LVU2032
+	.loc 1 1492 5 view .LVU2033
+	.loc 1 1493 5 view .LVU2034
+	.loc 1 1494 5 view .LVU2035
+	.loc 1 1495 5 view .LVU2036
+	.loc 1 1497 5 view .LVU2037
+# qtest.c:1497:     seed = (int) time(NULL);
+	.loc 1 1497 18 is_stmt 0 view .LVU2038
+	movl	$0, %edi	#,
+	call	time@PLT	#
+.LVL973:
+# qtest.c:1497:     seed = (int) time(NULL);
+	.loc 1 1497 12 view .LVU2039
+	movl	%eax, seed(%rip)	# tmp273, seed
+	.loc 1 1498 5 is_stmt 1 view .LVU2040
+# qtest.c:1494:     int level = 4;
+	.loc 1 1494 9 is_stmt 0 view .LVU2041
+	movl	$4, 36(%rsp)	#, %sfp
+# qtest.c:1493:     char *metrics_name = NULL;
+	.loc 1 1493 11 view .LVU2042
+	movq	$0, 16(%rsp)	#, %sfp
+# qtest.c:1491:     char *bytecode_name = NULL;
+	.loc 1 1491 11 view .LVU2043
+	movq	$0, 56(%rsp)	#, %sfp
+# qtest.c:1489:     char *compile_name = NULL;
+	.loc 1 1489 11 view .LVU2044
+	movq	$0, 40(%rsp)	#, %sfp
+# qtest.c:1486:     char *logfile_name = NULL;
+	.loc 1 1486 11 view .LVU2045
+	movq	$0, 24(%rsp)	#, %sfp
+# qtest.c:1484:     char *infile_name = NULL;
+	.loc 1 1484 11 view .LVU2046
+	movq	$0, 48(%rsp)	#, %sfp
+# qtest.c:1498:     while ((c = getopt(argc, argv, "hv:f:l:k:s:o:b:j:")) != -1) {
+	.loc 1 1498 17 view .LVU2047
+	leaq	.LC140(%rip), %r13	#, tmp171
+# qtest.c:1499:         switch (c) {
+	.loc 1 1499 9 view .LVU2048
+	leaq	.L603(%rip), %rbx	#, tmp262
+# qtest.c:1535:             strncpy(lbuf, optarg, BUFSIZE);
+	.loc 1 1535 13 view .LVU2049
+	leaq	1280(%rsp), %r15	#, tmp263
+# qtest.c:1530:             strncpy(jbuf, optarg, BUFSIZE);
+	.loc 1 1530 13 view .LVU2050
+	leaq	256(%rsp), %rax	#, tmp264
+	movq	%rax, (%rsp)	# tmp264, %sfp
+# qtest.c:1498:     while ((c = getopt(argc, argv, "hv:f:l:k:s:o:b:j:")) != -1) {
+	.loc 1 1498 11 view .LVU2051
+	jmp	.L600	#
+.LVL974:
+.L624:
+.LBB193:
+.LBB190:
+.LBB187:
+	.loc 1 1466 13 is_stmt 1 view .LVU2052
+# qtest.c:1466:             if ((waitpid(pid, &status, 0) != -1) && (status == 0))
+	.loc 1 1466 18 is_stmt 0 view .LVU2053
+	leaq	76(%rsp), %rsi	#, tmp145
+	movl	$0, %edx	#,
+	movl	72(%rsp), %edi	# pid,
+	call	waitpid@PLT	#
+.LVL975:
+# qtest.c:1466:             if ((waitpid(pid, &status, 0) != -1) && (status == 0))
+	.loc 1 1466 16 view .LVU2054
+	cmpl	$-1, %eax	#, tmp272
+	je	.L598	#,
+# qtest.c:1466:             if ((waitpid(pid, &status, 0) != -1) && (status == 0))
+	.loc 1 1466 50 view .LVU2055
+	cmpl	$0, 76(%rsp)	#, status
+	je	.L596	#,
+.L598:
+	.loc 1 1468 13 is_stmt 1 view .LVU2056
+	leaq	.LC138(%rip), %rdi	#, tmp147
+	call	perror@PLT	#
+.LVL976:
+	jmp	.L597	#
+.LVL977:
+.L609:
+	.loc 1 1468 13 is_stmt 0 view .LVU2057
+.LBE187:
+.LBE190:
+.LBE193:
+	.loc 1 1501 13 is_stmt 1 view .LVU2058
+	movq	0(%rbp), %rdi	# *argv_46(D),
+	call	usage	#
+.LVL978:
+.L610:
+	.loc 1 1504 13 view .LVU2059
+	leaq	1536(%rsp), %rax	#, tmp156
+	movl	$255, %edx	#,
+	movq	optarg(%rip), %rsi	# optarg,
+.LVL979:
+	.loc 1 1504 13 is_stmt 0 view .LVU2060
+	movq	%rax, 8(%rsp)	# tmp156, %sfp
+	movq	%rax, %rdi	# tmp156,
+	call	strncpy@PLT	#
+.LVL980:
+	.loc 1 1505 13 is_stmt 1 view .LVU2061
+# qtest.c:1505:             buf[BUFSIZE - 1] = '\0';
+	.loc 1 1505 30 is_stmt 0 view .LVU2062
+	movb	$0, 1791(%rsp)	#, buf[255]
+	.loc 1 1506 13 is_stmt 1 view .LVU2063
+.LVL981:
+	.loc 1 1507 13 view .LVU2064
+# qtest.c:1506:             infile_name = buf;
+	.loc 1 1506 25 is_stmt 0 view .LVU2065
+	movq	8(%rsp), %rax	# %sfp, tmp156
+	movq	%rax, 48(%rsp)	# tmp156, %sfp
+.LVL982:
+.L600:
+	.loc 1 1498 58 is_stmt 1 view .LVU2066
+# qtest.c:1498:     while ((c = getopt(argc, argv, "hv:f:l:k:s:o:b:j:")) != -1) {
+	.loc 1 1498 17 is_stmt 0 view .LVU2067
+	movq	%r13, %rdx	# tmp171,
+	movq	%rbp, %rsi	# argv,
+	movl	%r12d, %edi	# argc,
+	call	getopt@PLT	#
+.LVL983:
+	movl	%eax, %esi	# tmp276, c
+.LVL984:
+# qtest.c:1498:     while ((c = getopt(argc, argv, "hv:f:l:k:s:o:b:j:")) != -1) {
+	.loc 1 1498 58 view .LVU2068
+	cmpl	$-1, %eax	#, c
+	je	.L625	#,
+	.loc 1 1499 9 is_stmt 1 view .LVU2069
+	leal	-98(%rsi), %eax	#, tmp148
+.LVL985:
+	.loc 1 1499 9 is_stmt 0 view .LVU2070
+	cmpl	$20, %eax	#, tmp148
+	ja	.L601	#,
+	movl	%eax, %eax	# tmp148, tmp149
+	movslq	(%rbx,%rax,4), %rax	#, tmp152
+	addq	%rbx, %rax	# tmp262, tmp153
+	jmp	*%rax	# tmp153
+	.section	.rodata
+	.align 4
+	.align 4
+.L603:
+	.long	.L611-.L603
+	.long	.L601-.L603
+	.long	.L601-.L603
+	.long	.L601-.L603
+	.long	.L610-.L603
+	.long	.L601-.L603
+	.long	.L609-.L603
+	.long	.L601-.L603
+	.long	.L608-.L603
+	.long	.L607-.L603
+	.long	.L606-.L603
+	.long	.L601-.L603
+	.long	.L601-.L603
+	.long	.L605-.L603
+	.long	.L601-.L603
+	.long	.L601-.L603
+	.long	.L601-.L603
+	.long	.L604-.L603
+	.long	.L601-.L603
+	.long	.L601-.L603
+	.long	.L602-.L603
+	.text
+.L602:
+	.loc 1 1509 13 is_stmt 1 view .LVU2071
+.LVL986:
+.LBB194:
+.LBI194:
+	.file 3 "/usr/include/stdlib.h"
+	.loc 3 362 1 view .LVU2072
+.LBB195:
+	.loc 3 364 3 view .LVU2073
+# /usr/include/stdlib.h:364:   return (int) strtol (__nptr, (char **) NULL, 10);
+	.loc 3 364 16 is_stmt 0 view .LVU2074
+	movl	$10, %edx	#,
+	movl	$0, %esi	#,
+.LVL987:
+	.loc 3 364 16 view .LVU2075
+	movq	optarg(%rip), %rdi	# optarg,
+	call	strtol@PLT	#
+.LVL988:
+# /usr/include/stdlib.h:364:   return (int) strtol (__nptr, (char **) NULL, 10);
+	.loc 3 364 10 view .LVU2076
+	movl	%eax, 36(%rsp)	# tmp274, %sfp
+.LVL989:
+	.loc 3 364 10 view .LVU2077
+.LBE195:
+.LBE194:
+	.loc 1 1510 13 is_stmt 1 view .LVU2078
+	jmp	.L600	#
+.LVL990:
+.L607:
+	.loc 1 1512 13 view .LVU2079
+	leaq	1024(%rsp), %rax	#, tmp159
+	movl	$255, %edx	#,
+	movq	optarg(%rip), %rsi	# optarg,
+.LVL991:
+	.loc 1 1512 13 is_stmt 0 view .LVU2080
+	movq	%rax, 8(%rsp)	# tmp159, %sfp
+	movq	%rax, %rdi	# tmp159,
+	call	strncpy@PLT	#
+.LVL992:
+	.loc 1 1513 13 is_stmt 1 view .LVU2081
+# qtest.c:1513:             kbuf[BUFSIZE - 1] = '\0';
+	.loc 1 1513 31 is_stmt 0 view .LVU2082
+	movb	$0, 1279(%rsp)	#, kbuf[255]
+	.loc 1 1514 13 is_stmt 1 view .LVU2083
+# qtest.c:1514:             leakfile_name = kbuf;
+	.loc 1 1514 27 is_stmt 0 view .LVU2084
+	movq	8(%rsp), %rax	# %sfp, tmp159
+	movq	%rax, leakfile_name(%rip)	# tmp159, leakfile_name
+	.loc 1 1515 13 is_stmt 1 view .LVU2085
+	jmp	.L600	#
+.LVL993:
+.L604:
+	.loc 1 1517 13 view .LVU2086
+.LBB196:
+.LBI196:
+	.loc 3 362 1 view .LVU2087
+.LBB197:
+	.loc 3 364 3 view .LVU2088
+# /usr/include/stdlib.h:364:   return (int) strtol (__nptr, (char **) NULL, 10);
+	.loc 3 364 16 is_stmt 0 view .LVU2089
+	movl	$10, %edx	#,
+	movl	$0, %esi	#,
+.LVL994:
+	.loc 3 364 16 view .LVU2090
+	movq	optarg(%rip), %rdi	# optarg,
+	call	strtol@PLT	#
+.LVL995:
+# /usr/include/stdlib.h:364:   return (int) strtol (__nptr, (char **) NULL, 10);
+	.loc 3 364 10 view .LVU2091
+	movl	%eax, seed(%rip)	# tmp275, seed
+.LBE197:
+.LBE196:
+	.loc 1 1518 13 is_stmt 1 view .LVU2092
+	jmp	.L600	#
+.LVL996:
+.L605:
+	.loc 1 1520 13 view .LVU2093
+	leaq	768(%rsp), %rax	#, tmp163
+	movl	$255, %edx	#,
+	movq	optarg(%rip), %rsi	# optarg,
+.LVL997:
+	.loc 1 1520 13 is_stmt 0 view .LVU2094
+	movq	%rax, 8(%rsp)	# tmp163, %sfp
+	movq	%rax, %rdi	# tmp163,
+	call	strncpy@PLT	#
+.LVL998:
+	.loc 1 1521 13 is_stmt 1 view .LVU2095
+# qtest.c:1521:             obuf[BUFSIZE - 1] = '\0';
+	.loc 1 1521 31 is_stmt 0 view .LVU2096
+	movb	$0, 1023(%rsp)	#, obuf[255]
+	.loc 1 1522 13 is_stmt 1 view .LVU2097
+.LVL999:
+	.loc 1 1523 13 view .LVU2098
+# qtest.c:1522:             compile_name = obuf;
+	.loc 1 1522 26 is_stmt 0 view .LVU2099
+	movq	8(%rsp), %rax	# %sfp, tmp163
+	movq	%rax, 40(%rsp)	# tmp163, %sfp
+# qtest.c:1523:             break;
+	.loc 1 1523 13 view .LVU2100
+	jmp	.L600	#
+.LVL1000:
+.L611:
+	.loc 1 1525 13 is_stmt 1 view .LVU2101
+	leaq	512(%rsp), %rax	#, tmp165
+	movl	$255, %edx	#,
+	movq	optarg(%rip), %rsi	# optarg,
+.LVL1001:
+	.loc 1 1525 13 is_stmt 0 view .LVU2102
+	movq	%rax, 8(%rsp)	# tmp165, %sfp
+	movq	%rax, %rdi	# tmp165,
+	call	strncpy@PLT	#
+.LVL1002:
+	.loc 1 1526 13 is_stmt 1 view .LVU2103
+# qtest.c:1526:             bbuf[BUFSIZE - 1] = '\0';
+	.loc 1 1526 31 is_stmt 0 view .LVU2104
+	movb	$0, 767(%rsp)	#, bbuf[255]
+	.loc 1 1527 13 is_stmt 1 view .LVU2105
+.LVL1003:
+	.loc 1 1528 13 view .LVU2106
+# qtest.c:1527:             bytecode_name = bbuf;
+	.loc 1 1527 27 is_stmt 0 view .LVU2107
+	movq	8(%rsp), %rax	# %sfp, tmp165
+	movq	%rax, 56(%rsp)	# tmp165, %sfp
+# qtest.c:1528:             break;
+	.loc 1 1528 13 view .LVU2108
+	jmp	.L600	#
+.LVL1004:
+.L608:
+	.loc 1 1530 13 is_stmt 1 view .LVU2109
+	movl	$255, %edx	#,
+	movq	optarg(%rip), %rsi	# optarg,
+.LVL1005:
+	.loc 1 1530 13 is_stmt 0 view .LVU2110
+	movq	(%rsp), %rdi	# %sfp,
+	call	strncpy@PLT	#
+.LVL1006:
+	.loc 1 1531 13 is_stmt 1 view .LVU2111
+# qtest.c:1531:             jbuf[BUFSIZE - 1] = '\0';
+	.loc 1 1531 31 is_stmt 0 view .LVU2112
+	movb	$0, 511(%rsp)	#, jbuf[255]
+	.loc 1 1532 13 is_stmt 1 view .LVU2113
+.LVL1007:
+	.loc 1 1533 13 view .LVU2114
+# qtest.c:1532:             metrics_name = jbuf;
+	.loc 1 1532 26 is_stmt 0 view .LVU2115
+	movq	(%rsp), %rax	# %sfp, tmp264
+	movq	%rax, 16(%rsp)	# tmp264, %sfp
+# qtest.c:1533:             break;
+	.loc 1 1533 13 view .LVU2116
+	jmp	.L600	#
+.LVL1008:
+.L606:
+	.loc 1 1535 13 is_stmt 1 view .LVU2117
+	movl	$256, %edx	#,
+	movq	optarg(%rip), %rsi	# optarg,
+.LVL1009:
+	.loc 1 1535 13 is_stmt 0 view .LVU2118
+	movq	%r15, %rdi	# tmp263,
+	call	strncpy@PLT	#
+.LVL1010:
+	.loc 1 1536 13 is_stmt 1 view .LVU2119
+# qtest.c:1536:             buf[BUFSIZE - 1] = '\0';
+	.loc 1 1536 30 is_stmt 0 view .LVU2120
+	movb	$0, 1791(%rsp)	#, buf[255]
+	.loc 1 1537 13 is_stmt 1 view .LVU2121
+.LVL1011:
+	.loc 1 1538 13 view .LVU2122
+# qtest.c:1537:             logfile_name = lbuf;
+	.loc 1 1537 26 is_stmt 0 view .LVU2123
+	movq	%r15, 24(%rsp)	# tmp263, %sfp
+# qtest.c:1538:             break;
+	.loc 1 1538 13 view .LVU2124
+	jmp	.L600	#
+.LVL1012:
+.L601:
+	.loc 1 1540 13 is_stmt 1 view .LVU2125
+	leaq	.LC139(%rip), %rdi	#, tmp170
+	movl	$0, %eax	#,
+	call	printf@PLT	#
+.LVL1013:
+	.loc 1 1541 13 view .LVU2126
+	movq	0(%rbp), %rdi	# *argv_46(D),
+	call	usage	#
+.LVL1014:
+.L625:
+	.loc 1 1546 5 view .LVU2127
+	movl	$0, %edi	#,
+	call	set_seed	#
+.LVL1015:
+	.loc 1 1547 5 view .LVU2128
+.LBB198:
+.LBI198:
+	.loc 1 1390 13 view .LVU2129
+.LBB199:
+	.loc 1 1392 5 view .LVU2130
+# qtest.c:1392:     fail_count = 0;
+	.loc 1 1392 16 is_stmt 0 view .LVU2131
+	movl	$0, fail_count(%rip)	#, fail_count
+	.loc 1 1393 5 is_stmt 1 view .LVU2132
+# qtest.c:1393:     q = NULL;
+	.loc 1 1393 7 is_stmt 0 view .LVU2133
+	movq	$0, q(%rip)	#, q
+	.loc 1 1394 5 is_stmt 1 view .LVU2134
+# qtest.c:1394:     qcnt = 0;
+	.loc 1 1394 10 is_stmt 0 view .LVU2135
+	movq	$0, qcnt(%rip)	#, qcnt
+	.loc 1 1395 5 is_stmt 1 view .LVU2136
+	movw	$113, queues(%rip)	#, MEM <char[1:2]> [(void *)&queues]
+	.loc 1 1396 5 view .LVU2137
+# qtest.c:1396:     queue_slots = 1;
+	.loc 1 1396 17 is_stmt 0 view .LVU2138
+	movl	$1, queue_slots(%rip)	#, queue_slots
+	.loc 1 1397 5 is_stmt 1 view .LVU2139
+# qtest.c:1397:     current = 0;
+	.loc 1 1397 13 is_stmt 0 view .LVU2140
+	movl	$0, current(%rip)	#, current
+	.loc 1 1398 5 is_stmt 1 view .LVU2141
+	leaq	sigsegvhandler(%rip), %rsi	#, tmp173
+	movl	$11, %edi	#,
+	call	signal@PLT	#
+.LVL1016:
+	.loc 1 1399 5 view .LVU2142
+	leaq	sigalrmhandler(%rip), %rsi	#, tmp174
+	movl	$14, %edi	#,
+	call	signal@PLT	#
+.LVL1017:
+.LBE199:
+.LBE198:
+	.loc 1 1548 5 view .LVU2143
+	movl	$0, %eax	#,
+	call	init_cmd@PLT	#
+.LVL1018:
+	.loc 1 1549 5 view .LVU2144
+.LBB200:
+.LBI200:
+	.loc 1 134 13 view .LVU2145
+.LBB201:
+	.loc 1 136 5 view .LVU2146
+	leaq	.LC141(%rip), %rdx	#, tmp175
+	leaq	do_new(%rip), %rsi	#, tmp176
+	leaq	.LC142(%rip), %rdi	#, tmp177
+	call	add_cmd@PLT	#
+.LVL1019:
+	.loc 1 138 5 view .LVU2147
+	leaq	.LC143(%rip), %rdx	#, tmp178
+	leaq	do_free(%rip), %rsi	#, tmp179
+	leaq	.LC144(%rip), %rdi	#, tmp180
+	call	add_cmd@PLT	#
+.LVL1020:
+	.loc 1 140 5 view .LVU2148
+	leaq	.LC145(%rip), %rdx	#, tmp181
+	leaq	do_use(%rip), %rsi	#, tmp182
+	leaq	.LC146(%rip), %rdi	#, tmp183
+	call	add_cmd@PLT	#
+.LVL1021:
+	.loc 1 143 5 view .LVU2149
+	leaq	.LC147(%rip), %rdx	#, tmp184
+	leaq	do_queues(%rip), %rsi	#, tmp185
+	leaq	.LC148(%rip), %rdi	#, tmp186
+	call	add_cmd@PLT	#
+.LVL1022:
+	.loc 1 144 5 view .LVU2150
+	leaq	.LC149(%rip), %rdx	#, tmp187
+	leaq	do_splice(%rip), %rsi	#, tmp188
+	leaq	.LC150(%rip), %rdi	#, tmp189
+	call	add_cmd@PLT	#
+.LVL1023:
+	.loc 1 147 5 view .LVU2151
+	leaq	.LC151(%rip), %rdx	#, tmp190
+	leaq	do_merge(%rip), %rsi	#, tmp191
+	leaq	.LC152(%rip), %rdi	#, tmp192
+	call	add_cmd@PLT	#
+.LVL1024:
+	.loc 1 150 5 view .LVU2152
+	leaq	.LC153(%rip), %rdx	#, tmp193
+	leaq	do_mergebench(%rip), %rsi	#, tmp194
+	leaq	.LC154(%rip), %rdi	#, tmp195
+	call	add_cmd@PLT	#
+.LVL1025:
+	.loc 1 154 5 view .LVU2153
+	leaq	.LC155(%rip), %rdx	#, tmp196
+	leaq	do_insert_head(%rip), %rsi	#, tmp197
+	leaq	.LC156(%rip), %rdi	#, tmp198
+	call	add_cmd@PLT	#
+.LVL1026:
+	.loc 1 157 5 view .LVU2154
+	leaq	.LC157(%rip), %rdx	#, tmp199
+	leaq	do_insert_tail(%rip), %rsi	#, tmp200
+	leaq	.LC158(%rip), %rdi	#, tmp201
+	call	add_cmd@PLT	#
+.LVL1027:
+	.loc 1 160 5 view .LVU2155
+	leaq	.LC159(%rip), %rdx	#, tmp202
+	leaq	do_remove_head(%rip), %rsi	#, tmp203
+	leaq	.LC160(%rip), %rdi	#, tmp204
+	call	add_cmd@PLT	#
+.LVL1028:
+	.loc 1 163 5 view .LVU2156
+	leaq	.LC161(%rip), %rdx	#, tmp205
+	leaq	do_remove_head_quiet(%rip), %rsi	#, tmp206
+	leaq	.LC162(%rip), %rdi	#, tmp207
+	call	add_cmd@PLT	#
+.LVL1029:
+	.loc 1 166 5 view .LVU2157
+	leaq	.LC163(%rip), %rdx	#, tmp208
+	leaq	do_reverse(%rip), %rsi	#, tmp209
+	leaq	.LC164(%rip), %rdi	#, tmp210
+	call	add_cmd@PLT	#
+.LVL1030:
+	.loc 1 167 5 view .LVU2158
+	leaq	.LC165(%rip), %rdx	#, tmp211
+	leaq	do_sort(%rip), %rsi	#, tmp212
+	leaq	.LC166(%rip), %rdi	#, tmp213
+	call	add_cmd@PLT	#
+.LVL1031:
+	.loc 1 168 5 view .LVU2159
+	leaq	.LC167(%rip), %rdx	#, tmp214
+	leaq	do_size(%rip), %rsi	#, tmp215
+	leaq	.LC168(%rip), %rdi	#, tmp216
+	call	add_cmd@PLT	#
+.LVL1032:
+	.loc 1 170 5 view .LVU2160
+	leaq	.LC169(%rip), %rdx	#, tmp217
+	leaq	do_show(%rip), %rsi	#, tmp218
+	leaq	.LC170(%rip), %rdi	#, tmp219
+	call	add_cmd@PLT	#
+.LVL1033:
+	.loc 1 171 5 view .LVU2161
+	leaq	.LC171(%rip), %rdx	#, tmp220
+	leaq	do_failat(%rip), %rsi	#, tmp221
+	leaq	.LC172(%rip), %rdi	#, tmp222
+	call	add_cmd@PLT	#
+.LVL1034:
+	.loc 1 174 5 view .LVU2162
+	leaq	.LC173(%rip), %rdx	#, tmp223
+	leaq	do_latency(%rip), %rsi	#, tmp224
+	leaq	.LC174(%rip), %rdi	#, tmp225
+	call	add_cmd@PLT	#
+.LVL1035:
+	.loc 1 177 5 view .LVU2163
+	leaq	.LC175(%rip), %rdx	#, tmp226
+	leaq	do_complexity(%rip), %rsi	#, tmp227
+	leaq	.LC176(%rip), %rdi	#, tmp228
+	call	add_cmd@PLT	#
+.LVL1036:
+	.loc 1 182 5 view .LVU2164
+	leaq	.LC177(%rip), %rdx	#, tmp229
+	leaq	do_leaks(%rip), %rsi	#, tmp230
+	leaq	.LC178(%rip), %rdi	#, tmp231
+	call	add_cmd@PLT	#
+.LVL1037:
+	.loc 1 185 5 view .LVU2165
+	movl	$0, %ecx	#,
+	leaq	.LC179(%rip), %rdx	#, tmp232
+	leaq	string_length(%rip), %rsi	#, tmp233
+	leaq	.LC180(%rip), %rdi	#, tmp234
+	call	add_param@PLT	#
+.LVL1038:
+	.loc 1 187 5 view .LVU2166
+	movl	$0, %ecx	#,
+	leaq	.LC181(%rip), %rdx	#, tmp235
+	leaq	fail_probability(%rip), %rsi	#, tmp236
+	leaq	.LC182(%rip), %rdi	#, tmp237
+	call	add_param@PLT	#
+.LVL1039:
+	.loc 1 189 5 view .LVU2167
+	movl	$0, %ecx	#,
+	leaq	.LC183(%rip), %rdx	#, tmp238
+	leaq	fail_every(%rip), %rsi	#, tmp239
+	leaq	.LC184(%rip), %rdi	#, tmp240
+	call	add_param@PLT	#
+.LVL1040:
+	.loc 1 191 5 view .LVU2168
+	leaq	set_seed(%rip), %rcx	#, tmp241
+	leaq	.LC185(%rip), %rdx	#, tmp242
+	leaq	seed(%rip), %rsi	#, tmp243
+	leaq	.LC186(%rip), %rdi	#, tmp244
+	call	add_param@PLT	#
+.LVL1041:
+	.loc 1 195 5 view .LVU2169
+	movl	$0, %ecx	#,
+	leaq	.LC187(%rip), %rdx	#, tmp245
+	leaq	fail_limit(%rip), %rsi	#, tmp246
+	leaq	.LC188(%rip), %rdi	#, tmp247
+	call	add_param@PLT	#
+.LVL1042:
+	.loc 1 197 5 view .LVU2170
+	movl	$0, %ecx	#,
+	leaq	.LC189(%rip), %rdx	#, tmp248
+	leaq	quarantine_max_blocks(%rip), %rsi	#, tmp249
+	leaq	.LC190(%rip), %rdi	#, tmp250
+	call	add_param@PLT	#
+.LVL1043:
+	.loc 1 200 5 view .LVU2171
+	movl	$0, %ecx	#,
+	leaq	.LC191(%rip), %rdx	#, tmp251
+	leaq	quarantine_max_kb(%rip), %rsi	#, tmp252
+	leaq	.LC192(%rip), %rdi	#, tmp253
+	call	add_param@PLT	#
+.LVL1044:
+.LBE201:
+.LBE200:
+	.loc 1 1551 5 view .LVU2172
+	movl	36(%rsp), %ebx	# %sfp, level
+	movl	%ebx, %edi	# level,
+	call	set_verblevel@PLT	#
+.LVL1045:
+	.loc 1 1552 5 view .LVU2173
+# qtest.c:1552:     if (level > 1) {
+	.loc 1 1552 8 is_stmt 0 view .LVU2174
+	cmpl	$1, %ebx	#, level
+	jg	.L626	#,
+.L614:
+	.loc 1 1556 5 is_stmt 1 view .LVU2175
+	movl	seed(%rip), %edx	# seed,
+	leaq	.LC193(%rip), %rsi	#, tmp255
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report@PLT	#
+.LVL1046:
+	.loc 1 1557 5 view .LVU2176
+# qtest.c:1557:     if (logfile_name)
+	.loc 1 1557 8 is_stmt 0 view .LVU2177
+	movq	24(%rsp), %rax	# %sfp, logfile_name
+	testq	%rax, %rax	# logfile_name
+	je	.L615	#,
+	.loc 1 1558 9 is_stmt 1 view .LVU2178
+	movq	%rax, %rdi	# logfile_name,
+	call	set_logfile@PLT	#
+.LVL1047:
+.L615:
+	.loc 1 1559 5 view .LVU2179
+# qtest.c:1559:     if (metrics_name && !set_metrics_file(metrics_name)) {
+	.loc 1 1559 8 is_stmt 0 view .LVU2180
+	movq	16(%rsp), %rax	# %sfp, metrics_name
+	testq	%rax, %rax	# metrics_name
+	je	.L616	#,
+# qtest.c:1559:     if (metrics_name && !set_metrics_file(metrics_name)) {
+	.loc 1 1559 26 discriminator 1 view .LVU2181
+	movq	%rax, %rdi	# metrics_name,
+	call	set_metrics_file@PLT	#
+.LVL1048:
+# qtest.c:1559:     if (metrics_name && !set_metrics_file(metrics_name)) {
+	.loc 1 1559 22 discriminator 1 view .LVU2182
+	testb	%al, %al	# tmp277
+	je	.L627	#,
+.L616:
+	.loc 1 1563 5 is_stmt 1 view .LVU2183
+	leaq	queue_metrics(%rip), %rdi	#, tmp257
+	call	set_metrics_helper@PLT	#
+.LVL1049:
+	.loc 1 1565 5 view .LVU2184
+	leaq	queue_quit(%rip), %rdi	#, tmp258
+	call	add_quit_helper@PLT	#
+.LVL1050:
+	.loc 1 1567 5 view .LVU2185
+	.loc 1 1568 5 view .LVU2186
+# qtest.c:1568:     if (compile_name)
+	.loc 1 1568 8 is_stmt 0 view .LVU2187
+	movq	40(%rsp), %rsi	# %sfp, compile_name
+	testq	%rsi, %rsi	# compile_name
+	je	.L617	#,
+	.loc 1 1569 9 is_stmt 1 discriminator 1 view .LVU2188
+# qtest.c:1569:         ok = ok && compile_file(infile_name, compile_name);
+	.loc 1 1569 20 is_stmt 0 discriminator 1 view .LVU2189
+	movq	48(%rsp), %rdi	# %sfp,
+	call	compile_file@PLT	#
+.LVL1051:
+# qtest.c:1569:         ok = ok && compile_file(infile_name, compile_name);
+	.loc 1 1569 17 discriminator 1 view .LVU2190
+	testb	%al, %al	# tmp278
+	je	.L619	#,
+.L618:
+.LVL1052:
+# qtest.c:1574:     ok = ok && finish_cmd();
+	.loc 1 1574 16 discriminator 1 view .LVU2191
+	movl	$0, %eax	#,
+	call	finish_cmd@PLT	#
+.LVL1053:
+# qtest.c:1574:     ok = ok && finish_cmd();
+	.loc 1 1574 13 discriminator 1 view .LVU2192
+	movzbl	%al, %r14d	# tmp281, iftmp.12_30
+.L619:
+.LVL1054:
+	.loc 1 1576 5 is_stmt 1 discriminator 6 view .LVU2193
+# qtest.c:1576:     return ok ? 0 : 1;
+	.loc 1 1576 19 is_stmt 0 discriminator 6 view .LVU2194
+	movl	%r14d, %eax	# iftmp.12_30, iftmp.12_30
+	notl	%eax	# iftmp.12_30
+	andl	$1, %eax	#, <retval>
+.LVL1055:
+.L592:
+# qtest.c:1577: }
+	.loc 1 1577 1 view .LVU2195
+	addq	$1800, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL1056:
+	.loc 1 1577 1 view .LVU2196
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL1057:
+	.loc 1 1577 1 view .LVU2197
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL1058:
+.L626:
+	.cfi_restore_state
+	.loc 1 1553 9 is_stmt 1 view .LVU2198
+	movl	$1, %edi	#,
+	call	set_echo@PLT	#
+.LVL1059:
+	jmp	.L614	#
+.L627:
+	.loc 1 1560 9 view .LVU2199
+	movq	16(%rsp), %rsi	# %sfp,
+	leaq	.LC194(%rip), %rdi	#, tmp256
+	call	printf@PLT	#
+.LVL1060:
+	.loc 1 1561 9 view .LVU2200
+# qtest.c:1561:         return 1;
+	.loc 1 1561 16 is_stmt 0 view .LVU2201
+	movl	$1, %eax	#, <retval>
+	jmp	.L592	#
+.LVL1061:
+.L617:
+	.loc 1 1570 10 is_stmt 1 view .LVU2202
+# qtest.c:1570:     else if (bytecode_name)
+	.loc 1 1570 13 is_stmt 0 view .LVU2203
+	movq	56(%rsp), %rax	# %sfp, bytecode_name
+	testq	%rax, %rax	# bytecode_name
+	je	.L620	#,
+	.loc 1 1571 9 is_stmt 1 discriminator 1 view .LVU2204
+# qtest.c:1571:         ok = ok && run_bytecode(bytecode_name);
+	.loc 1 1571 20 is_stmt 0 discriminator 1 view .LVU2205
+	movq	%rax, %rdi	# bytecode_name,
+	call	run_bytecode@PLT	#
+.LVL1062:
+# qtest.c:1571:         ok = ok && run_bytecode(bytecode_name);
+	.loc 1 1571 17 discriminator 1 view .LVU2206
+	testb	%al, %al	# tmp279
+	jne	.L618	#,
+	jmp	.L619	#
+.L620:
+	.loc 1 1573 9 is_stmt 1 discriminator 1 view .LVU2207
+# qtest.c:1573:         ok = ok && run_console(infile_name);
+	.loc 1 1573 20 is_stmt 0 discriminator 1 view .LVU2208
+	movq	48(%rsp), %rdi	# %sfp,
+	call	run_console@PLT	#
+.LVL1063:
+# qtest.c:1573:         ok = ok && run_console(infile_name);
+	.loc 1 1573 17 discriminator 1 view .LVU2209
+	testb	%al, %al	# tmp280
+	je	.L619	#,
+	jmp	.L618	#
+	.cfi_endproc
+.LFE76:
+	.size	main, .-main
+	.section	.rodata.str1.1
+.LC195:
+	.string	"transfer"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	cplx_ops, @object
+	.size	cplx_ops, 256
+cplx_ops:
+# name:
+	.quad	.LC168
+# reps:
+	.long	256
+# run:
+	.zero	4
+	.quad	cplx_size
+# undo:
+	.quad	0
+# name:
+	.quad	.LC156
+# reps:
+	.long	256
+# run:
+	.zero	4
+	.quad	cplx_insert_head
+# undo:
+	.quad	cplx_remove_head
+# name:
+	.quad	.LC158
+# reps:
+	.long	256
+# run:
+	.zero	4
+	.quad	cplx_insert_tail
+# undo:
+	.quad	cplx_remove_head
+# name:
+	.quad	.LC160
+# reps:
+	.long	256
+# run:
+	.zero	4
+	.quad	cplx_remove_head
+# undo:
+	.quad	cplx_insert_head
+# name:
+	.quad	.LC150
+# reps:
+	.long	256
+# run:
+	.zero	4
+	.quad	cplx_splice
+# undo:
+	.quad	0
+# name:
+	.quad	.LC195
+# reps:
+	.long	1
+# run:
+	.zero	4
+	.quad	cplx_transfer
+# undo:
+	.quad	cplx_transfer_back
+# name:
+	.quad	.LC164
+# reps:
+	.long	1
+# run:
+	.zero	4
+	.quad	cplx_reverse
+# undo:
+	.quad	0
+# name:
+	.quad	.LC166
+# reps:
+	.long	1
+# run:
+	.zero	4
+	.quad	cplx_sort
+# undo:
+	.quad	cplx_randomize
+	.local	cplx_side
+	.comm	cplx_side,8,8
+	.local	cplx_buf
+	.comm	cplx_buf,10,8
+	.section	.rodata
+	.align 16
+	.type	charset, @object
+	.size	charset, 27
+charset:
+	.string	"abcdefghijklmnopqrstuvwxyz"
+	.local	latency
+	.comm	latency,46128,32
+	.section	.rodata.str1.1
+.LC196:
+	.string	"insert_head"
+.LC197:
+	.string	"insert_tail"
+	.section	.data.rel.ro.local
+	.align 16
+	.type	lat_names, @object
+	.size	lat_names, 24
+lat_names:
+	.quad	.LC196
+	.quad	.LC197
+	.quad	.LC168
+	.local	metrics_alloc_start
+	.comm	metrics_alloc_start,8,8
+	.local	leakfile_name
+	.comm	leakfile_name,8,8
+	.local	seed
+	.comm	seed,4,4
+	.data
+	.align 4
+	.type	string_length, @object
+	.size	string_length, 4
+string_length:
+	.long	1024
+	.local	fail_count
+	.comm	fail_count,4,4
+	.align 4
+	.type	fail_limit, @object
+	.size	fail_limit, 4
+fail_limit:
+	.long	30
+	.local	current
+	.comm	current,4,4
+	.align 4
+	.type	queue_slots, @object
+	.size	queue_slots, 4
+queue_slots:
+	.long	1
+	.local	queues
+	.comm	queues,2048,32
+	.local	qcnt
+	.comm	qcnt,8,8
+	.local	q
+	.comm	q,8,8
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC36:
+	.long	0
+	.long	1079574528
+	.align 8
+.LC48:
+	.long	-652835029
+	.long	1072691150
+	.align 8
+.LC49:
+	.long	2061584302
+	.long	1072672276
+	.align 8
+.LC50:
+	.long	-858993459
+	.long	1072483532
+	.align 8
+.LC51:
+	.long	0
+	.long	1071644672
+	.text
+.Letext0:
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.file 7 "/usr/include/signal.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 13 "/usr/include/spawn.h"
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h"
+	.file 17 "/usr/include/stdio.h"
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 20 "./queue.h"
+	.file 21 "dudect/constant.h"
+	.file 22 "dudect/fixture.h"
+	.file 23 "complexity.h"
+	.file 24 "histogram.h"
+	.file 25 "harness.h"
+	.file 26 "console.h"
+	.file 27 "report.h"
+	.file 28 "/usr/include/string.h"
+	.file 29 "/usr/include/strings.h"
+	.file 30 "/usr/include/x86_64-linux-gnu/sys/wait.h"
+	.file 31 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 32 "/usr/include/time.h"
+	.file 33 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x63a3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x40
+	.long	.LASF363
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x19
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x19
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF3
+	.uleb128 0x1b
+	.long	.LASF88
+	.byte	0x10
+	.byte	0x24
+	.byte	0xe
+	.long	0x48
+	.uleb128 0xa
+	.long	0x52
+	.uleb128 0x1c
+	.long	0x48
+	.uleb128 0x19
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF4
+	.uleb128 0x1c
+	.long	0x52
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0x59
+	.uleb128 0x20
+	.long	0x65
+	.uleb128 0xa
+	.long	0x5e
+	.uleb128 0x19
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x19
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x19
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x19
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x9
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x2c
+	.byte	0x19
+	.long	0xa3
+	.uleb128 0x19
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x9
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x9
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x91
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x9
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x92
+	.byte	0x19
+	.long	0x82
+	.uleb128 0x9
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x93
+	.byte	0x19
+	.long	0x82
+	.uleb128 0x9
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x94
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x9
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x96
+	.byte	0x1a
+	.long	0x82
+	.uleb128 0x9
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x97
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x9
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x98
+	.byte	0x19
+	.long	0xa3
+	.uleb128 0x9
+	.long	.LASF20
+	.byte	0x4
+	.byte	0x99
+	.byte	0x1b
+	.long	0xa3
+	.uleb128 0x9
+	.long	.LASF21
+	.byte	0x4
+	.byte	0x9a
+	.byte	0x19
+	.long	0x5e
+	.uleb128 0x9
+	.long	.LASF22
+	.byte	0x4
+	.byte	0xa0
+	.byte	0x1a
+	.long	0xa3
+	.uleb128 0x42
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF23
+	.byte	0x4
+	.byte	0xaf
+	.byte	0x1d
+	.long	0xa3
+	.uleb128 0x9
+	.long	.LASF24
+	.byte	0x4
+	.byte	0xb4
+	.byte	0x1c
+	.long	0xa3
+	.uleb128 0x9
+	.long	.LASF25
+	.byte	0x4
+	.byte	0xc5
+	.byte	0x21
+	.long	0xa3
+	.uleb128 0x21
+	.byte	0x80
+	.byte	0x5
+	.byte	0x5
+	.long	0x16a
+	.uleb128 0x5
+	.long	.LASF30
+	.byte	0x5
+	.byte	0x7
+	.byte	0x15
+	.long	0x16a
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x2e
+	.long	0x17a
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF26
+	.byte	0x5
+	.byte	0x8
+	.byte	0x3
+	.long	0x154
+	.uleb128 0x9
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x7
+	.byte	0x14
+	.long	0x17a
+	.uleb128 0x9
+	.long	.LASF28
+	.byte	0x7
+	.byte	0x28
+	.byte	0x11
+	.long	0x116
+	.uleb128 0x9
+	.long	.LASF29
+	.byte	0x8
+	.byte	0xa
+	.byte	0x12
+	.long	0x122
+	.uleb128 0x28
+	.long	.LASF37
+	.byte	0x10
+	.byte	0x9
+	.byte	0xb
+	.long	0x1d1
+	.uleb128 0x5
+	.long	.LASF31
+	.byte	0x9
+	.byte	0x10
+	.byte	0xc
+	.long	0x122
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF32
+	.byte	0x9
+	.byte	0x15
+	.byte	0x15
+	.long	0x148
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF33
+	.byte	0x7
+	.byte	0x48
+	.byte	0x10
+	.long	0x1dd
+	.uleb128 0xa
+	.long	0x1e2
+	.uleb128 0x29
+	.long	0x1ed
+	.uleb128 0x3
+	.long	0x5e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF34
+	.byte	0xa
+	.byte	0xd6
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x19
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF35
+	.uleb128 0x19
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF36
+	.uleb128 0x28
+	.long	.LASF38
+	.byte	0x4
+	.byte	0xb
+	.byte	0x17
+	.long	0x221
+	.uleb128 0x5
+	.long	.LASF39
+	.byte	0xb
+	.byte	0x19
+	.byte	0x7
+	.long	0x5e
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF40
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x13
+	.long	0x97
+	.uleb128 0x34
+	.value	0x150
+	.byte	0xd
+	.byte	0x1d
+	.long	0x292
+	.uleb128 0x5
+	.long	.LASF41
+	.byte	0xd
+	.byte	0x1f
+	.byte	0xd
+	.long	0x90
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF42
+	.byte	0xd
+	.byte	0x20
+	.byte	0x9
+	.long	0x192
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF43
+	.byte	0xd
+	.byte	0x21
+	.byte	0xc
+	.long	0x186
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF44
+	.byte	0xd
+	.byte	0x22
+	.byte	0xc
+	.long	0x186
+	.byte	0x88
+	.uleb128 0x2d
+	.long	.LASF45
+	.byte	0x23
+	.byte	0x16
+	.long	0x207
+	.value	0x108
+	.uleb128 0x2d
+	.long	.LASF46
+	.byte	0x24
+	.byte	0x7
+	.long	0x5e
+	.value	0x10c
+	.uleb128 0x2d
+	.long	.LASF47
+	.byte	0x25
+	.byte	0x7
+	.long	0x292
+	.value	0x110
+	.byte	0
+	.uleb128 0xd
+	.long	0x5e
+	.long	0x2a2
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF48
+	.byte	0xd
+	.byte	0x26
+	.byte	0x3
+	.long	0x22d
+	.uleb128 0x1c
+	.long	0x2a2
+	.uleb128 0x21
+	.byte	0x50
+	.byte	0xd
+	.byte	0x2b
+	.long	0x2f0
+	.uleb128 0x5
+	.long	.LASF49
+	.byte	0xd
+	.byte	0x2d
+	.byte	0x7
+	.long	0x5e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF50
+	.byte	0xd
+	.byte	0x2e
+	.byte	0x7
+	.long	0x5e
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF51
+	.byte	0xd
+	.byte	0x2f
+	.byte	0x1a
+	.long	0x2f5
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF47
+	.byte	0xd
+	.byte	0x30
+	.byte	0x7
+	.long	0x292
+	.byte	0x10
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF84
+	.uleb128 0xa
+	.long	0x2f0
+	.uleb128 0x9
+	.long	.LASF52
+	.byte	0xd
+	.byte	0x31
+	.byte	0x3
+	.long	0x2b3
+	.uleb128 0x1c
+	.long	0x2fa
+	.uleb128 0x28
+	.long	.LASF53
+	.byte	0xd8
+	.byte	0xe
+	.byte	0x31
+	.long	0x491
+	.uleb128 0x5
+	.long	.LASF54
+	.byte	0xe
+	.byte	0x33
+	.byte	0x7
+	.long	0x5e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF55
+	.byte	0xe
+	.byte	0x36
+	.byte	0x9
+	.long	0x48
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF56
+	.byte	0xe
+	.byte	0x37
+	.byte	0x9
+	.long	0x48
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF57
+	.byte	0xe
+	.byte	0x38
+	.byte	0x9
+	.long	0x48
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF58
+	.byte	0xe
+	.byte	0x39
+	.byte	0x9
+	.long	0x48
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0xe
+	.byte	0x3a
+	.byte	0x9
+	.long	0x48
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0xe
+	.byte	0x3b
+	.byte	0x9
+	.long	0x48
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0xe
+	.byte	0x3c
+	.byte	0x9
+	.long	0x48
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0xe
+	.byte	0x3d
+	.byte	0x9
+	.long	0x48
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0xe
+	.byte	0x40
+	.byte	0x9
+	.long	0x48
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF64
+	.byte	0xe
+	.byte	0x41
+	.byte	0x9
+	.long	0x48
+	.byte	0x50
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0xe
+	.byte	0x42
+	.byte	0x9
+	.long	0x48
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF66
+	.byte	0xe
+	.byte	0x44
+	.byte	0x16
+	.long	0x4aa
+	.byte	0x60
+	.uleb128 0x5
+	.long	.LASF67
+	.byte	0xe
+	.byte	0x46
+	.byte	0x14
+	.long	0x4af
+	.byte	0x68
+	.uleb128 0x5
+	.long	.LASF68
+	.byte	0xe
+	.byte	0x48
+	.byte	0x7
+	.long	0x5e
+	.byte	0x70
+	.uleb128 0x5
+	.long	.LASF69
+	.byte	0xe
+	.byte	0x49
+	.byte	0x7
+	.long	0x5e
+	.byte	0x74
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0xe
+	.byte	0x4a
+	.byte	0xb
+	.long	0xfe
+	.byte	0x78
+	.uleb128 0x5
+	.long	.LASF71
+	.byte	0xe
+	.byte	0x4d
+	.byte	0x12
+	.long	0x7b
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF72
+	.byte	0xe
+	.byte	0x4e
+	.byte	0xf
+	.long	0x89
+	.byte	0x82
+	.uleb128 0x5
+	.long	.LASF73
+	.byte	0xe
+	.byte	0x4f
+	.byte	0x8
+	.long	0x4b4
+	.byte	0x83
+	.uleb128 0x5
+	.long	.LASF74
+	.byte	0xe
+	.byte	0x51
+	.byte	0xf
+	.long	0x4c4
+	.byte	0x88
+	.uleb128 0x5
+	.long	.LASF75
+	.byte	0xe
+	.byte	0x59
+	.byte	0xd
+	.long	0x10a
+	.byte	0x90
+	.uleb128 0x5
+	.long	.LASF76
+	.byte	0xe
+	.byte	0x5b
+	.byte	0x17
+	.long	0x4ce
+	.byte	0x98
+	.uleb128 0x5
+	.long	.LASF77
+	.byte	0xe
+	.byte	0x5c
+	.byte	0x19
+	.long	0x4d8
+	.byte	0xa0
+	.uleb128 0x5
+	.long	.LASF78
+	.byte	0xe
+	.byte	0x5d
+	.byte	0x14
+	.long	0x4af
+	.byte	0xa8
+	.uleb128 0x5
+	.long	.LASF79
+	.byte	0xe
+	.byte	0x5e
+	.byte	0x9
+	.long	0x12e
+	.byte	0xb0
+	.uleb128 0x5
+	.long	.LASF80
+	.byte	0xe
+	.byte	0x5f
+	.byte	0xa
+	.long	0x1ed
+	.byte	0xb8
+	.uleb128 0x5
+	.long	.LASF81
+	.byte	0xe
+	.byte	0x60
+	.byte	0x7
+	.long	0x5e
+	.byte	0xc0
+	.uleb128 0x5
+	.long	.LASF82
+	.byte	0xe
+	.byte	0x62
+	.byte	0x8
+	.long	0x4dd
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF83
+	.byte	0xf
+	.byte	0x7
+	.byte	0x19
+	.long	0x30b
+	.uleb128 0x43
+	.long	.LASF364
+	.byte	0xe
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x2a
+	.long	.LASF85
+	.uleb128 0xa
+	.long	0x4a5
+	.uleb128 0xa
+	.long	0x30b
+	.uleb128 0xd
+	.long	0x52
+	.long	0x4c4
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x49d
+	.uleb128 0x2a
+	.long	.LASF86
+	.uleb128 0xa
+	.long	0x4c9
+	.uleb128 0x2a
+	.long	.LASF87
+	.uleb128 0xa
+	.long	0x4d3
+	.uleb128 0xd
+	.long	0x52
+	.long	0x4ed
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x13
+	.byte	0
+	.uleb128 0xa
+	.long	0x491
+	.uleb128 0x1b
+	.long	.LASF89
+	.byte	0x11
+	.byte	0x90
+	.byte	0xe
+	.long	0x4ed
+	.uleb128 0x1b
+	.long	.LASF90
+	.byte	0x11
+	.byte	0x91
+	.byte	0xe
+	.long	0x4ed
+	.uleb128 0x28
+	.long	.LASF91
+	.byte	0x90
+	.byte	0x12
+	.byte	0x1a
+	.long	0x5da
+	.uleb128 0x5
+	.long	.LASF92
+	.byte	0x12
+	.byte	0x1f
+	.byte	0xd
+	.long	0xb6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF93
+	.byte	0x12
+	.byte	0x24
+	.byte	0xd
+	.long	0xda
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF94
+	.byte	0x12
+	.byte	0x2c
+	.byte	0xf
+	.long	0xf2
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF95
+	.byte	0x12
+	.byte	0x2d
+	.byte	0xe
+	.long	0xe6
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF96
+	.byte	0x12
+	.byte	0x2f
+	.byte	0xd
+	.long	0xc2
+	.byte	0x1c
+	.uleb128 0x5
+	.long	.LASF97
+	.byte	0x12
+	.byte	0x30
+	.byte	0xd
+	.long	0xce
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF98
+	.byte	0x12
+	.byte	0x32
+	.byte	0x9
+	.long	0x5e
+	.byte	0x24
+	.uleb128 0x5
+	.long	.LASF99
+	.byte	0x12
+	.byte	0x34
+	.byte	0xd
+	.long	0xb6
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF100
+	.byte	0x12
+	.byte	0x39
+	.byte	0xd
+	.long	0xfe
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF101
+	.byte	0x12
+	.byte	0x3d
+	.byte	0x11
+	.long	0x130
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF102
+	.byte	0x12
+	.byte	0x3f
+	.byte	0x10
+	.long	0x13c
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF103
+	.byte	0x12
+	.byte	0x4a
+	.byte	0x15
+	.long	0x1aa
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF104
+	.byte	0x12
+	.byte	0x4b
+	.byte	0x15
+	.long	0x1aa
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF105
+	.byte	0x12
+	.byte	0x4c
+	.byte	0x15
+	.long	0x1aa
+	.byte	0x68
+	.uleb128 0x5
+	.long	.LASF106
+	.byte	0x12
+	.byte	0x59
+	.byte	0x17
+	.long	0x5da
+	.byte	0x78
+	.byte	0
+	.uleb128 0xd
+	.long	0x148
+	.long	0x5ea
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	0x48
+	.uleb128 0x20
+	.long	0x5ea
+	.uleb128 0x9
+	.long	.LASF107
+	.byte	0x13
+	.byte	0x1b
+	.byte	0x14
+	.long	0xaa
+	.uleb128 0x19
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF108
+	.uleb128 0x44
+	.string	"ELE"
+	.byte	0x10
+	.byte	0x14
+	.byte	0x11
+	.byte	0x10
+	.long	0x62f
+	.uleb128 0x5
+	.long	.LASF109
+	.byte	0x14
+	.byte	0x15
+	.byte	0xb
+	.long	0x48
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF110
+	.byte	0x14
+	.byte	0x16
+	.byte	0x11
+	.long	0x62f
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0x607
+	.uleb128 0x9
+	.long	.LASF111
+	.byte	0x14
+	.byte	0x17
+	.byte	0x3
+	.long	0x607
+	.uleb128 0x21
+	.byte	0x18
+	.byte	0x14
+	.byte	0x1a
+	.long	0x670
+	.uleb128 0x5
+	.long	.LASF112
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x11
+	.long	0x670
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF113
+	.byte	0x14
+	.byte	0x1c
+	.byte	0x11
+	.long	0x670
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF114
+	.byte	0x14
+	.byte	0x1d
+	.byte	0x9
+	.long	0x5e
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.long	0x634
+	.uleb128 0x9
+	.long	.LASF115
+	.byte	0x14
+	.byte	0x1e
+	.byte	0x3
+	.long	0x640
+	.uleb128 0x2e
+	.long	0x82
+	.byte	0x15
+	.byte	0xa
+	.byte	0x6
+	.long	0x6be
+	.uleb128 0x14
+	.long	.LASF116
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF117
+	.byte	0x1
+	.uleb128 0x14
+	.long	.LASF118
+	.byte	0x2
+	.uleb128 0x14
+	.long	.LASF119
+	.byte	0x3
+	.uleb128 0x14
+	.long	.LASF120
+	.byte	0x4
+	.uleb128 0x14
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF122
+	.byte	0x6
+	.uleb128 0x14
+	.long	.LASF123
+	.byte	0x7
+	.byte	0
+	.uleb128 0x21
+	.byte	0x30
+	.byte	0x15
+	.byte	0x16
+	.long	0x715
+	.uleb128 0x5
+	.long	.LASF124
+	.byte	0x15
+	.byte	0x17
+	.byte	0xb
+	.long	0x48
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF125
+	.byte	0x15
+	.byte	0x19
+	.byte	0xa
+	.long	0x715
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF126
+	.byte	0x15
+	.byte	0x1b
+	.byte	0x10
+	.long	0x730
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF127
+	.byte	0x15
+	.byte	0x1d
+	.byte	0x10
+	.long	0x749
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF128
+	.byte	0x15
+	.byte	0x1f
+	.byte	0xc
+	.long	0x759
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF129
+	.byte	0x15
+	.byte	0x24
+	.byte	0xc
+	.long	0x759
+	.byte	0x28
+	.byte	0
+	.uleb128 0x19
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF130
+	.uleb128 0x2f
+	.long	0x72b
+	.long	0x72b
+	.uleb128 0x3
+	.long	0x1ed
+	.byte	0
+	.uleb128 0xa
+	.long	0x675
+	.uleb128 0xa
+	.long	0x71c
+	.uleb128 0x2f
+	.long	0x72b
+	.long	0x749
+	.uleb128 0x3
+	.long	0x72b
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0xa
+	.long	0x735
+	.uleb128 0x29
+	.long	0x759
+	.uleb128 0x3
+	.long	0x72b
+	.byte	0
+	.uleb128 0xa
+	.long	0x74e
+	.uleb128 0x9
+	.long	.LASF131
+	.byte	0x15
+	.byte	0x25
+	.byte	0x3
+	.long	0x6be
+	.uleb128 0x1c
+	.long	0x75e
+	.uleb128 0xd
+	.long	0x76a
+	.long	0x77f
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x6
+	.byte	0
+	.uleb128 0x1c
+	.long	0x76f
+	.uleb128 0x1b
+	.long	.LASF132
+	.byte	0x15
+	.byte	0x27
+	.byte	0x17
+	.long	0x77f
+	.uleb128 0x21
+	.byte	0x20
+	.byte	0x16
+	.byte	0x16
+	.long	0x7cd
+	.uleb128 0x5
+	.long	.LASF133
+	.byte	0x16
+	.byte	0x17
+	.byte	0x9
+	.long	0x5e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF134
+	.byte	0x16
+	.byte	0x18
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF135
+	.byte	0x16
+	.byte	0x19
+	.byte	0xc
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF136
+	.byte	0x16
+	.byte	0x1a
+	.byte	0xc
+	.long	0x35
+	.byte	0x18
+	.byte	0
+	.uleb128 0x1c
+	.long	0x35
+	.uleb128 0x9
+	.long	.LASF137
+	.byte	0x16
+	.byte	0x1b
+	.byte	0x3
+	.long	0x790
+	.uleb128 0x2e
+	.long	0x82
+	.byte	0x17
+	.byte	0xa
+	.byte	0xe
+	.long	0x809
+	.uleb128 0x14
+	.long	.LASF138
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF139
+	.byte	0x1
+	.uleb128 0x14
+	.long	.LASF140
+	.byte	0x2
+	.uleb128 0x14
+	.long	.LASF141
+	.byte	0x3
+	.uleb128 0x14
+	.long	.LASF142
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF143
+	.byte	0x17
+	.byte	0x10
+	.byte	0x3
+	.long	0x7de
+	.uleb128 0xd
+	.long	0x65
+	.long	0x825
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF144
+	.byte	0x17
+	.byte	0x12
+	.byte	0x14
+	.long	0x815
+	.uleb128 0x21
+	.byte	0x50
+	.byte	0x17
+	.byte	0x14
+	.long	0x86e
+	.uleb128 0x5
+	.long	.LASF145
+	.byte	0x17
+	.byte	0x15
+	.byte	0xc
+	.long	0x86e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF146
+	.byte	0x17
+	.byte	0x16
+	.byte	0xc
+	.long	0x86e
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF147
+	.byte	0x17
+	.byte	0x17
+	.byte	0x12
+	.long	0x809
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF148
+	.byte	0x17
+	.byte	0x19
+	.byte	0xc
+	.long	0x35
+	.byte	0x48
+	.byte	0
+	.uleb128 0xd
+	.long	0x35
+	.long	0x87e
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF149
+	.byte	0x17
+	.byte	0x1a
+	.byte	0x3
+	.long	0x831
+	.uleb128 0x34
+	.value	0x3c10
+	.byte	0x18
+	.byte	0xf
+	.long	0x8bb
+	.uleb128 0x5
+	.long	.LASF150
+	.byte	0x18
+	.byte	0x10
+	.byte	0xe
+	.long	0x5f4
+	.byte	0
+	.uleb128 0x30
+	.string	"max"
+	.byte	0x18
+	.byte	0x11
+	.byte	0xe
+	.long	0x5f4
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF151
+	.byte	0x18
+	.byte	0x12
+	.byte	0xe
+	.long	0x8bb
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd
+	.long	0x5f4
+	.long	0x8cc
+	.uleb128 0x45
+	.long	0x2e
+	.value	0x77f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF152
+	.byte	0x18
+	.byte	0x13
+	.byte	0x3
+	.long	0x88a
+	.uleb128 0x1b
+	.long	.LASF153
+	.byte	0x19
+	.byte	0x25
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x1b
+	.long	.LASF154
+	.byte	0x19
+	.byte	0x28
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x1b
+	.long	.LASF155
+	.byte	0x19
+	.byte	0x3d
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x1b
+	.long	.LASF156
+	.byte	0x19
+	.byte	0x3e
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x1b
+	.long	.LASF157
+	.byte	0x1a
+	.byte	0xa
+	.byte	0xd
+	.long	0x715
+	.uleb128 0x9
+	.long	.LASF158
+	.byte	0x1a
+	.byte	0xf
+	.byte	0x10
+	.long	0x920
+	.uleb128 0xa
+	.long	0x925
+	.uleb128 0x2f
+	.long	0x715
+	.long	0x939
+	.uleb128 0x3
+	.long	0x5e
+	.uleb128 0x3
+	.long	0x5ea
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF159
+	.byte	0x1a
+	.byte	0x22
+	.byte	0x10
+	.long	0x1dd
+	.uleb128 0x9
+	.long	.LASF160
+	.byte	0x1a
+	.byte	0x45
+	.byte	0x10
+	.long	0x951
+	.uleb128 0xa
+	.long	0x956
+	.uleb128 0x29
+	.long	0x961
+	.uleb128 0x3
+	.long	0x715
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF161
+	.byte	0x1b
+	.byte	0x17
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x46
+	.long	.LASF273
+	.byte	0x1
+	.byte	0x30
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x47
+	.string	"q"
+	.byte	0x1
+	.byte	0x35
+	.byte	0x11
+	.long	0x72b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	q
+	.uleb128 0x1a
+	.long	.LASF162
+	.byte	0x38
+	.byte	0xf
+	.long	0x1ed
+	.uleb128 0x9
+	.byte	0x3
+	.quad	qcnt
+	.uleb128 0x21
+	.byte	0x20
+	.byte	0x1
+	.byte	0x41
+	.long	0x9d0
+	.uleb128 0x5
+	.long	.LASF124
+	.byte	0x1
+	.byte	0x42
+	.byte	0xa
+	.long	0x9d0
+	.byte	0
+	.uleb128 0x30
+	.string	"q"
+	.byte	0x1
+	.byte	0x43
+	.byte	0xe
+	.long	0x72b
+	.byte	0x10
+	.uleb128 0x30
+	.string	"cnt"
+	.byte	0x1
+	.byte	0x44
+	.byte	0xc
+	.long	0x1ed
+	.byte	0x18
+	.byte	0
+	.uleb128 0xd
+	.long	0x52
+	.long	0x9e0
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF163
+	.byte	0x1
+	.byte	0x45
+	.byte	0x3
+	.long	0x9a2
+	.uleb128 0xd
+	.long	0x9e0
+	.long	0x9fc
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF164
+	.byte	0x47
+	.byte	0x15
+	.long	0x9ec
+	.uleb128 0x9
+	.byte	0x3
+	.quad	queues
+	.uleb128 0x1a
+	.long	.LASF165
+	.byte	0x48
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	queue_slots
+	.uleb128 0x1a
+	.long	.LASF166
+	.byte	0x49
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	current
+	.uleb128 0x1a
+	.long	.LASF167
+	.byte	0x4c
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_limit
+	.uleb128 0x1a
+	.long	.LASF168
+	.byte	0x4d
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_count
+	.uleb128 0x1a
+	.long	.LASF169
+	.byte	0x4f
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	string_length
+	.uleb128 0x1a
+	.long	.LASF170
+	.byte	0x52
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	seed
+	.uleb128 0x1a
+	.long	.LASF171
+	.byte	0x55
+	.byte	0xe
+	.long	0x48
+	.uleb128 0x9
+	.byte	0x3
+	.quad	leakfile_name
+	.uleb128 0x1a
+	.long	.LASF172
+	.byte	0x58
+	.byte	0xf
+	.long	0x1ed
+	.uleb128 0x9
+	.byte	0x3
+	.quad	metrics_alloc_start
+	.uleb128 0x2e
+	.long	0x82
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x6
+	.long	0xade
+	.uleb128 0x14
+	.long	.LASF173
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF174
+	.byte	0x1
+	.uleb128 0x14
+	.long	.LASF175
+	.byte	0x2
+	.uleb128 0x14
+	.long	.LASF176
+	.byte	0x3
+	.byte	0
+	.uleb128 0xd
+	.long	0x65
+	.long	0xaee
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF177
+	.byte	0x5c
+	.byte	0x14
+	.long	0xade
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lat_names
+	.uleb128 0xd
+	.long	0x8cc
+	.long	0xb13
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF178
+	.byte	0x5e
+	.byte	0x14
+	.long	0xb03
+	.uleb128 0x9
+	.byte	0x3
+	.quad	latency
+	.uleb128 0xd
+	.long	0x59
+	.long	0xb38
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x1c
+	.long	0xb28
+	.uleb128 0x1a
+	.long	.LASF179
+	.byte	0x69
+	.byte	0x13
+	.long	0xb38
+	.uleb128 0x9
+	.byte	0x3
+	.quad	charset
+	.uleb128 0x48
+	.byte	0x20
+	.byte	0x1
+	.value	0x484
+	.byte	0x9
+	.long	0xb92
+	.uleb128 0x31
+	.long	.LASF124
+	.value	0x485
+	.byte	0xb
+	.long	0x48
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF180
+	.value	0x486
+	.byte	0x9
+	.long	0x5e
+	.byte	0x8
+	.uleb128 0x49
+	.string	"run"
+	.byte	0x1
+	.value	0x487
+	.byte	0xc
+	.long	0xba2
+	.byte	0x10
+	.uleb128 0x31
+	.long	.LASF129
+	.value	0x488
+	.byte	0xc
+	.long	0xba2
+	.byte	0x18
+	.byte	0
+	.uleb128 0x29
+	.long	0xba2
+	.uleb128 0x3
+	.long	0x72b
+	.uleb128 0x3
+	.long	0x5e
+	.byte	0
+	.uleb128 0xa
+	.long	0xb92
+	.uleb128 0x4a
+	.long	.LASF181
+	.byte	0x1
+	.value	0x489
+	.byte	0x3
+	.long	0xb52
+	.uleb128 0x1c
+	.long	0xba7
+	.uleb128 0xd
+	.long	0x52
+	.long	0xbc9
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x9
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF182
+	.value	0x48b
+	.byte	0xd
+	.long	0xbb9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cplx_buf
+	.uleb128 0xe
+	.long	.LASF183
+	.value	0x48e
+	.byte	0x11
+	.long	0x72b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cplx_side
+	.uleb128 0xd
+	.long	0xbb4
+	.long	0xc05
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x1c
+	.long	0xbf5
+	.uleb128 0xe
+	.long	.LASF184
+	.value	0x4d4
+	.byte	0x18
+	.long	0xc05
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cplx_ops
+	.uleb128 0xc
+	.long	.LASF185
+	.byte	0x1c
+	.byte	0x8d
+	.byte	0xe
+	.long	0x48
+	.long	0xc3b
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x65
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF186
+	.byte	0x1c
+	.value	0x197
+	.byte	0xf
+	.long	0x1ed
+	.long	0xc52
+	.uleb128 0x3
+	.long	0x65
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF188
+	.byte	0x14
+	.byte	0x69
+	.long	0xc68
+	.uleb128 0x3
+	.long	0xc68
+	.uleb128 0x3
+	.long	0x5e
+	.byte	0
+	.uleb128 0xa
+	.long	0x72b
+	.uleb128 0xc
+	.long	.LASF187
+	.byte	0x1c
+	.byte	0x3d
+	.byte	0xe
+	.long	0x12e
+	.long	0xc8d
+	.uleb128 0x3
+	.long	0x12e
+	.uleb128 0x3
+	.long	0x5e
+	.uleb128 0x3
+	.long	0x1ed
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF189
+	.byte	0x3
+	.value	0x238
+	.long	0xc9f
+	.uleb128 0x3
+	.long	0x12e
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF190
+	.byte	0x3
+	.value	0x229
+	.byte	0xe
+	.long	0x12e
+	.long	0xcb6
+	.uleb128 0x3
+	.long	0x1ed
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF191
+	.byte	0x1d
+	.byte	0x74
+	.byte	0xc
+	.long	0x5e
+	.long	0xcd1
+	.uleb128 0x3
+	.long	0x65
+	.uleb128 0x3
+	.long	0x65
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF192
+	.byte	0x19
+	.byte	0x4d
+	.long	0xce2
+	.uleb128 0x3
+	.long	0x715
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF193
+	.byte	0x18
+	.byte	0x19
+	.long	0xcf8
+	.uleb128 0x3
+	.long	0xcf8
+	.uleb128 0x3
+	.long	0x5f4
+	.byte	0
+	.uleb128 0xa
+	.long	0x8cc
+	.uleb128 0xf
+	.long	.LASF194
+	.byte	0x1b
+	.byte	0x62
+	.long	0xd13
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF195
+	.byte	0x1b
+	.byte	0x63
+	.long	0xd29
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x715
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF208
+	.byte	0x16
+	.byte	0x1d
+	.byte	0x10
+	.long	0x7d2
+	.uleb128 0xc
+	.long	.LASF196
+	.byte	0x11
+	.byte	0xe6
+	.byte	0xc
+	.long	0x5e
+	.long	0xd4b
+	.uleb128 0x3
+	.long	0x4ed
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF197
+	.byte	0x16
+	.byte	0xf
+	.byte	0x6
+	.long	0x715
+	.long	0xd61
+	.uleb128 0x3
+	.long	0x5e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF198
+	.byte	0x1b
+	.byte	0x32
+	.long	0xd78
+	.uleb128 0x3
+	.long	0x5e
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF199
+	.byte	0x19
+	.byte	0x34
+	.byte	0x6
+	.long	0x715
+	.long	0xd93
+	.uleb128 0x3
+	.long	0xd93
+	.uleb128 0x3
+	.long	0x5e
+	.byte	0
+	.uleb128 0xa
+	.long	0x1ed
+	.uleb128 0xc
+	.long	.LASF200
+	.byte	0x18
+	.byte	0x1f
+	.byte	0xa
+	.long	0x5f4
+	.long	0xdb3
+	.uleb128 0x3
+	.long	0xcf8
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF201
+	.byte	0x18
+	.byte	0x16
+	.long	0xdc4
+	.uleb128 0x3
+	.long	0xcf8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF202
+	.byte	0x14
+	.byte	0x4e
+	.byte	0x5
+	.long	0x5e
+	.long	0xdda
+	.uleb128 0x3
+	.long	0x72b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF203
+	.byte	0x14
+	.byte	0x48
+	.byte	0x6
+	.long	0x715
+	.long	0xdfa
+	.uleb128 0x3
+	.long	0x72b
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x1ed
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF204
+	.byte	0x14
+	.byte	0x3e
+	.byte	0x6
+	.long	0x715
+	.long	0xe15
+	.uleb128 0x3
+	.long	0x72b
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF205
+	.byte	0x14
+	.byte	0x60
+	.long	0xe2b
+	.uleb128 0x3
+	.long	0x72b
+	.uleb128 0x3
+	.long	0x72b
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF206
+	.byte	0x14
+	.byte	0x57
+	.long	0xe3c
+	.uleb128 0x3
+	.long	0x72b
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF207
+	.byte	0x14
+	.byte	0x70
+	.long	0xe4d
+	.uleb128 0x3
+	.long	0x72b
+	.byte	0
+	.uleb128 0x4c
+	.long	.LASF209
+	.byte	0x3
+	.value	0x1c6
+	.byte	0xc
+	.long	0x5e
+	.uleb128 0xf
+	.long	.LASF210
+	.byte	0x17
+	.byte	0x1d
+	.long	0xe7a
+	.uleb128 0x3
+	.long	0xe7a
+	.uleb128 0x3
+	.long	0xe7a
+	.uleb128 0x3
+	.long	0x5e
+	.uleb128 0x3
+	.long	0xe7f
+	.byte	0
+	.uleb128 0xa
+	.long	0x7cd
+	.uleb128 0xa
+	.long	0x87e
+	.uleb128 0xc
+	.long	.LASF211
+	.byte	0x17
+	.byte	0x20
+	.byte	0x8
+	.long	0x35
+	.long	0xe9f
+	.uleb128 0x3
+	.long	0xe9f
+	.uleb128 0x3
+	.long	0x5e
+	.byte	0
+	.uleb128 0xa
+	.long	0x35
+	.uleb128 0x22
+	.long	.LASF212
+	.byte	0x1b
+	.byte	0x50
+	.byte	0xa
+	.long	0x5f4
+	.long	0xeb6
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF213
+	.byte	0x14
+	.byte	0x35
+	.byte	0x6
+	.long	0x715
+	.long	0xed1
+	.uleb128 0x3
+	.long	0x72b
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF214
+	.byte	0x14
+	.byte	0x26
+	.byte	0xa
+	.long	0x72b
+	.long	0xee3
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF215
+	.byte	0x1a
+	.byte	0x3c
+	.byte	0x6
+	.long	0x715
+	.long	0xefe
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x6f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF216
+	.byte	0x1c
+	.byte	0x9c
+	.byte	0xc
+	.long	0x5e
+	.long	0xf19
+	.uleb128 0x3
+	.long	0x65
+	.uleb128 0x3
+	.long	0x65
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF217
+	.byte	0x1a
+	.byte	0x36
+	.long	0xf39
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x6f
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x939
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF218
+	.byte	0x1a
+	.byte	0x33
+	.long	0xf54
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x914
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF219
+	.byte	0x3
+	.value	0x263
+	.byte	0xd
+	.uleb128 0x25
+	.long	.LASF221
+	.byte	0x1b
+	.byte	0x21
+	.long	0xf6a
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF220
+	.byte	0x19
+	.byte	0x62
+	.long	0xf7b
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF222
+	.byte	0x1b
+	.byte	0x28
+	.long	0xf88
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF223
+	.byte	0x7
+	.byte	0x58
+	.byte	0x17
+	.long	0x1d1
+	.long	0xfa3
+	.uleb128 0x3
+	.long	0x5e
+	.uleb128 0x3
+	.long	0x1d1
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF224
+	.byte	0x19
+	.byte	0x2e
+	.long	0xfb4
+	.uleb128 0x3
+	.long	0x82
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF225
+	.byte	0x3
+	.value	0x1c8
+	.long	0xfc6
+	.uleb128 0x3
+	.long	0x82
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF226
+	.byte	0x3
+	.value	0x27d
+	.byte	0xd
+	.long	0xfd9
+	.uleb128 0x3
+	.long	0x5e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF227
+	.byte	0x3
+	.byte	0xb1
+	.byte	0x11
+	.long	0xa3
+	.long	0xff9
+	.uleb128 0x3
+	.long	0x6a
+	.uleb128 0x3
+	.long	0x5ef
+	.uleb128 0x3
+	.long	0x5e
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF228
+	.byte	0x11
+	.value	0x324
+	.long	0x100b
+	.uleb128 0x3
+	.long	0x65
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF229
+	.byte	0x1e
+	.byte	0x6a
+	.byte	0x10
+	.long	0x116
+	.long	0x102b
+	.uleb128 0x3
+	.long	0x116
+	.uleb128 0x3
+	.long	0x6f
+	.uleb128 0x3
+	.long	0x5e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF230
+	.byte	0xd
+	.byte	0x48
+	.byte	0xc
+	.long	0x5e
+	.long	0x105a
+	.uleb128 0x3
+	.long	0x105f
+	.uleb128 0x3
+	.long	0x6a
+	.uleb128 0x3
+	.long	0x1069
+	.uleb128 0x3
+	.long	0x1073
+	.uleb128 0x3
+	.long	0x107d
+	.uleb128 0x3
+	.long	0x107d
+	.byte	0
+	.uleb128 0xa
+	.long	0x192
+	.uleb128 0x20
+	.long	0x105a
+	.uleb128 0xa
+	.long	0x306
+	.uleb128 0x20
+	.long	0x1064
+	.uleb128 0xa
+	.long	0x2ae
+	.uleb128 0x20
+	.long	0x106e
+	.uleb128 0xa
+	.long	0x4d
+	.uleb128 0x20
+	.long	0x1078
+	.uleb128 0xc
+	.long	.LASF91
+	.byte	0x1f
+	.byte	0xcd
+	.byte	0xc
+	.long	0x5e
+	.long	0x109d
+	.uleb128 0x3
+	.long	0x6a
+	.uleb128 0x3
+	.long	0x10a2
+	.byte	0
+	.uleb128 0xa
+	.long	0x50a
+	.uleb128 0x20
+	.long	0x109d
+	.uleb128 0x22
+	.long	.LASF231
+	.byte	0x19
+	.byte	0x1b
+	.byte	0x8
+	.long	0x1ed
+	.long	0x10b9
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF232
+	.byte	0x19
+	.byte	0x37
+	.byte	0x8
+	.long	0x1ed
+	.long	0x10cb
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF233
+	.byte	0x1b
+	.byte	0x61
+	.long	0x10e1
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x221
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF234
+	.byte	0x11
+	.byte	0xb2
+	.byte	0xc
+	.long	0x5e
+	.long	0x10f7
+	.uleb128 0x3
+	.long	0x4ed
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF235
+	.byte	0x19
+	.byte	0x22
+	.long	0x110d
+	.uleb128 0x3
+	.long	0x5e
+	.uleb128 0x3
+	.long	0x4ed
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF236
+	.byte	0x11
+	.value	0x102
+	.byte	0xe
+	.long	0x4ed
+	.long	0x1129
+	.uleb128 0x3
+	.long	0x6a
+	.uleb128 0x3
+	.long	0x6a
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF237
+	.byte	0x19
+	.byte	0x52
+	.byte	0x6
+	.long	0x715
+	.long	0x113b
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF238
+	.byte	0x19
+	.byte	0x18
+	.byte	0x8
+	.long	0x1ed
+	.long	0x114d
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF239
+	.byte	0x19
+	.byte	0x41
+	.long	0x115a
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF240
+	.byte	0x19
+	.byte	0x5d
+	.long	0x1167
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF241
+	.byte	0x14
+	.byte	0x2c
+	.long	0x1178
+	.uleb128 0x3
+	.long	0x72b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF242
+	.byte	0x19
+	.byte	0x58
+	.byte	0x6
+	.long	0x715
+	.long	0x118e
+	.uleb128 0x3
+	.long	0x715
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF243
+	.byte	0x19
+	.byte	0x47
+	.long	0x119f
+	.uleb128 0x3
+	.long	0x715
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF244
+	.byte	0x1a
+	.byte	0x4e
+	.byte	0x6
+	.long	0x715
+	.long	0x11b1
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF245
+	.byte	0x1a
+	.byte	0x5c
+	.byte	0x6
+	.long	0x715
+	.long	0x11c7
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF246
+	.byte	0x1a
+	.byte	0x65
+	.byte	0x6
+	.long	0x715
+	.long	0x11dd
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF247
+	.byte	0x1a
+	.byte	0x62
+	.byte	0x6
+	.long	0x715
+	.long	0x11f8
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF248
+	.byte	0x1a
+	.byte	0x3f
+	.long	0x1209
+	.uleb128 0x3
+	.long	0x914
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF249
+	.byte	0x1a
+	.byte	0x46
+	.long	0x121a
+	.uleb128 0x3
+	.long	0x945
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF250
+	.byte	0x1b
+	.byte	0x5a
+	.byte	0x6
+	.long	0x715
+	.long	0x1230
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF251
+	.byte	0x1b
+	.byte	0x15
+	.byte	0x6
+	.long	0x715
+	.long	0x1246
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF252
+	.byte	0x1b
+	.byte	0x2f
+	.long	0x125d
+	.uleb128 0x3
+	.long	0x5e
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF253
+	.byte	0x1a
+	.byte	0x49
+	.long	0x126e
+	.uleb128 0x3
+	.long	0x715
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF254
+	.byte	0x1b
+	.byte	0x18
+	.long	0x127f
+	.uleb128 0x3
+	.long	0x5e
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF255
+	.byte	0x1a
+	.byte	0x30
+	.long	0x128c
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF256
+	.byte	0x10
+	.byte	0x5b
+	.byte	0xc
+	.long	0x5e
+	.long	0x12ac
+	.uleb128 0x3
+	.long	0x5e
+	.uleb128 0x3
+	.long	0x1078
+	.uleb128 0x3
+	.long	0x65
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF257
+	.byte	0x11
+	.value	0x164
+	.byte	0xc
+	.long	0x5e
+	.long	0x12c4
+	.uleb128 0x3
+	.long	0x65
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF258
+	.byte	0x1c
+	.byte	0x90
+	.byte	0xe
+	.long	0x48
+	.long	0x12e4
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x65
+	.uleb128 0x3
+	.long	0x1ed
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF259
+	.byte	0x20
+	.byte	0x4c
+	.byte	0xf
+	.long	0x19e
+	.long	0x12fa
+	.uleb128 0x3
+	.long	0x12fa
+	.byte	0
+	.uleb128 0xa
+	.long	0x19e
+	.uleb128 0x4f
+	.long	.LASF365
+	.byte	0x1
+	.value	0x5c4
+	.byte	0x5
+	.long	0x5e
+	.quad	.LFB76
+	.quad	.LFE76-.LFB76
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f6c
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x5c4
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST230
+	.long	.LVUS230
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x5c4
+	.byte	0x1a
+	.long	0x5ea
+	.long	.LLST231
+	.long	.LVUS231
+	.uleb128 0x23
+	.string	"buf"
+	.value	0x5cb
+	.byte	0xa
+	.long	0x1f6c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0xb
+	.long	.LASF262
+	.value	0x5cc
+	.byte	0xb
+	.long	0x48
+	.long	.LLST232
+	.long	.LVUS232
+	.uleb128 0xe
+	.long	.LASF263
+	.value	0x5cd
+	.byte	0xa
+	.long	0x1f6c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -576
+	.uleb128 0xb
+	.long	.LASF264
+	.value	0x5ce
+	.byte	0xb
+	.long	0x48
+	.long	.LLST233
+	.long	.LVUS233
+	.uleb128 0xe
+	.long	.LASF265
+	.value	0x5cf
+	.byte	0xa
+	.long	0x1f6c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -832
+	.uleb128 0xe
+	.long	.LASF266
+	.value	0x5d0
+	.byte	0xa
+	.long	0x1f6c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1088
+	.uleb128 0xb
+	.long	.LASF267
+	.value	0x5d1
+	.byte	0xb
+	.long	0x48
+	.long	.LLST234
+	.long	.LVUS234
+	.uleb128 0xe
+	.long	.LASF268
+	.value	0x5d2
+	.byte	0xa
+	.long	0x1f6c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1344
+	.uleb128 0xb
+	.long	.LASF269
+	.value	0x5d3
+	.byte	0xb
+	.long	0x48
+	.long	.LLST235
+	.long	.LVUS235
+	.uleb128 0xe
+	.long	.LASF270
+	.value	0x5d4
+	.byte	0xa
+	.long	0x1f6c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1600
+	.uleb128 0xb
+	.long	.LASF271
+	.value	0x5d5
+	.byte	0xb
+	.long	0x48
+	.long	.LLST236
+	.long	.LVUS236
+	.uleb128 0xb
+	.long	.LASF272
+	.value	0x5d6
+	.byte	0x9
+	.long	0x5e
+	.long	.LLST237
+	.long	.LVUS237
+	.uleb128 0x6
+	.string	"c"
+	.value	0x5d7
+	.byte	0x9
+	.long	0x5e
+	.long	.LLST238
+	.long	.LVUS238
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x61f
+	.byte	0xa
+	.long	0x715
+	.long	.LLST239
+	.long	.LVUS239
+	.uleb128 0x24
+	.long	0x1f7c
+	.quad	.LBI184
+	.byte	.LVU1996
+	.long	.LLRL240
+	.value	0x5c7
+	.byte	0xa
+	.long	0x15f6
+	.uleb128 0x15
+	.long	.LLRL240
+	.uleb128 0x2c
+	.long	0x1f8b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1744
+	.uleb128 0x50
+	.long	0x1f97
+	.long	.LLRL241
+	.long	0x1536
+	.uleb128 0x2c
+	.long	0x1f98
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1776
+	.uleb128 0x2c
+	.long	0x1fb1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1784
+	.uleb128 0x2c
+	.long	0x1fbd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1780
+	.uleb128 0x51
+	.long	0x1fa4
+	.uleb128 0x2
+	.quad	.LVL968
+	.long	0x6394
+	.long	0x14c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC133
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2d
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL969
+	.long	0x102b
+	.long	0x14fc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1784
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC137
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1776
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL975
+	.long	0x100b
+	.long	0x151a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1780
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL976
+	.long	0xff9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC138
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL965
+	.long	0x1082
+	.long	0x155c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC128
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1744
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL966
+	.long	0x1082
+	.long	0x1582
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC130
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1744
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL967
+	.long	0x1082
+	.long	0x15a8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC131
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1744
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL970
+	.long	0x6394
+	.long	0x15d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC129
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4d
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL971
+	.long	0x1082
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC132
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1744
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6374
+	.quad	.LBI194
+	.byte	.LVU2072
+	.quad	.LBB194
+	.quad	.LBE194-.LBB194
+	.value	0x5e5
+	.byte	0x15
+	.long	0x1639
+	.uleb128 0x35
+	.long	0x6386
+	.uleb128 0x8
+	.quad	.LVL988
+	.long	0xfd9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6374
+	.quad	.LBI196
+	.byte	.LVU2087
+	.quad	.LBB196
+	.quad	.LBE196-.LBB196
+	.value	0x5ed
+	.byte	0x14
+	.long	0x167c
+	.uleb128 0x35
+	.long	0x6386
+	.uleb128 0x8
+	.quad	.LVL995
+	.long	0xfd9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x22cc
+	.quad	.LBI198
+	.byte	.LVU2129
+	.quad	.LBB198
+	.quad	.LBE198-.LBB198
+	.value	0x60b
+	.byte	0x5
+	.long	0x16e6
+	.uleb128 0x2
+	.quad	.LVL1016
+	.long	0xf88
+	.long	0x16c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	sigsegvhandler
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL1017
+	.long	0xf88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	sigalrmhandler
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6324
+	.quad	.LBI200
+	.byte	.LVU2145
+	.quad	.LBB200
+	.quad	.LBE200-.LBB200
+	.value	0x60d
+	.byte	0x5
+	.long	0x1cc9
+	.uleb128 0x2
+	.quad	.LVL1019
+	.long	0xf39
+	.long	0x1744
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC142
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_new
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC141
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1020
+	.long	0xf39
+	.long	0x177d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC144
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_free
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC143
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1021
+	.long	0xf39
+	.long	0x17b6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC146
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_use
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC145
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1022
+	.long	0xf39
+	.long	0x17ef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC148
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_queues
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC147
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1023
+	.long	0xf39
+	.long	0x1828
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC150
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_splice
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC149
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1024
+	.long	0xf39
+	.long	0x1861
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC152
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_merge
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC151
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1025
+	.long	0xf39
+	.long	0x189a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC154
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_mergebench
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC153
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1026
+	.long	0xf39
+	.long	0x18d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC156
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_insert_head
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC155
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1027
+	.long	0xf39
+	.long	0x190c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC158
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_insert_tail
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC157
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1028
+	.long	0xf39
+	.long	0x1945
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC160
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_remove_head
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC159
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1029
+	.long	0xf39
+	.long	0x197e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC162
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_remove_head_quiet
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC161
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1030
+	.long	0xf39
+	.long	0x19b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC164
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_reverse
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC163
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1031
+	.long	0xf39
+	.long	0x19f0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC166
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_sort
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC165
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1032
+	.long	0xf39
+	.long	0x1a29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC168
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_size
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC167
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1033
+	.long	0xf39
+	.long	0x1a62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC170
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_show
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC169
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1034
+	.long	0xf39
+	.long	0x1a9b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC172
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_failat
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC171
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1035
+	.long	0xf39
+	.long	0x1ad4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC174
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_latency
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC173
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1036
+	.long	0xf39
+	.long	0x1b0d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC176
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_complexity
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC175
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1037
+	.long	0xf39
+	.long	0x1b46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC178
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	do_leaks
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC177
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1038
+	.long	0xf19
+	.long	0x1b84
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC180
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	string_length
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC179
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1039
+	.long	0xf19
+	.long	0x1bb5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC182
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC181
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1040
+	.long	0xf19
+	.long	0x1be6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC184
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC183
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1041
+	.long	0xf19
+	.long	0x1c2c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC186
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	seed
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC185
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	set_seed
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1042
+	.long	0xf19
+	.long	0x1c6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC188
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_limit
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC187
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1043
+	.long	0xf19
+	.long	0x1c9b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC190
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC189
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL1044
+	.long	0xf19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC192
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC191
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL973
+	.long	0x12e4
+	.long	0x1ce0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL978
+	.long	0x1fdb
+	.uleb128 0x2
+	.quad	.LVL980
+	.long	0x12c4
+	.long	0x1d0d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1848
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL983
+	.long	0x128c
+	.long	0x1d31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL992
+	.long	0x12c4
+	.long	0x1d51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1848
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL998
+	.long	0x12c4
+	.long	0x1d71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1848
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1002
+	.long	0x12c4
+	.long	0x1d91
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1848
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1006
+	.long	0x12c4
+	.long	0x1db1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1856
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1010
+	.long	0x12c4
+	.long	0x1dd0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1013
+	.long	0x12ac
+	.long	0x1def
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC139
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL1014
+	.long	0x1fdb
+	.uleb128 0x2
+	.quad	.LVL1015
+	.long	0x24a5
+	.long	0x1e13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL1018
+	.long	0x127f
+	.uleb128 0x2
+	.quad	.LVL1045
+	.long	0x126e
+	.long	0x1e38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1046
+	.long	0x1246
+	.long	0x1e5c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC193
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1047
+	.long	0x1230
+	.long	0x1e76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1832
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1048
+	.long	0x121a
+	.long	0x1e90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1840
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1049
+	.long	0x1209
+	.long	0x1eaf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	queue_metrics
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1050
+	.long	0x11f8
+	.long	0x1ece
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	queue_quit
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1051
+	.long	0x11dd
+	.long	0x1ef0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1808
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1816
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL1053
+	.long	0x119f
+	.uleb128 0x2
+	.quad	.LVL1059
+	.long	0x125d
+	.long	0x1f14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1060
+	.long	0x12ac
+	.long	0x1f3b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC194
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1840
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL1062
+	.long	0x11c7
+	.long	0x1f55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1800
+	.byte	0x6
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL1063
+	.long	0x11b1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1808
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x52
+	.long	0x1f7c
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0xff
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF328
+	.value	0x5a4
+	.long	0x715
+	.long	0x1fcb
+	.uleb128 0x26
+	.string	"buf"
+	.value	0x5a6
+	.byte	0x11
+	.long	0x50a
+	.uleb128 0x37
+	.uleb128 0x38
+	.long	.LASF261
+	.value	0x5b4
+	.byte	0xf
+	.long	0x1fcb
+	.uleb128 0x52
+	.long	.LASF274
+	.byte	0x1
+	.value	0x5b5
+	.byte	0x17
+	.long	0x5ea
+	.uleb128 0x26
+	.string	"pid"
+	.value	0x5b6
+	.byte	0xf
+	.long	0x192
+	.uleb128 0x38
+	.long	.LASF275
+	.value	0x5b7
+	.byte	0xd
+	.long	0x5e
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x48
+	.long	0x1fdb
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF277
+	.value	0x593
+	.quad	.LFB74
+	.quad	.LFE74-.LFB74
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x215d
+	.uleb128 0x12
+	.string	"cmd"
+	.value	0x593
+	.byte	0x19
+	.long	0x48
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x2
+	.quad	.LVL65
+	.long	0x12ac
+	.long	0x2032
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL66
+	.long	0x639d
+	.long	0x2051
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL67
+	.long	0x639d
+	.long	0x2070
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL68
+	.long	0x639d
+	.long	0x208f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL69
+	.long	0x639d
+	.long	0x20ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL70
+	.long	0x639d
+	.long	0x20cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL71
+	.long	0x639d
+	.long	0x20ec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL72
+	.long	0x639d
+	.long	0x210b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL73
+	.long	0x639d
+	.long	0x212a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL74
+	.long	0x639d
+	.long	0x2149
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL75
+	.long	0xfc6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF284
+	.value	0x57a
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB73
+	.quad	.LFE73-.LFB73
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x22cc
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x57a
+	.byte	0x1c
+	.long	0x5e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x57a
+	.byte	0x28
+	.long	0x5ea
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xb
+	.long	.LASF276
+	.value	0x588
+	.byte	0xc
+	.long	0x1ed
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1e
+	.quad	.LBB32
+	.quad	.LBE32-.LBB32
+	.long	0x2242
+	.uleb128 0x6
+	.string	"i"
+	.value	0x57e
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2
+	.quad	.LVL28
+	.long	0x118e
+	.long	0x21f9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL29
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL30
+	.long	0x118e
+	.long	0x221d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL33
+	.long	0x1178
+	.long	0x2234
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL34
+	.long	0x1167
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL25
+	.long	0x1246
+	.long	0x2266
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL26
+	.long	0x630a
+	.uleb128 0x4
+	.quad	.LVL36
+	.long	0x114d
+	.uleb128 0x4
+	.quad	.LVL37
+	.long	0x113b
+	.uleb128 0x4
+	.quad	.LVL39
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL42
+	.long	0x1246
+	.long	0x22be
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL43
+	.long	0x5e99
+	.byte	0
+	.uleb128 0x53
+	.long	.LASF353
+	.byte	0x1
+	.value	0x56e
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x16
+	.long	.LASF278
+	.value	0x561
+	.quad	.LFB71
+	.quad	.LFE71-.LFB71
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x23ce
+	.uleb128 0x7
+	.long	.LASF279
+	.value	0x561
+	.byte	0x20
+	.long	0x715
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2
+	.quad	.LVL55
+	.long	0x10cb
+	.long	0x233c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1f
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL56
+	.long	0x113b
+	.uleb128 0x2
+	.quad	.LVL57
+	.long	0x10cb
+	.long	0x2368
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL58
+	.long	0x10a7
+	.uleb128 0x2
+	.quad	.LVL59
+	.long	0x10cb
+	.long	0x2394
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL60
+	.long	0x10b9
+	.uleb128 0x2
+	.quad	.LVL61
+	.long	0x10cb
+	.long	0x23c0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL62
+	.long	0x10b9
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF280
+	.value	0x558
+	.quad	.LFB70
+	.quad	.LFE70-.LFB70
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2428
+	.uleb128 0x12
+	.string	"sig"
+	.value	0x558
+	.byte	0x20
+	.long	0x5e
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x4
+	.quad	.LVL81
+	.long	0xf7b
+	.uleb128 0x8
+	.quad	.LVL82
+	.long	0xf6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF281
+	.value	0x54d
+	.quad	.LFB69
+	.quad	.LFE69-.LFB69
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x24a5
+	.uleb128 0x12
+	.string	"sig"
+	.value	0x54d
+	.byte	0x20
+	.long	0x5e
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x4
+	.quad	.LVL84
+	.long	0xf7b
+	.uleb128 0x2
+	.quad	.LVL85
+	.long	0x1246
+	.long	0x248a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL86
+	.long	0xf5d
+	.uleb128 0x4
+	.quad	.LVL87
+	.long	0xf54
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF282
+	.value	0x546
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x24f1
+	.uleb128 0x7
+	.long	.LASF283
+	.value	0x546
+	.byte	0x1a
+	.long	0x5e
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x4
+	.quad	.LVL78
+	.long	0xfb4
+	.uleb128 0x4
+	.quad	.LVL79
+	.long	0xfa3
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF285
+	.value	0x4e3
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ac0
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x4e3
+	.byte	0x1f
+	.long	0x5e
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x4e3
+	.byte	0x2b
+	.long	0x5ea
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0xe
+	.long	.LASF286
+	.value	0x4e5
+	.byte	0x9
+	.long	0x5e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xe
+	.long	.LASF287
+	.value	0x4e5
+	.byte	0x17
+	.long	0x5e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x6
+	.string	"op"
+	.value	0x4ea
+	.byte	0x16
+	.long	0x2ac0
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xe
+	.long	.LASF288
+	.value	0x501
+	.byte	0xc
+	.long	0x2ac5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0xe
+	.long	.LASF289
+	.value	0x502
+	.byte	0xc
+	.long	0x2ac5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0xe
+	.long	.LASF290
+	.value	0x503
+	.byte	0xc
+	.long	0x2ad5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1136
+	.uleb128 0xb
+	.long	.LASF150
+	.value	0x504
+	.byte	0x9
+	.long	0x5e
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x505
+	.byte	0xa
+	.long	0x715
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x23
+	.string	"fit"
+	.value	0x53c
+	.byte	0x10
+	.long	0x87e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1216
+	.uleb128 0x13
+	.long	.LLRL37
+	.long	0x25fd
+	.uleb128 0x26
+	.string	"i"
+	.value	0x4eb
+	.byte	0x11
+	.long	0x1ed
+	.uleb128 0x8
+	.quad	.LVL125
+	.long	0xefe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LLRL38
+	.long	0x2899
+	.uleb128 0x6
+	.string	"k"
+	.value	0x50b
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x15
+	.long	.LLRL40
+	.uleb128 0x6
+	.string	"n"
+	.value	0x50c
+	.byte	0x10
+	.long	0x1ed
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0xe
+	.long	.LASF291
+	.value	0x50d
+	.byte	0xe
+	.long	0xbb9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1226
+	.uleb128 0x6
+	.string	"cq"
+	.value	0x50e
+	.byte	0x12
+	.long	0x72b
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x13
+	.long	.LLRL43
+	.long	0x26cf
+	.uleb128 0x6
+	.string	"i"
+	.value	0x512
+	.byte	0x19
+	.long	0x1ed
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x2
+	.quad	.LVL146
+	.long	0x1246
+	.long	0x2697
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL165
+	.long	0x5865
+	.long	0x26b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL166
+	.long	0xeb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LLRL45
+	.long	0x2747
+	.uleb128 0x6
+	.string	"i"
+	.value	0x51b
+	.byte	0x16
+	.long	0x5e
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x15
+	.long	.LLRL47
+	.uleb128 0xb
+	.long	.LASF292
+	.value	0x51c
+	.byte	0x1a
+	.long	0x5f4
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x39
+	.quad	.LVL170
+	.long	0x2717
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL172
+	.long	0xea4
+	.uleb128 0x39
+	.quad	.LVL174
+	.long	0x2738
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL175
+	.long	0xea4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL147
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL148
+	.long	0x1178
+	.long	0x276b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL150
+	.long	0x1167
+	.long	0x2783
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL151
+	.long	0x1167
+	.uleb128 0x4
+	.quad	.LVL152
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL154
+	.long	0xe84
+	.long	0x27b6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1136
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL155
+	.long	0x1246
+	.long	0x27e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL159
+	.long	0x1178
+	.long	0x27f7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL160
+	.long	0xed1
+	.uleb128 0x4
+	.quad	.LVL161
+	.long	0xed1
+	.uleb128 0x4
+	.quad	.LVL177
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL178
+	.long	0x1178
+	.long	0x2835
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL190
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL192
+	.long	0x1246
+	.long	0x2866
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC33
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL195
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL196
+	.long	0x1178
+	.long	0x288a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL198
+	.long	0x115a
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LBB56
+	.quad	.LBE56-.LBB56
+	.long	0x28da
+	.uleb128 0x6
+	.string	"m"
+	.value	0x53e
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x8
+	.quad	.LVL185
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL127
+	.long	0xee3
+	.long	0x28f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL128
+	.long	0x1246
+	.long	0x2921
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL134
+	.long	0x1246
+	.long	0x2945
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL136
+	.long	0x1246
+	.long	0x296f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL137
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL138
+	.long	0x5865
+	.long	0x29a0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cplx_buf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL139
+	.long	0x118e
+	.long	0x29b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL140
+	.long	0x1246
+	.long	0x29f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC29
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL143
+	.long	0xee3
+	.long	0x2a0e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL144
+	.long	0x1246
+	.long	0x2a38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x65
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL181
+	.long	0x118e
+	.long	0x2a4f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL182
+	.long	0xe5a
+	.long	0x2a7b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL187
+	.long	0x1246
+	.long	0x2a9f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL188
+	.long	0x1129
+	.uleb128 0x8
+	.quad	.LVL193
+	.long	0x118e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xbb4
+	.uleb128 0xd
+	.long	0x35
+	.long	0x2ad5
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0xe
+	.byte	0
+	.uleb128 0xd
+	.long	0x35
+	.long	0x2ae5
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x64
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF293
+	.value	0x4cc
+	.quad	.LFB66
+	.quad	.LFE66-.LFB66
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2b72
+	.uleb128 0x12
+	.string	"q"
+	.value	0x4cc
+	.byte	0x25
+	.long	0x72b
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x7
+	.long	.LASF180
+	.value	0x4cc
+	.byte	0x2c
+	.long	0x5e
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x27
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.uleb128 0x6
+	.string	"e"
+	.value	0x4ce
+	.byte	0x16
+	.long	0x670
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x15
+	.long	.LLRL26
+	.uleb128 0x6
+	.string	"c"
+	.value	0x4cf
+	.byte	0x14
+	.long	0x48
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x4
+	.quad	.LVL107
+	.long	0xe4d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF294
+	.value	0x4c2
+	.quad	.LFB65
+	.quad	.LFE65-.LFB65
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2bcb
+	.uleb128 0x12
+	.string	"q"
+	.value	0x4c2
+	.byte	0x20
+	.long	0x72b
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x7
+	.long	.LASF180
+	.value	0x4c2
+	.byte	0x27
+	.long	0x5e
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x8
+	.quad	.LVL200
+	.long	0xe3c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF295
+	.value	0x4bd
+	.quad	.LFB64
+	.quad	.LFE64-.LFB64
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2c24
+	.uleb128 0x12
+	.string	"q"
+	.value	0x4bd
+	.byte	0x23
+	.long	0x72b
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x7
+	.long	.LASF180
+	.value	0x4bd
+	.byte	0x2a
+	.long	0x5e
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x8
+	.quad	.LVL202
+	.long	0xe2b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF296
+	.value	0x4b8
+	.quad	.LFB63
+	.quad	.LFE63-.LFB63
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2c7d
+	.uleb128 0x12
+	.string	"q"
+	.value	0x4b8
+	.byte	0x29
+	.long	0x72b
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x7
+	.long	.LASF180
+	.value	0x4b8
+	.byte	0x30
+	.long	0x5e
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x8
+	.quad	.LVL205
+	.long	0xe15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF297
+	.value	0x4b2
+	.quad	.LFB62
+	.quad	.LFE62-.LFB62
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2cf8
+	.uleb128 0x12
+	.string	"q"
+	.value	0x4b2
+	.byte	0x24
+	.long	0x72b
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x7
+	.long	.LASF180
+	.value	0x4b2
+	.byte	0x2b
+	.long	0x5e
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x2
+	.quad	.LVL225
+	.long	0xdfa
+	.long	0x2cd8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL226
+	.long	0xdda
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF298
+	.value	0x4a9
+	.quad	.LFB61
+	.quad	.LFE61-.LFB61
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d80
+	.uleb128 0x12
+	.string	"q"
+	.value	0x4a9
+	.byte	0x22
+	.long	0x72b
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x7
+	.long	.LASF180
+	.value	0x4a9
+	.byte	0x29
+	.long	0x5e
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x15
+	.long	.LLRL58
+	.uleb128 0x6
+	.string	"i"
+	.value	0x4ab
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x2
+	.quad	.LVL208
+	.long	0xe15
+	.long	0x2d6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL209
+	.long	0xe15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF299
+	.value	0x4a2
+	.quad	.LFB60
+	.quad	.LFE60-.LFB60
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2dfb
+	.uleb128 0x12
+	.string	"q"
+	.value	0x4a2
+	.byte	0x27
+	.long	0x72b
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x7
+	.long	.LASF180
+	.value	0x4a2
+	.byte	0x2e
+	.long	0x5e
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x15
+	.long	.LLRL68
+	.uleb128 0x6
+	.string	"i"
+	.value	0x4a4
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x8
+	.quad	.LVL230
+	.long	0xdda
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF300
+	.value	0x49c
+	.quad	.LFB59
+	.quad	.LFE59-.LFB59
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e71
+	.uleb128 0x12
+	.string	"q"
+	.value	0x49c
+	.byte	0x27
+	.long	0x72b
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x7
+	.long	.LASF180
+	.value	0x49c
+	.byte	0x2e
+	.long	0x5e
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x15
+	.long	.LLRL62
+	.uleb128 0x6
+	.string	"i"
+	.value	0x49e
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x8
+	.quad	.LVL217
+	.long	0xdfa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF301
+	.value	0x496
+	.quad	.LFB58
+	.quad	.LFE58-.LFB58
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ee7
+	.uleb128 0x12
+	.string	"q"
+	.value	0x496
+	.byte	0x27
+	.long	0x72b
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x7
+	.long	.LASF180
+	.value	0x496
+	.byte	0x2e
+	.long	0x5e
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x15
+	.long	.LLRL21
+	.uleb128 0x6
+	.string	"i"
+	.value	0x498
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x8
+	.quad	.LVL97
+	.long	0xeb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF302
+	.value	0x490
+	.quad	.LFB57
+	.quad	.LFE57-.LFB57
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2f57
+	.uleb128 0x12
+	.string	"q"
+	.value	0x490
+	.byte	0x20
+	.long	0x72b
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x7
+	.long	.LASF180
+	.value	0x490
+	.byte	0x27
+	.long	0x5e
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x15
+	.long	.LLRL76
+	.uleb128 0x6
+	.string	"i"
+	.value	0x492
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x8
+	.quad	.LVL248
+	.long	0xdc4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF303
+	.value	0x466
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB56
+	.quad	.LFE56-.LFB56
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x31b2
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x466
+	.byte	0x1c
+	.long	0x5e
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x466
+	.byte	0x28
+	.long	0x5ea
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x13
+	.long	.LLRL83
+	.long	0x3016
+	.uleb128 0x6
+	.string	"i"
+	.value	0x469
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x2
+	.quad	.LVL265
+	.long	0xdb3
+	.long	0x2fdb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	latency
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL266
+	.long	0xdb3
+	.long	0x2ffa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	latency+15376
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL267
+	.long	0xdb3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	latency+30752
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LLRL80
+	.long	0x311a
+	.uleb128 0x6
+	.string	"i"
+	.value	0x474
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x27
+	.quad	.LBB69
+	.quad	.LBE69-.LBB69
+	.uleb128 0x6
+	.string	"h"
+	.value	0x475
+	.byte	0x16
+	.long	0xcf8
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x2
+	.quad	.LVL271
+	.long	0xd98
+	.long	0x307b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0xd916872b
+	.long	0x3feff7ce
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL272
+	.long	0xd98
+	.long	0x30a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0x7ae147ae
+	.long	0x3fefae14
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL273
+	.long	0xd98
+	.long	0x30c9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0xcccccccd
+	.long	0x3feccccc
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL274
+	.long	0xd98
+	.long	0x30f0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0
+	.long	0x3fe00000
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL275
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL257
+	.long	0x1246
+	.long	0x3172
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC40
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL261
+	.long	0xefe
+	.long	0x3191
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC38
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL262
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC39
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF304
+	.value	0x45b
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB55
+	.quad	.LFE55-.LFB55
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x322a
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x45b
+	.byte	0x1a
+	.long	0x5e
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x45b
+	.byte	0x26
+	.long	0x5ea
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x4
+	.quad	.LVL46
+	.long	0x5e99
+	.uleb128 0x8
+	.quad	.LVL51
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF305
+	.value	0x448
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB54
+	.quad	.LFE54-.LFB54
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x333e
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x448
+	.byte	0x1b
+	.long	0x5e
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x448
+	.byte	0x27
+	.long	0x5ea
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0xb
+	.long	.LASF306
+	.value	0x44a
+	.byte	0xc
+	.long	0x333e
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x13
+	.long	.LLRL90
+	.long	0x32f0
+	.uleb128 0x6
+	.string	"i"
+	.value	0x44b
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x15
+	.long	.LLRL92
+	.uleb128 0x23
+	.string	"n"
+	.value	0x44c
+	.byte	0xd
+	.long	0x5e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x2
+	.quad	.LVL283
+	.long	0xee3
+	.long	0x32ce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL290
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.long	0x2e
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x2
+	.quad	.LVL287
+	.long	0xd78
+	.long	0x331d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL288
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x1ed
+	.long	0x3351
+	.uleb128 0x55
+	.long	0x2e
+	.long	0x32f0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF307
+	.value	0x43f
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x33d3
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x43f
+	.byte	0x19
+	.long	0x5e
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x43f
+	.byte	0x25
+	.long	0x5ea
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x2
+	.quad	.LVL330
+	.long	0x1246
+	.long	0x33bf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL333
+	.long	0x33d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF308
+	.value	0x40f
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB52
+	.quad	.LFE52-.LFB52
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x35d4
+	.uleb128 0x7
+	.long	.LASF309
+	.value	0x40f
+	.byte	0x1c
+	.long	0x5e
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x411
+	.byte	0xa
+	.long	0x715
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x6
+	.string	"cnt"
+	.value	0x415
+	.byte	0x9
+	.long	0x5e
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0xb
+	.long	.LASF124
+	.value	0x416
+	.byte	0xb
+	.long	0x48
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x6
+	.string	"e"
+	.value	0x41d
+	.byte	0x11
+	.long	0x670
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x2
+	.quad	.LVL299
+	.long	0xd61
+	.long	0x347b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC58
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL301
+	.long	0x1178
+	.long	0x3492
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL303
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL304
+	.long	0x1246
+	.long	0x34c4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL306
+	.long	0x1246
+	.long	0x34e3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC57
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL309
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL313
+	.long	0xd61
+	.long	0x351c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x10
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL316
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL317
+	.long	0x1246
+	.long	0x354e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL319
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL321
+	.long	0x1246
+	.long	0x3580
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL322
+	.long	0x1246
+	.long	0x35a5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL325
+	.long	0x115a
+	.uleb128 0x8
+	.quad	.LVL326
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF310
+	.value	0x3e8
+	.byte	0x6
+	.long	0x715
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x37cf
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x3e8
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x3e8
+	.byte	0x1e
+	.long	0x5ea
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x6
+	.string	"cnt"
+	.value	0x3f3
+	.byte	0x9
+	.long	0x5e
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x3fe
+	.byte	0xa
+	.long	0x715
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x13
+	.long	.LLRL172
+	.long	0x368e
+	.uleb128 0x6
+	.string	"e"
+	.value	0x400
+	.byte	0x1a
+	.long	0x670
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x4
+	.quad	.LVL613
+	.long	0xcb6
+	.uleb128 0x8
+	.quad	.LVL627
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC101
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL601
+	.long	0x1129
+	.uleb128 0x4
+	.quad	.LVL602
+	.long	0xdc4
+	.uleb128 0x4
+	.quad	.LVL605
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL606
+	.long	0xcd1
+	.long	0x36cc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL607
+	.long	0x1178
+	.long	0x36e3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL608
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL609
+	.long	0xcd1
+	.long	0x3707
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL617
+	.long	0x1246
+	.long	0x372b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL621
+	.long	0x1246
+	.long	0x374f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC99
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL624
+	.long	0x1246
+	.long	0x3773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC100
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL625
+	.long	0xe3c
+	.uleb128 0x2
+	.quad	.LVL628
+	.long	0x33d3
+	.long	0x3797
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL630
+	.long	0x33d3
+	.long	0x37ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL631
+	.long	0x1129
+	.uleb128 0x8
+	.quad	.LVL635
+	.long	0x33d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF311
+	.value	0x3b2
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3add
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x3b2
+	.byte	0x19
+	.long	0x5e
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x3b2
+	.byte	0x25
+	.long	0x5ea
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0xe
+	.long	.LASF180
+	.value	0x3bc
+	.byte	0x9
+	.long	0x5e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x3bd
+	.byte	0xa
+	.long	0x715
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x6
+	.string	"cnt"
+	.value	0x3c9
+	.byte	0x9
+	.long	0x5e
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x13
+	.long	.LLRL116
+	.long	0x3967
+	.uleb128 0x6
+	.string	"r"
+	.value	0x3cf
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x15
+	.long	.LLRL118
+	.uleb128 0xb
+	.long	.LASF312
+	.value	0x3d0
+	.byte	0x15
+	.long	0x221
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x24
+	.long	0x632d
+	.quad	.LBI87
+	.byte	.LVU865
+	.long	.LLRL120
+	.value	0x3d2
+	.byte	0xd
+	.long	0x38cb
+	.uleb128 0x1f
+	.long	0x6343
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x1f
+	.long	0x6339
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x8
+	.quad	.LVL417
+	.long	0xce2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6350
+	.quad	.LBI91
+	.byte	.LVU845
+	.quad	.LBB91
+	.quad	.LBE91-.LBB91
+	.value	0x3d0
+	.byte	0x1e
+	.long	0x390b
+	.uleb128 0x18
+	.long	0x6361
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x18
+	.long	0x636a
+	.long	.LLST124
+	.long	.LVUS124
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6350
+	.quad	.LBI93
+	.byte	.LVU857
+	.quad	.LBB93
+	.quad	.LBE93-.LBB93
+	.value	0x3d2
+	.byte	0x26
+	.long	0x394b
+	.uleb128 0x18
+	.long	0x6361
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x18
+	.long	0x636a
+	.long	.LLST126
+	.long	.LVUS126
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL418
+	.long	0x1129
+	.uleb128 0x4
+	.quad	.LVL424
+	.long	0xdc4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL394
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL395
+	.long	0x1178
+	.long	0x398b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL396
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL398
+	.long	0x1246
+	.long	0x39c2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL399
+	.long	0x33d3
+	.long	0x39d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL403
+	.long	0x4a5c
+	.long	0x39f0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL408
+	.long	0x1246
+	.long	0x3a14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC77
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL412
+	.long	0xee3
+	.long	0x3a2c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL413
+	.long	0x1246
+	.long	0x3a50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC78
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL415
+	.long	0x1246
+	.long	0x3a74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC79
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL431
+	.long	0x1246
+	.long	0x3a9e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL432
+	.long	0x33d3
+	.long	0x3ab5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL433
+	.long	0x1129
+	.uleb128 0x4
+	.quad	.LVL435
+	.long	0x115a
+	.uleb128 0x4
+	.quad	.LVL437
+	.long	0x115a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF313
+	.value	0x39a
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3c17
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x39a
+	.byte	0x1c
+	.long	0x5e
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x39a
+	.byte	0x28
+	.long	0x5ea
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x4
+	.quad	.LVL546
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL547
+	.long	0xcd1
+	.long	0x3b4b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL548
+	.long	0x1178
+	.long	0x3b62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL549
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL550
+	.long	0xcd1
+	.long	0x3b86
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL551
+	.long	0x33d3
+	.long	0x3b9d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL552
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL554
+	.long	0x4a5c
+	.long	0x3bc1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x36
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL558
+	.long	0x1246
+	.long	0x3be5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL562
+	.long	0x1246
+	.long	0x3c09
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC92
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL563
+	.long	0xe2b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF314
+	.value	0x373
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3e09
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x373
+	.byte	0x26
+	.long	0x5e
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x373
+	.byte	0x32
+	.long	0x5ea
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x37d
+	.byte	0xa
+	.long	0x715
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0xb
+	.long	.LASF315
+	.value	0x384
+	.byte	0xa
+	.long	0x715
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x4
+	.quad	.LVL361
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL362
+	.long	0x1178
+	.long	0x3cac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL363
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL364
+	.long	0x1246
+	.long	0x3cdd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL365
+	.long	0x33d3
+	.long	0x3cf4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL366
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL368
+	.long	0x4a5c
+	.long	0x3d18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL372
+	.long	0x1246
+	.long	0x3d3c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL376
+	.long	0x1246
+	.long	0x3d60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL380
+	.long	0x1246
+	.long	0x3d84
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC73
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL382
+	.long	0xdda
+	.long	0x3da0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL385
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL386
+	.long	0x1246
+	.long	0x3dd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL388
+	.long	0x1246
+	.long	0x3df5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC76
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL389
+	.long	0x33d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF316
+	.value	0x315
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x42fc
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x315
+	.byte	0x20
+	.long	0x5e
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x315
+	.byte	0x2c
+	.long	0x5ea
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0xb
+	.long	.LASF317
+	.value	0x31f
+	.byte	0xb
+	.long	0x48
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0xb
+	.long	.LASF318
+	.value	0x326
+	.byte	0xb
+	.long	0x48
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0xb
+	.long	.LASF319
+	.value	0x32e
+	.byte	0xa
+	.long	0x715
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x32f
+	.byte	0xa
+	.long	0x715
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0xb
+	.long	.LASF315
+	.value	0x33f
+	.byte	0xa
+	.long	0x715
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x13
+	.long	.LLRL185
+	.long	0x3f40
+	.uleb128 0x6
+	.string	"i"
+	.value	0x34f
+	.byte	0xd
+	.long	0x5e
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0x2
+	.quad	.LVL692
+	.long	0x1246
+	.long	0x3ef5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC104
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL698
+	.long	0x1246
+	.long	0x3f19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC103
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL702
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC105
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL650
+	.long	0xc9f
+	.long	0x3f5f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 1025
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL652
+	.long	0xc9f
+	.long	0x3f77
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL656
+	.long	0xc6d
+	.long	0x3fa2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x58
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 1023
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL657
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL658
+	.long	0x1178
+	.long	0x3fc6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL659
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL660
+	.long	0x1246
+	.long	0x3ff7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC107
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL661
+	.long	0x33d3
+	.long	0x400e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL662
+	.long	0xc8d
+	.long	0x4026
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL663
+	.long	0xc8d
+	.long	0x403e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL668
+	.long	0x4a5c
+	.long	0x4055
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL671
+	.long	0x1246
+	.long	0x4079
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL674
+	.long	0x1246
+	.long	0x409d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL677
+	.long	0x1246
+	.long	0x40c1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL678
+	.long	0xc8d
+	.long	0x40d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL681
+	.long	0x12c4
+	.long	0x40f7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL682
+	.long	0x1246
+	.long	0x411b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL683
+	.long	0x1246
+	.long	0x413f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC73
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL685
+	.long	0xdda
+	.long	0x4157
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL688
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL694
+	.long	0x33d3
+	.long	0x417b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL695
+	.long	0xc8d
+	.long	0x4193
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL696
+	.long	0xc8d
+	.long	0x41ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL703
+	.long	0xefe
+	.long	0x41c9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL705
+	.long	0x33d3
+	.long	0x41e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL706
+	.long	0xc8d
+	.long	0x41f8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL707
+	.long	0xc8d
+	.long	0x4210
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL708
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL711
+	.long	0x1246
+	.long	0x4241
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC106
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL712
+	.long	0x33d3
+	.long	0x4258
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL713
+	.long	0xc8d
+	.long	0x4270
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL714
+	.long	0xc8d
+	.long	0x4288
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL716
+	.long	0x1246
+	.long	0x42b8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC108
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL717
+	.long	0x33d3
+	.long	0x42cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL718
+	.long	0xc8d
+	.long	0x42e7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL719
+	.long	0xc8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF320
+	.value	0x2d7
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4684
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x2d7
+	.byte	0x20
+	.long	0x5e
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x2d7
+	.byte	0x2c
+	.long	0x5ea
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0xe
+	.long	.LASF291
+	.value	0x2dc
+	.byte	0xa
+	.long	0xbb9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -74
+	.uleb128 0xe
+	.long	.LASF180
+	.value	0x2dd
+	.byte	0x9
+	.long	0x5e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x2de
+	.byte	0xa
+	.long	0x715
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0xb
+	.long	.LASF321
+	.value	0x2de
+	.byte	0x15
+	.long	0x715
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0xb
+	.long	.LASF322
+	.value	0x2e4
+	.byte	0xb
+	.long	0x48
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x1e
+	.quad	.LBB100
+	.quad	.LBE100-.LBB100
+	.long	0x457e
+	.uleb128 0x6
+	.string	"r"
+	.value	0x2f6
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x15
+	.long	.LLRL133
+	.uleb128 0xb
+	.long	.LASF312
+	.value	0x2f9
+	.byte	0x15
+	.long	0x221
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0xb
+	.long	.LASF315
+	.value	0x2fa
+	.byte	0x12
+	.long	0x715
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x24
+	.long	0x632d
+	.quad	.LBI102
+	.byte	.LVU971
+	.long	.LLRL136
+	.value	0x2fb
+	.byte	0xd
+	.long	0x4444
+	.uleb128 0x1f
+	.long	0x6343
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x1f
+	.long	0x6339
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x8
+	.quad	.LVL465
+	.long	0xce2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	latency+15376
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6350
+	.quad	.LBI105
+	.byte	.LVU952
+	.quad	.LBB105
+	.quad	.LBE105-.LBB105
+	.value	0x2f9
+	.byte	0x1e
+	.long	0x4484
+	.uleb128 0x18
+	.long	0x6361
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x18
+	.long	0x636a
+	.long	.LLST140
+	.long	.LVUS140
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6350
+	.quad	.LBI107
+	.byte	.LVU963
+	.quad	.LBB107
+	.quad	.LBE107-.LBB107
+	.value	0x2fb
+	.byte	0x2d
+	.long	0x44c4
+	.uleb128 0x18
+	.long	0x6361
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x18
+	.long	0x636a
+	.long	.LLST142
+	.long	.LVUS142
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL463
+	.long	0x5865
+	.long	0x44e3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL467
+	.long	0x1246
+	.long	0x450d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC87
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL468
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL474
+	.long	0xdfa
+	.long	0x4532
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL480
+	.long	0x1246
+	.long	0x4556
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC86
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL482
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL442
+	.long	0xefe
+	.long	0x45a3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC84
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL445
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL446
+	.long	0x1178
+	.long	0x45c7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL448
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL449
+	.long	0x33d3
+	.long	0x45eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL451
+	.long	0x4a5c
+	.long	0x4602
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL455
+	.long	0x1246
+	.long	0x4626
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL458
+	.long	0xee3
+	.long	0x463f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL459
+	.long	0x1246
+	.long	0x4663
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC83
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL461
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC85
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF323
+	.value	0x28a
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4a5c
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x28a
+	.byte	0x20
+	.long	0x5e
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x28a
+	.byte	0x2c
+	.long	0x5ea
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0xb
+	.long	.LASF324
+	.value	0x28f
+	.byte	0xb
+	.long	0x48
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0xe
+	.long	.LASF291
+	.value	0x290
+	.byte	0xa
+	.long	0xbb9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -74
+	.uleb128 0xe
+	.long	.LASF180
+	.value	0x291
+	.byte	0x9
+	.long	0x5e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x292
+	.byte	0xa
+	.long	0x715
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0xb
+	.long	.LASF321
+	.value	0x292
+	.byte	0x15
+	.long	0x715
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0xb
+	.long	.LASF322
+	.value	0x298
+	.byte	0xb
+	.long	0x48
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x13
+	.long	.LLRL149
+	.long	0x4956
+	.uleb128 0x6
+	.string	"r"
+	.value	0x2aa
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x15
+	.long	.LLRL151
+	.uleb128 0xb
+	.long	.LASF312
+	.value	0x2ad
+	.byte	0x15
+	.long	0x221
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0xb
+	.long	.LASF315
+	.value	0x2ae
+	.byte	0x12
+	.long	0x715
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x24
+	.long	0x632d
+	.quad	.LBI115
+	.byte	.LVU1101
+	.long	.LLRL154
+	.value	0x2af
+	.byte	0xd
+	.long	0x47d4
+	.uleb128 0x1f
+	.long	0x6343
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x1f
+	.long	0x6339
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x8
+	.quad	.LVL513
+	.long	0xce2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	latency
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6350
+	.quad	.LBI118
+	.byte	.LVU1082
+	.quad	.LBB118
+	.quad	.LBE118-.LBB118
+	.value	0x2ad
+	.byte	0x1e
+	.long	0x4814
+	.uleb128 0x18
+	.long	0x6361
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x18
+	.long	0x636a
+	.long	.LLST158
+	.long	.LVUS158
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6350
+	.quad	.LBI120
+	.byte	.LVU1093
+	.quad	.LBB120
+	.quad	.LBE120-.LBB120
+	.value	0x2af
+	.byte	0x2d
+	.long	0x4854
+	.uleb128 0x18
+	.long	0x6361
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x18
+	.long	0x636a
+	.long	.LLST160
+	.long	.LVUS160
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL511
+	.long	0x5865
+	.long	0x4873
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL515
+	.long	0x1246
+	.long	0x4897
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC86
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL518
+	.long	0x1246
+	.long	0x48bb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC90
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL520
+	.long	0x1246
+	.long	0x48df
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC91
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL522
+	.long	0x1246
+	.long	0x4909
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC87
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL523
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL529
+	.long	0xeb6
+	.long	0x492e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL540
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL490
+	.long	0xefe
+	.long	0x497b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC84
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL492
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL493
+	.long	0x1178
+	.long	0x499f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL495
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL496
+	.long	0x33d3
+	.long	0x49c3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL498
+	.long	0x4a5c
+	.long	0x49da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL502
+	.long	0x1246
+	.long	0x49fe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL505
+	.long	0xee3
+	.long	0x4a17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL506
+	.long	0x1246
+	.long	0x4a3b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC83
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL509
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC89
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF325
+	.value	0x277
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4ca1
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x277
+	.byte	0x1a
+	.long	0x5e
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x277
+	.byte	0x26
+	.long	0x5ea
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x7
+	.long	.LASF326
+	.value	0x277
+	.byte	0x32
+	.long	0x5e
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0xb
+	.long	.LASF327
+	.value	0x27d
+	.byte	0xb
+	.long	0x48
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x27f
+	.byte	0xa
+	.long	0x715
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x24
+	.long	0x4ca1
+	.quad	.LBI79
+	.byte	.LVU698
+	.long	.LLRL105
+	.value	0x281
+	.byte	0x5
+	.long	0x4bfa
+	.uleb128 0x1f
+	.long	0x4caf
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x15
+	.long	.LLRL105
+	.uleb128 0x18
+	.long	0x4cbb
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x2
+	.quad	.LVL341
+	.long	0xd29
+	.long	0x4b31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL343
+	.long	0xd13
+	.long	0x4b59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC63
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL344
+	.long	0xcfd
+	.long	0x4b81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL345
+	.long	0x10cb
+	.long	0x4bae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC66
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xa
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL346
+	.long	0xcfd
+	.long	0x4bd6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC67
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -48
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL355
+	.long	0xcfd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0xc
+	.uleb128 0x35
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL337
+	.long	0xf5d
+	.uleb128 0x2
+	.quad	.LVL338
+	.long	0xd4b
+	.long	0x4c1f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL340
+	.long	0xd35
+	.uleb128 0x2
+	.quad	.LVL348
+	.long	0x1246
+	.long	0x4c56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL353
+	.long	0x1246
+	.long	0x4c7a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL357
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.long	.LASF329
+	.byte	0x1
+	.value	0x26b
+	.byte	0xd
+	.byte	0x1
+	.long	0x4cc6
+	.uleb128 0x57
+	.string	"ok"
+	.byte	0x1
+	.value	0x26b
+	.byte	0x1f
+	.long	0x715
+	.uleb128 0x26
+	.string	"r"
+	.value	0x26d
+	.byte	0x14
+	.long	0x7d2
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF330
+	.value	0x212
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x53a4
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x212
+	.byte	0x1f
+	.long	0x5e
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x212
+	.byte	0x2b
+	.long	0x5ea
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0x23
+	.string	"n"
+	.value	0x214
+	.byte	0x9
+	.long	0x5e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xe
+	.long	.LASF287
+	.value	0x214
+	.byte	0x14
+	.long	0x5e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x23
+	.string	"qs"
+	.value	0x226
+	.byte	0xe
+	.long	0x53a4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2128
+	.uleb128 0x6
+	.string	"all"
+	.value	0x227
+	.byte	0xe
+	.long	0x72b
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0xe
+	.long	.LASF331
+	.value	0x228
+	.byte	0xc
+	.long	0x2ad5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2944
+	.uleb128 0xe
+	.long	.LASF332
+	.value	0x228
+	.byte	0x27
+	.long	0x2ad5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -3760
+	.uleb128 0xe
+	.long	.LASF291
+	.value	0x229
+	.byte	0xa
+	.long	0xbb9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -3770
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x22a
+	.byte	0xa
+	.long	0x715
+	.long	.LLST190
+	.long	.LVUS190
+	.uleb128 0x1e
+	.quad	.LBB132
+	.quad	.LBE132-.LBB132
+	.long	0x4e17
+	.uleb128 0x6
+	.string	"i"
+	.value	0x230
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x2
+	.quad	.LVL748
+	.long	0x5865
+	.long	0x4dd8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL749
+	.long	0xeb6
+	.long	0x4df6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL751
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC111
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LLRL192
+	.long	0x4e40
+	.uleb128 0x6
+	.string	"i"
+	.value	0x239
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0x4
+	.quad	.LVL756
+	.long	0xed1
+	.byte	0
+	.uleb128 0x13
+	.long	.LLRL194
+	.long	0x5050
+	.uleb128 0x6
+	.string	"k"
+	.value	0x242
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0x13
+	.long	.LLRL196
+	.long	0x4ff0
+	.uleb128 0x6
+	.string	"t"
+	.value	0x243
+	.byte	0x16
+	.long	0x5e
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x15
+	.long	.LLRL198
+	.uleb128 0xb
+	.long	.LASF292
+	.value	0x245
+	.byte	0x1a
+	.long	0x5f4
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1e
+	.quad	.LBB139
+	.quad	.LBE139-.LBB139
+	.long	0x4ef2
+	.uleb128 0x6
+	.string	"i"
+	.value	0x24c
+	.byte	0x1a
+	.long	0x5e
+	.long	.LLST200
+	.long	.LVUS200
+	.uleb128 0x27
+	.quad	.LBB140
+	.quad	.LBE140-.LBB140
+	.uleb128 0xe
+	.long	.LASF333
+	.value	0x24d
+	.byte	0x1e
+	.long	0x53b4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -3792
+	.uleb128 0x8
+	.quad	.LVL786
+	.long	0xc52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL767
+	.long	0x5790
+	.long	0x4f0a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL768
+	.long	0x53c4
+	.long	0x4f30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -3824
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL770
+	.long	0x5790
+	.long	0x4f48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL773
+	.long	0x53c4
+	.long	0x4f6e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -3824
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL776
+	.long	0xea4
+	.uleb128 0x2
+	.quad	.LVL778
+	.long	0xc52
+	.long	0x4f9b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -3824
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL779
+	.long	0xea4
+	.uleb128 0x2
+	.quad	.LVL780
+	.long	0xe15
+	.long	0x4fc0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL783
+	.long	0xea4
+	.uleb128 0x4
+	.quad	.LVL789
+	.long	0xea4
+	.uleb128 0x8
+	.quad	.LVL790
+	.long	0xe15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL814
+	.long	0xe84
+	.long	0x5009
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -3760
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL815
+	.long	0xe84
+	.long	0x5022
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2944
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL816
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC118
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x3
+	.uleb128 0x35
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LBB147
+	.quad	.LBE147-.LBB147
+	.long	0x5085
+	.uleb128 0x6
+	.string	"i"
+	.value	0x260
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x4
+	.quad	.LVL797
+	.long	0x1167
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL723
+	.long	0xee3
+	.long	0x509e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL724
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL726
+	.long	0x118e
+	.long	0x50c2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL727
+	.long	0x1178
+	.long	0x50d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL730
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL731
+	.long	0x1178
+	.long	0x50fd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL732
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL733
+	.long	0x118e
+	.long	0x5121
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL734
+	.long	0x1246
+	.long	0x5145
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC117
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL738
+	.long	0x1246
+	.long	0x5169
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC109
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL740
+	.long	0x1246
+	.long	0x5194
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC110
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL741
+	.long	0xee3
+	.long	0x51ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL742
+	.long	0x1246
+	.long	0x51d7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x65
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL744
+	.long	0xed1
+	.uleb128 0x2
+	.quad	.LVL752
+	.long	0xe3c
+	.long	0x51fc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL754
+	.long	0xe3c
+	.long	0x5214
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL762
+	.long	0x1246
+	.long	0x525f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC116
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC115
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC114
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC113
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL764
+	.long	0x1246
+	.long	0x5283
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC112
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL765
+	.long	0x1246
+	.long	0x52ce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC116
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC115
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC114
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC113
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL792
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL793
+	.long	0x1178
+	.long	0x52f2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL795
+	.long	0x1167
+	.long	0x530a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL799
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL800
+	.long	0x118e
+	.long	0x532e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL802
+	.long	0x1129
+	.uleb128 0x4
+	.quad	.LVL806
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL807
+	.long	0x1178
+	.long	0x535f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL808
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL809
+	.long	0x118e
+	.long	0x5383
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL811
+	.long	0x115a
+	.uleb128 0x8
+	.quad	.LVL812
+	.long	0x118e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x72b
+	.long	0x53b4
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0xff
+	.byte	0
+	.uleb128 0xd
+	.long	0x72b
+	.long	0x53c4
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF334
+	.value	0x208
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5488
+	.uleb128 0x12
+	.string	"q"
+	.value	0x208
+	.byte	0x21
+	.long	0x72b
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x12
+	.string	"qs"
+	.value	0x208
+	.byte	0x2e
+	.long	0xc68
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x12
+	.string	"k"
+	.value	0x208
+	.byte	0x36
+	.long	0x5e
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x23
+	.string	"buf"
+	.value	0x20a
+	.byte	0xa
+	.long	0xbb9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -58
+	.uleb128 0x27
+	.quad	.LBB65
+	.quad	.LBE65-.LBB65
+	.uleb128 0x6
+	.string	"i"
+	.value	0x20b
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x2
+	.quad	.LVL240
+	.long	0xdda
+	.long	0x5472
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL241
+	.long	0xdfa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF335
+	.value	0x1c8
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x576b
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x1c8
+	.byte	0x1a
+	.long	0x5e
+	.long	.LLST202
+	.long	.LVUS202
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x1c8
+	.byte	0x26
+	.long	0x5ea
+	.long	.LLST203
+	.long	.LVUS203
+	.uleb128 0xe
+	.long	.LASF336
+	.value	0x1ce
+	.byte	0x9
+	.long	0x576b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x23
+	.string	"qs"
+	.value	0x1cf
+	.byte	0xe
+	.long	0x577b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -848
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x1ef
+	.byte	0xa
+	.long	0x715
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0x13
+	.long	.LLRL205
+	.long	0x55e2
+	.uleb128 0x6
+	.string	"i"
+	.value	0x1d0
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0x15
+	.long	.LLRL207
+	.uleb128 0x6
+	.string	"j"
+	.value	0x1d1
+	.byte	0xd
+	.long	0x5e
+	.long	.LLST208
+	.long	.LVUS208
+	.uleb128 0x13
+	.long	.LLRL209
+	.long	0x5578
+	.uleb128 0x6
+	.string	"k"
+	.value	0x1da
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST210
+	.long	.LVUS210
+	.uleb128 0x8
+	.quad	.LVL850
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC121
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL821
+	.long	0x6282
+	.long	0x5590
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL843
+	.long	0x1246
+	.long	0x55ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC94
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL846
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC120
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LLRL211
+	.long	0x5642
+	.uleb128 0x6
+	.string	"i"
+	.value	0x1f1
+	.byte	0x12
+	.long	0x5e
+	.long	.LLST212
+	.long	.LVUS212
+	.uleb128 0x15
+	.long	.LLRL213
+	.uleb128 0x6
+	.string	"src"
+	.value	0x1f2
+	.byte	0x1b
+	.long	0x578b
+	.long	.LLST214
+	.long	.LVUS214
+	.uleb128 0x8
+	.quad	.LVL856
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x35
+	.byte	0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL831
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL832
+	.long	0xcd1
+	.long	0x5666
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL833
+	.long	0x1178
+	.long	0x567d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL834
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL835
+	.long	0xcd1
+	.long	0x56a1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL840
+	.long	0x1246
+	.long	0x56c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC119
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL853
+	.long	0x1246
+	.long	0x56e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC122
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL854
+	.long	0xc52
+	.long	0x570b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -848
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -852
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL865
+	.long	0x33d3
+	.long	0x5722
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL868
+	.long	0x5790
+	.uleb128 0x2
+	.quad	.LVL870
+	.long	0x33d3
+	.long	0x5746
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL872
+	.long	0x33d3
+	.long	0x575d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL873
+	.long	0x1129
+	.byte	0
+	.uleb128 0xd
+	.long	0x5e
+	.long	0x577b
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xd
+	.long	0x72b
+	.long	0x578b
+	.uleb128 0x11
+	.long	0x2e
+	.byte	0x40
+	.byte	0
+	.uleb128 0xa
+	.long	0x9e0
+	.uleb128 0x10
+	.long	.LASF337
+	.value	0x1b5
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5865
+	.uleb128 0x12
+	.string	"q"
+	.value	0x1b5
+	.byte	0x23
+	.long	0x72b
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x12
+	.string	"cnt"
+	.value	0x1b5
+	.byte	0x2d
+	.long	0x1ed
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x1b7
+	.byte	0xa
+	.long	0x715
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x1e
+	.quad	.LBB129
+	.quad	.LBE129-.LBB129
+	.long	0x5840
+	.uleb128 0x6
+	.string	"e"
+	.value	0x1bb
+	.byte	0x1a
+	.long	0x670
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x4
+	.quad	.LVL643
+	.long	0xcb6
+	.uleb128 0x8
+	.quad	.LVL644
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC101
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL639
+	.long	0x1178
+	.long	0x5857
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL647
+	.long	0x115a
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF338
+	.value	0x1a8
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5901
+	.uleb128 0x12
+	.string	"buf"
+	.value	0x1a8
+	.byte	0x24
+	.long	0x48
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x7
+	.long	.LASF339
+	.value	0x1a8
+	.byte	0x30
+	.long	0x1ed
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x6
+	.string	"len"
+	.value	0x1aa
+	.byte	0xc
+	.long	0x1ed
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x1e
+	.quad	.LBB39
+	.quad	.LBE39-.LBB39
+	.long	0x58f3
+	.uleb128 0x6
+	.string	"n"
+	.value	0x1ae
+	.byte	0x11
+	.long	0x1ed
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x4
+	.quad	.LVL118
+	.long	0xe4d
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL114
+	.long	0xe4d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF340
+	.value	0x179
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5b45
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x179
+	.byte	0x1b
+	.long	0x5e
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x179
+	.byte	0x27
+	.long	0x5ea
+	.long	.LLST164
+	.long	.LVUS164
+	.uleb128 0x6
+	.string	"i"
+	.value	0x17f
+	.byte	0x9
+	.long	0x5e
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x6
+	.string	"src"
+	.value	0x189
+	.byte	0x13
+	.long	0x578b
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x196
+	.byte	0xa
+	.long	0x715
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x2
+	.quad	.LVL566
+	.long	0x6282
+	.long	0x599c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL570
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL571
+	.long	0xcd1
+	.long	0x59c0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL572
+	.long	0x1178
+	.long	0x59d7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL573
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL574
+	.long	0xcd1
+	.long	0x59fb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL576
+	.long	0x1246
+	.long	0x5a25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC98
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL577
+	.long	0x33d3
+	.long	0x5a3c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL583
+	.long	0x1246
+	.long	0x5a60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC93
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL586
+	.long	0x1246
+	.long	0x5a8a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC94
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL589
+	.long	0x1246
+	.long	0x5ab4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL592
+	.long	0x1246
+	.long	0x5ad8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC96
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL593
+	.long	0x1246
+	.long	0x5afc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC97
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL594
+	.long	0xe15
+	.uleb128 0x2
+	.quad	.LVL596
+	.long	0x33d3
+	.long	0x5b20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL597
+	.long	0x33d3
+	.long	0x5b37
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL598
+	.long	0x1129
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF341
+	.value	0x167
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5c19
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x167
+	.byte	0x1b
+	.long	0x5e
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x167
+	.byte	0x27
+	.long	0x5ea
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x13
+	.long	.LLRL2
+	.long	0x5be7
+	.uleb128 0x6
+	.string	"i"
+	.value	0x16e
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x2
+	.quad	.LVL7
+	.long	0x1246
+	.long	0x5bc7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL10
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL3
+	.long	0x1246
+	.long	0x5c0b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL5
+	.long	0x630a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF342
+	.value	0x15b
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5cb2
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x15b
+	.byte	0x18
+	.long	0x5e
+	.long	.LLST219
+	.long	.LVUS219
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x15b
+	.byte	0x24
+	.long	0x5ea
+	.long	.LLST220
+	.long	.LVUS220
+	.uleb128 0x2
+	.quad	.LVL895
+	.long	0x1246
+	.long	0x5c87
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC93
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL899
+	.long	0x611c
+	.long	0x5c9e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL900
+	.long	0x33d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF343
+	.value	0x133
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5e99
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x133
+	.byte	0x19
+	.long	0x5e
+	.long	.LLST221
+	.long	.LVUS221
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x133
+	.byte	0x25
+	.long	0x5ea
+	.long	.LLST222
+	.long	.LVUS222
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x13f
+	.byte	0xa
+	.long	0x715
+	.long	.LLST223
+	.long	.LVUS223
+	.uleb128 0xb
+	.long	.LASF276
+	.value	0x150
+	.byte	0xc
+	.long	0x1ed
+	.long	.LLST224
+	.long	.LVUS224
+	.uleb128 0x24
+	.long	0x6100
+	.quad	.LBI169
+	.byte	.LVU1900
+	.long	.LLRL225
+	.value	0x150
+	.byte	0x13
+	.long	0x5d54
+	.uleb128 0x58
+	.long	0x610f
+	.long	.LLRL225
+	.uleb128 0x18
+	.long	0x6110
+	.long	.LLST226
+	.long	.LVUS226
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL903
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL904
+	.long	0x1178
+	.long	0x5d78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL905
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL906
+	.long	0x118e
+	.long	0x5d9c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL907
+	.long	0x33d3
+	.long	0x5db3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL909
+	.long	0x4a5c
+	.long	0x5dca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL914
+	.long	0x1246
+	.long	0x5dee
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL918
+	.long	0x611c
+	.long	0x5e05
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL920
+	.long	0x1246
+	.long	0x5e29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC126
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL921
+	.long	0x118e
+	.long	0x5e40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL922
+	.long	0x1167
+	.uleb128 0x4
+	.quad	.LVL927
+	.long	0x1129
+	.uleb128 0x4
+	.quad	.LVL929
+	.long	0x113b
+	.uleb128 0x2
+	.quad	.LVL931
+	.long	0x1246
+	.long	0x5e8b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL932
+	.long	0x5e99
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF344
+	.value	0x125
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5f7b
+	.uleb128 0x7
+	.long	.LASF345
+	.value	0x125
+	.byte	0x1e
+	.long	0x48
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xb
+	.long	.LASF346
+	.value	0x127
+	.byte	0xb
+	.long	0x4ed
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2
+	.quad	.LVL14
+	.long	0x110d
+	.long	0x5f03
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL16
+	.long	0x10f7
+	.long	0x5f20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL17
+	.long	0x10e1
+	.long	0x5f38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL20
+	.long	0x1246
+	.long	0x5f62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL21
+	.long	0x10f7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF347
+	.value	0x10b
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6100
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x10b
+	.byte	0x18
+	.long	0x5e
+	.long	.LLST227
+	.long	.LVUS227
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x10b
+	.byte	0x24
+	.long	0x5ea
+	.long	.LLST228
+	.long	.LVUS228
+	.uleb128 0x6
+	.string	"ok"
+	.value	0x114
+	.byte	0xa
+	.long	0x715
+	.long	.LLST229
+	.long	.LVUS229
+	.uleb128 0x2
+	.quad	.LVL935
+	.long	0x1246
+	.long	0x5ffc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC127
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL936
+	.long	0x5cb2
+	.long	0x601a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL939
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL940
+	.long	0x1178
+	.long	0x603e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL942
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL943
+	.long	0x33d3
+	.long	0x6062
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL949
+	.long	0x1246
+	.long	0x6086
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL952
+	.long	0x611c
+	.long	0x609d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL954
+	.long	0xed1
+	.uleb128 0x4
+	.quad	.LVL956
+	.long	0x1129
+	.uleb128 0x2
+	.quad	.LVL957
+	.long	0x1178
+	.long	0x60ce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL959
+	.long	0x115a
+	.uleb128 0x2
+	.quad	.LVL960
+	.long	0x33d3
+	.long	0x60f2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL961
+	.long	0x1129
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF348
+	.value	0x102
+	.long	0x715
+	.long	0x611c
+	.uleb128 0x37
+	.uleb128 0x26
+	.string	"i"
+	.value	0x104
+	.byte	0xe
+	.long	0x5e
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF349
+	.byte	0xe7
+	.byte	0xd
+	.long	0x715
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6282
+	.uleb128 0x33
+	.long	.LASF124
+	.byte	0xe7
+	.byte	0x1d
+	.long	0x48
+	.long	.LLST215
+	.long	.LVUS215
+	.uleb128 0x33
+	.long	.LASF350
+	.byte	0xe7
+	.byte	0x28
+	.long	0x715
+	.long	.LLST216
+	.long	.LVUS216
+	.uleb128 0x3b
+	.string	"i"
+	.byte	0xe9
+	.byte	0x9
+	.long	0x5e
+	.long	.LLST217
+	.long	.LVUS217
+	.uleb128 0x59
+	.long	0x62f4
+	.quad	.LBI164
+	.byte	.LVU1833
+	.quad	.LBB164
+	.quad	.LBE164-.LBB164
+	.byte	0x1
+	.byte	0xfd
+	.byte	0x5
+	.long	0x61b4
+	.uleb128 0x1f
+	.long	0x6300
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x4
+	.quad	.LVL883
+	.long	0x630a
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL875
+	.long	0x6282
+	.long	0x61cc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL878
+	.long	0xc3b
+	.long	0x61e4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL881
+	.long	0xc20
+	.long	0x6202
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL888
+	.long	0x1246
+	.long	0x622c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC94
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL889
+	.long	0x1246
+	.long	0x625b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC124
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL891
+	.long	0x1246
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC125
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF351
+	.byte	0xdd
+	.byte	0xc
+	.long	0x5e
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x62f4
+	.uleb128 0x33
+	.long	.LASF124
+	.byte	0xdd
+	.byte	0x1d
+	.long	0x48
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x27
+	.quad	.LBB33
+	.quad	.LBE33-.LBB33
+	.uleb128 0x3b
+	.string	"i"
+	.byte	0xdf
+	.byte	0xe
+	.long	0x5e
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x8
+	.quad	.LVL91
+	.long	0xefe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF352
+	.byte	0xd4
+	.byte	0xd
+	.byte	0x1
+	.long	0x630a
+	.uleb128 0x3d
+	.string	"i"
+	.byte	0xd4
+	.byte	0x1e
+	.long	0x5e
+	.byte	0
+	.uleb128 0x5a
+	.long	.LASF366
+	.byte	0x1
+	.byte	0xce
+	.byte	0xd
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x5b
+	.long	.LASF354
+	.byte	0x1
+	.byte	0x86
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x3c
+	.long	.LASF355
+	.byte	0x61
+	.byte	0x14
+	.byte	0x3
+	.long	0x6350
+	.uleb128 0x3d
+	.string	"op"
+	.byte	0x61
+	.byte	0x27
+	.long	0x5e
+	.uleb128 0x5c
+	.long	.LASF356
+	.byte	0x1
+	.byte	0x61
+	.byte	0x33
+	.long	0x221
+	.byte	0
+	.uleb128 0x5d
+	.long	.LASF367
+	.byte	0x2
+	.byte	0x6
+	.byte	0x17
+	.long	0x221
+	.byte	0x3
+	.long	0x6374
+	.uleb128 0x3e
+	.string	"hi"
+	.byte	0x12
+	.long	0x82
+	.uleb128 0x3e
+	.string	"lo"
+	.byte	0x16
+	.long	0x82
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF357
+	.byte	0x3
+	.value	0x16a
+	.byte	0x1
+	.long	0x5e
+	.byte	0x3
+	.long	0x6394
+	.uleb128 0x5f
+	.long	.LASF358
+	.byte	0x3
+	.value	0x16a
+	.byte	0x1
+	.long	0x65
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF359
+	.long	.LASF361
+	.uleb128 0x3f
+	.long	.LASF360
+	.long	.LASF362
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS230:
+	.uleb128 0
+	.uleb128 .LVU2001
+	.uleb128 .LVU2001
+	.uleb128 .LVU2197
+	.uleb128 .LVU2197
+	.uleb128 .LVU2198
+	.uleb128 .LVU2198
+	.uleb128 0
+.LLST230:
+	.byte	0x4
+	.uleb128 .LVL962-.Ltext0
+	.uleb128 .LVL964-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL964-.Ltext0
+	.uleb128 .LVL1057-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL1057-.Ltext0
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS231:
+	.uleb128 0
+	.uleb128 .LVU2000
+	.uleb128 .LVU2000
+	.uleb128 .LVU2196
+	.uleb128 .LVU2196
+	.uleb128 .LVU2198
+	.uleb128 .LVU2198
+	.uleb128 0
+.LLST231:
+	.byte	0x4
+	.uleb128 .LVL962-.Ltext0
+	.uleb128 .LVL963-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL963-.Ltext0
+	.uleb128 .LVL1056-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1056-.Ltext0
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS232:
+	.uleb128 .LVU2026
+	.uleb128 .LVU2052
+	.uleb128 .LVU2057
+	.uleb128 .LVU2064
+	.uleb128 .LVU2064
+	.uleb128 .LVU2066
+	.uleb128 .LVU2066
+	.uleb128 .LVU2195
+	.uleb128 .LVU2198
+	.uleb128 0
+.LLST232:
+	.byte	0x4
+	.uleb128 .LVL972-.Ltext0
+	.uleb128 .LVL974-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL977-.Ltext0
+	.uleb128 .LVL981-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1808
+	.byte	0x4
+	.uleb128 .LVL981-.Ltext0
+	.uleb128 .LVL982-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1848
+	.byte	0x4
+	.uleb128 .LVL982-.Ltext0
+	.uleb128 .LVL1055-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1808
+	.byte	0x4
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1808
+	.byte	0
+.LVUS233:
+	.uleb128 .LVU2028
+	.uleb128 .LVU2052
+	.uleb128 .LVU2057
+	.uleb128 .LVU2122
+	.uleb128 .LVU2122
+	.uleb128 .LVU2125
+	.uleb128 .LVU2125
+	.uleb128 .LVU2195
+	.uleb128 .LVU2198
+	.uleb128 0
+.LLST233:
+	.byte	0x4
+	.uleb128 .LVL972-.Ltext0
+	.uleb128 .LVL974-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL977-.Ltext0
+	.uleb128 .LVL1011-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1832
+	.byte	0x4
+	.uleb128 .LVL1011-.Ltext0
+	.uleb128 .LVL1012-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL1012-.Ltext0
+	.uleb128 .LVL1055-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1832
+	.byte	0x4
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1832
+	.byte	0
+.LVUS234:
+	.uleb128 .LVU2031
+	.uleb128 .LVU2052
+	.uleb128 .LVU2057
+	.uleb128 .LVU2098
+	.uleb128 .LVU2098
+	.uleb128 .LVU2101
+	.uleb128 .LVU2101
+	.uleb128 .LVU2195
+	.uleb128 .LVU2198
+	.uleb128 0
+.LLST234:
+	.byte	0x4
+	.uleb128 .LVL972-.Ltext0
+	.uleb128 .LVL974-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL977-.Ltext0
+	.uleb128 .LVL999-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1816
+	.byte	0x4
+	.uleb128 .LVL999-.Ltext0
+	.uleb128 .LVL1000-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1848
+	.byte	0x4
+	.uleb128 .LVL1000-.Ltext0
+	.uleb128 .LVL1055-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1816
+	.byte	0x4
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1816
+	.byte	0
+.LVUS235:
+	.uleb128 .LVU2033
+	.uleb128 .LVU2052
+	.uleb128 .LVU2057
+	.uleb128 .LVU2106
+	.uleb128 .LVU2106
+	.uleb128 .LVU2109
+	.uleb128 .LVU2109
+	.uleb128 .LVU2195
+	.uleb128 .LVU2198
+	.uleb128 0
+.LLST235:
+	.byte	0x4
+	.uleb128 .LVL972-.Ltext0
+	.uleb128 .LVL974-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL977-.Ltext0
+	.uleb128 .LVL1003-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1800
+	.byte	0x4
+	.uleb128 .LVL1003-.Ltext0
+	.uleb128 .LVL1004-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1848
+	.byte	0x4
+	.uleb128 .LVL1004-.Ltext0
+	.uleb128 .LVL1055-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1800
+	.byte	0x4
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1800
+	.byte	0
+.LVUS236:
+	.uleb128 .LVU2035
+	.uleb128 .LVU2052
+	.uleb128 .LVU2057
+	.uleb128 .LVU2114
+	.uleb128 .LVU2114
+	.uleb128 .LVU2117
+	.uleb128 .LVU2117
+	.uleb128 .LVU2195
+	.uleb128 .LVU2198
+	.uleb128 0
+.LLST236:
+	.byte	0x4
+	.uleb128 .LVL972-.Ltext0
+	.uleb128 .LVL974-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL977-.Ltext0
+	.uleb128 .LVL1007-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1840
+	.byte	0x4
+	.uleb128 .LVL1007-.Ltext0
+	.uleb128 .LVL1008-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1856
+	.byte	0x4
+	.uleb128 .LVL1008-.Ltext0
+	.uleb128 .LVL1055-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1840
+	.byte	0x4
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1840
+	.byte	0
+.LVUS237:
+	.uleb128 .LVU2036
+	.uleb128 .LVU2052
+	.uleb128 .LVU2057
+	.uleb128 .LVU2077
+	.uleb128 .LVU2077
+	.uleb128 .LVU2079
+	.uleb128 .LVU2079
+	.uleb128 .LVU2195
+	.uleb128 .LVU2198
+	.uleb128 0
+.LLST237:
+	.byte	0x4
+	.uleb128 .LVL972-.Ltext0
+	.uleb128 .LVL974-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL977-.Ltext0
+	.uleb128 .LVL989-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1820
+	.byte	0x4
+	.uleb128 .LVL989-.Ltext0
+	.uleb128 .LVL990-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL990-.Ltext0
+	.uleb128 .LVL1055-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1820
+	.byte	0x4
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1820
+	.byte	0
+.LVUS238:
+	.uleb128 .LVU2057
+	.uleb128 .LVU2059
+	.uleb128 .LVU2059
+	.uleb128 .LVU2060
+	.uleb128 .LVU2068
+	.uleb128 .LVU2070
+	.uleb128 .LVU2070
+	.uleb128 .LVU2075
+	.uleb128 .LVU2079
+	.uleb128 .LVU2080
+	.uleb128 .LVU2086
+	.uleb128 .LVU2090
+	.uleb128 .LVU2093
+	.uleb128 .LVU2094
+	.uleb128 .LVU2101
+	.uleb128 .LVU2102
+	.uleb128 .LVU2109
+	.uleb128 .LVU2110
+	.uleb128 .LVU2117
+	.uleb128 .LVU2118
+	.uleb128 .LVU2125
+	.uleb128 .LVU2126
+	.uleb128 .LVU2127
+	.uleb128 .LVU2128
+.LLST238:
+	.byte	0x4
+	.uleb128 .LVL977-.Ltext0
+	.uleb128 .LVL978-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL978-.Ltext0
+	.uleb128 .LVL979-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL984-.Ltext0
+	.uleb128 .LVL985-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL985-.Ltext0
+	.uleb128 .LVL987-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL990-.Ltext0
+	.uleb128 .LVL991-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL993-.Ltext0
+	.uleb128 .LVL994-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL996-.Ltext0
+	.uleb128 .LVL997-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1000-.Ltext0
+	.uleb128 .LVL1001-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1004-.Ltext0
+	.uleb128 .LVL1005-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1008-.Ltext0
+	.uleb128 .LVL1009-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1012-.Ltext0
+	.uleb128 .LVL1013-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1014-.Ltext0
+	.uleb128 .LVL1015-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS239:
+	.uleb128 .LVU2186
+	.uleb128 .LVU2191
+	.uleb128 .LVU2193
+	.uleb128 .LVU2195
+	.uleb128 .LVU2202
+	.uleb128 0
+.LLST239:
+	.byte	0x4
+	.uleb128 .LVL1050-.Ltext0
+	.uleb128 .LVL1052-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1054-.Ltext0
+	.uleb128 .LVL1055-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL1061-.Ltext0
+	.uleb128 .LFE76-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL65-1-.Ltext0
+	.uleb128 .LFE74-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE73-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE73-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU75
+	.uleb128 .LVU79
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU84
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU58
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU71
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL84-1-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU266
+	.uleb128 .LVU266
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU287
+	.uleb128 .LVU287
+	.uleb128 .LVU288
+	.uleb128 .LVU288
+	.uleb128 .LVU294
+	.uleb128 .LVU294
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU294
+	.uleb128 .LVU294
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU247
+	.uleb128 .LVU262
+	.uleb128 .LVU269
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU279
+	.uleb128 .LVU288
+	.uleb128 .LVU294
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU327
+	.uleb128 .LVU328
+	.uleb128 .LVU394
+	.uleb128 .LVU404
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU280
+	.uleb128 .LVU288
+	.uleb128 .LVU294
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU306
+	.uleb128 .LVU313
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU385
+	.uleb128 .LVU385
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 .LVU404
+	.uleb128 .LVU404
+	.uleb128 .LVU408
+	.uleb128 .LVU410
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU285
+	.uleb128 .LVU288
+	.uleb128 .LVU294
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU327
+	.uleb128 .LVU328
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU394
+	.uleb128 .LVU404
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 10
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 11
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 10
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 10
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 10
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU294
+	.uleb128 .LVU327
+	.uleb128 .LVU331
+	.uleb128 .LVU386
+	.uleb128 .LVU404
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU294
+	.uleb128 .LVU306
+	.uleb128 .LVU333
+	.uleb128 .LVU342
+	.uleb128 .LVU342
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU385
+	.uleb128 .LVU404
+	.uleb128 .LVU408
+	.uleb128 .LVU415
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU294
+	.uleb128 .LVU306
+	.uleb128 .LVU344
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 .LVU354
+	.uleb128 .LVU421
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU300
+	.uleb128 .LVU306
+	.uleb128 .LVU357
+	.uleb128 .LVU359
+	.uleb128 .LVU359
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 .LVU371
+	.uleb128 .LVU371
+	.uleb128 .LVU385
+	.uleb128 .LVU421
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU359
+	.uleb128 .LVU371
+	.uleb128 .LVU374
+	.uleb128 .LVU375
+	.uleb128 .LVU375
+	.uleb128 .LVU380
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU393
+	.uleb128 .LVU395
+	.uleb128 .LVU395
+	.uleb128 .LVU397
+	.uleb128 .LVU397
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 .LVU404
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0xb
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x4c0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x4c0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x4b8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU193
+	.uleb128 .LVU212
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU200
+	.uleb128 .LVU210
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS50:
+	.uleb128 0
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL200-1-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 0
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL200-1-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 0
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL202-1-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL202-1-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 .LFE63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU436
+	.uleb128 .LVU436
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LFE63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 0
+	.uleb128 .LVU473
+	.uleb128 .LVU473
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 0
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 0
+	.uleb128 .LVU473
+	.uleb128 .LVU473
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 0
+	.uleb128 .LVU444
+	.uleb128 .LVU444
+	.uleb128 .LVU450
+	.uleb128 .LVU450
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LFE61-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS57:
+	.uleb128 0
+	.uleb128 .LVU444
+	.uleb128 .LVU444
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 0
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LFE61-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU441
+	.uleb128 .LVU444
+	.uleb128 .LVU444
+	.uleb128 .LVU449
+	.uleb128 .LVU452
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LFE61-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 0
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU480
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU488
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU467
+	.uleb128 .LVU467
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LFE59-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU467
+	.uleb128 .LVU467
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LFE59-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU456
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU464
+	.uleb128 .LVU467
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LFE59-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU176
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU184
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 0
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 .LVU528
+	.uleb128 .LVU528
+	.uleb128 0
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LFE57-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS75:
+	.uleb128 0
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU526
+	.uleb128 .LVU526
+	.uleb128 .LVU528
+	.uleb128 .LVU528
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LFE57-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU518
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU525
+	.uleb128 .LVU528
+	.uleb128 0
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LFE57-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 0
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU542
+	.uleb128 .LVU542
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 0
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 .LVU542
+	.uleb128 .LVU542
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU550
+	.uleb128 .LVU552
+	.uleb128 .LVU552
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU558
+	.uleb128 .LVU558
+	.uleb128 .LVU560
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU540
+	.uleb128 .LVU542
+	.uleb128 .LVU560
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU563
+	.uleb128 .LVU563
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	latency
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x3c10
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x19
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	latency
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x3c10
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x19
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	latency+15376
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x3c10
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	latency
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x3c10
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x19
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	latency+15376
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x3c10
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU560
+	.uleb128 .LVU563
+	.uleb128 .LVU563
+	.uleb128 .LVU564
+	.uleb128 .LVU565
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	latency
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x3c10
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x3c10
+	.byte	0x1e
+	.byte	0x3
+	.quad	latency
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	latency+15376
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x3c10
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x3c10
+	.byte	0x1e
+	.byte	0x3
+	.quad	latency
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	latency
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x3c10
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x3c10
+	.byte	0x1e
+	.byte	0x3
+	.quad	latency
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	latency+15376
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x3c10
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x3c10
+	.byte	0x1e
+	.byte	0x3
+	.quad	latency
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS87:
+	.uleb128 0
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU605
+	.uleb128 .LVU605
+	.uleb128 0
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 0
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU576
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 0
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x6
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 -88
+	.byte	0x6
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU578
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU591
+	.uleb128 .LVU591
+	.uleb128 .LVU592
+	.uleb128 .LVU599
+	.uleb128 .LVU602
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0xf
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU573
+	.uleb128 .LVU574
+	.uleb128 .LVU574
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU605
+	.uleb128 .LVU605
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0xb
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0xb
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0xb
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0xc
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 0
+	.uleb128 .LVU677
+	.uleb128 .LVU677
+	.uleb128 .LVU681
+	.uleb128 .LVU681
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 0
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 0
+	.uleb128 .LVU676
+	.uleb128 .LVU676
+	.uleb128 .LVU681
+	.uleb128 .LVU681
+	.uleb128 .LVU684
+	.uleb128 .LVU684
+	.uleb128 0
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL333-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL333-1-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS93:
+	.uleb128 0
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 .LVU632
+	.uleb128 .LVU632
+	.uleb128 .LVU633
+	.uleb128 .LVU633
+	.uleb128 .LVU663
+	.uleb128 .LVU663
+	.uleb128 .LVU664
+	.uleb128 .LVU664
+	.uleb128 0
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL299-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL299-1-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL306-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL306-1-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU610
+	.uleb128 .LVU641
+	.uleb128 .LVU641
+	.uleb128 .LVU642
+	.uleb128 .LVU643
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU648
+	.uleb128 .LVU648
+	.uleb128 .LVU655
+	.uleb128 .LVU655
+	.uleb128 .LVU657
+	.uleb128 .LVU659
+	.uleb128 .LVU662
+	.uleb128 .LVU662
+	.uleb128 .LVU663
+	.uleb128 .LVU664
+	.uleb128 .LVU666
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU614
+	.uleb128 .LVU631
+	.uleb128 .LVU632
+	.uleb128 .LVU635
+	.uleb128 .LVU635
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 .LVU642
+	.uleb128 .LVU643
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU655
+	.uleb128 .LVU655
+	.uleb128 .LVU659
+	.uleb128 .LVU664
+	.uleb128 0
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x94
+	.byte	0x4
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x94
+	.byte	0x4
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU616
+	.uleb128 .LVU619
+	.uleb128 .LVU632
+	.uleb128 .LVU633
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL299-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL306-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU621
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 .LVU632
+	.uleb128 .LVU635
+	.uleb128 .LVU659
+	.uleb128 .LVU664
+	.uleb128 0
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS168:
+	.uleb128 0
+	.uleb128 .LVU1255
+	.uleb128 .LVU1255
+	.uleb128 .LVU1282
+	.uleb128 .LVU1282
+	.uleb128 .LVU1285
+	.uleb128 .LVU1285
+	.uleb128 .LVU1288
+	.uleb128 .LVU1288
+	.uleb128 .LVU1290
+	.uleb128 .LVU1290
+	.uleb128 0
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL599-.Ltext0
+	.uleb128 .LVL600-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL600-.Ltext0
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL620-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL620-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS169:
+	.uleb128 0
+	.uleb128 .LVU1255
+	.uleb128 .LVU1255
+	.uleb128 .LVU1282
+	.uleb128 .LVU1282
+	.uleb128 .LVU1284
+	.uleb128 .LVU1284
+	.uleb128 .LVU1288
+	.uleb128 .LVU1288
+	.uleb128 .LVU1289
+	.uleb128 .LVU1289
+	.uleb128 0
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL599-.Ltext0
+	.uleb128 .LVL600-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL600-.Ltext0
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL615-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL615-.Ltext0
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU1258
+	.uleb128 .LVU1260
+	.uleb128 .LVU1260
+	.uleb128 .LVU1275
+	.uleb128 .LVU1275
+	.uleb128 .LVU1276
+	.uleb128 .LVU1276
+	.uleb128 .LVU1282
+	.uleb128 .LVU1291
+	.uleb128 .LVU1292
+	.uleb128 .LVU1292
+	.uleb128 .LVU1306
+	.uleb128 .LVU1307
+	.uleb128 0
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL603-.Ltext0
+	.uleb128 .LVL604-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL604-.Ltext0
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL634-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU1268
+	.uleb128 .LVU1282
+	.uleb128 .LVU1294
+	.uleb128 .LVU1296
+	.uleb128 .LVU1296
+	.uleb128 .LVU1301
+	.uleb128 .LVU1301
+	.uleb128 .LVU1305
+	.uleb128 .LVU1307
+	.uleb128 0
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL609-.Ltext0
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 .LVL627-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL627-.Ltext0
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL634-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU1274
+	.uleb128 .LVU1280
+	.uleb128 .LVU1301
+	.uleb128 .LVU1302
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL613-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 .LVL630-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU800
+	.uleb128 .LVU800
+	.uleb128 .LVU820
+	.uleb128 .LVU820
+	.uleb128 .LVU822
+	.uleb128 .LVU822
+	.uleb128 .LVU823
+	.uleb128 .LVU823
+	.uleb128 .LVU825
+	.uleb128 .LVU825
+	.uleb128 .LVU826
+	.uleb128 .LVU826
+	.uleb128 .LVU829
+	.uleb128 .LVU829
+	.uleb128 .LVU832
+	.uleb128 .LVU832
+	.uleb128 .LVU833
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL403-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL403-1-.Ltext0
+	.uleb128 .LVL404-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL404-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 .LVL407-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL407-.Ltext0
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LVL412-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL412-1-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU800
+	.uleb128 .LVU800
+	.uleb128 .LVU810
+	.uleb128 .LVU810
+	.uleb128 .LVU820
+	.uleb128 .LVU820
+	.uleb128 .LVU822
+	.uleb128 .LVU822
+	.uleb128 .LVU823
+	.uleb128 .LVU823
+	.uleb128 .LVU824
+	.uleb128 .LVU824
+	.uleb128 .LVU829
+	.uleb128 .LVU829
+	.uleb128 .LVU831
+	.uleb128 .LVU831
+	.uleb128 .LVU836
+	.uleb128 .LVU836
+	.uleb128 .LVU869
+	.uleb128 .LVU869
+	.uleb128 .LVU872
+	.uleb128 .LVU872
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL403-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL403-1-.Ltext0
+	.uleb128 .LVL404-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL404-.Ltext0
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU797
+	.uleb128 .LVU815
+	.uleb128 .LVU815
+	.uleb128 .LVU818
+	.uleb128 .LVU829
+	.uleb128 .LVU840
+	.uleb128 .LVU840
+	.uleb128 .LVU843
+	.uleb128 .LVU843
+	.uleb128 .LVU879
+	.uleb128 .LVU879
+	.uleb128 .LVU881
+	.uleb128 .LVU881
+	.uleb128 0
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU801
+	.uleb128 .LVU810
+	.uleb128 .LVU835
+	.uleb128 .LVU836
+	.uleb128 .LVU836
+	.uleb128 .LVU843
+	.uleb128 .LVU855
+	.uleb128 .LVU860
+	.uleb128 .LVU860
+	.uleb128 .LVU869
+	.uleb128 .LVU869
+	.uleb128 .LVU873
+	.uleb128 .LVU879
+	.uleb128 .LVU881
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 .LVL430-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU836
+	.uleb128 .LVU869
+	.uleb128 .LVU879
+	.uleb128 0
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU836
+	.uleb128 .LVU843
+	.uleb128 .LVU852
+	.uleb128 .LVU869
+	.uleb128 .LVU879
+	.uleb128 .LVU881
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU836
+	.uleb128 .LVU837
+	.uleb128 .LVU864
+	.uleb128 .LVU868
+	.uleb128 .LVU868
+	.uleb128 .LVU869
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL417-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU836
+	.uleb128 .LVU837
+	.uleb128 .LVU864
+	.uleb128 .LVU869
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU848
+	.uleb128 .LVU850
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU848
+	.uleb128 .LVU852
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU860
+	.uleb128 .LVU861
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU860
+	.uleb128 .LVU861
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS161:
+	.uleb128 0
+	.uleb128 .LVU1149
+	.uleb128 .LVU1149
+	.uleb128 .LVU1161
+	.uleb128 .LVU1161
+	.uleb128 .LVU1163
+	.uleb128 .LVU1163
+	.uleb128 .LVU1164
+	.uleb128 .LVU1164
+	.uleb128 .LVU1166
+	.uleb128 .LVU1166
+	.uleb128 .LVU1169
+	.uleb128 .LVU1169
+	.uleb128 .LVU1171
+	.uleb128 .LVU1171
+	.uleb128 0
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL544-.Ltext0
+	.uleb128 .LVL545-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL545-.Ltext0
+	.uleb128 .LVL553-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL553-.Ltext0
+	.uleb128 .LVL554-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL554-1-.Ltext0
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 .LVL557-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL557-.Ltext0
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS162:
+	.uleb128 0
+	.uleb128 .LVU1149
+	.uleb128 .LVU1149
+	.uleb128 .LVU1161
+	.uleb128 .LVU1161
+	.uleb128 .LVU1163
+	.uleb128 .LVU1163
+	.uleb128 .LVU1164
+	.uleb128 .LVU1164
+	.uleb128 .LVU1165
+	.uleb128 .LVU1165
+	.uleb128 .LVU1169
+	.uleb128 .LVU1169
+	.uleb128 .LVU1170
+	.uleb128 .LVU1170
+	.uleb128 0
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL544-.Ltext0
+	.uleb128 .LVL545-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL545-.Ltext0
+	.uleb128 .LVL553-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL553-.Ltext0
+	.uleb128 .LVL554-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL554-1-.Ltext0
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 .LVL556-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL556-.Ltext0
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 .LVL560-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL560-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 0
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 .LVU756
+	.uleb128 .LVU756
+	.uleb128 .LVU758
+	.uleb128 .LVU758
+	.uleb128 .LVU759
+	.uleb128 .LVU759
+	.uleb128 .LVU761
+	.uleb128 .LVU761
+	.uleb128 .LVU764
+	.uleb128 .LVU764
+	.uleb128 .LVU766
+	.uleb128 .LVU766
+	.uleb128 .LVU767
+	.uleb128 .LVU767
+	.uleb128 .LVU769
+	.uleb128 .LVU769
+	.uleb128 0
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 .LVL368-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL368-1-.Ltext0
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 0
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 .LVU756
+	.uleb128 .LVU756
+	.uleb128 .LVU758
+	.uleb128 .LVU758
+	.uleb128 .LVU759
+	.uleb128 .LVU759
+	.uleb128 .LVU760
+	.uleb128 .LVU760
+	.uleb128 .LVU764
+	.uleb128 .LVU764
+	.uleb128 .LVU765
+	.uleb128 .LVU765
+	.uleb128 .LVU767
+	.uleb128 .LVU767
+	.uleb128 .LVU768
+	.uleb128 .LVU768
+	.uleb128 0
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 .LVL368-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL368-1-.Ltext0
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU735
+	.uleb128 .LVU756
+	.uleb128 .LVU764
+	.uleb128 .LVU781
+	.uleb128 .LVU781
+	.uleb128 .LVU784
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU742
+	.uleb128 .LVU747
+	.uleb128 .LVU770
+	.uleb128 .LVU772
+	.uleb128 .LVU772
+	.uleb128 .LVU773
+	.uleb128 .LVU773
+	.uleb128 .LVU779
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS178:
+	.uleb128 0
+	.uleb128 .LVU1351
+	.uleb128 .LVU1351
+	.uleb128 .LVU1402
+	.uleb128 .LVU1402
+	.uleb128 .LVU1403
+	.uleb128 .LVU1403
+	.uleb128 0
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL648-.Ltext0
+	.uleb128 .LVL649-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL649-.Ltext0
+	.uleb128 .LVL666-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL666-.Ltext0
+	.uleb128 .LVL667-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL667-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS179:
+	.uleb128 0
+	.uleb128 .LVU1352
+	.uleb128 .LVU1352
+	.uleb128 .LVU1403
+	.uleb128 .LVU1403
+	.uleb128 .LVU1405
+	.uleb128 .LVU1405
+	.uleb128 .LVU1406
+	.uleb128 .LVU1406
+	.uleb128 .LVU1407
+	.uleb128 .LVU1407
+	.uleb128 0
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL648-.Ltext0
+	.uleb128 .LVL650-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL650-1-.Ltext0
+	.uleb128 .LVL667-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL667-.Ltext0
+	.uleb128 .LVL668-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL668-1-.Ltext0
+	.uleb128 .LVL669-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL669-.Ltext0
+	.uleb128 .LVL670-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL670-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU1353
+	.uleb128 .LVU1358
+	.uleb128 .LVU1358
+	.uleb128 .LVU1401
+	.uleb128 .LVU1410
+	.uleb128 .LVU1411
+	.uleb128 .LVU1411
+	.uleb128 0
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL652-1-.Ltext0
+	.uleb128 .LVL665-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL672-.Ltext0
+	.uleb128 .LVL673-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL673-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU1359
+	.uleb128 .LVU1365
+	.uleb128 .LVU1365
+	.uleb128 .LVU1401
+	.uleb128 .LVU1414
+	.uleb128 .LVU1415
+	.uleb128 .LVU1415
+	.uleb128 .LVU1419
+	.uleb128 .LVU1419
+	.uleb128 .LVU1420
+	.uleb128 .LVU1420
+	.uleb128 0
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL653-.Ltext0
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 .LVL665-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL675-.Ltext0
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 .LVL679-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL679-.Ltext0
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU1362
+	.uleb128 .LVU1401
+	.uleb128 .LVU1419
+	.uleb128 0
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL654-.Ltext0
+	.uleb128 .LVL665-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x2b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL679-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x2b
+	.byte	0x9f
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU1363
+	.uleb128 .LVU1394
+	.uleb128 .LVU1394
+	.uleb128 .LVU1400
+	.uleb128 .LVU1419
+	.uleb128 .LVU1438
+	.uleb128 .LVU1438
+	.uleb128 .LVU1453
+	.uleb128 .LVU1453
+	.uleb128 .LVU1457
+	.uleb128 .LVU1457
+	.uleb128 .LVU1462
+	.uleb128 .LVU1462
+	.uleb128 .LVU1464
+	.uleb128 .LVU1464
+	.uleb128 .LVU1466
+	.uleb128 .LVU1466
+	.uleb128 .LVU1475
+	.uleb128 .LVU1475
+	.uleb128 .LVU1481
+	.uleb128 .LVU1481
+	.uleb128 .LVU1482
+	.uleb128 .LVU1482
+	.uleb128 .LVU1488
+	.uleb128 .LVU1488
+	.uleb128 .LVU1490
+	.uleb128 .LVU1490
+	.uleb128 0
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL654-.Ltext0
+	.uleb128 .LVL660-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL660-.Ltext0
+	.uleb128 .LVL664-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL679-.Ltext0
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 .LVL692-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL692-.Ltext0
+	.uleb128 .LVL693-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL693-.Ltext0
+	.uleb128 .LVL697-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL697-.Ltext0
+	.uleb128 .LVL698-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL698-.Ltext0
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 .LVL709-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL709-.Ltext0
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU1382
+	.uleb128 .LVU1387
+	.uleb128 .LVU1426
+	.uleb128 .LVU1429
+	.uleb128 .LVU1429
+	.uleb128 .LVU1430
+	.uleb128 .LVU1430
+	.uleb128 .LVU1438
+	.uleb128 .LVU1462
+	.uleb128 .LVU1465
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL657-.Ltext0
+	.uleb128 .LVL659-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL684-.Ltext0
+	.uleb128 .LVL686-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL686-.Ltext0
+	.uleb128 .LVL687-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL687-.Ltext0
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL697-.Ltext0
+	.uleb128 .LVL699-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS186:
+	.uleb128 .LVU1441
+	.uleb128 .LVU1452
+	.uleb128 .LVU1466
+	.uleb128 .LVU1467
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL690-.Ltext0
+	.uleb128 .LVL692-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL701-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS127:
+	.uleb128 0
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU916
+	.uleb128 .LVU916
+	.uleb128 .LVU918
+	.uleb128 .LVU918
+	.uleb128 .LVU919
+	.uleb128 .LVU919
+	.uleb128 .LVU920
+	.uleb128 .LVU920
+	.uleb128 .LVU921
+	.uleb128 .LVU921
+	.uleb128 .LVU924
+	.uleb128 .LVU924
+	.uleb128 .LVU926
+	.uleb128 .LVU926
+	.uleb128 .LVU927
+	.uleb128 .LVU927
+	.uleb128 0
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 .LVL451-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL451-1-.Ltext0
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 .LVL457-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL457-.Ltext0
+	.uleb128 .LVL458-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL458-1-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 0
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU912
+	.uleb128 .LVU912
+	.uleb128 .LVU916
+	.uleb128 .LVU916
+	.uleb128 .LVU933
+	.uleb128 .LVU933
+	.uleb128 .LVU994
+	.uleb128 .LVU994
+	.uleb128 .LVU997
+	.uleb128 .LVU997
+	.uleb128 0
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU892
+	.uleb128 .LVU912
+	.uleb128 .LVU912
+	.uleb128 .LVU915
+	.uleb128 .LVU919
+	.uleb128 .LVU944
+	.uleb128 .LVU944
+	.uleb128 .LVU948
+	.uleb128 .LVU948
+	.uleb128 .LVU986
+	.uleb128 .LVU986
+	.uleb128 .LVU987
+	.uleb128 .LVU987
+	.uleb128 .LVU989
+	.uleb128 .LVU989
+	.uleb128 .LVU994
+	.uleb128 .LVU994
+	.uleb128 .LVU997
+	.uleb128 .LVU997
+	.uleb128 0
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -89
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU892
+	.uleb128 .LVU905
+	.uleb128 .LVU905
+	.uleb128 .LVU915
+	.uleb128 .LVU919
+	.uleb128 .LVU932
+	.uleb128 .LVU932
+	.uleb128 0
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL460-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL460-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU897
+	.uleb128 .LVU904
+	.uleb128 .LVU905
+	.uleb128 .LVU915
+	.uleb128 .LVU924
+	.uleb128 0
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU946
+	.uleb128 .LVU947
+	.uleb128 .LVU947
+	.uleb128 .LVU948
+	.uleb128 .LVU997
+	.uleb128 0
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU934
+	.uleb128 .LVU948
+	.uleb128 .LVU959
+	.uleb128 .LVU994
+	.uleb128 .LVU997
+	.uleb128 0
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU934
+	.uleb128 .LVU948
+	.uleb128 .LVU962
+	.uleb128 .LVU966
+	.uleb128 .LVU966
+	.uleb128 .LVU994
+	.uleb128 .LVU997
+	.uleb128 0
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU934
+	.uleb128 .LVU935
+	.uleb128 .LVU970
+	.uleb128 .LVU974
+	.uleb128 .LVU974
+	.uleb128 .LVU975
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 .LVL465-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 .LVL478-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL478-.Ltext0
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU934
+	.uleb128 .LVU936
+	.uleb128 .LVU970
+	.uleb128 .LVU975
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 .LVL466-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU955
+	.uleb128 .LVU957
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU955
+	.uleb128 .LVU959
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU966
+	.uleb128 .LVU967
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU966
+	.uleb128 .LVU967
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS143:
+	.uleb128 0
+	.uleb128 .LVU1015
+	.uleb128 .LVU1015
+	.uleb128 .LVU1030
+	.uleb128 .LVU1030
+	.uleb128 .LVU1032
+	.uleb128 .LVU1032
+	.uleb128 .LVU1033
+	.uleb128 .LVU1033
+	.uleb128 .LVU1034
+	.uleb128 .LVU1034
+	.uleb128 .LVU1035
+	.uleb128 .LVU1035
+	.uleb128 .LVU1038
+	.uleb128 .LVU1038
+	.uleb128 .LVU1040
+	.uleb128 .LVU1040
+	.uleb128 .LVU1041
+	.uleb128 .LVU1041
+	.uleb128 0
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 .LVL489-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL489-.Ltext0
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 .LVL498-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL498-1-.Ltext0
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 .LVL505-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL505-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 0
+	.uleb128 .LVU1015
+	.uleb128 .LVU1015
+	.uleb128 .LVU1026
+	.uleb128 .LVU1026
+	.uleb128 .LVU1030
+	.uleb128 .LVU1030
+	.uleb128 .LVU1049
+	.uleb128 .LVU1049
+	.uleb128 .LVU1134
+	.uleb128 .LVU1134
+	.uleb128 .LVU1138
+	.uleb128 .LVU1138
+	.uleb128 0
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 .LVL489-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL489-.Ltext0
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU1004
+	.uleb128 .LVU1026
+	.uleb128 .LVU1033
+	.uleb128 .LVU1049
+	.uleb128 .LVU1124
+	.uleb128 .LVU1127
+	.uleb128 .LVU1134
+	.uleb128 .LVU1138
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL537-.Ltext0
+	.uleb128 .LVL538-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU1008
+	.uleb128 .LVU1026
+	.uleb128 .LVU1026
+	.uleb128 .LVU1029
+	.uleb128 .LVU1033
+	.uleb128 .LVU1055
+	.uleb128 .LVU1055
+	.uleb128 .LVU1057
+	.uleb128 .LVU1057
+	.uleb128 .LVU1059
+	.uleb128 .LVU1059
+	.uleb128 .LVU1062
+	.uleb128 .LVU1062
+	.uleb128 .LVU1064
+	.uleb128 .LVU1064
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+	.uleb128 .LVU1074
+	.uleb128 .LVU1074
+	.uleb128 .LVU1078
+	.uleb128 .LVU1078
+	.uleb128 .LVU1121
+	.uleb128 .LVU1121
+	.uleb128 .LVU1127
+	.uleb128 .LVU1127
+	.uleb128 .LVU1131
+	.uleb128 .LVU1131
+	.uleb128 .LVU1133
+	.uleb128 .LVU1133
+	.uleb128 .LVU1134
+	.uleb128 .LVU1134
+	.uleb128 .LVU1138
+	.uleb128 .LVU1138
+	.uleb128 .LVU1139
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -90
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 .LVL521-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL521-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 .LVL525-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL525-.Ltext0
+	.uleb128 .LVL536-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL536-.Ltext0
+	.uleb128 .LVL538-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL538-.Ltext0
+	.uleb128 .LVL539-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL539-.Ltext0
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 .LVL543-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU1008
+	.uleb128 .LVU1019
+	.uleb128 .LVU1019
+	.uleb128 .LVU1029
+	.uleb128 .LVU1033
+	.uleb128 .LVU1048
+	.uleb128 .LVU1048
+	.uleb128 0
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU1013
+	.uleb128 .LVU1029
+	.uleb128 .LVU1038
+	.uleb128 .LVU1047
+	.uleb128 .LVU1048
+	.uleb128 0
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU1076
+	.uleb128 .LVU1077
+	.uleb128 .LVU1077
+	.uleb128 .LVU1078
+	.uleb128 .LVU1138
+	.uleb128 0
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 .LVL524-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL524-.Ltext0
+	.uleb128 .LVL525-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU1050
+	.uleb128 .LVU1057
+	.uleb128 .LVU1067
+	.uleb128 .LVU1073
+	.uleb128 .LVU1089
+	.uleb128 .LVU1118
+	.uleb128 .LVU1131
+	.uleb128 .LVU1134
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL521-.Ltext0
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL539-.Ltext0
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU1050
+	.uleb128 .LVU1056
+	.uleb128 .LVU1057
+	.uleb128 .LVU1073
+	.uleb128 .LVU1092
+	.uleb128 .LVU1096
+	.uleb128 .LVU1096
+	.uleb128 .LVU1121
+	.uleb128 .LVU1131
+	.uleb128 .LVU1134
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL530-.Ltext0
+	.uleb128 .LVL531-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL531-.Ltext0
+	.uleb128 .LVL536-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL539-.Ltext0
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU1050
+	.uleb128 .LVU1051
+	.uleb128 .LVU1100
+	.uleb128 .LVU1104
+	.uleb128 .LVU1104
+	.uleb128 .LVU1105
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU1050
+	.uleb128 .LVU1052
+	.uleb128 .LVU1100
+	.uleb128 .LVU1105
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU1085
+	.uleb128 .LVU1087
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL526-.Ltext0
+	.uleb128 .LVL527-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU1085
+	.uleb128 .LVU1089
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL526-.Ltext0
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU1096
+	.uleb128 .LVU1097
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL531-.Ltext0
+	.uleb128 .LVL531-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU1096
+	.uleb128 .LVU1097
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL531-.Ltext0
+	.uleb128 .LVL531-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS100:
+	.uleb128 0
+	.uleb128 .LVU694
+	.uleb128 .LVU694
+	.uleb128 .LVU715
+	.uleb128 .LVU715
+	.uleb128 .LVU718
+	.uleb128 .LVU718
+	.uleb128 0
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL337-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL337-1-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 0
+	.uleb128 .LVU694
+	.uleb128 .LVU694
+	.uleb128 .LVU715
+	.uleb128 .LVU715
+	.uleb128 .LVU717
+	.uleb128 .LVU717
+	.uleb128 0
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL337-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL337-1-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 0
+	.uleb128 .LVU692
+	.uleb128 .LVU692
+	.uleb128 .LVU696
+	.uleb128 .LVU696
+	.uleb128 .LVU715
+	.uleb128 .LVU715
+	.uleb128 .LVU716
+	.uleb128 .LVU716
+	.uleb128 0
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU693
+	.uleb128 .LVU714
+	.uleb128 .LVU721
+	.uleb128 0
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU696
+	.uleb128 .LVU697
+	.uleb128 .LVU697
+	.uleb128 .LVU714
+	.uleb128 .LVU721
+	.uleb128 0
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU698
+	.uleb128 .LVU709
+	.uleb128 .LVU721
+	.uleb128 .LVU723
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU701
+	.uleb128 .LVU709
+	.uleb128 .LVU721
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU723
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 0x5
+	.byte	0x93
+	.uleb128 0x18
+	.byte	0x5c
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL355-1-.Ltext0
+	.uleb128 0x5
+	.byte	0x93
+	.uleb128 0x18
+	.byte	0x62
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL355-1-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x5
+	.byte	0x93
+	.uleb128 0x18
+	.byte	0x5c
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS187:
+	.uleb128 0
+	.uleb128 .LVU1506
+	.uleb128 .LVU1506
+	.uleb128 .LVU1521
+	.uleb128 .LVU1521
+	.uleb128 .LVU1533
+	.uleb128 .LVU1533
+	.uleb128 .LVU1535
+	.uleb128 .LVU1535
+	.uleb128 .LVU1538
+	.uleb128 .LVU1538
+	.uleb128 .LVU1547
+	.uleb128 .LVU1547
+	.uleb128 0
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 .LVL722-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL722-.Ltext0
+	.uleb128 .LVL728-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL728-.Ltext0
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 .LVL737-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL737-.Ltext0
+	.uleb128 .LVL739-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL739-.Ltext0
+	.uleb128 .LVL743-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL743-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS188:
+	.uleb128 0
+	.uleb128 .LVU1505
+	.uleb128 .LVU1505
+	.uleb128 .LVU1523
+	.uleb128 .LVU1523
+	.uleb128 .LVU1533
+	.uleb128 .LVU1533
+	.uleb128 .LVU1534
+	.uleb128 .LVU1534
+	.uleb128 .LVU1553
+	.uleb128 .LVU1553
+	.uleb128 0
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 .LVL721-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL721-.Ltext0
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 .LVL736-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL736-.Ltext0
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU1515
+	.uleb128 .LVU1523
+	.uleb128 .LVU1523
+	.uleb128 .LVU1533
+	.uleb128 .LVU1547
+	.uleb128 .LVU1549
+	.uleb128 .LVU1549
+	.uleb128 .LVU1555
+	.uleb128 .LVU1555
+	.uleb128 .LVU1678
+	.uleb128 .LVU1679
+	.uleb128 0
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL743-.Ltext0
+	.uleb128 .LVL745-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL745-.Ltext0
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 .LVL803-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL804-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS190:
+	.uleb128 .LVU1518
+	.uleb128 .LVU1523
+	.uleb128 .LVU1523
+	.uleb128 .LVU1530
+	.uleb128 .LVU1547
+	.uleb128 .LVU1564
+	.uleb128 .LVU1564
+	.uleb128 .LVU1565
+	.uleb128 .LVU1565
+	.uleb128 .LVU1570
+	.uleb128 .LVU1570
+	.uleb128 .LVU1580
+	.uleb128 .LVU1580
+	.uleb128 .LVU1587
+	.uleb128 .LVU1588
+	.uleb128 .LVU1594
+	.uleb128 .LVU1597
+	.uleb128 .LVU1601
+	.uleb128 .LVU1601
+	.uleb128 .LVU1607
+	.uleb128 .LVU1607
+	.uleb128 .LVU1611
+	.uleb128 .LVU1611
+	.uleb128 .LVU1615
+	.uleb128 .LVU1615
+	.uleb128 .LVU1617
+	.uleb128 .LVU1617
+	.uleb128 .LVU1630
+	.uleb128 .LVU1630
+	.uleb128 .LVU1632
+	.uleb128 .LVU1632
+	.uleb128 .LVU1653
+	.uleb128 .LVU1653
+	.uleb128 .LVU1662
+	.uleb128 .LVU1679
+	.uleb128 .LVU1680
+	.uleb128 .LVU1680
+	.uleb128 .LVU1687
+	.uleb128 .LVU1687
+	.uleb128 .LVU1690
+	.uleb128 .LVU1690
+	.uleb128 0
+.LLST190:
+	.byte	0x4
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 .LVL733-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL743-.Ltext0
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 .LVL753-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL753-.Ltext0
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 .LVL769-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL769-.Ltext0
+	.uleb128 .LVL772-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -3794
+	.byte	0x4
+	.uleb128 .LVL772-.Ltext0
+	.uleb128 .LVL774-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL774-.Ltext0
+	.uleb128 .LVL775-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL775-.Ltext0
+	.uleb128 .LVL781-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL781-.Ltext0
+	.uleb128 .LVL782-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL782-.Ltext0
+	.uleb128 .LVL791-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -3794
+	.byte	0x4
+	.uleb128 .LVL791-.Ltext0
+	.uleb128 .LVL794-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL804-.Ltext0
+	.uleb128 .LVL805-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL805-.Ltext0
+	.uleb128 .LVL810-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL810-.Ltext0
+	.uleb128 .LVL813-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL813-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU1551
+	.uleb128 .LVU1555
+	.uleb128 .LVU1555
+	.uleb128 .LVU1565
+	.uleb128 .LVU1570
+	.uleb128 .LVU1576
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL745-.Ltext0
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL753-.Ltext0
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU1569
+	.uleb128 .LVU1570
+	.uleb128 .LVU1574
+	.uleb128 .LVU1576
+	.uleb128 .LVU1576
+	.uleb128 .LVU1581
+	.uleb128 .LVU1581
+	.uleb128 .LVU1582
+.LLST193:
+	.byte	0x4
+	.uleb128 .LVL752-.Ltext0
+	.uleb128 .LVL753-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL754-.Ltext0
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU1591
+	.uleb128 .LVU1594
+	.uleb128 .LVU1600
+	.uleb128 .LVU1601
+	.uleb128 .LVU1601
+	.uleb128 .LVU1657
+	.uleb128 .LVU1690
+	.uleb128 0
+.LLST195:
+	.byte	0x4
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 .LVL791-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL813-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU1601
+	.uleb128 .LVU1610
+	.uleb128 .LVU1611
+	.uleb128 .LVU1653
+	.uleb128 .LVU1680
+	.uleb128 .LVU1687
+	.uleb128 .LVU1690
+	.uleb128 .LVU1694
+	.uleb128 .LVU1694
+	.uleb128 0
+.LLST197:
+	.byte	0x4
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 .LVL771-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL772-.Ltext0
+	.uleb128 .LVL791-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL805-.Ltext0
+	.uleb128 .LVL810-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL813-.Ltext0
+	.uleb128 .LVL818-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL818-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU1601
+	.uleb128 .LVU1607
+	.uleb128 .LVU1607
+	.uleb128 .LVU1611
+	.uleb128 .LVU1618
+	.uleb128 .LVU1619
+	.uleb128 .LVU1619
+	.uleb128 .LVU1633
+	.uleb128 .LVU1633
+	.uleb128 .LVU1637
+	.uleb128 .LVU1637
+	.uleb128 .LVU1662
+	.uleb128 .LVU1687
+	.uleb128 .LVU1690
+.LLST199:
+	.byte	0x4
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 .LVL769-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL769-.Ltext0
+	.uleb128 .LVL772-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -3816
+	.byte	0x4
+	.uleb128 .LVL777-.Ltext0
+	.uleb128 .LVL778-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL778-1-.Ltext0
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 .LVL785-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL785-.Ltext0
+	.uleb128 .LVL794-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -3816
+	.byte	0x4
+	.uleb128 .LVL810-.Ltext0
+	.uleb128 .LVL813-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -3816
+	.byte	0
+.LVUS200:
+	.uleb128 .LVU1635
+	.uleb128 .LVU1637
+	.uleb128 .LVU1637
+	.uleb128 .LVU1641
+	.uleb128 .LVU1641
+	.uleb128 .LVU1642
+	.uleb128 .LVU1642
+	.uleb128 .LVU1643
+.LLST200:
+	.byte	0x4
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 .LVL785-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL785-.Ltext0
+	.uleb128 .LVL786-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x848
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL786-.Ltext0
+	.uleb128 .LVL787-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x848
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL787-.Ltext0
+	.uleb128 .LVL788-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x840
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU1665
+	.uleb128 .LVU1666
+	.uleb128 .LVU1666
+	.uleb128 .LVU1668
+	.uleb128 .LVU1668
+	.uleb128 .LVU1669
+	.uleb128 .LVU1669
+	.uleb128 .LVU1674
+.LLST201:
+	.byte	0x4
+	.uleb128 .LVL795-.Ltext0
+	.uleb128 .LVL796-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL796-.Ltext0
+	.uleb128 .LVL797-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x850
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL797-.Ltext0
+	.uleb128 .LVL798-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x850
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL798-.Ltext0
+	.uleb128 .LVL801-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x848
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 0
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU513
+	.uleb128 .LVU513
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 0
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU514
+	.uleb128 .LVU514
+	.uleb128 0
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 0
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU512
+	.uleb128 .LVU512
+	.uleb128 0
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU497
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU511
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS202:
+	.uleb128 0
+	.uleb128 .LVU1701
+	.uleb128 .LVU1701
+	.uleb128 .LVU1742
+	.uleb128 .LVU1742
+	.uleb128 .LVU1745
+	.uleb128 .LVU1745
+	.uleb128 0
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL819-.Ltext0
+	.uleb128 .LVL820-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL820-.Ltext0
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -852
+	.byte	0x4
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 .LVL839-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL839-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -852
+	.byte	0
+.LVUS203:
+	.uleb128 0
+	.uleb128 .LVU1701
+	.uleb128 .LVU1701
+	.uleb128 .LVU1738
+	.uleb128 .LVU1738
+	.uleb128 .LVU1742
+	.uleb128 .LVU1742
+	.uleb128 .LVU1744
+	.uleb128 .LVU1744
+	.uleb128 .LVU1761
+	.uleb128 .LVU1761
+	.uleb128 .LVU1763
+	.uleb128 .LVU1763
+	.uleb128 .LVU1766
+	.uleb128 .LVU1766
+	.uleb128 .LVU1802
+	.uleb128 .LVU1802
+	.uleb128 .LVU1804
+	.uleb128 .LVU1804
+	.uleb128 0
+.LLST203:
+	.byte	0x4
+	.uleb128 .LVL819-.Ltext0
+	.uleb128 .LVL820-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL820-.Ltext0
+	.uleb128 .LVL836-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL836-.Ltext0
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 .LVL838-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL838-.Ltext0
+	.uleb128 .LVL851-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL851-.Ltext0
+	.uleb128 .LVL852-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL852-.Ltext0
+	.uleb128 .LVL855-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL855-.Ltext0
+	.uleb128 .LVL871-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL871-.Ltext0
+	.uleb128 .LVL872-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL872-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU1736
+	.uleb128 .LVU1742
+	.uleb128 .LVU1766
+	.uleb128 .LVU1769
+	.uleb128 .LVU1770
+	.uleb128 .LVU1771
+	.uleb128 .LVU1771
+	.uleb128 .LVU1793
+	.uleb128 .LVU1793
+	.uleb128 .LVU1796
+	.uleb128 .LVU1797
+	.uleb128 .LVU1798
+	.uleb128 .LVU1799
+	.uleb128 .LVU1800
+	.uleb128 .LVU1800
+	.uleb128 .LVU1802
+	.uleb128 .LVU1802
+	.uleb128 0
+.LLST204:
+	.byte	0x4
+	.uleb128 .LVL835-.Ltext0
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL855-.Ltext0
+	.uleb128 .LVL856-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL856-.Ltext0
+	.uleb128 .LVL857-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL857-.Ltext0
+	.uleb128 .LVL864-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL864-.Ltext0
+	.uleb128 .LVL866-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL867-.Ltext0
+	.uleb128 .LVL868-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL869-.Ltext0
+	.uleb128 .LVL870-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL870-1-.Ltext0
+	.uleb128 .LVL871-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL871-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU1701
+	.uleb128 .LVU1721
+	.uleb128 .LVU1721
+	.uleb128 .LVU1722
+	.uleb128 .LVU1748
+	.uleb128 .LVU1761
+.LLST206:
+	.byte	0x4
+	.uleb128 .LVL820-.Ltext0
+	.uleb128 .LVL828-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL828-.Ltext0
+	.uleb128 .LVL829-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL841-.Ltext0
+	.uleb128 .LVL851-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS208:
+	.uleb128 .LVU1703
+	.uleb128 .LVU1718
+	.uleb128 .LVU1718
+	.uleb128 .LVU1722
+	.uleb128 .LVU1722
+	.uleb128 .LVU1728
+	.uleb128 .LVU1748
+	.uleb128 .LVU1749
+	.uleb128 .LVU1752
+	.uleb128 .LVU1753
+	.uleb128 .LVU1756
+	.uleb128 .LVU1758
+	.uleb128 .LVU1763
+	.uleb128 .LVU1764
+.LLST208:
+	.byte	0x4
+	.uleb128 .LVL821-.Ltext0
+	.uleb128 .LVL827-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL827-.Ltext0
+	.uleb128 .LVL829-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x144
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL829-.Ltext0
+	.uleb128 .LVL830-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x32
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x144
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL841-.Ltext0
+	.uleb128 .LVL842-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL844-.Ltext0
+	.uleb128 .LVL845-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL847-.Ltext0
+	.uleb128 .LVL849-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL852-.Ltext0
+	.uleb128 .LVL853-1-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x32
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x144
+	.byte	0x1c
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU1707
+	.uleb128 .LVU1708
+	.uleb128 .LVU1708
+	.uleb128 .LVU1711
+	.uleb128 .LVU1711
+	.uleb128 .LVU1712
+	.uleb128 .LVU1712
+	.uleb128 .LVU1713
+	.uleb128 .LVU1756
+	.uleb128 .LVU1757
+.LLST210:
+	.byte	0x4
+	.uleb128 .LVL822-.Ltext0
+	.uleb128 .LVL823-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL823-.Ltext0
+	.uleb128 .LVL824-.Ltext0
+	.uleb128 0xd
+	.byte	0x71
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x140
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL824-.Ltext0
+	.uleb128 .LVL825-.Ltext0
+	.uleb128 0xd
+	.byte	0x71
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x140
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL825-.Ltext0
+	.uleb128 .LVL826-.Ltext0
+	.uleb128 0xd
+	.byte	0x71
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x13c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL847-.Ltext0
+	.uleb128 .LVL848-.Ltext0
+	.uleb128 0xd
+	.byte	0x71
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x140
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU1766
+	.uleb128 .LVU1780
+	.uleb128 .LVU1780
+	.uleb128 .LVU1781
+	.uleb128 .LVU1781
+	.uleb128 .LVU1782
+	.uleb128 .LVU1782
+	.uleb128 .LVU1790
+	.uleb128 .LVU1790
+	.uleb128 .LVU1796
+	.uleb128 .LVU1797
+	.uleb128 .LVU1802
+.LLST212:
+	.byte	0x4
+	.uleb128 .LVL855-.Ltext0
+	.uleb128 .LVL859-.Ltext0
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x140
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL859-.Ltext0
+	.uleb128 .LVL860-.Ltext0
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x140
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL860-.Ltext0
+	.uleb128 .LVL861-.Ltext0
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x13c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL861-.Ltext0
+	.uleb128 .LVL863-.Ltext0
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x140
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL863-.Ltext0
+	.uleb128 .LVL866-.Ltext0
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x13c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL867-.Ltext0
+	.uleb128 .LVL871-.Ltext0
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x13c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0
+.LVUS214:
+	.uleb128 .LVU1766
+	.uleb128 .LVU1774
+	.uleb128 .LVU1784
+	.uleb128 .LVU1790
+.LLST214:
+	.byte	0x4
+	.uleb128 .LVL855-.Ltext0
+	.uleb128 .LVL858-.Ltext0
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x35
+	.byte	0x24
+	.byte	0x3
+	.quad	queues
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL862-.Ltext0
+	.uleb128 .LVL863-.Ltext0
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x35
+	.byte	0x24
+	.byte	0x3
+	.quad	queues
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS174:
+	.uleb128 0
+	.uleb128 .LVU1317
+	.uleb128 .LVU1317
+	.uleb128 .LVU1323
+	.uleb128 .LVU1323
+	.uleb128 .LVU1336
+	.uleb128 .LVU1336
+	.uleb128 .LVU1338
+	.uleb128 .LVU1338
+	.uleb128 0
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS175:
+	.uleb128 0
+	.uleb128 .LVU1318
+	.uleb128 .LVU1318
+	.uleb128 .LVU1324
+	.uleb128 .LVU1324
+	.uleb128 .LVU1325
+	.uleb128 .LVU1325
+	.uleb128 .LVU1340
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL639-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL639-1-.Ltext0
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU1312
+	.uleb128 .LVU1333
+	.uleb128 .LVU1333
+	.uleb128 .LVU1336
+	.uleb128 .LVU1336
+	.uleb128 .LVU1338
+	.uleb128 .LVU1338
+	.uleb128 .LVU1340
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU1323
+	.uleb128 .LVU1329
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 .LVL643-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU218
+	.uleb128 .LVU218
+	.uleb128 .LVU236
+	.uleb128 .LVU236
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU218
+	.uleb128 .LVU218
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU216
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU235
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU225
+	.uleb128 .LVU234
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS163:
+	.uleb128 0
+	.uleb128 .LVU1179
+	.uleb128 .LVU1179
+	.uleb128 .LVU1220
+	.uleb128 .LVU1220
+	.uleb128 .LVU1222
+	.uleb128 .LVU1222
+	.uleb128 0
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LVL580-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL580-.Ltext0
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS164:
+	.uleb128 0
+	.uleb128 .LVU1180
+	.uleb128 .LVU1180
+	.uleb128 .LVU1220
+	.uleb128 .LVU1220
+	.uleb128 .LVU1221
+	.uleb128 .LVU1221
+	.uleb128 0
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 .LVL566-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL566-1-.Ltext0
+	.uleb128 .LVL580-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL580-.Ltext0
+	.uleb128 .LVL581-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL581-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU1181
+	.uleb128 .LVU1188
+	.uleb128 .LVU1188
+	.uleb128 .LVU1208
+	.uleb128 .LVU1225
+	.uleb128 .LVU1226
+	.uleb128 .LVU1226
+	.uleb128 .LVU1229
+	.uleb128 .LVU1229
+	.uleb128 .LVU1230
+	.uleb128 .LVU1230
+	.uleb128 .LVU1233
+	.uleb128 .LVU1233
+	.uleb128 .LVU1234
+	.uleb128 .LVU1234
+	.uleb128 0
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL567-.Ltext0
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 .LVL575-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL584-.Ltext0
+	.uleb128 .LVL585-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL585-.Ltext0
+	.uleb128 .LVL587-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL587-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 .LVL590-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL590-.Ltext0
+	.uleb128 .LVL591-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL591-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU1186
+	.uleb128 .LVU1188
+	.uleb128 .LVU1188
+	.uleb128 .LVU1208
+	.uleb128 .LVU1233
+	.uleb128 .LVU1234
+	.uleb128 .LVU1234
+	.uleb128 0
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL568-.Ltext0
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x35
+	.byte	0x24
+	.byte	0x3
+	.quad	queues
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 .LVL575-.Ltext0
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x35
+	.byte	0x24
+	.byte	0x3
+	.quad	queues
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL590-.Ltext0
+	.uleb128 .LVL591-.Ltext0
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x35
+	.byte	0x24
+	.byte	0x3
+	.quad	queues
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL591-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x35
+	.byte	0x24
+	.byte	0x3
+	.quad	queues
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU1199
+	.uleb128 .LVU1211
+	.uleb128 .LVU1211
+	.uleb128 .LVU1218
+	.uleb128 .LVU1237
+	.uleb128 0
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL574-.Ltext0
+	.uleb128 .LVL576-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL576-.Ltext0
+	.uleb128 .LVL578-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL595-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU19
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS219:
+	.uleb128 0
+	.uleb128 .LVU1861
+	.uleb128 .LVU1861
+	.uleb128 .LVU1865
+	.uleb128 .LVU1865
+	.uleb128 .LVU1867
+	.uleb128 .LVU1867
+	.uleb128 0
+.LLST219:
+	.byte	0x4
+	.uleb128 .LVL892-.Ltext0
+	.uleb128 .LVL894-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL894-.Ltext0
+	.uleb128 .LVL896-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL896-.Ltext0
+	.uleb128 .LVL897-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL897-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS220:
+	.uleb128 0
+	.uleb128 .LVU1860
+	.uleb128 .LVU1860
+	.uleb128 .LVU1865
+	.uleb128 .LVU1865
+	.uleb128 .LVU1868
+	.uleb128 .LVU1868
+	.uleb128 0
+.LLST220:
+	.byte	0x4
+	.uleb128 .LVL892-.Ltext0
+	.uleb128 .LVL893-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL893-.Ltext0
+	.uleb128 .LVL896-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL896-.Ltext0
+	.uleb128 .LVL898-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL898-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS221:
+	.uleb128 0
+	.uleb128 .LVU1883
+	.uleb128 .LVU1883
+	.uleb128 .LVU1906
+	.uleb128 .LVU1906
+	.uleb128 .LVU1909
+	.uleb128 .LVU1909
+	.uleb128 .LVU1910
+	.uleb128 .LVU1910
+	.uleb128 .LVU1912
+	.uleb128 .LVU1912
+	.uleb128 .LVU1913
+	.uleb128 .LVU1913
+	.uleb128 .LVU1916
+	.uleb128 .LVU1916
+	.uleb128 .LVU1917
+	.uleb128 .LVU1917
+	.uleb128 .LVU1919
+	.uleb128 .LVU1919
+	.uleb128 0
+.LLST221:
+	.byte	0x4
+	.uleb128 .LVL901-.Ltext0
+	.uleb128 .LVL902-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL902-.Ltext0
+	.uleb128 .LVL908-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL908-.Ltext0
+	.uleb128 .LVL909-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL909-1-.Ltext0
+	.uleb128 .LVL910-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL910-.Ltext0
+	.uleb128 .LVL912-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL912-.Ltext0
+	.uleb128 .LVL913-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL913-.Ltext0
+	.uleb128 .LVL915-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL915-.Ltext0
+	.uleb128 .LVL916-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL916-.Ltext0
+	.uleb128 .LVL918-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL918-1-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS222:
+	.uleb128 0
+	.uleb128 .LVU1883
+	.uleb128 .LVU1883
+	.uleb128 .LVU1906
+	.uleb128 .LVU1906
+	.uleb128 .LVU1909
+	.uleb128 .LVU1909
+	.uleb128 .LVU1910
+	.uleb128 .LVU1910
+	.uleb128 .LVU1911
+	.uleb128 .LVU1911
+	.uleb128 .LVU1916
+	.uleb128 .LVU1916
+	.uleb128 .LVU1918
+	.uleb128 .LVU1918
+	.uleb128 0
+.LLST222:
+	.byte	0x4
+	.uleb128 .LVL901-.Ltext0
+	.uleb128 .LVL902-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL902-.Ltext0
+	.uleb128 .LVL908-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL908-.Ltext0
+	.uleb128 .LVL909-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL909-1-.Ltext0
+	.uleb128 .LVL910-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL910-.Ltext0
+	.uleb128 .LVL911-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL911-.Ltext0
+	.uleb128 .LVL915-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL915-.Ltext0
+	.uleb128 .LVL917-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL917-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS223:
+	.uleb128 .LVU1884
+	.uleb128 .LVU1906
+	.uleb128 .LVU1921
+	.uleb128 .LVU1929
+	.uleb128 .LVU1934
+	.uleb128 .LVU1941
+	.uleb128 .LVU1941
+	.uleb128 0
+.LLST223:
+	.byte	0x4
+	.uleb128 .LVL902-.Ltext0
+	.uleb128 .LVL908-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL919-.Ltext0
+	.uleb128 .LVL926-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL928-.Ltext0
+	.uleb128 .LVL932-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL932-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU1935
+	.uleb128 .LVU1938
+	.uleb128 .LVU1938
+	.uleb128 .LVU1939
+.LLST224:
+	.byte	0x4
+	.uleb128 .LVL929-.Ltext0
+	.uleb128 .LVL930-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL930-.Ltext0
+	.uleb128 .LVL931-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS226:
+	.uleb128 .LVU1903
+	.uleb128 .LVU1906
+	.uleb128 .LVU1924
+	.uleb128 .LVU1929
+.LLST226:
+	.byte	0x4
+	.uleb128 .LVL907-.Ltext0
+	.uleb128 .LVL908-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL923-.Ltext0
+	.uleb128 .LVL926-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU35
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS227:
+	.uleb128 0
+	.uleb128 .LVU1950
+	.uleb128 .LVU1950
+	.uleb128 .LVU1956
+	.uleb128 .LVU1956
+	.uleb128 .LVU1970
+	.uleb128 .LVU1970
+	.uleb128 .LVU1972
+	.uleb128 .LVU1972
+	.uleb128 .LVU1973
+	.uleb128 .LVU1973
+	.uleb128 .LVU1976
+	.uleb128 .LVU1976
+	.uleb128 .LVU1979
+	.uleb128 .LVU1979
+	.uleb128 .LVU1982
+	.uleb128 .LVU1982
+	.uleb128 .LVU1985
+	.uleb128 .LVU1985
+	.uleb128 0
+.LLST227:
+	.byte	0x4
+	.uleb128 .LVL933-.Ltext0
+	.uleb128 .LVL934-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL934-.Ltext0
+	.uleb128 .LVL937-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL937-.Ltext0
+	.uleb128 .LVL945-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL945-.Ltext0
+	.uleb128 .LVL947-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL947-.Ltext0
+	.uleb128 .LVL948-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL948-.Ltext0
+	.uleb128 .LVL950-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL950-.Ltext0
+	.uleb128 .LVL953-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL953-.Ltext0
+	.uleb128 .LVL955-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL955-.Ltext0
+	.uleb128 .LVL958-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL958-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS228:
+	.uleb128 0
+	.uleb128 .LVU1950
+	.uleb128 .LVU1950
+	.uleb128 .LVU1969
+	.uleb128 .LVU1969
+	.uleb128 .LVU1970
+	.uleb128 .LVU1970
+	.uleb128 .LVU1971
+	.uleb128 .LVU1971
+	.uleb128 .LVU1976
+	.uleb128 .LVU1976
+	.uleb128 .LVU1977
+	.uleb128 .LVU1977
+	.uleb128 0
+.LLST228:
+	.byte	0x4
+	.uleb128 .LVL933-.Ltext0
+	.uleb128 .LVL934-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL934-.Ltext0
+	.uleb128 .LVL944-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL944-.Ltext0
+	.uleb128 .LVL945-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL945-.Ltext0
+	.uleb128 .LVL946-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL946-.Ltext0
+	.uleb128 .LVL950-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL950-.Ltext0
+	.uleb128 .LVL951-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL951-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS229:
+	.uleb128 .LVU1951
+	.uleb128 .LVU1956
+	.uleb128 .LVU1956
+	.uleb128 .LVU1957
+	.uleb128 .LVU1957
+	.uleb128 .LVU1961
+	.uleb128 .LVU1982
+	.uleb128 .LVU1991
+.LLST229:
+	.byte	0x4
+	.uleb128 .LVL934-.Ltext0
+	.uleb128 .LVL937-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL937-.Ltext0
+	.uleb128 .LVL938-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL938-.Ltext0
+	.uleb128 .LVL941-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL955-.Ltext0
+	.uleb128 .LVL960-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS215:
+	.uleb128 0
+	.uleb128 .LVU1810
+	.uleb128 .LVU1810
+	.uleb128 .LVU1845
+	.uleb128 .LVU1845
+	.uleb128 .LVU1846
+	.uleb128 .LVU1846
+	.uleb128 0
+.LLST215:
+	.byte	0x4
+	.uleb128 .LVL874-.Ltext0
+	.uleb128 .LVL875-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL875-1-.Ltext0
+	.uleb128 .LVL886-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL886-.Ltext0
+	.uleb128 .LVL887-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL887-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS216:
+	.uleb128 0
+	.uleb128 .LVU1810
+	.uleb128 .LVU1810
+	.uleb128 0
+.LLST216:
+	.byte	0x4
+	.uleb128 .LVL874-.Ltext0
+	.uleb128 .LVL875-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL875-1-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS217:
+	.uleb128 .LVU1811
+	.uleb128 .LVU1813
+	.uleb128 .LVU1813
+	.uleb128 .LVU1822
+	.uleb128 .LVU1825
+	.uleb128 .LVU1839
+	.uleb128 .LVU1839
+	.uleb128 .LVU1844
+	.uleb128 .LVU1846
+	.uleb128 .LVU1852
+.LLST217:
+	.byte	0x4
+	.uleb128 .LVL876-.Ltext0
+	.uleb128 .LVL877-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL877-.Ltext0
+	.uleb128 .LVL879-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL880-.Ltext0
+	.uleb128 .LVL884-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL884-.Ltext0
+	.uleb128 .LVL885-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	current
+	.byte	0x4
+	.uleb128 .LVL887-.Ltext0
+	.uleb128 .LVL890-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU1833
+	.uleb128 .LVU1839
+	.uleb128 .LVU1839
+	.uleb128 .LVU1844
+.LLST218:
+	.byte	0x4
+	.uleb128 .LVL882-.Ltext0
+	.uleb128 .LVL884-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL884-.Ltext0
+	.uleb128 .LVL885-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	current
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU171
+	.uleb128 .LVU172
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0
+.LLRL37:
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0
+.LLRL47:
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0
+.LLRL58:
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0
+.LLRL68:
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL76:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0
+.LLRL80:
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0
+.LLRL90:
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0
+.LLRL92:
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL105:
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0
+.LLRL116:
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0
+.LLRL118:
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0
+.LLRL120:
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0
+.LLRL133:
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0
+.LLRL136:
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0
+.LLRL149:
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0
+.LLRL151:
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0
+.LLRL154:
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0
+.LLRL172:
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB128-.Ltext0
+	.uleb128 .LBE128-.Ltext0
+	.byte	0
+.LLRL185:
+	.byte	0x4
+	.uleb128 .LBB130-.Ltext0
+	.uleb128 .LBE130-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB131-.Ltext0
+	.uleb128 .LBE131-.Ltext0
+	.byte	0
+.LLRL192:
+	.byte	0x4
+	.uleb128 .LBB133-.Ltext0
+	.uleb128 .LBE133-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB134-.Ltext0
+	.uleb128 .LBE134-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0
+.LLRL194:
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB146-.Ltext0
+	.uleb128 .LBE146-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0
+.LLRL196:
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0
+.LLRL198:
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0
+.LLRL205:
+	.byte	0x4
+	.uleb128 .LBB149-.Ltext0
+	.uleb128 .LBE149-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB155-.Ltext0
+	.uleb128 .LBE155-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0
+.LLRL207:
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB154-.Ltext0
+	.uleb128 .LBE154-.Ltext0
+	.byte	0
+.LLRL209:
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0
+.LLRL211:
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB161-.Ltext0
+	.uleb128 .LBE161-.Ltext0
+	.byte	0
+.LLRL213:
+	.byte	0x4
+	.uleb128 .LBB157-.Ltext0
+	.uleb128 .LBE157-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0
+.LLRL225:
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0
+.LLRL240:
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB191-.Ltext0
+	.uleb128 .LBE191-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB192-.Ltext0
+	.uleb128 .LBE192-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB193-.Ltext0
+	.uleb128 .LBE193-.Ltext0
+	.byte	0
+.LLRL241:
+	.byte	0x4
+	.uleb128 .LBB186-.Ltext0
+	.uleb128 .LBE186-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB187-.Ltext0
+	.uleb128 .LBE187-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF106:
+	.string	"__glibc_reserved"
+.LASF272:
+	.string	"level"
+.LASF169:
+	.string	"string_length"
+.LASF105:
+	.string	"st_ctim"
+.LASF200:
+	.string	"hist_percentile"
+.LASF34:
+	.string	"size_t"
+.LASF210:
+	.string	"cplx_fit"
+.LASF292:
+	.string	"start"
+.LASF141:
+	.string	"CPLX_NLOGN"
+.LASF43:
+	.string	"__sd"
+.LASF175:
+	.string	"lat_size"
+.LASF101:
+	.string	"st_blksize"
+.LASF45:
+	.string	"__sp"
+.LASF102:
+	.string	"st_blocks"
+.LASF44:
+	.string	"__ss"
+.LASF113:
+	.string	"tail"
+.LASF86:
+	.string	"_IO_codecvt"
+.LASF338:
+	.string	"fill_rand_string"
+.LASF134:
+	.string	"max_t"
+.LASF341:
+	.string	"do_queues"
+.LASF65:
+	.string	"_IO_save_end"
+.LASF224:
+	.string	"set_fail_seed"
+.LASF356:
+	.string	"cycles"
+.LASF329:
+	.string	"record_const"
+.LASF15:
+	.string	"__gid_t"
+.LASF180:
+	.string	"reps"
+.LASF125:
+	.string	"linear"
+.LASF184:
+	.string	"cplx_ops"
+.LASF104:
+	.string	"st_mtim"
+.LASF29:
+	.string	"time_t"
+.LASF176:
+	.string	"lat_count"
+.LASF27:
+	.string	"sigset_t"
+.LASF118:
+	.string	"test_insert_head"
+.LASF288:
+	.string	"sizes"
+.LASF123:
+	.string	"test_count"
+.LASF312:
+	.string	"before"
+.LASF74:
+	.string	"_lock"
+.LASF318:
+	.string	"checks"
+.LASF360:
+	.string	"puts"
+.LASF295:
+	.string	"cplx_reverse"
+.LASF294:
+	.string	"cplx_sort"
+.LASF165:
+	.string	"queue_slots"
+.LASF212:
+	.string	"time_ns"
+.LASF91:
+	.string	"stat"
+.LASF63:
+	.string	"_IO_save_base"
+.LASF280:
+	.string	"sigalrmhandler"
+.LASF337:
+	.string	"check_sorted"
+.LASF357:
+	.string	"atoi"
+.LASF67:
+	.string	"_chain"
+.LASF84:
+	.string	"__spawn_action"
+.LASF229:
+	.string	"waitpid"
+.LASF71:
+	.string	"_cur_column"
+.LASF239:
+	.string	"quarantine_flush"
+.LASF254:
+	.string	"set_verblevel"
+.LASF191:
+	.string	"strcasecmp"
+.LASF13:
+	.string	"__dev_t"
+.LASF117:
+	.string	"test_size"
+.LASF302:
+	.string	"cplx_size"
+.LASF253:
+	.string	"set_echo"
+.LASF283:
+	.string	"oldval"
+.LASF153:
+	.string	"fail_probability"
+.LASF193:
+	.string	"hist_record"
+.LASF159:
+	.string	"setter_function"
+.LASF264:
+	.string	"logfile_name"
+.LASF219:
+	.string	"abort"
+.LASF156:
+	.string	"quarantine_max_kb"
+.LASF152:
+	.string	"histogram_t"
+.LASF358:
+	.string	"__nptr"
+.LASF10:
+	.string	"long int"
+.LASF249:
+	.string	"set_metrics_helper"
+.LASF202:
+	.string	"q_size"
+.LASF133:
+	.string	"test"
+.LASF85:
+	.string	"_IO_marker"
+.LASF365:
+	.string	"main"
+.LASF235:
+	.string	"report_leaks"
+.LASF209:
+	.string	"rand"
+.LASF332:
+	.string	"pair_ns"
+.LASF111:
+	.string	"list_ele_t"
+.LASF146:
+	.string	"error"
+.LASF112:
+	.string	"head"
+.LASF276:
+	.string	"bcnt"
+.LASF170:
+	.string	"seed"
+.LASF8:
+	.string	"signed char"
+.LASF23:
+	.string	"__blksize_t"
+.LASF53:
+	.string	"_IO_FILE"
+.LASF87:
+	.string	"_IO_wide_data"
+.LASF96:
+	.string	"st_uid"
+.LASF127:
+	.string	"call"
+.LASF174:
+	.string	"lat_insert_tail"
+.LASF218:
+	.string	"add_cmd"
+.LASF320:
+	.string	"do_insert_tail"
+.LASF274:
+	.string	"environ"
+.LASF5:
+	.string	"unsigned char"
+.LASF215:
+	.string	"get_int"
+.LASF78:
+	.string	"_freeres_list"
+.LASF99:
+	.string	"st_rdev"
+.LASF234:
+	.string	"fclose"
+.LASF222:
+	.string	"report_signal_enter"
+.LASF247:
+	.string	"compile_file"
+.LASF270:
+	.string	"jbuf"
+.LASF304:
+	.string	"do_leaks"
+.LASF25:
+	.string	"__syscall_slong_t"
+.LASF130:
+	.string	"_Bool"
+.LASF263:
+	.string	"lbuf"
+.LASF109:
+	.string	"value"
+.LASF287:
+	.string	"trials"
+.LASF315:
+	.string	"rval"
+.LASF4:
+	.string	"char"
+.LASF187:
+	.string	"memset"
+.LASF258:
+	.string	"strncpy"
+.LASF250:
+	.string	"set_metrics_file"
+.LASF42:
+	.string	"__pgrp"
+.LASF364:
+	.string	"_IO_lock_t"
+.LASF223:
+	.string	"signal"
+.LASF39:
+	.string	"sched_priority"
+.LASF289:
+	.string	"times"
+.LASF354:
+	.string	"console_init"
+.LASF17:
+	.string	"__mode_t"
+.LASF55:
+	.string	"_IO_read_ptr"
+.LASF355:
+	.string	"record_latency"
+.LASF216:
+	.string	"strcmp"
+.LASF195:
+	.string	"metric_bool"
+.LASF160:
+	.string	"metrics_function"
+.LASF66:
+	.string	"_markers"
+.LASF346:
+	.string	"file"
+.LASF290:
+	.string	"samples"
+.LASF161:
+	.string	"verblevel"
+.LASF314:
+	.string	"do_remove_head_quiet"
+.LASF268:
+	.string	"bbuf"
+.LASF257:
+	.string	"printf"
+.LASF240:
+	.string	"exception_cancel"
+.LASF351:
+	.string	"find_queue"
+.LASF126:
+	.string	"setup"
+.LASF299:
+	.string	"cplx_remove_head"
+.LASF178:
+	.string	"latency"
+.LASF136:
+	.string	"rate"
+.LASF177:
+	.string	"lat_names"
+.LASF308:
+	.string	"show_queue"
+.LASF41:
+	.string	"__flags"
+.LASF75:
+	.string	"_offset"
+.LASF335:
+	.string	"do_merge"
+.LASF296:
+	.string	"cplx_transfer_back"
+.LASF366:
+	.string	"save_queue"
+.LASF97:
+	.string	"st_gid"
+.LASF307:
+	.string	"do_show"
+.LASF298:
+	.string	"cplx_splice"
+.LASF361:
+	.string	"__builtin_fwrite"
+.LASF183:
+	.string	"cplx_side"
+.LASF12:
+	.string	"__uint64_t"
+.LASF340:
+	.string	"do_splice"
+.LASF350:
+	.string	"create"
+.LASF2:
+	.string	"long unsigned int"
+.LASF251:
+	.string	"set_logfile"
+.LASF322:
+	.string	"inserts"
+.LASF339:
+	.string	"buf_size"
+.LASF319:
+	.string	"check"
+.LASF185:
+	.string	"strcpy"
+.LASF255:
+	.string	"init_cmd"
+.LASF69:
+	.string	"_flags2"
+.LASF100:
+	.string	"st_size"
+.LASF57:
+	.string	"_IO_read_base"
+.LASF192:
+	.string	"set_noallocate_mode"
+.LASF197:
+	.string	"check_op"
+.LASF131:
+	.string	"dut_op_t"
+.LASF173:
+	.string	"lat_insert_head"
+.LASF82:
+	.string	"_unused2"
+.LASF163:
+	.string	"queue_slot_t"
+.LASF204:
+	.string	"q_insert_tail"
+.LASF149:
+	.string	"cplx_fit_t"
+.LASF300:
+	.string	"cplx_insert_tail"
+.LASF46:
+	.string	"__policy"
+.LASF172:
+	.string	"metrics_alloc_start"
+.LASF179:
+	.string	"charset"
+.LASF260:
+	.string	"argc"
+.LASF342:
+	.string	"do_use"
+.LASF70:
+	.string	"_old_offset"
+.LASF243:
+	.string	"set_cautious_mode"
+.LASF305:
+	.string	"do_failat"
+.LASF261:
+	.string	"argv"
+.LASF24:
+	.string	"__blkcnt_t"
+.LASF188:
+	.string	"q_merge_k"
+.LASF244:
+	.string	"finish_cmd"
+.LASF135:
+	.string	"measurements"
+.LASF16:
+	.string	"__ino_t"
+.LASF325:
+	.string	"simulate"
+.LASF242:
+	.string	"exception_setup"
+.LASF256:
+	.string	"getopt"
+.LASF303:
+	.string	"do_latency"
+.LASF35:
+	.string	"long long int"
+.LASF282:
+	.string	"set_seed"
+.LASF121:
+	.string	"test_free_queue"
+.LASF119:
+	.string	"test_remove_head"
+.LASF343:
+	.string	"do_free"
+.LASF3:
+	.string	"double"
+.LASF367:
+	.string	"cpucycles"
+.LASF353:
+	.string	"queue_init"
+.LASF60:
+	.string	"_IO_write_end"
+.LASF248:
+	.string	"add_quit_helper"
+.LASF362:
+	.string	"__builtin_puts"
+.LASF151:
+	.string	"buckets"
+.LASF198:
+	.string	"report_noreturn"
+.LASF150:
+	.string	"count"
+.LASF330:
+	.string	"do_mergebench"
+.LASF281:
+	.string	"sigsegvhandler"
+.LASF51:
+	.string	"__actions"
+.LASF61:
+	.string	"_IO_buf_base"
+.LASF269:
+	.string	"bytecode_name"
+.LASF7:
+	.string	"unsigned int"
+.LASF205:
+	.string	"q_splice"
+.LASF228:
+	.string	"perror"
+.LASF246:
+	.string	"run_bytecode"
+.LASF143:
+	.string	"cplx_model_t"
+.LASF98:
+	.string	"__pad0"
+.LASF80:
+	.string	"__pad5"
+.LASF28:
+	.string	"pid_t"
+.LASF138:
+	.string	"CPLX_1"
+.LASF116:
+	.string	"test_insert_tail"
+.LASF214:
+	.string	"q_new"
+.LASF317:
+	.string	"removes"
+.LASF182:
+	.string	"cplx_buf"
+.LASF58:
+	.string	"_IO_write_base"
+.LASF48:
+	.string	"posix_spawnattr_t"
+.LASF140:
+	.string	"CPLX_N"
+.LASF166:
+	.string	"current"
+.LASF347:
+	.string	"do_new"
+.LASF54:
+	.string	"_flags"
+.LASF137:
+	.string	"const_result_t"
+.LASF306:
+	.string	"list"
+.LASF38:
+	.string	"sched_param"
+.LASF148:
+	.string	"confidence"
+.LASF81:
+	.string	"_mode"
+.LASF217:
+	.string	"add_param"
+.LASF76:
+	.string	"_codecvt"
+.LASF94:
+	.string	"st_nlink"
+.LASF168:
+	.string	"fail_count"
+.LASF52:
+	.string	"posix_spawn_file_actions_t"
+.LASF110:
+	.string	"next"
+.LASF181:
+	.string	"cplx_op_t"
+.LASF47:
+	.string	"__pad"
+.LASF278:
+	.string	"queue_metrics"
+.LASF108:
+	.string	"long double"
+.LASF316:
+	.string	"do_remove_head"
+.LASF83:
+	.string	"FILE"
+.LASF21:
+	.string	"__pid_t"
+.LASF93:
+	.string	"st_ino"
+.LASF92:
+	.string	"st_dev"
+.LASF297:
+	.string	"cplx_transfer"
+.LASF211:
+	.string	"cplx_median"
+.LASF37:
+	.string	"timespec"
+.LASF236:
+	.string	"fopen"
+.LASF142:
+	.string	"CPLX_COUNT"
+.LASF352:
+	.string	"select_queue"
+.LASF203:
+	.string	"q_remove_head"
+.LASF333:
+	.string	"pair"
+.LASF114:
+	.string	"size"
+.LASF36:
+	.string	"long long unsigned int"
+.LASF206:
+	.string	"q_reverse"
+.LASF328:
+	.string	"sanity_check"
+.LASF19:
+	.string	"__off_t"
+.LASF323:
+	.string	"do_insert_head"
+.LASF267:
+	.string	"compile_name"
+.LASF241:
+	.string	"q_free"
+.LASF79:
+	.string	"_freeres_buf"
+.LASF120:
+	.string	"test_remove_head_quiet"
+.LASF309:
+	.string	"vlevel"
+.LASF164:
+	.string	"queues"
+.LASF22:
+	.string	"__time_t"
+.LASF252:
+	.string	"report"
+.LASF128:
+	.string	"teardown"
+.LASF167:
+	.string	"fail_limit"
+.LASF265:
+	.string	"kbuf"
+.LASF139:
+	.string	"CPLX_LOGN"
+.LASF201:
+	.string	"hist_init"
+.LASF273:
+	.string	"big_queue_size"
+.LASF64:
+	.string	"_IO_backup_base"
+.LASF147:
+	.string	"best"
+.LASF73:
+	.string	"_shortbuf"
+.LASF286:
+	.string	"max_log"
+.LASF158:
+	.string	"cmd_function"
+.LASF162:
+	.string	"qcnt"
+.LASF49:
+	.string	"__allocated"
+.LASF154:
+	.string	"fail_every"
+.LASF190:
+	.string	"malloc"
+.LASF259:
+	.string	"time"
+.LASF20:
+	.string	"__off64_t"
+.LASF266:
+	.string	"obuf"
+.LASF115:
+	.string	"queue_t"
+.LASF291:
+	.string	"randstr_buf"
+.LASF199:
+	.string	"set_fail_list"
+.LASF50:
+	.string	"__used"
+.LASF62:
+	.string	"_IO_buf_end"
+.LASF157:
+	.string	"simulation"
+.LASF331:
+	.string	"heap_ns"
+.LASF334:
+	.string	"merge_deal"
+.LASF321:
+	.string	"need_rand"
+.LASF124:
+	.string	"name"
+.LASF285:
+	.string	"do_complexity"
+.LASF145:
+	.string	"coef"
+.LASF227:
+	.string	"strtol"
+.LASF345:
+	.string	"file_name"
+.LASF279:
+	.string	"after"
+.LASF90:
+	.string	"stderr"
+.LASF9:
+	.string	"short int"
+.LASF155:
+	.string	"quarantine_max_blocks"
+.LASF245:
+	.string	"run_console"
+.LASF233:
+	.string	"metric_int"
+.LASF107:
+	.string	"uint64_t"
+.LASF326:
+	.string	"mode"
+.LASF132:
+	.string	"dut_ops"
+.LASF231:
+	.string	"allocation_bytes"
+.LASF32:
+	.string	"tv_nsec"
+.LASF277:
+	.string	"usage"
+.LASF348:
+	.string	"other_queues"
+.LASF72:
+	.string	"_vtable_offset"
+.LASF194:
+	.string	"metric_double"
+.LASF33:
+	.string	"__sighandler_t"
+.LASF30:
+	.string	"__val"
+.LASF336:
+	.string	"slots"
+.LASF225:
+	.string	"srand"
+.LASF262:
+	.string	"infile_name"
+.LASF186:
+	.string	"strlen"
+.LASF11:
+	.string	"__int64_t"
+.LASF324:
+	.string	"lasts"
+.LASF95:
+	.string	"st_mode"
+.LASF14:
+	.string	"__uid_t"
+.LASF208:
+	.string	"last_const_result"
+.LASF237:
+	.string	"error_check"
+.LASF56:
+	.string	"_IO_read_end"
+.LASF230:
+	.string	"posix_spawn"
+.LASF275:
+	.string	"status"
+.LASF293:
+	.string	"cplx_randomize"
+.LASF310:
+	.string	"do_sort"
+.LASF68:
+	.string	"_fileno"
+.LASF313:
+	.string	"do_reverse"
+.LASF77:
+	.string	"_wide_data"
+.LASF122:
+	.string	"test_reverse"
+.LASF88:
+	.string	"optarg"
+.LASF189:
+	.string	"free"
+.LASF213:
+	.string	"q_insert_head"
+.LASF301:
+	.string	"cplx_insert_head"
+.LASF221:
+	.string	"report_flush"
+.LASF6:
+	.string	"short unsigned int"
+.LASF89:
+	.string	"stdout"
+.LASF271:
+	.string	"metrics_name"
+.LASF349:
+	.string	"use_queue"
+.LASF59:
+	.string	"_IO_write_ptr"
+.LASF344:
+	.string	"show_leaks"
+.LASF311:
+	.string	"do_size"
+.LASF144:
+	.string	"cplx_names"
+.LASF40:
+	.string	"int64_t"
+.LASF226:
+	.string	"exit"
+.LASF284:
+	.string	"queue_quit"
+.LASF363:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF18:
+	.string	"__nlink_t"
+.LASF327:
+	.string	"complexity"
+.LASF171:
+	.string	"leakfile_name"
+.LASF26:
+	.string	"__sigset_t"
+.LASF196:
+	.string	"fflush"
+.LASF31:
+	.string	"tv_sec"
+.LASF220:
+	.string	"trigger_exception"
+.LASF129:
+	.string	"undo"
+.LASF359:
+	.string	"fwrite"
+.LASF238:
+	.string	"allocation_check"
+.LASF207:
+	.string	"q_sort"
+.LASF103:
+	.string	"st_atim"
+.LASF232:
+	.string	"allocation_number"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"qtest.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
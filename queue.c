@@ -159,6 +159,82 @@ void q_reverse(queue_t *q)
     q->tail = oldhead;
 }
 
+/*
+ * Append all elements of src to dst, in constant time, leaving src empty.
+ * No effect if either queue is NULL, or if they are the same queue.
+ * No elements are allocated or freed, and src itself is not freed.
+ */
+void q_splice(queue_t *dst, queue_t *src)
+{
+    if (!dst || !src || dst == src || !src->head)
+        return;
+    if (dst->tail)
+        dst->tail->next = src->head;
+    else
+        dst->head = src->head;
+    dst->tail = src->tail;
+    dst->size += src->size;
+    src->head = src->tail = NULL;
+    src->size = 0;
+}
+
+/* Restore heap order of element heads below slot i, by their strings */
+static void heap_down(list_ele_t **heap, int n, int i)
+{
+    list_ele_t *e = heap[i];
+    for (;;) {
+        int c = 2 * i + 1;
+        if (c >= n)
+            break;
+        if (c + 1 < n && strcmp(heap[c + 1]->value, heap[c]->value) < 0)
+            c++;
+        if (strcmp(e->value, heap[c]->value) <= 0)
+            break;
+        heap[i] = heap[c];
+        i = c;
+    }
+    heap[i] = e;
+}
+
+/*
+ * Merge k sorted queues into qs[0], leaving qs[1] .. qs[k - 1] empty.
+ * A binary heap holds the first remaining element of each queue, so each
+ * element costs O(log k) comparisons.  Elements are relinked, not copied.
+ * No effect if qs[0] is NULL.  NULL queues among the others are skipped.
+ */
+void q_merge_k(queue_t **qs, int k)
+{
+    if (!qs || k < 1 || !qs[0])
+        return;
+    list_ele_t *heap[k];
+    int n = 0, size = 0;
+    for (int i = 0; i < k; i++) {
+        if (!qs[i] || (i > 0 && qs[i] == qs[0]))
+            continue;
+        if (qs[i]->head)
+            heap[n++] = qs[i]->head;
+        size += qs[i]->size;
+        qs[i]->head = qs[i]->tail = NULL;
+        qs[i]->size = 0;
+    }
+    for (int i = n / 2 - 1; i >= 0; i--)
+        heap_down(heap, n, i);
+
+    list_ele_t root = {.next = NULL};
+    list_ele_t *tail = &root;
+    while (n > 0) {
+        list_ele_t *e = heap[0];
+        tail = tail->next = e;
+        heap[0] = e->next ? e->next : heap[--n];
+        if (n > 0)
+            heap_down(heap, n, 0);
+    }
+    tail->next = NULL;
+    qs[0]->head = root.next;
+    qs[0]->tail = root.next ? tail : NULL;
+    qs[0]->size = size;
+}
+
 void split_list(list_ele_t *src, list_ele_t **front, list_ele_t **back)
 {
     list_ele_t *fast = src->next, *slow = src;
@@ -86,6 +86,24 @@ int q_size(queue_t *q);
  */
 void q_reverse(queue_t *q);
 
+/*
+ * Append all elements of src to the tail of dst in constant time, leaving
+ * src empty.
+ * No effect if either queue is NULL, or if dst and src are the same queue.
+ * This function should not allocate or free any list elements, nor free
+ * src itself.
+ */
+void q_splice(queue_t *dst, queue_t *src);
+
+/*
+ * Merge k queues, each sorted in ascending order, into qs[0], leaving
+ * qs[1] .. qs[k - 1] empty.
+ * No effect if qs[0] is NULL.  NULL queues among the others are skipped.
+ * This function should not allocate or free any list elements.  It should
+ * take O(n log k) time for n elements in total.
+ */
+void q_merge_k(queue_t **qs, int k);
+
 /*
  * Sort elements of queue in ascending order
  * No effect if q is NULL or empty. In addition, if q has only one
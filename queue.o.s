@@ -0,0 +1,4766 @@
+	.file	"queue.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "queue.c"
+	.type	heap_down, @function
+heap_down:
+.LVL0:
+.LFB30:
+	.file 1 "queue.c"
+	.loc 1 183 1 view -0
+	.cfi_startproc
+	.loc 1 183 1 is_stmt 0 view .LVU1
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %r13	# tmp136, heap
+	movl	%esi, %r15d	# tmp137, n
+	movl	%edx, %ebp	# tmp138, i
+	.loc 1 184 5 is_stmt 1 view .LVU2
+# queue.c:184:     list_ele_t *e = heap[i];
+	.loc 1 184 25 is_stmt 0 view .LVU3
+	movslq	%edx, %rax	# i, i
+# queue.c:184:     list_ele_t *e = heap[i];
+	.loc 1 184 17 view .LVU4
+	movq	(%rdi,%rax,8), %r14	# *_3, e
+.LVL1:
+	.loc 1 185 5 is_stmt 1 view .LVU5
+.LBB2:
+	.loc 1 186 9 view .LVU6
+# queue.c:186:         int c = 2 * i + 1;
+	.loc 1 186 13 is_stmt 0 view .LVU7
+	leal	1(%rdx,%rdx), %r12d	#, c
+.LVL2:
+	.loc 1 187 9 is_stmt 1 view .LVU8
+# queue.c:187:         if (c >= n)
+	.loc 1 187 12 is_stmt 0 view .LVU9
+	cmpl	%r12d, %esi	# c, n
+	jg	.L4	#,
+	jmp	.L2	#
+.LVL3:
+.L5:
+	.loc 1 187 12 view .LVU10
+	movl	%r12d, %ebx	# c, _5
+.L3:
+.LVL4:
+	.loc 1 191 9 is_stmt 1 view .LVU11
+# queue.c:191:         if (strcmp(e->value, heap[c]->value) <= 0)
+	.loc 1 191 34 is_stmt 0 view .LVU12
+	movslq	%ebx, %rax	# _5, _5
+	movq	0(%r13,%rax,8), %r12	# *_19, _20
+# queue.c:191:         if (strcmp(e->value, heap[c]->value) <= 0)
+	.loc 1 191 13 view .LVU13
+	movq	(%r12), %rsi	# _20->value, _20->value
+	movq	(%r14), %rdi	# e_36->value, e_36->value
+	call	strcmp@PLT	#
+.LVL5:
+# queue.c:191:         if (strcmp(e->value, heap[c]->value) <= 0)
+	.loc 1 191 12 view .LVU14
+	testl	%eax, %eax	# tmp140
+	jle	.L2	#,
+	.loc 1 193 9 is_stmt 1 view .LVU15
+# queue.c:193:         heap[i] = heap[c];
+	.loc 1 193 13 is_stmt 0 view .LVU16
+	movslq	%ebp, %rbp	# i, i
+# queue.c:193:         heap[i] = heap[c];
+	.loc 1 193 17 view .LVU17
+	movq	%r12, 0(%r13,%rbp,8)	# _20, *_26
+	.loc 1 194 9 is_stmt 1 view .LVU18
+.LVL6:
+	.loc 1 194 9 is_stmt 0 view .LVU19
+.LBE2:
+	.loc 1 185 5 is_stmt 1 view .LVU20
+	.loc 1 185 5 view .LVU21
+.LBB3:
+	.loc 1 186 9 view .LVU22
+# queue.c:186:         int c = 2 * i + 1;
+	.loc 1 186 13 is_stmt 0 view .LVU23
+	leal	1(%rbx,%rbx), %r12d	#, c
+.LVL7:
+	.loc 1 187 9 is_stmt 1 view .LVU24
+# queue.c:187:         if (c >= n)
+	.loc 1 187 12 is_stmt 0 view .LVU25
+	cmpl	%r15d, %r12d	# n, c
+	jge	.L8	#,
+	movl	%ebx, %ebp	# _5, i
+.LVL8:
+.L4:
+	.loc 1 189 9 is_stmt 1 view .LVU26
+# queue.c:189:         if (c + 1 < n && strcmp(heap[c + 1]->value, heap[c]->value) < 0)
+	.loc 1 189 15 is_stmt 0 view .LVU27
+	leal	2(%rbp,%rbp), %ebx	#, _5
+# queue.c:189:         if (c + 1 < n && strcmp(heap[c + 1]->value, heap[c]->value) < 0)
+	.loc 1 189 12 view .LVU28
+	cmpl	%r15d, %ebx	# n, _5
+	jge	.L5	#,
+# queue.c:189:         if (c + 1 < n && strcmp(heap[c + 1]->value, heap[c]->value) < 0)
+	.loc 1 189 57 discriminator 1 view .LVU29
+	movslq	%r12d, %rax	# c, c
+# queue.c:189:         if (c + 1 < n && strcmp(heap[c + 1]->value, heap[c]->value) < 0)
+	.loc 1 189 60 discriminator 1 view .LVU30
+	movq	0(%r13,%rax,8), %rdx	# *_8, *_8
+# queue.c:189:         if (c + 1 < n && strcmp(heap[c + 1]->value, heap[c]->value) < 0)
+	.loc 1 189 26 discriminator 1 view .LVU31
+	movq	(%rdx), %rsi	# _9->value, _9->value
+# queue.c:189:         if (c + 1 < n && strcmp(heap[c + 1]->value, heap[c]->value) < 0)
+	.loc 1 189 44 discriminator 1 view .LVU32
+	movq	8(%r13,%rax,8), %rax	# *_13, *_13
+# queue.c:189:         if (c + 1 < n && strcmp(heap[c + 1]->value, heap[c]->value) < 0)
+	.loc 1 189 26 discriminator 1 view .LVU33
+	movq	(%rax), %rdi	# _14->value, _14->value
+	call	strcmp@PLT	#
+.LVL9:
+# queue.c:189:         if (c + 1 < n && strcmp(heap[c + 1]->value, heap[c]->value) < 0)
+	.loc 1 189 23 discriminator 1 view .LVU34
+	testl	%eax, %eax	# tmp139
+	cmovns	%r12d, %ebx	# _5,, c, _5
+	jmp	.L3	#
+.LVL10:
+.L8:
+	.loc 1 189 23 discriminator 1 view .LVU35
+.LBE3:
+	movl	%ebx, %ebp	# _5, i
+.LVL11:
+.L2:
+	.loc 1 196 5 is_stmt 1 view .LVU36
+# queue.c:196:     heap[i] = e;
+	.loc 1 196 9 is_stmt 0 view .LVU37
+	movslq	%ebp, %rbp	# i, i
+# queue.c:196:     heap[i] = e;
+	.loc 1 196 13 view .LVU38
+	movq	%r14, 0(%r13,%rbp,8)	# e, *_29
+# queue.c:197: }
+	.loc 1 197 1 view .LVU39
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL12:
+	.loc 1 197 1 view .LVU40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL13:
+	.loc 1 197 1 view .LVU41
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL14:
+	.loc 1 197 1 view .LVU42
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL15:
+	.loc 1 197 1 view .LVU43
+	ret	
+	.cfi_endproc
+.LFE30:
+	.size	heap_down, .-heap_down
+	.globl	q_new
+	.type	q_new, @function
+q_new:
+.LFB22:
+	.loc 1 14 1 is_stmt 1 view -0
+	.cfi_startproc
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 15 5 view .LVU45
+# queue.c:15:     queue_t *q = malloc(sizeof(queue_t));
+	.loc 1 15 18 is_stmt 0 view .LVU46
+	movl	$24, %edi	#,
+	call	test_malloc@PLT	#
+.LVL16:
+	.loc 1 16 5 is_stmt 1 view .LVU47
+# queue.c:16:     if (!q)
+	.loc 1 16 8 is_stmt 0 view .LVU48
+	testq	%rax, %rax	# <retval>
+	je	.L9	#,
+	.loc 1 18 5 is_stmt 1 view .LVU49
+# queue.c:18:     q->head = NULL;
+	.loc 1 18 13 is_stmt 0 view .LVU50
+	movq	$0, (%rax)	#, q_5->head
+	.loc 1 19 5 is_stmt 1 view .LVU51
+# queue.c:19:     q->tail = NULL;
+	.loc 1 19 13 is_stmt 0 view .LVU52
+	movq	$0, 8(%rax)	#, q_5->tail
+	.loc 1 20 5 is_stmt 1 view .LVU53
+# queue.c:20:     q->size = 0;
+	.loc 1 20 13 is_stmt 0 view .LVU54
+	movl	$0, 16(%rax)	#, q_5->size
+	.loc 1 21 5 is_stmt 1 view .LVU55
+.L9:
+# queue.c:22: }
+	.loc 1 22 1 is_stmt 0 view .LVU56
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE22:
+	.size	q_new, .-q_new
+	.globl	q_free
+	.type	q_free, @function
+q_free:
+.LVL17:
+.LFB23:
+	.loc 1 26 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 27 5 view .LVU58
+# queue.c:27:     if (!q)
+	.loc 1 27 8 is_stmt 0 view .LVU59
+	testq	%rdi, %rdi	# q
+	je	.L18	#,
+# queue.c:26: {
+	.loc 1 26 1 view .LVU60
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %r12	# tmp87, q
+	.loc 1 29 5 is_stmt 1 view .LVU61
+# queue.c:29:     list_ele_t *p = q->head;
+	.loc 1 29 17 is_stmt 0 view .LVU62
+	movq	(%rdi), %rbx	# q_5(D)->head, p
+.LVL18:
+	.loc 1 30 5 is_stmt 1 view .LVU63
+	.loc 1 30 12 view .LVU64
+	testq	%rbx, %rbx	# p
+	je	.L14	#,
+.LVL19:
+.L15:
+.LBB4:
+	.loc 1 31 9 view .LVU65
+	.loc 1 32 9 view .LVU66
+	movq	%rbx, %rbp	# p, p
+# queue.c:32:         p = p->next;
+	.loc 1 32 11 is_stmt 0 view .LVU67
+	movq	8(%rbx), %rbx	# p_14->next, p
+.LVL20:
+	.loc 1 33 9 is_stmt 1 view .LVU68
+	movq	0(%rbp), %rdi	# p_3->value, p_3->value
+	call	test_free@PLT	#
+.LVL21:
+	.loc 1 34 9 view .LVU69
+	movq	%rbp, %rdi	# p,
+	call	test_free@PLT	#
+.LVL22:
+	.loc 1 34 9 is_stmt 0 view .LVU70
+.LBE4:
+	.loc 1 30 12 is_stmt 1 view .LVU71
+	testq	%rbx, %rbx	# p
+	jne	.L15	#,
+.LVL23:
+.L14:
+	.loc 1 36 5 view .LVU72
+	movq	%r12, %rdi	# q,
+	call	test_free@PLT	#
+.LVL24:
+# queue.c:37: }
+	.loc 1 37 1 is_stmt 0 view .LVU73
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LVL25:
+	.loc 1 37 1 view .LVU74
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL26:
+	.loc 1 37 1 view .LVU75
+	ret	
+.LVL27:
+.L18:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.loc 1 37 1 view .LVU76
+	ret	
+	.cfi_endproc
+.LFE23:
+	.size	q_free, .-q_free
+	.globl	q_insert_head
+	.type	q_insert_head, @function
+q_insert_head:
+.LVL28:
+.LFB24:
+	.loc 1 47 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 48 5 view .LVU78
+	.loc 1 49 5 view .LVU79
+# queue.c:50:         return false;
+	.loc 1 50 16 is_stmt 0 view .LVU80
+	movl	$0, %eax	#, <retval>
+# queue.c:49:     if (!q)
+	.loc 1 49 8 view .LVU81
+	testq	%rdi, %rdi	# q
+	je	.L28	#,
+# queue.c:47: {
+	.loc 1 47 1 view .LVU82
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx	# tmp94, q
+	movq	%rsi, %r12	# tmp95, s
+	.loc 1 51 5 is_stmt 1 view .LVU83
+# queue.c:51:     newh = malloc(sizeof(list_ele_t));
+	.loc 1 51 12 is_stmt 0 view .LVU84
+	movl	$16, %edi	#,
+.LVL29:
+	.loc 1 51 12 view .LVU85
+	call	test_malloc@PLT	#
+.LVL30:
+	.loc 1 51 12 view .LVU86
+	movq	%rax, %rbp	# tmp96, newh
+.LVL31:
+	.loc 1 53 5 is_stmt 1 view .LVU87
+# queue.c:54:         return false;
+	.loc 1 54 16 is_stmt 0 view .LVU88
+	movl	$0, %eax	#, <retval>
+.LVL32:
+# queue.c:53:     if (!newh)
+	.loc 1 53 8 view .LVU89
+	testq	%rbp, %rbp	# newh
+	je	.L21	#,
+	.loc 1 55 5 is_stmt 1 view .LVU90
+# queue.c:55:     newh->value = strdup(s);
+	.loc 1 55 19 is_stmt 0 view .LVU91
+	movq	%r12, %rdi	# s,
+	call	test_strdup@PLT	#
+.LVL33:
+# queue.c:55:     newh->value = strdup(s);
+	.loc 1 55 17 view .LVU92
+	movq	%rax, 0(%rbp)	# _1, newh_11->value
+	.loc 1 57 5 is_stmt 1 view .LVU93
+# queue.c:57:     if (!newh->value) {
+	.loc 1 57 8 is_stmt 0 view .LVU94
+	testq	%rax, %rax	# _1
+	je	.L31	#,
+	.loc 1 61 5 is_stmt 1 view .LVU95
+# queue.c:61:     if (!q->head) {
+	.loc 1 61 11 is_stmt 0 view .LVU96
+	movq	(%rbx), %rax	# q_8(D)->head, _2
+# queue.c:61:     if (!q->head) {
+	.loc 1 61 8 view .LVU97
+	testq	%rax, %rax	# _2
+	je	.L32	#,
+.L24:
+	.loc 1 64 5 is_stmt 1 view .LVU98
+# queue.c:64:     newh->next = q->head;
+	.loc 1 64 16 is_stmt 0 view .LVU99
+	movq	%rax, 8(%rbp)	# _2, newh_11->next
+	.loc 1 65 5 is_stmt 1 view .LVU100
+# queue.c:65:     q->head = newh;
+	.loc 1 65 13 is_stmt 0 view .LVU101
+	movq	%rbp, (%rbx)	# newh, q_8(D)->head
+	.loc 1 66 5 is_stmt 1 view .LVU102
+	addl	$1, 16(%rbx)	#, q_8(D)->size
+	.loc 1 67 5 view .LVU103
+# queue.c:67:     return true;
+	.loc 1 67 12 is_stmt 0 view .LVU104
+	movl	$1, %eax	#, <retval>
+.L21:
+# queue.c:68: }
+	.loc 1 68 1 view .LVU105
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL34:
+	.loc 1 68 1 view .LVU106
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL35:
+	.loc 1 68 1 view .LVU107
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL36:
+	.loc 1 68 1 view .LVU108
+	ret	
+.LVL37:
+.L31:
+	.cfi_restore_state
+	.loc 1 58 9 is_stmt 1 view .LVU109
+	movq	%rbp, %rdi	# newh,
+	call	test_free@PLT	#
+.LVL38:
+	.loc 1 59 9 view .LVU110
+# queue.c:59:         return false;
+	.loc 1 59 16 is_stmt 0 view .LVU111
+	movl	$0, %eax	#, <retval>
+	jmp	.L21	#
+.L32:
+	.loc 1 62 9 is_stmt 1 view .LVU112
+# queue.c:62:         q->tail = newh;
+	.loc 1 62 17 is_stmt 0 view .LVU113
+	movq	%rbp, 8(%rbx)	# newh, q_8(D)->tail
+	jmp	.L24	#
+.LVL39:
+.L28:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+# queue.c:68: }
+	.loc 1 68 1 view .LVU114
+	ret	
+	.cfi_endproc
+.LFE24:
+	.size	q_insert_head, .-q_insert_head
+	.globl	q_insert_tail
+	.type	q_insert_tail, @function
+q_insert_tail:
+.LVL40:
+.LFB25:
+	.loc 1 78 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 79 5 view .LVU116
+# queue.c:80:         return false;
+	.loc 1 80 16 is_stmt 0 view .LVU117
+	movl	$0, %eax	#, <retval>
+# queue.c:79:     if (!q)
+	.loc 1 79 8 view .LVU118
+	testq	%rdi, %rdi	# q
+	je	.L41	#,
+# queue.c:78: {
+	.loc 1 78 1 view .LVU119
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx	# tmp91, q
+	movq	%rsi, %r12	# tmp92, s
+	.loc 1 81 5 is_stmt 1 view .LVU120
+# queue.c:81:     list_ele_t *e = malloc(sizeof(list_ele_t));
+	.loc 1 81 21 is_stmt 0 view .LVU121
+	movl	$16, %edi	#,
+.LVL41:
+	.loc 1 81 21 view .LVU122
+	call	test_malloc@PLT	#
+.LVL42:
+	.loc 1 81 21 view .LVU123
+	movq	%rax, %rbp	# tmp93, e
+.LVL43:
+	.loc 1 82 5 is_stmt 1 view .LVU124
+# queue.c:83:         return false;
+	.loc 1 83 16 is_stmt 0 view .LVU125
+	movl	$0, %eax	#, <retval>
+.LVL44:
+# queue.c:82:     if (!e)
+	.loc 1 82 8 view .LVU126
+	testq	%rbp, %rbp	# e
+	je	.L33	#,
+	.loc 1 84 5 is_stmt 1 view .LVU127
+# queue.c:84:     e->value = strdup(s);
+	.loc 1 84 16 is_stmt 0 view .LVU128
+	movq	%r12, %rdi	# s,
+	call	test_strdup@PLT	#
+.LVL45:
+# queue.c:84:     e->value = strdup(s);
+	.loc 1 84 14 view .LVU129
+	movq	%rax, 0(%rbp)	# _1, e_11->value
+	.loc 1 85 5 is_stmt 1 view .LVU130
+# queue.c:85:     e->next = NULL;
+	.loc 1 85 13 is_stmt 0 view .LVU131
+	movq	$0, 8(%rbp)	#, e_11->next
+	.loc 1 86 5 is_stmt 1 view .LVU132
+# queue.c:86:     if (!e->value) {
+	.loc 1 86 8 is_stmt 0 view .LVU133
+	testq	%rax, %rax	# _1
+	je	.L44	#,
+	.loc 1 90 5 is_stmt 1 view .LVU134
+# queue.c:90:     if (!q->tail) {
+	.loc 1 90 11 is_stmt 0 view .LVU135
+	movq	8(%rbx), %rax	# q_8(D)->tail, _2
+# queue.c:90:     if (!q->tail) {
+	.loc 1 90 8 view .LVU136
+	testq	%rax, %rax	# _2
+	je	.L45	#,
+	.loc 1 93 9 is_stmt 1 view .LVU137
+# queue.c:93:         q->tail->next = e;
+	.loc 1 93 23 is_stmt 0 view .LVU138
+	movq	%rbp, 8(%rax)	# e, _2->next
+.L37:
+	.loc 1 95 5 is_stmt 1 view .LVU139
+# queue.c:95:     q->tail = e;
+	.loc 1 95 13 is_stmt 0 view .LVU140
+	movq	%rbp, 8(%rbx)	# e, q_8(D)->tail
+	.loc 1 96 5 is_stmt 1 view .LVU141
+	addl	$1, 16(%rbx)	#, q_8(D)->size
+	.loc 1 97 5 view .LVU142
+# queue.c:97:     return true;
+	.loc 1 97 12 is_stmt 0 view .LVU143
+	movl	$1, %eax	#, <retval>
+.L33:
+# queue.c:98: }
+	.loc 1 98 1 view .LVU144
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL46:
+	.loc 1 98 1 view .LVU145
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL47:
+	.loc 1 98 1 view .LVU146
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL48:
+	.loc 1 98 1 view .LVU147
+	ret	
+.LVL49:
+.L44:
+	.cfi_restore_state
+	.loc 1 87 9 is_stmt 1 view .LVU148
+	movq	%rbp, %rdi	# e,
+	call	test_free@PLT	#
+.LVL50:
+	.loc 1 88 9 view .LVU149
+# queue.c:88:         return false;
+	.loc 1 88 16 is_stmt 0 view .LVU150
+	movl	$0, %eax	#, <retval>
+	jmp	.L33	#
+.L45:
+	.loc 1 91 9 is_stmt 1 view .LVU151
+# queue.c:91:         q->head = q->tail = e;
+	.loc 1 91 17 is_stmt 0 view .LVU152
+	movq	%rbp, (%rbx)	# e, q_8(D)->head
+	jmp	.L37	#
+.LVL51:
+.L41:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+# queue.c:98: }
+	.loc 1 98 1 view .LVU153
+	ret	
+	.cfi_endproc
+.LFE25:
+	.size	q_insert_tail, .-q_insert_tail
+	.globl	q_remove_head
+	.type	q_remove_head, @function
+q_remove_head:
+.LVL52:
+.LFB26:
+	.loc 1 109 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 110 5 view .LVU155
+# queue.c:110:     if (!q || !q->head)
+	.loc 1 110 8 is_stmt 0 view .LVU156
+	testq	%rdi, %rdi	# q
+	je	.L51	#,
+# queue.c:109: {
+	.loc 1 109 1 discriminator 1 view .LVU157
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx	# tmp99, q
+	movq	%rsi, %rbp	# tmp100, sp
+	movq	%rdx, %r12	# tmp101, bufsize
+# queue.c:110:     if (!q || !q->head)
+	.loc 1 110 17 discriminator 1 view .LVU158
+	movq	(%rdi), %rax	# q_15(D)->head, _1
+# queue.c:110:     if (!q || !q->head)
+	.loc 1 110 12 discriminator 1 view .LVU159
+	testq	%rax, %rax	# _1
+	je	.L52	#,
+	.loc 1 112 5 is_stmt 1 view .LVU160
+# queue.c:112:     if (sp) {
+	.loc 1 112 8 is_stmt 0 view .LVU161
+	testq	%rsi, %rsi	# sp
+	je	.L48	#,
+	.loc 1 113 9 is_stmt 1 view .LVU162
+	movq	(%rax), %rsi	# _1->value, _1->value
+.LVL53:
+	.loc 1 113 9 is_stmt 0 view .LVU163
+	movq	%rbp, %rdi	# sp,
+.LVL54:
+	.loc 1 113 9 view .LVU164
+	call	strncpy@PLT	#
+.LVL55:
+	.loc 1 114 9 is_stmt 1 view .LVU165
+# queue.c:114:         sp[bufsize - 1] = '\0';
+	.loc 1 114 25 is_stmt 0 view .LVU166
+	movb	$0, -1(%rbp,%r12)	#, *_4
+.L48:
+	.loc 1 116 5 is_stmt 1 view .LVU167
+# queue.c:116:     list_ele_t *e = q->head;
+	.loc 1 116 17 is_stmt 0 view .LVU168
+	movq	(%rbx), %rbp	# q_15(D)->head, e
+.LVL56:
+	.loc 1 117 5 is_stmt 1 view .LVU169
+# queue.c:117:     q->head = q->head->next;
+	.loc 1 117 22 is_stmt 0 view .LVU170
+	movq	8(%rbp), %rax	# e_21->next, _5
+# queue.c:117:     q->head = q->head->next;
+	.loc 1 117 13 view .LVU171
+	movq	%rax, (%rbx)	# _5, q_15(D)->head
+	.loc 1 118 5 is_stmt 1 view .LVU172
+# queue.c:118:     if (e->value)
+	.loc 1 118 10 is_stmt 0 view .LVU173
+	movq	0(%rbp), %rdi	# e_21->value, _6
+# queue.c:118:     if (e->value)
+	.loc 1 118 8 view .LVU174
+	testq	%rdi, %rdi	# _6
+	je	.L49	#,
+	.loc 1 119 9 is_stmt 1 view .LVU175
+	call	test_free@PLT	#
+.LVL57:
+.L49:
+	.loc 1 120 5 view .LVU176
+	movq	%rbp, %rdi	# e,
+	call	test_free@PLT	#
+.LVL58:
+	.loc 1 121 5 view .LVU177
+# queue.c:121:     if (!q->head)
+	.loc 1 121 8 is_stmt 0 view .LVU178
+	cmpq	$0, (%rbx)	#, q_15(D)->head
+	je	.L57	#,
+.L50:
+	.loc 1 123 5 is_stmt 1 view .LVU179
+	subl	$1, 16(%rbx)	#, q_15(D)->size
+	.loc 1 124 5 view .LVU180
+# queue.c:124:     return true;
+	.loc 1 124 12 is_stmt 0 view .LVU181
+	movl	$1, %eax	#, <retval>
+.LVL59:
+.L46:
+# queue.c:125: }
+	.loc 1 125 1 view .LVU182
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL60:
+	.loc 1 125 1 view .LVU183
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL61:
+	.loc 1 125 1 view .LVU184
+	ret	
+.LVL62:
+.L57:
+	.cfi_restore_state
+	.loc 1 122 9 is_stmt 1 view .LVU185
+# queue.c:122:         q->tail = NULL;
+	.loc 1 122 17 is_stmt 0 view .LVU186
+	movq	$0, 8(%rbx)	#, q_15(D)->tail
+	jmp	.L50	#
+.LVL63:
+.L51:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+# queue.c:111:         return false;
+	.loc 1 111 16 view .LVU187
+	movl	$0, %eax	#, <retval>
+# queue.c:125: }
+	.loc 1 125 1 view .LVU188
+	ret	
+.LVL64:
+.L52:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+# queue.c:111:         return false;
+	.loc 1 111 16 view .LVU189
+	movl	$0, %eax	#, <retval>
+	jmp	.L46	#
+	.cfi_endproc
+.LFE26:
+	.size	q_remove_head, .-q_remove_head
+	.globl	q_size
+	.type	q_size, @function
+q_size:
+.LVL65:
+.LFB27:
+	.loc 1 132 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 133 5 view .LVU191
+# queue.c:133:     if (!q)
+	.loc 1 133 8 is_stmt 0 view .LVU192
+	testq	%rdi, %rdi	# q
+	je	.L60	#,
+	.loc 1 135 5 is_stmt 1 view .LVU193
+# queue.c:135:     return q->size;
+	.loc 1 135 13 is_stmt 0 view .LVU194
+	movl	16(%rdi), %eax	# q_2(D)->size, <retval>
+	ret	
+.L60:
+# queue.c:134:         return 0;
+	.loc 1 134 16 view .LVU195
+	movl	$0, %eax	#, <retval>
+# queue.c:136: }
+	.loc 1 136 1 view .LVU196
+	ret	
+	.cfi_endproc
+.LFE27:
+	.size	q_size, .-q_size
+	.globl	q_reverse
+	.type	q_reverse, @function
+q_reverse:
+.LVL66:
+.LFB28:
+	.loc 1 146 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 147 5 view .LVU198
+# queue.c:147:     if (!q || !q->head)
+	.loc 1 147 8 is_stmt 0 view .LVU199
+	testq	%rdi, %rdi	# q
+	je	.L61	#,
+# queue.c:147:     if (!q || !q->head)
+	.loc 1 147 17 discriminator 1 view .LVU200
+	movq	(%rdi), %r8	# q_7(D)->head, _1
+# queue.c:147:     if (!q || !q->head)
+	.loc 1 147 12 discriminator 1 view .LVU201
+	testq	%r8, %r8	# _1
+	je	.L61	#,
+.LVL67:
+	.loc 1 151 12 is_stmt 1 view .LVU202
+# queue.c:151:     while (cur->next) {
+	.loc 1 151 15 is_stmt 0 view .LVU203
+	movq	8(%r8), %rax	# _1->next, _15
+# queue.c:151:     while (cur->next) {
+	.loc 1 151 12 view .LVU204
+	testq	%rax, %rax	# _15
+	je	.L65	#,
+# queue.c:150:     list_ele_t *prev = NULL, *cur = q->head, *next;
+	.loc 1 150 31 view .LVU205
+	movq	%r8, %rdx	# _1, prev
+# queue.c:150:     list_ele_t *prev = NULL, *cur = q->head, *next;
+	.loc 1 150 17 view .LVU206
+	movl	$0, %esi	#, prev
+	jmp	.L64	#
+.LVL68:
+.L66:
+	.loc 1 150 17 view .LVU207
+	movq	%rax, %rdx	# _15, prev
+.LVL69:
+# queue.c:151:     while (cur->next) {
+	.loc 1 151 15 view .LVU208
+	movq	%rcx, %rax	# _2, _15
+.LVL70:
+.L64:
+	.loc 1 152 9 is_stmt 1 view .LVU209
+	.loc 1 153 9 view .LVU210
+# queue.c:153:         cur->next = prev;
+	.loc 1 153 19 is_stmt 0 view .LVU211
+	movq	%rsi, 8(%rdx)	# prev, cur_20->next
+	.loc 1 154 9 is_stmt 1 view .LVU212
+.LVL71:
+	.loc 1 155 9 view .LVU213
+	.loc 1 151 12 view .LVU214
+# queue.c:151:     while (cur->next) {
+	.loc 1 151 15 is_stmt 0 view .LVU215
+	movq	8(%rax), %rcx	# MEM[(struct list_ele_t *)_17].next, _2
+	movq	%rdx, %rsi	# prev, prev
+# queue.c:151:     while (cur->next) {
+	.loc 1 151 12 view .LVU216
+	testq	%rcx, %rcx	# _2
+	jne	.L66	#,
+.LVL72:
+.L63:
+	.loc 1 157 5 is_stmt 1 view .LVU217
+# queue.c:157:     cur->next = prev;
+	.loc 1 157 15 is_stmt 0 view .LVU218
+	movq	%rdx, 8(%rax)	# prev, cur_21->next
+	.loc 1 158 5 is_stmt 1 view .LVU219
+# queue.c:158:     q->head = cur;
+	.loc 1 158 13 is_stmt 0 view .LVU220
+	movq	%rax, (%rdi)	# _15, q_7(D)->head
+	.loc 1 159 5 is_stmt 1 view .LVU221
+# queue.c:159:     q->tail = oldhead;
+	.loc 1 159 13 is_stmt 0 view .LVU222
+	movq	%r8, 8(%rdi)	# _1, q_7(D)->tail
+.LVL73:
+.L61:
+# queue.c:160: }
+	.loc 1 160 1 view .LVU223
+	ret	
+.LVL74:
+.L65:
+# queue.c:150:     list_ele_t *prev = NULL, *cur = q->head, *next;
+	.loc 1 150 17 view .LVU224
+	movq	%rax, %rdx	# _15, prev
+# queue.c:150:     list_ele_t *prev = NULL, *cur = q->head, *next;
+	.loc 1 150 31 view .LVU225
+	movq	%r8, %rax	# _1, _15
+	jmp	.L63	#
+	.cfi_endproc
+.LFE28:
+	.size	q_reverse, .-q_reverse
+	.globl	q_splice
+	.type	q_splice, @function
+q_splice:
+.LVL75:
+.LFB29:
+	.loc 1 168 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 169 5 view .LVU227
+# queue.c:169:     if (!dst || !src || dst == src || !src->head)
+	.loc 1 169 9 is_stmt 0 view .LVU228
+	testq	%rdi, %rdi	# dst
+	sete	%al	#, tmp96
+# queue.c:169:     if (!dst || !src || dst == src || !src->head)
+	.loc 1 169 22 view .LVU229
+	cmpq	%rsi, %rdi	# src, dst
+	sete	%dl	#, tmp98
+	orb	%dl, %al	# tmp98, tmp105
+	jne	.L67	#,
+	testq	%rsi, %rsi	# src
+	je	.L67	#,
+# queue.c:169:     if (!dst || !src || dst == src || !src->head)
+	.loc 1 169 43 discriminator 2 view .LVU230
+	movq	(%rsi), %rax	# src_13(D)->head, _4
+# queue.c:169:     if (!dst || !src || dst == src || !src->head)
+	.loc 1 169 36 discriminator 2 view .LVU231
+	testq	%rax, %rax	# _4
+	je	.L67	#,
+	.loc 1 171 5 is_stmt 1 view .LVU232
+# queue.c:171:     if (dst->tail)
+	.loc 1 171 12 is_stmt 0 view .LVU233
+	movq	8(%rdi), %rdx	# dst_12(D)->tail, _5
+# queue.c:171:     if (dst->tail)
+	.loc 1 171 8 view .LVU234
+	testq	%rdx, %rdx	# _5
+	je	.L69	#,
+	.loc 1 172 9 is_stmt 1 view .LVU235
+# queue.c:172:         dst->tail->next = src->head;
+	.loc 1 172 25 is_stmt 0 view .LVU236
+	movq	%rax, 8(%rdx)	# _4, _5->next
+.L70:
+	.loc 1 175 5 is_stmt 1 view .LVU237
+# queue.c:175:     dst->tail = src->tail;
+	.loc 1 175 20 is_stmt 0 view .LVU238
+	movq	8(%rsi), %rax	# src_13(D)->tail, _6
+# queue.c:175:     dst->tail = src->tail;
+	.loc 1 175 15 view .LVU239
+	movq	%rax, 8(%rdi)	# _6, dst_12(D)->tail
+	.loc 1 176 5 is_stmt 1 view .LVU240
+# queue.c:176:     dst->size += src->size;
+	.loc 1 176 15 is_stmt 0 view .LVU241
+	movl	16(%rsi), %eax	# src_13(D)->size, src_13(D)->size
+	addl	%eax, 16(%rdi)	# src_13(D)->size, dst_12(D)->size
+	.loc 1 177 5 is_stmt 1 view .LVU242
+# queue.c:177:     src->head = src->tail = NULL;
+	.loc 1 177 27 is_stmt 0 view .LVU243
+	movq	$0, 8(%rsi)	#, src_13(D)->tail
+# queue.c:177:     src->head = src->tail = NULL;
+	.loc 1 177 15 view .LVU244
+	movq	$0, (%rsi)	#, src_13(D)->head
+	.loc 1 178 5 is_stmt 1 view .LVU245
+# queue.c:178:     src->size = 0;
+	.loc 1 178 15 is_stmt 0 view .LVU246
+	movl	$0, 16(%rsi)	#, src_13(D)->size
+.L67:
+# queue.c:179: }
+	.loc 1 179 1 view .LVU247
+	ret	
+.L69:
+	.loc 1 174 9 is_stmt 1 view .LVU248
+# queue.c:174:         dst->head = src->head;
+	.loc 1 174 19 is_stmt 0 view .LVU249
+	movq	%rax, (%rdi)	# _4, dst_12(D)->head
+	jmp	.L70	#
+	.cfi_endproc
+.LFE29:
+	.size	q_splice, .-q_splice
+	.globl	q_merge_k
+	.type	q_merge_k, @function
+q_merge_k:
+.LVL76:
+.LFB31:
+	.loc 1 206 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 206 1 is_stmt 0 view .LVU251
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$40, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+# queue.c:206: {
+	.loc 1 206 1 view .LVU252
+	movq	%rsp, %r8	#, saved_stack.5_42
+	.loc 1 207 5 is_stmt 1 view .LVU253
+# queue.c:207:     if (!qs || k < 1 || !qs[0])
+	.loc 1 207 8 is_stmt 0 view .LVU254
+	testq	%rdi, %rdi	# qs
+	je	.L72	#,
+	movq	%rdi, %r14	# tmp141, qs
+	movl	%esi, %ecx	# tmp142, k
+	testl	%esi, %esi	# k
+	jle	.L72	#,
+# queue.c:207:     if (!qs || k < 1 || !qs[0])
+	.loc 1 207 22 discriminator 1 view .LVU255
+	cmpq	$0, (%rdi)	#, *qs_43(D)
+	je	.L72	#,
+	.loc 1 209 5 is_stmt 1 view .LVU256
+.LVL77:
+# queue.c:209:     list_ele_t *heap[k];
+	.loc 1 209 17 is_stmt 0 view .LVU257
+	movslq	%esi, %rax	# k, k
+.LVL78:
+	.loc 1 209 17 view .LVU258
+	leaq	15(,%rax,8), %rax	#, tmp121
+.LVL79:
+	.loc 1 209 17 view .LVU259
+	andq	$-16, %rax	#, tmp125
+	subq	%rax, %rsp	# tmp125,
+	movq	%rsp, %r12	#, tmp129
+.LVL80:
+	.loc 1 210 5 is_stmt 1 view .LVU260
+	.loc 1 211 5 view .LVU261
+.LBB5:
+	.loc 1 211 10 view .LVU262
+	.loc 1 211 23 view .LVU263
+.LBE5:
+# queue.c:209:     list_ele_t *heap[k];
+	.loc 1 209 17 is_stmt 0 view .LVU264
+	movl	$0, %eax	#, ivtmp.53
+# queue.c:210:     int n = 0, size = 0;
+	.loc 1 210 16 view .LVU265
+	movl	$0, %r15d	#, size
+# queue.c:210:     int n = 0, size = 0;
+	.loc 1 210 9 view .LVU266
+	movl	$0, %ebx	#, n
+	jmp	.L78	#
+.LVL81:
+.L72:
+	.loc 1 208 9 is_stmt 1 view .LVU267
+	movq	%r8, %rsp	# saved_stack.5_42,
+	jmp	.L71	#
+.LVL82:
+.L76:
+.LBB6:
+	.loc 1 214 9 view .LVU268
+# queue.c:214:         if (qs[i]->head)
+	.loc 1 214 18 is_stmt 0 view .LVU269
+	movq	(%rdx), %rsi	# _10->head, _12
+# queue.c:214:         if (qs[i]->head)
+	.loc 1 214 12 view .LVU270
+	testq	%rsi, %rsi	# _12
+	je	.L77	#,
+	.loc 1 215 13 is_stmt 1 view .LVU271
+.LVL83:
+# queue.c:215:             heap[n++] = qs[i]->head;
+	.loc 1 215 23 is_stmt 0 view .LVU272
+	movslq	%ebx, %rdi	# n, n
+	movq	%rsi, (%r12,%rdi,8)	# _12, (*heap.1_47)[n_83]
+# queue.c:215:             heap[n++] = qs[i]->head;
+	.loc 1 215 19 view .LVU273
+	leal	1(%rbx), %ebx	#, n
+.LVL84:
+.L77:
+	.loc 1 216 9 is_stmt 1 view .LVU274
+# queue.c:216:         size += qs[i]->size;
+	.loc 1 216 14 is_stmt 0 view .LVU275
+	addl	16(%rdx), %r15d	# _10->size, size
+.LVL85:
+	.loc 1 217 9 is_stmt 1 view .LVU276
+# queue.c:217:         qs[i]->head = qs[i]->tail = NULL;
+	.loc 1 217 35 is_stmt 0 view .LVU277
+	movq	$0, 8(%rdx)	#, _10->tail
+# queue.c:217:         qs[i]->head = qs[i]->tail = NULL;
+	.loc 1 217 11 view .LVU278
+	movq	(%r14,%rax,8), %rdx	# MEM[(struct queue_t * *)qs_43(D) + ivtmp.53_87 * 8], _14
+# queue.c:217:         qs[i]->head = qs[i]->tail = NULL;
+	.loc 1 217 21 view .LVU279
+	movq	$0, (%rdx)	#, _14->head
+	.loc 1 218 9 is_stmt 1 view .LVU280
+# queue.c:218:         qs[i]->size = 0;
+	.loc 1 218 11 is_stmt 0 view .LVU281
+	movq	(%r14,%rax,8), %rdx	# MEM[(struct queue_t * *)qs_43(D) + ivtmp.53_87 * 8], _15
+# queue.c:218:         qs[i]->size = 0;
+	.loc 1 218 21 view .LVU282
+	movl	$0, 16(%rdx)	#, _15->size
+.LVL86:
+.L75:
+	.loc 1 211 29 is_stmt 1 discriminator 2 view .LVU283
+	.loc 1 211 23 discriminator 2 view .LVU284
+	addq	$1, %rax	#, ivtmp.53
+.LVL87:
+	.loc 1 211 23 is_stmt 0 discriminator 2 view .LVU285
+	cmpl	%eax, %ecx	# ivtmp.53, k
+	jle	.L89	#,
+.LVL88:
+.L78:
+	.loc 1 212 9 is_stmt 1 view .LVU286
+# queue.c:212:         if (!qs[i] || (i > 0 && qs[i] == qs[0]))
+	.loc 1 212 16 is_stmt 0 view .LVU287
+	movq	(%r14,%rax,8), %rdx	# MEM[(struct queue_t * *)qs_43(D) + ivtmp.53_87 * 8], _10
+# queue.c:212:         if (!qs[i] || (i > 0 && qs[i] == qs[0]))
+	.loc 1 212 12 view .LVU288
+	testq	%rdx, %rdx	# _10
+	je	.L75	#,
+# queue.c:212:         if (!qs[i] || (i > 0 && qs[i] == qs[0]))
+	.loc 1 212 20 discriminator 2 view .LVU289
+	testl	%eax, %eax	# ivtmp.53
+	jle	.L76	#,
+# queue.c:212:         if (!qs[i] || (i > 0 && qs[i] == qs[0]))
+	.loc 1 212 30 discriminator 3 view .LVU290
+	cmpq	(%r14), %rdx	# *qs_43(D), _10
+	jne	.L76	#,
+	jmp	.L75	#
+.LVL89:
+.L89:
+	.loc 1 212 30 discriminator 3 view .LVU291
+	movq	%r8, -72(%rbp)	# saved_stack.5_42, %sfp
+.LBE6:
+	.loc 1 220 5 is_stmt 1 view .LVU292
+.LBB7:
+	.loc 1 220 10 view .LVU293
+# queue.c:220:     for (int i = n / 2 - 1; i >= 0; i--)
+	.loc 1 220 20 is_stmt 0 view .LVU294
+	movl	%ebx, %r13d	# n, tmp135
+	shrl	$31, %r13d	#, tmp135
+	addl	%ebx, %r13d	# n, tmp136
+	sarl	%r13d	# tmp137
+.LVL90:
+	.loc 1 220 31 is_stmt 1 view .LVU295
+	subl	$1, %r13d	#, i
+.LVL91:
+	.loc 1 220 31 is_stmt 0 view .LVU296
+	js	.L79	#,
+.LVL92:
+.L80:
+	.loc 1 221 9 is_stmt 1 discriminator 3 view .LVU297
+	movl	%r13d, %edx	# i,
+	movl	%ebx, %esi	# n,
+	movq	%r12, %rdi	# tmp129,
+	call	heap_down	#
+.LVL93:
+	.loc 1 220 38 discriminator 3 view .LVU298
+	subl	$1, %r13d	#, i
+.LVL94:
+	.loc 1 220 31 discriminator 3 view .LVU299
+	cmpl	$-1, %r13d	#, i
+	jne	.L80	#,
+.L79:
+	.loc 1 220 31 is_stmt 0 discriminator 3 view .LVU300
+.LBE7:
+	.loc 1 223 5 is_stmt 1 view .LVU301
+# queue.c:223:     list_ele_t root = {.next = NULL};
+	.loc 1 223 16 is_stmt 0 view .LVU302
+	movq	$0, -64(%rbp)	#, root
+	movq	$0, -56(%rbp)	#, root
+	.loc 1 224 5 is_stmt 1 view .LVU303
+.LVL95:
+	.loc 1 225 5 view .LVU304
+	.loc 1 225 14 view .LVU305
+	testl	%ebx, %ebx	# n
+	jle	.L85	#,
+# queue.c:224:     list_ele_t *tail = &root;
+	.loc 1 224 17 is_stmt 0 view .LVU306
+	leaq	-64(%rbp), %rax	#, tail
+.LVL96:
+	.loc 1 224 17 view .LVU307
+	jmp	.L83	#
+.LVL97:
+.L82:
+.LBB8:
+# queue.c:228:         heap[0] = e->next ? e->next : heap[--n];
+	.loc 1 228 17 discriminator 4 view .LVU308
+	movq	%rax, (%r12)	# _17, (*heap.1_47)[0]
+	.loc 1 229 9 is_stmt 1 discriminator 4 view .LVU309
+# queue.c:229:         if (n > 0)
+	.loc 1 229 12 is_stmt 0 discriminator 4 view .LVU310
+	testl	%ebx, %ebx	# n
+	jle	.L81	#,
+	.loc 1 230 13 is_stmt 1 view .LVU311
+	movl	$0, %edx	#,
+	movl	%ebx, %esi	# n,
+	movq	%r12, %rdi	# tmp129,
+	call	heap_down	#
+.LVL98:
+	.loc 1 230 13 is_stmt 0 view .LVU312
+.LBE8:
+	.loc 1 225 14 is_stmt 1 view .LVU313
+.LBB9:
+# queue.c:227:         tail = tail->next = e;
+	.loc 1 227 14 is_stmt 0 view .LVU314
+	movq	%r13, %rax	# e, tail
+.LVL99:
+.L83:
+	.loc 1 226 9 is_stmt 1 view .LVU315
+# queue.c:226:         list_ele_t *e = heap[0];
+	.loc 1 226 21 is_stmt 0 view .LVU316
+	movq	(%r12), %r13	# (*heap.1_47)[0], e
+.LVL100:
+	.loc 1 227 9 is_stmt 1 view .LVU317
+# queue.c:227:         tail = tail->next = e;
+	.loc 1 227 27 is_stmt 0 view .LVU318
+	movq	%r13, 8(%rax)	# e, tail_90->next
+.LVL101:
+	.loc 1 228 9 is_stmt 1 view .LVU319
+# queue.c:228:         heap[0] = e->next ? e->next : heap[--n];
+	.loc 1 228 20 is_stmt 0 view .LVU320
+	movq	8(%r13), %rax	# e_57->next, _17
+# queue.c:228:         heap[0] = e->next ? e->next : heap[--n];
+	.loc 1 228 37 view .LVU321
+	testq	%rax, %rax	# _17
+	jne	.L82	#,
+# queue.c:228:         heap[0] = e->next ? e->next : heap[--n];
+	.loc 1 228 37 discriminator 2 view .LVU322
+	subl	$1, %ebx	#, n
+.LVL102:
+	.loc 1 228 37 discriminator 2 view .LVU323
+	movslq	%ebx, %rax	# n, n
+	movq	(%r12,%rax,8), %rax	# (*heap.1_47)[n_59], _17
+	jmp	.L82	#
+.LVL103:
+.L85:
+	.loc 1 228 37 discriminator 2 view .LVU324
+.LBE9:
+# queue.c:224:     list_ele_t *tail = &root;
+	.loc 1 224 17 view .LVU325
+	leaq	-64(%rbp), %r13	#, e
+.LVL104:
+.L81:
+	.loc 1 232 5 is_stmt 1 view .LVU326
+# queue.c:232:     tail->next = NULL;
+	.loc 1 232 16 is_stmt 0 view .LVU327
+	movq	$0, 8(%r13)	#, tail_45->next
+	.loc 1 233 5 is_stmt 1 view .LVU328
+# queue.c:233:     qs[0]->head = root.next;
+	.loc 1 233 7 is_stmt 0 view .LVU329
+	movq	(%r14), %rdx	# *qs_43(D), _18
+# queue.c:233:     qs[0]->head = root.next;
+	.loc 1 233 23 view .LVU330
+	movq	-56(%rbp), %rax	# root.next, _19
+# queue.c:233:     qs[0]->head = root.next;
+	.loc 1 233 17 view .LVU331
+	movq	%rax, (%rdx)	# _19, _18->head
+	.loc 1 234 5 is_stmt 1 view .LVU332
+# queue.c:234:     qs[0]->tail = root.next ? tail : NULL;
+	.loc 1 234 36 is_stmt 0 view .LVU333
+	testq	%rax, %rax	# _19
+	cmove	%rax, %r13	# e,, _19, e
+# queue.c:234:     qs[0]->tail = root.next ? tail : NULL;
+	.loc 1 234 7 view .LVU334
+	movq	(%r14), %rax	# *qs_43(D), _20
+# queue.c:234:     qs[0]->tail = root.next ? tail : NULL;
+	.loc 1 234 17 view .LVU335
+	movq	%r13, 8(%rax)	# e, _20->tail
+	.loc 1 235 5 is_stmt 1 view .LVU336
+# queue.c:235:     qs[0]->size = size;
+	.loc 1 235 7 is_stmt 0 view .LVU337
+	movq	(%r14), %rax	# *qs_43(D), _21
+# queue.c:235:     qs[0]->size = size;
+	.loc 1 235 17 view .LVU338
+	movl	%r15d, 16(%rax)	# size, _21->size
+	movq	-72(%rbp), %rsp	# %sfp,
+.LVL105:
+.L71:
+# queue.c:236: }
+	.loc 1 236 1 view .LVU339
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+	popq	%r12	#
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE31:
+	.size	q_merge_k, .-q_merge_k
+	.globl	split_list
+	.type	split_list, @function
+split_list:
+.LVL106:
+.LFB32:
+	.loc 1 239 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 240 5 view .LVU341
+# queue.c:240:     list_ele_t *fast = src->next, *slow = src;
+	.loc 1 240 17 is_stmt 0 view .LVU342
+	movq	8(%rdi), %rax	# src_5(D)->next, fast
+.LVL107:
+	.loc 1 241 5 is_stmt 1 view .LVU343
+	.loc 1 241 12 view .LVU344
+	testq	%rax, %rax	# fast
+	je	.L93	#,
+# queue.c:240:     list_ele_t *fast = src->next, *slow = src;
+	.loc 1 240 36 is_stmt 0 view .LVU345
+	movq	%rdi, %rcx	# src, slow
+.LVL108:
+.L92:
+	.loc 1 242 9 is_stmt 1 view .LVU346
+# queue.c:242:         fast = fast->next;
+	.loc 1 242 14 is_stmt 0 view .LVU347
+	movq	8(%rax), %rax	# fast_17->next, fast
+.LVL109:
+	.loc 1 243 9 is_stmt 1 view .LVU348
+# queue.c:243:         if (fast) {
+	.loc 1 243 12 is_stmt 0 view .LVU349
+	testq	%rax, %rax	# fast
+	je	.L91	#,
+	.loc 1 244 13 is_stmt 1 view .LVU350
+# queue.c:244:             slow = slow->next;
+	.loc 1 244 18 is_stmt 0 view .LVU351
+	movq	8(%rcx), %rcx	# slow_18->next, slow
+.LVL110:
+	.loc 1 245 13 is_stmt 1 view .LVU352
+# queue.c:245:             fast = fast->next;
+	.loc 1 245 18 is_stmt 0 view .LVU353
+	movq	8(%rax), %rax	# fast_12->next, fast
+.LVL111:
+	.loc 1 241 12 is_stmt 1 view .LVU354
+	testq	%rax, %rax	# fast
+	jne	.L92	#,
+.L91:
+.LVL112:
+	.loc 1 248 5 view .LVU355
+# queue.c:248:     *front = src;
+	.loc 1 248 12 is_stmt 0 view .LVU356
+	movq	%rdi, (%rsi)	# src, *front_7(D)
+	.loc 1 249 5 is_stmt 1 view .LVU357
+# queue.c:249:     *back = slow->next;
+	.loc 1 249 17 is_stmt 0 view .LVU358
+	movq	8(%rcx), %rax	# slow_19->next, _1
+# queue.c:249:     *back = slow->next;
+	.loc 1 249 11 view .LVU359
+	movq	%rax, (%rdx)	# _1, *back_9(D)
+	.loc 1 250 5 is_stmt 1 view .LVU360
+# queue.c:250:     slow->next = NULL;
+	.loc 1 250 16 is_stmt 0 view .LVU361
+	movq	$0, 8(%rcx)	#, slow_19->next
+# queue.c:251: }
+	.loc 1 251 1 view .LVU362
+	ret	
+.LVL113:
+.L93:
+# queue.c:240:     list_ele_t *fast = src->next, *slow = src;
+	.loc 1 240 36 view .LVU363
+	movq	%rdi, %rcx	# src, slow
+	jmp	.L91	#
+	.cfi_endproc
+.LFE32:
+	.size	split_list, .-split_list
+	.globl	merge_sorted
+	.type	merge_sorted, @function
+merge_sorted:
+.LVL114:
+.LFB33:
+	.loc 1 254 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 254 1 is_stmt 0 view .LVU365
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$32, %rsp	#,
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %rax	# a, tmp111
+	movq	%rdi, 8(%rsp)	# a, a
+	movq	%rsi, %rdx	# b, tmp112
+	movq	%rsi, (%rsp)	# b, b
+	.loc 1 255 5 is_stmt 1 view .LVU366
+# queue.c:255:     list_ele_t root = {.next = NULL};
+	.loc 1 255 16 is_stmt 0 view .LVU367
+	movq	$0, 16(%rsp)	#, root
+	movq	$0, 24(%rsp)	#, root
+	.loc 1 256 5 is_stmt 1 view .LVU368
+.LVL115:
+	.loc 1 257 5 view .LVU369
+	.loc 1 257 14 view .LVU370
+	orq	%rsi, %rax	# b.12_10, tmp114
+	je	.L96	#,
+	movq	%rdi, %rsi	# tmp111, a.11_8
+.LVL116:
+# queue.c:256:     list_ele_t *tail = &root;
+	.loc 1 256 17 is_stmt 0 view .LVU371
+	leaq	16(%rsp), %rbx	#, tail
+.LVL117:
+.LBB10:
+# queue.c:259:             (!b || (a && strcmp(a->value, b->value) <= 0)) ? &a : &b;
+	.loc 1 259 65 view .LVU372
+	leaq	8(%rsp), %rbp	#, iftmp.6_14
+	movq	%rsp, %r12	#, iftmp.6_14
+	jmp	.L99	#
+.LVL118:
+.L97:
+	.loc 1 260 9 is_stmt 1 view .LVU373
+# queue.c:260:         if (!(root.next))
+	.loc 1 260 12 is_stmt 0 view .LVU374
+	cmpq	$0, 24(%rsp)	#, root.next
+	je	.L105	#,
+.L98:
+	.loc 1 262 9 is_stmt 1 view .LVU375
+# queue.c:262:         tail = tail->next = *c;
+	.loc 1 262 29 is_stmt 0 view .LVU376
+	movq	(%rax), %rcx	# *iftmp.6_14, _6
+# queue.c:262:         tail = tail->next = *c;
+	.loc 1 262 27 view .LVU377
+	movq	%rcx, 8(%rbx)	# _6, tail_33->next
+.LVL119:
+	.loc 1 263 9 is_stmt 1 view .LVU378
+# queue.c:263:         *c = (*c)->next;
+	.loc 1 263 12 is_stmt 0 view .LVU379
+	movq	8(%rcx), %rdx	# _6->next, _6->next
+	movq	%rdx, (%rax)	# _6->next, *iftmp.6_14
+	.loc 1 263 12 view .LVU380
+.LBE10:
+	.loc 1 257 14 is_stmt 1 view .LVU381
+# queue.c:257:     while (a || b) {
+	.loc 1 257 12 is_stmt 0 view .LVU382
+	movq	8(%rsp), %rsi	# a, a.11_8
+# queue.c:257:     while (a || b) {
+	.loc 1 257 14 view .LVU383
+	movq	(%rsp), %rdx	# b, b.12_10
+	movq	%rsi, %rax	# a.11_8, tmp115
+.LVL120:
+	.loc 1 257 14 view .LVU384
+	orq	%rdx, %rax	# b.12_10, tmp115
+	je	.L96	#,
+.LBB11:
+# queue.c:262:         tail = tail->next = *c;
+	.loc 1 262 14 view .LVU385
+	movq	%rcx, %rbx	# _6, tail
+.LVL121:
+.L99:
+	.loc 1 258 9 is_stmt 1 view .LVU386
+# queue.c:259:             (!b || (a && strcmp(a->value, b->value) <= 0)) ? &a : &b;
+	.loc 1 259 65 is_stmt 0 view .LVU387
+	movq	%rbp, %rax	# iftmp.6_14, iftmp.6_14
+	testq	%rdx, %rdx	# b.12_10
+	je	.L97	#,
+# queue.c:259:             (!b || (a && strcmp(a->value, b->value) <= 0)) ? &a : &b;
+	.loc 1 259 65 discriminator 2 view .LVU388
+	movq	%r12, %rax	# iftmp.6_14, iftmp.6_14
+# queue.c:259:             (!b || (a && strcmp(a->value, b->value) <= 0)) ? &a : &b;
+	.loc 1 259 17 discriminator 2 view .LVU389
+	testq	%rsi, %rsi	# a.11_8
+	je	.L97	#,
+# queue.c:259:             (!b || (a && strcmp(a->value, b->value) <= 0)) ? &a : &b;
+	.loc 1 259 26 discriminator 3 view .LVU390
+	movq	(%rdx), %rax	# b.12_32->value, b.12_32->value
+	movq	(%rsi), %rdi	# a.11_31->value, a.11_31->value
+	movq	%rax, %rsi	# b.12_32->value,
+	call	strcmp@PLT	#
+.LVL122:
+# queue.c:259:             (!b || (a && strcmp(a->value, b->value) <= 0)) ? &a : &b;
+	.loc 1 259 65 discriminator 3 view .LVU391
+	testl	%eax, %eax	# tmp113
+	movq	%r12, %rax	# iftmp.6_14, iftmp.6_14
+	cmovle	%rbp, %rax	# iftmp.6_14,, iftmp.6_14
+	jmp	.L97	#
+.LVL123:
+.L105:
+	.loc 1 261 13 is_stmt 1 view .LVU392
+# queue.c:261:             root.next = *c;
+	.loc 1 261 23 is_stmt 0 view .LVU393
+	movq	(%rax), %rdx	# *iftmp.6_14, *iftmp.6_14
+	movq	%rdx, 24(%rsp)	# *iftmp.6_14, root.next
+	jmp	.L98	#
+.LVL124:
+.L96:
+	.loc 1 261 23 view .LVU394
+.LBE11:
+	.loc 1 265 5 is_stmt 1 view .LVU395
+# queue.c:266: }
+	.loc 1 266 1 is_stmt 0 view .LVU396
+	movq	24(%rsp), %rax	# root.next,
+	addq	$32, %rsp	#,
+	.cfi_def_cfa_offset 32
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE33:
+	.size	merge_sorted, .-merge_sorted
+	.globl	mergesort
+	.type	mergesort, @function
+mergesort:
+.LVL125:
+.LFB34:
+	.loc 1 271 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 271 1 is_stmt 0 view .LVU398
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$16, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx	# tmp94, headref
+	.loc 1 272 5 is_stmt 1 view .LVU399
+# queue.c:272:     list_ele_t *head = *headref;
+	.loc 1 272 17 is_stmt 0 view .LVU400
+	movq	(%rdi), %rdi	# *headref_7(D), head
+.LVL126:
+	.loc 1 273 5 is_stmt 1 view .LVU401
+	.loc 1 274 5 view .LVU402
+# queue.c:274:     if (!head || !(head->next)) {
+	.loc 1 274 8 is_stmt 0 view .LVU403
+	testq	%rdi, %rdi	# head
+	je	.L106	#,
+# queue.c:274:     if (!head || !(head->next)) {
+	.loc 1 274 15 discriminator 1 view .LVU404
+	cmpq	$0, 8(%rdi)	#, head_8->next
+	je	.L106	#,
+	.loc 1 277 5 is_stmt 1 view .LVU405
+	movq	%rsp, %rbp	#, tmp88
+	leaq	8(%rsp), %r12	#, tmp89
+	movq	%rbp, %rdx	# tmp88,
+	movq	%r12, %rsi	# tmp89,
+	call	split_list	#
+.LVL127:
+	.loc 1 278 5 view .LVU406
+	movq	%r12, %rdi	# tmp89,
+	call	mergesort	#
+.LVL128:
+	.loc 1 279 5 view .LVU407
+	movq	%rbp, %rdi	# tmp88,
+	call	mergesort	#
+.LVL129:
+	.loc 1 280 5 view .LVU408
+# queue.c:280:     *headref = merge_sorted(a, b);
+	.loc 1 280 16 is_stmt 0 view .LVU409
+	movq	(%rsp), %rsi	# b,
+	movq	8(%rsp), %rdi	# a,
+	call	merge_sorted	#
+.LVL130:
+# queue.c:280:     *headref = merge_sorted(a, b);
+	.loc 1 280 14 view .LVU410
+	movq	%rax, (%rbx)	# tmp95, *headref_7(D)
+.L106:
+# queue.c:281: }
+	.loc 1 281 1 view .LVU411
+	addq	$16, %rsp	#,
+	.cfi_def_cfa_offset 32
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LVL131:
+	.loc 1 281 1 view .LVU412
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE34:
+	.size	mergesort, .-mergesort
+	.globl	q_sort
+	.type	q_sort, @function
+q_sort:
+.LVL132:
+.LFB35:
+	.loc 1 289 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 291 5 view .LVU414
+.LBB14:
+.LBI14:
+	.loc 1 131 5 view .LVU415
+.LBB15:
+	.loc 1 133 5 view .LVU416
+# queue.c:133:     if (!q)
+	.loc 1 133 8 is_stmt 0 view .LVU417
+	testq	%rdi, %rdi	# q
+	je	.L114	#,
+.LBE15:
+.LBE14:
+# queue.c:289: {
+	.loc 1 289 1 view .LVU418
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp87, q
+.LBB17:
+.LBB16:
+	.loc 1 135 5 is_stmt 1 view .LVU419
+.LVL133:
+	.loc 1 135 5 is_stmt 0 view .LVU420
+.LBE16:
+.LBE17:
+	.loc 1 292 5 is_stmt 1 view .LVU421
+# queue.c:292:     if (!n)
+	.loc 1 292 8 is_stmt 0 view .LVU422
+	cmpl	$0, 16(%rdi)	#, q_6(D)->size
+	je	.L109	#,
+	.loc 1 294 5 is_stmt 1 view .LVU423
+	call	mergesort	#
+.LVL134:
+	.loc 1 295 5 view .LVU424
+	.loc 1 296 5 view .LVU425
+# queue.c:296:     for (c = q->head; c->next; c = c->next)
+	.loc 1 296 12 is_stmt 0 view .LVU426
+	movq	(%rbx), %rax	# q_6(D)->head, _2
+.LVL135:
+.L111:
+	.loc 1 296 23 is_stmt 1 discriminator 1 view .LVU427
+	movq	%rax, %rdx	# _2, c
+# queue.c:296:     for (c = q->head; c->next; c = c->next)
+	.loc 1 296 24 is_stmt 0 discriminator 1 view .LVU428
+	movq	8(%rax), %rax	# c_3->next, _2
+.LVL136:
+# queue.c:296:     for (c = q->head; c->next; c = c->next)
+	.loc 1 296 23 discriminator 1 view .LVU429
+	testq	%rax, %rax	# _2
+	jne	.L111	#,
+	.loc 1 298 5 is_stmt 1 view .LVU430
+# queue.c:298:     q->tail = c;
+	.loc 1 298 13 is_stmt 0 view .LVU431
+	movq	%rdx, 8(%rbx)	# c, q_6(D)->tail
+.LVL137:
+.L109:
+# queue.c:299: }
+	.loc 1 299 1 view .LVU432
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL138:
+	.loc 1 299 1 view .LVU433
+	ret	
+.LVL139:
+.L114:
+	.cfi_restore 3
+	.loc 1 299 1 view .LVU434
+	ret	
+	.cfi_endproc
+.LFE35:
+	.size	q_sort, .-q_sort
+.Letext0:
+	.file 2 "queue.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/string.h"
+	.file 5 "harness.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x963
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF49
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x10
+	.long	.LASF9
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x1d
+	.string	"ELE"
+	.byte	0x10
+	.byte	0x2
+	.byte	0x11
+	.byte	0x10
+	.long	0x83
+	.uleb128 0xb
+	.long	.LASF6
+	.byte	0x15
+	.byte	0xb
+	.long	0x83
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF7
+	.byte	0x16
+	.byte	0x11
+	.long	0x94
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0x88
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x1e
+	.long	0x88
+	.uleb128 0x9
+	.long	0x5d
+	.uleb128 0x10
+	.long	.LASF10
+	.byte	0x2
+	.byte	0x17
+	.byte	0x3
+	.long	0x5d
+	.uleb128 0x1f
+	.byte	0x18
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x9
+	.long	0xd3
+	.uleb128 0xb
+	.long	.LASF11
+	.byte	0x1b
+	.byte	0x11
+	.long	0xd3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF12
+	.byte	0x1c
+	.byte	0x11
+	.long	0xd3
+	.byte	0x8
+	.uleb128 0xb
+	.long	.LASF13
+	.byte	0x1d
+	.byte	0x9
+	.long	0x48
+	.byte	0x10
+	.byte	0
+	.uleb128 0x9
+	.long	0x99
+	.uleb128 0x10
+	.long	.LASF14
+	.byte	0x2
+	.byte	0x1e
+	.byte	0x3
+	.long	0xa5
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF15
+	.uleb128 0x20
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF16
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF17
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF18
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF19
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF20
+	.uleb128 0x9
+	.long	0x8f
+	.uleb128 0xd
+	.long	.LASF21
+	.byte	0x4
+	.byte	0x9c
+	.byte	0xc
+	.long	0x48
+	.long	0x130
+	.uleb128 0x6
+	.long	0x110
+	.uleb128 0x6
+	.long	0x110
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x90
+	.byte	0xe
+	.long	0x83
+	.long	0x150
+	.uleb128 0x6
+	.long	0x83
+	.uleb128 0x6
+	.long	0x110
+	.uleb128 0x6
+	.long	0x35
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF23
+	.byte	0x5
+	.byte	0x12
+	.byte	0x7
+	.long	0x83
+	.long	0x166
+	.uleb128 0x6
+	.long	0x110
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF50
+	.byte	0x5
+	.byte	0x11
+	.byte	0x6
+	.long	0x178
+	.uleb128 0x6
+	.long	0xeb
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF24
+	.byte	0x5
+	.byte	0xf
+	.byte	0x7
+	.long	0xeb
+	.long	0x18e
+	.uleb128 0x6
+	.long	0x35
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF25
+	.value	0x120
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x21f
+	.uleb128 0x22
+	.string	"q"
+	.byte	0x1
+	.value	0x120
+	.byte	0x16
+	.long	0x21f
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x11
+	.string	"n"
+	.value	0x123
+	.byte	0x9
+	.long	0x48
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x11
+	.string	"c"
+	.value	0x127
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x23
+	.long	0x666
+	.quad	.LBI14
+	.byte	.LVU415
+	.long	.LLRL48
+	.byte	0x1
+	.value	0x123
+	.byte	0xd
+	.long	0x20a
+	.uleb128 0x24
+	.long	0x677
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL134
+	.long	0x224
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xd8
+	.uleb128 0x12
+	.long	.LASF26
+	.value	0x10e
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2db
+	.uleb128 0x25
+	.long	.LASF27
+	.byte	0x1
+	.value	0x10e
+	.byte	0x1d
+	.long	0x2db
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x13
+	.long	.LASF11
+	.value	0x110
+	.long	0xd3
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x14
+	.string	"a"
+	.byte	0x11
+	.long	0xd3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x14
+	.string	"b"
+	.byte	0x15
+	.long	0xd3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.quad	.LVL127
+	.long	0x369
+	.long	0x29d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL128
+	.long	0x224
+	.long	0x2b5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL129
+	.long	0x224
+	.long	0x2cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL130
+	.long	0x2e0
+	.byte	0
+	.uleb128 0x9
+	.long	0xd3
+	.uleb128 0xe
+	.long	.LASF40
+	.byte	0xfd
+	.byte	0xd
+	.long	0xd3
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x369
+	.uleb128 0x2
+	.string	"a"
+	.byte	0xfd
+	.byte	0x26
+	.long	0xd3
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x2
+	.string	"b"
+	.byte	0xfd
+	.byte	0x35
+	.long	0xd3
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x15
+	.long	.LASF28
+	.byte	0xff
+	.long	0x99
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x13
+	.long	.LASF12
+	.value	0x100
+	.long	0xd3
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x16
+	.long	.LLRL41
+	.uleb128 0x11
+	.string	"c"
+	.value	0x102
+	.byte	0x16
+	.long	0x2db
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0xa
+	.quad	.LVL122
+	.long	0x115
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF29
+	.byte	0xee
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3d3
+	.uleb128 0xf
+	.string	"src"
+	.byte	0xee
+	.byte	0x1d
+	.long	0xd3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x17
+	.long	.LASF30
+	.byte	0xee
+	.byte	0x2f
+	.long	0x2db
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x17
+	.long	.LASF31
+	.byte	0xee
+	.byte	0x43
+	.long	0x2db
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x8
+	.long	.LASF32
+	.byte	0xf0
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x8
+	.long	.LASF33
+	.byte	0xf0
+	.byte	0x24
+	.long	0xd3
+	.long	.LLST37
+	.long	.LVUS37
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF34
+	.byte	0xcd
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x514
+	.uleb128 0x2
+	.string	"qs"
+	.byte	0xcd
+	.byte	0x1a
+	.long	0x514
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x2
+	.string	"k"
+	.byte	0xcd
+	.byte	0x22
+	.long	0x48
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x8
+	.long	.LASF35
+	.byte	0xd1
+	.byte	0x11
+	.long	0x519
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x4
+	.string	"n"
+	.byte	0xd2
+	.byte	0x9
+	.long	0x48
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x8
+	.long	.LASF13
+	.byte	0xd2
+	.byte	0x10
+	.long	0x48
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x15
+	.long	.LASF28
+	.byte	0xdf
+	.long	0x99
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x8
+	.long	.LASF12
+	.byte	0xe0
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x18
+	.long	.LLRL31
+	.long	0x485
+	.uleb128 0x4
+	.string	"i"
+	.byte	0xd3
+	.byte	0xe
+	.long	0x48
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x19
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.long	0x4cc
+	.uleb128 0x4
+	.string	"i"
+	.byte	0xdc
+	.byte	0xe
+	.long	0x48
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x5
+	.quad	.LVL93
+	.long	0x52c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LLRL34
+	.long	0x506
+	.uleb128 0x4
+	.string	"e"
+	.byte	0xe2
+	.byte	0x15
+	.long	0xd3
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x5
+	.quad	.LVL98
+	.long	0x52c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	0x41
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.uleb128 0x9
+	.long	0x21f
+	.uleb128 0x27
+	.long	0xd3
+	.long	0x52c
+	.uleb128 0x28
+	.long	0x41
+	.long	0x506
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF51
+	.byte	0x1
+	.byte	0xb6
+	.byte	0xd
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5c2
+	.uleb128 0x1a
+	.long	.LASF35
+	.byte	0xb6
+	.byte	0x24
+	.long	0x2db
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x2
+	.string	"n"
+	.byte	0xb6
+	.byte	0x2e
+	.long	0x48
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2
+	.string	"i"
+	.byte	0xb6
+	.byte	0x35
+	.long	0x48
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x4
+	.string	"e"
+	.byte	0xb8
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x16
+	.long	.LLRL4
+	.uleb128 0x4
+	.string	"c"
+	.byte	0xba
+	.byte	0xd
+	.long	0x48
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xa
+	.quad	.LVL5
+	.long	0x115
+	.uleb128 0xa
+	.quad	.LVL9
+	.long	0x115
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF36
+	.byte	0xa7
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5f9
+	.uleb128 0xf
+	.string	"dst"
+	.byte	0xa7
+	.byte	0x18
+	.long	0x21f
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xf
+	.string	"src"
+	.byte	0xa7
+	.byte	0x26
+	.long	0x21f
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF37
+	.byte	0x91
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x666
+	.uleb128 0xf
+	.string	"q"
+	.byte	0x91
+	.byte	0x19
+	.long	0x21f
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2a
+	.long	.LASF52
+	.byte	0x1
+	.byte	0x95
+	.byte	0x11
+	.long	0xd3
+	.uleb128 0x8
+	.long	.LASF38
+	.byte	0x96
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x4
+	.string	"cur"
+	.byte	0x96
+	.byte	0x1f
+	.long	0xd3
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x8
+	.long	.LASF7
+	.byte	0x96
+	.byte	0x2f
+	.long	0xd3
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF39
+	.byte	0x1
+	.byte	0x83
+	.byte	0x5
+	.long	0x48
+	.byte	0x1
+	.long	0x682
+	.uleb128 0x2c
+	.string	"q"
+	.byte	0x1
+	.byte	0x83
+	.byte	0x15
+	.long	0x21f
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF41
+	.byte	0x6c
+	.byte	0x6
+	.long	0x72a
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x72a
+	.uleb128 0x2
+	.string	"q"
+	.byte	0x6c
+	.byte	0x1d
+	.long	0x21f
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2
+	.string	"sp"
+	.byte	0x6c
+	.byte	0x26
+	.long	0x83
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1a
+	.long	.LASF42
+	.byte	0x6c
+	.byte	0x31
+	.long	0x35
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x4
+	.string	"e"
+	.byte	0x74
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x7
+	.quad	.LVL55
+	.long	0x130
+	.long	0x708
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL57
+	.long	0x166
+	.uleb128 0x5
+	.quad	.LVL58
+	.long	0x166
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF43
+	.uleb128 0xe
+	.long	.LASF44
+	.byte	0x4d
+	.byte	0x6
+	.long	0x72a
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7c9
+	.uleb128 0x2
+	.string	"q"
+	.byte	0x4d
+	.byte	0x1d
+	.long	0x21f
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x2
+	.string	"s"
+	.byte	0x4d
+	.byte	0x26
+	.long	0x83
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x4
+	.string	"e"
+	.byte	0x51
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x7
+	.quad	.LVL42
+	.long	0x178
+	.long	0x79c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL45
+	.long	0x150
+	.long	0x7b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL50
+	.long	0x166
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF45
+	.byte	0x2e
+	.byte	0x6
+	.long	0x72a
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x863
+	.uleb128 0x2
+	.string	"q"
+	.byte	0x2e
+	.byte	0x1d
+	.long	0x21f
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2
+	.string	"s"
+	.byte	0x2e
+	.byte	0x26
+	.long	0x83
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x30
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x7
+	.quad	.LVL30
+	.long	0x178
+	.long	0x836
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL33
+	.long	0x150
+	.long	0x84e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL38
+	.long	0x166
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF47
+	.byte	0x19
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x900
+	.uleb128 0x2
+	.string	"q"
+	.byte	0x19
+	.byte	0x16
+	.long	0x21f
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x4
+	.string	"p"
+	.byte	0x1d
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x19
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.long	0x8eb
+	.uleb128 0x4
+	.string	"tmp"
+	.byte	0x1f
+	.byte	0x15
+	.long	0xd3
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xa
+	.quad	.LVL21
+	.long	0x166
+	.uleb128 0x5
+	.quad	.LVL22
+	.long	0x166
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL24
+	.long	0x166
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF48
+	.byte	0x1
+	.byte	0xd
+	.byte	0xa
+	.long	0x21f
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x947
+	.uleb128 0x4
+	.string	"q"
+	.byte	0xf
+	.byte	0xe
+	.long	0x21f
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x5
+	.quad	.LVL16
+	.long	0x178
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	0x666
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2f
+	.long	0x677
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 273
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU424
+	.uleb128 .LVU424
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU420
+	.uleb128 .LVU424
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 16
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU427
+	.uleb128 .LVU429
+	.uleb128 .LVU429
+	.uleb128 .LVU432
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU415
+	.uleb128 .LVU420
+	.uleb128 .LVU434
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 .LVU412
+	.uleb128 .LVU412
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU401
+	.uleb128 .LVU406
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU373
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU371
+	.uleb128 .LVU371
+	.uleb128 .LVU373
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU369
+	.uleb128 .LVU372
+	.uleb128 .LVU372
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 .LVU394
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU373
+	.uleb128 .LVU384
+	.uleb128 .LVU392
+	.uleb128 .LVU394
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU343
+	.uleb128 .LVU355
+	.uleb128 .LVU363
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU343
+	.uleb128 .LVU346
+	.uleb128 .LVU346
+	.uleb128 .LVU355
+	.uleb128 .LVU363
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU260
+	.uleb128 .LVU267
+	.uleb128 .LVU268
+	.uleb128 .LVU339
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU261
+	.uleb128 .LVU267
+	.uleb128 .LVU268
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU326
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU261
+	.uleb128 .LVU267
+	.uleb128 .LVU268
+	.uleb128 .LVU339
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU304
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU263
+	.uleb128 .LVU267
+	.uleb128 .LVU268
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU285
+	.uleb128 .LVU286
+	.uleb128 .LVU291
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU295
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU308
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU308
+	.uleb128 .LVU315
+	.uleb128 .LVU317
+	.uleb128 .LVU324
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU257
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU267
+	.uleb128 .LVU268
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU339
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0xb
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0xb
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0xb
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0xc
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU40
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU5
+	.uleb128 .LVU42
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU8
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU36
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU202
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+	.uleb128 .LVU224
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU202
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 .LVU223
+	.uleb128 .LVU224
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU207
+	.uleb128 .LVU209
+	.uleb128 .LVU210
+	.uleb128 .LVU217
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU169
+	.uleb128 .LVU182
+	.uleb128 .LVU185
+	.uleb128 .LVU187
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU124
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU146
+	.uleb128 .LVU148
+	.uleb128 .LVU153
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU87
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU107
+	.uleb128 .LVU109
+	.uleb128 .LVU114
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU63
+	.uleb128 .LVU74
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU66
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU72
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU47
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0
+.LLRL48:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF21:
+	.string	"strcmp"
+.LASF9:
+	.string	"size_t"
+.LASF38:
+	.string	"prev"
+.LASF32:
+	.string	"fast"
+.LASF22:
+	.string	"strncpy"
+.LASF20:
+	.string	"long long unsigned int"
+.LASF7:
+	.string	"next"
+.LASF4:
+	.string	"long long int"
+.LASF18:
+	.string	"signed char"
+.LASF36:
+	.string	"q_splice"
+.LASF2:
+	.string	"long int"
+.LASF37:
+	.string	"q_reverse"
+.LASF52:
+	.string	"oldhead"
+.LASF42:
+	.string	"bufsize"
+.LASF40:
+	.string	"merge_sorted"
+.LASF29:
+	.string	"split_list"
+.LASF50:
+	.string	"test_free"
+.LASF6:
+	.string	"value"
+.LASF34:
+	.string	"q_merge_k"
+.LASF15:
+	.string	"unsigned int"
+.LASF45:
+	.string	"q_insert_head"
+.LASF3:
+	.string	"long unsigned int"
+.LASF31:
+	.string	"back"
+.LASF13:
+	.string	"size"
+.LASF17:
+	.string	"short unsigned int"
+.LASF33:
+	.string	"slow"
+.LASF12:
+	.string	"tail"
+.LASF5:
+	.string	"long double"
+.LASF49:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF26:
+	.string	"mergesort"
+.LASF14:
+	.string	"queue_t"
+.LASF23:
+	.string	"test_strdup"
+.LASF43:
+	.string	"_Bool"
+.LASF16:
+	.string	"unsigned char"
+.LASF48:
+	.string	"q_new"
+.LASF25:
+	.string	"q_sort"
+.LASF19:
+	.string	"short int"
+.LASF11:
+	.string	"head"
+.LASF51:
+	.string	"heap_down"
+.LASF24:
+	.string	"test_malloc"
+.LASF35:
+	.string	"heap"
+.LASF8:
+	.string	"char"
+.LASF39:
+	.string	"q_size"
+.LASF47:
+	.string	"q_free"
+.LASF44:
+	.string	"q_insert_tail"
+.LASF10:
+	.string	"list_ele_t"
+.LASF30:
+	.string	"front"
+.LASF41:
+	.string	"q_remove_head"
+.LASF46:
+	.string	"newh"
+.LASF27:
+	.string	"headref"
+.LASF28:
+	.string	"root"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"queue.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -1,11 +1,16 @@
 #include "random.h"
 #include <assert.h>
+#include <errno.h>
 #include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+#include <sys/random.h>
 #include <unistd.h>
 
 /* shameless stolen from ebacs */
-void randombytes(uint8_t *x, size_t how_much)
+static void urandom_bytes(uint8_t *x, size_t how_much)
 {
     ssize_t i;
     static int fd = -1;
@@ -38,9 +43,98 @@ void randombytes(uint8_t *x, size_t how_much)
     }
 }
 
+/*
+ * Random numbers come from xoshiro256** in user space, so that the
+ * measurement loop makes no system calls for them.  The state is seeded
+ * from getrandom, and seeded again after RESEED_WORDS outputs and in each
+ * forked child, so that workers do not share a stream.
+ */
+#define RESEED_WORDS (1 << 20)
+
+static uint64_t state[4];
+static size_t words_left = 0;
+static uint64_t bits;
+static int bits_left = 0;
+
+static void reseed_child(void)
+{
+    words_left = 0;
+    bits_left = 0;
+}
+
+static void reseed(void)
+{
+    static bool registered = false;
+    if (!registered) {
+        pthread_atfork(NULL, NULL, reseed_child);
+        registered = true;
+    }
+
+    uint8_t *p = (uint8_t *) state;
+    size_t len = sizeof(state);
+    while (len > 0) {
+        ssize_t n = getrandom(p, len, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0) {
+            /* Kernel without getrandom */
+            urandom_bytes(p, len);
+            break;
+        }
+        p += n;
+        len -= n;
+    }
+    /* xoshiro must not start from all zeros */
+    if (!(state[0] | state[1] | state[2] | state[3]))
+        state[0] = 1;
+    words_left = RESEED_WORDS;
+}
+
+static inline uint64_t rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t next_word(void)
+{
+    if (words_left == 0)
+        reseed();
+    words_left--;
+
+    uint64_t result = rotl(state[1] * 5, 7) * 9;
+    uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+    return result;
+}
+
+void randombytes(uint8_t *x, size_t how_much)
+{
+    while (how_much >= sizeof(uint64_t)) {
+        uint64_t w = next_word();
+        memcpy(x, &w, sizeof(w));
+        x += sizeof(w);
+        how_much -= sizeof(w);
+    }
+    if (how_much > 0) {
+        uint64_t w = next_word();
+        memcpy(x, &w, how_much);
+    }
+}
+
+/* Bits are taken one at a time from a 64-bit word */
 uint8_t randombit(void)
 {
-    uint8_t ret = 0;
-    randombytes(&ret, 1);
-    return (ret & 1);
+    if (bits_left == 0) {
+        bits = next_word();
+        bits_left = 64;
+    }
+    uint8_t ret = bits & 1;
+    bits >>= 1;
+    bits_left--;
+    return ret;
 }
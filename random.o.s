@@ -0,0 +1,2596 @@
+	.file	"random.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "random.c"
+	.type	reseed_child, @function
+reseed_child:
+.LFB8:
+	.file 1 "random.c"
+	.loc 1 60 1 view -0
+	.cfi_startproc
+	.loc 1 61 5 view .LVU1
+# random.c:61:     words_left = 0;
+	.loc 1 61 16 is_stmt 0 view .LVU2
+	movq	$0, words_left(%rip)	#, words_left
+	.loc 1 62 5 is_stmt 1 view .LVU3
+# random.c:62:     bits_left = 0;
+	.loc 1 62 15 is_stmt 0 view .LVU4
+	movl	$0, bits_left(%rip)	#, bits_left
+# random.c:63: }
+	.loc 1 63 1 view .LVU5
+	ret	
+	.cfi_endproc
+.LFE8:
+	.size	reseed_child, .-reseed_child
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"random.c"
+.LC1:
+	.string	"xlen >= 0"
+.LC2:
+	.string	"/dev/urandom"
+	.text
+	.type	next_word, @function
+next_word:
+.LFB11:
+	.loc 1 99 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 100 5 view .LVU7
+# random.c:100:     if (words_left == 0)
+	.loc 1 100 8 is_stmt 0 view .LVU8
+	cmpq	$0, words_left(%rip)	#, words_left
+	je	.L21	#,
+.L3:
+	.loc 1 102 5 is_stmt 1 view .LVU9
+# random.c:102:     words_left--;
+	.loc 1 102 15 is_stmt 0 view .LVU10
+	subq	$1, words_left(%rip)	#, words_left
+	.loc 1 104 5 is_stmt 1 view .LVU11
+# random.c:104:     uint64_t result = rotl(state[1] * 5, 7) * 9;
+	.loc 1 104 33 is_stmt 0 view .LVU12
+	movq	8+state(%rip), %rax	# state[1], _4
+.LVL0:
+.LBB15:
+.LBI15:
+	.loc 1 93 24 is_stmt 1 view .LVU13
+.LBB16:
+	.loc 1 95 5 view .LVU14
+	.loc 1 95 5 is_stmt 0 view .LVU15
+.LBE16:
+.LBE15:
+	.loc 1 105 5 is_stmt 1 view .LVU16
+	.loc 1 106 5 view .LVU17
+# random.c:106:     state[2] ^= state[0];
+	.loc 1 106 22 is_stmt 0 view .LVU18
+	movq	state(%rip), %rcx	# state[0], _7
+# random.c:106:     state[2] ^= state[0];
+	.loc 1 106 14 view .LVU19
+	movq	%rcx, %rsi	# _7, _8
+	xorq	16+state(%rip), %rsi	# state[2], _8
+	.loc 1 107 5 is_stmt 1 view .LVU20
+# random.c:107:     state[3] ^= state[1];
+	.loc 1 107 14 is_stmt 0 view .LVU21
+	movq	%rax, %rdx	# _4, _10
+	xorq	24+state(%rip), %rdx	# state[3], _10
+	.loc 1 108 5 is_stmt 1 view .LVU22
+# random.c:108:     state[1] ^= state[2];
+	.loc 1 108 14 is_stmt 0 view .LVU23
+	movq	%rax, %rdi	# _4, tmp142
+	xorq	%rsi, %rdi	# _8, tmp142
+	movq	%rdi, 8+state(%rip)	# tmp142, state[1]
+	.loc 1 109 5 is_stmt 1 view .LVU24
+# random.c:109:     state[0] ^= state[3];
+	.loc 1 109 14 is_stmt 0 view .LVU25
+	xorq	%rdx, %rcx	# _10, tmp144
+	movq	%rcx, state(%rip)	# tmp144, state[0]
+	.loc 1 110 5 is_stmt 1 view .LVU26
+# random.c:105:     uint64_t t = state[1] << 17;
+	.loc 1 105 14 is_stmt 0 view .LVU27
+	movq	%rax, %rcx	# _4, t
+	salq	$17, %rcx	#, t
+.LVL1:
+# random.c:110:     state[2] ^= t;
+	.loc 1 110 14 view .LVU28
+	xorq	%rsi, %rcx	# _8, tmp147
+.LVL2:
+	.loc 1 110 14 view .LVU29
+	movq	%rcx, 16+state(%rip)	# tmp147, state[2]
+	.loc 1 111 5 is_stmt 1 view .LVU30
+.LVL3:
+.LBB18:
+.LBI18:
+	.loc 1 93 24 view .LVU31
+.LBB19:
+	.loc 1 95 5 view .LVU32
+# random.c:95:     return (x << k) | (x >> (64 - k));
+	.loc 1 95 21 is_stmt 0 view .LVU33
+	rorq	$19, %rdx	#, tmp149
+	movq	%rdx, 24+state(%rip)	# tmp149, state[3]
+.LBE19:
+.LBE18:
+	.loc 1 112 5 is_stmt 1 view .LVU34
+# random.c:104:     uint64_t result = rotl(state[1] * 5, 7) * 9;
+	.loc 1 104 23 is_stmt 0 view .LVU35
+	leaq	(%rax,%rax,4), %rax	#, tmp153
+.LVL4:
+.LBB20:
+.LBB17:
+# random.c:95:     return (x << k) | (x >> (64 - k));
+	.loc 1 95 21 view .LVU36
+	rolq	$7, %rax	#, tmp154
+.LBE17:
+.LBE20:
+# random.c:104:     uint64_t result = rotl(state[1] * 5, 7) * 9;
+	.loc 1 104 14 view .LVU37
+	leaq	(%rax,%rax,8), %rax	#, result
+# random.c:113: }
+	.loc 1 113 1 view .LVU38
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL5:
+.L21:
+	.cfi_restore_state
+	.loc 1 101 9 is_stmt 1 view .LVU39
+.LBB21:
+.LBI21:
+	.loc 1 65 13 view .LVU40
+.LBB22:
+	.loc 1 67 5 view .LVU41
+	.loc 1 68 5 view .LVU42
+# random.c:68:     if (!registered) {
+	.loc 1 68 8 is_stmt 0 view .LVU43
+	cmpb	$0, registered.2(%rip)	#, registered
+	je	.L22	#,
+.L4:
+.LVL6:
+	.loc 1 75 16 is_stmt 1 view .LVU44
+.LBE22:
+.LBE21:
+# random.c:99: {
+	.loc 1 99 1 is_stmt 0 view .LVU45
+	movl	$32, %r12d	#, len
+	leaq	state(%rip), %rbp	#, x
+	jmp	.L14	#
+.LVL7:
+.L22:
+.LBB30:
+.LBB29:
+	.loc 1 69 9 is_stmt 1 view .LVU46
+	leaq	reseed_child(%rip), %rdx	#, tmp121
+	movl	$0, %esi	#,
+	movl	$0, %edi	#,
+	call	pthread_atfork@PLT	#
+.LVL8:
+	.loc 1 70 9 view .LVU47
+# random.c:70:         registered = true;
+	.loc 1 70 20 is_stmt 0 view .LVU48
+	movb	$1, registered.2(%rip)	#, registered
+	jmp	.L4	#
+.LVL9:
+.L25:
+.LBB23:
+.LBB24:
+.LBB25:
+	.loc 1 19 5 is_stmt 1 view .LVU49
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx	#, tmp122
+	movl	$19, %edx	#,
+	leaq	.LC0(%rip), %rsi	#, tmp123
+	leaq	.LC1(%rip), %rdi	#, tmp124
+	call	__assert_fail@PLT	#
+.LVL10:
+.L23:
+	.loc 1 25 13 view .LVU50
+	movl	$1, %edi	#,
+	call	sleep@PLT	#
+.LVL11:
+	.loc 1 21 9 view .LVU51
+.L8:
+	.loc 1 21 9 view .LVU52
+	.loc 1 22 13 view .LVU53
+# random.c:22:             fd = open("/dev/urandom", O_RDONLY);
+	.loc 1 22 18 is_stmt 0 view .LVU54
+	movl	$0, %esi	#,
+	movq	%r12, %rdi	# tmp125,
+	movl	$0, %eax	#,
+	call	open@PLT	#
+.LVL12:
+# random.c:22:             fd = open("/dev/urandom", O_RDONLY);
+	.loc 1 22 16 view .LVU55
+	movl	%eax, fd.0(%rip)	# _48, fd
+	.loc 1 23 13 is_stmt 1 view .LVU56
+# random.c:23:             if (fd != -1)
+	.loc 1 23 16 is_stmt 0 view .LVU57
+	cmpl	$-1, %eax	#, _48
+	je	.L23	#,
+	jmp	.L11	#
+.LVL13:
+.L24:
+	.loc 1 37 13 is_stmt 1 view .LVU58
+	movl	$1, %edi	#,
+	call	sleep@PLT	#
+.LVL14:
+	.loc 1 38 13 view .LVU59
+.L13:
+	.loc 1 29 17 view .LVU60
+	testq	%rbx, %rbx	# xlen
+	jle	.L10	#,
+.LVL15:
+.L9:
+	.loc 1 30 9 view .LVU61
+	.loc 1 35 9 view .LVU62
+# random.c:30:         if (xlen < 1048576)
+	.loc 1 30 12 is_stmt 0 view .LVU63
+	movl	$1048576, %edx	#, tmp164
+	cmpq	%rdx, %rbx	# tmp164, xlen
+	cmovle	%rbx, %rdx	# xlen,, tmp126
+# random.c:35:         i = read(fd, x, (size_t) i);
+	.loc 1 35 13 view .LVU64
+	movq	%rbp, %rsi	# x,
+	movl	fd.0(%rip), %edi	# fd,
+	call	read@PLT	#
+.LVL16:
+	.loc 1 36 9 is_stmt 1 view .LVU65
+# random.c:36:         if (i < 1) {
+	.loc 1 36 12 is_stmt 0 view .LVU66
+	testq	%rax, %rax	# i
+	jle	.L24	#,
+	.loc 1 41 9 is_stmt 1 view .LVU67
+# random.c:41:         x += i;
+	.loc 1 41 11 is_stmt 0 view .LVU68
+	addq	%rax, %rbp	# i, x
+.LVL17:
+	.loc 1 42 9 is_stmt 1 view .LVU69
+# random.c:42:         xlen -= i;
+	.loc 1 42 14 is_stmt 0 view .LVU70
+	subq	%rax, %rbx	# i, xlen
+.LVL18:
+	.loc 1 42 14 view .LVU71
+	jmp	.L13	#
+.LVL19:
+.L5:
+	.loc 1 42 14 view .LVU72
+.LBE25:
+.LBE24:
+	.loc 1 84 9 is_stmt 1 view .LVU73
+# random.c:84:         p += n;
+	.loc 1 84 11 is_stmt 0 view .LVU74
+	addq	%rax, %rbp	# n, x
+.LVL20:
+	.loc 1 85 9 is_stmt 1 view .LVU75
+# random.c:85:         len -= n;
+	.loc 1 85 13 is_stmt 0 view .LVU76
+	subq	%rax, %r12	# n, len
+.LVL21:
+.L6:
+	.loc 1 85 13 view .LVU77
+.LBE23:
+	.loc 1 75 16 is_stmt 1 view .LVU78
+	testq	%r12, %r12	# len
+	je	.L10	#,
+.LVL22:
+.L14:
+.LBB28:
+	.loc 1 76 9 view .LVU79
+# random.c:76:         ssize_t n = getrandom(p, len, 0);
+	.loc 1 76 21 is_stmt 0 view .LVU80
+	movl	$0, %edx	#,
+	movq	%r12, %rsi	# len,
+	movq	%rbp, %rdi	# x,
+	call	getrandom@PLT	#
+.LVL23:
+	.loc 1 77 9 is_stmt 1 view .LVU81
+# random.c:77:         if (n < 0 && errno == EINTR)
+	.loc 1 77 12 is_stmt 0 view .LVU82
+	testq	%rax, %rax	# n
+	jns	.L5	#,
+# random.c:77:         if (n < 0 && errno == EINTR)
+	.loc 1 77 22 view .LVU83
+	call	__errno_location@PLT	#
+.LVL24:
+# random.c:77:         if (n < 0 && errno == EINTR)
+	.loc 1 77 19 view .LVU84
+	cmpl	$4, (%rax)	#, *_30
+	je	.L6	#,
+	.loc 1 79 9 is_stmt 1 view .LVU85
+	.loc 1 81 13 view .LVU86
+.LVL25:
+.LBB27:
+.LBI24:
+	.loc 1 13 13 view .LVU87
+.LBB26:
+	.loc 1 15 5 view .LVU88
+	.loc 1 16 5 view .LVU89
+	.loc 1 18 5 view .LVU90
+# random.c:18:     ssize_t xlen = (ssize_t) how_much;
+	.loc 1 18 13 is_stmt 0 view .LVU91
+	movq	%r12, %rbx	# len, xlen
+.LVL26:
+	.loc 1 19 5 is_stmt 1 view .LVU92
+	testq	%r12, %r12	# len
+	js	.L25	#,
+	.loc 1 20 5 view .LVU93
+# random.c:22:             fd = open("/dev/urandom", O_RDONLY);
+	.loc 1 22 18 is_stmt 0 view .LVU94
+	leaq	.LC2(%rip), %r12	#, tmp125
+.LVL27:
+# random.c:20:     if (fd == -1) {
+	.loc 1 20 8 view .LVU95
+	cmpl	$-1, fd.0(%rip)	#, fd
+	je	.L8	#,
+.L11:
+	.loc 1 29 17 is_stmt 1 view .LVU96
+	testq	%rbx, %rbx	# xlen
+	jg	.L9	#,
+.LVL28:
+.L10:
+	.loc 1 29 17 is_stmt 0 view .LVU97
+.LBE26:
+.LBE27:
+.LBE28:
+	.loc 1 88 5 is_stmt 1 view .LVU98
+# random.c:88:     if (!(state[0] | state[1] | state[2] | state[3]))
+	.loc 1 88 20 is_stmt 0 view .LVU99
+	movq	state(%rip), %rax	# state[0], state[0]
+	orq	8+state(%rip), %rax	# state[1], tmp130
+# random.c:88:     if (!(state[0] | state[1] | state[2] | state[3]))
+	.loc 1 88 31 view .LVU100
+	orq	16+state(%rip), %rax	# state[2], tmp133
+# random.c:88:     if (!(state[0] | state[1] | state[2] | state[3]))
+	.loc 1 88 8 view .LVU101
+	orq	24+state(%rip), %rax	# state[3], tmp165
+	jne	.L15	#,
+	.loc 1 89 9 is_stmt 1 view .LVU102
+# random.c:89:         state[0] = 1;
+	.loc 1 89 18 is_stmt 0 view .LVU103
+	movq	$1, state(%rip)	#, state[0]
+.L15:
+	.loc 1 90 5 is_stmt 1 view .LVU104
+# random.c:90:     words_left = RESEED_WORDS;
+	.loc 1 90 16 is_stmt 0 view .LVU105
+	movq	$1048576, words_left(%rip)	#, words_left
+# random.c:91: }
+	.loc 1 91 1 view .LVU106
+	jmp	.L3	#
+.LBE29:
+.LBE30:
+	.cfi_endproc
+.LFE11:
+	.size	next_word, .-next_word
+	.globl	randombytes
+	.type	randombytes, @function
+randombytes:
+.LVL29:
+.LFB12:
+	.loc 1 116 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 116 1 is_stmt 0 view .LVU108
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$16, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx	# tmp101, x
+	movq	%rsi, %r12	# tmp102, how_much
+	.loc 1 117 5 is_stmt 1 view .LVU109
+	.loc 1 117 21 view .LVU110
+	cmpq	$7, %rsi	#, how_much
+	jbe	.L30	#,
+	leaq	-8(%rsi), %rax	#, tmp91
+	shrq	$3, %rax	#, tmp92
+	leaq	8(%rdi,%rax,8), %rbp	#, x
+.LVL30:
+.L28:
+.LBB31:
+	.loc 1 118 9 view .LVU111
+# random.c:118:         uint64_t w = next_word();
+	.loc 1 118 22 is_stmt 0 view .LVU112
+	call	next_word	#
+.LVL31:
+	.loc 1 119 9 is_stmt 1 view .LVU113
+	movq	%rax, (%rbx)	# tmp103, MEM <unsigned long> [(char * {ref-all})x_21]
+	.loc 1 120 9 view .LVU114
+# random.c:120:         x += sizeof(w);
+	.loc 1 120 11 is_stmt 0 view .LVU115
+	addq	$8, %rbx	#, x
+.LVL32:
+	.loc 1 121 9 is_stmt 1 view .LVU116
+	.loc 1 121 9 is_stmt 0 view .LVU117
+.LBE31:
+	.loc 1 117 21 is_stmt 1 view .LVU118
+	cmpq	%rbp, %rbx	# x, x
+	jne	.L28	#,
+.LBB32:
+# random.c:121:         how_much -= sizeof(w);
+	.loc 1 121 18 is_stmt 0 view .LVU119
+	andl	$7, %r12d	#, how_much
+.LVL33:
+.L27:
+	.loc 1 121 18 view .LVU120
+.LBE32:
+	.loc 1 123 5 is_stmt 1 view .LVU121
+# random.c:123:     if (how_much > 0) {
+	.loc 1 123 8 is_stmt 0 view .LVU122
+	testq	%r12, %r12	# how_much
+	jne	.L33	#,
+.L26:
+# random.c:127: }
+	.loc 1 127 1 view .LVU123
+	addq	$16, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LVL34:
+	.loc 1 127 1 view .LVU124
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL35:
+.L30:
+	.cfi_restore_state
+# random.c:117:     while (how_much >= sizeof(uint64_t)) {
+	.loc 1 117 21 view .LVU125
+	movq	%rdi, %rbp	# x, x
+	jmp	.L27	#
+.LVL36:
+.L33:
+.LBB33:
+	.loc 1 124 9 is_stmt 1 view .LVU126
+# random.c:124:         uint64_t w = next_word();
+	.loc 1 124 22 is_stmt 0 view .LVU127
+	call	next_word	#
+.LVL37:
+# random.c:124:         uint64_t w = next_word();
+	.loc 1 124 18 view .LVU128
+	movq	%rax, 8(%rsp)	# tmp104, w
+	.loc 1 125 9 is_stmt 1 view .LVU129
+	leaq	8(%rsp), %rsi	#, tmp95
+	movq	%r12, %rdx	# how_much,
+	movq	%rbp, %rdi	# x,
+	call	memcpy@PLT	#
+.LVL38:
+.LBE33:
+# random.c:127: }
+	.loc 1 127 1 is_stmt 0 view .LVU130
+	jmp	.L26	#
+	.cfi_endproc
+.LFE12:
+	.size	randombytes, .-randombytes
+	.globl	randombit
+	.type	randombit, @function
+randombit:
+.LFB13:
+	.loc 1 131 1 is_stmt 1 view -0
+	.cfi_startproc
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 132 5 view .LVU132
+# random.c:132:     if (bits_left == 0) {
+	.loc 1 132 8 is_stmt 0 view .LVU133
+	cmpl	$0, bits_left(%rip)	#, bits_left
+	je	.L37	#,
+.L35:
+	.loc 1 136 5 is_stmt 1 view .LVU134
+# random.c:136:     uint8_t ret = bits & 1;
+	.loc 1 136 24 is_stmt 0 view .LVU135
+	movq	bits(%rip), %rax	# bits, bits.11_3
+.LVL39:
+	.loc 1 137 5 is_stmt 1 view .LVU136
+# random.c:137:     bits >>= 1;
+	.loc 1 137 10 is_stmt 0 view .LVU137
+	movq	%rax, %rdx	# bits.11_3, tmp90
+	shrq	%rdx	# tmp90
+	movq	%rdx, bits(%rip)	# tmp90, bits
+	.loc 1 138 5 is_stmt 1 view .LVU138
+# random.c:138:     bits_left--;
+	.loc 1 138 14 is_stmt 0 view .LVU139
+	subl	$1, bits_left(%rip)	#, bits_left
+	.loc 1 139 5 is_stmt 1 view .LVU140
+# random.c:136:     uint8_t ret = bits & 1;
+	.loc 1 136 13 is_stmt 0 view .LVU141
+	andl	$1, %eax	#, ret
+.LVL40:
+# random.c:140: }
+	.loc 1 140 1 view .LVU142
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL41:
+.L37:
+	.cfi_restore_state
+	.loc 1 133 9 is_stmt 1 view .LVU143
+# random.c:133:         bits = next_word();
+	.loc 1 133 16 is_stmt 0 view .LVU144
+	call	next_word	#
+.LVL42:
+# random.c:133:         bits = next_word();
+	.loc 1 133 14 view .LVU145
+	movq	%rax, bits(%rip)	# tmp92, bits
+	.loc 1 134 9 is_stmt 1 view .LVU146
+# random.c:134:         bits_left = 64;
+	.loc 1 134 19 is_stmt 0 view .LVU147
+	movl	$64, bits_left(%rip)	#, bits_left
+	jmp	.L35	#
+	.cfi_endproc
+.LFE13:
+	.size	randombit, .-randombit
+	.data
+	.align 4
+	.type	fd.0, @object
+	.size	fd.0, 4
+fd.0:
+	.long	-1
+	.section	.rodata
+	.align 8
+	.type	__PRETTY_FUNCTION__.1, @object
+	.size	__PRETTY_FUNCTION__.1, 14
+__PRETTY_FUNCTION__.1:
+	.string	"urandom_bytes"
+	.local	registered.2
+	.comm	registered.2,1,1
+	.local	bits_left
+	.comm	bits_left,4,4
+	.local	bits
+	.comm	bits,8,8
+	.local	words_left
+	.comm	words_left,8,8
+	.local	state
+	.comm	state,32,32
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 6 "/usr/include/unistd.h"
+	.file 7 "/usr/include/fcntl.h"
+	.file 8 "/usr/include/assert.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/sys/random.h"
+	.file 10 "/usr/include/pthread.h"
+	.file 11 "/usr/include/string.h"
+	.file 12 "/usr/include/errno.h"
+	.file 13 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x69b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF38
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x4
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF6
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0x4
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x5d
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF12
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x1a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0x11
+	.long	0xa6
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x79
+	.uleb128 0x4
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8c
+	.uleb128 0x6
+	.long	0xad
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x6c
+	.byte	0x13
+	.long	0x9a
+	.uleb128 0x12
+	.long	0xbe
+	.long	0xf2
+	.uleb128 0x13
+	.long	0x41
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF20
+	.byte	0x36
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	state
+	.uleb128 0x7
+	.long	.LASF21
+	.byte	0x37
+	.byte	0xf
+	.long	0x35
+	.uleb128 0x9
+	.byte	0x3
+	.quad	words_left
+	.uleb128 0x7
+	.long	.LASF22
+	.byte	0x38
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bits
+	.uleb128 0x7
+	.long	.LASF23
+	.byte	0x39
+	.byte	0xc
+	.long	0x48
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bits_left
+	.uleb128 0xc
+	.long	.LASF24
+	.byte	0x6
+	.value	0x173
+	.byte	0x10
+	.long	0xd6
+	.long	0x167
+	.uleb128 0x1
+	.long	0x48
+	.uleb128 0x1
+	.long	0x98
+	.uleb128 0x1
+	.long	0x35
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF25
+	.byte	0x6
+	.value	0x1d0
+	.byte	0x15
+	.long	0x6b
+	.long	0x17e
+	.uleb128 0x1
+	.long	0x6b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF26
+	.byte	0x7
+	.byte	0xb5
+	.byte	0xc
+	.long	0x48
+	.long	0x19a
+	.uleb128 0x1
+	.long	0xca
+	.uleb128 0x1
+	.long	0x48
+	.uleb128 0x1b
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF27
+	.byte	0x8
+	.byte	0x45
+	.byte	0xd
+	.long	0x1bb
+	.uleb128 0x1
+	.long	0xca
+	.uleb128 0x1
+	.long	0xca
+	.uleb128 0x1
+	.long	0x6b
+	.uleb128 0x1
+	.long	0xca
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF39
+	.byte	0xc
+	.byte	0x25
+	.byte	0xd
+	.long	0x1c7
+	.uleb128 0x6
+	.long	0x48
+	.uleb128 0xd
+	.long	.LASF28
+	.byte	0x9
+	.byte	0x22
+	.byte	0x9
+	.long	0xd6
+	.long	0x1ec
+	.uleb128 0x1
+	.long	0x98
+	.uleb128 0x1
+	.long	0x35
+	.uleb128 0x1
+	.long	0x6b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF29
+	.byte	0xa
+	.value	0x534
+	.byte	0xc
+	.long	0x48
+	.long	0x20d
+	.uleb128 0x1
+	.long	0x20d
+	.uleb128 0x1
+	.long	0x20d
+	.uleb128 0x1
+	.long	0x20d
+	.byte	0
+	.uleb128 0x6
+	.long	0x212
+	.uleb128 0x1e
+	.uleb128 0xd
+	.long	.LASF30
+	.byte	0xb
+	.byte	0x2b
+	.byte	0xe
+	.long	0x98
+	.long	0x233
+	.uleb128 0x1
+	.long	0x98
+	.uleb128 0x1
+	.long	0x233
+	.uleb128 0x1
+	.long	0x35
+	.byte	0
+	.uleb128 0x6
+	.long	0x238
+	.uleb128 0x1f
+	.uleb128 0x20
+	.long	.LASF40
+	.byte	0x1
+	.byte	0x82
+	.byte	0x9
+	.long	0xb2
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x27c
+	.uleb128 0xe
+	.string	"ret"
+	.byte	0x88
+	.byte	0xd
+	.long	0xb2
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xa
+	.quad	.LVL42
+	.long	0x339
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF41
+	.byte	0x1
+	.byte	0x73
+	.byte	0x6
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x334
+	.uleb128 0x22
+	.string	"x"
+	.byte	0x1
+	.byte	0x73
+	.byte	0x1b
+	.long	0x334
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x23
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x73
+	.byte	0x25
+	.long	0x35
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x24
+	.long	.LLRL19
+	.long	0x2e8
+	.uleb128 0xe
+	.string	"w"
+	.byte	0x76
+	.byte	0x12
+	.long	0xbe
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xa
+	.quad	.LVL31
+	.long	0x339
+	.byte	0
+	.uleb128 0x25
+	.quad	.LBB33
+	.quad	.LBE33-.LBB33
+	.uleb128 0x14
+	.string	"w"
+	.byte	0x7c
+	.byte	0x12
+	.long	0xbe
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xa
+	.quad	.LVL37
+	.long	0x339
+	.uleb128 0xf
+	.quad	.LVL38
+	.long	0x693
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xb2
+	.uleb128 0x26
+	.long	.LASF42
+	.byte	0x1
+	.byte	0x62
+	.byte	0x11
+	.long	0xbe
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x59e
+	.uleb128 0x27
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x68
+	.byte	0xe
+	.long	0xbe
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xe
+	.string	"t"
+	.byte	0x69
+	.byte	0xe
+	.long	0xbe
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x15
+	.long	0x59e
+	.quad	.LBI15
+	.byte	.LVU13
+	.long	.LLRL2
+	.byte	0x68
+	.byte	0x17
+	.long	0x3b3
+	.uleb128 0x5
+	.long	0x5b8
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x5
+	.long	0x5af
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0x28
+	.long	0x59e
+	.quad	.LBI18
+	.byte	.LVU31
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.byte	0x1
+	.byte	0x6f
+	.byte	0x10
+	.long	0x3f3
+	.uleb128 0x5
+	.long	0x5b8
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x5
+	.long	0x5af
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.uleb128 0x29
+	.long	0x5c2
+	.quad	.LBI21
+	.byte	.LVU40
+	.long	.LLRL7
+	.byte	0x1
+	.byte	0x65
+	.byte	0x9
+	.uleb128 0x16
+	.long	.LLRL7
+	.uleb128 0x8
+	.long	0x5e1
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x8
+	.long	0x5ea
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2a
+	.long	0x5f5
+	.long	.LLRL10
+	.long	0x576
+	.uleb128 0x8
+	.long	0x5f6
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x15
+	.long	0x622
+	.quad	.LBI24
+	.byte	.LVU87
+	.long	.LLRL12
+	.byte	0x51
+	.byte	0xd
+	.long	0x545
+	.uleb128 0x5
+	.long	0x635
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x5
+	.long	0x62c
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x16
+	.long	.LLRL12
+	.uleb128 0x8
+	.long	0x641
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x8
+	.long	0x65e
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x9
+	.quad	.LVL10
+	.long	0x19a
+	.long	0x4d0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x43
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL11
+	.long	0x167
+	.long	0x4e7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL12
+	.long	0x17e
+	.long	0x504
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL14
+	.long	0x167
+	.long	0x51b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL16
+	.long	0x146
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x10
+	.byte	0x73
+	.sleb128 0
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL23
+	.long	0x1cc
+	.long	0x568
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL24
+	.long	0x1bb
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL8
+	.long	0x1ec
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	reseed_child
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF43
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x18
+	.long	0xbe
+	.byte	0x3
+	.long	0x5c2
+	.uleb128 0x10
+	.string	"x"
+	.byte	0x5d
+	.byte	0x26
+	.long	0xbe
+	.uleb128 0x10
+	.string	"k"
+	.byte	0x5d
+	.byte	0x2d
+	.long	0x48
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF35
+	.byte	0x41
+	.long	0x601
+	.uleb128 0x7
+	.long	.LASF33
+	.byte	0x43
+	.byte	0x11
+	.long	0x601
+	.uleb128 0x9
+	.byte	0x3
+	.quad	registered.2
+	.uleb128 0xb
+	.string	"p"
+	.byte	0x49
+	.byte	0xe
+	.long	0x334
+	.uleb128 0xb
+	.string	"len"
+	.byte	0x4a
+	.byte	0xc
+	.long	0x35
+	.uleb128 0x2c
+	.uleb128 0xb
+	.string	"n"
+	.byte	0x4c
+	.byte	0x11
+	.long	0xd6
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF34
+	.uleb128 0x2d
+	.long	.LASF44
+	.byte	0x1
+	.byte	0x3b
+	.byte	0xd
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x17
+	.long	.LASF36
+	.byte	0xd
+	.long	0x67e
+	.uleb128 0x10
+	.string	"x"
+	.byte	0xd
+	.byte	0x24
+	.long	0x334
+	.uleb128 0x2e
+	.long	.LASF31
+	.byte	0x1
+	.byte	0xd
+	.byte	0x2e
+	.long	0x35
+	.uleb128 0xb
+	.string	"i"
+	.byte	0xf
+	.byte	0xd
+	.long	0xd6
+	.uleb128 0x14
+	.string	"fd"
+	.byte	0x10
+	.byte	0x10
+	.long	0x48
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fd.0
+	.uleb128 0x2f
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x12
+	.byte	0xd
+	.long	0xd6
+	.uleb128 0x30
+	.long	.LASF45
+	.long	0x68e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.byte	0
+	.uleb128 0x12
+	.long	0xad
+	.long	0x68e
+	.uleb128 0x13
+	.long	0x41
+	.byte	0xd
+	.byte	0
+	.uleb128 0x11
+	.long	0x67e
+	.uleb128 0x31
+	.long	.LASF30
+	.long	.LASF46
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS21:
+	.uleb128 .LVU136
+	.uleb128 .LVU142
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU124
+	.uleb128 .LVU125
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU113
+	.uleb128 .LVU120
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU15
+	.uleb128 .LVU36
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x11
+	.byte	0x70
+	.sleb128 0
+	.byte	0x35
+	.byte	0x1e
+	.byte	0x37
+	.byte	0x14
+	.byte	0x14
+	.byte	0x24
+	.byte	0x17
+	.byte	0x1f
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x25
+	.byte	0x21
+	.byte	0x39
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU17
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU36
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x41
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x41
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU13
+	.uleb128 .LVU15
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU13
+	.uleb128 .LVU15
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x35
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU31
+	.uleb128 .LVU33
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU31
+	.uleb128 .LVU33
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU44
+	.uleb128 .LVU46
+	.uleb128 .LVU49
+	.uleb128 .LVU58
+	.uleb128 .LVU72
+	.uleb128 .LVU97
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	state
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU44
+	.uleb128 .LVU46
+	.uleb128 .LVU49
+	.uleb128 .LVU58
+	.uleb128 .LVU72
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU97
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU72
+	.uleb128 .LVU77
+	.uleb128 .LVU81
+	.uleb128 .LVU84
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU49
+	.uleb128 .LVU58
+	.uleb128 .LVU87
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU97
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU49
+	.uleb128 .LVU72
+	.uleb128 .LVU87
+	.uleb128 .LVU97
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU58
+	.uleb128 .LVU59
+	.uleb128 .LVU62
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU72
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x12
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x16
+	.byte	0x14
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU49
+	.uleb128 .LVU72
+	.uleb128 .LVU92
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU97
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF26:
+	.string	"open"
+.LASF25:
+	.string	"sleep"
+.LASF11:
+	.string	"__uint8_t"
+.LASF10:
+	.string	"size_t"
+.LASF20:
+	.string	"state"
+.LASF27:
+	.string	"__assert_fail"
+.LASF7:
+	.string	"short unsigned int"
+.LASF31:
+	.string	"how_much"
+.LASF17:
+	.string	"uint64_t"
+.LASF19:
+	.string	"ssize_t"
+.LASF33:
+	.string	"registered"
+.LASF35:
+	.string	"reseed"
+.LASF45:
+	.string	"__PRETTY_FUNCTION__"
+.LASF9:
+	.string	"signed char"
+.LASF6:
+	.string	"unsigned char"
+.LASF23:
+	.string	"bits_left"
+.LASF3:
+	.string	"long unsigned int"
+.LASF21:
+	.string	"words_left"
+.LASF42:
+	.string	"next_word"
+.LASF37:
+	.string	"xlen"
+.LASF40:
+	.string	"randombit"
+.LASF46:
+	.string	"__builtin_memcpy"
+.LASF24:
+	.string	"read"
+.LASF8:
+	.string	"unsigned int"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF16:
+	.string	"uint8_t"
+.LASF32:
+	.string	"result"
+.LASF41:
+	.string	"randombytes"
+.LASF36:
+	.string	"urandom_bytes"
+.LASF14:
+	.string	"__ssize_t"
+.LASF4:
+	.string	"long long int"
+.LASF15:
+	.string	"char"
+.LASF22:
+	.string	"bits"
+.LASF30:
+	.string	"memcpy"
+.LASF12:
+	.string	"short int"
+.LASF13:
+	.string	"__uint64_t"
+.LASF29:
+	.string	"pthread_atfork"
+.LASF28:
+	.string	"getrandom"
+.LASF2:
+	.string	"long int"
+.LASF5:
+	.string	"long double"
+.LASF43:
+	.string	"rotl"
+.LASF39:
+	.string	"__errno_location"
+.LASF38:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF34:
+	.string	"_Bool"
+.LASF44:
+	.string	"reseed_child"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"random.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
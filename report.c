@@ -1,9 +1,14 @@
+#include <pthread.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <signal.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/eventfd.h>
 #include <sys/resource.h>
 #include <sys/time.h>
 #include <time.h>
@@ -24,10 +29,346 @@ static void init_files(FILE *efile, FILE *vfile)
     verbfile = vfile;
 }
 
-static char fail_buf[1024] = "FATAL Error.  Exiting\n";
+/*
+ * Asynchronous output.
+ * Messages are formatted into a ring buffer per destination, and a
+ * background thread writes them out with large write calls.
+ * Only the main thread reports, so each ring has a single producer.
+ * The producer takes no lock, so a siglongjmp out of report can not leave
+ * the writer stuck.  Consumers (the writer thread, or report_flush) are
+ * serialized by a mutex, which the main thread holds with signals blocked.
+ * The writer sleeps until the producer appends, and a producer with a full
+ * ring sleeps until the writer has made room.
+ *
+ * A signal handler may interrupt the main thread halfway through an append.
+ * report_signal_enter writes out what the rings hold, and until
+ * report_signal_leave, output is written straight to its file descriptor.
+ */
+bool async_output = true;
+
+#define RING_SIZE (1 << 20)
+typedef struct {
+    int fd;              /* Destination, or -1 */
+    _Atomic size_t head; /* Bytes appended so far */
+    _Atomic size_t tail; /* Bytes written so far */
+    char buf[RING_SIZE];
+} ring_t;
+
+enum { RING_VERB, RING_LOG, NRINGS };
+static ring_t *rings[NRINGS];
+static pthread_mutex_t drain_lock = PTHREAD_MUTEX_INITIALIZER;
+static bool writer_started = false;
+static volatile sig_atomic_t in_signal = 0;
+
+/* After writing, writer waits this long for more output to batch with */
+#define WRITER_BATCH_US 1000
+
+/*
+ * Each side sets its flag before checking the rings one last time and
+ * sleeping on its eventfd.  The other side clears the flag, and if it was
+ * set, writes to the eventfd.
+ */
+static int data_fd = -1;  /* Wakes writer */
+static int space_fd = -1; /* Wakes producer */
+static atomic_bool writer_waiting = false;
+static atomic_bool producer_waiting = false;
+
+static void wake(atomic_bool *waiting, int fd)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_exchange(waiting, false))
+        eventfd_write(fd, 1);
+}
+
+/* Sleep on fd, unless ready says there is no need to */
+static void wait_for(atomic_bool *waiting, int fd, bool (*ready)())
+{
+    eventfd_t count;
+    atomic_store(waiting, true);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!ready())
+        eventfd_read(fd, &count);
+    atomic_store(waiting, false);
+}
+
+/* Write out everything appended to ring so far */
+static bool drain_ring(ring_t *r)
+{
+    size_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    bool wrote = tail != head;
+    while (tail != head) {
+        size_t pos = tail % RING_SIZE;
+        size_t chunk = head - tail;
+        if (chunk > RING_SIZE - pos)
+            chunk = RING_SIZE - pos;
+        ssize_t n = r->fd >= 0 ? write(r->fd, r->buf + pos, chunk) : -1;
+        if (n < 0 && errno == EINTR)
+            continue;
+        /* Drop output that can not be written */
+        tail += n > 0 ? (size_t) n : chunk;
+        atomic_store_explicit(&r->tail, tail, memory_order_release);
+    }
+    return wrote;
+}
+
+static bool drain_rings()
+{
+    bool wrote = false;
+    pthread_mutex_lock(&drain_lock);
+    for (int i = 0; i < NRINGS; i++)
+        wrote = drain_ring(rings[i]) || wrote;
+    pthread_mutex_unlock(&drain_lock);
+    return wrote;
+}
+
+/*
+ * Drain rings from a signal handler.  The main thread never holds the lock
+ * with signals unblocked, so only the writer can hold it, and only for as
+ * long as a write takes.  Give up after about a second.
+ */
+#define SIGNAL_DRAIN_TRIES 1000
+
+static void drain_rings_signal()
+{
+    struct timespec pause = {0, 1000000};
+    for (int tries = 0; tries < SIGNAL_DRAIN_TRIES; tries++) {
+        if (pthread_mutex_trylock(&drain_lock) == 0) {
+            for (int i = 0; i < NRINGS; i++)
+                drain_ring(rings[i]);
+            pthread_mutex_unlock(&drain_lock);
+            return;
+        }
+        nanosleep(&pause, NULL);
+    }
+}
+
+/* Drain rings from the main thread, which signal handlers may interrupt */
+static void drain_rings_main()
+{
+    if (in_signal) {
+        drain_rings_signal();
+        return;
+    }
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+    drain_rings();
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+}
+
+/*
+ * A forked child has no writer thread.  The lock is held across fork, so
+ * the child gets it in a known state, and the child writes synchronously.
+ */
+static sigset_t fork_mask;
+
+static void fork_prepare()
+{
+    sigset_t all;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &fork_mask);
+    pthread_mutex_lock(&drain_lock);
+}
+
+static void fork_parent()
+{
+    pthread_mutex_unlock(&drain_lock);
+    pthread_sigmask(SIG_SETMASK, &fork_mask, NULL);
+}
+
+static void fork_child()
+{
+    pthread_mutex_unlock(&drain_lock);
+    writer_started = false;
+    async_output = false;
+    pthread_sigmask(SIG_SETMASK, &fork_mask, NULL);
+}
+
+static bool rings_pending()
+{
+    for (int i = 0; i < NRINGS; i++) {
+        if (atomic_load(&rings[i]->head) != atomic_load(&rings[i]->tail))
+            return true;
+    }
+    return false;
+}
+
+static void *writer_main(void *arg)
+{
+    for (;;) {
+        if (drain_rings()) {
+            wake(&producer_waiting, space_fd);
+            usleep(WRITER_BATCH_US);
+            continue;
+        }
+        wait_for(&writer_waiting, data_fd, rings_pending);
+    }
+    return NULL;
+}
+
+/* Start writer thread.  Return false if output must stay synchronous */
+static bool start_writer()
+{
+    for (int i = 0; i < NRINGS; i++) {
+        rings[i] = calloc(1, sizeof(ring_t));
+        if (!rings[i])
+            return false;
+        rings[i]->fd = -1;
+    }
+    data_fd = eventfd(0, EFD_CLOEXEC);
+    space_fd = eventfd(0, EFD_CLOEXEC);
+    if (data_fd < 0 || space_fd < 0)
+        return false;
+    rings[RING_VERB]->fd = fileno(verbfile);
+    if (logfile)
+        rings[RING_LOG]->fd = fileno(logfile);
+
+    /* Signals such as SIGALRM must be handled by main thread */
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+    pthread_t writer;
+    int err = pthread_create(&writer, NULL, writer_main, NULL);
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    if (err)
+        return false;
+
+    pthread_detach(writer);
+    pthread_atfork(fork_prepare, fork_parent, fork_child);
+    atexit(report_flush);
+    writer_started = true;
+    return true;
+}
+
+/* Ring being appended to, for ring_has_room */
+static ring_t *put_ring;
+static size_t put_len;
 
+static bool ring_has_room()
+{
+    size_t head = atomic_load(&put_ring->head);
+    return head + put_len - atomic_load(&put_ring->tail) <= RING_SIZE;
+}
+
+/* Append bytes to ring, waiting for writer if it is full */
+static void ring_put(ring_t *r, const char *data, size_t len)
+{
+    if (len > RING_SIZE) {
+        report_flush();
+        while (len > 0) {
+            ssize_t n = write(r->fd, data, len);
+            if (n <= 0)
+                return;
+            data += n;
+            len -= n;
+        }
+        return;
+    }
+
+    size_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    put_ring = r;
+    put_len = len;
+    while (!ring_has_room())
+        wait_for(&producer_waiting, space_fd, ring_has_room);
+
+    size_t pos = head % RING_SIZE;
+    size_t first = len < RING_SIZE - pos ? len : RING_SIZE - pos;
+    memcpy(r->buf + pos, data, first);
+    memcpy(r->buf, data + first, len - first);
+    atomic_store_explicit(&r->head, head + len, memory_order_release);
+    wake(&writer_waiting, data_fd);
+}
+
+/*
+ * Format message to file, or to its ring when output is asynchronous.
+ * Message is preceded by prefix, and followed by newline if requested.
+ */
 static volatile int ret = 0;
 
+static void emit(FILE *file,
+                 int ring,
+                 char *prefix,
+                 char *fmt,
+                 va_list ap,
+                 bool newline)
+{
+    if (in_signal) {
+        /* Neither the ring nor stdio may be in a consistent state */
+        char buf[4 * MAX_CHAR];
+        int len = prefix ? snprintf(buf, sizeof(buf), "%s", prefix) : 0;
+        int n = vsnprintf(buf + len, sizeof(buf) - len, fmt, ap);
+        if (n > 0)
+            len += n;
+        if (len > (int) sizeof(buf) - 2)
+            len = sizeof(buf) - 2;
+        if (newline)
+            buf[len++] = '\n';
+        ret = write(fileno(file), buf, len);
+        return;
+    }
+
+    if (!async_output || (!writer_started && !start_writer())) {
+        if (prefix)
+            fputs(prefix, file);
+        vfprintf(file, fmt, ap);
+        if (newline)
+            fputc('\n', file);
+        fflush(file);
+        return;
+    }
+
+    char buf[4 * MAX_CHAR];
+    char *msg = buf;
+    va_list ap2;
+    va_copy(ap2, ap);
+    int len = vsnprintf(buf, sizeof(buf), fmt, ap);
+    if (len >= (int) sizeof(buf)) {
+        msg = malloc(len + 1);
+        if (msg)
+            vsnprintf(msg, len + 1, fmt, ap2);
+    }
+    va_end(ap2);
+    if (len < 0 || !msg)
+        return;
+
+    if (prefix)
+        ring_put(rings[ring], prefix, strlen(prefix));
+    ring_put(rings[ring], msg, len);
+    if (newline)
+        ring_put(rings[ring], "\n", 1);
+    if (msg != buf)
+        free(msg);
+}
+
+void report_flush()
+{
+    if (writer_started)
+        drain_rings_main();
+    /* Messages from handlers bypass stdio, which may be partly updated */
+    if (in_signal)
+        return;
+    if (verbfile)
+        fflush(verbfile);
+    if (logfile)
+        fflush(logfile);
+}
+
+void report_signal_enter()
+{
+    in_signal = 1;
+    /* Output written from the handler must follow what is already queued */
+    if (writer_started)
+        drain_rings_signal();
+}
+
+void report_signal_leave()
+{
+    in_signal = 0;
+}
+
+static char fail_buf[1024] = "FATAL Error.  Exiting\n";
+
 /* Default fatal function */
 static void default_fatal_fun()
 {
@@ -46,10 +387,23 @@ void set_verblevel(int level)
 
 bool set_logfile(char *file_name)
 {
+    report_flush();
     logfile = fopen(file_name, "w");
+    if (writer_started)
+        rings[RING_LOG]->fd = logfile ? fileno(logfile) : -1;
     return logfile != NULL;
 }
 
+/* Close log file once pending output has been written */
+static void close_logfile()
+{
+    report_flush();
+    if (writer_started)
+        rings[RING_LOG]->fd = -1;
+    fclose(logfile);
+    logfile = NULL;
+}
+
 void report_event(message_t msg, char *fmt, ...)
 {
     va_list ap;
@@ -64,24 +418,22 @@ void report_event(message_t msg, char *fmt, ...)
     if (!errfile)
         init_files(stdout, stdout);
 
+    char prefix[32];
+    snprintf(prefix, sizeof(prefix), "%s: ", msg_name);
     va_start(ap, fmt);
-    fprintf(errfile, "%s: ", msg_name);
-    vfprintf(errfile, fmt, ap);
-    fprintf(errfile, "\n");
-    fflush(errfile);
+    emit(errfile, RING_VERB, prefix, fmt, ap, true);
     va_end(ap);
 
     if (logfile) {
         va_start(ap, fmt);
-        fprintf(logfile, "Error: ");
-        vfprintf(logfile, fmt, ap);
-        fprintf(logfile, "\n");
-        fflush(logfile);
+        emit(logfile, RING_LOG, "Error: ", fmt, ap, true);
         va_end(ap);
-        fclose(logfile);
+        close_logfile();
     }
 
     if (fatal) {
+        /* Make sure everything reported so far is out before exiting */
+        report_flush();
         if (fatal_fun)
             fatal_fun();
         exit(1);
@@ -96,16 +448,12 @@ void report(int level, char *fmt, ...)
     if (level <= verblevel) {
         va_list ap;
         va_start(ap, fmt);
-        vfprintf(verbfile, fmt, ap);
-        fprintf(verbfile, "\n");
-        fflush(verbfile);
+        emit(verbfile, RING_VERB, NULL, fmt, ap, true);
         va_end(ap);
 
         if (logfile) {
             va_start(ap, fmt);
-            vfprintf(logfile, fmt, ap);
-            fprintf(logfile, "\n");
-            fflush(logfile);
+            emit(logfile, RING_LOG, NULL, fmt, ap, true);
             va_end(ap);
         }
     }
@@ -119,14 +467,12 @@ void report_noreturn(int level, char *fmt, ...)
     if (level <= verblevel) {
         va_list ap;
         va_start(ap, fmt);
-        vfprintf(verbfile, fmt, ap);
-        fflush(verbfile);
+        emit(verbfile, RING_VERB, NULL, fmt, ap, false);
         va_end(ap);
 
         if (logfile) {
             va_start(ap, fmt);
-            vfprintf(logfile, fmt, ap);
-            fflush(logfile);
+            emit(logfile, RING_LOG, NULL, fmt, ap, false);
             va_end(ap);
         }
     }
@@ -137,6 +483,8 @@ void report_noreturn(int level, char *fmt, ...)
 /* Need to be able to print without using malloc */
 static void fail_fun(char *format, char *msg)
 {
+    /* Get pending output out first.  This does not allocate */
+    report_flush();
     snprintf(fail_buf, sizeof(fail_buf), format, msg);
     /* Tack on return */
     fail_buf[strlen(fail_buf)] = '\n';
@@ -280,10 +628,143 @@ void init_time(double *timep)
 
 double delta_time(double *timep)
 {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    double current_time = tv.tv_sec + 1.0E-6 * tv.tv_usec;
+    double current_time = 1.0E-9 * time_ns();
     double delta = current_time - *timep;
     *timep = current_time;
     return delta;
 }
+
+/* Monotonic clock, unaffected by changes to time of day */
+uint64_t time_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/** Machine-readable metrics.  **/
+
+/* Unbuffered, so that a record is out as soon as metric_end returns */
+static int metricsfd = -1;
+
+/* Record being assembled.  Written as one line with a single write, so a
+ * crash leaves no partial record behind */
+static char *mbuf = NULL;
+static size_t mlen = 0;
+static size_t msize = 0;
+static bool mopen = false;
+
+static void metric_append(char *fmt, ...)
+{
+    va_list ap;
+    for (;;) {
+        va_start(ap, fmt);
+        int len = vsnprintf(mbuf + mlen, msize - mlen, fmt, ap);
+        va_end(ap);
+        if (len < 0)
+            return;
+        if (mlen + len < msize) {
+            mlen += len;
+            return;
+        }
+        size_t nsize = msize ? 2 * msize : 1024;
+        while (nsize <= mlen + len)
+            nsize *= 2;
+        char *nbuf = realloc(mbuf, nsize);
+        if (!nbuf) {
+            fail_fun("Realloc returned NULL in %s", "metric_append");
+            return;
+        }
+        mbuf = nbuf;
+        msize = nsize;
+    }
+}
+
+/* Append string with JSON escapes */
+static void metric_quote(const char *s)
+{
+    metric_append("\"");
+    for (; *s; s++) {
+        unsigned char c = *s;
+        if (c == '"' || c == '\\')
+            metric_append("\\%c", c);
+        else if (c < 0x20)
+            metric_append("\\u%04x", c);
+        else
+            metric_append("%c", c);
+    }
+    metric_append("\"");
+}
+
+bool set_metrics_file(char *file_name)
+{
+    close_metrics_file();
+    metricsfd = open(file_name, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+    return metricsfd >= 0;
+}
+
+void close_metrics_file()
+{
+    if (metricsfd >= 0)
+        close(metricsfd);
+    metricsfd = -1;
+    mopen = false;
+}
+
+bool metrics_enabled()
+{
+    return metricsfd >= 0;
+}
+
+void metric_begin(int argc, char *argv[])
+{
+    if (metricsfd < 0)
+        return;
+    mlen = 0;
+    mopen = true;
+    metric_append("{\"cmd\":");
+    metric_quote(argv[0]);
+    metric_append(",\"args\":[");
+    for (int i = 1; i < argc; i++) {
+        if (i > 1)
+            metric_append(",");
+        metric_quote(argv[i]);
+    }
+    metric_append("]");
+}
+
+void metric_int(char *key, int64_t val)
+{
+    if (mopen)
+        metric_append(",\"%s\":%ld", key, (long) val);
+}
+
+void metric_double(char *key, double val)
+{
+    if (!mopen)
+        return;
+    /* JSON has no representation for infinity or NaN */
+    if (val == val && val - val == 0)
+        metric_append(",\"%s\":%.9g", key, val);
+    else
+        metric_append(",\"%s\":null", key);
+}
+
+void metric_bool(char *key, bool val)
+{
+    if (mopen)
+        metric_append(",\"%s\":%s", key, val ? "true" : "false");
+}
+
+void metric_end()
+{
+    if (!mopen)
+        return;
+    metric_append(",\"console_bytes\":%lu,\"console_peak_bytes\":%lu}\n",
+                  current_bytes, peak_bytes);
+    ssize_t n;
+    do
+        n = write(metricsfd, mbuf, mlen);
+    while (n < 0 && errno == EINTR);
+    mopen = false;
+}
@@ -3,6 +3,7 @@
 
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 /* Default reporting level.  Must recompile when change */
 #ifndef RPT
@@ -22,6 +23,23 @@ bool set_logfile(char *file_name);
 extern int verblevel;
 void set_verblevel(int level);
 
+/*
+ * Write output from a background thread, rather than flushing every
+ * message.  Call report_flush before writing to stdout by other means.
+ */
+extern bool async_output;
+
+/* Write out all pending output */
+void report_flush();
+
+/*
+ * Call on entry to a signal handler that reports, and once its siglongjmp
+ * has landed.  Entering writes out pending output.  In between, output is
+ * written directly, not through the background thread's buffers.
+ */
+void report_signal_enter();
+void report_signal_leave();
+
 /* Error messages */
 void report_event(message_t msg, char *fmt, ...);
 
@@ -58,4 +76,29 @@ void init_time(double *timep);
    and reset timer */
 double delta_time(double *timep);
 
+/* Current time in nanoseconds, from monotonic clock */
+uint64_t time_ns();
+
+/** Machine-readable metrics.  **/
+
+/*
+ * Write one JSON object per line to file_name.
+ * Each record is started with metric_begin, gets fields added to it,
+ * and is written out by metric_end.  Fields added while no record is
+ * open are dropped.
+ */
+bool set_metrics_file(char *file_name);
+void close_metrics_file();
+bool metrics_enabled();
+
+/* Start record for command argv[0] with arguments argv[1..argc-1] */
+void metric_begin(int argc, char *argv[]);
+
+void metric_int(char *key, int64_t val);
+void metric_double(char *key, double val);
+void metric_bool(char *key, bool val);
+
+/* Finish record, adding memory used by the console itself */
+void metric_end();
+
 #endif /* LAB0_REPORT_H */
@@ -0,0 +1,14397 @@
+	.file	"report.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "report.c"
+	.type	fork_child, @function
+fork_child:
+.LFB32:
+	.file 1 "report.c"
+	.loc 1 181 1 view -0
+	.cfi_startproc
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 182 5 view .LVU1
+	leaq	drain_lock(%rip), %rdi	#, tmp82
+	call	pthread_mutex_unlock@PLT	#
+.LVL0:
+	.loc 1 183 5 view .LVU2
+# report.c:183:     writer_started = false;
+	.loc 1 183 20 is_stmt 0 view .LVU3
+	movb	$0, writer_started(%rip)	#, writer_started
+	.loc 1 184 5 is_stmt 1 view .LVU4
+# report.c:184:     async_output = false;
+	.loc 1 184 18 is_stmt 0 view .LVU5
+	movb	$0, async_output(%rip)	#, async_output
+	.loc 1 185 5 is_stmt 1 view .LVU6
+	movl	$0, %edx	#,
+	leaq	fork_mask(%rip), %rsi	#, tmp83
+	movl	$2, %edi	#,
+	call	pthread_sigmask@PLT	#
+.LVL1:
+# report.c:186: }
+	.loc 1 186 1 is_stmt 0 view .LVU7
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE32:
+	.size	fork_child, .-fork_child
+	.type	fork_parent, @function
+fork_parent:
+.LFB31:
+	.loc 1 175 1 is_stmt 1 view -0
+	.cfi_startproc
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 176 5 view .LVU9
+	leaq	drain_lock(%rip), %rdi	#, tmp82
+	call	pthread_mutex_unlock@PLT	#
+.LVL2:
+	.loc 1 177 5 view .LVU10
+	movl	$0, %edx	#,
+	leaq	fork_mask(%rip), %rsi	#, tmp83
+	movl	$2, %edi	#,
+	call	pthread_sigmask@PLT	#
+.LVL3:
+# report.c:178: }
+	.loc 1 178 1 is_stmt 0 view .LVU11
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE31:
+	.size	fork_parent, .-fork_parent
+	.type	rings_pending, @function
+rings_pending:
+.LFB33:
+	.loc 1 189 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 190 5 view .LVU13
+.LBB2:
+	.loc 1 190 10 view .LVU14
+.LVL4:
+	.loc 1 190 23 view .LVU15
+	.loc 1 191 9 view .LVU16
+.LBB3:
+	.loc 1 191 13 view .LVU17
+	.loc 1 191 13 view .LVU18
+	.loc 1 191 13 view .LVU19
+	movq	rings(%rip), %rax	# rings[0], rings[0]
+	movq	8(%rax), %rdx	#, _22
+.LVL5:
+	.loc 1 191 13 view .LVU20
+.LBE3:
+.LBB4:
+	.loc 1 191 45 view .LVU21
+	.loc 1 191 45 view .LVU22
+	.loc 1 191 45 view .LVU23
+	movq	rings(%rip), %rax	# rings[0], rings[0]
+	movq	16(%rax), %rax	#, _26
+.LVL6:
+	.loc 1 191 45 view .LVU24
+.LBE4:
+# report.c:191:         if (atomic_load(&rings[i]->head) != atomic_load(&rings[i]->tail))
+	.loc 1 191 12 is_stmt 0 view .LVU25
+	cmpq	%rax, %rdx	# _26, _22
+	jne	.L6	#,
+	.loc 1 190 34 is_stmt 1 view .LVU26
+.LVL7:
+	.loc 1 190 23 view .LVU27
+	.loc 1 191 9 view .LVU28
+.LBB5:
+	.loc 1 191 13 view .LVU29
+	.loc 1 191 13 view .LVU30
+	.loc 1 191 13 view .LVU31
+	movq	8+rings(%rip), %rax	# rings[1], rings[1]
+.LVL8:
+	.loc 1 191 13 is_stmt 0 view .LVU32
+	movq	8(%rax), %rcx	#, _2
+.LVL9:
+	.loc 1 191 13 is_stmt 1 view .LVU33
+.LBE5:
+.LBB6:
+	.loc 1 191 45 view .LVU34
+	.loc 1 191 45 view .LVU35
+	.loc 1 191 45 view .LVU36
+	movq	8+rings(%rip), %rax	# rings[1], rings[1]
+	movq	16(%rax), %rdx	#, _4
+.LVL10:
+	.loc 1 191 45 view .LVU37
+.LBE6:
+.LBE2:
+# report.c:194:     return false;
+	.loc 1 194 12 is_stmt 0 view .LVU38
+	movl	$0, %eax	#, <retval>
+.LBB7:
+# report.c:191:         if (atomic_load(&rings[i]->head) != atomic_load(&rings[i]->tail))
+	.loc 1 191 12 view .LVU39
+	cmpq	%rdx, %rcx	# _4, _2
+	jne	.L6	#,
+.LVL11:
+.L5:
+	.loc 1 191 12 view .LVU40
+.LBE7:
+# report.c:195: }
+	.loc 1 195 1 view .LVU41
+	ret	
+.L6:
+.LBB8:
+# report.c:192:             return true;
+	.loc 1 192 20 view .LVU42
+	movl	$1, %eax	#, <retval>
+	jmp	.L5	#
+.LBE8:
+	.cfi_endproc
+.LFE33:
+	.size	rings_pending, .-rings_pending
+	.type	ring_has_room, @function
+ring_has_room:
+.LFB36:
+	.loc 1 249 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 250 5 view .LVU44
+.LBB9:
+	.loc 1 250 19 view .LVU45
+.LVL12:
+	.loc 1 250 19 view .LVU46
+	.loc 1 250 19 view .LVU47
+	movq	put_ring(%rip), %rax	# put_ring, put_ring
+	movq	8(%rax), %rax	#, _2
+.LVL13:
+	.loc 1 250 19 view .LVU48
+	.loc 1 250 19 is_stmt 0 view .LVU49
+.LBE9:
+	.loc 1 251 5 is_stmt 1 view .LVU50
+# report.c:251:     return head + put_len - atomic_load(&put_ring->tail) <= RING_SIZE;
+	.loc 1 251 17 is_stmt 0 view .LVU51
+	addq	put_len(%rip), %rax	# put_len, _4
+.LVL14:
+.LBB10:
+	.loc 1 251 29 is_stmt 1 view .LVU52
+	.loc 1 251 29 view .LVU53
+	.loc 1 251 29 view .LVU54
+	movq	put_ring(%rip), %rdx	# put_ring, put_ring
+	movq	16(%rdx), %rdx	#, _6
+.LVL15:
+	.loc 1 251 29 view .LVU55
+.LBE10:
+# report.c:251:     return head + put_len - atomic_load(&put_ring->tail) <= RING_SIZE;
+	.loc 1 251 27 is_stmt 0 view .LVU56
+	subq	%rdx, %rax	# _6, tmp96
+# report.c:251:     return head + put_len - atomic_load(&put_ring->tail) <= RING_SIZE;
+	.loc 1 251 58 view .LVU57
+	cmpq	$1048576, %rax	#, tmp96
+	setbe	%al	#, tmp97
+# report.c:252: }
+	.loc 1 252 1 view .LVU58
+	ret	
+	.cfi_endproc
+.LFE36:
+	.size	ring_has_room, .-ring_has_room
+	.type	drain_ring, @function
+drain_ring:
+.LVL16:
+.LFB26:
+	.loc 1 96 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 96 1 is_stmt 0 view .LVU60
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 80
+	.loc 1 97 5 is_stmt 1 view .LVU61
+.LBB11:
+	.loc 1 97 19 view .LVU62
+.LVL17:
+	.loc 1 97 19 view .LVU63
+	.loc 1 97 19 view .LVU64
+	movq	8(%rdi), %r12	#, _1
+.LVL18:
+	.loc 1 97 19 view .LVU65
+	.loc 1 97 19 is_stmt 0 view .LVU66
+.LBE11:
+	.loc 1 98 5 is_stmt 1 view .LVU67
+.LBB12:
+	.loc 1 98 19 view .LVU68
+	.loc 1 98 19 view .LVU69
+	.loc 1 98 19 view .LVU70
+	movq	16(%rdi), %rbp	#, tail
+.LVL19:
+	.loc 1 98 19 view .LVU71
+	.loc 1 98 19 is_stmt 0 view .LVU72
+.LBE12:
+	.loc 1 99 5 is_stmt 1 view .LVU73
+# report.c:99:     bool wrote = tail != head;
+	.loc 1 99 10 is_stmt 0 view .LVU74
+	cmpq	%rbp, %r12	# tail, _1
+	setne	15(%rsp)	#, %sfp
+.LVL20:
+	.loc 1 100 5 is_stmt 1 view .LVU75
+	.loc 1 100 17 view .LVU76
+	je	.L10	#,
+	movq	%rdi, %r13	# tmp107, r
+	leaq	16(%rdi), %r15	#, __atomic_load_ptr
+.LVL21:
+.LBB13:
+# report.c:103:         if (chunk > RING_SIZE - pos)
+	.loc 1 103 31 is_stmt 0 view .LVU77
+	movl	$1048576, %r14d	#, tmp102
+	jmp	.L16	#
+.LVL22:
+.L20:
+# report.c:105:         ssize_t n = r->fd >= 0 ? write(r->fd, r->buf + pos, chunk) : -1;
+	.loc 1 105 34 discriminator 1 view .LVU78
+	leaq	24(%r13,%rdx), %rsi	#, tmp105
+	movq	%rbx, %rdx	# iftmp.8_11,
+.LVL23:
+	.loc 1 105 34 discriminator 1 view .LVU79
+	call	write@PLT	#
+.LVL24:
+	.loc 1 106 9 is_stmt 1 discriminator 1 view .LVU80
+# report.c:106:         if (n < 0 && errno == EINTR)
+	.loc 1 106 12 is_stmt 0 discriminator 1 view .LVU81
+	testq	%rax, %rax	# iftmp.7_29
+	js	.L19	#,
+	.loc 1 109 9 is_stmt 1 view .LVU82
+# report.c:109:         tail += n > 0 ? (size_t) n : chunk;
+	.loc 1 109 36 is_stmt 0 view .LVU83
+	cmovg	%rax, %rbx	# iftmp.8_11,, iftmp.7_29, iftmp.8_11
+.LVL25:
+.L15:
+# report.c:109:         tail += n > 0 ? (size_t) n : chunk;
+	.loc 1 109 14 discriminator 4 view .LVU84
+	addq	%rbx, %rbp	# iftmp.8_11, tail
+.LVL26:
+	.loc 1 110 9 is_stmt 1 discriminator 4 view .LVU85
+.LBB14:
+	.loc 1 110 9 discriminator 4 view .LVU86
+	.loc 1 110 9 discriminator 4 view .LVU87
+	.loc 1 110 9 discriminator 4 view .LVU88
+	movq	%rbp, (%r15)	#, tail,* __atomic_load_ptr
+.LVL27:
+.L14:
+	.loc 1 110 9 is_stmt 0 discriminator 4 view .LVU89
+.LBE14:
+.LBE13:
+	.loc 1 100 17 is_stmt 1 view .LVU90
+	cmpq	%rbp, %r12	# tail, _1
+	je	.L10	#,
+.LVL28:
+.L16:
+.LBB15:
+	.loc 1 101 9 view .LVU91
+# report.c:101:         size_t pos = tail % RING_SIZE;
+	.loc 1 101 16 is_stmt 0 view .LVU92
+	movq	%rbp, %rdx	# tail, pos
+	andl	$1048575, %edx	#, pos
+.LVL29:
+	.loc 1 102 9 is_stmt 1 view .LVU93
+	.loc 1 103 9 view .LVU94
+# report.c:103:         if (chunk > RING_SIZE - pos)
+	.loc 1 103 31 is_stmt 0 view .LVU95
+	movq	%r14, %rbx	# tmp102, tmp101
+	subq	%rdx, %rbx	# pos, tmp101
+# report.c:102:         size_t chunk = head - tail;
+	.loc 1 102 16 view .LVU96
+	movq	%r12, %rax	# _1, chunk
+	subq	%rbp, %rax	# tail, chunk
+.LVL30:
+	.loc 1 102 16 view .LVU97
+	cmpq	%rax, %rbx	# chunk, tmp101
+	cmova	%rax, %rbx	# tmp101,, chunk, iftmp.8_11
+.LVL31:
+	.loc 1 105 9 is_stmt 1 view .LVU98
+# report.c:105:         ssize_t n = r->fd >= 0 ? write(r->fd, r->buf + pos, chunk) : -1;
+	.loc 1 105 22 is_stmt 0 view .LVU99
+	movl	0(%r13), %edi	# r_13(D)->fd, _4
+# report.c:105:         ssize_t n = r->fd >= 0 ? write(r->fd, r->buf + pos, chunk) : -1;
+	.loc 1 105 68 view .LVU100
+	testl	%edi, %edi	# _4
+	jns	.L20	#,
+# report.c:106:         if (n < 0 && errno == EINTR)
+	.loc 1 106 22 view .LVU101
+	call	__errno_location@PLT	#
+.LVL32:
+# report.c:106:         if (n < 0 && errno == EINTR)
+	.loc 1 106 19 view .LVU102
+	cmpl	$4, (%rax)	#, *_38
+	jne	.L15	#,
+	jmp	.L14	#
+.LVL33:
+.L19:
+# report.c:106:         if (n < 0 && errno == EINTR)
+	.loc 1 106 22 discriminator 1 view .LVU103
+	call	__errno_location@PLT	#
+.LVL34:
+# report.c:106:         if (n < 0 && errno == EINTR)
+	.loc 1 106 19 discriminator 1 view .LVU104
+	cmpl	$4, (%rax)	#, *_7
+	jne	.L15	#,
+	jmp	.L14	#
+.LVL35:
+.L10:
+	.loc 1 106 19 discriminator 1 view .LVU105
+.LBE15:
+# report.c:113: }
+	.loc 1 113 1 view .LVU106
+	movzbl	15(%rsp), %eax	# %sfp,
+	addq	$24, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL36:
+	.loc 1 113 1 view .LVU107
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL37:
+	.loc 1 113 1 view .LVU108
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE26:
+	.size	drain_ring, .-drain_ring
+	.type	drain_rings_signal, @function
+drain_rings_signal:
+.LFB28:
+	.loc 1 133 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 48
+	.loc 1 134 5 view .LVU110
+# report.c:134:     struct timespec pause = {0, 1000000};
+	.loc 1 134 21 is_stmt 0 view .LVU111
+	movq	$0, (%rsp)	#, pause.tv_sec
+	movq	$1000000, 8(%rsp)	#, pause.tv_nsec
+	.loc 1 135 5 is_stmt 1 view .LVU112
+.LBB16:
+	.loc 1 135 10 view .LVU113
+.LVL38:
+	.loc 1 135 31 view .LVU114
+.LBE16:
+# report.c:134:     struct timespec pause = {0, 1000000};
+	.loc 1 134 21 is_stmt 0 view .LVU115
+	movl	$1000, %ebx	#, ivtmp_20
+.LBB18:
+# report.c:136:         if (pthread_mutex_trylock(&drain_lock) == 0) {
+	.loc 1 136 13 view .LVU116
+	leaq	drain_lock(%rip), %rbp	#, tmp86
+.LVL39:
+.L24:
+	.loc 1 136 9 is_stmt 1 view .LVU117
+# report.c:136:         if (pthread_mutex_trylock(&drain_lock) == 0) {
+	.loc 1 136 13 is_stmt 0 view .LVU118
+	movq	%rbp, %rdi	# tmp86,
+	call	pthread_mutex_trylock@PLT	#
+.LVL40:
+# report.c:136:         if (pthread_mutex_trylock(&drain_lock) == 0) {
+	.loc 1 136 12 view .LVU119
+	testl	%eax, %eax	# tmp93
+	je	.L27	#,
+	.loc 1 142 9 is_stmt 1 discriminator 2 view .LVU120
+	movq	%rsp, %rdi	#, tmp92
+	movl	$0, %esi	#,
+	call	nanosleep@PLT	#
+.LVL41:
+	.loc 1 135 58 discriminator 2 view .LVU121
+	.loc 1 135 31 discriminator 2 view .LVU122
+	subl	$1, %ebx	#, ivtmp_20
+.LVL42:
+	.loc 1 135 31 is_stmt 0 discriminator 2 view .LVU123
+	jne	.L24	#,
+	jmp	.L21	#
+.L27:
+.LVL43:
+.LBB17:
+	.loc 1 138 17 is_stmt 1 view .LVU124
+	movq	rings(%rip), %rdi	# rings[0],
+	call	drain_ring	#
+.LVL44:
+	.loc 1 137 42 view .LVU125
+	.loc 1 137 31 view .LVU126
+	.loc 1 138 17 view .LVU127
+	movq	8+rings(%rip), %rdi	# rings[1],
+	call	drain_ring	#
+.LVL45:
+	.loc 1 137 42 view .LVU128
+	.loc 1 137 31 view .LVU129
+.LBE17:
+	.loc 1 139 13 view .LVU130
+	leaq	drain_lock(%rip), %rdi	#, tmp91
+	call	pthread_mutex_unlock@PLT	#
+.LVL46:
+	.loc 1 140 13 view .LVU131
+.L21:
+	.loc 1 140 13 is_stmt 0 view .LVU132
+.LBE18:
+# report.c:144: }
+	.loc 1 144 1 view .LVU133
+	addq	$24, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE28:
+	.size	drain_rings_signal, .-drain_rings_signal
+	.type	drain_rings, @function
+drain_rings:
+.LFB27:
+	.loc 1 116 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 117 5 view .LVU135
+.LVL47:
+	.loc 1 118 5 view .LVU136
+	leaq	drain_lock(%rip), %rbp	#, tmp87
+	movq	%rbp, %rdi	# tmp87,
+	call	pthread_mutex_lock@PLT	#
+.LVL48:
+	.loc 1 119 5 view .LVU137
+.LBB19:
+	.loc 1 119 10 view .LVU138
+	.loc 1 119 23 view .LVU139
+	.loc 1 120 9 view .LVU140
+# report.c:120:         wrote = drain_ring(rings[i]) || wrote;
+	.loc 1 120 17 is_stmt 0 view .LVU141
+	movq	rings(%rip), %rdi	# rings[0],
+	call	drain_ring	#
+.LVL49:
+	movl	%eax, %ebx	# tmp94, _15
+.LVL50:
+	.loc 1 119 34 is_stmt 1 view .LVU142
+	.loc 1 119 23 view .LVU143
+	.loc 1 120 9 view .LVU144
+# report.c:120:         wrote = drain_ring(rings[i]) || wrote;
+	.loc 1 120 17 is_stmt 0 view .LVU145
+	movq	8+rings(%rip), %rdi	# rings[1],
+	call	drain_ring	#
+.LVL51:
+	.loc 1 120 17 view .LVU146
+	orl	%eax, %ebx	# tmp95, <retval>
+.LVL52:
+	.loc 1 119 34 is_stmt 1 view .LVU147
+	.loc 1 119 23 view .LVU148
+.LBE19:
+	.loc 1 121 5 view .LVU149
+	movq	%rbp, %rdi	# tmp87,
+	call	pthread_mutex_unlock@PLT	#
+.LVL53:
+	.loc 1 122 5 view .LVU150
+# report.c:123: }
+	.loc 1 123 1 is_stmt 0 view .LVU151
+	movl	%ebx, %eax	# <retval>,
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL54:
+	.loc 1 123 1 view .LVU152
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE27:
+	.size	drain_rings, .-drain_rings
+	.globl	report_flush
+	.type	report_flush, @function
+report_flush:
+.LFB39:
+	.loc 1 345 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$264, %rsp	#,
+	.cfi_def_cfa_offset 288
+	.loc 1 346 5 view .LVU154
+# report.c:346:     if (writer_started)
+	.loc 1 346 8 is_stmt 0 view .LVU155
+	cmpb	$0, writer_started(%rip)	#, writer_started
+	jne	.L36	#,
+.L31:
+	.loc 1 349 5 is_stmt 1 view .LVU156
+# report.c:349:     if (in_signal)
+	.loc 1 349 9 is_stmt 0 view .LVU157
+	movl	in_signal(%rip), %eax	# in_signal, in_signal.1_2
+# report.c:349:     if (in_signal)
+	.loc 1 349 8 view .LVU158
+	testl	%eax, %eax	# in_signal.1_2
+	jne	.L30	#,
+	.loc 1 351 5 is_stmt 1 view .LVU159
+# report.c:351:     if (verbfile)
+	.loc 1 351 9 is_stmt 0 view .LVU160
+	movq	verbfile(%rip), %rdi	# verbfile, verbfile.2_3
+# report.c:351:     if (verbfile)
+	.loc 1 351 8 view .LVU161
+	testq	%rdi, %rdi	# verbfile.2_3
+	je	.L34	#,
+	.loc 1 352 9 is_stmt 1 view .LVU162
+	call	fflush@PLT	#
+.LVL55:
+.L34:
+	.loc 1 353 5 view .LVU163
+# report.c:353:     if (logfile)
+	.loc 1 353 9 is_stmt 0 view .LVU164
+	movq	logfile(%rip), %rdi	# logfile, logfile.4_4
+# report.c:353:     if (logfile)
+	.loc 1 353 8 view .LVU165
+	testq	%rdi, %rdi	# logfile.4_4
+	je	.L30	#,
+	.loc 1 354 9 is_stmt 1 view .LVU166
+	call	fflush@PLT	#
+.LVL56:
+.L30:
+# report.c:355: }
+	.loc 1 355 1 is_stmt 0 view .LVU167
+	addq	$264, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.L36:
+	.cfi_restore_state
+	.loc 1 347 9 is_stmt 1 view .LVU168
+.LBB22:
+.LBI22:
+	.loc 1 147 13 view .LVU169
+.LBB23:
+	.loc 1 149 5 view .LVU170
+# report.c:149:     if (in_signal) {
+	.loc 1 149 9 is_stmt 0 view .LVU171
+	movl	in_signal(%rip), %eax	# in_signal, in_signal.6_12
+# report.c:149:     if (in_signal) {
+	.loc 1 149 8 view .LVU172
+	testl	%eax, %eax	# in_signal.6_12
+	jne	.L37	#,
+	.loc 1 153 5 is_stmt 1 view .LVU173
+	.loc 1 154 5 view .LVU174
+	movq	%rsp, %rbp	#, tmp87
+	movq	%rbp, %rdi	# tmp87,
+	call	sigfillset@PLT	#
+.LVL57:
+	.loc 1 155 5 view .LVU175
+	leaq	128(%rsp), %rbx	#, tmp88
+	movq	%rbx, %rdx	# tmp88,
+	movq	%rbp, %rsi	# tmp87,
+	movl	$2, %edi	#,
+	call	pthread_sigmask@PLT	#
+.LVL58:
+	.loc 1 156 5 view .LVU176
+	movl	$0, %eax	#,
+	call	drain_rings	#
+.LVL59:
+	.loc 1 157 5 view .LVU177
+	movl	$0, %edx	#,
+	movq	%rbx, %rsi	# tmp88,
+	movl	$2, %edi	#,
+	call	pthread_sigmask@PLT	#
+.LVL60:
+	jmp	.L31	#
+.L37:
+	.loc 1 150 9 view .LVU178
+	movl	$0, %eax	#,
+	call	drain_rings_signal	#
+.LVL61:
+	.loc 1 151 9 view .LVU179
+	jmp	.L31	#
+.LBE23:
+.LBE22:
+	.cfi_endproc
+.LFE39:
+	.size	report_flush, .-report_flush
+	.type	fork_prepare, @function
+fork_prepare:
+.LFB30:
+	.loc 1 167 1 view -0
+	.cfi_startproc
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	addq	$-128, %rsp	#,
+	.cfi_def_cfa_offset 144
+	.loc 1 168 5 view .LVU181
+	.loc 1 169 5 view .LVU182
+	movq	%rsp, %rbx	#, tmp82
+	movq	%rbx, %rdi	# tmp82,
+	call	sigfillset@PLT	#
+.LVL62:
+	.loc 1 170 5 view .LVU183
+	leaq	fork_mask(%rip), %rdx	#, tmp84
+	movq	%rbx, %rsi	# tmp82,
+	movl	$2, %edi	#,
+	call	pthread_sigmask@PLT	#
+.LVL63:
+	.loc 1 171 5 view .LVU184
+	leaq	drain_lock(%rip), %rdi	#, tmp85
+	call	pthread_mutex_lock@PLT	#
+.LVL64:
+# report.c:172: }
+	.loc 1 172 1 is_stmt 0 view .LVU185
+	subq	$-128, %rsp	#,
+	.cfi_def_cfa_offset 16
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE30:
+	.size	fork_prepare, .-fork_prepare
+	.type	default_fatal_fun, @function
+default_fatal_fun:
+.LFB42:
+	.loc 1 374 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 375 5 view .LVU187
+# report.c:375:     ret = write(STDOUT_FILENO, fail_buf, strlen(fail_buf) + 1);
+	.loc 1 375 42 is_stmt 0 view .LVU188
+	leaq	fail_buf(%rip), %rbx	#, tmp88
+	movq	%rbx, %rdi	# tmp88,
+	call	strlen@PLT	#
+.LVL65:
+# report.c:375:     ret = write(STDOUT_FILENO, fail_buf, strlen(fail_buf) + 1);
+	.loc 1 375 11 view .LVU189
+	leaq	1(%rax), %rdx	#, tmp91
+	movq	%rbx, %rsi	# tmp88,
+	movl	$1, %edi	#,
+	call	write@PLT	#
+.LVL66:
+# report.c:375:     ret = write(STDOUT_FILENO, fail_buf, strlen(fail_buf) + 1);
+	.loc 1 375 9 view .LVU190
+	movl	%eax, ret(%rip)	# _3, ret
+	.loc 1 376 5 is_stmt 1 view .LVU191
+# report.c:376:     if (logfile)
+	.loc 1 376 9 is_stmt 0 view .LVU192
+	movq	logfile(%rip), %rsi	# logfile, logfile.29_5
+# report.c:376:     if (logfile)
+	.loc 1 376 8 view .LVU193
+	testq	%rsi, %rsi	# logfile.29_5
+	je	.L40	#,
+	.loc 1 377 9 is_stmt 1 view .LVU194
+	movq	%rbx, %rdi	#, tmp93
+	call	fputs@PLT	#
+.LVL67:
+.L40:
+# report.c:378: }
+	.loc 1 378 1 is_stmt 0 view .LVU195
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE42:
+	.size	default_fatal_fun, .-default_fatal_fun
+	.type	wake, @function
+wake:
+.LVL68:
+.LFB24:
+	.loc 1 77 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 78 5 view .LVU197
+	lock orq	$0, (%rsp)	#
+	.loc 1 79 5 view .LVU198
+.LBB24:
+	.loc 1 79 9 view .LVU199
+.LVL69:
+	.loc 1 79 9 view .LVU200
+	.loc 1 79 9 view .LVU201
+	.loc 1 79 9 view .LVU202
+	movl	$0, %edx	#, tmp86
+	xchgb	(%rdi), %dl	#,* waiting, _1
+.LVL70:
+	.loc 1 79 9 view .LVU203
+.LBE24:
+# report.c:79:     if (atomic_exchange(waiting, false))
+	.loc 1 79 8 is_stmt 0 view .LVU204
+	testb	%dl, %dl	# _1
+	jne	.L49	#,
+	ret	
+.L49:
+# report.c:77: {
+	.loc 1 77 1 view .LVU205
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	movl	%esi, %edi	# tmp88, fd
+.LVL71:
+	.loc 1 80 9 is_stmt 1 view .LVU206
+	movl	$1, %esi	#,
+.LVL72:
+	.loc 1 80 9 is_stmt 0 view .LVU207
+	call	eventfd_write@PLT	#
+.LVL73:
+# report.c:81: }
+	.loc 1 81 1 view .LVU208
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE24:
+	.size	wake, .-wake
+	.type	wait_for, @function
+wait_for:
+.LVL74:
+.LFB25:
+	.loc 1 85 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 85 1 is_stmt 0 view .LVU210
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx	# tmp91, waiting
+	movl	%esi, %ebp	# tmp92, fd
+	.loc 1 86 5 is_stmt 1 view .LVU211
+	.loc 1 87 5 view .LVU212
+.LBB25:
+	.loc 1 87 5 view .LVU213
+.LVL75:
+	.loc 1 87 5 view .LVU214
+	.loc 1 87 5 view .LVU215
+	movl	$1, %eax	#, tmp86
+	xchgb	(%rdi), %al	#,* waiting, tmp87
+.LBE25:
+	.loc 1 88 5 view .LVU216
+	lock orq	$0, (%rsp)	#
+	.loc 1 89 5 view .LVU217
+# report.c:89:     if (!ready())
+	.loc 1 89 10 is_stmt 0 view .LVU218
+	movl	$0, %eax	#,
+	call	*%rdx	# ready
+.LVL76:
+# report.c:89:     if (!ready())
+	.loc 1 89 8 view .LVU219
+	testb	%al, %al	# tmp94
+	je	.L53	#,
+.L51:
+	.loc 1 91 5 is_stmt 1 view .LVU220
+.LBB26:
+	.loc 1 91 5 view .LVU221
+.LVL77:
+	.loc 1 91 5 view .LVU222
+	.loc 1 91 5 view .LVU223
+	movl	$0, %eax	#, tmp89
+	xchgb	(%rbx), %al	#,* waiting, tmp90
+.LBE26:
+# report.c:92: }
+	.loc 1 92 1 is_stmt 0 view .LVU224
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL78:
+	.loc 1 92 1 view .LVU225
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL79:
+	.loc 1 92 1 view .LVU226
+	ret	
+.LVL80:
+.L53:
+	.cfi_restore_state
+	.loc 1 90 9 is_stmt 1 view .LVU227
+	leaq	8(%rsp), %rsi	#, tmp88
+	movl	%ebp, %edi	# fd,
+	call	eventfd_read@PLT	#
+.LVL81:
+	jmp	.L51	#
+	.cfi_endproc
+.LFE25:
+	.size	wait_for, .-wait_for
+	.type	writer_main, @function
+writer_main:
+.LVL82:
+.LFB34:
+	.loc 1 198 1 view -0
+	.cfi_startproc
+	.loc 1 198 1 is_stmt 0 view .LVU229
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+# report.c:205:         wait_for(&writer_waiting, data_fd, rings_pending);
+	.loc 1 205 9 view .LVU230
+	leaq	rings_pending(%rip), %r12	#, tmp92
+	leaq	writer_waiting(%rip), %rbp	#, tmp93
+# report.c:201:             wake(&producer_waiting, space_fd);
+	.loc 1 201 13 view .LVU231
+	leaq	producer_waiting(%rip), %rbx	#, tmp94
+	jmp	.L55	#
+.LVL83:
+.L59:
+	.loc 1 201 13 is_stmt 1 discriminator 1 view .LVU232
+	movl	space_fd(%rip), %esi	# space_fd,
+	movq	%rbx, %rdi	# tmp94,
+	call	wake	#
+.LVL84:
+	.loc 1 202 13 discriminator 1 view .LVU233
+	movl	$1000, %edi	#,
+	call	usleep@PLT	#
+.LVL85:
+	.loc 1 203 13 discriminator 1 view .LVU234
+.L55:
+	.loc 1 199 5 view .LVU235
+	.loc 1 200 9 view .LVU236
+# report.c:200:         if (drain_rings()) {
+	.loc 1 200 13 is_stmt 0 view .LVU237
+	movl	$0, %eax	#,
+	call	drain_rings	#
+.LVL86:
+# report.c:200:         if (drain_rings()) {
+	.loc 1 200 12 view .LVU238
+	testb	%al, %al	# tmp95
+	jne	.L59	#,
+	.loc 1 205 9 is_stmt 1 view .LVU239
+	movq	%r12, %rdx	# tmp92,
+	movl	data_fd(%rip), %esi	# data_fd,
+	movq	%rbp, %rdi	# tmp93,
+	call	wait_for	#
+.LVL87:
+	jmp	.L55	#
+	.cfi_endproc
+.LFE34:
+	.size	writer_main, .-writer_main
+	.type	ring_put, @function
+ring_put:
+.LVL88:
+.LFB37:
+	.loc 1 256 1 view -0
+	.cfi_startproc
+	.loc 1 256 1 is_stmt 0 view .LVU241
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+	movq	%rdi, %r12	# tmp125, r
+	movq	%rsi, %rbp	# tmp126, data
+	movq	%rdx, %rbx	# tmp127, len
+	.loc 1 257 5 is_stmt 1 view .LVU242
+# report.c:257:     if (len > RING_SIZE) {
+	.loc 1 257 8 is_stmt 0 view .LVU243
+	cmpq	$1048576, %rdx	#, len
+	jbe	.L61	#,
+	.loc 1 258 9 is_stmt 1 view .LVU244
+	movl	$0, %eax	#,
+	call	report_flush	#
+.LVL89:
+	.loc 1 259 9 view .LVU245
+	.loc 1 259 20 view .LVU246
+.L63:
+.LBB27:
+	.loc 1 260 13 view .LVU247
+# report.c:260:             ssize_t n = write(r->fd, data, len);
+	.loc 1 260 25 is_stmt 0 view .LVU248
+	movl	(%r12), %edi	# r_19(D)->fd, r_19(D)->fd
+	movq	%rbx, %rdx	# len,
+	movq	%rbp, %rsi	# data,
+	call	write@PLT	#
+.LVL90:
+	.loc 1 261 13 is_stmt 1 view .LVU249
+# report.c:261:             if (n <= 0)
+	.loc 1 261 16 is_stmt 0 view .LVU250
+	testq	%rax, %rax	# n
+	jle	.L60	#,
+	.loc 1 263 13 is_stmt 1 view .LVU251
+# report.c:263:             data += n;
+	.loc 1 263 18 is_stmt 0 view .LVU252
+	addq	%rax, %rbp	# n, data
+.LVL91:
+	.loc 1 264 13 is_stmt 1 view .LVU253
+	.loc 1 264 13 is_stmt 0 view .LVU254
+.LBE27:
+	.loc 1 259 20 is_stmt 1 view .LVU255
+	subq	%rax, %rbx	# n, len
+.LVL92:
+	.loc 1 259 20 is_stmt 0 view .LVU256
+	jne	.L63	#,
+	jmp	.L60	#
+.LVL93:
+.L61:
+	.loc 1 269 5 is_stmt 1 view .LVU257
+.LBB28:
+	.loc 1 269 19 view .LVU258
+	.loc 1 269 19 view .LVU259
+	.loc 1 269 19 view .LVU260
+	movq	8(%rdi), %r14	#, _3
+.LVL94:
+	.loc 1 269 19 view .LVU261
+	.loc 1 269 19 is_stmt 0 view .LVU262
+.LBE28:
+	.loc 1 270 5 is_stmt 1 view .LVU263
+# report.c:270:     put_ring = r;
+	.loc 1 270 14 is_stmt 0 view .LVU264
+	movq	%rdi, put_ring(%rip)	# r, put_ring
+	.loc 1 271 5 is_stmt 1 view .LVU265
+# report.c:271:     put_len = len;
+	.loc 1 271 13 is_stmt 0 view .LVU266
+	movq	%rdx, put_len(%rip)	# len, put_len
+	.loc 1 272 5 is_stmt 1 view .LVU267
+# report.c:273:         wait_for(&producer_waiting, space_fd, ring_has_room);
+	.loc 1 273 9 is_stmt 0 view .LVU268
+	leaq	ring_has_room(%rip), %r15	#, tmp123
+	leaq	producer_waiting(%rip), %r13	#, tmp124
+# report.c:272:     while (!ring_has_room())
+	.loc 1 272 11 view .LVU269
+	jmp	.L64	#
+.LVL95:
+.L65:
+	.loc 1 273 9 is_stmt 1 view .LVU270
+	movq	%r15, %rdx	# tmp123,
+	movl	space_fd(%rip), %esi	# space_fd,
+	movq	%r13, %rdi	# tmp124,
+	call	wait_for	#
+.LVL96:
+.L64:
+	.loc 1 272 12 view .LVU271
+# report.c:272:     while (!ring_has_room())
+	.loc 1 272 13 is_stmt 0 view .LVU272
+	movl	$0, %eax	#,
+	call	ring_has_room	#
+.LVL97:
+# report.c:272:     while (!ring_has_room())
+	.loc 1 272 12 view .LVU273
+	testb	%al, %al	# tmp129
+	je	.L65	#,
+	.loc 1 275 5 is_stmt 1 view .LVU274
+# report.c:275:     size_t pos = head % RING_SIZE;
+	.loc 1 275 12 is_stmt 0 view .LVU275
+	movq	%r14, %rdi	# _3, pos
+	andl	$1048575, %edi	#, pos
+.LVL98:
+	.loc 1 276 5 is_stmt 1 view .LVU276
+# report.c:276:     size_t first = len < RING_SIZE - pos ? len : RING_SIZE - pos;
+	.loc 1 276 36 is_stmt 0 view .LVU277
+	movl	$1048576, %r15d	#, tmp106
+	subq	%rdi, %r15	# pos, tmp105
+# report.c:276:     size_t first = len < RING_SIZE - pos ? len : RING_SIZE - pos;
+	.loc 1 276 12 view .LVU278
+	cmpq	%rbx, %r15	# len, tmp105
+	cmova	%rbx, %r15	# tmp105,, len, first
+.LVL99:
+	.loc 1 277 5 is_stmt 1 view .LVU279
+# report.c:277:     memcpy(r->buf + pos, data, first);
+	.loc 1 277 12 is_stmt 0 view .LVU280
+	leaq	24(%r12), %r13	#, _7
+# report.c:277:     memcpy(r->buf + pos, data, first);
+	.loc 1 277 5 view .LVU281
+	addq	%r13, %rdi	# _7, tmp107
+.LVL100:
+	.loc 1 277 5 view .LVU282
+	movq	%r15, %rdx	# first,
+	movq	%rbp, %rsi	# data,
+	call	memcpy@PLT	#
+.LVL101:
+	.loc 1 278 5 is_stmt 1 view .LVU283
+	movq	%rbx, %rdx	# len, tmp113
+	subq	%r15, %rdx	# first, tmp113
+# report.c:278:     memcpy(r->buf, data + first, len - first);
+	.loc 1 278 25 is_stmt 0 view .LVU284
+	leaq	0(%rbp,%r15), %rsi	#, tmp114
+# report.c:278:     memcpy(r->buf, data + first, len - first);
+	.loc 1 278 5 view .LVU285
+	movq	%r13, %rdi	# _7,
+	call	memcpy@PLT	#
+.LVL102:
+	.loc 1 279 5 is_stmt 1 view .LVU286
+.LBB29:
+	.loc 1 279 5 view .LVU287
+	.loc 1 279 5 view .LVU288
+	.loc 1 279 5 view .LVU289
+	addq	%rbx, %r14	# len, tmp120
+.LVL103:
+	.loc 1 279 5 is_stmt 0 view .LVU290
+	movq	%r14, 8(%r12)	#, tmp120,
+.LBE29:
+	.loc 1 280 5 is_stmt 1 view .LVU291
+	movl	data_fd(%rip), %esi	# data_fd,
+	leaq	writer_waiting(%rip), %rdi	#, tmp122
+	call	wake	#
+.LVL104:
+.L60:
+# report.c:281: }
+	.loc 1 281 1 is_stmt 0 view .LVU292
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL105:
+	.loc 1 281 1 view .LVU293
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL106:
+	.loc 1 281 1 view .LVU294
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE37:
+	.size	ring_put, .-ring_put
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"%s"
+.LC1:
+	.string	"\n"
+	.text
+	.type	emit, @function
+emit:
+.LVL107:
+.LFB38:
+	.loc 1 295 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 295 1 is_stmt 0 view .LVU296
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$4312, %rsp	#,
+	.cfi_def_cfa_offset 4368
+	movq	%rdi, %r12	# tmp174, file
+	movl	%esi, 12(%rsp)	# tmp175, %sfp
+	movq	%rdx, %rbp	# tmp176, prefix
+	movq	%rcx, %r13	# tmp177, fmt
+	movq	%r8, %rbx	# tmp178, ap
+	movl	%r9d, %r14d	# tmp179, newline
+	.loc 1 296 5 is_stmt 1 view .LVU297
+# report.c:296:     if (in_signal) {
+	.loc 1 296 9 is_stmt 0 view .LVU298
+	movl	in_signal(%rip), %eax	# in_signal, in_signal.31_1
+# report.c:296:     if (in_signal) {
+	.loc 1 296 8 view .LVU299
+	testl	%eax, %eax	# in_signal.31_1
+	jne	.L89	#,
+	.loc 1 311 5 is_stmt 1 view .LVU300
+# report.c:311:     if (!async_output || (!writer_started && !start_writer())) {
+	.loc 1 311 8 is_stmt 0 view .LVU301
+	cmpb	$0, async_output(%rip)	#, async_output
+	je	.L74	#,
+# report.c:311:     if (!async_output || (!writer_started && !start_writer())) {
+	.loc 1 311 23 discriminator 1 view .LVU302
+	cmpb	$0, writer_started(%rip)	#, writer_started
+	jne	.L75	#,
+.LVL108:
+.LBB34:
+.LBB35:
+.LBB36:
+	.loc 1 214 9 is_stmt 1 view .LVU303
+# report.c:214:         rings[i] = calloc(1, sizeof(ring_t));
+	.loc 1 214 20 is_stmt 0 view .LVU304
+	movl	$1048600, %esi	#,
+.LVL109:
+	.loc 1 214 20 view .LVU305
+	movl	$1, %edi	#,
+.LVL110:
+	.loc 1 214 20 view .LVU306
+	call	calloc@PLT	#
+.LVL111:
+	.loc 1 214 20 view .LVU307
+	movq	%rax, %r15	# tmp184, _94
+# report.c:214:         rings[i] = calloc(1, sizeof(ring_t));
+	.loc 1 214 18 view .LVU308
+	movq	%rax, rings(%rip)	# _94, rings[0]
+	.loc 1 215 9 is_stmt 1 view .LVU309
+# report.c:215:         if (!rings[i])
+	.loc 1 215 12 is_stmt 0 view .LVU310
+	testq	%rax, %rax	# _94
+	je	.L74	#,
+	.loc 1 217 9 is_stmt 1 view .LVU311
+# report.c:217:         rings[i]->fd = -1;
+	.loc 1 217 22 is_stmt 0 view .LVU312
+	movl	$-1, (%rax)	#, MEM[(struct ring_t *)_94].fd
+	.loc 1 213 34 is_stmt 1 view .LVU313
+.LVL112:
+	.loc 1 213 23 view .LVU314
+	.loc 1 214 9 view .LVU315
+# report.c:214:         rings[i] = calloc(1, sizeof(ring_t));
+	.loc 1 214 20 is_stmt 0 view .LVU316
+	movl	$1048600, %esi	#,
+	movl	$1, %edi	#,
+	call	calloc@PLT	#
+.LVL113:
+# report.c:214:         rings[i] = calloc(1, sizeof(ring_t));
+	.loc 1 214 18 view .LVU317
+	movq	%rax, 8+rings(%rip)	# _77, rings[1]
+	.loc 1 215 9 is_stmt 1 view .LVU318
+# report.c:215:         if (!rings[i])
+	.loc 1 215 12 is_stmt 0 view .LVU319
+	testq	%rax, %rax	# _77
+	je	.L74	#,
+	.loc 1 217 9 is_stmt 1 view .LVU320
+# report.c:217:         rings[i]->fd = -1;
+	.loc 1 217 22 is_stmt 0 view .LVU321
+	movq	%rax, 24(%rsp)	# _77, %sfp
+	movl	$-1, (%rax)	#, MEM[(struct ring_t *)_77].fd
+	.loc 1 213 34 is_stmt 1 view .LVU322
+.LVL114:
+	.loc 1 213 23 view .LVU323
+.LBE36:
+	.loc 1 219 5 view .LVU324
+# report.c:219:     data_fd = eventfd(0, EFD_CLOEXEC);
+	.loc 1 219 15 is_stmt 0 view .LVU325
+	movl	$524288, %esi	#,
+	movl	$0, %edi	#,
+	call	eventfd@PLT	#
+.LVL115:
+# report.c:219:     data_fd = eventfd(0, EFD_CLOEXEC);
+	.loc 1 219 13 view .LVU326
+	movl	%eax, 16(%rsp)	# _80, %sfp
+	movl	%eax, data_fd(%rip)	# _80, data_fd
+	.loc 1 220 5 is_stmt 1 view .LVU327
+# report.c:220:     space_fd = eventfd(0, EFD_CLOEXEC);
+	.loc 1 220 16 is_stmt 0 view .LVU328
+	movl	$524288, %esi	#,
+	movl	$0, %edi	#,
+	call	eventfd@PLT	#
+.LVL116:
+# report.c:220:     space_fd = eventfd(0, EFD_CLOEXEC);
+	.loc 1 220 14 view .LVU329
+	movl	%eax, space_fd(%rip)	# _81, space_fd
+	.loc 1 221 5 is_stmt 1 view .LVU330
+# report.c:221:     if (data_fd < 0 || space_fd < 0)
+	.loc 1 221 21 is_stmt 0 view .LVU331
+	orl	16(%rsp), %eax	# %sfp, tmp195
+	jns	.L90	#,
+.LVL117:
+.L74:
+	.loc 1 221 21 view .LVU332
+.LBE35:
+.LBE34:
+	.loc 1 312 9 is_stmt 1 view .LVU333
+# report.c:312:         if (prefix)
+	.loc 1 312 12 is_stmt 0 view .LVU334
+	testq	%rbp, %rbp	# prefix
+	je	.L79	#,
+	.loc 1 313 13 is_stmt 1 view .LVU335
+	movq	%r12, %rsi	# file,
+	movq	%rbp, %rdi	# prefix,
+	call	fputs@PLT	#
+.LVL118:
+.L79:
+	.loc 1 314 9 view .LVU336
+	movq	%rbx, %rdx	# ap,
+	movq	%r13, %rsi	# fmt,
+	movq	%r12, %rdi	# file,
+	call	vfprintf@PLT	#
+.LVL119:
+	.loc 1 315 9 view .LVU337
+# report.c:315:         if (newline)
+	.loc 1 315 12 is_stmt 0 view .LVU338
+	testb	%r14b, %r14b	# newline
+	jne	.L91	#,
+.L80:
+	.loc 1 317 9 is_stmt 1 view .LVU339
+	movq	%r12, %rdi	# file,
+	call	fflush@PLT	#
+.LVL120:
+	.loc 1 318 9 view .LVU340
+	jmp	.L68	#
+.LVL121:
+.L89:
+.LBB38:
+	.loc 1 298 9 view .LVU341
+	.loc 1 299 9 view .LVU342
+# report.c:299:         int len = prefix ? snprintf(buf, sizeof(buf), "%s", prefix) : 0;
+	.loc 1 299 69 is_stmt 0 view .LVU343
+	movl	$0, %r15d	#, len
+	testq	%rdx, %rdx	# prefix
+	je	.L70	#,
+# report.c:299:         int len = prefix ? snprintf(buf, sizeof(buf), "%s", prefix) : 0;
+	.loc 1 299 28 discriminator 1 view .LVU344
+	leaq	176(%rsp), %rdi	#, tmp123
+.LVL122:
+	.loc 1 299 28 discriminator 1 view .LVU345
+	movq	%rdx, %rcx	# prefix,
+.LVL123:
+	.loc 1 299 28 discriminator 1 view .LVU346
+	leaq	.LC0(%rip), %rdx	#, tmp124
+.LVL124:
+	.loc 1 299 28 discriminator 1 view .LVU347
+	movl	$2048, %esi	#,
+.LVL125:
+	.loc 1 299 28 discriminator 1 view .LVU348
+	movl	$0, %eax	#,
+	call	snprintf@PLT	#
+.LVL126:
+	.loc 1 299 28 discriminator 1 view .LVU349
+	movl	%eax, %r15d	# tmp180, len
+.L70:
+.LVL127:
+	.loc 1 300 9 is_stmt 1 discriminator 4 view .LVU350
+# report.c:300:         int n = vsnprintf(buf + len, sizeof(buf) - len, fmt, ap);
+	.loc 1 300 17 is_stmt 0 discriminator 4 view .LVU351
+	movslq	%r15d, %rax	# len, _2
+	movl	$2048, %esi	#, tmp126
+	subq	%rax, %rsi	# _2, tmp125
+	leaq	176(%rsp,%rax), %rdi	#, tmp128
+	movq	%rbx, %rcx	# ap,
+	movq	%r13, %rdx	# fmt,
+	call	vsnprintf@PLT	#
+.LVL128:
+	.loc 1 301 9 is_stmt 1 discriminator 4 view .LVU352
+# report.c:302:             len += n;
+	.loc 1 302 17 is_stmt 0 discriminator 4 view .LVU353
+	leal	(%r15,%rax), %edx	#, tmp172
+	testl	%eax, %eax	# n
+	cmovg	%edx, %r15d	# tmp172,, len
+.LVL129:
+	.loc 1 303 9 is_stmt 1 discriminator 4 view .LVU354
+# report.c:303:         if (len > (int) sizeof(buf) - 2)
+	.loc 1 303 12 is_stmt 0 discriminator 4 view .LVU355
+	movl	$2046, %eax	#, tmp194
+.LVL130:
+	.loc 1 303 12 discriminator 4 view .LVU356
+	cmpl	%eax, %r15d	# tmp194, len
+	cmovg	%eax, %r15d	# len,, tmp194, _10
+.LVL131:
+	.loc 1 305 9 is_stmt 1 discriminator 4 view .LVU357
+# report.c:305:         if (newline)
+	.loc 1 305 12 is_stmt 0 discriminator 4 view .LVU358
+	testb	%r14b, %r14b	# newline
+	je	.L72	#,
+	.loc 1 306 13 is_stmt 1 view .LVU359
+.LVL132:
+# report.c:306:             buf[len++] = '\n';
+	.loc 1 306 24 is_stmt 0 view .LVU360
+	movslq	%r15d, %rax	# _10, _10
+	movb	$10, 176(%rsp,%rax)	#, MEM[(char[2048] *)_40][_10]
+# report.c:306:             buf[len++] = '\n';
+	.loc 1 306 20 view .LVU361
+	leal	1(%r15), %r15d	#, _10
+.LVL133:
+.L72:
+	.loc 1 307 9 is_stmt 1 view .LVU362
+# report.c:307:         ret = write(fileno(file), buf, len);
+	.loc 1 307 15 is_stmt 0 view .LVU363
+	movq	%r12, %rdi	# file,
+	call	fileno@PLT	#
+.LVL134:
+	movl	%eax, %edi	# tmp182, _6
+	movslq	%r15d, %rdx	# _10, _10
+	leaq	176(%rsp), %rsi	#, tmp131
+	call	write@PLT	#
+.LVL135:
+# report.c:307:         ret = write(fileno(file), buf, len);
+	.loc 1 307 13 view .LVU364
+	movl	%eax, ret(%rip)	# _7, ret
+	.loc 1 308 9 is_stmt 1 view .LVU365
+.LVL136:
+.L68:
+	.loc 1 308 9 is_stmt 0 view .LVU366
+.LBE38:
+# report.c:342: }
+	.loc 1 342 1 view .LVU367
+	addq	$4312, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL137:
+	.loc 1 342 1 view .LVU368
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL138:
+	.loc 1 342 1 view .LVU369
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL139:
+.L90:
+	.cfi_restore_state
+.LBB39:
+.LBB37:
+	.loc 1 223 5 is_stmt 1 view .LVU370
+# report.c:223:     rings[RING_VERB]->fd = fileno(verbfile);
+	.loc 1 223 28 is_stmt 0 view .LVU371
+	movq	verbfile(%rip), %rdi	# verbfile,
+	call	fileno@PLT	#
+.LVL140:
+# report.c:223:     rings[RING_VERB]->fd = fileno(verbfile);
+	.loc 1 223 26 view .LVU372
+	movl	%eax, (%r15)	# tmp188, MEM[(struct ring_t *)_94].fd
+	.loc 1 224 5 is_stmt 1 view .LVU373
+# report.c:224:     if (logfile)
+	.loc 1 224 9 is_stmt 0 view .LVU374
+	movq	logfile(%rip), %rdi	# logfile, logfile.39_86
+# report.c:224:     if (logfile)
+	.loc 1 224 8 view .LVU375
+	testq	%rdi, %rdi	# logfile.39_86
+	je	.L78	#,
+	.loc 1 225 9 is_stmt 1 view .LVU376
+# report.c:225:         rings[RING_LOG]->fd = fileno(logfile);
+	.loc 1 225 31 is_stmt 0 view .LVU377
+	call	fileno@PLT	#
+.LVL141:
+# report.c:225:         rings[RING_LOG]->fd = fileno(logfile);
+	.loc 1 225 29 view .LVU378
+	movq	24(%rsp), %rcx	# %sfp, _77
+	movl	%eax, (%rcx)	# tmp189, MEM[(struct ring_t *)_77].fd
+.L78:
+	.loc 1 228 5 is_stmt 1 view .LVU379
+	.loc 1 229 5 view .LVU380
+	leaq	48(%rsp), %r15	#, tmp138
+	movq	%r15, %rdi	# tmp138,
+	call	sigfillset@PLT	#
+.LVL142:
+	.loc 1 230 5 view .LVU381
+	leaq	176(%rsp), %rax	#, tmp139
+	movq	%rax, 16(%rsp)	# tmp139, %sfp
+	movq	%rax, %rdx	# tmp139,
+	movq	%r15, %rsi	# tmp138,
+	movl	$2, %edi	#,
+	call	pthread_sigmask@PLT	#
+.LVL143:
+	.loc 1 231 5 view .LVU382
+	.loc 1 232 5 view .LVU383
+# report.c:232:     int err = pthread_create(&writer, NULL, writer_main, NULL);
+	.loc 1 232 15 is_stmt 0 view .LVU384
+	leaq	40(%rsp), %rdi	#, tmp141
+	movl	$0, %ecx	#,
+	leaq	writer_main(%rip), %rdx	#, tmp142
+	movl	$0, %esi	#,
+	call	pthread_create@PLT	#
+.LVL144:
+	movl	%eax, %r15d	# tmp190, err
+.LVL145:
+	.loc 1 233 5 is_stmt 1 view .LVU385
+	movl	$0, %edx	#,
+	movq	16(%rsp), %rsi	# %sfp,
+	movl	$2, %edi	#,
+	call	pthread_sigmask@PLT	#
+.LVL146:
+	.loc 1 234 5 view .LVU386
+# report.c:234:     if (err)
+	.loc 1 234 8 is_stmt 0 view .LVU387
+	testl	%r15d, %r15d	# err
+	jne	.L74	#,
+	.loc 1 237 5 is_stmt 1 view .LVU388
+	movq	40(%rsp), %rdi	# writer,
+	call	pthread_detach@PLT	#
+.LVL147:
+	.loc 1 238 5 view .LVU389
+	leaq	fork_child(%rip), %rdx	#, tmp145
+	leaq	fork_parent(%rip), %rsi	#, tmp146
+	leaq	fork_prepare(%rip), %rdi	#, tmp147
+	call	pthread_atfork@PLT	#
+.LVL148:
+	.loc 1 239 5 view .LVU390
+	leaq	report_flush(%rip), %rdi	#, tmp148
+	call	atexit@PLT	#
+.LVL149:
+	.loc 1 240 5 view .LVU391
+# report.c:240:     writer_started = true;
+	.loc 1 240 20 is_stmt 0 view .LVU392
+	movb	$1, writer_started(%rip)	#, writer_started
+	.loc 1 241 5 is_stmt 1 view .LVU393
+.LVL150:
+.L75:
+	.loc 1 241 5 is_stmt 0 view .LVU394
+.LBE37:
+.LBE39:
+	.loc 1 321 5 is_stmt 1 view .LVU395
+	.loc 1 322 5 view .LVU396
+	.loc 1 323 5 view .LVU397
+	.loc 1 324 5 view .LVU398
+	movdqu	(%rbx), %xmm0	#* ap, tmp206
+	movups	%xmm0, 2232(%rsp)	# tmp206,
+	movq	16(%rbx), %rax	#, tmp151
+	movq	%rax, 2248(%rsp)	# tmp151,
+	.loc 1 325 5 view .LVU399
+# report.c:325:     int len = vsnprintf(buf, sizeof(buf), fmt, ap);
+	.loc 1 325 15 is_stmt 0 view .LVU400
+	leaq	2256(%rsp), %rdi	#, tmp152
+.LVL151:
+	.loc 1 325 15 view .LVU401
+	movq	%rbx, %rcx	# ap,
+	movq	%r13, %rdx	# fmt,
+	movl	$2048, %esi	#,
+	call	vsnprintf@PLT	#
+.LVL152:
+	.loc 1 325 15 view .LVU402
+	movl	%eax, %ebx	# tmp191, len
+.LVL153:
+	.loc 1 326 5 is_stmt 1 view .LVU403
+# report.c:326:     if (len >= (int) sizeof(buf)) {
+	.loc 1 326 8 is_stmt 0 view .LVU404
+	cmpl	$2047, %eax	#, len
+	jg	.L92	#,
+	.loc 1 331 5 is_stmt 1 view .LVU405
+	.loc 1 332 5 view .LVU406
+# report.c:332:     if (len < 0 || !msg)
+	.loc 1 332 8 is_stmt 0 view .LVU407
+	testl	%eax, %eax	# len
+	js	.L68	#,
+# report.c:322:     char *msg = buf;
+	.loc 1 322 11 view .LVU408
+	leaq	2256(%rsp), %r12	#, msg
+.LVL154:
+.L82:
+	.loc 1 335 5 is_stmt 1 view .LVU409
+# report.c:335:     if (prefix)
+	.loc 1 335 8 is_stmt 0 view .LVU410
+	testq	%rbp, %rbp	# prefix
+	je	.L83	#,
+	.loc 1 336 9 is_stmt 1 view .LVU411
+	movq	%rbp, %rdi	# prefix,
+	call	strlen@PLT	#
+.LVL155:
+	movq	%rax, %rdx	# tmp193, tmp157
+	movslq	12(%rsp), %rax	# %sfp, ring
+	leaq	rings(%rip), %rcx	#, tmp159
+	movq	(%rcx,%rax,8), %rdi	# rings[ring_51(D)], rings[ring_51(D)]
+	movq	%rbp, %rsi	# prefix,
+	call	ring_put	#
+.LVL156:
+.L83:
+	.loc 1 337 5 view .LVU412
+	movslq	%ebx, %rdx	# len, len
+	movslq	12(%rsp), %rax	# %sfp, ring
+	leaq	rings(%rip), %rcx	#, tmp163
+	movq	(%rcx,%rax,8), %rdi	# rings[ring_51(D)], rings[ring_51(D)]
+	movq	%r12, %rsi	# msg,
+	call	ring_put	#
+.LVL157:
+	.loc 1 338 5 view .LVU413
+# report.c:338:     if (newline)
+	.loc 1 338 8 is_stmt 0 view .LVU414
+	testb	%r14b, %r14b	# newline
+	jne	.L93	#,
+.L84:
+	.loc 1 340 5 is_stmt 1 view .LVU415
+# report.c:340:     if (msg != buf)
+	.loc 1 340 8 is_stmt 0 view .LVU416
+	leaq	2256(%rsp), %rax	#, tmp170
+	cmpq	%rax, %r12	# tmp170, msg
+	je	.L68	#,
+	.loc 1 341 9 is_stmt 1 view .LVU417
+	movq	%r12, %rdi	# msg,
+	call	free@PLT	#
+.LVL158:
+	jmp	.L68	#
+.LVL159:
+.L91:
+	.loc 1 316 13 view .LVU418
+	movq	%r12, %rsi	# file,
+	movl	$10, %edi	#,
+	call	fputc@PLT	#
+.LVL160:
+	jmp	.L80	#
+.LVL161:
+.L92:
+	.loc 1 327 9 view .LVU419
+# report.c:327:         msg = malloc(len + 1);
+	.loc 1 327 26 is_stmt 0 view .LVU420
+	leal	1(%rax), %eax	#, tmp153
+.LVL162:
+# report.c:327:         msg = malloc(len + 1);
+	.loc 1 327 15 view .LVU421
+	movslq	%eax, %r15	# tmp153, _14
+	movq	%r15, %rdi	# _14,
+	call	malloc@PLT	#
+.LVL163:
+	movq	%rax, %r12	# tmp192, msg
+.LVL164:
+	.loc 1 328 9 is_stmt 1 view .LVU422
+# report.c:328:         if (msg)
+	.loc 1 328 12 is_stmt 0 view .LVU423
+	testq	%rax, %rax	# msg
+	je	.L68	#,
+	.loc 1 329 13 is_stmt 1 view .LVU424
+	leaq	2232(%rsp), %rcx	#, tmp155
+	movq	%r13, %rdx	# fmt,
+	movq	%r15, %rsi	# _14,
+	movq	%rax, %rdi	# msg,
+	call	vsnprintf@PLT	#
+.LVL165:
+	.loc 1 331 5 view .LVU425
+	.loc 1 332 5 view .LVU426
+	jmp	.L82	#
+.L93:
+	.loc 1 339 9 view .LVU427
+	movslq	12(%rsp), %rax	# %sfp, ring
+	leaq	rings(%rip), %rdx	#, tmp166
+	movq	(%rdx,%rax,8), %rdi	# rings[ring_51(D)], rings[ring_51(D)]
+	movl	$1, %edx	#,
+	leaq	.LC1(%rip), %rsi	#, tmp169
+	call	ring_put	#
+.LVL166:
+	jmp	.L84	#
+	.cfi_endproc
+.LFE38:
+	.size	emit, .-emit
+	.type	fail_fun, @function
+fail_fun:
+.LVL167:
+.LFB49:
+	.loc 1 485 1 view -0
+	.cfi_startproc
+	.loc 1 485 1 is_stmt 0 view .LVU429
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbx	# tmp104, format
+	movq	%rsi, %rbp	# tmp105, msg
+	.loc 1 487 5 is_stmt 1 view .LVU430
+	movl	$0, %eax	#,
+	call	report_flush	#
+.LVL168:
+	.loc 1 488 5 view .LVU431
+	movq	%rbp, %rcx	# msg,
+	movq	%rbx, %rdx	# format,
+	movl	$1024, %esi	#,
+	leaq	fail_buf(%rip), %rbx	#, tmp91
+.LVL169:
+	.loc 1 488 5 is_stmt 0 view .LVU432
+	movq	%rbx, %rdi	# tmp91,
+	movl	$0, %eax	#,
+	call	snprintf@PLT	#
+.LVL170:
+	.loc 1 490 5 is_stmt 1 view .LVU433
+# report.c:490:     fail_buf[strlen(fail_buf)] = '\n';
+	.loc 1 490 14 is_stmt 0 view .LVU434
+	movq	%rbx, %rdi	# tmp91,
+	call	strlen@PLT	#
+.LVL171:
+# report.c:490:     fail_buf[strlen(fail_buf)] = '\n';
+	.loc 1 490 32 view .LVU435
+	movb	$10, (%rbx,%rax)	#, fail_buf[_1]
+	.loc 1 492 5 is_stmt 1 view .LVU436
+# report.c:492:     ret = write(STDOUT_FILENO, fail_buf, strlen(fail_buf) + 1);
+	.loc 1 492 42 is_stmt 0 view .LVU437
+	movq	%rbx, %rdi	# tmp91,
+	call	strlen@PLT	#
+.LVL172:
+# report.c:492:     ret = write(STDOUT_FILENO, fail_buf, strlen(fail_buf) + 1);
+	.loc 1 492 11 view .LVU438
+	leaq	1(%rax), %rdx	#, tmp101
+	movq	%rbx, %rsi	# tmp91,
+	movl	$1, %edi	#,
+	call	write@PLT	#
+.LVL173:
+# report.c:492:     ret = write(STDOUT_FILENO, fail_buf, strlen(fail_buf) + 1);
+	.loc 1 492 9 view .LVU439
+	movl	%eax, ret(%rip)	# _4, ret
+	.loc 1 494 5 is_stmt 1 view .LVU440
+# report.c:494:     if (logfile) {
+	.loc 1 494 9 is_stmt 0 view .LVU441
+	movq	logfile(%rip), %rsi	# logfile, logfile.82_6
+# report.c:494:     if (logfile) {
+	.loc 1 494 8 view .LVU442
+	testq	%rsi, %rsi	# logfile.82_6
+	je	.L95	#,
+	.loc 1 496 9 is_stmt 1 view .LVU443
+	movq	%rbx, %rdi	#, tmp103
+	call	fputs@PLT	#
+.LVL174:
+.L95:
+	.loc 1 499 5 view .LVU444
+	.loc 1 500 9 view .LVU445
+	movl	$0, %eax	#,
+	call	default_fatal_fun	#
+.LVL175:
+	.loc 1 502 5 view .LVU446
+# report.c:502:     if (logfile)
+	.loc 1 502 9 is_stmt 0 view .LVU447
+	movq	logfile(%rip), %rdi	# logfile, logfile.86_8
+# report.c:502:     if (logfile)
+	.loc 1 502 8 view .LVU448
+	testq	%rdi, %rdi	# logfile.86_8
+	je	.L96	#,
+	.loc 1 503 9 is_stmt 1 view .LVU449
+	call	fclose@PLT	#
+.LVL176:
+.L96:
+	.loc 1 505 5 view .LVU450
+	movl	$1, %edi	#,
+	call	exit@PLT	#
+.LVL177:
+	.cfi_endproc
+.LFE49:
+	.size	fail_fun, .-fail_fun
+	.section	.rodata.str1.1
+.LC2:
+	.string	"metric_append"
+.LC3:
+	.string	"Realloc returned NULL in %s"
+	.text
+	.type	metric_append, @function
+metric_append:
+.LVL178:
+.LFB60:
+	.loc 1 658 1 view -0
+	.cfi_startproc
+	.loc 1 658 1 is_stmt 0 view .LVU452
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$208, %rsp	#,
+	.cfi_def_cfa_offset 240
+	movq	%rdi, %rbp	# tmp109, fmt
+	movq	%rsi, 40(%rsp)	#,
+	movq	%rdx, 48(%rsp)	#,
+	movq	%rcx, 56(%rsp)	#,
+	movq	%r8, 64(%rsp)	#,
+	movq	%r9, 72(%rsp)	#,
+	testb	%al, %al	#
+	je	.L108	#,
+	movaps	%xmm0, 80(%rsp)	#,
+	movaps	%xmm1, 96(%rsp)	#,
+	movaps	%xmm2, 112(%rsp)	#,
+	movaps	%xmm3, 128(%rsp)	#,
+	movaps	%xmm4, 144(%rsp)	#,
+	movaps	%xmm5, 160(%rsp)	#,
+	movaps	%xmm6, 176(%rsp)	#,
+	movaps	%xmm7, 192(%rsp)	#,
+.L108:
+.LBB40:
+# report.c:662:         int len = vsnprintf(mbuf + mlen, msize - mlen, fmt, ap);
+	.loc 1 662 19 view .LVU453
+	leaq	8(%rsp), %r12	#, tmp97
+	jmp	.L106	#
+.LVL179:
+.L112:
+	.loc 1 667 13 is_stmt 1 view .LVU454
+# report.c:667:             mlen += len;
+	.loc 1 667 18 is_stmt 0 view .LVU455
+	movq	%rax, mlen(%rip)	# _8, mlen
+	.loc 1 668 13 is_stmt 1 view .LVU456
+.L98:
+.LBE40:
+# report.c:681: }
+	.loc 1 681 1 is_stmt 0 view .LVU457
+	addq	$208, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL180:
+	.loc 1 681 1 view .LVU458
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL181:
+.L103:
+	.cfi_restore_state
+.LBB41:
+	.loc 1 673 9 is_stmt 1 view .LVU459
+# report.c:673:         char *nbuf = realloc(mbuf, nsize);
+	.loc 1 673 22 is_stmt 0 view .LVU460
+	movq	%rbx, %rsi	# nsize,
+	movq	mbuf(%rip), %rdi	# mbuf,
+	call	realloc@PLT	#
+.LVL182:
+	.loc 1 674 9 is_stmt 1 view .LVU461
+# report.c:674:         if (!nbuf) {
+	.loc 1 674 12 is_stmt 0 view .LVU462
+	testq	%rax, %rax	# nbuf
+	je	.L111	#,
+	.loc 1 678 9 is_stmt 1 view .LVU463
+# report.c:678:         mbuf = nbuf;
+	.loc 1 678 14 is_stmt 0 view .LVU464
+	movq	%rax, mbuf(%rip)	# nbuf, mbuf
+	.loc 1 679 9 is_stmt 1 view .LVU465
+# report.c:679:         msize = nsize;
+	.loc 1 679 15 is_stmt 0 view .LVU466
+	movq	%rbx, msize(%rip)	# nsize, msize
+.LBE41:
+	.loc 1 660 5 is_stmt 1 view .LVU467
+.LVL183:
+.L106:
+	.loc 1 659 5 view .LVU468
+	.loc 1 660 5 view .LVU469
+.LBB42:
+	.loc 1 661 9 view .LVU470
+	movl	$8, 8(%rsp)	#, MEM[(struct [1] *)&ap].gp_offset
+	movl	$48, 12(%rsp)	#, MEM[(struct [1] *)&ap].fp_offset
+	leaq	240(%rsp), %rax	#, tmp113
+	movq	%rax, 16(%rsp)	# tmp113, MEM[(struct [1] *)&ap].overflow_arg_area
+	leaq	32(%rsp), %rax	#, tmp114
+	movq	%rax, 24(%rsp)	# tmp114, MEM[(struct [1] *)&ap].reg_save_area
+	.loc 1 662 9 view .LVU471
+# report.c:662:         int len = vsnprintf(mbuf + mlen, msize - mlen, fmt, ap);
+	.loc 1 662 19 is_stmt 0 view .LVU472
+	movq	mlen(%rip), %rdi	# mlen, mlen.114_2
+	movq	msize(%rip), %rsi	# msize, tmp98
+	subq	%rdi, %rsi	# mlen.114_2, tmp98
+	addq	mbuf(%rip), %rdi	# mbuf, tmp100
+	movq	%r12, %rcx	# tmp97,
+	movq	%rbp, %rdx	# fmt,
+	call	vsnprintf@PLT	#
+.LVL184:
+	.loc 1 663 9 is_stmt 1 view .LVU473
+	.loc 1 664 9 view .LVU474
+# report.c:664:         if (len < 0)
+	.loc 1 664 12 is_stmt 0 view .LVU475
+	testl	%eax, %eax	# len
+	js	.L98	#,
+	.loc 1 666 9 is_stmt 1 view .LVU476
+# report.c:666:         if (mlen + len < msize) {
+	.loc 1 666 18 is_stmt 0 view .LVU477
+	cltq
+	.loc 1 666 18 view .LVU478
+	addq	mlen(%rip), %rax	# mlen, _8
+.LVL185:
+# report.c:666:         if (mlen + len < msize) {
+	.loc 1 666 24 view .LVU479
+	movq	msize(%rip), %rdx	# msize, msize.118_9
+# report.c:666:         if (mlen + len < msize) {
+	.loc 1 666 12 view .LVU480
+	cmpq	%rdx, %rax	# msize.118_9, _8
+	jb	.L112	#,
+	.loc 1 670 9 is_stmt 1 view .LVU481
+# report.c:670:         size_t nsize = msize ? 2 * msize : 1024;
+	.loc 1 670 42 is_stmt 0 view .LVU482
+	leaq	(%rdx,%rdx), %rbx	#, tmp107
+	testq	%rdx, %rdx	# msize.118_9
+	movl	$1024, %edx	#, tmp108
+	cmove	%rdx, %rbx	# tmp107,, tmp108, nsize
+.LVL186:
+	.loc 1 671 22 is_stmt 1 view .LVU483
+	cmpq	%rbx, %rax	# nsize, _8
+	jb	.L103	#,
+.L104:
+	.loc 1 672 13 view .LVU484
+# report.c:672:             nsize *= 2;
+	.loc 1 672 19 is_stmt 0 view .LVU485
+	addq	%rbx, %rbx	# nsize
+.LVL187:
+	.loc 1 671 22 is_stmt 1 view .LVU486
+	cmpq	%rbx, %rax	# nsize, _8
+	jnb	.L104	#,
+	jmp	.L103	#
+.LVL188:
+.L111:
+	.loc 1 675 13 view .LVU487
+	leaq	.LC2(%rip), %rsi	#, tmp105
+	leaq	.LC3(%rip), %rdi	#, tmp106
+	call	fail_fun	#
+.LVL189:
+	.loc 1 675 13 is_stmt 0 view .LVU488
+.LBE42:
+	.cfi_endproc
+.LFE60:
+	.size	metric_append, .-metric_append
+	.section	.rodata.str1.1
+.LC4:
+	.string	"\""
+.LC5:
+	.string	"\\%c"
+.LC6:
+	.string	"\\u%04x"
+.LC7:
+	.string	"%c"
+	.text
+	.type	metric_quote, @function
+metric_quote:
+.LVL190:
+.LFB61:
+	.loc 1 685 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 685 1 is_stmt 0 view .LVU490
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx	# tmp106, s
+	.loc 1 686 5 is_stmt 1 view .LVU491
+	leaq	.LC4(%rip), %rdi	#, tmp91
+.LVL191:
+	.loc 1 686 5 is_stmt 0 view .LVU492
+	movl	$0, %eax	#,
+	call	metric_append	#
+.LVL192:
+	.loc 1 687 5 is_stmt 1 view .LVU493
+	.loc 1 687 12 view .LVU494
+	movzbl	(%rbx), %eax	# *s_13(D), _7
+	testb	%al, %al	# _7
+	je	.L114	#,
+.LBB43:
+# report.c:690:             metric_append("\\%c", c);
+	.loc 1 690 13 is_stmt 0 view .LVU495
+	leaq	.LC5(%rip), %r13	#, tmp103
+# report.c:694:             metric_append("%c", c);
+	.loc 1 694 13 view .LVU496
+	leaq	.LC7(%rip), %r12	#, tmp104
+# report.c:692:             metric_append("\\u%04x", c);
+	.loc 1 692 13 view .LVU497
+	leaq	.LC6(%rip), %rbp	#, tmp105
+	jmp	.L119	#
+.LVL193:
+.L120:
+	.loc 1 690 13 is_stmt 1 view .LVU498
+	movzbl	%sil, %esi	# c, c
+	movq	%r13, %rdi	# tmp103,
+	movl	$0, %eax	#,
+.LVL194:
+	.loc 1 690 13 is_stmt 0 view .LVU499
+	call	metric_append	#
+.LVL195:
+	.loc 1 690 13 view .LVU500
+	jmp	.L117	#
+.LVL196:
+.L118:
+	.loc 1 694 13 is_stmt 1 view .LVU501
+	movzbl	%al, %esi	# c, c
+	movq	%r12, %rdi	# tmp104,
+	movl	$0, %eax	#,
+.LVL197:
+	.loc 1 694 13 is_stmt 0 view .LVU502
+	call	metric_append	#
+.LVL198:
+.L117:
+	.loc 1 694 13 view .LVU503
+.LBE43:
+	.loc 1 687 17 is_stmt 1 view .LVU504
+	addq	$1, %rbx	#, s
+.LVL199:
+	.loc 1 687 12 view .LVU505
+	movzbl	(%rbx), %eax	# MEM[(const char *)s_19], _7
+	testb	%al, %al	# _7
+	je	.L114	#,
+.LVL200:
+.L119:
+.LBB44:
+	.loc 1 688 9 view .LVU506
+# report.c:688:         unsigned char c = *s;
+	.loc 1 688 23 is_stmt 0 view .LVU507
+	movl	%eax, %esi	# _7, c
+.LVL201:
+	.loc 1 689 9 is_stmt 1 view .LVU508
+# report.c:689:         if (c == '"' || c == '\\')
+	.loc 1 689 12 is_stmt 0 view .LVU509
+	cmpb	$34, %al	#, _7
+	je	.L120	#,
+	.loc 1 689 12 view .LVU510
+	cmpb	$92, %al	#, _7
+	je	.L120	#,
+	.loc 1 691 14 is_stmt 1 view .LVU511
+# report.c:691:         else if (c < 0x20)
+	.loc 1 691 17 is_stmt 0 view .LVU512
+	cmpb	$31, %al	#, c
+	ja	.L118	#,
+	.loc 1 692 13 is_stmt 1 view .LVU513
+	movzbl	%al, %esi	# c, c
+	movq	%rbp, %rdi	# tmp105,
+	movl	$0, %eax	#,
+.LVL202:
+	.loc 1 692 13 is_stmt 0 view .LVU514
+	call	metric_append	#
+.LVL203:
+	.loc 1 692 13 view .LVU515
+	jmp	.L117	#
+.LVL204:
+.L114:
+	.loc 1 692 13 view .LVU516
+.LBE44:
+	.loc 1 696 5 is_stmt 1 view .LVU517
+	leaq	.LC4(%rip), %rdi	#, tmp102
+	movl	$0, %eax	#,
+	call	metric_append	#
+.LVL205:
+# report.c:697: }
+	.loc 1 697 1 is_stmt 0 view .LVU518
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL206:
+	.loc 1 697 1 view .LVU519
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE61:
+	.size	metric_quote, .-metric_quote
+	.globl	report_signal_enter
+	.type	report_signal_enter, @function
+report_signal_enter:
+.LFB40:
+	.loc 1 358 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 359 5 view .LVU521
+# report.c:359:     in_signal = 1;
+	.loc 1 359 15 is_stmt 0 view .LVU522
+	movl	$1, in_signal(%rip)	#, in_signal
+	.loc 1 361 5 is_stmt 1 view .LVU523
+# report.c:361:     if (writer_started)
+	.loc 1 361 8 is_stmt 0 view .LVU524
+	cmpb	$0, writer_started(%rip)	#, writer_started
+	jne	.L129	#,
+	ret	
+.L129:
+# report.c:358: {
+	.loc 1 358 1 view .LVU525
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 362 9 is_stmt 1 view .LVU526
+	movl	$0, %eax	#,
+	call	drain_rings_signal	#
+.LVL207:
+# report.c:363: }
+	.loc 1 363 1 is_stmt 0 view .LVU527
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE40:
+	.size	report_signal_enter, .-report_signal_enter
+	.globl	report_signal_leave
+	.type	report_signal_leave, @function
+report_signal_leave:
+.LFB41:
+	.loc 1 366 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 367 5 view .LVU529
+# report.c:367:     in_signal = 0;
+	.loc 1 367 15 is_stmt 0 view .LVU530
+	movl	$0, in_signal(%rip)	#, in_signal
+# report.c:368: }
+	.loc 1 368 1 view .LVU531
+	ret	
+	.cfi_endproc
+.LFE41:
+	.size	report_signal_leave, .-report_signal_leave
+	.globl	set_verblevel
+	.type	set_verblevel, @function
+set_verblevel:
+.LVL208:
+.LFB43:
+	.loc 1 384 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 385 5 view .LVU533
+# report.c:385:     verblevel = level;
+	.loc 1 385 15 is_stmt 0 view .LVU534
+	movl	%edi, verblevel(%rip)	# tmp83, verblevel
+# report.c:386: }
+	.loc 1 386 1 view .LVU535
+	ret	
+	.cfi_endproc
+.LFE43:
+	.size	set_verblevel, .-set_verblevel
+	.section	.rodata.str1.1
+.LC8:
+	.string	"w"
+	.text
+	.globl	set_logfile
+	.type	set_logfile, @function
+set_logfile:
+.LVL209:
+.LFB44:
+	.loc 1 389 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 389 1 is_stmt 0 view .LVU537
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp94, file_name
+	.loc 1 390 5 is_stmt 1 view .LVU538
+	movl	$0, %eax	#,
+	call	report_flush	#
+.LVL210:
+	.loc 1 391 5 view .LVU539
+# report.c:391:     logfile = fopen(file_name, "w");
+	.loc 1 391 15 is_stmt 0 view .LVU540
+	leaq	.LC8(%rip), %rsi	#, tmp88
+	movq	%rbx, %rdi	# file_name,
+	call	fopen@PLT	#
+.LVL211:
+	movq	%rax, %rbx	# tmp95, _1
+.LVL212:
+# report.c:391:     logfile = fopen(file_name, "w");
+	.loc 1 391 13 view .LVU541
+	movq	%rax, logfile(%rip)	# _1, logfile
+	.loc 1 392 5 is_stmt 1 view .LVU542
+# report.c:392:     if (writer_started)
+	.loc 1 392 8 is_stmt 0 view .LVU543
+	cmpb	$0, writer_started(%rip)	#, writer_started
+	je	.L133	#,
+	.loc 1 393 9 is_stmt 1 view .LVU544
+# report.c:393:         rings[RING_LOG]->fd = logfile ? fileno(logfile) : -1;
+	.loc 1 393 57 is_stmt 0 view .LVU545
+	testq	%rax, %rax	# _1
+	je	.L135	#,
+# report.c:393:         rings[RING_LOG]->fd = logfile ? fileno(logfile) : -1;
+	.loc 1 393 41 discriminator 1 view .LVU546
+	movq	%rax, %rdi	# _1,
+	call	fileno@PLT	#
+.LVL213:
+.L134:
+# report.c:393:         rings[RING_LOG]->fd = logfile ? fileno(logfile) : -1;
+	.loc 1 393 29 discriminator 4 view .LVU547
+	movq	8+rings(%rip), %rdx	# rings[1], rings[1]
+	movl	%eax, (%rdx)	# iftmp.13_5, _3->fd
+.L133:
+	.loc 1 394 5 is_stmt 1 view .LVU548
+# report.c:394:     return logfile != NULL;
+	.loc 1 394 20 is_stmt 0 view .LVU549
+	testq	%rbx, %rbx	# _1
+	setne	%al	#, tmp93
+# report.c:395: }
+	.loc 1 395 1 view .LVU550
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.L135:
+	.cfi_restore_state
+# report.c:393:         rings[RING_LOG]->fd = logfile ? fileno(logfile) : -1;
+	.loc 1 393 57 view .LVU551
+	movl	$-1, %eax	#, iftmp.13_5
+	jmp	.L134	#
+	.cfi_endproc
+.LFE44:
+	.size	set_logfile, .-set_logfile
+	.section	.rodata.str1.1
+.LC9:
+	.string	"FATAL ERROR"
+.LC10:
+	.string	"ERROR"
+.LC11:
+	.string	"WARNING"
+.LC12:
+	.string	"%s: "
+.LC13:
+	.string	"Error: "
+	.text
+	.globl	report_event
+	.type	report_event, @function
+report_event:
+.LVL214:
+.LFB46:
+	.loc 1 408 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 408 1 is_stmt 0 view .LVU553
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$240, %rsp	#,
+	.cfi_def_cfa_offset 272
+	movl	%edi, %ebx	# tmp111, msg
+	movq	%rsi, %rbp	# tmp112, fmt
+	movq	%rdx, 80(%rsp)	#,
+	movq	%rcx, 88(%rsp)	#,
+	movq	%r8, 96(%rsp)	#,
+	movq	%r9, 104(%rsp)	#,
+	testb	%al, %al	#
+	je	.L147	#,
+	movaps	%xmm0, 112(%rsp)	#,
+	movaps	%xmm1, 128(%rsp)	#,
+	movaps	%xmm2, 144(%rsp)	#,
+	movaps	%xmm3, 160(%rsp)	#,
+	movaps	%xmm4, 176(%rsp)	#,
+	movaps	%xmm5, 192(%rsp)	#,
+	movaps	%xmm6, 208(%rsp)	#,
+	movaps	%xmm7, 224(%rsp)	#,
+.L147:
+	.loc 1 409 5 is_stmt 1 view .LVU554
+	.loc 1 410 5 view .LVU555
+.LVL215:
+	.loc 1 411 5 view .LVU556
+# report.c:413:                          : msg == MSG_ERROR ? "ERROR" : "FATAL ERROR";
+	.loc 1 413 26 is_stmt 0 view .LVU557
+	leaq	.LC11(%rip), %rcx	#, iftmp.17_15
+# report.c:414:     int level = msg == MSG_WARN ? 2 : msg == MSG_ERROR ? 1 : 0;
+	.loc 1 414 37 view .LVU558
+	movl	$2, %eax	#, iftmp.19_9
+# report.c:413:                          : msg == MSG_ERROR ? "ERROR" : "FATAL ERROR";
+	.loc 1 413 26 view .LVU559
+	testl	%ebx, %ebx	# msg
+	je	.L139	#,
+# report.c:413:                          : msg == MSG_ERROR ? "ERROR" : "FATAL ERROR";
+	.loc 1 413 55 discriminator 1 view .LVU560
+	cmpl	$1, %ebx	#, msg
+	leaq	.LC9(%rip), %rcx	#, tmp109
+	leaq	.LC10(%rip), %rax	#, tmp110
+	cmove	%rax, %rcx	# tmp109,, tmp110, iftmp.17_15
+# report.c:414:     int level = msg == MSG_WARN ? 2 : msg == MSG_ERROR ? 1 : 0;
+	.loc 1 414 60 discriminator 1 view .LVU561
+	sete	%al	#, iftmp.19_9
+	movzbl	%al, %eax	# iftmp.19_9, iftmp.19_9
+.L139:
+.LVL216:
+	.loc 1 415 5 is_stmt 1 discriminator 4 view .LVU562
+# report.c:415:     if (verblevel < level)
+	.loc 1 415 8 is_stmt 0 discriminator 4 view .LVU563
+	cmpl	%eax, verblevel(%rip)	# iftmp.19_9, verblevel
+	jl	.L137	#,
+	.loc 1 418 5 is_stmt 1 view .LVU564
+# report.c:418:     if (!errfile)
+	.loc 1 418 8 is_stmt 0 view .LVU565
+	cmpq	$0, errfile(%rip)	#, errfile
+	je	.L149	#,
+.LVL217:
+.L142:
+	.loc 1 421 5 is_stmt 1 view .LVU566
+	.loc 1 422 5 view .LVU567
+	movq	%rsp, %r12	#, tmp97
+	leaq	.LC12(%rip), %rdx	#, tmp98
+	movl	$32, %esi	#,
+.LVL218:
+	.loc 1 422 5 is_stmt 0 view .LVU568
+	movq	%r12, %rdi	# tmp97,
+.LVL219:
+	.loc 1 422 5 view .LVU569
+	movl	$0, %eax	#,
+	call	snprintf@PLT	#
+.LVL220:
+	.loc 1 423 5 is_stmt 1 view .LVU570
+	movl	$16, 40(%rsp)	#, MEM[(struct [1] *)&ap].gp_offset
+	movl	$48, 44(%rsp)	#, MEM[(struct [1] *)&ap].fp_offset
+	leaq	272(%rsp), %rax	#, tmp114
+	movq	%rax, 48(%rsp)	# tmp114, MEM[(struct [1] *)&ap].overflow_arg_area
+	leaq	64(%rsp), %rax	#, tmp115
+	movq	%rax, 56(%rsp)	# tmp115, MEM[(struct [1] *)&ap].reg_save_area
+	.loc 1 424 5 view .LVU571
+	movl	$1, %r9d	#,
+	leaq	40(%rsp), %r8	#,
+	movq	%rbp, %rcx	# fmt,
+	movq	%r12, %rdx	# tmp97,
+	movl	$0, %esi	#,
+	movq	errfile(%rip), %rdi	# errfile,
+	call	emit	#
+.LVL221:
+	.loc 1 425 5 view .LVU572
+	.loc 1 427 5 view .LVU573
+# report.c:427:     if (logfile) {
+	.loc 1 427 9 is_stmt 0 view .LVU574
+	movq	logfile(%rip), %rdi	# logfile, logfile.25_6
+# report.c:427:     if (logfile) {
+	.loc 1 427 8 view .LVU575
+	testq	%rdi, %rdi	# logfile.25_6
+	je	.L143	#,
+	.loc 1 428 9 is_stmt 1 view .LVU576
+	movl	$16, 40(%rsp)	#, MEM[(struct [1] *)&ap].gp_offset
+	movl	$48, 44(%rsp)	#, MEM[(struct [1] *)&ap].fp_offset
+	leaq	272(%rsp), %rax	#, tmp116
+	movq	%rax, 48(%rsp)	# tmp116, MEM[(struct [1] *)&ap].overflow_arg_area
+	leaq	64(%rsp), %rax	#, tmp117
+	movq	%rax, 56(%rsp)	# tmp117, MEM[(struct [1] *)&ap].reg_save_area
+	.loc 1 429 9 view .LVU577
+	movl	$1, %r9d	#,
+	leaq	40(%rsp), %r8	#,
+	movq	%rbp, %rcx	# fmt,
+	leaq	.LC13(%rip), %rdx	#, tmp105
+	movl	$1, %esi	#,
+	call	emit	#
+.LVL222:
+	.loc 1 430 9 view .LVU578
+	.loc 1 431 9 view .LVU579
+.LBB49:
+.LBI49:
+	.loc 1 398 13 view .LVU580
+.LBB50:
+	.loc 1 400 5 view .LVU581
+	movl	$0, %eax	#,
+	call	report_flush	#
+.LVL223:
+	.loc 1 401 5 view .LVU582
+# report.c:401:     if (writer_started)
+	.loc 1 401 8 is_stmt 0 view .LVU583
+	cmpb	$0, writer_started(%rip)	#, writer_started
+	je	.L144	#,
+	.loc 1 402 9 is_stmt 1 view .LVU584
+# report.c:402:         rings[RING_LOG]->fd = -1;
+	.loc 1 402 29 is_stmt 0 view .LVU585
+	movq	8+rings(%rip), %rax	# rings[1], rings[1]
+	movl	$-1, (%rax)	#, _37->fd
+.L144:
+	.loc 1 403 5 is_stmt 1 view .LVU586
+	movq	logfile(%rip), %rdi	# logfile,
+	call	fclose@PLT	#
+.LVL224:
+	.loc 1 404 5 view .LVU587
+# report.c:404:     logfile = NULL;
+	.loc 1 404 13 is_stmt 0 view .LVU588
+	movq	$0, logfile(%rip)	#, logfile
+.L143:
+.LBE50:
+.LBE49:
+	.loc 1 434 5 is_stmt 1 view .LVU589
+# report.c:434:     if (fatal) {
+	.loc 1 434 8 is_stmt 0 view .LVU590
+	cmpl	$2, %ebx	#, msg
+	je	.L150	#,
+.L137:
+# report.c:441: }
+	.loc 1 441 1 view .LVU591
+	addq	$240, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LVL225:
+	.loc 1 441 1 view .LVU592
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL226:
+	.loc 1 441 1 view .LVU593
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL227:
+.L149:
+	.cfi_restore_state
+	.loc 1 419 9 is_stmt 1 view .LVU594
+	movq	stdout(%rip), %rax	# stdout, stdout.22_4
+.LVL228:
+.LBB51:
+.LBI51:
+	.loc 1 26 13 view .LVU595
+.LBB52:
+	.loc 1 28 5 view .LVU596
+# report.c:28:     errfile = efile;
+	.loc 1 28 13 is_stmt 0 view .LVU597
+	movq	%rax, errfile(%rip)	# stdout.22_4, errfile
+	.loc 1 29 5 is_stmt 1 view .LVU598
+# report.c:29:     verbfile = vfile;
+	.loc 1 29 14 is_stmt 0 view .LVU599
+	movq	%rax, verbfile(%rip)	# stdout.22_4, verbfile
+# report.c:30: }
+	.loc 1 30 1 view .LVU600
+	jmp	.L142	#
+.LVL229:
+.L150:
+	.loc 1 30 1 view .LVU601
+.LBE52:
+.LBE51:
+	.loc 1 436 9 is_stmt 1 view .LVU602
+	movl	$0, %eax	#,
+	call	report_flush	#
+.LVL230:
+	.loc 1 437 9 view .LVU603
+	.loc 1 438 13 view .LVU604
+	movl	$0, %eax	#,
+	call	default_fatal_fun	#
+.LVL231:
+	.loc 1 439 9 view .LVU605
+	movl	$1, %edi	#,
+	call	exit@PLT	#
+.LVL232:
+	.cfi_endproc
+.LFE46:
+	.size	report_event, .-report_event
+	.type	check_exceed, @function
+check_exceed:
+.LVL233:
+.LFB50:
+	.loc 1 523 1 view -0
+	.cfi_startproc
+	.loc 1 524 5 view .LVU607
+	.loc 1 525 5 view .LVU608
+	.loc 1 526 5 view .LVU609
+# report.c:531: }
+	.loc 1 531 1 is_stmt 0 view .LVU610
+	ret	
+	.cfi_endproc
+.LFE50:
+	.size	check_exceed, .-check_exceed
+	.globl	report
+	.type	report, @function
+report:
+.LVL234:
+.LFB47:
+	.loc 1 444 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 444 1 is_stmt 0 view .LVU612
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$208, %rsp	#,
+	.cfi_def_cfa_offset 224
+	movq	%rsi, %rbx	# tmp95, fmt
+	movq	%rdx, 48(%rsp)	#,
+	movq	%rcx, 56(%rsp)	#,
+	movq	%r8, 64(%rsp)	#,
+	movq	%r9, 72(%rsp)	#,
+	testb	%al, %al	#
+	je	.L157	#,
+	movaps	%xmm0, 80(%rsp)	#,
+	movaps	%xmm1, 96(%rsp)	#,
+	movaps	%xmm2, 112(%rsp)	#,
+	movaps	%xmm3, 128(%rsp)	#,
+	movaps	%xmm4, 144(%rsp)	#,
+	movaps	%xmm5, 160(%rsp)	#,
+	movaps	%xmm6, 176(%rsp)	#,
+	movaps	%xmm7, 192(%rsp)	#,
+.L157:
+	.loc 1 445 5 is_stmt 1 view .LVU613
+# report.c:445:     if (!verbfile)
+	.loc 1 445 8 is_stmt 0 view .LVU614
+	cmpq	$0, verbfile(%rip)	#, verbfile
+	je	.L159	#,
+.L154:
+	.loc 1 448 5 is_stmt 1 view .LVU615
+# report.c:448:     if (level <= verblevel) {
+	.loc 1 448 8 is_stmt 0 view .LVU616
+	cmpl	%edi, verblevel(%rip)	# level, verblevel
+	jge	.L160	#,
+.LVL235:
+.L152:
+# report.c:460: }
+	.loc 1 460 1 view .LVU617
+	addq	$208, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL236:
+	.loc 1 460 1 view .LVU618
+	ret	
+.LVL237:
+.L159:
+	.cfi_restore_state
+	.loc 1 446 9 is_stmt 1 view .LVU619
+	movq	stdout(%rip), %rax	# stdout, stdout.58_2
+.LVL238:
+.LBB56:
+.LBI56:
+	.loc 1 26 13 view .LVU620
+.LBB57:
+	.loc 1 28 5 view .LVU621
+# report.c:28:     errfile = efile;
+	.loc 1 28 13 is_stmt 0 view .LVU622
+	movq	%rax, errfile(%rip)	# stdout.58_2, errfile
+	.loc 1 29 5 is_stmt 1 view .LVU623
+# report.c:29:     verbfile = vfile;
+	.loc 1 29 14 is_stmt 0 view .LVU624
+	movq	%rax, verbfile(%rip)	# stdout.58_2, verbfile
+# report.c:30: }
+	.loc 1 30 1 view .LVU625
+	jmp	.L154	#
+.LVL239:
+.L160:
+	.loc 1 30 1 view .LVU626
+.LBE57:
+.LBE56:
+.LBB58:
+	.loc 1 449 9 is_stmt 1 view .LVU627
+	.loc 1 450 9 view .LVU628
+	movl	$16, 8(%rsp)	#, MEM[(struct [1] *)&ap].gp_offset
+	movl	$48, 12(%rsp)	#, MEM[(struct [1] *)&ap].fp_offset
+	leaq	224(%rsp), %rax	#, tmp97
+	movq	%rax, 16(%rsp)	# tmp97, MEM[(struct [1] *)&ap].overflow_arg_area
+	leaq	32(%rsp), %rax	#, tmp98
+	movq	%rax, 24(%rsp)	# tmp98, MEM[(struct [1] *)&ap].reg_save_area
+	.loc 1 451 9 view .LVU629
+	movl	$1, %r9d	#,
+	leaq	8(%rsp), %r8	#,
+	movq	%rbx, %rcx	# fmt,
+	movl	$0, %edx	#,
+	movl	$0, %esi	#,
+	movq	verbfile(%rip), %rdi	# verbfile,
+.LVL240:
+	.loc 1 451 9 is_stmt 0 view .LVU630
+	call	emit	#
+.LVL241:
+	.loc 1 452 9 is_stmt 1 view .LVU631
+	.loc 1 454 9 view .LVU632
+# report.c:454:         if (logfile) {
+	.loc 1 454 13 is_stmt 0 view .LVU633
+	movq	logfile(%rip), %rdi	# logfile, logfile.62_5
+# report.c:454:         if (logfile) {
+	.loc 1 454 12 view .LVU634
+	testq	%rdi, %rdi	# logfile.62_5
+	je	.L152	#,
+	.loc 1 455 13 is_stmt 1 view .LVU635
+	movl	$16, 8(%rsp)	#, MEM[(struct [1] *)&ap].gp_offset
+	movl	$48, 12(%rsp)	#, MEM[(struct [1] *)&ap].fp_offset
+	leaq	224(%rsp), %rax	#, tmp99
+	movq	%rax, 16(%rsp)	# tmp99, MEM[(struct [1] *)&ap].overflow_arg_area
+	leaq	32(%rsp), %rax	#, tmp100
+	movq	%rax, 24(%rsp)	# tmp100, MEM[(struct [1] *)&ap].reg_save_area
+	.loc 1 456 13 view .LVU636
+	movl	$1, %r9d	#,
+	leaq	8(%rsp), %r8	#,
+	movq	%rbx, %rcx	# fmt,
+	movl	$0, %edx	#,
+	movl	$1, %esi	#,
+	call	emit	#
+.LVL242:
+	.loc 1 457 13 view .LVU637
+.LBE58:
+# report.c:460: }
+	.loc 1 460 1 is_stmt 0 view .LVU638
+	jmp	.L152	#
+	.cfi_endproc
+.LFE47:
+	.size	report, .-report
+	.globl	report_noreturn
+	.type	report_noreturn, @function
+report_noreturn:
+.LVL243:
+.LFB48:
+	.loc 1 463 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 463 1 is_stmt 0 view .LVU640
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$208, %rsp	#,
+	.cfi_def_cfa_offset 224
+	movq	%rsi, %rbx	# tmp95, fmt
+	movq	%rdx, 48(%rsp)	#,
+	movq	%rcx, 56(%rsp)	#,
+	movq	%r8, 64(%rsp)	#,
+	movq	%r9, 72(%rsp)	#,
+	testb	%al, %al	#
+	je	.L166	#,
+	movaps	%xmm0, 80(%rsp)	#,
+	movaps	%xmm1, 96(%rsp)	#,
+	movaps	%xmm2, 112(%rsp)	#,
+	movaps	%xmm3, 128(%rsp)	#,
+	movaps	%xmm4, 144(%rsp)	#,
+	movaps	%xmm5, 160(%rsp)	#,
+	movaps	%xmm6, 176(%rsp)	#,
+	movaps	%xmm7, 192(%rsp)	#,
+.L166:
+	.loc 1 464 5 is_stmt 1 view .LVU641
+# report.c:464:     if (!verbfile)
+	.loc 1 464 8 is_stmt 0 view .LVU642
+	cmpq	$0, verbfile(%rip)	#, verbfile
+	je	.L168	#,
+.L163:
+	.loc 1 467 5 is_stmt 1 view .LVU643
+# report.c:467:     if (level <= verblevel) {
+	.loc 1 467 8 is_stmt 0 view .LVU644
+	cmpl	%edi, verblevel(%rip)	# level, verblevel
+	jge	.L169	#,
+.LVL244:
+.L161:
+# report.c:479: }
+	.loc 1 479 1 view .LVU645
+	addq	$208, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL245:
+	.loc 1 479 1 view .LVU646
+	ret	
+.LVL246:
+.L168:
+	.cfi_restore_state
+	.loc 1 465 9 is_stmt 1 view .LVU647
+	movq	stdout(%rip), %rax	# stdout, stdout.65_2
+.LVL247:
+.LBB62:
+.LBI62:
+	.loc 1 26 13 view .LVU648
+.LBB63:
+	.loc 1 28 5 view .LVU649
+# report.c:28:     errfile = efile;
+	.loc 1 28 13 is_stmt 0 view .LVU650
+	movq	%rax, errfile(%rip)	# stdout.65_2, errfile
+	.loc 1 29 5 is_stmt 1 view .LVU651
+# report.c:29:     verbfile = vfile;
+	.loc 1 29 14 is_stmt 0 view .LVU652
+	movq	%rax, verbfile(%rip)	# stdout.65_2, verbfile
+# report.c:30: }
+	.loc 1 30 1 view .LVU653
+	jmp	.L163	#
+.LVL248:
+.L169:
+	.loc 1 30 1 view .LVU654
+.LBE63:
+.LBE62:
+.LBB64:
+	.loc 1 468 9 is_stmt 1 view .LVU655
+	.loc 1 469 9 view .LVU656
+	movl	$16, 8(%rsp)	#, MEM[(struct [1] *)&ap].gp_offset
+	movl	$48, 12(%rsp)	#, MEM[(struct [1] *)&ap].fp_offset
+	leaq	224(%rsp), %rax	#, tmp97
+	movq	%rax, 16(%rsp)	# tmp97, MEM[(struct [1] *)&ap].overflow_arg_area
+	leaq	32(%rsp), %rax	#, tmp98
+	movq	%rax, 24(%rsp)	# tmp98, MEM[(struct [1] *)&ap].reg_save_area
+	.loc 1 470 9 view .LVU657
+	movl	$0, %r9d	#,
+	leaq	8(%rsp), %r8	#,
+	movq	%rbx, %rcx	# fmt,
+	movl	$0, %edx	#,
+	movl	$0, %esi	#,
+	movq	verbfile(%rip), %rdi	# verbfile,
+.LVL249:
+	.loc 1 470 9 is_stmt 0 view .LVU658
+	call	emit	#
+.LVL250:
+	.loc 1 471 9 is_stmt 1 view .LVU659
+	.loc 1 473 9 view .LVU660
+# report.c:473:         if (logfile) {
+	.loc 1 473 13 is_stmt 0 view .LVU661
+	movq	logfile(%rip), %rdi	# logfile, logfile.69_5
+# report.c:473:         if (logfile) {
+	.loc 1 473 12 view .LVU662
+	testq	%rdi, %rdi	# logfile.69_5
+	je	.L161	#,
+	.loc 1 474 13 is_stmt 1 view .LVU663
+	movl	$16, 8(%rsp)	#, MEM[(struct [1] *)&ap].gp_offset
+	movl	$48, 12(%rsp)	#, MEM[(struct [1] *)&ap].fp_offset
+	leaq	224(%rsp), %rax	#, tmp99
+	movq	%rax, 16(%rsp)	# tmp99, MEM[(struct [1] *)&ap].overflow_arg_area
+	leaq	32(%rsp), %rax	#, tmp100
+	movq	%rax, 24(%rsp)	# tmp100, MEM[(struct [1] *)&ap].reg_save_area
+	.loc 1 475 13 view .LVU664
+	movl	$0, %r9d	#,
+	leaq	8(%rsp), %r8	#,
+	movq	%rbx, %rcx	# fmt,
+	movl	$0, %edx	#,
+	movl	$1, %esi	#,
+	call	emit	#
+.LVL251:
+	.loc 1 476 13 view .LVU665
+.LBE64:
+# report.c:479: }
+	.loc 1 479 1 is_stmt 0 view .LVU666
+	jmp	.L161	#
+	.cfi_endproc
+.LFE48:
+	.size	report_noreturn, .-report_noreturn
+	.section	.rodata.str1.1
+.LC14:
+	.string	"Malloc returned NULL in %s"
+	.text
+	.globl	malloc_or_fail
+	.type	malloc_or_fail, @function
+malloc_or_fail:
+.LVL252:
+.LFB51:
+	.loc 1 535 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 535 1 is_stmt 0 view .LVU668
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbx	# tmp103, bytes
+	movq	%rsi, %rbp	# tmp104, fun_name
+	.loc 1 536 5 is_stmt 1 view .LVU669
+	.loc 1 537 5 view .LVU670
+# report.c:537:     void *p = malloc(bytes);
+	.loc 1 537 15 is_stmt 0 view .LVU671
+	call	malloc@PLT	#
+.LVL253:
+	.loc 1 538 5 is_stmt 1 view .LVU672
+# report.c:538:     if (!p) {
+	.loc 1 538 8 is_stmt 0 view .LVU673
+	testq	%rax, %rax	# <retval>
+	je	.L173	#,
+	.loc 1 543 5 is_stmt 1 view .LVU674
+# report.c:543:     allocate_cnt++;
+	.loc 1 543 17 is_stmt 0 view .LVU675
+	addq	$1, allocate_cnt(%rip)	#, allocate_cnt
+	.loc 1 544 5 is_stmt 1 view .LVU676
+# report.c:544:     allocate_bytes += bytes;
+	.loc 1 544 20 is_stmt 0 view .LVU677
+	addq	%rbx, allocate_bytes(%rip)	# bytes, allocate_bytes
+	.loc 1 545 5 is_stmt 1 view .LVU678
+# report.c:545:     current_bytes += bytes;
+	.loc 1 545 19 is_stmt 0 view .LVU679
+	addq	current_bytes(%rip), %rbx	# current_bytes, bytes
+.LVL254:
+	.loc 1 545 19 view .LVU680
+	movq	%rbx, current_bytes(%rip)	# _6, current_bytes
+	.loc 1 546 5 is_stmt 1 view .LVU681
+# report.c:546:     peak_bytes = MAX(peak_bytes, current_bytes);
+	.loc 1 546 18 is_stmt 0 view .LVU682
+	movq	peak_bytes(%rip), %rdx	# peak_bytes, peak_bytes
+	cmpq	%rbx, %rdx	# _6, peak_bytes
+	cmovb	%rbx, %rdx	# peak_bytes,, _6, tmp98
+# report.c:546:     peak_bytes = MAX(peak_bytes, current_bytes);
+	.loc 1 546 16 view .LVU683
+	movq	%rdx, peak_bytes(%rip)	# tmp98, peak_bytes
+	.loc 1 547 5 is_stmt 1 view .LVU684
+# report.c:547:     last_peak_bytes = MAX(last_peak_bytes, current_bytes);
+	.loc 1 547 23 is_stmt 0 view .LVU685
+	movq	last_peak_bytes(%rip), %rdx	# last_peak_bytes, last_peak_bytes
+	cmpq	%rbx, %rdx	# _6, last_peak_bytes
+	cmovb	%rbx, %rdx	# last_peak_bytes,, _6, tmp100
+# report.c:547:     last_peak_bytes = MAX(last_peak_bytes, current_bytes);
+	.loc 1 547 21 view .LVU686
+	movq	%rdx, last_peak_bytes(%rip)	# tmp100, last_peak_bytes
+	.loc 1 549 5 is_stmt 1 view .LVU687
+# report.c:550: }
+	.loc 1 550 1 is_stmt 0 view .LVU688
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL255:
+	.loc 1 550 1 view .LVU689
+	ret	
+.LVL256:
+.L173:
+	.cfi_restore_state
+	.loc 1 539 9 is_stmt 1 view .LVU690
+	movq	%rbp, %rsi	# fun_name,
+	leaq	.LC14(%rip), %rdi	#, tmp96
+	call	fail_fun	#
+.LVL257:
+	.loc 1 539 9 is_stmt 0 view .LVU691
+	.cfi_endproc
+.LFE51:
+	.size	malloc_or_fail, .-malloc_or_fail
+	.section	.rodata.str1.1
+.LC15:
+	.string	"Calloc returned NULL in %s"
+	.text
+	.globl	calloc_or_fail
+	.type	calloc_or_fail, @function
+calloc_or_fail:
+.LVL258:
+.LFB52:
+	.loc 1 554 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 554 1 is_stmt 0 view .LVU693
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdx, %rbp	# tmp107, fun_name
+	.loc 1 555 5 is_stmt 1 view .LVU694
+	movq	%rdi, %rbx	# cnt, _1
+	imulq	%rsi, %rbx	# bytes, _1
+	.loc 1 556 5 view .LVU695
+# report.c:556:     void *p = calloc(cnt, bytes);
+	.loc 1 556 15 is_stmt 0 view .LVU696
+	call	calloc@PLT	#
+.LVL259:
+	.loc 1 557 5 is_stmt 1 view .LVU697
+# report.c:557:     if (!p) {
+	.loc 1 557 8 is_stmt 0 view .LVU698
+	testq	%rax, %rax	# <retval>
+	je	.L177	#,
+	.loc 1 562 5 is_stmt 1 view .LVU699
+# report.c:562:     allocate_cnt++;
+	.loc 1 562 17 is_stmt 0 view .LVU700
+	addq	$1, allocate_cnt(%rip)	#, allocate_cnt
+	.loc 1 563 5 is_stmt 1 view .LVU701
+# report.c:563:     allocate_bytes += cnt * bytes;
+	.loc 1 563 20 is_stmt 0 view .LVU702
+	addq	%rbx, allocate_bytes(%rip)	# _1, allocate_bytes
+	.loc 1 564 5 is_stmt 1 view .LVU703
+# report.c:564:     current_bytes += cnt * bytes;
+	.loc 1 564 19 is_stmt 0 view .LVU704
+	addq	current_bytes(%rip), %rbx	# current_bytes, _1
+	movq	%rbx, current_bytes(%rip)	# _7, current_bytes
+	.loc 1 565 5 is_stmt 1 view .LVU705
+# report.c:565:     peak_bytes = MAX(peak_bytes, current_bytes);
+	.loc 1 565 18 is_stmt 0 view .LVU706
+	movq	peak_bytes(%rip), %rcx	# peak_bytes, peak_bytes
+	cmpq	%rbx, %rcx	# _7, peak_bytes
+	cmovb	%rbx, %rcx	# peak_bytes,, _7, tmp100
+# report.c:565:     peak_bytes = MAX(peak_bytes, current_bytes);
+	.loc 1 565 16 view .LVU707
+	movq	%rcx, peak_bytes(%rip)	# tmp100, peak_bytes
+	.loc 1 566 5 is_stmt 1 view .LVU708
+# report.c:566:     last_peak_bytes = MAX(last_peak_bytes, current_bytes);
+	.loc 1 566 23 is_stmt 0 view .LVU709
+	movq	last_peak_bytes(%rip), %rcx	# last_peak_bytes, last_peak_bytes
+	cmpq	%rbx, %rcx	# _7, last_peak_bytes
+	cmovb	%rbx, %rcx	# last_peak_bytes,, _7, tmp102
+# report.c:566:     last_peak_bytes = MAX(last_peak_bytes, current_bytes);
+	.loc 1 566 21 view .LVU710
+	movq	%rcx, last_peak_bytes(%rip)	# tmp102, last_peak_bytes
+	.loc 1 568 5 is_stmt 1 view .LVU711
+# report.c:569: }
+	.loc 1 569 1 is_stmt 0 view .LVU712
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL260:
+	.loc 1 569 1 view .LVU713
+	ret	
+.LVL261:
+.L177:
+	.cfi_restore_state
+	.loc 1 558 9 is_stmt 1 view .LVU714
+	movq	%rbp, %rsi	# fun_name,
+	leaq	.LC15(%rip), %rdi	#, tmp98
+	call	fail_fun	#
+.LVL262:
+	.loc 1 558 9 is_stmt 0 view .LVU715
+	.cfi_endproc
+.LFE52:
+	.size	calloc_or_fail, .-calloc_or_fail
+	.section	.rodata.str1.1
+.LC16:
+	.string	"strsave failed in %s"
+	.text
+	.globl	strsave_or_fail
+	.type	strsave_or_fail, @function
+strsave_or_fail:
+.LVL263:
+.LFB53:
+	.loc 1 572 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 572 1 is_stmt 0 view .LVU717
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movq	%rdi, %rbx	# tmp117, s
+	.loc 1 573 5 is_stmt 1 view .LVU718
+# report.c:573:     if (!s)
+	.loc 1 573 8 is_stmt 0 view .LVU719
+	testq	%rdi, %rdi	# s
+	je	.L181	#,
+	movq	%rsi, %r13	# tmp118, fun_name
+	.loc 1 576 5 is_stmt 1 view .LVU720
+# report.c:576:     size_t len = strlen(s);
+	.loc 1 576 18 is_stmt 0 view .LVU721
+	call	strlen@PLT	#
+.LVL264:
+	.loc 1 576 18 view .LVU722
+	movq	%rax, %rbp	# tmp119, tmp101
+.LVL265:
+	.loc 1 577 5 is_stmt 1 view .LVU723
+	leaq	1(%rax), %r12	#, _1
+	.loc 1 578 5 view .LVU724
+# report.c:578:     char *ss = malloc(len + 1);
+	.loc 1 578 16 is_stmt 0 view .LVU725
+	movq	%r12, %rdi	# _1,
+	call	malloc@PLT	#
+.LVL266:
+	.loc 1 578 16 view .LVU726
+	movq	%rax, %rdi	# tmp120, ss
+.LVL267:
+	.loc 1 579 5 is_stmt 1 view .LVU727
+# report.c:579:     if (!ss)
+	.loc 1 579 8 is_stmt 0 view .LVU728
+	testq	%rax, %rax	# ss
+	je	.L183	#,
+	.loc 1 582 5 is_stmt 1 view .LVU729
+# report.c:582:     allocate_cnt++;
+	.loc 1 582 17 is_stmt 0 view .LVU730
+	addq	$1, allocate_cnt(%rip)	#, allocate_cnt
+	.loc 1 583 5 is_stmt 1 view .LVU731
+# report.c:583:     allocate_bytes += len + 1;
+	.loc 1 583 20 is_stmt 0 view .LVU732
+	movq	allocate_bytes(%rip), %rax	# allocate_bytes, allocate_bytes
+.LVL268:
+	.loc 1 583 20 view .LVU733
+	leaq	1(%rbp,%rax), %rax	#, tmp107
+	movq	%rax, allocate_bytes(%rip)	# tmp107, allocate_bytes
+	.loc 1 584 5 is_stmt 1 view .LVU734
+# report.c:584:     current_bytes += len + 1;
+	.loc 1 584 19 is_stmt 0 view .LVU735
+	movq	current_bytes(%rip), %rax	# current_bytes, current_bytes
+	leaq	1(%rbp,%rax), %rdx	#, _9
+	movq	%rdx, current_bytes(%rip)	# _9, current_bytes
+	.loc 1 585 5 is_stmt 1 view .LVU736
+# report.c:585:     peak_bytes = MAX(peak_bytes, current_bytes);
+	.loc 1 585 18 is_stmt 0 view .LVU737
+	movq	peak_bytes(%rip), %rax	# peak_bytes, peak_bytes
+	cmpq	%rdx, %rax	# _9, peak_bytes
+	cmovb	%rdx, %rax	# peak_bytes,, _9, tmp110
+# report.c:585:     peak_bytes = MAX(peak_bytes, current_bytes);
+	.loc 1 585 16 view .LVU738
+	movq	%rax, peak_bytes(%rip)	# tmp110, peak_bytes
+	.loc 1 586 5 is_stmt 1 view .LVU739
+# report.c:586:     last_peak_bytes = MAX(last_peak_bytes, current_bytes);
+	.loc 1 586 23 is_stmt 0 view .LVU740
+	movq	last_peak_bytes(%rip), %rax	# last_peak_bytes, last_peak_bytes
+	cmpq	%rdx, %rax	# _9, last_peak_bytes
+	cmovb	%rdx, %rax	# last_peak_bytes,, _9, tmp112
+# report.c:586:     last_peak_bytes = MAX(last_peak_bytes, current_bytes);
+	.loc 1 586 21 view .LVU741
+	movq	%rax, last_peak_bytes(%rip)	# tmp112, last_peak_bytes
+	.loc 1 588 5 is_stmt 1 view .LVU742
+# report.c:588:     return strncpy(ss, s, len + 1);
+	.loc 1 588 12 is_stmt 0 view .LVU743
+	movq	%r12, %rdx	# _1,
+	movq	%rbx, %rsi	# s,
+	call	strncpy@PLT	#
+.LVL269:
+.L178:
+# report.c:589: }
+	.loc 1 589 1 view .LVU744
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL270:
+	.loc 1 589 1 view .LVU745
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL271:
+.L183:
+	.cfi_restore_state
+	.loc 1 580 9 is_stmt 1 view .LVU746
+	movq	%r13, %rsi	# fun_name,
+	leaq	.LC16(%rip), %rdi	#, tmp104
+	call	fail_fun	#
+.LVL272:
+.L181:
+# report.c:574:         return NULL;
+	.loc 1 574 16 is_stmt 0 view .LVU747
+	movq	%rdi, %rax	# s, <retval>
+	jmp	.L178	#
+	.cfi_endproc
+.LFE53:
+	.size	strsave_or_fail, .-strsave_or_fail
+	.section	.rodata.str1.1
+.LC17:
+	.string	"Attempting to free null block"
+	.text
+	.globl	free_block
+	.type	free_block, @function
+free_block:
+.LVL273:
+.LFB54:
+	.loc 1 593 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 593 1 is_stmt 0 view .LVU749
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rbp	# tmp91, b
+	movq	%rsi, %rbx	# tmp92, bytes
+	.loc 1 594 5 is_stmt 1 view .LVU750
+# report.c:594:     if (!b)
+	.loc 1 594 8 is_stmt 0 view .LVU751
+	testq	%rdi, %rdi	# b
+	je	.L187	#,
+.LVL274:
+.L185:
+	.loc 1 596 5 is_stmt 1 view .LVU752
+	movq	%rbp, %rdi	# b,
+	call	free@PLT	#
+.LVL275:
+	.loc 1 598 5 view .LVU753
+# report.c:598:     free_cnt++;
+	.loc 1 598 13 is_stmt 0 view .LVU754
+	addq	$1, free_cnt(%rip)	#, free_cnt
+	.loc 1 599 5 is_stmt 1 view .LVU755
+# report.c:599:     free_bytes += bytes;
+	.loc 1 599 16 is_stmt 0 view .LVU756
+	addq	%rbx, free_bytes(%rip)	# bytes, free_bytes
+	.loc 1 600 5 is_stmt 1 view .LVU757
+# report.c:600:     current_bytes -= bytes;
+	.loc 1 600 19 is_stmt 0 view .LVU758
+	subq	%rbx, current_bytes(%rip)	# bytes, current_bytes
+# report.c:601: }
+	.loc 1 601 1 view .LVU759
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL276:
+	.loc 1 601 1 view .LVU760
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+.LVL277:
+	.loc 1 601 1 view .LVU761
+	ret	
+.LVL278:
+.L187:
+	.cfi_restore_state
+	.loc 1 595 9 is_stmt 1 view .LVU762
+	leaq	.LC17(%rip), %rsi	#, tmp90
+	movl	$1, %edi	#,
+.LVL279:
+	.loc 1 595 9 is_stmt 0 view .LVU763
+	movl	$0, %eax	#,
+	call	report_event	#
+.LVL280:
+	jmp	.L185	#
+	.cfi_endproc
+.LFE54:
+	.size	free_block, .-free_block
+	.globl	free_array
+	.type	free_array, @function
+free_array:
+.LVL281:
+.LFB55:
+	.loc 1 605 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 605 1 is_stmt 0 view .LVU765
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbp	# tmp93, b
+	movq	%rsi, %rbx	# tmp94, cnt
+	movq	%rdx, %r12	# tmp95, bytes
+	.loc 1 606 5 is_stmt 1 view .LVU766
+# report.c:606:     if (!b)
+	.loc 1 606 8 is_stmt 0 view .LVU767
+	testq	%rdi, %rdi	# b
+	je	.L191	#,
+.LVL282:
+.L189:
+	.loc 1 608 5 is_stmt 1 view .LVU768
+	movq	%rbp, %rdi	# b,
+	call	free@PLT	#
+.LVL283:
+	.loc 1 610 5 view .LVU769
+# report.c:610:     free_cnt++;
+	.loc 1 610 13 is_stmt 0 view .LVU770
+	addq	$1, free_cnt(%rip)	#, free_cnt
+	.loc 1 611 5 is_stmt 1 view .LVU771
+# report.c:611:     free_bytes += cnt * bytes;
+	.loc 1 611 23 is_stmt 0 view .LVU772
+	imulq	%r12, %rbx	# bytes, cnt
+.LVL284:
+# report.c:611:     free_bytes += cnt * bytes;
+	.loc 1 611 16 view .LVU773
+	addq	%rbx, free_bytes(%rip)	# _3, free_bytes
+	.loc 1 612 5 is_stmt 1 view .LVU774
+# report.c:612:     current_bytes -= cnt * bytes;
+	.loc 1 612 19 is_stmt 0 view .LVU775
+	subq	%rbx, current_bytes(%rip)	# _3, current_bytes
+# report.c:613: }
+	.loc 1 613 1 view .LVU776
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL285:
+	.loc 1 613 1 view .LVU777
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL286:
+	.loc 1 613 1 view .LVU778
+	ret	
+.LVL287:
+.L191:
+	.cfi_restore_state
+	.loc 1 607 9 is_stmt 1 view .LVU779
+	leaq	.LC17(%rip), %rsi	#, tmp92
+	movl	$1, %edi	#,
+.LVL288:
+	.loc 1 607 9 is_stmt 0 view .LVU780
+	movl	$0, %eax	#,
+	call	report_event	#
+.LVL289:
+	.loc 1 607 9 view .LVU781
+	jmp	.L189	#
+	.cfi_endproc
+.LFE55:
+	.size	free_array, .-free_array
+	.globl	free_string
+	.type	free_string, @function
+free_string:
+.LVL290:
+.LFB56:
+	.loc 1 617 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 617 1 is_stmt 0 view .LVU783
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp90, s
+	.loc 1 618 5 is_stmt 1 view .LVU784
+# report.c:618:     if (!s)
+	.loc 1 618 8 is_stmt 0 view .LVU785
+	testq	%rdi, %rdi	# s
+	je	.L195	#,
+.LVL291:
+.L193:
+	.loc 1 620 5 is_stmt 1 view .LVU786
+# report.c:620:     free_block((void *) s, strlen(s) + 1);
+	.loc 1 620 28 is_stmt 0 view .LVU787
+	movq	%rbx, %rdi	# s,
+	call	strlen@PLT	#
+.LVL292:
+# report.c:620:     free_block((void *) s, strlen(s) + 1);
+	.loc 1 620 5 view .LVU788
+	leaq	1(%rax), %rsi	#, tmp89
+	movq	%rbx, %rdi	# s,
+	call	free_block	#
+.LVL293:
+# report.c:621: }
+	.loc 1 621 1 view .LVU789
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL294:
+	.loc 1 621 1 view .LVU790
+	ret	
+.LVL295:
+.L195:
+	.cfi_restore_state
+	.loc 1 619 9 is_stmt 1 view .LVU791
+	leaq	.LC17(%rip), %rsi	#, tmp85
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	report_event	#
+.LVL296:
+	jmp	.L193	#
+	.cfi_endproc
+.LFE56:
+	.size	free_string, .-free_string
+	.globl	time_ns
+	.type	time_ns, @function
+time_ns:
+.LFB59:
+	.loc 1 639 1 view -0
+	.cfi_startproc
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 32
+	.loc 1 640 5 view .LVU793
+	.loc 1 641 5 view .LVU794
+	movq	%rsp, %rsi	#, tmp88
+	movl	$1, %edi	#,
+	call	clock_gettime@PLT	#
+.LVL297:
+	.loc 1 642 5 view .LVU795
+# report.c:642:     return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+	.loc 1 642 33 is_stmt 0 view .LVU796
+	imulq	$1000000000, (%rsp), %rax	#, ts.tv_sec, tmp89
+# report.c:642:     return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+	.loc 1 642 46 view .LVU797
+	addq	8(%rsp), %rax	# ts.tv_nsec, <retval>
+# report.c:643: }
+	.loc 1 643 1 view .LVU798
+	addq	$24, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE59:
+	.size	time_ns, .-time_ns
+	.globl	delta_time
+	.type	delta_time, @function
+delta_time:
+.LVL298:
+.LFB58:
+	.loc 1 630 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 630 1 is_stmt 0 view .LVU800
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp94, timep
+	.loc 1 631 5 is_stmt 1 view .LVU801
+# report.c:631:     double current_time = 1.0E-9 * time_ns();
+	.loc 1 631 36 is_stmt 0 view .LVU802
+	movl	$0, %eax	#,
+	call	time_ns	#
+.LVL299:
+# report.c:631:     double current_time = 1.0E-9 * time_ns();
+	.loc 1 631 34 view .LVU803
+	testq	%rax, %rax	# _1
+	js	.L199	#,
+	pxor	%xmm0, %xmm0	# tmp88
+	cvtsi2sdq	%rax, %xmm0	# _1, tmp88
+.L200:
+# report.c:631:     double current_time = 1.0E-9 * time_ns();
+	.loc 1 631 12 view .LVU804
+	mulsd	.LC18(%rip), %xmm0	#, current_time
+.LVL300:
+	.loc 1 632 5 is_stmt 1 view .LVU805
+# report.c:632:     double delta = current_time - *timep;
+	.loc 1 632 12 is_stmt 0 view .LVU806
+	movapd	%xmm0, %xmm1	# current_time, <retval>
+	subsd	(%rbx), %xmm1	# *timep_7(D), <retval>
+.LVL301:
+	.loc 1 633 5 is_stmt 1 view .LVU807
+# report.c:633:     *timep = current_time;
+	.loc 1 633 12 is_stmt 0 view .LVU808
+	movsd	%xmm0, (%rbx)	# current_time, *timep_7(D)
+	.loc 1 634 5 is_stmt 1 view .LVU809
+# report.c:635: }
+	.loc 1 635 1 is_stmt 0 view .LVU810
+	movapd	%xmm1, %xmm0	# <retval>,
+.LVL302:
+	.loc 1 635 1 view .LVU811
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL303:
+	.loc 1 635 1 view .LVU812
+	ret	
+.LVL304:
+.L199:
+	.cfi_restore_state
+# report.c:631:     double current_time = 1.0E-9 * time_ns();
+	.loc 1 631 34 view .LVU813
+	movq	%rax, %rdx	# _1, tmp90
+	shrq	%rdx	# tmp90
+	andl	$1, %eax	#, tmp91
+	orq	%rax, %rdx	# tmp91, tmp90
+	pxor	%xmm0, %xmm0	# tmp89
+	cvtsi2sdq	%rdx, %xmm0	# tmp90, tmp89
+	addsd	%xmm0, %xmm0	# tmp89, tmp88
+	jmp	.L200	#
+	.cfi_endproc
+.LFE58:
+	.size	delta_time, .-delta_time
+	.globl	init_time
+	.type	init_time, @function
+init_time:
+.LVL305:
+.LFB57:
+	.loc 1 625 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 625 1 is_stmt 0 view .LVU815
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 626 5 is_stmt 1 view .LVU816
+# report.c:626:     (void) delta_time(timep);
+	.loc 1 626 12 is_stmt 0 view .LVU817
+	call	delta_time	#
+.LVL306:
+# report.c:627: }
+	.loc 1 627 1 view .LVU818
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE57:
+	.size	init_time, .-init_time
+	.globl	close_metrics_file
+	.type	close_metrics_file, @function
+close_metrics_file:
+.LFB63:
+	.loc 1 707 1 is_stmt 1 view -0
+	.cfi_startproc
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 708 5 view .LVU820
+# report.c:708:     if (metricsfd >= 0)
+	.loc 1 708 19 is_stmt 0 view .LVU821
+	movl	metricsfd(%rip), %edi	# metricsfd, metricsfd.109_1
+# report.c:708:     if (metricsfd >= 0)
+	.loc 1 708 8 view .LVU822
+	testl	%edi, %edi	# metricsfd.109_1
+	jns	.L207	#,
+.L205:
+	.loc 1 710 5 is_stmt 1 view .LVU823
+# report.c:710:     metricsfd = -1;
+	.loc 1 710 15 is_stmt 0 view .LVU824
+	movl	$-1, metricsfd(%rip)	#, metricsfd
+	.loc 1 711 5 is_stmt 1 view .LVU825
+# report.c:711:     mopen = false;
+	.loc 1 711 11 is_stmt 0 view .LVU826
+	movb	$0, mopen(%rip)	#, mopen
+# report.c:712: }
+	.loc 1 712 1 view .LVU827
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.L207:
+	.cfi_restore_state
+	.loc 1 709 9 is_stmt 1 view .LVU828
+	call	close@PLT	#
+.LVL307:
+	jmp	.L205	#
+	.cfi_endproc
+.LFE63:
+	.size	close_metrics_file, .-close_metrics_file
+	.globl	set_metrics_file
+	.type	set_metrics_file, @function
+set_metrics_file:
+.LVL308:
+.LFB62:
+	.loc 1 700 1 view -0
+	.cfi_startproc
+	.loc 1 700 1 is_stmt 0 view .LVU830
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp88, file_name
+	.loc 1 701 5 is_stmt 1 view .LVU831
+	movl	$0, %eax	#,
+	call	close_metrics_file	#
+.LVL309:
+	.loc 1 702 5 view .LVU832
+# report.c:702:     metricsfd = open(file_name, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+	.loc 1 702 17 is_stmt 0 view .LVU833
+	movl	$420, %edx	#,
+	movl	$1601, %esi	#,
+	movq	%rbx, %rdi	# file_name,
+	movl	$0, %eax	#,
+	call	open@PLT	#
+.LVL310:
+# report.c:702:     metricsfd = open(file_name, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+	.loc 1 702 15 view .LVU834
+	movl	%eax, metricsfd(%rip)	# _1, metricsfd
+	.loc 1 703 5 is_stmt 1 view .LVU835
+# report.c:703:     return metricsfd >= 0;
+	.loc 1 703 22 is_stmt 0 view .LVU836
+	notl	%eax	# tmp86
+	shrl	$31, %eax	#, <retval>
+# report.c:704: }
+	.loc 1 704 1 view .LVU837
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL311:
+	.loc 1 704 1 view .LVU838
+	ret	
+	.cfi_endproc
+.LFE62:
+	.size	set_metrics_file, .-set_metrics_file
+	.globl	metrics_enabled
+	.type	metrics_enabled, @function
+metrics_enabled:
+.LFB64:
+	.loc 1 715 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 716 5 view .LVU840
+# report.c:716:     return metricsfd >= 0;
+	.loc 1 716 22 is_stmt 0 view .LVU841
+	movl	metricsfd(%rip), %eax	# metricsfd, tmp85
+	notl	%eax	# tmp85
+	shrl	$31, %eax	#, <retval>
+# report.c:717: }
+	.loc 1 717 1 view .LVU842
+	ret	
+	.cfi_endproc
+.LFE64:
+	.size	metrics_enabled, .-metrics_enabled
+	.section	.rodata.str1.1
+.LC19:
+	.string	"{\"cmd\":"
+.LC20:
+	.string	",\"args\":["
+.LC21:
+	.string	","
+.LC22:
+	.string	"]"
+	.text
+	.globl	metric_begin
+	.type	metric_begin, @function
+metric_begin:
+.LVL312:
+.LFB65:
+	.loc 1 720 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 721 5 view .LVU844
+# report.c:721:     if (metricsfd < 0)
+	.loc 1 721 8 is_stmt 0 view .LVU845
+	cmpl	$0, metricsfd(%rip)	#, metricsfd
+	js	.L218	#,
+# report.c:720: {
+	.loc 1 720 1 view .LVU846
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+	movl	%edi, %ebp	# tmp98, argc
+	movq	%rsi, %r12	# tmp99, argv
+	.loc 1 723 5 is_stmt 1 view .LVU847
+# report.c:723:     mlen = 0;
+	.loc 1 723 10 is_stmt 0 view .LVU848
+	movq	$0, mlen(%rip)	#, mlen
+	.loc 1 724 5 is_stmt 1 view .LVU849
+# report.c:724:     mopen = true;
+	.loc 1 724 11 is_stmt 0 view .LVU850
+	movb	$1, mopen(%rip)	#, mopen
+	.loc 1 725 5 is_stmt 1 view .LVU851
+	leaq	.LC19(%rip), %rdi	#, tmp91
+.LVL313:
+	.loc 1 725 5 is_stmt 0 view .LVU852
+	movl	$0, %eax	#,
+	call	metric_append	#
+.LVL314:
+	.loc 1 726 5 is_stmt 1 view .LVU853
+	movq	(%r12), %rdi	# *argv_15(D), *argv_15(D)
+	call	metric_quote	#
+.LVL315:
+	.loc 1 727 5 view .LVU854
+	leaq	.LC20(%rip), %rdi	#, tmp93
+	movl	$0, %eax	#,
+	call	metric_append	#
+.LVL316:
+	.loc 1 728 5 view .LVU855
+.LBB65:
+	.loc 1 728 10 view .LVU856
+	.loc 1 728 23 view .LVU857
+	cmpl	$1, %ebp	#, argc
+	jle	.L213	#,
+	movl	%ebp, %ebp	# argc, _30
+	.loc 1 728 23 is_stmt 0 view .LVU858
+	movl	$1, %ebx	#, ivtmp.245
+# report.c:730:             metric_append(",");
+	.loc 1 730 13 view .LVU859
+	leaq	.LC21(%rip), %r13	#, tmp97
+	jmp	.L215	#
+.LVL317:
+.L214:
+	.loc 1 731 9 is_stmt 1 discriminator 2 view .LVU860
+	movq	(%r12,%rbx,8), %rdi	# MEM[(char * *)argv_15(D) + ivtmp.245_9 * 8], MEM[(char * *)argv_15(D) + ivtmp.245_9 * 8]
+	call	metric_quote	#
+.LVL318:
+	.loc 1 728 32 discriminator 2 view .LVU861
+	.loc 1 728 23 discriminator 2 view .LVU862
+	addq	$1, %rbx	#, ivtmp.245
+.LVL319:
+	.loc 1 728 23 is_stmt 0 discriminator 2 view .LVU863
+	cmpq	%rbp, %rbx	# _30, ivtmp.245
+	je	.L213	#,
+.LVL320:
+.L215:
+	.loc 1 729 9 is_stmt 1 view .LVU864
+# report.c:729:         if (i > 1)
+	.loc 1 729 12 is_stmt 0 view .LVU865
+	cmpl	$1, %ebx	#, ivtmp.245
+	jle	.L214	#,
+	.loc 1 730 13 is_stmt 1 view .LVU866
+	movq	%r13, %rdi	# tmp97,
+	movl	$0, %eax	#,
+	call	metric_append	#
+.LVL321:
+	jmp	.L214	#
+.LVL322:
+.L213:
+	.loc 1 730 13 is_stmt 0 view .LVU867
+.LBE65:
+	.loc 1 733 5 is_stmt 1 view .LVU868
+	leaq	.LC22(%rip), %rdi	#, tmp96
+	movl	$0, %eax	#,
+	call	metric_append	#
+.LVL323:
+# report.c:734: }
+	.loc 1 734 1 is_stmt 0 view .LVU869
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL324:
+	.loc 1 734 1 view .LVU870
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL325:
+.L218:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.loc 1 734 1 view .LVU871
+	ret	
+	.cfi_endproc
+.LFE65:
+	.size	metric_begin, .-metric_begin
+	.section	.rodata.str1.1
+.LC23:
+	.string	",\"%s\":%ld"
+	.text
+	.globl	metric_int
+	.type	metric_int, @function
+metric_int:
+.LVL326:
+.LFB66:
+	.loc 1 737 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 738 5 view .LVU873
+# report.c:738:     if (mopen)
+	.loc 1 738 8 is_stmt 0 view .LVU874
+	cmpb	$0, mopen(%rip)	#, mopen
+	jne	.L227	#,
+	ret	
+.L227:
+# report.c:737: {
+	.loc 1 737 1 view .LVU875
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 739 9 is_stmt 1 view .LVU876
+	movq	%rsi, %rdx	# val,
+	movq	%rdi, %rsi	# key,
+.LVL327:
+	.loc 1 739 9 is_stmt 0 view .LVU877
+	leaq	.LC23(%rip), %rdi	#, tmp85
+.LVL328:
+	.loc 1 739 9 view .LVU878
+	movl	$0, %eax	#,
+	call	metric_append	#
+.LVL329:
+# report.c:740: }
+	.loc 1 740 1 view .LVU879
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE66:
+	.size	metric_int, .-metric_int
+	.section	.rodata.str1.1
+.LC25:
+	.string	",\"%s\":%.9g"
+.LC26:
+	.string	",\"%s\":null"
+	.text
+	.globl	metric_double
+	.type	metric_double, @function
+metric_double:
+.LVL330:
+.LFB67:
+	.loc 1 743 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 744 5 view .LVU881
+# report.c:744:     if (!mopen)
+	.loc 1 744 8 is_stmt 0 view .LVU882
+	cmpb	$0, mopen(%rip)	#, mopen
+	je	.L236	#,
+# report.c:743: {
+	.loc 1 743 1 view .LVU883
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 747 5 is_stmt 1 view .LVU884
+# report.c:747:     if (val == val && val - val == 0)
+	.loc 1 747 8 is_stmt 0 view .LVU885
+	ucomisd	%xmm0, %xmm0	# val, val
+	jp	.L230	#,
+# report.c:747:     if (val == val && val - val == 0)
+	.loc 1 747 27 discriminator 1 view .LVU886
+	movapd	%xmm0, %xmm1	# val, tmp86
+	subsd	%xmm0, %xmm1	# val, tmp86
+# report.c:747:     if (val == val && val - val == 0)
+	.loc 1 747 20 discriminator 1 view .LVU887
+	pxor	%xmm2, %xmm2	# tmp87
+	ucomisd	%xmm2, %xmm1	# tmp87, tmp86
+	jp	.L230	#,
+	je	.L239	#,
+.L230:
+	.loc 1 750 9 is_stmt 1 view .LVU888
+	movq	%rdi, %rsi	# key,
+	leaq	.LC26(%rip), %rdi	#, tmp90
+.LVL331:
+	.loc 1 750 9 is_stmt 0 view .LVU889
+	movl	$0, %eax	#,
+	call	metric_append	#
+.LVL332:
+.L228:
+# report.c:751: }
+	.loc 1 751 1 view .LVU890
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL333:
+.L239:
+	.cfi_restore_state
+	.loc 1 748 9 is_stmt 1 view .LVU891
+	movq	%rdi, %rsi	# key,
+	leaq	.LC25(%rip), %rdi	#, tmp89
+.LVL334:
+	.loc 1 748 9 is_stmt 0 view .LVU892
+	movl	$1, %eax	#,
+	call	metric_append	#
+.LVL335:
+	.loc 1 748 9 view .LVU893
+	jmp	.L228	#
+.LVL336:
+.L236:
+	.cfi_def_cfa_offset 8
+	.loc 1 748 9 view .LVU894
+	ret	
+	.cfi_endproc
+.LFE67:
+	.size	metric_double, .-metric_double
+	.section	.rodata.str1.1
+.LC27:
+	.string	"true"
+.LC28:
+	.string	"false"
+.LC29:
+	.string	",\"%s\":%s"
+	.text
+	.globl	metric_bool
+	.type	metric_bool, @function
+metric_bool:
+.LVL337:
+.LFB68:
+	.loc 1 754 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 755 5 view .LVU896
+# report.c:755:     if (mopen)
+	.loc 1 755 8 is_stmt 0 view .LVU897
+	cmpb	$0, mopen(%rip)	#, mopen
+	je	.L245	#,
+# report.c:754: {
+	.loc 1 754 1 view .LVU898
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 756 9 is_stmt 1 view .LVU899
+	testb	%sil, %sil	# val
+	leaq	.LC28(%rip), %rdx	#, tmp88
+	leaq	.LC27(%rip), %rax	#, tmp89
+	cmovne	%rax, %rdx	# tmp88,, tmp89, iftmp.128_2
+	movq	%rdi, %rsi	# key,
+.LVL338:
+	.loc 1 756 9 is_stmt 0 view .LVU900
+	leaq	.LC29(%rip), %rdi	#, tmp87
+.LVL339:
+	.loc 1 756 9 view .LVU901
+	movl	$0, %eax	#,
+	call	metric_append	#
+.LVL340:
+# report.c:757: }
+	.loc 1 757 1 view .LVU902
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL341:
+.L245:
+	.loc 1 757 1 view .LVU903
+	ret	
+	.cfi_endproc
+.LFE68:
+	.size	metric_bool, .-metric_bool
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC30:
+	.string	",\"console_bytes\":%lu,\"console_peak_bytes\":%lu}\n"
+	.text
+	.globl	metric_end
+	.type	metric_end, @function
+metric_end:
+.LFB69:
+	.loc 1 760 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 761 5 view .LVU905
+# report.c:761:     if (!mopen)
+	.loc 1 761 8 is_stmt 0 view .LVU906
+	cmpb	$0, mopen(%rip)	#, mopen
+	jne	.L257	#,
+	ret	
+.L257:
+# report.c:760: {
+	.loc 1 760 1 view .LVU907
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+	.loc 1 763 5 is_stmt 1 view .LVU908
+	movq	peak_bytes(%rip), %rdx	# peak_bytes,
+	movq	current_bytes(%rip), %rsi	# current_bytes,
+	leaq	.LC30(%rip), %rdi	#, tmp93
+	movl	$0, %eax	#,
+	call	metric_append	#
+.LVL342:
+.L251:
+	.loc 1 765 5 discriminator 2 view .LVU909
+	.loc 1 766 5 discriminator 2 view .LVU910
+	.loc 1 767 9 discriminator 2 view .LVU911
+# report.c:767:         n = write(metricsfd, mbuf, mlen);
+	.loc 1 767 13 is_stmt 0 discriminator 2 view .LVU912
+	movq	mlen(%rip), %rdx	# mlen,
+	movq	mbuf(%rip), %rsi	# mbuf,
+	movl	metricsfd(%rip), %edi	# metricsfd,
+	call	write@PLT	#
+.LVL343:
+	.loc 1 768 18 is_stmt 1 discriminator 2 view .LVU913
+	testq	%rax, %rax	# tmp97
+	jns	.L250	#,
+# report.c:768:     while (n < 0 && errno == EINTR);
+	.loc 1 768 21 is_stmt 0 discriminator 1 view .LVU914
+	call	__errno_location@PLT	#
+.LVL344:
+# report.c:768:     while (n < 0 && errno == EINTR);
+	.loc 1 768 18 discriminator 1 view .LVU915
+	cmpl	$4, (%rax)	#, *_7
+	je	.L251	#,
+.L250:
+	.loc 1 769 5 is_stmt 1 view .LVU916
+# report.c:769:     mopen = false;
+	.loc 1 769 11 is_stmt 0 view .LVU917
+	movb	$0, mopen(%rip)	#, mopen
+# report.c:770: }
+	.loc 1 770 1 view .LVU918
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE69:
+	.size	metric_end, .-metric_end
+	.local	mopen
+	.comm	mopen,1,1
+	.local	msize
+	.comm	msize,8,8
+	.local	mlen
+	.comm	mlen,8,8
+	.local	mbuf
+	.comm	mbuf,8,8
+	.data
+	.align 4
+	.type	metricsfd, @object
+	.size	metricsfd, 4
+metricsfd:
+	.long	-1
+	.local	current_bytes
+	.comm	current_bytes,8,8
+	.local	last_peak_bytes
+	.comm	last_peak_bytes,8,8
+	.local	peak_bytes
+	.comm	peak_bytes,8,8
+	.local	free_bytes
+	.comm	free_bytes,8,8
+	.local	free_cnt
+	.comm	free_cnt,8,8
+	.local	allocate_bytes
+	.comm	allocate_bytes,8,8
+	.local	allocate_cnt
+	.comm	allocate_cnt,8,8
+	.align 32
+	.type	fail_buf, @object
+	.size	fail_buf, 1024
+fail_buf:
+	.string	"FATAL Error.  Exiting\n"
+	.zero	1001
+	.local	ret
+	.comm	ret,4,4
+	.local	put_len
+	.comm	put_len,8,8
+	.local	put_ring
+	.comm	put_ring,8,8
+	.local	fork_mask
+	.comm	fork_mask,128,32
+	.local	producer_waiting
+	.comm	producer_waiting,1,1
+	.local	writer_waiting
+	.comm	writer_waiting,1,1
+	.align 4
+	.type	space_fd, @object
+	.size	space_fd, 4
+space_fd:
+	.long	-1
+	.align 4
+	.type	data_fd, @object
+	.size	data_fd, 4
+data_fd:
+	.long	-1
+	.local	in_signal
+	.comm	in_signal,4,4
+	.local	writer_started
+	.comm	writer_started,1,1
+	.local	drain_lock
+	.comm	drain_lock,40,32
+	.local	rings
+	.comm	rings,16,16
+	.globl	async_output
+	.type	async_output, @object
+	.size	async_output, 1
+async_output:
+	.byte	1
+	.globl	verblevel
+	.bss
+	.align 4
+	.type	verblevel, @object
+	.size	verblevel, 4
+verblevel:
+	.zero	4
+	.local	logfile
+	.comm	logfile,8,8
+	.local	verbfile
+	.comm	verbfile,8,8
+	.local	errfile
+	.comm	errfile,8,8
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC18:
+	.long	-400107883
+	.long	1041313291
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 13 "<built-in>"
+	.file 14 "/usr/include/pthread.h"
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdatomic.h"
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 18 "/usr/include/stdio.h"
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/eventfd.h"
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/eventfd.h"
+	.file 23 "report.h"
+	.file 24 "/usr/include/stdlib.h"
+	.file 25 "/usr/include/unistd.h"
+	.file 26 "/usr/include/fcntl.h"
+	.file 27 "/usr/include/time.h"
+	.file 28 "/usr/include/string.h"
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/sigthread.h"
+	.file 30 "/usr/include/signal.h"
+	.file 31 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2f6e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3e
+	.long	.LASF273
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF3
+	.uleb128 0x10
+	.long	0x35
+	.uleb128 0x14
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x10
+	.long	0x41
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x10
+	.long	0x4d
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x10
+	.long	0x59
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x10
+	.long	0x65
+	.uleb128 0x14
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x10
+	.long	0x71
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x32
+	.long	0x7d
+	.uleb128 0x10
+	.long	0x7d
+	.uleb128 0x8
+	.long	.LASF10
+	.byte	0x2
+	.byte	0x2c
+	.byte	0x19
+	.long	0x9a
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x10
+	.long	0x9a
+	.uleb128 0x8
+	.long	.LASF11
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x59
+	.uleb128 0x8
+	.long	.LASF12
+	.byte	0x2
+	.byte	0x98
+	.byte	0x19
+	.long	0x9a
+	.uleb128 0x8
+	.long	.LASF13
+	.byte	0x2
+	.byte	0x99
+	.byte	0x1b
+	.long	0x9a
+	.uleb128 0x8
+	.long	.LASF14
+	.byte	0x2
+	.byte	0xa0
+	.byte	0x1a
+	.long	0x9a
+	.uleb128 0x8
+	.long	.LASF15
+	.byte	0x2
+	.byte	0xa1
+	.byte	0x1e
+	.long	0x4d
+	.uleb128 0x8
+	.long	.LASF16
+	.byte	0x2
+	.byte	0xa9
+	.byte	0x1d
+	.long	0x7d
+	.uleb128 0x40
+	.byte	0x8
+	.uleb128 0x1b
+	.long	0xee
+	.uleb128 0x8
+	.long	.LASF17
+	.byte	0x2
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x9a
+	.uleb128 0x8
+	.long	.LASF18
+	.byte	0x2
+	.byte	0xc5
+	.byte	0x21
+	.long	0x9a
+	.uleb128 0x7
+	.long	0x112
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF19
+	.uleb128 0x26
+	.long	0x112
+	.uleb128 0x10
+	.long	0x112
+	.uleb128 0x8
+	.long	.LASF20
+	.byte	0x2
+	.byte	0xd7
+	.byte	0xd
+	.long	0x7d
+	.uleb128 0x8
+	.long	.LASF21
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x59
+	.uleb128 0x10
+	.long	0x12f
+	.uleb128 0x27
+	.long	.LASF26
+	.byte	0x10
+	.byte	0x4
+	.byte	0xb
+	.byte	0x8
+	.long	0x168
+	.uleb128 0x4
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x10
+	.byte	0xc
+	.long	0xca
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x15
+	.byte	0x15
+	.long	0x101
+	.byte	0x8
+	.byte	0
+	.uleb128 0x26
+	.long	0x140
+	.uleb128 0x7
+	.long	0x119
+	.uleb128 0x1b
+	.long	0x16d
+	.uleb128 0x8
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x7
+	.byte	0x15
+	.long	0xe2
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF25
+	.uleb128 0x10
+	.long	0x183
+	.uleb128 0x27
+	.long	.LASF27
+	.byte	0x10
+	.byte	0x6
+	.byte	0x33
+	.byte	0x10
+	.long	0x1b7
+	.uleb128 0x4
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x35
+	.byte	0x23
+	.long	0x1b7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x36
+	.byte	0x23
+	.long	0x1b7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x18f
+	.uleb128 0x8
+	.long	.LASF30
+	.byte	0x6
+	.byte	0x37
+	.byte	0x3
+	.long	0x18f
+	.uleb128 0x27
+	.long	.LASF31
+	.byte	0x28
+	.byte	0x7
+	.byte	0x16
+	.byte	0x8
+	.long	0x23e
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x7
+	.byte	0x18
+	.byte	0x7
+	.long	0x7d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0x7
+	.byte	0x19
+	.byte	0x10
+	.long	0x4d
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x7
+	.long	0x7d
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x10
+	.long	0x4d
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x7
+	.byte	0x20
+	.byte	0x7
+	.long	0x7d
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF37
+	.byte	0x7
+	.byte	0x22
+	.byte	0x9
+	.long	0x71
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0x7
+	.byte	0x23
+	.byte	0x9
+	.long	0x71
+	.byte	0x16
+	.uleb128 0x4
+	.long	.LASF39
+	.byte	0x7
+	.byte	0x24
+	.byte	0x14
+	.long	0x1bc
+	.byte	0x18
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF40
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x59
+	.uleb128 0x41
+	.long	.LASF43
+	.byte	0x38
+	.byte	0x8
+	.byte	0x38
+	.byte	0x7
+	.long	0x26e
+	.uleb128 0x21
+	.long	.LASF41
+	.byte	0x3a
+	.byte	0x8
+	.long	0x26e
+	.uleb128 0x21
+	.long	.LASF42
+	.byte	0x3b
+	.byte	0xc
+	.long	0x9a
+	.byte	0
+	.uleb128 0x16
+	.long	0x112
+	.long	0x27e
+	.uleb128 0x19
+	.long	0x59
+	.byte	0x37
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF43
+	.byte	0x8
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x24a
+	.uleb128 0x26
+	.long	0x27e
+	.uleb128 0x42
+	.byte	0x28
+	.byte	0x8
+	.byte	0x43
+	.byte	0x9
+	.long	0x2ba
+	.uleb128 0x21
+	.long	.LASF44
+	.byte	0x45
+	.byte	0x1c
+	.long	0x1c8
+	.uleb128 0x21
+	.long	.LASF41
+	.byte	0x46
+	.byte	0x8
+	.long	0x2ba
+	.uleb128 0x21
+	.long	.LASF42
+	.byte	0x47
+	.byte	0xc
+	.long	0x9a
+	.byte	0
+	.uleb128 0x16
+	.long	0x112
+	.long	0x2ca
+	.uleb128 0x19
+	.long	0x59
+	.byte	0x27
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x48
+	.byte	0x3
+	.long	0x28f
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF46
+	.uleb128 0x10
+	.long	0x2d6
+	.uleb128 0x16
+	.long	0x112
+	.long	0x2f2
+	.uleb128 0x19
+	.long	0x59
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x33
+	.byte	0x80
+	.byte	0x9
+	.byte	0x5
+	.byte	0x9
+	.long	0x309
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x9
+	.byte	0x7
+	.byte	0x15
+	.long	0x309
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x59
+	.long	0x319
+	.uleb128 0x19
+	.long	0x59
+	.byte	0xf
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF48
+	.byte	0x9
+	.byte	0x8
+	.byte	0x3
+	.long	0x2f2
+	.uleb128 0x26
+	.long	0x319
+	.uleb128 0x22
+	.long	0x4d
+	.byte	0xe
+	.byte	0x30
+	.byte	0x1
+	.long	0x367
+	.uleb128 0xb
+	.long	.LASF49
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF50
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF51
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF52
+	.byte	0x3
+	.uleb128 0xb
+	.long	.LASF53
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF54
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF55
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF56
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF57
+	.byte	0xa
+	.byte	0x8
+	.byte	0x18
+	.long	0x123
+	.uleb128 0x32
+	.long	0x367
+	.uleb128 0x8
+	.long	.LASF58
+	.byte	0xb
+	.byte	0x7
+	.byte	0x14
+	.long	0x319
+	.uleb128 0x43
+	.uleb128 0x7
+	.long	0x384
+	.uleb128 0x8
+	.long	.LASF59
+	.byte	0xc
+	.byte	0x28
+	.byte	0x1b
+	.long	0x396
+	.uleb128 0x44
+	.long	.LASF274
+	.long	0x39f
+	.uleb128 0x16
+	.long	0x3af
+	.long	0x3af
+	.uleb128 0x19
+	.long	0x59
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF275
+	.byte	0x18
+	.byte	0xd
+	.byte	0
+	.long	0x3e4
+	.uleb128 0x28
+	.long	.LASF60
+	.long	0x4d
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF61
+	.long	0x4d
+	.byte	0x4
+	.uleb128 0x28
+	.long	.LASF62
+	.long	0xee
+	.byte	0x8
+	.uleb128 0x28
+	.long	.LASF63
+	.long	0xee
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF64
+	.byte	0xc
+	.byte	0x63
+	.byte	0x18
+	.long	0x38a
+	.uleb128 0x22
+	.long	0x4d
+	.byte	0xf
+	.byte	0x1e
+	.byte	0x3
+	.long	0x421
+	.uleb128 0xb
+	.long	.LASF65
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF66
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF67
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF68
+	.byte	0x3
+	.uleb128 0xb
+	.long	.LASF69
+	.byte	0x4
+	.uleb128 0xb
+	.long	.LASF70
+	.byte	0x5
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF71
+	.byte	0xf
+	.byte	0x28
+	.byte	0x17
+	.long	0x434
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF72
+	.uleb128 0x10
+	.long	0x42d
+	.uleb128 0x33
+	.byte	0x1
+	.byte	0xf
+	.byte	0xda
+	.byte	0x11
+	.long	0x450
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0xf
+	.byte	0xdd
+	.byte	0x9
+	.long	0x42d
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x439
+	.uleb128 0x27
+	.long	.LASF73
+	.byte	0xd8
+	.byte	0x10
+	.byte	0x31
+	.byte	0x8
+	.long	0x5dc
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0x10
+	.byte	0x33
+	.byte	0x7
+	.long	0x7d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF75
+	.byte	0x10
+	.byte	0x36
+	.byte	0x9
+	.long	0x10d
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0x10
+	.byte	0x37
+	.byte	0x9
+	.long	0x10d
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0x10
+	.byte	0x38
+	.byte	0x9
+	.long	0x10d
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0x10
+	.byte	0x39
+	.byte	0x9
+	.long	0x10d
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF79
+	.byte	0x10
+	.byte	0x3a
+	.byte	0x9
+	.long	0x10d
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF80
+	.byte	0x10
+	.byte	0x3b
+	.byte	0x9
+	.long	0x10d
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0x10
+	.byte	0x3c
+	.byte	0x9
+	.long	0x10d
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF82
+	.byte	0x10
+	.byte	0x3d
+	.byte	0x9
+	.long	0x10d
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF83
+	.byte	0x10
+	.byte	0x40
+	.byte	0x9
+	.long	0x10d
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF84
+	.byte	0x10
+	.byte	0x41
+	.byte	0x9
+	.long	0x10d
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF85
+	.byte	0x10
+	.byte	0x42
+	.byte	0x9
+	.long	0x10d
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0x10
+	.byte	0x44
+	.byte	0x16
+	.long	0x5f5
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF87
+	.byte	0x10
+	.byte	0x46
+	.byte	0x14
+	.long	0x5fa
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF88
+	.byte	0x10
+	.byte	0x48
+	.byte	0x7
+	.long	0x7d
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF89
+	.byte	0x10
+	.byte	0x49
+	.byte	0x7
+	.long	0x7d
+	.byte	0x74
+	.uleb128 0x4
+	.long	.LASF90
+	.byte	0x10
+	.byte	0x4a
+	.byte	0xb
+	.long	0xb2
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF91
+	.byte	0x10
+	.byte	0x4d
+	.byte	0x12
+	.long	0x41
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF92
+	.byte	0x10
+	.byte	0x4e
+	.byte	0xf
+	.long	0x65
+	.byte	0x82
+	.uleb128 0x4
+	.long	.LASF93
+	.byte	0x10
+	.byte	0x4f
+	.byte	0x8
+	.long	0x5ff
+	.byte	0x83
+	.uleb128 0x4
+	.long	.LASF94
+	.byte	0x10
+	.byte	0x51
+	.byte	0xf
+	.long	0x60f
+	.byte	0x88
+	.uleb128 0x4
+	.long	.LASF95
+	.byte	0x10
+	.byte	0x59
+	.byte	0xd
+	.long	0xbe
+	.byte	0x90
+	.uleb128 0x4
+	.long	.LASF96
+	.byte	0x10
+	.byte	0x5b
+	.byte	0x17
+	.long	0x619
+	.byte	0x98
+	.uleb128 0x4
+	.long	.LASF97
+	.byte	0x10
+	.byte	0x5c
+	.byte	0x19
+	.long	0x623
+	.byte	0xa0
+	.uleb128 0x4
+	.long	.LASF98
+	.byte	0x10
+	.byte	0x5d
+	.byte	0x14
+	.long	0x5fa
+	.byte	0xa8
+	.uleb128 0x4
+	.long	.LASF99
+	.byte	0x10
+	.byte	0x5e
+	.byte	0x9
+	.long	0xee
+	.byte	0xb0
+	.uleb128 0x4
+	.long	.LASF100
+	.byte	0x10
+	.byte	0x5f
+	.byte	0xa
+	.long	0x12f
+	.byte	0xb8
+	.uleb128 0x4
+	.long	.LASF101
+	.byte	0x10
+	.byte	0x60
+	.byte	0x7
+	.long	0x7d
+	.byte	0xc0
+	.uleb128 0x4
+	.long	.LASF102
+	.byte	0x10
+	.byte	0x62
+	.byte	0x8
+	.long	0x628
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF103
+	.byte	0x11
+	.byte	0x7
+	.byte	0x19
+	.long	0x455
+	.uleb128 0x46
+	.long	.LASF276
+	.byte	0x10
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x2c
+	.long	.LASF104
+	.uleb128 0x7
+	.long	0x5f0
+	.uleb128 0x7
+	.long	0x455
+	.uleb128 0x16
+	.long	0x112
+	.long	0x60f
+	.uleb128 0x19
+	.long	0x59
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x5e8
+	.uleb128 0x2c
+	.long	.LASF105
+	.uleb128 0x7
+	.long	0x614
+	.uleb128 0x2c
+	.long	.LASF106
+	.uleb128 0x7
+	.long	0x61e
+	.uleb128 0x16
+	.long	0x112
+	.long	0x638
+	.uleb128 0x19
+	.long	0x59
+	.byte	0x13
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF107
+	.byte	0x12
+	.byte	0x4d
+	.byte	0x13
+	.long	0xf5
+	.uleb128 0x7
+	.long	0x5dc
+	.uleb128 0x1b
+	.long	0x644
+	.uleb128 0x2d
+	.long	.LASF118
+	.byte	0x12
+	.byte	0x90
+	.byte	0xe
+	.long	0x644
+	.uleb128 0x8
+	.long	.LASF108
+	.byte	0x13
+	.byte	0x1b
+	.byte	0x13
+	.long	0x8e
+	.uleb128 0x7
+	.long	0x66b
+	.uleb128 0x47
+	.uleb128 0x8
+	.long	.LASF109
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa6
+	.uleb128 0x22
+	.long	0x4d
+	.byte	0x15
+	.byte	0x18
+	.byte	0x3
+	.long	0x69b
+	.uleb128 0xb
+	.long	.LASF110
+	.byte	0x1
+	.uleb128 0x48
+	.long	.LASF111
+	.long	0x80000
+	.uleb128 0x49
+	.long	.LASF112
+	.value	0x800
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF113
+	.byte	0x16
+	.byte	0x1b
+	.byte	0x12
+	.long	0x66c
+	.uleb128 0x7
+	.long	0x10d
+	.uleb128 0x22
+	.long	0x4d
+	.byte	0x17
+	.byte	0x10
+	.byte	0xe
+	.long	0x6cb
+	.uleb128 0xb
+	.long	.LASF114
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF115
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF116
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF117
+	.byte	0x17
+	.byte	0x10
+	.byte	0x31
+	.long	0x6ac
+	.uleb128 0x2d
+	.long	.LASF119
+	.byte	0x17
+	.byte	0x17
+	.byte	0xc
+	.long	0x7d
+	.uleb128 0x2d
+	.long	.LASF120
+	.byte	0x17
+	.byte	0x1e
+	.byte	0xd
+	.long	0x42d
+	.uleb128 0xe
+	.long	.LASF121
+	.byte	0x15
+	.byte	0xe
+	.long	0x644
+	.uleb128 0x9
+	.byte	0x3
+	.quad	errfile
+	.uleb128 0xe
+	.long	.LASF122
+	.byte	0x16
+	.byte	0xe
+	.long	0x644
+	.uleb128 0x9
+	.byte	0x3
+	.quad	verbfile
+	.uleb128 0xe
+	.long	.LASF123
+	.byte	0x17
+	.byte	0xe
+	.long	0x644
+	.uleb128 0x9
+	.byte	0x3
+	.quad	logfile
+	.uleb128 0x34
+	.long	0x6d7
+	.byte	0x19
+	.byte	0x5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	verblevel
+	.uleb128 0x34
+	.long	0x6e3
+	.byte	0x2f
+	.byte	0x6
+	.uleb128 0x9
+	.byte	0x3
+	.quad	async_output
+	.uleb128 0x4a
+	.long	0x100018
+	.byte	0x1
+	.byte	0x32
+	.byte	0x9
+	.long	0x78e
+	.uleb128 0x35
+	.string	"fd"
+	.byte	0x33
+	.byte	0x9
+	.long	0x7d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF124
+	.byte	0x1
+	.byte	0x34
+	.byte	0x14
+	.long	0x13b
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF125
+	.byte	0x1
+	.byte	0x35
+	.byte	0x14
+	.long	0x13b
+	.byte	0x10
+	.uleb128 0x35
+	.string	"buf"
+	.byte	0x36
+	.byte	0xa
+	.long	0x78e
+	.byte	0x18
+	.byte	0
+	.uleb128 0x16
+	.long	0x112
+	.long	0x7a1
+	.uleb128 0x4b
+	.long	0x59
+	.long	0xfffff
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF126
+	.byte	0x1
+	.byte	0x37
+	.byte	0x3
+	.long	0x750
+	.uleb128 0x22
+	.long	0x4d
+	.byte	0x1
+	.byte	0x39
+	.byte	0x6
+	.long	0x7cc
+	.uleb128 0xb
+	.long	.LASF127
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF128
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF129
+	.byte	0x2
+	.byte	0
+	.uleb128 0x16
+	.long	0x7dc
+	.long	0x7dc
+	.uleb128 0x19
+	.long	0x59
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	0x7a1
+	.uleb128 0xe
+	.long	.LASF130
+	.byte	0x3a
+	.byte	0x10
+	.long	0x7cc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rings
+	.uleb128 0xe
+	.long	.LASF131
+	.byte	0x3b
+	.byte	0x18
+	.long	0x2ca
+	.uleb128 0x9
+	.byte	0x3
+	.quad	drain_lock
+	.uleb128 0xe
+	.long	.LASF132
+	.byte	0x3c
+	.byte	0xd
+	.long	0x42d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	writer_started
+	.uleb128 0xe
+	.long	.LASF133
+	.byte	0x3d
+	.byte	0x1e
+	.long	0x373
+	.uleb128 0x9
+	.byte	0x3
+	.quad	in_signal
+	.uleb128 0xe
+	.long	.LASF134
+	.byte	0x47
+	.byte	0xc
+	.long	0x7d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	data_fd
+	.uleb128 0xe
+	.long	.LASF135
+	.byte	0x48
+	.byte	0xc
+	.long	0x7d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	space_fd
+	.uleb128 0xe
+	.long	.LASF136
+	.byte	0x49
+	.byte	0x14
+	.long	0x421
+	.uleb128 0x9
+	.byte	0x3
+	.quad	writer_waiting
+	.uleb128 0xe
+	.long	.LASF137
+	.byte	0x4a
+	.byte	0x14
+	.long	0x421
+	.uleb128 0x9
+	.byte	0x3
+	.quad	producer_waiting
+	.uleb128 0xe
+	.long	.LASF138
+	.byte	0xa4
+	.byte	0x11
+	.long	0x378
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fork_mask
+	.uleb128 0xe
+	.long	.LASF139
+	.byte	0xf5
+	.byte	0x10
+	.long	0x7dc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	put_ring
+	.uleb128 0xe
+	.long	.LASF140
+	.byte	0xf6
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	put_len
+	.uleb128 0x18
+	.string	"ret"
+	.value	0x11f
+	.byte	0x15
+	.long	0x84
+	.uleb128 0x9
+	.byte	0x3
+	.quad	ret
+	.uleb128 0x16
+	.long	0x112
+	.long	0x8ef
+	.uleb128 0x36
+	.long	0x59
+	.value	0x3ff
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF141
+	.value	0x172
+	.byte	0xd
+	.long	0x8de
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fail_buf
+	.uleb128 0x4c
+	.long	0x90c
+	.uleb128 0x1a
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF142
+	.value	0x17d
+	.byte	0xf
+	.long	0x918
+	.uleb128 0x7
+	.long	0x905
+	.uleb128 0x2e
+	.long	.LASF143
+	.value	0x1fd
+	.byte	0xc
+	.long	0x7d
+	.uleb128 0x11
+	.long	.LASF144
+	.value	0x200
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocate_cnt
+	.uleb128 0x11
+	.long	.LASF145
+	.value	0x201
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocate_bytes
+	.uleb128 0x11
+	.long	.LASF146
+	.value	0x202
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	free_cnt
+	.uleb128 0x11
+	.long	.LASF147
+	.value	0x203
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	free_bytes
+	.uleb128 0x11
+	.long	.LASF148
+	.value	0x206
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	peak_bytes
+	.uleb128 0x11
+	.long	.LASF149
+	.value	0x207
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	last_peak_bytes
+	.uleb128 0x11
+	.long	.LASF150
+	.value	0x208
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	current_bytes
+	.uleb128 0x11
+	.long	.LASF151
+	.value	0x288
+	.byte	0xc
+	.long	0x7d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	metricsfd
+	.uleb128 0x11
+	.long	.LASF152
+	.value	0x28c
+	.byte	0xe
+	.long	0x10d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mbuf
+	.uleb128 0x11
+	.long	.LASF153
+	.value	0x28d
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mlen
+	.uleb128 0x11
+	.long	.LASF154
+	.value	0x28e
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msize
+	.uleb128 0x11
+	.long	.LASF155
+	.value	0x28f
+	.byte	0xd
+	.long	0x42d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mopen
+	.uleb128 0xa
+	.long	.LASF156
+	.byte	0x18
+	.value	0x234
+	.byte	0xe
+	.long	0xee
+	.long	0xa4d
+	.uleb128 0x3
+	.long	0xee
+	.uleb128 0x3
+	.long	0x12f
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF157
+	.byte	0x19
+	.value	0x166
+	.byte	0xc
+	.long	0x7d
+	.long	0xa64
+	.uleb128 0x3
+	.long	0x7d
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF158
+	.byte	0x1a
+	.byte	0xb5
+	.byte	0xc
+	.long	0x7d
+	.long	0xa80
+	.uleb128 0x3
+	.long	0x16d
+	.uleb128 0x3
+	.long	0x7d
+	.uleb128 0x1a
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF159
+	.byte	0x1b
+	.value	0x120
+	.byte	0xc
+	.long	0x7d
+	.long	0xa9c
+	.uleb128 0x3
+	.long	0x177
+	.uleb128 0x3
+	.long	0xa9c
+	.byte	0
+	.uleb128 0x7
+	.long	0x140
+	.uleb128 0x17
+	.long	.LASF160
+	.byte	0x1c
+	.byte	0x90
+	.byte	0xe
+	.long	0x10d
+	.long	0xac1
+	.uleb128 0x3
+	.long	0x10d
+	.uleb128 0x3
+	.long	0x16d
+	.uleb128 0x3
+	.long	0x12f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF161
+	.byte	0x12
+	.byte	0xb2
+	.byte	0xc
+	.long	0x7d
+	.long	0xad7
+	.uleb128 0x3
+	.long	0x644
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF162
+	.byte	0x1c
+	.byte	0x2b
+	.byte	0xe
+	.long	0xee
+	.long	0xaf7
+	.uleb128 0x3
+	.long	0xee
+	.uleb128 0x3
+	.long	0x666
+	.uleb128 0x3
+	.long	0x12f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF163
+	.byte	0x16
+	.byte	0x25
+	.byte	0xc
+	.long	0x7d
+	.long	0xb12
+	.uleb128 0x3
+	.long	0x7d
+	.uleb128 0x3
+	.long	0xb12
+	.byte	0
+	.uleb128 0x7
+	.long	0x69b
+	.uleb128 0x17
+	.long	.LASF164
+	.byte	0x16
+	.byte	0x28
+	.byte	0xc
+	.long	0x7d
+	.long	0xb32
+	.uleb128 0x3
+	.long	0x7d
+	.uleb128 0x3
+	.long	0x69b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF165
+	.byte	0x19
+	.value	0x1e0
+	.byte	0xc
+	.long	0x7d
+	.long	0xb49
+	.uleb128 0x3
+	.long	0xd6
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF166
+	.byte	0x18
+	.value	0x267
+	.byte	0xc
+	.long	0x7d
+	.long	0xb60
+	.uleb128 0x3
+	.long	0x385
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF167
+	.byte	0xe
+	.value	0x534
+	.byte	0xc
+	.long	0x7d
+	.long	0xb81
+	.uleb128 0x3
+	.long	0x385
+	.uleb128 0x3
+	.long	0x385
+	.uleb128 0x3
+	.long	0x385
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF168
+	.byte	0xe
+	.value	0x10d
+	.byte	0xc
+	.long	0x7d
+	.long	0xb98
+	.uleb128 0x3
+	.long	0x23e
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF169
+	.byte	0xe
+	.byte	0xca
+	.byte	0xc
+	.long	0x7d
+	.long	0xbbd
+	.uleb128 0x3
+	.long	0xbc2
+	.uleb128 0x3
+	.long	0xbcc
+	.uleb128 0x3
+	.long	0xbd1
+	.uleb128 0x3
+	.long	0xf0
+	.byte	0
+	.uleb128 0x7
+	.long	0x23e
+	.uleb128 0x1b
+	.long	0xbbd
+	.uleb128 0x7
+	.long	0x28a
+	.uleb128 0x1b
+	.long	0xbc7
+	.uleb128 0x7
+	.long	0xbd6
+	.uleb128 0x4d
+	.long	0xee
+	.long	0xbe5
+	.uleb128 0x3
+	.long	0xee
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF170
+	.byte	0x16
+	.byte	0x22
+	.byte	0xc
+	.long	0x7d
+	.long	0xc00
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x7d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF171
+	.byte	0x18
+	.value	0x22c
+	.byte	0xe
+	.long	0xee
+	.long	0xc1c
+	.uleb128 0x3
+	.long	0x12f
+	.uleb128 0x3
+	.long	0x12f
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF277
+	.byte	0x18
+	.value	0x238
+	.byte	0xd
+	.long	0xc2f
+	.uleb128 0x3
+	.long	0xee
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF172
+	.byte	0x18
+	.value	0x229
+	.byte	0xe
+	.long	0xee
+	.long	0xc46
+	.uleb128 0x3
+	.long	0x12f
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF173
+	.byte	0x12
+	.value	0x225
+	.byte	0xc
+	.long	0x7d
+	.long	0xc62
+	.uleb128 0x3
+	.long	0x7d
+	.uleb128 0x3
+	.long	0x644
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF174
+	.byte	0x12
+	.value	0x16d
+	.byte	0xc
+	.long	0x7d
+	.long	0xc83
+	.uleb128 0x3
+	.long	0x649
+	.uleb128 0x3
+	.long	0x172
+	.uleb128 0x3
+	.long	0xc83
+	.byte	0
+	.uleb128 0x7
+	.long	0x3af
+	.uleb128 0xa
+	.long	.LASF175
+	.byte	0x12
+	.value	0x17e
+	.byte	0xc
+	.long	0x7d
+	.long	0xcae
+	.uleb128 0x3
+	.long	0x10d
+	.uleb128 0x3
+	.long	0x12f
+	.uleb128 0x3
+	.long	0x16d
+	.uleb128 0x3
+	.long	0xc83
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF176
+	.byte	0x12
+	.value	0x28f
+	.byte	0xc
+	.long	0x7d
+	.long	0xcca
+	.uleb128 0x3
+	.long	0x172
+	.uleb128 0x3
+	.long	0x649
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF177
+	.byte	0x1c
+	.value	0x197
+	.byte	0xf
+	.long	0x12f
+	.long	0xce1
+	.uleb128 0x3
+	.long	0x16d
+	.byte	0
+	.uleb128 0x4f
+	.long	.LASF178
+	.byte	0x18
+	.value	0x27d
+	.byte	0xd
+	.long	0xcf4
+	.uleb128 0x3
+	.long	0x7d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF179
+	.byte	0x12
+	.value	0x17a
+	.byte	0xc
+	.long	0x7d
+	.long	0xd16
+	.uleb128 0x3
+	.long	0x10d
+	.uleb128 0x3
+	.long	0x12f
+	.uleb128 0x3
+	.long	0x16d
+	.uleb128 0x1a
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF180
+	.byte	0x12
+	.value	0x329
+	.byte	0xc
+	.long	0x7d
+	.long	0xd2d
+	.uleb128 0x3
+	.long	0x644
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF181
+	.byte	0x12
+	.value	0x102
+	.byte	0xe
+	.long	0x644
+	.long	0xd49
+	.uleb128 0x3
+	.long	0x172
+	.uleb128 0x3
+	.long	0x172
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF182
+	.byte	0xe
+	.value	0x31a
+	.byte	0xc
+	.long	0x7d
+	.long	0xd60
+	.uleb128 0x3
+	.long	0xd60
+	.byte	0
+	.uleb128 0x7
+	.long	0x2ca
+	.uleb128 0x50
+	.long	.LASF278
+	.byte	0x1f
+	.byte	0x25
+	.byte	0xd
+	.long	0xd71
+	.uleb128 0x7
+	.long	0x7d
+	.uleb128 0xa
+	.long	.LASF183
+	.byte	0x19
+	.value	0x17a
+	.byte	0x10
+	.long	0x638
+	.long	0xd97
+	.uleb128 0x3
+	.long	0x7d
+	.uleb128 0x3
+	.long	0x666
+	.uleb128 0x3
+	.long	0x12f
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF184
+	.byte	0x1b
+	.value	0x119
+	.byte	0xc
+	.long	0x7d
+	.long	0xdb3
+	.uleb128 0x3
+	.long	0xdb3
+	.uleb128 0x3
+	.long	0xa9c
+	.byte	0
+	.uleb128 0x7
+	.long	0x168
+	.uleb128 0xa
+	.long	.LASF185
+	.byte	0xe
+	.value	0x343
+	.byte	0xc
+	.long	0x7d
+	.long	0xdcf
+	.uleb128 0x3
+	.long	0xd60
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF186
+	.byte	0xe
+	.value	0x316
+	.byte	0xc
+	.long	0x7d
+	.long	0xde6
+	.uleb128 0x3
+	.long	0xd60
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF187
+	.byte	0x1d
+	.byte	0x1f
+	.byte	0xc
+	.long	0x7d
+	.long	0xe06
+	.uleb128 0x3
+	.long	0x7d
+	.uleb128 0x3
+	.long	0xe0b
+	.uleb128 0x3
+	.long	0xe15
+	.byte	0
+	.uleb128 0x7
+	.long	0x325
+	.uleb128 0x1b
+	.long	0xe06
+	.uleb128 0x7
+	.long	0x319
+	.uleb128 0x1b
+	.long	0xe10
+	.uleb128 0x17
+	.long	.LASF188
+	.byte	0x1e
+	.byte	0xca
+	.byte	0xc
+	.long	0x7d
+	.long	0xe30
+	.uleb128 0x3
+	.long	0xe30
+	.byte	0
+	.uleb128 0x7
+	.long	0x378
+	.uleb128 0x17
+	.long	.LASF189
+	.byte	0x12
+	.byte	0xe6
+	.byte	0xc
+	.long	0x7d
+	.long	0xe4b
+	.uleb128 0x3
+	.long	0x644
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF196
+	.value	0x2f7
+	.quad	.LFB69
+	.quad	.LFE69-.LFB69
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xeb4
+	.uleb128 0x12
+	.string	"n"
+	.value	0x2fd
+	.byte	0xd
+	.long	0x638
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x2
+	.quad	.LVL342
+	.long	0x12ab
+	.long	0xe99
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL343
+	.long	0xd76
+	.uleb128 0x6
+	.quad	.LVL344
+	.long	0xd65
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF190
+	.value	0x2f1
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf3f
+	.uleb128 0xc
+	.string	"key"
+	.value	0x2f1
+	.byte	0x18
+	.long	0x10d
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0xc
+	.string	"val"
+	.value	0x2f1
+	.byte	0x22
+	.long	0x42d
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x5
+	.quad	.LVL340
+	.long	0x12ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1f
+	.byte	0x3
+	.quad	.LC28
+	.byte	0x3
+	.quad	.LC27
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF191
+	.value	0x2e6
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfcd
+	.uleb128 0xc
+	.string	"key"
+	.value	0x2e6
+	.byte	0x1a
+	.long	0x10d
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0xc
+	.string	"val"
+	.value	0x2e6
+	.byte	0x26
+	.long	0x2e
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x2
+	.quad	.LVL332
+	.long	0x12ab
+	.long	0xfaa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL335
+	.long	0x12ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF192
+	.value	0x2e0
+	.quad	.LFB66
+	.quad	.LFE66-.LFB66
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x103c
+	.uleb128 0xc
+	.string	"key"
+	.value	0x2e0
+	.byte	0x17
+	.long	0x10d
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0xc
+	.string	"val"
+	.value	0x2e0
+	.byte	0x24
+	.long	0x65a
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x5
+	.quad	.LVL329
+	.long	0x12ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF193
+	.value	0x2cf
+	.quad	.LFB65
+	.quad	.LFE65-.LFB65
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1131
+	.uleb128 0xd
+	.long	.LASF194
+	.value	0x2cf
+	.byte	0x17
+	.long	0x7d
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0xd
+	.long	.LASF195
+	.value	0x2cf
+	.byte	0x23
+	.long	0x6a7
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0xf
+	.quad	.LBB65
+	.quad	.LBE65-.LBB65
+	.long	0x10ca
+	.uleb128 0x12
+	.string	"i"
+	.value	0x2d8
+	.byte	0xe
+	.long	0x7d
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x6
+	.quad	.LVL318
+	.long	0x11e1
+	.uleb128 0x5
+	.quad	.LVL321
+	.long	0x12ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL314
+	.long	0x12ab
+	.long	0x10e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL315
+	.long	0x11e1
+	.uleb128 0x2
+	.quad	.LVL316
+	.long	0x12ab
+	.long	0x1115
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL323
+	.long	0x12ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF279
+	.byte	0x1
+	.value	0x2ca
+	.byte	0x6
+	.long	0x42d
+	.quad	.LFB64
+	.quad	.LFE64-.LFB64
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x29
+	.long	.LASF197
+	.value	0x2c2
+	.quad	.LFB63
+	.quad	.LFE63-.LFB63
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x117b
+	.uleb128 0x6
+	.quad	.LVL307
+	.long	0xa4d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF204
+	.value	0x2bb
+	.byte	0x6
+	.long	0x42d
+	.quad	.LFB62
+	.quad	.LFE62-.LFB62
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11e1
+	.uleb128 0xd
+	.long	.LASF198
+	.value	0x2bb
+	.byte	0x1d
+	.long	0x10d
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x6
+	.quad	.LVL309
+	.long	0x1150
+	.uleb128 0x5
+	.quad	.LVL310
+	.long	0xa64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x641
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1a4
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF199
+	.value	0x2ac
+	.quad	.LFB61
+	.quad	.LFE61-.LFB61
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12ab
+	.uleb128 0xc
+	.string	"s"
+	.value	0x2ac
+	.byte	0x26
+	.long	0x16d
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x37
+	.long	.LLRL75
+	.long	0x1270
+	.uleb128 0x12
+	.string	"c"
+	.value	0x2b0
+	.byte	0x17
+	.long	0x35
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x2
+	.quad	.LVL195
+	.long	0x12ab
+	.long	0x1243
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL198
+	.long	0x12ab
+	.long	0x125b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL203
+	.long	0x12ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL192
+	.long	0x12ab
+	.long	0x128f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL205
+	.long	0x12ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF200
+	.value	0x291
+	.quad	.LFB60
+	.quad	.LFE60-.LFB60
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x138d
+	.uleb128 0xc
+	.string	"fmt"
+	.value	0x291
+	.byte	0x21
+	.long	0x10d
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x1a
+	.uleb128 0x18
+	.string	"ap"
+	.value	0x293
+	.byte	0xd
+	.long	0x3e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x1d
+	.long	.LLRL70
+	.uleb128 0x12
+	.string	"len"
+	.value	0x296
+	.byte	0xd
+	.long	0x7d
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x13
+	.long	.LASF201
+	.value	0x29e
+	.byte	0x10
+	.long	0x12f
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x13
+	.long	.LASF202
+	.value	0x2a1
+	.byte	0xf
+	.long	0x10d
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x2
+	.quad	.LVL182
+	.long	0xa31
+	.long	0x1345
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL184
+	.long	0xc88
+	.long	0x1363
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL189
+	.long	0x1891
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.long	.LASF203
+	.byte	0x1
+	.value	0x27e
+	.byte	0xa
+	.long	0x66c
+	.quad	.LFB59
+	.quad	.LFE59-.LFB59
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13d8
+	.uleb128 0x18
+	.string	"ts"
+	.value	0x280
+	.byte	0x15
+	.long	0x140
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x5
+	.quad	.LVL297
+	.long	0xa80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF205
+	.value	0x275
+	.byte	0x8
+	.long	0x2e
+	.quad	.LFB58
+	.quad	.LFE58-.LFB58
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1444
+	.uleb128 0xd
+	.long	.LASF206
+	.value	0x275
+	.byte	0x1b
+	.long	0x1444
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x13
+	.long	.LASF207
+	.value	0x277
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x13
+	.long	.LASF208
+	.value	0x278
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x6
+	.quad	.LVL299
+	.long	0x138d
+	.byte	0
+	.uleb128 0x7
+	.long	0x2e
+	.uleb128 0x15
+	.long	.LASF209
+	.value	0x270
+	.quad	.LFB57
+	.quad	.LFE57-.LFB57
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1490
+	.uleb128 0xd
+	.long	.LASF206
+	.value	0x270
+	.byte	0x18
+	.long	0x1444
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x5
+	.quad	.LVL306
+	.long	0x13d8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF210
+	.value	0x268
+	.quad	.LFB56
+	.quad	.LFE56-.LFB56
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1510
+	.uleb128 0xc
+	.string	"s"
+	.value	0x268
+	.byte	0x18
+	.long	0x10d
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x2
+	.quad	.LVL292
+	.long	0xcca
+	.long	0x14d7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL293
+	.long	0x15a0
+	.long	0x14ef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL296
+	.long	0x1ba0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF211
+	.value	0x25c
+	.quad	.LFB55
+	.quad	.LFE55-.LFB55
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15a0
+	.uleb128 0xc
+	.string	"b"
+	.value	0x25c
+	.byte	0x17
+	.long	0xee
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0xc
+	.string	"cnt"
+	.value	0x25c
+	.byte	0x21
+	.long	0x12f
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0xd
+	.long	.LASF212
+	.value	0x25c
+	.byte	0x2d
+	.long	0x12f
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x2
+	.quad	.LVL283
+	.long	0xc1c
+	.long	0x157f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL289
+	.long	0x1ba0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF213
+	.value	0x250
+	.quad	.LFB54
+	.quad	.LFE54-.LFB54
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x161c
+	.uleb128 0xc
+	.string	"b"
+	.value	0x250
+	.byte	0x17
+	.long	0xee
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0xd
+	.long	.LASF212
+	.value	0x250
+	.byte	0x21
+	.long	0x12f
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x2
+	.quad	.LVL275
+	.long	0xc1c
+	.long	0x15fb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL280
+	.long	0x1ba0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF214
+	.value	0x23b
+	.byte	0x7
+	.long	0x10d
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16fb
+	.uleb128 0xc
+	.string	"s"
+	.value	0x23b
+	.byte	0x1d
+	.long	0x10d
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0xd
+	.long	.LASF215
+	.value	0x23b
+	.byte	0x26
+	.long	0x10d
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x12
+	.string	"len"
+	.value	0x240
+	.byte	0xc
+	.long	0x12f
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x12
+	.string	"ss"
+	.value	0x242
+	.byte	0xb
+	.long	0x10d
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x2
+	.quad	.LVL264
+	.long	0xcca
+	.long	0x16a3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL266
+	.long	0xc2f
+	.long	0x16bb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL269
+	.long	0xaa1
+	.long	0x16d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL272
+	.long	0x1891
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF216
+	.value	0x229
+	.byte	0x7
+	.long	0xee
+	.quad	.LFB52
+	.quad	.LFE52-.LFB52
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17ad
+	.uleb128 0xc
+	.string	"cnt"
+	.value	0x229
+	.byte	0x1d
+	.long	0x12f
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0xd
+	.long	.LASF212
+	.value	0x229
+	.byte	0x29
+	.long	0x12f
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0xd
+	.long	.LASF215
+	.value	0x229
+	.byte	0x36
+	.long	0x10d
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x12
+	.string	"p"
+	.value	0x22c
+	.byte	0xb
+	.long	0xee
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x2
+	.quad	.LVL259
+	.long	0xc00
+	.long	0x178b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL262
+	.long	0x1891
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF217
+	.value	0x216
+	.byte	0x7
+	.long	0xee
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1843
+	.uleb128 0xd
+	.long	.LASF212
+	.value	0x216
+	.byte	0x1d
+	.long	0x12f
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0xd
+	.long	.LASF215
+	.value	0x216
+	.byte	0x2a
+	.long	0x10d
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x12
+	.string	"p"
+	.value	0x219
+	.byte	0xb
+	.long	0xee
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x2
+	.quad	.LVL253
+	.long	0xc2f
+	.long	0x1821
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL257
+	.long	0x1891
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF218
+	.value	0x20a
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1891
+	.uleb128 0x38
+	.long	.LASF232
+	.value	0x20a
+	.byte	0x21
+	.long	0x12f
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x53
+	.long	.LASF219
+	.byte	0x1
+	.value	0x20c
+	.byte	0xc
+	.long	0x12f
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF220
+	.value	0x20d
+	.byte	0xc
+	.long	0x12f
+	.long	.LLST84
+	.long	.LVUS84
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF221
+	.value	0x1e4
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19a2
+	.uleb128 0xd
+	.long	.LASF222
+	.value	0x1e4
+	.byte	0x1c
+	.long	0x10d
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0xc
+	.string	"msg"
+	.value	0x1e4
+	.byte	0x2a
+	.long	0x10d
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x6
+	.quad	.LVL168
+	.long	0x1ed7
+	.uleb128 0x2
+	.quad	.LVL170
+	.long	0xcf4
+	.long	0x190f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x400
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL171
+	.long	0xcca
+	.long	0x1927
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL172
+	.long	0xcca
+	.long	0x193f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL173
+	.long	0xd76
+	.long	0x195c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL174
+	.long	0xcae
+	.long	0x1974
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL175
+	.long	0x1e28
+	.uleb128 0x6
+	.quad	.LVL176
+	.long	0xac1
+	.uleb128 0x5
+	.quad	.LVL177
+	.long	0xce1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF223
+	.value	0x1ce
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1aa1
+	.uleb128 0xd
+	.long	.LASF224
+	.value	0x1ce
+	.byte	0x1a
+	.long	0x7d
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0xc
+	.string	"fmt"
+	.value	0x1ce
+	.byte	0x27
+	.long	0x10d
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x1a
+	.uleb128 0xf
+	.quad	.LBB64
+	.quad	.LBE64-.LBB64
+	.long	0x1a65
+	.uleb128 0x18
+	.string	"ap"
+	.value	0x1d4
+	.byte	0x11
+	.long	0x3e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x2
+	.quad	.LVL250
+	.long	0x1fbd
+	.long	0x1a3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL251
+	.long	0x1fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	0x2f44
+	.quad	.LBI62
+	.byte	.LVU648
+	.quad	.LBB62
+	.quad	.LBE62-.LBB62
+	.value	0x1d1
+	.uleb128 0x1e
+	.long	0x2f5b
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x1e
+	.long	0x2f51
+	.long	.LLST91
+	.long	.LVUS91
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF225
+	.value	0x1bb
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ba0
+	.uleb128 0xd
+	.long	.LASF224
+	.value	0x1bb
+	.byte	0x11
+	.long	0x7d
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0xc
+	.string	"fmt"
+	.value	0x1bb
+	.byte	0x1e
+	.long	0x10d
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x1a
+	.uleb128 0xf
+	.quad	.LBB58
+	.quad	.LBE58-.LBB58
+	.long	0x1b64
+	.uleb128 0x18
+	.string	"ap"
+	.value	0x1c1
+	.byte	0x11
+	.long	0x3e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x2
+	.quad	.LVL241
+	.long	0x1fbd
+	.long	0x1b39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL242
+	.long	0x1fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	0x2f44
+	.quad	.LBI56
+	.byte	.LVU620
+	.quad	.LBB56
+	.quad	.LBE56-.LBB56
+	.value	0x1be
+	.uleb128 0x1e
+	.long	0x2f5b
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x1e
+	.long	0x2f51
+	.long	.LLST87
+	.long	.LVUS87
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF226
+	.value	0x197
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d75
+	.uleb128 0xc
+	.string	"msg"
+	.value	0x197
+	.byte	0x1d
+	.long	0x6cb
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0xc
+	.string	"fmt"
+	.value	0x197
+	.byte	0x28
+	.long	0x10d
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x1a
+	.uleb128 0x18
+	.string	"ap"
+	.value	0x199
+	.byte	0xd
+	.long	0x3e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x13
+	.long	.LASF227
+	.value	0x19a
+	.byte	0xa
+	.long	0x42d
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x2e
+	.long	.LASF228
+	.value	0x19b
+	.byte	0xb
+	.long	0x10d
+	.uleb128 0x13
+	.long	.LASF224
+	.value	0x19e
+	.byte	0x9
+	.long	0x7d
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x11
+	.long	.LASF229
+	.value	0x1a5
+	.byte	0xa
+	.long	0x2e2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x2f
+	.long	0x1d75
+	.quad	.LBI49
+	.byte	.LVU580
+	.quad	.LBB49
+	.quad	.LBE49-.LBB49
+	.value	0x1af
+	.long	0x1c78
+	.uleb128 0x6
+	.quad	.LVL223
+	.long	0x1ed7
+	.uleb128 0x6
+	.quad	.LVL224
+	.long	0xac1
+	.byte	0
+	.uleb128 0x2f
+	.long	0x2f44
+	.quad	.LBI51
+	.byte	.LVU595
+	.quad	.LBB51
+	.quad	.LBE51-.LBB51
+	.value	0x1a3
+	.long	0x1cb7
+	.uleb128 0x1e
+	.long	0x2f5b
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x1e
+	.long	0x2f51
+	.long	.LLST82
+	.long	.LVUS82
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL220
+	.long	0xcf4
+	.long	0x1ce2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL221
+	.long	0x1fbd
+	.long	0x1d11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL222
+	.long	0x1fbd
+	.long	0x1d47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL230
+	.long	0x1ed7
+	.uleb128 0x6
+	.quad	.LVL231
+	.long	0x1e28
+	.uleb128 0x5
+	.quad	.LVL232
+	.long	0xce1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.long	.LASF280
+	.byte	0x1
+	.value	0x18e
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x1c
+	.long	.LASF230
+	.value	0x184
+	.byte	0x6
+	.long	0x42d
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1dfc
+	.uleb128 0xd
+	.long	.LASF198
+	.value	0x184
+	.byte	0x18
+	.long	0x10d
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x6
+	.quad	.LVL210
+	.long	0x1ed7
+	.uleb128 0x2
+	.quad	.LVL211
+	.long	0xd2d
+	.long	0x1de7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL213
+	.long	0xd16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF231
+	.value	0x17f
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e28
+	.uleb128 0x38
+	.long	.LASF224
+	.value	0x17f
+	.byte	0x18
+	.long	0x7d
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF249
+	.byte	0x1
+	.value	0x175
+	.byte	0xd
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e91
+	.uleb128 0x2
+	.quad	.LVL65
+	.long	0xcca
+	.long	0x1e5f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL66
+	.long	0xd76
+	.long	0x1e7c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL67
+	.long	0xcae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.long	.LASF281
+	.byte	0x1
+	.value	0x16d
+	.byte	0x6
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x29
+	.long	.LASF233
+	.value	0x165
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ed7
+	.uleb128 0x6
+	.quad	.LVL207
+	.long	0x2a81
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF234
+	.value	0x158
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1fbd
+	.uleb128 0x2f
+	.long	0x2a5d
+	.quad	.LBI22
+	.byte	.LVU169
+	.quad	.LBB22
+	.quad	.LBE22-.LBB22
+	.value	0x15b
+	.long	0x1fa2
+	.uleb128 0x24
+	.long	0x2a6a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.uleb128 0x24
+	.long	0x2a75
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x2
+	.quad	.LVL57
+	.long	0xe1a
+	.long	0x1f42
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL58
+	.long	0xde6
+	.long	0x1f65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL59
+	.long	0x2b4f
+	.uleb128 0x2
+	.quad	.LVL60
+	.long	0xde6
+	.long	0x1f94
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL61
+	.long	0x2a81
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL55
+	.long	0xe35
+	.uleb128 0x6
+	.quad	.LVL56
+	.long	0xe35
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF235
+	.value	0x121
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x24f0
+	.uleb128 0xd
+	.long	.LASF236
+	.value	0x121
+	.byte	0x18
+	.long	0x644
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0xd
+	.long	.LASF237
+	.value	0x122
+	.byte	0x16
+	.long	0x7d
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0xd
+	.long	.LASF229
+	.value	0x123
+	.byte	0x18
+	.long	0x10d
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0xc
+	.string	"fmt"
+	.value	0x124
+	.byte	0x18
+	.long	0x10d
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0xc
+	.string	"ap"
+	.value	0x125
+	.byte	0x1a
+	.long	0xc83
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0xd
+	.long	.LASF238
+	.value	0x126
+	.byte	0x17
+	.long	0x42d
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x18
+	.string	"buf"
+	.value	0x141
+	.byte	0xa
+	.long	0x24f0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2112
+	.uleb128 0x12
+	.string	"msg"
+	.value	0x142
+	.byte	0xb
+	.long	0x10d
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x18
+	.string	"ap2"
+	.value	0x143
+	.byte	0xd
+	.long	0x3e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2136
+	.uleb128 0x12
+	.string	"len"
+	.value	0x145
+	.byte	0x9
+	.long	0x7d
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0xf
+	.quad	.LBB38
+	.quad	.LBE38-.LBB38
+	.long	0x2192
+	.uleb128 0x18
+	.string	"buf"
+	.value	0x12a
+	.byte	0xe
+	.long	0x24f0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4192
+	.uleb128 0x12
+	.string	"len"
+	.value	0x12b
+	.byte	0xd
+	.long	0x7d
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x12
+	.string	"n"
+	.value	0x12c
+	.byte	0xd
+	.long	0x7d
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x2
+	.quad	.LVL126
+	.long	0xcf4
+	.long	0x2117
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4192
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x800
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL128
+	.long	0xc88
+	.long	0x2158
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xf
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x1060
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xc
+	.byte	0xa
+	.value	0x800
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL134
+	.long	0xd16
+	.long	0x2170
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL135
+	.long	0xd76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4192
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.long	0x27a6
+	.long	.LLRL62
+	.byte	0x1
+	.value	0x137
+	.byte	0x2f
+	.long	0x237d
+	.uleb128 0x1d
+	.long	.LLRL62
+	.uleb128 0x24
+	.long	0x27b7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4320
+	.uleb128 0x24
+	.long	0x27c2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4192
+	.uleb128 0x24
+	.long	0x27cd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4328
+	.uleb128 0x3a
+	.long	0x27d9
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x58
+	.long	0x27e4
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.long	0x2233
+	.uleb128 0x3a
+	.long	0x27e5
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x2
+	.quad	.LVL111
+	.long	0xc00
+	.long	0x2216
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x100018
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL113
+	.long	0xc00
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x100018
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL115
+	.long	0xbe5
+	.long	0x2251
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL116
+	.long	0xbe5
+	.long	0x226f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL140
+	.long	0xd16
+	.uleb128 0x6
+	.quad	.LVL141
+	.long	0xd16
+	.uleb128 0x2
+	.quad	.LVL142
+	.long	0xe1a
+	.long	0x22a1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL143
+	.long	0xde6
+	.long	0x22c6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4352
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL144
+	.long	0xb98
+	.long	0x22f6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4328
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	writer_main
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL146
+	.long	0xde6
+	.long	0x231a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4352
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL147
+	.long	0xb81
+	.uleb128 0x2
+	.quad	.LVL148
+	.long	0xb60
+	.long	0x2360
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fork_prepare
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fork_parent
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fork_child
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL149
+	.long	0xb49
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	report_flush
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL118
+	.long	0xcae
+	.long	0x239b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL119
+	.long	0xc62
+	.long	0x23bf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL120
+	.long	0xe35
+	.long	0x23d7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL152
+	.long	0xc88
+	.long	0x2403
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2112
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x800
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL155
+	.long	0xcca
+	.long	0x241b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL156
+	.long	0x2501
+	.long	0x2433
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL157
+	.long	0x2501
+	.long	0x2457
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL158
+	.long	0xc1c
+	.long	0x246f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL160
+	.long	0xc46
+	.long	0x248c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL163
+	.long	0xc2f
+	.long	0x24a4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL165
+	.long	0xc88
+	.long	0x24cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2136
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL166
+	.long	0x2501
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x112
+	.long	0x2501
+	.uleb128 0x36
+	.long	0x59
+	.value	0x7ff
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF239
+	.byte	0xff
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x26f9
+	.uleb128 0x1f
+	.string	"r"
+	.byte	0xff
+	.byte	0x1e
+	.long	0x7dc
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x2a
+	.long	.LASF240
+	.byte	0xff
+	.byte	0x2d
+	.long	0x16d
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x1f
+	.string	"len"
+	.byte	0xff
+	.byte	0x3a
+	.long	0x12f
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x13
+	.long	.LASF124
+	.value	0x10d
+	.byte	0xc
+	.long	0x12f
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x12
+	.string	"pos"
+	.value	0x113
+	.byte	0xc
+	.long	0x12f
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x13
+	.long	.LASF241
+	.value	0x114
+	.byte	0xc
+	.long	0x12f
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0xf
+	.quad	.LBB27
+	.quad	.LBE27-.LBB27
+	.long	0x25d2
+	.uleb128 0x12
+	.string	"n"
+	.value	0x104
+	.byte	0x15
+	.long	0x638
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x5
+	.quad	.LVL90
+	.long	0xd76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.long	0x2610
+	.uleb128 0x13
+	.long	.LASF242
+	.value	0x10d
+	.byte	0x13
+	.long	0x26f9
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x13
+	.long	.LASF243
+	.value	0x10d
+	.byte	0x13
+	.long	0x12f
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0xf
+	.quad	.LBB29
+	.quad	.LBE29-.LBB29
+	.long	0x264e
+	.uleb128 0x13
+	.long	.LASF244
+	.value	0x117
+	.byte	0x5
+	.long	0x26f9
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x13
+	.long	.LASF245
+	.value	0x117
+	.byte	0x5
+	.long	0x12f
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL89
+	.long	0x1ed7
+	.uleb128 0x2
+	.quad	.LVL96
+	.long	0x2d90
+	.long	0x2679
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL97
+	.long	0x26fe
+	.uleb128 0x2
+	.quad	.LVL101
+	.long	0x2f66
+	.long	0x26b3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xb
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xc
+	.long	0xfffff
+	.byte	0x1a
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL102
+	.long	0x2f66
+	.long	0x26dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL104
+	.long	0x2ea0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	writer_waiting
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x13b
+	.uleb128 0x31
+	.long	.LASF246
+	.byte	0xf8
+	.long	0x42d
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x27a6
+	.uleb128 0x9
+	.long	.LASF124
+	.byte	0xfa
+	.byte	0xc
+	.long	0x12f
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xf
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.long	0x276d
+	.uleb128 0x9
+	.long	.LASF242
+	.byte	0xfa
+	.byte	0x13
+	.long	0x26f9
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x9
+	.long	.LASF243
+	.byte	0xfa
+	.byte	0x13
+	.long	0x12f
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.uleb128 0x59
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x9
+	.long	.LASF242
+	.byte	0xfb
+	.byte	0x1d
+	.long	0x26f9
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x9
+	.long	.LASF243
+	.byte	0xfb
+	.byte	0x1d
+	.long	0x12f
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.long	.LASF269
+	.byte	0x1
+	.byte	0xd3
+	.byte	0xd
+	.long	0x42d
+	.byte	0x1
+	.long	0x27f0
+	.uleb128 0x20
+	.string	"all"
+	.byte	0xe4
+	.byte	0xe
+	.long	0x378
+	.uleb128 0x20
+	.string	"old"
+	.byte	0xe4
+	.byte	0x13
+	.long	0x378
+	.uleb128 0x5b
+	.long	.LASF247
+	.byte	0x1
+	.byte	0xe7
+	.byte	0xf
+	.long	0x23e
+	.uleb128 0x20
+	.string	"err"
+	.byte	0xe8
+	.byte	0x9
+	.long	0x7d
+	.uleb128 0x5c
+	.uleb128 0x20
+	.string	"i"
+	.byte	0xd5
+	.byte	0xe
+	.long	0x7d
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF258
+	.byte	0xc5
+	.byte	0xe
+	.long	0xee
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x287d
+	.uleb128 0x1f
+	.string	"arg"
+	.byte	0xc5
+	.byte	0x20
+	.long	0xee
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x2
+	.quad	.LVL84
+	.long	0x2ea0
+	.long	0x283c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL85
+	.long	0xb32
+	.long	0x2855
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL86
+	.long	0x2b4f
+	.uleb128 0x5
+	.quad	.LVL87
+	.long	0x2d90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF248
+	.byte	0xbc
+	.long	0x42d
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2911
+	.uleb128 0x1d
+	.long	.LLRL0
+	.uleb128 0x25
+	.string	"i"
+	.byte	0xbe
+	.byte	0xe
+	.long	0x7d
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x37
+	.long	.LLRL2
+	.long	0x28e3
+	.uleb128 0x9
+	.long	.LASF242
+	.byte	0xbf
+	.byte	0xd
+	.long	0x26f9
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x9
+	.long	.LASF243
+	.byte	0xbf
+	.byte	0xd
+	.long	0x12f
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0x1d
+	.long	.LLRL5
+	.uleb128 0x9
+	.long	.LASF242
+	.byte	0xbf
+	.byte	0x2d
+	.long	0x26f9
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x9
+	.long	.LASF243
+	.byte	0xbf
+	.byte	0x2d
+	.long	0x12f
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF250
+	.byte	0xb4
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2972
+	.uleb128 0x2
+	.quad	.LVL0
+	.long	0xdb8
+	.long	0x294c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	drain_lock
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1
+	.long	0xde6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fork_mask
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF251
+	.byte	0xae
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x29d3
+	.uleb128 0x2
+	.quad	.LVL2
+	.long	0xdb8
+	.long	0x29ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	drain_lock
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL3
+	.long	0xde6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fork_mask
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF252
+	.byte	0xa6
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a5d
+	.uleb128 0x5d
+	.string	"all"
+	.byte	0x1
+	.byte	0xa8
+	.byte	0xe
+	.long	0x378
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x2
+	.quad	.LVL62
+	.long	0xe1a
+	.long	0x2a17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL63
+	.long	0xde6
+	.long	0x2a41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fork_mask
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL64
+	.long	0xd49
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	drain_lock
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF282
+	.byte	0x1
+	.byte	0x93
+	.byte	0xd
+	.byte	0x1
+	.long	0x2a81
+	.uleb128 0x20
+	.string	"all"
+	.byte	0x99
+	.byte	0xe
+	.long	0x378
+	.uleb128 0x20
+	.string	"old"
+	.byte	0x99
+	.byte	0x13
+	.long	0x378
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF253
+	.byte	0x84
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2b4f
+	.uleb128 0xe
+	.long	.LASF254
+	.byte	0x86
+	.byte	0x15
+	.long	0x140
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1d
+	.long	.LLRL27
+	.uleb128 0x9
+	.long	.LASF255
+	.byte	0x87
+	.byte	0xe
+	.long	0x7d
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0xf
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.long	0x2b04
+	.uleb128 0x25
+	.string	"i"
+	.byte	0x89
+	.byte	0x16
+	.long	0x7d
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x6
+	.quad	.LVL44
+	.long	0x2bf0
+	.uleb128 0x6
+	.quad	.LVL45
+	.long	0x2bf0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL40
+	.long	0xdcf
+	.long	0x2b1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL41
+	.long	0xd97
+	.long	0x2b39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL46
+	.long	0xdb8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF256
+	.byte	0x73
+	.long	0x42d
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2bf0
+	.uleb128 0x9
+	.long	.LASF257
+	.byte	0x75
+	.byte	0xa
+	.long	0x42d
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0xf
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.long	0x2bc3
+	.uleb128 0x25
+	.string	"i"
+	.byte	0x77
+	.byte	0xe
+	.long	0x7d
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x6
+	.quad	.LVL49
+	.long	0x2bf0
+	.uleb128 0x6
+	.quad	.LVL51
+	.long	0x2bf0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL48
+	.long	0xd49
+	.long	0x2bdb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL53
+	.long	0xdb8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF259
+	.byte	0x5f
+	.byte	0xd
+	.long	0x42d
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d90
+	.uleb128 0x1f
+	.string	"r"
+	.byte	0x5f
+	.byte	0x20
+	.long	0x7dc
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x9
+	.long	.LASF124
+	.byte	0x61
+	.byte	0xc
+	.long	0x12f
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x9
+	.long	.LASF125
+	.byte	0x62
+	.byte	0xc
+	.long	0x12f
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x9
+	.long	.LASF257
+	.byte	0x63
+	.byte	0xa
+	.long	0x42d
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xf
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.long	0x2c97
+	.uleb128 0x9
+	.long	.LASF242
+	.byte	0x61
+	.byte	0x13
+	.long	0x26f9
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x9
+	.long	.LASF243
+	.byte	0x61
+	.byte	0x13
+	.long	0x12f
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.uleb128 0xf
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.long	0x2cd3
+	.uleb128 0x9
+	.long	.LASF242
+	.byte	0x62
+	.byte	0x13
+	.long	0x26f9
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x9
+	.long	.LASF243
+	.byte	0x62
+	.byte	0x13
+	.long	0x12f
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0x1d
+	.long	.LLRL21
+	.uleb128 0x25
+	.string	"pos"
+	.byte	0x65
+	.byte	0x10
+	.long	0x12f
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x9
+	.long	.LASF260
+	.byte	0x66
+	.byte	0x10
+	.long	0x12f
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x25
+	.string	"n"
+	.byte	0x69
+	.byte	0x11
+	.long	0x638
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xf
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.long	0x2d4b
+	.uleb128 0x9
+	.long	.LASF244
+	.byte	0x6e
+	.byte	0x9
+	.long	0x26f9
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x9
+	.long	.LASF245
+	.byte	0x6e
+	.byte	0x9
+	.long	0x12f
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL24
+	.long	0xd76
+	.long	0x2d74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 0
+	.byte	0xc
+	.long	0xfffff
+	.byte	0x1a
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL32
+	.long	0xd65
+	.uleb128 0x6
+	.quad	.LVL34
+	.long	0xd65
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF261
+	.byte	0x54
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e8b
+	.uleb128 0x2a
+	.long	.LASF262
+	.byte	0x54
+	.byte	0x23
+	.long	0x2e8b
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1f
+	.string	"fd"
+	.byte	0x54
+	.byte	0x30
+	.long	0x7d
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x2a
+	.long	.LASF263
+	.byte	0x54
+	.byte	0x3b
+	.long	0x2e9b
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0xe
+	.long	.LASF264
+	.byte	0x56
+	.byte	0xf
+	.long	0x69b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.long	0x2e27
+	.uleb128 0x9
+	.long	.LASF244
+	.byte	0x57
+	.byte	0x5
+	.long	0x2e8b
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x3c
+	.long	.LASF245
+	.byte	0x57
+	.byte	0x5
+	.long	0x42d
+	.byte	0x1
+	.byte	0
+	.uleb128 0xf
+	.quad	.LBB26
+	.quad	.LBE26-.LBB26
+	.long	0x2e63
+	.uleb128 0x9
+	.long	.LASF244
+	.byte	0x5b
+	.byte	0x5
+	.long	0x2e8b
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x9
+	.long	.LASF245
+	.byte	0x5b
+	.byte	0x5
+	.long	0x42d
+	.long	.LLST41
+	.long	.LVUS41
+	.byte	0
+	.uleb128 0x5f
+	.quad	.LVL76
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.quad	.LVL81
+	.long	0xaf7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x421
+	.uleb128 0x60
+	.long	0x42d
+	.long	0x2e9b
+	.uleb128 0x1a
+	.byte	0
+	.uleb128 0x7
+	.long	0x2e90
+	.uleb128 0x30
+	.long	.LASF265
+	.byte	0x4c
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2f44
+	.uleb128 0x2a
+	.long	.LASF262
+	.byte	0x4c
+	.byte	0x1f
+	.long	0x2e8b
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1f
+	.string	"fd"
+	.byte	0x4c
+	.byte	0x2c
+	.long	0x7d
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0xf
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.long	0x2f29
+	.uleb128 0x9
+	.long	.LASF266
+	.byte	0x4f
+	.byte	0x9
+	.long	0x2e8b
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x3c
+	.long	.LASF267
+	.byte	0x4f
+	.byte	0x9
+	.long	0x42d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF268
+	.byte	0x4f
+	.byte	0x9
+	.long	0x42d
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL73
+	.long	0xb17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.long	.LASF270
+	.byte	0x1
+	.byte	0x1a
+	.byte	0xd
+	.byte	0x1
+	.long	0x2f66
+	.uleb128 0x3d
+	.long	.LASF271
+	.byte	0x1e
+	.long	0x644
+	.uleb128 0x3d
+	.long	.LASF272
+	.byte	0x2b
+	.long	0x644
+	.byte	0
+	.uleb128 0x62
+	.long	.LASF162
+	.long	.LASF283
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x47
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x6
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x62
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS124:
+	.uleb128 .LVU913
+	.uleb128 .LVU915
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LVL344-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS122:
+	.uleb128 0
+	.uleb128 .LVU901
+	.uleb128 .LVU901
+	.uleb128 .LVU902
+	.uleb128 .LVU902
+	.uleb128 .LVU903
+	.uleb128 .LVU903
+	.uleb128 0
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS123:
+	.uleb128 0
+	.uleb128 .LVU900
+	.uleb128 .LVU900
+	.uleb128 .LVU903
+	.uleb128 .LVU903
+	.uleb128 0
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS120:
+	.uleb128 0
+	.uleb128 .LVU889
+	.uleb128 .LVU889
+	.uleb128 .LVU890
+	.uleb128 .LVU890
+	.uleb128 .LVU891
+	.uleb128 .LVU891
+	.uleb128 .LVU892
+	.uleb128 .LVU892
+	.uleb128 .LVU893
+	.uleb128 .LVU893
+	.uleb128 .LVU894
+	.uleb128 .LVU894
+	.uleb128 0
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL332-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL332-1-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL335-1-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS121:
+	.uleb128 0
+	.uleb128 .LVU890
+	.uleb128 .LVU890
+	.uleb128 .LVU891
+	.uleb128 .LVU891
+	.uleb128 .LVU893
+	.uleb128 .LVU893
+	.uleb128 .LVU894
+	.uleb128 .LVU894
+	.uleb128 0
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL332-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL332-1-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL335-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL335-1-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS118:
+	.uleb128 0
+	.uleb128 .LVU878
+	.uleb128 .LVU878
+	.uleb128 .LVU879
+	.uleb128 .LVU879
+	.uleb128 0
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL329-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL329-1-.Ltext0
+	.uleb128 .LFE66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 0
+	.uleb128 .LVU877
+	.uleb128 .LVU877
+	.uleb128 .LVU879
+	.uleb128 .LVU879
+	.uleb128 0
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL329-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL329-1-.Ltext0
+	.uleb128 .LFE66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 0
+	.uleb128 .LVU852
+	.uleb128 .LVU852
+	.uleb128 .LVU867
+	.uleb128 .LVU867
+	.uleb128 .LVU871
+	.uleb128 .LVU871
+	.uleb128 0
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS116:
+	.uleb128 0
+	.uleb128 .LVU853
+	.uleb128 .LVU853
+	.uleb128 .LVU870
+	.uleb128 .LVU870
+	.uleb128 .LVU871
+	.uleb128 .LVU871
+	.uleb128 0
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL314-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL314-1-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU857
+	.uleb128 .LVU860
+	.uleb128 .LVU860
+	.uleb128 .LVU862
+	.uleb128 .LVU862
+	.uleb128 .LVU863
+	.uleb128 .LVU864
+	.uleb128 .LVU867
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS114:
+	.uleb128 0
+	.uleb128 .LVU832
+	.uleb128 .LVU832
+	.uleb128 .LVU838
+	.uleb128 .LVU838
+	.uleb128 0
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL309-1-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 0
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 .LVU519
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU498
+	.uleb128 .LVU499
+	.uleb128 .LVU499
+	.uleb128 .LVU500
+	.uleb128 .LVU501
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU503
+	.uleb128 .LVU508
+	.uleb128 .LVU514
+	.uleb128 .LVU514
+	.uleb128 .LVU515
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL195-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL198-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU454
+	.uleb128 .LVU454
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU473
+	.uleb128 .LVU479
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU459
+	.uleb128 .LVU468
+	.uleb128 .LVU483
+	.uleb128 0
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU461
+	.uleb128 .LVU468
+	.uleb128 .LVU487
+	.uleb128 .LVU488
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS110:
+	.uleb128 0
+	.uleb128 .LVU803
+	.uleb128 .LVU803
+	.uleb128 .LVU812
+	.uleb128 .LVU812
+	.uleb128 .LVU813
+	.uleb128 .LVU813
+	.uleb128 0
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL299-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL299-1-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU805
+	.uleb128 .LVU811
+	.uleb128 .LVU811
+	.uleb128 .LVU812
+	.uleb128 .LVU812
+	.uleb128 .LVU813
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU807
+	.uleb128 .LVU813
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU818
+	.uleb128 .LVU818
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL306-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL306-1-.Ltext0
+	.uleb128 .LFE57-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 0
+	.uleb128 .LVU786
+	.uleb128 .LVU786
+	.uleb128 .LVU790
+	.uleb128 .LVU790
+	.uleb128 .LVU791
+	.uleb128 .LVU791
+	.uleb128 0
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS106:
+	.uleb128 0
+	.uleb128 .LVU768
+	.uleb128 .LVU768
+	.uleb128 .LVU777
+	.uleb128 .LVU777
+	.uleb128 .LVU779
+	.uleb128 .LVU779
+	.uleb128 .LVU780
+	.uleb128 .LVU780
+	.uleb128 0
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS107:
+	.uleb128 0
+	.uleb128 .LVU768
+	.uleb128 .LVU768
+	.uleb128 .LVU773
+	.uleb128 .LVU773
+	.uleb128 .LVU779
+	.uleb128 .LVU779
+	.uleb128 0
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS108:
+	.uleb128 0
+	.uleb128 .LVU768
+	.uleb128 .LVU768
+	.uleb128 .LVU778
+	.uleb128 .LVU778
+	.uleb128 .LVU779
+	.uleb128 .LVU779
+	.uleb128 .LVU781
+	.uleb128 .LVU781
+	.uleb128 0
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL289-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL289-1-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS104:
+	.uleb128 0
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 .LVU761
+	.uleb128 .LVU761
+	.uleb128 .LVU762
+	.uleb128 .LVU762
+	.uleb128 .LVU763
+	.uleb128 .LVU763
+	.uleb128 0
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS105:
+	.uleb128 0
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 .LVU760
+	.uleb128 .LVU760
+	.uleb128 .LVU762
+	.uleb128 .LVU762
+	.uleb128 0
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS100:
+	.uleb128 0
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU745
+	.uleb128 .LVU745
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 0
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL264-1-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS101:
+	.uleb128 0
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU744
+	.uleb128 .LVU744
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU747
+	.uleb128 .LVU747
+	.uleb128 0
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL264-1-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU723
+	.uleb128 .LVU726
+	.uleb128 .LVU726
+	.uleb128 .LVU744
+	.uleb128 .LVU746
+	.uleb128 .LVU747
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL266-1-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU727
+	.uleb128 .LVU733
+	.uleb128 .LVU733
+	.uleb128 .LVU744
+	.uleb128 .LVU746
+	.uleb128 .LVU747
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL269-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS96:
+	.uleb128 0
+	.uleb128 .LVU697
+	.uleb128 .LVU697
+	.uleb128 0
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL259-1-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 0
+	.uleb128 .LVU697
+	.uleb128 .LVU697
+	.uleb128 0
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL259-1-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 0
+	.uleb128 .LVU697
+	.uleb128 .LVU697
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 .LVU714
+	.uleb128 .LVU714
+	.uleb128 0
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL259-1-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU697
+	.uleb128 .LVU715
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL262-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS93:
+	.uleb128 0
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 .LVU680
+	.uleb128 .LVU680
+	.uleb128 .LVU690
+	.uleb128 .LVU690
+	.uleb128 0
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL253-1-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS94:
+	.uleb128 0
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 .LVU689
+	.uleb128 .LVU689
+	.uleb128 .LVU690
+	.uleb128 .LVU690
+	.uleb128 0
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL253-1-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU672
+	.uleb128 .LVU691
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL257-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU609
+	.uleb128 0
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0xe
+	.byte	0x3
+	.quad	current_bytes
+	.byte	0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU431
+	.uleb128 .LVU431
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU431
+	.uleb128 .LVU431
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS89:
+	.uleb128 0
+	.uleb128 .LVU645
+	.uleb128 .LVU645
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 0
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 0
+	.uleb128 .LVU645
+	.uleb128 .LVU645
+	.uleb128 .LVU646
+	.uleb128 .LVU646
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 0
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU648
+	.uleb128 .LVU654
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS85:
+	.uleb128 0
+	.uleb128 .LVU617
+	.uleb128 .LVU617
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 0
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 0
+	.uleb128 .LVU617
+	.uleb128 .LVU617
+	.uleb128 .LVU618
+	.uleb128 .LVU618
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU620
+	.uleb128 .LVU626
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS78:
+	.uleb128 0
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU592
+	.uleb128 .LVU592
+	.uleb128 .LVU594
+	.uleb128 .LVU594
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS79:
+	.uleb128 0
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU593
+	.uleb128 .LVU593
+	.uleb128 .LVU594
+	.uleb128 .LVU594
+	.uleb128 .LVU601
+	.uleb128 .LVU601
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU556
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU592
+	.uleb128 .LVU592
+	.uleb128 .LVU594
+	.uleb128 .LVU594
+	.uleb128 0
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0xa
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4d
+	.byte	0x24
+	.byte	0x29
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4d
+	.byte	0x24
+	.byte	0x29
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0xb
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4d
+	.byte	0x24
+	.byte	0x29
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4d
+	.byte	0x24
+	.byte	0x29
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU562
+	.uleb128 .LVU566
+	.uleb128 .LVU594
+	.uleb128 .LVU595
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU595
+	.uleb128 .LVU601
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS77:
+	.uleb128 0
+	.uleb128 .LVU539
+	.uleb128 .LVU539
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 0
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL210-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL210-1-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU370
+	.uleb128 .LVU370
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU418
+	.uleb128 .LVU418
+	.uleb128 .LVU422
+	.uleb128 .LVU422
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4356
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4356
+	.byte	0
+.LVUS56:
+	.uleb128 0
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU368
+	.uleb128 .LVU368
+	.uleb128 .LVU370
+	.uleb128 .LVU370
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS57:
+	.uleb128 0
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU346
+	.uleb128 .LVU346
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 .LVU370
+	.uleb128 .LVU370
+	.uleb128 0
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS58:
+	.uleb128 0
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU370
+	.uleb128 .LVU370
+	.uleb128 .LVU403
+	.uleb128 .LVU403
+	.uleb128 .LVU418
+	.uleb128 .LVU418
+	.uleb128 .LVU419
+	.uleb128 .LVU419
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU397
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 .LVU402
+	.uleb128 .LVU402
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU418
+	.uleb128 .LVU419
+	.uleb128 .LVU422
+	.uleb128 .LVU422
+	.uleb128 .LVU425
+	.uleb128 .LVU425
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2112
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL152-1-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2112
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2112
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU403
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU418
+	.uleb128 .LVU419
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU350
+	.uleb128 .LVU360
+	.uleb128 .LVU360
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU366
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU352
+	.uleb128 .LVU356
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU385
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 .LVU394
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU303
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU332
+	.uleb128 .LVU370
+	.uleb128 .LVU394
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU294
+	.uleb128 .LVU294
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL89-1-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU293
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL89-1-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU292
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL89-1-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU262
+	.uleb128 .LVU290
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU276
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU290
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x9
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xc
+	.long	0xfffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU279
+	.uleb128 .LVU292
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU249
+	.uleb128 .LVU257
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU259
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU292
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU261
+	.uleb128 .LVU290
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU288
+	.uleb128 .LVU292
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU289
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU292
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU49
+	.uleb128 .LVU52
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU46
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0xd
+	.byte	0x3
+	.quad	put_ring
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU48
+	.uleb128 .LVU52
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU53
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0xd
+	.byte	0x3
+	.quad	put_ring
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU15
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU40
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU18
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU40
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0xd
+	.byte	0x3
+	.quad	rings
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0xd
+	.byte	0x3
+	.quad	rings+8
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU20
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU40
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU22
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU40
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0xd
+	.byte	0x3
+	.quad	rings
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0xd
+	.byte	0x3
+	.quad	rings+8
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU24
+	.uleb128 .LVU32
+	.uleb128 .LVU37
+	.uleb128 .LVU40
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU114
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU132
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x7
+	.byte	0xa
+	.value	0x3e8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x7
+	.byte	0xa
+	.value	0x3e9
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x7
+	.byte	0xa
+	.value	0x3e8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU124
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU132
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU136
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU139
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU66
+	.uleb128 .LVU108
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU72
+	.uleb128 .LVU107
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU75
+	.uleb128 .LVU78
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -65
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU63
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU65
+	.uleb128 .LVU108
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU69
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU71
+	.uleb128 .LVU78
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU78
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU85
+	.uleb128 .LVU93
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU105
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0xc
+	.long	0xfffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL32-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL32-1-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0xc
+	.long	0xfffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU78
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU85
+	.uleb128 .LVU94
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3d
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0xc
+	.long	0xfffff
+	.byte	0x1a
+	.byte	0x1c
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0xc
+	.long	0xfffff
+	.byte	0x1a
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU80
+	.uleb128 .LVU84
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU87
+	.uleb128 .LVU89
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU88
+	.uleb128 .LVU89
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS37:
+	.uleb128 0
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU226
+	.uleb128 .LVU226
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU214
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU222
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU227
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU223
+	.uleb128 .LVU227
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL73-1-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU200
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU203
+	.uleb128 .LVU208
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL73-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF224:
+	.string	"level"
+.LASF196:
+	.string	"metric_end"
+.LASF260:
+	.string	"chunk"
+.LASF21:
+	.string	"size_t"
+.LASF142:
+	.string	"fatal_fun"
+.LASF134:
+	.string	"data_fd"
+.LASF228:
+	.string	"msg_name"
+.LASF36:
+	.string	"__kind"
+.LASF67:
+	.string	"memory_order_acquire"
+.LASF125:
+	.string	"tail"
+.LASF17:
+	.string	"__ssize_t"
+.LASF105:
+	.string	"_IO_codecvt"
+.LASF255:
+	.string	"tries"
+.LASF247:
+	.string	"writer"
+.LASF30:
+	.string	"__pthread_list_t"
+.LASF85:
+	.string	"_IO_save_end"
+.LASF137:
+	.string	"producer_waiting"
+.LASF183:
+	.string	"write"
+.LASF16:
+	.string	"__clockid_t"
+.LASF29:
+	.string	"__next"
+.LASF170:
+	.string	"eventfd"
+.LASF44:
+	.string	"__data"
+.LASF58:
+	.string	"sigset_t"
+.LASF281:
+	.string	"report_signal_leave"
+.LASF28:
+	.string	"__prev"
+.LASF158:
+	.string	"open"
+.LASF270:
+	.string	"init_files"
+.LASF94:
+	.string	"_lock"
+.LASF203:
+	.string	"time_ns"
+.LASF27:
+	.string	"__pthread_internal_list"
+.LASF169:
+	.string	"pthread_create"
+.LASF83:
+	.string	"_IO_save_base"
+.LASF279:
+	.string	"metrics_enabled"
+.LASF34:
+	.string	"__owner"
+.LASF87:
+	.string	"_chain"
+.LASF107:
+	.string	"ssize_t"
+.LASF91:
+	.string	"_cur_column"
+.LASF231:
+	.string	"set_verblevel"
+.LASF151:
+	.string	"metricsfd"
+.LASF110:
+	.string	"EFD_SEMAPHORE"
+.LASF180:
+	.string	"fileno"
+.LASF239:
+	.string	"ring_put"
+.LASF263:
+	.string	"ready"
+.LASF57:
+	.string	"sig_atomic_t"
+.LASF165:
+	.string	"usleep"
+.LASF9:
+	.string	"long int"
+.LASF253:
+	.string	"drain_rings_signal"
+.LASF184:
+	.string	"nanosleep"
+.LASF104:
+	.string	"_IO_marker"
+.LASF124:
+	.string	"head"
+.LASF122:
+	.string	"verbfile"
+.LASF213:
+	.string	"free_block"
+.LASF35:
+	.string	"__nusers"
+.LASF147:
+	.string	"free_bytes"
+.LASF121:
+	.string	"errfile"
+.LASF245:
+	.string	"__atomic_store_tmp"
+.LASF7:
+	.string	"signed char"
+.LASF113:
+	.string	"eventfd_t"
+.LASF73:
+	.string	"_IO_FILE"
+.LASF114:
+	.string	"MSG_WARN"
+.LASF106:
+	.string	"_IO_wide_data"
+.LASF31:
+	.string	"__pthread_mutex_s"
+.LASF266:
+	.string	"__atomic_exchange_ptr"
+.LASF3:
+	.string	"unsigned char"
+.LASF37:
+	.string	"__spins"
+.LASF98:
+	.string	"_freeres_list"
+.LASF161:
+	.string	"fclose"
+.LASF262:
+	.string	"waiting"
+.LASF242:
+	.string	"__atomic_load_ptr"
+.LASF156:
+	.string	"realloc"
+.LASF233:
+	.string	"report_signal_enter"
+.LASF274:
+	.string	"__builtin_va_list"
+.LASF18:
+	.string	"__syscall_slong_t"
+.LASF59:
+	.string	"__gnuc_va_list"
+.LASF72:
+	.string	"_Bool"
+.LASF187:
+	.string	"pthread_sigmask"
+.LASF212:
+	.string	"bytes"
+.LASF257:
+	.string	"wrote"
+.LASF202:
+	.string	"nbuf"
+.LASF19:
+	.string	"char"
+.LASF160:
+	.string	"strncpy"
+.LASF204:
+	.string	"set_metrics_file"
+.LASF261:
+	.string	"wait_for"
+.LASF276:
+	.string	"_IO_lock_t"
+.LASF211:
+	.string	"free_array"
+.LASF138:
+	.string	"fork_mask"
+.LASF206:
+	.string	"timep"
+.LASF278:
+	.string	"__errno_location"
+.LASF215:
+	.string	"fun_name"
+.LASF283:
+	.string	"__builtin_memcpy"
+.LASF69:
+	.string	"memory_order_acq_rel"
+.LASF75:
+	.string	"_IO_read_ptr"
+.LASF2:
+	.string	"double"
+.LASF61:
+	.string	"fp_offset"
+.LASF209:
+	.string	"init_time"
+.LASF190:
+	.string	"metric_bool"
+.LASF136:
+	.string	"writer_waiting"
+.LASF86:
+	.string	"_markers"
+.LASF236:
+	.string	"file"
+.LASF119:
+	.string	"verblevel"
+.LASF275:
+	.string	"__va_list_tag"
+.LASF186:
+	.string	"pthread_mutex_trylock"
+.LASF229:
+	.string	"prefix"
+.LASF55:
+	.string	"PTHREAD_MUTEX_ERRORCHECK"
+.LASF32:
+	.string	"__lock"
+.LASF246:
+	.string	"ring_has_room"
+.LASF227:
+	.string	"fatal"
+.LASF95:
+	.string	"_offset"
+.LASF133:
+	.string	"in_signal"
+.LASF197:
+	.string	"close_metrics_file"
+.LASF123:
+	.string	"logfile"
+.LASF120:
+	.string	"async_output"
+.LASF11:
+	.string	"__uint64_t"
+.LASF6:
+	.string	"long unsigned int"
+.LASF230:
+	.string	"set_logfile"
+.LASF164:
+	.string	"eventfd_write"
+.LASF256:
+	.string	"drain_rings"
+.LASF222:
+	.string	"format"
+.LASF40:
+	.string	"pthread_t"
+.LASF89:
+	.string	"_flags2"
+.LASF77:
+	.string	"_IO_read_base"
+.LASF63:
+	.string	"reg_save_area"
+.LASF102:
+	.string	"_unused2"
+.LASF141:
+	.string	"fail_buf"
+.LASF41:
+	.string	"__size"
+.LASF258:
+	.string	"writer_main"
+.LASF194:
+	.string	"argc"
+.LASF90:
+	.string	"_old_offset"
+.LASF210:
+	.string	"free_string"
+.LASF195:
+	.string	"argv"
+.LASF199:
+	.string	"metric_quote"
+.LASF179:
+	.string	"snprintf"
+.LASF167:
+	.string	"pthread_atfork"
+.LASF49:
+	.string	"PTHREAD_MUTEX_TIMED_NP"
+.LASF46:
+	.string	"long long int"
+.LASF249:
+	.string	"default_fatal_fun"
+.LASF64:
+	.string	"va_list"
+.LASF207:
+	.string	"current_time"
+.LASF218:
+	.string	"check_exceed"
+.LASF66:
+	.string	"memory_order_consume"
+.LASF70:
+	.string	"memory_order_seq_cst"
+.LASF15:
+	.string	"__useconds_t"
+.LASF80:
+	.string	"_IO_write_end"
+.LASF127:
+	.string	"RING_VERB"
+.LASF60:
+	.string	"gp_offset"
+.LASF149:
+	.string	"last_peak_bytes"
+.LASF68:
+	.string	"memory_order_release"
+.LASF223:
+	.string	"report_noreturn"
+.LASF112:
+	.string	"EFD_NONBLOCK"
+.LASF43:
+	.string	"pthread_attr_t"
+.LASF264:
+	.string	"count"
+.LASF235:
+	.string	"emit"
+.LASF185:
+	.string	"pthread_mutex_unlock"
+.LASF81:
+	.string	"_IO_buf_base"
+.LASF5:
+	.string	"unsigned int"
+.LASF45:
+	.string	"pthread_mutex_t"
+.LASF131:
+	.string	"drain_lock"
+.LASF146:
+	.string	"free_cnt"
+.LASF216:
+	.string	"calloc_or_fail"
+.LASF100:
+	.string	"__pad5"
+.LASF175:
+	.string	"vsnprintf"
+.LASF62:
+	.string	"overflow_arg_area"
+.LASF78:
+	.string	"_IO_write_base"
+.LASF269:
+	.string	"start_writer"
+.LASF74:
+	.string	"_flags"
+.LASF265:
+	.string	"wake"
+.LASF241:
+	.string	"first"
+.LASF101:
+	.string	"_mode"
+.LASF143:
+	.string	"mblimit"
+.LASF254:
+	.string	"pause"
+.LASF96:
+	.string	"_codecvt"
+.LASF33:
+	.string	"__count"
+.LASF219:
+	.string	"limit_bytes"
+.LASF244:
+	.string	"__atomic_store_ptr"
+.LASF171:
+	.string	"calloc"
+.LASF144:
+	.string	"allocate_cnt"
+.LASF217:
+	.string	"malloc_or_fail"
+.LASF103:
+	.string	"FILE"
+.LASF200:
+	.string	"metric_append"
+.LASF221:
+	.string	"fail_fun"
+.LASF115:
+	.string	"MSG_ERROR"
+.LASF26:
+	.string	"timespec"
+.LASF181:
+	.string	"fopen"
+.LASF188:
+	.string	"sigfillset"
+.LASF282:
+	.string	"drain_rings_main"
+.LASF50:
+	.string	"PTHREAD_MUTEX_RECURSIVE_NP"
+.LASF25:
+	.string	"long long unsigned int"
+.LASF155:
+	.string	"mopen"
+.LASF251:
+	.string	"fork_parent"
+.LASF65:
+	.string	"memory_order_relaxed"
+.LASF39:
+	.string	"__list"
+.LASF250:
+	.string	"fork_child"
+.LASF12:
+	.string	"__off_t"
+.LASF280:
+	.string	"close_logfile"
+.LASF208:
+	.string	"delta"
+.LASF129:
+	.string	"NRINGS"
+.LASF99:
+	.string	"_freeres_buf"
+.LASF128:
+	.string	"RING_LOG"
+.LASF252:
+	.string	"fork_prepare"
+.LASF126:
+	.string	"ring_t"
+.LASF14:
+	.string	"__time_t"
+.LASF225:
+	.string	"report"
+.LASF168:
+	.string	"pthread_detach"
+.LASF24:
+	.string	"clockid_t"
+.LASF205:
+	.string	"delta_time"
+.LASF20:
+	.string	"__sig_atomic_t"
+.LASF259:
+	.string	"drain_ring"
+.LASF193:
+	.string	"metric_begin"
+.LASF84:
+	.string	"_IO_backup_base"
+.LASF93:
+	.string	"_shortbuf"
+.LASF226:
+	.string	"report_event"
+.LASF152:
+	.string	"mbuf"
+.LASF172:
+	.string	"malloc"
+.LASF42:
+	.string	"__align"
+.LASF13:
+	.string	"__off64_t"
+.LASF140:
+	.string	"put_len"
+.LASF173:
+	.string	"fputc"
+.LASF176:
+	.string	"fputs"
+.LASF237:
+	.string	"ring"
+.LASF82:
+	.string	"_IO_buf_end"
+.LASF271:
+	.string	"efile"
+.LASF51:
+	.string	"PTHREAD_MUTEX_ERRORCHECK_NP"
+.LASF268:
+	.string	"__atomic_exchange_tmp"
+.LASF220:
+	.string	"request_bytes"
+.LASF267:
+	.string	"__atomic_exchange_val"
+.LASF53:
+	.string	"PTHREAD_MUTEX_NORMAL"
+.LASF198:
+	.string	"file_name"
+.LASF52:
+	.string	"PTHREAD_MUTEX_ADAPTIVE_NP"
+.LASF243:
+	.string	"__atomic_load_tmp"
+.LASF8:
+	.string	"short int"
+.LASF192:
+	.string	"metric_int"
+.LASF109:
+	.string	"uint64_t"
+.LASF182:
+	.string	"pthread_mutex_lock"
+.LASF23:
+	.string	"tv_nsec"
+.LASF201:
+	.string	"nsize"
+.LASF166:
+	.string	"atexit"
+.LASF92:
+	.string	"_vtable_offset"
+.LASF191:
+	.string	"metric_double"
+.LASF38:
+	.string	"__elision"
+.LASF232:
+	.string	"new_bytes"
+.LASF56:
+	.string	"PTHREAD_MUTEX_DEFAULT"
+.LASF47:
+	.string	"__val"
+.LASF116:
+	.string	"MSG_FATAL"
+.LASF135:
+	.string	"space_fd"
+.LASF177:
+	.string	"strlen"
+.LASF10:
+	.string	"__int64_t"
+.LASF130:
+	.string	"rings"
+.LASF150:
+	.string	"current_bytes"
+.LASF153:
+	.string	"mlen"
+.LASF162:
+	.string	"memcpy"
+.LASF272:
+	.string	"vfile"
+.LASF76:
+	.string	"_IO_read_end"
+.LASF117:
+	.string	"message_t"
+.LASF88:
+	.string	"_fileno"
+.LASF163:
+	.string	"eventfd_read"
+.LASF97:
+	.string	"_wide_data"
+.LASF277:
+	.string	"free"
+.LASF132:
+	.string	"writer_started"
+.LASF234:
+	.string	"report_flush"
+.LASF4:
+	.string	"short unsigned int"
+.LASF118:
+	.string	"stdout"
+.LASF145:
+	.string	"allocate_bytes"
+.LASF248:
+	.string	"rings_pending"
+.LASF79:
+	.string	"_IO_write_ptr"
+.LASF159:
+	.string	"clock_gettime"
+.LASF148:
+	.string	"peak_bytes"
+.LASF108:
+	.string	"int64_t"
+.LASF178:
+	.string	"exit"
+.LASF71:
+	.string	"atomic_bool"
+.LASF111:
+	.string	"EFD_CLOEXEC"
+.LASF273:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O1 -fasynchronous-unwind-tables"
+.LASF214:
+	.string	"strsave_or_fail"
+.LASF48:
+	.string	"__sigset_t"
+.LASF240:
+	.string	"data"
+.LASF157:
+	.string	"close"
+.LASF189:
+	.string	"fflush"
+.LASF22:
+	.string	"tv_sec"
+.LASF154:
+	.string	"msize"
+.LASF174:
+	.string	"vfprintf"
+.LASF139:
+	.string	"put_ring"
+.LASF54:
+	.string	"PTHREAD_MUTEX_RECURSIVE"
+.LASF238:
+	.string	"newline"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"report.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+
+import argparse
+import os
+import pathlib
+import subprocess
+import tempfile
+import time
+
+# Generators of benchmark traces.  Each yields n command lines.
+
+
+def dispatch(n):
+    """Cheap commands and options, to expose parsing and dispatch cost"""
+    lines = [
+        "option verbose 0",
+        "option echo 0",
+        "option error 5",
+        "option length 1024",
+        "option fail 30",
+        "option malloc 0",
+        "# comment line",
+        "option simulation 0",
+    ]
+    for i in range(n):
+        yield lines[i % len(lines)]
+
+
+def ops(n):
+    """Queue operations on a short queue"""
+    lines = ["ih dolphin", "it gerbil", "rhq", "rhq", "size"]
+    yield "option fail 0"
+    yield "new"
+    for i in range(n - 2):
+        yield lines[i % len(lines)]
+
+
+WORKLOADS = {
+    "dispatch": dispatch,
+    "ops": ops,
+}
+
+
+class Bench:
+    def __init__(self, programs, repeat, compiled):
+        self.programs = programs
+        self.repeat = repeat
+        self.compiled = compiled
+
+    def time_trace(self, program, fname):
+        args = [program, "-v", "0", "-f", fname]
+        if self.compiled:
+            # Compile outside the timed runs
+            bname = fname + ".qbc"
+            subprocess.run(args + ["-o", bname], stdout=subprocess.DEVNULL,
+                           check=False)
+            args = [program, "-v", "0", "-b", bname]
+        best = None
+        for _ in range(self.repeat):
+            start = time.perf_counter()
+            subprocess.run(args, stdout=subprocess.DEVNULL, check=False)
+            elapsed = time.perf_counter() - start
+            best = elapsed if best is None else min(best, elapsed)
+        if self.compiled:
+            os.unlink(bname)
+        return best
+
+    def run(self, workload, n):
+        with tempfile.NamedTemporaryFile("w", suffix=".cmd",
+                                         delete=False) as f:
+            for line in WORKLOADS[workload](n):
+                f.write(line + "\n")
+            fname = f.name
+        try:
+            for program in self.programs:
+                elapsed = self.time_trace(program, fname)
+                print("%-10s %-20s %10d lines %8.3f s %8.1f ns/line" %
+                      (workload, program, n, elapsed, 1e9 * elapsed / n))
+        finally:
+            os.unlink(fname)
+
+
+if __name__ == "__main__":
+    ROOT = str(pathlib.Path(__file__).resolve().parents[1])
+
+    parser = argparse.ArgumentParser(
+        description="Time qtest on generated traces")
+    parser.add_argument("-p", "--prog", dest="programs", action="append",
+                        help="Program to time (repeat to compare builds)")
+    parser.add_argument("-w", "--workload", choices=sorted(WORKLOADS),
+                        action="append", help="Workload to run (default: all)")
+    parser.add_argument("-n", "--lines", type=int, default=1000000,
+                        help="Number of lines per trace")
+    parser.add_argument("-r", "--repeat", type=int, default=3,
+                        help="Report best of this many runs")
+    parser.add_argument("-b", "--compiled", action="store_true",
+                        help="Replay traces compiled with qtest -o")
+    args = parser.parse_args()
+
+    os.chdir(ROOT)
+    bench = Bench(args.programs or ["./qtest"], args.repeat, args.compiled)
+    for w in args.workload or sorted(WORKLOADS):
+        bench.run(w, args.lines)
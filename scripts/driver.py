@@ -4,6 +4,9 @@ from __future__ import print_function
 import subprocess
 import sys
 import getopt
+import json
+import os
+import tempfile
 
 
 
@@ -17,6 +20,8 @@ class Tracer:
     autograde = False
     useValgrind = False
     colored = False
+    metricsFile = None
+    metrics = {}
 
     traceDict = {
         1: "trace-01-ops",
@@ -69,13 +74,16 @@ class Tracer:
                  verbLevel=0,
                  autograde=False,
                  useValgrind=False,
-                 colored=False):
+                 colored=False,
+                 metricsFile=None):
         if qtest != "":
             self.qtest = qtest
         self.verbLevel = verbLevel
         self.autograde = autograde
         self.useValgrind = useValgrind
         self.colored = colored
+        self.metricsFile = metricsFile
+        self.metrics = {}
 
     def printInColor(self, text, color):
         if self.colored == False:
@@ -89,14 +97,33 @@ class Tracer:
         fname = "%s/%s.cmd" % (self.traceDirectory, self.traceDict[tid])
         vname = "%d" % self.verbLevel
         clist = self.command + ["-v", vname, "-f", fname]
-        
+        if self.metricsFile:
+            fd, jname = tempfile.mkstemp(suffix=".json")
+            os.close(fd)
+            clist += ["-j", jname]
+
         try:
             retcode = subprocess.call(clist)
         except Exception as e:
             self.printInColor("Call of '%s' failed: %s" % (" ".join(clist), e), self.RED)
-            return False
+            retcode = None
+        if self.metricsFile:
+            self.collectMetrics(tid, jname, retcode == 0)
         return retcode == 0
 
+    def collectMetrics(self, tid, jname, ok):
+        records = []
+        try:
+            with open(jname) as f:
+                for line in f:
+                    records.append(json.loads(line))
+        except (OSError, ValueError) as e:
+            self.printInColor("Couldn't read metrics for %s: %s" %
+                              (self.traceDict[tid], e), self.RED)
+        finally:
+            os.unlink(jname)
+        self.metrics[self.traceDict[tid]] = {"ok": ok, "records": records}
+
     def run(self, tid=0):
         scoreDict = {k: 0 for k in self.traceDict.keys()}
         print("---\tTrace\t\tPoints")
@@ -142,14 +169,19 @@ class Tracer:
                 jstring += '"%s" : %d' % (self.traceProbs[k], scoreDict[k])
             jstring += '}}'
             print(jstring)
+        if self.metricsFile:
+            with open(self.metricsFile, "w") as f:
+                json.dump({"traces": self.metrics}, f, indent=1)
+                f.write("\n")
 
 
 def usage(name):
-    print("Usage: %s [-h] [-p PROG] [-t TID] [-v VLEVEL] [--valgrind] [-c]" % name)
+    print("Usage: %s [-h] [-p PROG] [-t TID] [-v VLEVEL] [-j JFILE] [--valgrind] [-c]" % name)
     print("  -h        Print this message")
     print("  -p PROG   Program to test")
     print("  -t TID    Trace ID to test")
     print("  -v VLEVEL Set verbosity level (0-3)")
+    print("  -j JFILE  Collect per-command metrics of each trace into JFILE")
     print("  -c Enable colored text")
     sys.exit(0)
 
@@ -162,8 +194,9 @@ def run(name, args):
     autograde = False
     useValgrind = False
     colored = False
+    metricsFile = None
 
-    optlist, args = getopt.getopt(args, 'hp:t:v:A:c', ['valgrind'])
+    optlist, args = getopt.getopt(args, 'hp:t:v:A:cj:', ['valgrind'])
     for (opt, val) in optlist:
         if opt == '-h':
             usage(name)
@@ -180,6 +213,8 @@ def run(name, args):
             useValgrind = True
         elif opt == '-c':
             colored = True
+        elif opt == '-j':
+            metricsFile = val
         else:
             print("Unrecognized option '%s'" % opt)
             usage(name)
@@ -189,7 +224,8 @@ def run(name, args):
                verbLevel=vlevel,
                autograde=autograde,
                useValgrind=useValgrind,
-               colored=colored)
+               colored=colored,
+               metricsFile=metricsFile)
     t.run(tid)
 
 
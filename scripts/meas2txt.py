@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+
+"""Convert a measurement file written with "option write 1" to text.
+
+Prints one "class ticks" line per measurement, as the old ./meas.txt did.
+With -H, each segment starts with a "# key: value" line per header field.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"DUDECTMF"
+# Layout of meas_header_t and meas_record_t in dudect/measfile.h
+HEADER = struct.Struct("=8s10IQ32s64s")
+RECORD = struct.Struct("=qIB3x")
+FIELDS = [
+    "version",
+    "header_size",
+    "record_size",
+    "op",
+    "timer",
+    "cpu",
+    "batch_size",
+    "drop_size",
+    "total_measurements",
+    "reserved",
+    "records",
+    "op_name",
+    "cpu_model",
+]
+
+
+def segments(data):
+    """Yield (header, records) for each segment of data"""
+    pos = 0
+    while pos < len(data):
+        if len(data) - pos < HEADER.size:
+            sys.exit("Truncated header at offset %d" % pos)
+        values = HEADER.unpack_from(data, pos)
+        if values[0] != MAGIC:
+            sys.exit("Bad magic at offset %d" % pos)
+        header = dict(zip(FIELDS, values[1:]))
+        header["cpu"] = struct.unpack("=i", struct.pack("=I", header["cpu"]))[0]
+        for key in ("op_name", "cpu_model"):
+            header[key] = header[key].split(b"\0")[0].decode(errors="replace")
+        if header["record_size"] != RECORD.size:
+            sys.exit("Unknown record size %d" % header["record_size"])
+        pos += header["header_size"]
+        count = header["records"]
+        if count == 0:
+            # Interrupted test, which is the last of its run: records run
+            # to the end of the file
+            count = (len(data) - pos) // RECORD.size
+        yield header, RECORD.iter_unpack(data[pos:pos + count * RECORD.size])
+        pos += count * RECORD.size
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", nargs="?", default="meas.bin")
+    parser.add_argument("-o", "--output", default="-",
+                        help="Text file to write (default: standard output)")
+    parser.add_argument("-H", "--header", action="store_true",
+                        help="Print the header of each segment")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+    for header, records in segments(data):
+        if args.header:
+            for key in FIELDS:
+                out.write("# %s: %s\n" % (key, header[key]))
+        for ticks, length, cls in records:
+            out.write("%d %d\n" % (cls, ticks))
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()